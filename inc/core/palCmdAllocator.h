@@ -59,7 +59,30 @@ union CmdAllocatorCreateFlags
                                               ///  not returned to the allocator before the GPU has finished processing
                                               ///  them.  Failure to guarantee this will result in undefined behavior.
                                               ///  This flag has no effect if @ref autoMemoryReuse is not set.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        uint32 perThreadChunkCache      :  1; ///< If set, each thread which records into command buffers using this
+                                              ///  allocator keeps a small private cache of free command chunks.  The
+                                              ///  caches are refilled from and drained to the shared chunk pool in
+                                              ///  batches so that most chunk acquires and releases do not take the
+                                              ///  allocator's lock.  Idle chunks held in one thread's cache are not
+                                              ///  visible to other threads until @ref ICmdAllocator::Reset() is called.
+                                              ///  This flag has no effect if @ref threadSafe is not set.
+        uint32 backgroundReclaim        :  1; ///< If set, the allocator creates a worker thread which periodically
+                                              ///  moves command chunks the GPU has finished with back onto the free
+                                              ///  list and frees idle allocations in excess of each allocation type's
+                                              ///  reclaimHighWaterMark.  This keeps busy-tracker polling off of the
+                                              ///  recording threads and lets long-running processes return memory after
+                                              ///  a spike in command buffer usage.  This flag has no effect unless both
+                                              ///  @ref threadSafe and @ref autoMemoryReuse are set.
+        uint32 sysMemHugePages          :  1; ///< If set, the allocator asks the OS to back the system-memory
+                                              ///  allocations it makes for command data (used when command buffers are
+                                              ///  built in system memory) with transparent huge pages.  This cuts the
+                                              ///  number of page faults taken while recording at the cost of coarser
+                                              ///  memory usage.  It is only a hint and has no effect on GPU memory.
+        uint32 reserved                 : 26; ///< Reserved for future use.
+#else
         uint32 reserved                 : 29; ///< Reserved for future use.
+#endif
     };
 
     uint32     u32All;          ///< Flags packed as 32-bit uint.
@@ -93,7 +116,25 @@ struct CmdAllocatorCreateInfo
                                           ///  command buffers.  It must be an integer multiple of 4096.
                                           ///  Must be greater than zero even if the client doesn't plan on using this
                                           ///  allocation type.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        uint32              reclaimHighWaterMark; ///< If @ref CmdAllocatorCreateFlags::backgroundReclaim is set,
+                                                  ///  the reclaim worker will free allocations of this type whose
+                                                  ///  chunks are all idle until at most this many allocations remain.
+                                                  ///  Zero disables trimming.
+#endif
     } allocInfo[CmdAllocatorTypeCount];   ///< Information for each allocation type.
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    uint32 reclaimIntervalMs;             ///< Milliseconds between the reclaim worker's sweeps if
+                                          ///  @ref CmdAllocatorCreateFlags::backgroundReclaim is set.  Zero selects a
+                                          ///  default interval.
+
+    uint32 prefaultChunkCount;            ///< Number of free chunks of each allocation type the allocator keeps
+                                          ///  pre-faulted ahead of the chunks it hands out, so that command buffers
+                                          ///  don't take CPU page faults the first time they write to a chunk.  Chunks
+                                          ///  are pre-faulted once in their lifetime, by the reclaim worker if there is
+                                          ///  one and otherwise when a chunk is acquired.  Zero disables pre-faulting.
+#endif
 };
 
 /**
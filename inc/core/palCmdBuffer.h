@@ -64,6 +64,7 @@ class      IMsaaState;
 class      IPerfExperiment;
 class      IQueue;
 class      IScissorState;
+class      IStateBlock;
 class      IViewportState;
 class      IQueryPool;
 enum class PerfTraceMarkerType : uint32;
@@ -1098,6 +1099,44 @@ struct DrawIndexedIndirectArgs
                            ///  firstInstance to firstInstance + instanceCount - 1.
 };
 
+/// Specifies one draw of a batch of draws issued by @ref ICmdBuffer::CmdDrawBatch().
+///
+/// The draw uses the same parameters as @ref ICmdBuffer::CmdDraw() or @ref ICmdBuffer::CmdDrawIndexed() would, and can
+/// update a range of graphics user-data entries beforehand, as if @ref ICmdBuffer::CmdSetUserData() had been called.
+struct DrawBatchEntry
+{
+    uint32        first;              ///< Starting vertex (non-indexed batches) or index buffer slot (indexed batches).
+    uint32        count;              ///< Number of vertices (non-indexed batches) or indices (indexed batches) to
+                                      ///  draw.  If zero, the draw will be discarded.
+    int32         vertexOffset;       ///< Offset added to the index fetched from the index buffer before it is passed
+                                      ///  to the vertex shader.  Ignored by non-indexed batches.
+    uint32        firstInstance;      ///< Starting instance for the draw.
+    uint32        instanceCount;      ///< Number of instances to draw.  If zero, the draw will be discarded.
+    uint32        firstUserDataEntry; ///< First graphics user-data entry to update before the draw.
+    uint32        userDataEntryCount; ///< Number of graphics user-data entries to update before the draw.  Zero means
+                                      ///  the draw doesn't update any user-data entries.
+    const uint32* pUserDataEntries;   ///< New values for the user-data entries.  Must contain userDataEntryCount
+                                      ///  values.
+};
+
+/// Input structure to @ref ICmdBuffer::CmdDrawBatch().  Specifies a batch of draws which share all graphics state
+/// except for some user-data entries.
+struct DrawBatchInfo
+{
+    union
+    {
+        struct
+        {
+            uint32 indexed  :  1;   ///< The draws are indexed draws using the currently bound index buffer.
+            uint32 reserved : 31;   ///< Reserved for future use.
+        };
+        uint32 u32All;              ///< Flags packed as 32-bit uint.
+    } flags;                        ///< Flags which apply to every draw in the batch.
+
+    uint32                drawCount; ///< Number of draws in the batch (i.e., size of the pDraws array).
+    const DrawBatchEntry* pDraws;    ///< Array of draws.  They are issued in array order.
+};
+
 /// Specifies layout of GPU memory used as an input to CmdDispatchIndirect.
 struct DispatchIndirectArgs
 {
@@ -1769,6 +1808,17 @@ public:
     virtual void CmdBindDepthStencilState(
         const IDepthStencilState* pDepthStencilState) = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    /// Binds all of the state contained in the specified state block to the current command buffer state.
+    ///
+    /// This is equivalent to individually binding each state object and setting the viewports and scissor rectangles
+    /// which were specified when the state block was created, but writes all of the state with a single copy.
+    ///
+    /// @param [in] pStateBlock State block to be bound.  Must not be null.
+    virtual void CmdBindStateBlock(
+        const IStateBlock* pStateBlock) = 0;
+#endif
+
     /// Sets the value range to be used for depth bounds testing.
     ///
     /// The depth bounds test is enabled in the graphics pipeline.  When enabled, an additional check will be done that
@@ -2209,6 +2259,22 @@ public:
         m_funcTable.pfnCmdDrawIndexedIndirectMulti(this, gpuMemory, offset, stride, maximumCount, countGpuAddr);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    /// Issues a batch of draws using the command buffer's currently bound graphics state.  This is equivalent to
+    /// calling @ref ICmdBuffer::CmdSetUserData() with the graphics bind point (for draws which update user-data
+    /// entries) followed by @ref ICmdBuffer::CmdDraw() or @ref ICmdBuffer::CmdDrawIndexed() once for each draw, in
+    /// array order.
+    ///
+    /// Because no other state can change between the draws of a batch, PAL validates the bound state once for the whole
+    /// batch and then only writes the per-draw user-data updates and draw parameters, which makes this considerably
+    /// cheaper on the CPU than issuing the draws one at a time.  The user-data entries updated by the batch keep their
+    /// last values afterwards.
+    ///
+    /// @param [in] batchInfo  Draws to issue and flags describing them.
+    virtual void CmdDrawBatch(
+        const DrawBatchInfo& batchInfo) = 0;
+#endif
+
     /// Dispatches a compute workload of the given dimensions using the command buffer's currently bound compute state.
     ///
     /// The thread group size is defined in the compute shader.
@@ -3336,6 +3402,33 @@ public:
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    /// Marks the current position in this command buffer as the place where the commands of a group of "secondary
+    /// segments" will execute.  Segments split the recording of one logical command buffer across several threads: each
+    /// segment is recorded on its own thread, concurrently with the other segments and with any commands recorded into
+    /// this command buffer after this call.  The segments' command chunks are stitched into this command buffer's
+    /// command streams using chain packets when @ref ICmdBuffer::End() is called on this command buffer, so executing
+    /// them costs no more than executing commands recorded directly into this command buffer.
+    ///
+    /// Segments are nested command buffers built with the optimizeExclusiveSubmit flag.  They must call
+    /// @ref ICmdBuffer::Begin() with pStateInheritCmdBuffer set to this command buffer before this call is made, so
+    /// that every segment starts from this command buffer's current state.  The segments must all be ended before
+    /// this command buffer is ended and they must not be reset or begun again until this command buffer is no longer
+    /// in use.  Each segment may only be inserted into one command buffer, once.
+    ///
+    /// Unlike nested command buffers, segments do not leak any state back into this command buffer.  Commands recorded
+    /// after this call observe the render and resource-binding state which was current when this call was made; PAL
+    /// re-establishes that state after the last segment executes.
+    ///
+    /// Only universal command buffers support segments.
+    ///
+    /// @param [in] segmentCount  Number of segments to insert (i.e., size of the ppSegments array).
+    /// @param [in] ppSegments    Array of segments.  They execute in array order.
+    virtual void CmdInsertSegments(
+        uint32            segmentCount,
+        ICmdBuffer*const* ppSegments) = 0;
+#endif
+
     /// Saves a copy of some set of the current command buffer state that is used by compute workloads. This feature is
     /// intended to give PAL clients a convenient way to issue their own internal compute workloads without modifying
     /// the application-facing state.
@@ -193,6 +193,14 @@ struct BarrierOperations
         uint16 u16All; ///< Unsigned integer containing all the values.
 
     } caches; ///< Information about cache operations performed for the barrier.
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    struct
+    {
+        uint16 barriersCoalesced; ///< Number of earlier barriers whose syncs were merged into this barrier's syncs.
+        uint16 drainsSaved;       ///< Number of pipeline drains (EOP waits and partial flushes) avoided by merging.
+    } coalescing; ///< Information about sync operations shared with the previous barrier in the command buffer.
+#endif
 };
 
 /// Enumeration for PAL barrier reasons
@@ -413,6 +421,43 @@ struct BindPipelineData
 };
 
 #if PAL_BUILD_PM4_INSTRUMENTOR
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+/// Stages of draw-time validation which are profiled separately.
+enum class DrawValidationStage : uint32
+{
+    Pipeline = 0,    ///< Writing the state of a newly bound pipeline.
+    UserData,        ///< Validating user-data entries.
+    Viewports,       ///< Validating the viewport state.
+    ScissorRects,    ///< Validating the scissor-rect state.
+    DrawTimeHwState, ///< Validating the per-draw hardware state (index buffer, instance count, etc.).
+    Other,           ///< All other draw-time validation.
+    Count
+};
+
+/// Flags identifying which specialization of draw-time validation handled a draw.  Every combination of these flags is
+/// a distinct specialization.
+enum DrawValidationSpecialization : uint32
+{
+    DrawValidationIndexed             = 0x01, ///< The draw is indexed.
+    DrawValidationIndirect            = 0x02, ///< The draw is indirect.
+    DrawValidationPm4OptImmediate     = 0x04, ///< The immediate-mode PM4 optimizer is enabled.
+    DrawValidationPipelineDirty       = 0x08, ///< The pipeline changed since the previous draw.
+    DrawValidationStateDirty          = 0x10, ///< Some other validated state changed since the previous draw.
+    DrawValidationNgg                 = 0x20, ///< The pipeline uses NGG.
+    DrawValidationNggFastLaunch       = 0x40, ///< The pipeline uses NGG fast launch.
+    DrawValidationSpecializationCount = 0x80, ///< Number of distinct specializations.
+};
+
+/// CPU time and PM4 footprint of a single draw's validation, broken down by stage.
+struct DrawValidationProfile
+{
+    uint32 specialization;                                                ///< DrawValidationSpecialization mask.
+    uint32 stageCalls[static_cast<uint32>(DrawValidationStage::Count)];   ///< Times each stage ran for this draw.
+    int64  stageTicks[static_cast<uint32>(DrawValidationStage::Count)];   ///< CPU ticks spent in each stage.
+    uint32 stageCmdSize[static_cast<uint32>(DrawValidationStage::Count)]; ///< PM4 bytes written by each stage.
+};
+#endif
+
 /// Information for DrawDispatchValidation callbacks
 struct DrawDispatchValidationData
 {
@@ -420,6 +465,11 @@ struct DrawDispatchValidationData
     uint32      pipelineCmdSize;    ///< Size of PM4 commands used to validate the current pipeline state (bytes).
     uint32      userDataCmdSize;    ///< Size of PM4 commands used to validate the current user-data entries (bytes).
     uint32      miscCmdSize;        ///< Size of PM4 commands for all other draw- or dispatch-time validation (bytes).
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    /// Per-stage profile of the draw's validation, or null if the command buffer doesn't profile this validation.  Only
+    /// valid for the duration of the callback.
+    const DrawValidationProfile* pProfile;
+#endif
 };
 
 /// Information for OptimizedRegisters callbacks
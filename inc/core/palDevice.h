@@ -64,6 +64,7 @@ class  IPrivateScreen;
 class  IQueryPool;
 class  IQueue;
 class  IQueueSemaphore;
+class  IStateBlock;
 class  ISwapChain;
 struct BorderColorPaletteCreateInfo;
 struct CmdAllocatorCreateInfo;
@@ -97,6 +98,7 @@ struct QueryPoolCreateInfo;
 struct QueueCreateInfo;
 struct QueueSemaphoreCreateInfo;
 struct QueueSemaphoreOpenInfo;
+struct StateBlockCreateInfo;
 struct SwapChainCreateInfo;
 struct SwapChainProperties;
 struct SvmGpuMemoryCreateInfo;
@@ -3978,6 +3980,40 @@ public:
         void*                              pPlacementAddr,
         IDepthStencilState**               ppDepthStencilState) const = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    /// Determines the amount of system memory required for a state block object.  An allocation of this amount of
+    /// memory must be provided in the pPlacementAddr parameter of CreateStateBlock().
+    ///
+    /// @param [in]  createInfo State block creation properties.
+    /// @param [out] pResult    The validation result if pResult is non-null. This argument can be null to avoid
+    ///                         the additional validation.
+    ///
+    /// @returns Size, in bytes, of system memory required for an @ref IStateBlock object with the specified
+    ///          properties.  A return value of 0 indicates the createInfo was invalid.
+    virtual size_t GetStateBlockSize(
+        const StateBlockCreateInfo& createInfo,
+        Result*                     pResult) const = 0;
+
+    /// Creates an @ref IStateBlock object with the requested properties.
+    ///
+    /// @param [in]  createInfo     Properties of the state block object to create.
+    /// @param [in]  pPlacementAddr Pointer to the location where PAL should construct this object.  There must be as
+    ///                             much size available here as reported by calling GetStateBlockSize() with the same
+    ///                             createInfo param.
+    /// @param [out] ppStateBlock   Constructed state block object.  When successful, the returned address will be the
+    ///                             same as specified in pPlacementAddr.
+    ///
+    /// @returns Success if the state block was successfully created.  Otherwise, one of the following errors may be
+    ///          returned:
+    ///          + ErrorInvalidPointer if pPlacementAddr or ppStateBlock is null.
+    ///          + ErrorInvalidValue if the viewport or scissor rectangle count is out of range.
+    ///          + ErrorUnavailable if the device does not support state blocks.
+    virtual Result CreateStateBlock(
+        const StateBlockCreateInfo& createInfo,
+        void*                       pPlacementAddr,
+        IStateBlock**               ppStateBlock) const = 0;
+#endif
+
     /// Determines the amount of system memory required for a queue semaphore object.  An allocation of this amount of
     /// memory must be provided in the pPlacementAddr parameter of CreateQueueSemaphore().
     ///
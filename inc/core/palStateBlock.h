@@ -0,0 +1,112 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palStateBlock.h
+ * @brief Defines the Platform Abstraction Library (PAL) IStateBlock interface and related types.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "pal.h"
+#include "palCmdBuffer.h"
+#include "palDestroyable.h"
+
+namespace Pal
+{
+
+// Forward declarations.
+class IColorBlendState;
+class IDepthStencilState;
+class IMsaaState;
+
+/// Specifies properties for creation of an @ref IStateBlock object.  Input structure to IDevice::CreateStateBlock().
+///
+/// Every member is optional; state which is not specified is left untouched when the state block is bound.
+struct StateBlockCreateInfo
+{
+    const IMsaaState*         pMsaaState;         ///< MSAA state object to bind, or null.
+    const IColorBlendState*   pColorBlendState;   ///< Color/blend state object to bind, or null.
+    const IDepthStencilState* pDepthStencilState; ///< Depth/stencil state object to bind, or null.
+    const ViewportParams*     pViewports;         ///< Viewports to set, or null.  Copied into the state block.
+    const ScissorRectParams*  pScissorRects;      ///< Scissor rectangles to set, or null.  Copied into the state block.
+};
+
+/**
+ ***********************************************************************************************************************
+ * @interface IStateBlock
+ * @brief     Pre-built combination of dynamic state objects which can be bound to a command buffer in a single call.
+ *
+ * The PM4 commands for all of the contained state objects are baked into a single image when the state block is
+ * created, so binding it costs one copy instead of one bind per state object.  Binding a state block is equivalent to
+ * binding each of its state objects and setting its viewports and scissor rectangles individually, so the state
+ * objects it references must not be destroyed while the state block is in use.
+ *
+ * @see IDevice::CreateStateBlock
+ * @see ICmdBuffer::CmdBindStateBlock
+ ***********************************************************************************************************************
+ */
+class IStateBlock : public IDestroyable
+{
+public:
+
+    /// Returns the value of the associated arbitrary client data pointer.
+    /// Can be used to associate arbitrary data with a particular PAL object.
+    ///
+    /// @returns Pointer to client data.
+    PAL_INLINE void* GetClientData() const
+    {
+        return m_pClientData;
+    }
+
+    /// Sets the value of the associated arbitrary client data pointer.
+    /// Can be used to associate arbitrary data with a particular PAL object.
+    ///
+    /// @param  [in]    pClientData     A pointer to arbitrary client data.
+    PAL_INLINE void SetClientData(
+        void* pClientData)
+    {
+        m_pClientData = pClientData;
+    }
+
+protected:
+    /// @internal Constructor. Prevent use of new operator on this interface. Client must create objects by explicitly
+    /// called the proper create method.
+    IStateBlock() : m_pClientData(nullptr) {}
+
+    /// @internal Destructor.  Prevent use of delete operator on this interface.  Client must destroy objects by
+    /// explicitly calling IDestroyable::Destroy() and is responsible for freeing the system memory allocated for the
+    /// object on their own.
+    virtual ~IStateBlock() { }
+
+private:
+    /// @internal Client data pointer. This can have an arbitrary value and can be returned by calling GetClientData()
+    /// and set via SetClientData().
+    /// For non-top-layer objects, this will point to the layer above the current object.
+    void* m_pClientData;
+};
+
+} // Pal
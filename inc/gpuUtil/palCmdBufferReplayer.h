@@ -0,0 +1,219 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palCmdBufferReplayer.h
+ * @brief PAL GPU utility CmdBufferReplayer class and the binary command buffer capture format it consumes.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palDevice.h"
+#include "palVector.h"
+
+// Forward declarations.
+namespace Pal
+{
+class ICmdAllocator;
+class ICmdBuffer;
+class IDestroyable;
+class IPlatform;
+}
+
+namespace GpuUtil
+{
+
+/// Definitions of the binary command buffer capture format.
+///
+/// A capture is written by the interface logger layer when InterfaceLoggerConfig.BinaryCapture is set.  The file
+/// begins with a @ref FileHeader followed by a tightly packed sequence of records.  Each record is a
+/// @ref RecordHeader followed by exactly RecordHeader::size bytes of payload.  Payloads contain PAL interface
+/// structures copied verbatim with their pointers cleared; referenced objects are written separately as capture IDs.
+/// A capture can therefore only be replayed by a build of PAL with the same client interface version and pointer size.
+namespace CmdCapture
+{
+
+constexpr Pal::uint32 FileMagic    = 0x434C4150;  ///< "PALC" in little-endian byte order.
+constexpr Pal::uint32 FileVersion  = 1;           ///< Incremented whenever the record layouts change.
+constexpr Pal::uint32 NullObjectId = 0xFFFFFFFF;  ///< Capture ID used in place of a null object pointer.
+
+/// Identifies the PAL interface call a record represents.  Capture IDs are zero-based and dense per object type (all
+/// pipelines share one ID space).  Unless noted otherwise, RecordHeader::objectId is the capture ID of the command
+/// buffer the call was made on.  Payload layouts are listed in order.
+enum class Func : Pal::uint32
+{
+    CreateCmdAllocator = 0,     ///< objectId: new allocator.  CmdAllocatorCreateInfo.
+    CreateCmdBuffer,            ///< objectId: new command buffer.  CmdBufferCreateInfo, uint32 allocator ID.
+    CreateComputePipeline,      ///< objectId: new pipeline.  ComputePipelineCreateInfo, pipeline ELF.
+    CreateGraphicsPipeline,     ///< objectId: new pipeline.  GraphicsPipelineCreateInfo, pipeline ELF.
+    CreateMsaaState,            ///< objectId: new state.  MsaaStateCreateInfo.
+    CreateColorBlendState,      ///< objectId: new state.  ColorBlendStateCreateInfo.
+    CreateDepthStencilState,    ///< objectId: new state.  DepthStencilStateCreateInfo.
+    CmdBufferBegin,             ///< CmdBufferBuildFlags.
+    CmdBufferEnd,               ///< No payload.
+    CmdBufferReset,             ///< uint32 allocator ID, uint32 returnGpuMemory.
+    CmdBindPipeline,            ///< PipelineBindPoint, uint32 pipeline ID, uint64 apiPsoHash.
+    CmdBindMsaaState,           ///< uint32 state ID.
+    CmdBindColorBlendState,     ///< uint32 state ID.
+    CmdBindDepthStencilState,   ///< uint32 state ID.
+    CmdSetUserData,             ///< PipelineBindPoint, uint32 firstEntry, uint32 entryCount, uint32[entryCount].
+    CmdSetVertexBuffers,        ///< uint32 firstBuffer, uint32 bufferCount, BufferViewInfo[bufferCount].
+    CmdBindIndexData,           ///< gpusize gpuAddr, uint32 indexCount, IndexType.
+    CmdSetBlendConst,           ///< BlendConstParams.
+    CmdSetInputAssemblyState,   ///< InputAssemblyStateParams.
+    CmdSetTriangleRasterState,  ///< TriangleRasterStateParams.
+    CmdSetPointLineRasterState, ///< PointLineRasterStateParams.
+    CmdSetDepthBiasState,       ///< DepthBiasParams.
+    CmdSetDepthBounds,          ///< DepthBoundsParams.
+    CmdSetStencilRefMasks,      ///< StencilRefMaskParams.
+    CmdSetViewports,            ///< ViewportParams.
+    CmdSetScissorRects,         ///< ScissorRectParams.
+    CmdSetGlobalScissor,        ///< GlobalScissorParams.
+    CmdBarrier,                 ///< BarrierInfo, HwPipePoint[pipePointWaitCount], BarrierTransition[transitionCount].
+                                ///  Only memory transitions are captured; GPU event and target waits are dropped.
+    CmdDraw,                    ///< uint32 firstVertex, vertexCount, firstInstance, instanceCount.
+    CmdDrawIndexed,             ///< uint32 firstIndex, indexCount, int32 vertexOffset, uint32 firstInstance,
+                                ///  instanceCount.
+    CmdDispatch,                ///< uint32 x, y, z.
+    CmdDispatchOffset,          ///< uint32 xOffset, yOffset, zOffset, xDim, yDim, zDim.
+    Count
+};
+
+/// Header at the start of every capture file.
+struct FileHeader
+{
+    Pal::uint32 magic;                  ///< Must be @ref FileMagic.
+    Pal::uint32 version;                ///< Must be @ref FileVersion.
+    Pal::uint32 interfaceMajorVersion;  ///< PAL_CLIENT_INTERFACE_MAJOR_VERSION of the capturing build.
+    Pal::uint32 pointerSize;            ///< sizeof(void*) in the capturing build.
+};
+
+/// Header preceding every record's payload.
+struct RecordHeader
+{
+    Pal::uint32 size;      ///< Size of the payload in bytes, not including this header.
+    Func        func;      ///< Which interface call this record represents.
+    Pal::uint32 objectId;  ///< Capture ID of the object the call was made on or created.
+};
+
+} // CmdCapture
+
+/// Statistics gathered by CmdBufferReplayer::Replay.
+struct ReplayStats
+{
+    Pal::uint32 recordsReplayed;  ///< Records which were re-issued against the device.
+    Pal::uint32 recordsSkipped;   ///< Records skipped because an object they depend on could not be created.
+    Pal::uint32 cmdBuffersBuilt;  ///< Number of command buffers which were successfully ended.
+    Pal::int64  totalTicks;       ///< CPU ticks spent inside PAL command buffer calls.  @see Util::GetPerfFrequency.
+
+    Pal::uint64 callCount[static_cast<Pal::uint32>(CmdCapture::Func::Count)]; ///< Number of calls per function.
+    Pal::int64  callTicks[static_cast<Pal::uint32>(CmdCapture::Func::Count)]; ///< CPU ticks spent per function.
+};
+
+/**
+***********************************************************************************************************************
+* @brief CmdBufferReplayer re-issues a binary command buffer capture against any PAL device, including the null device.
+*
+* Objects referenced by the capture are recreated on the target device the first time their creation record is seen
+* and kept for the lifetime of the replayer, so calling Replay() repeatedly only measures command buffer recording.
+* Nothing is ever submitted; the replayer is intended for profiling and comparing the CPU cost of command building.
+* Any command buffer which references an object that failed to be recreated (e.g., a pipeline ELF compiled for a
+* different GPU) is skipped until its next Begin().
+***********************************************************************************************************************
+*/
+class CmdBufferReplayer
+{
+public:
+    CmdBufferReplayer(
+        Pal::IPlatform* pPlatform,
+        Pal::IDevice*   pDevice);
+    ~CmdBufferReplayer();
+
+    /// Loads a capture file written by the interface logger.
+    ///
+    /// @param [in] pFilePath Path to the capture file.
+    ///
+    /// @returns Success if the file was loaded and its header is compatible with this build of PAL.  Otherwise:
+    ///          + ErrorInvalidValue if the file is not a capture or was written by an incompatible build.
+    ///          + ErrorOutOfMemory if the capture could not be loaded into memory.
+    Pal::Result Init(const char* pFilePath);
+
+    /// Uses a capture which the caller has already loaded into memory.  The memory must remain valid for the lifetime
+    /// of the replayer.
+    ///
+    /// @param [in] pData Capture data, starting with the file header.
+    /// @param [in] size  Size of the capture data in bytes.
+    ///
+    /// @returns Success if the header is compatible with this build of PAL, ErrorInvalidValue otherwise.
+    Pal::Result Init(const void* pData, size_t size);
+
+    /// Replays every record in the capture once.
+    ///
+    /// @param [out] pStats Optional statistics about the replay.
+    ///
+    /// @returns Success if the capture was well formed.  Object creation and command buffer failures do not fail the
+    ///          replay; they are reported as skipped records instead.
+    Pal::Result Replay(ReplayStats* pStats);
+
+private:
+    // Per-command buffer replay state.
+    struct ReplayCmdBuffer
+    {
+        Pal::ICmdBuffer* pCmdBuffer;
+        bool             valid;      // False if a call since the last Begin() was skipped.
+    };
+
+    typedef Util::Vector<Pal::IDestroyable*, 16, Pal::IPlatform> ObjectVector;
+    typedef Util::Vector<ReplayCmdBuffer, 16, Pal::IPlatform>    CmdBufferVector;
+
+    Pal::Result ValidateHeader();
+    Pal::Result CreateObject(const CmdCapture::RecordHeader& header, const Pal::uint8* pPayload, bool* pMalformed);
+    bool ReplayCmdBufferCall(const CmdCapture::RecordHeader& header, const Pal::uint8* pPayload, ReplayStats* pStats);
+    void DestroyObjects();
+
+    static Pal::Result StoreObject(ObjectVector* pObjects, Pal::uint32 objectId, Pal::IDestroyable* pObject);
+    static Pal::IDestroyable* LookupObject(const ObjectVector& objects, Pal::uint32 objectId);
+
+    Pal::IPlatform*const m_pPlatform;
+    Pal::IDevice*const   m_pDevice;
+
+    const Pal::uint8*    m_pData;       // The capture, starting with the file header.
+    size_t               m_dataSize;    // Size of the capture in bytes.
+    void*                m_pFileData;   // Non-null if the capture was loaded from a file and is owned by us.
+
+    // Recreated objects, indexed by capture ID.  Entries are null if the object has not been created (yet).
+    ObjectVector         m_cmdAllocators;
+    ObjectVector         m_pipelines;
+    ObjectVector         m_msaaStates;
+    ObjectVector         m_colorBlendStates;
+    ObjectVector         m_depthStencilStates;
+    CmdBufferVector      m_cmdBuffers;
+
+    PAL_DISALLOW_DEFAULT_CTOR(CmdBufferReplayer);
+    PAL_DISALLOW_COPY_AND_ASSIGN(CmdBufferReplayer);
+};
+
+} // GpuUtil
@@ -67,6 +67,12 @@ struct ArchiveFileOpenInfo
     bool                allowAsyncFileIo;            ///< Allow use of OS specific asynchronous file routines
     bool                useBufferedReadMemory;       ///< Allow preloading/read-ahead of file into memory
     size_t              maxReadBufferMem;            ///< Maximum size allowed for read buffer
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    bool                useMemoryMappedReads;        ///< Map the file read-only into memory instead of reading it
+                                                     ///  through the read buffer. Only honored if allowWriteAccess is
+                                                     ///  false. Entry payloads may then be accessed without copies
+                                                     ///  through IArchiveFile::GetEntryDataView().
+#endif
 };
 
 /// Get the memory size needed for an archive file object
@@ -79,7 +85,9 @@ size_t GetArchiveFileObjectSize(
 
 /// Opens a file on disk as a "PAL Archive File"
 ///
-/// This Interface may cause disk access routines to be called by the underlying OS.
+/// This Interface may cause disk access routines to be called by the underlying OS. If a valid index sidecar
+/// ("<fileName>.idx") is found next to the archive, the entry headers are loaded from it instead of being read one by
+/// one from the archive. Archives opened with write access refresh the sidecar when they are destroyed.
 ///
 /// @param [in]     pOpenInfo       Information about which file to open
 /// @param [in]     pPlacementAddr  Pointer to the location where the interface should be constructed. There must
@@ -110,6 +118,37 @@ Result OpenArchiveFile(
 Result CreateArchiveFile(
     const ArchiveFileOpenInfo* pOpenInfo);
 
+/// Filter deciding which entries survive CompactArchiveFile()
+///
+/// @param [in] header      Header of an entry in the archive being compacted
+/// @param [in] pUserData   Client data passed to CompactArchiveFile()
+///
+/// @returns true to keep the entry, false to evict it
+typedef bool (*ArchiveEntryFilter)(const ArchiveEntryHeader& header, void* pUserData);
+
+/// Rewrite an archive file on disc keeping only the entries that are still useful
+///
+/// Entries failing their checksum, entries whose key duplicates an earlier entry and entries rejected by pfnFilter are
+/// dropped. The surviving entries are written to a temporary archive, with a fresh index sidecar, which then replaces
+/// the original. If any entry can't be read the original is left untouched. The archive must not be opened by anyone
+/// while it is being compacted.
+///
+/// @param [in]     pOpenInfo       Information about which file to compact
+/// @param [in]     pfnFilter       Optional filter selecting entries to evict. May be nullptr to keep all valid entries
+/// @param [in]     pUserData       Client data passed to pfnFilter
+/// @param [out]    pEntriesRemoved Optional count of entries dropped from the archive
+///
+/// @returns Success if the archive was compacted. Otherwise, one of the following errors may be returned:
+///          + ErrorInvalidPointer if pOpenInfo is nullptr.
+///          + ErrorUnavailable if the archive or the temporary archive could not be opened.
+///          + ErrorOutOfMemory when there is not enough system memory to compact the file.
+///          + ErrorUnknown if there is an internal error.
+Result CompactArchiveFile(
+    const ArchiveFileOpenInfo* pOpenInfo,
+    ArchiveEntryFilter         pfnFilter,
+    void*                      pUserData,
+    size_t*                    pEntriesRemoved);
+
 /// Attempt to delete an archive file on disc
 ///
 /// @param [in]     pOpenInfo       Information about which file to delete
@@ -183,6 +222,8 @@ public:
 
     /// Read the data for an entry located by its header
     ///
+    /// The data is returned as stored, decoding according to pHeader->compressionType is left to the caller.
+    ///
     /// @param [in]  pHeader        Header of data entry desired
     /// @param [out] pDataBuffer    Buffer to read data into. There should be sufficient memory to hold
     ///                             pHeader->dataSize number of bytes.
@@ -198,6 +239,22 @@ public:
         const ArchiveEntryHeader*   pHeader,
         void*                       pDataBuffer) = 0;
 
+    /// Get a read-only view of the data for an entry located by its header without copying it
+    ///
+    /// Only memory mapped archive files support views. The view remains valid until the archive file is destroyed.
+    ///
+    /// @param [in]  pHeader    Header of data entry desired
+    /// @param [out] ppData     Address of the entry's pHeader->dataSize bytes of data inside the mapped file
+    ///
+    /// @return Success if the view is valid. Otherwise, one of the following may be returned:
+    ///         + Unsupported if the archive file was not opened with useMemoryMappedReads
+    ///         + ErrorInvalidPointer if pHeader or ppData is nullptr
+    ///         + ErrorInvalidValue if pHeader->dataPosition is past the end of the file
+    ///         + ErrorUnknown if the data fails the pHeader->dataCrc64 check or there is an internal error.
+    virtual Result GetEntryDataView(
+        const ArchiveEntryHeader*   pHeader,
+        const void**                ppData) = 0;
+
     /// Write header and data out to archive file
     ///
     /// If async file writes are allowed, this function will return before the write is fully complete.
@@ -214,6 +271,27 @@ public:
         ArchiveEntryHeader* pHeader,
         const void*         pData) = 0;
 
+    /// Write a set of headers and data out to archive file, updating the footer only once for the whole set
+    ///
+    /// If async file writes are allowed, this function will return before the write is fully complete.
+    ///
+    /// @param [in/out] pHeaders    Array of count headers for the new data entries. Header data will be modified to
+    ///                             reflect the output file. Entries are assigned consecutive ordinal ids.
+    /// @param [in]     ppData      Array of count pointers to the data to be stored for each entry.
+    ///                             pHeaders[i].dataSize number of bytes will be read from ppData[i]
+    /// @param [in]     count       Number of entries to write
+    ///
+    /// @return Success if the data write completed without error. If any error is returned none of the entries were
+    ///         added to the archive. One of the following may be returned:
+    ///         + Unsupported if the file was not opened with write access
+    ///         + ErrorInvalidPointer if pHeaders, ppData or any entry of ppData is nullptr
+    ///         + ErrorOutOfMemory if there is not enough system memory to stage the write
+    ///         + ErrorUnknown if there is an internal error.
+    virtual Result WriteBatch(
+        ArchiveEntryHeader* pHeaders,
+        const void* const*  ppData,
+        size_t              count) = 0;
+
     /// Destroy the archive file interface. Closing the file if necessary.
     ///
     ///  If async file writes are allowed this function may block if there are pending writes to complete.
@@ -53,14 +53,23 @@ constexpr uint8 MagicArchiveMarker[16]  =                       ///< Identifies
      0x8b, 0xd1, 0x48, 0xf5, 0xd8, 0xf0, 0xb4, 0xa7};
 constexpr uint8 MagicFooterMarker[4]    = {'F','O','T','R'};    ///< Identifies the start of the ArchiveFileFooter
 constexpr uint8 MagicEntryMarker[4]     = {'N','T','R','Y'};    ///< Identifies the start of an ArchiveEntryHeader
+constexpr uint8 MagicIndexMarker[4]     = {'I','N','D','X'};    ///< Identifies the start of an ArchiveIndexHeader
 
 /**
 ***********************************************************************************************************************
 * @brief Version constants. Must be updated if this file is changed
 ***********************************************************************************************************************
 */
-constexpr uint32 CurrentMajorVersion    = 1;    ///< Version number denoting compatibility breaking changes
-constexpr uint32 CurrentMinorVersion    = 1;    ///< Version number denoting changes that should be backward compatible
+constexpr uint32 CurrentMajorVersion    = 2;    ///< Version number denoting compatibility breaking changes
+constexpr uint32 CurrentMinorVersion    = 0;    ///< Version number denoting changes that should be backward compatible
+
+/**
+***********************************************************************************************************************
+* @brief Encodings an entry's data may be stored with
+***********************************************************************************************************************
+*/
+constexpr uint32 ArchiveCompressionNone = 0;    ///< Data is stored as-is
+constexpr uint32 ArchiveCompressionLz4  = 1;    ///< Data is stored as a single LZ4 block
 
 /**
 ***********************************************************************************************************************
@@ -106,6 +115,28 @@ struct ArchiveEntryHeader
     uint32 dataType;        ///< Optional ID signifying the data type for the entry
     uint8  entryKey[20];    ///< 160-bit (max) hash key for the entry
     uint32 metaValue;       ///< Optional meta-data value for use by consumer of data
+    uint32 compressionType; ///< Encoding of the stored data, one of the ArchiveCompression* values
+    uint32 decompressedSize;///< Size of entry data once decoded. dataSize and dataCrc64 refer to the stored data
+};
+
+/**
+***********************************************************************************************************************
+* @brief A header stored at the front of an archive index sidecar file
+*
+* The sidecar lets an archive be opened with a single sequential read instead of walking the chain of entry headers.
+* It is followed by entryCount ArchiveEntryHeader records in ordinal (and therefore file offset) order. If the archive
+* has grown since the sidecar was written the records are still used as a prefix of the archive's entries.
+***********************************************************************************************************************
+*/
+struct ArchiveIndexHeader
+{
+    uint8  indexMarker[4];  ///< Fixed marker to designate an index, must match MagicIndexMarker
+    uint32 majorVersion;    ///< Major version of the archive format the index was written for
+    uint32 minorVersion;    ///< Minor version of the archive format the index was written for
+    uint32 entryCount;      ///< Count of ArchiveEntryHeader records following this header
+    uint32 footerOffset;    ///< Byte offset of the archive footer at the time the index was written
+    uint64 footerCrc64;     ///< Checksum of the archive footer at the time the index was written
+    uint64 entriesCrc64;    ///< Checksum of the ArchiveEntryHeader records
 };
 #pragma pack(pop)
 
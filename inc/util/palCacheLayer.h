@@ -213,6 +213,30 @@ struct MemoryCacheCreateInfo
     bool                     evictOnFull;     ///< Whether or not the cache should evict entries based on LRU to
                                               ///  make room for new ones
     bool                     evictDuplicates; ///< Whether or not the cache should evict entries with a duplicate hash
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    uint32                   numShards;       ///< Number of independently locked partitions to split the cache into.
+                                              ///  Zero or one keeps a single partition with exact LRU eviction, where
+                                              ///  every query takes the lock exclusively.  Larger values (rounded up to
+                                              ///  a power of two, at most 64) let queries on different partitions
+                                              ///  proceed in parallel, take only a shared lock, and evict using an
+                                              ///  approximate (CLOCK) LRU.  The object count and memory size limits
+                                              ///  apply to the cache as a whole and are shared by all partitions;
+                                              ///  making room for a new entry may evict entries from any partition.
+#endif
+};
+
+/**
+***********************************************************************************************************************
+* @brief Runtime statistics for one partition of an in-memory cache layer
+***********************************************************************************************************************
+*/
+struct MemoryCacheShardStats
+{
+    size_t curCount;     ///< Number of entries currently in the partition
+    size_t curSize;      ///< Total data size of the entries currently in the partition
+    uint64 hits;         ///< Number of queries which found their entry in this partition
+    uint64 misses;       ///< Number of queries which did not find their entry in this partition
+    uint64 contentions;  ///< Number of times a thread had to wait for this partition's lock
 };
 
 /// Get the memory size for a in-memory cache layer
@@ -261,6 +285,20 @@ Result GetMemoryCacheLayerHashIds(
     size_t          curCount,
     Hash128*        pHashIds);
 
+/// Get per-partition hit/miss/contention statistics of a memoryCache
+///
+/// @param [in]         pCacheLayer  memory cache layer to be queried.
+/// @param [in,out]     pNumShards   on input, the number of elements available in pStats; on output, the number of
+///                                  partitions in the memoryCache.
+/// @param [out]        pStats       optional array receiving the statistics of each partition.  If null, only the
+///                                  number of partitions is returned.
+///
+/// @return Success if the statistics were returned, ErrorInvalidMemorySize if pStats is too small.
+Result GetMemoryCacheLayerShardStats(
+    ICacheLayer*            pCacheLayer,
+    uint32*                 pNumShards,
+    MemoryCacheShardStats*  pStats);
+
 /**
 ***********************************************************************************************************************
 * @brief Information needed to create an archive file backed key-value store
@@ -276,6 +314,15 @@ struct ArchiveFileCacheCreateInfo
                                            ///  to be keyed to a specific driver/platform fingerprint.
     uint32                   dataTypeId;   ///< Optional 32-bit data type identifier, allows heterogenous data to be
                                            ///  stored within an archive file.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    bool                     useWriteBehind;      ///< Queue stored data and write it to the archive file in batches
+                                                  ///  from a background thread instead of on the storing thread.
+                                                  ///  See FlushArchiveFileCacheLayer().
+    size_t                   maxWriteBehindBytes; ///< Maximum amount of queued data before Store() blocks waiting for
+                                                  ///  the background thread. 0 selects a default budget.
+    bool                     disableCompression;  ///< Store entries uncompressed. By default entries are LZ4
+                                                  ///  compressed whenever that makes them smaller.
+#endif
 };
 
 /// Get the memory size for a archive file backed cache layer
@@ -301,6 +348,15 @@ Result CreateArchiveFileCacheLayer(
     void*                             pPlacementAddr,
     ICacheLayer**                     ppCacheLayer);
 
+/// Wait for all data queued by an archive file cache layer created with useWriteBehind to be written to the archive
+///
+/// @param [in]     pCacheLayer     Archive file cache layer to flush
+///
+/// @return Success if every queued store was written. Otherwise the first error hit by the background writer since
+///         the last flush is returned.
+Result FlushArchiveFileCacheLayer(
+    ICacheLayer* pCacheLayer);
+
 /**
 ***********************************************************************************************************************
 * @brief Information needed to create a pipeline content tracker
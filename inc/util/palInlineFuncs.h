@@ -250,6 +250,56 @@ void WideBitfieldAndBits(
     }
 }
 
+/// Sets a range of consecutive bits in a "wide bitfield" to one. A "wide bifield" is a bitfield which spans an array of
+/// integers because there are more flags than bits in one integer. Each integer is modified at most once.
+///
+/// @param [in] bitfield  Reference to the bitfield being modified
+/// @param [in] firstBit  Index of the first flag to set
+/// @param [in] numBits   Number of consecutive flags to set
+template <typename T, size_t N>
+void WideBitfieldSetRange(
+    T      (&bitfield)[N],
+    uint32 firstBit,
+    uint32 numBits)
+{
+    constexpr uint32 BitsPerElement = (sizeof(T) << 3);
+
+    uint32 index  = (firstBit / BitsPerElement);
+    uint32 offset = (firstBit & (BitsPerElement - 1));
+
+    while (numBits > 0)
+    {
+        const uint32 bits = ((numBits < (BitsPerElement - offset)) ? numBits : (BitsPerElement - offset));
+        const T      mask = ((bits == BitsPerElement) ? static_cast<T>(~static_cast<T>(0))
+                                                      : static_cast<T>(((static_cast<T>(1) << bits) - 1) << offset));
+
+        bitfield[index] |= mask;
+
+        numBits -= bits;
+        offset   = 0;
+        ++index;
+    }
+}
+
+/// Determines if any of the bits in a "wide bitfield" are set. A "wide bifield" is a bitfield which spans an array of
+/// integers because there are more flags than bits in one integer.
+///
+/// @param [in] bitfield  Reference to the bitfield being tested
+///
+/// @returns True if any flag is set.
+template <typename T, size_t N>
+bool WideBitfieldIsAnyBitSet(
+    const T (&bitfield)[N])
+{
+    T anySet = 0;
+    for (uint32 i = 0; i < N; i++)
+    {
+        anySet |= bitfield[i];
+    }
+
+    return (anySet != 0);
+}
+
 /// Scans the specified bit-mask for the least-significant '1' bit.
 ///
 /// @returns True if the input was nonzero; false otherwise.
@@ -310,6 +360,72 @@ bool BitMaskScanReverse(
     return result;
 }
 
+/// Scans a "wide bitfield" for the first run of consecutive '1' bits which begins at or after startBit. Only the bits
+/// below bitLimit are considered. Runs may span multiple integers in the bitfield; each integer is scanned using bit-
+/// scan instructions rather than one bit at a time.
+///
+/// @returns True if a run was found; false otherwise.
+template <typename T, size_t N>
+bool WideBitfieldScanRun(
+    const T (&bitfield)[N],   ///< Bitfield to scan.
+    uint32  startBit,         ///< Index of the first bit to consider.
+    uint32  bitLimit,         ///< One past the index of the last bit to consider. Must not exceed the bitfield size.
+    uint32* pFirstBit,        ///< [out] Index of the first '1' bit in the run.
+    uint32* pNumBits)         ///< [out] Number of consecutive '1' bits in the run.
+{
+    constexpr uint32 BitsPerElement = (sizeof(T) << 3);
+
+    bool   found = false;
+    uint32 bit   = startBit;
+
+    // Find the first '1' bit.
+    while ((found == false) && (bit < bitLimit))
+    {
+        const uint32 shift  = (bit & (BitsPerElement - 1));
+        const T      mask   = static_cast<T>(bitfield[bit / BitsPerElement] >> shift);
+        uint32       offset = 0;
+
+        if (BitMaskScanForward(&offset, mask))
+        {
+            bit  += offset;
+            found = (bit < bitLimit);
+        }
+        else
+        {
+            bit += (BitsPerElement - shift);
+        }
+    }
+
+    if (found)
+    {
+        *pFirstBit = bit;
+
+        // Find the first '0' bit which follows it. The bits shifted in from the top count as '1' bits so that runs
+        // continue into the next integer.
+        bool ended = false;
+        while ((ended == false) && (bit < bitLimit))
+        {
+            const uint32 shift  = (bit & (BitsPerElement - 1));
+            const T      mask   = static_cast<T>(static_cast<T>(~bitfield[bit / BitsPerElement]) >> shift);
+            uint32       offset = 0;
+
+            if (BitMaskScanForward(&offset, mask))
+            {
+                bit  += offset;
+                ended = true;
+            }
+            else
+            {
+                bit += (BitsPerElement - shift);
+            }
+        }
+
+        *pNumBits = (((bit < bitLimit) ? bit : bitLimit) - *pFirstBit);
+    }
+
+    return found;
+}
+
 /// Scans the specified wide bit-mask for the least-significant '1' bit.
 ///
 /// @returns True if input was nonzero; false otherwise.
@@ -0,0 +1,238 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palOpenHashBase.h
+ * @brief PAL utility collection shared class declarations used by the OpenHashMap and OpenHashSet containers.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashBase.h"
+
+namespace Util
+{
+
+// Forward declarations.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc> class OpenHashBase;
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Iterator for traversal of elements in an open-addressing hash container.
+ *
+ * Entries are visited in slot order.  While the container is migrating to a larger table the entries which have not
+ * been migrated yet are visited after those which already live in the new table.  Backward iterating is not supported.
+ *
+ * @warning Any insertion or erase invalidates all iterators of the container.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+class OpenHashIterator
+{
+public:
+    /// Convenience typedef for the associated container for this templated iterator.
+    typedef OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc> Container;
+
+    ~OpenHashIterator() { }
+
+    /// Returns a pointer to current entry.  Will return null if the iterator has been advanced off the end of the
+    /// container.
+    Entry* Get() const { return m_pCurrentEntry; }
+
+    /// Advances the iterator to the next position (move forward).
+    void Next();
+
+private:
+    explicit OpenHashIterator(const Container* pContainer);
+
+    // Points m_pCurrentEntry at the first occupied slot at or after (m_tableIdx, m_slot), or at null if there is none.
+    void Advance();
+
+    const Container* const m_pContainer;     // Hash container that we're iterating over.
+    uint32                 m_tableIdx;       // Index of the table we're iterating (see OpenHashBase::Table).
+    uint32                 m_slot;           // Slot of m_pCurrentEntry within its table.
+    Entry*                 m_pCurrentEntry;  // Current entry we're at now.
+
+    PAL_DISALLOW_DEFAULT_CTOR(OpenHashIterator);
+
+    // Although this is a transgression of coding standards, it means that Container does not need to have a public
+    // interface specifically to implement this class. The added encapsulation this provides is worthwhile.
+    friend class OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>;
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Templated base class for OpenHashMap and OpenHashSet, supporting the ability to store, find, and remove
+ *        entries in a self-resizing open-addressing table.
+ *
+ * Unlike @ref HashBase, which has a fixed number of buckets and chains additional entry groups when a bucket fills
+ * up, this container stores every entry directly in a flat slot array and grows the array whenever the load factor
+ * exceeds 7/8.  Each slot is paired with a one-byte control value which is either "empty", "deleted" or the low 7 bits
+ * of the hash of the key stored in the slot.  Slots are probed in groups of 16 control bytes which fit in one SSE
+ * register, so a single compare filters out nearly every non-matching key before the entries themselves are touched.
+ * A typical lookup costs one cache miss for the control group and one for the matching entry, regardless of size.
+ *
+ * Growth is incremental: when the table needs to grow a new table is allocated, but entries are moved over a few
+ * groups at a time by subsequent insertions and erasures rather than all at once.  Lookups consult both tables until
+ * the migration completes.  This bounds the worst-case cost of any single operation, which matters for containers
+ * that are modified on latency-sensitive threads (e.g., queue submission).
+ *
+ * The following restrictions apply:
+ *
+ * - The key and entry must be POD-style types; entries are moved with plain assignment.
+ * - Pointers to entries or values are invalidated by any insertion or erase.
+ *
+ * The container may use any hash functor accepted by @ref HashBase; the functor's result is remixed internally so that
+ * weak hashes such as @ref DefaultHashFunc still distribute well.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+class OpenHashBase
+{
+public:
+    /// Convenience typedef for iterators of this templated OpenHashBase.
+    typedef OpenHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc> Iterator;
+
+    /// Initializes the hash container.
+    ///
+    /// @returns @ref Success if the initialization completed successfully, or ErrorOutOfMemory if the operation failed
+    ///          due to an internal failure to allocate system memory.
+    Result Init();
+
+    /// Returns number of entries in the container.
+    uint32 GetNumEntries() const { return m_numEntries; }
+
+    /// Returns the number of slots currently allocated by the container, including any table being migrated.
+    uint32 GetCapacity() const { return m_table[NewTable].capacity + m_table[OldTable].capacity; }
+
+    /// Returns an iterator pointing to the first entry.
+    Iterator Begin() const { return Iterator(this); }
+
+    /// Empty the hash container.  The current table is retained for reuse.
+    void Reset();
+
+    /// Number of control bytes probed at once.
+    static constexpr uint32 GroupWidth = 16;
+
+protected:
+    /// @internal Constructor
+    ///
+    /// @param [in] numEntries Number of entries the container is expected to hold.  The container will grow past this
+    ///                        number as needed; this only determines the size of the table allocated by Init().
+    /// @param [in] pAllocator The allocator that will allocate memory if required.
+    explicit OpenHashBase(uint32 numEntries, Allocator*const pAllocator);
+    virtual ~OpenHashBase();
+
+    /// @internal Returns the entry that matches the specified key, or null if there is no such entry.
+    Entry* FindEntry(const Key& key) const;
+
+    /// @internal Returns the entry that matches the specified key.  If no entry exists, a new entry is allocated and
+    /// its key is initialized.
+    ///
+    /// @param [in]  key      Key to search for.
+    /// @param [out] pExisted True if an entry for the specified key existed before this call was made.
+    ///
+    /// @returns The matching or newly allocated entry, or null if a new entry was needed but memory allocation failed.
+    Entry* FindAllocateEntry(const Key& key, bool* pExisted);
+
+    /// @internal Removes the entry that matches the specified key.
+    ///
+    /// @returns True if an entry was removed, false if an entry for this key did not exist.
+    bool EraseEntry(const Key& key);
+
+    const HashFunc  m_hashFunc;       ///< @internal Hash functor object.
+    const EqualFunc m_equalFunc;      ///< @internal Key compare function object.
+    Allocator*const m_pAllocator;     ///< @internal Allocator for the slot tables.
+
+private:
+    // Control byte values.  A full slot stores the low 7 bits of its key's hash so that the high bit distinguishes
+    // full slots from empty or deleted ones.
+    static constexpr int8 CtrlEmpty   = -128;
+    static constexpr int8 CtrlDeleted = -2;
+
+    // Number of old-table slots migrated by every insertion or erase while a migration is in progress.  The new table
+    // always has enough headroom for the migration to finish well before it reaches its own growth threshold.
+    static constexpr uint32 MigrateSlotsPerOp = GroupWidth * 2;
+
+    // A flat slot table.
+    struct Table
+    {
+        void*  pMemory;     // Base allocation holding both arrays below.
+        int8*  pCtrl;       // One control byte per slot; aligned to GroupWidth.
+        Entry* pEntries;    // Slot storage.
+        uint32 capacity;    // Number of slots.  A power of two and a multiple of GroupWidth, or zero.
+        uint32 numFull;     // Number of occupied slots.
+        uint32 numDeleted;  // Number of tombstones.
+    };
+
+    // Indices into m_table.
+    static constexpr uint32 NewTable = 0;  // The table which receives all new insertions.
+    static constexpr uint32 OldTable = 1;  // The table being drained during an incremental migration, if any.
+
+    static uint32 MixHash(uint32 hash);
+    static uint32 MaxLoad(uint32 capacity) { return (capacity - (capacity / 8)); }
+
+    static uint32 MatchByte(const int8* pGroup, int8 value);
+    static uint32 MatchEmpty(const int8* pGroup) { return MatchByte(pGroup, CtrlEmpty); }
+    static uint32 MatchEmptyOrDeleted(const int8* pGroup);
+
+    uint32 HashKey(const Key& key) const { return MixHash(m_hashFunc(&key, sizeof(key))); }
+
+    Entry* FindInTable(const Table& table, const Key& key, uint32 hash, uint32* pSlot) const;
+    uint32 FindInsertSlot(const Table& table, uint32 hash) const;
+    void   InsertIntoTable(Table* pTable, uint32 slot, uint32 hash);
+
+    Result AllocTable(uint32 capacity, Table* pTable);
+    void   FreeTable(Table* pTable);
+    Result Grow();
+    void   Migrate(uint32 numSlots);
+
+    uint32 m_numEntries;     // Entries in the container across both tables.
+    uint32 m_minCapacity;    // Capacity of the table allocated by Init().
+    uint32 m_migrateSlot;    // Next old-table slot to be migrated.
+    Table  m_table[2];       // The current table and the table being migrated, indexed by NewTable and OldTable.
+
+    PAL_DISALLOW_DEFAULT_CTOR(OpenHashBase);
+    PAL_DISALLOW_COPY_AND_ASSIGN(OpenHashBase);
+
+    // Although this is a transgression of coding standards, it prevents OpenHashIterator requiring a public
+    // constructor.
+    friend class OpenHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>;
+};
+
+} // Util
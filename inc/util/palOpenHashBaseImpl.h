@@ -0,0 +1,542 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palOpenHashBaseImpl.h
+ * @brief PAL utility collection shared class implementations used by the OpenHashMap and OpenHashSet containers.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashBaseImpl.h"
+#include "palOpenHashBase.h"
+#include "palInlineFuncs.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define PAL_OPEN_HASH_SSE2 1
+#else
+#define PAL_OPEN_HASH_SSE2 0
+#endif
+
+namespace Util
+{
+
+// =====================================================================================================================
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE OpenHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>::OpenHashIterator(
+    const Container* pContainer)  // [retained] The hash container to iterate over
+    :
+    m_pContainer(pContainer),
+    m_tableIdx(Container::NewTable),
+    m_slot(0),
+    m_pCurrentEntry(nullptr)
+{
+    Advance();
+}
+
+// =====================================================================================================================
+// Proceeds to the next entry, null if to the end.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE void OpenHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>::Next()
+{
+    if (m_pCurrentEntry != nullptr)
+    {
+        m_slot++;
+        Advance();
+    }
+}
+
+// =====================================================================================================================
+// Scans forward from the current position for an occupied slot, moving on to the old table when the new one is done.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE void OpenHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>::Advance()
+{
+    m_pCurrentEntry = nullptr;
+
+    while ((m_pCurrentEntry == nullptr) && (m_tableIdx <= Container::OldTable))
+    {
+        const typename Container::Table& table = m_pContainer->m_table[m_tableIdx];
+
+        for (; m_slot < table.capacity; ++m_slot)
+        {
+            // Full slots are the only ones with the high bit clear.
+            if (table.pCtrl[m_slot] >= 0)
+            {
+                m_pCurrentEntry = &table.pEntries[m_slot];
+                break;
+            }
+        }
+
+        if (m_pCurrentEntry == nullptr)
+        {
+            m_tableIdx++;
+            m_slot = 0;
+        }
+    }
+}
+
+// =====================================================================================================================
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::OpenHashBase(
+    uint32          numEntries,
+    Allocator*const pAllocator)
+    :
+    m_hashFunc(),
+    m_equalFunc(),
+    m_pAllocator(pAllocator),
+    m_numEntries(0),
+    m_minCapacity(Max(GroupWidth, Pow2Pad(numEntries + (numEntries / 7) + 1))),
+    m_migrateSlot(0)
+{
+    memset(&m_table[0], 0, sizeof(m_table));
+}
+
+// =====================================================================================================================
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::~OpenHashBase()
+{
+    FreeTable(&m_table[NewTable]);
+    FreeTable(&m_table[OldTable]);
+}
+
+// =====================================================================================================================
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE Result OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Init()
+{
+    PAL_ASSERT(m_table[NewTable].pMemory == nullptr);
+
+    return AllocTable(m_minCapacity, &m_table[NewTable]);
+}
+
+// =====================================================================================================================
+// Empty the hash table.  Any table still being migrated is released; the current table is kept for reuse.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE void OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Reset()
+{
+    Table*const pTable = &m_table[NewTable];
+
+    if (pTable->pMemory != nullptr)
+    {
+        memset(pTable->pCtrl, CtrlEmpty, pTable->capacity);
+        pTable->numFull    = 0;
+        pTable->numDeleted = 0;
+    }
+
+    FreeTable(&m_table[OldTable]);
+
+    m_migrateSlot = 0;
+    m_numEntries  = 0;
+}
+
+// =====================================================================================================================
+// Finalizes the raw hash with the MurmurHash3 avalanche step.  The probe position comes from the high bits and the
+// control byte from the low bits, so both need to depend on every bit of the input.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE uint32 OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::MixHash(
+    uint32 hash)
+{
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+// =====================================================================================================================
+// Returns a mask with bit i set for each control byte i in the group which equals value.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE uint32 OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::MatchByte(
+    const int8* pGroup,
+    int8        value)
+{
+#if PAL_OPEN_HASH_SSE2
+    const __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(pGroup));
+    return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value))));
+#else
+    uint32 mask = 0;
+
+    for (uint32 i = 0; i < GroupWidth; ++i)
+    {
+        mask |= ((pGroup[i] == value) ? 1u : 0u) << i;
+    }
+
+    return mask;
+#endif
+}
+
+// =====================================================================================================================
+// Returns a mask with bit i set for each control byte i in the group which is empty or deleted.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE uint32 OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::MatchEmptyOrDeleted(
+    const int8* pGroup)
+{
+#if PAL_OPEN_HASH_SSE2
+    // Empty and deleted are the only control values with the high bit set.
+    const __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(pGroup));
+    return static_cast<uint32>(_mm_movemask_epi8(ctrl));
+#else
+    uint32 mask = 0;
+
+    for (uint32 i = 0; i < GroupWidth; ++i)
+    {
+        mask |= ((pGroup[i] < 0) ? 1u : 0u) << i;
+    }
+
+    return mask;
+#endif
+}
+
+// =====================================================================================================================
+// Searches one table for the specified key.  Groups are visited with triangular probing, which touches every group of
+// a power-of-two table exactly once, and the search ends at the first group which contains an empty slot.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE Entry* OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindInTable(
+    const Table& table,
+    const Key&   key,
+    uint32       hash,
+    uint32*      pSlot
+    ) const
+{
+    Entry* pEntry = nullptr;
+
+    if (table.numFull > 0)
+    {
+        const uint32 groupMask = (table.capacity / GroupWidth) - 1;
+        const int8   h2        = static_cast<int8>(hash & 0x7F);
+        uint32       group     = (hash >> 7) & groupMask;
+
+        for (uint32 probe = 1; (pEntry == nullptr) && (probe <= (groupMask + 1)); ++probe)
+        {
+            const int8*const pGroup = &table.pCtrl[group * GroupWidth];
+
+            uint32 match = MatchByte(pGroup, h2);
+            uint32 index = 0;
+
+            while (BitMaskScanForward(&index, match))
+            {
+                const uint32 slot = (group * GroupWidth) + index;
+
+                if (m_equalFunc(table.pEntries[slot].key, key))
+                {
+                    pEntry = &table.pEntries[slot];
+                    *pSlot = slot;
+                    break;
+                }
+
+                match &= (match - 1);
+            }
+
+            if ((pEntry != nullptr) || (MatchEmpty(pGroup) != 0))
+            {
+                break;
+            }
+
+            group = (group + probe) & groupMask;
+        }
+    }
+
+    return pEntry;
+}
+
+// =====================================================================================================================
+// Returns the first empty or deleted slot along the probe sequence of the specified hash.  The table must have at least
+// one such slot.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE uint32 OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindInsertSlot(
+    const Table& table,
+    uint32       hash
+    ) const
+{
+    PAL_ASSERT((table.numFull + table.numDeleted) < table.capacity);
+
+    const uint32 groupMask = (table.capacity / GroupWidth) - 1;
+    uint32       group     = (hash >> 7) & groupMask;
+    uint32       index     = 0;
+
+    for (uint32 probe = 1; BitMaskScanForward(&index, MatchEmptyOrDeleted(&table.pCtrl[group * GroupWidth])) == false;
+         ++probe)
+    {
+        group = (group + probe) & groupMask;
+    }
+
+    return (group * GroupWidth) + index;
+}
+
+// =====================================================================================================================
+// Marks the specified empty or deleted slot as occupied by a key with the specified hash.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE void OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::InsertIntoTable(
+    Table* pTable,
+    uint32 slot,
+    uint32 hash)
+{
+    PAL_ASSERT(pTable->pCtrl[slot] < 0);
+
+    if (pTable->pCtrl[slot] == CtrlDeleted)
+    {
+        pTable->numDeleted--;
+    }
+
+    pTable->pCtrl[slot] = static_cast<int8>(hash & 0x7F);
+    pTable->numFull++;
+}
+
+// =====================================================================================================================
+// Allocates a table with the given number of slots and marks every slot empty.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE Result OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::AllocTable(
+    uint32 capacity,
+    Table* pTable)
+{
+    PAL_ASSERT(IsPowerOfTwo(capacity) && (capacity >= GroupWidth));
+
+    // The control bytes go first so that they are aligned for the group loads; the entries follow them.
+    const size_t entryOffset = Pow2Align(static_cast<size_t>(capacity), alignof(Entry));
+    const size_t memorySize  = entryOffset + (static_cast<size_t>(capacity) * sizeof(Entry));
+
+    Result result    = Result::ErrorOutOfMemory;
+    void*  pMemory   = PAL_MALLOC_ALIGNED(memorySize, Max<size_t>(GroupWidth, alignof(Entry)), m_pAllocator,
+                                          AllocInternal);
+
+    PAL_ALERT(pMemory == nullptr);
+
+    if (pMemory != nullptr)
+    {
+        pTable->pMemory    = pMemory;
+        pTable->pCtrl      = static_cast<int8*>(pMemory);
+        pTable->pEntries   = static_cast<Entry*>(VoidPtrInc(pMemory, entryOffset));
+        pTable->capacity   = capacity;
+        pTable->numFull    = 0;
+        pTable->numDeleted = 0;
+
+        memset(pTable->pCtrl, CtrlEmpty, capacity);
+
+        result = Result::Success;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE void OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FreeTable(
+    Table* pTable)
+{
+    if (pTable->pMemory != nullptr)
+    {
+        PAL_FREE(pTable->pMemory, m_pAllocator);
+    }
+
+    memset(pTable, 0, sizeof(Table));
+}
+
+// =====================================================================================================================
+// Starts migrating to a new table.  The new table doubles the capacity unless most of the used slots are tombstones,
+// in which case a table of the same size is enough to reclaim them.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE Result OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Grow()
+{
+    // A previous migration should always have finished long before the new table fills up, but finish it now if not
+    // so that there are never more than two tables.
+    if (m_table[OldTable].pMemory != nullptr)
+    {
+        Migrate(m_table[OldTable].capacity);
+    }
+
+    const Table& curTable    = m_table[NewTable];
+    const uint32 newCapacity = (curTable.numFull >= (curTable.capacity / 2)) ? (curTable.capacity * 2)
+                                                                             : curTable.capacity;
+    Table newTable = {};
+    Result result  = AllocTable(newCapacity, &newTable);
+
+    if (result == Result::Success)
+    {
+        m_table[OldTable] = curTable;
+        m_table[NewTable] = newTable;
+        m_migrateSlot     = 0;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Moves up to numSlots slots of the old table into the new table, releasing the old table once it has been drained.
+// Migrated slots are marked deleted rather than empty so that probe sequences through them remain intact.
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE void OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Migrate(
+    uint32 numSlots)
+{
+    Table*const  pOldTable = &m_table[OldTable];
+    Table*const  pNewTable = &m_table[NewTable];
+    const uint32 endSlot   = Min(pOldTable->capacity, m_migrateSlot + numSlots);
+
+    for (; m_migrateSlot < endSlot; ++m_migrateSlot)
+    {
+        if (pOldTable->pCtrl[m_migrateSlot] >= 0)
+        {
+            const Entry& entry = pOldTable->pEntries[m_migrateSlot];
+            const uint32 hash  = HashKey(entry.key);
+            const uint32 slot  = FindInsertSlot(*pNewTable, hash);
+
+            InsertIntoTable(pNewTable, slot, hash);
+            pNewTable->pEntries[slot] = entry;
+
+            pOldTable->pCtrl[m_migrateSlot] = CtrlDeleted;
+            pOldTable->numFull--;
+        }
+    }
+
+    if ((m_migrateSlot == pOldTable->capacity) || (pOldTable->numFull == 0))
+    {
+        FreeTable(pOldTable);
+        m_migrateSlot = 0;
+    }
+}
+
+// =====================================================================================================================
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE Entry* OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindEntry(
+    const Key& key
+    ) const
+{
+    PAL_ASSERT(m_table[NewTable].pMemory != nullptr);
+
+    const uint32 hash = HashKey(key);
+    uint32       slot = 0;
+    Entry*       pEntry = FindInTable(m_table[NewTable], key, hash, &slot);
+
+    if (pEntry == nullptr)
+    {
+        pEntry = FindInTable(m_table[OldTable], key, hash, &slot);
+    }
+
+    return pEntry;
+}
+
+// =====================================================================================================================
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE Entry* OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindAllocateEntry(
+    const Key& key,
+    bool*      pExisted)
+{
+    PAL_ASSERT(pExisted != nullptr);
+    PAL_ASSERT(m_table[NewTable].pMemory != nullptr);
+
+    // Migrate first; moving entries afterwards would invalidate the pointer we return.
+    if (m_table[OldTable].pMemory != nullptr)
+    {
+        Migrate(MigrateSlotsPerOp);
+    }
+
+    Entry* pEntry = FindEntry(key);
+
+    *pExisted = (pEntry != nullptr);
+
+    if (pEntry == nullptr)
+    {
+        const Table& curTable = m_table[NewTable];
+        Result       result   = Result::Success;
+
+        if ((curTable.numFull + curTable.numDeleted) >= MaxLoad(curTable.capacity))
+        {
+            result = Grow();
+
+            // If we couldn't get a bigger table, keep using the current one as long as it has any free slot.
+            if ((result != Result::Success) && ((curTable.numFull + curTable.numDeleted) < curTable.capacity))
+            {
+                result = Result::Success;
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            const uint32 hash = HashKey(key);
+            const uint32 slot = FindInsertSlot(m_table[NewTable], hash);
+
+            InsertIntoTable(&m_table[NewTable], slot, hash);
+
+            pEntry      = &m_table[NewTable].pEntries[slot];
+            pEntry->key = key;
+
+            m_numEntries++;
+        }
+    }
+
+    return pEntry;
+}
+
+// =====================================================================================================================
+template<typename Key, typename Entry, typename Allocator, typename HashFunc, typename EqualFunc>
+PAL_INLINE bool OpenHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::EraseEntry(
+    const Key& key)
+{
+    PAL_ASSERT(m_table[NewTable].pMemory != nullptr);
+
+    if (m_table[OldTable].pMemory != nullptr)
+    {
+        Migrate(MigrateSlotsPerOp);
+    }
+
+    const uint32 hash   = HashKey(key);
+    uint32       slot   = 0;
+    Table*       pTable = &m_table[NewTable];
+    Entry*       pEntry = FindInTable(*pTable, key, hash, &slot);
+
+    if (pEntry == nullptr)
+    {
+        pTable = &m_table[OldTable];
+        pEntry = FindInTable(*pTable, key, hash, &slot);
+    }
+
+    if (pEntry != nullptr)
+    {
+        // If the slot's group still has an empty slot no probe sequence can have continued past it, so the slot can
+        // become empty instead of a tombstone.
+        const int8*const pGroup = &pTable->pCtrl[slot & ~(GroupWidth - 1)];
+
+        if (MatchEmpty(pGroup) != 0)
+        {
+            pTable->pCtrl[slot] = CtrlEmpty;
+        }
+        else
+        {
+            pTable->pCtrl[slot] = CtrlDeleted;
+            pTable->numDeleted++;
+        }
+
+        pTable->numFull--;
+
+        PAL_ASSERT(m_numEntries > 0);
+        m_numEntries--;
+    }
+
+    return (pEntry != nullptr);
+}
+
+} // Util
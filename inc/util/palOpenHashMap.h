@@ -0,0 +1,123 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palOpenHashMap.h
+ * @brief PAL utility collection OpenHashMap class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashMap.h"
+#include "palOpenHashBase.h"
+
+namespace Util
+{
+
+/**
+ ***********************************************************************************************************************
+ * @brief Templated, self-resizing hash map container.
+ *
+ * Offers the same interface as @ref HashMap, but is backed by an open-addressing table that grows as entries are
+ * added instead of a fixed number of buckets.  Prefer this container for long-lived maps whose final size is not known
+ * up front; a @ref HashMap sized too small degrades into walking chains of entry groups.
+ *
+ * HashFunc and EqualFunc accept the same functors as @ref HashMap.
+ *
+ * @warning This class is not thread-safe for Insert, FindAllocate, Erase, or iteration!
+ * @warning Init() must be called before using this container. Begin() and Reset() can be safely called before
+ *          initialization and Begin() will always return an iterator that points to null.
+ * @warning Value pointers returned by FindKey and FindAllocate are invalidated by any later Insert, FindAllocate or
+ *          Erase call.
+ *
+ * For more details please refer to @ref OpenHashBase.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc  = DefaultHashFunc,
+         template<typename> class EqualFunc = DefaultEqualFunc>
+class OpenHashMap : public OpenHashBase<Key, HashMapEntry<Key, Value>, Allocator, HashFunc<Key>, EqualFunc<Key>>
+{
+public:
+    /// Convenience typedef for a templated entry of this hash map.
+    typedef HashMapEntry<Key, Value> Entry;
+
+    /// @internal Constructor
+    ///
+    /// @param [in] numEntries Number of entries the map is expected to hold.  The map grows past this as needed.
+    /// @param [in] pAllocator Pointer to an allocator that will create system memory requested by this hash container.
+    explicit OpenHashMap(uint32 numEntries, Allocator*const pAllocator) : Base::OpenHashBase(numEntries, pAllocator) { }
+    virtual ~OpenHashMap() { }
+
+    /// Finds a given entry; if no entry was found, allocate it.
+    ///
+    /// @param [in]  key      Key to search for.
+    /// @param [out] pExisted True if an entry for the specified key existed before this call was made.  False indicates
+    ///                       that a new entry was allocated as a result of this call.
+    /// @param [out] ppValue  Readable/writeable value in the hash map corresponding to the specified key.
+    ///
+    /// @returns @ref Success if the operation completed successfully, or @ref ErrorOutOfMemory if the operation failed
+    ///          because an internal memory allocation failed.
+    Result FindAllocate(const Key& key, bool* pExisted, Value** ppValue);
+
+    /// Gets a pointer to the value that matches the specified key.
+    ///
+    /// @param [in] key Key to search for.
+    ///
+    /// @returns A pointer to the value that matches the specified key or null if an entry for the key does not exist.
+    Value* FindKey(const Key& key) const;
+
+    /// Inserts a key/value pair entry if the key doesn't already exist in the hash map.
+    ///
+    /// @warning No action will be taken if an entry matching this key already exists, even if the specified value
+    ///          differs from the current value stored in the entry matching the specified key.
+    ///
+    /// @param [in] key   Key of the new entry to insert.
+    /// @param [in] value Value of the new entry to insert.
+    ///
+    /// @returns @ref Success if the operation completed successfully, or @ref ErrorOutOfMemory if the operation failed
+    ///          because an internal memory allocation failed.
+    Result Insert(const Key& key, const Value& value);
+
+    /// Removes an entry that matches the specified key.
+    ///
+    /// @param [in] key Key of the entry to erase.
+    ///
+    /// @returns True if the erase completed successfully, false if an entry for this key did not exist.
+    bool Erase(const Key& key) { return this->EraseEntry(key); }
+
+private:
+    // Typedef for the specialized 'OpenHashBase' object we're inheriting from so we can use properly qualified names
+    // when accessing members of OpenHashBase.
+    typedef OpenHashBase<Key, HashMapEntry<Key, Value>, Allocator, HashFunc<Key>, EqualFunc<Key>> Base;
+
+    PAL_DISALLOW_DEFAULT_CTOR(OpenHashMap);
+    PAL_DISALLOW_COPY_AND_ASSIGN(OpenHashMap);
+};
+
+} // Util
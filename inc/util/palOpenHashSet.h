@@ -0,0 +1,106 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palOpenHashSet.h
+ * @brief PAL utility collection OpenHashSet class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashSet.h"
+#include "palOpenHashBase.h"
+
+namespace Util
+{
+
+/**
+ ***********************************************************************************************************************
+ * @brief Templated, self-resizing hash set container.
+ *
+ * Offers the same interface as @ref HashSet, but is backed by an open-addressing table that grows as entries are
+ * added instead of a fixed number of buckets.
+ *
+ * HashFunc and EqualFunc accept the same functors as @ref HashSet.
+ *
+ * @warning This class is not thread-safe for Insert, Erase, or iteration!
+ * @warning Init() must be called before using this container. Begin() and Reset() can be safely called before
+ *          initialization and Begin() will always return an iterator that points to null.
+ *
+ * For more details please refer to @ref OpenHashBase.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Allocator,
+         template<typename> class HashFunc  = DefaultHashFunc,
+         template<typename> class EqualFunc = DefaultEqualFunc>
+class OpenHashSet : public OpenHashBase<Key, HashSetEntry<Key>, Allocator, HashFunc<Key>, EqualFunc<Key>>
+{
+public:
+    /// Convenience typedef for a templated entry of this hash set.
+    typedef HashSetEntry<Key> Entry;
+
+    /// @internal Constructor
+    ///
+    /// @param [in] numEntries Number of entries the set is expected to hold.  The set grows past this as needed.
+    /// @param [in] pAllocator Pointer to an allocator that will create system memory requested by this hash container.
+    explicit OpenHashSet(uint32 numEntries, Allocator*const pAllocator) : Base::OpenHashBase(numEntries, pAllocator) { }
+    virtual ~OpenHashSet() { }
+
+    /// Returns true if the specified key exists in the set.
+    ///
+    /// @param [in] key Key to search for.
+    ///
+    /// @returns True if the specified key exists in the set.
+    bool Contains(const Key& key) const { return (this->FindEntry(key) != nullptr); }
+
+    /// Inserts an entry.
+    ///
+    /// No action will be taken if an entry matching this key already exists in the set.
+    ///
+    /// @param [in] key New entry to insert.
+    ///
+    /// @returns @ref Success if the operation completed successfully, or @ref ErrorOutOfMemory if the operation failed
+    ///          because an internal memory allocation failed.
+    Result Insert(const Key& key);
+
+    /// Removes an entry that matches the specified key.
+    ///
+    /// @param [in] key Key of the entry to erase.
+    ///
+    /// @returns True if the erase completed successfully, false if an entry for this key did not exist.
+    bool Erase(const Key& key) { return this->EraseEntry(key); }
+
+private:
+    // Typedef for the specialized 'OpenHashBase' object we're inheriting from so we can use properly qualified names
+    // when accessing members of OpenHashBase.
+    typedef OpenHashBase<Key, HashSetEntry<Key>, Allocator, HashFunc<Key>, EqualFunc<Key>> Base;
+
+    PAL_DISALLOW_DEFAULT_CTOR(OpenHashSet);
+    PAL_DISALLOW_COPY_AND_ASSIGN(OpenHashSet);
+};
+
+} // Util
@@ -89,6 +89,18 @@ CmdAllocator::CmdAllocator(
     :
     m_pDevice(pDevice),
     m_pChunkLock(nullptr),
+    m_pThreadCaches(nullptr),
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    m_reclaimIntervalMs((createInfo.reclaimIntervalMs != 0) ? createInfo.reclaimIntervalMs : DefaultReclaimIntervalMs),
+    m_reclaimStop(false),
+    m_reclaimSweeping(false),
+    m_prefaultChunkCount(createInfo.prefaultChunkCount),
+#else
+    m_reclaimIntervalMs(DefaultReclaimIntervalMs),
+    m_reclaimStop(false),
+    m_reclaimSweeping(false),
+    m_prefaultChunkCount(0),
+#endif
     m_lastPagingFence(0),
     m_pLinearAllocLock(nullptr),
     m_pDummyChunkAllocation(nullptr)
@@ -110,6 +122,15 @@ CmdAllocator::CmdAllocator(
         // If this allocator is thread safe we construct mutexes immediately following this object in memory.
         m_pChunkLock       = PAL_PLACEMENT_NEW(this + 1) Mutex();
         m_pLinearAllocLock = PAL_PLACEMENT_NEW(m_pChunkLock + 1) Mutex();
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        // Per-thread chunk caches only exist to keep threads off of the chunk lock.
+        m_flags.threadChunkCaches = createInfo.flags.perThreadChunkCache;
+
+        // The reclaim worker shares the chunk lists with the recording threads so it requires the chunk lock, and
+        // there's nothing for it to reclaim unless chunks are returned to us automatically.
+        m_flags.reclaimWorker = (createInfo.flags.backgroundReclaim & createInfo.flags.autoMemoryReuse);
+#endif
     }
 
     const uint32 residencyFlags = m_pDevice->GetPublicSettings()->cmdAllocResidency;
@@ -117,6 +138,13 @@ CmdAllocator::CmdAllocator(
     {
         memset(&m_gpuAllocInfo[i].allocCreateInfo, 0, sizeof(m_gpuAllocInfo[i].allocCreateInfo));
 
+        m_gpuAllocInfo[i].numAllocs            = 0;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        m_gpuAllocInfo[i].reclaimHighWaterMark = createInfo.allocInfo[i].reclaimHighWaterMark;
+#else
+        m_gpuAllocInfo[i].reclaimHighWaterMark = 0;
+#endif
+
         m_gpuAllocInfo[i].allocCreateInfo.memObjCreateInfo.priority  = GpuMemPriority::Normal;
         m_gpuAllocInfo[i].allocCreateInfo.memObjCreateInfo.vaRange   = VaRange::Default;
         if (i != GpuScratchMemAlloc)
@@ -188,6 +216,11 @@ CmdAllocator::CmdAllocator(
     // memory heaps selected.
     m_sysAllocInfo.allocCreateInfo = m_gpuAllocInfo[CommandDataAlloc].allocCreateInfo;
     m_sysAllocInfo.allocCreateInfo.memObjCreateInfo.heapCount = 0;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    m_sysAllocInfo.allocCreateInfo.flags.hugePages            = createInfo.flags.sysMemHugePages;
+#endif
+    m_sysAllocInfo.numAllocs                                  = 0;
+    m_sysAllocInfo.reclaimHighWaterMark                       = m_gpuAllocInfo[CommandDataAlloc].reclaimHighWaterMark;
 
     ResourceDescriptionCmdAllocator desc = {};
     desc.pCreateInfo = &createInfo;
@@ -208,6 +241,9 @@ CmdAllocator::~CmdAllocator()
     data.pObj = this;
     m_pDevice->GetPlatform()->GetEventProvider()->LogGpuMemoryResourceDestroyEvent(data);
 
+    // The reclaim thread uses the chunk lock so it must exit before we destroy the mutexes.
+    StopReclaimWorker();
+
     // We must explicitly invoke the mutexes' destructors because we created them using placement new.
     if (m_pChunkLock != nullptr)
     {
@@ -224,6 +260,12 @@ CmdAllocator::~CmdAllocator()
     FreeAllChunks();
     FreeAllLinearAllocators();
 
+    if (UsesThreadChunkCaches())
+    {
+        FreeThreadChunkCaches();
+        DeleteThreadLocalKey(m_threadCacheKey);
+    }
+
     // Free the dummy chunk.
     if (m_pDummyChunkAllocation != nullptr)
     {
@@ -303,6 +345,9 @@ void CmdAllocator::FreeAllChunks()
     }
 #endif
 
+    // The thread caches only hold pointers to chunks owned by the allocations we're about to destroy.
+    ClearThreadChunkCaches();
+
     // Note that as soon as we start destroying allocations our command chunk's head chunks become invalid. Nothing
     // called in this loop can access those head chunks.
     for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
@@ -323,6 +368,8 @@ void CmdAllocator::FreeAllChunks()
             pAlloc->Destroy(m_pDevice);
             PAL_SAFE_FREE(pAlloc, m_pDevice->GetPlatform());
         }
+
+        pAllocInfo[i]->numAllocs = 0;
     }
 }
 
@@ -356,6 +403,16 @@ Result CmdAllocator::Init()
         result = m_pLinearAllocLock->Init();
     }
 
+    if (UsesThreadChunkCaches() && (result == Result::Success))
+    {
+        // Thread-local keys are a limited resource. If we can't get one, fall back to the shared chunk lists rather
+        // than failing allocator creation.
+        if (CreateThreadLocalKey(&m_threadCacheKey) != Result::Success)
+        {
+            m_flags.threadChunkCaches = 0;
+        }
+    }
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     const auto& settings = m_pDevice->Settings();
 
@@ -389,6 +446,17 @@ Result CmdAllocator::Init()
         result = CreateDummyChunkAllocation();
     }
 
+    // Start the reclaim worker last so that it never sees a partially initialized allocator.
+    if (UsesReclaimWorker() && (result == Result::Success))
+    {
+        result = m_reclaimCondVar.Init();
+
+        if (result == Result::Success)
+        {
+            result = m_reclaimThread.Begin(&ReclaimThreadFunc, this);
+        }
+    }
+
     return result;
 }
 
@@ -412,11 +480,32 @@ Result CmdAllocator::Reset()
         m_pChunkLock->Lock();
     }
 
+    // The reclaim thread may be destroying or pre-faulting chunks which it has taken off of our lists. Wait for it to
+    // put them back before we rebuild or free the lists.
+    while (m_reclaimSweeping)
+    {
+        m_reclaimCondVar.Wait(m_pChunkLock, m_reclaimIntervalMs);
+    }
+
     if (freeOnReset)
     {
         // We've been asked to simply destroy all of our allocations on each reset.
         FreeAllChunks();
     }
+    else if (UsesThreadChunkCaches())
+    {
+        // Chunks which are in use by command streams aren't on any list when the thread caches are in use, so we must
+        // rebuild the free lists from the allocations themselves. The client guarantees that no thread is recording
+        // with this allocator during Reset() so we're free to empty the thread caches.
+        ClearThreadChunkCaches();
+
+        for (uint32 i = 0; i < CmdAllocatorTypeCount; ++i)
+        {
+            ReclaimAllChunks(&m_gpuAllocInfo[i]);
+        }
+
+        ReclaimAllChunks(&m_sysAllocInfo);
+    }
     else
     {
         for (uint32 i = 0; i < CmdAllocatorTypeCount; ++i)
@@ -467,7 +556,57 @@ void CmdAllocator::ReuseChunks(
     // System memory allocations are only allowed for command data!
     PAL_ASSERT((systemMemory == false) || (allocType == CommandDataAlloc));
 
-    if (AutomaticMemoryReuse())
+    if (AutomaticMemoryReuse() && UsesThreadChunkCaches())
+    {
+        auto*const pAllocInfo = (systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType]);
+
+        if (iter.Get()->IsIdle())
+        {
+            // The chunks can be reused immediately so push them onto this thread's cache, draining half of it back to
+            // the shared free list each time it fills up.
+            ThreadChunkCache*const pThreadCache = GetThreadChunkCache();
+
+            if (pThreadCache != nullptr)
+            {
+                ChunkCache*const pCache = &pThreadCache->caches[systemMemory ? CmdAllocatorTypeCount : allocType];
+
+                while (iter.IsValid())
+                {
+                    if (pCache->numChunks == ChunkCacheSize)
+                    {
+                        DrainChunkCache(pAllocInfo, pCache);
+                    }
+
+                    iter.Get()->Reset(true);
+                    pCache->pChunks[pCache->numChunks++] = iter.Get();
+                    iter.Next();
+                }
+            }
+            else
+            {
+                MutexAuto lock(m_pChunkLock);
+
+                while (iter.IsValid())
+                {
+                    iter.Get()->Reset(true);
+                    pAllocInfo->freeList.PushFront(iter.Get()->ListNode());
+                    iter.Next();
+                }
+            }
+        }
+        else
+        {
+            // Chunks still in use by the GPU go to the shared reuse list, all under a single acquisition of the lock.
+            MutexAuto lock(m_pChunkLock);
+
+            while (iter.IsValid())
+            {
+                pAllocInfo->reuseList.PushFront(iter.Get()->ListNode());
+                iter.Next();
+            }
+        }
+    }
+    else if (AutomaticMemoryReuse())
     {
         // If necessary, engage the chunk lock.
         if (m_pChunkLock != nullptr)
@@ -522,16 +661,65 @@ Result CmdAllocator::GetNewChunk(
     // System memory allocations are only allowed for command data!
     PAL_ASSERT((systemMemory == false) || (allocType == CommandDataAlloc));
 
+    ThreadChunkCache*const pThreadCache = UsesThreadChunkCaches() ? GetThreadChunkCache() : nullptr;
+
+    if (pThreadCache != nullptr)
+    {
+        // Only this thread touches its cache, so we only need the chunk lock if the cache must be refilled.
+        ChunkCache*const pCache = &pThreadCache->caches[systemMemory ? CmdAllocatorTypeCount : allocType];
+        Result           result = Result::Success;
+
+        if (pCache->numChunks == 0)
+        {
+            result = RefillChunkCache(systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType], pCache);
+
+            if (result == Result::Success)
+            {
+                // The refilled chunks belong to this thread so they can be pre-faulted without holding the lock.
+                PrefaultCachedChunks(*pCache);
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            PAL_ASSERT(pCache->numChunks > 0);
+
+            CmdStreamChunk*const pChunk = pCache->pChunks[--pCache->numChunks];
+            PAL_ASSERT((AutomaticMemoryReuse() && pChunk->IsIdle()) || pChunk->IsIdleOnGpu());
+
+            pChunk->AddCommandStreamReference();
+            *ppChunk = pChunk;
+        }
+
+        return result;
+    }
+
     // If necessary, engage the chunk lock while we search for a free chunk.
     if (m_pChunkLock != nullptr)
     {
         m_pChunkLock->Lock();
     }
 
-    Result result = FindFreeChunk(systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType], ppChunk);
+    CmdAllocInfo*const pAllocInfo = (systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType]);
+
+    Result result = FindFreeChunk(pAllocInfo, ppChunk);
     if (result == Result::Success)
     {
+        if (UsesThreadChunkCaches())
+        {
+            // We only get here if this thread's chunk cache couldn't be allocated. ReuseChunks will still return this
+            // chunk through the thread caches, which expect it not to live on any list, so take it off the busy list.
+            pAllocInfo->busyList.Erase((*ppChunk)->ListNode());
+        }
+
         (*ppChunk)->AddCommandStreamReference();
+
+        // The reclaim worker keeps the free list pre-faulted on our behalf, if it exists.
+        if ((m_prefaultChunkCount > 0) && (UsesReclaimWorker() == false))
+        {
+            (*ppChunk)->Prefault();
+            PrefaultFreeChunks(pAllocInfo);
+        }
     }
 
     if (m_pChunkLock != nullptr)
@@ -570,8 +758,14 @@ Result CmdAllocator::FindFreeChunk(
         if (AutomaticMemoryReuse())
         {
             // Search the reuse list for a chunk that expired after it was returned to us. Start at the end because
-            // those chunks have been on the list the longest and are most likely to be idle.
-            for (auto reuseIter = pAllocInfo->reuseList.End(); reuseIter.IsValid(); reuseIter.Prev())
+            // those chunks have been on the list the longest and are most likely to be idle. The reclaim worker sweeps
+            // the whole list on our behalf, if it exists, so we only check the oldest few chunks in that case.
+            const uint32 pollLimit = UsesReclaimWorker() ? ReclaimWorkerPollLimit : UINT32_MAX;
+            uint32       numPolled = 0;
+
+            for (auto reuseIter = pAllocInfo->reuseList.End();
+                 reuseIter.IsValid() && (numPolled < pollLimit);
+                 reuseIter.Prev(), numPolled++)
             {
                 if (reuseIter.Get()->IsIdle())
                 {
@@ -599,6 +793,408 @@ Result CmdAllocator::FindFreeChunk(
     return result;
 }
 
+// =====================================================================================================================
+// Returns the calling thread's chunk caches, creating them on the thread's first visit. Returns null if we ran out of
+// memory, in which case the caller must fall back to the shared chunk lists.
+CmdAllocator::ThreadChunkCache* CmdAllocator::GetThreadChunkCache()
+{
+    PAL_ASSERT(UsesThreadChunkCaches());
+
+    ThreadChunkCache* pThreadCache = static_cast<ThreadChunkCache*>(GetThreadLocalValue(m_threadCacheKey));
+
+    if (pThreadCache == nullptr)
+    {
+        pThreadCache = static_cast<ThreadChunkCache*>(PAL_CALLOC(sizeof(ThreadChunkCache),
+                                                                 m_pDevice->GetPlatform(),
+                                                                 AllocInternal));
+
+        if (pThreadCache != nullptr)
+        {
+            if (SetThreadLocalValue(m_threadCacheKey, pThreadCache) == Result::Success)
+            {
+                MutexAuto lock(m_pChunkLock);
+
+                pThreadCache->pNext = m_pThreadCaches;
+                m_pThreadCaches     = pThreadCache;
+            }
+            else
+            {
+                PAL_SAFE_FREE(pThreadCache, m_pDevice->GetPlatform());
+            }
+        }
+    }
+
+    return pThreadCache;
+}
+
+// =====================================================================================================================
+// Moves a batch of free chunks from the shared lists into an empty thread chunk cache. Reset chunks on the free list
+// are preferred, followed by idle chunks on the reuse list; a new allocation is created only if neither has any.
+Result CmdAllocator::RefillChunkCache(
+    CmdAllocInfo* pAllocInfo,
+    ChunkCache*   pCache)
+{
+    PAL_ASSERT(pCache->numChunks == 0);
+
+    Result result = Result::Success;
+
+    MutexAuto lock(m_pChunkLock);
+
+    if (pAllocInfo->freeList.IsEmpty() && AutomaticMemoryReuse())
+    {
+        // Start at the end of the reuse list because those chunks have been on the list the longest and are most
+        // likely to be idle. The reclaim worker sweeps the whole list on our behalf, if it exists, so we only check
+        // the oldest few chunks in that case.
+        const uint32 pollLimit = UsesReclaimWorker() ? ReclaimWorkerPollLimit : UINT32_MAX;
+        uint32       numPolled = 0;
+
+        for (auto reuseIter = pAllocInfo->reuseList.End();
+             reuseIter.IsValid() && (pCache->numChunks < ChunkCacheBatchSize) && (numPolled < pollLimit);
+             numPolled++)
+        {
+            CmdStreamChunk*const pChunk = reuseIter.Get();
+            reuseIter.Prev();
+
+            if (pChunk->IsIdle())
+            {
+                pChunk->Reset(true);
+                pAllocInfo->reuseList.Erase(pChunk->ListNode());
+                pCache->pChunks[pCache->numChunks++] = pChunk;
+            }
+        }
+    }
+
+    if (pAllocInfo->freeList.IsEmpty() && (pCache->numChunks == 0))
+    {
+        // Nothing could be recycled so we must create a new allocation. It will place its first chunk on the busy list
+        // and the rest on the free list, but chunks handed out through thread caches don't live on any list.
+        CmdStreamChunk* pChunk = nullptr;
+        result = CreateAllocation(pAllocInfo, false, &pChunk);
+
+        if (result == Result::Success)
+        {
+            pAllocInfo->busyList.Erase(pChunk->ListNode());
+            pCache->pChunks[pCache->numChunks++] = pChunk;
+        }
+    }
+
+    while ((pCache->numChunks < ChunkCacheBatchSize) && (pAllocInfo->freeList.IsEmpty() == false))
+    {
+        CmdStreamChunk*const pChunk = pAllocInfo->freeList.Back();
+        pAllocInfo->freeList.Erase(pChunk->ListNode());
+        pCache->pChunks[pCache->numChunks++] = pChunk;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Moves the oldest batch of chunks in a full thread chunk cache back to the shared free list so that other threads can
+// use them.
+void CmdAllocator::DrainChunkCache(
+    CmdAllocInfo* pAllocInfo,
+    ChunkCache*   pCache)
+{
+    PAL_ASSERT(pCache->numChunks == ChunkCacheSize);
+
+    {
+        MutexAuto lock(m_pChunkLock);
+
+        for (uint32 idx = 0; idx < ChunkCacheBatchSize; ++idx)
+        {
+            pAllocInfo->freeList.PushFront(pCache->pChunks[idx]->ListNode());
+        }
+    }
+
+    // Slide the most-recently released chunks down to the bottom of the stack.
+    memmove(&pCache->pChunks[0],
+            &pCache->pChunks[ChunkCacheBatchSize],
+            sizeof(CmdStreamChunk*) * (ChunkCacheSize - ChunkCacheBatchSize));
+    pCache->numChunks = ChunkCacheSize - ChunkCacheBatchSize;
+}
+
+// =====================================================================================================================
+// Resets every chunk owned by the given allocation type and places it on the free list. This is how Reset() recovers
+// chunks which were handed out through the thread chunk caches, since those are never tracked on the busy list. The
+// caller must hold the chunk lock and must have already emptied the thread chunk caches.
+void CmdAllocator::ReclaimAllChunks(
+    CmdAllocInfo* pAllocInfo)
+{
+    pAllocInfo->freeList.EraseAll();
+    pAllocInfo->busyList.EraseAll();
+    pAllocInfo->reuseList.EraseAll();
+
+    const uint32 numChunks = pAllocInfo->allocCreateInfo.numChunks;
+
+    for (auto iter = pAllocInfo->allocList.Begin(); iter.IsValid(); iter.Next())
+    {
+        CmdStreamChunk*const pChunks = iter.Get()->Chunks();
+
+        for (uint32 idx = 0; idx < numChunks; ++idx)
+        {
+            // As with TransferChunks, the caller must guarantee that all of these chunks have expired.
+            PAL_ASSERT((TrackBusyChunks() == false) || pChunks[idx].IsIdleOnGpu());
+
+            pChunks[idx].Reset(true);
+            pAllocInfo->freeList.PushBack(pChunks[idx].ListNode());
+        }
+    }
+}
+
+// =====================================================================================================================
+// Forgets every chunk held in every thread's chunk caches. The caller must hold the chunk lock and guarantee that no
+// other thread is using this allocator.
+void CmdAllocator::ClearThreadChunkCaches()
+{
+    for (ThreadChunkCache* pThreadCache = m_pThreadCaches; pThreadCache != nullptr; pThreadCache = pThreadCache->pNext)
+    {
+        for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
+        {
+            pThreadCache->caches[i].numChunks = 0;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Frees the memory backing every thread's chunk caches. Only called at destruction time.
+void CmdAllocator::FreeThreadChunkCaches()
+{
+    while (m_pThreadCaches != nullptr)
+    {
+        ThreadChunkCache*const pThreadCache = m_pThreadCaches;
+        m_pThreadCaches = pThreadCache->pNext;
+
+        PAL_FREE(pThreadCache, m_pDevice->GetPlatform());
+    }
+}
+
+// =====================================================================================================================
+void CmdAllocator::ReclaimThreadFunc(
+    void* pParam)
+{
+    static_cast<CmdAllocator*>(pParam)->ReclaimLoop();
+}
+
+// =====================================================================================================================
+// The reclaim thread's main loop. Each sweep moves idle chunks from the reuse lists to the free lists, trims idle
+// allocations down to their high-water marks and pre-faults the next free chunks to be handed out. The chunk lock is
+// only held while we pick and unlink chunks and allocations; destroying allocations and pre-faulting chunks are slow
+// so we do those after releasing it.
+void CmdAllocator::ReclaimLoop()
+{
+    CmdAllocInfo*const pAllocInfo[] =
+    {
+        &m_gpuAllocInfo[CommandDataAlloc],
+        &m_gpuAllocInfo[EmbeddedDataAlloc],
+        &m_gpuAllocInfo[GpuScratchMemAlloc],
+        &m_sysAllocInfo,
+    };
+    static_assert(ArrayLen(pAllocInfo) == (CmdAllocatorTypeCount + 1),
+                  "Unexpected number of command allocation memory types!");
+
+    m_pChunkLock->Lock();
+
+    while (m_reclaimStop == false)
+    {
+        AllocList trimmedAllocs;
+        ChunkList prefaultChunks[CmdAllocatorTypeCount + 1];
+
+        for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
+        {
+            ReclaimIdleChunks(pAllocInfo[i]);
+            TrimIdleAllocations(pAllocInfo[i], &trimmedAllocs);
+            CollectPrefaultChunks(pAllocInfo[i], &prefaultChunks[i]);
+        }
+
+        // Nothing else can reach these allocations or chunks now that they're off of every list. Reset() waits for us
+        // to finish with them before it touches the lists.
+        m_reclaimSweeping = true;
+        m_pChunkLock->Unlock();
+
+        while (trimmedAllocs.IsEmpty() == false)
+        {
+            CmdStreamAllocation*const pAlloc = trimmedAllocs.Back();
+            trimmedAllocs.Erase(pAlloc->ListNode());
+
+            pAlloc->Destroy(m_pDevice);
+            PAL_FREE(pAlloc, m_pDevice->GetPlatform());
+        }
+
+        for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
+        {
+            for (auto iter = prefaultChunks[i].Begin(); iter.IsValid(); iter.Next())
+            {
+                iter.Get()->Prefault();
+            }
+        }
+
+        m_pChunkLock->Lock();
+
+        // Put the pre-faulted chunks back where FindFreeChunk and RefillChunkCache will take them from next.
+        for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
+        {
+            while (prefaultChunks[i].IsEmpty() == false)
+            {
+                CmdStreamChunk*const pChunk = prefaultChunks[i].Front();
+                prefaultChunks[i].Erase(pChunk->ListNode());
+                pAllocInfo[i]->freeList.PushBack(pChunk->ListNode());
+            }
+        }
+
+        m_reclaimSweeping = false;
+        m_reclaimCondVar.WakeAll();
+
+        if (m_reclaimStop == false)
+        {
+            m_reclaimCondVar.Wait(m_pChunkLock, m_reclaimIntervalMs);
+        }
+    }
+
+    m_pChunkLock->Unlock();
+}
+
+// =====================================================================================================================
+// Resets every chunk on the reuse list which the GPU has finished with and moves it to the free list. The caller must
+// hold the chunk lock.
+void CmdAllocator::ReclaimIdleChunks(
+    CmdAllocInfo* pAllocInfo)
+{
+    for (auto iter = pAllocInfo->reuseList.Begin(); iter.IsValid();)
+    {
+        CmdStreamChunk*const pChunk = iter.Get();
+
+        if (pChunk->IsIdle())
+        {
+            pAllocInfo->reuseList.Erase(&iter);
+
+            pChunk->Reset(true);
+            pAllocInfo->freeList.PushFront(pChunk->ListNode());
+        }
+        else
+        {
+            iter.Next();
+        }
+    }
+}
+
+// =====================================================================================================================
+// Picks allocations whose chunks are all on the free list until the allocation count drops to the high-water mark. The
+// picked allocations and their chunks are removed from every list and moved onto pTrimmedAllocs so that the caller can
+// destroy them after releasing the chunk lock. The caller must hold the chunk lock.
+void CmdAllocator::TrimIdleAllocations(
+    CmdAllocInfo* pAllocInfo,
+    AllocList*    pTrimmedAllocs)
+{
+    if ((pAllocInfo->reclaimHighWaterMark != 0) && (pAllocInfo->numAllocs > pAllocInfo->reclaimHighWaterMark))
+    {
+        const uint32 numChunks = pAllocInfo->allocCreateInfo.numChunks;
+
+        // Chunks which are referenced by command streams, waiting on the reuse list, or sitting in a thread chunk
+        // cache all keep their allocation alive; only chunks on the free list are known to be unused. Count each
+        // allocation's free chunks in a single pass over the free list.
+        for (auto allocIter = pAllocInfo->allocList.Begin(); allocIter.IsValid(); allocIter.Next())
+        {
+            allocIter.Get()->ResetNumFreeChunks();
+        }
+
+        for (auto chunkIter = pAllocInfo->freeList.Begin(); chunkIter.IsValid(); chunkIter.Next())
+        {
+            chunkIter.Get()->Allocation().IncrementNumFreeChunks();
+        }
+
+        // Start with the newest allocations; the older ones are more likely to be partially in use.
+        for (auto allocIter = pAllocInfo->allocList.End();
+             allocIter.IsValid() && (pAllocInfo->numAllocs > pAllocInfo->reclaimHighWaterMark);)
+        {
+            CmdStreamAllocation*const pAlloc = allocIter.Get();
+            allocIter.Prev();
+
+            if (pAlloc->NumFreeChunks() == numChunks)
+            {
+                CmdStreamChunk*const pChunks = pAlloc->Chunks();
+
+                for (uint32 idx = 0; idx < numChunks; ++idx)
+                {
+                    pAllocInfo->freeList.Erase(pChunks[idx].ListNode());
+                }
+
+                pAllocInfo->allocList.Erase(pAlloc->ListNode());
+                pAllocInfo->numAllocs--;
+
+                pTrimmedAllocs->PushBack(pAlloc->ListNode());
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Moves the chunks at the back of the free list which haven't been pre-faulted yet onto pPrefaultChunks. These are the
+// next ones FindFreeChunk and RefillChunkCache will hand out. The chunks are taken off the free list so that no other
+// thread can write to them while the caller pre-faults them without the chunk lock. The caller must hold the chunk
+// lock.
+void CmdAllocator::CollectPrefaultChunks(
+    CmdAllocInfo* pAllocInfo,
+    ChunkList*    pPrefaultChunks)
+{
+    uint32 numChunks = 0;
+
+    for (auto iter = pAllocInfo->freeList.End(); iter.IsValid() && (numChunks < m_prefaultChunkCount); numChunks++)
+    {
+        CmdStreamChunk*const pChunk = iter.Get();
+        iter.Prev();
+
+        if (pChunk->IsPrefaulted() == false)
+        {
+            pAllocInfo->freeList.Erase(pChunk->ListNode());
+            pPrefaultChunks->PushFront(pChunk->ListNode());
+        }
+    }
+}
+
+// =====================================================================================================================
+// Pre-faults the chunks at the back of the free list, which are the next ones FindFreeChunk and RefillChunkCache will
+// hand out. Chunks only need to be pre-faulted once so this is cheap when the list is already warm. The caller must
+// hold the chunk lock.
+void CmdAllocator::PrefaultFreeChunks(
+    CmdAllocInfo* pAllocInfo)
+{
+    uint32 numChunks = 0;
+
+    for (auto iter = pAllocInfo->freeList.End(); iter.IsValid() && (numChunks < m_prefaultChunkCount); iter.Prev())
+    {
+        iter.Get()->Prefault();
+        numChunks++;
+    }
+}
+
+// =====================================================================================================================
+// Pre-faults the chunks at the top of a thread chunk cache, which are the next ones GetNewChunk will hand out.
+void CmdAllocator::PrefaultCachedChunks(
+    const ChunkCache& cache)
+{
+    const uint32 numChunks = Min(cache.numChunks, m_prefaultChunkCount);
+
+    for (uint32 idx = 0; idx < numChunks; ++idx)
+    {
+        cache.pChunks[cache.numChunks - 1 - idx]->Prefault();
+    }
+}
+
+// =====================================================================================================================
+// Signals the reclaim thread to exit and waits for it to do so.
+void CmdAllocator::StopReclaimWorker()
+{
+    if (m_reclaimThread.IsCreated())
+    {
+        m_pChunkLock->Lock();
+        m_reclaimStop = true;
+        m_reclaimCondVar.WakeOne();
+        m_pChunkLock->Unlock();
+
+        m_reclaimThread.Join();
+    }
+}
+
 // =====================================================================================================================
 // Creates a new command stream allocation and returns one of its chunks for immediate use. If the allocation contains
 // more than one chunk the rest will be pushed onto the free chunk list.
@@ -638,6 +1234,7 @@ Result CmdAllocator::CreateAllocation(
     {
         PAL_ASSERT(result == Result::Success);
         pAllocInfo->allocList.PushBack(pAlloc->ListNode());
+        pAllocInfo->numAllocs++;
 
         pChunk = pAlloc->Chunks();
         for (uint32 idx = 1; idx < allocCreateInfo.numChunks; ++idx)
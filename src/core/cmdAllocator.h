@@ -27,8 +27,10 @@
 
 #include "core/cmdStreamAllocation.h"
 #include "palCmdAllocator.h"
+#include "palConditionVariable.h"
 #include "palIntrusiveList.h"
 #include "palLinearAllocator.h"
+#include "palThread.h"
 #include "palVector.h"
 
 namespace Util { class Mutex; }
@@ -89,6 +91,8 @@ public:
 
     bool AutomaticMemoryReuse() const { return (m_flags.autoMemoryReuse != 0); }
     bool TrackBusyChunks() const      { return (m_flags.trackBusyChunks != 0); }
+    bool UsesThreadChunkCaches() const { return (m_flags.threadChunkCaches != 0); }
+    bool UsesReclaimWorker() const     { return (m_flags.reclaimWorker != 0); }
 
     uint64 LastPagingFence() const { return m_lastPagingFence; }
 
@@ -104,12 +108,60 @@ private:
 
         // All allocations for each alloc type are identical, so we can build the create info up-front.
         CmdStreamAllocationCreateInfo allocCreateInfo;
+
+        uint32 numAllocs;            // Number of allocations in allocList.
+        uint32 reclaimHighWaterMark; // The reclaim worker trims idle allocations down to this count if non-zero.
+    };
+
+    // The reclaim worker sweeps this often if the client doesn't specify an interval.
+    static constexpr uint32 DefaultReclaimIntervalMs = 100;
+
+    // The reclaim worker sweeps the reuse lists on behalf of every other thread, so a thread that finds no free chunk
+    // only checks this many of the oldest chunks on the reuse list before it creates a new allocation.
+    static constexpr uint32 ReclaimWorkerPollLimit = 4;
+
+    // Each thread's chunk cache holds at most this many chunks of each type. When a cache runs dry it is refilled with
+    // up to ChunkCacheBatchSize chunks under the chunk lock, and when it overflows the same number is drained back.
+    static constexpr uint32 ChunkCacheSize      = 16;
+    static constexpr uint32 ChunkCacheBatchSize = ChunkCacheSize / 2;
+
+    // A small LIFO stack of reset, idle chunks owned by a single thread. Chunks in a cache are on none of the lists in
+    // the corresponding CmdAllocInfo.
+    struct ChunkCache
+    {
+        CmdStreamChunk* pChunks[ChunkCacheSize];
+        uint32          numChunks;
     };
 
+    // All of the chunk caches for one thread. The last entry caches system-memory command chunks.
+    struct ThreadChunkCache
+    {
+        ChunkCache        caches[CmdAllocatorTypeCount + 1];
+        ThreadChunkCache* pNext; // Next thread's caches in m_pThreadCaches; protected by the chunk lock.
+    };
+
+    // These internal functions are used to manage the per-thread chunk caches.
+    ThreadChunkCache* GetThreadChunkCache();
+    Result RefillChunkCache(CmdAllocInfo* pAllocInfo, ChunkCache* pCache);
+    void DrainChunkCache(CmdAllocInfo* pAllocInfo, ChunkCache* pCache);
+    void ReclaimAllChunks(CmdAllocInfo* pAllocInfo);
+    void PrefaultCachedChunks(const ChunkCache& cache);
+    void ClearThreadChunkCaches();
+    void FreeThreadChunkCaches();
+
+    // These internal functions implement the background reclaim worker.
+    static void ReclaimThreadFunc(void* pParam);
+    void ReclaimLoop();
+    void ReclaimIdleChunks(CmdAllocInfo* pAllocInfo);
+    void TrimIdleAllocations(CmdAllocInfo* pAllocInfo, AllocList* pTrimmedAllocs);
+    void CollectPrefaultChunks(CmdAllocInfo* pAllocInfo, ChunkList* pPrefaultChunks);
+    void StopReclaimWorker();
+
     // These internal functions are used to manage all types of chunks.
     Result FindFreeChunk(CmdAllocInfo* pAllocInfo, CmdStreamChunk** ppChunk);
     Result CreateAllocation(CmdAllocInfo* pAllocInfo, bool dummyAlloc, CmdStreamChunk** ppChunk);
     Result CreateDummyChunkAllocation();
+    void PrefaultFreeChunks(CmdAllocInfo* pAllocInfo);
 
     void TransferChunks(ChunkList* pFreeList, ChunkList* pSrcList);
     void FreeAllChunks();
@@ -123,10 +175,12 @@ private:
     {
         struct
         {
-            uint32 autoMemoryReuse :  1; // Indicates that the allocator will automatically recycle idle chunks.
-            uint32 trackBusyChunks :  1; // Indicates that the allocator will track which chunks are idle (for debugging
-                                         // purposes, or for supporting 'autoMemoryReuse').
-            uint32 reserved        : 30;
+            uint32 autoMemoryReuse   :  1; // Indicates that the allocator will automatically recycle idle chunks.
+            uint32 trackBusyChunks   :  1; // Indicates that the allocator will track which chunks are idle (for
+                                           // debugging purposes, or for supporting 'autoMemoryReuse').
+            uint32 threadChunkCaches :  1; // Indicates that chunks are handed out through per-thread chunk caches.
+            uint32 reclaimWorker     :  1; // Indicates that a worker thread periodically reclaims idle chunks.
+            uint32 reserved          : 28;
         };
         uint32 u32All;
     }  m_flags;
@@ -137,6 +191,19 @@ private:
     CmdAllocInfo    m_gpuAllocInfo[CmdAllocatorTypeCount];
     CmdAllocInfo    m_sysAllocInfo;
 
+    Util::ThreadLocalKey m_threadCacheKey; // Maps each thread to its ThreadChunkCache if threadChunkCaches is set.
+    ThreadChunkCache*    m_pThreadCaches;  // Every ThreadChunkCache created by this allocator.
+
+    Util::Thread            m_reclaimThread;     // Background thread which sweeps the reuse lists.
+    Util::ConditionVariable m_reclaimCondVar;    // Wakes the reclaim thread early when it must exit, and wakes
+                                                 // Reset() when the reclaim thread finishes a sweep.
+    uint32                  m_reclaimIntervalMs; // Time between reclaim sweeps.
+    bool                    m_reclaimStop;       // Tells the reclaim thread to exit; protected by the chunk lock.
+    bool                    m_reclaimSweeping;   // True while the reclaim thread works on chunks or allocations it has
+                                                 // taken off of our lists without the chunk lock; protected by it.
+
+    const uint32    m_prefaultChunkCount;  // Free chunks of each type to keep pre-faulted ahead of the next acquire.
+
     // Most-recent paging fence value returned from the OS when allocating command-chunk allocations
     uint64          m_lastPagingFence;
 
@@ -24,6 +24,7 @@
  **********************************************************************************************************************/
 
 #include "core/cmdBuffer.h"
+#include "core/cmdStream.h"
 #include "core/device.h"
 #include "core/gpuEvent.h"
 #include "core/platform.h"
@@ -1244,6 +1245,14 @@ uint32 CmdBuffer::GetUsedSize(
         }
         break;
     case CommandDataAlloc:
+        for (uint32 idx = 0; idx < NumCmdStreams(); ++idx)
+        {
+            const CmdStream*const pCmdStream = GetCmdStream(idx);
+            if (pCmdStream != nullptr)
+            {
+                sizeInDwords += (pCmdStream->GetUsedCmdMemorySize() / sizeof(uint32));
+            }
+        }
         break;
     default:
         PAL_ASSERT_ALWAYS();
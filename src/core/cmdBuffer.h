@@ -215,6 +215,11 @@ public:
     virtual void CmdBindDepthStencilState(const IDepthStencilState* pDepthStencilState) override
         { PAL_NEVER_CALLED(); }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdBindStateBlock(const IStateBlock* pStateBlock) override
+        { PAL_NEVER_CALLED(); }
+#endif
+
     virtual void CmdSetBlendConst(const BlendConstParams& params) override
         { PAL_NEVER_CALLED(); }
 
@@ -698,6 +703,15 @@ public:
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override { PAL_NEVER_CALLED(); }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdDrawBatch(
+        const DrawBatchInfo& batchInfo) override { PAL_NEVER_CALLED(); }
+
+    virtual void CmdInsertSegments(
+        uint32            segmentCount,
+        ICmdBuffer*const* ppSegments) override { PAL_NEVER_CALLED(); }
+#endif
+
     virtual void CmdSaveComputeState(
         uint32 stateFlags) override { PAL_NEVER_CALLED(); }
 
@@ -255,6 +255,24 @@ void CmdStream::CommitCommands(
     m_pReserveBuffer = nullptr;
 }
 
+// =====================================================================================================================
+// Rolls the tail of the command stream back to the given address, discarding all commands committed after it. This
+// lets callers replace a packet sequence they just wrote, as long as nothing else has been written since.
+void CmdStream::RewindCommands(
+    const uint32* pCmdAddr)
+{
+#if PAL_ENABLE_PRINTS_ASSERTS
+    // It's not legal to rewind while commands are reserved.
+    PAL_ASSERT(m_isReserved == false);
+#endif
+
+    const uint32* pNextCmdAddr = GetNextCmdAddr();
+
+    PAL_ASSERT((pCmdAddr != nullptr) && (pCmdAddr <= pNextCmdAddr) && m_chunkList.Back()->ContainsAddress(pCmdAddr));
+
+    ReclaimCommandSpace(static_cast<uint32>(pNextCmdAddr - pCmdAddr));
+}
+
 // =====================================================================================================================
 // Returns a pointer to chunk command space that can hold commands of the given size. This may cause the command stream
 // to switch to a new chunk if the current chunk does not have enough free space.
@@ -214,6 +214,15 @@ public:
     // Returns the current GPU VA of this command stream
     gpusize GetCurrentGpuVa();
 
+    // Returns the CPU address at which the next command will be written, or null if no chunk has been allocated yet.
+    // Comparing this against a value saved earlier tells the caller whether any commands were written in between.
+    const uint32* GetNextCmdAddr() const
+        { return (GetNumChunks() > 0) ? m_chunkList.Back()->PeekNextCommandAddr() : nullptr; }
+
+    // Discards every command written after pCmdAddr, which must have been returned by GetNextCmdAddr while the current
+    // tail chunk was already active.
+    void RewindCommands(const uint32* pCmdAddr);
+
     uint32 GetSizeAlignDwords() const { return m_sizeAlignDwords; }
 
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -31,12 +31,18 @@
 #include "palFile.h"
 #include "palIntrusiveListImpl.h"
 #include "palSysMemory.h"
+#if defined(__unix__)
+#include "util/lnx/lnxSysMemory.h"
+#endif
 
 using namespace Util;
 
 namespace Pal
 {
 
+// The size of a transparent huge page on the platforms we care about.
+constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
 // =====================================================================================================================
 // We need enough space for our class and its array of chunks.
 size_t CmdStreamAllocation::GetSize(
@@ -78,7 +84,8 @@ CmdStreamAllocation::CmdStreamAllocation(
     m_pChunks(reinterpret_cast<CmdStreamChunk*>(this + 1)),
     m_pGpuMemory(nullptr),
     m_pCpuAddr(nullptr),
-    m_pStaging(nullptr)
+    m_pStaging(nullptr),
+    m_numFreeChunks(0)
 {
 }
 
@@ -104,12 +111,26 @@ Result CmdStreamAllocation::Init(
     {
         PAL_ASSERT(IsPow2Aligned(ChunkSize(), VirtualPageSize()));
 
-        result = VirtualReserve(static_cast<size_t>(m_createInfo.memObjCreateInfo.size),
-                                reinterpret_cast<void**>(&m_pCpuAddr));
+        const size_t allocSize = static_cast<size_t>(m_createInfo.memObjCreateInfo.size);
+        const bool   hugePages = (m_createInfo.flags.hugePages != 0) && (allocSize >= HugePageSize);
+
+        // Huge pages can only back naturally aligned huge page ranges so align the whole allocation to one.
+        result = VirtualReserve(allocSize,
+                                reinterpret_cast<void**>(&m_pCpuAddr),
+                                nullptr,
+                                hugePages ? HugePageSize : 1);
         if (result == Result::Success)
         {
-            result = VirtualCommit(m_pCpuAddr, static_cast<size_t>(m_createInfo.memObjCreateInfo.size));
+            result = VirtualCommit(m_pCpuAddr, allocSize);
+        }
+
+#if defined(__unix__)
+        if ((result == Result::Success) && hugePages)
+        {
+            // This is only a hint; the allocation works just as well with normal pages if the OS refuses.
+            VirtualAdviseHugePages(m_pCpuAddr, allocSize);
         }
+#endif
     }
     else
     {
@@ -218,7 +239,8 @@ CmdStreamChunk::CmdStreamChunk(
     m_usedDataSizeDwords(0),
     m_cmdDwordsToExecute(0),
     m_cmdDwordsToExecuteNoPostamble(0),
-    m_reservedDataOffset(SizeDwords())
+    m_reservedDataOffset(SizeDwords()),
+    m_prefaulted(false)
 {
     ResetBusyTracker();
 }
@@ -387,6 +409,23 @@ void CmdStreamChunk::Reset(
     ResetBusyTracker();
 }
 
+// =====================================================================================================================
+// Faults in the CPU pages this chunk's commands will be written to so that the command stream which gets this chunk
+// won't take page faults while recording. Pages stay resident once faulted in so this only does work the first time.
+// This must only be called on free chunks.
+void CmdStreamChunk::Prefault()
+{
+    if ((m_prefaulted == false) && m_allocation.CpuAccessible() && (m_pWriteAddr != nullptr))
+    {
+#if defined(__unix__)
+        // A failure here only means that the pages will be faulted in as they're written, as they would have been.
+        VirtualPrefault(m_pWriteAddr, Size());
+#endif
+
+        m_prefaulted = true;
+    }
+}
+
 // =====================================================================================================================
 // Initialize the busy tracker to represent a state indicating that:
 // <> This chunk is the "root" of whatever command stream owns it;
@@ -57,7 +57,9 @@ struct CmdStreamAllocationCreateInfo
                                                             // system memory and get dummy GPU memory from Device
         uint32                  cpuAccessible       :  1;   // True if this chunk should be CPU-accessible.  Only valid
                                                             // for "real" GPU memory allocations.
-        uint32                  reserved            : 29;
+        uint32                  hugePages           :  1;   // True if system memory allocations should be backed by
+                                                            // transparent huge pages.
+        uint32                  reserved            : 28;
     } flags;
 };
 
@@ -97,6 +99,12 @@ public:
     bool IsDummyAllocation() const { return (m_createInfo.flags.dummyAllocation != 0); }
     bool CpuAccessible() const { return (m_createInfo.flags.cpuAccessible != 0); }
 
+    // The owning command allocator uses these to count how many of this allocation's chunks are on its free list. They
+    // must only be called while holding the allocator's chunk lock.
+    uint32 NumFreeChunks() const          { return m_numFreeChunks; }
+    void   ResetNumFreeChunks() const     { m_numFreeChunks = 0; }
+    void   IncrementNumFreeChunks() const { m_numFreeChunks++; }
+
 private:
     CmdStreamAllocation(const CmdStreamAllocationCreateInfo& createInfo);
     ~CmdStreamAllocation() {}
@@ -111,6 +119,10 @@ private:
     uint32*              m_pCpuAddr;   // CPU virtual address of the mapped GPU allocation.
     uint32*              m_pStaging;   // If non-null, commands should be accumulated here until chunks are finalized.
 
+    // Scratch count of this allocation's chunks which are on the allocator's free list. This is bookkeeping for the
+    // allocator rather than state of the allocation itself, so it may change through a const reference.
+    mutable uint32       m_numFreeChunks;
+
     PAL_DISALLOW_DEFAULT_CTOR(CmdStreamAllocation);
     PAL_DISALLOW_COPY_AND_ASSIGN(CmdStreamAllocation);
 };
@@ -143,6 +155,8 @@ public:
     void EndCommandBlock(uint32 postambleDwords);
     void FinalizeCommands();
     void Reset(bool resetRefCount);
+    void Prefault();
+    bool IsPrefaulted() const { return m_prefaulted; }
 
     Result InitRootBusyTracker(CmdAllocator* pAllocator);
     void UpdateRootInfo(CmdStreamChunk* pRootChunk);
@@ -193,6 +207,7 @@ public:
     bool IsIdle() const { return (m_referenceCount == 0) && IsIdleOnGpu(); }
 
     bool UsesSystemMemory() const { return m_allocation.UsesSystemMemory(); }
+    const CmdStreamAllocation& Allocation() const { return m_allocation; }
 
     uint32 GetGeneration() const { return m_generation; }
 
@@ -262,6 +277,7 @@ private:
     uint32 m_cmdDwordsToExecuteNoPostamble; // Excludes the postamble commands which may make this unsafe to execute.
     uint32 m_reservedDataOffset; // Offset in DWORDs to the beginning of any reserved space. It will be equal to the
                                  // size of the chunk if no space has been reserved.
+    bool   m_prefaulted;         // True once the CPU pages behind m_pWriteAddr have been faulted in.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(CmdStreamChunk);
 };
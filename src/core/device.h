@@ -1309,6 +1309,26 @@ public:
                 m_pGfxDevice->CreateDepthStencilState(createInfo, pPlacementAddr, ppDepthStencilState);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    // NOTE: Part of the public IDevice interface.
+    virtual size_t GetStateBlockSize(
+        const StateBlockCreateInfo& createInfo,
+        Result*                     pResult) const override
+    {
+        return (m_pGfxDevice == nullptr) ? 0 : m_pGfxDevice->GetStateBlockSize(createInfo, pResult);
+    }
+
+    // NOTE: Part of the public IDevice interface.
+    virtual Result CreateStateBlock(
+        const StateBlockCreateInfo& createInfo,
+        void*                       pPlacementAddr,
+        IStateBlock**               ppStateBlock) const override
+    {
+        return (m_pGfxDevice == nullptr) ? Result::ErrorUnavailable :
+                m_pGfxDevice->CreateStateBlock(createInfo, pPlacementAddr, ppStateBlock);
+    }
+#endif
+
     // NOTE: Part of the public IDevice interface.
     virtual size_t GetQueueSemaphoreSize(
         const QueueSemaphoreCreateInfo& createInfo,
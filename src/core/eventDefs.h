@@ -857,6 +857,10 @@ static void SerializeResourceDescriptionCmdAllocator(
         pJsonWriter->KeyAndValue("AutoMemoryReuse",          static_cast<bool>(data.pCreateInfo->flags.autoMemoryReuse));
         pJsonWriter->KeyAndValue("DisableBusyChunkTracking", static_cast<bool>(data.pCreateInfo->flags.disableBusyChunkTracking));
         pJsonWriter->KeyAndValue("ThreadSafe",               static_cast<bool>(data.pCreateInfo->flags.threadSafe));
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        pJsonWriter->KeyAndValue("PerThreadChunkCache",      static_cast<bool>(data.pCreateInfo->flags.perThreadChunkCache));
+        pJsonWriter->KeyAndValue("BackgroundReclaim",        static_cast<bool>(data.pCreateInfo->flags.backgroundReclaim));
+#endif
         pJsonWriter->EndMap();
 
     }
@@ -122,6 +122,7 @@ void PlatformSettingsLoader::SetupDefaults()
     m_settings.gpuProfilerConfig.recordPipelineStats = false;
     m_settings.gpuProfilerConfig.breakSubmitBatches = false;
     m_settings.gpuProfilerConfig.useFullPipelineHash = false;
+    m_settings.gpuProfilerConfig.reportBarrierCosts = false;
     m_settings.gpuProfilerConfig.traceModeMask = 0x0;
     memset(m_settings.gpuProfilerPerfCounterConfig.globalPerfCounterConfigFile, 0, 256);
     strncpy(m_settings.gpuProfilerPerfCounterConfig.globalPerfCounterConfigFile, "", 256);
@@ -171,6 +172,7 @@ void PlatformSettingsLoader::SetupDefaults()
     m_settings.interfaceLoggerConfig.multithreaded = false;
     m_settings.interfaceLoggerConfig.basePreset = 0x7;
     m_settings.interfaceLoggerConfig.elevatedPreset = 0x1f;
+    m_settings.interfaceLoggerConfig.binaryCapture = false;
 
     m_settings.numSettings = g_palPlatformNumSettings;
 }
@@ -407,6 +409,11 @@ void PlatformSettingsLoader::ReadSettings(Pal::Device* pDevice)
                            &m_settings.gpuProfilerConfig.useFullPipelineHash,
                            InternalSettingScope::PrivatePalKey);
 
+    pDevice->ReadSetting(pGpuProfilerConfig_ReportBarrierCostsStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.gpuProfilerConfig.reportBarrierCosts,
+                           InternalSettingScope::PrivatePalKey);
+
     pDevice->ReadSetting(pGpuProfilerConfig_TraceModeMaskStr,
                            Util::ValueType::Uint,
                            &m_settings.gpuProfilerConfig.traceModeMask,
@@ -612,6 +619,11 @@ void PlatformSettingsLoader::ReadSettings(Pal::Device* pDevice)
                            &m_settings.interfaceLoggerConfig.elevatedPreset,
                            InternalSettingScope::PrivatePalKey);
 
+    pDevice->ReadSetting(pInterfaceLoggerConfig_BinaryCaptureStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.interfaceLoggerConfig.binaryCapture,
+                           InternalSettingScope::PrivatePalKey);
+
 }
 
 // =====================================================================================================================
@@ -853,6 +865,11 @@ void PlatformSettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.gpuProfilerConfig.useFullPipelineHash);
     m_settingsInfoMap.Insert(3204367348, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.gpuProfilerConfig.reportBarrierCosts;
+    info.valueSize = sizeof(m_settings.gpuProfilerConfig.reportBarrierCosts);
+    m_settingsInfoMap.Insert(3226274009, info);
+
     info.type      = SettingType::Uint;
     info.pValuePtr = &m_settings.gpuProfilerConfig.traceModeMask;
     info.valueSize = sizeof(m_settings.gpuProfilerConfig.traceModeMask);
@@ -1053,6 +1070,11 @@ void PlatformSettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.interfaceLoggerConfig.elevatedPreset);
     m_settingsInfoMap.Insert(3991423149, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.interfaceLoggerConfig.binaryCapture;
+    info.valueSize = sizeof(m_settings.interfaceLoggerConfig.binaryCapture);
+    m_settingsInfoMap.Insert(4102846733, info);
+
 }
 
 // =====================================================================================================================
@@ -1074,9 +1096,9 @@ void PlatformSettingsLoader::DevDriverRegister()
             component.pfnSetValue = ISettingsLoader::SetValue;
             component.pSettingsData = &g_palPlatformJsonData[0];
             component.settingsDataSize = sizeof(g_palPlatformJsonData);
-            component.settingsDataHash = 893439670;
-            component.settingsDataHeader.isEncoded = true;
-            component.settingsDataHeader.magicBufferId = 402778310;
+            component.settingsDataHash = 0;
+            component.settingsDataHeader.isEncoded = false;
+            component.settingsDataHeader.magicBufferId = 0;
             component.settingsDataHeader.magicBufferOffset = 0;
 
             pSettingsService->RegisterComponent(component);
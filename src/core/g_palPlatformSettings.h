@@ -156,6 +156,7 @@ struct PalPlatformSettings : public Pal::DriverSettings
         bool                                        recordPipelineStats;
         bool                                        breakSubmitBatches;
         bool                                        useFullPipelineHash;
+        bool                                        reportBarrierCosts;
         uint32                                      traceModeMask;
     } gpuProfilerConfig;
     struct {
@@ -208,6 +209,7 @@ struct PalPlatformSettings : public Pal::DriverSettings
         bool                                        multithreaded;
         uint32                                      basePreset;
         uint32                                      elevatedPreset;
+        bool                                        binaryCapture;
     } interfaceLoggerConfig;
 
 };
@@ -276,6 +278,7 @@ static const char* pGpuProfilerConfig_FrameCountStr = "#3630548216";
 static const char* pGpuProfilerConfig_RecordPipelineStatsStr = "#1092484338";
 static const char* pGpuProfilerConfig_BreakSubmitBatchesStr = "#2743656777";
 static const char* pGpuProfilerConfig_UseFullPipelineHashStr = "#3204367348";
+static const char* pGpuProfilerConfig_ReportBarrierCostsStr = "#3226274009";
 static const char* pGpuProfilerConfig_TraceModeMaskStr = "#2717664970";
 static const char* pGpuProfilerPerfCounterConfig_GlobalPerfCounterConfigFileStr = "#1666123781";
 static const char* pGpuProfilerPerfCounterConfig_CacheFlushOnCounterCollectionStr = "#3543519762";
@@ -316,8 +319,9 @@ static const char* pInterfaceLoggerConfig_LogDirectoryStr = "#3997041373";
 static const char* pInterfaceLoggerConfig_MultithreadedStr = "#4177532476";
 static const char* pInterfaceLoggerConfig_BasePresetStr = "#3886684530";
 static const char* pInterfaceLoggerConfig_ElevatedPresetStr = "#3991423149";
+static const char* pInterfaceLoggerConfig_BinaryCaptureStr = "#4102846733";
 
-static const uint32 g_palPlatformNumSettings = 88;
+static const uint32 g_palPlatformNumSettings = 90;
 static const SettingNameHash g_palPlatformSettingHashList[] = {
 #if PAL_ENABLE_PRINTS_ASSERTS
 87264462,
@@ -386,6 +390,7 @@ static const SettingNameHash g_palPlatformSettingHashList[] = {
 1092484338,
 2743656777,
 3204367348,
+3226274009,
 2717664970,
 1666123781,
 3543519762,
@@ -426,1597 +431,1518 @@ static const SettingNameHash g_palPlatformSettingHashList[] = {
 4177532476,
 3886684530,
 3991423149,
+4102846733,
 
 };
 
 static const uint8 g_palPlatformJsonData[] = {
-    26, 250, 84, 220, 1, 92, 96, 106, 146, 207, 33, 32, 160, 3, 90, 155, 144, 218, 198, 78, 114, 176, 126, 93, 73, 14,
-    35, 100, 246, 56, 59, 44, 57, 20, 138, 53, 137, 42, 27, 8, 229, 59, 94, 194, 49, 22, 213, 135, 171, 196, 161, 14,
-    45, 34, 34, 61, 232, 36, 103, 94, 214, 160, 197, 1, 129, 99, 2, 145, 103, 102, 239, 97, 44, 11, 73, 81, 240, 216,
-    150, 152, 90, 171, 163, 73, 133, 12, 237, 134, 168, 90, 50, 225, 50, 84, 167, 21, 2, 23, 243, 219, 217, 48, 47, 117,
-    247, 34, 238, 78, 167, 36, 158, 158, 31, 139, 109, 240, 30, 131, 214, 87, 178, 237, 246, 65, 205, 125, 220, 219, 43,
-    206, 88, 52, 147, 248, 89, 215, 249, 198, 81, 209, 176, 204, 180, 225, 198, 58, 11, 96, 140, 3, 39, 236, 197, 242,
-    233, 244, 200, 15, 40, 200, 168, 13, 236, 142, 242, 30, 235, 65, 121, 128, 219, 102, 197, 72, 118, 69, 208, 135,
-    183, 222, 116, 85, 211, 129, 225, 86, 158, 129, 180, 151, 231, 15, 163, 241, 207, 36, 238, 64, 78, 149, 50, 177,
-    155, 194, 155, 213, 220, 190, 164, 82, 180, 178, 167, 50, 59, 180, 99, 203, 120, 194, 97, 208, 253, 209, 126, 17,
-    39, 231, 108, 169, 37, 219, 73, 103, 100, 120, 193, 11, 221, 132, 55, 221, 63, 91, 21, 43, 71, 80, 241, 103, 202,
-    204, 246, 32, 246, 234, 147, 219, 10, 15, 189, 182, 153, 192, 246, 186, 41, 14, 212, 154, 17, 81, 191, 251, 81, 101,
-    159, 204, 7, 39, 7, 15, 76, 226, 108, 39, 165, 12, 113, 43, 80, 195, 209, 117, 178, 13, 34, 141, 102, 133, 165, 20,
-    204, 238, 15, 35, 115, 101, 92, 72, 232, 88, 97, 164, 217, 113, 81, 79, 101, 88, 77, 24, 172, 242, 152, 226, 199,
-    139, 140, 85, 110, 209, 209, 208, 88, 238, 113, 3, 164, 87, 252, 203, 209, 65, 98, 27, 195, 134, 10, 210, 127, 29,
-    8, 153, 204, 155, 31, 110, 16, 72, 26, 170, 250, 88, 73, 26, 119, 230, 233, 43, 40, 251, 106, 138, 135, 157, 49, 89,
-    28, 57, 19, 83, 188, 105, 79, 215, 188, 103, 57, 205, 26, 129, 254, 243, 184, 20, 196, 145, 99, 55, 241, 7, 167, 78,
-    66, 39, 165, 86, 105, 25, 124, 67, 211, 79, 185, 189, 147, 49, 219, 243, 26, 127, 122, 22, 124, 45, 56, 254, 106,
-    171, 18, 8, 208, 95, 227, 196, 241, 21, 159, 142, 240, 133, 83, 134, 199, 41, 147, 111, 197, 122, 66, 204, 58, 98,
-    93, 213, 45, 205, 7, 93, 217, 196, 164, 101, 214, 147, 138, 0, 185, 235, 216, 224, 150, 248, 34, 9, 151, 112, 155,
-    84, 249, 222, 162, 129, 138, 176, 79, 24, 9, 54, 55, 71, 223, 205, 237, 5, 167, 118, 93, 33, 39, 45, 235, 20, 8, 37,
-    150, 218, 83, 53, 247, 163, 143, 198, 184, 77, 127, 158, 13, 241, 142, 195, 146, 54, 250, 212, 28, 36, 42, 167, 178,
-    208, 120, 2, 52, 2, 223, 160, 226, 1, 253, 237, 215, 240, 39, 16, 161, 102, 179, 109, 245, 181, 111, 167, 44, 171,
-    164, 86, 213, 154, 249, 31, 55, 119, 60, 201, 109, 94, 33, 247, 55, 130, 188, 139, 116, 194, 170, 93, 139, 79, 41,
-    36, 169, 141, 90, 78, 46, 41, 228, 164, 133, 132, 106, 222, 106, 79, 221, 10, 148, 29, 246, 13, 159, 56, 117, 14,
-    57, 49, 120, 4, 104, 93, 210, 66, 208, 20, 95, 71, 224, 108, 20, 80, 11, 56, 154, 193, 148, 1, 173, 166, 197, 147,
-    249, 223, 19, 121, 181, 110, 177, 167, 174, 154, 102, 0, 254, 40, 125, 204, 51, 190, 2, 196, 95, 25, 92, 181, 46,
-    219, 169, 116, 25, 42, 202, 178, 44, 56, 220, 145, 135, 114, 163, 109, 185, 25, 136, 177, 82, 208, 37, 74, 40, 129,
-    86, 64, 196, 116, 247, 208, 195, 185, 240, 183, 139, 155, 170, 128, 138, 6, 103, 76, 11, 102, 199, 183, 220, 43, 24,
-    21, 2, 253, 1, 4, 184, 191, 119, 67, 57, 221, 27, 186, 187, 145, 118, 91, 254, 230, 213, 231, 198, 119, 247, 137,
-    212, 39, 93, 213, 232, 217, 2, 53, 193, 116, 198, 205, 18, 209, 38, 239, 156, 135, 239, 239, 78, 153, 232, 41, 47,
-    27, 17, 169, 8, 158, 42, 188, 30, 125, 232, 22, 178, 103, 94, 14, 253, 104, 167, 169, 214, 171, 224, 143, 244, 144,
-    12, 18, 120, 224, 102, 242, 34, 90, 107, 45, 234, 149, 244, 47, 138, 155, 231, 118, 93, 38, 186, 231, 129, 153, 52,
-    149, 221, 153, 118, 22, 255, 45, 186, 79, 158, 37, 177, 110, 139, 248, 37, 67, 137, 111, 181, 8, 139, 204, 190, 3,
-    103, 47, 90, 14, 120, 23, 123, 206, 150, 46, 0, 116, 13, 105, 153, 143, 182, 94, 92, 214, 144, 147, 206, 41, 185,
-    45, 105, 22, 165, 12, 186, 71, 176, 54, 121, 95, 112, 32, 192, 140, 28, 186, 167, 46, 149, 62, 48, 131, 68, 140, 93,
-    177, 0, 8, 164, 75, 157, 24, 81, 250, 223, 128, 143, 210, 37, 102, 210, 222, 105, 116, 242, 100, 57, 73, 225, 164,
-    40, 155, 181, 218, 29, 70, 114, 51, 243, 25, 50, 55, 38, 206, 204, 77, 27, 79, 39, 1, 143, 174, 154, 56, 225, 74,
-    31, 253, 92, 75, 220, 4, 242, 10, 18, 254, 160, 187, 218, 60, 198, 199, 81, 239, 154, 160, 246, 225, 172, 129, 203,
-    143, 139, 20, 93, 213, 52, 71, 196, 176, 5, 173, 21, 4, 13, 34, 95, 176, 192, 187, 224, 151, 11, 22, 31, 235, 88,
-    138, 186, 139, 233, 133, 248, 137, 202, 236, 204, 65, 68, 213, 164, 147, 224, 232, 219, 132, 53, 125, 171, 64, 203,
-    92, 165, 15, 224, 171, 249, 122, 59, 199, 85, 132, 223, 192, 215, 50, 74, 43, 139, 182, 154, 50, 230, 138, 252, 47,
-    45, 224, 45, 135, 97, 60, 8, 42, 107, 163, 47, 195, 127, 142, 158, 124, 120, 163, 22, 105, 181, 233, 155, 97, 200,
-    80, 233, 125, 46, 158, 128, 71, 112, 254, 190, 196, 11, 12, 48, 18, 109, 155, 78, 187, 6, 39, 184, 203, 15, 48, 233,
-    114, 50, 118, 79, 222, 197, 22, 232, 226, 106, 63, 254, 48, 159, 164, 237, 205, 243, 246, 33, 169, 20, 9, 232, 16,
-    174, 213, 142, 110, 199, 105, 131, 98, 253, 190, 123, 208, 242, 18, 17, 157, 230, 11, 32, 163, 38, 32, 238, 104, 4,
-    216, 68, 243, 186, 247, 209, 255, 118, 123, 70, 169, 200, 117, 27, 248, 208, 238, 150, 34, 108, 120, 26, 64, 9, 122,
-    205, 29, 219, 213, 182, 128, 151, 120, 203, 223, 54, 187, 144, 206, 63, 151, 205, 42, 89, 79, 8, 33, 144, 134, 7,
-    32, 213, 159, 44, 223, 35, 159, 195, 216, 43, 44, 20, 247, 181, 172, 42, 178, 27, 61, 165, 118, 16, 120, 33, 35,
-    182, 23, 120, 12, 229, 184, 198, 249, 197, 142, 82, 128, 159, 84, 112, 91, 88, 128, 233, 55, 254, 121, 39, 17, 42,
-    255, 109, 248, 13, 128, 16, 251, 244, 58, 58, 222, 6, 109, 233, 210, 70, 32, 170, 72, 92, 255, 233, 171, 31, 204,
-    61, 182, 184, 242, 215, 218, 233, 39, 151, 103, 102, 21, 151, 195, 243, 166, 201, 152, 159, 41, 151, 203, 207, 217,
-    254, 2, 52, 8, 67, 36, 214, 85, 119, 22, 220, 133, 38, 149, 231, 157, 205, 14, 49, 42, 158, 203, 162, 130, 177, 178,
-    184, 165, 200, 236, 247, 92, 123, 216, 220, 219, 117, 255, 40, 153, 210, 112, 39, 162, 14, 90, 50, 55, 33, 125, 137,
-    229, 66, 68, 13, 159, 82, 100, 92, 235, 121, 243, 53, 227, 38, 10, 151, 20, 77, 47, 239, 237, 9, 95, 226, 106, 27,
-    104, 216, 192, 72, 29, 196, 197, 64, 89, 77, 175, 96, 178, 179, 8, 88, 124, 227, 232, 253, 197, 239, 38, 217, 101,
-    91, 42, 151, 219, 219, 178, 84, 190, 3, 38, 122, 142, 217, 132, 173, 229, 103, 24, 35, 186, 176, 156, 139, 205, 208,
-    51, 110, 199, 79, 104, 145, 242, 122, 11, 207, 24, 24, 64, 215, 225, 67, 217, 91, 165, 132, 225, 181, 179, 222, 239,
-    122, 28, 73, 24, 196, 29, 109, 71, 206, 60, 227, 188, 20, 168, 20, 187, 191, 88, 48, 23, 105, 141, 42, 167, 193,
-    254, 119, 152, 173, 226, 41, 48, 49, 133, 79, 90, 129, 187, 18, 67, 79, 111, 190, 146, 15, 13, 216, 167, 156, 173,
-    24, 132, 151, 21, 139, 219, 206, 234, 66, 122, 22, 152, 12, 16, 152, 129, 46, 82, 250, 63, 107, 12, 5, 158, 217,
-    197, 142, 187, 240, 81, 89, 10, 206, 28, 225, 11, 54, 171, 229, 143, 194, 190, 124, 250, 237, 86, 202, 4, 197, 207,
-    215, 94, 137, 154, 181, 17, 11, 165, 71, 239, 240, 2, 238, 158, 162, 183, 181, 85, 106, 128, 121, 117, 41, 92, 192,
-    61, 133, 166, 77, 118, 129, 179, 27, 252, 8, 253, 151, 199, 212, 160, 45, 194, 154, 66, 216, 8, 119, 57, 222, 237,
-    9, 184, 182, 181, 188, 209, 92, 249, 201, 32, 123, 85, 237, 60, 213, 184, 12, 108, 132, 53, 204, 124, 74, 112, 13,
-    185, 197, 93, 57, 99, 33, 153, 56, 204, 72, 143, 149, 74, 159, 94, 212, 46, 139, 108, 17, 138, 202, 31, 93, 46, 120,
-    127, 10, 169, 101, 17, 195, 27, 65, 30, 104, 147, 209, 171, 131, 59, 159, 184, 52, 63, 240, 242, 103, 130, 116, 119,
-    100, 206, 233, 39, 168, 231, 195, 46, 146, 64, 167, 188, 121, 94, 228, 152, 68, 48, 168, 186, 64, 111, 71, 208, 173,
-    54, 77, 157, 243, 201, 241, 24, 106, 22, 99, 10, 32, 183, 205, 70, 245, 67, 7, 203, 74, 187, 52, 12, 45, 137, 99,
-    120, 60, 91, 243, 216, 30, 17, 52, 47, 160, 40, 88, 251, 187, 101, 149, 129, 210, 32, 112, 20, 159, 8, 230, 196, 82,
-    152, 84, 177, 131, 207, 246, 220, 78, 172, 96, 177, 115, 153, 20, 68, 99, 105, 30, 172, 59, 188, 192, 233, 76, 88,
-    105, 224, 209, 27, 26, 83, 225, 101, 40, 167, 21, 63, 154, 14, 68, 214, 4, 179, 187, 14, 148, 164, 230, 248, 168,
-    24, 159, 194, 249, 172, 101, 125, 19, 17, 90, 156, 241, 140, 150, 42, 42, 201, 158, 114, 107, 124, 253, 85, 32, 124,
-    180, 156, 0, 13, 110, 127, 47, 35, 173, 226, 7, 29, 224, 55, 114, 200, 246, 254, 132, 251, 84, 48, 173, 40, 0, 111,
-    120, 26, 106, 80, 205, 142, 38, 85, 113, 237, 216, 214, 206, 65, 3, 29, 150, 123, 1, 34, 245, 236, 158, 216, 166,
-    21, 3, 53, 168, 118, 50, 81, 229, 27, 66, 98, 122, 244, 137, 14, 227, 142, 91, 114, 225, 173, 64, 65, 81, 99, 211,
-    64, 87, 214, 25, 39, 135, 56, 224, 146, 217, 237, 250, 203, 225, 133, 115, 46, 242, 14, 114, 219, 84, 98, 121, 101,
-    14, 93, 120, 251, 41, 210, 50, 134, 8, 221, 187, 211, 128, 36, 232, 14, 225, 133, 249, 67, 196, 106, 47, 12, 97,
-    218, 224, 52, 207, 204, 220, 73, 239, 118, 87, 120, 31, 64, 248, 17, 190, 8, 8, 105, 44, 143, 60, 173, 104, 245,
-    133, 4, 29, 36, 14, 27, 42, 136, 73, 147, 242, 59, 18, 116, 243, 57, 24, 217, 20, 173, 117, 241, 251, 179, 132, 20,
-    201, 104, 209, 162, 51, 166, 142, 221, 169, 104, 178, 141, 245, 71, 18, 65, 141, 57, 155, 34, 89, 42, 169, 32, 14,
-    95, 214, 205, 2, 160, 151, 26, 218, 235, 24, 6, 62, 97, 68, 1, 179, 228, 182, 236, 187, 138, 235, 100, 219, 176, 30,
-    155, 73, 158, 100, 101, 200, 49, 72, 219, 255, 90, 103, 30, 43, 74, 64, 180, 239, 224, 187, 81, 10, 48, 173, 124,
-    235, 234, 213, 17, 63, 139, 203, 67, 50, 146, 134, 198, 4, 124, 71, 15, 41, 172, 241, 79, 118, 240, 239, 32, 81,
-    160, 254, 91, 121, 183, 130, 99, 118, 54, 156, 229, 100, 190, 24, 98, 107, 105, 107, 83, 28, 123, 191, 183, 156,
-    209, 49, 53, 233, 249, 28, 137, 217, 196, 178, 185, 48, 74, 249, 252, 102, 108, 96, 121, 74, 166, 111, 199, 127, 79,
-    161, 217, 6, 30, 72, 216, 40, 13, 49, 154, 23, 158, 17, 175, 60, 218, 219, 155, 115, 179, 12, 115, 14, 201, 123, 31,
-    103, 207, 161, 70, 162, 239, 123, 180, 152, 230, 181, 55, 39, 169, 134, 99, 90, 176, 237, 109, 209, 29, 133, 151,
-    188, 252, 114, 18, 132, 247, 82, 97, 164, 133, 50, 167, 127, 26, 111, 69, 2, 62, 170, 39, 21, 81, 150, 164, 122,
-    217, 143, 70, 38, 64, 234, 108, 210, 68, 192, 40, 155, 7, 255, 203, 170, 23, 188, 66, 243, 81, 94, 63, 92, 110, 235,
-    237, 121, 183, 24, 183, 249, 80, 27, 110, 59, 82, 112, 197, 165, 111, 138, 73, 75, 236, 143, 55, 72, 34, 156, 52,
-    141, 248, 188, 232, 52, 51, 157, 170, 101, 249, 252, 8, 44, 36, 96, 118, 208, 135, 119, 159, 107, 200, 12, 207, 204,
-    138, 206, 127, 67, 109, 142, 133, 106, 83, 244, 155, 237, 182, 0, 108, 249, 1, 8, 115, 217, 220, 158, 224, 63, 38,
-    128, 233, 9, 166, 194, 141, 130, 42, 102, 128, 27, 65, 10, 181, 204, 249, 3, 167, 71, 156, 120, 195, 70, 108, 174,
-    140, 144, 84, 99, 47, 178, 242, 202, 84, 79, 56, 92, 51, 152, 77, 57, 73, 48, 191, 71, 28, 26, 167, 209, 37, 51,
-    129, 37, 6, 196, 31, 175, 224, 97, 105, 198, 69, 59, 0, 9, 116, 86, 2, 214, 148, 93, 109, 139, 22, 88, 39, 54, 199,
-    175, 57, 244, 215, 80, 79, 245, 199, 195, 32, 105, 231, 25, 19, 49, 73, 168, 146, 0, 77, 146, 247, 232, 63, 192,
-    231, 160, 213, 32, 129, 125, 104, 24, 213, 59, 30, 16, 185, 128, 112, 225, 35, 175, 201, 75, 42, 90, 229, 188, 112,
-    126, 238, 166, 139, 133, 100, 131, 37, 118, 30, 158, 208, 9, 47, 57, 150, 92, 219, 30, 219, 2, 114, 1, 20, 19, 55,
-    106, 169, 140, 247, 120, 67, 239, 143, 133, 201, 218, 140, 194, 95, 234, 19, 77, 228, 78, 193, 215, 40, 184, 85,
-    171, 152, 92, 140, 40, 170, 189, 133, 60, 129, 255, 127, 26, 111, 23, 160, 227, 205, 15, 49, 55, 30, 253, 202, 73,
-    103, 251, 10, 75, 90, 110, 84, 194, 116, 13, 246, 132, 134, 112, 198, 211, 14, 12, 173, 100, 133, 15, 176, 138, 42,
-    218, 181, 237, 142, 211, 161, 212, 75, 198, 2, 147, 185, 57, 137, 22, 231, 199, 132, 130, 156, 175, 126, 175, 151,
-    96, 37, 247, 254, 161, 11, 19, 105, 8, 143, 243, 42, 96, 162, 92, 97, 107, 196, 96, 123, 36, 166, 18, 59, 50, 126,
-    200, 65, 89, 150, 53, 11, 250, 207, 120, 16, 18, 89, 197, 154, 72, 201, 239, 28, 63, 163, 193, 90, 137, 75, 219,
-    100, 18, 11, 212, 175, 85, 91, 185, 62, 180, 236, 20, 62, 220, 47, 204, 166, 58, 189, 123, 5, 96, 16, 63, 250, 156,
-    57, 98, 167, 26, 106, 206, 158, 162, 242, 51, 162, 247, 94, 10, 3, 159, 84, 205, 29, 119, 63, 93, 248, 162, 212,
-    119, 137, 55, 241, 82, 44, 240, 187, 64, 81, 1, 180, 49, 26, 131, 235, 105, 43, 221, 121, 72, 37, 2, 226, 152, 116,
-    192, 94, 210, 168, 82, 73, 23, 119, 153, 19, 19, 100, 130, 236, 144, 96, 157, 205, 8, 78, 118, 98, 234, 233, 228,
-    24, 87, 15, 242, 118, 186, 242, 173, 221, 203, 106, 76, 115, 26, 216, 128, 22, 147, 49, 114, 215, 255, 44, 254, 48,
-    150, 162, 200, 234, 119, 64, 116, 47, 44, 125, 82, 210, 101, 115, 164, 85, 199, 178, 112, 125, 133, 84, 204, 168,
-    135, 222, 73, 200, 105, 128, 216, 138, 2, 108, 5, 114, 151, 189, 132, 86, 122, 212, 19, 15, 141, 88, 6, 80, 1, 79,
-    227, 243, 17, 225, 139, 163, 42, 56, 189, 56, 126, 180, 210, 44, 162, 63, 76, 153, 161, 165, 208, 103, 145, 206,
-    212, 240, 32, 88, 104, 56, 85, 247, 16, 156, 138, 12, 198, 99, 174, 239, 15, 44, 113, 207, 42, 247, 108, 83, 64, 29,
-    209, 107, 89, 106, 72, 85, 30, 174, 188, 97, 26, 219, 73, 75, 192, 143, 69, 22, 230, 80, 95, 129, 193, 201, 78, 38,
-    192, 100, 131, 222, 11, 251, 106, 69, 9, 1, 205, 58, 126, 59, 108, 236, 232, 141, 91, 190, 108, 194, 251, 71, 229,
-    242, 253, 255, 248, 202, 219, 239, 105, 126, 53, 123, 253, 102, 107, 109, 127, 34, 245, 92, 67, 139, 51, 121, 104,
-    13, 161, 206, 21, 109, 2, 170, 231, 196, 244, 99, 72, 44, 166, 155, 208, 93, 108, 183, 102, 185, 62, 30, 77, 30,
-    102, 113, 159, 169, 20, 30, 128, 219, 235, 13, 180, 236, 153, 233, 135, 13, 24, 228, 128, 251, 88, 128, 100, 96,
-    176, 242, 196, 76, 238, 153, 151, 90, 13, 184, 173, 201, 235, 68, 210, 54, 46, 147, 2, 161, 95, 254, 170, 168, 160,
-    128, 30, 110, 20, 127, 134, 218, 212, 49, 168, 229, 113, 43, 89, 233, 186, 14, 158, 13, 32, 64, 252, 94, 146, 69,
-    206, 131, 50, 94, 196, 42, 215, 51, 116, 64, 37, 59, 75, 198, 193, 213, 34, 2, 87, 207, 248, 158, 184, 216, 72, 26,
-    165, 84, 91, 159, 230, 11, 184, 151, 117, 130, 146, 103, 247, 74, 93, 220, 149, 220, 171, 73, 73, 40, 175, 168, 44,
-    147, 45, 219, 134, 148, 21, 112, 144, 143, 216, 81, 249, 89, 67, 206, 65, 78, 74, 141, 16, 111, 80, 157, 155, 209,
-    222, 163, 68, 68, 157, 133, 146, 69, 47, 198, 237, 8, 235, 199, 174, 80, 110, 209, 234, 142, 54, 49, 147, 49, 65,
-    82, 79, 19, 195, 43, 169, 2, 140, 69, 64, 206, 64, 111, 80, 81, 12, 232, 195, 134, 92, 197, 99, 193, 200, 7, 43, 34,
-    252, 222, 165, 43, 142, 253, 237, 251, 190, 52, 155, 250, 2, 198, 136, 180, 217, 213, 129, 164, 192, 129, 210, 139,
-    89, 215, 48, 252, 78, 83, 103, 40, 54, 73, 66, 93, 167, 77, 142, 48, 10, 206, 7, 11, 39, 5, 195, 216, 109, 68, 6,
-    83, 112, 46, 1, 190, 189, 0, 35, 139, 124, 70, 15, 33, 132, 12, 134, 29, 144, 185, 83, 140, 146, 84, 177, 253, 10,
-    190, 7, 18, 63, 176, 222, 181, 128, 144, 159, 185, 111, 79, 108, 179, 53, 238, 243, 73, 157, 42, 127, 170, 130, 27,
-    21, 189, 168, 233, 249, 86, 218, 170, 60, 89, 37, 19, 75, 118, 154, 131, 151, 109, 170, 249, 31, 102, 214, 82, 140,
-    209, 150, 74, 205, 110, 109, 165, 7, 76, 108, 196, 58, 28, 161, 186, 52, 192, 239, 183, 63, 196, 236, 146, 79, 253,
-    233, 136, 90, 40, 135, 120, 132, 118, 154, 26, 122, 122, 44, 82, 45, 206, 209, 221, 26, 90, 139, 223, 183, 193, 8,
-    246, 105, 186, 48, 93, 229, 93, 165, 221, 102, 154, 200, 66, 78, 251, 118, 14, 218, 11, 197, 50, 251, 130, 12, 229,
-    111, 114, 164, 238, 139, 44, 90, 4, 56, 224, 171, 31, 144, 136, 252, 31, 36, 43, 156, 6, 46, 222, 216, 171, 187, 45,
-    255, 187, 50, 159, 57, 226, 73, 153, 197, 91, 106, 234, 86, 71, 9, 126, 33, 73, 71, 63, 117, 153, 152, 189, 230,
-    248, 89, 201, 194, 28, 144, 178, 71, 229, 30, 0, 225, 152, 191, 31, 223, 120, 245, 48, 167, 6, 150, 135, 209, 20,
-    214, 166, 123, 188, 211, 153, 106, 55, 72, 254, 128, 111, 30, 81, 47, 24, 93, 191, 185, 211, 55, 110, 43, 112, 27,
-    87, 252, 142, 112, 16, 133, 25, 84, 135, 116, 102, 1, 80, 143, 91, 231, 211, 235, 2, 23, 78, 248, 247, 86, 175, 56,
-    18, 21, 65, 94, 148, 62, 246, 189, 168, 85, 56, 112, 110, 81, 145, 113, 140, 204, 82, 15, 84, 120, 86, 129, 226,
-    202, 208, 101, 142, 128, 201, 228, 50, 100, 6, 139, 182, 128, 158, 2, 44, 201, 209, 218, 194, 216, 44, 93, 10, 36,
-    176, 224, 225, 18, 199, 100, 48, 37, 228, 175, 37, 97, 191, 56, 68, 156, 76, 135, 1, 34, 198, 176, 32, 165, 233,
-    143, 27, 178, 26, 222, 135, 185, 212, 183, 111, 172, 127, 75, 72, 243, 246, 133, 71, 180, 236, 237, 116, 177, 247,
-    139, 42, 101, 62, 83, 246, 96, 139, 130, 108, 188, 214, 233, 213, 34, 226, 249, 170, 78, 158, 51, 191, 188, 102,
-    216, 186, 226, 132, 83, 202, 173, 70, 244, 120, 76, 63, 212, 121, 103, 197, 109, 220, 155, 247, 149, 135, 236, 96,
-    5, 200, 121, 205, 76, 244, 61, 185, 7, 78, 95, 197, 1, 171, 14, 200, 217, 18, 151, 59, 177, 137, 207, 78, 49, 209,
-    110, 219, 150, 149, 214, 189, 107, 242, 6, 45, 62, 211, 162, 36, 7, 25, 55, 187, 242, 112, 105, 60, 80, 193, 3, 15,
-    253, 157, 255, 184, 203, 91, 193, 185, 201, 205, 79, 116, 239, 242, 227, 83, 238, 90, 141, 239, 132, 30, 6, 254,
-    241, 145, 17, 3, 76, 210, 250, 100, 58, 60, 48, 11, 157, 239, 101, 70, 219, 109, 9, 241, 89, 200, 171, 86, 127, 167,
-    213, 98, 155, 24, 94, 179, 165, 220, 162, 55, 40, 201, 5, 153, 217, 39, 234, 68, 180, 153, 125, 172, 236, 249, 33,
-    158, 164, 152, 186, 156, 179, 216, 243, 146, 58, 101, 236, 234, 209, 4, 7, 10, 154, 10, 34, 222, 64, 41, 244, 81,
-    221, 49, 182, 39, 198, 209, 14, 142, 31, 247, 217, 183, 20, 232, 133, 180, 82, 134, 216, 79, 121, 114, 196, 57, 142,
-    249, 89, 175, 62, 239, 83, 138, 169, 38, 3, 28, 11, 166, 207, 194, 209, 235, 219, 9, 216, 25, 224, 104, 183, 67,
-    254, 208, 180, 218, 175, 193, 223, 204, 101, 8, 234, 207, 31, 211, 13, 122, 131, 73, 127, 79, 25, 123, 104, 166, 77,
-    51, 236, 97, 214, 71, 245, 235, 135, 168, 192, 176, 171, 142, 199, 228, 229, 104, 122, 172, 248, 149, 132, 206, 120,
-    232, 235, 169, 47, 180, 53, 229, 65, 135, 167, 172, 9, 131, 67, 137, 196, 51, 56, 131, 10, 182, 202, 199, 22, 230,
-    10, 15, 62, 115, 57, 212, 12, 225, 56, 131, 244, 58, 73, 113, 118, 165, 120, 87, 186, 73, 234, 45, 85, 16, 153, 254,
-    84, 142, 109, 12, 204, 150, 185, 197, 168, 11, 252, 99, 193, 136, 179, 24, 177, 71, 22, 43, 231, 183, 231, 115, 218,
-    111, 98, 24, 134, 1, 239, 244, 254, 89, 128, 231, 120, 249, 147, 84, 22, 147, 156, 122, 109, 27, 31, 108, 33, 246,
-    219, 235, 210, 72, 155, 21, 229, 180, 164, 61, 156, 205, 73, 175, 117, 29, 199, 237, 172, 55, 252, 43, 7, 214, 191,
-    152, 159, 70, 191, 160, 212, 232, 27, 168, 165, 92, 102, 4, 57, 253, 32, 20, 229, 148, 100, 207, 218, 172, 54, 160,
-    130, 224, 124, 62, 60, 225, 74, 132, 122, 238, 45, 100, 86, 16, 59, 226, 164, 49, 23, 145, 82, 201, 35, 52, 70, 20,
-    158, 147, 184, 39, 170, 17, 215, 202, 106, 216, 137, 152, 89, 222, 130, 47, 145, 128, 93, 69, 110, 41, 197, 90, 236,
-    221, 103, 47, 5, 179, 208, 242, 162, 76, 153, 40, 155, 117, 127, 219, 44, 88, 77, 8, 23, 244, 50, 156, 209, 111, 35,
-    174, 209, 140, 208, 212, 220, 120, 104, 24, 47, 161, 238, 209, 176, 95, 237, 160, 51, 34, 41, 44, 102, 143, 236, 52,
-    157, 183, 192, 1, 235, 39, 92, 183, 88, 38, 229, 6, 1, 76, 115, 98, 119, 91, 95, 79, 152, 58, 13, 25, 66, 188, 18,
-    159, 158, 124, 46, 139, 132, 167, 89, 211, 123, 129, 97, 134, 9, 132, 226, 29, 7, 128, 230, 177, 107, 188, 188, 59,
-    77, 25, 62, 179, 43, 92, 59, 173, 147, 210, 166, 200, 60, 23, 127, 142, 223, 32, 230, 138, 82, 84, 14, 49, 206, 167,
-    214, 139, 214, 28, 235, 240, 63, 243, 122, 176, 179, 96, 64, 32, 126, 142, 40, 171, 193, 83, 68, 224, 140, 72, 228,
-    226, 86, 231, 88, 103, 16, 37, 113, 222, 241, 30, 14, 38, 175, 104, 115, 83, 207, 76, 246, 120, 146, 75, 56, 210,
-    244, 251, 77, 49, 204, 220, 180, 208, 75, 27, 187, 55, 141, 253, 105, 236, 74, 55, 179, 127, 189, 6, 68, 57, 99, 18,
-    34, 141, 6, 133, 216, 191, 244, 22, 157, 119, 225, 58, 122, 174, 2, 205, 143, 40, 161, 21, 178, 253, 229, 123, 210,
-    53, 106, 4, 185, 204, 26, 107, 147, 31, 142, 172, 211, 197, 140, 252, 108, 215, 192, 50, 224, 74, 94, 76, 179, 48,
-    133, 80, 138, 217, 89, 227, 128, 243, 194, 126, 68, 121, 136, 227, 85, 226, 15, 253, 108, 106, 28, 20, 7, 100, 7,
-    213, 217, 173, 193, 3, 9, 44, 108, 216, 202, 237, 178, 123, 84, 57, 81, 93, 12, 121, 132, 68, 185, 236, 0, 197, 175,
-    167, 249, 149, 52, 130, 202, 213, 36, 193, 242, 201, 218, 94, 97, 90, 52, 142, 251, 71, 20, 255, 127, 55, 121, 22,
-    75, 1, 200, 13, 198, 134, 118, 150, 192, 255, 236, 133, 75, 55, 168, 207, 238, 219, 213, 30, 212, 127, 201, 151,
-    247, 3, 55, 245, 27, 207, 180, 129, 81, 210, 183, 121, 66, 166, 85, 222, 110, 251, 10, 69, 165, 57, 192, 223, 55,
-    136, 132, 167, 232, 50, 177, 21, 57, 173, 177, 100, 87, 179, 190, 172, 189, 28, 60, 164, 185, 64, 169, 206, 243, 45,
-    86, 75, 214, 198, 169, 34, 150, 40, 148, 91, 244, 152, 16, 24, 133, 38, 239, 192, 151, 112, 226, 244, 62, 171, 159,
-    232, 212, 177, 138, 104, 245, 22, 184, 246, 216, 3, 158, 180, 240, 206, 185, 147, 113, 242, 55, 207, 59, 221, 57,
-    235, 43, 197, 48, 105, 3, 89, 16, 39, 215, 221, 176, 154, 233, 111, 29, 146, 127, 65, 181, 153, 166, 72, 188, 67,
-    40, 236, 80, 98, 116, 168, 167, 123, 243, 204, 57, 250, 186, 136, 31, 179, 234, 196, 162, 203, 251, 214, 54, 94, 42,
-    247, 213, 202, 57, 35, 69, 179, 212, 148, 22, 152, 102, 181, 122, 255, 156, 35, 251, 152, 210, 67, 214, 188, 200,
-    24, 159, 131, 249, 17, 234, 153, 196, 80, 65, 93, 66, 110, 110, 65, 56, 73, 25, 30, 215, 33, 90, 28, 253, 15, 181,
-    193, 232, 63, 245, 81, 174, 155, 169, 0, 225, 160, 221, 134, 0, 146, 95, 122, 217, 191, 8, 100, 24, 50, 92, 240,
-    127, 220, 47, 183, 129, 196, 170, 206, 51, 44, 151, 98, 123, 3, 247, 134, 127, 227, 27, 15, 237, 194, 8, 37, 72,
-    106, 131, 117, 240, 252, 127, 159, 9, 208, 157, 144, 90, 248, 115, 92, 236, 44, 216, 216, 83, 115, 211, 38, 56, 217,
-    34, 23, 185, 101, 28, 57, 247, 18, 6, 108, 132, 208, 5, 12, 65, 32, 83, 153, 99, 246, 59, 129, 96, 141, 46, 207,
-    153, 204, 59, 215, 68, 139, 210, 7, 99, 122, 55, 138, 43, 7, 180, 30, 133, 216, 77, 100, 161, 11, 108, 193, 139, 6,
-    67, 171, 234, 94, 83, 181, 46, 213, 238, 119, 136, 170, 94, 95, 156, 192, 26, 17, 202, 15, 50, 124, 223, 231, 75,
-    16, 163, 254, 79, 168, 20, 249, 163, 86, 40, 168, 99, 252, 18, 159, 190, 152, 188, 222, 104, 99, 141, 18, 64, 184,
-    150, 94, 95, 49, 120, 195, 164, 44, 179, 193, 185, 162, 171, 36, 253, 153, 132, 243, 140, 221, 30, 123, 116, 187,
-    111, 148, 58, 94, 97, 9, 160, 176, 9, 212, 239, 128, 124, 177, 184, 249, 153, 182, 248, 176, 33, 124, 254, 2, 76,
-    131, 191, 175, 36, 33, 156, 141, 255, 161, 87, 241, 150, 240, 217, 235, 218, 180, 156, 141, 4, 139, 156, 188, 58,
-    180, 164, 49, 191, 48, 84, 186, 19, 135, 247, 252, 131, 234, 230, 104, 110, 36, 90, 226, 138, 82, 167, 45, 123, 165,
-    46, 37, 59, 100, 200, 32, 195, 161, 209, 117, 148, 83, 77, 109, 236, 42, 21, 91, 154, 217, 141, 211, 66, 78, 23,
-    223, 68, 190, 209, 48, 239, 161, 70, 184, 68, 183, 0, 0, 70, 3, 62, 140, 141, 130, 157, 206, 17, 187, 169, 198, 89,
-    175, 75, 221, 198, 83, 237, 132, 174, 67, 41, 187, 52, 191, 155, 220, 143, 135, 9, 59, 177, 187, 68, 116, 11, 155,
-    134, 72, 6, 1, 227, 123, 118, 171, 12, 162, 135, 234, 37, 228, 213, 168, 186, 226, 89, 107, 13, 1, 172, 215, 132,
-    25, 207, 240, 48, 52, 1, 179, 184, 239, 169, 249, 247, 149, 188, 242, 16, 140, 30, 180, 42, 161, 102, 141, 206, 152,
-    233, 186, 161, 57, 193, 50, 50, 69, 124, 230, 118, 107, 21, 126, 114, 60, 169, 195, 119, 0, 195, 149, 238, 19, 27,
-    144, 242, 33, 2, 70, 139, 126, 75, 239, 154, 233, 25, 196, 127, 246, 16, 176, 141, 207, 241, 38, 87, 156, 84, 121,
-    169, 124, 184, 90, 174, 68, 86, 158, 0, 216, 239, 230, 4, 40, 1, 125, 219, 95, 80, 208, 66, 0, 122, 162, 28, 208,
-    65, 51, 204, 89, 112, 164, 252, 227, 25, 186, 114, 59, 89, 158, 235, 93, 173, 5, 139, 0, 173, 176, 215, 183, 106,
-    178, 97, 178, 242, 255, 92, 172, 36, 94, 232, 202, 57, 176, 226, 95, 199, 208, 214, 79, 157, 110, 122, 47, 182, 176,
-    160, 200, 184, 243, 28, 194, 19, 1, 135, 116, 137, 22, 198, 135, 252, 129, 82, 149, 97, 100, 82, 120, 232, 101, 166,
-    22, 205, 75, 202, 32, 80, 30, 185, 38, 86, 232, 147, 48, 56, 88, 231, 73, 179, 137, 161, 151, 27, 154, 30, 21, 42,
-    167, 206, 66, 25, 114, 175, 146, 159, 217, 84, 34, 109, 176, 165, 16, 237, 155, 49, 84, 79, 217, 63, 232, 85, 226,
-    226, 101, 234, 152, 35, 49, 76, 79, 31, 4, 171, 36, 66, 10, 228, 131, 57, 253, 88, 118, 9, 180, 107, 202, 232, 215,
-    242, 23, 9, 130, 72, 213, 22, 154, 60, 179, 74, 155, 148, 140, 254, 243, 173, 208, 37, 78, 42, 237, 225, 251, 137,
-    194, 141, 20, 108, 142, 115, 125, 173, 195, 92, 150, 1, 43, 152, 114, 116, 229, 12, 178, 125, 143, 105, 184, 233,
-    182, 136, 135, 101, 245, 226, 182, 10, 38, 150, 213, 196, 26, 253, 3, 48, 98, 81, 96, 11, 87, 2, 48, 217, 188, 155,
-    144, 79, 167, 82, 1, 196, 42, 110, 182, 123, 230, 176, 71, 216, 28, 70, 76, 11, 25, 48, 219, 86, 3, 243, 138, 233,
-    229, 79, 226, 138, 8, 90, 51, 82, 230, 145, 144, 133, 225, 198, 24, 236, 12, 107, 179, 133, 226, 94, 45, 210, 52, 4,
-    217, 192, 30, 206, 225, 113, 232, 214, 224, 44, 88, 52, 241, 142, 231, 144, 97, 43, 234, 21, 134, 43, 219, 63, 231,
-    147, 185, 216, 249, 145, 177, 104, 212, 113, 148, 255, 169, 251, 164, 41, 104, 216, 231, 176, 19, 238, 152, 245, 21,
-    254, 139, 164, 30, 94, 73, 101, 41, 227, 74, 163, 168, 58, 35, 204, 199, 194, 53, 61, 125, 143, 116, 149, 38, 10,
-    187, 239, 79, 74, 180, 121, 137, 4, 93, 117, 205, 17, 39, 239, 193, 227, 186, 60, 229, 103, 254, 91, 45, 102, 102,
-    232, 203, 255, 170, 217, 147, 150, 131, 49, 82, 202, 19, 183, 105, 232, 233, 144, 232, 30, 64, 236, 68, 201, 93,
-    228, 33, 14, 118, 97, 141, 161, 234, 153, 64, 129, 106, 76, 227, 174, 15, 163, 167, 221, 34, 125, 168, 50, 151, 227,
-    108, 62, 238, 33, 134, 166, 83, 214, 124, 23, 19, 15, 21, 158, 253, 1, 207, 231, 189, 130, 98, 3, 115, 229, 200, 38,
-    124, 33, 112, 227, 87, 121, 66, 165, 119, 120, 100, 188, 93, 13, 144, 191, 72, 37, 77, 196, 225, 145, 101, 29, 100,
-    214, 115, 62, 84, 28, 110, 201, 241, 232, 144, 139, 211, 194, 123, 97, 225, 219, 101, 250, 87, 25, 243, 124, 32,
-    188, 173, 51, 84, 107, 111, 87, 13, 13, 121, 217, 210, 94, 145, 174, 32, 105, 244, 160, 83, 7, 81, 174, 182, 26, 15,
-    18, 4, 86, 116, 86, 232, 72, 63, 224, 91, 156, 63, 75, 1, 194, 218, 101, 228, 183, 215, 209, 50, 116, 110, 103, 39,
-    195, 223, 140, 70, 128, 44, 59, 37, 70, 163, 65, 51, 117, 96, 168, 153, 71, 114, 139, 242, 174, 7, 197, 1, 76, 98,
-    136, 64, 44, 228, 26, 90, 77, 223, 45, 53, 6, 54, 149, 47, 133, 154, 208, 158, 61, 7, 65, 131, 87, 77, 135, 225,
-    144, 135, 168, 77, 109, 220, 204, 77, 6, 9, 194, 254, 254, 160, 242, 213, 23, 57, 195, 66, 219, 106, 210, 138, 175,
-    77, 219, 223, 226, 105, 248, 141, 165, 202, 240, 221, 149, 169, 124, 110, 247, 101, 126, 44, 0, 171, 236, 156, 231,
-    87, 157, 32, 234, 61, 130, 177, 9, 45, 221, 157, 115, 158, 251, 124, 211, 131, 253, 37, 58, 205, 10, 233, 120, 238,
-    126, 113, 39, 50, 242, 153, 175, 95, 126, 183, 6, 210, 194, 142, 173, 108, 58, 109, 129, 106, 115, 136, 220, 92, 46,
-    52, 17, 237, 200, 255, 174, 37, 50, 184, 138, 24, 64, 16, 116, 183, 30, 123, 21, 244, 93, 51, 99, 201, 228, 23, 196,
-    244, 78, 152, 121, 204, 81, 48, 130, 240, 206, 216, 4, 95, 169, 192, 186, 205, 71, 6, 129, 153, 31, 14, 142, 48,
-    172, 47, 54, 82, 233, 8, 247, 153, 85, 22, 104, 243, 42, 246, 252, 21, 213, 109, 221, 70, 2, 28, 233, 52, 235, 246,
-    86, 204, 207, 16, 229, 66, 152, 28, 132, 43, 223, 16, 84, 250, 220, 105, 125, 30, 156, 243, 28, 1, 244, 102, 98,
-    225, 40, 142, 48, 49, 165, 153, 220, 209, 65, 254, 225, 195, 157, 93, 220, 204, 181, 81, 151, 117, 25, 209, 43, 187,
-    90, 120, 110, 25, 66, 14, 20, 48, 174, 119, 10, 144, 60, 8, 152, 102, 197, 174, 2, 192, 167, 56, 121, 132, 192, 69,
-    228, 55, 120, 205, 94, 84, 244, 84, 129, 102, 167, 254, 163, 179, 135, 185, 73, 226, 226, 239, 49, 34, 83, 32, 237,
-    170, 107, 168, 238, 217, 102, 125, 191, 75, 242, 56, 243, 163, 255, 129, 52, 3, 107, 95, 68, 3, 33, 220, 20, 199,
-    11, 62, 135, 109, 135, 223, 215, 91, 30, 234, 30, 91, 182, 96, 181, 49, 187, 150, 134, 206, 172, 48, 203, 131, 4,
-    67, 68, 95, 204, 170, 69, 139, 12, 228, 209, 224, 45, 211, 124, 114, 93, 76, 131, 152, 84, 72, 121, 151, 95, 27, 80,
-    88, 81, 155, 63, 174, 171, 231, 116, 178, 230, 254, 142, 178, 129, 177, 226, 188, 151, 163, 174, 30, 150, 39, 170,
-    32, 251, 58, 158, 240, 203, 123, 200, 45, 186, 223, 178, 167, 1, 83, 208, 55, 66, 184, 77, 210, 115, 73, 154, 2, 86,
-    205, 205, 205, 165, 104, 48, 191, 241, 143, 173, 89, 229, 228, 6, 221, 119, 164, 24, 236, 46, 157, 55, 117, 226,
-    249, 135, 47, 133, 125, 90, 117, 85, 82, 85, 47, 120, 104, 164, 223, 188, 8, 79, 31, 209, 213, 41, 226, 232, 145,
-    236, 167, 87, 5, 51, 120, 68, 194, 189, 7, 243, 251, 95, 248, 147, 26, 138, 228, 51, 117, 35, 79, 168, 105, 133,
-    246, 163, 125, 213, 159, 40, 112, 47, 174, 243, 67, 241, 30, 125, 176, 147, 180, 135, 16, 132, 115, 115, 65, 153,
-    221, 139, 88, 140, 85, 166, 64, 103, 174, 169, 172, 1, 157, 216, 227, 127, 120, 26, 126, 151, 54, 255, 160, 38, 130,
-    26, 234, 17, 55, 60, 143, 167, 103, 95, 201, 243, 75, 150, 229, 148, 162, 57, 254, 161, 159, 38, 249, 211, 149, 59,
-    161, 162, 52, 164, 128, 137, 123, 0, 106, 144, 119, 186, 173, 149, 191, 136, 196, 78, 16, 39, 162, 242, 186, 33, 17,
-    188, 90, 32, 38, 27, 129, 171, 45, 141, 100, 113, 233, 205, 137, 28, 110, 225, 85, 153, 112, 89, 123, 13, 199, 150,
-    54, 208, 2, 64, 203, 107, 174, 235, 156, 241, 17, 119, 172, 73, 225, 81, 32, 167, 241, 59, 137, 157, 191, 113, 165,
-    188, 38, 92, 62, 45, 64, 175, 102, 100, 2, 179, 1, 9, 55, 152, 210, 17, 86, 107, 75, 242, 230, 98, 45, 37, 206, 147,
-    72, 219, 254, 204, 8, 146, 222, 71, 150, 164, 111, 210, 107, 72, 228, 139, 235, 138, 242, 83, 12, 71, 198, 253, 20,
-    172, 52, 183, 237, 133, 141, 217, 241, 237, 116, 217, 26, 49, 233, 231, 198, 192, 67, 200, 98, 137, 253, 132, 133,
-    43, 217, 138, 122, 248, 220, 26, 3, 208, 47, 214, 14, 78, 37, 96, 29, 145, 240, 249, 77, 142, 145, 30, 0, 121, 13,
-    211, 182, 111, 220, 76, 15, 55, 220, 79, 181, 65, 66, 113, 20, 79, 212, 206, 224, 115, 213, 184, 148, 194, 116, 87,
-    132, 57, 135, 237, 129, 104, 148, 247, 109, 17, 251, 129, 7, 162, 89, 26, 19, 80, 79, 188, 143, 194, 138, 199, 52,
-    126, 108, 242, 131, 129, 70, 233, 194, 73, 219, 225, 162, 68, 248, 123, 86, 90, 13, 145, 126, 10, 103, 142, 218,
-    141, 60, 217, 123, 181, 116, 66, 1, 82, 156, 238, 141, 152, 100, 129, 154, 157, 112, 207, 16, 85, 33, 122, 111, 75,
-    150, 202, 201, 62, 97, 42, 155, 242, 118, 126, 250, 250, 42, 60, 253, 177, 104, 122, 96, 25, 132, 116, 2, 124, 11,
-    203, 81, 13, 204, 114, 208, 13, 163, 39, 128, 27, 54, 190, 82, 150, 10, 118, 248, 151, 118, 248, 199, 98, 216, 95,
-    22, 195, 63, 202, 61, 186, 145, 71, 36, 202, 122, 48, 73, 30, 10, 167, 123, 202, 89, 33, 11, 246, 209, 165, 164,
-    245, 43, 245, 192, 95, 169, 194, 168, 150, 116, 85, 157, 27, 40, 195, 168, 1, 5, 255, 79, 193, 37, 141, 126, 145,
-    139, 18, 39, 53, 75, 218, 57, 118, 45, 85, 94, 27, 186, 21, 88, 110, 204, 148, 115, 131, 250, 203, 184, 14, 100,
-    158, 52, 87, 64, 179, 199, 196, 4, 197, 164, 199, 126, 233, 152, 218, 64, 34, 230, 238, 134, 225, 239, 24, 30, 74,
-    61, 45, 103, 118, 148, 175, 74, 219, 179, 173, 13, 52, 121, 33, 174, 97, 61, 9, 93, 230, 234, 46, 187, 183, 250, 99,
-    170, 172, 190, 136, 80, 180, 83, 22, 11, 151, 228, 12, 7, 79, 185, 43, 0, 54, 97, 195, 62, 229, 168, 227, 123, 117,
-    123, 91, 138, 82, 50, 201, 190, 171, 226, 253, 43, 249, 120, 184, 84, 93, 94, 105, 4, 130, 110, 3, 28, 227, 229,
-    222, 31, 59, 239, 221, 41, 207, 56, 135, 19, 246, 189, 105, 244, 178, 20, 42, 221, 194, 228, 151, 188, 12, 45, 72,
-    53, 160, 41, 183, 206, 115, 196, 145, 173, 202, 223, 241, 49, 185, 240, 19, 2, 26, 88, 119, 86, 46, 198, 167, 169,
-    197, 116, 17, 83, 142, 253, 59, 50, 200, 142, 163, 96, 78, 104, 189, 160, 118, 196, 95, 63, 224, 247, 27, 111, 3,
-    13, 70, 142, 227, 197, 0, 253, 220, 106, 126, 240, 77, 108, 27, 65, 34, 24, 27, 46, 209, 179, 120, 214, 198, 16, 14,
-    135, 159, 212, 140, 0, 166, 118, 91, 95, 110, 33, 13, 184, 26, 196, 222, 44, 211, 194, 133, 253, 253, 148, 227, 130,
-    111, 235, 45, 186, 44, 188, 99, 161, 128, 253, 205, 227, 41, 98, 79, 222, 6, 165, 117, 5, 247, 89, 148, 50, 237,
-    215, 178, 96, 155, 48, 22, 123, 139, 233, 61, 24, 123, 157, 119, 24, 86, 101, 111, 109, 142, 23, 125, 95, 116, 223,
-    97, 119, 143, 60, 3, 115, 203, 72, 252, 113, 75, 34, 188, 138, 80, 240, 218, 158, 15, 32, 212, 220, 32, 233, 117,
-    144, 239, 5, 153, 75, 99, 83, 167, 51, 211, 66, 143, 250, 66, 176, 79, 174, 126, 237, 161, 60, 38, 62, 114, 89, 169,
-    120, 218, 148, 18, 76, 50, 246, 188, 7, 180, 174, 203, 161, 229, 30, 31, 229, 200, 30, 207, 175, 55, 74, 115, 8,
-    179, 93, 137, 144, 103, 87, 59, 235, 87, 159, 30, 62, 130, 174, 25, 61, 174, 87, 195, 203, 48, 253, 61, 236, 188, 5,
-    37, 80, 27, 84, 191, 197, 178, 101, 243, 30, 174, 2, 18, 205, 207, 65, 231, 130, 59, 220, 2, 152, 224, 73, 195, 78,
-    22, 151, 7, 89, 49, 64, 70, 200, 86, 191, 72, 246, 0, 90, 202, 1, 162, 57, 41, 140, 51, 190, 192, 73, 165, 70, 212,
-    26, 9, 8, 28, 127, 43, 127, 238, 60, 16, 243, 119, 193, 26, 222, 118, 229, 172, 47, 216, 104, 113, 203, 100, 106,
-    240, 121, 94, 143, 127, 2, 116, 41, 156, 159, 92, 3, 129, 91, 83, 114, 199, 49, 173, 55, 241, 87, 253, 98, 220, 89,
-    199, 106, 140, 196, 36, 120, 10, 172, 173, 87, 218, 179, 39, 203, 109, 77, 137, 9, 71, 205, 161, 211, 115, 30, 148,
-    82, 254, 224, 254, 217, 188, 165, 190, 44, 157, 7, 127, 210, 156, 88, 213, 123, 52, 208, 182, 26, 85, 225, 8, 152,
-    31, 12, 249, 52, 51, 223, 125, 205, 13, 131, 165, 29, 109, 43, 119, 118, 215, 194, 200, 57, 7, 115, 190, 30, 39,
-    252, 70, 46, 206, 132, 80, 153, 37, 145, 170, 206, 215, 19, 205, 39, 98, 65, 137, 234, 124, 155, 18, 49, 16, 42,
-    161, 65, 182, 232, 140, 167, 172, 191, 185, 24, 25, 22, 159, 112, 13, 126, 173, 119, 192, 93, 197, 150, 36, 70, 34,
-    131, 56, 153, 227, 142, 108, 27, 187, 160, 146, 59, 236, 205, 219, 97, 22, 25, 178, 90, 220, 47, 103, 73, 58, 85,
-    188, 91, 20, 169, 40, 217, 10, 112, 104, 6, 75, 67, 177, 126, 11, 144, 2, 70, 249, 1, 142, 190, 128, 105, 236, 25,
-    175, 182, 226, 86, 197, 95, 105, 121, 150, 51, 118, 3, 85, 194, 33, 218, 50, 84, 143, 117, 248, 227, 8, 108, 76, 84,
-    180, 144, 54, 54, 86, 196, 38, 171, 70, 19, 215, 150, 70, 58, 189, 253, 215, 12, 115, 4, 199, 50, 3, 197, 172, 41,
-    165, 81, 60, 157, 68, 148, 22, 250, 136, 247, 115, 81, 35, 249, 115, 60, 231, 11, 21, 163, 198, 190, 121, 127, 105,
-    187, 78, 243, 239, 61, 235, 26, 160, 138, 40, 36, 90, 121, 59, 7, 84, 237, 6, 61, 234, 165, 235, 174, 193, 13, 82,
-    96, 55, 246, 19, 229, 223, 66, 56, 181, 67, 74, 124, 113, 188, 84, 77, 169, 2, 33, 148, 72, 18, 33, 195, 79, 112,
-    156, 20, 8, 102, 235, 55, 122, 18, 5, 156, 155, 97, 213, 22, 237, 150, 143, 31, 160, 31, 61, 119, 212, 117, 45, 89,
-    118, 2, 1, 6, 161, 36, 112, 106, 145, 11, 27, 172, 164, 25, 236, 153, 26, 125, 11, 181, 81, 135, 169, 55, 82, 25,
-    98, 57, 144, 24, 182, 62, 13, 103, 30, 226, 18, 77, 23, 12, 164, 233, 207, 235, 225, 194, 9, 65, 214, 220, 249, 34,
-    130, 202, 35, 229, 101, 248, 231, 144, 93, 176, 117, 149, 119, 46, 55, 102, 127, 202, 207, 90, 36, 115, 53, 19, 206,
-    133, 174, 100, 111, 81, 124, 131, 36, 94, 103, 156, 121, 101, 57, 180, 133, 120, 194, 67, 29, 122, 232, 169, 115,
-    249, 160, 32, 69, 185, 130, 51, 167, 165, 192, 129, 174, 200, 253, 131, 105, 104, 197, 115, 218, 150, 200, 148, 173,
-    235, 233, 161, 12, 205, 238, 50, 167, 40, 130, 158, 157, 31, 124, 80, 229, 35, 170, 230, 159, 144, 164, 141, 54, 87,
-    120, 204, 69, 83, 54, 143, 217, 144, 139, 63, 238, 52, 176, 51, 148, 105, 78, 163, 199, 102, 181, 170, 105, 88, 13,
-    181, 84, 118, 42, 48, 164, 212, 216, 74, 44, 41, 57, 220, 47, 33, 102, 216, 214, 52, 104, 149, 100, 83, 91, 235,
-    178, 33, 196, 51, 176, 223, 89, 173, 211, 241, 47, 60, 251, 76, 150, 253, 73, 150, 18, 82, 147, 76, 106, 237, 214,
-    182, 139, 212, 182, 31, 23, 192, 100, 148, 135, 171, 196, 246, 218, 9, 205, 9, 177, 85, 114, 12, 142, 198, 30, 58,
-    145, 139, 193, 33, 23, 149, 95, 51, 112, 197, 222, 154, 53, 237, 184, 156, 122, 150, 237, 122, 113, 3, 58, 112, 221,
-    195, 78, 185, 166, 111, 65, 132, 252, 178, 233, 181, 76, 215, 65, 91, 84, 209, 132, 100, 47, 95, 198, 10, 179, 130,
-    176, 5, 185, 186, 100, 211, 93, 228, 43, 118, 137, 84, 198, 19, 213, 201, 199, 198, 98, 44, 160, 169, 60, 130, 79,
-    221, 178, 169, 189, 54, 4, 56, 14, 166, 194, 133, 225, 249, 159, 36, 83, 199, 233, 58, 222, 144, 19, 236, 128, 42,
-    86, 83, 27, 148, 107, 124, 230, 119, 61, 66, 74, 46, 167, 147, 92, 191, 240, 251, 36, 58, 154, 68, 26, 1, 87, 229,
-    191, 102, 97, 118, 176, 151, 47, 205, 183, 228, 122, 97, 179, 47, 199, 232, 234, 228, 128, 72, 115, 103, 52, 175,
-    87, 55, 145, 180, 166, 227, 56, 84, 39, 0, 31, 115, 13, 116, 5, 27, 68, 248, 165, 223, 242, 68, 223, 177, 195, 178,
-    225, 88, 247, 189, 133, 195, 73, 53, 86, 223, 92, 32, 105, 149, 181, 185, 115, 121, 80, 143, 155, 183, 248, 202,
-    212, 221, 162, 235, 33, 131, 172, 139, 41, 224, 69, 11, 78, 202, 203, 202, 177, 123, 14, 141, 115, 198, 190, 98, 40,
-    239, 212, 28, 247, 235, 119, 22, 114, 45, 36, 239, 24, 183, 81, 106, 200, 143, 13, 154, 26, 196, 68, 27, 9, 68, 11,
-    240, 227, 137, 120, 182, 156, 89, 144, 190, 185, 30, 236, 175, 201, 206, 207, 130, 83, 254, 207, 14, 224, 3, 51,
-    251, 0, 147, 191, 133, 181, 128, 253, 226, 24, 31, 153, 44, 133, 76, 88, 245, 248, 68, 10, 9, 16, 114, 190, 240, 48,
-    110, 140, 9, 149, 27, 215, 227, 252, 120, 68, 76, 234, 226, 233, 211, 231, 73, 88, 173, 61, 76, 53, 226, 233, 45,
-    52, 222, 165, 145, 93, 125, 252, 150, 137, 25, 102, 132, 119, 84, 53, 117, 154, 94, 9, 102, 46, 190, 202, 84, 11,
-    63, 83, 243, 196, 39, 191, 85, 113, 54, 159, 36, 194, 6, 239, 41, 19, 28, 0, 240, 38, 58, 60, 107, 152, 43, 29, 193,
-    6, 25, 107, 22, 153, 7, 221, 141, 26, 70, 185, 48, 171, 197, 104, 247, 142, 183, 140, 240, 198, 42, 84, 180, 173,
-    162, 171, 246, 77, 87, 171, 202, 151, 22, 194, 184, 120, 63, 189, 214, 255, 249, 247, 94, 38, 25, 41, 90, 241, 54,
-    47, 6, 192, 106, 60, 251, 115, 83, 214, 83, 72, 26, 35, 31, 59, 219, 218, 29, 103, 2, 223, 47, 217, 3, 243, 216,
-    164, 209, 221, 149, 138, 245, 16, 247, 136, 36, 173, 221, 44, 58, 206, 169, 48, 46, 60, 233, 119, 179, 125, 99, 53,
-    195, 166, 46, 200, 46, 161, 30, 60, 120, 32, 14, 186, 114, 34, 62, 135, 85, 55, 190, 114, 242, 74, 171, 5, 34, 169,
-    216, 28, 163, 53, 220, 29, 10, 243, 253, 136, 129, 34, 112, 118, 40, 247, 77, 90, 111, 240, 124, 2, 105, 178, 242,
-    67, 219, 121, 179, 130, 196, 239, 190, 209, 15, 166, 133, 174, 215, 87, 101, 211, 156, 68, 168, 172, 110, 219, 165,
-    137, 82, 98, 242, 80, 175, 81, 180, 65, 149, 215, 134, 16, 22, 112, 8, 18, 52, 46, 200, 19, 245, 241, 89, 144, 164,
-    235, 185, 49, 86, 87, 37, 32, 184, 65, 59, 109, 153, 60, 254, 93, 43, 223, 73, 102, 40, 6, 76, 213, 3, 99, 124, 120,
-    105, 189, 156, 123, 189, 33, 78, 199, 193, 148, 36, 25, 140, 200, 26, 208, 245, 153, 243, 204, 99, 213, 203, 189,
-    218, 135, 21, 121, 108, 216, 165, 99, 165, 214, 56, 253, 119, 163, 61, 119, 63, 69, 92, 43, 106, 245, 137, 87, 238,
-    107, 22, 79, 119, 8, 186, 161, 17, 249, 186, 10, 233, 73, 197, 9, 226, 170, 49, 195, 82, 133, 89, 164, 96, 245, 106,
-    192, 99, 138, 118, 107, 169, 15, 79, 119, 204, 38, 104, 55, 77, 201, 61, 166, 157, 90, 31, 136, 176, 84, 6, 9, 107,
-    189, 134, 44, 60, 19, 199, 140, 94, 168, 64, 64, 173, 41, 73, 214, 234, 252, 65, 219, 73, 114, 94, 202, 192, 215,
-    191, 194, 2, 74, 243, 231, 28, 167, 118, 195, 36, 197, 233, 246, 155, 161, 6, 159, 154, 118, 151, 64, 61, 110, 40,
-    164, 95, 204, 244, 86, 33, 21, 195, 8, 115, 235, 203, 120, 202, 56, 126, 86, 227, 75, 123, 152, 66, 70, 83, 77, 14,
-    61, 204, 240, 14, 181, 155, 11, 10, 36, 128, 129, 121, 166, 57, 134, 8, 82, 67, 52, 239, 11, 161, 52, 91, 160, 251,
-    25, 68, 217, 81, 149, 50, 63, 111, 1, 98, 132, 48, 179, 79, 170, 113, 69, 59, 173, 94, 178, 210, 183, 247, 113, 246,
-    99, 232, 112, 98, 113, 122, 204, 89, 229, 129, 119, 50, 133, 112, 2, 127, 124, 52, 186, 205, 104, 62, 46, 154, 142,
-    73, 51, 91, 175, 103, 65, 248, 45, 226, 28, 49, 81, 167, 70, 239, 66, 120, 154, 72, 151, 15, 221, 216, 221, 101,
-    116, 183, 216, 72, 105, 80, 14, 71, 123, 59, 159, 27, 168, 93, 223, 189, 134, 58, 61, 178, 140, 221, 18, 26, 54, 70,
-    43, 31, 218, 252, 177, 40, 177, 24, 18, 141, 45, 3, 104, 245, 13, 79, 5, 249, 245, 80, 124, 75, 221, 248, 18, 32,
-    136, 65, 121, 227, 223, 178, 35, 7, 124, 208, 67, 25, 25, 149, 0, 235, 239, 243, 32, 81, 160, 243, 253, 114, 205,
-    146, 162, 40, 112, 250, 74, 88, 165, 85, 197, 126, 158, 184, 24, 154, 239, 95, 98, 124, 136, 132, 119, 129, 106,
-    111, 95, 48, 123, 164, 154, 146, 22, 208, 158, 63, 244, 86, 97, 219, 156, 7, 190, 174, 34, 156, 185, 253, 111, 75,
-    38, 155, 15, 241, 127, 219, 54, 92, 59, 94, 113, 161, 10, 195, 208, 48, 233, 189, 235, 162, 34, 253, 94, 227, 153,
-    51, 87, 203, 195, 230, 213, 244, 241, 166, 25, 175, 54, 178, 12, 89, 72, 22, 188, 212, 37, 17, 84, 220, 35, 201,
-    178, 35, 6, 100, 10, 168, 21, 104, 211, 62, 30, 65, 41, 12, 80, 102, 62, 45, 59, 182, 143, 44, 117, 229, 70, 94, 8,
-    246, 166, 138, 227, 103, 31, 219, 54, 64, 42, 196, 238, 119, 11, 215, 30, 46, 214, 101, 9, 61, 106, 186, 253, 101,
-    192, 25, 215, 85, 93, 154, 136, 252, 163, 219, 150, 153, 84, 180, 99, 18, 39, 115, 160, 252, 89, 189, 126, 205, 48,
-    212, 152, 190, 79, 79, 173, 181, 165, 47, 41, 82, 76, 25, 68, 42, 6, 127, 253, 115, 116, 12, 201, 219, 124, 5, 145,
-    62, 249, 155, 93, 58, 66, 75, 246, 10, 101, 203, 115, 94, 150, 128, 34, 173, 196, 69, 25, 172, 116, 200, 192, 185,
-    0, 87, 96, 231, 226, 150, 170, 27, 9, 232, 233, 39, 188, 224, 165, 228, 215, 152, 132, 18, 7, 249, 132, 250, 35, 29,
-    20, 209, 90, 247, 105, 243, 224, 105, 58, 102, 190, 51, 241, 30, 221, 188, 10, 184, 71, 168, 214, 107, 128, 56, 165,
-    177, 16, 9, 241, 155, 15, 132, 125, 64, 39, 191, 154, 85, 181, 56, 220, 76, 165, 161, 182, 211, 140, 133, 89, 255,
-    23, 82, 195, 66, 188, 86, 183, 65, 196, 22, 238, 53, 218, 211, 197, 59, 184, 254, 137, 147, 159, 128, 3, 43, 95,
-    204, 242, 230, 221, 139, 207, 78, 137, 248, 80, 11, 169, 240, 35, 15, 151, 162, 35, 37, 151, 62, 244, 244, 179, 158,
-    5, 171, 189, 155, 226, 48, 2, 25, 58, 109, 102, 42, 239, 130, 52, 133, 177, 29, 158, 154, 138, 190, 229, 6, 137, 66,
-    81, 161, 193, 189, 138, 13, 68, 112, 5, 9, 31, 232, 213, 75, 38, 32, 129, 82, 122, 50, 72, 84, 71, 80, 199, 179, 72,
-    251, 100, 14, 84, 223, 41, 160, 196, 76, 14, 211, 93, 112, 100, 2, 166, 171, 38, 103, 107, 5, 81, 87, 253, 1, 200,
-    203, 240, 222, 216, 239, 49, 149, 51, 127, 238, 104, 48, 205, 164, 160, 39, 114, 86, 240, 162, 101, 179, 64, 244,
-    254, 16, 11, 135, 240, 82, 207, 82, 235, 52, 229, 215, 100, 147, 166, 207, 232, 81, 46, 95, 85, 208, 218, 116, 95,
-    206, 64, 103, 74, 33, 181, 134, 119, 128, 67, 152, 236, 222, 22, 11, 94, 63, 226, 109, 217, 124, 59, 140, 189, 203,
-    33, 13, 13, 84, 37, 127, 224, 225, 93, 134, 171, 233, 106, 229, 60, 26, 52, 124, 118, 195, 224, 175, 174, 25, 25,
-    182, 113, 179, 141, 163, 188, 247, 57, 8, 198, 178, 82, 196, 178, 3, 152, 87, 118, 36, 63, 28, 235, 208, 186, 254,
-    76, 108, 3, 44, 31, 168, 210, 20, 39, 96, 109, 253, 204, 15, 195, 162, 168, 158, 167, 39, 48, 243, 225, 193, 4, 108,
-    168, 190, 63, 97, 194, 224, 133, 250, 191, 82, 59, 64, 68, 216, 153, 222, 81, 141, 211, 135, 216, 196, 75, 64, 78,
-    20, 181, 114, 94, 235, 180, 150, 50, 52, 190, 129, 223, 49, 104, 65, 110, 171, 50, 134, 197, 150, 4, 114, 35, 38,
-    118, 7, 87, 119, 140, 126, 201, 218, 93, 142, 74, 231, 253, 218, 244, 248, 197, 158, 139, 23, 65, 12, 146, 106, 74,
-    23, 129, 125, 133, 39, 226, 212, 46, 49, 103, 28, 237, 101, 13, 248, 31, 60, 203, 193, 10, 80, 134, 241, 221, 107,
-    230, 70, 188, 233, 214, 217, 221, 116, 231, 24, 143, 221, 7, 1, 31, 108, 249, 246, 141, 198, 55, 139, 239, 56, 196,
-    120, 17, 57, 114, 18, 48, 169, 148, 92, 235, 180, 147, 241, 188, 145, 207, 149, 214, 165, 147, 127, 52, 114, 52,
-    162, 115, 202, 135, 173, 210, 101, 68, 150, 8, 174, 3, 139, 206, 89, 226, 21, 55, 136, 90, 112, 137, 121, 228, 87,
-    115, 77, 160, 204, 93, 61, 138, 221, 149, 176, 214, 95, 250, 247, 126, 4, 27, 75, 153, 206, 167, 87, 42, 104, 148,
-    136, 196, 74, 79, 110, 96, 30, 15, 102, 236, 44, 80, 157, 232, 220, 113, 81, 40, 66, 147, 30, 82, 202, 149, 126,
-    156, 134, 37, 116, 46, 105, 245, 17, 43, 201, 142, 86, 155, 61, 193, 117, 123, 133, 22, 76, 246, 233, 170, 121, 210,
-    153, 16, 181, 62, 41, 250, 124, 201, 250, 176, 10, 234, 180, 40, 59, 69, 140, 87, 83, 31, 87, 206, 204, 56, 172, 4,
-    244, 56, 5, 133, 163, 124, 0, 16, 19, 228, 87, 227, 78, 152, 26, 70, 240, 102, 103, 76, 48, 177, 119, 54, 202, 180,
-    140, 73, 42, 219, 192, 20, 162, 232, 74, 250, 227, 36, 31, 195, 246, 50, 224, 215, 196, 108, 156, 90, 30, 254, 91,
-    55, 174, 230, 50, 190, 47, 119, 77, 254, 181, 104, 211, 7, 76, 99, 54, 50, 35, 70, 155, 20, 233, 69, 141, 250, 47,
-    253, 201, 199, 208, 86, 57, 20, 234, 85, 231, 72, 141, 243, 209, 35, 155, 134, 189, 16, 153, 98, 112, 18, 190, 68,
-    126, 32, 59, 186, 203, 141, 102, 151, 88, 146, 194, 11, 132, 36, 128, 86, 29, 101, 176, 243, 12, 228, 22, 67, 183,
-    149, 33, 51, 173, 72, 117, 196, 109, 119, 124, 5, 75, 76, 4, 12, 59, 182, 193, 100, 38, 85, 150, 61, 13, 112, 50,
-    157, 121, 89, 255, 239, 28, 218, 184, 85, 123, 246, 51, 56, 10, 191, 109, 73, 95, 129, 139, 22, 107, 240, 133, 152,
-    138, 69, 121, 222, 137, 76, 216, 210, 12, 132, 82, 15, 211, 76, 30, 129, 95, 99, 148, 159, 191, 173, 6, 37, 147, 0,
-    66, 126, 252, 244, 253, 186, 35, 98, 79, 160, 123, 21, 125, 36, 153, 202, 98, 187, 151, 165, 89, 53, 74, 43, 175,
-    238, 59, 2, 48, 147, 135, 13, 116, 117, 148, 158, 139, 71, 144, 106, 54, 2, 235, 69, 63, 92, 109, 40, 7, 180, 13,
-    174, 120, 94, 77, 243, 18, 221, 32, 254, 154, 196, 108, 112, 25, 34, 207, 173, 179, 190, 30, 2, 175, 240, 29, 177,
-    200, 243, 168, 237, 205, 145, 65, 220, 76, 29, 186, 1, 103, 167, 203, 194, 118, 119, 210, 75, 103, 25, 105, 235,
-    212, 63, 83, 94, 171, 131, 79, 244, 118, 161, 104, 212, 110, 94, 56, 120, 162, 17, 228, 121, 253, 135, 94, 184, 236,
-    125, 226, 117, 123, 51, 49, 112, 146, 0, 71, 185, 248, 124, 178, 234, 31, 123, 9, 120, 40, 82, 82, 213, 150, 33,
-    142, 67, 73, 199, 225, 178, 31, 162, 228, 185, 123, 236, 217, 125, 236, 33, 11, 106, 65, 76, 232, 66, 123, 74, 211,
-    108, 43, 109, 28, 249, 75, 188, 187, 82, 80, 147, 44, 124, 10, 209, 209, 142, 121, 93, 42, 238, 220, 48, 10, 88,
-    147, 209, 123, 213, 224, 229, 165, 132, 132, 199, 127, 59, 44, 80, 169, 126, 186, 109, 139, 125, 174, 220, 241, 66,
-    217, 10, 45, 99, 167, 100, 170, 52, 222, 31, 151, 141, 143, 95, 19, 10, 239, 61, 242, 57, 88, 114, 1, 79, 107, 170,
-    92, 246, 155, 168, 201, 118, 180, 198, 77, 199, 224, 152, 202, 126, 109, 62, 136, 144, 110, 119, 171, 7, 25, 82,
-    174, 210, 184, 153, 233, 218, 31, 97, 160, 163, 127, 199, 169, 112, 56, 180, 96, 66, 13, 238, 123, 132, 145, 69, 80,
-    148, 128, 150, 30, 157, 27, 31, 83, 128, 3, 88, 148, 149, 169, 217, 155, 100, 14, 183, 93, 20, 73, 166, 99, 16, 224,
-    121, 46, 37, 105, 4, 31, 213, 36, 182, 5, 191, 92, 42, 250, 60, 82, 76, 186, 14, 71, 236, 22, 137, 122, 220, 131,
-    60, 120, 223, 67, 35, 203, 163, 91, 22, 147, 98, 30, 15, 172, 49, 136, 249, 93, 172, 83, 151, 44, 101, 231, 52, 70,
-    169, 214, 212, 253, 66, 91, 139, 234, 163, 3, 160, 141, 210, 225, 55, 3, 76, 205, 234, 191, 220, 179, 228, 82, 130,
-    62, 76, 239, 84, 103, 134, 141, 224, 198, 115, 28, 110, 129, 102, 161, 198, 113, 66, 63, 129, 172, 165, 249, 148,
-    34, 137, 57, 126, 26, 135, 12, 42, 165, 57, 121, 222, 77, 217, 42, 196, 208, 114, 50, 177, 124, 230, 34, 171, 102,
-    122, 26, 190, 105, 63, 60, 67, 70, 51, 241, 212, 77, 47, 127, 108, 184, 239, 248, 149, 34, 249, 36, 7, 9, 184, 110,
-    143, 253, 227, 92, 192, 167, 196, 50, 130, 171, 228, 199, 106, 96, 221, 220, 152, 236, 104, 66, 67, 176, 82, 65,
-    226, 246, 249, 111, 191, 8, 243, 41, 116, 56, 231, 98, 59, 86, 225, 14, 38, 232, 133, 42, 34, 2, 73, 62, 159, 208,
-    236, 19, 194, 240, 236, 174, 14, 178, 165, 45, 154, 84, 107, 4, 204, 93, 114, 235, 148, 132, 37, 189, 212, 175, 172,
-    146, 169, 115, 110, 168, 96, 185, 170, 43, 4, 246, 111, 43, 117, 8, 226, 200, 21, 177, 77, 33, 66, 97, 227, 187, 78,
-    105, 224, 249, 152, 205, 6, 216, 123, 23, 207, 98, 213, 7, 213, 21, 22, 101, 98, 112, 69, 177, 29, 138, 94, 106, 72,
-    247, 100, 21, 111, 195, 125, 221, 55, 78, 125, 155, 170, 163, 248, 190, 36, 162, 158, 75, 171, 134, 17, 6, 127, 228,
-    115, 21, 189, 151, 15, 38, 211, 191, 249, 34, 12, 116, 75, 253, 34, 3, 72, 211, 132, 77, 222, 45, 86, 177, 161, 144,
-    19, 199, 232, 5, 26, 80, 88, 103, 129, 192, 133, 109, 5, 67, 158, 209, 46, 2, 171, 114, 239, 255, 137, 74, 99, 18,
-    49, 216, 87, 113, 46, 21, 88, 240, 36, 41, 35, 96, 140, 10, 123, 3, 113, 242, 162, 59, 141, 41, 23, 181, 217, 243,
-    144, 212, 9, 4, 129, 18, 202, 173, 159, 127, 229, 69, 189, 19, 23, 130, 90, 167, 203, 150, 153, 12, 168, 237, 143,
-    177, 198, 201, 167, 136, 64, 51, 87, 6, 238, 51, 167, 249, 135, 245, 14, 19, 10, 65, 48, 5, 14, 229, 167, 74, 60,
-    116, 230, 79, 193, 107, 33, 201, 124, 241, 71, 134, 218, 92, 161, 155, 48, 161, 8, 150, 82, 13, 227, 199, 89, 182,
-    94, 144, 229, 167, 207, 203, 194, 137, 124, 115, 213, 11, 225, 248, 35, 38, 224, 204, 19, 4, 241, 186, 128, 85, 61,
-    181, 25, 171, 66, 110, 68, 15, 172, 223, 183, 46, 156, 210, 86, 101, 237, 208, 118, 215, 242, 141, 204, 244, 178,
-    247, 131, 121, 48, 207, 217, 81, 120, 196, 51, 59, 90, 38, 123, 14, 48, 147, 0, 36, 171, 161, 196, 67, 193, 24, 29,
-    182, 33, 6, 131, 191, 43, 236, 204, 79, 157, 158, 205, 240, 185, 201, 77, 50, 23, 139, 157, 57, 210, 43, 179, 143,
-    4, 60, 208, 146, 154, 62, 60, 3, 194, 50, 67, 3, 173, 92, 128, 242, 166, 45, 237, 76, 205, 249, 155, 17, 178, 85,
-    53, 221, 200, 196, 34, 130, 38, 35, 93, 119, 140, 31, 78, 6, 196, 85, 48, 27, 239, 237, 236, 31, 126, 8, 172, 156,
-    96, 180, 13, 141, 245, 70, 131, 30, 244, 226, 227, 235, 115, 123, 51, 233, 171, 113, 43, 127, 235, 176, 2, 231, 84,
-    12, 56, 245, 150, 231, 218, 126, 114, 235, 146, 92, 99, 117, 116, 177, 114, 218, 49, 58, 126, 65, 93, 206, 112, 26,
-    107, 227, 22, 62, 242, 62, 42, 16, 170, 196, 131, 159, 27, 17, 69, 202, 29, 79, 18, 10, 189, 59, 252, 198, 197, 84,
-    252, 172, 86, 11, 99, 119, 139, 180, 139, 9, 40, 171, 226, 81, 245, 162, 109, 199, 154, 177, 238, 50, 14, 12, 182,
-    9, 48, 154, 67, 27, 119, 214, 201, 209, 209, 240, 138, 44, 52, 247, 149, 3, 115, 131, 117, 220, 85, 250, 65, 59,
-    157, 212, 159, 212, 114, 111, 216, 93, 219, 216, 186, 208, 5, 242, 211, 212, 231, 240, 255, 216, 40, 32, 108, 253,
-    210, 245, 1, 165, 200, 105, 106, 90, 29, 2, 242, 3, 230, 26, 124, 145, 217, 201, 246, 73, 41, 109, 161, 59, 37, 211,
-    137, 133, 124, 215, 36, 183, 146, 14, 161, 48, 108, 145, 10, 161, 227, 103, 213, 192, 51, 134, 174, 224, 4, 126, 45,
-    159, 178, 114, 145, 172, 231, 118, 152, 53, 253, 112, 25, 150, 226, 135, 25, 234, 138, 135, 225, 254, 249, 84, 100,
-    230, 84, 165, 103, 5, 203, 34, 149, 139, 52, 232, 73, 196, 201, 25, 254, 7, 151, 34, 205, 7, 148, 67, 252, 195, 247,
-    85, 183, 76, 69, 179, 159, 27, 229, 15, 56, 92, 78, 122, 13, 181, 84, 80, 126, 28, 25, 37, 14, 189, 54, 44, 234,
-    173, 67, 176, 80, 226, 123, 130, 23, 193, 82, 18, 218, 220, 226, 14, 246, 86, 136, 11, 246, 153, 119, 170, 103, 112,
-    253, 8, 188, 193, 149, 99, 195, 159, 28, 177, 24, 27, 100, 147, 34, 229, 229, 118, 205, 83, 80, 143, 110, 104, 156,
-    254, 57, 140, 86, 170, 168, 88, 121, 93, 66, 97, 179, 180, 92, 143, 130, 177, 205, 215, 91, 75, 185, 88, 123, 220,
-    173, 252, 26, 87, 203, 101, 112, 243, 127, 70, 1, 37, 201, 254, 132, 101, 94, 2, 153, 251, 185, 202, 17, 86, 154,
-    47, 184, 110, 12, 201, 203, 212, 117, 21, 209, 50, 69, 68, 251, 187, 159, 198, 60, 230, 92, 139, 67, 10, 63, 178,
-    132, 167, 226, 230, 121, 253, 230, 186, 74, 209, 111, 131, 117, 106, 175, 109, 77, 46, 5, 230, 153, 70, 81, 190,
-    105, 190, 195, 248, 145, 145, 132, 255, 18, 56, 228, 230, 207, 202, 58, 129, 92, 233, 26, 84, 71, 158, 226, 34, 253,
-    84, 162, 251, 177, 226, 16, 47, 232, 151, 178, 207, 113, 166, 226, 30, 115, 61, 75, 171, 121, 195, 174, 181, 247,
-    73, 214, 123, 192, 232, 78, 216, 56, 21, 223, 213, 150, 105, 241, 49, 91, 54, 81, 0, 150, 87, 194, 153, 40, 20, 211,
-    203, 25, 108, 193, 207, 143, 174, 181, 176, 211, 213, 166, 154, 94, 98, 247, 121, 23, 146, 138, 153, 238, 164, 107,
-    186, 228, 79, 223, 155, 149, 16, 71, 144, 6, 127, 53, 89, 17, 61, 5, 244, 21, 2, 34, 51, 113, 239, 142, 57, 249,
-    194, 92, 61, 255, 217, 74, 45, 103, 43, 126, 51, 175, 82, 3, 48, 71, 73, 55, 14, 164, 31, 188, 195, 178, 208, 254,
-    66, 186, 19, 91, 224, 210, 120, 96, 126, 104, 247, 144, 164, 15, 8, 146, 251, 202, 41, 242, 28, 167, 96, 87, 129,
-    20, 25, 64, 119, 237, 24, 55, 242, 89, 43, 94, 231, 88, 232, 11, 200, 127, 85, 248, 191, 37, 45, 57, 220, 84, 98,
-    241, 14, 198, 8, 37, 190, 84, 97, 144, 84, 95, 62, 181, 229, 12, 151, 38, 32, 0, 242, 200, 85, 182, 16, 134, 161,
-    70, 213, 233, 251, 98, 64, 52, 86, 251, 146, 28, 55, 238, 169, 24, 29, 61, 225, 55, 112, 133, 233, 126, 49, 130,
-    137, 183, 3, 1, 116, 124, 145, 192, 152, 100, 177, 139, 184, 251, 126, 207, 201, 241, 108, 201, 192, 17, 32, 228,
-    47, 214, 89, 59, 99, 238, 7, 43, 171, 244, 72, 225, 235, 173, 118, 49, 14, 129, 165, 72, 65, 170, 190, 2, 106, 181,
-    16, 20, 147, 106, 124, 236, 44, 82, 247, 241, 177, 67, 188, 115, 146, 23, 108, 255, 187, 175, 204, 238, 66, 105,
-    213, 206, 195, 34, 246, 125, 115, 68, 228, 176, 208, 190, 39, 9, 24, 255, 127, 193, 56, 0, 7, 216, 132, 122, 212,
-    183, 69, 39, 78, 205, 104, 171, 6, 89, 236, 232, 125, 242, 145, 224, 54, 146, 211, 214, 155, 240, 13, 19, 21, 71,
-    160, 229, 136, 71, 209, 108, 76, 226, 79, 56, 64, 229, 146, 131, 135, 138, 66, 169, 240, 76, 209, 11, 114, 93, 55,
-    39, 230, 86, 82, 75, 128, 246, 70, 152, 89, 6, 59, 160, 80, 181, 235, 41, 124, 21, 41, 181, 24, 5, 160, 255, 138,
-    93, 39, 27, 207, 227, 32, 8, 69, 239, 45, 166, 63, 239, 123, 125, 155, 139, 63, 107, 7, 50, 77, 153, 172, 104, 168,
-    227, 247, 231, 230, 228, 157, 62, 154, 48, 181, 207, 54, 22, 155, 228, 237, 110, 106, 186, 80, 153, 221, 65, 201,
-    164, 36, 76, 73, 56, 172, 251, 41, 8, 48, 227, 167, 246, 253, 122, 30, 253, 105, 20, 69, 87, 72, 192, 60, 216, 210,
-    15, 73, 136, 237, 100, 161, 29, 175, 94, 166, 153, 16, 227, 172, 7, 148, 6, 210, 74, 254, 122, 50, 254, 136, 231,
-    203, 228, 137, 204, 69, 126, 112, 122, 130, 41, 68, 172, 2, 77, 224, 202, 76, 165, 65, 142, 58, 85, 235, 51, 154,
-    172, 129, 175, 194, 242, 245, 181, 232, 146, 180, 143, 94, 188, 50, 200, 210, 39, 26, 190, 43, 104, 201, 166, 166,
-    109, 24, 43, 69, 240, 254, 213, 52, 158, 181, 239, 67, 109, 87, 161, 104, 128, 124, 89, 47, 51, 44, 231, 170, 149,
-    189, 38, 119, 145, 142, 7, 244, 76, 72, 173, 118, 227, 229, 208, 155, 226, 34, 221, 202, 212, 60, 179, 224, 131,
-    246, 106, 205, 100, 17, 68, 36, 79, 235, 133, 207, 231, 85, 69, 49, 226, 95, 11, 228, 44, 28, 24, 187, 46, 51, 108,
-    226, 98, 203, 139, 249, 192, 151, 35, 199, 137, 228, 90, 175, 124, 84, 144, 241, 217, 116, 75, 160, 80, 102, 27,
-    150, 178, 69, 93, 148, 65, 202, 173, 131, 85, 52, 125, 254, 43, 252, 221, 82, 179, 249, 233, 139, 229, 203, 150,
-    139, 49, 173, 34, 91, 74, 9, 25, 235, 133, 245, 143, 131, 76, 239, 247, 34, 220, 70, 114, 57, 71, 196, 92, 219, 246,
-    115, 211, 245, 154, 23, 28, 44, 222, 189, 39, 255, 134, 126, 17, 8, 54, 220, 68, 190, 13, 95, 165, 88, 25, 139, 116,
-    199, 137, 41, 115, 90, 128, 253, 36, 211, 38, 55, 47, 11, 123, 5, 255, 93, 213, 249, 93, 56, 229, 197, 116, 111,
-    127, 36, 39, 34, 23, 24, 143, 116, 64, 40, 120, 34, 80, 57, 132, 148, 100, 191, 65, 253, 204, 250, 9, 199, 61, 52,
-    32, 202, 180, 235, 96, 150, 239, 48, 130, 214, 18, 83, 108, 43, 62, 189, 179, 213, 136, 254, 127, 42, 87, 197, 103,
-    152, 26, 210, 163, 47, 144, 202, 152, 52, 166, 101, 51, 243, 116, 136, 2, 237, 233, 216, 64, 208, 143, 228, 28, 199,
-    162, 226, 174, 169, 246, 222, 11, 26, 227, 159, 28, 55, 228, 11, 144, 18, 18, 123, 236, 236, 36, 46, 106, 54, 148,
-    41, 143, 94, 252, 15, 132, 97, 33, 5, 182, 174, 89, 170, 144, 224, 196, 3, 79, 82, 148, 246, 231, 234, 61, 144, 237,
-    70, 151, 129, 172, 32, 62, 194, 142, 143, 98, 107, 34, 158, 170, 93, 74, 34, 140, 35, 81, 88, 125, 18, 231, 215,
-    243, 96, 12, 186, 94, 74, 136, 164, 137, 37, 154, 254, 126, 114, 72, 43, 106, 165, 160, 79, 206, 48, 65, 174, 21,
-    190, 109, 3, 214, 105, 196, 209, 121, 131, 45, 38, 139, 130, 176, 22, 93, 100, 5, 189, 27, 179, 209, 155, 201, 3,
-    193, 252, 141, 98, 88, 234, 232, 229, 150, 125, 80, 15, 22, 31, 60, 226, 97, 162, 2, 73, 95, 114, 102, 166, 205, 13,
-    245, 212, 102, 103, 222, 25, 78, 199, 41, 54, 233, 9, 175, 36, 157, 184, 121, 110, 239, 105, 158, 137, 249, 82, 134,
-    141, 235, 216, 182, 194, 176, 192, 45, 155, 185, 211, 76, 185, 18, 6, 157, 20, 114, 203, 79, 94, 41, 70, 86, 156,
-    54, 197, 22, 218, 116, 195, 137, 62, 109, 171, 198, 48, 53, 141, 255, 33, 7, 161, 216, 52, 187, 24, 114, 158, 217,
-    176, 15, 34, 242, 194, 64, 134, 11, 120, 217, 241, 177, 131, 0, 76, 73, 246, 4, 227, 113, 204, 34, 221, 196, 16,
-    178, 236, 18, 7, 58, 105, 176, 45, 74, 160, 168, 17, 78, 113, 10, 49, 241, 51, 235, 233, 168, 145, 209, 192, 165,
-    58, 146, 116, 235, 64, 173, 52, 137, 4, 40, 175, 18, 44, 26, 18, 247, 236, 241, 77, 117, 88, 52, 75, 126, 144, 160,
-    189, 188, 73, 110, 162, 104, 21, 2, 214, 82, 75, 34, 139, 24, 89, 188, 162, 211, 246, 190, 73, 92, 115, 48, 13, 28,
-    23, 212, 247, 74, 136, 121, 81, 147, 92, 48, 89, 18, 116, 103, 47, 68, 167, 27, 237, 57, 8, 0, 208, 183, 208, 180,
-    128, 184, 135, 183, 244, 113, 102, 218, 79, 161, 63, 52, 126, 157, 170, 98, 200, 171, 120, 189, 143, 136, 175, 207,
-    86, 244, 45, 62, 227, 138, 113, 250, 140, 26, 48, 248, 18, 39, 68, 25, 135, 213, 89, 216, 20, 54, 46, 174, 238, 83,
-    2, 126, 27, 136, 162, 128, 124, 236, 205, 133, 205, 115, 208, 226, 33, 55, 44, 64, 184, 160, 138, 147, 96, 69, 21,
-    54, 26, 35, 16, 147, 232, 122, 194, 56, 67, 156, 172, 184, 213, 62, 80, 191, 105, 242, 103, 215, 123, 74, 149, 67,
-    82, 44, 185, 66, 172, 161, 167, 213, 206, 203, 231, 9, 127, 61, 234, 239, 133, 35, 4, 107, 212, 106, 28, 53, 101,
-    132, 233, 16, 188, 78, 141, 239, 108, 38, 27, 27, 221, 21, 49, 243, 52, 143, 250, 167, 224, 54, 117, 172, 202, 32,
-    77, 184, 208, 22, 225, 195, 133, 90, 234, 66, 123, 148, 3, 78, 190, 174, 187, 206, 176, 89, 82, 232, 8, 87, 79, 223,
-    6, 134, 64, 144, 36, 243, 8, 126, 4, 156, 56, 44, 203, 227, 55, 96, 78, 181, 26, 68, 9, 200, 114, 10, 112, 250, 113,
-    171, 244, 188, 167, 111, 189, 231, 32, 74, 234, 16, 209, 44, 191, 173, 244, 106, 247, 41, 220, 123, 136, 106, 43,
-    95, 155, 199, 188, 88, 58, 27, 219, 38, 164, 224, 41, 23, 45, 67, 136, 107, 246, 103, 17, 76, 30, 254, 33, 138, 146,
-    171, 106, 248, 83, 212, 252, 102, 81, 4, 161, 70, 113, 80, 51, 65, 173, 105, 148, 151, 81, 210, 120, 41, 222, 25,
-    100, 83, 150, 212, 112, 112, 85, 251, 58, 185, 32, 232, 224, 216, 206, 106, 126, 3, 253, 237, 220, 224, 89, 117,
-    161, 43, 255, 19, 150, 131, 214, 13, 1, 206, 157, 198, 136, 184, 103, 16, 219, 49, 225, 76, 247, 175, 88, 193, 111,
-    250, 12, 164, 78, 205, 116, 130, 121, 56, 112, 190, 171, 184, 35, 177, 247, 15, 137, 42, 121, 238, 229, 44, 255,
-    132, 253, 237, 162, 147, 232, 169, 157, 187, 129, 253, 29, 236, 219, 75, 81, 84, 10, 127, 8, 252, 90, 35, 26, 59,
-    255, 28, 227, 204, 7, 229, 99, 61, 34, 190, 49, 236, 114, 254, 178, 153, 56, 142, 153, 241, 172, 134, 218, 184, 153,
-    153, 85, 98, 28, 228, 6, 56, 83, 33, 113, 178, 246, 100, 246, 220, 145, 39, 119, 168, 111, 230, 167, 223, 88, 91,
-    121, 105, 71, 48, 239, 145, 99, 43, 216, 237, 230, 130, 156, 129, 36, 6, 67, 159, 84, 66, 45, 158, 52, 103, 131, 81,
-    165, 49, 222, 45, 19, 246, 242, 18, 117, 197, 4, 135, 206, 155, 183, 104, 56, 242, 140, 54, 56, 120, 237, 235, 43,
-    199, 97, 6, 156, 45, 233, 226, 200, 105, 21, 100, 84, 254, 218, 73, 6, 240, 203, 149, 3, 134, 224, 105, 163, 221,
-    212, 193, 176, 33, 208, 134, 225, 210, 178, 182, 185, 215, 51, 25, 130, 210, 102, 186, 103, 155, 245, 2, 212, 52,
-    87, 117, 242, 193, 189, 49, 15, 251, 167, 4, 128, 161, 56, 67, 19, 168, 115, 79, 223, 166, 77, 28, 244, 220, 99, 69,
-    237, 82, 228, 233, 153, 33, 206, 1, 3, 123, 44, 87, 0, 159, 120, 61, 166, 181, 105, 95, 111, 193, 172, 10, 184, 151,
-    197, 91, 217, 82, 9, 36, 252, 234, 91, 2, 238, 104, 205, 185, 100, 132, 178, 53, 205, 53, 96, 241, 189, 91, 90, 42,
-    12, 197, 136, 195, 198, 49, 226, 69, 130, 23, 230, 2, 61, 187, 4, 174, 98, 32, 202, 131, 107, 18, 55, 196, 254, 156,
-    108, 181, 146, 169, 16, 48, 216, 128, 225, 98, 185, 1, 123, 251, 29, 1, 181, 123, 135, 91, 204, 65, 174, 108, 175,
-    234, 234, 137, 192, 41, 189, 254, 222, 108, 245, 140, 49, 168, 89, 67, 17, 229, 168, 51, 99, 207, 49, 26, 6, 1, 188,
-    196, 196, 31, 191, 134, 5, 152, 7, 114, 45, 69, 244, 133, 164, 64, 7, 123, 4, 73, 168, 62, 100, 228, 108, 56, 148,
-    235, 213, 79, 117, 39, 70, 228, 135, 183, 247, 143, 182, 139, 99, 34, 112, 100, 70, 181, 67, 192, 110, 31, 122, 189,
-    61, 175, 239, 44, 114, 171, 24, 175, 14, 102, 56, 123, 150, 43, 241, 112, 204, 164, 218, 244, 61, 45, 211, 119, 162,
-    199, 30, 33, 222, 100, 196, 229, 120, 80, 100, 140, 192, 110, 67, 71, 160, 98, 233, 254, 225, 92, 247, 164, 101, 15,
-    119, 18, 11, 122, 173, 28, 7, 24, 82, 96, 158, 173, 240, 13, 151, 10, 64, 140, 142, 245, 85, 230, 84, 20, 11, 180,
-    176, 138, 46, 232, 97, 8, 61, 9, 235, 67, 0, 115, 193, 229, 248, 233, 68, 96, 13, 246, 238, 17, 132, 8, 107, 82, 92,
-    60, 59, 61, 13, 8, 207, 212, 34, 179, 191, 103, 85, 239, 37, 121, 48, 125, 43, 29, 194, 49, 117, 24, 2, 19, 133,
-    125, 4, 130, 144, 157, 2, 59, 124, 240, 56, 199, 121, 65, 238, 117, 24, 249, 152, 17, 204, 146, 61, 188, 149, 54,
-    44, 124, 210, 156, 119, 201, 120, 171, 94, 249, 227, 46, 179, 247, 85, 190, 195, 191, 55, 169, 105, 135, 80, 160,
-    187, 156, 27, 78, 131, 107, 144, 125, 121, 212, 243, 190, 61, 106, 186, 171, 149, 58, 201, 182, 197, 146, 27, 219,
-    94, 103, 68, 111, 61, 249, 234, 149, 143, 187, 30, 212, 159, 184, 28, 58, 41, 98, 129, 121, 81, 86, 152, 194, 59,
-    18, 209, 235, 234, 22, 157, 108, 154, 105, 146, 95, 193, 32, 15, 33, 85, 152, 250, 77, 42, 240, 181, 135, 61, 219,
-    138, 198, 43, 201, 203, 174, 147, 77, 139, 242, 204, 80, 205, 64, 43, 125, 34, 114, 233, 111, 110, 121, 242, 250,
-    165, 208, 152, 248, 17, 195, 35, 186, 26, 153, 159, 159, 46, 153, 172, 230, 157, 129, 128, 74, 43, 227, 215, 152,
-    235, 199, 78, 130, 107, 143, 213, 57, 122, 68, 112, 7, 144, 79, 81, 222, 244, 44, 46, 198, 70, 25, 180, 227, 63, 69,
-    253, 80, 245, 28, 238, 241, 151, 14, 77, 3, 233, 162, 148, 203, 133, 162, 217, 30, 93, 251, 155, 81, 184, 181, 13,
-    165, 1, 207, 235, 68, 220, 19, 218, 21, 48, 178, 107, 236, 186, 193, 187, 14, 124, 238, 148, 221, 25, 63, 76, 185,
-    137, 253, 5, 186, 15, 22, 91, 147, 171, 15, 117, 148, 94, 178, 51, 155, 180, 181, 237, 173, 245, 146, 155, 64, 68,
-    98, 239, 47, 20, 58, 195, 87, 31, 125, 123, 106, 203, 98, 183, 18, 55, 171, 28, 20, 172, 150, 99, 187, 76, 153, 218,
-    207, 39, 107, 124, 23, 21, 9, 173, 44, 118, 148, 127, 196, 20, 184, 133, 117, 107, 2, 249, 189, 229, 114, 244, 234,
-    219, 24, 195, 37, 87, 151, 35, 140, 207, 207, 218, 89, 203, 47, 74, 115, 248, 142, 15, 9, 196, 112, 35, 131, 238,
-    68, 111, 93, 2, 175, 73, 153, 248, 198, 10, 237, 160, 16, 0, 243, 135, 49, 197, 68, 25, 206, 74, 24, 140, 217, 252,
-    47, 123, 241, 93, 86, 88, 146, 71, 63, 115, 104, 201, 15, 61, 217, 133, 68, 172, 56, 159, 25, 75, 218, 71, 32, 221,
-    96, 61, 32, 20, 8, 7, 24, 253, 195, 16, 75, 80, 137, 55, 10, 219, 149, 52, 50, 109, 255, 11, 247, 198, 55, 234, 30,
-    174, 30, 187, 148, 216, 55, 135, 218, 88, 64, 190, 81, 84, 107, 141, 135, 66, 40, 122, 233, 238, 90, 67, 140, 179,
-    246, 117, 44, 225, 149, 147, 28, 225, 188, 63, 152, 71, 28, 163, 168, 182, 150, 236, 130, 82, 113, 171, 81, 136,
-    111, 222, 234, 187, 127, 105, 249, 79, 42, 8, 54, 28, 8, 7, 162, 176, 12, 158, 145, 209, 254, 236, 201, 93, 128, 69,
-    172, 161, 22, 192, 222, 62, 150, 104, 159, 20, 220, 190, 248, 183, 17, 217, 167, 5, 166, 15, 63, 20, 125, 204, 130,
-    110, 17, 239, 113, 19, 208, 130, 143, 29, 30, 150, 168, 139, 14, 66, 206, 224, 166, 158, 139, 66, 26, 28, 118, 211,
-    246, 162, 63, 20, 8, 132, 62, 6, 45, 168, 80, 32, 113, 190, 117, 249, 54, 38, 91, 47, 204, 51, 3, 32, 169, 215, 141,
-    176, 30, 13, 189, 102, 116, 28, 211, 142, 36, 93, 102, 10, 42, 26, 143, 198, 190, 42, 40, 99, 178, 143, 42, 160,
-    111, 174, 30, 142, 72, 89, 62, 200, 156, 172, 150, 105, 255, 220, 14, 206, 121, 124, 87, 167, 254, 92, 246, 253, 55,
-    100, 247, 182, 52, 141, 184, 175, 205, 138, 105, 189, 195, 188, 136, 79, 20, 191, 234, 152, 153, 108, 145, 13, 205,
-    81, 69, 18, 19, 156, 239, 223, 149, 67, 71, 63, 45, 59, 107, 50, 66, 167, 62, 186, 250, 78, 66, 245, 179, 28, 221,
-    232, 2, 187, 227, 49, 217, 186, 252, 173, 155, 139, 8, 237, 120, 49, 174, 137, 62, 75, 190, 52, 185, 210, 249, 117,
-    111, 101, 182, 86, 222, 154, 254, 192, 210, 116, 111, 92, 113, 142, 88, 172, 51, 1, 72, 101, 2, 70, 186, 50, 225,
-    107, 206, 40, 36, 83, 59, 235, 98, 233, 157, 142, 126, 103, 172, 174, 201, 209, 49, 51, 200, 209, 137, 80, 114, 132,
-    5, 131, 157, 3, 159, 10, 21, 162, 174, 196, 223, 181, 53, 138, 153, 45, 123, 94, 245, 118, 153, 98, 167, 203, 78,
-    115, 7, 195, 139, 220, 8, 39, 71, 25, 161, 246, 107, 77, 228, 75, 71, 148, 191, 0, 179, 180, 84, 197, 244, 21, 185,
-    226, 37, 172, 45, 11, 19, 123, 27, 121, 235, 66, 12, 135, 124, 9, 110, 73, 145, 101, 146, 152, 150, 232, 50, 247,
-    207, 183, 200, 75, 123, 212, 165, 103, 240, 53, 83, 15, 118, 37, 213, 75, 36, 228, 251, 92, 125, 130, 23, 191, 79,
-    145, 255, 34, 11, 98, 92, 64, 94, 159, 63, 189, 34, 3, 176, 210, 192, 252, 242, 178, 176, 118, 56, 147, 151, 26,
-    106, 150, 144, 59, 197, 185, 16, 107, 96, 120, 241, 223, 9, 18, 14, 26, 157, 85, 11, 37, 233, 181, 93, 138, 132, 12,
-    85, 30, 192, 191, 134, 122, 23, 191, 222, 108, 215, 212, 232, 157, 217, 191, 249, 32, 216, 250, 99, 243, 130, 77,
-    171, 16, 60, 53, 160, 73, 36, 132, 15, 65, 2, 96, 181, 223, 207, 87, 9, 229, 5, 49, 231, 107, 103, 36, 255, 69, 214,
-    186, 92, 191, 3, 99, 120, 185, 155, 44, 222, 114, 154, 222, 76, 143, 237, 122, 172, 234, 80, 164, 40, 113, 170, 42,
-    213, 34, 242, 131, 49, 255, 122, 228, 115, 252, 231, 9, 194, 110, 48, 71, 52, 203, 191, 39, 165, 128, 227, 18, 38,
-    229, 143, 165, 192, 184, 227, 207, 225, 102, 219, 14, 79, 240, 0, 245, 10, 135, 11, 194, 150, 57, 185, 59, 77, 112,
-    206, 101, 212, 85, 5, 54, 140, 162, 171, 59, 204, 242, 75, 91, 211, 181, 118, 243, 18, 186, 219, 100, 245, 193, 62,
-    121, 252, 242, 212, 248, 59, 147, 127, 240, 17, 129, 201, 159, 120, 6, 130, 111, 210, 17, 147, 150, 9, 29, 227, 203,
-    56, 253, 141, 84, 219, 94, 169, 242, 99, 252, 235, 136, 9, 247, 213, 175, 234, 114, 185, 209, 175, 87, 210, 231,
-    159, 83, 89, 249, 87, 32, 25, 255, 138, 63, 80, 124, 240, 50, 17, 254, 22, 171, 197, 53, 121, 145, 146, 187, 19,
-    113, 21, 222, 41, 144, 67, 132, 101, 66, 236, 87, 85, 49, 32, 189, 142, 124, 170, 84, 185, 251, 119, 225, 42, 216,
-    47, 80, 109, 230, 1, 110, 105, 133, 100, 164, 43, 175, 28, 177, 149, 56, 245, 42, 111, 227, 111, 251, 86, 191, 195,
-    58, 34, 103, 225, 151, 194, 57, 209, 24, 41, 132, 228, 20, 60, 93, 136, 178, 107, 18, 217, 128, 42, 197, 178, 38,
-    143, 241, 29, 0, 211, 166, 245, 50, 229, 219, 41, 145, 239, 35, 236, 127, 99, 117, 18, 24, 228, 82, 115, 199, 47,
-    34, 124, 234, 44, 121, 217, 113, 14, 154, 185, 128, 5, 116, 91, 208, 148, 75, 17, 46, 1, 34, 252, 8, 152, 99, 96,
-    68, 183, 154, 250, 186, 234, 210, 203, 143, 22, 48, 4, 110, 133, 27, 105, 233, 54, 34, 220, 131, 198, 14, 2, 167,
-    60, 51, 184, 55, 13, 156, 160, 125, 207, 6, 87, 123, 171, 87, 198, 116, 227, 143, 25, 232, 100, 84, 39, 196, 47, 97,
-    20, 200, 107, 6, 212, 226, 181, 229, 42, 213, 161, 174, 29, 158, 132, 217, 174, 93, 97, 37, 72, 50, 251, 92, 45,
-    221, 28, 245, 29, 83, 87, 243, 211, 239, 68, 124, 45, 186, 78, 106, 81, 167, 14, 109, 126, 162, 121, 44, 219, 183,
-    234, 111, 42, 184, 67, 141, 237, 237, 236, 239, 45, 20, 91, 158, 216, 133, 197, 244, 117, 189, 215, 13, 58, 136,
-    157, 253, 215, 193, 102, 193, 75, 155, 25, 103, 25, 210, 42, 100, 145, 83, 25, 213, 69, 183, 150, 77, 248, 166, 169,
-    175, 215, 183, 147, 0, 59, 130, 186, 82, 241, 165, 81, 252, 170, 89, 244, 78, 148, 145, 207, 173, 25, 50, 55, 101,
-    14, 140, 174, 229, 58, 165, 90, 49, 86, 83, 35, 118, 16, 92, 23, 239, 202, 56, 100, 29, 204, 72, 35, 35, 118, 117,
-    36, 113, 33, 22, 80, 198, 88, 6, 117, 202, 94, 94, 55, 113, 180, 51, 75, 195, 164, 63, 203, 149, 161, 236, 227, 234,
-    236, 42, 155, 17, 129, 161, 255, 78, 46, 19, 50, 14, 67, 252, 43, 84, 53, 185, 158, 22, 123, 220, 171, 209, 183,
-    121, 96, 25, 199, 219, 17, 150, 87, 75, 98, 175, 161, 42, 177, 126, 96, 215, 21, 162, 207, 165, 204, 80, 42, 180,
-    65, 62, 250, 215, 101, 197, 81, 254, 9, 23, 223, 37, 77, 65, 201, 17, 243, 188, 235, 217, 41, 52, 161, 111, 94, 101,
-    221, 226, 244, 215, 149, 39, 204, 73, 244, 197, 130, 6, 191, 218, 82, 194, 247, 18, 82, 151, 48, 253, 166, 190, 136,
-    244, 121, 120, 36, 237, 224, 64, 218, 166, 99, 50, 36, 40, 28, 24, 167, 66, 167, 175, 153, 231, 52, 14, 255, 38,
-    231, 99, 254, 218, 154, 23, 71, 108, 195, 129, 208, 61, 109, 50, 224, 74, 22, 47, 89, 48, 216, 36, 190, 227, 115,
-    54, 20, 45, 184, 158, 223, 230, 72, 129, 139, 182, 111, 157, 119, 211, 12, 138, 62, 120, 208, 63, 147, 144, 233, 4,
-    7, 179, 46, 104, 163, 58, 125, 76, 0, 173, 31, 66, 1, 209, 223, 95, 249, 76, 222, 75, 172, 57, 25, 188, 16, 181,
-    107, 16, 13, 85, 211, 165, 126, 188, 229, 57, 11, 15, 86, 25, 57, 193, 119, 107, 129, 208, 38, 132, 127, 26, 126,
-    220, 232, 108, 4, 202, 46, 154, 35, 239, 141, 244, 181, 24, 40, 95, 24, 254, 134, 14, 133, 185, 46, 192, 84, 106,
-    53, 179, 12, 148, 143, 173, 161, 229, 141, 85, 104, 237, 154, 228, 84, 236, 46, 184, 75, 17, 125, 37, 22, 67, 164,
-    77, 227, 117, 238, 61, 235, 146, 28, 15, 86, 212, 139, 143, 59, 152, 3, 88, 120, 46, 31, 138, 58, 134, 158, 62, 51,
-    54, 180, 1, 72, 181, 220, 76, 204, 189, 228, 5, 209, 37, 112, 45, 182, 85, 106, 53, 85, 111, 124, 241, 142, 31, 153,
-    12, 230, 145, 126, 175, 63, 186, 252, 173, 202, 209, 50, 54, 111, 186, 78, 5, 225, 116, 0, 48, 12, 180, 220, 85,
-    132, 82, 238, 13, 85, 75, 9, 225, 92, 35, 32, 226, 74, 105, 44, 49, 158, 3, 56, 99, 239, 68, 190, 129, 32, 121, 212,
-    52, 218, 246, 237, 82, 101, 66, 214, 1, 59, 96, 95, 231, 124, 55, 100, 199, 63, 81, 222, 127, 215, 112, 83, 133,
-    199, 105, 37, 47, 25, 83, 59, 139, 64, 109, 15, 39, 177, 143, 82, 179, 57, 34, 3, 108, 6, 235, 190, 108, 29, 255,
-    147, 66, 108, 233, 245, 130, 63, 89, 9, 212, 183, 41, 37, 209, 143, 53, 69, 112, 61, 182, 28, 70, 99, 28, 43, 140,
-    46, 203, 164, 160, 22, 45, 42, 113, 173, 237, 65, 254, 51, 117, 39, 230, 130, 176, 9, 47, 13, 182, 138, 96, 51, 1,
-    160, 56, 240, 35, 215, 41, 229, 246, 42, 163, 131, 49, 105, 116, 7, 111, 58, 12, 79, 18, 77, 209, 80, 141, 235, 120,
-    114, 42, 134, 250, 209, 128, 164, 101, 71, 239, 238, 75, 80, 49, 92, 22, 172, 246, 146, 39, 208, 126, 120, 4, 12,
-    75, 75, 154, 26, 142, 150, 252, 55, 9, 81, 228, 12, 118, 72, 157, 175, 56, 101, 235, 114, 88, 80, 203, 28, 8, 211,
-    194, 157, 187, 59, 37, 157, 213, 96, 26, 168, 216, 156, 174, 184, 79, 19, 149, 208, 95, 254, 153, 250, 121, 168, 47,
-    19, 14, 3, 210, 128, 245, 28, 171, 129, 64, 249, 0, 83, 23, 160, 4, 139, 138, 150, 219, 181, 69, 3, 173, 156, 213,
-    211, 200, 119, 57, 121, 197, 202, 109, 198, 219, 130, 170, 111, 187, 206, 231, 182, 116, 210, 155, 250, 173, 100,
-    255, 8, 193, 32, 14, 243, 173, 109, 109, 17, 4, 121, 21, 127, 244, 107, 39, 193, 79, 72, 49, 196, 233, 96, 50, 104,
-    131, 87, 203, 150, 61, 12, 8, 127, 200, 121, 125, 9, 97, 218, 156, 196, 127, 186, 44, 189, 144, 144, 183, 241, 126,
-    3, 93, 191, 114, 176, 210, 164, 47, 213, 19, 1, 100, 188, 109, 102, 137, 7, 149, 76, 215, 102, 184, 188, 225, 83,
-    216, 244, 115, 207, 202, 47, 35, 113, 74, 49, 100, 101, 93, 65, 239, 169, 189, 144, 79, 56, 119, 75, 51, 57, 61, 51,
-    4, 112, 37, 223, 37, 5, 138, 64, 189, 131, 32, 246, 91, 206, 197, 199, 242, 183, 107, 88, 158, 158, 128, 253, 147,
-    136, 125, 167, 195, 53, 107, 98, 130, 44, 121, 194, 95, 244, 114, 229, 210, 22, 134, 12, 153, 203, 157, 238, 64,
-    244, 170, 13, 105, 245, 95, 204, 32, 240, 231, 200, 21, 63, 116, 219, 160, 58, 229, 137, 238, 127, 129, 176, 130,
-    229, 206, 109, 161, 88, 47, 77, 37, 110, 117, 222, 15, 116, 43, 79, 55, 141, 36, 11, 171, 46, 87, 69, 132, 95, 195,
-    100, 171, 176, 57, 43, 93, 201, 42, 200, 239, 8, 18, 187, 165, 155, 135, 161, 177, 67, 21, 9, 36, 78, 43, 16, 181,
-    64, 243, 126, 0, 61, 140, 3, 65, 97, 137, 214, 47, 122, 209, 155, 27, 114, 220, 139, 109, 126, 138, 204, 194, 191,
-    167, 85, 173, 198, 17, 125, 113, 219, 7, 6, 193, 158, 169, 118, 154, 232, 59, 209, 250, 122, 200, 98, 219, 62, 170,
-    65, 11, 58, 168, 115, 222, 194, 81, 92, 226, 102, 185, 109, 127, 92, 77, 220, 204, 189, 44, 57, 37, 109, 168, 234,
-    76, 215, 54, 251, 10, 208, 21, 156, 220, 14, 179, 236, 212, 182, 50, 23, 165, 222, 110, 169, 221, 80, 180, 60, 172,
-    92, 255, 66, 252, 126, 237, 51, 72, 164, 118, 57, 255, 56, 18, 119, 228, 77, 31, 91, 225, 102, 113, 77, 187, 44,
-    162, 126, 233, 238, 45, 109, 83, 74, 96, 146, 224, 254, 89, 80, 157, 159, 210, 249, 101, 239, 71, 58, 127, 224, 86,
-    99, 190, 156, 118, 166, 31, 90, 146, 227, 213, 199, 59, 183, 237, 81, 69, 187, 80, 78, 242, 143, 128, 44, 13, 111,
-    133, 127, 161, 1, 166, 0, 51, 55, 98, 54, 38, 151, 159, 105, 185, 90, 152, 196, 143, 12, 8, 99, 7, 92, 160, 30, 253,
-    229, 93, 148, 82, 92, 52, 82, 72, 82, 230, 137, 135, 91, 121, 243, 85, 130, 145, 166, 177, 63, 181, 12, 248, 255,
-    14, 48, 1, 152, 85, 135, 87, 135, 167, 172, 57, 67, 207, 163, 4, 69, 198, 129, 119, 26, 253, 199, 98, 9, 105, 83,
-    36, 161, 212, 171, 93, 193, 105, 145, 159, 250, 240, 198, 72, 146, 162, 17, 144, 105, 16, 195, 205, 187, 135, 119,
-    50, 139, 98, 254, 16, 184, 82, 84, 89, 7, 78, 64, 56, 185, 22, 75, 228, 174, 19, 12, 96, 182, 53, 208, 196, 98, 140,
-    207, 193, 49, 7, 232, 64, 221, 147, 51, 168, 11, 115, 151, 1, 159, 253, 18, 9, 192, 196, 216, 196, 94, 167, 7, 14,
-    179, 44, 51, 124, 193, 233, 239, 205, 67, 202, 153, 178, 241, 167, 202, 77, 14, 22, 46, 37, 165, 163, 234, 162, 64,
-    183, 234, 168, 158, 109, 199, 222, 203, 187, 78, 69, 160, 170, 22, 102, 241, 140, 143, 11, 1, 59, 87, 67, 181, 121,
-    197, 216, 192, 165, 47, 105, 123, 228, 130, 38, 207, 39, 174, 112, 241, 225, 208, 89, 179, 106, 103, 117, 161, 223,
-    153, 208, 164, 239, 253, 14, 180, 26, 20, 164, 73, 111, 140, 237, 145, 117, 216, 63, 237, 157, 250, 141, 251, 93,
-    59, 241, 206, 160, 81, 231, 201, 193, 233, 129, 85, 225, 209, 205, 46, 4, 166, 226, 98, 188, 40, 17, 225, 9, 46, 54,
-    93, 230, 17, 124, 60, 45, 45, 245, 156, 118, 69, 83, 236, 255, 82, 253, 61, 209, 107, 251, 148, 101, 125, 97, 20,
-    89, 13, 23, 90, 240, 251, 105, 93, 200, 234, 219, 76, 33, 158, 49, 174, 226, 0, 192, 182, 90, 19, 213, 99, 153, 192,
-    62, 11, 227, 222, 20, 17, 71, 249, 235, 93, 162, 179, 85, 212, 64, 39, 107, 87, 54, 197, 235, 48, 36, 177, 222, 177,
-    241, 51, 163, 214, 184, 122, 121, 230, 157, 94, 190, 109, 169, 30, 162, 88, 17, 87, 253, 116, 92, 68, 74, 248, 4,
-    237, 140, 179, 119, 216, 42, 96, 50, 68, 46, 209, 32, 41, 102, 119, 223, 194, 162, 99, 32, 37, 82, 224, 89, 230, 37,
-    107, 34, 140, 150, 82, 5, 152, 105, 198, 93, 66, 101, 99, 255, 183, 30, 108, 56, 104, 101, 240, 39, 224, 235, 86, 3,
-    187, 97, 3, 100, 254, 29, 217, 180, 238, 246, 74, 124, 69, 9, 126, 158, 202, 23, 71, 185, 125, 79, 52, 21, 50, 32,
-    205, 118, 238, 45, 94, 28, 155, 90, 48, 150, 190, 113, 223, 23, 155, 227, 131, 41, 174, 242, 7, 189, 38, 8, 170, 43,
-    197, 130, 103, 202, 58, 218, 120, 37, 98, 254, 7, 36, 126, 37, 61, 253, 200, 71, 22, 114, 90, 247, 229, 24, 189, 78,
-    90, 4, 129, 200, 10, 110, 232, 139, 213, 152, 113, 115, 224, 186, 45, 19, 9, 85, 223, 228, 217, 92, 181, 195, 240,
-    50, 179, 30, 235, 150, 60, 232, 67, 108, 78, 78, 211, 138, 44, 73, 11, 50, 172, 165, 110, 212, 65, 50, 68, 67, 193,
-    84, 71, 44, 89, 147, 166, 97, 58, 97, 17, 193, 29, 202, 24, 242, 98, 121, 172, 38, 40, 14, 59, 116, 107, 5, 17, 146,
-    152, 142, 181, 131, 187, 200, 31, 254, 109, 186, 147, 35, 101, 121, 151, 228, 50, 44, 158, 23, 121, 226, 213, 73,
-    28, 47, 128, 173, 6, 232, 214, 178, 144, 17, 216, 195, 253, 176, 129, 101, 226, 254, 45, 161, 14, 59, 209, 81, 63,
-    242, 90, 105, 149, 220, 163, 246, 245, 16, 51, 234, 147, 218, 179, 35, 167, 205, 20, 244, 205, 241, 192, 58, 21,
-    200, 114, 68, 17, 208, 236, 202, 243, 141, 150, 211, 0, 10, 99, 75, 42, 65, 84, 52, 102, 169, 36, 239, 231, 6, 227,
-    133, 145, 105, 125, 196, 133, 79, 124, 40, 6, 61, 230, 248, 29, 229, 83, 200, 74, 7, 106, 187, 165, 108, 179, 136,
-    189, 213, 250, 194, 164, 79, 179, 160, 94, 182, 62, 239, 132, 231, 153, 205, 215, 137, 236, 144, 68, 245, 8, 133,
-    228, 152, 183, 88, 232, 208, 72, 73, 2, 81, 235, 61, 160, 65, 174, 219, 140, 89, 34, 227, 68, 200, 98, 247, 22, 4,
-    223, 46, 61, 55, 244, 50, 213, 138, 223, 35, 106, 65, 128, 77, 169, 167, 243, 78, 147, 189, 101, 71, 150, 66, 143,
-    142, 130, 101, 60, 12, 248, 51, 194, 70, 110, 163, 39, 103, 149, 8, 135, 191, 122, 84, 227, 125, 186, 46, 31, 224,
-    154, 181, 72, 198, 211, 185, 126, 128, 133, 216, 47, 54, 135, 57, 138, 188, 16, 241, 56, 193, 124, 30, 67, 160, 207,
-    159, 75, 188, 13, 129, 249, 79, 114, 130, 125, 16, 100, 222, 253, 97, 102, 214, 137, 100, 68, 96, 204, 72, 214, 188,
-    104, 149, 107, 177, 94, 134, 184, 19, 23, 49, 7, 143, 120, 38, 194, 140, 141, 111, 142, 213, 18, 95, 105, 242, 155,
-    179, 189, 153, 85, 218, 174, 195, 10, 119, 171, 254, 193, 194, 250, 104, 27, 20, 15, 82, 118, 210, 203, 38, 45, 59,
-    153, 13, 5, 153, 153, 130, 234, 87, 198, 114, 41, 47, 179, 31, 203, 59, 54, 254, 201, 48, 214, 26, 48, 189, 118,
-    140, 199, 72, 237, 159, 243, 163, 153, 219, 141, 49, 110, 43, 135, 58, 8, 132, 94, 98, 141, 115, 63, 112, 73, 252,
-    4, 37, 135, 191, 56, 118, 0, 10, 83, 26, 84, 187, 94, 96, 2, 24, 165, 189, 44, 147, 31, 45, 218, 112, 197, 216, 117,
-    199, 211, 239, 212, 204, 214, 18, 22, 113, 95, 18, 2, 77, 241, 6, 221, 233, 215, 47, 233, 73, 90, 19, 136, 8, 32,
-    119, 40, 41, 240, 130, 215, 178, 42, 185, 225, 151, 9, 122, 139, 43, 92, 7, 28, 126, 186, 50, 129, 171, 126, 66,
-    194, 31, 18, 251, 87, 135, 102, 250, 86, 230, 93, 252, 43, 107, 149, 132, 106, 242, 220, 242, 254, 72, 193, 25, 126,
-    190, 67, 35, 52, 61, 147, 143, 68, 168, 218, 23, 194, 88, 222, 105, 3, 242, 34, 247, 121, 175, 146, 253, 219, 211,
-    154, 162, 31, 229, 18, 35, 123, 143, 163, 16, 88, 224, 15, 72, 78, 92, 41, 29, 108, 55, 126, 18, 13, 37, 212, 207,
-    107, 21, 21, 41, 223, 44, 20, 234, 230, 184, 76, 51, 242, 21, 125, 49, 86, 196, 72, 238, 118, 35, 92, 4, 48, 72,
-    181, 15, 107, 249, 48, 65, 36, 28, 38, 35, 109, 38, 79, 86, 23, 95, 51, 102, 192, 88, 38, 233, 186, 79, 41, 6, 112,
-    221, 89, 224, 38, 85, 35, 44, 35, 118, 62, 211, 189, 246, 217, 88, 148, 114, 192, 45, 113, 172, 21, 189, 74, 29,
-    104, 104, 216, 72, 7, 121, 65, 175, 127, 230, 225, 242, 111, 46, 67, 77, 253, 21, 186, 195, 119, 29, 255, 176, 55,
-    133, 145, 180, 106, 187, 237, 215, 168, 51, 5, 110, 106, 193, 166, 5, 139, 213, 130, 197, 84, 220, 188, 121, 74,
-    133, 175, 194, 16, 133, 216, 180, 249, 64, 97, 74, 207, 29, 47, 173, 153, 142, 22, 14, 39, 195, 169, 154, 186, 73,
-    53, 43, 253, 106, 89, 111, 143, 228, 86, 55, 13, 40, 186, 169, 46, 225, 64, 21, 9, 216, 214, 10, 55, 149, 40, 187,
-    109, 56, 116, 122, 108, 187, 148, 102, 192, 53, 249, 15, 41, 114, 129, 106, 235, 208, 37, 217, 184, 128, 75, 76, 94,
-    89, 27, 51, 133, 155, 175, 229, 194, 210, 118, 230, 211, 143, 122, 84, 110, 134, 73, 55, 142, 27, 236, 176, 112, 1,
-    114, 72, 187, 231, 95, 237, 237, 83, 128, 223, 96, 169, 114, 104, 76, 28, 227, 7, 226, 244, 186, 87, 7, 44, 129, 32,
-    238, 163, 172, 175, 233, 191, 200, 202, 115, 10, 180, 171, 27, 139, 72, 223, 211, 41, 160, 128, 41, 107, 77, 58,
-    182, 78, 51, 202, 117, 177, 230, 220, 171, 49, 32, 168, 223, 54, 32, 96, 40, 98, 13, 232, 25, 19, 68, 136, 17, 198,
-    51, 138, 95, 176, 127, 162, 3, 91, 101, 84, 77, 141, 21, 111, 75, 222, 210, 65, 253, 79, 191, 184, 237, 247, 84, 83,
-    179, 202, 148, 19, 73, 24, 224, 77, 204, 118, 200, 125, 44, 222, 66, 134, 54, 17, 196, 1, 231, 11, 97, 133, 233, 32,
-    36, 250, 47, 31, 255, 243, 136, 157, 88, 160, 185, 241, 205, 207, 65, 34, 222, 41, 13, 175, 163, 84, 140, 69, 79,
-    78, 193, 181, 164, 23, 35, 10, 121, 166, 23, 37, 130, 238, 32, 207, 187, 121, 67, 15, 232, 93, 45, 218, 111, 192,
-    75, 146, 54, 152, 237, 59, 238, 203, 30, 234, 186, 65, 10, 59, 96, 133, 15, 119, 219, 173, 134, 149, 141, 31, 190,
-    174, 235, 242, 230, 121, 214, 105, 203, 51, 46, 227, 12, 243, 115, 0, 80, 135, 155, 186, 137, 191, 178, 31, 80, 131,
-    252, 144, 100, 62, 238, 205, 129, 151, 245, 156, 116, 214, 211, 150, 66, 47, 47, 122, 122, 251, 13, 70, 228, 107,
-    163, 154, 243, 49, 250, 224, 134, 91, 165, 103, 83, 200, 75, 188, 38, 160, 45, 74, 58, 18, 98, 135, 157, 198, 83,
-    10, 70, 176, 165, 128, 144, 120, 51, 223, 122, 97, 82, 52, 51, 211, 24, 210, 50, 2, 94, 166, 79, 160, 92, 78, 158,
-    214, 90, 12, 168, 215, 110, 20, 81, 171, 134, 177, 32, 199, 123, 205, 156, 96, 109, 183, 64, 129, 215, 192, 58, 44,
-    120, 5, 29, 92, 208, 113, 247, 252, 228, 111, 225, 34, 66, 169, 135, 213, 106, 30, 50, 45, 177, 132, 206, 121, 87,
-    137, 40, 73, 99, 30, 145, 117, 152, 18, 250, 60, 243, 44, 109, 134, 228, 170, 83, 215, 145, 198, 198, 161, 2, 70,
-    83, 153, 86, 215, 151, 247, 220, 26, 31, 96, 29, 65, 12, 205, 83, 108, 76, 166, 174, 85, 92, 253, 172, 173, 177,
-    204, 131, 187, 244, 117, 231, 109, 137, 255, 237, 50, 96, 236, 187, 128, 119, 186, 249, 21, 182, 224, 94, 71, 105,
-    203, 250, 82, 127, 178, 250, 77, 86, 129, 241, 80, 1, 82, 24, 56, 108, 59, 210, 132, 139, 248, 151, 90, 64, 191,
-    179, 79, 226, 118, 217, 1, 192, 84, 192, 14, 123, 0, 131, 68, 199, 23, 46, 63, 0, 215, 84, 79, 72, 183, 33, 155, 91,
-    29, 77, 24, 34, 22, 168, 92, 117, 173, 132, 225, 213, 120, 42, 218, 139, 132, 8, 19, 210, 168, 248, 239, 39, 147,
-    98, 145, 202, 84, 43, 175, 129, 47, 59, 10, 4, 83, 217, 43, 131, 108, 140, 124, 143, 102, 118, 176, 187, 11, 206, 2,
-    170, 90, 193, 129, 193, 68, 242, 157, 140, 2, 8, 226, 189, 189, 96, 98, 190, 66, 108, 212, 113, 73, 210, 131, 126,
-    107, 20, 138, 31, 234, 150, 134, 217, 14, 193, 22, 35, 104, 55, 240, 86, 190, 230, 79, 57, 60, 70, 53, 47, 37, 241,
-    242, 21, 7, 51, 104, 110, 95, 128, 14, 154, 119, 132, 54, 242, 139, 175, 73, 223, 69, 126, 18, 204, 133, 139, 132,
-    50, 82, 5, 126, 64, 205, 159, 88, 217, 97, 145, 255, 120, 52, 93, 63, 41, 69, 200, 251, 111, 160, 218, 104, 137, 89,
-    19, 35, 24, 254, 28, 44, 76, 139, 91, 52, 207, 96, 122, 161, 170, 104, 228, 157, 8, 243, 63, 221, 59, 144, 17, 134,
-    155, 255, 143, 141, 241, 182, 142, 147, 219, 107, 180, 209, 135, 31, 183, 173, 136, 19, 118, 202, 110, 18, 245, 91,
-    163, 57, 39, 153, 185, 62, 196, 51, 10, 207, 243, 52, 179, 70, 149, 5, 131, 79, 19, 110, 141, 167, 22, 223, 84, 239,
-    192, 194, 231, 6, 10, 214, 50, 173, 56, 152, 46, 247, 183, 244, 223, 54, 15, 215, 199, 53, 120, 57, 246, 72, 52, 84,
-    251, 118, 14, 195, 49, 117, 233, 63, 126, 45, 166, 245, 150, 36, 76, 159, 104, 80, 172, 180, 97, 156, 53, 111, 23,
-    213, 214, 238, 27, 87, 151, 232, 67, 58, 116, 184, 203, 80, 221, 112, 142, 26, 10, 91, 188, 138, 43, 114, 43, 57,
-    72, 12, 121, 29, 70, 180, 46, 97, 100, 92, 27, 141, 164, 85, 136, 35, 87, 36, 93, 106, 104, 110, 247, 167, 118, 210,
-    114, 150, 193, 171, 96, 23, 37, 23, 18, 189, 79, 68, 27, 202, 61, 221, 212, 50, 170, 175, 142, 211, 189, 23, 156,
-    178, 167, 210, 140, 52, 51, 207, 13, 215, 210, 169, 114, 15, 40, 58, 140, 230, 200, 109, 162, 60, 124, 209, 134,
-    255, 108, 73, 43, 162, 154, 181, 36, 91, 208, 146, 255, 30, 134, 222, 213, 23, 90, 103, 72, 0, 227, 2, 100, 100,
-    147, 101, 216, 89, 223, 29, 111, 124, 142, 74, 44, 148, 30, 20, 130, 29, 46, 111, 156, 17, 65, 229, 99, 232, 33, 81,
-    73, 20, 209, 47, 88, 227, 54, 207, 149, 121, 64, 64, 207, 210, 79, 82, 230, 197, 67, 242, 154, 255, 141, 104, 171,
-    131, 249, 140, 26, 21, 131, 151, 189, 69, 158, 202, 198, 183, 191, 49, 43, 82, 189, 152, 209, 201, 165, 73, 195,
-    237, 28, 190, 43, 250, 50, 54, 173, 228, 226, 251, 139, 53, 38, 4, 73, 160, 254, 239, 95, 84, 158, 225, 193, 59,
-    242, 33, 18, 203, 68, 1, 214, 114, 118, 146, 92, 34, 106, 236, 237, 106, 38, 229, 168, 26, 236, 227, 187, 193, 152,
-    119, 192, 129, 189, 220, 245, 153, 131, 11, 228, 72, 97, 14, 39, 209, 92, 204, 6, 139, 92, 132, 50, 125, 201, 128,
-    97, 108, 131, 109, 134, 215, 153, 102, 234, 157, 242, 1, 189, 137, 222, 43, 23, 187, 14, 155, 89, 49, 167, 1, 174,
-    142, 50, 66, 158, 178, 126, 200, 120, 245, 78, 133, 219, 196, 38, 24, 149, 23, 84, 43, 113, 50, 252, 151, 70, 188,
-    223, 121, 204, 80, 125, 113, 213, 4, 95, 100, 12, 123, 203, 53, 50, 149, 221, 199, 173, 115, 88, 105, 107, 134, 94,
-    167, 204, 23, 202, 98, 244, 12, 239, 94, 214, 170, 252, 186, 169, 182, 26, 111, 66, 120, 67, 46, 52, 141, 53, 99,
-    108, 193, 251, 107, 91, 212, 76, 181, 139, 45, 251, 37, 154, 149, 52, 223, 105, 120, 11, 144, 150, 123, 121, 116,
-    179, 72, 164, 23, 130, 26, 235, 220, 170, 234, 95, 72, 82, 154, 139, 191, 132, 69, 156, 83, 243, 184, 39, 155, 17,
-    226, 41, 200, 217, 231, 106, 24, 22, 132, 32, 150, 133, 39, 206, 108, 11, 48, 208, 0, 55, 93, 226, 61, 179, 189,
-    100, 82, 191, 146, 77, 38, 187, 95, 162, 111, 6, 88, 27, 39, 38, 133, 189, 28, 65, 88, 189, 68, 173, 175, 180, 204,
-    238, 150, 130, 171, 207, 153, 167, 79, 218, 178, 212, 195, 153, 99, 14, 99, 59, 222, 237, 117, 222, 243, 182, 138,
-    91, 230, 62, 145, 231, 76, 126, 215, 122, 219, 204, 158, 111, 188, 133, 220, 106, 173, 217, 26, 208, 153, 88, 117,
-    120, 165, 169, 106, 129, 85, 215, 42, 43, 98, 190, 81, 7, 2, 164, 59, 149, 230, 186, 194, 133, 173, 17, 206, 253,
-    249, 233, 26, 118, 112, 187, 217, 129, 133, 48, 57, 164, 120, 153, 184, 120, 69, 81, 115, 124, 61, 181, 178, 203,
-    106, 179, 27, 115, 18, 58, 84, 185, 114, 42, 248, 66, 232, 189, 211, 209, 62, 123, 243, 29, 244, 104, 159, 12, 20,
-    176, 39, 69, 108, 57, 19, 59, 124, 105, 64, 32, 191, 91, 146, 110, 193, 79, 9, 21, 77, 59, 2, 194, 18, 195, 166,
-    230, 203, 196, 224, 176, 229, 1, 101, 148, 30, 242, 124, 141, 68, 209, 98, 186, 118, 16, 217, 146, 60, 139, 15, 98,
-    147, 245, 154, 177, 109, 117, 45, 91, 84, 35, 163, 185, 130, 142, 165, 43, 30, 80, 84, 137, 208, 145, 102, 109, 58,
-    145, 132, 19, 186, 89, 101, 66, 194, 156, 27, 116, 190, 16, 123, 35, 1, 170, 158, 185, 150, 16, 102, 98, 177, 185,
-    232, 89, 86, 67, 86, 52, 53, 112, 1, 78, 250, 80, 195, 208, 37, 168, 160, 225, 189, 67, 148, 209, 23, 63, 177, 162,
-    97, 123, 242, 202, 24, 80, 240, 190, 42, 40, 111, 208, 76, 146, 100, 126, 5, 218, 1, 189, 245, 20, 232, 86, 1, 125,
-    63, 3, 93, 154, 148, 123, 143, 104, 117, 215, 151, 229, 16, 96, 244, 150, 139, 25, 162, 146, 179, 3, 232, 94, 211,
-    201, 142, 15, 245, 39, 85, 73, 105, 86, 193, 196, 79, 124, 16, 166, 90, 226, 127, 18, 197, 224, 35, 22, 117, 76, 22,
-    214, 179, 61, 167, 140, 176, 242, 74, 198, 120, 25, 113, 174, 56, 182, 142, 128, 97, 225, 33, 13, 232, 85, 167, 131,
-    247, 3, 20, 227, 110, 232, 36, 222, 128, 250, 176, 39, 74, 154, 88, 136, 49, 24, 195, 81, 31, 88, 246, 157, 139,
-    222, 168, 47, 58, 184, 97, 31, 212, 186, 170, 113, 232, 219, 168, 85, 217, 49, 215, 84, 165, 26, 204, 123, 236, 0,
-    14, 63, 132, 170, 252, 88, 58, 195, 207, 152, 162, 172, 69, 151, 20, 209, 225, 23, 109, 40, 97, 240, 141, 107, 14,
-    2, 16, 212, 108, 150, 165, 146, 14, 248, 197, 43, 149, 60, 173, 174, 10, 40, 217, 89, 179, 110, 179, 109, 12, 56,
-    86, 69, 119, 30, 214, 166, 54, 154, 207, 1, 214, 42, 179, 199, 62, 97, 8, 236, 89, 244, 119, 189, 151, 157, 226,
-    203, 16, 36, 44, 15, 101, 197, 95, 221, 64, 120, 65, 40, 86, 250, 15, 16, 27, 104, 147, 174, 138, 161, 141, 70, 154,
-    172, 215, 252, 53, 62, 53, 95, 70, 175, 85, 122, 164, 217, 210, 94, 207, 185, 123, 12, 97, 159, 130, 253, 111, 93,
-    166, 64, 58, 2, 27, 7, 136, 241, 121, 119, 79, 201, 13, 156, 128, 50, 25, 142, 160, 115, 234, 220, 1, 30, 164, 113,
-    216, 6, 171, 110, 192, 230, 79, 194, 70, 178, 32, 69, 39, 110, 174, 109, 245, 34, 54, 202, 174, 117, 215, 246, 107,
-    92, 37, 54, 237, 83, 172, 19, 8, 127, 22, 168, 105, 25, 187, 227, 90, 33, 178, 13, 153, 55, 98, 113, 163, 254, 241,
-    131, 160, 114, 233, 144, 239, 167, 220, 56, 102, 247, 102, 118, 255, 141, 160, 1, 210, 1, 78, 95, 12, 85, 80, 79,
-    69, 119, 69, 42, 206, 41, 212, 9, 20, 42, 134, 56, 159, 64, 34, 142, 205, 40, 42, 107, 177, 124, 2, 218, 202, 132,
-    124, 218, 76, 14, 161, 28, 28, 150, 64, 175, 161, 73, 151, 138, 37, 35, 215, 69, 25, 119, 220, 197, 138, 167, 61,
-    251, 59, 65, 29, 50, 33, 205, 8, 29, 142, 125, 119, 72, 242, 66, 30, 184, 247, 135, 244, 245, 50, 194, 242, 230,
-    197, 136, 20, 103, 143, 116, 78, 182, 44, 151, 218, 34, 116, 237, 24, 49, 159, 123, 158, 157, 165, 197, 166, 194,
-    120, 175, 135, 113, 246, 83, 96, 205, 146, 125, 131, 246, 239, 254, 51, 182, 0, 229, 117, 104, 128, 187, 19, 98,
-    164, 114, 141, 125, 139, 20, 46, 151, 240, 145, 97, 221, 227, 186, 24, 120, 38, 130, 48, 56, 122, 117, 144, 30, 225,
-    8, 252, 172, 239, 145, 186, 239, 81, 67, 78, 215, 141, 170, 179, 189, 134, 140, 154, 176, 160, 170, 144, 61, 24, 22,
-    231, 55, 72, 205, 134, 172, 72, 106, 228, 206, 81, 91, 190, 12, 205, 97, 156, 192, 56, 225, 161, 234, 145, 227, 132,
-    204, 90, 239, 73, 140, 251, 251, 45, 0, 171, 121, 191, 24, 41, 98, 180, 168, 224, 5, 19, 34, 186, 137, 73, 52, 71,
-    169, 212, 183, 168, 217, 255, 33, 251, 41, 17, 107, 110, 3, 234, 210, 162, 105, 42, 171, 69, 80, 111, 144, 114, 156,
-    27, 243, 35, 34, 35, 237, 152, 5, 78, 53, 43, 2, 69, 155, 217, 210, 114, 243, 234, 185, 127, 126, 219, 190, 172,
-    194, 167, 244, 161, 239, 6, 0, 143, 118, 121, 45, 182, 49, 206, 241, 94, 143, 167, 185, 49, 227, 136, 221, 170, 169,
-    178, 79, 241, 128, 106, 182, 87, 78, 216, 112, 82, 129, 90, 24, 202, 143, 41, 147, 199, 31, 172, 190, 207, 129, 29,
-    191, 0, 158, 238, 122, 79, 4, 238, 194, 103, 132, 29, 108, 15, 68, 90, 3, 202, 248, 156, 48, 152, 208, 221, 108,
-    123, 131, 195, 71, 229, 175, 140, 51, 228, 231, 29, 136, 238, 64, 103, 245, 33, 248, 198, 23, 151, 186, 192, 222,
-    173, 70, 227, 52, 152, 119, 224, 76, 100, 213, 131, 204, 7, 196, 13, 159, 42, 145, 119, 67, 46, 99, 155, 206, 138,
-    212, 191, 31, 15, 29, 162, 81, 241, 38, 111, 244, 126, 217, 73, 147, 188, 203, 204, 58, 90, 5, 26, 84, 199, 245, 74,
-    196, 79, 141, 106, 202, 235, 158, 159, 233, 178, 176, 76, 32, 92, 93, 126, 66, 181, 60, 70, 197, 169, 76, 76, 81,
-    132, 75, 120, 23, 35, 104, 12, 186, 124, 104, 221, 124, 61, 56, 53, 220, 111, 106, 195, 46, 156, 11, 213, 223, 122,
-    188, 184, 235, 253, 119, 12, 41, 51, 152, 108, 180, 199, 137, 183, 164, 36, 0, 122, 22, 157, 58, 10, 223, 98, 238,
-    247, 242, 75, 35, 132, 146, 228, 121, 83, 99, 73, 131, 17, 19, 161, 34, 204, 180, 148, 34, 52, 215, 45, 233, 93, 66,
-    201, 137, 212, 44, 96, 239, 168, 34, 22, 162, 73, 74, 201, 83, 206, 190, 30, 113, 118, 3, 25, 17, 3, 234, 238, 221,
-    49, 27, 65, 153, 128, 115, 104, 142, 17, 21, 64, 123, 61, 202, 196, 3, 178, 205, 111, 88, 133, 27, 28, 135, 134, 73,
-    215, 135, 14, 8, 49, 99, 25, 163, 147, 231, 44, 185, 221, 117, 19, 101, 73, 40, 48, 85, 220, 237, 14, 231, 152, 128,
-    208, 109, 13, 29, 224, 57, 150, 162, 180, 228, 90, 240, 55, 91, 12, 159, 140, 12, 166, 100, 161, 219, 165, 62, 242,
-    174, 8, 182, 15, 171, 80, 207, 233, 224, 58, 110, 35, 56, 133, 2, 22, 4, 160, 214, 206, 108, 153, 214, 210, 164, 41,
-    100, 181, 10, 230, 20, 219, 59, 193, 112, 220, 217, 89, 99, 219, 52, 207, 61, 186, 120, 101, 21, 57, 141, 238, 183,
-    86, 248, 68, 215, 212, 192, 88, 65, 175, 253, 118, 237, 207, 126, 149, 146, 12, 15, 222, 227, 215, 88, 183, 244,
-    197, 16, 11, 127, 117, 237, 136, 95, 60, 63, 174, 238, 178, 122, 234, 147, 157, 222, 116, 185, 15, 82, 166, 230,
-    139, 135, 54, 188, 71, 218, 165, 207, 12, 246, 145, 251, 85, 204, 170, 155, 140, 210, 165, 248, 249, 235, 74, 7, 16,
-    209, 93, 126, 133, 82, 171, 51, 176, 171, 121, 124, 203, 204, 99, 230, 198, 214, 50, 120, 182, 36, 144, 253, 150,
-    107, 114, 106, 193, 45, 10, 31, 177, 142, 90, 51, 114, 234, 68, 149, 139, 182, 10, 112, 85, 153, 88, 210, 221, 181,
-    117, 214, 8, 244, 220, 86, 201, 248, 226, 74, 64, 55, 203, 252, 188, 142, 247, 137, 234, 181, 210, 106, 188, 60,
-    203, 46, 246, 68, 162, 186, 50, 219, 44, 130, 97, 85, 18, 35, 9, 204, 252, 26, 186, 91, 194, 24, 192, 91, 158, 201,
-    48, 214, 246, 195, 182, 183, 202, 251, 182, 174, 174, 18, 57, 70, 235, 164, 30, 172, 30, 87, 190, 188, 173, 63, 48,
-    169, 192, 78, 53, 204, 50, 248, 188, 128, 88, 24, 26, 33, 74, 231, 73, 26, 167, 27, 2, 80, 140, 102, 160, 7, 191,
-    83, 83, 6, 192, 124, 24, 243, 4, 146, 165, 199, 23, 91, 247, 14, 11, 98, 9, 171, 52, 187, 27, 151, 5, 61, 254, 252,
-    248, 206, 13, 31, 180, 114, 90, 120, 65, 29, 161, 83, 135, 179, 88, 58, 193, 194, 111, 81, 168, 205, 52, 131, 48,
-    194, 31, 139, 244, 51, 57, 15, 89, 133, 127, 242, 226, 5, 245, 9, 185, 36, 159, 53, 251, 19, 67, 170, 206, 187, 135,
-    252, 126, 91, 213, 55, 153, 126, 63, 3, 89, 147, 0, 132, 255, 120, 158, 141, 251, 184, 69, 60, 8, 105, 114, 209, 99,
-    124, 125, 113, 153, 10, 231, 183, 103, 59, 251, 178, 216, 167, 245, 204, 58, 140, 55, 244, 221, 38, 222, 248, 65,
-    192, 88, 202, 78, 217, 53, 158, 112, 221, 232, 50, 19, 137, 80, 21, 34, 229, 80, 143, 17, 114, 9, 145, 226, 156, 50,
-    219, 173, 117, 142, 48, 0, 138, 121, 243, 138, 89, 175, 126, 44, 9, 233, 204, 61, 81, 189, 127, 254, 68, 23, 5, 41,
-    20, 101, 158, 81, 162, 137, 187, 239, 201, 96, 50, 138, 9, 54, 96, 47, 55, 98, 250, 158, 43, 246, 228, 9, 190, 60,
-    231, 93, 234, 26, 80, 17, 13, 155, 188, 149, 206, 181, 116, 191, 223, 153, 60, 14, 52, 4, 214, 12, 169, 50, 254,
-    117, 30, 200, 2, 236, 136, 176, 192, 41, 224, 112, 221, 81, 204, 153, 66, 46, 223, 101, 154, 110, 140, 159, 65, 81,
-    171, 202, 51, 222, 29, 216, 189, 95, 111, 166, 121, 135, 126, 228, 44, 46, 111, 157, 134, 249, 222, 62, 205, 245,
-    213, 226, 202, 107, 227, 70, 195, 5, 57, 8, 18, 223, 31, 207, 185, 116, 17, 241, 71, 172, 54, 83, 27, 182, 166, 17,
-    21, 165, 147, 104, 142, 46, 71, 167, 23, 255, 8, 106, 89, 57, 180, 218, 126, 12, 30, 59, 109, 229, 116, 154, 93,
-    163, 227, 217, 18, 131, 78, 153, 102, 93, 158, 163, 103, 129, 57, 198, 18, 0, 185, 30, 147, 60, 92, 158, 111, 166,
-    32, 203, 120, 41, 231, 190, 18, 110, 126, 195, 115, 226, 216, 255, 89, 244, 81, 125, 177, 143, 202, 54, 229, 97,
-    152, 150, 173, 90, 19, 207, 76, 144, 44, 238, 46, 1, 194, 223, 134, 127, 57, 61, 186, 45, 35, 6, 64, 156, 201, 12,
-    160, 202, 153, 29, 99, 164, 134, 192, 45, 135, 21, 255, 141, 80, 33, 244, 17, 136, 37, 111, 84, 155, 72, 84, 255,
-    241, 192, 171, 252, 181, 229, 121, 170, 246, 26, 199, 101, 234, 200, 62, 16, 91, 67, 179, 57, 68, 176, 140, 36, 192,
-    88, 49, 71, 115, 80, 188, 241, 143, 128, 79, 29, 176, 45, 210, 73, 104, 90, 91, 82, 135, 87, 221, 13, 194, 103, 10,
-    42, 254, 255, 142, 219, 234, 149, 11, 144, 19, 58, 90, 79, 252, 78, 145, 215, 102, 92, 130, 162, 86, 185, 92, 106,
-    239, 116, 134, 16, 168, 244, 77, 184, 227, 95, 252, 213, 239, 248, 174, 63, 149, 240, 26, 179, 36, 165, 89, 110,
-    234, 136, 130, 218, 201, 5, 181, 141, 157, 182, 239, 102, 139, 208, 72, 137, 66, 106, 32, 201, 95, 87, 229, 207,
-    115, 166, 244, 40, 186, 147, 156, 201, 61, 20, 160, 221, 88, 1, 226, 217, 199, 31, 104, 114, 254, 45, 96, 210, 34,
-    117, 117, 28, 32, 42, 111, 205, 143, 66, 93, 176, 166, 65, 203, 20, 177, 198, 250, 150, 191, 56, 40, 228, 179, 157,
-    212, 84, 173, 214, 43, 183, 89, 199, 115, 113, 78, 56, 69, 181, 130, 244, 211, 72, 121, 188, 148, 72, 65, 61, 4,
-    167, 194, 208, 179, 55, 200, 159, 247, 53, 87, 62, 39, 27, 37, 11, 36, 90, 50, 123, 19, 161, 239, 222, 74, 106, 122,
-    112, 136, 205, 175, 145, 142, 102, 51, 23, 1, 99, 81, 122, 5, 179, 166, 161, 127, 74, 234, 61, 229, 70, 23, 125,
-    234, 250, 94, 232, 62, 130, 147, 132, 154, 78, 156, 175, 211, 176, 238, 103, 104, 203, 18, 32, 127, 227, 47, 197,
-    202, 196, 221, 214, 183, 67, 60, 57, 184, 211, 50, 4, 141, 46, 117, 56, 137, 211, 6, 188, 231, 114, 68, 116, 82,
-    171, 153, 10, 77, 32, 28, 22, 38, 220, 87, 152, 167, 229, 134, 63, 165, 242, 99, 42, 215, 40, 245, 178, 28, 63, 41,
-    102, 174, 83, 87, 209, 78, 214, 142, 116, 170, 3, 98, 222, 162, 241, 2, 174, 63, 127, 17, 135, 92, 219, 68, 117,
-    231, 157, 254, 63, 253, 241, 246, 32, 3, 110, 67, 1, 157, 72, 224, 92, 99, 168, 177, 158, 32, 233, 156, 48, 129, 7,
-    162, 181, 188, 14, 159, 215, 237, 47, 71, 122, 244, 10, 134, 44, 32, 25, 142, 82, 62, 176, 167, 93, 94, 48, 232,
-    118, 76, 163, 0, 183, 195, 148, 151, 10, 1, 226, 143, 225, 208, 54, 32, 81, 90, 128, 202, 189, 122, 253, 46, 139,
-    208, 217, 98, 43, 135, 107, 108, 49, 87, 211, 128, 104, 52, 108, 235, 67, 201, 147, 72, 99, 55, 225, 42, 103, 62,
-    88, 67, 202, 87, 130, 64, 210, 14, 213, 147, 223, 85, 183, 217, 83, 181, 211, 227, 197, 46, 199, 173, 242, 40, 136,
-    43, 124, 197, 66, 125, 44, 240, 58, 239, 219, 188, 25, 84, 104, 231, 232, 10, 199, 110, 158, 220, 181, 138, 26, 39,
-    183, 79, 210, 118, 115, 43, 66, 240, 117, 217, 84, 114, 70, 50, 221, 195, 192, 188, 141, 243, 226, 223, 115, 60,
-    131, 210, 52, 232, 185, 69, 141, 130, 45, 105, 169, 181, 149, 90, 110, 140, 142, 171, 32, 57, 24, 123, 44, 195, 117,
-    109, 76, 162, 189, 11, 243, 153, 249, 154, 50, 59, 225, 121, 22, 116, 216, 36, 131, 20, 69, 244, 80, 239, 95, 162,
-    12, 26, 221, 59, 155, 157, 169, 248, 195, 55, 79, 107, 149, 132, 213, 218, 200, 183, 31, 35, 37, 254, 40, 85, 118,
-    250, 33, 83, 147, 217, 30, 253, 246, 110, 39, 91, 188, 250, 222, 123, 56, 47, 124, 182, 31, 201, 81, 117, 242, 150,
-    172, 170, 171, 59, 148, 137, 52, 197, 63, 214, 147, 6, 55, 192, 212, 201, 71, 226, 115, 65, 118, 43, 229, 253, 108,
-    198, 166, 102, 12, 105, 173, 203, 84, 147, 254, 219, 172, 148, 137, 52, 14, 137, 39, 168, 178, 26, 105, 148, 28, 52,
-    23, 4, 47, 130, 19, 97, 82, 198, 59, 218, 243, 120, 14, 202, 58, 196, 169, 171, 38, 189, 95, 166, 46, 143, 51, 49,
-    180, 125, 21, 234, 215, 146, 107, 106, 177, 246, 132, 123, 1, 88, 165, 185, 107, 21, 179, 239, 47, 98, 21, 202, 229,
-    11, 56, 64, 16, 11, 169, 182, 134, 116, 207, 63, 70, 223, 29, 185, 181, 176, 34, 138, 128, 218, 249, 71, 46, 162,
-    48, 28, 215, 145, 96, 185, 133, 153, 177, 122, 132, 140, 125, 172, 20, 197, 204, 43, 220, 122, 142, 71, 34, 62, 42,
-    102, 137, 91, 236, 248, 196, 25, 228, 71, 129, 200, 18, 204, 136, 180, 188, 103, 64, 183, 232, 157, 119, 152, 47,
-    130, 248, 222, 16, 36, 119, 254, 22, 232, 0, 35, 146, 53, 66, 19, 22, 13, 187, 255, 188, 115, 148, 68, 168, 22, 87,
-    175, 31, 229, 142, 15, 138, 99, 87, 44, 30, 182, 205, 250, 121, 46, 194, 45, 126, 218, 97, 62, 124, 108, 84, 90,
-    218, 126, 189, 19, 137, 104, 95, 120, 202, 134, 81, 145, 137, 9, 156, 219, 121, 102, 65, 177, 0, 123, 98, 227, 228,
-    132, 26, 165, 167, 136, 158, 21, 200, 7, 137, 162, 216, 122, 127, 30, 205, 196, 238, 132, 238, 221, 42, 5, 174, 137,
-    188, 95, 153, 23, 39, 203, 242, 70, 131, 5, 8, 56, 47, 194, 195, 182, 14, 197, 157, 56, 137, 81, 235, 60, 202, 45,
-    152, 145, 177, 208, 68, 85, 98, 222, 78, 234, 199, 159, 154, 175, 160, 19, 200, 47, 2, 135, 101, 80, 83, 232, 98,
-    35, 72, 61, 104, 16, 66, 210, 147, 222, 9, 227, 28, 120, 240, 41, 10, 235, 48, 225, 228, 114, 90, 50, 176, 73, 229,
-    70, 118, 163, 242, 14, 43, 61, 37, 4, 175, 164, 91, 89, 71, 24, 56, 26, 126, 91, 212, 49, 183, 48, 41, 112, 238, 75,
-    117, 130, 66, 108, 66, 83, 43, 187, 217, 10, 99, 94, 51, 13, 252, 123, 151, 152, 65, 201, 74, 19, 199, 140, 228, 84,
-    11, 196, 99, 85, 84, 234, 247, 104, 106, 245, 230, 181, 254, 47, 9, 119, 71, 159, 67, 180, 38, 154, 168, 96, 107,
-    131, 120, 176, 35, 63, 206, 132, 200, 46, 199, 98, 160, 143, 215, 180, 216, 198, 147, 90, 253, 140, 228, 53, 124,
-    93, 149, 57, 217, 209, 225, 23, 85, 120, 86, 87, 143, 171, 53, 222, 16, 96, 159, 163, 25, 143, 94, 131, 233, 85,
-    134, 200, 254, 158, 58, 149, 185, 89, 174, 108, 197, 47, 244, 62, 197, 156, 43, 143, 226, 192, 181, 240, 80, 123,
-    153, 136, 92, 219, 211, 189, 155, 53, 149, 145, 241, 148, 212, 219, 34, 156, 231, 118, 99, 132, 28, 34, 12, 104,
-    198, 145, 237, 61, 110, 8, 60, 33, 32, 159, 92, 136, 173, 138, 144, 72, 103, 24, 75, 243, 40, 201, 127, 140, 61,
-    151, 193, 78, 251, 81, 83, 124, 112, 27, 76, 186, 225, 175, 250, 167, 98, 251, 128, 194, 91, 158, 187, 208, 248, 44,
-    15, 111, 101, 240, 242, 19, 83, 101, 48, 134, 209, 147, 47, 100, 100, 208, 11, 244, 95, 9, 137, 177, 36, 22, 89,
-    224, 144, 190, 31, 32, 149, 140, 218, 182, 31, 121, 212, 240, 171, 216, 122, 84, 139, 246, 202, 118, 164, 80, 128,
-    207, 203, 139, 199, 36, 141, 137, 140, 188, 78, 179, 246, 116, 204, 207, 66, 144, 177, 228, 107, 186, 191, 23, 170,
-    101, 19, 117, 0, 176, 213, 84, 140, 108, 25, 92, 13, 77, 150, 233, 225, 225, 215, 91, 14, 49, 14, 243, 67, 108, 181,
-    140, 239, 75, 74, 27, 114, 146, 62, 172, 103, 63, 53, 6, 99, 15, 70, 114, 27, 109, 179, 126, 110, 170, 166, 22, 212,
-    145, 17, 221, 44, 40, 85, 161, 199, 127, 37, 104, 71, 131, 242, 133, 41, 137, 82, 220, 22, 38, 102, 203, 53, 50, 92,
-    230, 67, 150, 205, 103, 206, 10, 148, 79, 76, 200, 205, 153, 253, 124, 212, 27, 22, 121, 135, 169, 203, 208, 88,
-    153, 87, 87, 233, 1, 237, 61, 138, 33, 139, 188, 184, 168, 184, 25, 141, 175, 87, 226, 69, 101, 104, 212, 176, 236,
-    3, 165, 150, 8, 114, 19, 250, 120, 33, 138, 196, 6, 198, 84, 205, 32, 36, 35, 174, 199, 238, 93, 85, 228, 172, 137,
-    204, 173, 248, 5, 179, 197, 63, 196, 101, 208, 1, 1, 216, 252, 63, 86, 120, 236, 84, 176, 138, 172, 148, 231, 53,
-    15, 197, 201, 103, 138, 140, 94, 57, 18, 29, 227, 51, 212, 12, 226, 71, 236, 147, 166, 125, 223, 27, 211, 40, 230,
-    125, 139, 235, 215, 78, 131, 249, 214, 19, 63, 54, 150, 26, 183, 116, 186, 13, 162, 82, 176, 249, 51, 97, 149, 100,
-    214, 193, 207, 228, 2, 239, 91, 91, 230, 24, 151, 22, 89, 52, 65, 87, 95, 241, 248, 216, 178, 210, 211, 75, 241,
-    239, 192, 253, 226, 76, 84, 14, 72, 42, 78, 123, 201, 201, 248, 97, 103, 181, 184, 50, 207, 252, 209, 202, 35, 98,
-    134, 220, 3, 213, 45, 37, 124, 126, 77, 76, 170, 80, 167, 183, 173, 205, 108, 221, 192, 94, 31, 196, 191, 105, 67,
-    221, 172, 84, 106, 253, 110, 38, 47, 91, 234, 77, 84, 97, 127, 102, 4, 187, 224, 42, 127, 199, 203, 56, 254, 141,
-    158, 49, 250, 227, 44, 118, 194, 204, 139, 116, 107, 226, 237, 24, 31, 200, 79, 166, 135, 137, 240, 71, 120, 95, 93,
-    192, 87, 74, 90, 43, 143, 137, 230, 129, 192, 25, 80, 198, 22, 93, 219, 18, 71, 134, 91, 42, 216, 110, 37, 102, 63,
-    178, 155, 225, 49, 203, 155, 0, 151, 254, 197, 18, 7, 29, 161, 99, 238, 218, 43, 27, 148, 72, 151, 123, 206, 130,
-    251, 162, 133, 19, 37, 167, 162, 112, 26, 38, 135, 139, 183, 63, 56, 111, 253, 74, 169, 210, 44, 196, 94, 152, 226,
-    208, 153, 34, 188, 55, 110, 196, 146, 242, 168, 127, 58, 204, 76, 36, 83, 151, 178, 81, 135, 145, 231, 113, 6, 167,
-    176, 157, 37, 101, 192, 134, 140, 240, 183, 61, 28, 62, 216, 6, 116, 219, 130, 228, 105, 11, 150, 116, 180, 79, 30,
-    214, 174, 93, 171, 218, 106, 110, 164, 57, 40, 151, 66, 180, 9, 140, 0, 73, 165, 169, 235, 133, 206, 254, 140, 53,
-    58, 154, 161, 31, 244, 95, 72, 240, 79, 107, 245, 223, 173, 29, 140, 47, 222, 108, 36, 240, 95, 242, 223, 159, 126,
-    40, 175, 120, 137, 123, 76, 132, 31, 8, 249, 220, 242, 155, 56, 236, 251, 226, 169, 53, 73, 172, 79, 108, 196, 106,
-    144, 15, 209, 227, 39, 108, 31, 179, 8, 8, 118, 237, 165, 56, 238, 242, 72, 46, 239, 93, 90, 178, 111, 228, 225,
-    220, 57, 229, 242, 61, 195, 42, 138, 25, 226, 166, 138, 11, 164, 142, 69, 77, 55, 62, 236, 190, 199, 138, 178, 181,
-    101, 240, 32, 224, 102, 217, 104, 224, 92, 146, 194, 223, 239, 188, 65, 136, 99, 81, 21, 17, 222, 87, 143, 95, 162,
-    119, 54, 32, 57, 250, 91, 101, 141, 57, 144, 101, 71, 203, 141, 242, 35, 252, 142, 194, 188, 181, 179, 149, 250,
-    248, 38, 137, 32, 64, 192, 22, 130, 193, 183, 125, 168, 18, 72, 248, 45, 255, 249, 3, 250, 80, 174, 171, 230, 52,
-    187, 59, 150, 80, 109, 110, 22, 196, 225, 120, 218, 54, 63, 108, 3, 88, 38, 105, 187, 254, 114, 40, 252, 209, 68,
-    24, 245, 14, 68, 129, 116, 11, 208, 154, 211, 106, 147, 147, 187, 5, 203, 147, 27, 36, 121, 138, 131, 44, 167, 199,
-    196, 48, 95, 90, 89, 179, 162, 223, 28, 150, 79, 28, 245, 138, 108, 168, 216, 255, 71, 119, 37, 234, 38, 177, 187,
-    194, 127, 155, 138, 136, 211, 86, 106, 38, 1, 99, 14, 162, 173, 239, 32, 166, 140, 179, 222, 122, 145, 78, 181, 151,
-    94, 41, 119, 240, 211, 43, 228, 48, 156, 171, 177, 239, 182, 113, 99, 212, 183, 209, 170, 223, 226, 47, 97, 237,
-    201, 231, 86, 169, 23, 246, 85, 154, 136, 95, 16, 79, 122, 73, 217, 149, 166, 130, 189, 133, 117, 58, 52, 72, 124,
-    23, 67, 179, 56, 131, 91, 38, 249, 234, 8, 212, 69, 164, 191, 175, 66, 29, 36, 217, 7, 170, 167, 162, 3, 34, 144,
-    32, 92, 188, 198, 207, 148, 135, 173, 80, 195, 208, 250, 99, 253, 49, 69, 96, 228, 119, 90, 115, 248, 107, 129, 13,
-    124, 20, 54, 9, 91, 0, 89, 20, 136, 45, 84, 225, 119, 192, 223, 176, 231, 140, 231, 6, 53, 93, 11, 140, 195, 34, 99,
-    90, 136, 96, 92, 97, 38, 112, 212, 218, 198, 165, 112, 28, 34, 23, 86, 221, 42, 73, 109, 16, 145, 235, 214, 210, 32,
-    167, 163, 219, 164, 46, 42, 23, 135, 149, 3, 207, 208, 80, 172, 43, 53, 184, 46, 227, 83, 206, 197, 168, 39, 204,
-    30, 92, 128, 165, 176, 64, 113, 231, 143, 1, 132, 7, 86, 83, 191, 222, 1, 238, 81, 90, 233, 99, 209, 234, 109, 221,
-    126, 142, 195, 228, 217, 245, 38, 128, 169, 25, 111, 71, 172, 173, 44, 25, 134, 6, 172, 161, 17, 212, 178, 1, 226,
-    113, 230, 56, 253, 143, 146, 96, 116, 91, 115, 24, 228, 138, 102, 195, 109, 132, 2, 237, 153, 77, 94, 95, 129, 7,
-    185, 176, 33, 57, 173, 160, 142, 249, 103, 179, 252, 199, 89, 191, 208, 126, 44, 24, 25, 222, 104, 94, 43, 224, 80,
-    130, 124, 174, 68, 202, 167, 179, 2, 61, 83, 11, 188, 218, 138, 80, 122, 93, 94, 137, 184, 175, 186, 147, 115, 58,
-    69, 250, 253, 174, 146, 3, 128, 94, 213, 25, 223, 237, 75, 53, 1, 168, 197, 144, 217, 34, 143, 86, 44, 89, 216, 103,
-    2, 30, 230, 100, 100, 41, 39, 114, 96, 197, 119, 91, 111, 136, 86, 157, 220, 53, 113, 53, 9, 242, 137, 209, 100, 19,
-    209, 187, 50, 215, 192, 93, 74, 205, 52, 157, 52, 38, 183, 165, 86, 107, 171, 125, 220, 108, 163, 162, 13, 73, 6,
-    37, 221, 232, 72, 196, 13, 36, 86, 42, 133, 4, 20, 143, 240, 134, 103, 129, 159, 0, 14, 171, 65, 221, 131, 112, 27,
-    114, 137, 41, 93, 200, 213, 115, 213, 129, 247, 160, 188, 116, 2, 89, 218, 114, 202, 130, 190, 23, 83, 109, 72, 186,
-    118, 6, 59, 107, 73, 101, 236, 144, 198, 147, 187, 93, 167, 209, 64, 179, 100, 181, 79, 183, 146, 187, 211, 193,
-    218, 168, 204, 146, 224, 92, 178, 31, 36, 156, 0, 124, 192, 70, 35, 145, 184, 114, 176, 113, 7, 154, 28, 51, 76, 77,
-    17, 130, 65, 158, 166, 210, 231, 72, 136, 86, 177, 27, 11, 177, 40, 227, 116, 101, 16, 49, 165, 167, 40, 117, 73,
-    217, 34, 188, 222, 26, 185, 90, 213, 80, 15, 111, 233, 216, 132, 251, 237, 53, 200, 72, 223, 188, 198, 7, 185, 114,
-    10, 199, 174, 140, 140, 160, 103, 87, 175, 102, 165, 147, 119, 229, 241, 81, 11, 62, 189, 193, 207, 161, 180, 120,
-    224, 163, 191, 243, 107, 14, 83, 99, 129, 82, 141, 116, 129, 233, 235, 31, 76, 43, 177, 201, 41, 91, 135, 190, 193,
-    67, 53, 179, 82, 125, 188, 52, 210, 180, 78, 182, 235, 32, 45, 184, 71, 48, 111, 249, 232, 214, 8, 251, 155, 107,
-    71, 114, 117, 176, 22, 215, 89, 221, 124, 65, 111, 96, 86, 102, 88, 8, 65, 246, 178, 255, 113, 15, 115, 159, 162,
-    27, 88, 57, 179, 232, 128, 104, 155, 227, 57, 91, 159, 16, 49, 32, 232, 80, 19, 149, 94, 205, 153, 153, 19, 163,
-    235, 203, 96, 194, 24, 194, 189, 181, 200, 109, 178, 161, 174, 247, 110, 144, 173, 163, 223, 202, 154, 252, 177,
-    228, 215, 162, 60, 210, 149, 238, 194, 146, 78, 160, 9, 39, 151, 231, 151, 197, 192, 69, 255, 126, 220, 33, 13, 25,
-    78, 86, 172, 212, 241, 211, 176, 99, 3, 51, 20, 59, 81, 146, 249, 233, 108, 60, 9, 202, 116, 106, 149, 113, 153, 10,
-    140, 222, 136, 255, 144, 45, 159, 164, 34, 194, 37, 108, 28, 30, 232, 173, 251, 37, 157, 10, 7, 116, 0, 142, 62,
-    231, 181, 100, 220, 192, 52, 190, 142, 120, 243, 127, 115, 16, 0, 99, 10, 137, 94, 20, 110, 103, 127, 79, 239, 247,
-    213, 183, 123, 245, 12, 38, 60, 190, 7, 53, 73, 210, 155, 23, 94, 106, 250, 190, 184, 241, 176, 94, 99, 141, 97,
-    195, 92, 82, 162, 180, 215, 132, 59, 223, 54, 117, 13, 63, 0, 94, 90, 115, 237, 100, 126, 103, 99, 30, 232, 27, 75,
-    97, 21, 176, 181, 240, 27, 31, 105, 33, 23, 46, 122, 51, 193, 164, 234, 74, 224, 101, 164, 84, 214, 254, 22, 84,
-    114, 252, 112, 155, 202, 102, 128, 44, 193, 92, 60, 116, 248, 147, 85, 139, 241, 85, 18, 58, 110, 245, 158, 171,
-    207, 181, 22, 50, 212, 207, 220, 1, 116, 242, 5, 45, 79, 220, 162, 181, 45, 41, 11, 7, 93, 165, 225, 57, 6, 161, 58,
-    181, 27, 251, 254, 247, 210, 124, 229, 67, 54, 190, 120, 90, 195, 53, 92, 165, 37, 90, 2, 93, 239, 31, 179, 194,
-    185, 239, 191, 17, 48, 144, 51, 120, 18, 11, 47, 117, 160, 32, 220, 10, 223, 183, 44, 181, 51, 124, 22, 203, 77,
-    217, 140, 183, 91, 239, 117, 15, 4, 97, 105, 72, 125, 240, 39, 136, 42, 1, 152, 194, 35, 207, 46, 223, 16, 59, 111,
-    68, 100, 5, 27, 95, 75, 184, 51, 156, 236, 24, 173, 40, 184, 230, 239, 6, 253, 19, 45, 66, 23, 147, 24, 214, 25, 25,
-    49, 54, 251, 187, 57, 142, 49, 85, 251, 102, 1, 136, 103, 43, 64, 120, 7, 138, 123, 181, 183, 146, 128, 134, 144,
-    52, 246, 139, 220, 240, 19, 189, 89, 174, 66, 227, 175, 9, 108, 180, 185, 139, 230, 234, 67, 60, 194, 26, 2, 252, 8,
-    84, 139, 144, 152, 164, 29, 143, 45, 67, 208, 214, 229, 50, 154, 206, 116, 18, 219, 82, 206, 248, 91, 248, 255, 32,
-    30, 225, 48, 229, 46, 169, 111, 214, 7, 255, 201, 122, 134, 84, 198, 236, 40, 100, 239, 78, 250, 178, 116, 18, 32,
-    92, 83, 198, 123, 60, 1, 208, 148, 108, 13, 150, 142, 29, 176, 179, 41, 112, 165, 120, 132, 105, 72, 106, 142, 81,
-    66, 27, 94, 53, 231, 153, 77, 189, 176, 117, 246, 125, 80, 252, 172, 115, 124, 171, 144, 86, 21, 84, 183, 166, 198,
-    35, 211, 120, 142, 27, 250, 38, 230, 195, 36, 138, 86, 209, 143, 77, 10, 117, 17, 29, 117, 31, 239, 70, 151, 218, 1,
-    74, 2, 208, 248, 204, 121, 30, 29, 139, 88, 107, 19, 179, 16, 49, 123, 249, 164, 250, 178, 111, 28, 17, 102, 44,
-    123, 102, 94, 22, 142, 84, 48, 17, 78, 181, 98, 130, 44, 27, 133, 135, 172, 182, 9, 147, 165, 169, 68, 160, 183,
-    178, 174, 255, 131, 238, 78, 22, 91, 5, 191, 161, 114, 165, 206, 125, 120, 167, 235, 117, 103, 255, 37, 185, 104,
-    93, 205, 186, 18, 56, 227, 172, 88, 105, 170, 238, 45, 99, 237, 245, 138, 227, 175, 50, 53, 10, 50, 43, 235, 15,
-    131, 241, 179, 234, 92, 60, 189, 19, 239, 190, 28, 112, 116, 127, 143, 139, 90, 116, 128, 140, 136, 7, 148, 34, 149,
-    189, 1, 214, 91, 147, 188, 71, 248, 197, 57, 138, 78, 80, 128, 23, 92, 32, 128, 95, 18, 67, 199, 251, 61, 95, 133,
-    147, 105, 89, 119, 140, 44, 99, 186, 249, 164, 7, 195, 51, 77, 81, 212, 208, 190, 129, 56, 10, 141, 69, 75, 216,
-    137, 102, 202, 1, 253, 88, 78, 187, 214, 73, 202, 62, 93, 192, 64, 242, 104, 48, 231, 118, 237, 168, 12, 247, 150,
-    84, 19, 70, 100, 128, 157, 34, 215, 118, 41, 249, 146, 155, 100, 63, 223, 5, 229, 169, 55, 177, 62, 145, 99, 220,
-    94, 254, 241, 200, 62, 154, 171, 31, 50, 250, 59, 206, 240, 96, 101, 45, 252, 39, 34, 138, 32, 7, 144, 38, 16, 55,
-    125, 181, 37, 16, 144, 43, 94, 214, 158, 156, 64, 125, 193, 26, 11, 14, 211, 233, 170, 225, 218, 2, 101, 52, 52, 24,
-    49, 241, 77, 224, 73, 150, 150, 34, 49, 79, 146, 207, 105, 46, 59, 157, 151, 9, 140, 236, 180, 205, 107, 80, 112,
-    26, 131, 248, 151, 53, 181, 218, 78, 137, 56, 59, 174, 3, 106, 204, 119, 102, 238, 218, 252, 30, 159, 252, 163, 24,
-    80, 145, 60, 145, 28, 4, 173, 251, 9, 68, 97, 188, 190, 27, 67, 78, 228, 239, 52, 136, 219, 115, 36, 78, 162, 99,
-    167, 90, 94, 107, 80, 108, 95, 174, 2, 241, 115, 60, 31, 76, 196, 142, 47, 35, 238, 61, 129, 105, 42, 132, 4, 225,
-    200, 10, 198, 104, 139, 56, 182, 100, 171, 138, 190, 135, 45, 79, 80, 65, 165, 213, 221, 99, 39, 160, 69, 39, 46,
-    60, 150, 190, 74, 68, 36, 21, 40, 44, 177, 14, 249, 213, 142, 255, 197, 221, 162, 83, 238, 239, 118, 73, 115, 187,
-    209, 43, 50, 15, 221, 11, 77, 153, 84, 88, 93, 96, 61, 23, 31, 107, 96, 104, 14, 228, 239, 46, 8, 116, 146, 212, 6,
-    40, 130, 199, 194, 195, 66, 30, 103, 203, 215, 34, 237, 97, 106, 136, 18, 204, 176, 95, 4, 60, 61, 16, 69, 73, 227,
-    33, 90, 36, 10, 182, 238, 165, 248, 190, 125, 225, 148, 130, 53, 131, 62, 245, 159, 43, 136, 221, 193, 145, 235,
-    134, 132, 95, 217, 167, 235, 148, 20, 142, 60, 12, 161, 237, 198, 190, 133, 94, 188, 16, 130, 40, 15, 175, 114, 190,
-    26, 252, 88, 69, 163, 38, 149, 102, 8, 178, 197, 96, 26, 193, 58, 2, 186, 243, 174, 146, 255, 206, 66, 118, 8, 113,
-    136, 99, 235, 55, 37, 70, 201, 71, 61, 13, 86, 140, 247, 236, 66, 63, 66, 251, 177, 51, 78, 80, 190, 154, 193, 150,
-    252, 72, 230, 79, 22, 239, 205, 70, 207, 215, 229, 224, 24, 129, 199, 166, 130, 162, 97, 156, 91, 138, 82, 37, 85,
-    2, 180, 21, 68, 96, 84, 232, 55, 47, 238, 89, 107, 25, 86, 236, 51, 233, 66, 100, 219, 229, 196, 56, 189, 204, 250,
-    151, 187, 121, 220, 199, 243, 141, 52, 204, 49, 94, 1, 104, 169, 178, 227, 128, 177, 130, 114, 51, 198, 67, 94, 168,
-    21, 101, 46, 222, 132, 86, 156, 59, 24, 145, 189, 93, 184, 31, 5, 167, 54, 232, 203, 233, 79, 79, 154, 198, 192,
-    184, 3, 228, 11, 179, 191, 198, 46, 246, 239, 109, 25, 37, 192, 58, 14, 216, 26, 126, 35, 38, 117, 8, 119, 34, 255,
-    149, 123, 135, 85, 56, 94, 242, 242, 0, 28, 46, 195, 132, 213, 168, 29, 183, 130, 210, 138, 251, 124, 2, 228, 241,
-    136, 20, 31, 85, 13, 15, 22, 245, 8, 212, 6, 44, 196, 16, 233, 155, 36, 53, 71, 40, 143, 68, 184, 131, 167, 132,
-    179, 142, 217, 80, 199, 79, 56, 200, 151, 7, 41, 39, 194, 175, 128, 132, 232, 152, 83, 224, 120, 169, 202, 173, 82,
-    64, 159, 134, 76, 245, 48, 200, 24, 193, 83, 217, 63, 104, 149, 120, 219, 111, 224, 154, 70, 104, 152, 15, 8, 66,
-    156, 28, 167, 163, 99, 44, 65, 227, 244, 212, 79, 92, 151, 199, 15, 1, 17, 165, 20, 5, 9, 114, 43, 133, 134, 90,
-    150, 166, 43, 143, 68, 73, 231, 181, 115, 90, 131, 110, 23, 133, 113, 105, 173, 252, 40, 136, 42, 128, 126, 86, 13,
-    53, 167, 111, 168, 115, 65, 125, 123, 85, 78, 206, 79, 90, 194, 132, 255, 128, 240, 182, 114, 163, 124, 44, 38, 52,
-    119, 141, 175, 100, 68, 223, 199, 75, 212, 3, 62, 36, 94, 131, 67, 146, 37, 214, 210, 73, 130, 22, 149, 134, 29, 7,
-    80, 84, 193, 16, 227, 113, 46, 183, 190, 42, 133, 174, 199, 6, 51, 76, 60, 167, 156, 55, 200, 32, 249, 250, 207,
-    159, 154, 227, 141, 211, 166, 184, 242, 97, 89, 8, 29, 46, 213, 184, 225, 88, 92, 34, 205, 71, 251, 210, 245, 166,
-    26, 189, 193, 161, 238, 156, 169, 36, 235, 29, 161, 98, 30, 176, 236, 247, 95, 201, 54, 56, 229, 207, 117, 165, 77,
-    35, 7, 204, 208, 176, 23, 72, 161, 82, 140, 83, 188, 172, 246, 173, 108, 251, 105, 158, 232, 208, 91, 87, 209, 5,
-    183, 154, 253, 104, 176, 206, 157, 238, 230, 129, 205, 13, 7, 39, 202, 133, 249, 18, 137, 190, 90, 188, 8, 175, 27,
-    235, 207, 100, 108, 171, 47, 248, 114, 143, 136, 248, 111, 7, 182, 251, 45, 69, 234, 29, 61, 170, 127, 217, 119,
-    255, 106, 57, 233, 105, 201, 199, 73, 187, 246, 109, 234, 215, 214, 134, 93, 183, 210, 113, 72, 127, 127, 203, 78,
-    90, 250, 195, 68, 161, 52, 166, 26, 226, 77, 79, 105, 178, 243, 188, 95, 204, 159, 134, 244, 97, 5, 123, 159, 151,
-    108, 129, 92, 47, 55, 62, 245, 2, 102, 223, 139, 102, 198, 179, 130, 70, 224, 162, 165, 22, 38, 233, 114, 190, 182,
-    115, 74, 163, 252, 130, 23, 105, 218, 28, 191, 86, 253, 165, 220, 184, 235, 99, 117, 244, 217, 123, 103, 67, 132,
-    143, 240, 183, 196, 114, 236, 115, 230, 43, 81, 205, 81, 113, 128, 172, 164, 191, 116, 167, 59, 42, 145, 78, 159,
-    54, 178, 76, 70, 233, 72, 119, 250, 110, 93, 159, 122, 206, 125, 27, 161, 250, 118, 76, 32, 19, 206, 87, 233, 233,
-    194, 246, 166, 70, 140, 130, 252, 59, 181, 160, 170, 197, 102, 155, 226, 208, 99, 96, 28, 7, 95, 134, 124, 158, 236,
-    211, 136, 21, 66, 96, 33, 39, 234, 32, 130, 151, 34, 239, 196, 122, 165, 249, 121, 27, 251, 86, 247, 217, 14, 136,
-    36, 125, 119, 82, 151, 93, 228, 51, 63, 178, 66, 209, 53, 98, 221, 60, 131, 144, 75, 86, 138, 233, 201, 156, 83, 79,
-    91, 7, 80, 235, 73, 65, 249, 132, 97, 214, 8, 190, 253, 5, 26, 50, 31, 178, 64, 152, 215, 30, 156, 3, 30, 174, 121,
-    228, 236, 133, 221, 177, 30, 78, 231, 22, 215, 140, 195, 220, 176, 192, 38, 9, 137, 167, 54, 57, 188, 115, 157, 76,
-    56, 69, 195, 124, 1, 178, 253, 99, 196, 174, 134, 202, 223, 186, 240, 187, 142, 204, 255, 168, 15, 189, 166, 210,
-    235, 219, 243, 28, 126, 75, 193, 126, 73, 66, 239, 18, 111, 226, 81, 108, 233, 52, 155, 28, 226, 179, 51, 84, 241,
-    156, 61, 29, 152, 24, 43, 34, 168, 51, 11, 216, 127, 221, 92, 171, 246, 16, 189, 59, 136, 159, 3, 46, 131, 237, 184,
-    38, 110, 173, 52, 238, 126, 186, 205, 11, 206, 109, 89, 113, 63, 66, 181, 107, 51, 111, 132, 160, 182, 91, 164, 126,
-    85, 117, 63, 5, 125, 236, 91, 11, 124, 91, 55, 201, 112, 84, 131, 148, 161, 213, 63, 248, 104, 204, 229, 84, 8, 210,
-    138, 228, 238, 53, 127, 36, 104, 129, 46, 83, 47, 214, 227, 112, 175, 7, 198, 229, 89, 249, 22, 81, 87, 18, 146,
-    168, 50, 187, 93, 37, 250, 177, 107, 217, 113, 70, 123, 245, 140, 153, 73, 177, 254, 21, 210, 82, 230, 16, 253, 213,
-    63, 159, 72, 25, 22, 200, 33, 98, 241, 137, 96, 57, 57, 194, 226, 50, 191, 180, 171, 58, 184, 139, 81, 206, 113, 3,
-    77, 122, 66, 255, 250, 37, 131, 202, 129, 146, 38, 19, 25, 168, 2, 237, 157, 65, 23, 105, 66, 123, 26, 213, 91, 232,
-    233, 10, 94, 3, 40, 35, 114, 193, 164, 108, 8, 4, 136, 19, 13, 83, 217, 254, 61, 217, 137, 149, 177, 113, 137, 178,
-    208, 165, 255, 110, 37, 84, 25, 129, 47, 244, 252, 40, 35, 16, 71, 94, 250, 110, 157, 122, 9, 56, 217, 77, 16, 98,
-    127, 57, 144, 235, 34, 214, 36, 91, 1, 14, 150, 180, 180, 135, 86, 123, 135, 89, 17, 220, 157, 6, 5, 16, 213, 119,
-    20, 105, 92, 176, 78, 2, 199, 206, 199, 188, 213, 145, 232, 60, 106, 23, 26, 167, 132, 94, 185, 159, 22, 155, 181,
-    92, 98, 138, 254, 206, 1, 195, 171, 61, 62, 186, 131, 225, 18, 208, 61, 253, 197, 108, 107, 205, 48, 195, 156, 75,
-    115, 202, 78, 212, 53, 4, 154, 151, 111, 204, 73, 221, 5, 26, 51, 202, 169, 234, 0, 179, 252, 157, 122, 251, 95, 90,
-    221, 164, 111, 134, 55, 3, 42, 211, 195, 159, 242, 26, 156, 13, 101, 239, 211, 199, 5, 49, 195, 245, 203, 128, 211,
-    92, 0, 44, 51, 235, 182, 200, 227, 137, 234, 225, 29, 128, 88, 194, 16, 233, 38, 255, 104, 187, 213, 230, 167, 249,
-    98, 55, 127, 154, 192, 101, 112, 54, 59, 250, 181, 228, 158, 224, 43, 76, 99, 26, 205, 115, 145, 124, 8, 230, 251,
-    250, 178, 242, 112, 200, 245, 170, 42, 213, 25, 137, 113, 34, 200, 99, 140, 57, 1, 212, 167, 3, 13, 212, 181, 195,
-    135, 11, 6, 237, 13, 193, 183, 154, 246, 79, 167, 223, 95, 97, 44, 47, 233, 28, 151, 139, 21, 140, 152, 122, 1, 51,
-    134, 253, 50, 85, 249, 135, 57, 34, 24, 167, 170, 146, 11, 160, 190, 122, 178, 19, 136, 101, 133, 70, 193, 108, 21,
-    85, 13, 106, 206, 157, 115, 234, 103, 91, 6, 74, 4, 213, 58, 252, 170, 81, 141, 140, 133, 14, 200, 82, 33, 19, 202,
-    169, 23, 193, 249, 195, 111, 18, 77, 117, 57, 225, 144, 250, 140, 168, 196, 158, 41, 89, 219, 251, 28, 19, 70, 76,
-    43, 118, 252, 94, 27, 52, 135, 113, 175, 138, 93, 223, 224, 157, 189, 13, 46, 243, 79, 154, 141, 50, 136, 149, 121,
-    215, 212, 126, 79, 61, 17, 35, 151, 98, 95, 50, 133, 178, 157, 101, 7, 210, 33, 138, 118, 112, 38, 182, 214, 230,
-    116, 199, 42, 103, 193, 54, 112, 25, 180, 165, 172, 170, 89, 85, 134, 52, 134, 118, 77, 246, 169, 112, 245, 43, 1,
-    163, 23, 26, 138, 16, 237, 42, 155, 68, 69, 65, 235, 145, 81, 114, 188, 161, 80, 250, 82, 184, 183, 135, 99, 125,
-    223, 37, 210, 244, 182, 131, 164, 6, 75, 47, 96, 222, 84, 109, 248, 101, 245, 116, 39, 76, 169, 124, 41, 45, 116,
-    157, 245, 130, 18, 54, 135, 76, 228, 241, 119, 144, 208, 186, 121, 119, 95, 199, 154, 62, 141, 241, 129, 143, 69,
-    128, 108, 188, 172, 204, 246, 173, 151, 208, 93, 89, 85, 208, 124, 168, 164, 39, 66, 123, 82, 213, 47, 91, 167, 163,
-    78, 138, 11, 171, 236, 156, 14, 134, 199, 136, 67, 74, 228, 117, 18, 69, 40, 109, 230, 21, 175, 212, 121, 73, 165,
-    32, 49, 233, 11, 77, 44, 184, 174, 241, 246, 204, 60, 162, 100, 118, 250, 131, 249, 163, 3, 158, 162, 118, 224, 220,
-    164, 40, 128, 107, 20, 231, 186, 227, 59, 176, 34, 200, 165, 135, 161, 101, 38, 194, 185, 206, 221, 29, 103, 153,
-    85, 85, 195, 69, 8, 176, 147, 118, 132, 235, 169, 46, 197, 128, 110, 33, 14, 253, 19, 40, 152, 178, 239, 33, 4, 111,
-    65, 74, 215, 25, 44, 182, 104, 30, 226, 232, 215, 7, 199, 211, 91, 223, 91, 118, 133, 201, 158, 23, 91, 201, 87,
-    177, 99, 110, 46, 192, 191, 164, 87, 223, 208, 97, 147, 42, 150, 105, 168, 115, 136, 74, 115, 44, 90, 244, 161, 143,
-    126, 30, 32, 82, 198, 17, 179, 212, 149, 137, 130, 13, 51, 182, 123, 16, 60, 206, 83, 207, 109, 107, 7, 195, 164,
-    176, 6, 11, 253, 200, 206, 103, 232, 14, 255, 87, 118, 54, 92, 123, 116, 0, 173, 9, 234, 107, 159, 102, 80, 174, 31,
-    145, 76, 118, 243, 84, 103, 215, 212, 55, 42, 106, 239, 226, 70, 248, 234, 51, 4, 167, 54, 44, 87, 103, 67, 137,
-    224, 184, 214, 226, 76, 178, 157, 151, 191, 131, 160, 242, 61, 201, 139, 237, 130, 112, 118, 233, 45, 217, 137, 188,
-    163, 130, 226, 184, 24, 49, 26, 90, 100, 71, 94, 62, 135, 44, 16, 140, 108, 54, 212, 42, 107, 37, 183, 42, 59, 251,
-    174, 46, 157, 91, 40, 34, 241, 178, 85, 243, 188, 135, 195, 186, 91, 126, 102, 79, 25, 34, 2, 118, 139, 159, 200,
-    131, 206, 189, 3, 119, 82, 98, 187, 161, 5, 209, 149, 174, 99, 21, 39, 202, 185, 74, 59, 166, 113, 140, 200, 66, 39,
-    37, 88, 223, 61, 29, 116, 62, 204, 73, 39, 55, 57, 109, 45, 74, 126, 241, 254, 221, 27, 144, 243, 8, 120, 132, 141,
-    118, 118, 207, 199, 122, 184, 163, 195, 9, 206, 57, 181, 232, 25, 149, 121, 109, 21, 104, 121, 19, 68, 230, 92, 156,
-    127, 175, 144, 123, 150, 83, 242, 48, 124, 71, 183, 145, 87, 3, 240, 85, 80, 60, 62, 93, 179, 90, 163, 221, 13, 136,
-    146, 254, 165, 190, 149, 20, 46, 9, 223, 224, 83, 158, 120, 253, 197, 8, 107, 203, 28, 111, 211, 248, 146, 202, 25,
-    175, 26, 207, 255, 178, 47, 75, 181, 117, 154, 0, 63, 176, 225, 237, 97, 204, 199, 124, 232, 9, 118, 211, 95, 250,
-    41, 164, 199, 114, 235, 69, 217, 132, 172, 174, 29, 158, 25, 20, 191, 0, 4, 24, 13, 170, 172, 233, 110, 153, 186,
-    249, 18, 90, 117, 38, 177, 28, 174, 226, 104, 41, 198, 206, 168, 5, 19, 15, 68, 135, 115, 149, 96, 125, 172, 242,
-    75, 172, 64, 73, 156, 224, 89, 159, 190, 108, 168, 92, 73, 166, 244, 190, 120, 213, 197, 123, 229, 143, 195, 65, 82,
-    15, 163, 114, 151, 116, 6, 242, 237, 121, 99, 72, 70, 178, 9, 102, 141, 234, 56, 228, 165, 180, 106, 35, 40, 217,
-    13, 140, 205, 255, 144, 121, 207, 105, 219, 138, 158, 67, 149, 185, 88, 145, 76, 26, 222, 170, 101, 123, 65, 206,
-    211, 210, 89, 215, 57, 136, 250, 184, 73, 175, 187, 215, 116, 200, 252, 6, 58, 188, 31, 70, 88, 194, 178, 155, 79,
-    186, 77, 175, 89, 163, 191, 117, 88, 243, 102, 92, 66, 37, 109, 30, 19, 174, 27, 175, 33, 121, 97, 43, 136, 123, 28,
-    101, 168, 206, 229, 233, 211, 90, 57, 81, 236, 155, 132, 56, 149, 174, 23, 122, 7, 128, 22, 44, 201, 35, 79, 98, 36,
-    74, 54, 115, 60, 52, 17, 120, 13, 244, 108, 137, 124, 50, 69, 123, 60, 233, 60, 4, 30, 228, 249, 25, 220, 230, 74,
-    69, 157, 20, 25, 212, 159, 145, 61, 252, 77, 255, 4, 60, 2, 46, 99, 214, 139, 90, 154, 229, 23, 132, 37, 231, 254,
-    234, 67, 189, 31, 10, 240, 148, 142, 157, 201, 204, 16, 201, 224, 85, 27, 9, 85, 64, 239, 30, 211, 89, 178, 221,
-    130, 183, 94, 208, 105, 105, 9, 57, 220, 214, 7, 60, 134, 228, 204, 138, 68, 97, 17, 194, 113, 143, 246, 252, 139,
-    48, 186, 72, 63, 231, 119, 43, 124, 218, 136, 37, 156, 211, 98, 105, 103, 51, 227, 56, 89, 76, 30, 12, 238, 169, 59,
-    150, 155, 156, 97, 201, 3, 177, 155, 152, 165, 213, 77, 0, 62, 68, 24, 114, 223, 99, 155, 223, 94, 234, 179, 175,
-    65, 106, 155, 2, 109, 83, 125, 152, 171, 137, 172, 79, 145, 195, 118, 146, 182, 46, 4, 22, 66, 132, 91, 108, 92,
-    125, 41, 214, 211, 108, 224, 139, 209, 163, 223, 214, 52, 153, 74, 142, 200, 239, 149, 106, 177, 174, 91, 47, 67,
-    75, 158, 223, 89, 131, 4, 19, 123, 179, 24, 221, 91, 12, 20, 250, 17, 180, 28, 161, 151, 130, 206, 21, 147, 117, 29,
-    45, 241, 73, 90, 125, 110, 180, 140, 35, 14, 152, 17, 104, 18, 199, 92, 114, 144, 45, 239, 172, 122, 175, 210, 13,
-    159, 178, 0, 164, 193, 37, 94, 80, 197, 106, 99, 237, 100, 40, 33, 189, 85, 184, 100, 0, 220, 221, 236, 158, 42, 28,
-    96, 33, 51, 124, 92, 60, 47, 109, 226, 41, 31, 27, 240, 151, 92, 82, 134, 74, 78, 5, 49, 207, 110, 130, 205, 42, 67,
-    113, 46, 200, 32, 156, 3, 249, 248, 17, 14, 233, 20, 79, 4, 12, 64, 29, 211, 216, 251, 203, 204, 7, 122, 30, 185,
-    164, 53, 63, 156, 91, 129, 43, 85, 134, 202, 247, 229, 175, 91, 171, 150, 62, 170, 32, 244, 248, 39, 120, 63, 194,
-    146, 229, 205, 84, 24, 209, 24, 90, 191, 88, 142, 16, 155, 124, 22, 49, 235, 195, 84, 125, 135, 159, 53, 142, 73,
-    248, 189, 155, 115, 119, 141, 95, 42, 64, 73, 189, 184, 45, 79, 7, 216, 35, 191, 213, 167, 244, 21, 204, 88, 142,
-    187, 33, 107, 87, 97, 127, 252, 138, 96, 25, 237, 30, 163, 60, 134, 184, 102, 6, 244, 148, 133, 246, 176, 229, 163,
-    141, 94, 228, 27, 72, 39, 125, 94, 229, 14, 15, 229, 50, 121, 112, 139, 86, 142, 87, 12, 59, 80, 219, 219, 24, 89,
-    214, 238, 215, 76, 255, 244, 1, 2, 171, 203, 9, 172, 236, 212, 88, 253, 184, 200, 222, 136, 184, 246, 128, 142, 207,
-    234, 6, 106, 157, 35, 214, 75, 26, 149, 100, 164, 2, 21, 116, 252, 171, 110, 138, 134, 213, 154, 50, 45, 40, 225,
-    47, 24, 230, 138, 11, 177, 9, 85, 196, 157, 124, 4, 148, 105, 58, 237, 95, 76, 127, 117, 180, 132, 9, 178, 5, 87,
-    96, 20, 91, 211, 117, 166, 138, 182, 174, 159, 159, 7, 31, 92, 252, 252, 160, 55, 13, 245, 250, 30, 193, 156, 251,
-    160, 146, 200, 240, 249, 163, 213, 92, 234, 124, 117, 81, 143, 127, 37, 61, 5, 13, 102, 162, 153, 109, 142, 169,
-    122, 37, 233, 132, 99, 79, 164, 51, 241, 174, 190, 41, 210, 58, 1, 164, 230, 206, 220, 167, 31, 84, 47, 32, 0, 106,
-    53, 17, 130, 20, 238, 144, 171, 123, 68, 113, 184, 170, 225, 195, 219, 235, 102, 209, 138, 123, 190, 219, 99, 39,
-    117, 156, 208, 212, 104, 110, 143, 252, 229, 245, 221, 161, 156, 92, 61, 11, 63, 177, 16, 118, 180, 138, 75, 150,
-    107, 78, 30, 218, 120, 100, 135, 212, 179, 11, 6, 173, 150, 237, 189, 183, 223, 199, 20, 168, 154, 36, 177, 63, 186,
-    214, 112, 83, 76, 240, 179, 199, 67, 238, 9, 138, 201, 85, 6, 149, 249, 224, 221, 17, 11, 20, 41, 12, 21, 249, 173,
-    3, 48, 159, 24, 15, 39, 162, 233, 141, 151, 95, 24, 213, 255, 182, 138, 38, 178, 126, 170, 180, 160, 112, 251, 240,
-    230, 15, 74, 44, 193, 226, 163, 236, 18, 154, 179, 129, 60, 154, 247, 222, 103, 224, 98, 242, 8, 222, 184, 46, 254,
-    28, 79, 237, 66, 66, 86, 89, 234, 223, 204, 45, 229, 121, 198, 125, 45, 172, 119, 158, 230, 210, 210, 233, 51, 241,
-    225, 38, 94, 70, 229, 62, 8, 75, 0, 176, 233, 160, 104, 171, 82, 109, 143, 116, 247, 17, 126, 20, 132, 131, 65, 238,
-    163, 252, 142, 13, 250, 246, 96, 2, 56, 174, 69, 248, 179, 216, 166, 205, 157, 213, 47, 168, 162, 87, 17, 32, 229,
-    135, 159, 166, 128, 1, 31, 95, 159, 37, 94, 152, 13, 42, 218, 95, 205, 61, 155, 31, 4, 114, 98, 224, 0, 182, 54,
-    221, 83, 232, 53, 129, 87, 118, 138, 91, 225, 50, 184, 71, 2, 105, 53, 91, 124, 59, 70, 217, 67, 168, 82, 234, 5,
-    28, 30, 189, 230, 216, 83, 61, 180, 200, 212, 152, 153, 38, 137, 154, 148, 113, 70, 22, 50, 4, 55, 203, 106, 219,
-    58, 161, 124, 223, 243, 143, 200, 245, 218, 155, 225, 196, 157, 65, 110, 30, 249, 118, 79, 234, 191, 51, 225, 206,
-    185, 207, 127, 47, 168, 177, 190, 178, 154, 156, 54, 20, 237, 224, 115, 175, 133, 220, 97, 237, 170, 20, 138, 171,
-    188, 186, 84, 38, 6, 109, 39, 227, 226, 27, 66, 41, 104, 70, 97, 61, 1, 225, 208, 231, 182, 202, 252, 54, 227, 40,
-    30, 159, 65, 127, 200, 7, 8, 0, 248, 223, 238, 119, 213, 170, 59, 43, 175, 223, 186, 62, 44, 186, 10, 44, 143, 44,
-    41, 15, 164, 230, 159, 18, 247, 75, 185, 214, 207, 154, 191, 92, 239, 196, 41, 41, 80, 101, 125, 159, 30, 127, 228,
-    237, 100, 92, 69, 169, 239, 229, 223, 243, 10, 16, 98, 253, 99, 3, 166, 77, 240, 198, 218, 22, 23, 117, 188, 244,
-    61, 158, 110, 124, 174, 51, 255, 190, 191, 207, 177, 241, 0, 150, 191, 200, 93, 94, 83, 224, 53, 126, 175, 239, 24,
-    33, 90, 145, 210, 161, 236, 206, 164, 70, 184, 69, 10, 185, 154, 164, 191, 227, 231, 132, 229, 172, 59, 54, 57, 194,
-    151, 97, 119, 180, 188, 3, 221, 226, 227, 152, 179, 212, 39, 132, 156, 167, 116, 121, 43, 12, 109, 234, 73, 161, 96,
-    106, 6, 140, 131, 31, 28, 105, 211, 165, 188, 86, 216, 240, 128, 78, 195, 131, 75, 221, 124, 195, 54, 241, 187, 105,
-    51, 196, 49, 110, 12, 24, 193, 208, 128, 255, 231, 36, 154, 80, 56, 220, 144, 140, 135, 197, 236, 19, 23, 252, 246,
-    223, 102, 104, 67, 164, 177, 186, 107, 186, 125, 226, 199, 198, 124, 222, 89, 126, 242, 77, 17, 151, 93, 16, 57,
-    130, 92, 155, 171, 160, 156, 201, 6, 105, 19, 50, 177, 158, 51, 167, 13, 20, 17, 157, 69, 125, 92, 255, 250, 221,
-    181, 74, 170, 198, 150, 72, 255, 9, 79, 175, 186, 16, 11, 178, 105, 62, 246, 41, 189, 116, 65, 16, 207, 206, 18,
-    234, 174, 205, 195, 7, 195, 228, 192, 166, 189, 45, 71, 188, 118, 115, 148, 108, 124, 64, 72, 105, 53, 151, 118, 16,
-    136, 22, 124, 21, 78, 123, 225, 38, 70, 29, 43, 30, 244, 146, 76, 5, 240, 92, 208, 129, 106, 65, 243, 39, 54, 115,
-    3, 63, 253, 173, 222, 15, 63, 101, 229, 12, 99, 178, 248, 133, 91, 51, 224, 48, 2, 118, 195, 140, 196, 212, 248,
-    139, 180, 50, 116, 225, 144, 213, 69, 149, 175, 158, 197, 136, 49, 242, 74, 38, 129, 236, 249, 101, 172, 42, 114,
-    230, 17, 177, 28, 11, 185, 13, 182, 134, 198, 117, 5, 244, 18, 216, 170, 213, 174, 169, 183, 28, 44, 216, 37, 251,
-    117, 133, 1, 29, 11, 115, 231, 151, 74, 178, 152, 23, 116, 109, 226, 193, 2, 177, 135, 103, 3, 11, 209, 193, 142,
-    218, 187, 69, 86, 36, 71, 50, 6, 81, 79, 22, 91, 159, 104, 40, 192, 29, 44, 120, 103, 146, 204, 233, 111, 31, 97,
-    225, 158, 2, 60, 233, 203, 215, 112, 18, 196, 98, 80, 254, 26, 146, 248, 189, 206, 212, 176, 30, 230, 83, 119, 82,
-    188, 199, 138, 81, 114, 73, 101, 1, 90, 254, 38, 226, 253, 159, 17, 128, 87, 54, 253, 144, 65, 236, 190, 86, 3, 100,
-    40, 50, 44, 126, 143, 173, 120, 120, 74, 11, 33, 72, 22, 238, 64, 50, 141, 82, 95, 165, 41, 60, 224, 179, 143, 0,
-    135, 118, 45, 182, 49, 169, 201, 255, 71, 93, 96, 71, 224, 239, 74, 32, 27, 29, 150, 18, 174, 21, 200, 30, 249, 72,
-    59, 223, 211, 132, 74, 108, 43, 223, 192, 54, 50, 40, 134, 80, 0, 197, 82, 187, 193, 45, 32, 175, 242, 170, 132, 50,
-    134, 139, 13, 105, 155, 122, 253, 77, 48, 18, 60, 158, 118, 152, 88, 237, 154, 181, 138, 167, 7, 131, 97, 36, 105,
-    202, 4, 31, 240, 189, 78, 131, 1, 71, 21, 129, 75, 217, 25, 130, 91, 188, 97, 23, 35, 79, 0, 124, 214, 152, 58, 166,
-    224, 30, 58, 14, 94, 80, 162, 148, 75, 208, 53, 7, 142, 109, 45, 121, 114, 106, 74, 69, 176, 4, 13, 111, 202, 152,
-    8, 177, 226, 205, 169, 199, 253, 199, 243, 135, 145, 155, 33, 126, 227, 160, 101, 62, 154, 183, 93, 232, 118, 169,
-    28, 223, 94, 218, 6, 126, 108, 124, 215, 6, 208, 75, 130, 149, 187, 116, 66, 249, 241, 255, 155, 20, 163, 165, 11,
-    196, 243, 29, 166, 239, 172, 62, 134, 176, 232, 84, 146, 118, 161, 101, 99, 24, 225, 10, 214, 192, 114, 244, 122,
-    207, 218, 46, 40, 21, 116, 94, 128, 68, 217, 64, 168, 219, 191, 8, 58, 126, 82, 220, 176, 232, 165, 166, 140, 220,
-    177, 164, 190, 245, 76, 239, 160, 179, 245, 84, 89, 99, 24, 114, 64, 251, 224, 72, 173, 198, 69, 123, 110, 89, 89,
-    215, 120, 87, 44, 168, 69, 142, 152, 121, 184, 104, 254, 154, 43, 126, 139, 221, 248, 238, 122, 211, 234, 173, 3,
-    240, 50, 41, 220, 1, 112, 216, 59, 131, 0, 189, 3, 17, 142, 129, 158, 225, 219, 81, 1, 249, 62, 16, 239, 75, 185,
-    24, 52, 37, 32, 231, 225, 182, 178, 81, 100, 241, 58, 55, 54, 1, 134, 28, 76, 55, 103, 36, 106, 182, 103, 63, 181,
-    180, 146, 119, 128, 201, 75, 203, 192, 16, 106, 129, 91, 34, 124, 94, 23, 60, 63, 49, 76, 196, 192, 209, 11, 104,
-    222, 11, 87, 126, 219, 57, 14, 206, 113, 203, 8, 153, 245, 82, 135, 106, 17, 58, 82, 122, 14, 66, 1, 89, 52, 168,
-    102, 151, 71, 129, 19, 91, 132, 238, 39, 203, 241, 53, 98, 228, 93, 192, 19, 112, 71, 186, 150, 111, 88, 28, 74,
-    238, 24, 13, 230, 126, 36, 30, 191, 93, 214, 185, 244, 109, 153, 110, 11, 87, 207, 60, 75, 166, 214, 119, 19, 44,
-    196, 41, 19, 200, 36, 151, 91, 118, 42, 119, 94, 39, 59, 47, 60, 165, 47, 144, 146, 234, 10, 158, 99, 50, 61, 163,
-    238, 71, 85, 75, 120, 157, 3, 105, 57, 110, 47, 165, 202, 7, 61, 5, 69, 212, 44, 191, 11, 250, 123, 8, 183, 128,
-    142, 120, 226, 20, 89, 179, 44, 208, 237, 217, 178, 21, 134, 83, 79, 87, 227, 158, 71, 2, 171, 64, 176, 41, 219, 33,
-    126, 20, 109, 20, 121, 183, 120, 124, 19, 214, 1, 79, 19, 175, 62, 190, 216, 123, 78, 34, 195, 86, 208, 121, 236,
-    110, 57, 55, 253, 248, 104, 178, 213, 189, 235, 229, 136, 88, 124, 125, 134, 137, 239, 216, 207, 20, 214, 124, 158,
-    9, 118, 158, 37, 158, 17, 70, 125, 82, 239, 113, 252, 191, 127, 119, 124, 196, 89, 221, 183, 118, 18, 201, 115, 53,
-    176, 72, 182, 125, 214, 3, 132, 168, 167, 231, 27, 106, 239, 216, 82, 130, 197, 147, 176, 52, 181, 1, 219, 207, 102,
-    59, 244, 186, 38, 130, 13, 214, 137, 96, 239, 255, 9, 144, 250, 126, 237, 190, 64, 194, 94, 115, 245, 61, 12, 3,
-    234, 83, 173, 35, 140, 110, 226, 151, 144, 163, 35, 217, 26, 183, 39, 80, 173, 211, 184, 172, 55, 62, 231, 248, 184,
-    51, 51, 56, 133, 77, 150, 162, 8, 79, 223, 198, 58, 42, 177, 163, 23, 166, 105, 182, 71, 169, 175, 32, 51, 140, 226,
-    9, 183, 194, 213, 114, 153, 114, 229, 175, 7, 126, 215, 77, 76, 118, 166, 246, 242, 254, 8, 32, 38, 116, 116, 187,
-    235, 30, 78, 53, 40, 127, 178, 159, 226, 228, 22, 96, 50, 48, 148, 103, 186, 248, 49, 109, 221, 252, 138, 238, 5,
-    89, 226, 2, 46, 148, 228, 2, 73, 4, 247, 106, 204, 157, 214, 52, 250, 250, 121, 158, 4, 32, 149, 47, 168, 155, 9,
-    168, 185, 11, 155, 135, 46, 72, 1, 2, 90, 158, 229, 247, 24, 6, 95, 76, 244, 147, 159, 149, 98, 26, 236, 9, 20, 130,
-    178, 152, 243, 58, 152, 144, 108, 179, 192, 35, 105, 21, 133, 87, 188, 140, 247, 73, 171, 174, 24, 66, 87, 164, 98,
-    228, 117, 65, 182, 12, 102, 231, 0, 195, 3, 112, 127, 164, 247, 201, 117, 137, 251, 144, 92, 250, 118, 165, 128,
-    153, 199, 53, 55, 235, 121, 26, 160, 103, 175, 96, 197, 224, 208, 252, 105, 215, 2, 255, 78, 154, 88, 112, 210, 166,
-    167, 59, 109, 0, 151, 206, 66, 235, 79, 39, 183, 207, 8, 89, 170, 250, 176, 2, 116, 107, 52, 44, 63, 60, 155, 144,
-    181, 80, 239, 136, 101, 25, 158, 119, 207, 217, 43, 62, 246, 104, 119, 18, 12, 13, 179, 254, 53, 48, 72, 14, 240,
-    189, 69, 74, 218, 147, 182, 180, 133, 9, 113, 47, 202, 116, 6, 30, 211, 153, 180, 29, 131, 107, 151, 11, 219, 242,
-    3, 244, 68, 208, 175, 87, 199, 74, 25, 222, 153, 111, 217, 30, 244, 240, 33, 228, 8, 144, 165, 217, 9, 62, 232, 186,
-    224, 236, 229, 28, 19, 67, 222, 20, 65, 8, 251, 231, 50, 219, 2, 64, 244, 24, 81, 249, 97, 233, 0, 200, 181, 55,
-    153, 175, 46, 251, 65, 75, 85, 141, 83, 172, 25, 55, 71, 43, 254, 187, 144, 45, 164, 32, 171, 79, 87, 57, 4, 225,
-    40, 226, 252, 44, 247, 190, 254, 106, 197, 21, 98, 128, 54, 216, 223, 12, 220, 51, 102, 107, 32, 36, 176, 20, 135,
-    167, 134, 73, 72, 153, 156, 98, 162, 90, 182, 155, 56, 178, 63, 228, 241, 17, 194, 55, 63, 219, 182, 54, 217, 103,
-    101, 72, 141, 55, 35, 125, 135, 69, 184, 41, 55, 166, 229, 58, 254, 210, 142, 72, 38, 54, 22, 148, 136, 254, 52,
-    160, 154, 16, 160, 104, 13, 219, 219, 23, 111, 176, 201, 200, 118, 98, 150, 250, 235, 238, 225, 0, 189, 186, 97,
-    153, 217, 184, 221, 116, 99, 49, 180, 224, 253, 141, 218, 131, 202, 168, 101, 128, 158, 18, 152, 101, 41, 197, 91,
-    149, 196, 120, 120, 149, 41, 245, 90, 134, 68, 240, 120, 56, 58, 134, 26, 242, 2, 100, 206, 253, 251, 168, 245, 253,
-    129, 51, 236, 49, 198, 109, 117, 240, 72, 75, 20, 32, 3, 253, 63, 149, 154, 84, 12, 84, 217, 143, 34, 209, 93, 249,
-    81, 181, 87, 145, 180, 131, 57, 146, 157, 7, 35, 42, 92, 240, 105, 172, 92, 234, 225, 53, 122, 102, 168, 156, 220,
-    34, 195, 110, 30, 241, 163, 6, 103, 86, 160, 62, 61, 167, 167, 19, 137, 73, 178, 2, 122, 220, 242, 247, 173, 225,
-    134, 88, 233, 53, 194, 223, 168, 142, 141, 156, 218, 72, 57, 115, 254, 251, 14, 104, 220, 84, 146, 150, 168, 246,
-    179, 99, 27, 241, 68, 231, 47, 58, 149, 237, 227, 89, 59, 96, 56, 56, 19, 113, 123, 177, 134, 117, 171, 22, 95, 75,
-    231, 144, 121, 147, 46, 241, 155, 30, 231, 87, 130, 211, 244, 225, 101, 57, 194, 222, 218, 95, 67, 130, 235, 36, 47,
-    9, 94, 220, 255, 11, 46, 140, 39, 253, 159, 100, 133, 54, 67, 71, 27, 93, 71, 210, 43, 8, 82, 138, 56, 9, 119, 202,
-    233, 102, 197, 15, 95, 36, 189, 18, 71, 62, 232, 218, 105, 220, 225, 244, 110, 61, 101, 87, 8, 161, 167, 35, 192,
-    233, 170, 200, 244, 87, 65, 239, 13, 101, 120, 195, 109, 132, 160, 63, 216, 141, 110, 214, 47, 94, 194, 112, 101,
-    156, 48, 59, 130, 58, 92, 148, 76, 126, 110, 182, 91, 50, 120, 44, 182, 146, 131, 90, 15, 252, 133, 121, 242, 13,
-    254, 165, 92, 42, 179, 129, 250, 89, 78, 186, 168, 87, 32, 186, 14, 241, 102, 62, 168, 248, 42, 218, 174, 255, 86,
-    87, 250, 170, 62, 100, 158, 171, 156, 20, 7, 104, 76, 164, 136, 137, 152, 109, 15, 96, 140, 64, 139, 212, 212, 14,
-    244, 255, 13, 30, 194, 57, 149, 232, 192, 68, 77, 253, 124, 83, 44, 164, 141, 22, 77, 72, 114, 75, 62, 3, 22, 80,
-    205, 251, 253, 146, 57, 51, 206, 97, 29, 49, 213, 61, 179, 74, 34, 111, 124, 171, 233, 129, 183, 12, 135, 234, 195,
-    191, 226, 77, 11, 110, 131, 57, 29, 209, 218, 29, 172, 106, 5, 254, 15, 112, 201, 198, 219, 62, 10, 178, 102, 69,
-    108, 106, 13, 224, 159, 97, 180, 126, 69, 32, 23, 225, 201, 46, 211, 75, 68, 168, 142, 63, 27, 249, 24, 177, 141,
-    254, 170, 114, 5, 220, 0, 143, 202, 186, 118, 161, 240, 123, 102, 39, 216, 180, 134, 193, 209, 181, 139, 9, 64, 157,
-    142, 10, 160, 94, 245, 139, 85, 204, 242, 2, 68, 94, 84, 112, 44, 126, 121, 240, 12, 146, 54, 80, 8, 190, 232, 194,
-    226, 255, 174, 56, 180, 38, 42, 132, 23, 90, 68, 147, 182, 1, 204, 213, 250, 92, 32, 182, 232, 240, 9, 215, 51, 97,
-    129, 194, 68, 122, 167, 53, 122, 241, 18, 83, 138, 67, 57, 236, 175, 78, 153, 42, 146, 94, 102, 132, 191, 80, 109,
-    226, 15, 143, 90, 101, 249, 182, 182, 196, 16, 67, 138, 175, 159, 250, 24, 213, 187, 195, 204, 37, 242, 191, 166,
-    226, 101, 213, 59, 225, 72, 1, 76, 3, 150, 4, 230, 111, 176, 10, 246, 152, 134, 43, 114, 56, 77, 242, 157, 137, 221,
-    17, 63, 191, 111, 255, 37, 92, 126, 89, 125, 25, 96, 247, 122, 232, 48, 56, 12, 211, 79, 81, 129, 172, 220, 118,
-    235, 193, 161, 40, 115, 190, 4, 39, 74, 177, 1, 90, 173, 189, 209, 212, 78, 22, 145, 150, 249, 163, 141, 76, 115,
-    85, 88, 56, 32, 11, 94, 240, 55, 0, 122, 212, 204, 187, 83, 123, 1, 28, 29, 187, 135, 226, 194, 121, 195, 57, 59, 2,
-    215, 211, 158, 159, 71, 218, 225, 3, 176, 29, 58, 252, 10, 228, 181, 215, 138, 80, 157, 115, 122, 197, 251, 199,
-    165, 19, 81, 106, 39, 58, 86, 251, 29, 42, 44, 247, 43, 131, 225, 53, 194, 72, 5, 21, 51, 180, 204, 50, 251, 243,
-    42, 16, 35, 49, 205, 223, 190, 33, 91, 63, 182, 127, 18, 87, 28, 59, 121, 94, 64, 165, 190, 147, 201, 96, 134, 62,
-    116, 131, 249, 80, 207, 195, 87, 88, 46, 120, 99, 25, 133, 96, 186, 248, 69, 101, 136, 25, 36, 136, 178, 39, 169,
-    37, 100, 99, 130, 233, 85, 23, 170, 79, 83, 75, 63, 230, 153, 164, 201, 205, 220, 129, 138, 203, 34, 82, 243, 124,
-    1, 243, 129, 165, 227, 55, 153, 229, 159, 80, 43, 6, 168, 128, 146, 237, 4, 58, 93, 245, 124, 127, 5, 108, 198, 107,
-    122, 145, 233, 215, 53, 191, 222, 51, 51, 220, 110, 92, 69, 133, 44, 118, 191, 215, 39, 22, 216, 0, 75, 212, 211,
-    156, 31, 42, 13, 218, 180, 152, 50, 68, 90, 190, 226, 95, 149, 188, 73, 137, 33, 41, 158, 151, 172, 45, 175, 171,
-    25, 189, 46, 194, 229, 120, 80, 160, 79, 34, 207, 233, 10, 195, 28, 115, 82, 73, 244, 182, 113, 109, 3, 116, 98,
-    170, 137, 94, 218, 66, 149, 127, 5, 249, 176, 203, 61, 4, 0, 230, 244, 170, 108, 215, 50, 126, 19, 236, 125, 49,
-    171, 113, 98, 81, 195, 205, 3, 188, 100, 210, 162, 153, 192, 209, 25, 97, 186, 170, 11, 29, 211, 222, 248, 46, 63,
-    224, 169, 234, 48, 240, 44, 99, 250, 249, 81, 105, 177, 155, 235, 196, 102, 157, 66, 19, 2, 250, 100, 203, 243, 167,
-    125, 237, 195, 206, 90, 181, 224, 27, 87, 95, 188, 231, 45, 170, 54, 237, 150, 60, 103, 135, 23, 253, 9, 27, 154,
-    113, 65, 141, 34, 248, 131, 103, 127, 208, 168, 71, 163, 64, 233, 133, 99, 230, 113, 127, 18, 1, 104, 171, 170, 104,
-    3, 27, 30, 121, 146, 166, 137, 43, 132, 178, 102, 91, 80, 186, 187, 85, 48, 170, 101, 150, 195, 32, 113, 171, 88,
-    39, 59, 185, 88, 105, 57, 206, 183, 52, 57, 151, 84, 79, 75, 82, 88, 144, 118, 159, 229, 128, 222, 103, 145, 239,
-    90, 90, 243, 236, 253, 106, 29, 249, 136, 55, 106, 8, 101, 63, 168, 29, 9, 217, 118, 252, 50, 218, 127, 207, 40, 36,
-    2, 184, 173, 34, 113, 13, 124, 226, 218, 185, 12, 127, 173, 57, 99, 142, 196, 3, 30, 182, 157, 150, 17, 226, 133,
-    234, 172, 100, 188, 97, 210, 177, 43, 56, 75, 86, 25, 106, 61, 19, 105, 185, 151, 179, 196, 225, 115, 76, 96, 98,
-    13, 116, 46, 51, 220, 99, 220, 58, 230, 57, 17, 19, 249, 215, 32, 188, 27, 137, 217, 233, 19, 164, 49, 37, 62, 88,
-    149, 166, 189, 25, 170, 92, 97, 53, 206, 30, 117, 77, 62, 84, 130, 6, 164, 234, 210, 55, 188, 115, 205, 157, 90,
-    233, 108, 88, 25, 21, 54, 45, 167, 206, 195, 183, 250, 54, 46, 236, 87, 64, 189, 28, 245, 91, 33, 86, 174, 171, 66,
-    191, 26, 40, 64, 27, 228, 163, 108, 217, 236, 24, 57, 51, 187, 106, 182, 131, 98, 135, 251, 107, 81, 217, 97, 122,
-    114, 65, 53, 3, 166, 253, 53, 192, 99, 167, 129, 108, 196, 57, 199, 70, 10, 123, 153, 199, 82, 6, 104, 112, 209, 28,
-    204, 176, 183, 70, 180, 172, 247, 252, 184, 76, 73, 28, 241, 160, 240, 180, 236, 11, 162, 19, 154, 155, 242, 22,
-    109, 78, 150, 40, 235, 194, 89, 131, 222, 144, 206, 54, 232, 153, 56, 105, 36, 153, 215, 69, 123, 105, 92, 135, 65,
-    96, 140, 107, 74, 30, 245, 235, 149, 187, 183, 152, 75, 183, 155, 124, 132, 72, 242, 65, 119, 129, 230, 89, 107,
-    195, 9, 106, 219, 227, 227, 143, 54, 91, 69, 76, 192, 232, 125, 147, 53, 190, 83, 84, 166, 190, 221, 34, 203, 80,
-    240, 217, 128, 154, 1, 74, 79, 47, 99, 20, 117, 27, 160, 207, 134, 199, 102, 108, 112, 76, 184, 248, 39, 30, 114,
-    113, 20, 212, 165, 201, 111, 12, 160, 37, 121, 171, 183, 67, 31, 147, 180, 163, 159, 176, 46, 196, 239, 82, 166,
-    106, 152, 47, 190, 139, 247, 74, 117, 208, 47, 1, 234, 202, 188, 212, 133, 81, 46, 235, 207, 110, 84, 181, 95, 147,
-    82, 174, 170, 152, 140, 38, 37, 222, 244, 111, 145, 106, 43, 196, 129, 153, 128, 189, 240, 66, 4, 136, 12, 115, 179,
-    76, 222, 61, 133, 120, 170, 5, 112, 253, 203, 138, 129, 104, 177, 59, 106, 180, 74, 119, 157, 168, 109, 155, 55, 24,
-    42, 206, 27, 110, 31, 247, 70, 110, 242, 140, 31, 14, 176, 30, 150, 67, 111, 153, 5, 245, 168, 64, 156, 225, 35, 48,
-    184, 247, 18, 124, 46, 43, 60, 88, 96, 45, 176, 158, 44, 128, 212, 1, 89, 50, 156, 120, 188, 121, 96, 23, 138, 212,
-    212, 25, 96, 165, 180, 64, 44, 217, 124, 115, 8, 125, 106, 17, 55, 113, 119, 107, 169, 33, 141, 68, 232, 69, 25,
-    237, 192, 93, 108, 0, 56, 123, 66, 32, 132, 102, 13, 149, 90, 127, 46, 237, 182, 134, 251, 108, 42, 85, 20, 141,
-    249, 162, 9, 11, 128, 40, 81, 243, 46, 158, 12, 199, 196, 26, 130, 178, 222, 248, 84, 51, 230, 10, 52, 95, 226, 53,
-    86, 111, 171, 85, 35, 21, 220, 31, 21, 203, 106, 177, 184, 3, 164, 9, 85, 72, 184, 220, 84, 119, 125, 233, 7, 4, 95,
-    208, 111, 162, 126, 13, 140, 72, 142, 210, 24, 28, 214, 40, 147, 18, 187, 69, 178, 189, 92, 3, 118, 40, 254, 160,
-    46, 55, 1, 60, 95, 197, 111, 55, 67, 250, 198, 89, 114, 133, 248, 106, 160, 100, 69, 10, 29, 144, 156, 14, 220, 133,
-    143, 176, 147, 153, 52, 53, 33, 5, 140, 131, 174, 115, 48, 90, 116, 22, 215, 47, 138, 163, 156, 8, 46, 163, 239, 19,
-    10, 176, 68, 123, 144, 67, 218, 64, 131, 21, 243, 90, 105, 227, 105, 24, 87, 181, 91, 143, 84, 13, 4, 168, 194, 80,
-    130, 250, 252, 239, 104, 31, 190, 179, 7, 118, 97, 87, 198, 246, 92, 7, 225, 124, 205, 13, 53, 225, 229, 138, 56,
-    37, 96, 147, 96, 89, 52, 20, 248, 119, 253, 237, 48, 127, 134, 45, 158, 214, 136, 79, 149, 170, 79, 33, 245, 255,
-    33, 155, 167, 11, 192, 176, 217, 255, 112, 5, 59, 103, 111, 233, 72, 209, 59, 225, 126, 3, 114, 119, 8, 233, 60,
-    216, 242, 254, 103, 214, 133, 26, 170, 82, 47, 73, 51, 159, 151, 163, 245, 89, 34, 214, 197, 41, 171, 22, 91, 172,
-    240, 37, 234, 72, 175, 22, 49, 163, 167, 164, 201, 191, 130, 246, 178, 203, 246, 88, 198, 227, 67, 108, 70, 212,
-    206, 233, 39, 58, 90, 61, 114, 54, 229, 119, 56, 110, 215, 36, 16, 68, 75, 40, 125, 106, 192, 183, 73, 40, 47, 82,
-    64, 228, 221, 220, 145, 138, 31, 205, 125, 42, 87, 96, 242, 133, 254, 169, 175, 21, 236, 173, 47, 217, 43, 171, 88,
-    82, 14, 246, 50, 35, 145, 74, 74, 209, 130, 225, 125, 245, 222, 181, 220, 155, 150, 156, 3, 24, 139, 224, 77, 225,
-    82, 223, 233, 183, 100, 46, 47, 123, 185, 204, 95, 66, 96, 207, 231, 153, 251, 185, 7, 116, 132, 217, 192, 13, 95,
-    151, 196, 99, 9, 111, 147, 153, 39, 157, 78, 96, 77, 51, 175, 245, 15, 131, 21, 106, 40, 183, 148, 211, 40, 150,
-    196, 93, 87, 67, 102, 169, 120, 220, 204, 100, 169, 70, 178, 201, 138, 172, 203, 74, 118, 76, 93, 254, 57, 42, 16,
-    162, 174, 204, 61, 17, 5, 68, 98, 80, 253, 211, 188, 204, 120, 99, 143, 181, 198, 105, 44, 168, 99, 53, 239, 75, 76,
-    234, 241, 6, 105, 230, 13, 27, 239, 104, 130, 6, 192, 101, 246, 239, 246, 142, 150, 33, 105, 40, 191, 140, 168, 51,
-    65, 242, 24, 145, 82, 21, 10, 22, 212, 101, 19, 122, 243, 120, 233, 35, 71, 219, 188, 225, 254, 144, 15, 137, 156,
-    169, 232, 67, 79, 67, 237, 252, 162, 90, 203, 219, 34, 11, 233, 249, 245, 169, 251, 222, 119, 124, 99, 188, 118,
-    130, 197, 236, 171, 195, 143, 2, 157, 199, 194, 58, 123, 132, 120, 169, 210, 103, 228, 106, 122, 222, 111, 224, 73,
-    212, 127, 202, 199, 146, 249, 152, 219, 62, 199, 110, 73, 56, 107, 1, 11, 179, 130, 211, 27, 25, 3, 108, 198, 46,
-    63, 16, 110, 254, 177, 100, 165, 110, 28, 183, 12, 115, 236, 224, 203, 207, 228, 116, 9, 140, 19, 136, 200, 124,
-    216, 14, 7, 92, 162, 207, 65, 252, 162, 99, 10, 123, 103, 173, 224, 20, 134, 164, 76, 153, 146, 221, 166, 193, 197,
-    247, 136, 215, 184, 204, 248, 28, 218, 130, 87, 82, 236, 179, 161, 176, 162, 165, 201, 113, 133, 45, 157, 12, 162,
-    252, 130, 188, 190, 64, 128, 224, 136, 158, 232, 77, 254, 84, 144, 148, 40, 90, 210, 153, 172, 4, 153, 221, 117,
-    179, 32, 248, 1, 107, 253, 88, 153, 173, 140, 87, 65, 246, 85, 195, 230, 59, 34, 146, 117, 248, 67, 189, 193, 246,
-    140, 131, 246, 56, 185, 41, 39, 48, 176, 237, 43, 225, 179, 205, 7, 150, 75, 73, 58, 62, 147, 109, 175, 173, 88,
-    155, 107, 253, 189, 166, 48, 78, 202, 101, 29, 1, 173, 97, 249, 172, 249, 254, 121, 242, 250, 200, 234, 28, 169, 63,
-    166, 32, 113, 136, 210, 116, 23, 21, 57, 59, 202, 102, 177, 75, 141, 80, 236, 9, 214, 43, 52, 189, 73, 254, 179,
-    104, 39, 119, 108, 73, 131, 113, 32, 250, 252, 24, 57, 64, 35, 62, 110, 45, 231, 112, 81, 133, 75, 248, 237, 208,
-    118, 198, 169, 155, 32, 8, 40, 61, 18, 101, 182, 215, 247, 86, 38, 91, 19, 226, 202, 188, 94, 75, 49, 255, 251, 78,
-    52, 86, 243, 13, 227, 3, 125, 116, 254, 1, 161, 27, 242, 12, 144, 238, 193, 160, 199, 213, 248, 78, 140, 68, 20,
-    187, 248, 200, 9, 118, 30, 227, 36, 144, 115, 113, 232, 210, 20, 89, 3, 158, 213, 216, 206, 105, 165, 41, 83, 39,
-    47, 183, 38, 214, 180, 183, 228, 66, 174, 236, 175, 53, 48, 208, 215, 90, 165, 147, 48, 163, 237, 247, 208, 187, 18,
-    237, 75, 160, 246, 143, 228, 189, 155, 173, 131, 192, 44, 186, 149, 45, 104, 182, 171, 229, 253, 229, 226, 144, 207,
-    65, 33, 69, 130, 183, 35, 94, 177, 155, 29, 74, 186, 246, 49, 131, 101, 247, 32, 114, 6, 59, 155, 15, 209, 250, 197,
-    15, 43, 90, 77, 100, 229, 183, 10, 74, 102, 90, 4, 136, 10, 149, 222, 33, 3, 177, 80, 109, 228, 172, 49, 95, 53,
-    139, 223, 200, 195, 73, 110, 200, 109, 236, 17, 107, 202, 184, 177, 32, 201, 239, 175, 84, 210, 205, 97, 188, 31,
-    103, 30, 171, 92, 22, 248, 202, 135, 193, 171, 216, 152, 218, 208, 178, 215, 148, 73, 219, 143, 47, 230, 53, 98, 19,
-    117, 170, 69, 128, 129, 131, 76, 207, 212, 171, 200, 121, 200, 28, 253, 30, 196, 73, 151, 22, 222, 21, 68, 183, 115,
-    194, 239, 203, 70, 242, 178, 86, 193, 252, 125, 196, 143, 52, 196, 249, 44, 154, 158, 52, 156, 222, 230, 102, 172,
-    146, 23, 94, 112, 35, 252, 132, 193, 134, 63, 31, 244, 234, 216, 218, 16, 223, 185, 245, 182, 181, 99, 218, 241,
-    217, 242, 171, 50, 57, 244, 136, 167, 249, 56, 216, 200, 246, 45, 190, 181, 247, 179, 120, 42, 135, 225, 46, 232,
-    81, 34, 4, 158, 130, 63, 154, 72, 144, 123, 195, 119, 103, 88, 17, 51, 219, 12, 73, 230, 135, 73, 252, 81, 208, 84,
-    139, 193, 14, 148, 253, 151, 147, 171, 216, 20, 129, 210, 170, 236, 205, 22, 254, 92, 215, 189, 66, 86, 226, 42,
-    204, 199, 109, 89, 10, 79, 18, 24, 195, 242, 101, 225, 194, 30, 205, 92, 250, 18, 165, 24, 214, 42, 19, 234, 240,
-    18, 131, 210, 174, 11, 74, 134, 42, 111, 134, 82, 132, 215, 109, 25, 116, 223, 50, 145, 69, 151, 230, 85, 2, 184,
-    76, 53, 55, 177, 150, 71, 65, 57, 49, 164, 64, 105, 65, 157, 190, 191, 201, 96, 122, 69, 61, 172, 247, 133, 68, 249,
-    101, 113, 64, 51, 215, 184, 99, 97, 34, 180, 252, 172, 236, 18, 109, 53, 220, 227, 88, 134, 87, 65, 51, 207, 87, 61,
-    226, 26, 115, 42, 68, 151, 97, 69, 253, 244, 183, 210, 164, 116, 184, 99, 207, 183, 140, 220, 0, 150, 16, 128, 104,
-    18, 66, 228, 18, 200, 142, 167, 100, 62, 159, 199, 244, 61, 191, 123, 8, 48, 37, 147, 237, 66, 37, 170, 204, 238,
-    151, 221, 206, 114, 91, 160, 210, 86, 41, 174, 172, 77, 57, 0, 97, 135, 238, 39, 26, 170, 245, 142, 176, 69, 249,
-    194, 93, 177, 96, 204, 125, 13, 160, 57, 137, 211, 150, 243, 197, 78, 167, 137, 7, 92, 41, 237, 21, 25, 156, 11,
-    110, 132, 139, 100, 165, 171, 143, 251, 185, 72, 229, 0, 197, 125, 24, 244, 192, 196, 10, 215, 15, 114, 2, 236, 235,
-    175, 198, 80, 188, 131, 149, 195, 31, 126, 106, 44, 232, 188, 235, 60, 186, 8, 179, 161, 213, 189, 129, 145, 205,
-    161, 22, 56, 124, 148, 29, 150, 162, 160, 244, 170, 42, 144, 64, 225, 209, 48, 203, 18, 1, 250, 74, 57, 114, 178,
-    100, 182, 201, 102, 249, 214, 10, 139, 100, 235, 211, 202, 8, 52, 3, 67, 34, 180, 172, 1, 106, 113, 82, 210, 228,
-    145, 138, 1, 84, 136, 195, 1, 173, 82, 251, 159, 228, 32, 101, 158, 68, 39, 179, 146, 222, 136, 132, 58, 193, 133,
-    230, 15, 108, 175, 121, 140, 122, 122, 62, 65, 78, 222, 112, 251, 96, 19, 97, 66, 51, 243, 244, 149, 225, 23, 248,
-    116, 15, 85, 37, 66, 163, 104, 36, 252, 63, 221, 188, 206, 133, 97, 226, 83, 31, 35, 156, 53, 142, 253, 178, 192,
-    186, 87, 246, 86, 186, 87, 158, 34, 253, 33, 168, 191, 206, 136, 29, 162, 110, 15, 175, 155, 4, 121, 222, 22, 62,
-    79, 217, 75, 97, 131, 122, 43, 105, 164, 25, 19, 241, 87, 24, 44, 243, 2, 54, 29, 186, 94, 234, 175, 160, 185, 45,
-    130, 184, 40, 19, 73, 29, 19, 89, 9, 80, 58, 100, 65, 12, 82, 242, 209, 207, 117, 141, 127, 247, 79, 2, 139, 60,
-    195, 216, 49, 233, 104, 251, 79, 34, 129, 145, 121, 95, 27, 77, 131, 46, 249, 179, 179, 31, 180, 104, 144, 234, 106,
-    150, 79, 144, 117, 73, 88, 131, 216, 118, 176, 163, 246, 45, 187, 173, 197, 38, 255, 208, 0, 15, 104, 126, 90, 224,
-    18, 233, 93, 43, 96, 107, 214, 96, 9, 209, 25, 120, 151, 114, 87, 191, 58, 186, 73, 144, 71, 153, 168, 176, 38, 245,
-    222, 69, 135, 142, 20, 239, 178, 58, 55, 89, 239, 199, 74, 110, 93, 31, 245, 149, 220, 188, 93, 92, 106, 64, 156,
-    63, 212, 161, 70, 87, 102, 222, 185, 51, 115, 24, 183, 228, 252, 95, 122, 13, 253, 210, 240, 78, 234, 58, 243, 31,
-    163, 111, 184, 86, 243, 61, 207, 247, 130, 51, 3, 28, 115, 93, 123, 185, 124, 64, 210, 125, 16, 158, 87, 49, 16,
-    235, 43, 169, 195, 166, 51, 168, 80, 166, 236, 17, 243, 95, 62, 6, 69, 202, 151, 154, 145, 116, 9, 119, 148, 159,
-    27, 221, 254, 102, 157, 159, 228, 144, 123, 148, 23, 147, 124, 198, 206, 101, 89, 21, 147, 63, 133, 18, 237, 12,
-    109, 102, 151, 115, 61, 232, 225, 182, 250, 102, 91, 88, 36, 2, 153, 19, 15, 66, 228, 135, 203, 83, 75, 93, 22, 179,
-    46, 134, 66, 149, 100, 184, 188, 209, 11, 53, 60, 236, 220, 144, 180, 165, 35, 211, 96, 50, 89, 116, 0, 41, 231,
-    213, 238, 136, 91, 127, 132, 172, 174, 245, 243, 61, 83, 72, 222, 137, 99, 81, 208, 200, 101, 141, 165, 119, 232,
-    215, 249, 253, 92, 209, 47, 80, 131, 222, 191, 7, 238, 148, 170, 223, 17, 143, 211, 201, 197, 168, 152, 82, 17, 53,
-    123, 90, 189, 192, 40, 76, 100, 46, 217, 144, 191, 130, 122, 191, 51, 32, 248, 193, 243, 145, 205, 179, 63, 41, 15,
-    22, 191, 110, 37, 54, 172, 104, 174, 188, 32, 32, 47, 89, 247, 45, 27, 91, 53, 144, 181, 106, 82, 184, 144, 107, 1,
-    238, 72, 162, 177, 76, 203, 243, 187, 33, 25, 133, 83, 233, 44, 174, 175, 6, 202, 67, 114, 98, 132, 170, 241, 21,
-    122, 21, 121, 184, 32, 148, 86, 153, 182, 7, 80, 159, 25, 7, 160, 71, 243, 17, 74, 166, 220, 254, 215, 56, 161, 164,
-    152, 66, 75, 125, 217, 184, 5, 224, 150, 50, 167, 179, 203, 35, 173, 110, 58, 24, 112, 225, 180, 152, 255, 205, 51,
-    134, 4, 232, 27, 61, 222, 36, 226, 114, 61, 102, 213, 224, 155, 224, 63, 85, 136, 216, 85, 248, 251, 173, 187, 166,
-    31, 10, 79, 100, 177, 30, 133, 206, 119, 72, 241, 109, 103, 247, 189, 168, 224, 248, 187, 187, 192, 87, 24, 50, 115,
-    76, 13, 83, 114, 85, 1, 66, 139, 62, 151, 154, 43, 184, 26, 30, 100, 45, 200, 183, 56, 148, 132, 196, 33, 217, 110,
-    12, 90, 156, 83, 235, 18, 91, 201, 181, 131, 210, 242, 124, 171, 220, 184, 148, 185, 213, 112, 64, 242, 125, 105,
-    46, 58, 211, 187, 6, 99, 161, 3, 107, 244, 62, 23, 75, 118, 41, 68, 154, 93, 78, 84, 62, 7, 80, 37, 172, 92, 131,
-    142, 225, 84, 139, 41, 140, 77, 131, 173, 147, 83, 111, 177, 168, 249, 254, 227, 115, 38, 48, 143, 70, 248, 103,
-    104, 90, 183, 190, 37, 182, 221, 4, 86, 9, 18, 114, 42, 96, 44, 211, 69, 156, 145, 233, 23, 164, 94, 17, 89, 78,
-    127, 226, 229, 180, 176, 60, 8, 161, 58, 126, 3, 124, 150, 30, 252, 227, 94, 7, 236, 182, 136, 27, 113, 82, 155,
-    174, 251, 167, 14, 40, 127, 91, 137, 165, 28, 60, 88, 9, 88, 55, 103, 203, 84, 88, 227, 175, 165, 231, 155, 25, 66,
-    247, 64, 160, 204, 146, 238, 87, 142, 111, 57, 167, 85, 184, 65, 209, 89, 67, 16, 1, 144, 204, 31, 242, 208, 88, 98,
-    120, 68, 49, 46, 87, 218, 174, 100, 8, 53, 246, 44, 119, 181, 2, 191, 64, 130, 140, 174, 114, 202, 88, 167, 113,
-    244, 249, 47, 170, 135, 254, 28, 83, 156, 238, 112, 113, 113, 19, 134, 86, 41, 45, 173, 190, 58, 116, 255, 90, 9,
-    140, 191, 153, 244, 14, 166, 122, 103, 124, 152, 21, 241, 94, 13, 6, 80, 8, 178, 68, 3, 145, 239, 161, 21, 117, 169,
-    195, 61, 87, 6, 128, 116, 64, 79, 65, 8, 235, 0, 230, 28, 243, 84, 121, 170, 76, 187, 95, 201, 142, 133, 107, 114,
-    101, 242, 89, 56, 57, 184, 24, 137, 95, 29, 241, 21, 202, 207, 218, 135, 157, 45, 110, 106, 115, 94, 5, 239, 244,
-    158, 174, 224, 111, 235, 16, 132, 122, 97, 210, 37, 197, 175, 113, 111, 7, 245, 234, 55, 53, 50, 238, 124, 227, 106,
-    111, 186, 160, 81, 191, 60, 166, 137, 57, 93, 140, 192, 20, 18, 197, 164, 113, 124, 222, 172, 246, 67, 96, 192, 25,
-    117, 156, 102, 87, 203, 115, 30, 97, 223, 159, 22, 17, 246, 225, 184, 161, 101, 194, 94, 200, 33, 218, 107, 102,
-    252, 13, 155, 53, 252, 70, 95, 255, 236, 11, 155, 67, 6, 83, 77, 5, 79, 225, 103, 36, 0, 220, 157, 84, 149, 84, 91,
-    30, 206, 166, 240, 137, 168, 124, 9, 12, 247, 22, 158, 209, 109, 92, 61, 50, 245, 137, 37, 187, 244, 254, 209, 66,
-    191, 155, 172, 194, 6, 144, 143, 163, 89, 73, 213, 117, 240, 238, 184, 255, 91, 13, 188, 11, 246, 169, 120, 228,
-    157, 14, 227, 232, 142, 102, 78, 68, 209, 77, 207, 112, 182, 46, 40, 170, 245, 201, 206, 89, 7, 136, 155, 8, 240,
-    44, 52, 107, 198, 66, 230, 97, 246, 59, 228, 67, 46, 60, 240, 196, 131, 196, 125, 67, 198, 179, 235, 157, 199, 190,
-    16, 223, 86, 199, 242, 16, 253, 181, 79, 13, 173, 226, 226, 236, 5, 0, 89, 92, 58, 191, 240, 103, 121, 7, 238, 51,
-    139, 147, 108, 155, 2, 235, 154, 40, 27, 2, 93, 154, 6, 2, 109, 230, 92, 232, 12, 162, 183, 150, 248, 154, 184, 37,
-    27, 111, 252, 65, 116, 160, 142, 222, 101, 219, 238, 105, 19, 185, 255, 21, 192, 190, 31, 121, 65, 210, 61, 212, 64,
-    99, 234, 186, 127, 30, 122, 56, 101, 74, 33, 19, 160, 153, 17, 120, 93, 85, 65, 141, 67, 8, 49, 203, 184, 124, 180,
-    165, 148, 60, 213, 203, 127, 213, 244, 187, 45, 79, 133, 188, 61, 157, 22, 67, 245, 154, 99, 66, 146, 104, 57, 8,
-    105, 183, 16, 225, 56, 65, 138, 237, 171, 114, 130, 156, 117, 208, 60, 21, 48, 70, 66, 80, 71, 142, 42, 108, 20,
-    191, 153, 30, 21, 166, 253, 207, 138, 20, 127, 126, 150, 81, 8, 138, 11, 243, 132, 18, 193, 215, 176, 13, 88, 73,
-    131, 50, 103, 213, 92, 158, 118, 18, 79, 228, 174, 217, 153, 107, 23, 166, 65, 135, 52, 224, 28, 7, 15, 144, 151,
-    184, 180, 185, 29, 2, 178, 88, 173, 234, 187, 114, 114, 248, 4, 168, 75, 11, 73, 170, 32, 76, 195, 89, 159, 161,
-    155, 55, 106, 61, 200, 50, 208, 98, 73, 198, 35, 56, 30, 178, 24, 39, 199, 80, 247, 45, 252, 3, 51, 122, 127, 159,
-    79, 149, 246, 181, 164, 251, 68, 21, 194, 80, 196, 85, 117, 14, 63, 141, 224, 188, 86, 230, 19, 175, 48, 198, 9, 45,
-    49, 243, 97, 183, 237, 175, 120, 218, 251, 177, 143, 133, 187, 122, 180, 243, 78, 217, 107, 23, 35, 22, 154, 233,
-    119, 196, 72, 230, 128, 195, 100, 136, 60, 127, 248, 164, 223, 175, 202, 172, 115, 94, 82, 6, 250, 175, 117, 244,
-    147, 120, 54, 249, 171, 92, 182, 120, 18, 105, 113, 16, 165, 197, 30, 112, 23, 222, 108, 193, 112, 132, 67, 151, 2,
-    84, 200, 151, 36, 109, 9, 61, 53, 85, 17, 93, 35, 26, 126, 27, 234, 211, 133, 8, 160, 56, 246, 89, 110, 52, 52, 215,
-    249, 110, 190, 84, 23, 5, 1, 250, 186, 146, 127, 212, 67, 1, 79, 58, 160, 113, 238, 202, 111, 153, 166, 72, 105,
-    188, 54, 246, 165, 150, 253, 81, 202, 201, 187, 5, 100, 184, 167, 58, 40, 157, 183, 2, 79, 133, 31, 199, 95, 23,
-    213, 52, 59, 164, 8, 139, 75, 154, 126, 87, 5, 248, 252, 244, 25, 170, 45, 31, 130, 137, 72, 217, 153, 255, 232,
-    178, 22, 57, 252, 176, 71, 157, 207, 158, 57, 232, 169, 157, 140, 37, 224, 157, 139, 8, 109, 235, 9, 79, 45, 91,
-    197, 14, 96, 150, 150, 73, 14, 13, 249, 156, 21, 204, 80, 3, 173, 144, 80, 213, 42, 186, 224, 99, 42, 210, 15, 241,
-    81, 180, 73, 87, 250, 157, 124, 122, 153, 230, 31, 46, 206, 213, 122, 114, 131, 154, 204, 34, 43, 80, 195, 136, 155,
-    195, 92, 192, 171, 199, 69, 46, 85, 106, 157, 122, 242, 247, 156, 177, 146, 158, 108, 200, 71, 131, 53, 107, 91, 70,
-    141, 255, 231, 135, 238, 132, 194, 77, 67, 60, 8, 137, 243, 231, 34, 105, 248, 73, 58, 195, 194, 26, 35, 119, 159,
-    77, 16, 249, 189, 127, 21, 42, 12, 156, 32, 39, 199, 108, 68, 82, 19, 88, 49, 249, 77, 197, 175, 143, 216, 101, 238,
-    151, 96, 206, 92, 230, 81, 145, 75, 214, 21, 248, 59, 179, 22, 222, 211, 133, 44, 62, 188, 33, 177, 120, 166, 144,
-    142, 41, 71, 74, 101, 70, 235, 82, 168, 242, 115, 209, 143, 196, 162, 52, 236, 99, 50, 144, 240, 128, 141, 29, 157,
-    55, 101, 83, 94, 168, 96, 187, 47, 55, 129, 27, 52, 85, 141, 233, 108, 75, 44, 65, 222, 54, 62, 163, 214, 249, 179,
-    223, 137, 98, 182, 58, 141, 87, 107, 221, 13, 229, 120, 81, 56, 48, 118, 210, 92, 254, 103, 14, 213, 119, 219, 178,
-    2, 94, 27, 206, 201, 174, 180, 193, 6, 17, 136, 161, 140, 95, 150, 31, 113, 34, 115, 55, 181, 119, 221, 205, 252,
-    71, 140, 11, 70, 15, 38, 20, 248, 6, 218, 14, 3, 5, 70, 154, 255, 152, 57, 195, 242, 187, 201, 202, 42, 86, 142,
-    247, 19, 139, 87, 13, 9, 182, 211, 44, 33, 215, 246, 116, 71, 211, 175, 131, 93, 131, 131, 205, 14, 130, 227, 197,
-    147, 98, 158, 134, 137, 203, 13, 96, 203, 149, 160, 223, 247, 186, 38, 91, 98, 212, 104, 133, 174, 234, 210, 134,
-    190, 226, 104, 169, 23, 135, 253, 106, 39, 147, 37, 141, 91, 232, 189, 160, 174, 204, 104, 77, 197, 109, 166, 252,
-    191, 246, 174, 231, 215, 52, 105, 110, 30, 16, 78, 27, 141, 10, 199, 74, 218, 21, 132, 222, 137, 105, 246, 153, 157,
-    93, 239, 101, 92, 181, 162, 179, 34, 236, 35, 150, 83, 4, 223, 204, 80, 43, 66, 95, 139, 39, 165, 40, 237, 37, 72,
-    132, 53, 149, 254, 47, 169, 131, 231, 137, 243, 73, 98, 69, 13, 56, 117, 103, 205, 147, 252, 236, 80, 18, 145, 56,
-    66, 193, 1, 39, 115, 159, 33, 24, 100, 233, 83, 173, 149, 216, 253, 53, 212, 214, 0, 59, 173, 26, 85, 183, 104, 238,
-    102, 8, 172, 208, 40, 128, 218, 57, 92, 62, 186, 246, 68, 95, 220, 208, 176, 206, 66, 111, 233, 231, 48, 206, 141,
-    159, 165, 38, 9, 30, 188, 130, 104, 237, 246, 239, 32, 205, 161, 72, 111, 112, 68, 86, 131, 196, 200, 253, 9, 92,
-    236, 21, 118, 134, 239, 223, 193, 182, 41, 199, 39, 178, 76, 140, 249, 200, 55, 55, 212, 15, 182, 233, 221, 99, 134,
-    205, 194, 124, 42, 189, 213, 8, 83, 68, 19, 139, 98, 251, 230, 12, 48, 238, 107, 246, 192, 125, 106, 180, 202, 125,
-    226, 2, 232, 104, 238, 25, 151, 31, 34, 69, 51, 42, 126, 84, 180, 37, 93, 249, 1, 229, 128, 77, 148, 121, 4, 240,
-    67, 250, 172, 95, 73, 194, 35, 230, 39, 39, 245, 144, 135, 228, 68, 42, 26, 171, 234, 251, 94, 129, 232, 94, 63, 23,
-    160, 187, 25, 16, 120, 234, 27, 12, 104, 203, 71, 227, 48, 248, 225, 195, 117, 216, 169, 15, 131, 139, 12, 226, 105,
-    165, 122, 187, 9, 5, 213, 198, 242, 116, 225, 2, 21, 106, 183, 117, 220, 132, 134, 85, 147, 167, 250, 134, 189, 95,
-    200, 150, 207, 127, 248, 14, 155, 202, 66, 217, 6, 148, 63, 111, 4, 254, 98, 84, 249, 121, 220, 208, 193, 113, 166,
-    159, 140, 144, 200, 82, 211, 193, 29, 237, 44, 235, 214, 127, 35, 23, 9, 198, 22, 120, 189, 193, 149, 161, 16, 237,
-    50, 6, 176, 167, 113, 143, 128, 124, 245, 255, 148, 228, 46, 184, 126, 31, 154, 216, 105, 249, 174, 7, 226, 9, 1,
-    178, 92, 243, 67, 176, 18, 106, 61, 203, 209, 22, 39, 199, 85, 33, 146, 98, 31, 25, 0, 99, 106, 104, 47, 30, 103,
-    141, 219, 80, 86, 110, 204, 254, 110, 165, 68, 109, 75, 144, 53, 123, 242, 117, 219, 105, 231, 43, 162, 168, 153,
-    42, 133, 173, 205, 170, 161, 248, 220, 5, 15, 178, 226, 38, 10, 47, 149, 71, 148, 25, 27, 221, 165, 24, 185, 101,
-    159, 79, 122, 106, 215, 242, 143, 183, 90, 6, 54, 68, 233, 194, 7, 207, 136, 46, 196, 156, 106, 125, 72, 136, 172,
-    123, 171, 144, 193, 182, 188, 115, 46, 160, 0, 189, 20, 242, 249, 9, 76, 72, 68, 9, 66, 167, 23, 82, 164, 70, 186,
-    42, 7, 65, 90, 128, 109, 16, 20, 240, 144, 231, 10, 127, 173, 68, 65, 47, 80, 230, 16, 186, 129, 201, 13, 64, 28,
-    196, 200, 27, 167, 86, 157, 233, 241, 211, 247, 119, 200, 106, 242, 188, 86, 141, 143, 109, 105, 220, 165, 171, 124,
-    18, 245, 100, 127, 144, 163, 74, 240, 96, 38, 235, 245, 2, 195, 46, 203, 246, 250, 54, 89, 234, 15, 146, 28, 207,
-    145, 110, 94, 168, 143, 239, 208, 23, 14, 228, 194, 67, 204, 118, 210, 131, 68, 127, 138, 132, 43, 68, 184, 75, 216,
-    235, 234, 113, 14, 16, 192, 252, 17, 148, 191, 207, 106, 77, 167, 203, 147, 87, 185, 15, 172, 235, 191, 62, 48, 35,
-    75, 175, 199, 14, 156, 49, 247, 73, 62, 94, 126, 221, 224, 199, 80, 141, 112, 162, 127, 96, 15, 135, 99, 131, 207,
-    117, 255, 248, 129, 189, 242, 7, 56, 60, 34, 248, 84, 123, 113, 67, 225, 146, 185, 90, 176, 180, 240, 57, 46, 71,
-    250, 71, 105, 110, 194, 213, 164, 131, 199, 223, 183, 23, 61, 250, 27, 35, 162, 202, 255, 133, 198, 216, 210, 28,
-    93, 166, 210, 39, 115, 46, 250, 36, 204, 251, 168, 172, 32, 30, 14, 69, 36, 125, 146, 41, 63, 79, 32, 50, 159, 66,
-    108, 235, 98, 218, 248, 43, 215, 171, 165, 223, 246, 216, 159, 175, 233, 30, 20, 116, 249, 122, 123, 155, 9, 184,
-    152, 248, 208, 17, 22, 155, 56, 93, 26, 24, 241, 159, 101, 17, 174, 71, 71, 160, 225, 1, 12, 124, 131, 101, 84, 92,
-    124, 249, 237, 199, 188, 225, 242, 242, 33, 239, 220, 60, 36, 48, 47, 53, 124, 241, 31, 230, 4, 106, 138, 178, 39,
-    184, 10, 255, 100, 230, 107, 40, 90, 54, 13, 154, 113, 159, 149, 28, 142, 249, 188, 120, 160, 235, 122, 1, 96, 142,
-    90, 90, 22, 189, 16, 140, 244, 101, 86, 170, 229, 30, 165, 236, 208, 3, 251, 37, 40, 2, 169, 40, 42, 47, 93, 216,
-    213, 251, 64, 250, 94, 46, 121, 90, 6, 239, 32, 231, 48, 162, 131, 69, 31, 123, 110, 5, 14, 187, 118, 36, 230, 50,
-    144, 192, 94, 54, 240, 220, 58, 92, 223, 136, 4, 156, 148, 167, 4, 10, 227, 218, 71, 90, 136, 121, 163, 105, 204,
-    54, 124, 85, 142, 150, 140, 181, 241, 185, 14, 147, 79, 146, 57, 23, 78, 237, 52, 122, 244, 58, 33, 213, 48, 96, 84,
-    69, 95, 145, 165, 1, 116, 197, 172, 95, 254, 250, 152, 163, 91, 110, 138, 69, 118, 111, 101, 198, 245, 234, 176, 38,
-    33, 39, 75, 69, 158, 109, 127, 137, 152, 13, 93, 97, 41, 62, 118, 132, 72, 27, 154, 187, 79, 253, 224, 33, 22, 219,
-    57, 148, 65, 208, 87, 177, 88, 59, 151, 171, 119, 246, 254, 50, 203, 227, 178, 87, 53, 180, 212, 253, 99, 51, 189,
-    49, 99, 14, 33, 166, 154, 6, 186, 40, 145, 197, 191, 240, 102, 252, 3, 176, 124, 57, 196, 24, 229, 244, 79, 116,
-    135, 54, 1, 3, 148, 209, 112, 247, 200, 253, 97, 81, 191, 157, 188, 145, 116, 176, 237, 150, 118, 141, 234, 199, 67,
-    42, 63, 150, 181, 13, 138, 8, 92, 88, 191, 55, 116, 157, 111, 180, 58, 95, 255, 33, 116, 80, 58, 136, 60, 58, 179,
-    17, 74, 55, 170, 84, 231, 220, 2, 35, 169, 104, 226, 35, 207, 206, 11, 13, 41, 84, 229, 172, 42, 210, 223, 63, 110,
-    219, 247, 147, 128, 200, 10, 42, 143, 19, 103, 17, 251, 42, 216, 59, 95, 255, 29, 109, 103, 35, 214, 156, 157, 125,
-    12, 59, 35, 115, 230, 210, 190, 185, 215, 195, 27, 182, 147, 46, 74, 22, 93, 15, 172, 238, 126, 205, 108, 115, 12,
-    126, 243, 169, 79, 173, 203, 252, 113, 246, 129, 128, 253, 222, 143, 208, 225, 240, 4, 52, 17, 57, 2, 101, 206, 213,
-    0, 141, 213, 23, 166, 170, 250, 36, 163, 122, 86, 201, 220, 114, 25, 98, 103, 242, 129, 2, 115, 245, 122, 200, 205,
-    22, 157, 244, 53, 55, 124, 13, 220, 185, 126, 160, 245, 172, 114, 136, 165, 41, 76, 62, 235, 93, 150, 62, 2, 245,
-    212, 211, 54, 231, 199, 96, 189, 183, 72, 171, 28, 124, 201, 111, 132, 194, 137, 217, 71, 196, 56, 132, 247, 111,
-    188, 13, 197, 34, 134, 0, 180, 65, 234, 58, 96, 109, 154, 126, 229, 186, 112, 59, 184, 93, 10, 3, 66, 219, 161, 183,
-    244, 55, 143, 212, 65, 14, 139, 52, 207, 82, 66, 175, 253, 235, 16, 24, 87, 109, 4, 155, 30, 214, 26, 3, 211, 120,
-    58, 223, 143, 72, 201, 30, 254, 73, 46, 106, 191, 164, 31, 218, 222, 80, 165, 244, 41, 35, 190, 233, 144, 216, 131,
-    46, 3, 105, 226, 99, 49, 46, 20, 24, 156, 226, 195, 102, 32, 158, 63, 110, 4, 187, 91, 21, 101, 187, 32, 174, 152,
-    135, 236, 243, 70, 30, 66, 23, 67, 66, 79, 203, 87, 214, 67, 201, 182, 42, 6, 170, 185, 155, 21, 28, 49, 206, 248,
-    244, 97, 250, 16, 181, 96, 157, 9, 51, 164, 178, 20, 202, 75, 191, 185, 75, 8, 56, 126, 173, 201, 86, 151, 148, 43,
-    189, 224, 99, 146, 50, 211, 85, 135, 34, 242, 239, 77, 251, 5, 120, 136, 60, 41, 25, 248, 62, 127, 135, 13, 159,
-    104, 200, 47, 79, 189, 61, 116, 10, 205, 36, 7, 231, 33, 222, 191, 72, 58, 235, 131, 216, 15, 99, 227, 35, 237, 84,
-    172, 173, 41, 183, 250, 1, 55, 81, 101, 188, 73, 171, 235, 39, 9, 52, 33, 139, 134, 233, 84, 237, 100, 157, 185,
-    217, 86, 39, 61, 36, 243, 206, 42, 253, 2, 255, 130, 127, 94, 52, 93, 241, 35, 181, 125, 189, 123, 173, 70, 74, 193,
-    196, 116, 39, 249, 81, 184, 188, 32, 184, 172, 102, 17, 166, 47, 104, 174, 27, 126, 244, 78, 5, 229, 178, 154, 205,
-    146, 70, 154, 21, 89, 116, 254, 101, 192, 32, 229, 16, 71, 55, 137, 85, 31, 0, 255, 243, 73, 25, 186, 156, 153, 207,
-    142, 76, 42, 24, 213, 61, 212, 171, 251, 152, 181, 186, 218, 62, 217, 88, 201, 201, 175, 177, 123, 228, 57, 36, 169,
-    208, 120, 154, 192, 130, 67, 249, 32, 98, 209, 167, 232, 223, 238, 31, 188, 207, 154, 78, 220, 38, 61, 4, 48, 222,
-    154, 117, 92, 116, 177, 245, 255, 31, 129, 246, 79, 96, 200, 228, 190, 5, 98, 38, 223, 23, 149, 4, 129, 12, 199, 87,
-    73, 93, 17, 123, 159, 35, 193, 125, 47, 190, 172, 172, 130, 25, 219, 76, 37, 105, 88, 66, 129, 88, 45, 213, 65, 239,
-    130, 87, 179, 118, 140, 233, 56, 70, 146, 168, 187, 49, 51, 14, 79, 107, 246, 133, 125, 247, 128, 29, 227, 115, 83,
-    6, 149, 58, 164, 114, 124, 237, 59, 60, 89, 123, 61, 150, 72, 112, 130, 67, 241, 45, 161, 127, 14, 173, 112, 203,
-    94, 98, 98, 127, 129, 33, 107, 90, 148, 178, 31, 9, 170, 231, 12, 248, 215, 16, 122, 150, 105, 188, 41, 210, 138,
-    114, 176, 145, 6, 194, 225, 3, 174, 45, 58, 78, 240, 68, 255, 168, 93, 189, 77, 165, 213, 224, 239, 47, 31, 69, 84,
-    252, 112, 23, 0, 209, 3, 217, 8, 37, 142, 207, 16, 112, 80, 218, 121, 105, 231, 40, 128, 154, 118, 0, 128, 13, 113,
-    18, 222, 239, 174, 38, 228, 173, 152, 228, 222, 204, 44, 190, 65, 134, 54, 146, 236, 52, 6, 241, 53, 241, 146, 124,
-    93, 90, 159, 149, 173, 13, 81, 63, 122, 219, 60, 140, 89, 126, 128, 162, 89, 182, 237, 222, 88, 128, 181, 204, 184,
-    45, 7, 19, 66, 195, 216, 236, 63, 24, 249, 56, 71, 153, 155, 62, 87, 75, 200, 186, 46, 233, 233, 202, 88, 184, 228,
-    11, 206, 14, 182, 189, 73, 40, 205, 34, 253, 146, 175, 95, 3, 206, 24, 154, 123, 83, 37, 33, 210, 159, 172, 166,
-    213, 151, 42, 235, 71, 203, 172, 216, 188, 186, 14, 54, 72, 118, 225, 44, 174, 86, 55, 57, 112, 13, 81, 172, 86,
-    144, 56, 145, 40, 85, 66, 139, 63, 74, 177, 15, 16, 182, 140, 93, 5, 161, 3, 19, 209, 209, 226, 227, 246, 27, 29,
-    254, 131, 145, 171, 156, 183, 142, 192, 94, 69, 23, 70, 190, 214, 119, 78, 174, 68, 241, 4, 89, 86, 187, 129, 103,
-    90, 181, 129, 116, 16, 35, 136, 147, 100, 7, 87, 86, 211, 61, 84, 104, 161, 70, 130, 184, 47, 254, 32, 210, 188, 67,
-    147, 163, 107, 93, 159, 45, 22, 2, 24, 31, 25, 154, 127, 78, 68, 222, 223, 248, 207, 108, 101, 13, 174, 102, 232,
-    34, 8, 113, 191, 190, 73, 112, 76, 122, 71, 53, 241, 106, 212, 164, 136, 0, 50, 55, 67, 137, 242, 255, 41, 162, 27,
-    155, 13, 132, 84, 254, 141, 62, 206, 164, 45, 209, 147, 25, 21, 237, 157, 80, 73, 76, 70, 223, 169, 84, 47, 92, 185,
-    215, 255, 174, 184, 12, 115, 39, 28, 93, 117, 68, 237, 154, 170, 123, 252, 238, 236, 39, 103, 39, 161, 209, 9, 97,
-    215, 221, 124, 141, 49, 44, 141, 50, 5, 9, 65, 17, 116, 170, 182, 72, 211, 173, 237, 83, 27, 9, 37, 89, 194, 52,
-    187, 234, 12, 243, 171, 186, 172, 255, 39, 188, 166, 212, 224, 247, 160, 166, 190, 132, 156, 200, 163, 31, 42, 9, 6,
-    48, 186, 157, 43, 141, 5, 46, 109, 40, 59, 206, 40, 4, 214, 22, 170, 149, 62, 50, 87, 182, 17, 115, 22, 155, 180,
-    164, 106, 83, 231, 50, 196, 199, 28, 70, 167, 16, 154, 58, 153, 126, 25, 228, 42, 72, 248, 177, 136, 40, 225, 10,
-    137, 141, 144, 18, 111, 179, 37, 127, 123, 45, 243, 149, 145, 60, 150, 117, 136, 194, 98, 55, 223, 39, 87, 178, 155,
-    228, 191, 181, 237, 3, 112, 242, 8, 82, 195, 179, 80, 93, 40, 244, 214, 28, 24, 182, 13, 28, 254, 147, 185, 119, 27,
-    122, 32, 132, 190, 157, 105, 216, 155, 216, 62, 61, 222, 177, 178, 159, 49, 130, 247, 187, 32, 146, 125, 76, 144,
-    193, 153, 254, 37, 216, 181, 233, 171, 206, 69, 235, 238, 60, 141, 130, 83, 211, 191, 131, 168, 5, 40, 150, 75, 186,
-    21, 100, 173, 0, 210, 55, 47, 27, 147, 218, 108, 147, 247, 87, 106, 216, 27, 56, 104, 39, 22, 12, 80, 171, 213, 21,
-    5, 13, 129, 238, 161, 215, 17, 171, 237, 250, 107, 210, 68, 127, 65, 226, 89, 101, 165, 228, 216, 163, 133, 61, 243,
-    134, 97, 220, 147, 219, 91, 250, 167, 138, 212, 27, 76, 140, 61, 170, 251, 80, 29, 22, 136, 28, 219, 221, 49, 75,
-    104, 91, 136, 209, 38, 212, 251, 103, 96, 143, 82, 177, 140, 121, 24, 120, 221, 3, 75, 255, 45, 141, 31, 209, 158,
-    81, 29, 66, 32, 239, 30, 16, 70, 163, 126, 14, 142, 122, 159, 188, 105, 74, 27, 193, 130, 10, 77, 58, 157, 4, 67,
-    23, 97, 207, 127, 194, 220, 160, 102, 218, 153, 240, 22, 97, 255, 20, 30, 38, 127, 105, 30, 19, 112, 212, 87, 160,
-    196, 5, 99, 65, 166, 186, 255, 12, 103, 54, 40, 197, 238, 193, 60, 161, 27, 198, 102, 158, 77, 35, 23, 161, 161,
-    169, 39, 173, 226, 243, 8, 239, 153, 196, 165, 45, 255, 45, 16, 12, 182, 72, 210, 240, 145, 10, 155, 98, 106, 59,
-    142, 44, 55, 23, 162, 72, 84, 87, 120, 236, 98, 118, 84, 128, 186, 151, 252, 153, 138, 14, 64, 170, 192, 215, 149,
-    158, 195, 11, 189, 54, 213, 38, 54, 178, 22, 194, 185, 24, 70, 90, 228, 35, 31, 239, 232, 52, 197, 229, 203, 18,
-    197, 129, 79, 131, 13, 58, 103, 142, 142, 242, 82, 151, 152, 240, 36, 153, 110, 244, 249, 178, 10, 81, 114, 130,
-    167, 172, 236, 134, 54, 87, 152, 219, 78, 35, 202, 189, 118, 218, 221, 120, 165, 100, 90, 179, 160, 133, 23, 104,
-    147, 190, 165, 191, 47, 142, 46, 170, 143, 103, 214, 117, 247, 12, 211, 172, 92, 25, 166, 115, 129, 201, 151, 90,
-    104, 233, 183, 203, 128, 230, 30, 23, 241, 230, 137, 214, 144, 242, 142, 228, 31, 14, 112, 94, 151, 170, 20, 187,
-    175, 35, 86, 224, 192, 192, 206, 25, 32, 51, 152, 77, 83, 205, 19, 33, 233, 67, 190, 22, 112, 96, 185, 125, 175,
-    225, 102, 199, 187, 31, 168, 228, 226, 164, 117, 145, 61, 120, 221, 202, 138, 138, 243, 110, 192, 219, 168, 177, 84,
-    133, 110, 253, 128, 7, 217, 166, 178, 195, 194, 210, 117, 232, 96, 213, 214, 155, 158, 252, 86, 253, 191, 157, 75,
-    115, 185, 197, 167, 16, 36, 120, 58, 227, 173, 25, 145, 194, 106, 114, 156, 100, 250, 77, 142, 24, 159, 155, 0, 188,
-    213, 125, 213, 21, 143, 197, 194, 96, 191, 221, 218, 79, 179, 237, 107, 1, 40, 204, 109, 11, 2, 115, 19, 63, 52,
-    119, 143, 237, 229, 83, 78, 224, 10, 70, 198, 204, 157, 48, 226, 222, 114, 161, 213, 211, 165, 26, 142, 73, 15, 1,
-    156, 253, 50, 90, 101, 192, 229, 133, 127, 233, 88, 156, 29, 170, 192, 237, 222, 166, 28, 61, 133, 175, 219, 233,
-    20, 230, 13, 211, 188, 124, 4, 111, 118, 8, 190, 74, 26, 243, 204, 109, 118, 64, 22, 181, 150, 162, 107, 113, 17,
-    38, 245, 59, 52, 105, 129, 190, 37, 204, 158, 168, 147, 250, 14, 22, 97, 80, 68, 170, 46, 21, 98, 239, 122, 114,
-    183, 99, 237, 23, 177, 96, 44, 14, 19, 235, 129, 23, 244, 96, 245, 18, 141, 81, 35, 176, 32, 171, 184, 157, 239,
-    109, 34, 61, 74, 235, 78, 221, 81, 184, 83, 66, 231, 51, 250, 201, 40, 115, 238, 168, 142, 254, 116, 114, 9, 23,
-    169, 12, 200, 203, 111, 30, 127, 189, 152, 170, 215, 62, 243, 96, 106, 35, 151, 229, 225, 239, 25, 72, 234, 81, 143,
-    20, 91, 53, 199, 188, 109, 209, 58, 24, 127, 240, 70, 30, 200, 121, 170, 51, 122, 100, 179, 12, 141, 50, 122, 185,
-    19, 145, 253, 135, 220, 151, 79, 159, 54, 195, 77, 129, 25, 212, 176, 96, 124, 248, 114, 34, 171, 82, 221, 149, 125,
-    232, 236, 194, 146, 5, 213, 1, 180, 218, 73, 38, 228, 200, 62, 143, 171, 74, 69, 133, 226, 214, 142, 228, 19, 160,
-    163, 200, 102, 44, 128, 55, 26, 136, 15, 141, 116, 143, 31, 59, 50, 79, 101, 128, 125, 41, 1, 175, 104, 254, 243,
-    20, 222, 195, 37, 121, 139, 185, 143, 222, 237, 222, 79, 141, 237, 140, 2, 141, 133, 173, 38, 85, 15, 232, 43, 241,
-    202, 218, 51, 143, 198, 121, 106, 136, 63, 92, 182, 227, 76, 157, 27, 133, 163, 214, 129, 18, 9, 87, 162, 41, 182,
-    121, 84, 187, 234, 197, 50, 98, 34, 200, 246, 143, 251, 195, 204, 18, 203, 70, 22, 254, 26, 26, 225, 211, 92, 231,
-    170, 24, 24, 129, 167, 197, 230, 130, 211, 78, 103, 151, 129, 36, 113, 245, 27, 122, 75, 105, 173, 112, 124, 173,
-    79, 50, 108, 131, 233, 248, 177, 172, 171, 80, 119, 102, 165, 85, 211, 60, 174, 119, 175, 183, 150, 12, 76, 31, 176,
-    17, 186, 75, 93, 49, 16, 234, 101, 106, 28, 65, 178, 75, 164, 136, 192, 184, 194, 0, 16, 167, 115, 188, 15, 10, 191,
-    226, 44, 148, 6, 184, 209, 92, 126, 105, 91, 42, 63, 74, 236, 124, 58, 154, 148, 169, 229, 163, 26, 18, 19, 84, 17,
-    223, 182, 66, 197, 52, 182, 180, 42, 224, 168, 65, 107, 105, 94, 9, 15, 85, 153, 43, 18, 19, 155, 39, 114, 127, 51,
-    134, 217, 211, 87, 124, 171, 148, 14, 98, 0, 26, 222, 90, 88, 51, 149, 96, 8, 7, 49, 110, 239, 154, 152, 96, 242,
-    76, 148, 34, 229, 24, 114, 242, 48, 146, 93, 96, 141, 68, 72, 149, 125, 138, 186, 219, 239, 67, 255, 173, 89, 225,
-    155, 187, 104, 205, 185, 103, 125, 210, 219, 155, 209, 229, 161, 232, 237, 180, 184, 62, 63, 80, 224, 87, 170, 116,
-    35, 42, 149, 208, 194, 230, 192, 226, 30, 87, 148, 50, 170, 33, 182, 124, 95, 95, 37, 128, 167, 147, 174, 51, 76,
-    127, 12, 103, 255, 56, 166, 138, 54, 141, 0, 167, 10, 194, 10, 169, 12, 243, 15, 183, 194, 33, 98, 229, 15, 35, 116,
-    83, 97, 89, 131, 99, 65, 58, 120, 134, 208, 101, 239, 73, 236, 253, 171, 56, 83, 86, 138, 95, 212, 134, 116, 182,
-    182, 129, 86, 89, 230, 45, 109, 146, 73, 103, 32, 118, 130, 250, 178, 103, 171, 128, 86, 66, 111, 86, 26, 53, 167,
-    192, 235, 87, 163, 48, 169, 206, 164, 176, 29, 94, 128, 17, 103, 227, 129, 108, 219, 44, 192, 158, 14, 152, 47, 121,
-    173, 57, 106, 120, 133, 110, 234, 145, 208, 225, 79, 197, 32, 161, 34, 50, 70, 154, 13, 186, 200, 26, 248, 164, 176,
-    137, 162, 223, 91, 230, 158, 226, 18, 215, 44, 44, 18, 67, 8, 154, 134, 42, 148, 231, 131, 213, 228, 155, 189, 81,
-    167, 159, 160, 211, 171, 131, 130, 68, 149, 30, 48, 162, 237, 43, 35, 95, 36, 37, 207, 115, 221, 110, 17, 82, 149,
-    185, 190, 143, 246, 120, 43, 103, 75, 70, 130, 121, 116, 199, 232, 57, 212, 101, 132, 217, 40, 159, 109, 238, 230,
-    204, 4, 161, 109, 57, 119, 197, 145, 238, 57, 72, 244, 96, 53, 196, 38, 180, 27, 6, 248, 165, 162, 223, 245, 73,
-    118, 183, 52, 157, 15, 20, 252, 215, 8, 29, 81, 206, 164, 224, 59, 168, 126, 187, 53, 35, 71, 168, 63, 16, 126, 243,
-    217, 218, 121, 79, 29, 210, 238, 200, 208, 88, 134, 240, 251, 71, 62, 24, 175, 191, 226, 37, 191, 4, 73, 244, 229,
-    110, 187, 149, 216, 216, 112, 103, 79, 207, 171, 126, 221, 45, 182, 162, 104, 108, 179, 19, 1, 173, 186, 72, 114,
-    24, 105, 125, 85, 212, 125, 171, 237, 224, 172, 100, 244, 157, 62, 63, 107, 114, 13, 121, 255, 154, 246, 123, 16,
-    25, 113, 56, 183, 154, 228, 209, 13, 120, 159, 224, 147, 102, 139, 40, 163, 183, 67, 6, 42, 171, 185, 162, 134, 50,
-    51, 228, 131, 224, 25, 99, 58, 202, 44, 198, 92, 91, 8, 250, 177, 148, 127, 249, 236, 92, 231, 47, 71, 225, 228,
-    229, 106, 236, 39, 223, 191, 204, 115, 118, 127, 24, 40, 244, 250, 108, 33, 101, 125, 223, 159, 81, 166, 19, 155,
-    13, 133, 226, 110, 102, 160, 171, 51, 124, 204, 13, 202, 176, 31, 38, 11, 21, 235, 35, 142, 127, 66, 38, 169, 131,
-    96, 213, 93, 93, 66, 41, 205, 45, 116, 106, 25, 205, 99, 173, 156, 151, 172, 51, 175, 4, 18, 48, 146, 75, 2, 108,
-    163, 145, 51, 125, 251, 25, 180, 7, 162, 137, 232, 146, 241, 76, 199, 223, 108, 93, 78, 184, 177, 125, 108, 192,
-    192, 220, 52, 105, 20, 20, 206, 160, 6, 9, 92, 86, 35, 241, 10, 188, 125, 127, 154, 199, 106, 180, 224, 107, 250,
-    12, 166, 137, 6, 114, 212, 20, 244, 109, 48, 194, 21, 129, 158, 246, 54, 30, 112, 87, 16, 222, 116, 171, 17, 248,
-    208, 190, 240, 164, 7, 211, 170, 202, 90, 222, 94, 74, 115, 67, 151, 68, 119, 191, 228, 75, 217, 40, 15, 24, 76,
-    232, 17, 176, 127, 91, 68, 200, 164, 115, 71, 34, 224, 36, 49, 12, 143, 50, 224, 60, 160, 113, 126, 161, 108, 213,
-    171, 250, 141, 54, 58, 178, 197, 113, 201, 244, 132, 90, 144, 52, 144, 153, 74, 105, 110, 186, 136, 128, 17, 173,
-    69, 159, 164, 28, 112, 38, 170, 203, 50, 93, 111, 251, 160, 64, 243, 120, 65, 24, 119, 233, 202, 0, 120, 103, 186,
-    177, 192, 138, 218, 122, 125, 137, 120, 147, 215, 251, 67, 89, 10, 207, 243, 143, 10, 236, 136, 93, 17, 213, 83,
-    213, 221, 231, 76, 120, 4, 7, 35, 200, 205, 59, 231, 127, 147, 153, 17, 54, 132, 114, 65, 51, 30, 23, 163, 148, 246,
-    240, 211, 172, 48, 179, 186, 108, 167, 138, 197, 155, 246, 139, 228, 64, 165, 173, 204, 72, 159, 213, 11, 145, 47,
-    246, 235, 25, 239, 235, 32, 112, 118, 235, 56, 43, 52, 127, 101, 38, 0, 192, 87, 222, 206, 210, 105, 39, 77, 238,
-    36, 148, 134, 111, 218, 254, 202, 130, 6, 29, 69, 191, 84, 253, 114, 139, 166, 170, 211, 143, 149, 190, 51, 42, 255,
-    27, 226, 7, 254, 55, 25, 173, 43, 94, 206, 207, 133, 121, 115, 198, 220, 76, 154, 114, 139, 23, 161, 140, 175, 254,
-    217, 8, 225, 144, 27, 244, 241, 87, 106, 85, 100, 14, 57, 69, 157, 207, 51, 78, 76, 224, 114, 215, 246, 117, 160,
-    153, 3, 127, 221, 244, 157, 248, 158, 134, 9, 146, 192, 135, 173, 244, 242, 95, 35, 69, 156, 172, 195, 230, 230, 76,
-    239, 55, 207, 203, 217, 130, 197, 145, 205, 140, 12, 137, 203, 185, 182, 53, 6, 117, 125, 191, 148, 71, 31, 58, 24,
-    127, 119, 113, 136, 23, 94, 177, 62, 42, 251, 76, 172, 228, 220, 18, 215, 184, 148, 171, 233, 241, 75, 100, 202,
-    212, 18, 173, 188, 167, 78, 238, 166, 206, 212, 185, 189, 176, 34, 101, 74, 112, 190, 242, 220, 148, 95, 128, 177,
-    247, 23, 99, 220, 123, 199, 47, 60, 141, 186, 172, 197, 94, 26, 91, 210, 238, 5, 48, 116, 105, 205, 249, 174, 93,
-    78, 206, 197, 20, 66, 52, 194, 119, 23, 18, 87, 179, 85, 142, 174, 60, 60, 232, 95, 143, 61, 182, 165, 234, 182, 83,
-    113, 29, 101, 85, 30, 58, 29, 182, 30, 46, 46, 45, 134, 146, 91, 79, 41, 227, 133, 92, 36, 235, 159, 56, 183, 40,
-    216, 254, 100, 133, 168, 4, 12, 192, 255, 166, 204, 168, 35, 3, 98, 231, 7, 82, 202, 12, 48, 166, 171, 61, 72, 32,
-    1, 92, 112, 63, 41, 22, 246, 185, 240, 70, 72, 89, 241, 17, 158, 53, 54, 205, 101, 34, 2, 117, 98, 227, 240, 164,
-    57, 106, 239, 124, 189, 105, 133, 229, 146, 80, 93, 255, 154, 16, 94, 27, 83, 32, 58, 165, 91, 240, 121, 130, 200,
-    9, 175, 60, 183, 186, 244, 192, 219, 24, 213, 10, 237, 72, 218, 19, 145, 78, 143, 182, 11, 20, 193, 166, 240, 139,
-    246, 248, 241, 209, 113, 48, 67, 198, 185, 32, 91, 248, 140, 241, 87, 179, 13, 90, 235, 232, 84, 235, 176, 43, 82,
-    241, 61, 193, 20, 146, 210, 104, 62, 52, 186, 45, 228, 244, 142, 230, 13, 20, 100, 36, 123, 74, 183, 253, 16, 172,
-    192, 31, 25, 144, 232, 10, 79, 113, 35, 0, 246, 7, 104, 245, 77, 233, 228, 41, 58, 93, 220, 75, 239, 43, 97, 159,
-    213, 125, 135, 123, 198, 116, 174, 125, 57, 120, 115, 150, 135, 179, 61, 211, 50, 19, 165, 212, 241, 69, 121, 170,
-    205, 189, 47, 213, 19, 144, 68, 239, 33, 184, 199, 229, 54, 117, 103, 245, 24, 59, 8, 58, 225, 146, 239, 110, 122,
-    156, 54, 226, 141, 117, 208, 4, 225, 215, 136, 130, 68, 176, 61, 244, 117, 201, 119, 143, 148, 228, 146, 16, 5, 171,
-    232, 32, 157, 206, 59, 66, 246, 2, 157, 11, 67, 44, 115, 114, 49, 156, 175, 225, 44, 180, 121, 221, 139, 128, 54,
-    154, 152, 139, 170, 181, 243, 66, 210, 219, 186, 43, 137, 1, 67, 131, 86, 146, 129, 110, 91, 120, 126, 13, 252, 22,
-    91, 251, 35, 98, 201, 241, 35, 163, 157, 232, 250, 32, 50, 240, 154, 116, 242, 66, 22, 70, 13, 208, 185, 191, 197,
-    248, 15, 240, 165, 105, 134, 75, 136, 189, 177, 133, 29, 240, 113, 78, 195, 184, 219, 8, 220, 185, 98, 13, 80, 23,
-    3, 171, 246, 141, 73, 10, 220, 2, 22, 28, 194, 83, 229, 8, 116, 137, 143, 235, 238, 221, 160, 129, 162, 121, 97, 8,
-    133, 15, 183, 210, 132, 75, 253, 156, 134, 211, 63, 201, 131, 125, 194, 92, 216, 166, 132, 222, 225, 251, 172, 163,
-    103, 102, 91, 62, 203, 58, 102, 78, 205, 114, 160, 63, 6, 168, 8, 59, 111, 79, 233, 199, 188, 240, 151, 51, 45, 44,
-    66, 130, 240, 228, 5, 11, 243, 166, 25, 102, 51, 161, 127, 25, 148, 50, 69, 158, 93, 148, 255, 24, 255, 77, 70, 12,
-    158, 253, 217, 123, 30, 201, 137, 53, 243, 26, 58, 175, 197, 106, 110, 85, 66, 70, 174, 24, 102, 164, 213, 209, 138,
-    79, 28, 87, 161, 3, 205, 113, 140, 102, 109, 243, 152, 200, 5, 14, 185, 211, 180, 32, 212, 73, 25, 21, 40, 60, 7,
-    52, 203, 175, 174, 29, 4, 183, 143, 38, 223, 53, 219, 105, 181, 174, 245, 166, 13, 147, 111, 203, 178, 127, 142, 33,
-    220, 97, 209, 56, 215, 193, 166, 128, 250, 58, 237, 3, 169, 192, 88, 144, 232, 58, 216, 72, 241, 242, 75, 246, 59,
-    255, 233, 103, 86, 179, 31, 37, 37, 181, 47, 185, 236, 134, 91, 48, 170, 187, 217, 79, 56, 209, 119, 107, 114, 131,
-    201, 198, 51, 191, 156, 251, 253, 73, 209, 50, 121, 203, 11, 243, 221, 212, 47, 172, 229, 212, 152, 190, 196, 96,
-    156, 148, 144, 81, 117, 168, 46, 192, 215, 106, 213, 0, 130, 40, 9, 173, 26, 205, 61, 233, 163, 74, 245, 247, 100,
-    4, 158, 33, 53, 201, 29, 47, 179, 83, 14, 71, 99, 244, 177, 201, 209, 154, 227, 246, 223, 19, 87, 52, 134, 80, 135,
-    246, 35, 53, 136, 10, 8, 9, 209, 59, 207, 167, 107, 169, 62, 130, 146, 67, 157, 66, 44, 251, 234, 62, 147, 126, 129,
-    193, 128, 0, 89, 7, 3, 144, 195, 159, 162, 112, 208, 141, 23, 239, 82, 69, 32, 199, 152, 138, 7, 167, 255, 235, 227,
-    166, 112, 197, 18, 11, 174, 4, 30, 149, 142, 161, 92, 112, 74, 119, 16, 85, 201, 235, 94, 250, 96, 101, 130, 139,
-    59, 194, 3, 66, 247, 250, 226, 194, 99, 115, 19, 154, 123, 54, 170, 77, 50, 10, 192, 142, 9, 33, 197, 250, 121, 190,
-    174, 120, 120, 145, 12, 97, 158, 47, 52, 129, 225, 204, 11, 101, 162, 152, 15, 56, 77, 157, 2, 255, 108, 91, 250,
-    204, 217, 153, 79, 113, 67, 67, 78, 104, 110, 89, 203, 99, 54, 123, 219, 50, 84, 183, 89, 80, 222, 49, 26, 210, 70,
-    151, 103, 84, 89, 45, 80, 94, 63, 138, 95, 217, 124, 237, 245, 27, 108, 66, 43, 145, 129, 81, 247, 133, 253, 200,
-    149, 138, 7, 116, 245, 108, 30, 156, 161, 38, 160, 142, 177, 66, 143, 208, 176, 90, 30, 131, 88, 51, 29, 229, 134,
-    73, 66, 147, 144, 192, 17, 67, 37, 202, 113, 149, 162, 142, 133, 26, 139, 85, 252, 43, 182, 92, 130, 202, 135, 143,
-    21, 168, 10, 149, 70, 152, 75, 54, 220, 177, 15, 196, 192, 139, 80, 74, 85, 182, 105, 116, 135, 26, 104, 129, 217,
-    180, 211, 57, 105, 198, 145, 172, 219, 42, 77, 85, 166, 31, 14, 150, 130, 16, 155, 1, 78, 84, 90, 162, 54, 1, 46,
-    38, 161, 127, 246, 160, 251, 81, 11, 123, 208, 30, 200, 6, 227, 245, 0, 55, 247, 0, 67, 191, 62, 157, 24, 43, 245,
-    172, 133, 240, 70, 228, 223, 140, 85, 235, 171, 82, 132, 162, 193, 181, 220, 222, 62, 178, 150, 195, 247, 245, 10,
-    52, 240, 189, 223, 151, 158, 184, 49, 245, 87, 191, 92, 31, 76, 56, 153, 202, 146, 57, 56, 111, 241, 167, 15, 19,
-    156, 178, 182, 144, 151, 205, 94, 84, 108, 165, 60, 27, 26, 105, 245, 94, 62, 143, 113, 180, 149, 58, 252, 251, 100,
-    104, 10, 108, 128, 78, 175, 255, 5, 39, 227, 157, 102, 109, 98, 45, 221, 248, 119, 50, 118, 164, 211, 98, 206, 35,
-    196, 223, 12, 113, 125, 119, 171, 246, 253, 92, 159, 217, 0, 244, 148, 240, 17, 56, 253, 168, 59, 240, 58, 228, 96,
-    111, 20, 245, 105, 165, 22, 105, 206, 202, 170, 92, 49, 158, 147, 107, 169, 137, 72, 92, 61, 54, 223, 29, 51, 90,
-    200, 136, 109, 92, 236, 133, 189, 226, 205, 172, 157, 117, 201, 212, 255, 189, 82, 30, 55, 187, 88, 197, 38, 141,
-    197, 250, 104, 94, 119, 99, 172, 164, 117, 145, 138, 237, 95, 248, 173, 115, 220, 50, 189, 128, 239, 122, 154, 7,
-    91, 124, 97, 2, 107, 94, 90, 170, 4, 69, 152, 211, 103, 191, 16, 56, 188, 219, 45, 40, 134, 219, 194, 140, 114, 191,
-    172, 83, 175, 44, 10, 170, 71, 71, 86, 185, 14, 201, 122, 208, 200, 192, 238, 10, 245, 1, 75, 113, 235, 218, 15, 46,
-    79, 114, 179, 45, 173, 159, 198, 189, 14, 127, 101, 206, 181, 20, 43, 211, 194, 115, 189, 17, 157, 80, 95, 36, 148,
-    10, 153, 141, 164, 7, 188, 218, 87, 214, 101, 156, 0, 249, 117, 97, 1, 221, 251, 113, 138, 160, 144, 181, 152, 64,
-    89, 76, 97, 112, 150, 142, 236, 54, 235, 133, 23, 9, 228, 33, 107, 16, 32, 207, 57, 151, 54, 238, 147, 135, 151,
-    195, 240, 149, 206, 30, 74, 88, 110, 155, 213, 62, 97, 243, 143, 55, 103, 92, 65, 127, 213, 83, 42, 86, 231, 72,
-    154, 121, 207, 249, 182, 143, 171, 132, 140, 14, 110, 17, 32, 255, 238, 215, 125, 92, 195, 183, 160, 164, 107, 50,
-    143, 114, 61, 143, 116, 17, 81, 220, 121, 2, 29, 113, 16, 57, 72, 251, 88, 50, 148, 142, 75, 163, 45, 246, 0, 37,
-    91, 74, 64, 27, 132, 94, 114, 28, 53, 208, 182, 99, 225, 82, 122, 158, 56, 41, 157, 20, 32, 169, 36, 203, 145, 217,
-    193, 190, 49, 66, 89, 66, 16, 242, 131, 113, 244, 63, 36, 63, 187, 198, 235, 86, 148, 21, 210, 20, 28, 135, 253,
-    252, 116, 82, 218, 95, 54, 60, 248, 191, 219, 229, 214, 100, 68, 253, 51, 197, 161, 151, 84, 149, 126, 130, 153, 23,
-    129, 43, 224, 254, 189, 131, 129, 54, 198, 164, 115, 161, 171, 134, 115, 69, 233, 99, 5, 124, 253, 226, 152, 111,
-    61, 89, 166, 34, 23, 169, 133, 65, 47, 3, 15, 186, 121, 34, 8, 125, 88, 152, 219, 22, 234, 38, 232, 28, 98, 248,
-    177, 156, 215, 5, 159, 178, 154, 14, 154, 193, 164, 209, 114, 238, 100, 131, 218, 249, 99, 230, 50, 152, 141, 173,
-    207, 22, 242, 183, 154, 148, 151, 212, 143, 68, 101, 117, 182, 153, 48, 181, 88, 187, 128, 77, 48, 128, 178, 203,
-    72, 231, 220, 58, 37, 205, 208, 59, 241, 230, 65, 8, 85, 163, 123, 149, 14, 85, 212, 228, 46, 219, 56, 86, 242, 41,
-    176, 50, 5, 16, 211, 218, 154, 50, 193, 248, 78, 110, 39, 33, 172, 20, 86, 236, 187, 124, 90, 226, 161, 251, 170, 0,
-    64, 34, 219, 19, 223, 26, 37, 119, 158, 140, 213, 213, 14, 100, 128, 134, 252, 67, 168, 95, 179, 25, 30, 252, 188,
-    138, 122, 53, 120, 240, 114, 172, 189, 243, 76, 209, 214, 236, 69, 240, 236, 96, 89, 43, 198, 144, 229, 25, 231, 19,
-    62, 66, 157, 110, 102, 8, 65, 4, 99, 17, 241, 62, 153, 115, 172, 112, 45, 98, 33, 179, 63, 79, 123, 107, 25, 245,
-    208, 120, 254, 73, 156, 89, 69, 41, 237, 48, 144, 247, 8, 176, 196, 77, 72, 100, 125, 57, 26, 86, 243, 254, 132, 31,
-    24, 77, 157, 234, 4, 113, 54, 215, 73, 219, 179, 8, 47, 13, 242, 8, 152, 5, 48, 89, 19, 221, 145, 113
+    123, 34, 67, 111, 109, 112, 111, 110, 101, 110, 116, 78, 97, 109, 101, 34, 58, 32, 34, 80, 97, 108, 95, 80, 108, 97,
+    116, 102, 111, 114, 109, 34, 44, 32, 34, 68, 114, 105, 118, 101, 114, 83, 116, 97, 116, 101, 34, 58, 32, 91, 34, 72,
+    97, 108, 116, 101, 100, 79, 110, 80, 108, 97, 116, 102, 111, 114, 109, 73, 110, 105, 116, 34, 93, 44, 32, 34, 83,
+    101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 98, 103, 80, 114,
+    105, 110, 116, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 98, 117,
+    103, 32, 80, 114, 105, 110, 116, 34, 93, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 98, 103, 80, 114, 105,
+    110, 116, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32,
+    100, 101, 98, 117, 103, 32, 112, 114, 105, 110, 116, 32, 109, 101, 115, 115, 97, 103, 101, 115, 32, 105, 110, 32,
+    116, 104, 101, 32, 73, 110, 102, 111, 32, 99, 97, 116, 101, 103, 111, 114, 121, 32, 91, 68, 98, 103, 80, 114, 105,
+    110, 116, 67, 97, 116, 73, 110, 102, 111, 77, 115, 103, 93, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 105, 110, 102, 111, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 73, 110, 102, 111, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 56, 55, 50, 54, 52, 52, 54, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 100, 101, 98, 117, 103, 32, 112, 114, 105, 110, 116, 32, 109,
+    101, 115, 115, 97, 103, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 87, 97, 114, 110, 105, 110, 103, 32, 99, 97,
+    116, 101, 103, 111, 114, 121, 32, 91, 68, 98, 103, 80, 114, 105, 110, 116, 67, 97, 116, 87, 97, 114, 110, 77, 115,
+    103, 93, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 114, 110, 105, 110, 103,
+    69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 114, 110, 105, 110, 103,
+    69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49, 49, 49, 50,
+    49, 55, 53, 55, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69,
+    110, 97, 98, 108, 101, 115, 32, 100, 101, 98, 117, 103, 32, 112, 114, 105, 110, 116, 32, 109, 101, 115, 115, 97,
+    103, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 69, 114, 114, 111, 114, 32, 99, 97, 116, 101, 103, 111, 114,
+    121, 32, 91, 68, 98, 103, 80, 114, 105, 110, 116, 67, 97, 116, 69, 114, 114, 111, 114, 77, 115, 103, 93, 46, 34, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102,
+    97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 114, 114, 111, 114, 69, 110, 97, 98, 108, 101,
+    100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 114, 114, 111, 114, 69, 110, 97, 98, 108, 101, 100, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 53, 56, 55, 55, 49, 48, 49, 56, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32,
+    100, 101, 98, 117, 103, 32, 112, 114, 105, 110, 116, 32, 109, 101, 115, 115, 97, 103, 101, 115, 32, 105, 110, 32,
+    116, 104, 101, 32, 83, 67, 32, 99, 97, 116, 101, 103, 111, 114, 121, 32, 91, 68, 98, 103, 80, 114, 105, 110, 116,
+    67, 97, 116, 83, 99, 77, 115, 103, 93, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 83,
+    99, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 99, 69, 110, 97, 98, 108,
+    101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56, 50, 55, 57, 57, 54, 52, 52, 48,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108,
+    101, 115, 32, 100, 101, 98, 117, 103, 32, 112, 114, 105, 110, 116, 32, 109, 101, 115, 115, 97, 103, 101, 115, 32,
+    105, 110, 32, 116, 104, 101, 32, 69, 118, 101, 110, 116, 32, 80, 114, 105, 110, 116, 32, 99, 97, 116, 101, 103, 111,
+    114, 121, 32, 91, 68, 98, 103, 80, 114, 105, 110, 116, 67, 97, 116, 69, 118, 101, 110, 116, 80, 114, 105, 110, 116,
+    77, 115, 103, 93, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111,
+    108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 118, 101, 110, 116,
+    80, 114, 105, 110, 116, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 118,
+    101, 110, 116, 80, 114, 105, 110, 116, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 52, 50, 56, 51, 56, 53, 48, 50, 49, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 100, 101, 98, 117, 103, 32, 112, 114, 105,
+    110, 116, 32, 109, 101, 115, 115, 97, 103, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 69, 118, 101, 110, 116,
+    32, 80, 114, 105, 110, 116, 32, 67, 97, 108, 108, 98, 97, 99, 107, 32, 99, 97, 116, 101, 103, 111, 114, 121, 32, 91,
+    68, 98, 103, 80, 114, 105, 110, 116, 67, 97, 116, 69, 118, 101, 110, 116, 80, 114, 105, 110, 116, 67, 97, 108, 108,
+    98, 97, 99, 107, 77, 115, 103, 93, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101,
+    118, 101, 110, 116, 80, 114, 105, 110, 116, 67, 98, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 69, 118, 101, 110, 116, 80, 114, 105, 110, 116, 67, 98, 69, 110, 97, 98, 108, 101, 100, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 55, 52, 54, 53, 51, 48, 48, 52, 125, 93, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 100,
+    101, 98, 117, 103, 32, 112, 114, 105, 110, 116, 32, 99, 97, 116, 101, 103, 111, 114, 121, 32, 101, 110, 97, 98, 108,
+    101, 47, 100, 105, 115, 97, 98, 108, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51,
+    52, 50, 48, 54, 48, 53, 53, 57, 51, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 115, 115, 101, 114,
+    116, 115, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 65, 115, 115, 101,
+    114, 116, 115, 32, 97, 110, 100, 32, 65, 108, 101, 114, 116, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 97, 115, 115, 101, 114, 116, 115, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 100, 114, 105, 118,
+    101, 114, 32, 97, 115, 115, 101, 114, 116, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    49, 49, 49, 48, 54, 48, 53, 48, 48, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 108, 101, 114,
+    116, 115, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 65, 115, 115, 101,
+    114, 116, 115, 32, 97, 110, 100, 32, 65, 108, 101, 114, 116, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 97, 108, 101, 114, 116, 115, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 100, 114, 105, 118, 101,
+    114, 32, 97, 108, 101, 114, 116, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51,
+    51, 51, 48, 48, 52, 56, 53, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101,
+    69, 118, 101, 110, 116, 76, 111, 103, 70, 105, 108, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 69,
+    118, 101, 110, 116, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 114,
+    105, 118, 101, 114, 83, 116, 97, 116, 101, 34, 58, 32, 91, 34, 72, 97, 108, 116, 101, 100, 79, 110, 80, 108, 97,
+    116, 102, 111, 114, 109, 73, 110, 105, 116, 34, 44, 32, 34, 72, 97, 108, 116, 101, 100, 79, 110, 68, 101, 118, 105,
+    99, 101, 73, 110, 105, 116, 34, 44, 32, 34, 72, 97, 108, 116, 101, 100, 80, 111, 115, 116, 68, 101, 118, 105, 99,
+    101, 73, 110, 105, 116, 34, 44, 32, 34, 80, 97, 117, 115, 101, 100, 34, 44, 32, 34, 82, 117, 110, 110, 105, 110,
+    103, 34, 93, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101, 69, 118, 101, 110, 116, 76, 111,
+    103, 70, 105, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69,
+    110, 97, 98, 108, 101, 115, 32, 108, 111, 103, 103, 105, 110, 103, 32, 111, 102, 32, 101, 118, 101, 110, 116, 115,
+    32, 116, 111, 32, 97, 32, 102, 105, 108, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    51, 50, 56, 56, 50, 48, 53, 50, 56, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 82, 101, 108, 97, 116, 105, 118, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104,
+    101, 114, 101, 32, 101, 118, 101, 110, 116, 32, 108, 111, 103, 32, 102, 105, 108, 101, 32, 119, 105, 108, 108, 32,
+    98, 101, 32, 112, 108, 97, 99, 101, 100, 46, 32, 82, 101, 108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 116, 104,
+    101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77, 68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82,
+    32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97, 98, 108, 101, 46, 32, 73, 102,
+    32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105, 115, 110, 39, 116, 32, 115, 101, 116, 44, 32,
+    116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 108, 97, 116, 102, 111, 114, 109,
+    32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73,
+    115, 80, 97, 116, 104, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 69,
+    118, 101, 110, 116, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 32,
+    34, 87, 105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 58, 92, 92, 80, 97, 108, 76, 111, 103, 92,
+    92, 34, 44, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47,
+    34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 118, 101, 110, 116, 76, 111, 103, 68, 105, 114, 101, 99,
+    116, 111, 114, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 118, 101, 110, 116, 76, 111, 103, 68, 105,
+    114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 55, 56, 57,
+    53, 49, 55, 48, 57, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    70, 105, 108, 101, 110, 97, 109, 101, 32, 97, 110, 100, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 111,
+    102, 32, 116, 104, 101, 32, 101, 118, 101, 110, 116, 32, 108, 111, 103, 32, 102, 105, 108, 101, 46, 34, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97,
+    108, 69, 118, 101, 110, 116, 76, 111, 103, 46, 106, 115, 111, 110, 34, 125, 44, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 34, 69, 118, 101, 110, 116, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 83, 105, 122, 101, 34,
+    58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 101, 118, 101, 110, 116, 76, 111, 103, 70, 105, 108, 101, 110, 97, 109, 101, 34, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 69, 118, 101, 110, 116, 76, 111, 103, 70, 105, 108, 101, 110, 97, 109, 101, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 56, 55, 53, 48, 50, 53, 53, 52, 125, 44, 32, 123, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 71, 80, 85, 32, 73, 68, 32, 77, 97, 115, 113, 117, 101, 114, 97, 100, 101, 34, 93, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 115, 32, 114, 101, 112, 111, 114, 116, 105, 110, 103, 32, 115,
+    117, 112, 112, 111, 114, 116, 32, 111, 102, 32, 65, 83, 84, 67, 47, 69, 84, 67, 50, 32, 116, 101, 120, 116, 117,
+    114, 101, 32, 114, 101, 97, 100, 115, 32, 97, 110, 100, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 66, 67, 52,
+    45, 55, 46, 32, 87, 97, 114, 110, 105, 110, 103, 58, 32, 79, 110, 32, 103, 102, 120, 49, 48, 32, 104, 97, 114, 100,
+    119, 97, 114, 101, 44, 32, 116, 104, 105, 115, 32, 105, 115, 32, 105, 110, 116, 101, 110, 100, 101, 100, 32, 116,
+    111, 32, 98, 101, 32, 117, 115, 101, 100, 32, 111, 110, 108, 121, 32, 105, 110, 32, 73, 70, 72, 32, 109, 111, 100,
+    101, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 102, 111, 114, 99, 101, 69, 116, 99, 65, 115, 116, 99, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 69, 116, 99, 65, 115, 116, 99, 69, 110, 97, 98, 108, 101, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 51, 48, 52, 53, 48, 52, 57, 54, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 69, 110, 97, 98, 108,
+    101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108,
+    97, 121, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 101, 98, 117, 103, 79, 118,
+    101, 114, 108, 97, 121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 100, 101, 98, 117, 103, 32, 111,
+    118, 101, 114, 108, 97, 121, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 54, 50, 49,
+    54, 51, 56, 48, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101,
+    114, 108, 97, 121, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 98,
+    117, 103, 32, 79, 118, 101, 114, 108, 97, 121, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34,
+    58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58,
+    32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101,
+    114, 108, 97, 121, 69, 110, 97, 98, 108, 101, 100, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    115, 116, 114, 117, 99, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    100, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 83, 116, 114,
+    117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 87, 114, 105, 116, 101, 115, 32, 100, 101, 98, 117, 103, 32, 111, 118, 101, 114, 108, 97, 121, 32, 105, 110,
+    102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 116, 111, 32, 116, 104, 101, 32, 115, 99, 114, 101, 101, 110, 46,
+    34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 116, 114, 117, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 118, 105, 115, 117, 97, 108, 67, 111, 110, 102,
+    105, 114, 109, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 105, 115, 117,
+    97, 108, 67, 111, 110, 102, 105, 114, 109, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 49, 56, 48, 50, 52, 55, 54, 57, 53, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 68, 114, 97, 119, 115, 32, 116, 104, 101, 32, 116, 105, 109, 101, 103, 114, 97,
+    112, 104, 32, 116, 111, 32, 116, 104, 101, 32, 115, 99, 114, 101, 101, 110, 46, 34, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 105, 109, 101, 71, 114, 97, 112, 104, 69, 110, 97, 98, 108, 101, 100,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 109, 101, 71, 114, 97, 112, 104, 69, 110, 97, 98, 108,
+    101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 51, 51, 53, 53, 56, 52, 48, 56,
+    125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117,
+    109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 85, 112, 112, 101, 114, 76, 101, 102,
+    116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 85, 112, 112, 101, 114, 82, 105, 103, 104, 116, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117,
+    103, 79, 118, 101, 114, 108, 97, 121, 76, 111, 119, 101, 114, 82, 105, 103, 104, 116, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 50, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118,
+    101, 114, 108, 97, 121, 76, 111, 119, 101, 114, 76, 101, 102, 116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 51, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97,
+    121, 67, 111, 117, 110, 116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 125, 93, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 76, 111, 99, 97, 116, 105, 111,
+    110, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121,
+    76, 111, 99, 97, 116, 105, 111, 110, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 76, 111, 119,
+    101, 114, 76, 101, 102, 116, 34, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 118, 101, 114, 108, 97, 121, 76, 111,
+    99, 97, 116, 105, 111, 110, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76,
+    111, 99, 97, 116, 105, 111, 110, 32, 116, 111, 32, 100, 105, 115, 112, 108, 97, 121, 32, 100, 101, 98, 117, 103, 32,
+    116, 101, 120, 116, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 52, 53, 55, 52, 53,
+    50, 48, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 110, 102,
+    111, 114, 109, 97, 116, 105, 111, 110, 32, 97, 98, 111, 117, 116, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110,
+    116, 32, 112, 101, 114, 102, 111, 114, 109, 105, 110, 103, 32, 116, 104, 101, 32, 114, 101, 110, 100, 101, 114, 105,
+    110, 103, 46, 32, 70, 111, 114, 32, 101, 120, 97, 109, 112, 108, 101, 58, 32, 82, 101, 110, 100, 101, 114, 101, 100,
+    32, 66, 121, 32, 80, 65, 76, 32, 40, 48, 46, 48, 46, 49, 41, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 34, 125, 44, 32, 34, 83, 105, 122, 101, 34,
+    58, 32, 34, 77, 97, 120, 77, 105, 115, 99, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 114, 101, 110, 100, 101, 114, 101, 100, 66, 121, 83, 116, 114, 105, 110, 103, 34, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 82, 101, 110, 100, 101, 114, 101, 100, 66, 121, 83, 116, 114, 105, 110, 103, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 49, 50, 50, 55, 48, 54, 52, 49, 125, 44, 32, 123, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 98, 117, 103, 32, 105, 110, 102, 111, 114,
+    109, 97, 116, 105, 111, 110, 32, 116, 104, 97, 116, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 32, 111,
+    114, 32, 116, 101, 115, 116, 101, 114, 32, 109, 105, 103, 104, 116, 32, 119, 97, 110, 116, 32, 114, 101, 112, 111,
+    114, 116, 101, 100, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 34, 34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 77, 105, 115,
+    99, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 105, 115, 99, 101, 108, 108,
+    97, 110, 101, 111, 117, 115, 68, 101, 98, 117, 103, 83, 116, 114, 105, 110, 103, 34, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 77, 105, 115, 99, 101, 108, 108, 97, 110, 101, 111, 117, 115, 68, 101, 98, 117, 103, 83, 116, 114,
+    105, 110, 103, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 57, 54, 48, 50, 54, 52, 57,
+    48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 117, 116, 112,
+    117, 116, 32, 99, 117, 114, 114, 101, 110, 116, 32, 102, 114, 97, 109, 101, 32, 110, 117, 109, 98, 101, 114, 32,
+    105, 110, 32, 116, 104, 101, 32, 100, 101, 98, 117, 103, 32, 111, 118, 101, 114, 108, 97, 121, 46, 34, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 105, 110, 116, 70, 114, 97, 109, 101, 78, 117,
+    109, 98, 101, 114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 105, 110, 116, 70, 114, 97, 109, 101,
+    78, 117, 109, 98, 101, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 54, 51, 54, 52,
+    51, 56, 55, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115,
+    101, 32, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 32, 111, 110, 32, 67, 109, 100, 67, 111, 108, 111,
+    114, 83, 112, 97, 99, 101, 67, 111, 110, 118, 101, 114, 115, 105, 111, 110, 67, 111, 112, 121, 46, 34, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 115, 101, 68, 101, 98, 117, 103, 79, 118, 101, 114,
+    108, 97, 121, 79, 110, 67, 111, 108, 111, 114, 83, 112, 97, 99, 101, 67, 111, 110, 118, 101, 114, 115, 105, 111,
+    110, 67, 111, 112, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 115, 101, 68, 101, 98, 117, 103, 79,
+    118, 101, 114, 108, 97, 121, 79, 110, 67, 111, 108, 111, 114, 83, 112, 97, 99, 101, 67, 111, 110, 118, 101, 114,
+    115, 105, 111, 110, 67, 111, 112, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 53, 51,
+    51, 54, 50, 57, 52, 50, 53, 125, 93, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 97, 116, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105,
+    111, 110, 32, 105, 115, 32, 100, 105, 115, 112, 108, 97, 121, 101, 100, 32, 111, 110, 32, 116, 104, 101, 32, 68,
+    101, 98, 117, 103, 32, 79, 118, 101, 114, 108, 97, 121, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 52, 50, 49, 53, 52, 52, 51, 53, 50, 54, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105,
+    109, 101, 71, 114, 97, 112, 104, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108, 97, 121, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115,
+    79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103,
+    79, 118, 101, 114, 108, 97, 121, 69, 110, 97, 98, 108, 101, 100, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 116, 105, 109, 101, 71, 114, 97, 112, 104, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 83, 116,
+    114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 108, 97, 99, 107,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 108, 97,
+    99, 107, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 82, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 82, 101, 100, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 71, 114, 101, 101, 110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 114, 101, 101, 110, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 108, 117, 101, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 51, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 108, 117, 101, 67, 111, 108, 111, 114,
+    34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 89, 101, 108, 108,
+    111, 119, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 89,
+    101, 108, 108, 111, 119, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 121, 97, 110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 67, 121, 97, 110, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 103, 101, 110, 116, 97, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 54, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 103, 101, 110, 116, 97, 67, 111,
+    108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87,
+    104, 105, 116, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 55, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 87, 104, 105, 116, 101, 67, 111, 108, 111, 114, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84,
+    105, 109, 101, 71, 114, 97, 112, 104, 67, 111, 108, 111, 114, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    71, 114, 105, 100, 76, 105, 110, 101, 67, 111, 108, 111, 114, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 82, 101, 100, 67, 111, 108, 111, 114, 34, 125,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 114, 105, 100, 76, 105, 110, 101, 67, 111, 108, 111, 114, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 108, 111, 114, 32, 111, 102, 32,
+    116, 104, 101, 32, 103, 114, 105, 100, 32, 108, 105, 110, 101, 32, 105, 110, 32, 116, 104, 101, 32, 116, 105, 109,
+    101, 32, 103, 114, 97, 112, 104, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 56, 57,
+    48, 57, 55, 57, 56, 57, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 66, 108, 97, 99, 107, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 66, 108, 97, 99, 107, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 100, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 114, 101, 101, 110, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 114, 101, 101, 110, 67, 111, 108,
+    111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 108,
+    117, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66,
+    108, 117, 101, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 89, 101, 108, 108, 111, 119, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 89, 101, 108, 108, 111, 119, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 121, 97, 110, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 53, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 121, 97, 110, 67, 111, 108, 111, 114, 34,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 103, 101, 110,
+    116, 97, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77,
+    97, 103, 101, 110, 116, 97, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 87, 104, 105, 116, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 55, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 104, 105, 116, 101, 67, 111, 108, 111, 114, 34, 125, 93, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 109, 101, 71, 114, 97, 112, 104, 67, 111, 108, 111, 114, 34, 125, 44, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 76, 105, 110, 101, 67, 111, 108, 111, 114, 34, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 89, 101,
+    108, 108, 111, 119, 67, 111, 108, 111, 114, 34, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117,
+    109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112, 117, 76, 105,
+    110, 101, 67, 111, 108, 111, 114, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 111, 108, 111, 114, 32, 111, 102, 32, 116, 104, 101, 32, 67, 80, 85, 32, 108, 105, 110, 101, 32, 105, 110,
+    32, 116, 104, 101, 32, 116, 105, 109, 101, 32, 103, 114, 97, 112, 104, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 54, 56, 57, 57, 49, 56, 48, 48, 55, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 108, 97, 99, 107, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    48, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 108, 97, 99, 107, 67, 111, 108, 111, 114, 34, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 100, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 100, 67, 111, 108, 111, 114,
+    34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 114, 101, 101,
+    110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 114,
+    101, 101, 110, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 66, 108, 117, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 66, 108, 117, 101, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 89, 101, 108, 108, 111, 119, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 52, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 89, 101, 108, 108, 111, 119, 67, 111, 108, 111,
+    114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 121, 97,
+    110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 121,
+    97, 110, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 77, 97, 103, 101, 110, 116, 97, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 77, 97, 103, 101, 110, 116, 97, 67, 111, 108, 111, 114, 34, 125, 44, 32, 123, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 105, 116, 101, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 55, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 104, 105, 116, 101, 67, 111, 108,
+    111, 114, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 109, 101, 71, 114, 97, 112, 104, 67,
+    111, 108, 111, 114, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 76, 105, 110, 101, 67, 111,
+    108, 111, 114, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 34, 71, 114, 101, 101, 110, 67, 111, 108, 111, 114, 34, 125, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 103, 112, 117, 76, 105, 110, 101, 67, 111, 108, 111, 114, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 108, 111, 114, 32, 111, 102, 32, 116, 104, 101, 32, 71, 80, 85, 32,
+    108, 105, 110, 101, 32, 105, 110, 32, 116, 104, 101, 32, 116, 105, 109, 101, 32, 103, 114, 97, 112, 104, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 50, 57, 51, 56, 54, 51, 50, 51, 125, 93, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101, 32, 71, 114, 97, 112, 104,
+    32, 100, 105, 115, 112, 108, 97, 121, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 49, 48, 49, 53, 53, 48, 49, 57, 56, 125, 44, 32, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 79, 118, 101, 114, 108, 97, 121, 66, 101, 110, 99, 104, 109, 97, 114, 107, 67,
+    111, 110, 102, 105, 103, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 98, 117, 103, 32, 79, 118,
+    101, 114, 108, 97, 121, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101,
+    116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 116, 114, 117,
+    101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 69,
+    110, 97, 98, 108, 101, 100, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99,
+    116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 118, 101, 114, 108,
+    97, 121, 66, 101, 110, 99, 104, 109, 97, 114, 107, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 83, 116, 114, 117,
+    99, 116, 117, 114, 101, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 69, 110, 100, 32, 98, 101, 110, 99, 104, 109, 97, 114, 107, 32, 97, 102, 116, 101, 114, 32, 115, 112, 101, 99,
+    105, 102, 105, 101, 100, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 115, 101, 99, 111, 110, 100, 115, 46,
+    32, 32, 84, 104, 101, 32, 98, 101, 110, 99, 104, 109, 97, 114, 107, 32, 99, 97, 110, 32, 115, 116, 105, 108, 108,
+    32, 98, 101, 32, 101, 110, 100, 101, 100, 32, 101, 97, 114, 108, 121, 32, 98, 121, 32, 104, 105, 116, 116, 105, 110,
+    103, 32, 70, 49, 49, 46, 32, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 48, 32, 119, 105, 108, 108, 32,
+    97, 108, 108, 111, 119, 32, 116, 104, 101, 32, 98, 101, 110, 99, 104, 109, 97, 114, 107, 32, 116, 111, 32, 114, 117,
+    110, 32, 102, 111, 114, 101, 118, 101, 114, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109,
+    97, 120, 66, 101, 110, 99, 104, 109, 97, 114, 107, 84, 105, 109, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 77, 97, 120, 66, 101, 110, 99, 104, 109, 97, 114, 107, 84, 105, 109, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 52, 56, 48, 51, 49, 51, 53, 49, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 116, 104, 101, 114, 32, 111, 114, 32, 110, 111, 116, 32, 97, 32,
+    108, 111, 103, 32, 101, 110, 116, 114, 121, 32, 111, 102, 32, 80, 65, 76, 32, 117, 115, 97, 103, 101, 32, 119, 105,
+    108, 108, 32, 98, 101, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100, 32, 116, 111, 32, 100, 105, 115, 107, 46, 34,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 115, 97, 103, 101, 76, 111, 103, 69, 110, 97,
+    98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 115, 97, 103, 101, 76, 111, 103, 69, 110, 97,
+    98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49, 55, 54, 56, 48, 49, 50, 51,
+    56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97,
+    116, 105, 118, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 117, 115, 97,
+    103, 101, 32, 108, 111, 103, 115, 32, 97, 114, 101, 32, 112, 108, 97, 99, 101, 100, 46, 32, 82, 101, 108, 97, 116,
+    105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77,
+    68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97,
+    114, 105, 97, 98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105,
+    115, 110, 39, 116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115,
+    32, 112, 108, 97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46, 34, 44, 32, 34, 70,
+    108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 80, 97, 116, 104, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109,
+    100, 112, 97, 108, 47, 34, 44, 32, 34, 87, 105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108,
+    76, 111, 103, 92, 92, 34, 44, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100,
+    112, 97, 108, 47, 34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116,
+    114, 76, 101, 110, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 115, 97, 103, 101, 76, 111, 103, 68, 105,
+    114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 115, 97, 103, 101, 76, 111,
+    103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50,
+    49, 57, 56, 50, 48, 49, 52, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 70, 105, 108, 101, 110, 97, 109, 101, 32, 97, 110, 100, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32,
+    111, 102, 32, 116, 104, 101, 32, 117, 115, 97, 103, 101, 32, 108, 111, 103, 46, 34, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 85, 115, 97,
+    103, 101, 76, 111, 103, 46, 116, 120, 116, 34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80,
+    97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105,
+    110, 103, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 115, 97, 103,
+    101, 76, 111, 103, 70, 105, 108, 101, 110, 97, 109, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 115,
+    97, 103, 101, 76, 111, 103, 70, 105, 108, 101, 110, 97, 109, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 53, 53, 49, 52, 54, 51, 54, 48, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 32, 102, 114, 97, 109, 101, 32, 116, 105, 109, 101, 32, 97, 110, 100,
+    32, 97, 118, 101, 114, 97, 103, 101, 32, 70, 80, 83, 32, 100, 117, 114, 105, 110, 103, 32, 98, 101, 110, 99, 104,
+    109, 97, 114, 107, 32, 115, 101, 115, 115, 105, 111, 110, 32, 116, 111, 32, 102, 105, 108, 101, 115, 46, 32, 79,
+    110, 108, 121, 32, 101, 110, 97, 98, 108, 101, 100, 32, 119, 104, 101, 110, 32, 68, 101, 98, 117, 103, 86, 105, 115,
+    117, 97, 108, 68, 105, 115, 112, 108, 97, 121, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 70, 114, 97, 109, 101, 83, 116, 97, 116,
+    115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 70, 114, 97, 109, 101, 83, 116, 97, 116, 115,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 54, 55, 57, 56, 54, 51, 50, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116, 105, 118, 101,
+    32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 102, 114, 97, 109, 101, 32, 115,
+    116, 97, 116, 105, 115, 116, 105, 99, 32, 108, 111, 103, 115, 32, 97, 114, 101, 32, 112, 108, 97, 99, 101, 100, 46,
+    32, 82, 101, 108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32,
+    116, 104, 101, 32, 65, 77, 68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109,
+    101, 110, 116, 32, 118, 97, 114, 105, 97, 98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118,
+    32, 118, 97, 114, 32, 105, 115, 110, 39, 116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116,
+    105, 111, 110, 32, 105, 115, 32, 112, 108, 97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110,
+    116, 46, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 80, 97, 116, 104, 34, 58, 32, 116,
+    114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 32, 34, 87, 105, 110, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 34, 80, 97, 108, 76, 111, 103, 92, 92, 34, 44, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97,
+    120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114,
+    105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 114, 97,
+    109, 101, 83, 116, 97, 116, 115, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 70, 114, 97, 109, 101, 83, 116, 97, 116, 115, 76, 111, 103, 68, 105, 114, 101, 99, 116,
+    111, 114, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 52, 53, 55, 48, 54, 56, 48,
+    51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 32, 109,
+    117, 109, 98, 101, 114, 32, 111, 102, 32, 102, 114, 97, 109, 101, 32, 116, 105, 109, 101, 32, 115, 97, 109, 112,
+    108, 101, 115, 32, 116, 104, 97, 116, 32, 99, 97, 110, 32, 98, 101, 32, 108, 111, 103, 103, 101, 100, 32, 105, 110,
+    32, 97, 32, 98, 101, 110, 99, 104, 109, 97, 114, 107, 32, 115, 101, 115, 115, 105, 111, 110, 46, 34, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 54, 53, 53, 51,
+    54, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 76, 111, 103, 103, 101, 100, 70, 114, 97,
+    109, 101, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 76, 111, 103, 103, 101, 100, 70, 114,
+    97, 109, 101, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 56, 55, 56, 56, 51, 52,
+    56, 52, 125, 93, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 98, 117,
+    103, 32, 79, 118, 101, 114, 108, 97, 121, 32, 66, 101, 110, 99, 104, 109, 97, 114, 107, 32, 99, 111, 110, 102, 105,
+    103, 117, 114, 97, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50,
+    55, 48, 56, 53, 50, 57, 52, 48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 118, 101, 114, 108, 97,
+    121, 77, 101, 109, 111, 114, 121, 73, 110, 102, 111, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 34, 68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108, 97, 121, 34, 93, 44, 32, 34, 68, 101, 112,
+    101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 69, 110, 97, 98, 108, 101, 100, 34, 125, 93, 125, 44, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 118, 101, 114, 108, 97, 121, 77, 101, 109, 111, 114, 121, 73, 110, 102,
+    111, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 123,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 104, 101, 32, 116, 111,
+    116, 97, 108, 32, 109, 101, 109, 111, 114, 121, 32, 97, 108, 108, 111, 99, 97, 116, 101, 100, 32, 102, 114, 111,
+    109, 32, 116, 104, 101, 32, 116, 119, 111, 32, 110, 111, 110, 45, 108, 111, 99, 97, 108, 32, 104, 101, 97, 112, 115,
+    32, 115, 104, 111, 117, 108, 100, 32, 98, 101, 32, 115, 104, 111, 119, 110, 32, 105, 110, 32, 97, 32, 115, 105, 110,
+    103, 108, 101, 32, 108, 105, 110, 101, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99,
+    111, 109, 98, 105, 110, 101, 78, 111, 110, 76, 111, 99, 97, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    67, 111, 109, 98, 105, 110, 101, 78, 111, 110, 76, 111, 99, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 52, 53, 50, 48, 57, 57, 57, 57, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 116, 104, 101, 32,
+    111, 118, 101, 114, 108, 97, 121, 32, 119, 105, 108, 108, 32, 114, 101, 112, 111, 114, 116, 32, 105, 110, 102, 111,
+    114, 109, 97, 116, 105, 111, 110, 32, 97, 98, 111, 117, 116, 32, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111,
+    114, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 114, 101, 112, 111, 114, 116, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 34, 44, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 112, 111, 114, 116, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116,
+    111, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 52, 53, 50, 57, 55, 55, 48, 55,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114,
+    109, 105, 110, 101, 115, 32, 105, 102, 32, 116, 104, 101, 32, 111, 118, 101, 114, 108, 97, 121, 32, 119, 105, 108,
+    108, 32, 114, 101, 112, 111, 114, 116, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 97, 98, 111,
+    117, 116, 32, 101, 120, 116, 101, 114, 110, 97, 108, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 46, 34,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101, 112, 111, 114, 116, 69, 120, 116, 101, 114,
+    110, 97, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 112, 111, 114, 116, 69, 120, 116, 101, 114,
+    110, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 57, 50, 49, 48, 51, 56, 56,
+    57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101,
+    114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 116, 104, 101, 32, 111, 118, 101, 114, 108, 97, 121, 32, 119, 105,
+    108, 108, 32, 114, 101, 112, 111, 114, 116, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 97, 98,
+    111, 117, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115,
+    46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101, 112, 111, 114, 116, 73, 110, 116,
+    101, 114, 110, 97, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 112, 111, 114, 116, 73, 110, 116,
+    101, 114, 110, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 55, 54, 57, 57, 57,
+    55, 53, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116,
+    101, 114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 116, 104, 101, 32, 111, 118, 101, 114, 108, 97, 121, 32, 119,
+    105, 108, 108, 32, 100, 105, 115, 112, 108, 97, 121, 32, 112, 101, 97, 107, 32, 109, 101, 109, 111, 114, 121, 32,
+    117, 115, 97, 103, 101, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 112,
+    108, 97, 121, 80, 101, 97, 107, 77, 101, 109, 85, 115, 97, 103, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 68, 105, 115, 112, 108, 97, 121, 80, 101, 97, 107, 77, 101, 109, 85, 115, 97, 103, 101, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 53, 57, 55, 54, 56, 53, 50, 57, 125, 93, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105, 103, 117, 114, 101, 115, 32, 116,
+    104, 101, 32, 109, 101, 109, 111, 114, 121, 32, 117, 115, 97, 103, 101, 32, 100, 105, 115, 112, 108, 97, 121, 32,
+    111, 110, 32, 116, 104, 101, 32, 68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108, 97, 121, 46, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 53, 48, 56, 50, 55, 49, 48, 50, 50, 125, 44, 32, 123, 34, 86, 97,
+    108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 68, 105, 115, 97, 98, 108,
+    101, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 32, 68, 105, 115, 97, 98, 108,
+    101, 100, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108,
+    101, 114, 67, 111, 117, 110, 116, 101, 114, 65, 110, 100, 84, 105, 109, 105, 110, 103, 79, 110, 108, 121, 34, 44,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 84, 114, 97, 99, 101, 115, 32, 97, 114, 101, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 98, 117, 116,
+    32, 112, 101, 114, 102, 32, 99, 111, 117, 110, 116, 101, 114, 32, 97, 110, 100, 32, 116, 105, 109, 105, 110, 103,
+    32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 84,
+    114, 97, 99, 101, 69, 110, 97, 98, 108, 101, 100, 84, 116, 118, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 115, 32,
+    40, 83, 112, 109, 32, 97, 110, 100, 47, 111, 114, 32, 83, 113, 116, 116, 41, 32, 97, 114, 101, 32, 111, 117, 116,
+    112, 117, 116, 32, 105, 110, 32, 102, 111, 114, 109, 97, 116, 32, 40, 46, 99, 115, 118, 44, 32, 46, 111, 117, 116,
+    41, 32, 102, 111, 114, 32, 84, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 118, 105, 101, 119, 101, 114,
+    46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114,
+    84, 114, 97, 99, 101, 69, 110, 97, 98, 108, 101, 100, 82, 103, 112, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 51, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 32,
+    100, 97, 116, 97, 32, 40, 83, 112, 109, 32, 97, 110, 100, 47, 111, 114, 32, 83, 113, 116, 116, 41, 32, 105, 115, 32,
+    111, 117, 116, 112, 117, 116, 32, 97, 115, 32, 46, 114, 103, 112, 32, 102, 105, 108, 101, 32, 102, 111, 114, 32, 82,
+    97, 100, 101, 111, 110, 32, 71, 112, 117, 32, 80, 114, 111, 102, 105, 108, 101, 114, 46, 34, 125, 93, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 77, 111, 100, 101, 34, 125,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 77, 111, 100,
+    101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114,
+    34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 68, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 77, 111, 100, 101, 34, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 97,
+    110, 100, 32, 115, 101, 116, 115, 32, 116, 104, 101, 32, 83, 81, 84, 84, 32, 109, 111, 100, 101, 32, 102, 111, 114,
+    32, 116, 104, 101, 32, 71, 80, 85, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 112, 114, 111, 102,
+    105, 108, 101, 114, 32, 108, 97, 121, 101, 114, 46, 32, 32, 65, 99, 116, 117, 97, 108, 32, 99, 97, 112, 116, 117,
+    114, 101, 32, 111, 102, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 100, 97, 116, 97, 32, 109, 117,
+    115, 116, 32, 98, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 118, 105, 97, 32, 102, 114, 97, 109, 101,
+    32, 110, 117, 109, 98, 101, 114, 32, 119, 105, 116, 104, 32, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114,
+    67, 111, 110, 102, 105, 103, 46, 83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 32, 111, 114, 32, 98, 121, 32, 104,
+    111, 108, 100, 105, 110, 103, 32, 115, 104, 105, 102, 116, 45, 70, 49, 49, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 51, 52, 57, 48, 48, 56, 53, 52, 49, 53, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 84, 111, 107, 101, 110, 65, 108, 108, 111, 99, 97, 116,
+    111, 114, 83, 105, 122, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 80, 85, 32, 80, 114, 111,
+    102, 105, 108, 101, 114, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83,
+    101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 49, 93, 44,
+    32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 77, 111, 100, 101,
+    34, 125, 93, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 34, 52, 42, 49, 48, 50, 52, 42, 49, 48, 50, 52, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 115, 105, 122, 101, 95, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 103, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 84, 111, 107, 101, 110, 65, 108, 108, 111, 99, 97, 116,
+    111, 114, 83, 105, 122, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    66, 97, 116, 99, 104, 101, 100, 32, 99, 109, 100, 32, 98, 117, 102, 102, 101, 114, 32, 116, 111, 107, 101, 110, 32,
+    115, 105, 122, 101, 32, 119, 105, 116, 104, 32, 51, 50, 32, 98, 105, 116, 32, 98, 117, 105, 108, 100, 32, 119, 104,
+    101, 110, 32, 71, 80, 85, 32, 112, 114, 111, 102, 105, 108, 101, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 49, 54, 49, 56, 51, 49, 56, 51, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 67, 111, 110,
+    102, 105, 103, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108,
+    101, 114, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116,
+    105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 48, 93, 44, 32, 34, 76,
+    111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 77, 111, 100, 101, 34, 125, 93,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 67, 111,
+    110, 102, 105, 103, 34, 44, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 123, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116, 105, 118, 101, 32, 100, 105, 114,
+    101, 99, 116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 71, 80, 85, 32, 112, 114, 111, 102, 105, 108, 101,
+    114, 32, 108, 111, 103, 115, 32, 97, 114, 101, 32, 119, 114, 105, 116, 116, 101, 110, 46, 32, 82, 101, 108, 97, 116,
+    105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77,
+    68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97,
+    114, 105, 97, 98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105,
+    115, 110, 39, 116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115,
+    32, 112, 108, 97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46, 34, 44, 32, 34, 70,
+    108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 80, 97, 116, 104, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109,
+    100, 112, 97, 108, 47, 34, 44, 32, 34, 87, 105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108,
+    76, 111, 103, 92, 92, 34, 44, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100,
+    112, 97, 108, 47, 34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116,
+    114, 76, 101, 110, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 68, 105, 114, 101, 99, 116,
+    111, 114, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114,
+    121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54, 48, 50, 57, 56, 54, 57, 55, 51, 125, 44,
+    32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 114, 97, 109, 101, 32, 110,
+    117, 109, 98, 101, 114, 32, 116, 111, 32, 98, 101, 103, 105, 110, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110,
+    99, 101, 32, 100, 97, 116, 97, 32, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 46, 32, 67, 117, 114, 114, 101,
+    110, 116, 108, 121, 32, 71, 112, 117, 32, 80, 114, 111, 102, 105, 108, 101, 114, 32, 100, 111, 101, 115, 110, 39,
+    116, 32, 115, 117, 112, 112, 111, 114, 116, 32, 112, 114, 111, 102, 105, 108, 105, 110, 103, 32, 102, 114, 97, 109,
+    101, 32, 48, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 116, 97, 114, 116, 70, 114, 97, 109, 101,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 55, 52, 57, 54, 53, 54, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 102, 114, 97, 109,
+    101, 115, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32,
+    100, 97, 116, 97, 32, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 102, 114, 97, 109, 101, 67, 111, 117, 110, 116, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 70, 114, 97, 109, 101, 67, 111, 117, 110, 116, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    51, 54, 51, 48, 53, 52, 56, 50, 49, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 114, 101, 99, 111, 114, 100, 105, 110, 103, 32, 111, 102, 32, 112,
+    105, 112, 101, 108, 105, 110, 101, 32, 115, 116, 97, 116, 115, 32, 102, 111, 114, 32, 101, 97, 99, 104, 32, 111,
+    112, 101, 114, 97, 116, 105, 111, 110, 32, 111, 110, 32, 116, 104, 101, 32, 99, 111, 109, 112, 117, 116, 101, 32,
+    111, 114, 32, 117, 110, 105, 118, 101, 114, 115, 97, 108, 32, 113, 117, 101, 117, 101, 46, 32, 69, 110, 97, 98, 108,
+    105, 110, 103, 32, 116, 104, 105, 115, 32, 109, 97, 121, 32, 97, 100, 118, 101, 114, 115, 101, 108, 121, 32, 97,
+    102, 102, 101, 99, 116, 32, 113, 117, 97, 108, 105, 116, 121, 32, 111, 102, 32, 116, 104, 101, 32, 71, 80, 85, 32,
+    116, 105, 109, 105, 110, 103, 32, 100, 97, 116, 97, 46, 32, 32, 78, 111, 116, 32, 115, 117, 112, 112, 111, 114, 116,
+    101, 100, 32, 102, 111, 114, 32, 102, 114, 97, 109, 101, 45, 103, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121,
+    32, 99, 97, 112, 116, 117, 114, 101, 115, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    114, 101, 99, 111, 114, 100, 80, 105, 112, 101, 108, 105, 110, 101, 83, 116, 97, 116, 115, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 82, 101, 99, 111, 114, 100, 80, 105, 112, 101, 108, 105, 110, 101, 83, 116, 97, 116, 115,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 57, 50, 52, 56, 52, 51, 51, 56, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 112, 108, 105, 116, 32, 117, 112,
+    32, 73, 81, 117, 101, 117, 101, 58, 58, 83, 117, 98, 109, 105, 116, 40, 41, 32, 99, 97, 108, 108, 115, 32, 115, 111,
+    32, 116, 104, 97, 116, 32, 116, 104, 101, 32, 80, 65, 76, 32, 99, 111, 114, 101, 32, 105, 115, 32, 99, 97, 108, 108,
+    101, 100, 32, 111, 110, 99, 101, 32, 112, 101, 114, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101,
+    114, 32, 105, 110, 32, 116, 104, 101, 32, 98, 97, 116, 99, 104, 46, 32, 32, 84, 104, 105, 115, 32, 99, 97, 110, 32,
+    115, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 108, 121, 32, 114, 101, 100, 117, 99, 101, 32, 116, 104, 101,
+    32, 71, 80, 85, 32, 109, 101, 109, 111, 114, 121, 32, 111, 118, 101, 114, 104, 101, 97, 100, 32, 111, 102, 32, 116,
+    104, 101, 32, 112, 114, 111, 102, 105, 108, 101, 114, 44, 32, 98, 117, 116, 32, 109, 97, 121, 32, 104, 97, 118, 101,
+    32, 97, 32, 115, 108, 105, 103, 104, 116, 32, 105, 109, 112, 97, 99, 116, 32, 111, 110, 32, 114, 101, 115, 117, 108,
+    116, 115, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 114, 101, 97, 107, 83, 117,
+    98, 109, 105, 116, 66, 97, 116, 99, 104, 101, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 114, 101,
+    97, 107, 83, 117, 98, 109, 105, 116, 66, 97, 116, 99, 104, 101, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 55, 52, 51, 54, 53, 54, 55, 55, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32,
+    102, 105, 108, 101, 32, 110, 97, 109, 101, 115, 32, 97, 110, 100, 32, 116, 101, 120, 116, 32, 108, 111, 103, 115,
+    32, 119, 105, 108, 108, 32, 99, 111, 110, 116, 97, 105, 110, 32, 102, 117, 108, 108, 32, 112, 105, 112, 101, 108,
+    105, 110, 101, 32, 104, 97, 115, 104, 101, 115, 32, 111, 114, 32, 106, 117, 115, 116, 32, 116, 104, 101, 32, 115,
+    116, 97, 98, 108, 101, 32, 104, 97, 115, 104, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 117, 115, 101, 70, 117, 108, 108, 80, 105, 112, 101, 108, 105, 110, 101, 72, 97, 115, 104, 34, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 85, 115, 101, 70, 117, 108, 108, 80, 105, 112, 101, 108, 105, 110, 101, 72, 97, 115,
+    104, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50, 48, 52, 51, 54, 55, 51, 52, 56, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 103, 103, 114, 101, 103,
+    97, 116, 101, 32, 116, 104, 101, 32, 71, 80, 85, 32, 116, 105, 109, 101, 32, 111, 102, 32, 101, 118, 101, 114, 121,
+    32, 98, 97, 114, 114, 105, 101, 114, 32, 98, 121, 32, 98, 97, 114, 114, 105, 101, 114, 32, 114, 101, 97, 115, 111,
+    110, 32, 97, 110, 100, 32, 98, 121, 32, 105, 109, 97, 103, 101, 44, 32, 97, 110, 100, 32, 119, 114, 105, 116, 101,
+    32, 97, 32, 112, 101, 114, 45, 102, 114, 97, 109, 101, 32, 114, 101, 112, 111, 114, 116, 32, 114, 97, 110, 107, 105,
+    110, 103, 32, 116, 104, 101, 32, 109, 111, 115, 116, 32, 101, 120, 112, 101, 110, 115, 105, 118, 101, 32, 98, 97,
+    114, 114, 105, 101, 114, 32, 114, 101, 97, 115, 111, 110, 115, 46, 32, 32, 82, 101, 113, 117, 105, 114, 101, 115,
+    32, 100, 114, 97, 119, 45, 103, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 32, 112, 114, 111, 102, 105, 108,
+    105, 110, 103, 44, 32, 119, 104, 105, 99, 104, 32, 98, 114, 97, 99, 107, 101, 116, 115, 32, 101, 97, 99, 104, 32,
+    98, 97, 114, 114, 105, 101, 114, 32, 119, 105, 116, 104, 32, 116, 105, 109, 101, 115, 116, 97, 109, 112, 115, 46,
+    34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101, 112, 111, 114, 116, 66, 97, 114,
+    114, 105, 101, 114, 67, 111, 115, 116, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 112, 111,
+    114, 116, 66, 97, 114, 114, 105, 101, 114, 67, 111, 115, 116, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 50, 50, 54, 50, 55, 52, 48, 48, 57, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    84, 114, 97, 99, 101, 32, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    48, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 84, 114, 97,
+    99, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 83, 80, 77, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 49, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 84, 114,
+    97, 99, 101, 83, 112, 109, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 69, 110, 97, 98, 108, 101, 32, 83, 81, 84, 84, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 84, 114, 97, 99, 101,
+    83, 113, 116, 116, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105,
+    108, 101, 114, 84, 114, 97, 99, 101, 77, 111, 100, 101, 70, 108, 97, 103, 115, 34, 125, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 84, 114, 97, 99, 101, 77, 111, 100, 101, 77, 97, 115, 107, 34, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 70, 108,
+    97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 32,
+    34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116,
+    114, 97, 99, 101, 77, 111, 100, 101, 77, 97, 115, 107, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 77, 97, 115, 107, 32, 105, 110, 100, 105, 99, 97, 116, 105, 110, 103, 32, 119, 104, 105,
+    99, 104, 32, 116, 114, 97, 99, 101, 115, 32, 97, 114, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 32, 66, 111,
+    116, 104, 32, 115, 112, 109, 32, 116, 114, 97, 99, 101, 32, 97, 110, 100, 32, 83, 113, 116, 116, 32, 116, 114, 97,
+    99, 101, 32, 97, 114, 101, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 40, 48, 120, 48, 41, 32, 32, 32, 83, 112,
+    109, 32, 116, 114, 97, 99, 101, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 40, 48, 120, 49, 41, 46, 32,
+    83, 113, 116, 116, 32, 116, 114, 97, 99, 101, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 40, 48, 120,
+    50, 41, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 49, 55, 54, 54, 52, 57, 55, 48,
+    125, 93, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105,
+    103, 117, 114, 97, 116, 105, 111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 116, 104, 101,
+    32, 80, 65, 76, 32, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 32, 108, 97, 121, 101, 114, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 51, 54, 49, 52, 54, 52, 50, 50, 54, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 80, 101, 114, 102, 67,
+    111, 117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71,
+    80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110,
+    34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 91, 49, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101,
+    114, 77, 111, 100, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 80, 114, 111,
+    102, 105, 108, 101, 114, 80, 101, 114, 102, 67, 111, 117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103, 34, 44,
+    32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 70, 105, 108, 101, 32, 112, 97, 116, 104, 32, 115, 112, 101, 99, 105, 102, 121, 105,
+    110, 103, 32, 119, 104, 101, 114, 101, 32, 116, 104, 101, 32, 103, 108, 111, 98, 97, 108, 32, 112, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 32, 99, 111, 117, 110, 116, 101, 114, 32, 99, 111, 110, 102, 105, 103, 32, 102,
+    105, 108, 101, 32, 99, 97, 110, 32, 98, 101, 32, 102, 111, 117, 110, 100, 46, 32, 32, 84, 104, 105, 115, 32, 102,
+    105, 108, 101, 32, 115, 104, 111, 117, 108, 100, 32, 104, 97, 118, 101, 32, 111, 110, 101, 32, 108, 105, 110, 101,
+    32, 112, 101, 114, 32, 99, 111, 117, 110, 116, 101, 114, 32, 116, 111, 32, 99, 97, 112, 116, 117, 114, 101, 32, 105,
+    110, 32, 116, 104, 101, 32, 102, 111, 114, 109, 32, 92, 34, 66, 108, 111, 99, 107, 32, 73, 68, 32, 73, 110, 115,
+    116, 97, 110, 99, 101, 32, 78, 97, 109, 101, 92, 34, 46, 32, 66, 108, 111, 99, 107, 32, 99, 97, 110, 32, 98, 101,
+    32, 111, 110, 101, 32, 111, 102, 32, 116, 104, 101, 32, 102, 111, 108, 108, 111, 119, 105, 110, 103, 58, 32, 67, 66,
+    44, 32, 67, 80, 67, 44, 32, 67, 80, 70, 44, 32, 67, 80, 71, 44, 32, 68, 66, 44, 32, 68, 77, 65, 44, 32, 71, 68, 83,
+    44, 32, 71, 82, 66, 77, 44, 32, 71, 82, 66, 77, 95, 83, 69, 44, 32, 73, 65, 44, 32, 77, 67, 44, 32, 80, 65, 44, 32,
+    82, 76, 67, 44, 32, 83, 67, 44, 32, 83, 80, 73, 44, 32, 83, 81, 44, 32, 83, 82, 66, 77, 44, 32, 83, 88, 44, 32, 84,
+    65, 44, 32, 84, 67, 65, 44, 32, 84, 67, 67, 44, 32, 84, 67, 80, 44, 32, 84, 67, 83, 44, 32, 84, 68, 44, 32, 86, 71,
+    84, 44, 32, 87, 68, 46, 32, 73, 68, 32, 115, 104, 111, 117, 108, 100, 32, 99, 111, 114, 114, 101, 115, 112, 111,
+    110, 100, 32, 116, 111, 32, 116, 104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 99, 32, 99, 111, 117, 110, 116,
+    101, 114, 32, 111, 102, 32, 105, 110, 116, 101, 114, 101, 115, 116, 32, 102, 111, 114, 32, 116, 104, 101, 32, 115,
+    112, 101, 99, 105, 102, 105, 101, 100, 32, 66, 108, 111, 99, 107, 44, 32, 116, 104, 101, 115, 101, 32, 99, 97, 110,
+    32, 98, 101, 32, 115, 101, 108, 101, 99, 116, 101, 100, 32, 98, 121, 32, 114, 101, 97, 100, 105, 110, 103, 32, 116,
+    104, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 99, 111, 117, 110, 116, 101, 114, 32, 115,
+    101, 108, 101, 99, 116, 32, 114, 101, 103, 105, 115, 116, 101, 114, 32, 102, 111, 114, 32, 116, 104, 97, 116, 32,
+    98, 108, 111, 99, 107, 46, 32, 73, 110, 115, 116, 97, 110, 99, 101, 32, 99, 97, 110, 32, 98, 101, 32, 116, 104, 101,
+    32, 98, 108, 111, 99, 107, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 111, 114, 100, 105, 110, 97, 108, 32, 111,
+    102, 32, 105, 110, 116, 101, 114, 101, 115, 116, 46, 32, 73, 116, 32, 99, 97, 110, 32, 97, 108, 115, 111, 32, 98,
+    101, 32, 116, 104, 101, 32, 101, 110, 117, 109, 32, 69, 65, 67, 72, 32, 119, 104, 105, 99, 104, 32, 109, 101, 97,
+    110, 115, 32, 101, 118, 101, 114, 121, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 111, 102, 32, 116, 104, 101,
+    32, 98, 108, 111, 99, 107, 32, 105, 115, 32, 111, 102, 32, 105, 110, 116, 101, 114, 101, 115, 116, 46, 32, 65, 108,
+    115, 111, 32, 73, 116, 32, 99, 97, 110, 32, 98, 101, 32, 65, 76, 76, 44, 32, 119, 104, 105, 99, 104, 32, 104, 97,
+    115, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 109, 101, 97, 110, 105, 110, 103, 32, 97, 115, 32, 69, 65, 67,
+    72, 44, 32, 98, 117, 116, 32, 116, 104, 101, 32, 114, 101, 115, 117, 108, 116, 115, 32, 111, 102, 32, 101, 118, 101,
+    114, 121, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 97, 99, 99, 117, 109,
+    108, 97, 116, 101, 100, 46, 32, 78, 97, 109, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 116, 104, 101, 32, 104,
+    101, 97, 100, 101, 114, 32, 111, 102, 32, 116, 104, 101, 32, 99, 111, 108, 117, 109, 110, 32, 105, 110, 32, 116,
+    104, 101, 32, 46, 99, 115, 118, 32, 102, 105, 108, 101, 32, 40, 108, 105, 109, 105, 116, 101, 100, 32, 116, 111, 32,
+    49, 50, 55, 32, 99, 104, 97, 114, 97, 99, 116, 101, 114, 115, 41, 46, 32, 32, 65, 32, 92, 34, 35, 92, 34, 32, 99,
+    97, 110, 32, 98, 101, 32, 105, 110, 115, 101, 114, 116, 101, 100, 32, 97, 115, 32, 116, 104, 101, 32, 102, 105, 114,
+    115, 116, 32, 99, 104, 97, 114, 97, 99, 116, 101, 114, 32, 105, 110, 32, 97, 32, 108, 105, 110, 101, 32, 116, 111,
+    32, 102, 111, 114, 99, 101, 32, 116, 104, 97, 116, 32, 108, 105, 110, 101, 32, 116, 111, 32, 98, 101, 32, 105, 103,
+    110, 111, 114, 101, 100, 46, 32, 32, 71, 97, 116, 104, 101, 114, 105, 110, 103, 32, 112, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 32, 99, 111, 117, 110, 116, 101, 114, 115, 32, 104, 97, 115, 32, 97, 32, 104, 117, 103, 101,
+    32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 105, 109, 112, 97, 99, 116, 59, 32, 99, 111, 110, 115,
+    105, 100, 101, 114, 32, 100, 105, 115, 97, 98, 108, 105, 110, 103, 32, 84, 68, 82, 115, 32, 111, 110, 32, 87, 105,
+    110, 100, 111, 119, 115, 46, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 70, 105, 108, 101,
+    34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 34, 34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 70,
+    105, 108, 101, 78, 97, 109, 101, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115,
+    116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103,
+    108, 111, 98, 97, 108, 80, 101, 114, 102, 67, 111, 117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103, 70, 105,
+    108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 108, 111, 98, 97, 108, 80, 101, 114, 102, 67, 111,
+    117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103, 70, 105, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 49, 54, 54, 54, 49, 50, 51, 55, 56, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 73, 110, 115, 101, 114, 116, 32, 99, 97, 99, 104, 101, 32, 102, 108, 117, 115,
+    104, 32, 97, 110, 100, 32, 105, 110, 118, 97, 108, 105, 100, 97, 116, 101, 32, 101, 118, 101, 110, 116, 115, 32, 98,
+    101, 102, 111, 114, 101, 32, 97, 110, 100, 32, 97, 102, 116, 101, 114, 32, 101, 118, 101, 114, 121, 32, 114, 97,
+    110, 103, 101, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110, 100, 115, 32, 119, 104, 101, 114, 101, 32, 112, 101,
+    114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 99, 111, 117, 110, 116, 101, 114, 115, 32, 97, 114, 101, 32, 99, 111,
+    108, 108, 101, 99, 116, 101, 100, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 97, 99,
+    104, 101, 70, 108, 117, 115, 104, 79, 110, 67, 111, 117, 110, 116, 101, 114, 67, 111, 108, 108, 101, 99, 116, 105,
+    111, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 97, 99, 104, 101, 70, 108, 117, 115, 104, 79, 110,
+    67, 111, 117, 110, 116, 101, 114, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 51, 53, 52, 51, 53, 49, 57, 55, 54, 50, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114,
+    111, 102, 105, 108, 101, 114, 71, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 68, 114, 97, 119, 34, 44, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 80, 101, 114, 32, 100, 114, 97, 119, 46, 32, 32, 69, 97, 99, 104, 32, 115, 101, 112, 97, 114, 97, 116, 101, 32,
+    100, 114, 97, 119, 32, 119, 105, 108, 108, 32, 98, 101, 32, 109, 101, 97, 115, 117, 114, 101, 100, 46, 34, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 71, 114, 97,
+    110, 117, 108, 97, 114, 105, 116, 121, 67, 109, 100, 66, 117, 102, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 101, 114, 32, 99, 111,
+    109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 46, 32, 32, 87, 104, 111, 108, 101, 32, 99, 111, 109, 109,
+    97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 103, 114, 111, 117,
+    112, 101, 100, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105,
+    108, 101, 114, 71, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 70, 114, 97, 109, 101, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80,
+    101, 114, 32, 102, 114, 97, 109, 101, 44, 32, 116, 104, 101, 32, 119, 104, 111, 108, 101, 32, 102, 114, 97, 109,
+    101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 103, 114, 111, 117, 112, 101, 100, 46, 32, 32, 85, 115, 101, 102, 117,
+    108, 32, 116, 111, 32, 103, 101, 116, 32, 97, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 99,
+    111, 118, 101, 114, 105, 110, 103, 32, 97, 108, 108, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102,
+    101, 114, 115, 32, 97, 99, 114, 111, 115, 115, 32, 116, 104, 101, 32, 117, 110, 105, 118, 101, 114, 115, 97, 108,
+    32, 97, 110, 100, 32, 99, 111, 109, 112, 117, 116, 101, 32, 113, 117, 101, 117, 101, 115, 46, 32, 32, 80, 105, 112,
+    101, 108, 105, 110, 101, 32, 115, 116, 97, 116, 115, 32, 119, 105, 108, 108, 32, 110, 111, 116, 32, 98, 101, 32,
+    103, 97, 116, 104, 101, 114, 101, 100, 32, 105, 110, 32, 116, 104, 105, 115, 32, 109, 111, 100, 101, 46, 32, 32, 78,
+    79, 84, 69, 58, 32, 83, 105, 110, 99, 101, 32, 83, 81, 84, 84, 32, 119, 105, 108, 108, 32, 98, 101, 32, 102, 105,
+    108, 116, 101, 114, 101, 100, 32, 98, 121, 32, 86, 77, 73, 68, 32, 105, 102, 32, 121, 111, 117, 32, 119, 105, 115,
+    104, 32, 116, 111, 32, 103, 97, 116, 104, 101, 114, 32, 97, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99,
+    101, 32, 97, 99, 114, 111, 115, 115, 32, 109, 117, 108, 116, 105, 112, 108, 101, 32, 113, 117, 101, 117, 101, 115,
+    32, 40, 105, 46, 101, 46, 44, 32, 105, 110, 99, 108, 117, 100, 105, 110, 103, 32, 97, 115, 121, 110, 99, 32, 99,
+    111, 109, 112, 117, 116, 101, 32, 119, 111, 114, 107, 41, 44, 32, 97, 32, 68, 101, 98, 117, 103, 32, 86, 77, 73, 68,
+    32, 115, 104, 111, 117, 108, 100, 32, 97, 108, 115, 111, 32, 98, 101, 32, 114, 101, 113, 117, 101, 115, 116, 101,
+    100, 32, 116, 111, 32, 101, 110, 115, 117, 114, 101, 32, 119, 111, 114, 107, 32, 105, 110, 32, 97, 108, 108, 32,
+    113, 117, 101, 117, 101, 115, 32, 115, 104, 97, 114, 101, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 86, 77, 73,
+    68, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101,
+    114, 71, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71,
+    114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 71,
+    114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 68, 114, 97, 119, 34, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    103, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 119, 104, 97, 116, 32, 103, 114, 97, 110,
+    117, 108, 97, 114, 105, 116, 121, 32, 115, 104, 111, 117, 108, 100, 32, 98, 101, 32, 117, 115, 101, 100, 32, 102,
+    111, 114, 32, 103, 97, 116, 104, 101, 114, 105, 110, 103, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101,
+    32, 100, 97, 116, 97, 58, 32, 32, 48, 58, 32, 80, 101, 114, 32, 100, 114, 97, 119, 46, 32, 32, 69, 97, 99, 104, 32,
+    115, 101, 112, 97, 114, 97, 116, 101, 32, 100, 114, 97, 119, 32, 119, 105, 108, 108, 32, 98, 101, 32, 109, 101, 97,
+    115, 117, 114, 101, 100, 46, 32, 49, 58, 32, 80, 101, 114, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102,
+    102, 101, 114, 46, 32, 32, 87, 104, 111, 108, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101,
+    114, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 103, 114, 111, 117, 112, 101, 100, 46, 32, 50, 58, 32, 80, 101,
+    114, 32, 102, 114, 97, 109, 101, 46, 32, 32, 87, 104, 111, 108, 101, 32, 102, 114, 97, 109, 101, 32, 119, 105, 108,
+    108, 32, 98, 101, 32, 103, 114, 111, 117, 112, 101, 100, 46, 32, 32, 85, 115, 101, 102, 117, 108, 32, 116, 111, 32,
+    103, 101, 116, 32, 97, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 99, 111, 118, 101, 114, 105,
+    110, 103, 32, 97, 108, 108, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 97, 99,
+    114, 111, 115, 115, 32, 116, 104, 101, 32, 117, 110, 105, 118, 101, 114, 115, 97, 108, 32, 97, 110, 100, 32, 99,
+    111, 109, 112, 117, 116, 101, 32, 113, 117, 101, 117, 101, 115, 46, 32, 32, 80, 105, 112, 101, 108, 105, 110, 101,
+    32, 115, 116, 97, 116, 115, 32, 99, 97, 110, 110, 111, 116, 32, 98, 101, 32, 103, 97, 116, 104, 101, 114, 101, 100,
+    32, 105, 110, 32, 116, 104, 105, 115, 32, 109, 111, 100, 101, 46, 32, 32, 73, 102, 32, 121, 111, 117, 32, 119, 105,
+    115, 104, 32, 116, 111, 32, 103, 97, 116, 104, 101, 114, 32, 97, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97,
+    99, 101, 32, 97, 99, 114, 111, 115, 115, 32, 109, 117, 108, 116, 105, 112, 108, 101, 32, 113, 117, 101, 117, 101,
+    115, 32, 40, 105, 46, 101, 46, 44, 32, 105, 110, 99, 108, 117, 100, 105, 110, 103, 32, 97, 115, 121, 110, 99, 32,
+    99, 111, 109, 112, 117, 116, 101, 32, 119, 111, 114, 107, 41, 44, 32, 121, 111, 117, 32, 115, 104, 111, 117, 108,
+    100, 32, 97, 108, 115, 111, 32, 115, 101, 116, 32, 114, 101, 113, 117, 101, 115, 116, 68, 101, 98, 117, 103, 86,
+    109, 105, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 56, 48, 57, 53, 51, 52,
+    53, 51, 125, 93, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102,
+    105, 103, 117, 114, 97, 116, 105, 111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 112, 101,
+    114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 99, 111, 117, 110, 116, 101, 114, 32, 99, 111, 108, 108, 101, 99,
+    116, 105, 111, 110, 32, 116, 104, 114, 111, 117, 103, 104, 32, 116, 104, 101, 32, 80, 65, 76, 32, 71, 80, 85, 32,
+    80, 114, 111, 102, 105, 108, 101, 114, 32, 76, 97, 121, 101, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 52, 56, 53, 53, 48, 55, 54, 53, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71,
+    112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 113, 116, 116, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 34, 93, 44, 32, 34, 68,
+    101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91,
+    123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 49, 93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32,
+    34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112,
+    117, 80, 114, 111, 102, 105, 108, 101, 114, 77, 111, 100, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 103, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 113, 116, 116, 67, 111, 110, 102, 105, 103,
+    34, 44, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 84, 111, 107, 101, 110, 77, 97, 115, 107, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115,
+    72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 54, 53, 53, 51, 53, 125, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 116, 111, 107, 101, 110, 77, 97, 115, 107, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 77, 97, 115, 107, 32, 105, 110, 100, 105, 99, 97, 116, 105, 110, 103, 32, 119, 104, 105,
+    99, 104, 32, 83, 81, 84, 84, 32, 116, 111, 107, 101, 110, 115, 32, 115, 104, 111, 117, 108, 100, 32, 98, 101, 32,
+    105, 110, 99, 108, 117, 100, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 116, 114, 97, 99, 101, 46, 32, 32, 86,
+    97, 108, 117, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 119, 114, 105, 116, 116, 101, 110, 32, 116, 111, 32, 84,
+    79, 75, 69, 78, 95, 77, 65, 83, 75, 32, 102, 105, 101, 108, 100, 32, 105, 110, 32, 104, 97, 114, 100, 119, 97, 114,
+    101, 46, 32, 32, 70, 111, 114, 32, 114, 101, 102, 101, 114, 101, 110, 99, 101, 44, 32, 98, 97, 115, 101, 100, 32,
+    111, 110, 32, 71, 70, 88, 56, 32, 83, 81, 84, 84, 32, 117, 115, 101, 114, 32, 103, 117, 105, 100, 101, 58, 32, 48,
+    120, 48, 48, 48, 49, 58, 32, 84, 73, 77, 69, 32, 40, 84, 84, 50, 46, 48, 32, 111, 110, 108, 121, 41, 44, 32, 77, 73,
+    83, 67, 32, 40, 84, 84, 50, 46, 49, 43, 41, 32, 48, 120, 48, 48, 48, 50, 58, 32, 84, 73, 77, 69, 83, 84, 65, 77, 80,
+    32, 48, 120, 48, 48, 48, 52, 58, 32, 82, 69, 71, 32, 48, 120, 48, 48, 48, 56, 58, 32, 87, 65, 86, 69, 95, 83, 84,
+    65, 82, 84, 32, 48, 120, 48, 48, 49, 48, 58, 32, 87, 65, 86, 69, 95, 80, 83, 95, 65, 76, 76, 79, 67, 32, 40, 84, 84,
+    50, 46, 48, 32, 111, 110, 108, 121, 41, 32, 47, 32, 87, 65, 86, 69, 95, 65, 76, 76, 79, 67, 32, 40, 84, 84, 50, 46,
+    49, 43, 41, 32, 48, 120, 48, 48, 50, 48, 58, 32, 87, 65, 86, 69, 95, 86, 83, 95, 65, 76, 76, 79, 67, 32, 40, 84, 84,
+    50, 46, 48, 32, 111, 110, 108, 121, 41, 32, 47, 32, 82, 69, 71, 95, 67, 83, 80, 82, 73, 86, 32, 40, 84, 84, 50, 46,
+    49, 43, 41, 32, 48, 120, 48, 48, 52, 48, 58, 32, 87, 65, 86, 69, 95, 69, 78, 68, 32, 48, 120, 48, 48, 56, 48, 58,
+    32, 69, 86, 69, 78, 84, 32, 48, 120, 48, 49, 48, 48, 58, 32, 69, 86, 69, 78, 84, 95, 67, 83, 32, 48, 120, 48, 50,
+    48, 48, 58, 32, 69, 86, 69, 78, 84, 95, 71, 70, 88, 49, 32, 48, 120, 48, 52, 48, 48, 58, 32, 73, 78, 83, 84, 32, 48,
+    120, 48, 56, 48, 48, 58, 32, 73, 78, 83, 84, 95, 80, 67, 32, 48, 120, 49, 48, 48, 48, 58, 32, 73, 78, 83, 84, 95,
+    85, 83, 69, 82, 68, 65, 84, 65, 32, 48, 120, 50, 48, 48, 48, 58, 32, 73, 83, 83, 85, 69, 32, 48, 120, 52, 48, 48,
+    48, 58, 32, 80, 69, 82, 70, 32, 48, 120, 56, 48, 48, 48, 58, 32, 77, 73, 83, 67, 32, 40, 84, 84, 50, 46, 48, 32,
+    111, 110, 108, 121, 41, 44, 32, 82, 69, 71, 95, 67, 83, 40, 84, 84, 50, 46, 49, 43, 41, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 56, 57, 53, 57, 49, 49, 55, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 69, 110, 103, 105, 110, 101, 45, 48, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114,
+    97, 99, 101, 32, 102, 111, 114, 32, 83, 104, 97, 100, 101, 114, 32, 69, 110, 103, 105, 110, 101, 32, 48, 34, 125,
+    44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 69, 110, 103, 105, 110, 101, 45, 49,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 32, 102, 111, 114, 32, 83, 104, 97, 100, 101, 114, 32, 69, 110, 103, 105,
+    110, 101, 32, 49, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 69, 110,
+    103, 105, 110, 101, 45, 50, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 32, 102, 111, 114, 32, 83, 104, 97, 100,
+    101, 114, 32, 69, 110, 103, 105, 110, 101, 32, 50, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83,
+    104, 97, 100, 101, 114, 69, 110, 103, 105, 110, 101, 45, 51, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 32, 102, 111,
+    114, 32, 83, 104, 97, 100, 101, 114, 32, 69, 110, 103, 105, 110, 101, 32, 51, 34, 125, 93, 125, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 83, 69, 77, 97, 115, 107, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73,
+    115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 49, 53, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 101, 77, 97, 115, 107,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 115, 107, 32, 105, 110,
+    100, 105, 99, 97, 116, 105, 110, 103, 32, 119, 104, 105, 99, 104, 32, 119, 104, 105, 99, 104, 32, 83, 69, 32, 116,
+    111, 32, 103, 97, 116, 104, 101, 114, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 102, 114, 111,
+    109, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 51, 56, 49, 52, 53, 56, 52, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105,
+    110, 101, 32, 99, 111, 109, 112, 105, 108, 101, 114, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108,
+    101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 32, 73,
+    102, 32, 116, 104, 105, 115, 32, 105, 115, 32, 122, 101, 114, 111, 44, 32, 116, 104, 114, 101, 97, 100, 32, 116,
+    114, 97, 99, 101, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114,
+    32, 97, 108, 108, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 32, 32, 84, 104, 105, 115, 32, 102, 105, 108,
+    116, 101, 114, 105, 110, 103, 32, 111, 110, 108, 121, 32, 97, 112, 112, 108, 105, 101, 115, 32, 116, 111, 32, 100,
+    114, 97, 119, 32, 111, 114, 32, 99, 109, 100, 98, 117, 102, 32, 112, 114, 111, 102, 105, 108, 105, 110, 103, 32,
+    103, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 46, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34,
+    73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 117, 105, 110, 116, 54, 52, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 112, 105, 112, 101, 108, 105, 110, 101, 72, 97, 115, 104, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80,
+    105, 112, 101, 108, 105, 110, 101, 72, 97, 115, 104, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    53, 54, 50, 51, 49, 53, 51, 54, 54, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 115, 72, 97, 115,
+    104, 72, 105, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116,
+    114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 118, 115, 72, 97, 115, 104, 72, 105,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 105, 103, 104, 32, 81, 87,
+    79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 86, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98,
+    108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 52, 54, 49, 52, 55, 49, 56, 56, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 118, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 76, 111, 119, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 86, 83,
+    32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100,
+    32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 50, 57, 55, 53, 49, 49, 57, 55, 54, 50, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 72, 115, 72, 97,
+    115, 104, 72, 105, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 104, 115, 72, 97, 115, 104, 72,
+    105, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 105, 103, 104, 32, 81,
+    87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 72, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97,
+    98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 55, 50, 56, 53, 53, 56, 49, 57, 56, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 72, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 104, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 76, 111, 119, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 72, 83,
+    32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100,
+    32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 50, 50, 53, 56, 49, 56, 48, 48, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 115, 72, 97,
+    115, 104, 72, 105, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 115, 72, 97, 115, 104, 72,
+    105, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 105, 103, 104, 32, 81,
+    87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 68, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97,
+    98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 53, 54, 55, 48, 53, 49, 49, 52, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 100, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 76, 111, 119, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 68, 83,
+    32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100,
+    32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 50, 48, 49, 56, 52, 54, 52, 48, 52, 52, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 115, 72, 97,
+    115, 104, 72, 105, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 115, 72, 97, 115, 104, 72,
+    105, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 105, 103, 104, 32, 81,
+    87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 71, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97,
+    98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 49, 57, 54, 50, 50, 57, 55, 54, 53, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 103, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 76, 111, 119, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 71, 83,
+    32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100,
+    32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 51, 56, 49, 55, 50, 49, 49, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 115, 72, 97,
+    115, 104, 72, 105, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 115, 72, 97, 115, 104, 72,
+    105, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 105, 103, 104, 32, 81,
+    87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 80, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97,
+    98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 51, 48, 54, 52, 50, 53, 55, 57, 48, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 112, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 76, 111, 119, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 80, 83,
+    32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100,
+    32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 49, 51, 52, 48, 54, 55, 50, 53, 55, 54, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 72, 97,
+    115, 104, 72, 105, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 115, 72, 97, 115, 104, 72,
+    105, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 105, 103, 104, 32, 81,
+    87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 67, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97,
+    98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 57, 48, 54, 55, 54, 53, 48, 53, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 99, 115, 72, 97, 115, 104, 76, 111, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 76, 111, 119, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 67, 83,
+    32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100,
+    32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 49, 54, 48, 52, 50, 52, 48, 48, 51, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 68,
+    114, 97, 119, 115, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 68, 114, 97, 119,
+    115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 32, 110, 117,
+    109, 98, 101, 114, 32, 111, 102, 32, 100, 114, 97, 119, 115, 32, 116, 111, 32, 116, 104, 114, 101, 97, 100, 45, 116,
+    114, 97, 99, 101, 46, 32, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 48, 32, 105, 110, 100, 105, 99, 97,
+    116, 101, 115, 32, 110, 111, 32, 108, 105, 109, 105, 116, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 50, 57, 51, 56, 51, 50, 52, 50, 54, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100,
+    100, 84, 116, 118, 72, 97, 115, 104, 101, 115, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 97, 100, 100, 84, 116, 118, 72, 97, 115, 104, 101, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 116, 104, 101, 114, 32, 116, 111, 32, 105, 110, 106, 101, 99, 116, 32,
+    116, 104, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 104, 97, 115, 104, 32, 97, 110, 100, 32, 99, 108,
+    105, 101, 110, 116, 32, 115, 104, 97, 100, 101, 114, 32, 104, 97, 115, 101, 115, 32, 105, 110, 116, 111, 32, 116,
+    104, 101, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 102, 111, 114, 32, 84, 104, 114, 101, 97,
+    100, 32, 84, 114, 97, 99, 101, 32, 86, 105, 101, 119, 101, 114, 32, 97, 110, 97, 108, 121, 115, 105, 115, 46, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 49, 56, 53, 53, 49, 55, 57, 125, 44, 32, 123,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 97,
+    109, 111, 117, 110, 116, 32, 111, 102, 32, 100, 97, 116, 97, 32, 105, 110, 32, 98, 121, 116, 101, 115, 32, 116, 111,
+    32, 99, 97, 112, 116, 117, 114, 101, 32, 112, 101, 114, 32, 116, 114, 97, 99, 101, 46, 32, 32, 65, 32, 116, 114, 97,
+    99, 101, 32, 119, 105, 108, 108, 32, 99, 111, 118, 101, 114, 32, 97, 32, 115, 112, 97, 110, 32, 111, 102, 32, 99,
+    111, 109, 109, 97, 110, 100, 115, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 116, 104, 101, 32, 71, 112, 117, 80,
+    114, 111, 102, 105, 108, 101, 114, 71, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 32, 115, 101, 116, 116, 105,
+    110, 103, 46, 32, 32, 68, 101, 102, 97, 117, 108, 116, 115, 32, 116, 111, 32, 49, 77, 66, 46, 32, 32, 67, 117, 114,
+    114, 101, 110, 116, 32, 72, 87, 32, 114, 101, 113, 117, 105, 114, 101, 115, 32, 116, 104, 101, 32, 115, 105, 122,
+    101, 32, 98, 101, 32, 97, 108, 105, 103, 110, 101, 100, 32, 116, 111, 32, 48, 120, 49, 48, 48, 48, 32, 98, 121, 116,
+    101, 115, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 49, 48, 52, 56, 53, 55, 54, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 105, 122, 101,
+    95, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 117, 102, 102,
+    101, 114, 83, 105, 122, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 117, 102, 102, 101, 114, 83, 105,
+    122, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 51, 51, 51, 56, 53, 49, 48, 51,
+    125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 116, 97, 108, 108, 77, 111, 100, 101, 34, 44,
+    32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 65, 108, 119, 97, 121, 115, 32, 115, 116, 97, 108, 108, 44, 32, 110, 101, 118, 101, 114, 32, 100,
+    105, 115, 99, 97, 114, 100, 32, 100, 97, 116, 97, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 116, 97, 108, 108, 65,
+    108, 119, 97, 121, 115, 34, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 76, 111, 115, 101, 32, 100, 101, 116, 97, 105, 108, 101, 100, 32, 112, 114, 111, 102, 105, 108, 105, 110, 103,
+    32, 100, 97, 116, 97, 32, 119, 104, 101, 110, 32, 110, 101, 99, 101, 115, 115, 97, 114, 121, 32, 116, 111, 32, 97,
+    116, 116, 101, 109, 112, 116, 32, 116, 111, 32, 97, 118, 111, 105, 100, 32, 115, 116, 97, 108, 108, 115, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111,
+    102, 105, 108, 101, 114, 83, 116, 97, 108, 108, 76, 111, 115, 101, 68, 101, 116, 97, 105, 108, 34, 125, 44, 32, 123,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 101, 118, 101, 114, 32, 115, 116, 97,
+    108, 108, 44, 32, 100, 105, 115, 99, 97, 114, 100, 32, 100, 97, 116, 97, 32, 105, 102, 32, 116, 104, 101, 32, 98,
+    117, 102, 102, 101, 114, 32, 105, 115, 32, 102, 117, 108, 108, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    50, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 116, 97,
+    108, 108, 78, 101, 118, 101, 114, 34, 125, 93, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 116, 97, 108,
+    108, 66, 101, 104, 97, 118, 105, 111, 114, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 116,
+    97, 108, 108, 65, 108, 119, 97, 121, 115, 34, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117,
+    109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 116, 97, 108, 108,
+    66, 101, 104, 97, 118, 105, 111, 114, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 66, 101, 104, 97, 118, 105, 111, 114, 32, 116, 111, 32, 116, 97, 107, 101, 32, 119, 104, 101, 110, 32, 116,
+    114, 97, 99, 101, 32, 98, 117, 102, 102, 101, 114, 32, 105, 115, 32, 102, 117, 108, 108, 46, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 48, 56, 56, 56, 49, 54, 49, 54, 125, 93, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111,
+    110, 32, 111, 112, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 99, 97, 112, 116, 117, 114, 105, 110, 103, 32,
+    97, 32, 83, 81, 32, 84, 104, 114, 101, 97, 100, 32, 84, 114, 97, 99, 101, 32, 116, 104, 114, 111, 117, 103, 104, 32,
+    116, 104, 101, 32, 80, 65, 76, 32, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 32, 108, 97, 121, 101,
+    114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 52, 54, 56, 52, 52, 54, 53, 56,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83,
+    112, 109, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 80, 85, 32, 80,
+    114, 111, 102, 105, 108, 101, 114, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123,
+    34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 49,
+    93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 77, 111, 100,
+    101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 80, 114, 111, 102, 105, 108,
+    101, 114, 83, 112, 109, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34,
+    58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 105, 108, 101, 32,
+    112, 97, 116, 104, 32, 115, 112, 101, 99, 105, 102, 121, 105, 110, 103, 32, 119, 104, 101, 114, 101, 32, 116, 104,
+    101, 32, 103, 108, 111, 98, 97, 108, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 99, 111, 117, 110,
+    116, 101, 114, 32, 99, 111, 110, 102, 105, 103, 32, 102, 105, 108, 101, 32, 99, 97, 110, 32, 98, 101, 32, 102, 111,
+    117, 110, 100, 46, 32, 32, 84, 104, 105, 115, 32, 102, 105, 108, 101, 32, 115, 104, 111, 117, 108, 100, 32, 104, 97,
+    118, 101, 32, 111, 110, 101, 32, 108, 105, 110, 101, 32, 112, 101, 114, 32, 99, 111, 117, 110, 116, 101, 114, 32,
+    116, 111, 32, 99, 97, 112, 116, 117, 114, 101, 32, 105, 110, 32, 116, 104, 101, 32, 102, 111, 114, 109, 32, 92, 34,
+    66, 108, 111, 99, 107, 32, 73, 68, 32, 73, 110, 115, 116, 97, 110, 99, 101, 32, 78, 97, 109, 101, 92, 34, 46, 32,
+    66, 108, 111, 99, 107, 32, 99, 97, 110, 32, 98, 101, 32, 111, 110, 101, 32, 111, 102, 32, 116, 104, 101, 32, 102,
+    111, 108, 108, 111, 119, 105, 110, 103, 58, 32, 67, 66, 44, 32, 67, 80, 67, 44, 32, 67, 80, 70, 44, 32, 67, 80, 71,
+    44, 32, 68, 66, 44, 32, 68, 77, 65, 44, 32, 71, 68, 83, 44, 32, 71, 82, 66, 77, 44, 32, 71, 82, 66, 77, 95, 83, 69,
+    44, 32, 73, 65, 44, 32, 77, 67, 44, 32, 80, 65, 44, 32, 82, 76, 67, 44, 32, 83, 67, 44, 32, 83, 80, 73, 44, 32, 83,
+    81, 44, 32, 83, 82, 66, 77, 44, 32, 83, 88, 44, 32, 84, 65, 44, 32, 84, 67, 65, 44, 32, 84, 67, 67, 44, 32, 84, 67,
+    80, 44, 32, 84, 67, 83, 44, 32, 84, 68, 44, 32, 86, 71, 84, 44, 32, 87, 68, 46, 32, 32, 73, 68, 32, 115, 104, 111,
+    117, 108, 100, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 32, 99, 111, 117, 110, 116, 101, 114, 32, 111,
+    102, 32, 105, 110, 116, 101, 114, 101, 115, 116, 32, 102, 111, 114, 32, 116, 104, 101, 32, 115, 112, 101, 99, 105,
+    102, 105, 101, 100, 32, 66, 108, 111, 99, 107, 44, 32, 116, 104, 101, 115, 101, 32, 99, 97, 110, 32, 98, 101, 32,
+    115, 101, 108, 101, 99, 116, 101, 100, 32, 98, 121, 32, 114, 101, 97, 100, 105, 110, 103, 32, 116, 104, 101, 32,
+    112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 116, 111, 32, 116, 104, 101, 32, 115, 112, 101, 99, 105,
+    102, 105, 99, 32, 99, 111, 117, 110, 116, 101, 114, 32, 115, 101, 108, 101, 99, 116, 32, 114, 101, 103, 105, 115,
+    116, 101, 114, 32, 102, 111, 114, 32, 116, 104, 97, 116, 32, 98, 108, 111, 99, 107, 46, 32, 73, 110, 115, 116, 97,
+    110, 99, 101, 32, 99, 97, 110, 32, 98, 101, 32, 116, 104, 101, 32, 98, 108, 111, 99, 107, 32, 105, 110, 115, 116,
+    97, 110, 99, 101, 32, 111, 114, 100, 105, 110, 97, 108, 32, 111, 102, 32, 105, 110, 116, 101, 114, 101, 115, 116,
+    46, 32, 73, 116, 32, 99, 97, 110, 32, 97, 108, 115, 111, 32, 98, 101, 32, 116, 104, 101, 32, 101, 110, 117, 109, 32,
+    69, 65, 67, 72, 32, 119, 104, 105, 99, 104, 32, 109, 101, 97, 110, 115, 32, 101, 118, 101, 114, 121, 32, 105, 110,
+    115, 116, 97, 110, 99, 101, 32, 111, 102, 32, 116, 104, 101, 32, 98, 108, 111, 99, 107, 32, 105, 115, 32, 111, 102,
+    32, 105, 110, 116, 101, 114, 101, 115, 116, 46, 32, 65, 108, 115, 111, 32, 73, 116, 32, 99, 97, 110, 32, 98, 101,
+    32, 65, 76, 76, 44, 32, 119, 104, 105, 99, 104, 32, 104, 97, 115, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 109,
+    101, 97, 110, 105, 110, 103, 32, 97, 115, 32, 69, 65, 67, 72, 44, 32, 98, 117, 116, 32, 116, 104, 101, 32, 114, 101,
+    115, 117, 108, 116, 115, 32, 111, 102, 32, 101, 118, 101, 114, 121, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32,
+    119, 105, 108, 108, 32, 98, 101, 32, 97, 99, 99, 117, 109, 108, 97, 116, 101, 100, 46, 32, 78, 97, 109, 101, 32,
+    119, 105, 108, 108, 32, 98, 101, 32, 116, 104, 101, 32, 104, 101, 97, 100, 101, 114, 32, 111, 102, 32, 116, 104,
+    101, 32, 99, 111, 108, 117, 109, 110, 32, 105, 110, 32, 116, 104, 101, 32, 46, 99, 115, 118, 32, 102, 105, 108, 101,
+    32, 40, 108, 105, 109, 105, 116, 101, 100, 32, 116, 111, 32, 49, 50, 55, 32, 99, 104, 97, 114, 97, 99, 116, 101,
+    114, 115, 41, 46, 32, 32, 65, 32, 92, 34, 35, 92, 34, 32, 99, 97, 110, 32, 98, 101, 32, 105, 110, 115, 101, 114,
+    116, 101, 100, 32, 97, 115, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 32, 99, 104, 97, 114, 97, 99, 116, 101,
+    114, 32, 105, 110, 32, 97, 32, 108, 105, 110, 101, 32, 116, 111, 32, 102, 111, 114, 99, 101, 32, 116, 104, 97, 116,
+    32, 108, 105, 110, 101, 32, 116, 111, 32, 98, 101, 32, 105, 103, 110, 111, 114, 101, 100, 46, 32, 32, 71, 97, 116,
+    104, 101, 114, 105, 110, 103, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 99, 111, 117, 110, 116,
+    101, 114, 115, 32, 104, 97, 115, 32, 97, 32, 104, 117, 103, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99,
+    101, 32, 105, 109, 112, 97, 99, 116, 59, 32, 99, 111, 110, 115, 105, 100, 101, 114, 32, 100, 105, 115, 97, 98, 108,
+    105, 110, 103, 32, 84, 68, 82, 115, 32, 111, 110, 32, 87, 105, 110, 100, 111, 119, 115, 46, 32, 87, 65, 82, 78, 73,
+    78, 71, 58, 32, 80, 97, 103, 101, 32, 102, 97, 117, 108, 116, 32, 119, 105, 108, 108, 32, 111, 99, 99, 117, 114, 32,
+    119, 104, 101, 110, 32, 97, 116, 116, 101, 109, 112, 116, 105, 110, 103, 32, 115, 112, 109, 32, 116, 114, 97, 99,
+    101, 115, 32, 111, 110, 32, 71, 70, 88, 57, 32, 72, 87, 44, 32, 117, 110, 108, 101, 115, 115, 32, 82, 76, 67, 95,
+    83, 80, 77, 95, 86, 77, 73, 68, 32, 105, 115, 32, 115, 101, 116, 32, 105, 110, 32, 116, 104, 101, 32, 82, 76, 67,
+    95, 83, 80, 77, 95, 77, 67, 95, 67, 78, 84, 76, 32, 114, 101, 103, 105, 115, 116, 101, 114, 46, 32, 75, 77, 68, 32,
+    104, 97, 115, 32, 116, 111, 32, 115, 101, 116, 32, 116, 104, 105, 115, 32, 114, 101, 103, 105, 115, 116, 101, 114,
+    46, 32, 84, 104, 105, 115, 32, 114, 101, 103, 105, 115, 116, 101, 114, 32, 99, 97, 110, 32, 98, 101, 32, 115, 101,
+    116, 32, 109, 97, 110, 117, 97, 108, 108, 121, 32, 40, 100, 101, 98, 117, 103, 32, 86, 77, 73, 68, 58, 32, 48, 120,
+    98, 44, 32, 82, 101, 113, 117, 101, 115, 116, 68, 101, 98, 117, 103, 86, 109, 105, 100, 61, 116, 114, 117, 101, 41,
+    32, 102, 111, 114, 32, 116, 101, 115, 116, 105, 110, 103, 46, 32, 65, 108, 115, 111, 44, 32, 116, 104, 101, 32, 115,
+    97, 109, 112, 108, 101, 32, 100, 101, 108, 97, 121, 32, 114, 101, 103, 105, 115, 116, 101, 114, 32, 118, 97, 108,
+    117, 101, 115, 32, 110, 101, 101, 100, 32, 116, 111, 32, 98, 101, 32, 115, 101, 116, 32, 102, 111, 114, 32, 99, 111,
+    114, 114, 101, 99, 116, 32, 115, 116, 114, 101, 97, 109, 105, 110, 103, 32, 99, 111, 117, 110, 116, 101, 114, 32,
+    100, 97, 116, 97, 46, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 70, 105, 108, 101, 34,
+    58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 34, 34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 70,
+    105, 108, 101, 78, 97, 109, 101, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115,
+    116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115,
+    112, 109, 80, 101, 114, 102, 67, 111, 117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103, 70, 105, 108, 101, 34,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 112, 109, 80, 101, 114, 102, 67, 111, 117, 110, 116, 101, 114, 67,
+    111, 110, 102, 105, 103, 70, 105, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49,
+    54, 50, 49, 57, 50, 54, 49, 51, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32,
+    123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71,
+    114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 79, 114, 69, 113, 117, 97, 108, 34, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 105, 110, 105, 109, 117, 109, 32, 51, 50, 34, 44, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 51, 50, 125, 93, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 112, 109, 84,
+    114, 97, 99, 101, 73, 110, 116, 101, 114, 118, 97, 108, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 48, 57, 54, 125, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 115, 112, 109, 84, 114, 97, 99, 101, 73, 110, 116, 101, 114, 118, 97, 108, 34, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 97, 109, 112, 108, 101, 32, 105, 110, 116, 101, 114,
+    118, 97, 108, 32, 105, 110, 32, 115, 99, 108, 99, 107, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 51, 50, 57, 49, 57, 51, 50, 48, 48, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 97, 109, 111, 117, 110, 116, 32, 111, 102, 32, 100,
+    97, 116, 97, 32, 105, 110, 32, 98, 121, 116, 101, 115, 32, 116, 111, 32, 99, 97, 112, 116, 117, 114, 101, 32, 112,
+    101, 114, 32, 116, 114, 97, 99, 101, 46, 32, 32, 65, 32, 116, 114, 97, 99, 101, 32, 119, 105, 108, 108, 32, 99, 111,
+    118, 101, 114, 32, 97, 32, 115, 112, 97, 110, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110, 100, 115, 32, 98, 97,
+    115, 101, 100, 32, 111, 110, 32, 116, 104, 101, 32, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 71, 114,
+    97, 110, 117, 108, 97, 114, 105, 116, 121, 32, 115, 101, 116, 116, 105, 110, 103, 46, 32, 32, 68, 101, 102, 97, 117,
+    108, 116, 115, 32, 116, 111, 32, 49, 77, 66, 46, 32, 32, 67, 117, 114, 114, 101, 110, 116, 32, 72, 87, 32, 114, 101,
+    113, 117, 105, 114, 101, 115, 32, 116, 104, 101, 32, 115, 105, 122, 101, 32, 98, 101, 32, 97, 108, 105, 103, 110,
+    101, 100, 32, 116, 111, 32, 48, 120, 49, 48, 48, 48, 32, 98, 121, 116, 101, 115, 46, 34, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 48, 52, 56, 53, 55,
+    54, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 105, 122, 101, 95, 116, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 112, 109, 66, 117, 102, 102, 101, 114, 83, 105, 122,
+    101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 112, 109, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 53, 55, 54, 48, 48, 57, 50, 55, 125, 93, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105, 103, 117, 114,
+    97, 116, 105, 111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 99, 97, 112, 116, 117, 114,
+    105, 110, 103, 32, 83, 116, 114, 101, 97, 109, 105, 110, 103, 32, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99,
+    101, 32, 77, 111, 110, 105, 116, 111, 114, 115, 32, 116, 104, 114, 111, 117, 103, 104, 32, 116, 104, 101, 32, 80,
+    65, 76, 32, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 32, 108, 97, 121, 101, 114, 46, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49, 53, 51, 53, 52, 50, 49, 57, 50, 125, 44, 32, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 76, 111, 103, 103, 101, 114, 69, 110, 97,
+    98, 108, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114,
+    32, 76, 111, 103, 103, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109,
+    100, 66, 117, 102, 102, 101, 114, 76, 111, 103, 103, 101, 114, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 116, 104, 101,
+    32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 108, 111, 103, 103, 101, 114, 32, 108, 97,
+    121, 101, 114, 44, 32, 119, 104, 105, 99, 104, 32, 112, 114, 111, 118, 105, 100, 101, 115, 32, 73, 67, 109, 100, 66,
+    117, 102, 102, 101, 114, 32, 108, 101, 118, 101, 108, 32, 97, 110, 110, 111, 116, 97, 116, 105, 111, 110, 115, 32,
+    100, 105, 114, 101, 99, 116, 108, 121, 32, 105, 110, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102,
+    101, 114, 32, 100, 117, 109, 112, 115, 46, 32, 84, 104, 101, 115, 101, 32, 97, 110, 110, 111, 97, 116, 105, 111,
+    110, 115, 32, 99, 97, 110, 32, 108, 97, 116, 101, 114, 32, 98, 101, 32, 100, 101, 99, 105, 112, 104, 101, 114, 101,
+    100, 32, 117, 115, 105, 110, 103, 32, 111, 102, 102, 108, 105, 110, 101, 32, 116, 111, 111, 108, 115, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 48, 54, 57, 56, 50, 56, 51, 52, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 76, 111, 103, 103, 101, 114, 67,
+    111, 110, 102, 105, 103, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 109, 100, 66, 117, 102, 102, 101,
+    114, 32, 76, 111, 103, 103, 101, 114, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32,
+    123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91,
+    116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 76,
+    111, 103, 103, 101, 114, 69, 110, 97, 98, 108, 101, 100, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 99, 109, 100, 66, 117, 102, 102, 101, 114, 76, 111, 103, 103, 101, 114, 67, 111, 110, 102, 105, 103, 34, 44,
+    32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117,
+    101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 66, 97, 114, 114, 105, 101, 114, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67,
+    109, 100, 68, 114, 97, 119, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 125, 44, 32, 123, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 68, 105, 115, 112, 97, 116, 99, 104,
+    115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 87, 114, 105, 116, 101, 84, 105, 109, 101, 115, 116, 97, 109, 112,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 66, 105, 110, 100, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 49, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 109, 100,
+    83, 101, 116, 85, 115, 101, 114, 68, 97, 116, 97, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 50, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 83, 101, 116,
+    115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 66, 108, 116, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 49, 50, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77,
+    105, 115, 99, 101, 108, 108, 97, 110, 101, 111, 117, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 53,
+    54, 125, 93, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 76, 111,
+    103, 103, 101, 114, 65, 110, 110, 111, 116, 97, 116, 105, 111, 110, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 76, 111, 103, 103, 101, 114, 34, 93, 44, 32, 34, 70, 108,
+    97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 66,
+    105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 53, 49, 49, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 102, 101, 114, 76, 111, 103, 103, 101, 114, 65, 110, 110, 111, 116, 97,
+    116, 105, 111, 110, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66,
+    105, 116, 109, 97, 115, 107, 32, 99, 111, 110, 116, 114, 111, 108, 108, 105, 110, 103, 32, 119, 104, 105, 99, 104,
+    32, 73, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 99, 97, 108, 108, 115, 32, 116, 111, 32, 97, 110, 110, 111,
+    116, 97, 116, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 54, 50, 49, 52, 49, 50,
+    57, 49, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84,
+    105, 109, 101, 115, 116, 97, 109, 112, 68, 114, 97, 119, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101, 115,
+    116, 97, 109, 112, 68, 105, 115, 112, 97, 116, 99, 104, 101, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101,
+    115, 116, 97, 109, 112, 66, 97, 114, 114, 105, 101, 114, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101, 115,
+    116, 97, 109, 112, 66, 108, 116, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 125, 44, 32, 123, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101, 115, 116, 97, 109, 112, 80,
+    105, 112, 101, 108, 105, 110, 101, 66, 105, 110, 100, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49,
+    54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 97, 105, 116, 73,
+    100, 108, 101, 68, 114, 97, 119, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 50, 125, 44, 32, 123,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 97, 105, 116, 73, 100, 108, 101, 68,
+    105, 115, 112, 97, 116, 99, 104, 101, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 52, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 97, 105, 116, 73, 100, 108, 101,
+    66, 97, 114, 114, 105, 101, 114, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 50, 56, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 97, 105, 116, 73, 100, 108, 101,
+    66, 108, 116, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 53, 54, 125, 44, 32, 123, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 97, 105, 116, 73, 100, 108, 101, 80, 105, 112, 101,
+    108, 105, 110, 101, 66, 105, 110, 100, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 49, 50, 125, 93,
+    125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 76, 111, 103, 103,
+    101, 114, 83, 105, 110, 103, 108, 101, 83, 116, 101, 112, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67,
+    109, 100, 66, 117, 102, 102, 101, 114, 32, 76, 111, 103, 103, 101, 114, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115,
+    34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 66, 105, 116, 109,
+    97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99,
+    109, 100, 66, 117, 102, 102, 101, 114, 76, 111, 103, 103, 101, 114, 83, 105, 110, 103, 108, 101, 83, 116, 101, 112,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115,
+    107, 32, 99, 111, 110, 116, 114, 111, 108, 108, 105, 110, 103, 32, 115, 105, 110, 103, 108, 101, 32, 115, 116, 101,
+    112, 32, 98, 101, 104, 97, 118, 105, 111, 114, 32, 102, 111, 114, 32, 73, 67, 109, 100, 66, 117, 102, 102, 101, 114,
+    32, 99, 97, 108, 108, 115, 32, 102, 111, 114, 32, 68, 114, 97, 119, 47, 68, 105, 115, 112, 97, 116, 99, 104, 47, 66,
+    97, 114, 114, 105, 101, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 56, 52, 50,
+    51, 54, 54, 48, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 109, 98, 101, 100, 68, 114, 97, 119,
+    68, 105, 115, 112, 97, 116, 99, 104, 73, 110, 102, 111, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67,
+    109, 100, 66, 117, 102, 102, 101, 114, 32, 76, 111, 103, 103, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 101, 109, 98, 101, 100, 68, 114, 97, 119, 68, 105, 115, 112, 97, 116, 99, 104, 73,
+    110, 102, 111, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98,
+    108, 101, 115, 32, 116, 104, 101, 32, 101, 109, 98, 101, 100, 100, 105, 110, 103, 32, 111, 102, 32, 100, 114, 97,
+    119, 47, 100, 105, 115, 112, 97, 116, 99, 104, 32, 115, 104, 97, 100, 101, 114, 32, 73, 68, 115, 32, 119, 105, 116,
+    104, 105, 110, 32, 116, 104, 101, 32, 99, 109, 100, 45, 115, 116, 114, 101, 97, 109, 46, 32, 32, 65, 110, 110, 111,
+    116, 97, 116, 105, 111, 110, 115, 32, 97, 110, 100, 32, 115, 105, 110, 103, 108, 101, 45, 115, 116, 101, 112, 32,
+    111, 112, 116, 105, 111, 110, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 100, 105, 115, 97, 98, 108, 101, 100,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 48, 49, 51, 49, 51, 49, 55, 54, 125, 93,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105, 103, 117,
+    114, 97, 116, 105, 111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 116, 104, 101, 32, 67,
+    109, 100, 66, 117, 102, 102, 101, 114, 32, 76, 111, 103, 103, 101, 114, 32, 108, 97, 121, 101, 114, 46, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 48, 51, 54, 57, 55, 50, 53, 57, 125, 44, 32, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 73, 110, 115, 116, 114, 117, 109, 101, 110, 116, 111, 114, 69, 110,
+    97, 98, 108, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 77, 52, 32, 73, 110, 115, 116, 114,
+    117, 109, 101, 110, 116, 111, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112,
+    109, 52, 73, 110, 115, 116, 114, 117, 109, 101, 110, 116, 111, 114, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 116, 104,
+    101, 32, 80, 65, 76, 32, 80, 77, 52, 32, 105, 110, 115, 116, 114, 117, 109, 101, 110, 116, 111, 114, 32, 108, 97,
+    121, 101, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 49, 55, 55, 54, 52, 57, 53,
+    53, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 73, 110, 115, 116, 114, 117, 109, 101, 110,
+    116, 111, 114, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 77, 52, 32,
+    73, 110, 115, 116, 114, 117, 109, 101, 110, 116, 111, 114, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79,
+    110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 73, 110,
+    115, 116, 114, 117, 109, 101, 110, 116, 111, 114, 69, 110, 97, 98, 108, 101, 100, 34, 125, 93, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 112, 109, 52, 73, 110, 115, 116, 114, 117, 109, 101, 110, 116, 111, 114, 67, 111, 110,
+    102, 105, 103, 34, 44, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116, 105, 118, 101, 32, 100, 105, 114, 101, 99,
+    116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 115, 116, 97, 116, 105, 115, 116, 105, 99, 115, 32, 108, 111,
+    103, 115, 32, 97, 114, 101, 32, 112, 108, 97, 99, 101, 100, 46, 32, 82, 101, 108, 97, 116, 105, 118, 101, 32, 116,
+    111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77, 68, 95, 68, 69, 66, 85,
+    71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97, 98, 108,
+    101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105, 115, 110, 39, 116, 32,
+    115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 108, 97, 116,
+    102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34,
+    58, 32, 123, 34, 73, 115, 80, 97, 116, 104, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47,
+    34, 44, 32, 34, 87, 105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 76, 111, 103, 92, 92,
+    34, 44, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34,
+    125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56, 50, 51, 56, 50, 50, 51, 54, 51, 125, 44, 32, 123, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 117, 102, 102, 105, 120, 32, 97, 100, 100, 101,
+    100, 32, 116, 111, 32, 116, 104, 101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 40, 105, 110, 99, 108, 117,
+    100, 105, 110, 103, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 41,
+    32, 111, 102, 32, 116, 104, 101, 32, 115, 116, 97, 116, 105, 115, 116, 105, 99, 115, 32, 108, 111, 103, 115, 46, 32,
+    69, 97, 99, 104, 32, 108, 111, 103, 103, 101, 100, 32, 81, 117, 101, 117, 101, 32, 119, 105, 108, 108, 32, 104, 97,
+    118, 101, 32, 97, 32, 117, 110, 105, 113, 117, 101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 112, 114, 101,
+    102, 105, 120, 32, 119, 104, 105, 99, 104, 32, 119, 105, 108, 108, 32, 112, 114, 101, 99, 101, 100, 101, 32, 116,
+    104, 105, 115, 32, 115, 116, 114, 105, 110, 103, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 112, 109, 52, 45, 115, 116, 97, 116, 115, 46, 108,
+    111, 103, 34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76,
+    101, 110, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 105, 108, 101, 110, 97, 109, 101, 83, 117, 102,
+    102, 105, 120, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 105, 108, 101, 110, 97, 109, 101, 83, 117, 102,
+    102, 105, 120, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 52, 56, 55, 53, 52, 50, 51,
+    52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116,
+    114, 111, 108, 115, 32, 119, 104, 101, 110, 32, 115, 116, 97, 116, 105, 115, 116, 105, 99, 115, 32, 97, 114, 101,
+    32, 119, 114, 105, 116, 116, 101, 110, 32, 111, 117, 116, 32, 116, 111, 32, 116, 104, 101, 32, 108, 111, 103, 32,
+    102, 105, 108, 101, 40, 115, 41, 46, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44,
+    32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    80, 109, 52, 73, 110, 115, 116, 114, 117, 109, 101, 110, 116, 111, 114, 68, 117, 109, 112, 77, 111, 100, 101, 34,
+    44, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 117, 109, 112, 32, 97,
+    116, 32, 81, 117, 101, 117, 101, 32, 68, 101, 115, 116, 114, 117, 99, 116, 105, 111, 110, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 73, 110, 115, 116, 114,
+    117, 109, 101, 110, 116, 111, 114, 68, 117, 109, 112, 81, 117, 101, 117, 101, 68, 101, 115, 116, 114, 111, 121, 34,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 117, 109, 112, 32,
+    97, 116, 32, 81, 117, 101, 117, 101, 32, 83, 117, 98, 109, 105, 115, 115, 105, 111, 110, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 73, 110, 115, 116, 114,
+    117, 109, 101, 110, 116, 111, 114, 68, 117, 109, 112, 81, 117, 101, 117, 101, 83, 117, 98, 109, 105, 116, 34, 125,
+    93, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 117, 109, 112, 77, 111, 100, 101, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 117, 109, 112, 77, 111, 100, 101, 34, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 109,
+    52, 73, 110, 115, 116, 114, 117, 109, 101, 110, 116, 111, 114, 68, 117, 109, 112, 81, 117, 101, 117, 101, 68, 101,
+    115, 116, 114, 111, 121, 34, 125, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 55, 51, 53,
+    48, 48, 51, 55, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67,
+    111, 110, 116, 114, 111, 108, 115, 32, 104, 111, 119, 32, 111, 102, 116, 101, 110, 32, 115, 116, 97, 116, 105, 115,
+    116, 105, 99, 115, 32, 97, 114, 101, 32, 119, 114, 105, 116, 116, 101, 110, 32, 111, 117, 116, 32, 116, 111, 32,
+    116, 104, 101, 32, 108, 111, 103, 32, 102, 105, 108, 101, 40, 115, 41, 46, 32, 32, 65, 32, 118, 97, 108, 117, 101,
+    32, 111, 102, 32, 122, 101, 114, 111, 32, 109, 101, 97, 110, 115, 32, 114, 101, 45, 100, 117, 109, 112, 32, 101,
+    118, 101, 114, 121, 32, 115, 117, 98, 109, 105, 116, 46, 32, 32, 85, 110, 105, 116, 115, 32, 97, 114, 101, 32, 105,
+    110, 32, 115, 101, 99, 111, 110, 100, 115, 46, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110,
+    116, 51, 50, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 117, 109, 112, 73, 110, 116, 101, 114, 118, 97,
+    108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 117, 109, 112, 73,
+    110, 116, 101, 114, 118, 97, 108, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 53, 125, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49,
+    52, 55, 49, 48, 54, 53, 55, 52, 53, 125, 93, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 80, 77, 52, 32, 73, 110, 115, 116, 114, 117, 109, 101, 110, 116, 111, 114, 32, 99, 111, 110, 102, 105,
+    103, 117, 114, 97, 116, 105, 111, 110, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 54, 48,
+    55, 50, 57, 48, 51, 50, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 110, 116, 101, 114, 102, 97, 99,
+    101, 76, 111, 103, 103, 101, 114, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 32, 76, 111, 103, 103, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 110, 116, 101, 114, 102, 97, 99, 101, 76, 111, 103, 103, 101, 114, 69,
+    110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69,
+    110, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 80, 65, 76, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32,
+    108, 111, 103, 103, 105, 110, 103, 32, 108, 97, 121, 101, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 54, 55, 56, 48, 53, 52, 49, 49, 55, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73,
+    110, 116, 101, 114, 102, 97, 99, 101, 76, 111, 103, 103, 101, 114, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 32, 76, 111, 103, 103, 101, 114, 34, 93,
+    44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115,
+    34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 76, 111, 103, 103, 101, 114, 69, 110, 97, 98,
+    108, 101, 100, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 110, 116, 101, 114, 102, 97, 99,
+    101, 76, 111, 103, 103, 101, 114, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114,
+    101, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97,
+    116, 105, 118, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 116, 104, 101,
+    32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32, 108, 111, 103, 103, 101, 114, 32, 119, 114, 105, 116, 101, 115,
+    32, 105, 116, 115, 32, 108, 111, 103, 115, 46, 32, 82, 101, 108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 116, 104,
+    101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77, 68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82,
+    32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97, 98, 108, 101, 46, 32, 73, 102,
+    32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105, 115, 110, 39, 116, 32, 115, 101, 116, 44, 32,
+    116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 108, 97, 116, 102, 111, 114, 109,
+    32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73,
+    115, 80, 97, 116, 104, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 32, 34,
+    87, 105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 76, 111, 103, 92, 92, 34, 44, 32, 34,
+    76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 125, 44, 32, 34,
+    83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 51, 57, 57, 55, 48, 52, 49, 51, 55, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 97, 99, 104, 32, 116, 104, 114, 101, 97, 100, 32, 119, 105, 108, 108,
+    32, 119, 114, 105, 116, 101, 32, 105, 110, 116, 111, 32, 105, 116, 115, 32, 111, 119, 110, 32, 108, 111, 103, 32,
+    102, 105, 108, 101, 44, 32, 97, 118, 111, 105, 100, 105, 110, 103, 32, 116, 97, 107, 105, 110, 103, 32, 97, 32, 103,
+    108, 111, 98, 97, 108, 32, 108, 111, 99, 107, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 109, 117, 108, 116, 105, 116, 104, 114, 101, 97, 100, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 77, 117, 108, 116, 105, 116, 104, 114, 101, 97, 100, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 52, 49, 55, 55, 53, 51, 50, 52, 55, 54, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 71, 101, 110, 101, 114, 97, 108, 67, 97,
+    108, 108, 115, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 97, 114, 101, 32,
+    104, 97, 114, 100, 32, 116, 111, 32, 99, 108, 97, 115, 115, 105, 102, 121, 32, 111, 114, 32, 114, 97, 114, 101, 108,
+    121, 32, 99, 97, 108, 108, 101, 100, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 125, 44, 32, 123,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 67, 114,
+    101, 97, 116, 101, 68, 101, 115, 116, 114, 111, 121, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119,
+    104, 105, 99, 104, 32, 99, 114, 101, 97, 116, 101, 32, 97, 110, 100, 32, 100, 101, 115, 116, 114, 111, 121, 32, 80,
+    65, 76, 32, 111, 98, 106, 101, 99, 116, 115, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 66,
+    105, 110, 100, 71, 112, 117, 77, 101, 109, 111, 114, 121, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32,
+    114, 101, 108, 101, 118, 97, 110, 116, 32, 116, 111, 32, 71, 80, 85, 32, 109, 101, 109, 111, 114, 121, 32, 98, 105,
+    110, 100, 105, 110, 103, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 125, 44, 32, 123, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 81, 117, 101, 117, 101,
+    79, 112, 115, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 114, 101, 108, 101, 118, 97, 110, 116, 32, 116,
+    111, 32, 73, 81, 117, 101, 117, 101, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 115, 46, 34, 44, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 67, 109, 100, 66, 117, 105, 108, 100, 105, 110, 103, 58, 32, 70, 117,
+    110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 98, 117, 105, 108, 100, 32, 73, 67, 109, 100, 66,
+    117, 102, 102, 101, 114, 32, 99, 111, 109, 109, 97, 110, 100, 115, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 49, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111,
+    103, 70, 108, 97, 103, 67, 114, 101, 97, 116, 101, 83, 114, 100, 115, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110,
+    115, 32, 119, 104, 105, 99, 104, 32, 99, 114, 101, 97, 116, 101, 32, 83, 82, 68, 115, 46, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 51, 50, 125, 93, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 97, 115, 101, 80,
+    114, 101, 115, 101, 116, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58,
+    32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 125,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    55, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 97, 115, 101, 80, 114, 101, 115, 101, 116, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 111,
+    102, 32, 119, 104, 105, 99, 104, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32, 102, 117, 110, 99, 116, 105,
+    111, 110, 32, 99, 97, 108, 108, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 108, 111, 103, 103, 101, 100, 32, 98,
+    121, 32, 100, 101, 102, 97, 117, 108, 116, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51,
+    56, 56, 54, 54, 56, 52, 53, 51, 48, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58,
+    32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 71, 101, 110, 101, 114, 97, 108, 67, 97, 108, 108, 115, 58, 32,
+    70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 97, 114, 101, 32, 104, 97, 114, 100, 32,
+    116, 111, 32, 99, 108, 97, 115, 115, 105, 102, 121, 32, 111, 114, 32, 114, 97, 114, 101, 108, 121, 32, 99, 97, 108,
+    108, 101, 100, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 67, 114, 101, 97, 116, 101, 68,
+    101, 115, 116, 114, 111, 121, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 99,
+    114, 101, 97, 116, 101, 32, 97, 110, 100, 32, 100, 101, 115, 116, 114, 111, 121, 32, 80, 65, 76, 32, 111, 98, 106,
+    101, 99, 116, 115, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 125, 44, 32, 123, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 66, 105, 110, 100, 71, 112,
+    117, 77, 101, 109, 111, 114, 121, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 114, 101, 108, 101, 118,
+    97, 110, 116, 32, 116, 111, 32, 71, 80, 85, 32, 109, 101, 109, 111, 114, 121, 32, 98, 105, 110, 100, 105, 110, 103,
+    46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 81, 117, 101, 117, 101, 79, 112, 115, 58, 32,
+    70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 114, 101, 108, 101, 118, 97, 110, 116, 32, 116, 111, 32, 73, 81, 117,
+    101, 117, 101, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 115, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103,
+    70, 108, 97, 103, 67, 109, 100, 66, 117, 105, 108, 100, 105, 110, 103, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110,
+    115, 32, 119, 104, 105, 99, 104, 32, 98, 117, 105, 108, 100, 32, 73, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32,
+    99, 111, 109, 109, 97, 110, 100, 115, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 54, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 67,
+    114, 101, 97, 116, 101, 83, 114, 100, 115, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99,
+    104, 32, 99, 114, 101, 97, 116, 101, 32, 83, 82, 68, 115, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51,
+    50, 125, 93, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 108, 101, 118, 97, 116, 101, 100, 80, 114, 101,
+    115, 101, 116, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116,
+    114, 117, 101, 44, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 51, 49,
+    125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 108, 101, 118, 97, 116, 101, 100, 80, 114, 101, 115, 101,
+    116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97,
+    115, 107, 32, 111, 102, 32, 119, 104, 105, 99, 104, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32, 102, 117,
+    110, 99, 116, 105, 111, 110, 32, 99, 97, 108, 108, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 108, 111, 103, 103,
+    101, 100, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 117, 115, 101, 114, 32, 104, 111, 108, 100, 115, 32, 83,
+    104, 105, 102, 116, 45, 70, 49, 49, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 57, 49,
+    52, 50, 51, 49, 52, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    65, 108, 115, 111, 32, 119, 114, 105, 116, 101, 115, 32, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98,
+    117, 102, 102, 101, 114, 32, 114, 101, 99, 111, 114, 100, 105, 110, 103, 32, 99, 97, 108, 108, 32, 115, 116, 114,
+    101, 97, 109, 32, 116, 111, 32, 112, 97, 108, 95, 99, 97, 112, 116, 117, 114, 101, 46, 98, 105, 110, 32, 105, 110,
+    32, 97, 32, 99, 111, 109, 112, 97, 99, 116, 32, 98, 105, 110, 97, 114, 121, 32, 102, 111, 114, 109, 97, 116, 32,
+    119, 104, 105, 99, 104, 32, 71, 112, 117, 85, 116, 105, 108, 58, 58, 67, 109, 100, 66, 117, 102, 102, 101, 114, 82,
+    101, 112, 108, 97, 121, 101, 114, 32, 99, 97, 110, 32, 114, 101, 112, 108, 97, 121, 32, 111, 110, 32, 97, 110, 121,
+    32, 100, 101, 118, 105, 99, 101, 44, 32, 105, 110, 99, 108, 117, 100, 105, 110, 103, 32, 116, 104, 101, 32, 110,
+    117, 108, 108, 32, 100, 101, 118, 105, 99, 101, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 98, 105, 110, 97, 114, 121, 67, 97, 112, 116, 117, 114, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 66, 105, 110, 97, 114, 121, 67, 97, 112, 116, 117, 114, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 52, 49, 48, 50, 56, 52, 54, 55, 51, 51, 125, 93, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 32, 111, 112, 116,
+    105, 111, 110, 115, 32, 102, 111, 114, 32, 116, 104, 101, 32, 80, 65, 76, 32, 73, 110, 116, 101, 114, 102, 97, 99,
+    101, 32, 76, 111, 103, 103, 101, 114, 32, 108, 97, 121, 101, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 57, 57, 54, 49, 52, 53, 56, 50, 54, 125, 93, 44, 32, 34, 68, 101, 102, 105, 110, 101, 100, 67,
+    111, 110, 115, 116, 97, 110, 116, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 80,
+    97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 49, 50, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115, 116,
+    114, 105, 110, 103, 32, 108, 101, 110, 103, 116, 104, 32, 102, 111, 114, 32, 97, 32, 100, 105, 114, 101, 99, 116,
+    111, 114, 121, 47, 112, 97, 116, 104, 32, 115, 101, 116, 116, 105, 110, 103, 34, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 77, 97, 120, 70, 105, 108, 101, 78, 97, 109, 101, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 50, 53, 54, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115, 116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116, 104, 32,
+    102, 111, 114, 32, 97, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 115, 101, 116, 116, 105, 110, 103, 34, 125,
+    44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 77, 105, 115, 99, 83, 116, 114, 76, 101, 110, 34,
+    44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115, 116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116,
+    104, 32, 102, 111, 114, 32, 97, 32, 109, 105, 115, 99, 101, 108, 108, 97, 110, 101, 111, 117, 115, 32, 115, 116,
+    114, 105, 110, 103, 32, 115, 101, 116, 116, 105, 110, 103, 34, 125, 93, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 68, 101, 98, 117, 103, 32, 80, 114, 105, 110, 116, 34, 44, 32, 34, 68, 101, 98, 117, 103, 32, 79, 118, 101,
+    114, 108, 97, 121, 34, 44, 32, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 34, 44, 32, 34, 67, 109,
+    100, 66, 117, 102, 102, 101, 114, 32, 76, 111, 103, 103, 101, 114, 34, 44, 32, 34, 73, 110, 116, 101, 114, 102, 97,
+    99, 101, 32, 76, 111, 103, 103, 101, 114, 34, 44, 32, 34, 83, 104, 97, 100, 101, 114, 32, 68, 101, 98, 117, 103, 34,
+    93, 125
 };  // g_palPlatformJsonData[]
 
 } // Pal
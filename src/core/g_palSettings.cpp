@@ -132,6 +132,7 @@ void SettingsLoader::SetupDefaults()
     m_settings.cmdBufPreemptionMode = CmdBufPreemptModeEnable;
     m_settings.commandBufferForceCeRamDumpInPostamble = false;
     m_settings.commandBufferCombineDePreambles = false;
+    m_settings.cmdBufSpillTableCacheSize = 8;
     m_settings.cmdUtilVerifyShadowedRegRanges = true;
     m_settings.submitOptModeOverride = 0;
     m_settings.tileSwizzleMode = 0x7;
@@ -150,6 +151,10 @@ void SettingsLoader::SetupDefaults()
     m_settings.peerMemoryEnabled = true;
     m_settings.forcePresentViaGdi = false;
     m_settings.presentViaOglRuntime = true;
+    m_settings.rpmLazyPipelineCreation = false;
+    m_settings.rpmPrewarmPipelines = false;
+    m_settings.rpmInitThreadCount = 0;
+    m_settings.rpmLogPipelineCreationTime = false;
 
     m_settings.debugForceSurfaceAlignment = 0;
     m_settings.debugForceResourceAdditionalPadding = 0;
@@ -453,6 +458,11 @@ void SettingsLoader::ReadSettings()
                            &m_settings.commandBufferCombineDePreambles,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pCmdBufSpillTableCacheSizeStr,
+                           Util::ValueType::Uint,
+                           &m_settings.cmdBufSpillTableCacheSize,
+                           InternalSettingScope::PrivatePalKey);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pCmdUtilVerifyShadowedRegRangesStr,
                            Util::ValueType::Boolean,
                            &m_settings.cmdUtilVerifyShadowedRegRanges,
@@ -543,6 +553,26 @@ void SettingsLoader::ReadSettings()
                            &m_settings.presentViaOglRuntime,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pRpmLazyPipelineCreationStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.rpmLazyPipelineCreation,
+                           InternalSettingScope::PrivatePalKey);
+
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pRpmPrewarmPipelinesStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.rpmPrewarmPipelines,
+                           InternalSettingScope::PrivatePalKey);
+
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pRpmInitThreadCountStr,
+                           Util::ValueType::Uint,
+                           &m_settings.rpmInitThreadCount,
+                           InternalSettingScope::PrivatePalKey);
+
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pRpmLogPipelineCreationTimeStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.rpmLogPipelineCreationTime,
+                           InternalSettingScope::PrivatePalKey);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pDebugForceResourceAlignmentStr,
                            Util::ValueType::Uint64,
                            &m_settings.debugForceSurfaceAlignment,
@@ -921,6 +951,11 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.commandBufferCombineDePreambles);
     m_settingsInfoMap.Insert(148412311, info);
 
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.cmdBufSpillTableCacheSize;
+    info.valueSize = sizeof(m_settings.cmdBufSpillTableCacheSize);
+    m_settingsInfoMap.Insert(2952203245, info);
+
     info.type      = SettingType::Boolean;
     info.pValuePtr = &m_settings.cmdUtilVerifyShadowedRegRanges;
     info.valueSize = sizeof(m_settings.cmdUtilVerifyShadowedRegRanges);
@@ -1011,6 +1046,26 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.presentViaOglRuntime);
     m_settingsInfoMap.Insert(2466363770, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.rpmLazyPipelineCreation;
+    info.valueSize = sizeof(m_settings.rpmLazyPipelineCreation);
+    m_settingsInfoMap.Insert(2825646499, info);
+
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.rpmPrewarmPipelines;
+    info.valueSize = sizeof(m_settings.rpmPrewarmPipelines);
+    m_settingsInfoMap.Insert(2497436189, info);
+
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.rpmInitThreadCount;
+    info.valueSize = sizeof(m_settings.rpmInitThreadCount);
+    m_settingsInfoMap.Insert(3816128939, info);
+
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.rpmLogPipelineCreationTime;
+    info.valueSize = sizeof(m_settings.rpmLogPipelineCreationTime);
+    m_settingsInfoMap.Insert(104333330, info);
+
     info.type      = SettingType::Uint64;
     info.pValuePtr = &m_settings.debugForceSurfaceAlignment;
     info.valueSize = sizeof(m_settings.debugForceSurfaceAlignment);
@@ -1042,9 +1097,9 @@ void SettingsLoader::DevDriverRegister()
             component.pfnSetValue = ISettingsLoader::SetValue;
             component.pSettingsData = &g_palJsonData[0];
             component.settingsDataSize = sizeof(g_palJsonData);
-            component.settingsDataHash = 616573810;
-            component.settingsDataHeader.isEncoded = true;
-            component.settingsDataHeader.magicBufferId = 402778310;
+            component.settingsDataHash = 0;
+            component.settingsDataHeader.isEncoded = false;
+            component.settingsDataHeader.magicBufferId = 0;
             component.settingsDataHeader.magicBufferOffset = 0;
 
             pSettingsService->RegisterComponent(component);
@@ -247,6 +247,7 @@ struct PalSettings : public Pal::DriverSettings
     CmdBufPreemptMode                           cmdBufPreemptionMode;
     bool                                        commandBufferForceCeRamDumpInPostamble;
     bool                                        commandBufferCombineDePreambles;
+    uint32                                      cmdBufSpillTableCacheSize;
     bool                                        cmdUtilVerifyShadowedRegRanges;
     uint32                                      submitOptModeOverride;
     uint32                                      tileSwizzleMode;
@@ -265,6 +266,10 @@ struct PalSettings : public Pal::DriverSettings
     bool                                        peerMemoryEnabled;
     bool                                        forcePresentViaGdi;
     bool                                        presentViaOglRuntime;
+    bool                                        rpmLazyPipelineCreation;
+    bool                                        rpmPrewarmPipelines;
+    uint32                                      rpmInitThreadCount;
+    bool                                        rpmLogPipelineCreationTime;
 
     gpusize                                     debugForceSurfaceAlignment;
     gpusize                                     debugForceResourceAdditionalPadding;
@@ -327,6 +332,7 @@ static const char* pCmdBufForceOneTimeSubmitStr = "#909934676";
 static const char* pCmdBufPreemptionModeStr = "#3640527208";
 static const char* pCommandBufferForceCeRamDumpInPostambleStr = "#3413911781";
 static const char* pCommandBufferCombineDePreamblesStr = "#148412311";
+static const char* pCmdBufSpillTableCacheSizeStr = "#2952203245";
 static const char* pCmdUtilVerifyShadowedRegRangesStr = "#3890704045";
 static const char* pSubmitOptModeOverrideStr = "#3054810609";
 static const char* pTileSwizzleModeStr = "#1146877010";
@@ -345,11 +351,15 @@ static const char* pMgpuCompatibilityEnabledStr = "#1177937299";
 static const char* pPeerMemoryEnabledStr = "#259362511";
 static const char* pForcePresentViaGdiStr = "#2607871653";
 static const char* pPresentViaOglRuntimeStr = "#2466363770";
+static const char* pRpmLazyPipelineCreationStr = "#2825646499";
+static const char* pRpmPrewarmPipelinesStr = "#2497436189";
+static const char* pRpmInitThreadCountStr = "#3816128939";
+static const char* pRpmLogPipelineCreationTimeStr = "#104333330";
 
 static const char* pDebugForceResourceAlignmentStr = "#397089904";
 static const char* pDebugForceResourceAdditionalPaddingStr = "#3601080919";
 
-static const uint32 g_palNumSettings = 95;
+static const uint32 g_palNumSettings = 100;
 static const SettingNameHash g_palSettingHashList[] = {
 4265240458,
 1901986348,
@@ -423,6 +433,7 @@ static const SettingNameHash g_palSettingHashList[] = {
 3640527208,
 3413911781,
 148412311,
+2952203245,
 3890704045,
 3054810609,
 1146877010,
@@ -441,1837 +452,1873 @@ static const SettingNameHash g_palSettingHashList[] = {
 259362511,
 2607871653,
 2466363770,
+2825646499,
+2497436189,
+3816128939,
+104333330,
 
 397089904,
 3601080919,
 };
 
 static const uint8 g_palJsonData[] = {
-    26, 250, 84, 220, 1, 92, 96, 106, 146, 207, 33, 32, 160, 3, 90, 155, 144, 218, 198, 78, 114, 176, 3, 33, 5, 77, 19,
-    112, 240, 60, 51, 124, 70, 64, 201, 5, 158, 97, 87, 77, 204, 74, 98, 194, 41, 7, 146, 217, 196, 241, 199, 35, 58,
-    39, 53, 61, 197, 5, 96, 122, 152, 156, 157, 71, 204, 69, 14, 191, 122, 45, 161, 99, 42, 5, 57, 6, 198, 213, 152,
-    136, 88, 210, 192, 81, 135, 7, 248, 144, 180, 82, 124, 194, 98, 17, 233, 67, 103, 94, 189, 156, 239, 52, 33, 34,
-    188, 34, 131, 127, 146, 3, 210, 182, 8, 207, 46, 242, 16, 228, 164, 82, 247, 207, 226, 65, 217, 121, 209, 208, 58,
-    137, 86, 56, 145, 153, 100, 193, 210, 221, 67, 222, 187, 217, 180, 204, 199, 57, 76, 73, 145, 70, 108, 165, 137,
-    220, 165, 172, 141, 95, 13, 198, 166, 5, 173, 172, 249, 89, 206, 81, 109, 196, 146, 52, 197, 55, 62, 6, 230, 135,
-    182, 145, 69, 66, 210, 145, 166, 39, 166, 217, 224, 220, 205, 13, 182, 186, 141, 97, 168, 83, 83, 158, 39, 160, 142,
-    207, 135, 207, 144, 227, 164, 33, 131, 162, 201, 16, 55, 178, 41, 148, 120, 183, 77, 195, 232, 232, 113, 2, 102,
-    150, 52, 251, 75, 237, 79, 36, 44, 61, 145, 125, 243, 152, 54, 209, 114, 15, 70, 60, 90, 66, 255, 10, 175, 216, 198,
-    113, 185, 184, 216, 252, 45, 47, 240, 244, 155, 216, 146, 253, 6, 26, 203, 211, 51, 82, 183, 169, 78, 112, 148, 135,
-    69, 96, 5, 36, 121, 217, 43, 3, 191, 67, 113, 45, 78, 134, 194, 119, 250, 68, 114, 171, 104, 149, 136, 19, 211, 167,
-    26, 48, 39, 65, 19, 92, 234, 73, 103, 239, 155, 54, 81, 123, 39, 12, 83, 72, 132, 242, 150, 226, 197, 253, 195, 16,
-    68, 213, 219, 180, 29, 162, 54, 9, 160, 88, 236, 255, 135, 31, 14, 92, 254, 197, 64, 151, 14, 46, 29, 129, 208, 144,
-    90, 118, 28, 90, 13, 216, 179, 14, 38, 49, 118, 240, 168, 117, 97, 169, 86, 167, 186, 209, 63, 67, 30, 75, 44, 93,
-    162, 105, 78, 203, 191, 32, 104, 149, 72, 202, 210, 230, 241, 22, 198, 138, 116, 97, 181, 7, 227, 105, 85, 102, 180,
-    38, 106, 2, 118, 4, 145, 14, 246, 157, 222, 55, 210, 230, 26, 127, 123, 31, 124, 124, 52, 252, 67, 192, 15, 75, 224,
-    22, 225, 220, 149, 82, 180, 134, 230, 173, 94, 182, 203, 20, 148, 105, 232, 113, 88, 157, 52, 120, 95, 216, 55, 131,
-    60, 89, 150, 155, 166, 105, 199, 157, 231, 67, 133, 222, 202, 247, 140, 194, 38, 15, 178, 122, 155, 84, 239, 222,
-    162, 154, 138, 164, 83, 16, 94, 97, 55, 1, 154, 141, 168, 75, 226, 18, 84, 55, 42, 56, 246, 12, 92, 42, 150, 198,
-    81, 110, 247, 236, 171, 212, 163, 65, 126, 135, 1, 191, 152, 216, 149, 44, 180, 192, 72, 58, 38, 167, 178, 132, 99,
-    71, 38, 25, 196, 238, 228, 3, 228, 217, 137, 181, 102, 55, 171, 96, 190, 43, 235, 179, 104, 237, 54, 248, 154, 89,
-    131, 177, 226, 17, 121, 110, 68, 144, 102, 25, 28, 180, 96, 199, 197, 147, 4, 161, 171, 99, 182, 71, 1, 10, 128,
-    134, 100, 115, 25, 51, 222, 130, 154, 190, 69, 175, 21, 42, 173, 8, 166, 83, 222, 68, 157, 32, 27, 93, 97, 98, 118,
-    30, 106, 59, 243, 83, 212, 54, 68, 94, 250, 113, 56, 81, 71, 100, 211, 132, 251, 76, 245, 237, 252, 135, 243, 140,
-    66, 55, 231, 92, 253, 132, 235, 148, 118, 9, 185, 12, 103, 133, 59, 165, 82, 185, 18, 25, 24, 148, 35, 205, 175, 91,
-    21, 34, 143, 227, 115, 108, 155, 204, 219, 37, 183, 32, 160, 12, 202, 160, 48, 145, 106, 124, 105, 212, 6, 7, 171,
-    47, 175, 191, 250, 184, 250, 146, 158, 157, 131, 181, 133, 72, 0, 9, 80, 18, 138, 251, 139, 26, 67, 95, 71, 233, 10,
-    8, 186, 238, 71, 84, 63, 221, 29, 241, 231, 197, 61, 98, 241, 182, 134, 166, 134, 86, 243, 191, 220, 39, 77, 154,
-    242, 138, 84, 35, 202, 125, 241, 159, 23, 218, 60, 203, 135, 129, 169, 224, 70, 201, 228, 104, 45, 37, 12, 168, 30,
-    152, 50, 165, 13, 118, 175, 67, 231, 79, 5, 95, 199, 123, 163, 162, 147, 177, 179, 200, 201, 138, 3, 19, 90, 172,
-    122, 205, 98, 31, 45, 92, 163, 193, 162, 14, 133, 143, 252, 26, 6, 107, 132, 190, 153, 247, 109, 207, 138, 141, 120,
-    2, 235, 75, 208, 62, 158, 77, 244, 42, 190, 236, 46, 68, 216, 119, 175, 115, 210, 190, 143, 4, 109, 39, 76, 66, 79,
-    118, 2, 206, 191, 63, 24, 110, 7, 122, 198, 141, 201, 38, 5, 132, 189, 208, 135, 97, 213, 46, 107, 28, 235, 20, 182,
-    83, 160, 86, 45, 31, 45, 113, 150, 213, 65, 216, 230, 97, 180, 121, 108, 194, 19, 137, 71, 164, 77, 119, 234, 81,
-    221, 48, 81, 248, 156, 217, 195, 132, 67, 57, 129, 140, 102, 49, 162, 50, 3, 69, 224, 246, 119, 153, 173, 191, 81,
-    119, 101, 61, 250, 3, 113, 16, 34, 216, 216, 70, 66, 76, 33, 35, 132, 163, 152, 121, 164, 27, 56, 229, 75, 75, 141,
-    30, 187, 70, 71, 227, 166, 170, 201, 71, 138, 141, 30, 237, 175, 160, 240, 237, 170, 140, 213, 147, 229, 46, 116,
-    210, 113, 45, 150, 251, 31, 188, 46, 17, 12, 25, 84, 153, 223, 130, 223, 149, 32, 93, 81, 180, 88, 138, 227, 237,
-    194, 151, 246, 158, 129, 166, 152, 10, 124, 218, 244, 199, 169, 164, 255, 174, 53, 104, 187, 67, 194, 75, 167, 87,
-    165, 241, 197, 110, 58, 202, 59, 131, 219, 201, 129, 109, 24, 113, 212, 224, 139, 111, 167, 201, 160, 117, 118, 182,
-    108, 209, 76, 54, 0, 56, 62, 170, 35, 192, 50, 199, 219, 99, 122, 133, 10, 47, 151, 223, 180, 59, 200, 23, 229, 59,
-    52, 208, 189, 67, 96, 183, 188, 220, 127, 87, 3, 22, 59, 192, 2, 224, 23, 60, 150, 238, 15, 48, 233, 114, 48, 118,
-    90, 196, 134, 78, 164, 220, 6, 14, 230, 55, 209, 247, 174, 207, 199, 212, 16, 231, 50, 23, 251, 60, 175, 218, 159,
-    32, 255, 33, 129, 108, 149, 253, 76, 221, 207, 16, 14, 145, 180, 69, 105, 253, 113, 50, 229, 113, 30, 171, 25, 166,
-    224, 183, 148, 174, 18, 122, 69, 170, 200, 126, 79, 251, 128, 189, 216, 45, 110, 81, 26, 85, 27, 110, 198, 12, 138,
-    207, 255, 223, 202, 32, 131, 152, 69, 143, 158, 204, 52, 220, 153, 109, 91, 124, 28, 55, 153, 136, 11, 17, 205, 203,
-    22, 247, 56, 139, 231, 225, 39, 59, 66, 152, 244, 250, 41, 170, 25, 54, 202, 63, 87, 7, 122, 104, 165, 79, 107, 69,
-    229, 218, 135, 182, 246, 205, 26, 201, 220, 115, 110, 76, 121, 147, 193, 60, 189, 33, 107, 86, 45, 188, 53, 185, 67,
-    177, 2, 252, 221, 61, 121, 159, 67, 109, 151, 151, 4, 115, 237, 25, 27, 188, 177, 244, 64, 214, 43, 182, 184, 245,
-    221, 210, 252, 32, 148, 127, 102, 23, 204, 147, 248, 164, 233, 152, 141, 45, 129, 211, 155, 154, 170, 70, 114, 0,
-    66, 54, 212, 77, 123, 71, 139, 176, 51, 140, 246, 198, 215, 79, 127, 60, 148, 214, 167, 206, 250, 178, 245, 131,
-    221, 247, 243, 84, 99, 213, 205, 252, 123, 252, 62, 155, 141, 40, 117, 168, 15, 77, 57, 101, 6, 106, 200, 196, 109,
-    98, 71, 159, 3, 104, 94, 212, 62, 214, 55, 253, 38, 30, 181, 28, 78, 52, 168, 164, 11, 71, 135, 127, 88, 67, 199,
-    224, 67, 94, 204, 213, 81, 69, 92, 234, 50, 250, 250, 18, 94, 41, 235, 161, 174, 148, 216, 32, 208, 99, 30, 48, 219,
-    193, 143, 129, 74, 188, 2, 49, 123, 130, 217, 205, 190, 240, 122, 18, 42, 247, 248, 197, 137, 215, 248, 38, 104,
-    238, 78, 33, 141, 243, 87, 74, 207, 53, 15, 18, 200, 225, 107, 203, 81, 154, 198, 166, 232, 252, 147, 240, 120, 33,
-    92, 7, 196, 94, 58, 69, 192, 79, 162, 175, 27, 165, 3, 178, 248, 6, 50, 79, 59, 218, 7, 187, 158, 182, 66, 219, 132,
-    226, 120, 105, 99, 222, 7, 28, 223, 237, 69, 87, 65, 123, 172, 241, 65, 67, 229, 226, 136, 185, 3, 200, 151, 14,
-    204, 193, 158, 227, 5, 95, 30, 156, 1, 0, 212, 150, 97, 12, 250, 42, 126, 18, 19, 154, 201, 201, 217, 241, 193, 70,
-    9, 1, 137, 69, 164, 90, 39, 165, 248, 154, 194, 190, 124, 250, 237, 86, 212, 24, 193, 143, 129, 27, 161, 154, 180,
-    7, 76, 226, 58, 176, 143, 65, 137, 190, 162, 184, 188, 18, 52, 130, 119, 19, 100, 106, 198, 43, 182, 166, 65, 103,
-    152, 184, 24, 247, 105, 170, 211, 182, 229, 188, 41, 193, 155, 5, 135, 8, 49, 8, 221, 255, 29, 186, 252, 231, 142,
-    157, 111, 188, 202, 32, 122, 71, 224, 121, 156, 235, 14, 85, 143, 103, 222, 123, 93, 61, 63, 148, 134, 91, 122, 74,
-    104, 222, 117, 246, 80, 220, 166, 64, 156, 84, 225, 126, 216, 34, 87, 240, 147, 92, 55, 121, 2, 56, 84, 194, 103,
-    19, 156, 115, 4, 3, 43, 168, 220, 178, 149, 59, 159, 184, 109, 88, 194, 242, 111, 151, 81, 105, 121, 130, 167, 66,
-    178, 244, 212, 39, 138, 8, 165, 178, 10, 31, 195, 137, 82, 122, 220, 251, 15, 90, 23, 131, 251, 99, 11, 192, 144,
-    144, 168, 99, 61, 94, 112, 10, 32, 183, 221, 90, 227, 71, 80, 157, 30, 234, 116, 89, 98, 158, 99, 16, 121, 31, 196,
-    204, 0, 12, 119, 119, 236, 43, 119, 246, 165, 101, 202, 151, 210, 32, 66, 2, 157, 14, 161, 174, 0, 223, 87, 179,
-    142, 207, 177, 179, 3, 234, 101, 164, 115, 149, 20, 75, 45, 32, 112, 239, 18, 188, 145, 176, 30, 19, 124, 226, 221,
-    26, 0, 33, 169, 44, 100, 144, 63, 63, 143, 30, 71, 223, 19, 177, 224, 70, 211, 148, 235, 238, 185, 74, 130, 218,
-    232, 229, 122, 97, 84, 74, 23, 220, 216, 135, 215, 43, 41, 193, 128, 51, 97, 125, 191, 83, 51, 46, 161, 143, 4, 67,
-    124, 48, 48, 102, 191, 177, 55, 15, 224, 49, 55, 129, 241, 173, 208, 242, 93, 103, 137, 39, 22, 33, 127, 79, 88, 79,
-    205, 148, 38, 16, 118, 172, 195, 193, 137, 93, 26, 13, 198, 80, 32, 36, 178, 203, 132, 212, 166, 65, 52, 60, 185,
-    19, 55, 85, 230, 10, 50, 99, 112, 242, 152, 39, 229, 133, 99, 46, 227, 179, 3, 15, 94, 36, 229, 85, 26, 193, 78,
-    115, 212, 58, 199, 133, 223, 232, 163, 239, 252, 193, 127, 59, 210, 7, 23, 218, 91, 32, 97, 104, 15, 95, 23, 139,
-    43, 232, 58, 155, 7, 189, 248, 195, 201, 38, 169, 12, 152, 208, 162, 19, 213, 96, 63, 26, 0, 155, 186, 62, 223, 199,
-    254, 81, 231, 81, 80, 40, 64, 1, 238, 64, 170, 8, 28, 91, 44, 129, 37, 230, 38, 247, 207, 69, 83, 3, 10, 1, 117,
-    138, 81, 231, 208, 105, 48, 51, 167, 124, 72, 218, 23, 224, 68, 255, 247, 177, 238, 35, 219, 114, 246, 162, 60, 175,
-    201, 169, 232, 55, 227, 153, 248, 87, 4, 17, 195, 104, 204, 122, 41, 122, 132, 43, 28, 125, 193, 228, 24, 178, 215,
-    76, 159, 244, 24, 110, 123, 37, 97, 17, 172, 243, 230, 191, 235, 206, 255, 39, 149, 176, 119, 216, 4, 171, 111, 38,
-    144, 125, 15, 248, 173, 87, 116, 29, 42, 72, 48, 165, 241, 194, 176, 92, 8, 113, 232, 45, 204, 242, 194, 17, 110,
-    145, 130, 15, 103, 143, 128, 215, 23, 11, 19, 70, 103, 250, 135, 126, 118, 240, 224, 54, 29, 134, 209, 86, 120, 176,
-    193, 58, 61, 52, 146, 229, 104, 149, 10, 96, 90, 125, 47, 91, 44, 107, 189, 134, 131, 203, 15, 36, 216, 203, 29,
-    174, 194, 200, 168, 239, 76, 24, 178, 214, 119, 92, 98, 103, 79, 180, 122, 205, 123, 108, 240, 132, 123, 18, 41,
-    202, 27, 85, 99, 215, 63, 136, 66, 184, 38, 214, 139, 130, 123, 164, 11, 60, 65, 132, 121, 50, 125, 204, 183, 81,
-    191, 163, 103, 242, 220, 224, 184, 47, 45, 232, 152, 117, 19, 173, 237, 63, 215, 29, 156, 129, 251, 231, 104, 10,
-    208, 178, 95, 97, 168, 201, 53, 237, 59, 0, 105, 70, 13, 59, 187, 125, 82, 72, 154, 229, 117, 219, 162, 93, 44, 73,
-    174, 76, 196, 20, 209, 51, 220, 29, 180, 245, 250, 41, 152, 98, 130, 52, 95, 8, 123, 80, 220, 219, 77, 128, 34, 217,
-    217, 107, 33, 15, 3, 100, 71, 249, 148, 80, 136, 121, 6, 180, 196, 20, 92, 34, 217, 96, 214, 180, 235, 204, 103, 41,
-    158, 248, 98, 239, 205, 70, 57, 41, 44, 114, 148, 211, 58, 211, 60, 249, 77, 150, 159, 152, 218, 125, 101, 99, 239,
-    141, 59, 120, 231, 130, 251, 180, 91, 34, 191, 115, 44, 110, 201, 203, 153, 231, 85, 18, 203, 161, 123, 156, 202,
-    145, 152, 13, 115, 148, 40, 14, 89, 241, 223, 228, 18, 181, 37, 205, 42, 128, 84, 103, 162, 247, 144, 87, 99, 39,
-    182, 245, 199, 76, 30, 54, 70, 49, 179, 10, 15, 74, 57, 172, 95, 17, 0, 230, 142, 39, 8, 204, 105, 87, 233, 3, 240,
-    168, 13, 91, 200, 79, 105, 95, 11, 127, 67, 24, 182, 209, 7, 34, 216, 82, 15, 91, 119, 137, 160, 57, 235, 148, 9, 3,
-    163, 224, 152, 106, 44, 190, 1, 119, 118, 77, 166, 136, 0, 27, 156, 237, 234, 15, 192, 249, 186, 209, 63, 193, 56,
-    4, 42, 219, 49, 76, 79, 187, 152, 49, 176, 0, 184, 210, 73, 56, 107, 238, 141, 115, 126, 192, 167, 208, 139, 104,
-    129, 67, 71, 20, 141, 199, 66, 101, 109, 221, 81, 218, 83, 141, 0, 124, 100, 88, 36, 52, 116, 165, 158, 181, 112,
-    84, 200, 152, 141, 222, 216, 215, 145, 14, 253, 4, 72, 226, 5, 144, 222, 76, 241, 73, 225, 138, 91, 140, 43, 188,
-    128, 136, 53, 178, 225, 52, 68, 109, 96, 162, 145, 200, 38, 29, 17, 34, 213, 248, 113, 75, 203, 52, 59, 41, 0, 34,
-    195, 78, 61, 208, 178, 176, 86, 225, 160, 88, 57, 224, 48, 135, 34, 190, 137, 59, 157, 247, 185, 223, 178, 175, 212,
-    25, 209, 3, 179, 182, 44, 142, 30, 162, 212, 207, 218, 212, 173, 66, 167, 151, 123, 39, 189, 172, 147, 70, 32, 115,
-    15, 147, 161, 8, 94, 203, 121, 47, 123, 139, 1, 101, 36, 176, 19, 43, 117, 3, 148, 0, 28, 187, 116, 12, 243, 227,
-    117, 24, 87, 18, 145, 204, 26, 150, 181, 75, 110, 231, 156, 13, 210, 82, 135, 33, 94, 46, 221, 189, 93, 75, 166,
-    100, 229, 179, 2, 62, 220, 47, 198, 162, 49, 185, 44, 83, 52, 16, 87, 191, 139, 45, 107, 167, 11, 83, 135, 220, 245,
-    198, 6, 160, 238, 95, 10, 21, 159, 84, 201, 14, 121, 58, 30, 182, 231, 223, 52, 162, 25, 250, 78, 124, 189, 247, 64,
-    41, 88, 230, 16, 93, 219, 190, 44, 107, 158, 54, 6, 87, 92, 173, 220, 75, 205, 69, 213, 174, 18, 120, 94, 25, 218,
-    54, 23, 53, 208, 130, 211, 108, 148, 138, 64, 26, 54, 18, 189, 191, 191, 70, 3, 95, 229, 118, 186, 242, 173, 221,
-    222, 104, 75, 118, 30, 223, 203, 67, 221, 104, 106, 179, 184, 15, 241, 36, 152, 186, 143, 163, 119, 66, 103, 42, 41,
-    125, 93, 222, 36, 61, 146, 68, 220, 177, 59, 125, 194, 88, 206, 131, 215, 249, 94, 196, 120, 199, 178, 203, 76, 98,
-    14, 106, 215, 253, 193, 49, 88, 200, 13, 30, 227, 13, 65, 52, 10, 76, 233, 189, 31, 237, 137, 213, 29, 62, 188, 115,
-    37, 246, 229, 107, 169, 40, 68, 146, 247, 191, 188, 42, 132, 204, 204, 235, 34, 9, 65, 80, 16, 183, 45, 154, 175, 9,
-    225, 102, 225, 166, 13, 52, 21, 153, 107, 172, 38, 8, 0, 92, 138, 60, 1, 100, 82, 87, 120, 153, 191, 113, 26, 210,
-    78, 76, 145, 149, 17, 5, 165, 96, 26, 132, 207, 210, 86, 55, 154, 42, 208, 152, 8, 242, 57, 67, 6, 72, 140, 108, 72,
-    60, 35, 235, 228, 219, 9, 190, 47, 178, 237, 75, 241, 230, 238, 186, 254, 230, 254, 224, 34, 39, 67, 63, 180, 55,
-    15, 126, 122, 56, 255, 89, 99, 223, 52, 98, 127, 15, 249, 139, 58, 59, 47, 185, 171, 195, 249, 102, 99, 39, 132,
-    215, 213, 76, 104, 173, 115, 179, 30, 30, 67, 74, 38, 36, 159, 224, 57, 26, 156, 198, 224, 14, 219, 246, 181, 233,
-    209, 20, 26, 230, 172, 181, 69, 149, 36, 32, 245, 163, 172, 91, 227, 129, 155, 90, 125, 182, 184, 201, 202, 83, 132,
-    43, 37, 147, 107, 172, 89, 228, 252, 225, 248, 214, 110, 103, 0, 127, 195, 220, 147, 120, 230, 231, 80, 41, 94, 243,
-    176, 8, 156, 75, 93, 3, 169, 8, 232, 28, 158, 178, 120, 13, 151, 40, 220, 47, 59, 77, 107, 100, 4, 196, 226, 199,
-    53, 13, 67, 193, 180, 157, 153, 203, 5, 44, 214, 58, 47, 157, 243, 23, 182, 147, 112, 139, 190, 127, 245, 4, 72,
-    227, 218, 210, 153, 0, 64, 35, 254, 241, 126, 212, 26, 158, 151, 152, 19, 113, 192, 152, 222, 83, 231, 14, 13, 139,
-    67, 106, 74, 136, 82, 100, 71, 143, 203, 213, 216, 167, 80, 13, 130, 151, 215, 95, 44, 198, 255, 17, 252, 194, 250,
-    84, 39, 201, 233, 142, 36, 121, 148, 42, 72, 23, 21, 89, 219, 39, 250, 24, 195, 100, 5, 235, 110, 84, 125, 1, 25,
-    237, 192, 135, 9, 150, 45, 132, 186, 22, 47, 38, 168, 195, 187, 60, 203, 248, 224, 169, 175, 37, 142, 246, 21, 159,
-    220, 172, 145, 210, 150, 225, 134, 141, 200, 154, 82, 209, 117, 244, 1, 64, 40, 110, 62, 5, 84, 20, 190, 67, 142,
-    57, 10, 250, 47, 98, 19, 73, 138, 207, 103, 0, 73, 5, 77, 34, 9, 255, 170, 8, 37, 154, 41, 64, 9, 111, 151, 68, 140,
-    73, 136, 189, 85, 196, 194, 79, 176, 190, 27, 165, 17, 87, 13, 221, 237, 133, 182, 190, 244, 204, 95, 120, 65, 150,
-    2, 238, 229, 83, 130, 47, 97, 229, 143, 23, 0, 167, 169, 187, 230, 89, 207, 227, 60, 87, 37, 86, 18, 57, 161, 142,
-    151, 123, 187, 184, 31, 46, 214, 28, 142, 144, 146, 76, 218, 58, 36, 166, 27, 4, 123, 129, 58, 10, 251, 182, 90,
-    251, 211, 151, 37, 136, 209, 182, 126, 169, 244, 149, 85, 107, 135, 101, 195, 38, 151, 14, 122, 115, 46, 65, 52,
-    135, 214, 217, 6, 83, 156, 155, 160, 202, 13, 173, 46, 229, 100, 12, 145, 72, 170, 203, 100, 228, 141, 123, 25, 217,
-    32, 61, 249, 54, 161, 94, 240, 144, 25, 229, 111, 114, 166, 192, 194, 120, 13, 60, 121, 224, 172, 113, 133, 141,
-    252, 79, 123, 43, 198, 66, 54, 137, 130, 186, 226, 120, 163, 235, 62, 203, 116, 132, 70, 144, 195, 70, 47, 181, 86,
-    72, 67, 94, 33, 57, 85, 46, 105, 207, 203, 243, 245, 170, 91, 196, 218, 94, 144, 243, 98, 240, 12, 20, 230, 157,
-    165, 11, 221, 16, 146, 27, 165, 54, 129, 128, 211, 4, 201, 252, 123, 251, 223, 155, 112, 120, 98, 239, 140, 102, 19,
-    73, 35, 26, 49, 141, 166, 216, 1, 72, 37, 112, 0, 92, 237, 239, 38, 95, 196, 49, 35, 180, 76, 83, 66, 16, 227, 22,
-    212, 238, 208, 83, 25, 84, 250, 224, 26, 144, 25, 25, 22, 82, 74, 148, 104, 248, 167, 170, 51, 60, 127, 127, 70,
-    210, 49, 131, 204, 127, 81, 27, 60, 113, 140, 230, 193, 149, 125, 243, 142, 172, 176, 31, 107, 1, 175, 151, 134,
-    183, 14, 124, 150, 146, 156, 148, 153, 99, 78, 22, 50, 164, 131, 160, 78, 130, 100, 78, 96, 160, 189, 36, 127, 162,
-    37, 1, 132, 64, 220, 1, 48, 194, 164, 40, 177, 231, 151, 92, 198, 91, 213, 131, 247, 157, 242, 48, 229, 41, 12, 117,
-    228, 213, 154, 69, 210, 191, 191, 51, 130, 241, 141, 46, 125, 104, 26, 134, 35, 180, 160, 115, 160, 214, 255, 213,
-    34, 251, 225, 162, 123, 221, 125, 247, 205, 112, 197, 153, 235, 200, 93, 151, 163, 48, 238, 40, 97, 59, 197, 118,
-    112, 226, 124, 197, 151, 186, 193, 133, 244, 46, 66, 248, 117, 211, 106, 242, 61, 186, 5, 11, 125, 199, 10, 232, 0,
-    253, 194, 19, 156, 106, 244, 198, 131, 42, 59, 196, 45, 221, 151, 128, 130, 177, 114, 249, 74, 99, 62, 157, 137, 42,
-    84, 30, 60, 187, 242, 45, 107, 99, 21, 151, 35, 7, 244, 137, 253, 197, 187, 85, 195, 159, 211, 199, 66, 107, 188,
-    158, 229, 90, 169, 71, 139, 237, 134, 39, 88, 183, 165, 188, 2, 80, 12, 249, 252, 39, 127, 122, 127, 89, 199, 178,
-    58, 81, 158, 47, 84, 162, 5, 144, 238, 24, 58, 202, 158, 36, 191, 3, 83, 165, 186, 155, 184, 99, 59, 130, 50, 220,
-    214, 32, 191, 93, 179, 210, 41, 235, 238, 232, 7, 191, 193, 154, 176, 210, 161, 251, 238, 150, 113, 47, 252, 233,
-    208, 69, 17, 6, 204, 73, 0, 202, 72, 63, 244, 22, 209, 51, 136, 115, 245, 222, 22, 171, 20, 198, 254, 178, 13, 232,
-    152, 247, 5, 195, 129, 65, 15, 49, 252, 53, 155, 239, 89, 175, 62, 150, 91, 220, 159, 42, 30, 24, 91, 227, 159, 148,
-    238, 229, 199, 66, 131, 91, 174, 68, 151, 81, 231, 199, 227, 131, 251, 144, 154, 206, 104, 3, 190, 231, 2, 221, 61,
-    118, 157, 12, 101, 65, 84, 107, 57, 239, 77, 112, 211, 100, 140, 112, 149, 162, 133, 166, 173, 243, 133, 191, 202,
-    229, 232, 25, 52, 254, 153, 193, 151, 192, 37, 191, 233, 150, 104, 133, 35, 254, 68, 147, 135, 188, 22, 136, 18,
-    145, 222, 49, 39, 211, 51, 129, 227, 234, 116, 196, 42, 47, 22, 12, 20, 253, 53, 199, 122, 210, 139, 23, 110, 5, 92,
-    247, 32, 30, 245, 120, 199, 65, 124, 51, 160, 194, 125, 232, 30, 122, 175, 142, 135, 238, 146, 41, 150, 6, 173, 241,
-    154, 113, 179, 97, 24, 71, 170, 148, 235, 99, 246, 109, 41, 82, 210, 74, 199, 232, 185, 2, 212, 160, 89, 221, 148,
-    90, 30, 175, 206, 113, 125, 24, 23, 49, 55, 150, 146, 189, 243, 13, 137, 5, 183, 169, 188, 38, 128, 197, 79, 173,
-    38, 73, 197, 211, 167, 54, 237, 121, 36, 212, 165, 172, 208, 85, 191, 137, 157, 248, 12, 239, 241, 21, 52, 6, 25,
-    243, 103, 18, 180, 203, 100, 224, 144, 130, 21, 213, 199, 209, 89, 125, 5, 160, 87, 128, 98, 233, 58, 119, 18, 26,
-    127, 159, 218, 83, 70, 251, 31, 154, 105, 44, 70, 21, 142, 212, 160, 61, 184, 16, 152, 160, 35, 199, 154, 137, 38,
-    135, 195, 106, 145, 254, 24, 1, 65, 51, 199, 66, 240, 156, 60, 99, 58, 244, 231, 227, 131, 95, 141, 52, 135, 62, 38,
-    136, 9, 86, 81, 2, 32, 235, 109, 158, 223, 28, 98, 149, 192, 142, 129, 204, 198, 122, 99, 72, 1, 178, 225, 192, 167,
-    110, 224, 238, 84, 103, 114, 94, 47, 221, 168, 15, 150, 170, 196, 77, 178, 98, 92, 136, 27, 105, 171, 108, 76, 31,
-    57, 122, 119, 68, 83, 12, 192, 118, 93, 103, 18, 232, 71, 140, 148, 108, 60, 201, 197, 243, 116, 135, 41, 172, 125,
-    158, 24, 182, 179, 113, 70, 149, 131, 154, 105, 178, 145, 39, 85, 8, 62, 165, 43, 78, 8, 224, 222, 149, 215, 145,
-    115, 69, 84, 205, 147, 105, 245, 238, 108, 84, 12, 53, 229, 163, 245, 181, 236, 54, 224, 206, 114, 184, 50, 222,
-    142, 109, 85, 103, 33, 152, 40, 242, 138, 127, 69, 186, 210, 14, 156, 187, 4, 212, 74, 55, 67, 100, 72, 144, 196,
-    17, 35, 20, 136, 31, 0, 63, 169, 125, 215, 87, 168, 109, 106, 135, 199, 243, 97, 22, 253, 187, 186, 205, 27, 35,
-    147, 24, 161, 252, 83, 213, 127, 33, 142, 90, 222, 100, 59, 92, 104, 48, 25, 177, 56, 165, 252, 142, 191, 36, 223,
-    117, 249, 94, 61, 142, 17, 218, 133, 49, 179, 21, 184, 224, 231, 53, 154, 114, 12, 5, 190, 194, 29, 125, 193, 77,
-    132, 186, 156, 229, 186, 230, 34, 197, 147, 36, 241, 26, 71, 77, 225, 37, 133, 88, 158, 152, 104, 216, 189, 211,
-    158, 27, 115, 85, 202, 186, 1, 243, 24, 169, 119, 119, 23, 88, 26, 98, 7, 221, 138, 233, 197, 30, 25, 101, 102, 208,
-    205, 229, 191, 121, 66, 100, 81, 63, 29, 40, 205, 6, 244, 165, 57, 195, 253, 189, 248, 158, 115, 214, 159, 247, 40,
-    132, 231, 143, 205, 9, 113, 40, 30, 156, 169, 64, 2, 240, 45, 59, 59, 85, 77, 12, 192, 13, 131, 207, 85, 245, 224,
-    244, 184, 148, 77, 33, 162, 222, 169, 199, 202, 75, 194, 52, 203, 159, 168, 70, 40, 247, 34, 192, 180, 145, 21, 237,
-    184, 53, 126, 133, 110, 220, 57, 180, 21, 2, 194, 104, 169, 145, 96, 177, 199, 250, 187, 100, 249, 64, 7, 163, 214,
-    22, 75, 224, 178, 144, 254, 61, 40, 164, 161, 67, 169, 158, 168, 105, 71, 27, 254, 143, 165, 32, 252, 31, 134, 95,
-    207, 156, 14, 95, 157, 60, 148, 136, 131, 13, 179, 173, 110, 185, 145, 241, 192, 212, 204, 34, 252, 28, 186, 242,
-    233, 6, 153, 166, 176, 152, 252, 140, 113, 154, 114, 139, 12, 201, 57, 234, 108, 221, 42, 47, 82, 25, 67, 96, 238,
-    148, 227, 219, 200, 101, 2, 150, 115, 12, 225, 155, 190, 56, 236, 99, 24, 197, 4, 110, 87, 233, 175, 89, 229, 212,
-    121, 186, 255, 206, 105, 183, 182, 129, 251, 211, 149, 149, 57, 84, 103, 161, 215, 196, 80, 103, 123, 159, 201, 153,
-    18, 170, 107, 188, 22, 178, 209, 100, 143, 195, 158, 20, 213, 241, 128, 91, 203, 234, 173, 80, 239, 143, 195, 80,
-    118, 90, 83, 120, 107, 75, 116, 71, 3, 28, 187, 9, 113, 49, 255, 92, 230, 195, 199, 61, 247, 94, 174, 179, 184, 13,
-    212, 182, 205, 197, 44, 146, 30, 72, 244, 150, 10, 49, 95, 119, 85, 188, 84, 209, 98, 187, 208, 222, 228, 131, 3,
-    105, 150, 118, 112, 32, 228, 135, 36, 173, 7, 90, 136, 215, 75, 9, 69, 98, 130, 117, 230, 252, 127, 130, 14, 223,
-    163, 221, 4, 189, 99, 19, 204, 107, 150, 141, 22, 5, 253, 60, 40, 206, 108, 76, 224, 117, 109, 53, 245, 116, 43,
-    126, 148, 202, 34, 29, 88, 44, 30, 205, 97, 255, 40, 149, 27, 250, 80, 220, 200, 143, 42, 146, 9, 217, 250, 7, 104,
-    126, 44, 146, 58, 16, 182, 77, 203, 131, 27, 72, 161, 77, 102, 209, 149, 28, 4, 253, 232, 69, 111, 245, 125, 146,
-    221, 58, 197, 237, 47, 6, 211, 146, 54, 85, 152, 98, 127, 72, 200, 172, 17, 81, 245, 223, 122, 186, 27, 192, 175,
-    95, 126, 237, 44, 176, 100, 220, 238, 223, 215, 162, 0, 97, 162, 18, 75, 177, 148, 1, 26, 103, 90, 203, 184, 34,
-    242, 213, 180, 171, 144, 32, 227, 210, 132, 180, 128, 223, 88, 80, 119, 163, 109, 249, 118, 27, 49, 44, 135, 129,
-    110, 150, 174, 192, 68, 181, 187, 168, 151, 172, 250, 175, 102, 72, 248, 30, 64, 129, 170, 170, 105, 99, 158, 149,
-    155, 230, 112, 234, 144, 176, 232, 162, 137, 182, 160, 132, 18, 195, 182, 184, 53, 164, 225, 43, 240, 117, 3, 241,
-    70, 222, 184, 230, 144, 164, 242, 100, 53, 36, 80, 230, 129, 86, 240, 123, 47, 244, 72, 122, 121, 106, 141, 43, 208,
-    162, 194, 108, 153, 94, 44, 56, 162, 110, 53, 90, 208, 184, 194, 149, 115, 107, 25, 223, 7, 230, 157, 14, 169, 199,
-    94, 246, 17, 242, 115, 44, 95, 22, 41, 194, 214, 219, 157, 195, 79, 242, 253, 239, 76, 185, 115, 242, 203, 117, 237,
-    223, 182, 79, 61, 171, 81, 243, 223, 141, 158, 136, 27, 47, 248, 245, 19, 93, 76, 199, 195, 4, 52, 19, 222, 124, 53,
-    243, 64, 188, 235, 216, 45, 245, 131, 251, 244, 167, 67, 47, 95, 3, 219, 140, 132, 11, 203, 239, 38, 35, 27, 225,
-    246, 166, 157, 227, 167, 218, 249, 141, 127, 195, 82, 142, 57, 163, 111, 220, 212, 241, 165, 152, 173, 53, 221, 33,
-    24, 95, 96, 180, 92, 107, 31, 79, 60, 21, 170, 221, 118, 19, 128, 154, 214, 78, 31, 249, 150, 58, 72, 9, 150, 116,
-    13, 176, 148, 235, 26, 211, 115, 160, 56, 162, 128, 216, 224, 63, 81, 152, 94, 48, 165, 58, 245, 124, 247, 67, 91,
-    213, 89, 144, 237, 212, 35, 19, 55, 109, 143, 28, 14, 149, 64, 55, 125, 182, 16, 210, 87, 58, 205, 55, 57, 173, 252,
-    167, 66, 239, 60, 43, 28, 157, 242, 86, 203, 81, 147, 94, 225, 170, 140, 186, 100, 177, 98, 249, 175, 253, 82, 197,
-    98, 97, 249, 249, 42, 167, 243, 88, 230, 192, 150, 24, 212, 65, 70, 125, 141, 156, 172, 222, 241, 235, 16, 192, 103,
-    60, 149, 102, 155, 88, 191, 200, 201, 197, 124, 130, 98, 68, 78, 120, 230, 43, 239, 82, 205, 35, 143, 96, 109, 24,
-    232, 98, 56, 171, 173, 52, 124, 7, 148, 29, 255, 205, 250, 205, 75, 142, 122, 12, 61, 169, 166, 1, 46, 127, 135,
-    146, 135, 208, 2, 107, 111, 184, 179, 93, 250, 232, 109, 6, 30, 155, 106, 176, 87, 250, 132, 125, 249, 138, 53, 110,
-    90, 79, 70, 114, 155, 39, 111, 77, 166, 129, 33, 191, 67, 107, 16, 243, 58, 198, 234, 163, 215, 0, 6, 130, 95, 213,
-    7, 167, 127, 228, 15, 194, 140, 232, 185, 227, 165, 214, 60, 91, 100, 148, 174, 165, 146, 135, 223, 91, 109, 133,
-    98, 122, 175, 194, 75, 251, 67, 41, 128, 22, 106, 180, 32, 147, 54, 197, 61, 138, 164, 143, 195, 211, 33, 184, 194,
-    183, 65, 15, 142, 138, 196, 92, 203, 2, 42, 117, 20, 45, 71, 18, 82, 12, 202, 172, 205, 152, 85, 164, 109, 18, 197,
-    0, 127, 166, 54, 164, 176, 17, 227, 69, 66, 65, 76, 3, 99, 154, 81, 15, 248, 144, 244, 245, 16, 226, 138, 81, 46,
-    28, 65, 226, 149, 208, 211, 164, 170, 45, 232, 4, 44, 206, 215, 161, 71, 33, 251, 63, 36, 221, 216, 30, 216, 144,
-    40, 170, 153, 193, 57, 108, 44, 202, 162, 235, 134, 40, 51, 230, 7, 157, 92, 141, 121, 177, 217, 228, 152, 181, 212,
-    254, 36, 178, 46, 210, 188, 149, 243, 188, 63, 57, 194, 166, 173, 69, 207, 143, 179, 17, 234, 132, 184, 28, 7, 8,
-    111, 36, 175, 77, 169, 245, 69, 118, 140, 254, 210, 49, 120, 57, 218, 38, 151, 48, 13, 177, 163, 42, 54, 193, 124,
-    172, 69, 92, 108, 201, 16, 34, 236, 230, 231, 179, 121, 165, 36, 254, 13, 49, 106, 43, 239, 229, 249, 166, 200, 136,
-    184, 195, 112, 119, 246, 35, 244, 56, 228, 168, 192, 201, 91, 64, 255, 83, 195, 68, 246, 33, 4, 124, 99, 213, 248,
-    232, 169, 90, 133, 61, 79, 172, 169, 14, 178, 238, 198, 37, 48, 164, 59, 197, 246, 116, 51, 238, 55, 128, 242, 65,
-    215, 124, 91, 4, 76, 6, 149, 252, 79, 140, 164, 176, 142, 54, 23, 113, 199, 193, 47, 53, 9, 98, 195, 27, 111, 79,
-    183, 60, 44, 100, 166, 13, 54, 130, 131, 8, 112, 0, 163, 163, 208, 124, 31, 125, 214, 101, 62, 70, 50, 61, 133, 243,
-    226, 150, 197, 141, 194, 67, 123, 182, 230, 97, 183, 70, 83, 172, 124, 69, 168, 157, 113, 66, 99, 82, 83, 13, 12,
-    101, 215, 197, 111, 136, 176, 34, 59, 204, 170, 21, 7, 27, 231, 182, 10, 55, 23, 72, 111, 85, 53, 242, 11, 103, 252,
-    30, 210, 100, 0, 33, 131, 195, 104, 163, 173, 150, 129, 4, 112, 117, 50, 104, 237, 219, 155, 85, 149, 109, 50, 31,
-    69, 186, 80, 40, 72, 103, 239, 192, 26, 112, 211, 189, 172, 56, 192, 1, 92, 39, 203, 28, 120, 176, 21, 86, 8, 197,
-    108, 19, 71, 40, 133, 111, 210, 211, 134, 244, 122, 24, 24, 196, 99, 25, 180, 242, 144, 143, 181, 87, 99, 199, 220,
-    90, 39, 66, 159, 182, 241, 160, 151, 134, 112, 1, 215, 67, 140, 53, 208, 196, 253, 10, 195, 223, 226, 48, 147, 176,
-    129, 223, 246, 147, 218, 250, 55, 92, 247, 37, 49, 107, 59, 175, 252, 139, 167, 22, 198, 58, 228, 38, 146, 166, 54,
-    106, 129, 201, 10, 201, 249, 16, 228, 143, 244, 114, 101, 207, 18, 157, 36, 224, 33, 1, 51, 121, 210, 140, 140, 85,
-    50, 232, 4, 220, 166, 201, 153, 120, 49, 87, 146, 45, 59, 196, 141, 9, 77, 121, 32, 230, 207, 190, 240, 108, 96,
-    154, 130, 27, 91, 87, 108, 173, 28, 1, 7, 219, 28, 114, 45, 167, 234, 10, 196, 164, 21, 204, 50, 231, 90, 126, 215,
-    227, 238, 221, 18, 13, 181, 206, 170, 239, 92, 69, 137, 158, 86, 5, 137, 97, 176, 97, 122, 21, 201, 79, 249, 214, 7,
-    4, 58, 201, 34, 244, 247, 21, 213, 109, 221, 94, 2, 12, 251, 16, 237, 240, 86, 152, 250, 25, 177, 67, 131, 61, 149,
-    52, 202, 12, 6, 188, 149, 43, 42, 47, 221, 235, 12, 28, 162, 114, 96, 252, 36, 140, 90, 20, 179, 130, 241, 194, 69,
-    235, 183, 144, 210, 0, 206, 194, 160, 68, 232, 41, 71, 141, 61, 197, 27, 41, 94, 25, 86, 6, 27, 57, 168, 38, 85,
-    134, 60, 8, 152, 108, 193, 165, 6, 151, 241, 108, 121, 234, 143, 20, 211, 2, 117, 209, 87, 111, 213, 88, 129, 111,
-    160, 245, 142, 177, 149, 254, 23, 142, 165, 223, 36, 108, 91, 105, 239, 178, 31, 227, 178, 156, 102, 3, 250, 26,
-    244, 36, 239, 190, 169, 196, 123, 79, 31, 4, 22, 72, 6, 209, 10, 193, 32, 127, 189, 97, 215, 128, 145, 11, 16, 241,
-    30, 9, 188, 104, 160, 17, 244, 152, 136, 222, 160, 125, 216, 141, 8, 24, 68, 95, 204, 170, 69, 139, 12, 228, 209,
-    240, 39, 194, 122, 69, 125, 83, 136, 158, 122, 72, 99, 176, 118, 10, 94, 66, 76, 178, 48, 239, 179, 136, 33, 165,
-    168, 146, 195, 255, 198, 197, 185, 240, 192, 148, 233, 74, 210, 113, 244, 101, 189, 60, 130, 208, 220, 123, 200, 51,
-    169, 148, 241, 233, 1, 33, 145, 102, 108, 153, 94, 220, 115, 75, 194, 67, 6, 159, 220, 158, 249, 59, 32, 239, 183,
-    209, 239, 13, 231, 198, 2, 216, 115, 241, 23, 237, 49, 211, 100, 59, 254, 249, 190, 102, 195, 103, 13, 87, 64, 29,
-    10, 45, 96, 106, 251, 167, 243, 89, 111, 38, 196, 217, 101, 172, 137, 213, 213, 163, 93, 27, 63, 127, 82, 225, 235,
-    89, 159, 188, 103, 187, 211, 79, 205, 146, 112, 37, 114, 65, 178, 107, 227, 224, 164, 108, 206, 152, 63, 38, 106,
-    225, 191, 55, 170, 76, 54, 130, 146, 177, 145, 45, 138, 108, 59, 12, 214, 137, 137, 75, 133, 87, 226, 66, 112, 164,
-    160, 139, 12, 188, 213, 179, 107, 58, 93, 39, 153, 88, 188, 137, 38, 211, 67, 184, 90, 19, 39, 149, 187, 89, 18,
-    154, 189, 29, 155, 238, 130, 185, 35, 208, 172, 130, 63, 210, 212, 198, 59, 161, 161, 36, 242, 140, 221, 49, 51, 43,
-    159, 110, 182, 234, 193, 235, 157, 152, 11, 64, 5, 168, 243, 180, 58, 22, 171, 14, 61, 33, 16, 131, 227, 104, 193,
-    70, 123, 233, 199, 130, 91, 4, 164, 99, 130, 106, 84, 125, 25, 207, 139, 54, 213, 9, 29, 203, 93, 162, 246, 153,
-    246, 15, 119, 172, 75, 222, 4, 32, 140, 146, 57, 200, 216, 234, 125, 175, 178, 53, 33, 115, 35, 31, 223, 114, 47,
-    34, 166, 45, 10, 97, 199, 128, 99, 104, 32, 20, 177, 161, 88, 32, 40, 213, 147, 5, 148, 173, 190, 65, 208, 137, 100,
-    160, 163, 126, 201, 108, 95, 178, 206, 164, 198, 152, 8, 95, 13, 204, 245, 10, 168, 116, 225, 168, 148, 255, 143,
-    171, 178, 52, 207, 108, 125, 191, 173, 131, 144, 39, 218, 118, 129, 252, 141, 130, 122, 134, 156, 122, 248, 220, 16,
-    7, 219, 43, 129, 88, 26, 37, 14, 82, 192, 161, 212, 14, 199, 221, 57, 58, 106, 5, 129, 224, 42, 174, 114, 76, 99,
-    177, 4, 144, 67, 125, 112, 3, 33, 139, 128, 245, 115, 213, 184, 132, 222, 119, 81, 212, 106, 215, 187, 155, 115,
-    136, 188, 57, 86, 251, 248, 84, 229, 47, 26, 65, 77, 92, 183, 149, 206, 165, 202, 121, 75, 39, 176, 198, 207, 11,
-    211, 217, 75, 218, 232, 188, 7, 235, 67, 21, 15, 92, 155, 122, 5, 119, 203, 179, 217, 108, 228, 122, 161, 37, 62,
-    78, 25, 182, 255, 179, 148, 114, 141, 200, 197, 57, 130, 58, 18, 104, 57, 63, 102, 131, 220, 213, 54, 47, 97, 207,
-    180, 59, 88, 248, 232, 45, 117, 194, 176, 33, 96, 124, 88, 189, 59, 18, 113, 29, 201, 79, 77, 133, 53, 240, 24, 238,
-    45, 208, 1, 98, 249, 117, 141, 28, 119, 136, 149, 118, 241, 219, 91, 151, 76, 18, 143, 103, 202, 109, 139, 128, 79,
-    37, 156, 37, 116, 60, 30, 48, 238, 53, 212, 9, 14, 6, 185, 152, 167, 188, 133, 108, 215, 212, 89, 181, 219, 143,
-    138, 118, 93, 218, 8, 113, 142, 232, 44, 22, 174, 11, 175, 102, 168, 122, 192, 217, 124, 114, 108, 30, 201, 48, 96,
-    38, 91, 81, 4, 172, 3, 47, 51, 157, 194, 42, 207, 172, 252, 255, 82, 37, 144, 122, 103, 86, 247, 156, 145, 19, 147,
-    194, 152, 56, 170, 185, 217, 71, 115, 140, 161, 137, 238, 247, 37, 20, 89, 116, 47, 56, 14, 205, 253, 124, 154, 230,
-    253, 74, 116, 44, 110, 224, 19, 99, 64, 9, 209, 255, 57, 130, 183, 244, 68, 170, 155, 253, 201, 21, 180, 61, 79, 89,
-    130, 180, 95, 73, 25, 154, 55, 20, 54, 38, 161, 107, 170, 156, 231, 123, 62, 54, 25, 196, 115, 25, 219, 176, 188,
-    169, 183, 127, 178, 99, 185, 5, 20, 46, 36, 34, 153, 110, 62, 6, 243, 160, 159, 70, 105, 191, 252, 34, 200, 123,
-    147, 8, 231, 164, 101, 187, 178, 67, 125, 159, 133, 194, 216, 166, 17, 45, 76, 50, 172, 103, 167, 216, 49, 212, 152,
-    236, 199, 197, 241, 48, 245, 226, 30, 94, 81, 85, 43, 31, 59, 131, 201, 167, 221, 101, 19, 6, 200, 255, 41, 17, 248,
-    234, 177, 109, 73, 100, 210, 176, 124, 196, 19, 51, 246, 202, 16, 12, 10, 14, 74, 137, 195, 208, 5, 190, 201, 76,
-    99, 248, 84, 123, 4, 83, 40, 18, 85, 12, 208, 162, 109, 141, 153, 89, 95, 225, 222, 243, 140, 39, 180, 59, 77, 24,
-    32, 117, 85, 227, 78, 215, 139, 113, 132, 130, 197, 167, 189, 199, 225, 177, 98, 228, 47, 167, 96, 191, 127, 241,
-    209, 253, 193, 168, 1, 107, 9, 221, 22, 233, 117, 72, 190, 10, 151, 55, 175, 134, 170, 49, 151, 107, 22, 97, 147,
-    244, 61, 24, 123, 157, 119, 45, 93, 110, 110, 126, 228, 69, 58, 108, 67, 196, 122, 98, 152, 49, 10, 122, 218, 80,
-    212, 54, 28, 84, 223, 221, 15, 181, 188, 175, 12, 50, 192, 177, 108, 172, 92, 222, 201, 25, 184, 64, 82, 93, 167,
-    126, 252, 61, 223, 185, 105, 180, 127, 169, 94, 250, 169, 43, 119, 109, 61, 6, 216, 38, 152, 219, 8, 84, 33, 231,
-    193, 78, 231, 239, 253, 173, 243, 11, 3, 230, 210, 79, 215, 181, 53, 100, 34, 41, 246, 127, 141, 135, 126, 68, 86,
-    167, 18, 139, 19, 51, 136, 235, 11, 127, 174, 54, 253, 204, 28, 226, 52, 161, 244, 118, 119, 97, 10, 88, 138, 203,
-    168, 118, 198, 13, 177, 32, 24, 218, 174, 2, 183, 217, 65, 135, 15, 160, 238, 83, 193, 40, 17, 139, 11, 71, 122, 28,
-    18, 131, 111, 176, 24, 165, 65, 26, 229, 11, 130, 44, 54, 134, 125, 247, 192, 28, 186, 67, 196, 87, 81, 32, 8, 117,
-    60, 68, 230, 58, 13, 233, 120, 141, 52, 221, 35, 204, 160, 49, 254, 69, 50, 158, 33, 44, 148, 115, 67, 204, 121, 3,
-    97, 125, 177, 149, 80, 84, 220, 91, 62, 83, 202, 38, 181, 62, 237, 11, 255, 73, 177, 89, 211, 46, 226, 211, 32, 111,
-    92, 227, 236, 25, 174, 189, 58, 219, 10, 82, 141, 20, 64, 252, 183, 157, 98, 30, 159, 28, 242, 162, 185, 173, 187,
-    176, 168, 107, 195, 7, 69, 158, 188, 29, 197, 107, 39, 133, 139, 2, 85, 247, 68, 141, 9, 14, 242, 89, 94, 221, 84,
-    216, 94, 134, 142, 17, 111, 60, 44, 108, 147, 147, 138, 125, 68, 41, 242, 14, 98, 172, 19, 103, 206, 211, 122, 152,
-    48, 134, 228, 221, 192, 56, 206, 52, 118, 67, 143, 228, 15, 133, 68, 11, 24, 41, 163, 16, 174, 242, 142, 186, 184,
-    239, 140, 28, 51, 10, 130, 102, 75, 2, 248, 66, 215, 108, 223, 159, 22, 24, 80, 196, 5, 151, 226, 157, 43, 3, 183,
-    162, 244, 10, 239, 223, 207, 12, 90, 92, 155, 20, 250, 51, 76, 66, 41, 86, 188, 28, 92, 171, 119, 192, 18, 62, 61,
-    67, 58, 12, 254, 44, 60, 215, 75, 9, 174, 35, 159, 178, 214, 91, 253, 8, 139, 190, 224, 122, 211, 4, 22, 121, 150,
-    51, 106, 27, 86, 207, 77, 129, 127, 19, 222, 59, 170, 162, 89, 43, 87, 73, 162, 133, 82, 96, 23, 129, 103, 235, 110,
-    19, 255, 150, 94, 51, 235, 180, 213, 20, 39, 22, 136, 19, 33, 209, 172, 44, 161, 102, 113, 201, 2, 155, 16, 180,
-    215, 178, 44, 46, 119, 169, 85, 60, 252, 14, 2, 228, 222, 164, 123, 116, 96, 240, 110, 243, 247, 49, 223, 45, 173,
-    173, 56, 56, 11, 119, 33, 5, 123, 182, 63, 43, 141, 241, 190, 225, 129, 88, 29, 120, 103, 175, 86, 235, 169, 1, 28,
-    189, 78, 93, 117, 103, 208, 15, 0, 151, 91, 57, 240, 15, 7, 45, 195, 69, 101, 174, 20, 31, 109, 173, 75, 47, 94, 36,
-    179, 149, 110, 209, 70, 147, 211, 222, 38, 173, 5, 45, 48, 218, 111, 47, 45, 63, 81, 64, 58, 169, 57, 97, 33, 196,
-    69, 27, 212, 232, 90, 219, 154, 48, 97, 71, 169, 70, 209, 160, 114, 28, 5, 96, 27, 154, 25, 182, 41, 23, 55, 39,
-    216, 60, 98, 21, 85, 235, 167, 242, 252, 165, 137, 72, 0, 147, 239, 235, 110, 131, 192, 33, 190, 41, 190, 170, 201,
-    12, 222, 100, 138, 119, 106, 104, 52, 125, 254, 195, 70, 2, 120, 121, 26, 201, 201, 176, 60, 38, 69, 48, 231, 51,
-    72, 119, 129, 124, 99, 40, 174, 202, 121, 150, 28, 79, 120, 206, 181, 111, 188, 161, 118, 1, 252, 210, 69, 180, 172,
-    198, 139, 224, 132, 184, 145, 40, 45, 147, 85, 212, 159, 141, 158, 254, 173, 235, 160, 23, 208, 238, 56, 162, 50,
-    128, 146, 207, 79, 100, 15, 170, 52, 254, 199, 137, 195, 166, 141, 58, 7, 127, 208, 90, 77, 123, 199, 141, 215, 173,
-    115, 249, 40, 178, 107, 220, 46, 56, 171, 198, 114, 183, 237, 122, 86, 30, 205, 28, 61, 23, 113, 190, 216, 150, 28,
-    44, 100, 13, 213, 40, 54, 76, 211, 223, 123, 110, 223, 124, 95, 24, 252, 249, 0, 207, 52, 244, 222, 16, 173, 213,
-    253, 38, 55, 171, 4, 211, 187, 48, 129, 27, 77, 147, 87, 62, 164, 214, 249, 184, 193, 178, 5, 22, 192, 35, 152, 147,
-    252, 198, 144, 241, 27, 195, 30, 250, 31, 38, 71, 184, 205, 80, 108, 222, 222, 180, 122, 86, 152, 68, 101, 45, 136,
-    154, 133, 101, 204, 174, 156, 57, 144, 235, 42, 112, 25, 48, 62, 153, 150, 28, 187, 144, 120, 66, 133, 171, 240,
-    173, 183, 126, 211, 94, 77, 67, 154, 206, 48, 117, 1, 149, 6, 221, 183, 181, 9, 232, 160, 51, 152, 114, 241, 106,
-    107, 162, 84, 221, 92, 210, 155, 154, 131, 44, 119, 246, 133, 60, 209, 74, 206, 174, 181, 189, 54, 5, 49, 12, 253,
-    134, 195, 222, 253, 139, 50, 29, 218, 238, 56, 147, 144, 65, 219, 134, 35, 3, 80, 88, 219, 39, 62, 234, 62, 108, 44,
-    95, 49, 171, 214, 1, 250, 160, 211, 33, 125, 155, 95, 11, 64, 96, 229, 243, 104, 125, 116, 184, 213, 109, 217, 224,
-    206, 123, 50, 180, 56, 221, 251, 236, 228, 159, 82, 62, 47, 52, 228, 110, 127, 153, 174, 227, 160, 100, 4, 105, 63,
-    29, 126, 12, 120, 72, 79, 74, 237, 165, 223, 242, 94, 223, 187, 213, 178, 225, 88, 142, 200, 170, 207, 83, 53, 103,
-    209, 92, 109, 55, 151, 234, 183, 62, 63, 23, 146, 159, 174, 233, 129, 128, 154, 162, 226, 100, 206, 235, 132, 58,
-    242, 93, 45, 108, 200, 194, 135, 249, 121, 65, 152, 100, 214, 195, 54, 98, 185, 151, 66, 171, 191, 60, 63, 112, 110,
-    121, 188, 24, 206, 30, 125, 133, 180, 94, 189, 25, 156, 18, 73, 76, 16, 30, 247, 239, 144, 116, 250, 215, 115, 144,
-    248, 177, 5, 160, 175, 210, 137, 213, 214, 65, 177, 238, 75, 225, 16, 39, 231, 28, 159, 167, 137, 164, 148, 133,
-    183, 94, 65, 238, 125, 209, 17, 78, 247, 235, 68, 0, 2, 28, 114, 181, 244, 116, 122, 149, 7, 230, 90, 252, 246, 255,
-    59, 11, 0, 188, 193, 185, 128, 177, 83, 14, 140, 8, 75, 56, 220, 224, 32, 52, 200, 165, 145, 91, 97, 232, 176, 196,
-    79, 41, 212, 50, 89, 108, 38, 209, 112, 21, 52, 103, 188, 210, 34, 72, 40, 84, 231, 203, 105, 246, 59, 50, 13, 155,
-    116, 145, 71, 175, 48, 24, 48, 14, 232, 45, 124, 66, 46, 201, 47, 29, 193, 18, 33, 109, 10, 189, 32, 214, 147, 16,
-    71, 232, 62, 167, 199, 4, 216, 130, 191, 203, 232, 220, 40, 49, 147, 170, 164, 136, 234, 77, 86, 172, 192, 136, 26,
-    194, 243, 117, 103, 242, 223, 156, 203, 242, 64, 42, 14, 12, 25, 224, 111, 106, 14, 192, 30, 125, 237, 52, 39, 141,
-    31, 31, 60, 60, 88, 96, 137, 192, 10, 41, 41, 217, 61, 206, 20, 254, 228, 182, 218, 144, 215, 136, 237, 100, 180,
-    173, 59, 238, 132, 103, 67, 192, 206, 119, 22, 56, 247, 99, 186, 125, 117, 53, 209, 206, 107, 136, 21, 167, 81, 117,
-    122, 56, 125, 249, 86, 43, 12, 129, 74, 0, 184, 112, 250, 26, 212, 84, 46, 171, 235, 95, 148, 56, 225, 31, 21, 255,
-    175, 198, 200, 127, 40, 97, 37, 227, 93, 56, 63, 162, 107, 2, 105, 178, 224, 71, 209, 109, 163, 204, 138, 188, 173,
-    199, 15, 255, 233, 139, 223, 84, 38, 156, 208, 18, 216, 243, 42, 254, 171, 137, 78, 117, 173, 1, 163, 83, 139, 6,
-    161, 215, 155, 23, 23, 86, 22, 68, 103, 97, 221, 19, 128, 130, 89, 237, 246, 213, 254, 19, 29, 21, 112, 122, 204,
-    125, 42, 52, 220, 60, 151, 30, 118, 131, 12, 102, 92, 71, 3, 224, 83, 48, 42, 59, 90, 170, 169, 127, 191, 41, 68,
-    210, 140, 202, 38, 70, 244, 145, 17, 151, 147, 198, 160, 141, 115, 211, 212, 165, 145, 196, 91, 121, 0, 153, 245,
-    72, 168, 193, 49, 186, 21, 226, 114, 68, 124, 19, 9, 108, 43, 163, 204, 5, 176, 10, 88, 109, 121, 6, 190, 247, 78,
-    189, 212, 46, 231, 30, 140, 106, 175, 130, 59, 194, 19, 138, 28, 244, 111, 190, 65, 203, 50, 211, 36, 32, 154, 23,
-    67, 121, 208, 119, 114, 123, 0, 243, 57, 166, 209, 83, 26, 203, 241, 17, 4, 61, 127, 183, 149, 44, 108, 9, 147, 215,
-    82, 242, 7, 124, 163, 106, 12, 160, 184, 185, 67, 227, 64, 114, 93, 198, 214, 224, 181, 202, 77, 84, 190, 249, 81,
-    235, 45, 135, 18, 193, 247, 240, 201, 170, 3, 141, 149, 124, 139, 66, 110, 61, 42, 137, 73, 217, 186, 23, 97, 80,
-    128, 44, 119, 227, 158, 105, 135, 34, 36, 6, 189, 4, 121, 185, 77, 11, 122, 6, 90, 104, 150, 157, 87, 244, 180, 56,
-    21, 36, 134, 144, 58, 175, 124, 201, 29, 3, 39, 34, 243, 5, 182, 41, 66, 185, 247, 5, 10, 154, 24, 198, 101, 31,
-    107, 70, 115, 130, 37, 166, 77, 242, 57, 2, 77, 168, 64, 174, 193, 240, 191, 113, 183, 38, 164, 62, 12, 115, 123,
-    204, 26, 173, 129, 33, 23, 129, 55, 1, 99, 105, 56, 156, 192, 113, 55, 58, 221, 129, 69, 124, 78, 173, 111, 77, 229,
-    59, 232, 85, 105, 82, 166, 64, 226, 8, 98, 205, 5, 181, 11, 208, 140, 213, 38, 44, 244, 146, 62, 95, 85, 21, 70, 54,
-    118, 204, 12, 230, 24, 149, 146, 145, 62, 55, 226, 159, 211, 18, 48, 114, 15, 36, 88, 207, 242, 177, 46, 167, 108,
-    14, 188, 116, 70, 57, 153, 86, 2, 27, 249, 134, 3, 27, 113, 193, 248, 85, 93, 218, 84, 123, 254, 249, 241, 111, 74,
-    88, 147, 82, 64, 92, 196, 102, 180, 188, 203, 41, 26, 158, 230, 249, 120, 129, 138, 184, 42, 19, 221, 65, 70, 248,
-    99, 140, 98, 153, 250, 0, 151, 190, 20, 99, 127, 170, 205, 97, 146, 104, 111, 59, 60, 101, 240, 134, 216, 95, 208,
-    200, 0, 248, 95, 52, 217, 204, 92, 238, 247, 32, 158, 183, 153, 40, 112, 36, 154, 14, 207, 106, 223, 60, 16, 35, 68,
-    103, 187, 119, 159, 145, 124, 177, 173, 181, 227, 99, 184, 127, 245, 221, 47, 14, 135, 204, 183, 185, 175, 188, 184,
-    25, 209, 115, 246, 44, 72, 64, 16, 172, 170, 108, 64, 108, 219, 35, 192, 233, 63, 7, 88, 17, 174, 29, 48, 194, 119,
-    125, 12, 17, 26, 82, 50, 88, 53, 55, 180, 200, 20, 97, 228, 17, 23, 10, 238, 208, 217, 189, 46, 92, 253, 63, 86, 7,
-    215, 234, 98, 93, 132, 81, 98, 151, 47, 92, 83, 50, 144, 184, 101, 192, 25, 215, 85, 95, 223, 197, 191, 138, 223,
-    136, 222, 11, 162, 99, 75, 70, 77, 180, 221, 85, 241, 33, 174, 125, 249, 147, 168, 31, 0, 197, 252, 173, 108, 29,
-    95, 69, 68, 75, 62, 52, 100, 225, 108, 125, 66, 150, 184, 104, 75, 168, 45, 167, 170, 26, 101, 64, 83, 128, 48, 114,
-    156, 82, 25, 223, 195, 100, 232, 148, 19, 52, 166, 105, 137, 136, 240, 82, 97, 101, 233, 239, 223, 178, 23, 11, 248,
-    251, 102, 147, 250, 172, 169, 159, 152, 221, 83, 70, 188, 175, 232, 108, 5, 26, 203, 1, 247, 101, 254, 236, 111,
-    115, 31, 241, 125, 223, 8, 155, 179, 20, 220, 85, 249, 243, 108, 159, 62, 227, 179, 34, 46, 239, 157, 27, 220, 43,
-    5, 70, 130, 147, 94, 229, 39, 184, 76, 223, 224, 248, 240, 136, 203, 22, 186, 4, 68, 195, 88, 222, 23, 248, 96, 131,
-    95, 173, 101, 225, 198, 213, 17, 184, 252, 196, 219, 157, 223, 28, 79, 4, 173, 217, 239, 193, 154, 157, 78, 148,
-    237, 94, 1, 180, 240, 100, 114, 153, 197, 115, 14, 147, 61, 179, 250, 169, 156, 113, 139, 181, 138, 245, 32, 124,
-    80, 123, 32, 36, 100, 196, 215, 50, 162, 192, 80, 215, 194, 183, 160, 229, 65, 203, 33, 28, 137, 203, 188, 203, 2,
-    1, 32, 10, 66, 52, 227, 132, 18, 116, 107, 179, 79, 103, 48, 71, 5, 22, 80, 147, 144, 72, 251, 100, 95, 88, 139, 99,
-    151, 209, 0, 24, 217, 13, 56, 33, 66, 250, 228, 106, 77, 42, 28, 91, 85, 174, 76, 139, 238, 249, 139, 201, 213, 46,
-    156, 47, 45, 170, 122, 110, 205, 188, 237, 13, 99, 87, 252, 188, 96, 170, 90, 250, 177, 74, 66, 255, 240, 3, 225,
-    94, 253, 34, 230, 197, 102, 210, 233, 137, 219, 67, 108, 8, 77, 222, 192, 118, 37, 131, 13, 32, 38, 122, 248, 193,
-    20, 222, 7, 200, 135, 255, 19, 20, 80, 42, 205, 103, 129, 88, 43, 253, 183, 142, 123, 12, 67, 117, 13, 99, 231, 246,
-    22, 218, 255, 162, 81, 234, 121, 83, 54, 100, 21, 225, 163, 134, 233, 91, 92, 230, 70, 190, 195, 250, 249, 247, 81,
-    77, 128, 241, 7, 148, 159, 7, 213, 97, 49, 106, 107, 87, 198, 206, 168, 178, 82, 47, 79, 97, 37, 235, 220, 80, 73,
-    122, 34, 220, 139, 70, 128, 226, 243, 219, 225, 120, 104, 171, 251, 207, 22, 98, 197, 253, 30, 104, 205, 243, 151,
-    250, 169, 82, 98, 52, 108, 199, 164, 222, 11, 149, 201, 145, 128, 150, 28, 107, 3, 89, 242, 25, 23, 137, 255, 175,
-    62, 50, 168, 132, 137, 106, 11, 90, 112, 177, 37, 217, 148, 154, 6, 77, 100, 4, 114, 1, 88, 113, 150, 44, 135, 147,
-    73, 194, 44, 184, 187, 153, 214, 252, 216, 200, 212, 21, 93, 81, 156, 28, 9, 40, 151, 119, 215, 120, 224, 217, 34,
-    51, 21, 32, 229, 126, 9, 174, 64, 76, 136, 250, 41, 92, 139, 182, 178, 36, 168, 125, 183, 187, 206, 166, 203, 116,
-    231, 35, 135, 222, 22, 16, 23, 110, 247, 130, 198, 253, 51, 190, 244, 56, 214, 124, 55, 24, 127, 16, 39, 169, 211,
-    80, 233, 247, 179, 240, 189, 192, 249, 149, 213, 176, 152, 124, 63, 100, 101, 192, 2, 254, 129, 187, 199, 123, 1,
-    180, 1, 234, 18, 193, 135, 89, 135, 1, 7, 219, 85, 107, 142, 108, 176, 87, 114, 3, 246, 158, 24, 63, 188, 221, 140,
-    184, 151, 75, 227, 182, 97, 10, 21, 26, 192, 156, 227, 126, 40, 126, 220, 178, 220, 87, 79, 63, 122, 73, 85, 54,
-    189, 125, 67, 214, 182, 128, 54, 14, 96, 66, 223, 53, 67, 140, 149, 103, 156, 157, 33, 118, 32, 34, 204, 19, 28,
-    219, 129, 77, 148, 61, 208, 119, 44, 202, 80, 110, 247, 172, 169, 120, 227, 214, 31, 178, 37, 123, 244, 112, 158,
-    176, 141, 16, 242, 241, 127, 114, 0, 142, 115, 89, 14, 72, 161, 135, 106, 188, 124, 183, 55, 64, 196, 186, 50, 33,
-    59, 1, 234, 64, 168, 4, 204, 81, 78, 238, 49, 17, 5, 124, 131, 92, 60, 210, 179, 155, 25, 38, 143, 141, 122, 167,
-    236, 92, 185, 187, 104, 88, 164, 222, 8, 254, 158, 222, 96, 179, 80, 82, 252, 70, 113, 182, 200, 48, 188, 33, 19,
-    10, 217, 183, 125, 201, 85, 2, 42, 2, 126, 70, 25, 213, 83, 207, 77, 140, 189, 35, 154, 153, 244, 197, 77, 118, 5,
-    241, 69, 242, 4, 191, 239, 133, 52, 157, 134, 188, 10, 220, 74, 46, 83, 232, 101, 112, 61, 113, 137, 134, 192, 120,
-    151, 44, 211, 154, 89, 144, 46, 149, 70, 102, 33, 227, 173, 64, 167, 43, 100, 180, 154, 55, 55, 180, 90, 37, 149,
-    14, 99, 48, 39, 71, 77, 71, 85, 119, 224, 183, 63, 97, 64, 213, 107, 94, 78, 109, 245, 60, 25, 217, 235, 83, 229,
-    171, 18, 51, 186, 112, 17, 90, 139, 55, 8, 9, 172, 186, 4, 111, 245, 129, 140, 205, 75, 99, 220, 236, 7, 159, 135,
-    22, 139, 64, 20, 133, 19, 93, 205, 95, 11, 209, 205, 140, 162, 16, 63, 189, 12, 12, 33, 146, 238, 178, 140, 100, 44,
-    27, 235, 116, 22, 106, 116, 145, 174, 80, 179, 212, 145, 84, 60, 103, 33, 174, 152, 104, 78, 14, 170, 154, 28, 116,
-    10, 148, 158, 139, 71, 144, 106, 54, 2, 235, 69, 63, 89, 108, 46, 0, 225, 6, 177, 110, 77, 67, 254, 14, 192, 33,
-    237, 172, 193, 101, 113, 118, 48, 246, 181, 189, 227, 16, 113, 183, 189, 41, 177, 153, 170, 250, 166, 237, 151, 65,
-    197, 67, 75, 229, 113, 36, 143, 233, 212, 110, 55, 146, 14, 54, 109, 67, 187, 194, 106, 0, 4, 243, 156, 94, 166,
-    110, 173, 120, 147, 49, 94, 124, 65, 177, 67, 181, 122, 239, 155, 27, 149, 226, 124, 232, 37, 97, 103, 114, 109,
-    131, 0, 65, 166, 183, 39, 220, 175, 83, 76, 0, 114, 58, 2, 3, 182, 162, 109, 175, 79, 64, 128, 191, 243, 81, 211,
-    188, 235, 44, 221, 200, 123, 241, 49, 91, 51, 4, 55, 192, 5, 65, 95, 215, 103, 110, 36, 30, 134, 42, 253, 225, 88,
-    84, 142, 39, 90, 6, 221, 198, 199, 23, 20, 116, 184, 201, 37, 27, 78, 233, 136, 62, 141, 130, 164, 234, 165, 195,
-    155, 62, 122, 120, 20, 233, 109, 179, 120, 193, 111, 198, 153, 181, 103, 201, 0, 56, 52, 241, 48, 191, 119, 136, 76,
-    137, 210, 231, 26, 87, 56, 249, 62, 246, 126, 64, 104, 17, 16, 23, 248, 23, 212, 131, 172, 201, 4, 239, 138, 36,
-    215, 240, 212, 146, 109, 125, 72, 221, 192, 41, 3, 240, 85, 82, 81, 163, 209, 177, 245, 164, 151, 88, 21, 251, 241,
-    52, 203, 170, 100, 31, 159, 111, 76, 0, 161, 32, 214, 216, 112, 93, 157, 151, 134, 118, 212, 74, 58, 84, 159, 5,
-    121, 176, 138, 185, 213, 135, 50, 110, 253, 13, 117, 99, 164, 104, 66, 160, 48, 96, 100, 79, 8, 19, 194, 109, 172,
-    68, 251, 105, 43, 236, 110, 19, 120, 182, 30, 79, 232, 19, 137, 77, 177, 130, 45, 112, 206, 30, 19, 155, 188, 126,
-    89, 140, 104, 15, 66, 191, 121, 219, 172, 95, 194, 102, 146, 44, 103, 191, 113, 10, 133, 200, 220, 238, 92, 81, 210,
-    219, 167, 29, 239, 140, 210, 192, 31, 61, 78, 131, 175, 189, 237, 188, 231, 68, 196, 36, 9, 213, 4, 76, 154, 195,
-    231, 205, 50, 24, 37, 217, 50, 234, 236, 115, 20, 52, 223, 249, 238, 251, 152, 67, 139, 7, 91, 36, 208, 52, 38, 234,
-    125, 17, 143, 30, 198, 13, 201, 209, 55, 113, 231, 48, 187, 102, 190, 38, 37, 78, 175, 61, 110, 99, 12, 14, 124,
-    212, 195, 64, 110, 126, 111, 236, 238, 175, 193, 34, 228, 105, 49, 9, 168, 106, 136, 191, 181, 3, 214, 167, 203, 98,
-    185, 175, 244, 142, 104, 120, 174, 157, 162, 239, 108, 7, 28, 220, 31, 118, 213, 241, 238, 108, 167, 8, 129, 100,
-    56, 81, 202, 122, 106, 18, 143, 77, 31, 244, 215, 117, 32, 11, 88, 43, 203, 135, 179, 78, 210, 239, 244, 160, 120,
-    241, 147, 33, 157, 87, 114, 13, 246, 79, 61, 180, 150, 197, 39, 219, 222, 191, 168, 149, 169, 102, 53, 192, 37, 175,
-    164, 53, 3, 219, 86, 85, 119, 6, 150, 147, 33, 177, 28, 120, 16, 42, 241, 160, 72, 106, 172, 247, 130, 207, 114,
-    253, 108, 10, 203, 114, 212, 11, 245, 17, 8, 32, 41, 44, 69, 231, 0, 156, 31, 105, 72, 205, 110, 30, 69, 221, 121,
-    205, 123, 70, 48, 211, 239, 161, 211, 173, 50, 179, 128, 67, 162, 210, 15, 0, 125, 170, 105, 71, 250, 176, 8, 49,
-    211, 247, 245, 62, 74, 116, 75, 176, 45, 24, 85, 156, 139, 77, 211, 32, 94, 228, 176, 222, 47, 241, 195, 5, 24, 89,
-    28, 82, 238, 174, 216, 52, 86, 89, 219, 226, 111, 25, 171, 122, 213, 190, 135, 90, 38, 6, 118, 140, 18, 120, 109,
-    40, 78, 209, 106, 40, 33, 98, 210, 67, 124, 26, 42, 181, 243, 55, 143, 27, 70, 180, 196, 227, 159, 211, 19, 29, 131,
-    30, 135, 249, 157, 49, 183, 18, 138, 90, 91, 193, 120, 175, 209, 134, 220, 27, 227, 165, 202, 137, 201, 132, 155,
-    144, 13, 33, 29, 89, 188, 116, 215, 229, 132, 241, 5, 31, 68, 72, 23, 7, 28, 181, 138, 87, 58, 53, 250, 1, 140, 40,
-    102, 251, 51, 189, 96, 134, 148, 7, 245, 194, 106, 228, 10, 166, 88, 94, 244, 221, 85, 230, 90, 152, 254, 161, 205,
-    152, 140, 139, 68, 116, 211, 74, 204, 149, 36, 41, 241, 169, 39, 56, 197, 140, 166, 112, 10, 181, 20, 160, 85, 119,
-    24, 66, 191, 158, 242, 59, 202, 188, 65, 105, 250, 155, 45, 149, 188, 184, 139, 164, 158, 253, 202, 99, 61, 230,
-    200, 16, 109, 227, 43, 109, 69, 52, 96, 76, 53, 133, 76, 47, 255, 163, 225, 71, 217, 65, 88, 224, 115, 67, 146, 255,
-    100, 173, 233, 94, 135, 146, 209, 185, 160, 206, 4, 45, 21, 200, 211, 127, 159, 21, 177, 204, 1, 53, 128, 180, 164,
-    15, 121, 4, 216, 106, 8, 92, 228, 28, 164, 246, 245, 45, 198, 76, 208, 178, 155, 86, 190, 71, 127, 198, 190, 151,
-    127, 214, 48, 45, 81, 117, 254, 48, 82, 2, 207, 79, 124, 68, 135, 243, 175, 38, 74, 57, 191, 156, 93, 229, 64, 206,
-    163, 24, 214, 89, 223, 175, 175, 188, 82, 60, 111, 168, 236, 49, 127, 46, 141, 239, 81, 255, 4, 33, 45, 231, 158,
-    253, 216, 40, 106, 241, 144, 57, 82, 77, 61, 160, 112, 213, 123, 107, 33, 8, 29, 245, 124, 84, 90, 232, 19, 62, 228,
-    58, 59, 86, 176, 151, 216, 188, 14, 24, 100, 133, 23, 118, 35, 71, 227, 98, 240, 168, 214, 0, 152, 178, 18, 36, 119,
-    118, 154, 180, 139, 9, 40, 154, 230, 69, 224, 175, 104, 134, 221, 132, 167, 115, 92, 5, 182, 22, 33, 251, 24, 88,
-    61, 230, 219, 210, 218, 240, 228, 111, 115, 145, 170, 16, 122, 149, 100, 145, 29, 163, 80, 59, 157, 212, 143, 200,
-    113, 105, 136, 14, 139, 142, 160, 203, 25, 185, 135, 147, 231, 155, 143, 175, 83, 32, 125, 247, 214, 228, 30, 169,
-    228, 100, 98, 31, 92, 89, 177, 73, 246, 13, 61, 133, 197, 246, 237, 75, 0, 36, 190, 59, 43, 200, 148, 142, 43, 215,
-    117, 187, 144, 38, 234, 4, 104, 222, 85, 163, 251, 10, 150, 232, 10, 151, 191, 228, 62, 100, 58, 155, 178, 125, 195,
-    149, 174, 48, 134, 101, 231, 126, 55, 159, 169, 216, 87, 188, 253, 216, 160, 187, 202, 121, 103, 244, 119, 238, 49,
-    64, 145, 111, 216, 204, 82, 161, 26, 133, 243, 17, 253, 27, 176, 44, 206, 64, 140, 89, 254, 185, 167, 1, 246, 88, 7,
-    249, 217, 78, 245, 80, 104, 27, 105, 118, 13, 189, 68, 88, 42, 13, 66, 63, 77, 170, 125, 13, 225, 191, 2, 172, 82,
-    182, 41, 209, 71, 134, 110, 26, 216, 236, 177, 12, 227, 86, 165, 16, 244, 254, 109, 180, 124, 124, 162, 89, 193,
-    207, 230, 40, 247, 155, 83, 238, 26, 3, 9, 208, 10, 199, 225, 100, 192, 114, 86, 152, 70, 93, 155, 172, 112, 192,
-    29, 144, 180, 125, 108, 19, 23, 32, 245, 143, 77, 156, 155, 253, 134, 213, 85, 47, 254, 125, 121, 220, 173, 237, 12,
-    82, 193, 69, 51, 164, 58, 70, 115, 96, 138, 251, 215, 116, 75, 2, 179, 241, 172, 233, 22, 89, 154, 97, 191, 108, 27,
-    203, 151, 157, 39, 52, 216, 40, 72, 83, 225, 229, 201, 210, 127, 168, 92, 255, 2, 69, 28, 249, 210, 226, 174, 215,
-    102, 253, 160, 190, 86, 199, 42, 130, 93, 119, 186, 102, 82, 46, 4, 237, 236, 89, 91, 241, 124, 178, 238, 189, 133,
-    146, 199, 180, 87, 58, 220, 232, 207, 151, 58, 198, 80, 146, 67, 49, 108, 145, 234, 53, 190, 2, 160, 245, 221, 175,
-    39, 12, 232, 144, 176, 216, 79, 179, 237, 9, 101, 61, 58, 167, 123, 169, 135, 167, 236, 111, 249, 119, 200, 175, 86,
-    194, 42, 18, 216, 213, 159, 103, 244, 58, 91, 35, 72, 14, 242, 16, 224, 157, 59, 25, 210, 212, 79, 37, 195, 142,
-    141, 145, 242, 146, 215, 198, 171, 155, 16, 44, 245, 37, 86, 220, 169, 149, 227, 237, 39, 241, 222, 83, 231, 155,
-    214, 90, 35, 215, 2, 117, 40, 97, 92, 82, 73, 191, 38, 13, 36, 120, 109, 161, 194, 126, 228, 192, 94, 40, 184, 193,
-    80, 47, 41, 20, 107, 28, 171, 82, 26, 48, 68, 92, 58, 49, 178, 68, 178, 207, 176, 182, 207, 72, 169, 4, 16, 170,
-    134, 51, 106, 126, 63, 160, 146, 170, 99, 69, 163, 186, 222, 50, 242, 19, 174, 37, 109, 137, 20, 25, 66, 44, 163,
-    94, 103, 225, 74, 40, 73, 244, 77, 232, 79, 222, 70, 118, 189, 183, 57, 49, 53, 231, 67, 46, 252, 10, 204, 35, 40,
-    178, 69, 49, 215, 84, 14, 31, 163, 229, 6, 138, 33, 112, 0, 244, 135, 93, 253, 70, 195, 240, 56, 156, 214, 240, 98,
-    80, 122, 86, 230, 211, 31, 41, 238, 237, 77, 26, 57, 235, 56, 52, 164, 232, 60, 34, 138, 173, 254, 55, 36, 64, 48,
-    180, 202, 136, 113, 174, 153, 225, 175, 120, 156, 157, 252, 103, 136, 202, 24, 36, 240, 33, 128, 93, 103, 38, 181,
-    85, 29, 171, 225, 78, 225, 240, 184, 102, 118, 67, 146, 171, 82, 26, 170, 162, 6, 107, 177, 70, 71, 197, 45, 21,
-    230, 54, 69, 224, 230, 130, 89, 175, 120, 214, 48, 101, 253, 172, 136, 137, 252, 71, 109, 221, 197, 180, 53, 230,
-    113, 53, 123, 214, 183, 155, 241, 39, 71, 35, 249, 107, 146, 123, 72, 66, 163, 214, 81, 208, 186, 69, 49, 1, 129,
-    24, 226, 74, 26, 220, 228, 105, 226, 214, 182, 4, 158, 135, 156, 182, 177, 14, 26, 47, 78, 237, 233, 196, 93, 133,
-    55, 26, 242, 61, 67, 55, 141, 230, 246, 243, 243, 37, 212, 240, 96, 229, 74, 98, 95, 53, 61, 182, 3, 28, 93, 199,
-    220, 87, 222, 78, 18, 37, 189, 19, 237, 167, 42, 51, 89, 19, 182, 69, 93, 232, 188, 186, 24, 50, 16, 215, 167, 37,
-    38, 89, 237, 126, 245, 42, 234, 77, 40, 129, 130, 47, 19, 94, 54, 64, 222, 182, 36, 156, 162, 242, 246, 249, 169,
-    174, 50, 211, 97, 218, 236, 120, 77, 207, 217, 160, 75, 110, 244, 5, 204, 143, 121, 218, 236, 97, 0, 110, 117, 225,
-    167, 108, 8, 66, 162, 246, 206, 193, 114, 5, 249, 63, 75, 53, 5, 29, 191, 108, 150, 192, 21, 81, 154, 138, 49, 241,
-    90, 203, 8, 231, 220, 1, 174, 249, 75, 205, 8, 187, 27, 248, 122, 52, 255, 203, 191, 135, 245, 181, 216, 77, 102,
-    126, 96, 128, 79, 72, 164, 16, 93, 254, 202, 120, 242, 26, 220, 37, 39, 206, 49, 153, 143, 145, 183, 193, 181, 170,
-    251, 157, 151, 189, 134, 28, 139, 31, 148, 210, 39, 26, 190, 56, 100, 212, 129, 177, 98, 9, 42, 64, 235, 178, 205,
-    46, 156, 199, 199, 73, 1, 75, 163, 64, 252, 41, 16, 47, 102, 9, 229, 190, 241, 185, 52, 98, 129, 143, 3, 162, 86,
-    28, 224, 55, 231, 239, 211, 159, 252, 121, 223, 210, 149, 108, 229, 215, 194, 237, 110, 207, 45, 65, 7, 1, 88, 170,
-    129, 196, 148, 67, 65, 49, 230, 118, 1, 237, 72, 16, 28, 187, 63, 62, 35, 241, 119, 133, 200, 186, 131, 183, 51,
-    216, 130, 230, 13, 238, 46, 87, 141, 237, 215, 58, 69, 236, 92, 41, 75, 164, 182, 69, 20, 129, 76, 134, 174, 162,
-    70, 58, 125, 252, 97, 189, 152, 81, 225, 254, 229, 155, 218, 203, 132, 223, 53, 137, 40, 82, 46, 23, 25, 231, 146,
-    232, 142, 150, 21, 162, 174, 118, 141, 124, 127, 38, 2, 137, 0, 219, 181, 82, 222, 226, 169, 23, 28, 45, 226, 167,
-    38, 157, 195, 68, 91, 28, 105, 220, 87, 249, 47, 78, 187, 29, 95, 212, 54, 144, 163, 104, 121, 119, 129, 254, 44,
-    219, 98, 18, 50, 24, 100, 21, 252, 11, 144, 182, 17, 3, 164, 193, 116, 68, 112, 105, 53, 101, 13, 79, 206, 46, 12,
-    122, 96, 106, 2, 126, 200, 128, 39, 241, 6, 153, 200, 240, 4, 221, 50, 33, 39, 129, 225, 165, 59, 221, 197, 33, 139,
-    151, 6, 81, 119, 125, 108, 248, 247, 206, 157, 128, 60, 36, 15, 197, 39, 185, 10, 206, 162, 45, 221, 131, 206, 41,
-    239, 91, 6, 140, 25, 238, 107, 155, 142, 194, 110, 242, 163, 215, 33, 233, 146, 229, 131, 128, 179, 154, 93, 91,
-    166, 210, 27, 32, 218, 68, 131, 29, 30, 108, 138, 234, 42, 99, 120, 42, 196, 110, 129, 94, 197, 70, 215, 121, 113,
-    34, 167, 183, 85, 231, 196, 226, 220, 101, 2, 109, 150, 235, 143, 226, 41, 141, 223, 70, 151, 199, 151, 41, 88, 205,
-    132, 139, 107, 88, 99, 134, 182, 85, 92, 32, 211, 98, 30, 124, 112, 16, 231, 213, 189, 40, 54, 236, 46, 76, 155,
-    172, 198, 53, 146, 191, 124, 126, 74, 110, 35, 225, 162, 100, 210, 121, 78, 233, 2, 171, 33, 76, 158, 38, 237, 198,
-    115, 211, 14, 38, 138, 151, 251, 36, 31, 106, 5, 136, 39, 236, 153, 247, 236, 11, 215, 189, 197, 43, 26, 170, 176,
-    191, 207, 111, 89, 30, 6, 111, 117, 160, 54, 129, 71, 96, 72, 98, 120, 190, 223, 86, 239, 182, 120, 43, 249, 20, 69,
-    199, 46, 49, 189, 72, 250, 106, 157, 176, 114, 104, 248, 117, 198, 192, 180, 111, 203, 192, 230, 145, 180, 131, 178,
-    172, 28, 132, 181, 135, 23, 237, 85, 25, 138, 29, 75, 194, 87, 5, 72, 3, 25, 167, 61, 204, 58, 150, 40, 140, 232,
-    51, 108, 162, 195, 117, 59, 129, 253, 85, 50, 178, 214, 38, 251, 78, 55, 139, 154, 153, 15, 98, 189, 133, 66, 175,
-    18, 111, 200, 248, 152, 159, 67, 97, 53, 179, 84, 205, 68, 208, 12, 250, 221, 24, 179, 152, 73, 75, 126, 57, 243,
-    55, 84, 183, 187, 101, 25, 48, 69, 99, 186, 7, 250, 240, 162, 145, 151, 137, 202, 118, 249, 40, 235, 72, 234, 19,
-    204, 7, 57, 230, 11, 34, 5, 92, 237, 185, 217, 83, 119, 111, 117, 84, 110, 129, 243, 240, 224, 73, 93, 183, 104, 4,
-    74, 232, 17, 15, 101, 161, 89, 92, 188, 225, 153, 246, 236, 104, 75, 119, 42, 24, 62, 0, 223, 230, 67, 201, 118,
-    117, 145, 72, 55, 70, 87, 121, 43, 33, 109, 191, 86, 169, 59, 52, 5, 159, 179, 221, 243, 154, 237, 214, 146, 231,
-    116, 48, 250, 104, 141, 44, 120, 97, 166, 170, 120, 131, 225, 49, 252, 251, 135, 190, 198, 1, 171, 126, 50, 176,
-    222, 87, 231, 134, 29, 50, 167, 87, 113, 102, 17, 155, 219, 24, 211, 11, 115, 9, 161, 247, 83, 78, 32, 94, 206, 237,
-    144, 118, 236, 129, 134, 198, 87, 219, 232, 99, 48, 37, 41, 162, 163, 150, 164, 102, 69, 20, 127, 28, 114, 28, 196,
-    175, 9, 193, 35, 90, 147, 248, 191, 194, 47, 7, 247, 39, 137, 102, 144, 71, 68, 139, 6, 22, 121, 235, 64, 142, 162,
-    166, 151, 215, 192, 240, 33, 127, 33, 203, 225, 136, 33, 13, 105, 156, 43, 74, 28, 36, 152, 239, 126, 168, 77, 131,
-    163, 57, 113, 65, 14, 168, 117, 93, 185, 35, 150, 239, 223, 168, 125, 66, 233, 207, 32, 86, 244, 199, 4, 182, 138,
-    192, 1, 187, 114, 108, 147, 12, 92, 183, 250, 251, 145, 248, 76, 86, 244, 2, 88, 67, 215, 65, 252, 94, 206, 109,
-    241, 66, 49, 73, 140, 119, 51, 194, 179, 125, 47, 30, 142, 26, 88, 3, 204, 57, 70, 124, 218, 48, 181, 254, 243, 248,
-    111, 254, 244, 63, 75, 225, 26, 222, 61, 152, 173, 244, 85, 182, 104, 192, 59, 138, 61, 41, 51, 190, 207, 170, 25,
-    114, 82, 137, 17, 189, 250, 21, 80, 118, 7, 250, 71, 226, 33, 35, 75, 9, 146, 58, 134, 135, 166, 36, 244, 30, 147,
-    197, 104, 68, 14, 163, 29, 61, 103, 126, 114, 169, 111, 151, 156, 3, 217, 107, 40, 208, 92, 50, 23, 211, 214, 76,
-    98, 91, 171, 4, 179, 60, 163, 174, 234, 129, 43, 48, 107, 244, 251, 213, 222, 75, 56, 183, 97, 170, 70, 203, 215,
-    192, 88, 83, 223, 223, 158, 212, 249, 37, 16, 144, 27, 164, 75, 182, 169, 93, 219, 123, 180, 83, 164, 89, 134, 94,
-    130, 49, 123, 120, 254, 255, 225, 59, 223, 167, 31, 192, 40, 97, 154, 190, 14, 255, 214, 168, 191, 244, 182, 233,
-    162, 189, 163, 207, 190, 94, 175, 249, 69, 81, 31, 71, 61, 70, 209, 117, 49, 31, 16, 188, 75, 166, 204, 94, 181, 36,
-    90, 115, 234, 103, 133, 32, 187, 228, 232, 123, 220, 247, 218, 170, 129, 215, 239, 217, 205, 4, 4, 67, 183, 30, 104,
-    126, 52, 99, 186, 236, 102, 160, 196, 139, 37, 64, 138, 79, 163, 168, 150, 25, 29, 13, 96, 82, 39, 171, 196, 49,
-    100, 219, 236, 234, 139, 158, 203, 107, 86, 53, 146, 73, 72, 45, 144, 120, 111, 168, 93, 167, 38, 133, 53, 78, 248,
-    160, 12, 39, 228, 23, 158, 232, 212, 233, 9, 118, 221, 147, 32, 14, 126, 235, 237, 108, 187, 36, 86, 190, 14, 245,
-    243, 246, 111, 6, 113, 81, 179, 152, 75, 30, 132, 136, 182, 21, 208, 191, 59, 149, 150, 234, 193, 177, 103, 214,
-    146, 172, 199, 180, 176, 252, 154, 105, 92, 210, 246, 98, 162, 55, 188, 249, 28, 222, 54, 120, 60, 162, 140, 135,
-    36, 92, 250, 135, 3, 130, 182, 119, 24, 71, 243, 43, 18, 207, 242, 24, 67, 176, 157, 116, 42, 160, 20, 225, 224,
-    147, 47, 216, 12, 3, 103, 124, 77, 65, 136, 54, 22, 160, 178, 124, 67, 108, 219, 253, 30, 186, 219, 148, 87, 130,
-    82, 19, 60, 225, 234, 91, 2, 238, 104, 249, 176, 123, 138, 180, 99, 164, 109, 54, 194, 174, 71, 82, 39, 76, 133,
-    205, 175, 239, 61, 244, 15, 246, 86, 169, 4, 111, 244, 115, 237, 61, 109, 157, 226, 62, 83, 105, 186, 168, 194, 0,
-    248, 181, 173, 26, 115, 129, 204, 183, 85, 254, 72, 56, 242, 86, 53, 164, 116, 137, 64, 130, 15, 172, 116, 204, 206,
-    205, 220, 210, 38, 248, 170, 153, 24, 252, 153, 38, 236, 12, 17, 94, 230, 169, 63, 106, 205, 123, 85, 86, 119, 177,
-    217, 206, 31, 177, 202, 13, 179, 11, 112, 58, 30, 236, 216, 170, 18, 25, 41, 37, 90, 177, 30, 62, 170, 41, 104, 189,
-    250, 204, 63, 60, 102, 0, 240, 135, 182, 242, 187, 176, 137, 91, 36, 124, 107, 8, 173, 79, 194, 8, 46, 111, 191, 60,
-    224, 188, 98, 76, 250, 104, 163, 26, 32, 35, 97, 158, 106, 240, 101, 204, 244, 154, 181, 102, 69, 193, 127, 190,
-    251, 91, 33, 221, 54, 246, 187, 44, 82, 69, 131, 213, 105, 127, 75, 172, 115, 162, 171, 175, 78, 160, 245, 50, 76,
-    50, 2, 89, 49, 239, 85, 85, 84, 119, 105, 216, 173, 233, 13, 140, 26, 3, 194, 199, 225, 25, 209, 31, 80, 23, 237,
-    252, 133, 46, 156, 32, 84, 37, 7, 241, 65, 118, 88, 212, 240, 181, 161, 16, 11, 5, 238, 228, 2, 158, 75, 43, 80, 82,
-    74, 120, 7, 5, 26, 197, 246, 38, 144, 187, 40, 10, 237, 46, 107, 37, 44, 98, 81, 169, 99, 33, 77, 126, 86, 213, 95,
-    39, 139, 131, 164, 1, 44, 110, 190, 32, 203, 34, 65, 238, 117, 13, 251, 159, 20, 200, 196, 110, 243, 143, 102, 99,
-    57, 141, 247, 7, 190, 12, 160, 75, 253, 165, 52, 227, 176, 69, 183, 195, 161, 120, 228, 39, 198, 99, 225, 175, 154,
-    8, 12, 131, 97, 189, 125, 120, 145, 188, 225, 112, 39, 186, 183, 199, 40, 151, 226, 247, 222, 33, 223, 65, 108, 7,
-    57, 63, 247, 141, 199, 190, 137, 31, 222, 153, 180, 60, 43, 50, 107, 169, 52, 25, 58, 213, 229, 63, 10, 150, 181,
-    167, 93, 167, 104, 142, 58, 217, 3, 193, 15, 69, 20, 16, 133, 234, 71, 42, 241, 181, 144, 126, 201, 193, 134, 103,
-    203, 241, 174, 130, 82, 169, 227, 158, 95, 129, 123, 104, 47, 109, 91, 252, 117, 105, 89, 179, 246, 162, 157, 215,
-    172, 3, 154, 124, 253, 77, 211, 198, 198, 117, 138, 225, 170, 211, 170, 134, 77, 62, 255, 212, 130, 235, 203, 86,
-    223, 60, 141, 234, 126, 82, 68, 104, 14, 198, 87, 75, 220, 129, 56, 113, 150, 8, 44, 180, 195, 63, 6, 172, 61, 178,
-    23, 215, 237, 151, 29, 10, 13, 229, 160, 224, 226, 150, 184, 208, 50, 80, 243, 176, 18, 239, 240, 29, 175, 20, 212,
-    187, 2, 145, 113, 154, 69, 104, 247, 25, 205, 173, 193, 156, 20, 98, 214, 136, 156, 66, 115, 21, 183, 237, 186, 39,
-    190, 9, 25, 93, 216, 225, 91, 122, 154, 92, 227, 108, 198, 186, 210, 159, 172, 172, 149, 140, 11, 10, 39, 237, 61,
-    30, 39, 201, 26, 65, 48, 56, 82, 201, 117, 254, 21, 58, 181, 89, 54, 162, 152, 103, 245, 86, 212, 157, 198, 33, 106,
-    117, 89, 9, 92, 221, 50, 53, 177, 83, 204, 28, 207, 204, 52, 46, 32, 171, 228, 151, 53, 209, 235, 248, 30, 195, 42,
-    97, 140, 56, 170, 207, 155, 137, 10, 128, 9, 67, 98, 191, 208, 66, 66, 254, 116, 55, 208, 165, 24, 111, 114, 72,
-    154, 12, 132, 232, 204, 10, 236, 160, 7, 67, 225, 204, 113, 137, 70, 53, 194, 88, 24, 176, 221, 247, 105, 41, 201,
-    16, 29, 90, 183, 67, 33, 116, 84, 209, 66, 45, 136, 222, 3, 250, 37, 133, 82, 38, 194, 84, 48, 171, 49, 98, 99, 68,
-    37, 18, 10, 245, 217, 18, 29, 25, 139, 47, 105, 207, 217, 22, 62, 108, 235, 12, 254, 193, 53, 164, 86, 250, 67, 250,
-    209, 151, 12, 140, 211, 29, 23, 247, 16, 17, 104, 193, 140, 74, 47, 40, 169, 175, 1, 53, 130, 175, 191, 96, 38, 232,
-    208, 153, 24, 238, 172, 122, 130, 40, 72, 161, 170, 175, 165, 240, 205, 20, 92, 226, 3, 149, 11, 231, 249, 158, 120,
-    123, 198, 93, 47, 31, 63, 10, 8, 17, 162, 233, 106, 173, 131, 222, 249, 224, 202, 11, 211, 10, 153, 248, 14, 174,
-    157, 20, 163, 31, 133, 70, 155, 152, 236, 226, 49, 206, 186, 5, 160, 17, 55, 7, 87, 198, 148, 47, 21, 236, 102, 87,
-    155, 192, 217, 86, 59, 158, 166, 146, 14, 64, 153, 165, 251, 221, 217, 25, 124, 4, 41, 144, 255, 233, 1, 1, 12, 142,
-    114, 30, 55, 170, 53, 23, 84, 188, 39, 192, 48, 44, 109, 35, 210, 48, 55, 111, 159, 247, 144, 167, 21, 18, 177, 96,
-    58, 4, 221, 130, 127, 93, 124, 10, 32, 12, 143, 198, 190, 83, 77, 67, 162, 173, 62, 160, 123, 170, 19, 133, 89, 127,
-    115, 145, 210, 250, 187, 126, 223, 194, 58, 255, 98, 119, 28, 148, 181, 51, 186, 217, 47, 53, 179, 216, 119, 182,
-    188, 225, 130, 207, 121, 178, 218, 184, 150, 86, 7, 205, 191, 218, 214, 62, 218, 57, 220, 94, 75, 9, 93, 210, 188,
-    223, 251, 17, 93, 126, 12, 45, 45, 50, 69, 174, 106, 252, 169, 29, 18, 234, 243, 89, 155, 156, 25, 190, 242, 51,
-    147, 255, 172, 173, 215, 135, 6, 236, 52, 105, 235, 217, 72, 75, 162, 57, 248, 196, 252, 125, 72, 106, 188, 19, 147,
-    208, 187, 144, 212, 112, 115, 100, 109, 148, 12, 168, 17, 1, 26, 102, 42, 72, 170, 23, 234, 121, 137, 121, 48, 29,
-    119, 245, 98, 139, 220, 193, 95, 32, 229, 237, 153, 255, 49, 50, 241, 204, 136, 20, 33, 200, 66, 182, 153, 36, 222,
-    30, 2, 142, 180, 192, 157, 169, 53, 156, 171, 54, 127, 17, 184, 56, 216, 81, 230, 193, 84, 100, 5, 144, 197, 152,
-    77, 116, 12, 63, 168, 224, 40, 82, 232, 86, 92, 143, 169, 76, 236, 162, 84, 156, 130, 41, 185, 236, 37, 253, 55, 3,
-    98, 72, 6, 44, 221, 94, 1, 220, 118, 43, 43, 104, 134, 87, 137, 195, 241, 232, 50, 230, 186, 171, 202, 92, 41, 141,
-    241, 101, 205, 58, 20, 26, 59, 109, 152, 113, 114, 148, 182, 0, 120, 158, 19, 254, 14, 209, 243, 50, 93, 103, 92, 4,
-    121, 136, 126, 153, 26, 20, 167, 213, 134, 129, 170, 224, 243, 93, 60, 192, 137, 61, 110, 140, 144, 107, 209, 187,
-    89, 119, 121, 54, 226, 162, 89, 77, 83, 14, 139, 85, 11, 38, 252, 166, 108, 141, 135, 30, 79, 80, 159, 237, 169, 42,
-    50, 185, 221, 72, 204, 217, 254, 211, 134, 251, 154, 58, 132, 248, 109, 135, 217, 107, 175, 94, 115, 112, 160, 21,
-    104, 216, 66, 21, 2, 8, 240, 142, 250, 68, 18, 252, 16, 58, 228, 96, 11, 127, 178, 2, 160, 242, 29, 254, 5, 51, 105,
-    143, 157, 36, 138, 63, 153, 203, 83, 201, 202, 123, 186, 130, 94, 164, 124, 119, 168, 41, 194, 41, 254, 202, 96,
-    155, 112, 226, 100, 254, 251, 13, 150, 102, 44, 9, 56, 131, 248, 117, 198, 182, 223, 94, 52, 183, 128, 190, 215,
-    184, 193, 203, 247, 101, 219, 18, 2, 214, 30, 227, 79, 247, 31, 194, 130, 112, 146, 63, 77, 42, 185, 107, 254, 26,
-    5, 121, 167, 174, 169, 44, 151, 234, 22, 85, 180, 190, 33, 237, 1, 184, 216, 47, 163, 132, 110, 119, 227, 227, 227,
-    191, 39, 219, 15, 183, 45, 134, 226, 149, 40, 123, 195, 63, 225, 52, 149, 177, 24, 80, 169, 130, 118, 204, 158, 126,
-    199, 24, 246, 240, 20, 254, 153, 185, 26, 246, 201, 255, 189, 51, 140, 144, 141, 37, 171, 231, 237, 105, 83, 254,
-    78, 28, 25, 255, 206, 64, 33, 112, 242, 88, 56, 236, 13, 141, 234, 57, 113, 214, 138, 161, 0, 115, 26, 218, 43, 155,
-    64, 136, 96, 78, 236, 87, 85, 49, 32, 189, 142, 124, 170, 84, 185, 251, 119, 225, 42, 216, 47, 80, 109, 230, 1, 110,
-    105, 133, 100, 164, 56, 149, 64, 228, 231, 30, 227, 60, 99, 173, 48, 169, 48, 176, 220, 52, 33, 127, 166, 223, 192,
-    102, 171, 89, 121, 190, 230, 25, 32, 93, 228, 233, 38, 85, 171, 200, 99, 145, 176, 34, 159, 243, 25, 13, 252, 147,
-    233, 98, 175, 189, 100, 183, 209, 50, 251, 41, 12, 38, 71, 30, 168, 11, 62, 199, 71, 103, 45, 223, 63, 98, 192, 100,
-    5, 153, 178, 236, 94, 57, 28, 177, 254, 62, 19, 59, 20, 54, 200, 90, 135, 96, 123, 78, 189, 154, 218, 180, 224, 212,
-    140, 131, 80, 125, 50, 43, 177, 25, 105, 244, 19, 37, 194, 143, 136, 65, 93, 234, 113, 4, 175, 116, 18, 220, 229,
-    117, 205, 41, 88, 114, 238, 6, 153, 32, 178, 232, 29, 245, 83, 17, 21, 241, 43, 80, 70, 195, 66, 13, 195, 133, 178,
-    248, 44, 160, 166, 177, 27, 156, 239, 169, 217, 41, 112, 39, 73, 118, 174, 14, 27, 158, 34, 243, 10, 21, 72, 243,
-    209, 232, 67, 115, 45, 234, 66, 38, 18, 150, 14, 126, 32, 210, 60, 31, 222, 225, 194, 34, 102, 186, 104, 141, 238,
-    241, 215, 252, 37, 81, 22, 194, 216, 198, 151, 176, 34, 229, 149, 80, 99, 208, 199, 180, 215, 135, 67, 208, 76, 218,
-    1, 126, 30, 213, 40, 60, 212, 8, 72, 225, 69, 178, 158, 94, 253, 183, 239, 181, 129, 239, 143, 12, 125, 210, 143,
-    70, 228, 224, 29, 179, 231, 25, 247, 80, 219, 135, 210, 251, 93, 50, 82, 67, 26, 174, 181, 235, 62, 160, 83, 26, 69,
-    125, 41, 58, 76, 21, 82, 166, 233, 57, 87, 10, 217, 106, 1, 39, 105, 118, 66, 113, 33, 113, 83, 205, 12, 59, 105,
-    209, 89, 21, 117, 54, 182, 4, 70, 217, 161, 57, 143, 163, 228, 180, 162, 166, 179, 60, 155, 72, 228, 191, 203, 3,
-    57, 84, 105, 74, 65, 203, 62, 83, 3, 164, 131, 29, 115, 222, 173, 198, 195, 112, 100, 14, 137, 221, 28, 136, 76,
-    125, 112, 172, 173, 120, 143, 114, 119, 221, 69, 247, 205, 250, 180, 17, 54, 229, 45, 101, 183, 233, 101, 184, 33,
-    137, 110, 55, 216, 29, 89, 65, 209, 17, 209, 251, 196, 147, 79, 121, 155, 73, 76, 127, 231, 214, 234, 197, 212, 63,
-    192, 91, 225, 160, 213, 80, 244, 203, 89, 218, 159, 28, 34, 208, 6, 254, 175, 173, 144, 249, 99, 104, 99, 245, 236,
-    27, 218, 170, 99, 53, 53, 13, 21, 30, 227, 90, 218, 161, 141, 239, 77, 95, 190, 122, 131, 51, 163, 141, 140, 15, 26,
-    114, 214, 148, 160, 105, 40, 110, 182, 30, 87, 76, 23, 48, 166, 97, 163, 160, 85, 63, 20, 42, 243, 202, 152, 238,
-    72, 255, 206, 139, 117, 202, 87, 200, 73, 217, 125, 6, 221, 49, 137, 146, 159, 58, 5, 179, 109, 38, 230, 106, 79,
-    72, 14, 162, 73, 76, 13, 211, 171, 104, 244, 75, 210, 89, 236, 111, 92, 169, 64, 133, 34, 18, 21, 59, 144, 175, 107,
-    235, 136, 107, 64, 60, 67, 60, 12, 193, 126, 75, 135, 206, 4, 151, 64, 1, 79, 202, 189, 114, 123, 155, 34, 152, 69,
-    217, 157, 248, 183, 20, 122, 17, 81, 179, 184, 94, 214, 239, 109, 243, 97, 111, 116, 168, 53, 152, 130, 234, 173,
-    181, 202, 115, 119, 242, 141, 171, 15, 162, 111, 174, 2, 13, 119, 8, 66, 38, 233, 31, 181, 118, 252, 56, 225, 211,
-    19, 6, 94, 245, 152, 155, 124, 199, 21, 88, 33, 107, 33, 158, 7, 145, 211, 98, 122, 120, 146, 3, 105, 136, 210, 72,
-    198, 172, 237, 27, 216, 0, 126, 43, 158, 70, 75, 40, 108, 107, 61, 181, 203, 92, 191, 5, 240, 208, 32, 230, 109,
-    154, 244, 165, 215, 209, 50, 54, 22, 218, 127, 20, 240, 122, 10, 38, 65, 182, 223, 82, 193, 18, 183, 75, 17, 102,
-    30, 160, 88, 28, 46, 245, 66, 107, 2, 116, 196, 68, 80, 117, 245, 88, 152, 192, 126, 46, 214, 108, 147, 176, 245, 6,
-    41, 26, 141, 87, 40, 32, 2, 174, 50, 53, 103, 242, 12, 16, 219, 97, 204, 101, 24, 211, 130, 50, 110, 24, 92, 80, 52,
-    159, 78, 117, 72, 121, 191, 156, 82, 179, 57, 123, 117, 91, 23, 227, 249, 116, 7, 253, 215, 105, 115, 253, 209, 210,
-    124, 31, 66, 238, 179, 41, 15, 223, 131, 63, 73, 89, 126, 247, 89, 70, 13, 93, 110, 156, 124, 132, 214, 158, 85, 14,
-    42, 65, 255, 219, 117, 254, 39, 91, 42, 241, 132, 209, 53, 96, 69, 241, 163, 99, 44, 12, 204, 117, 189, 100, 177,
-    118, 182, 164, 107, 252, 194, 113, 54, 47, 91, 127, 54, 0, 77, 115, 89, 225, 0, 154, 224, 125, 101, 69, 152, 189,
-    153, 198, 176, 53, 121, 235, 244, 92, 92, 127, 93, 10, 252, 236, 245, 29, 217, 40, 119, 10, 8, 74, 77, 180, 8, 192,
-    201, 252, 120, 43, 78, 238, 31, 123, 15, 146, 215, 112, 127, 167, 30, 21, 29, 140, 104, 83, 159, 149, 187, 184, 108,
-    72, 207, 231, 36, 34, 212, 157, 204, 134, 159, 77, 4, 240, 139, 13, 168, 157, 235, 111, 144, 56, 29, 10, 6, 219,
-    199, 171, 113, 230, 177, 68, 188, 14, 44, 80, 172, 127, 139, 137, 144, 198, 163, 79, 83, 250, 221, 153, 224, 223,
-    60, 99, 56, 147, 231, 88, 198, 199, 153, 170, 100, 255, 192, 154, 184, 0, 137, 163, 254, 252, 54, 145, 75, 223, 49,
-    94, 188, 238, 32, 122, 4, 19, 107, 123, 47, 183, 58, 106, 131, 1, 105, 26, 195, 229, 112, 124, 38, 208, 87, 150,
-    198, 51, 126, 62, 117, 200, 113, 100, 0, 103, 187, 201, 138, 40, 174, 103, 191, 158, 228, 236, 210, 111, 83, 18,
-    252, 36, 163, 204, 174, 108, 155, 17, 118, 63, 188, 127, 98, 136, 13, 134, 71, 203, 119, 159, 178, 226, 20, 192,
-    238, 113, 191, 204, 51, 55, 82, 81, 46, 117, 32, 105, 77, 239, 170, 152, 139, 82, 13, 111, 25, 48, 18, 57, 34, 9,
-    53, 3, 237, 28, 64, 216, 30, 242, 199, 13, 255, 77, 223, 151, 194, 237, 164, 113, 23, 145, 206, 223, 253, 198, 185,
-    68, 134, 151, 39, 119, 37, 214, 27, 60, 222, 91, 242, 125, 252, 197, 91, 147, 13, 218, 218, 213, 237, 15, 246, 235,
-    62, 96, 167, 66, 225, 97, 231, 231, 200, 84, 28, 85, 250, 223, 19, 197, 166, 212, 74, 167, 214, 182, 155, 206, 115,
-    237, 96, 39, 82, 47, 34, 34, 155, 67, 71, 123, 76, 4, 154, 44, 14, 153, 39, 64, 13, 226, 121, 215, 3, 190, 170, 44,
-    28, 28, 207, 44, 219, 174, 28, 31, 172, 167, 222, 212, 237, 194, 86, 82, 9, 99, 0, 39, 107, 227, 120, 243, 44, 10,
-    61, 157, 15, 84, 102, 133, 221, 45, 63, 130, 153, 35, 123, 220, 143, 91, 116, 138, 199, 192, 134, 238, 5, 234, 224,
-    20, 107, 119, 225, 72, 73, 136, 156, 177, 30, 201, 171, 101, 173, 172, 34, 157, 115, 216, 43, 176, 81, 27, 71, 245,
-    35, 134, 128, 14, 4, 177, 102, 197, 33, 101, 25, 122, 155, 144, 252, 34, 119, 24, 60, 194, 171, 9, 194, 56, 225, 8,
-    240, 30, 153, 220, 81, 165, 236, 212, 148, 59, 30, 165, 223, 32, 241, 142, 80, 216, 125, 165, 23, 218, 69, 246, 122,
-    214, 62, 81, 227, 110, 35, 253, 123, 24, 99, 225, 126, 22, 21, 167, 26, 52, 29, 138, 3, 163, 72, 203, 233, 62, 108,
-    124, 95, 33, 192, 165, 189, 107, 93, 148, 241, 145, 190, 27, 247, 0, 101, 60, 176, 115, 125, 178, 177, 124, 174, 92,
-    21, 222, 181, 176, 173, 78, 181, 254, 89, 64, 175, 17, 82, 184, 223, 155, 111, 95, 32, 170, 112, 175, 1, 164, 92,
-    124, 103, 14, 30, 32, 161, 130, 88, 189, 90, 132, 206, 156, 23, 70, 42, 7, 19, 145, 10, 226, 242, 6, 140, 15, 82,
-    103, 93, 24, 117, 233, 131, 192, 85, 99, 241, 33, 164, 147, 186, 135, 47, 176, 29, 211, 206, 6, 39, 69, 228, 26,
-    215, 124, 137, 178, 156, 19, 80, 201, 168, 21, 75, 214, 148, 48, 20, 241, 197, 19, 52, 114, 81, 117, 185, 206, 169,
-    75, 130, 65, 164, 140, 232, 247, 231, 81, 129, 128, 23, 155, 105, 65, 207, 207, 136, 192, 88, 35, 182, 98, 174, 76,
-    186, 45, 43, 13, 68, 116, 85, 13, 163, 57, 71, 236, 233, 29, 22, 98, 207, 98, 145, 157, 28, 223, 155, 147, 32, 5,
-    228, 81, 200, 227, 111, 248, 95, 48, 206, 89, 204, 253, 108, 76, 221, 135, 233, 205, 76, 181, 80, 88, 231, 117, 43,
-    24, 149, 242, 162, 152, 13, 234, 194, 248, 180, 181, 141, 65, 12, 82, 22, 51, 180, 178, 234, 180, 64, 183, 201, 160,
-    130, 112, 149, 142, 133, 242, 32, 6, 155, 174, 70, 53, 176, 204, 132, 30, 58, 13, 72, 79, 227, 38, 181, 159, 193,
-    183, 8, 116, 125, 229, 145, 53, 214, 1, 237, 63, 185, 166, 245, 94, 172, 108, 55, 48, 241, 137, 180, 218, 185, 174,
-    181, 71, 230, 40, 15, 170, 74, 40, 150, 163, 198, 95, 234, 15, 191, 202, 252, 139, 175, 90, 126, 230, 194, 188, 23,
-    248, 222, 222, 238, 128, 68, 233, 144, 197, 34, 19, 166, 193, 98, 186, 61, 114, 227, 5, 42, 63, 89, 231, 9, 112,
-    115, 46, 102, 184, 176, 113, 78, 3, 244, 189, 6, 234, 102, 191, 77, 230, 132, 103, 23, 51, 89, 126, 8, 23, 80, 225,
-    186, 121, 91, 194, 247, 249, 2, 38, 202, 16, 190, 231, 3, 206, 166, 66, 86, 135, 61, 214, 132, 3, 6, 237, 195, 81,
-    11, 1, 208, 168, 96, 162, 225, 3, 153, 79, 102, 42, 66, 119, 238, 168, 0, 109, 179, 198, 217, 178, 6, 185, 249, 180,
-    114, 95, 171, 210, 16, 251, 120, 183, 9, 176, 35, 70, 29, 172, 14, 17, 9, 13, 158, 91, 171, 222, 240, 40, 156, 108,
-    118, 48, 86, 100, 197, 72, 108, 34, 82, 207, 200, 183, 52, 118, 113, 85, 176, 22, 163, 35, 101, 70, 203, 180, 86, 0,
-    145, 115, 128, 20, 45, 59, 60, 233, 183, 71, 26, 14, 75, 34, 232, 61, 155, 235, 111, 3, 187, 96, 72, 116, 129, 76,
-    213, 182, 154, 196, 91, 122, 84, 14, 48, 193, 164, 84, 122, 174, 54, 3, 117, 67, 49, 2, 205, 119, 192, 11, 72, 75,
-    217, 14, 48, 238, 231, 35, 254, 80, 210, 160, 211, 34, 177, 233, 2, 240, 100, 10, 178, 93, 134, 190, 123, 198, 58,
-    211, 111, 75, 108, 245, 66, 96, 54, 100, 114, 249, 215, 11, 13, 126, 27, 230, 226, 22, 177, 110, 86, 87, 133, 255,
-    29, 125, 244, 152, 218, 149, 122, 50, 169, 186, 107, 54, 24, 71, 156, 245, 223, 64, 173, 207, 252, 40, 248, 75, 165,
-    154, 76, 240, 66, 57, 70, 9, 189, 138, 45, 64, 70, 107, 237, 243, 85, 222, 76, 125, 90, 78, 226, 73, 23, 40, 86,
-    136, 167, 119, 26, 53, 3, 192, 12, 133, 93, 161, 51, 88, 162, 59, 51, 96, 51, 119, 46, 107, 66, 220, 220, 198, 162,
-    145, 219, 152, 66, 190, 126, 245, 214, 111, 43, 29, 155, 239, 35, 43, 157, 21, 111, 224, 172, 57, 50, 45, 180, 173,
-    18, 239, 204, 172, 137, 82, 140, 128, 254, 241, 130, 112, 167, 224, 110, 236, 65, 14, 198, 69, 122, 178, 21, 47,
-    209, 219, 190, 185, 234, 71, 125, 167, 216, 255, 161, 56, 161, 194, 90, 184, 202, 202, 213, 119, 7, 131, 36, 8, 19,
-    210, 230, 221, 249, 145, 134, 234, 8, 22, 106, 94, 99, 76, 80, 18, 97, 173, 112, 219, 149, 127, 227, 202, 176, 97,
-    97, 213, 142, 6, 104, 57, 66, 51, 228, 182, 72, 166, 16, 249, 77, 9, 102, 247, 180, 35, 225, 143, 187, 154, 236,
-    195, 161, 64, 173, 229, 85, 254, 60, 226, 193, 183, 135, 131, 240, 134, 228, 213, 21, 187, 73, 211, 212, 213, 181,
-    100, 238, 130, 72, 73, 12, 107, 174, 51, 180, 107, 178, 214, 129, 18, 97, 173, 70, 243, 109, 176, 17, 78, 128, 46,
-    5, 122, 218, 45, 205, 147, 219, 109, 97, 19, 226, 77, 161, 168, 224, 89, 195, 147, 40, 11, 148, 123, 155, 152, 159,
-    78, 115, 65, 216, 127, 153, 4, 49, 255, 120, 57, 132, 77, 216, 225, 49, 65, 162, 60, 225, 74, 27, 226, 141, 165, 86,
-    193, 197, 247, 61, 128, 159, 156, 13, 54, 130, 44, 223, 161, 17, 178, 110, 136, 110, 6, 15, 188, 204, 194, 19, 244,
-    74, 229, 219, 111, 66, 204, 109, 10, 70, 217, 177, 60, 102, 201, 202, 95, 118, 108, 214, 72, 195, 241, 75, 220, 118,
-    160, 65, 129, 164, 67, 62, 41, 79, 143, 60, 26, 211, 195, 155, 120, 205, 130, 87, 80, 94, 242, 147, 171, 169, 129,
-    81, 248, 166, 219, 56, 50, 177, 189, 157, 150, 173, 78, 7, 23, 68, 82, 49, 222, 201, 63, 96, 26, 148, 66, 76, 155,
-    129, 244, 169, 103, 221, 118, 42, 40, 133, 36, 200, 59, 58, 168, 177, 113, 128, 26, 53, 188, 86, 218, 153, 13, 174,
-    186, 192, 181, 144, 241, 163, 50, 103, 112, 159, 54, 26, 145, 46, 52, 200, 37, 123, 46, 14, 191, 65, 106, 203, 217,
-    103, 48, 67, 62, 83, 25, 70, 224, 23, 96, 20, 91, 138, 189, 106, 145, 5, 44, 195, 51, 145, 156, 51, 213, 203, 238,
-    212, 208, 151, 18, 89, 64, 75, 13, 21, 22, 235, 84, 154, 234, 220, 109, 234, 5, 26, 74, 138, 49, 47, 37, 53, 32,
-    247, 206, 245, 172, 30, 250, 164, 251, 92, 40, 196, 40, 66, 14, 4, 57, 201, 37, 150, 181, 110, 27, 244, 12, 7, 251,
-    84, 135, 113, 248, 27, 170, 19, 215, 45, 121, 130, 159, 108, 236, 219, 187, 240, 84, 134, 3, 12, 203, 60, 115, 44,
-    60, 142, 220, 17, 190, 149, 44, 240, 72, 200, 60, 18, 160, 125, 132, 110, 184, 140, 237, 143, 143, 193, 227, 31,
-    239, 27, 61, 40, 203, 177, 11, 25, 180, 14, 71, 78, 19, 125, 20, 41, 100, 75, 35, 32, 119, 214, 212, 124, 80, 103,
-    23, 140, 124, 22, 236, 239, 250, 9, 20, 167, 8, 97, 55, 93, 144, 84, 242, 36, 108, 81, 7, 36, 5, 163, 14, 125, 178,
-    33, 20, 45, 20, 99, 6, 9, 11, 108, 68, 65, 74, 122, 102, 217, 27, 28, 235, 191, 4, 43, 28, 4, 151, 118, 246, 104,
-    85, 39, 22, 106, 104, 50, 219, 166, 235, 240, 71, 146, 97, 220, 48, 121, 176, 23, 227, 15, 91, 73, 106, 218, 27, 81,
-    43, 4, 212, 26, 230, 209, 160, 100, 36, 92, 79, 238, 2, 249, 201, 35, 84, 173, 250, 23, 137, 128, 248, 100, 169,
-    164, 204, 174, 116, 120, 50, 56, 140, 136, 13, 148, 216, 190, 136, 25, 219, 235, 55, 74, 209, 249, 139, 1, 218, 139,
-    250, 173, 87, 44, 74, 158, 53, 35, 172, 144, 143, 90, 19, 57, 145, 242, 217, 181, 75, 30, 32, 187, 121, 73, 112,
-    142, 170, 24, 100, 19, 119, 235, 165, 44, 201, 1, 52, 24, 208, 145, 18, 45, 151, 90, 156, 119, 43, 83, 123, 101,
-    135, 165, 99, 251, 53, 236, 68, 107, 55, 235, 95, 225, 200, 98, 215, 162, 130, 33, 88, 68, 95, 33, 97, 218, 220,
-    161, 255, 192, 183, 37, 164, 142, 221, 46, 15, 56, 252, 16, 118, 203, 27, 146, 245, 52, 6, 98, 74, 172, 241, 41,
-    190, 160, 77, 205, 238, 113, 128, 101, 120, 82, 26, 168, 89, 167, 219, 181, 104, 17, 42, 222, 32, 238, 163, 188,
-    179, 234, 185, 152, 153, 35, 92, 191, 171, 26, 197, 80, 211, 209, 95, 159, 140, 62, 109, 89, 44, 250, 93, 28, 199,
-    109, 177, 228, 146, 228, 51, 58, 173, 223, 2, 39, 101, 32, 87, 68, 249, 12, 15, 0, 149, 4, 235, 49, 144, 81, 251,
-    54, 230, 1, 105, 97, 75, 91, 154, 92, 121, 80, 197, 157, 73, 186, 27, 252, 255, 142, 236, 83, 74, 164, 202, 141, 20,
-    26, 65, 168, 8, 236, 118, 196, 124, 44, 203, 78, 158, 39, 88, 196, 7, 170, 7, 97, 133, 229, 43, 33, 180, 50, 20,
-    224, 235, 205, 130, 68, 231, 163, 183, 154, 210, 69, 43, 222, 43, 18, 177, 247, 70, 149, 78, 12, 65, 210, 176, 173,
-    83, 115, 25, 108, 177, 20, 108, 159, 238, 99, 200, 180, 110, 88, 68, 187, 93, 3, 136, 57, 203, 82, 148, 39, 152,
-    246, 53, 171, 145, 8, 236, 180, 3, 14, 59, 50, 136, 78, 105, 214, 226, 202, 155, 129, 75, 170, 172, 200, 224, 239,
-    48, 198, 87, 207, 127, 58, 246, 15, 252, 58, 80, 78, 198, 187, 175, 165, 180, 163, 82, 6, 208, 177, 129, 121, 62,
-    255, 193, 215, 212, 207, 136, 125, 141, 150, 197, 53, 102, 106, 71, 116, 181, 105, 76, 249, 40, 153, 164, 163, 54,
-    250, 226, 157, 21, 254, 51, 24, 243, 87, 253, 50, 173, 104, 124, 54, 65, 116, 138, 131, 200, 94, 70, 13, 176, 228,
-    183, 130, 113, 53, 154, 59, 58, 28, 36, 109, 150, 73, 233, 63, 27, 27, 237, 27, 160, 24, 104, 130, 208, 111, 94,
-    179, 216, 106, 29, 91, 172, 166, 176, 111, 132, 62, 223, 148, 127, 121, 176, 12, 151, 195, 135, 36, 105, 62, 23, 90,
-    124, 149, 107, 250, 174, 254, 122, 246, 36, 67, 163, 214, 205, 55, 16, 87, 56, 242, 168, 195, 113, 18, 248, 66, 36,
-    99, 116, 222, 37, 173, 22, 160, 125, 253, 94, 54, 193, 176, 193, 1, 148, 177, 210, 199, 165, 82, 21, 7, 194, 51,
-    139, 194, 133, 250, 20, 30, 122, 83, 30, 94, 194, 3, 93, 74, 177, 155, 74, 67, 178, 176, 239, 242, 210, 131, 162,
-    189, 38, 166, 87, 129, 252, 241, 21, 110, 239, 252, 152, 109, 184, 141, 67, 228, 177, 6, 17, 123, 172, 146, 48, 7,
-    176, 244, 41, 17, 177, 241, 73, 24, 67, 73, 32, 118, 41, 133, 134, 237, 211, 144, 86, 80, 241, 253, 77, 250, 17,
-    207, 21, 252, 85, 202, 21, 62, 76, 196, 101, 240, 10, 63, 57, 71, 190, 5, 25, 108, 231, 53, 176, 22, 73, 10, 6, 34,
-    23, 134, 27, 54, 175, 138, 134, 135, 89, 3, 216, 129, 192, 91, 95, 149, 184, 195, 242, 42, 210, 43, 252, 135, 102,
-    47, 155, 132, 47, 62, 21, 67, 96, 148, 102, 196, 0, 215, 49, 200, 34, 35, 226, 250, 58, 138, 87, 162, 111, 237, 137,
-    192, 102, 205, 157, 145, 28, 70, 175, 239, 246, 92, 122, 239, 6, 2, 151, 88, 73, 131, 218, 44, 48, 83, 207, 65, 179,
-    206, 144, 218, 25, 211, 115, 101, 106, 2, 249, 67, 245, 181, 11, 108, 110, 94, 114, 70, 55, 213, 251, 77, 66, 121,
-    61, 58, 76, 153, 7, 217, 52, 199, 11, 232, 166, 168, 78, 146, 80, 98, 89, 140, 218, 139, 145, 44, 78, 7, 109, 9,
-    137, 146, 111, 213, 125, 149, 238, 52, 41, 64, 61, 37, 81, 216, 249, 66, 171, 223, 123, 153, 88, 2, 111, 86, 173, 2,
-    113, 51, 195, 22, 21, 218, 116, 63, 234, 253, 56, 180, 135, 23, 248, 107, 158, 108, 192, 91, 201, 203, 196, 143,
-    145, 251, 178, 192, 223, 220, 80, 161, 156, 149, 84, 225, 225, 138, 16, 101, 216, 121, 18, 152, 85, 231, 48, 5, 140,
-    234, 58, 128, 63, 71, 136, 218, 62, 178, 92, 199, 5, 157, 27, 27, 109, 138, 226, 66, 146, 19, 204, 213, 145, 237,
-    72, 7, 152, 38, 165, 63, 157, 51, 240, 190, 189, 221, 60, 75, 158, 223, 127, 22, 44, 233, 76, 117, 11, 168, 116, 58,
-    193, 48, 52, 248, 52, 80, 33, 175, 215, 130, 127, 58, 180, 117, 80, 177, 245, 126, 173, 60, 43, 17, 194, 196, 254,
-    92, 91, 214, 164, 115, 123, 64, 186, 157, 30, 221, 95, 222, 43, 12, 76, 250, 132, 43, 122, 106, 51, 66, 26, 58, 83,
-    10, 243, 25, 32, 42, 9, 48, 216, 249, 1, 193, 109, 99, 118, 28, 106, 62, 88, 243, 166, 102, 149, 57, 184, 205, 238,
-    44, 62, 38, 8, 31, 151, 14, 1, 78, 144, 54, 212, 206, 35, 206, 230, 201, 159, 174, 86, 217, 226, 232, 151, 142, 25,
-    37, 137, 9, 204, 223, 191, 109, 72, 118, 58, 223, 244, 244, 58, 237, 115, 43, 192, 175, 241, 118, 75, 9, 166, 133,
-    165, 51, 79, 140, 198, 180, 34, 139, 147, 159, 82, 90, 30, 7, 76, 213, 25, 106, 103, 128, 112, 201, 96, 209, 31, 4,
-    118, 135, 28, 105, 219, 82, 51, 219, 11, 36, 63, 134, 69, 11, 226, 44, 215, 12, 63, 69, 115, 163, 44, 25, 193, 45,
-    193, 145, 124, 73, 107, 220, 159, 70, 17, 165, 128, 19, 169, 200, 230, 192, 60, 181, 238, 217, 136, 48, 0, 212, 251,
-    244, 21, 173, 207, 210, 139, 140, 58, 41, 73, 180, 142, 208, 187, 236, 27, 135, 234, 22, 184, 38, 252, 62, 52, 154,
-    226, 227, 243, 192, 104, 36, 10, 32, 228, 138, 253, 93, 83, 144, 251, 150, 8, 181, 8, 98, 253, 5, 61, 200, 116, 126,
-    156, 16, 21, 125, 163, 209, 54, 80, 174, 146, 15, 234, 234, 153, 237, 144, 127, 141, 201, 228, 191, 160, 198, 211,
-    77, 252, 86, 123, 27, 78, 188, 48, 206, 53, 135, 64, 141, 124, 118, 212, 163, 118, 110, 221, 34, 221, 154, 164, 102,
-    190, 156, 245, 2, 187, 138, 211, 124, 86, 144, 85, 201, 125, 63, 191, 17, 168, 137, 48, 23, 206, 140, 61, 244, 32,
-    188, 3, 165, 154, 200, 55, 26, 206, 23, 2, 5, 108, 34, 128, 197, 64, 180, 197, 97, 204, 67, 84, 62, 222, 7, 93, 109,
-    35, 127, 142, 123, 119, 230, 202, 199, 253, 113, 8, 60, 62, 212, 46, 161, 205, 4, 139, 121, 225, 57, 252, 83, 233,
-    166, 234, 246, 246, 182, 90, 66, 27, 74, 71, 127, 107, 236, 115, 116, 106, 214, 253, 123, 1, 214, 64, 193, 193, 18,
-    233, 119, 146, 146, 48, 214, 111, 66, 25, 221, 164, 29, 7, 25, 163, 15, 187, 12, 190, 17, 170, 152, 190, 170, 26,
-    65, 32, 177, 152, 180, 162, 8, 211, 29, 165, 156, 57, 175, 31, 245, 60, 243, 219, 182, 47, 92, 81, 185, 32, 198,
-    220, 100, 152, 77, 24, 50, 129, 24, 45, 38, 194, 61, 167, 189, 101, 87, 162, 137, 80, 51, 188, 83, 169, 111, 97, 84,
-    25, 67, 7, 136, 171, 84, 127, 88, 164, 73, 175, 230, 228, 152, 180, 199, 221, 227, 149, 199, 246, 87, 129, 250, 147,
-    245, 153, 37, 27, 126, 50, 138, 249, 59, 139, 177, 172, 196, 63, 243, 61, 130, 244, 79, 120, 152, 33, 149, 201, 154,
-    35, 172, 143, 212, 40, 249, 158, 59, 147, 149, 71, 126, 60, 246, 238, 104, 183, 78, 210, 57, 106, 117, 186, 111, 70,
-    12, 138, 126, 138, 171, 227, 140, 195, 215, 72, 158, 204, 179, 186, 73, 116, 116, 189, 218, 136, 135, 111, 113, 233,
-    91, 148, 174, 49, 76, 82, 105, 124, 83, 187, 177, 203, 104, 229, 82, 63, 22, 118, 83, 189, 121, 121, 201, 72, 238,
-    186, 195, 209, 34, 47, 165, 94, 244, 41, 186, 25, 19, 166, 39, 73, 60, 36, 20, 116, 102, 35, 31, 32, 251, 117, 140,
-    111, 193, 114, 71, 59, 78, 55, 0, 221, 91, 229, 140, 181, 162, 221, 250, 168, 232, 79, 100, 148, 30, 204, 120, 146,
-    76, 236, 46, 241, 56, 38, 217, 132, 127, 139, 74, 113, 134, 187, 200, 182, 123, 60, 38, 80, 95, 119, 236, 168, 203,
-    142, 165, 33, 75, 66, 27, 136, 221, 144, 112, 99, 49, 155, 219, 93, 141, 59, 43, 27, 161, 184, 48, 61, 190, 48, 71,
-    12, 72, 228, 169, 201, 166, 85, 50, 78, 211, 212, 172, 121, 92, 114, 15, 89, 23, 89, 61, 16, 163, 69, 244, 244, 13,
-    246, 229, 200, 140, 100, 170, 160, 100, 90, 201, 234, 65, 73, 254, 135, 52, 106, 252, 236, 31, 13, 54, 147, 123,
-    254, 83, 58, 64, 169, 48, 228, 187, 51, 209, 114, 72, 125, 3, 36, 20, 200, 175, 76, 172, 65, 121, 152, 162, 157, 79,
-    53, 194, 186, 206, 74, 133, 184, 157, 65, 232, 101, 254, 170, 238, 70, 207, 17, 125, 73, 105, 96, 247, 227, 67, 43,
-    43, 140, 81, 182, 9, 34, 254, 190, 104, 97, 65, 16, 89, 239, 146, 111, 184, 157, 255, 238, 64, 130, 44, 18, 123,
-    252, 43, 163, 141, 156, 103, 236, 36, 89, 245, 85, 233, 215, 240, 16, 81, 226, 125, 226, 42, 218, 143, 231, 160, 39,
-    93, 157, 72, 198, 36, 11, 208, 24, 28, 95, 180, 152, 128, 138, 138, 13, 10, 235, 120, 90, 223, 186, 170, 40, 178,
-    145, 176, 89, 138, 58, 144, 121, 173, 17, 192, 60, 178, 0, 110, 23, 130, 186, 246, 22, 118, 210, 244, 132, 191, 170,
-    10, 150, 31, 249, 164, 27, 107, 109, 48, 185, 193, 44, 57, 23, 18, 195, 110, 206, 252, 233, 94, 205, 193, 61, 154,
-    61, 184, 227, 31, 46, 223, 28, 225, 86, 237, 43, 65, 2, 90, 87, 113, 51, 210, 235, 48, 215, 128, 79, 147, 125, 249,
-    208, 122, 53, 81, 177, 15, 184, 123, 239, 208, 190, 238, 222, 5, 52, 50, 91, 112, 136, 23, 221, 79, 50, 100, 57, 16,
-    249, 22, 19, 12, 33, 135, 174, 165, 174, 146, 65, 158, 191, 152, 185, 55, 14, 55, 94, 22, 168, 18, 96, 240, 147,
-    231, 12, 196, 163, 117, 27, 111, 239, 138, 255, 87, 76, 190, 12, 117, 71, 25, 60, 131, 229, 117, 59, 20, 133, 15,
-    145, 137, 125, 28, 194, 248, 54, 186, 239, 19, 24, 227, 48, 243, 30, 238, 67, 192, 229, 10, 129, 16, 225, 109, 1,
-    44, 120, 239, 123, 241, 34, 69, 214, 174, 99, 213, 180, 68, 91, 3, 16, 174, 65, 230, 86, 75, 53, 114, 160, 127, 27,
-    167, 249, 10, 48, 173, 7, 133, 108, 120, 56, 239, 201, 236, 145, 175, 115, 224, 213, 160, 135, 153, 34, 109, 247,
-    102, 118, 242, 145, 166, 14, 210, 7, 83, 95, 48, 74, 30, 69, 11, 76, 66, 50, 206, 57, 212, 9, 20, 45, 133, 57, 147,
-    5, 75, 143, 158, 46, 107, 81, 248, 115, 2, 137, 255, 169, 93, 134, 76, 63, 172, 27, 28, 155, 78, 231, 130, 67, 151,
-    154, 40, 32, 150, 67, 20, 110, 153, 163, 130, 172, 63, 240, 114, 91, 3, 98, 37, 158, 65, 43, 239, 77, 90, 8, 183,
-    67, 31, 169, 179, 211, 253, 243, 113, 223, 229, 241, 217, 138, 7, 52, 219, 116, 8, 226, 33, 132, 159, 35, 116, 190,
-    5, 58, 129, 47, 156, 156, 168, 198, 239, 210, 100, 177, 138, 37, 253, 89, 46, 130, 211, 99, 218, 187, 248, 189, 17,
-    178, 8, 162, 49, 112, 128, 186, 3, 39, 160, 57, 219, 49, 208, 84, 2, 196, 193, 151, 113, 144, 169, 229, 89, 104, 49,
-    133, 117, 123, 60, 119, 173, 5, 193, 80, 252, 175, 246, 151, 190, 247, 20, 8, 26, 215, 141, 176, 163, 248, 132, 207,
-    203, 144, 225, 160, 140, 52, 14, 20, 245, 123, 122, 219, 205, 150, 76, 99, 161, 152, 4, 91, 173, 104, 151, 0, 147,
-    223, 56, 234, 179, 223, 132, 234, 159, 219, 53, 174, 27, 207, 223, 159, 24, 81, 233, 71, 241, 93, 104, 47, 250, 170,
-    212, 1, 95, 62, 177, 216, 22, 102, 3, 224, 144, 181, 141, 207, 172, 54, 225, 37, 65, 121, 110, 30, 247, 132, 184,
-    42, 96, 140, 88, 67, 111, 129, 55, 154, 83, 255, 109, 109, 50, 185, 157, 1, 73, 42, 106, 2, 67, 212, 209, 157, 97,
-    252, 248, 248, 114, 101, 154, 174, 229, 221, 175, 248, 168, 170, 22, 77, 210, 56, 60, 118, 253, 24, 193, 243, 73,
-    200, 249, 183, 51, 149, 162, 253, 178, 182, 182, 68, 235, 184, 108, 250, 78, 79, 238, 115, 91, 146, 66, 21, 208,
-    169, 34, 210, 198, 28, 188, 242, 151, 196, 77, 154, 65, 154, 250, 108, 77, 95, 238, 155, 62, 195, 90, 8, 26, 82, 75,
-    23, 204, 250, 133, 56, 153, 221, 154, 118, 50, 204, 252, 72, 234, 162, 151, 118, 233, 233, 17, 151, 226, 4, 118,
-    239, 100, 188, 192, 20, 130, 177, 193, 222, 185, 64, 183, 9, 179, 75, 179, 27, 99, 222, 205, 187, 5, 207, 27, 158,
-    56, 142, 121, 5, 112, 42, 207, 227, 153, 135, 180, 48, 0, 80, 180, 6, 187, 118, 49, 176, 60, 205, 5, 141, 175, 135,
-    214, 69, 23, 72, 93, 48, 145, 180, 15, 225, 0, 246, 38, 198, 168, 174, 159, 249, 186, 176, 64, 102, 32, 18, 120, 83,
-    165, 28, 85, 136, 235, 2, 109, 22, 206, 10, 47, 45, 54, 119, 91, 229, 126, 41, 223, 10, 116, 126, 118, 237, 102,
-    109, 130, 102, 213, 89, 131, 203, 57, 242, 184, 159, 188, 56, 47, 100, 123, 219, 43, 211, 223, 142, 176, 229, 39,
-    32, 107, 13, 150, 16, 31, 203, 120, 243, 253, 238, 40, 45, 134, 131, 236, 103, 102, 42, 64, 136, 82, 93, 237, 101,
-    252, 239, 153, 26, 58, 205, 47, 133, 79, 91, 222, 194, 128, 107, 96, 149, 229, 65, 44, 180, 90, 90, 219, 103, 195,
-    183, 57, 116, 94, 8, 90, 73, 79, 173, 171, 157, 126, 91, 100, 144, 163, 117, 104, 129, 34, 14, 92, 122, 39, 141,
-    140, 96, 255, 231, 108, 87, 139, 51, 16, 152, 195, 31, 147, 194, 12, 40, 45, 105, 12, 238, 219, 179, 107, 144, 156,
-    91, 24, 44, 68, 33, 9, 85, 200, 251, 125, 229, 139, 160, 220, 103, 15, 13, 163, 125, 136, 243, 212, 167, 74, 185,
-    53, 67, 98, 220, 162, 8, 231, 54, 228, 191, 140, 37, 224, 164, 43, 189, 26, 169, 100, 205, 234, 228, 49, 94, 26, 53,
-    133, 14, 17, 82, 229, 153, 130, 26, 212, 145, 131, 206, 114, 55, 134, 102, 215, 28, 204, 127, 148, 34, 130, 141, 3,
-    51, 139, 39, 171, 38, 172, 104, 1, 84, 104, 161, 197, 176, 90, 232, 10, 153, 135, 211, 85, 80, 236, 237, 4, 188,
-    153, 38, 214, 210, 88, 15, 160, 166, 215, 88, 174, 235, 212, 30, 5, 101, 119, 194, 211, 107, 60, 123, 245, 187, 252,
-    108, 167, 198, 209, 222, 14, 244, 108, 104, 176, 245, 155, 149, 2, 177, 78, 253, 160, 230, 12, 178, 202, 174, 27,
-    219, 142, 150, 133, 213, 143, 241, 174, 229, 14, 104, 92, 193, 81, 100, 155, 67, 236, 123, 211, 230, 69, 98, 199,
-    217, 118, 251, 204, 232, 113, 56, 221, 99, 173, 186, 201, 40, 34, 87, 200, 41, 6, 82, 229, 140, 66, 118, 62, 214,
-    71, 196, 194, 228, 92, 6, 87, 138, 82, 219, 218, 249, 118, 244, 28, 234, 209, 84, 146, 182, 164, 15, 71, 56, 223,
-    241, 181, 177, 254, 169, 242, 167, 147, 118, 185, 15, 196, 54, 236, 0, 226, 243, 116, 150, 26, 130, 50, 87, 14, 46,
-    89, 217, 243, 1, 177, 11, 216, 93, 148, 105, 133, 196, 120, 132, 227, 197, 184, 161, 202, 242, 181, 239, 185, 8, 38,
-    78, 170, 175, 20, 190, 92, 76, 179, 189, 255, 12, 93, 249, 196, 88, 55, 209, 37, 230, 174, 139, 72, 93, 91, 48, 64,
-    178, 70, 2, 181, 8, 8, 3, 205, 98, 164, 75, 181, 88, 31, 29, 204, 107, 4, 255, 14, 156, 243, 210, 94, 91, 224, 67,
-    62, 98, 9, 226, 6, 160, 90, 152, 31, 54, 249, 187, 186, 154, 88, 29, 221, 85, 119, 127, 71, 80, 230, 5, 206, 170,
-    67, 33, 197, 154, 42, 0, 222, 216, 48, 147, 117, 223, 88, 212, 176, 72, 54, 66, 55, 133, 118, 243, 224, 79, 167, 66,
-    136, 53, 158, 0, 169, 17, 64, 174, 205, 172, 140, 155, 101, 84, 207, 45, 213, 107, 37, 15, 13, 152, 33, 133, 241,
-    122, 206, 194, 190, 186, 127, 52, 23, 104, 57, 211, 13, 52, 36, 46, 153, 69, 194, 171, 52, 42, 236, 191, 221, 176,
-    249, 131, 32, 198, 104, 244, 141, 3, 213, 254, 8, 201, 79, 139, 86, 129, 112, 204, 93, 217, 234, 62, 19, 149, 83,
-    69, 48, 226, 83, 150, 29, 33, 30, 138, 236, 133, 50, 195, 170, 57, 174, 121, 12, 154, 33, 178, 207, 90, 169, 127,
-    126, 27, 226, 140, 56, 88, 177, 40, 234, 20, 50, 68, 34, 30, 53, 132, 28, 229, 163, 164, 232, 224, 50, 46, 132, 1,
-    40, 96, 57, 80, 114, 226, 208, 51, 239, 233, 15, 190, 56, 242, 123, 167, 14, 96, 11, 8, 220, 227, 198, 137, 144, 59,
-    241, 215, 208, 62, 79, 54, 123, 155, 65, 238, 84, 161, 38, 95, 254, 2, 239, 157, 187, 195, 34, 145, 51, 147, 16,
-    211, 158, 90, 107, 223, 126, 213, 47, 205, 211, 113, 16, 174, 204, 119, 130, 88, 241, 177, 47, 42, 131, 119, 135,
-    96, 236, 109, 35, 99, 149, 201, 197, 156, 122, 207, 223, 193, 247, 196, 64, 240, 88, 134, 80, 106, 68, 70, 204, 77,
-    147, 170, 32, 91, 171, 11, 240, 115, 21, 113, 241, 189, 92, 64, 178, 197, 85, 205, 121, 2, 254, 15, 155, 79, 75, 72,
-    57, 136, 220, 51, 80, 87, 49, 105, 251, 64, 141, 65, 225, 182, 151, 55, 148, 87, 136, 113, 127, 159, 141, 100, 198,
-    33, 202, 73, 0, 160, 44, 221, 115, 25, 231, 119, 202, 123, 137, 45, 115, 129, 134, 28, 33, 44, 136, 80, 245, 222,
-    224, 82, 244, 81, 125, 177, 143, 221, 45, 179, 102, 158, 146, 144, 94, 83, 164, 93, 129, 107, 226, 121, 75, 249,
-    202, 147, 58, 125, 117, 251, 98, 36, 73, 88, 153, 135, 76, 160, 138, 170, 92, 118, 191, 136, 215, 49, 135, 63, 176,
-    192, 21, 86, 189, 84, 204, 52, 106, 7, 142, 69, 24, 253, 199, 205, 229, 254, 218, 243, 123, 189, 240, 15, 129, 105,
-    190, 152, 27, 22, 77, 0, 162, 63, 66, 161, 151, 34, 192, 29, 43, 6, 61, 120, 245, 225, 129, 143, 78, 25, 173, 105,
-    161, 82, 115, 95, 114, 85, 159, 65, 158, 24, 129, 102, 16, 41, 253, 176, 136, 199, 175, 211, 17, 140, 90, 63, 90,
-    80, 238, 95, 149, 152, 117, 87, 149, 162, 66, 190, 88, 121, 242, 32, 142, 85, 184, 239, 91, 237, 245, 73, 191, 148,
-    191, 192, 168, 61, 149, 239, 83, 170, 40, 233, 70, 58, 233, 153, 209, 152, 223, 31, 188, 133, 157, 183, 238, 50,
-    251, 192, 66, 230, 75, 103, 45, 129, 85, 87, 160, 231, 54, 168, 251, 107, 183, 219, 156, 212, 105, 28, 189, 223, 92,
-    76, 167, 138, 169, 49, 95, 84, 171, 127, 87, 210, 34, 113, 48, 72, 28, 91, 79, 241, 202, 21, 71, 165, 185, 21, 204,
-    28, 177, 195, 252, 148, 173, 52, 61, 244, 165, 220, 194, 68, 226, 238, 72, 220, 96, 203, 58, 108, 76, 23, 75, 172,
-    203, 231, 236, 90, 125, 233, 133, 84, 67, 96, 69, 168, 136, 252, 178, 82, 199, 202, 238, 127, 31, 123, 50, 13, 112,
-    26, 122, 27, 115, 87, 64, 133, 244, 207, 73, 108, 122, 57, 147, 221, 225, 223, 199, 98, 45, 7, 68, 62, 4, 61, 38,
-    183, 185, 244, 50, 80, 230, 98, 235, 49, 76, 54, 202, 248, 95, 248, 120, 209, 221, 193, 249, 66, 139, 148, 200, 181,
-    138, 113, 106, 214, 47, 58, 111, 227, 75, 219, 214, 215, 212, 147, 254, 7, 127, 53, 220, 148, 6, 16, 134, 123, 70,
-    87, 250, 183, 22, 227, 175, 63, 117, 125, 69, 232, 138, 15, 78, 59, 85, 27, 45, 222, 31, 221, 244, 211, 140, 33,
-    188, 246, 105, 110, 131, 37, 160, 177, 20, 41, 46, 52, 175, 6, 77, 206, 85, 211, 201, 61, 173, 80, 35, 214, 167,
-    162, 18, 185, 54, 111, 16, 214, 1, 132, 12, 111, 183, 182, 191, 38, 240, 182, 236, 115, 64, 64, 75, 69, 137, 112,
-    207, 92, 56, 231, 188, 142, 99, 173, 219, 44, 133, 9, 168, 229, 226, 122, 212, 253, 248, 120, 59, 40, 185, 58, 142,
-    44, 48, 14, 235, 26, 127, 239, 254, 17, 29, 6, 228, 113, 86, 243, 20, 235, 151, 223, 188, 1, 80, 187, 221, 170, 228,
-    55, 36, 78, 93, 204, 151, 189, 49, 202, 107, 154, 219, 202, 109, 46, 140, 106, 63, 112, 84, 155, 130, 115, 121, 102,
-    248, 76, 195, 198, 70, 119, 35, 238, 59, 108, 62, 89, 78, 198, 77, 156, 64, 210, 24, 217, 222, 207, 4, 175, 145, 83,
-    168, 158, 223, 132, 36, 195, 251, 160, 109, 216, 1, 127, 198, 32, 120, 47, 198, 41, 237, 217, 156, 23, 94, 110, 209,
-    189, 12, 203, 115, 139, 178, 252, 199, 79, 63, 187, 63, 149, 82, 50, 35, 69, 244, 32, 205, 84, 96, 47, 115, 156,
-    239, 133, 188, 139, 241, 234, 221, 102, 33, 137, 156, 114, 160, 248, 16, 233, 128, 41, 117, 172, 251, 144, 31, 39,
-    146, 203, 175, 61, 45, 8, 114, 45, 137, 117, 61, 2, 162, 142, 1, 236, 212, 251, 155, 59, 118, 226, 98, 20, 50, 223,
-    35, 197, 1, 85, 228, 19, 166, 11, 213, 16, 28, 220, 59, 153, 131, 155, 185, 142, 116, 111, 110, 216, 131, 130, 134,
-    142, 240, 46, 61, 97, 203, 52, 95, 94, 175, 46, 70, 254, 209, 8, 247, 161, 50, 98, 29, 214, 191, 159, 34, 106, 22,
-    105, 176, 86, 192, 77, 54, 165, 211, 160, 206, 238, 10, 149, 136, 61, 211, 63, 196, 137, 2, 122, 214, 129, 206, 94,
-    225, 109, 21, 113, 42, 229, 249, 113, 196, 190, 119, 7, 105, 163, 137, 1, 160, 235, 219, 184, 193, 129, 97, 23, 150,
-    39, 162, 184, 10, 44, 134, 18, 98, 2, 90, 106, 193, 57, 32, 75, 209, 120, 131, 182, 122, 46, 200, 40, 227, 174, 164,
-    12, 175, 18, 183, 15, 140, 119, 55, 249, 60, 88, 169, 237, 151, 44, 123, 230, 170, 194, 69, 81, 123, 247, 177, 102,
-    19, 181, 242, 59, 98, 0, 204, 228, 11, 1, 65, 30, 26, 165, 170, 146, 55, 254, 51, 7, 147, 49, 248, 165, 183, 1, 155,
-    152, 203, 190, 93, 127, 228, 99, 89, 133, 219, 119, 168, 149, 250, 235, 38, 193, 194, 80, 167, 23, 132, 202, 51,
-    201, 125, 223, 93, 97, 36, 102, 76, 131, 73, 173, 239, 205, 77, 161, 28, 213, 130, 52, 211, 137, 146, 233, 104, 106,
-    226, 241, 133, 83, 132, 107, 138, 211, 211, 6, 107, 53, 178, 58, 234, 2, 39, 209, 96, 64, 55, 28, 17, 163, 186, 234,
-    38, 148, 1, 153, 16, 86, 188, 12, 177, 138, 127, 159, 103, 110, 44, 6, 240, 193, 174, 41, 27, 216, 56, 59, 153, 56,
-    108, 49, 122, 73, 15, 218, 41, 253, 71, 194, 78, 82, 111, 131, 150, 70, 152, 153, 34, 142, 150, 52, 45, 85, 244, 12,
-    52, 47, 238, 200, 146, 16, 148, 182, 140, 128, 63, 135, 2, 159, 249, 154, 57, 125, 57, 199, 218, 253, 131, 243, 200,
-    126, 27, 174, 149, 245, 76, 149, 21, 26, 193, 243, 3, 130, 0, 14, 35, 38, 213, 195, 190, 4, 150, 150, 109, 151, 68,
-    246, 114, 223, 104, 128, 151, 244, 198, 94, 112, 101, 208, 94, 233, 189, 210, 146, 165, 234, 17, 147, 103, 69, 187,
-    108, 70, 73, 134, 106, 58, 13, 118, 33, 16, 16, 149, 139, 156, 85, 181, 64, 62, 161, 58, 73, 185, 50, 214, 244, 118,
-    86, 46, 168, 29, 226, 13, 33, 230, 167, 14, 18, 116, 99, 30, 248, 158, 78, 23, 20, 92, 76, 60, 98, 91, 225, 48, 250,
-    108, 96, 103, 169, 112, 65, 181, 77, 119, 90, 29, 112, 233, 196, 12, 111, 127, 109, 76, 169, 16, 153, 241, 25, 136,
-    114, 31, 196, 128, 176, 11, 9, 220, 38, 79, 83, 242, 176, 104, 106, 245, 230, 181, 224, 51, 13, 102, 9, 192, 45,
-    142, 48, 221, 196, 59, 38, 196, 61, 248, 98, 115, 248, 133, 205, 30, 219, 112, 157, 216, 150, 228, 188, 231, 128,
-    90, 249, 218, 138, 112, 38, 110, 197, 116, 151, 134, 219, 23, 75, 100, 71, 12, 151, 246, 88, 222, 16, 96, 159, 163,
-    25, 143, 94, 131, 233, 85, 134, 200, 254, 158, 58, 149, 185, 89, 174, 111, 206, 39, 253, 47, 151, 159, 42, 128, 235,
-    203, 231, 236, 0, 110, 130, 130, 18, 204, 134, 182, 132, 34, 209, 193, 253, 136, 146, 196, 60, 144, 239, 118, 32,
-    149, 89, 57, 23, 51, 138, 152, 164, 111, 53, 73, 29, 44, 33, 159, 29, 198, 228, 199, 189, 5, 119, 50, 76, 250, 25,
-    219, 122, 220, 15, 144, 214, 3, 202, 100, 93, 53, 89, 42, 107, 227, 147, 241, 181, 227, 93, 246, 137, 197, 30, 240,
-    224, 137, 172, 114, 1, 111, 92, 185, 161, 11, 3, 66, 33, 159, 221, 222, 123, 102, 124, 183, 89, 194, 96, 22, 139,
-    182, 35, 30, 28, 240, 182, 169, 13, 49, 164, 144, 148, 177, 4, 123, 214, 184, 254, 151, 94, 80, 136, 165, 129, 34,
-    164, 121, 195, 255, 187, 188, 142, 26, 158, 148, 147, 245, 79, 185, 224, 51, 191, 193, 31, 158, 217, 254, 58, 156,
-    144, 27, 162, 34, 11, 111, 2, 192, 136, 4, 248, 33, 75, 44, 78, 21, 222, 131, 174, 177, 254, 95, 10, 22, 9, 249, 81,
-    81, 162, 230, 176, 10, 85, 92, 83, 132, 104, 244, 46, 115, 4, 20, 45, 64, 3, 11, 90, 111, 205, 61, 41, 225, 129, 60,
-    215, 208, 89, 148, 126, 27, 78, 171, 200, 41, 122, 58, 49, 168, 252, 134, 102, 196, 28, 154, 96, 37, 127, 216, 54,
-    36, 12, 175, 67, 172, 142, 95, 194, 78, 195, 108, 93, 192, 204, 155, 174, 50, 214, 62, 15, 98, 182, 169, 221, 150,
-    92, 154, 86, 64, 132, 25, 224, 44, 192, 124, 134, 140, 160, 168, 242, 47, 143, 164, 66, 245, 20, 113, 106, 139, 189,
-    178, 74, 241, 185, 29, 122, 38, 185, 46, 74, 205, 254, 73, 142, 54, 154, 18, 25, 38, 166, 149, 146, 18, 5, 250, 185,
-    143, 155, 226, 172, 5, 219, 128, 110, 241, 118, 203, 24, 20, 211, 255, 52, 58, 35, 161, 19, 214, 213, 234, 223, 238,
-    32, 9, 181, 207, 96, 137, 197, 65, 41, 16, 62, 253, 53, 212, 42, 233, 9, 236, 149, 179, 50, 146, 79, 130, 91, 244,
-    96, 140, 168, 192, 84, 156, 241, 149, 71, 123, 77, 143, 77, 149, 119, 172, 28, 240, 95, 181, 224, 42, 103, 149, 33,
-    194, 195, 144, 133, 67, 190, 126, 26, 226, 19, 209, 69, 26, 119, 118, 83, 85, 212, 173, 201, 158, 206, 221, 83, 151,
-    211, 227, 196, 215, 24, 2, 77, 3, 109, 116, 105, 142, 201, 178, 52, 50, 130, 254, 66, 223, 240, 159, 215, 36, 111,
-    141, 137, 6, 222, 45, 37, 89, 127, 10, 95, 171, 91, 224, 225, 130, 128, 47, 154, 166, 31, 76, 250, 144, 100, 91,
-    221, 174, 25, 35, 160, 59, 54, 120, 15, 252, 14, 31, 63, 60, 62, 65, 247, 132, 59, 118, 134, 234, 27, 193, 187, 242,
-    84, 151, 217, 93, 121, 135, 204, 131, 100, 107, 242, 239, 75, 81, 202, 100, 170, 145, 175, 242, 64, 78, 79, 30, 144,
-    49, 99, 71, 52, 206, 143, 215, 130, 221, 31, 23, 213, 89, 24, 213, 118, 64, 151, 77, 33, 216, 61, 5, 102, 61, 207,
-    253, 194, 43, 184, 173, 37, 183, 195, 139, 0, 7, 90, 233, 99, 210, 212, 96, 51, 158, 21, 222, 40, 249, 194, 233,
-    168, 148, 11, 66, 129, 142, 92, 43, 99, 221, 139, 139, 108, 120, 125, 241, 5, 229, 232, 52, 129, 7, 221, 220, 187,
-    240, 65, 199, 47, 103, 188, 128, 254, 215, 53, 126, 137, 94, 102, 67, 133, 193, 14, 217, 243, 198, 94, 15, 151, 142,
-    185, 41, 71, 244, 195, 158, 245, 218, 112, 0, 42, 192, 117, 69, 241, 181, 161, 123, 73, 134, 102, 212, 5, 77, 128,
-    152, 104, 152, 207, 84, 81, 187, 29, 3, 225, 78, 164, 83, 232, 73, 8, 240, 177, 241, 242, 173, 205, 167, 31, 7, 235,
-    210, 126, 154, 69, 102, 193, 6, 34, 195, 231, 250, 125, 221, 98, 212, 32, 114, 169, 84, 177, 157, 219, 107, 28, 159,
-    121, 163, 87, 112, 142, 63, 57, 180, 149, 210, 237, 38, 226, 232, 141, 229, 102, 26, 166, 22, 44, 130, 51, 197, 65,
-    164, 152, 81, 11, 3, 138, 53, 35, 69, 206, 133, 4, 141, 166, 8, 31, 155, 9, 27, 240, 34, 234, 251, 144, 47, 170,
-    242, 113, 140, 21, 162, 63, 211, 129, 249, 57, 131, 161, 117, 8, 109, 74, 220, 249, 132, 203, 234, 178, 103, 189,
-    116, 240, 45, 207, 28, 191, 15, 166, 241, 224, 218, 151, 109, 169, 73, 83, 31, 73, 204, 53, 210, 3, 249, 35, 26, 0,
-    25, 148, 107, 44, 207, 36, 195, 32, 24, 137, 206, 242, 17, 194, 174, 254, 141, 202, 147, 169, 183, 165, 63, 215,
-    118, 80, 146, 89, 196, 226, 132, 74, 198, 34, 98, 210, 27, 212, 232, 66, 184, 77, 190, 239, 186, 101, 226, 126, 187,
-    48, 30, 104, 83, 152, 248, 60, 139, 112, 106, 118, 87, 126, 72, 78, 135, 196, 2, 27, 189, 149, 84, 9, 172, 80, 84,
-    207, 60, 39, 190, 136, 202, 113, 153, 132, 187, 21, 218, 149, 16, 33, 16, 232, 219, 123, 249, 129, 157, 120, 16,
-    125, 103, 133, 153, 238, 28, 208, 86, 90, 172, 219, 62, 254, 157, 129, 34, 108, 5, 234, 98, 161, 226, 134, 111, 206,
-    222, 222, 190, 105, 88, 23, 1, 34, 41, 152, 184, 181, 48, 245, 134, 169, 158, 35, 204, 10, 240, 229, 119, 1, 75,
-    210, 244, 106, 223, 10, 142, 236, 243, 228, 239, 63, 46, 128, 243, 246, 185, 193, 170, 5, 101, 240, 201, 171, 8,
-    236, 75, 183, 67, 129, 145, 70, 3, 42, 44, 2, 138, 149, 218, 206, 135, 192, 86, 106, 103, 6, 115, 92, 100, 167, 80,
-    135, 77, 96, 227, 134, 19, 193, 87, 168, 172, 228, 64, 98, 76, 156, 67, 131, 179, 189, 31, 31, 211, 119, 25, 229,
-    222, 171, 194, 211, 245, 22, 157, 157, 237, 105, 239, 50, 92, 117, 245, 4, 75, 62, 191, 58, 247, 78, 44, 10, 54,
-    122, 8, 114, 77, 9, 142, 123, 93, 243, 33, 158, 138, 247, 204, 193, 181, 77, 16, 90, 1, 136, 248, 47, 122, 76, 136,
-    96, 92, 56, 112, 91, 218, 217, 201, 157, 125, 27, 107, 15, 90, 223, 105, 106, 104, 13, 149, 165, 195, 208, 46, 211,
-    238, 231, 168, 46, 35, 19, 146, 159, 84, 222, 136, 82, 237, 41, 65, 137, 35, 230, 116, 245, 192, 134, 39, 207, 11,
-    27, 200, 246, 151, 62, 5, 170, 195, 86, 173, 26, 12, 45, 250, 227, 27, 185, 115, 79, 166, 60, 211, 242, 44, 146, 73,
-    150, 195, 236, 147, 165, 30, 194, 238, 82, 69, 71, 241, 248, 96, 81, 213, 107, 148, 226, 71, 129, 172, 1, 139, 52,
-    163, 96, 180, 195, 177, 118, 37, 2, 33, 42, 239, 220, 67, 195, 100, 207, 91, 130, 203, 59, 22, 30, 192, 37, 235,
-    179, 47, 63, 232, 129, 178, 240, 98, 184, 172, 203, 60, 243, 225, 118, 46, 8, 92, 157, 104, 25, 39, 155, 27, 253,
-    30, 239, 11, 225, 228, 228, 71, 61, 58, 67, 255, 253, 130, 70, 125, 70, 95, 164, 163, 167, 231, 239, 62, 114, 0,
-    250, 214, 146, 131, 90, 197, 94, 188, 90, 130, 177, 14, 53, 127, 237, 148, 163, 217, 34, 137, 67, 49, 83, 230, 36,
-    84, 117, 161, 73, 52, 100, 100, 53, 19, 202, 98, 76, 109, 225, 30, 222, 245, 49, 123, 69, 45, 232, 134, 235, 126, 4,
-    189, 239, 126, 136, 192, 93, 19, 187, 3, 140, 60, 97, 175, 191, 84, 58, 140, 103, 212, 102, 161, 242, 100, 7, 67,
-    26, 210, 255, 12, 151, 77, 100, 19, 70, 178, 8, 29, 216, 175, 132, 127, 194, 198, 72, 108, 252, 99, 252, 133, 126,
-    25, 95, 144, 47, 81, 196, 207, 62, 157, 216, 247, 216, 238, 55, 47, 93, 151, 113, 135, 202, 190, 102, 120, 97, 72,
-    157, 113, 64, 58, 112, 67, 124, 198, 156, 148, 196, 250, 84, 228, 131, 66, 179, 87, 248, 2, 169, 146, 207, 146, 142,
-    236, 226, 151, 214, 167, 125, 130, 19, 46, 156, 26, 77, 132, 24, 100, 254, 245, 52, 164, 101, 13, 171, 12, 124, 6,
-    62, 93, 207, 19, 200, 164, 197, 245, 70, 159, 29, 237, 79, 64, 138, 39, 166, 61, 103, 8, 69, 140, 228, 27, 98, 0,
-    209, 57, 167, 144, 46, 241, 90, 223, 81, 93, 3, 195, 209, 132, 251, 237, 55, 202, 38, 209, 225, 185, 50, 244, 33,
-    64, 199, 174, 140, 140, 160, 103, 87, 188, 3, 211, 231, 37, 166, 175, 71, 18, 38, 179, 169, 140, 150, 185, 80, 224,
-    187, 182, 165, 34, 12, 88, 114, 201, 72, 248, 37, 210, 176, 170, 95, 24, 43, 205, 133, 120, 65, 216, 188, 217, 39,
-    43, 225, 126, 96, 144, 34, 229, 248, 86, 172, 191, 41, 122, 142, 14, 100, 57, 217, 245, 243, 18, 173, 204, 42, 111,
-    98, 117, 198, 89, 196, 66, 203, 86, 76, 97, 122, 84, 0, 122, 28, 69, 226, 170, 238, 112, 121, 33, 222, 183, 27, 48,
-    124, 247, 223, 148, 104, 154, 164, 112, 89, 148, 5, 23, 60, 149, 94, 103, 206, 96, 201, 214, 198, 17, 187, 190, 128,
-    77, 219, 79, 178, 234, 255, 172, 58, 137, 176, 145, 241, 107, 151, 227, 187, 204, 214, 219, 185, 177, 141, 148, 239,
-    63, 210, 250, 181, 145, 219, 60, 254, 64, 115, 178, 246, 129, 246, 211, 64, 196, 111, 204, 108, 79, 27, 86, 34, 247,
-    233, 245, 130, 225, 99, 72, 40, 25, 60, 70, 192, 191, 162, 46, 123, 11, 235, 125, 113, 159, 120, 219, 17, 129, 249,
-    138, 250, 213, 92, 224, 164, 116, 222, 112, 105, 16, 3, 244, 156, 224, 104, 140, 33, 24, 117, 35, 159, 120, 215,
-    178, 104, 207, 246, 96, 185, 142, 99, 216, 35, 48, 0, 73, 97, 93, 139, 50, 49, 102, 113, 62, 7, 166, 165, 241, 183,
-    100, 254, 66, 117, 114, 249, 27, 60, 95, 154, 202, 79, 31, 58, 198, 182, 165, 254, 222, 89, 124, 137, 46, 156, 92,
-    19, 251, 166, 151, 193, 111, 158, 116, 99, 69, 106, 79, 104, 95, 124, 237, 55, 63, 50, 46, 8, 171, 60, 92, 9, 18,
-    189, 241, 172, 94, 25, 104, 122, 80, 46, 122, 51, 152, 194, 193, 77, 236, 117, 234, 26, 133, 254, 127, 1, 107, 179,
-    93, 138, 248, 110, 152, 37, 246, 19, 98, 22, 189, 136, 61, 222, 190, 113, 46, 36, 111, 145, 214, 234, 128, 165, 93,
-    112, 128, 219, 188, 66, 63, 161, 5, 65, 14, 245, 233, 132, 61, 44, 0, 61, 85, 166, 227, 59, 93, 239, 124, 229, 62,
-    228, 252, 252, 210, 124, 231, 41, 10, 225, 48, 90, 167, 116, 13, 137, 14, 72, 12, 74, 164, 85, 231, 159, 228, 179,
-    172, 18, 38, 131, 81, 40, 81, 66, 99, 62, 138, 32, 154, 8, 197, 182, 40, 175, 125, 35, 68, 144, 7, 252, 154, 185,
-    26, 238, 118, 91, 67, 53, 40, 26, 108, 185, 39, 249, 63, 68, 156, 207, 63, 206, 60, 244, 94, 109, 39, 5, 124, 66,
-    59, 26, 89, 163, 40, 220, 171, 34, 233, 50, 236, 213, 253, 87, 145, 21, 57, 11, 14, 185, 26, 155, 15, 25, 103, 25,
-    251, 187, 57, 158, 116, 83, 221, 111, 3, 131, 54, 39, 23, 51, 61, 135, 55, 162, 183, 193, 199, 210, 209, 13, 170,
-    179, 148, 240, 87, 156, 74, 227, 70, 173, 249, 9, 62, 158, 164, 138, 200, 246, 75, 29, 196, 89, 82, 145, 51, 88,
-    135, 193, 197, 238, 84, 152, 123, 106, 205, 216, 226, 54, 245, 209, 56, 68, 130, 80, 232, 250, 78, 245, 226, 32, 31,
-    149, 44, 235, 96, 239, 49, 151, 82, 137, 199, 100, 211, 82, 216, 170, 112, 49, 210, 94, 215, 236, 59, 86, 7, 81, 87,
-    205, 62, 38, 70, 128, 166, 119, 26, 151, 134, 27, 141, 174, 61, 59, 196, 104, 204, 11, 70, 46, 142, 65, 92, 8, 127,
-    40, 246, 159, 80, 148, 172, 54, 161, 56, 80, 201, 152, 105, 56, 171, 227, 82, 57, 105, 131, 227, 139, 127, 211, 46,
-    182, 12, 179, 6, 212, 151, 41, 187, 68, 213, 228, 92, 28, 119, 88, 83, 54, 41, 250, 83, 210, 171, 106, 74, 84, 205,
-    227, 199, 108, 73, 15, 221, 6, 42, 82, 128, 2, 99, 116, 247, 180, 184, 245, 13, 93, 94, 75, 111, 50, 46, 50, 4, 150,
-    83, 127, 66, 26, 210, 62, 219, 127, 105, 220, 212, 223, 251, 87, 251, 240, 230, 114, 137, 184, 177, 155, 175, 216,
-    163, 80, 22, 62, 86, 213, 128, 111, 244, 151, 47, 101, 165, 234, 121, 117, 189, 39, 161, 12, 26, 255, 179, 2, 116,
-    242, 177, 30, 58, 228, 242, 47, 65, 250, 242, 134, 243, 227, 50, 120, 16, 97, 111, 249, 83, 131, 183, 146, 254, 92,
-    48, 241, 78, 239, 255, 6, 116, 119, 106, 215, 219, 88, 58, 213, 200, 184, 3, 148, 56, 218, 253, 16, 159, 53, 137,
-    243, 108, 187, 146, 124, 138, 2, 3, 234, 58, 64, 47, 139, 91, 84, 45, 146, 191, 48, 81, 133, 155, 34, 23, 4, 199, 0,
-    117, 129, 186, 251, 79, 169, 14, 14, 75, 139, 210, 255, 131, 39, 77, 174, 84, 80, 223, 141, 123, 205, 9, 179, 27,
-    26, 255, 212, 73, 202, 46, 26, 248, 121, 218, 24, 41, 235, 57, 169, 192, 25, 236, 155, 58, 36, 120, 33, 202, 198,
-    113, 141, 100, 111, 164, 130, 206, 56, 107, 140, 94, 172, 169, 70, 164, 123, 131, 106, 219, 87, 235, 230, 202, 112,
-    200, 177, 94, 19, 236, 125, 201, 234, 126, 63, 45, 234, 39, 102, 163, 45, 7, 157, 21, 93, 122, 58, 211, 122, 64,
-    199, 124, 13, 144, 224, 195, 91, 112, 215, 83, 5, 108, 132, 198, 170, 228, 233, 8, 55, 107, 54, 89, 51, 227, 28,
-    204, 78, 137, 150, 69, 108, 23, 192, 152, 95, 48, 120, 205, 208, 111, 211, 170, 247, 232, 117, 77, 117, 89, 205,
-    189, 188, 118, 157, 244, 77, 145, 111, 123, 250, 3, 4, 149, 55, 126, 224, 192, 254, 104, 132, 227, 169, 86, 72, 157,
-    62, 198, 35, 11, 171, 164, 92, 4, 33, 249, 210, 44, 79, 89, 175, 180, 118, 198, 210, 82, 34, 96, 170, 37, 223, 15,
-    26, 94, 76, 73, 83, 180, 30, 238, 117, 100, 86, 31, 196, 236, 110, 108, 207, 122, 200, 42, 122, 187, 7, 221, 192,
-    22, 192, 6, 222, 58, 233, 11, 228, 159, 232, 177, 39, 80, 64, 19, 187, 205, 204, 126, 32, 171, 21, 61, 109, 113,
-    179, 186, 76, 66, 96, 100, 12, 23, 145, 47, 184, 215, 200, 188, 222, 216, 170, 26, 210, 156, 37, 72, 104, 173, 202,
-    43, 39, 18, 152, 78, 79, 151, 81, 83, 93, 36, 78, 50, 80, 63, 105, 58, 13, 236, 231, 107, 82, 36, 142, 155, 67, 32,
-    128, 239, 204, 220, 9, 30, 113, 203, 215, 38, 227, 117, 82, 175, 3, 196, 185, 20, 80, 121, 71, 73, 17, 30, 244, 56,
-    66, 55, 103, 239, 165, 246, 248, 194, 49, 219, 209, 161, 101, 208, 112, 250, 212, 12, 156, 181, 197, 135, 173, 156,
-    232, 68, 204, 181, 231, 135, 95, 140, 67, 100, 228, 169, 239, 170, 154, 66, 129, 83, 213, 109, 86, 183, 22, 227, 79,
-    168, 26, 16, 230, 49, 153, 117, 20, 239, 203, 4, 93, 243, 34, 7, 179, 165, 231, 144, 231, 155, 80, 58, 56, 34, 218,
-    32, 178, 123, 115, 50, 146, 21, 50, 13, 88, 147, 247, 223, 15, 114, 5, 157, 238, 99, 9, 86, 169, 161, 239, 139, 182,
-    58, 175, 22, 24, 141, 154, 97, 194, 222, 212, 187, 82, 196, 199, 212, 209, 177, 34, 139, 81, 165, 25, 90, 85, 2,
-    180, 76, 53, 71, 94, 235, 49, 127, 189, 9, 61, 32, 75, 235, 103, 178, 22, 35, 199, 235, 223, 83, 137, 226, 151, 233,
-    223, 123, 231, 216, 163, 156, 126, 147, 49, 52, 48, 39, 174, 191, 178, 196, 177, 212, 75, 114, 209, 68, 94, 168, 21,
-    101, 64, 236, 184, 19, 202, 105, 74, 214, 176, 86, 255, 59, 30, 182, 48, 225, 209, 167, 76, 83, 202, 196, 194, 182,
-    103, 163, 48, 177, 190, 199, 16, 227, 235, 103, 85, 61, 218, 41, 30, 175, 65, 39, 112, 114, 32, 75, 111, 94, 182,
-    199, 88, 135, 93, 49, 72, 240, 132, 79, 0, 107, 227, 153, 250, 239, 24, 185, 152, 137, 220, 205, 108, 20, 250, 175,
-    193, 70, 47, 89, 4, 0, 65, 163, 92, 133, 116, 127, 148, 14, 167, 182, 47, 54, 6, 17, 140, 87, 253, 208, 233, 211,
-    238, 193, 150, 28, 245, 95, 47, 216, 199, 92, 125, 108, 216, 168, 206, 159, 174, 216, 24, 163, 54, 248, 190, 224, 0,
-    11, 170, 133, 71, 227, 92, 147, 85, 255, 83, 179, 109, 35, 147, 127, 250, 96, 244, 210, 107, 105, 222, 3, 100, 15,
-    181, 26, 163, 168, 38, 52, 60, 237, 156, 133, 79, 92, 151, 199, 13, 15, 94, 189, 26, 31, 82, 98, 90, 216, 194, 1,
-    208, 250, 99, 201, 24, 10, 169, 181, 13, 31, 209, 67, 16, 134, 106, 6, 146, 137, 93, 250, 21, 130, 83, 69, 68, 45,
-    171, 94, 241, 71, 119, 127, 41, 20, 102, 132, 11, 76, 202, 134, 199, 194, 177, 246, 77, 163, 40, 11, 30, 122, 100,
-    150, 255, 59, 5, 224, 156, 29, 240, 3, 49, 52, 72, 208, 7, 199, 119, 163, 132, 23, 215, 81, 128, 203, 78, 77, 80,
-    84, 193, 16, 227, 113, 46, 167, 196, 112, 212, 201, 158, 67, 103, 17, 97, 229, 217, 92, 224, 42, 247, 191, 193, 224,
-    221, 239, 214, 211, 188, 168, 213, 116, 68, 8, 29, 46, 131, 154, 230, 84, 87, 111, 153, 0, 239, 214, 255, 140, 10,
-    168, 151, 254, 236, 132, 221, 38, 185, 60, 230, 62, 95, 231, 243, 247, 15, 134, 117, 124, 186, 207, 117, 165, 79,
-    59, 5, 192, 147, 232, 91, 15, 154, 90, 143, 66, 168, 162, 244, 163, 60, 176, 79, 154, 246, 208, 84, 80, 241, 15,
-    158, 184, 255, 99, 244, 157, 218, 238, 174, 210, 167, 63, 0, 61, 247, 143, 175, 75, 219, 249, 54, 231, 69, 145, 66,
-    243, 161, 39, 69, 189, 69, 163, 33, 197, 140, 254, 42, 51, 244, 175, 51, 21, 192, 25, 34, 235, 33, 144, 37, 195, 98,
-    37, 239, 5, 146, 138, 14, 213, 163, 58, 248, 183, 183, 255, 59, 199, 197, 47, 29, 109, 39, 131, 9, 62, 219, 246, 5,
-    188, 57, 161, 1, 224, 3, 0, 50, 245, 217, 184, 91, 193, 143, 202, 211, 18, 31, 47, 145, 132, 101, 147, 93, 114, 111,
-    108, 182, 53, 122, 220, 206, 34, 147, 225, 142, 6, 163, 237, 235, 124, 107, 186, 56, 166, 182, 108, 70, 224, 164,
-    206, 64, 23, 138, 73, 238, 66, 243, 181, 202, 224, 168, 36, 30, 220, 193, 127, 114, 94, 199, 217, 242, 224, 198, 25,
-    219, 94, 240, 48, 1, 158, 1, 113, 155, 182, 175, 224, 98, 167, 59, 45, 155, 70, 138, 44, 178, 75, 21, 167, 29, 48,
-    230, 37, 119, 157, 60, 192, 110, 87, 188, 182, 56, 9, 98, 0, 131, 27, 167, 196, 155, 225, 166, 10, 211, 208, 191,
-    58, 185, 170, 254, 131, 59, 201, 171, 156, 40, 88, 24, 6, 22, 207, 119, 220, 236, 179, 201, 42, 119, 15, 59, 119,
-    161, 52, 148, 179, 42, 242, 201, 69, 230, 251, 48, 79, 186, 58, 235, 152, 75, 209, 60, 19, 52, 123, 129, 55, 191,
-    96, 117, 178, 66, 148, 13, 54, 137, 34, 211, 186, 79, 73, 203, 183, 128, 206, 111, 71, 71, 1, 60, 176, 4, 6, 147,
-    215, 38, 135, 27, 215, 158, 123, 125, 70, 12, 237, 10, 152, 129, 50, 156, 69, 56, 136, 53, 248, 254, 212, 143, 177,
-    17, 3, 131, 22, 223, 140, 212, 220, 161, 194, 79, 120, 207, 178, 50, 56, 188, 111, 213, 76, 110, 99, 219, 111, 1,
-    227, 231, 37, 137, 190, 199, 135, 159, 184, 254, 211, 205, 233, 246, 148, 7, 177, 161, 156, 180, 181, 166, 64, 34,
-    95, 201, 108, 82, 25, 182, 64, 6, 186, 7, 79, 247, 59, 157, 3, 226, 165, 51, 13, 151, 176, 61, 54, 143, 9, 121, 108,
-    225, 40, 23, 143, 32, 128, 82, 200, 187, 58, 172, 50, 133, 153, 79, 54, 159, 168, 229, 111, 123, 232, 80, 228, 126,
-    251, 221, 31, 206, 42, 17, 63, 110, 83, 245, 50, 49, 92, 152, 190, 182, 11, 255, 42, 18, 100, 118, 27, 96, 170, 10,
-    69, 57, 21, 112, 236, 49, 14, 131, 219, 166, 151, 122, 194, 97, 196, 160, 23, 66, 130, 196, 234, 254, 28, 106, 62,
-    111, 167, 96, 2, 35, 134, 168, 78, 171, 6, 202, 169, 6, 170, 22, 107, 8, 122, 136, 249, 20, 146, 89, 98, 165, 167,
-    107, 128, 31, 109, 121, 213, 135, 138, 68, 164, 248, 15, 238, 89, 180, 75, 175, 150, 7, 149, 83, 64, 101, 179, 78,
-    18, 253, 200, 124, 55, 87, 215, 231, 50, 189, 201, 216, 41, 233, 223, 17, 145, 98, 67, 19, 108, 16, 189, 187, 101,
-    171, 202, 199, 160, 2, 95, 25, 179, 82, 178, 220, 94, 21, 89, 85, 124, 24, 197, 68, 188, 173, 95, 12, 75, 107, 99,
-    33, 134, 145, 33, 91, 78, 146, 11, 16, 83, 217, 254, 61, 200, 216, 194, 239, 42, 153, 175, 193, 182, 133, 47, 117,
-    123, 20, 130, 36, 226, 144, 115, 110, 14, 71, 45, 169, 4, 148, 109, 76, 81, 145, 88, 6, 114, 104, 55, 239, 174, 112,
-    243, 51, 92, 20, 30, 150, 185, 229, 137, 76, 121, 184, 30, 38, 218, 137, 14, 0, 8, 200, 58, 64, 107, 86, 237, 64,
-    107, 131, 186, 202, 190, 197, 214, 254, 60, 45, 3, 16, 161, 208, 27, 229, 220, 94, 222, 229, 42, 106, 150, 183, 206,
-    67, 223, 167, 3, 58, 187, 143, 173, 77, 208, 104, 243, 218, 72, 42, 220, 61, 175, 159, 6, 56, 141, 9, 254, 116, 29,
-    144, 149, 52, 204, 24, 255, 6, 51, 32, 216, 181, 195, 79, 247, 232, 221, 63, 160, 18, 112, 152, 179, 101, 135, 53,
-    93, 126, 245, 216, 153, 181, 82, 203, 70, 94, 227, 148, 219, 77, 5, 180, 205, 241, 171, 159, 86, 70, 124, 46, 243,
-    182, 132, 218, 180, 175, 169, 21, 128, 16, 146, 8, 231, 101, 255, 98, 250, 222, 228, 226, 184, 17, 21, 54, 128, 207,
-    123, 112, 119, 57, 179, 173, 243, 221, 254, 98, 31, 56, 94, 236, 96, 210, 59, 6, 252, 249, 144, 159, 238, 127, 194,
-    225, 183, 35, 158, 64, 200, 52, 116, 168, 60, 200, 110, 88, 138, 240, 86, 82, 214, 187, 165, 201, 34, 0, 237, 71,
-    181, 246, 140, 177, 36, 238, 183, 9, 42, 58, 34, 251, 89, 210, 200, 72, 196, 152, 122, 1, 51, 134, 253, 50, 85, 249,
-    135, 57, 34, 24, 167, 170, 146, 11, 160, 190, 122, 178, 19, 136, 101, 133, 70, 133, 99, 76, 16, 82, 18, 151, 207,
-    66, 177, 45, 30, 6, 5, 77, 153, 44, 165, 241, 31, 131, 128, 135, 122, 255, 65, 58, 27, 201, 167, 30, 234, 214, 207,
-    103, 85, 85, 111, 59, 179, 143, 221, 138, 159, 217, 166, 44, 18, 148, 186, 74, 56, 119, 72, 62, 49, 170, 23, 87, 1,
-    135, 27, 226, 217, 23, 211, 236, 204, 163, 83, 103, 248, 25, 183, 135, 47, 201, 221, 48, 133, 233, 113, 0, 39, 65,
-    108, 210, 108, 51, 57, 135, 226, 160, 91, 43, 225, 17, 207, 57, 102, 111, 178, 219, 239, 61, 249, 28, 52, 137, 32,
-    106, 29, 248, 241, 161, 239, 28, 95, 146, 59, 154, 118, 9, 133, 140, 63, 161, 34, 83, 160, 31, 18, 207, 68, 232, 34,
-    140, 73, 22, 0, 173, 144, 86, 49, 251, 255, 25, 187, 58, 170, 177, 137, 75, 117, 202, 96, 145, 186, 226, 211, 244,
-    90, 30, 125, 119, 152, 14, 122, 186, 33, 176, 118, 7, 73, 164, 126, 52, 110, 35, 216, 174, 212, 52, 101, 171, 64,
-    239, 167, 36, 222, 195, 189, 101, 97, 74, 203, 223, 125, 170, 252, 199, 141, 95, 156, 97, 239, 225, 144, 246, 162,
-    221, 241, 24, 79, 93, 213, 117, 176, 239, 115, 7, 101, 13, 132, 35, 89, 136, 248, 112, 142, 68, 244, 238, 132, 91,
-    205, 236, 145, 23, 27, 162, 9, 91, 23, 27, 96, 253, 18, 171, 242, 124, 95, 138, 50, 47, 233, 68, 21, 96, 227, 252,
-    174, 158, 143, 7, 171, 91, 113, 150, 206, 180, 228, 111, 197, 239, 32, 243, 209, 181, 57, 233, 33, 107, 177, 255,
-    167, 87, 253, 68, 208, 239, 198, 175, 43, 22, 212, 232, 151, 143, 15, 53, 169, 89, 92, 204, 18, 94, 228, 147, 4,
-    205, 234, 160, 98, 231, 178, 92, 95, 106, 255, 40, 55, 200, 163, 165, 126, 4, 14, 112, 5, 208, 20, 125, 242, 104,
-    72, 219, 169, 192, 0, 199, 211, 91, 223, 53, 68, 185, 140, 200, 69, 9, 142, 83, 184, 33, 127, 56, 241, 181, 177, 65,
-    147, 223, 96, 132, 64, 221, 54, 233, 34, 179, 78, 109, 38, 120, 236, 238, 198, 124, 6, 68, 5, 128, 75, 241, 139,
-    210, 203, 222, 82, 104, 184, 97, 18, 88, 235, 84, 136, 106, 59, 72, 134, 243, 178, 43, 17, 198, 204, 197, 54, 183,
-    67, 233, 73, 122, 115, 72, 57, 50, 77, 155, 1, 237, 126, 131, 101, 74, 253, 74, 194, 0, 97, 241, 114, 103, 145, 208,
-    47, 36, 123, 169, 188, 3, 172, 183, 118, 74, 241, 13, 117, 68, 109, 12, 195, 169, 246, 198, 239, 2, 131, 231, 229,
-    189, 205, 233, 190, 10, 218, 144, 225, 144, 60, 56, 241, 79, 152, 159, 251, 215, 217, 174, 243, 31, 20, 51, 87, 98,
-    74, 101, 117, 159, 32, 75, 140, 107, 36, 252, 33, 60, 114, 181, 50, 88, 252, 148, 58, 139, 31, 64, 105, 133, 174,
-    21, 166, 162, 214, 165, 229, 8, 70, 111, 4, 39, 55, 6, 124, 199, 135, 210, 129, 188, 152, 28, 101, 30, 90, 130, 139,
-    27, 250, 210, 135, 108, 89, 39, 199, 174, 36, 23, 155, 52, 198, 133, 17, 109, 83, 77, 220, 104, 29, 56, 101, 142,
-    21, 110, 55, 72, 120, 104, 77, 117, 241, 242, 204, 11, 217, 232, 20, 59, 221, 200, 39, 18, 198, 136, 102, 249, 245,
-    207, 77, 133, 2, 181, 249, 29, 190, 56, 108, 31, 45, 36, 90, 25, 176, 74, 206, 42, 238, 193, 47, 134, 15, 176, 48,
-    46, 104, 171, 149, 92, 25, 188, 10, 80, 51, 101, 100, 165, 60, 228, 216, 3, 146, 201, 168, 153, 170, 157, 12, 32,
-    19, 221, 134, 102, 145, 105, 237, 197, 21, 118, 140, 106, 32, 207, 156, 191, 195, 11, 171, 29, 224, 248, 178, 57,
-    75, 167, 94, 215, 76, 104, 129, 186, 167, 36, 223, 209, 124, 232, 56, 122, 206, 72, 190, 116, 246, 159, 59, 166,
-    125, 154, 204, 229, 237, 59, 155, 15, 59, 188, 1, 4, 26, 91, 229, 233, 237, 116, 191, 188, 170, 28, 121, 104, 36,
-    222, 79, 172, 220, 96, 52, 198, 128, 251, 75, 84, 63, 21, 178, 62, 198, 115, 19, 141, 177, 91, 229, 66, 8, 158, 134,
-    108, 133, 173, 123, 173, 69, 83, 170, 215, 191, 61, 169, 140, 53, 220, 139, 201, 47, 91, 29, 236, 60, 210, 36, 112,
-    252, 231, 44, 98, 24, 29, 229, 72, 106, 217, 167, 92, 245, 190, 165, 125, 43, 60, 128, 16, 145, 194, 190, 207, 119,
-    205, 13, 243, 217, 137, 64, 149, 169, 29, 221, 76, 27, 153, 243, 43, 117, 15, 204, 213, 195, 24, 237, 27, 188, 250,
-    166, 79, 255, 178, 210, 112, 207, 237, 91, 58, 237, 19, 68, 107, 129, 143, 146, 108, 190, 2, 240, 91, 187, 207, 46,
-    17, 165, 50, 6, 30, 116, 19, 71, 77, 196, 82, 225, 19, 112, 114, 11, 136, 123, 10, 101, 241, 186, 205, 246, 238, 90,
-    99, 73, 246, 143, 220, 106, 194, 143, 15, 37, 68, 208, 59, 57, 219, 43, 85, 96, 114, 3, 52, 107, 88, 38, 64, 93, 10,
-    254, 104, 220, 124, 41, 0, 38, 117, 183, 38, 8, 88, 169, 223, 64, 235, 240, 72, 15, 212, 70, 9, 209, 152, 139, 107,
-    189, 77, 174, 8, 62, 47, 109, 95, 222, 135, 93, 212, 186, 121, 199, 24, 235, 172, 181, 15, 246, 28, 14, 196, 191,
-    155, 186, 215, 211, 70, 128, 178, 35, 48, 27, 75, 7, 225, 4, 209, 45, 158, 208, 143, 150, 14, 139, 62, 34, 7, 100,
-    210, 178, 25, 109, 161, 243, 214, 153, 66, 97, 14, 216, 58, 218, 184, 252, 245, 121, 235, 126, 53, 238, 102, 99,
-    117, 199, 207, 54, 154, 157, 108, 39, 107, 57, 242, 108, 45, 93, 5, 26, 238, 169, 59, 150, 155, 156, 97, 201, 3,
-    226, 209, 132, 250, 157, 22, 67, 30, 65, 85, 116, 145, 48, 222, 147, 122, 163, 176, 162, 76, 103, 144, 21, 1, 84,
-    123, 173, 167, 150, 248, 67, 141, 225, 106, 226, 177, 100, 77, 22, 20, 186, 72, 101, 72, 124, 43, 152, 129, 60, 181,
-    194, 209, 231, 244, 193, 103, 174, 80, 149, 221, 250, 152, 37, 139, 254, 0, 108, 4, 47, 161, 197, 93, 150, 13, 4,
-    123, 190, 25, 219, 80, 28, 9, 244, 66, 252, 81, 255, 151, 246, 245, 36, 147, 61, 35, 37, 236, 73, 20, 46, 32, 224,
-    205, 48, 75, 240, 8, 121, 7, 176, 17, 63, 215, 75, 176, 234, 57, 138, 215, 9, 137, 252, 83, 234, 223, 75, 117, 82,
-    229, 98, 122, 245, 117, 120, 104, 191, 78, 245, 40, 81, 247, 193, 173, 219, 42, 114, 57, 115, 6, 55, 22, 121, 97,
-    102, 227, 35, 39, 64, 172, 210, 56, 109, 139, 76, 66, 22, 113, 143, 43, 238, 228, 38, 85, 59, 90, 137, 111, 152, 69,
-    167, 140, 84, 79, 146, 66, 15, 92, 93, 11, 11, 202, 212, 249, 167, 235, 6, 126, 91, 240, 166, 45, 94, 131, 29, 156,
-    44, 107, 171, 211, 166, 183, 234, 92, 251, 158, 119, 166, 123, 244, 255, 53, 87, 51, 148, 197, 164, 156, 125, 79,
-    141, 94, 75, 191, 126, 130, 23, 210, 126, 24, 85, 172, 237, 84, 123, 131, 165, 39, 193, 22, 250, 252, 153, 4, 36,
-    216, 13, 108, 20, 8, 174, 178, 62, 83, 90, 214, 71, 248, 231, 191, 241, 28, 154, 17, 140, 163, 116, 121, 27, 81, 41,
-    168, 201, 57, 85, 187, 106, 248, 110, 222, 233, 48, 82, 164, 237, 210, 230, 249, 231, 187, 249, 5, 228, 23, 26, 120,
-    49, 21, 248, 2, 33, 249, 29, 104, 20, 206, 26, 216, 100, 31, 107, 21, 154, 155, 48, 89, 235, 236, 200, 64, 173, 186,
-    72, 79, 167, 156, 85, 234, 171, 228, 98, 224, 164, 196, 153, 200, 252, 244, 179, 131, 213, 234, 28, 35, 140, 59,
-    211, 75, 3, 196, 126, 226, 79, 42, 53, 226, 171, 111, 139, 142, 135, 146, 49, 37, 125, 255, 50, 72, 236, 128, 66,
-    187, 13, 1, 201, 210, 114, 13, 221, 101, 36, 185, 78, 80, 127, 100, 163, 199, 6, 166, 17, 70, 53, 21, 78, 150, 102,
-    170, 158, 255, 185, 205, 142, 13, 10, 23, 176, 181, 143, 114, 89, 243, 226, 13, 193, 207, 162, 233, 222, 237, 182,
-    186, 173, 131, 91, 241, 40, 52, 24, 143, 47, 55, 54, 81, 66, 116, 234, 159, 108, 195, 176, 115, 42, 249, 215, 51,
-    68, 181, 37, 248, 163, 240, 35, 156, 110, 12, 188, 230, 206, 236, 190, 6, 104, 125, 1, 41, 87, 121, 22, 149, 115,
-    240, 158, 162, 105, 77, 116, 228, 227, 181, 238, 147, 253, 35, 199, 151, 102, 163, 156, 44, 117, 48, 248, 209, 215,
-    111, 114, 141, 237, 242, 245, 192, 160, 156, 25, 24, 44, 49, 199, 81, 89, 168, 156, 111, 146, 105, 79, 91, 225, 15,
-    37, 135, 195, 163, 7, 65, 253, 142, 178, 189, 184, 149, 230, 81, 168, 144, 44, 189, 111, 172, 218, 63, 92, 2, 163,
-    244, 139, 117, 250, 76, 157, 207, 19, 95, 142, 232, 160, 132, 81, 78, 26, 57, 22, 21, 170, 235, 64, 62, 219, 24, 0,
-    106, 212, 228, 142, 153, 21, 108, 152, 179, 225, 167, 52, 227, 44, 196, 174, 239, 67, 184, 166, 179, 89, 10, 59,
-    204, 245, 192, 165, 4, 230, 225, 222, 127, 202, 216, 194, 114, 238, 126, 190, 16, 196, 227, 46, 246, 3, 112, 233,
-    67, 19, 76, 10, 234, 204, 213, 36, 180, 117, 136, 58, 31, 172, 99, 223, 247, 215, 213, 249, 112, 185, 165, 125, 24,
-    99, 244, 57, 75, 18, 76, 230, 157, 251, 36, 238, 74, 99, 149, 118, 147, 68, 46, 83, 232, 216, 12, 169, 244, 175,
-    192, 91, 139, 178, 55, 126, 106, 227, 117, 240, 173, 212, 181, 252, 133, 209, 13, 165, 142, 94, 68, 123, 188, 214,
-    209, 180, 203, 113, 13, 13, 190, 44, 68, 149, 26, 11, 203, 88, 204, 112, 217, 29, 28, 28, 33, 193, 10, 231, 105,
-    221, 21, 193, 46, 135, 110, 115, 159, 90, 173, 43, 164, 77, 44, 97, 42, 90, 48, 33, 74, 157, 89, 254, 119, 175, 1,
-    23, 9, 186, 182, 194, 95, 49, 191, 153, 157, 217, 201, 13, 204, 130, 154, 37, 78, 20, 35, 65, 62, 210, 108, 158, 45,
-    186, 51, 204, 252, 192, 214, 249, 159, 154, 240, 133, 129, 68, 109, 89, 185, 63, 3, 217, 254, 54, 250, 205, 244,
-    135, 50, 127, 240, 248, 243, 146, 219, 157, 60, 81, 164, 224, 48, 154, 144, 137, 65, 243, 164, 17, 134, 163, 247,
-    232, 85, 55, 11, 96, 63, 198, 251, 13, 7, 25, 98, 18, 116, 60, 8, 227, 221, 170, 226, 217, 254, 27, 232, 123, 9,
-    133, 77, 47, 253, 35, 35, 49, 158, 160, 140, 0, 220, 144, 9, 7, 143, 223, 172, 36, 59, 191, 20, 111, 193, 37, 37,
-    18, 179, 167, 155, 23, 165, 70, 185, 192, 194, 223, 248, 26, 134, 214, 97, 56, 24, 102, 124, 217, 29, 116, 224, 237,
-    123, 78, 23, 239, 243, 250, 221, 246, 82, 16, 51, 206, 118, 67, 243, 92, 186, 153, 218, 72, 84, 54, 255, 206, 53,
-    156, 101, 126, 253, 96, 253, 137, 163, 219, 149, 229, 0, 130, 187, 132, 92, 73, 112, 241, 58, 118, 166, 207, 9, 121,
-    31, 166, 145, 191, 217, 194, 241, 10, 159, 85, 18, 185, 152, 238, 246, 177, 197, 152, 249, 146, 44, 121, 54, 216,
-    219, 109, 107, 199, 169, 66, 194, 235, 222, 150, 165, 208, 113, 156, 144, 225, 63, 81, 43, 95, 121, 241, 84, 185,
-    125, 109, 73, 150, 201, 68, 72, 107, 245, 169, 166, 82, 205, 237, 128, 78, 154, 217, 4, 169, 96, 199, 125, 248, 244,
-    121, 123, 207, 62, 35, 29, 74, 201, 192, 197, 189, 228, 34, 153, 82, 125, 193, 222, 197, 149, 197, 226, 7, 8, 248,
-    248, 146, 44, 104, 21, 132, 181, 233, 115, 157, 108, 234, 206, 141, 40, 155, 79, 53, 226, 22, 91, 202, 13, 82, 109,
-    148, 25, 213, 239, 139, 217, 206, 9, 120, 95, 49, 170, 213, 106, 239, 86, 69, 61, 153, 71, 121, 91, 179, 253, 139,
-    238, 13, 237, 242, 198, 92, 221, 30, 0, 168, 176, 8, 7, 182, 95, 100, 181, 105, 241, 23, 101, 6, 221, 223, 47, 169,
-    190, 132, 193, 31, 183, 172, 134, 241, 170, 47, 84, 167, 39, 43, 205, 33, 124, 42, 4, 42, 4, 133, 38, 67, 201, 15,
-    50, 57, 115, 74, 237, 55, 12, 5, 49, 28, 243, 148, 88, 12, 225, 50, 149, 203, 79, 82, 252, 41, 49, 61, 91, 108, 253,
-    217, 159, 25, 120, 3, 186, 74, 32, 148, 224, 144, 21, 101, 130, 119, 11, 122, 209, 149, 202, 202, 245, 212, 197, 62,
-    118, 148, 189, 222, 114, 147, 187, 150, 192, 144, 44, 191, 30, 36, 153, 156, 186, 74, 147, 45, 100, 234, 26, 173, 0,
-    15, 190, 56, 133, 202, 202, 58, 87, 204, 21, 207, 128, 195, 232, 174, 173, 2, 120, 153, 126, 171, 35, 145, 30, 16,
-    21, 117, 171, 217, 72, 156, 229, 23, 2, 75, 241, 201, 6, 247, 157, 19, 83, 58, 219, 212, 203, 194, 186, 89, 92, 29,
-    79, 61, 98, 76, 85, 22, 24, 187, 70, 22, 153, 120, 80, 13, 101, 150, 199, 246, 108, 84, 55, 164, 206, 81, 36, 250,
-    219, 220, 101, 30, 202, 63, 94, 136, 0, 194, 223, 189, 193, 221, 247, 106, 167, 28, 85, 0, 243, 183, 218, 78, 125,
-    80, 108, 8, 65, 195, 51, 195, 209, 151, 59, 143, 76, 52, 188, 200, 14, 188, 147, 21, 72, 55, 40, 91, 101, 95, 200,
-    200, 18, 13, 72, 22, 50, 95, 32, 230, 88, 63, 172, 4, 112, 197, 108, 112, 138, 175, 161, 68, 233, 53, 14, 178, 126,
-    246, 203, 246, 86, 74, 3, 27, 164, 184, 23, 112, 71, 84, 250, 95, 141, 51, 215, 21, 241, 69, 47, 178, 192, 138, 80,
-    55, 114, 179, 242, 62, 35, 126, 213, 30, 69, 245, 29, 229, 178, 2, 41, 232, 223, 168, 177, 62, 150, 161, 15, 61,
-    196, 22, 182, 103, 43, 3, 127, 198, 51, 200, 88, 228, 156, 168, 138, 177, 7, 250, 21, 6, 106, 210, 12, 13, 188, 227,
-    78, 154, 69, 124, 95, 196, 27, 181, 37, 195, 30, 188, 19, 86, 114, 96, 62, 104, 235, 143, 119, 250, 169, 65, 103,
-    72, 32, 6, 247, 194, 95, 157, 92, 86, 130, 111, 75, 79, 119, 100, 79, 76, 230, 77, 15, 119, 186, 145, 67, 131, 230,
-    223, 173, 226, 240, 223, 154, 216, 200, 139, 56, 104, 188, 216, 60, 108, 172, 246, 8, 184, 49, 248, 82, 141, 9, 233,
-    0, 53, 54, 61, 129, 53, 225, 88, 135, 191, 188, 97, 5, 155, 176, 176, 170, 79, 233, 224, 11, 153, 163, 74, 131, 244,
-    173, 44, 220, 238, 175, 10, 225, 36, 154, 71, 126, 31, 230, 1, 221, 135, 16, 181, 53, 249, 140, 102, 125, 84, 99,
-    70, 150, 114, 143, 8, 237, 225, 169, 120, 27, 104, 68, 205, 180, 228, 153, 187, 136, 218, 171, 164, 168, 245, 76,
-    237, 172, 172, 243, 6, 64, 114, 24, 115, 15, 230, 178, 23, 238, 141, 112, 114, 98, 84, 87, 145, 102, 90, 58, 250,
-    72, 193, 155, 49, 176, 41, 247, 143, 100, 88, 189, 254, 138, 218, 108, 129, 227, 164, 81, 254, 60, 42, 210, 5, 62,
-    223, 116, 133, 30, 168, 5, 6, 142, 139, 130, 175, 207, 93, 21, 188, 42, 15, 230, 74, 185, 25, 44, 107, 82, 224, 247,
-    243, 166, 72, 116, 220, 49, 116, 123, 64, 188, 16, 86, 108, 110, 108, 35, 142, 106, 118, 181, 252, 138, 107, 128,
-    193, 75, 193, 196, 70, 108, 205, 85, 33, 105, 27, 31, 117, 51, 45, 76, 209, 196, 192, 67, 43, 242, 19, 93, 89, 202,
-    57, 75, 219, 115, 203, 31, 151, 165, 82, 154, 125, 29, 104, 27, 87, 67, 82, 40, 80, 120, 161, 106, 132, 94, 206, 61,
-    94, 181, 162, 43, 192, 239, 123, 64, 128, 14, 224, 7, 102, 29, 249, 133, 32, 29, 71, 38, 193, 20, 5, 223, 126, 48,
-    30, 223, 114, 212, 190, 204, 57, 136, 106, 4, 26, 232, 55, 10, 171, 212, 119, 126, 38, 207, 122, 2, 212, 14, 217,
-    111, 124, 53, 126, 67, 38, 55, 99, 119, 191, 45, 135, 177, 161, 89, 255, 9, 81, 74, 161, 238, 120, 126, 10, 57, 176,
-    55, 14, 87, 59, 13, 129, 131, 85, 91, 21, 40, 216, 46, 176, 46, 218, 63, 102, 145, 191, 169, 23, 244, 20, 45, 216,
-    92, 170, 135, 184, 198, 11, 145, 46, 34, 91, 225, 151, 97, 72, 234, 101, 157, 113, 136, 81, 8, 119, 58, 22, 110,
-    145, 50, 61, 53, 234, 60, 65, 9, 220, 9, 243, 148, 91, 121, 29, 162, 90, 210, 110, 209, 50, 124, 13, 216, 167, 7,
-    136, 180, 198, 231, 190, 254, 89, 74, 56, 202, 185, 248, 241, 147, 81, 160, 5, 237, 126, 116, 174, 3, 213, 19, 77,
-    71, 42, 227, 115, 248, 152, 62, 39, 57, 175, 39, 221, 230, 78, 15, 213, 105, 48, 228, 78, 137, 110, 200, 45, 146,
-    161, 234, 165, 95, 104, 216, 206, 87, 137, 147, 204, 226, 54, 184, 8, 148, 202, 42, 99, 177, 234, 21, 144, 11, 159,
-    142, 109, 241, 186, 51, 153, 242, 59, 188, 244, 5, 131, 84, 120, 248, 11, 28, 81, 205, 94, 175, 5, 137, 35, 160,
-    143, 157, 139, 53, 209, 73, 177, 50, 113, 227, 227, 184, 255, 33, 41, 253, 248, 249, 107, 118, 126, 225, 74, 156,
-    225, 8, 67, 206, 214, 58, 43, 184, 161, 89, 238, 46, 223, 81, 236, 169, 52, 41, 155, 163, 72, 173, 201, 213, 114,
-    142, 114, 168, 182, 14, 117, 147, 30, 79, 103, 183, 250, 245, 250, 75, 119, 44, 119, 109, 245, 242, 30, 81, 102, 62,
-    110, 254, 155, 237, 252, 22, 113, 56, 58, 144, 117, 160, 249, 99, 62, 203, 242, 155, 171, 81, 69, 236, 86, 77, 155,
-    236, 62, 94, 29, 188, 43, 232, 190, 192, 45, 232, 241, 110, 173, 69, 47, 129, 36, 166, 217, 56, 224, 164, 16, 222,
-    208, 37, 72, 2, 65, 94, 208, 224, 224, 75, 20, 75, 76, 244, 130, 214, 149, 126, 94, 234, 9, 85, 138, 247, 149, 224,
-    125, 209, 156, 109, 191, 222, 34, 105, 79, 137, 10, 217, 216, 172, 8, 132, 161, 85, 70, 25, 237, 45, 230, 84, 73,
-    242, 43, 122, 240, 69, 199, 0, 72, 119, 233, 193, 237, 66, 151, 186, 139, 65, 246, 55, 225, 128, 214, 246, 53, 62,
-    235, 123, 69, 246, 89, 255, 90, 138, 228, 211, 238, 115, 210, 76, 222, 94, 220, 81, 115, 128, 240, 146, 114, 109,
-    64, 179, 192, 82, 232, 33, 47, 169, 138, 69, 5, 170, 160, 232, 64, 32, 45, 100, 106, 127, 38, 138, 253, 249, 1, 196,
-    205, 74, 12, 203, 120, 218, 196, 41, 102, 179, 51, 20, 26, 37, 71, 242, 252, 49, 45, 9, 92, 240, 225, 22, 0, 206,
-    222, 232, 230, 151, 67, 37, 63, 131, 116, 73, 63, 215, 135, 184, 29, 128, 56, 185, 22, 217, 141, 98, 204, 46, 190,
-    250, 92, 222, 90, 109, 211, 129, 111, 219, 86, 177, 216, 118, 236, 30, 132, 167, 235, 67, 62, 175, 159, 224, 234,
-    232, 85, 20, 74, 222, 66, 26, 70, 195, 249, 48, 226, 10, 65, 253, 26, 9, 188, 99, 203, 14, 207, 147, 46, 135, 171,
-    59, 243, 96, 11, 20, 161, 94, 164, 49, 114, 93, 49, 247, 163, 255, 33, 147, 101, 172, 66, 64, 111, 9, 166, 101, 166,
-    187, 8, 182, 189, 237, 47, 147, 71, 39, 212, 39, 194, 214, 4, 236, 32, 106, 34, 108, 87, 167, 19, 146, 226, 138, 16,
-    27, 205, 236, 118, 162, 64, 178, 207, 117, 142, 55, 229, 211, 0, 222, 113, 51, 143, 251, 66, 145, 37, 55, 74, 212,
-    127, 96, 122, 143, 72, 184, 127, 119, 247, 224, 52, 252, 164, 174, 26, 19, 117, 87, 164, 207, 144, 54, 172, 145, 18,
-    248, 45, 15, 209, 216, 0, 89, 182, 207, 200, 115, 47, 186, 236, 166, 233, 236, 17, 203, 189, 100, 158, 207, 238,
-    209, 55, 41, 20, 163, 242, 253, 139, 214, 129, 158, 168, 100, 206, 221, 8, 212, 46, 14, 198, 91, 162, 198, 60, 77,
-    142, 41, 243, 94, 203, 117, 246, 120, 46, 118, 143, 62, 249, 10, 55, 223, 230, 148, 164, 194, 184, 155, 49, 240, 40,
-    209, 40, 120, 173, 72, 31, 33, 52, 18, 181, 59, 139, 159, 26, 8, 27, 196, 135, 49, 217, 86, 171, 79, 164, 88, 145,
-    180, 131, 45, 148, 132, 5, 119, 45, 75, 163, 36, 161, 80, 234, 164, 32, 122, 122, 178, 219, 205, 106, 218, 120, 76,
-    225, 173, 24, 127, 82, 224, 125, 12, 239, 167, 13, 217, 95, 184, 26, 45, 220, 254, 246, 175, 235, 207, 90, 249, 41,
-    129, 207, 168, 146, 130, 222, 217, 79, 119, 112, 187, 205, 63, 93, 143, 22, 136, 145, 228, 197, 169, 35, 93, 227,
-    31, 180, 122, 56, 140, 205, 220, 114, 80, 20, 95, 32, 112, 76, 126, 148, 150, 51, 142, 31, 95, 73, 248, 245, 96,
-    155, 32, 241, 222, 34, 240, 85, 144, 200, 186, 241, 79, 41, 202, 152, 222, 89, 21, 203, 166, 118, 15, 1, 87, 200,
-    253, 66, 126, 186, 37, 202, 130, 104, 139, 50, 94, 3, 84, 113, 18, 243, 11, 53, 25, 136, 45, 114, 123, 200, 212,
-    105, 218, 2, 98, 54, 240, 37, 41, 71, 151, 184, 15, 168, 143, 148, 18, 66, 25, 66, 77, 242, 165, 20, 192, 251, 235,
-    212, 246, 3, 70, 165, 82, 101, 81, 173, 106, 190, 149, 14, 224, 190, 87, 183, 74, 61, 234, 69, 69, 207, 39, 35, 201,
-    115, 13, 179, 74, 99, 48, 243, 50, 69, 28, 46, 142, 129, 153, 12, 26, 231, 192, 90, 246, 21, 149, 180, 77, 97, 236,
-    129, 170, 104, 80, 163, 190, 1, 127, 232, 2, 179, 93, 57, 173, 169, 38, 136, 233, 206, 94, 86, 231, 174, 46, 40,
-    152, 132, 147, 89, 0, 47, 86, 247, 207, 158, 213, 100, 44, 123, 159, 98, 143, 205, 195, 69, 153, 245, 9, 30, 219,
-    59, 230, 202, 236, 106, 96, 169, 59, 33, 33, 160, 199, 83, 109, 15, 47, 30, 121, 52, 7, 103, 203, 235, 225, 133, 27,
-    55, 200, 107, 2, 127, 135, 106, 159, 5, 34, 125, 97, 172, 172, 217, 242, 26, 146, 224, 197, 248, 175, 2, 39, 111,
-    145, 56, 85, 209, 205, 29, 188, 36, 29, 191, 21, 105, 201, 207, 219, 59, 3, 178, 104, 95, 45, 108, 13, 167, 151, 50,
-    179, 98, 68, 116, 4, 237, 133, 54, 211, 85, 11, 180, 146, 122, 12, 173, 13, 185, 196, 242, 168, 114, 20, 204, 18,
-    201, 201, 167, 42, 161, 208, 123, 121, 56, 220, 185, 150, 146, 130, 182, 144, 0, 77, 208, 133, 1, 231, 13, 226, 139,
-    82, 199, 226, 71, 95, 16, 16, 101, 48, 118, 36, 242, 66, 199, 114, 126, 12, 191, 160, 249, 237, 230, 162, 118, 174,
-    114, 115, 208, 1, 11, 29, 223, 234, 92, 221, 143, 165, 92, 100, 153, 234, 240, 2, 205, 107, 62, 197, 151, 68, 78,
-    248, 83, 104, 191, 57, 16, 221, 6, 111, 164, 250, 9, 167, 107, 214, 61, 78, 141, 182, 82, 121, 250, 20, 142, 62, 45,
-    188, 168, 219, 238, 39, 64, 152, 191, 135, 172, 22, 207, 185, 181, 143, 63, 173, 189, 190, 140, 95, 154, 29, 172,
-    31, 76, 15, 62, 130, 73, 244, 127, 164, 10, 208, 133, 209, 24, 42, 125, 29, 249, 147, 148, 211, 54, 57, 148, 99,
-    177, 122, 94, 99, 77, 105, 124, 40, 177, 43, 253, 58, 46, 2, 128, 25, 103, 141, 164, 218, 33, 171, 149, 240, 92, 40,
-    236, 22, 100, 108, 184, 2, 117, 185, 188, 192, 212, 78, 22, 213, 132, 229, 189, 184, 84, 45, 19, 57, 4, 54, 10, 90,
-    240, 103, 121, 53, 152, 250, 160, 93, 75, 9, 4, 29, 201, 202, 174, 171, 79, 211, 97, 114, 0, 207, 167, 197, 162, 67,
-    128, 157, 74, 254, 26, 27, 242, 11, 163, 202, 131, 218, 74, 153, 111, 49, 217, 181, 139, 187, 127, 102, 102, 46,
-    113, 8, 141, 94, 37, 52, 246, 25, 205, 183, 122, 218, 11, 39, 27, 45, 135, 219, 36, 188, 134, 100, 25, 61, 96, 228,
-    196, 251, 100, 24, 82, 130, 56, 91, 20, 76, 21, 123, 79, 72, 190, 181, 195, 167, 40, 197, 25, 93, 209, 200, 83, 207,
-    199, 23, 90, 103, 57, 34, 53, 192, 112, 182, 231, 65, 116, 146, 20, 107, 135, 252, 113, 230, 100, 72, 126, 131, 242,
-    24, 21, 174, 3, 12, 89, 123, 184, 220, 227, 191, 197, 196, 135, 207, 138, 119, 31, 173, 47, 18, 202, 220, 234, 171,
-    96, 179, 235, 204, 82, 53, 3, 183, 151, 154, 246, 3, 119, 9, 166, 126, 91, 12, 100, 216, 39, 107, 217, 229, 153, 34,
-    182, 197, 32, 60, 196, 110, 86, 74, 201, 51, 102, 243, 253, 15, 85, 158, 109, 7, 154, 244, 158, 13, 54, 44, 201,
-    227, 199, 66, 27, 9, 232, 164, 78, 141, 165, 31, 205, 116, 119, 134, 207, 228, 96, 158, 169, 23, 252, 47, 198, 248,
-    120, 82, 248, 10, 49, 140, 219, 6, 202, 15, 38, 87, 78, 246, 237, 54, 56, 90, 35, 39, 163, 133, 10, 144, 115, 204,
-    125, 21, 183, 239, 152, 63, 30, 15, 168, 244, 241, 59, 213, 90, 6, 0, 136, 60, 48, 178, 117, 99, 84, 192, 234, 1,
-    176, 117, 153, 247, 215, 204, 128, 20, 32, 206, 163, 72, 40, 215, 251, 255, 62, 12, 243, 179, 254, 57, 161, 34, 121,
-    248, 204, 18, 77, 167, 252, 191, 145, 41, 236, 8, 94, 34, 250, 112, 205, 186, 206, 49, 207, 199, 208, 89, 177, 255,
-    27, 16, 83, 199, 231, 45, 170, 54, 237, 150, 60, 103, 135, 23, 254, 20, 66, 151, 116, 83, 175, 34, 236, 177, 123,
-    105, 193, 207, 5, 226, 0, 205, 129, 50, 162, 31, 60, 41, 5, 38, 228, 239, 123, 1, 14, 25, 99, 130, 180, 244, 124,
-    192, 253, 52, 16, 100, 171, 180, 91, 43, 228, 43, 197, 195, 85, 63, 188, 3, 67, 59, 177, 88, 126, 57, 223, 181, 97,
-    105, 210, 13, 22, 26, 29, 14, 210, 98, 220, 171, 209, 170, 105, 137, 239, 22, 64, 167, 166, 235, 35, 6, 236, 167,
-    99, 59, 84, 32, 126, 151, 26, 18, 213, 100, 190, 42, 215, 84, 142, 6, 12, 100, 221, 207, 85, 68, 59, 84, 242, 240,
-    144, 58, 78, 150, 39, 67, 174, 228, 126, 117, 198, 234, 141, 39, 220, 167, 212, 137, 75, 138, 73, 233, 156, 65, 34,
-    8, 27, 57, 102, 36, 20, 96, 236, 152, 230, 195, 234, 121, 75, 46, 116, 88, 114, 36, 119, 152, 100, 196, 58, 161,
-    126, 93, 78, 183, 142, 47, 251, 38, 200, 192, 227, 17, 253, 112, 119, 26, 64, 211, 140, 237, 29, 137, 65, 51, 34,
-    217, 58, 120, 73, 114, 24, 199, 101, 168, 190, 130, 0, 190, 122, 152, 143, 17, 191, 32, 73, 86, 90, 98, 12, 176,
-    157, 193, 229, 224, 54, 59, 235, 24, 65, 249, 6, 182, 22, 10, 84, 189, 166, 67, 236, 85, 58, 85, 1, 236, 174, 54,
-    215, 246, 81, 34, 53, 173, 106, 144, 159, 96, 182, 240, 119, 23, 213, 99, 126, 98, 106, 34, 6, 230, 170, 36, 141,
-    49, 181, 215, 91, 133, 39, 199, 16, 68, 50, 213, 240, 17, 18, 7, 68, 192, 60, 194, 183, 184, 87, 131, 229, 240, 242,
-    250, 17, 97, 124, 243, 160, 242, 161, 248, 21, 165, 19, 214, 213, 242, 108, 22, 78, 198, 9, 255, 196, 83, 131, 210,
-    147, 154, 43, 239, 146, 58, 32, 109, 193, 244, 10, 107, 111, 25, 198, 66, 121, 159, 108, 66, 19, 175, 254, 142, 242,
-    232, 142, 9, 167, 202, 32, 211, 75, 242, 70, 50, 150, 161, 8, 119, 252, 73, 47, 157, 137, 164, 129, 8, 5, 12, 30,
-    250, 224, 127, 152, 53, 190, 83, 84, 181, 188, 135, 11, 210, 67, 192, 197, 128, 140, 4, 64, 3, 35, 44, 70, 72, 1,
-    138, 217, 153, 146, 115, 106, 116, 9, 249, 163, 119, 30, 117, 118, 24, 199, 238, 201, 30, 54, 179, 45, 125, 228,
-    228, 13, 90, 240, 137, 162, 175, 163, 39, 249, 242, 71, 161, 100, 148, 117, 150, 180, 244, 23, 35, 147, 125, 80,
-    158, 223, 179, 213, 200, 30, 105, 216, 205, 89, 83, 189, 18, 162, 125, 134, 170, 157, 169, 21, 99, 235, 244, 34,
-    219, 35, 101, 241, 150, 203, 138, 179, 251, 74, 23, 200, 77, 107, 189, 49, 137, 63, 233, 81, 166, 19, 58, 137, 138,
-    197, 167, 39, 239, 89, 46, 226, 29, 42, 215, 221, 55, 206, 104, 69, 116, 171, 87, 75, 24, 253, 66, 127, 188, 212,
-    76, 14, 222, 95, 138, 18, 9, 198, 67, 207, 255, 111, 133, 167, 91, 101, 252, 193, 26, 58, 65, 23, 39, 123, 98, 46,
-    163, 201, 29, 216, 177, 77, 112, 49, 131, 117, 208, 101, 33, 82, 138, 189, 151, 71, 34, 240, 160, 67, 52, 201, 20,
-    50, 85, 39, 43, 71, 22, 68, 112, 102, 151, 40, 128, 21, 230, 95, 27, 194, 155, 105, 108, 68, 99, 46, 12, 49, 200,
-    41, 64, 209, 23, 51, 127, 222, 170, 216, 178, 47, 27, 90, 30, 179, 253, 237, 86, 9, 152, 88, 1, 249, 53, 155, 58,
-    215, 242, 52, 158, 141, 210, 236, 31, 101, 163, 120, 13, 18, 176, 124, 84, 119, 207, 18, 50, 25, 193, 26, 71, 147,
-    35, 252, 128, 64, 236, 64, 22, 105, 187, 215, 110, 100, 127, 224, 86, 30, 25, 155, 98, 170, 55, 40, 139, 79, 129,
-    217, 15, 52, 153, 32, 132, 3, 160, 109, 181, 166, 95, 27, 122, 35, 178, 172, 97, 115, 101, 60, 77, 197, 117, 126,
-    80, 225, 194, 91, 125, 201, 166, 106, 224, 84, 77, 13, 26, 142, 222, 14, 220, 161, 170, 225, 147, 137, 47, 42, 41,
-    5, 143, 201, 174, 82, 36, 82, 50, 26, 200, 127, 148, 163, 141, 10, 107, 161, 170, 13, 13, 166, 83, 100, 221, 13,
-    206, 77, 202, 25, 253, 90, 90, 193, 43, 12, 81, 164, 80, 152, 84, 37, 55, 181, 202, 123, 148, 253, 238, 227, 117,
-    81, 161, 246, 5, 123, 108, 3, 135, 240, 83, 30, 240, 61, 250, 52, 15, 175, 245, 211, 63, 32, 119, 133, 35, 89, 55,
-    77, 171, 110, 242, 191, 54, 62, 201, 61, 211, 152, 151, 77, 161, 190, 69, 46, 244, 219, 96, 147, 167, 3, 195, 225,
-    205, 255, 95, 79, 23, 103, 79, 167, 92, 210, 119, 180, 63, 3, 105, 109, 3, 182, 60, 153, 197, 241, 43, 207, 129, 29,
-    237, 26, 47, 112, 45, 157, 189, 167, 251, 85, 112, 132, 128, 121, 158, 31, 79, 150, 243, 56, 201, 64, 235, 28, 30,
-    168, 166, 168, 195, 179, 195, 246, 184, 134, 182, 11, 202, 151, 95, 44, 19, 202, 206, 157, 102, 103, 19, 63, 106,
-    82, 162, 71, 54, 120, 252, 33, 2, 75, 65, 52, 19, 63, 135, 242, 123, 50, 9, 83, 14, 225, 219, 214, 222, 199, 81,
-    139, 90, 107, 81, 97, 181, 159, 169, 128, 228, 34, 245, 172, 3, 140, 57, 162, 29, 84, 70, 223, 125, 39, 153, 66, 85,
-    146, 177, 169, 125, 164, 226, 166, 202, 146, 181, 218, 29, 93, 219, 191, 30, 183, 19, 153, 191, 161, 63, 108, 123,
-    40, 229, 146, 81, 66, 89, 134, 183, 135, 183, 147, 21, 86, 143, 217, 192, 13, 6, 229, 250, 50, 50, 107, 142, 186,
-    47, 138, 9, 28, 4, 6, 181, 187, 48, 152, 28, 123, 111, 232, 150, 203, 94, 172, 220, 90, 71, 4, 1, 165, 105, 210,
-    162, 39, 128, 70, 227, 144, 216, 231, 248, 83, 123, 97, 70, 186, 101, 111, 64, 185, 169, 206, 52, 84, 22, 33, 111,
-    94, 242, 210, 184, 198, 62, 62, 161, 188, 152, 44, 111, 150, 39, 41, 191, 77, 1, 189, 188, 69, 87, 240, 68, 14, 230,
-    105, 137, 61, 210, 41, 220, 248, 234, 140, 220, 104, 37, 29, 170, 149, 183, 116, 31, 252, 24, 159, 123, 75, 95, 87,
-    238, 38, 82, 63, 243, 20, 168, 115, 126, 215, 234, 194, 235, 170, 35, 139, 157, 238, 240, 79, 77, 2, 201, 235, 165,
-    87, 193, 200, 52, 16, 211, 243, 176, 244, 190, 216, 70, 102, 104, 167, 51, 197, 197, 142, 234, 140, 185, 84, 213,
-    146, 131, 13, 99, 146, 95, 254, 142, 8, 207, 101, 49, 229, 103, 246, 69, 224, 68, 159, 230, 136, 248, 142, 219, 40,
-    199, 55, 63, 15, 109, 30, 92, 236, 209, 170, 3, 122, 55, 122, 137, 11, 52, 7, 45, 206, 173, 114, 183, 98, 1, 251,
-    115, 101, 236, 224, 192, 195, 243, 94, 38, 159, 12, 132, 143, 52, 218, 16, 19, 71, 196, 150, 28, 191, 241, 112, 9,
-    119, 118, 242, 136, 81, 155, 231, 125, 144, 149, 205, 246, 146, 149, 248, 195, 252, 179, 136, 163, 73, 148, 181, 24,
-    12, 136, 227, 144, 170, 229, 200, 149, 37, 234, 20, 152, 5, 158, 244, 205, 227, 250, 27, 156, 184, 205, 199, 183,
-    37, 187, 5, 183, 131, 49, 79, 200, 148, 176, 37, 213, 197, 111, 177, 24, 183, 54, 74, 224, 95, 128, 162, 159, 71,
-    11, 191, 87, 180, 189, 59, 34, 146, 117, 248, 67, 236, 217, 236, 152, 165, 234, 52, 226, 58, 62, 121, 227, 172, 23,
-    233, 174, 220, 76, 195, 5, 73, 67, 115, 213, 108, 183, 175, 64, 153, 118, 224, 181, 155, 35, 70, 255, 123, 93, 45,
-    175, 117, 190, 162, 164, 129, 82, 191, 182, 159, 220, 93, 252, 111, 251, 127, 103, 136, 139, 6, 33, 25, 60, 57, 204,
-    106, 145, 94, 136, 116, 231, 82, 206, 39, 54, 220, 112, 227, 129, 100, 107, 41, 63, 73, 202, 63, 119, 193, 191, 88,
-    108, 7, 87, 101, 60, 117, 176, 111, 17, 192, 126, 187, 196, 208, 39, 159, 251, 208, 51, 17, 37, 16, 9, 33, 195, 135,
-    161, 124, 38, 86, 58, 226, 238, 132, 25, 99, 44, 223, 255, 24, 121, 84, 253, 105, 164, 38, 127, 106, 226, 20, 247,
-    72, 189, 81, 128, 169, 205, 162, 235, 159, 217, 69, 223, 119, 43, 230, 168, 211, 16, 109, 25, 172, 119, 202, 48, 70,
-    236, 217, 41, 28, 30, 158, 215, 145, 128, 42, 145, 36, 90, 54, 106, 225, 116, 159, 241, 163, 234, 11, 250, 227, 228,
-    31, 50, 131, 215, 71, 162, 151, 54, 165, 238, 234, 210, 246, 90, 170, 102, 237, 241, 162, 229, 164, 137, 225, 203,
-    192, 125, 152, 134, 36, 124, 190, 250, 255, 170, 189, 188, 196, 146, 24, 114, 91, 128, 135, 46, 72, 242, 134, 4, 78,
-    167, 242, 55, 151, 34, 191, 46, 114, 54, 126, 200, 23, 150, 192, 200, 2, 44, 91, 116, 112, 250, 224, 67, 25, 102,
-    54, 69, 159, 93, 185, 143, 94, 77, 246, 8, 121, 163, 209, 56, 1, 96, 204, 189, 137, 140, 101, 63, 183, 53, 173, 62,
-    115, 221, 147, 178, 35, 141, 176, 253, 108, 207, 223, 99, 245, 77, 4, 38, 164, 95, 23, 252, 205, 204, 148, 229, 240,
-    193, 212, 190, 241, 238, 144, 12, 146, 141, 55, 133, 3, 36, 18, 109, 168, 65, 154, 149, 134, 76, 254, 132, 146, 242,
-    110, 203, 24, 251, 89, 201, 4, 195, 92, 210, 17, 81, 190, 72, 207, 246, 140, 72, 232, 176, 52, 150, 162, 57, 149,
-    156, 60, 221, 248, 44, 154, 158, 54, 149, 204, 226, 103, 231, 216, 67, 76, 61, 4, 173, 246, 132, 220, 83, 74, 244,
-    241, 220, 202, 7, 129, 240, 179, 154, 234, 1, 198, 246, 209, 179, 187, 53, 114, 171, 198, 167, 172, 62, 157, 197,
-    168, 104, 250, 148, 224, 176, 119, 60, 142, 187, 127, 183, 71, 34, 4, 158, 136, 59, 145, 76, 199, 45, 151, 119, 30,
-    21, 64, 64, 159, 23, 35, 169, 215, 121, 250, 125, 208, 68, 252, 139, 74, 215, 217, 128, 170, 188, 205, 8, 171, 236,
-    233, 172, 166, 81, 209, 31, 151, 232, 5, 32, 161, 122, 152, 201, 119, 91, 108, 95, 8, 21, 197, 168, 39, 183, 135,
-    81, 129, 40, 161, 64, 238, 63, 219, 52, 21, 193, 177, 47, 167, 188, 180, 95, 7, 197, 50, 120, 161, 7, 150, 217, 109,
-    75, 123, 224, 0, 214, 85, 149, 195, 90, 24, 178, 24, 36, 34, 172, 145, 9, 84, 116, 111, 164, 20, 72, 86, 154, 184,
-    181, 128, 114, 123, 74, 52, 167, 167, 147, 68, 168, 83, 106, 81, 63, 219, 230, 103, 52, 53, 251, 243, 182, 250, 93,
-    114, 41, 220, 225, 83, 134, 84, 72, 56, 192, 90, 110, 133, 123, 99, 98, 38, 153, 37, 109, 249, 235, 242, 147, 255,
-    56, 246, 83, 130, 167, 161, 137, 7, 190, 17, 157, 127, 22, 117, 241, 73, 191, 131, 239, 37, 49, 216, 193, 244, 37,
-    190, 80, 56, 55, 107, 202, 168, 19, 81, 241, 128, 224, 208, 169, 149, 62, 28, 233, 129, 86, 87, 235, 132, 85, 105,
-    45, 116, 128, 228, 58, 29, 248, 187, 199, 253, 109, 180, 138, 30, 246, 20, 245, 81, 36, 243, 57, 135, 158, 147, 196,
-    210, 15, 164, 146, 64, 80, 74, 138, 99, 42, 177, 51, 43, 214, 208, 48, 252, 246, 197, 180, 176, 74, 215, 0, 196,
-    106, 15, 229, 144, 210, 22, 222, 7, 53, 74, 224, 233, 136, 219, 79, 188, 145, 140, 143, 29, 123, 90, 101, 250, 162,
-    238, 104, 170, 16, 191, 190, 155, 177, 213, 210, 249, 172, 31, 62, 55, 148, 90, 235, 188, 253, 250, 196, 48, 223,
-    97, 166, 152, 115, 155, 56, 28, 234, 97, 35, 122, 214, 49, 228, 136, 87, 211, 203, 26, 173, 96, 238, 223, 206, 47,
-    5, 16, 69, 35, 243, 163, 94, 104, 127, 60, 145, 223, 149, 196, 78, 17, 136, 186, 76, 253, 109, 162, 217, 217, 109,
-    83, 152, 82, 7, 177, 142, 251, 140, 137, 52, 219, 194, 140, 78, 58, 147, 50, 205, 63, 43, 30, 65, 68, 221, 16, 173,
-    52, 59, 97, 45, 124, 188, 207, 149, 227, 6, 189, 20, 64, 19, 123, 90, 253, 106, 2, 242, 91, 154, 135, 204, 132, 96,
-    220, 70, 27, 41, 208, 45, 148, 238, 162, 172, 225, 3, 162, 20, 252, 14, 194, 126, 141, 106, 156, 191, 196, 128, 6,
-    171, 88, 21, 227, 197, 87, 32, 208, 114, 121, 127, 217, 82, 120, 146, 122, 43, 105, 183, 108, 3, 185, 53, 22, 104,
-    241, 8, 55, 29, 173, 116, 234, 174, 156, 166, 39, 193, 246, 109, 97, 127, 8, 18, 98, 46, 22, 43, 45, 37, 92, 96,
-    230, 205, 157, 60, 143, 103, 129, 12, 62, 140, 48, 151, 131, 101, 191, 10, 231, 15, 73, 159, 202, 31, 22, 72, 12,
-    165, 62, 249, 162, 248, 74, 250, 104, 207, 164, 61, 172, 12, 213, 33, 34, 106, 142, 207, 91, 184, 178, 234, 41, 129,
-    175, 192, 38, 174, 200, 12, 13, 41, 69, 95, 206, 18, 234, 57, 126, 50, 62, 135, 94, 85, 132, 55, 42, 183, 118, 80,
-    185, 24, 178, 77, 140, 12, 218, 230, 176, 88, 176, 143, 113, 148, 142, 16, 210, 191, 57, 60, 57, 180, 149, 26, 64,
-    84, 2, 228, 214, 156, 240, 6, 42, 100, 90, 140, 40, 132, 242, 2, 3, 39, 198, 176, 119, 54, 67, 227, 193, 245, 89,
-    124, 95, 251, 196, 164, 100, 232, 48, 147, 80, 229, 43, 138, 69, 216, 60, 239, 255, 138, 16, 45, 17, 96, 93, 99,
-    175, 41, 17, 225, 95, 12, 158, 98, 114, 94, 163, 95, 243, 135, 143, 126, 234, 71, 225, 253, 4, 228, 93, 56, 10, 70,
-    158, 142, 148, 140, 37, 86, 51, 150, 161, 20, 148, 232, 86, 217, 135, 233, 165, 50, 135, 30, 150, 112, 198, 223, 9,
-    18, 6, 219, 108, 220, 28, 155, 79, 87, 110, 159, 80, 57, 166, 174, 243, 188, 117, 83, 5, 2, 93, 252, 64, 104, 98,
-    240, 135, 140, 75, 81, 9, 70, 133, 38, 206, 32, 194, 84, 191, 181, 214, 34, 41, 121, 177, 153, 185, 156, 238, 3,
-    213, 97, 50, 40, 58, 69, 123, 134, 148, 170, 232, 122, 120, 165, 176, 254, 172, 182, 41, 31, 110, 231, 132, 76, 65,
-    229, 219, 98, 146, 236, 79, 195, 213, 248, 249, 91, 159, 6, 94, 143, 220, 213, 48, 252, 144, 145, 219, 94, 208, 209,
-    195, 201, 186, 141, 46, 64, 116, 43, 30, 226, 128, 101, 9, 43, 98, 189, 198, 254, 199, 71, 242, 41, 111, 245, 134,
-    200, 144, 236, 178, 34, 39, 21, 67, 184, 121, 112, 50, 240, 56, 171, 134, 115, 18, 52, 72, 252, 41, 26, 85, 121,
-    201, 240, 48, 2, 176, 217, 54, 86, 236, 36, 135, 185, 79, 136, 188, 247, 119, 41, 202, 13, 139, 34, 234, 173, 12,
-    222, 65, 98, 65, 158, 237, 159, 92, 39, 13, 6, 237, 96, 170, 92, 130, 137, 12, 80, 137, 25, 7, 166, 84, 246, 18, 78,
-    240, 131, 142, 135, 120, 202, 227, 165, 5, 20, 62, 137, 133, 12, 228, 154, 127, 243, 177, 211, 118, 230, 70, 33, 89,
-    33, 166, 184, 251, 144, 223, 13, 182, 56, 207, 63, 20, 233, 53, 204, 81, 29, 27, 187, 137, 244, 198, 13, 98, 159,
-    239, 126, 215, 202, 255, 150, 165, 15, 12, 83, 101, 194, 24, 133, 135, 57, 80, 142, 57, 121, 165, 209, 229, 173,
-    191, 221, 228, 147, 22, 41, 54, 103, 122, 17, 90, 90, 24, 73, 1, 204, 51, 144, 139, 18, 176, 4, 16, 23, 59, 197,
-    180, 37, 146, 164, 206, 43, 146, 44, 75, 88, 185, 91, 233, 0, 82, 142, 175, 208, 148, 187, 44, 169, 250, 184, 143,
-    187, 209, 112, 95, 244, 52, 96, 47, 106, 201, 210, 103, 72, 170, 51, 125, 247, 120, 49, 116, 18, 21, 103, 163, 119,
-    123, 49, 10, 55, 109, 75, 173, 113, 182, 176, 131, 85, 189, 9, 169, 110, 186, 135, 175, 92, 76, 188, 173, 234, 238,
-    245, 33, 103, 116, 148, 68, 250, 97, 23, 56, 246, 241, 14, 245, 138, 65, 86, 118, 95, 50, 12, 105, 12, 227, 81, 141,
-    147, 239, 22, 183, 90, 42, 84, 67, 98, 229, 238, 190, 193, 101, 74, 238, 7, 107, 70, 35, 148, 6, 149, 203, 57, 60,
-    237, 167, 185, 7, 97, 81, 220, 230, 251, 159, 19, 58, 125, 67, 215, 167, 99, 94, 25, 70, 117, 116, 46, 131, 56, 122,
-    227, 174, 197, 168, 221, 110, 21, 181, 18, 246, 178, 207, 186, 52, 209, 46, 124, 214, 100, 191, 74, 217, 88, 13, 72,
-    82, 144, 162, 94, 238, 129, 62, 61, 62, 126, 102, 1, 76, 149, 249, 37, 0, 48, 186, 29, 103, 174, 72, 250, 16, 243,
-    178, 237, 34, 141, 50, 252, 34, 190, 231, 60, 174, 148, 189, 82, 22, 245, 191, 37, 3, 39, 94, 146, 77, 63, 35, 217,
-    229, 14, 116, 187, 1, 92, 194, 169, 133, 185, 88, 164, 45, 101, 26, 171, 18, 226, 66, 0, 16, 30, 87, 220, 7, 45,
-    153, 169, 217, 64, 49, 138, 193, 45, 81, 7, 139, 104, 68, 108, 108, 12, 253, 35, 242, 10, 253, 85, 68, 128, 79, 178,
-    28, 144, 194, 211, 13, 106, 58, 177, 9, 2, 42, 163, 1, 131, 19, 5, 235, 23, 184, 248, 221, 144, 158, 53, 110, 73,
-    50, 70, 38, 239, 173, 217, 239, 162, 40, 219, 13, 157, 113, 36, 200, 106, 129, 234, 123, 104, 11, 160, 233, 115,
-    126, 23, 255, 111, 254, 104, 101, 246, 182, 119, 191, 53, 166, 217, 35, 52, 234, 208, 89, 1, 238, 165, 127, 83, 223,
-    254, 225, 78, 74, 142, 31, 76, 145, 38, 65, 236, 116, 25, 109, 219, 197, 20, 29, 151, 173, 146, 171, 98, 192, 88,
-    200, 62, 192, 113, 41, 243, 65, 197, 53, 173, 104, 93, 247, 226, 15, 218, 92, 11, 22, 82, 83, 69, 227, 97, 36, 11,
-    215, 157, 84, 150, 85, 82, 82, 173, 137, 209, 246, 142, 64, 60, 43, 208, 40, 164, 250, 13, 59, 31, 59, 144, 228, 66,
-    160, 194, 216, 240, 125, 159, 191, 248, 200, 6, 147, 192, 248, 23, 15, 182, 120, 235, 238, 183, 253, 92, 95, 191,
-    10, 246, 170, 114, 173, 156, 25, 183, 231, 141, 105, 90, 74, 149, 95, 145, 112, 185, 100, 27, 235, 218, 205, 206,
-    77, 19, 130, 136, 8, 241, 46, 66, 36, 218, 7, 202, 96, 147, 57, 240, 87, 105, 116, 254, 146, 140, 157, 56, 20, 196,
-    223, 220, 145, 206, 233, 79, 140, 86, 173, 191, 127, 207, 249, 114, 24, 178, 242, 173, 179, 75, 86, 117, 67, 27,
-    147, 228, 99, 69, 16, 239, 116, 202, 195, 58, 130, 12, 232, 140, 78, 72, 81, 103, 218, 58, 42, 123, 234, 53, 164,
-    41, 183, 169, 150, 240, 221, 236, 113, 68, 49, 254, 62, 28, 229, 223, 245, 118, 193, 246, 83, 27, 187, 244, 21, 192,
-    190, 5, 11, 25, 136, 102, 129, 23, 50, 255, 244, 42, 90, 88, 56, 113, 88, 116, 8, 189, 134, 95, 98, 19, 65, 23, 233,
-    68, 11, 112, 206, 166, 109, 243, 242, 196, 46, 209, 195, 44, 210, 252, 227, 45, 2, 163, 173, 114, 156, 6, 4, 186,
-    223, 50, 50, 147, 116, 63, 25, 114, 160, 52, 160, 36, 120, 138, 241, 228, 46, 214, 215, 78, 199, 98, 82, 111, 80,
-    66, 9, 7, 175, 36, 109, 83, 177, 131, 28, 97, 132, 226, 194, 169, 3, 117, 75, 170, 85, 0, 130, 89, 189, 233, 95,
-    213, 223, 193, 42, 87, 88, 155, 37, 48, 148, 25, 210, 84, 28, 81, 212, 165, 154, 193, 39, 67, 238, 67, 137, 80, 167,
-    43, 1, 14, 154, 149, 165, 173, 162, 26, 79, 230, 90, 181, 137, 246, 90, 113, 248, 8, 160, 14, 26, 28, 184, 46, 76,
-    145, 122, 254, 128, 218, 30, 7, 107, 141, 123, 206, 99, 88, 209, 59, 37, 15, 185, 8, 104, 220, 22, 187, 7, 200, 34,
-    97, 38, 56, 146, 12, 199, 249, 228, 202, 233, 92, 0, 144, 5, 150, 3, 11, 65, 118, 232, 174, 180, 0, 218, 7, 175, 48,
-    138, 71, 98, 97, 243, 99, 189, 201, 179, 121, 168, 165, 244, 200, 188, 170, 105, 138, 190, 16, 156, 118, 64, 31, 55,
-    234, 160, 77, 203, 89, 254, 151, 227, 103, 158, 51, 109, 242, 244, 209, 210, 196, 218, 48, 122, 70, 16, 176, 219,
-    52, 171, 218, 122, 46, 157, 250, 25, 229, 61, 73, 32, 53, 74, 248, 135, 28, 104, 115, 153, 76, 229, 82, 192, 64,
-    170, 9, 2, 151, 217, 59, 60, 122, 19, 12, 101, 88, 87, 43, 12, 47, 79, 237, 252, 222, 89, 131, 41, 234, 67, 121, 51,
-    54, 128, 176, 81, 231, 69, 13, 13, 49, 183, 244, 212, 17, 215, 91, 2, 11, 101, 242, 115, 206, 213, 62, 181, 165, 75,
-    105, 167, 44, 245, 238, 216, 221, 86, 209, 255, 245, 7, 103, 186, 226, 54, 107, 142, 141, 95, 12, 215, 29, 247, 83,
-    10, 215, 36, 105, 234, 8, 198, 111, 128, 114, 83, 68, 232, 235, 205, 14, 163, 20, 9, 213, 139, 45, 141, 155, 198,
-    228, 177, 7, 59, 169, 254, 9, 151, 155, 142, 41, 171, 168, 204, 197, 97, 226, 173, 133, 8, 36, 238, 14, 65, 61, 114,
-    138, 65, 120, 233, 128, 73, 14, 51, 245, 197, 57, 128, 25, 87, 253, 166, 80, 212, 6, 187, 233, 65, 27, 216, 4, 250,
-    72, 167, 38, 20, 190, 218, 13, 115, 199, 179, 94, 20, 218, 202, 122, 114, 131, 154, 181, 26, 100, 112, 228, 142,
-    158, 225, 71, 213, 186, 195, 90, 52, 30, 63, 211, 21, 207, 246, 149, 242, 202, 215, 56, 249, 6, 128, 47, 59, 4, 5,
-    162, 178, 214, 145, 163, 158, 203, 70, 85, 121, 106, 143, 225, 224, 51, 114, 169, 96, 127, 128, 147, 114, 46, 107,
-    144, 112, 81, 245, 170, 56, 15, 122, 83, 203, 119, 114, 150, 112, 83, 50, 70, 12, 124, 173, 6, 247, 175, 201, 205,
-    127, 162, 151, 123, 137, 70, 182, 75, 199, 103, 147, 26, 247, 110, 171, 10, 153, 201, 228, 67, 57, 142, 1, 182, 79,
-    149, 135, 163, 8, 107, 117, 53, 87, 200, 75, 165, 229, 89, 209, 131, 195, 160, 37, 238, 104, 127, 194, 187, 178,
-    140, 30, 136, 124, 103, 32, 24, 170, 68, 161, 39, 53, 192, 10, 63, 115, 204, 243, 70, 92, 117, 10, 129, 120, 59,
-    131, 143, 250, 179, 137, 159, 98, 224, 55, 134, 2, 106, 144, 66, 164, 46, 110, 54, 44, 63, 218, 77, 178, 114, 44,
-    213, 110, 216, 255, 74, 19, 25, 201, 193, 186, 147, 218, 4, 36, 148, 176, 199, 16, 202, 75, 58, 5, 124, 9, 178, 93,
-    217, 130, 181, 69, 148, 111, 17, 68, 119, 85, 169, 68, 156, 84, 90, 88, 72, 128, 253, 252, 22, 205, 251, 188, 153,
-    159, 102, 94, 140, 202, 15, 251, 65, 17, 0, 224, 201, 104, 48, 194, 241, 116, 95, 223, 236, 206, 116, 139, 132, 194,
-    31, 206, 245, 195, 215, 62, 219, 143, 216, 175, 27, 115, 218, 144, 163, 217, 161, 160, 107, 16, 103, 148, 111, 154,
-    162, 235, 156, 202, 246, 226, 40, 139, 24, 143, 220, 125, 97, 130, 34, 132, 74, 167, 247, 244, 229, 243, 103, 15,
-    171, 127, 237, 128, 152, 246, 212, 166, 153, 17, 99, 64, 59, 25, 93, 31, 139, 68, 137, 72, 155, 23, 240, 222, 136,
-    120, 227, 139, 211, 72, 237, 67, 11, 183, 196, 152, 48, 226, 52, 221, 25, 80, 148, 239, 81, 110, 60, 22, 219, 18,
-    135, 16, 162, 32, 88, 202, 117, 149, 184, 14, 189, 131, 162, 232, 140, 73, 18, 119, 52, 106, 105, 122, 195, 223,
-    183, 236, 19, 100, 128, 37, 88, 212, 2, 38, 116, 189, 37, 85, 98, 164, 4, 224, 214, 218, 246, 114, 227, 203, 0, 59,
-    175, 3, 26, 178, 121, 169, 36, 77, 248, 230, 51, 218, 218, 114, 18, 118, 253, 201, 5, 106, 207, 243, 148, 134, 120,
-    104, 187, 206, 59, 193, 205, 142, 236, 98, 82, 83, 128, 195, 113, 224, 177, 245, 99, 131, 142, 68, 109, 97, 10, 82,
-    128, 192, 249, 228, 10, 73, 165, 25, 60, 207, 239, 218, 249, 178, 40, 220, 0, 160, 85, 140, 181, 134, 55, 69, 169,
-    27, 220, 159, 165, 112, 148, 152, 147, 49, 126, 234, 227, 8, 27, 7, 74, 199, 52, 222, 165, 90, 101, 240, 107, 136,
-    133, 111, 121, 180, 195, 116, 236, 24, 179, 104, 218, 17, 208, 81, 35, 88, 34, 42, 100, 21, 182, 104, 0, 251, 94,
-    153, 225, 35, 231, 103, 23, 249, 13, 224, 232, 8, 105, 211, 123, 245, 3, 115, 207, 130, 190, 182, 125, 60, 29, 231,
-    161, 251, 29, 245, 225, 65, 41, 65, 251, 246, 89, 15, 105, 184, 17, 13, 98, 132, 10, 173, 118, 142, 243, 197, 110,
-    220, 170, 14, 198, 178, 5, 234, 98, 226, 54, 254, 89, 67, 200, 194, 242, 58, 227, 3, 25, 92, 172, 103, 154, 136,
-    144, 22, 221, 235, 189, 177, 248, 124, 234, 168, 129, 124, 172, 64, 132, 193, 18, 144, 79, 197, 24, 127, 12, 236,
-    43, 111, 156, 56, 234, 245, 233, 50, 166, 141, 134, 209, 200, 79, 196, 132, 85, 164, 104, 218, 193, 110, 39, 17, 72,
-    130, 19, 111, 254, 194, 142, 169, 0, 163, 17, 126, 253, 159, 52, 216, 143, 121, 245, 186, 208, 238, 118, 184, 115,
-    24, 154, 152, 40, 181, 171, 7, 175, 57, 64, 170, 65, 243, 65, 249, 70, 109, 40, 206, 209, 7, 51, 249, 91, 45, 222,
-    47, 54, 11, 67, 38, 13, 51, 108, 84, 4, 142, 217, 90, 80, 101, 204, 156, 74, 182, 71, 125, 92, 246, 45, 96, 253,
-    124, 184, 100, 212, 60, 170, 204, 141, 103, 128, 138, 202, 139, 187, 238, 136, 2, 11, 188, 235, 45, 73, 110, 208,
-    69, 176, 10, 25, 200, 238, 90, 185, 73, 213, 101, 118, 111, 154, 228, 136, 191, 22, 100, 51, 80, 234, 196, 16, 137,
-    176, 34, 144, 214, 75, 111, 27, 147, 150, 104, 175, 155, 132, 162, 190, 61, 54, 177, 72, 166, 115, 162, 162, 88, 25,
-    50, 5, 71, 115, 167, 2, 17, 235, 10, 181, 123, 108, 8, 63, 149, 58, 57, 83, 172, 209, 230, 20, 126, 234, 82, 65,
-    107, 103, 235, 15, 170, 153, 150, 15, 88, 111, 252, 220, 73, 134, 17, 212, 170, 161, 234, 245, 106, 215, 100, 232,
-    251, 60, 204, 193, 98, 121, 200, 247, 167, 61, 68, 129, 76, 122, 144, 244, 21, 240, 6, 33, 247, 238, 28, 148, 97,
-    159, 189, 195, 57, 9, 175, 78, 210, 38, 203, 179, 122, 86, 239, 151, 245, 192, 25, 77, 169, 225, 79, 192, 125, 148,
-    251, 17, 59, 188, 140, 109, 75, 185, 74, 207, 252, 220, 121, 57, 31, 217, 215, 22, 189, 186, 235, 116, 76, 189, 221,
-    146, 83, 144, 8, 179, 250, 239, 125, 105, 35, 114, 230, 148, 22, 204, 28, 226, 78, 52, 67, 121, 143, 174, 142, 29,
-    183, 61, 255, 56, 46, 46, 129, 46, 132, 135, 113, 255, 176, 181, 186, 183, 29, 47, 60, 31, 226, 66, 54, 72, 113,
-    222, 219, 165, 92, 253, 237, 188, 127, 88, 71, 242, 86, 44, 45, 216, 133, 250, 220, 147, 156, 148, 20, 60, 250, 25,
-    109, 237, 200, 218, 134, 155, 231, 217, 29, 90, 181, 203, 106, 71, 53, 235, 62, 219, 159, 174, 180, 50, 34, 18, 83,
-    34, 113, 174, 50, 46, 2, 61, 41, 157, 91, 68, 170, 50, 216, 245, 15, 154, 156, 198, 168, 246, 141, 167, 167, 179,
-    50, 12, 98, 255, 40, 67, 181, 46, 134, 204, 254, 209, 117, 6, 152, 41, 114, 25, 25, 240, 147, 58, 64, 162, 69, 120,
-    231, 220, 3, 19, 112, 209, 43, 29, 17, 81, 180, 186, 138, 255, 204, 249, 222, 32, 251, 213, 53, 37, 83, 55, 48, 123,
-    246, 81, 240, 52, 110, 174, 169, 49, 173, 14, 254, 123, 163, 121, 120, 19, 54, 88, 188, 121, 140, 146, 91, 218, 249,
-    136, 47, 151, 164, 99, 3, 33, 148, 86, 31, 116, 164, 25, 141, 177, 113, 29, 155, 172, 22, 244, 141, 159, 82, 191,
-    75, 107, 39, 173, 121, 120, 65, 13, 129, 136, 237, 75, 232, 92, 39, 127, 69, 19, 253, 84, 177, 97, 250, 218, 9, 73,
-    76, 41, 89, 79, 181, 56, 20, 240, 118, 203, 149, 73, 96, 150, 131, 124, 91, 203, 136, 3, 219, 211, 171, 6, 120, 221,
-    141, 97, 68, 158, 47, 235, 60, 131, 3, 96, 72, 151, 133, 188, 165, 204, 168, 51, 173, 79, 158, 126, 127, 11, 188,
-    20, 113, 235, 38, 33, 146, 60, 98, 20, 126, 73, 141, 226, 15, 110, 199, 216, 91, 226, 230, 148, 227, 27, 43, 230,
-    114, 122, 120, 46, 157, 183, 164, 182, 7, 45, 39, 79, 9, 192, 15, 40, 139, 139, 5, 95, 111, 41, 55, 113, 207, 10,
-    94, 252, 144, 126, 226, 224, 98, 65, 153, 119, 181, 71, 159, 11, 220, 21, 27, 151, 250, 105, 168, 183, 57, 157, 206,
-    184, 74, 116, 252, 157, 175, 84, 53, 191, 61, 40, 90, 100, 247, 249, 29, 188, 57, 195, 238, 150, 163, 54, 241, 30,
-    234, 47, 35, 192, 1, 233, 238, 79, 102, 157, 51, 85, 26, 130, 215, 52, 247, 212, 179, 116, 70, 162, 201, 235, 147,
-    111, 161, 248, 158, 122, 193, 224, 193, 23, 99, 37, 141, 250, 89, 141, 3, 25, 20, 160, 53, 38, 214, 117, 173, 61,
-    26, 229, 124, 122, 0, 104, 172, 125, 33, 176, 17, 90, 124, 168, 70, 173, 220, 3, 100, 149, 102, 175, 43, 136, 149,
-    69, 92, 74, 75, 228, 212, 58, 206, 222, 25, 43, 204, 232, 144, 139, 226, 66, 56, 158, 30, 125, 29, 235, 86, 157,
-    124, 88, 240, 26, 126, 113, 112, 149, 194, 216, 127, 49, 52, 100, 115, 161, 139, 241, 140, 145, 243, 90, 249, 210,
-    111, 6, 58, 28, 62, 177, 198, 121, 197, 123, 115, 107, 114, 226, 191, 48, 253, 136, 162, 10, 160, 216, 208, 243,
-    196, 141, 167, 188, 175, 85, 118, 77, 121, 65, 115, 193, 217, 91, 141, 213, 23, 166, 170, 250, 36, 163, 43, 78, 211,
-    201, 116, 23, 6, 32, 192, 153, 7, 122, 163, 98, 210, 207, 23, 134, 239, 36, 121, 98, 15, 210, 221, 57, 134, 241,
-    176, 127, 154, 136, 43, 11, 74, 170, 75, 209, 94, 77, 188, 154, 211, 23, 243, 199, 76, 241, 249, 13, 130, 72, 121,
-    199, 42, 138, 206, 139, 181, 66, 204, 43, 132, 144, 50, 178, 105, 146, 28, 149, 38, 170, 80, 173, 114, 54, 46, 166,
-    46, 241, 145, 61, 111, 255, 73, 14, 28, 106, 204, 177, 229, 172, 126, 194, 238, 26, 68, 206, 52, 165, 63, 84, 237,
-    219, 234, 15, 78, 9, 56, 75, 168, 17, 208, 28, 16, 145, 119, 48, 255, 136, 76, 203, 73, 182, 8, 120, 96, 189, 174,
-    104, 211, 155, 28, 136, 179, 21, 43, 181, 245, 225, 138, 194, 104, 37, 112, 243, 98, 17, 45, 18, 41, 152, 192, 203,
-    100, 52, 217, 97, 11, 72, 158, 92, 10, 99, 173, 107, 242, 204, 204, 215, 252, 3, 87, 64, 15, 42, 127, 77, 246, 75,
-    215, 67, 151, 240, 27, 36, 131, 185, 160, 19, 23, 58, 139, 252, 179, 78, 191, 86, 238, 8, 136, 18, 58, 158, 243, 24,
-    195, 5, 165, 235, 28, 89, 102, 53, 233, 153, 16, 134, 210, 110, 248, 180, 36, 165, 119, 220, 90, 210, 45, 233, 241,
-    2, 160, 75, 103, 138, 26, 57, 25, 255, 46, 97, 128, 15, 196, 58, 203, 110, 83, 188, 55, 121, 67, 159, 106, 45, 164,
-    61, 198, 187, 14, 111, 188, 196, 236, 93, 125, 253, 39, 247, 17, 145, 165, 33, 220, 252, 23, 120, 16, 36, 240, 121,
-    242, 249, 55, 77, 104, 100, 219, 196, 246, 73, 228, 35, 220, 233, 143, 105, 41, 33, 109, 251, 223, 102, 253, 34,
-    255, 141, 118, 25, 106, 83, 243, 30, 179, 96, 171, 41, 168, 70, 71, 132, 224, 122, 54, 251, 20, 171, 217, 32, 182,
-    186, 99, 23, 163, 111, 40, 235, 25, 83, 252, 77, 7, 244, 175, 202, 214, 149, 9, 183, 103, 54, 116, 172, 69, 220, 39,
-    232, 14, 79, 37, 199, 66, 18, 75, 255, 247, 96, 60, 233, 213, 132, 222, 159, 74, 37, 23, 209, 120, 157, 180, 180,
-    150, 181, 189, 219, 43, 156, 80, 136, 217, 164, 227, 39, 163, 40, 109, 232, 216, 63, 244, 195, 154, 79, 183, 126,
-    49, 221, 204, 251, 135, 171, 22, 248, 248, 152, 71, 249, 45, 12, 2, 57, 217, 188, 105, 16, 40, 248, 233, 255, 101,
-    192, 184, 110, 100, 220, 181, 166, 31, 25, 6, 223, 16, 154, 29, 129, 92, 155, 22, 8, 124, 84, 81, 145, 49, 202, 108,
-    127, 176, 209, 162, 244, 90, 255, 88, 51, 35, 44, 3, 220, 17, 47, 205, 37, 184, 200, 13, 247, 46, 200, 168, 105, 27,
-    202, 166, 161, 51, 85, 59, 126, 66, 184, 150, 103, 212, 130, 31, 188, 61, 73, 70, 170, 58, 240, 105, 101, 247, 53,
-    34, 18, 59, 124, 185, 90, 61, 186, 81, 189, 47, 172, 105, 66, 183, 55, 245, 68, 117, 101, 123, 176, 97, 50, 88, 191,
-    181, 20, 5, 235, 180, 73, 180, 234, 80, 44, 142, 55, 250, 51, 147, 161, 95, 178, 147, 67, 157, 179, 100, 132, 37,
-    43, 67, 247, 76, 184, 177, 34, 236, 65, 167, 161, 210, 224, 53, 10, 2, 76, 230, 97, 25, 112, 129, 46, 202, 26, 50,
-    153, 246, 1, 104, 114, 208, 110, 105, 241, 40, 128, 138, 102, 3, 132, 77, 39, 87, 220, 253, 182, 56, 177, 161, 156,
-    178, 155, 129, 103, 146, 65, 128, 54, 156, 224, 43, 67, 203, 60, 253, 131, 126, 4, 21, 200, 144, 167, 89, 86, 40,
-    60, 222, 58, 157, 103, 120, 138, 160, 82, 176, 207, 221, 22, 143, 178, 139, 233, 113, 66, 82, 120, 214, 198, 185,
-    63, 13, 255, 47, 81, 149, 131, 99, 32, 16, 145, 220, 5, 251, 231, 221, 19, 242, 176, 64, 236, 9, 250, 204, 12, 120,
-    241, 34, 253, 160, 174, 84, 24, 194, 76, 141, 48, 13, 96, 96, 240, 145, 178, 170, 144, 194, 120, 174, 7, 130, 172,
-    142, 144, 186, 93, 60, 84, 107, 244, 42, 161, 88, 58, 126, 106, 65, 28, 134, 88, 155, 35, 220, 54, 93, 78, 223, 46,
-    81, 244, 70, 11, 179, 201, 67, 2, 163, 17, 89, 209, 236, 225, 175, 251, 14, 1, 230, 133, 217, 182, 157, 240, 218,
-    203, 84, 8, 10, 70, 164, 218, 119, 69, 181, 2, 227, 9, 78, 5, 218, 163, 77, 37, 133, 172, 83, 101, 39, 135, 130, 13,
-    52, 25, 87, 157, 12, 109, 79, 224, 10, 146, 241, 97, 241, 34, 234, 188, 92, 159, 224, 51, 17, 216, 78, 95, 37, 57,
-    79, 24, 177, 115, 94, 43, 205, 212, 252, 135, 127, 101, 27, 172, 35, 187, 110, 121, 100, 243, 184, 73, 38, 90, 122,
-    0, 113, 180, 104, 252, 174, 152, 2, 52, 55, 92, 147, 187, 249, 52, 160, 81, 215, 78, 189, 91, 255, 150, 62, 135,
-    186, 45, 129, 130, 31, 20, 168, 156, 82, 2, 28, 2, 154, 234, 120, 110, 64, 183, 185, 236, 166, 188, 74, 32, 105, 72,
-    68, 47, 28, 176, 195, 250, 38, 175, 253, 162, 114, 35, 7, 168, 194, 78, 113, 154, 138, 49, 151, 125, 1, 141, 66, 11,
-    19, 9, 71, 38, 239, 226, 125, 246, 157, 190, 93, 70, 118, 28, 16, 132, 119, 128, 231, 21, 229, 171, 186, 172, 166,
-    86, 141, 161, 223, 232, 246, 131, 162, 232, 243, 211, 142, 167, 61, 56, 28, 21, 46, 252, 219, 98, 143, 11, 89, 38,
-    18, 30, 204, 61, 71, 153, 90, 133, 149, 71, 125, 24, 139, 17, 113, 62, 212, 145, 141, 80, 23, 174, 96, 196, 214, 94,
-    30, 193, 61, 157, 40, 132, 92, 12, 171, 117, 74, 224, 240, 214, 124, 164, 95, 221, 147, 130, 89, 115, 170, 43, 17,
-    56, 4, 243, 209, 202, 105, 216, 77, 148, 135, 28, 126, 214, 96, 112, 163, 146, 247, 179, 251, 181, 1, 104, 134, 65,
-    95, 138, 177, 72, 46, 105, 232, 210, 11, 83, 226, 74, 28, 130, 193, 242, 87, 27, 124, 44, 181, 189, 157, 71, 243,
-    131, 151, 119, 63, 198, 197, 233, 131, 59, 199, 137, 242, 112, 130, 119, 86, 139, 128, 210, 254, 37, 216, 181, 236,
-    163, 198, 73, 168, 182, 112, 202, 129, 83, 198, 138, 192, 230, 77, 89, 145, 76, 148, 29, 99, 251, 50, 142, 99, 25,
-    86, 185, 222, 78, 128, 176, 31, 56, 147, 50, 40, 38, 127, 95, 90, 124, 188, 195, 23, 19, 1, 149, 184, 228, 152, 93,
-    193, 182, 169, 33, 213, 67, 50, 74, 175, 13, 104, 235, 176, 157, 251, 156, 46, 168, 198, 118, 140, 208, 137, 26,
-    219, 177, 204, 212, 2, 76, 216, 29, 253, 163, 29, 15, 64, 131, 9, 201, 241, 43, 67, 121, 10, 146, 133, 47, 149, 246,
-    52, 118, 130, 27, 242, 199, 75, 8, 107, 152, 87, 16, 179, 122, 138, 94, 158, 194, 73, 17, 44, 109, 153, 48, 20, 74,
-    176, 110, 11, 143, 81, 222, 224, 54, 72, 114, 148, 194, 10, 81, 34, 166, 29, 67, 50, 124, 206, 123, 156, 131, 128,
-    33, 144, 216, 167, 62, 112, 172, 69, 86, 111, 92, 104, 21, 17, 119, 130, 34, 240, 146, 13, 109, 70, 171, 160, 177,
-    32, 124, 32, 40, 195, 162, 211, 49, 237, 68, 220, 49, 191, 81, 53, 31, 232, 188, 136, 35, 182, 143, 245, 24, 249,
-    131, 145, 159, 42, 177, 10, 26, 25, 248, 75, 215, 207, 129, 68, 214, 106, 104, 39, 199, 124, 100, 89, 150, 29, 66,
-    91, 122, 241, 67, 97, 0, 172, 245, 148, 245, 204, 210, 34, 69, 228, 235, 200, 131, 182, 128, 77, 143, 108, 144, 47,
-    124, 129, 22, 202, 240, 94, 109, 23, 168, 45, 88, 202, 171, 98, 140, 250, 191, 37, 200, 152, 95, 149, 92, 34, 125,
-    213, 247, 192, 3, 150, 147, 246, 42, 201, 61, 164, 249, 169, 16, 90, 124, 152, 165, 216, 193, 133, 36, 116, 135,
-    152, 19, 68, 244, 168, 49, 230, 221, 121, 131, 39, 12, 255, 241, 235, 94, 66, 131, 131, 177, 162, 60, 155, 44, 188,
-    225, 127, 208, 121, 182, 72, 211, 239, 120, 29, 234, 110, 133, 153, 201, 90, 44, 170, 183, 138, 168, 226, 30, 7,
-    234, 233, 128, 130, 150, 239, 192, 180, 68, 92, 55, 118, 135, 249, 22, 184, 175, 42, 19, 240, 135, 142, 135, 25,
-    113, 18, 144, 91, 92, 196, 84, 59, 175, 29, 177, 26, 49, 119, 247, 25, 185, 231, 119, 211, 179, 12, 185, 254, 163,
-    232, 42, 135, 61, 33, 179, 235, 140, 161, 250, 45, 157, 184, 248, 128, 92, 157, 110, 234, 146, 29, 215, 174, 177,
-    223, 187, 157, 95, 242, 124, 148, 142, 210, 211, 196, 68, 177, 189, 144, 0, 42, 241, 212, 232, 66, 99, 93, 43, 245,
-    238, 10, 150, 214, 62, 127, 150, 121, 172, 5, 193, 67, 250, 165, 32, 146, 153, 119, 151, 11, 131, 202, 211, 51, 226,
-    136, 159, 21, 235, 215, 111, 77, 59, 198, 61, 17, 80, 36, 0, 119, 113, 126, 204, 203, 236, 69, 13, 241, 12, 90, 221,
-    215, 210, 42, 161, 150, 53, 230, 237, 207, 236, 126, 159, 4, 72, 56, 215, 221, 55, 112, 112, 151, 146, 192, 48, 210,
-    67, 137, 66, 217, 241, 241, 202, 191, 4, 49, 174, 164, 216, 189, 14, 161, 77, 150, 232, 75, 11, 119, 35, 25, 243,
-    80, 125, 145, 181, 109, 57, 97, 30, 169, 135, 169, 34, 99, 12, 33, 254, 60, 120, 52, 143, 190, 76, 130, 221, 156,
-    158, 243, 91, 7, 42, 6, 1, 190, 32, 78, 43, 238, 34, 90, 183, 48, 232, 10, 170, 48, 42, 2, 18, 225, 198, 95, 181,
-    32, 213, 24, 202, 115, 42, 161, 51, 146, 224, 139, 238, 109, 3, 46, 80, 189, 78, 239, 69, 164, 87, 83, 250, 47, 186,
-    152, 117, 45, 171, 191, 201, 198, 116, 113, 24, 21, 231, 67, 202, 214, 87, 7, 127, 155, 138, 227, 194, 52, 250, 119,
-    88, 63, 159, 238, 234, 238, 101, 15, 181, 83, 129, 98, 24, 15, 211, 181, 58, 142, 56, 26, 34, 232, 74, 69, 200, 121,
-    170, 51, 122, 100, 179, 12, 141, 50, 122, 185, 19, 145, 253, 135, 213, 150, 73, 187, 54, 199, 10, 182, 29, 220, 151,
-    53, 102, 227, 127, 49, 191, 89, 130, 149, 93, 242, 240, 129, 149, 4, 219, 11, 162, 136, 30, 60, 232, 216, 57, 218,
-    187, 92, 73, 154, 168, 212, 186, 139, 94, 191, 195, 243, 97, 39, 128, 103, 0, 203, 66, 180, 112, 130, 20, 12, 54, 8,
-    61, 214, 49, 110, 22, 162, 104, 201, 255, 66, 151, 193, 56, 111, 212, 195, 206, 201, 186, 255, 8, 196, 174, 201, 71,
-    221, 211, 128, 44, 72, 78, 160, 98, 163, 242, 220, 59, 167, 136, 34, 45, 233, 8, 87, 182, 245, 69, 171, 73, 149,
-    185, 128, 196, 116, 15, 78, 168, 39, 165, 122, 95, 232, 172, 221, 40, 43, 32, 204, 186, 204, 250, 211, 223, 0, 207,
-    5, 32, 223, 112, 75, 178, 172, 92, 231, 170, 0, 24, 128, 183, 130, 254, 152, 209, 41, 60, 134, 185, 10, 42, 188, 67,
-    78, 70, 97, 138, 59, 50, 254, 79, 13, 33, 208, 174, 230, 162, 164, 189, 23, 57, 100, 171, 33, 152, 24, 170, 87, 176,
-    144, 141, 27, 69, 88, 199, 94, 237, 22, 71, 43, 6, 240, 5, 62, 72, 2, 188, 81, 166, 149, 142, 139, 192, 0, 93, 232,
-    33, 164, 72, 99, 159, 207, 61, 152, 77, 236, 150, 91, 46, 65, 18, 38, 61, 32, 196, 124, 16, 189, 129, 169, 225, 242,
-    75, 16, 24, 69, 81, 155, 251, 16, 143, 40, 167, 166, 66, 165, 236, 102, 114, 100, 77, 9, 15, 85, 153, 43, 18, 30,
-    141, 9, 118, 114, 125, 200, 219, 157, 5, 62, 179, 197, 2, 96, 118, 39, 203, 89, 27, 124, 217, 54, 14, 76, 101, 58,
-    167, 138, 254, 41, 180, 15, 183, 47, 227, 83, 41, 176, 107, 138, 63, 33, 194, 114, 9, 192, 45, 205, 250, 128, 188,
-    4, 255, 173, 85, 228, 159, 187, 47, 177, 248, 41, 114, 210, 209, 218, 143, 172, 243, 200, 253, 171, 179, 62, 63, 80,
-    224, 96, 170, 110, 58, 120, 212, 153, 206, 169, 132, 148, 8, 77, 148, 48, 160, 109, 186, 92, 74, 87, 50, 196, 252,
-    208, 233, 103, 67, 102, 7, 87, 252, 56, 179, 158, 122, 139, 44, 164, 2, 212, 8, 242, 69, 189, 39, 242, 211, 39, 48,
-    224, 16, 48, 122, 89, 107, 91, 219, 58, 67, 28, 116, 148, 220, 113, 240, 86, 226, 168, 190, 125, 16, 69, 136, 108,
-    219, 139, 127, 190, 133, 147, 26, 78, 226, 48, 36, 136, 79, 60, 114, 73, 147, 243, 231, 118, 177, 206, 9, 66, 71,
-    90, 81, 11, 184, 223, 225, 75, 173, 96, 187, 200, 185, 254, 76, 17, 210, 85, 74, 239, 131, 89, 153, 111, 218, 245,
-    75, 141, 104, 69, 173, 56, 76, 59, 211, 34, 187, 238, 158, 198, 88, 199, 38, 131, 34, 57, 101, 132, 106, 189, 213,
-    37, 250, 129, 241, 152, 160, 211, 21, 233, 169, 241, 26, 158, 60, 34, 70, 73, 11, 149, 215, 117, 221, 163, 174, 148,
-    236, 154, 191, 25, 230, 182, 231, 237, 183, 208, 142, 80, 139, 17, 48, 230, 144, 108, 123, 11, 111, 29, 201, 108,
-    138, 86, 31, 72, 151, 192, 162, 208, 190, 77, 104, 78, 75, 23, 219, 43, 47, 128, 169, 97, 140, 51, 147, 211, 61,
-    140, 13, 161, 163, 206, 13, 166, 107, 15, 105, 212, 131, 184, 102, 44, 234, 49, 5, 211, 47, 172, 84, 74, 202, 242,
-    246, 156, 231, 65, 117, 170, 34, 192, 84, 92, 183, 240, 5, 77, 87, 210, 165, 242, 0, 163, 124, 224, 123, 60, 69,
-    131, 9, 65, 48, 161, 237, 129, 14, 118, 50, 166, 236, 139, 146, 16, 180, 250, 225, 5, 32, 24, 222, 226, 236, 83,
-    252, 59, 95, 254, 183, 49, 185, 157, 133, 214, 0, 110, 4, 253, 175, 121, 219, 15, 190, 190, 87, 96, 165, 95, 15,
-    183, 184, 62, 71, 7, 107, 25, 3, 149, 56, 139, 235, 225, 164, 1, 168, 200, 81, 12, 103, 111, 22, 97, 167, 214, 213,
-    64, 31, 23, 96, 115, 226, 212, 181, 148, 17, 124, 145, 233, 128, 81, 140, 56, 206, 174, 107, 86, 24, 173, 141, 207,
-    138, 39, 46, 226, 159, 254, 111, 96, 63, 205, 44, 206, 70, 85, 73, 182, 191, 152, 125, 141, 201, 85, 225, 41, 23,
-    178, 180, 165, 126, 175, 105, 134, 167, 168, 52, 74, 114, 74, 22, 192, 202, 72, 124, 43, 47, 137, 222, 7, 140, 19,
-    142, 38, 154, 175, 41, 103, 148, 130, 102, 112, 240, 93, 216, 232, 83, 5, 94, 15, 231, 119, 148, 117, 66, 49, 169,
-    144, 37, 202, 93, 95, 3, 40, 223, 45, 102, 105, 88, 227, 65, 248, 141, 138, 187, 124, 181, 19, 31, 98, 135, 80, 75,
-    119, 165, 135, 61, 52, 178, 75, 248, 52, 175, 197, 234, 159, 186, 21, 143, 199, 114, 16, 0, 227, 240, 86, 103, 199,
-    209, 193, 49, 57, 8, 18, 214, 238, 80, 91, 25, 84, 36, 211, 41, 218, 121, 127, 147, 224, 107, 181, 209, 62, 246, 1,
-    161, 136, 72, 82, 190, 97, 146, 78, 31, 129, 12, 137, 129, 232, 44, 80, 96, 31, 14, 213, 121, 229, 83, 255, 220,
-    161, 241, 246, 56, 249, 169, 201, 56, 253, 121, 12, 101, 65, 214, 68, 125, 254, 169, 71, 214, 60, 12, 95, 0, 163,
-    17, 196, 104, 26, 91, 205, 160, 50, 24, 34, 190, 96, 108, 85, 223, 45, 163, 12, 172, 108, 122, 243, 113, 205, 186,
-    179, 165, 8, 77, 168, 149, 50, 226, 254, 195, 113, 157, 37, 135, 179, 86, 107, 124, 224, 205, 154, 5, 233, 66, 205,
-    237, 41, 37, 59, 172, 203, 47, 91, 111, 239, 160, 94, 232, 49, 86, 2, 34, 239, 152, 17, 113, 118, 177, 177, 195,
-    153, 210, 41, 36, 194, 56, 223, 213, 223, 71, 68, 10, 207, 162, 193, 10, 171, 210, 65, 56, 136, 26, 141, 139, 219,
-    76, 53, 23, 68, 117, 129, 139, 31, 255, 115, 138, 150, 69, 58, 147, 2, 67, 51, 31, 20, 184, 196, 183, 181, 149, 196,
-    37, 175, 242, 71, 168, 148, 213, 203, 169, 139, 163, 17, 253, 232, 216, 31, 218, 129, 77, 209, 35, 145, 153, 10,
-    163, 252, 46, 113, 32, 164, 121, 60, 54, 87, 114, 10, 23, 221, 6, 151, 206, 203, 122, 34, 88, 171, 106, 209, 239,
-    104, 247, 183, 223, 207, 20, 30, 75, 254, 7, 187, 111, 154, 243, 191, 198, 218, 198, 245, 20, 46, 245, 90, 246, 7,
-    230, 43, 88, 246, 127, 76, 131, 229, 192, 108, 98, 214, 211, 81, 222, 33, 206, 87, 176, 144, 163, 179, 154, 40, 251,
-    136, 23, 184, 172, 87, 59, 69, 121, 64, 34, 16, 143, 153, 119, 11, 29, 211, 51, 238, 210, 80, 226, 147, 10, 80, 219,
-    234, 214, 248, 217, 138, 11, 140, 142, 172, 186, 248, 227, 24, 125, 53, 204, 140, 222, 226, 240, 2, 166, 66, 158,
-    248, 223, 185, 195, 130, 212, 189, 20, 140, 229, 187, 248, 96, 69, 54, 75, 191, 143, 68, 13, 107, 95, 127, 58, 67,
-    201, 7, 69, 250, 103, 98, 128, 7, 144, 245, 202, 15, 196, 171, 148, 171, 233, 196, 91, 126, 221, 201, 21, 165, 161,
-    165, 112, 163, 234, 128, 239, 248, 185, 177, 0, 104, 7, 119, 249, 232, 144, 200, 12, 215, 236, 160, 4, 39, 133, 40,
-    157, 35, 104, 199, 155, 233, 214, 76, 10, 69, 134, 245, 72, 102, 48, 97, 207, 238, 163, 82, 73, 207, 132, 38, 81,
-    63, 192, 108, 43, 82, 4, 244, 108, 199, 253, 125, 10, 228, 95, 158, 58, 189, 184, 135, 226, 81, 105, 126, 113, 25,
-    55, 0, 88, 249, 76, 20, 120, 19, 128, 146, 74, 16, 123, 202, 145, 31, 106, 186, 236, 61, 183, 42, 157, 168, 54, 192,
-    170, 4, 63, 229, 169, 142, 214, 185, 22, 16, 104, 205, 1, 78, 200, 108, 127, 227, 152, 33, 74, 101, 79, 7, 41, 120,
-    57, 87, 187, 168, 254, 74, 19, 89, 229, 5, 133, 48, 51, 251, 112, 55, 41, 103, 45, 188, 242, 197, 59, 24, 203, 94,
-    131, 73, 188, 201, 139, 103, 117, 207, 154, 52, 123, 46, 64, 19, 18, 166, 112, 190, 75, 205, 137, 95, 136, 50, 180,
-    172, 244, 214, 219, 24, 194, 7, 255, 79, 205, 8, 165, 88, 129, 156, 11, 87, 153, 234, 183, 166, 178, 244, 165, 129,
-    80, 52, 8, 149, 239, 114, 30, 205, 142, 214, 87, 187, 26, 31, 250, 160, 113, 224, 181, 59, 21, 176, 1, 152, 71, 213,
-    233, 41, 29, 29, 184, 108, 253, 254, 140, 189, 88, 82, 58, 126, 46, 11, 237, 175, 67, 242, 156, 74, 25, 209, 195, 1,
-    90, 121, 50, 9, 240, 84, 13, 142, 63, 198, 230, 25, 48, 27, 223, 91, 163, 62, 99, 211, 148, 119, 143, 115, 149, 121,
-    182, 48, 105, 122, 70, 154, 154, 227, 53, 144, 102, 74, 167, 229, 239, 64, 96, 168, 216, 172, 22, 219, 17, 168, 15,
-    180, 126, 184, 199, 188, 64, 90, 118, 252, 83, 101, 126, 121, 239, 136, 229, 113, 122, 138, 54, 187, 249, 93, 209,
-    40, 238, 192, 137, 197, 48, 241, 36, 227, 34, 150, 123, 141, 197, 218, 146, 24, 21, 188, 223, 96, 192, 171, 14, 88,
-    182, 32, 153, 2, 4, 34, 105, 112, 87, 184, 184, 230, 44, 239, 89, 219, 135, 137, 61, 202, 208, 206, 236, 190, 242,
-    77, 213, 149, 243, 120, 139, 35, 74, 138, 3, 167, 226, 24, 91, 59, 58, 76, 186, 55, 76, 168, 36, 117, 194, 244, 48,
-    234, 158, 231, 161, 127, 96, 252, 249, 109, 186, 16, 1, 13, 45, 133, 163, 182, 205, 201, 21, 244, 179, 58, 205, 5,
-    219, 198, 252, 162, 50, 156, 74, 105, 240, 144, 226, 32, 247, 202, 89, 59, 125, 40, 43, 152, 215, 239, 125, 77, 245,
-    2, 22, 74, 228, 91, 251, 77, 50, 218, 220, 168, 223, 217, 164, 150, 231, 91, 100, 38, 197, 63, 248, 204, 135, 80,
-    252, 158, 222, 134, 115, 244, 140, 125, 159, 92, 159, 170, 255, 135, 144, 221, 172, 170, 103, 54, 65, 90, 140, 25,
-    119, 77, 157, 29, 220, 109, 65, 134, 12, 58, 117, 100, 236, 249, 142, 141, 247, 49, 50, 58, 82, 225, 169, 186, 68,
-    91, 229, 173, 21, 119, 61, 197, 56, 45, 148, 47, 66, 159, 123, 138, 169, 75, 176, 88, 70, 101, 219, 171, 253, 96,
-    21, 200, 159, 101, 233, 96, 46, 166, 131, 89, 125, 25, 68, 84, 180, 64, 38, 232, 235, 133, 208, 123, 61, 78, 223,
-    124, 188, 104, 178, 81, 33, 255, 128, 149, 11, 125, 170, 144, 158, 36, 203, 104, 89, 72, 77, 112, 39, 50, 195, 184,
-    248, 111, 11, 143, 148, 111, 141, 101, 237, 110, 137, 137, 207, 215, 21, 159, 109, 185, 150, 119, 148, 53, 205, 38,
-    187, 121, 137, 166, 227, 219, 156, 115, 190, 66, 143, 208, 88, 129, 163, 111, 150, 72, 184, 166, 27, 211, 42, 238,
-    173, 46, 4, 177, 26, 48, 54, 178, 42, 186, 242, 135, 53, 34, 176, 183, 129, 15, 116, 150, 36, 43, 82, 163, 232, 230,
-    40, 142, 172, 231, 193, 14, 153, 121, 99, 197, 7, 168, 221, 201, 58, 179, 245, 149, 214, 235, 148, 68, 218, 202,
-    194, 56, 94, 248, 15, 195, 193, 123, 213, 12, 150, 15, 55, 157, 48, 205, 43, 233, 163, 81, 245, 227, 120, 12, 201,
-    118, 53, 156, 92, 96, 228, 121, 31, 20, 111, 224, 248, 221, 196, 135, 237, 184, 148, 71, 87, 116, 175, 86, 135, 227,
-    102, 51, 199, 110, 2, 27, 209, 35, 219, 172, 46, 250, 57, 142, 154, 25, 149, 85, 109, 164, 139, 10, 178, 94, 254,
-    250, 182, 45, 121, 89, 76, 192, 219, 147, 241, 99, 147, 167, 19, 240, 25, 71, 94, 130, 220, 170, 22, 175, 249, 170,
-    147, 160, 122, 131, 65, 77, 145, 35, 84, 228, 245, 222, 44, 26, 7, 36, 90, 77, 201, 234, 78, 189, 120, 127, 145,
-    135, 35, 218, 18, 49, 162, 184, 179, 129, 38, 35, 69, 183, 113, 62, 233, 2, 126, 92, 227, 222, 86, 103, 219, 170,
-    29, 137, 167, 109, 108, 137, 29, 39, 132, 124, 117, 223, 170, 134, 95, 56, 180, 132, 51, 80, 41, 237, 14, 207, 84,
-    116, 205, 199, 205, 155, 16, 13, 17, 81, 26, 71, 123, 81, 254, 32, 96, 16, 156, 10, 18, 255, 11, 64, 218, 58, 15,
-    209, 1, 223, 53, 19, 78, 0, 79, 93, 1, 139, 17, 129, 126, 227, 131, 88, 72, 74, 38, 134, 136, 22, 131, 196, 161,
-    152, 155, 144, 5, 18, 227, 119, 28, 138, 173, 36, 144, 133, 185, 111, 197, 159, 254, 19, 29, 152, 71, 48, 90, 187,
-    134, 10, 96, 158, 221, 214, 68, 16, 127, 146, 78, 152, 227, 135, 143, 12, 170, 68, 183, 72, 142, 104, 160, 129, 163,
-    143, 3, 161, 8, 155, 15, 212, 85, 119, 236, 189, 10, 194, 222, 155, 0, 90, 85, 170, 102, 52, 209, 95, 106, 191, 215,
-    161, 223, 116, 113, 196, 213, 168, 197, 101, 94, 84, 160, 31, 17, 149, 208, 18, 134, 18, 84, 70, 20, 160, 37, 78,
-    101, 55, 157, 49, 186, 231, 149, 86, 9, 108, 210, 80, 154, 69, 193, 248, 10, 34, 229, 32, 84, 168, 120, 155, 5, 52,
-    253, 169, 184, 227, 15, 252, 208, 134, 86, 218, 160, 12, 193, 193, 132, 172, 155, 194, 124, 225, 148, 248, 248, 250,
-    0, 99, 164, 249, 152, 178, 212, 254, 111, 231, 37, 133, 88, 10, 65, 4, 138, 194, 147, 72, 117, 38, 186, 238, 90, 67,
-    255, 249, 241, 193, 252, 159, 6, 86, 98, 193, 123, 41, 26, 123, 234, 8, 119, 141, 16, 182, 188, 125, 203, 241, 119,
-    123, 28, 101, 212, 63, 240, 171, 65, 51, 161, 218, 55, 28, 92, 110, 141, 191, 29, 105, 37, 238, 205, 113, 202, 48,
-    135, 145, 73, 16, 36, 40, 214, 166, 177, 73, 130, 207, 21, 140, 205, 162, 50, 118, 166, 239, 106, 161, 105, 190,
-    126, 18, 41, 164, 13, 224, 76, 29, 149, 152, 183, 79, 38, 151, 218, 5, 234, 173, 94, 60, 110, 98, 144, 15, 40, 80,
-    142, 215, 63, 108, 252, 151, 150, 234, 140, 200, 205, 80, 219, 193, 206, 173, 76, 41, 41, 253, 32, 144, 59, 201,
-    228, 237, 44, 19, 34, 45, 150, 231, 34, 212, 138, 150, 27, 190, 140, 41, 237, 36, 189, 148, 206, 106, 143, 44, 74,
-    85, 64, 22, 107, 92, 69, 142, 67, 74, 247, 158, 33, 174, 6, 49, 170, 219, 125, 48, 219, 213, 178, 133, 57, 135, 172,
-    74, 175, 94, 81, 230, 46, 113, 71, 250, 70, 140, 42, 192, 211, 215, 207, 65, 189, 68, 10, 96, 234, 221, 27, 46, 79,
-    114, 179, 51, 173, 158, 199, 146, 13, 126, 101, 162, 238, 89, 127, 197, 192, 98, 170, 64, 192, 12, 20, 46, 232, 88,
-    222, 175, 164, 19, 175, 202, 95, 241, 97, 215, 64, 163, 98, 38, 17, 193, 237, 117, 172, 169, 144, 181, 142, 64, 89,
-    88, 101, 111, 185, 147, 226, 26, 195, 206, 84, 71, 228, 76, 34, 92, 52, 235, 19, 209, 48, 162, 131, 192, 203, 130,
-    167, 169, 219, 82, 117, 64, 96, 189, 243, 112, 40, 243, 217, 2, 121, 65, 37, 105, 214, 70, 127, 77, 251, 15, 206,
-    121, 152, 235, 178, 133, 188, 197, 161, 69, 40, 30, 64, 182, 174, 182, 48, 17, 206, 254, 162, 229, 105, 94, 190,
-    109, 49, 219, 47, 69, 22, 220, 113, 30, 51, 120, 0, 117, 1, 139, 8, 4, 155, 145, 90, 226, 127, 147, 76, 9, 88, 94,
-    117, 88, 220, 22, 3, 60, 38, 251, 160, 47, 249, 94, 1, 158, 60, 34, 136, 23, 103, 231, 103, 129, 139, 195, 212, 247,
-    119, 105, 73, 78, 115, 177, 182, 120, 227, 118, 18, 60, 165, 206, 204, 89, 158, 89, 210, 115, 16, 133, 172, 220,
-    116, 69, 215, 99, 19, 51, 250, 217, 136, 183, 128, 63, 0, 162, 120, 132, 182, 130, 70, 132, 22, 199, 200, 48, 150,
-    36, 241, 255, 184, 152, 156, 54, 198, 164, 42, 209, 138, 143, 116, 80, 245, 121, 20, 126, 163, 171, 158, 120, 43,
-    72, 180, 124, 78, 171, 161, 74, 37, 1, 15, 184, 55, 106, 79, 13, 89, 153, 204, 19, 251, 49, 152, 25, 107, 209, 161,
-    130, 213, 69, 222, 233, 171, 5, 202, 211, 244, 130, 38, 169, 117, 204, 220, 225, 50, 234, 126, 213, 188, 191, 147,
-    95, 193, 176, 154, 144, 173, 220, 148, 68, 103, 59, 249, 155, 52, 180, 77, 254, 156, 69, 42, 141, 194, 208, 67, 161,
-    205, 38, 35, 133, 212, 24, 212, 219, 105, 40, 53, 218, 28, 232, 14, 121, 245, 167, 57, 220, 62, 75, 233, 41, 176,
-    125, 90, 94, 133, 179, 138, 115, 199, 227, 90, 105, 103, 100, 227, 64, 107, 239, 246, 120, 70, 163, 161, 180, 239,
-    30, 68, 103, 203, 23, 217, 89, 36, 36, 128, 194, 209, 144, 17, 104, 154, 207, 252, 68, 168, 91, 247, 16, 3, 191,
-    190, 145, 119, 63, 54, 177, 117, 187, 189, 231, 65, 196, 195, 170, 67, 236, 245, 47, 29, 2, 132, 213, 233, 24, 228,
-    18, 56, 9, 159, 118, 67, 65, 2, 83, 83, 29, 236, 58, 203, 110, 180, 97, 100, 125, 38, 225, 96, 3, 48, 70, 19, 181,
-    148, 108, 181, 28, 149, 26, 127, 33, 239, 59, 146, 162, 88, 230, 254, 74, 71, 115, 56, 45, 37, 86, 182, 236, 137,
-    14, 91, 86, 182, 231, 1, 121, 52, 164, 68, 196, 180, 95, 100, 13, 188, 61, 128, 7, 49, 85, 11, 128, 151, 46, 249,
-    120, 79, 234, 32, 245, 62, 13, 29, 246, 200, 101, 138, 13, 243, 96, 132, 43, 247, 67, 98, 95, 114, 169, 45, 63, 129,
-    177, 51, 65, 153, 81, 106, 183, 161, 238, 188, 16, 214, 193, 28, 224, 219, 117, 114, 213, 123, 121, 124, 153, 182,
-    123, 158, 220, 226, 179, 151, 198, 94, 26, 153, 125, 20, 34, 210, 205, 165, 230, 200, 252, 234, 253, 240, 160, 47,
-    174, 125, 105, 98, 36, 143, 225, 70, 180, 142, 237, 174, 190, 41, 3, 96, 161, 189, 141, 5, 164, 133, 57, 145, 174,
-    31, 251, 120, 178, 52, 101, 247, 220, 93, 49, 163, 67, 15, 134, 141, 107, 72, 19, 123, 114, 119, 239, 99, 117, 217,
-    27, 72, 13, 196, 251, 210, 158, 200, 151, 110, 83, 35, 68, 65, 236, 208, 179, 12, 83, 165, 68, 124, 193, 66, 206,
-    144, 6, 10, 156, 107, 137, 78, 145, 141, 14, 49, 196, 21, 198, 41, 68, 119, 172, 228, 18, 225, 14, 172, 192, 49, 25,
-    183, 182, 221, 232, 70, 131, 12, 33, 213, 164, 132, 170, 15, 86, 137, 7, 139, 78, 149, 251, 245, 44, 6, 229, 110,
-    167, 149, 119, 36, 238, 17, 231, 98, 109, 33, 162, 140, 33, 169, 27, 242, 148, 100, 159, 245, 250, 173, 70, 56, 76,
-    174, 64, 63, 107, 196, 1, 109, 12, 92, 100, 252, 184, 220, 217, 162, 58, 42, 64, 74, 167, 94, 86, 38, 180, 186, 147,
-    172, 125, 39, 181, 153, 110, 203, 6, 185, 87, 44, 3, 73, 136, 38, 215, 130, 3, 111, 22, 228, 40, 58, 62, 103, 255,
-    230, 49, 145, 28, 35, 155, 25, 84, 218, 73, 50, 100, 83, 59, 41, 165, 41, 31, 167, 105, 176, 28, 178, 171, 178, 124,
-    98, 14, 34, 72, 102, 8, 100, 79, 144, 2, 2, 59, 9, 46, 23, 72, 18, 163, 30, 45, 210, 55, 40, 163, 54, 86, 66, 177,
-    238, 32, 104, 243, 205, 191, 97, 30, 63, 233, 84, 111, 41, 137, 110, 34, 56, 106, 227, 95, 196, 104, 127, 171, 102,
-    59, 54, 214, 252, 103, 208, 189, 10, 221, 118, 126, 4, 86, 134, 150, 228, 107, 139, 138, 43, 184, 212, 145, 54, 98,
-    71, 21, 68, 249, 48, 131, 112, 172, 224, 248, 203, 47, 103, 122, 144, 193, 249, 91, 211, 20, 52, 220, 84, 111, 134,
-    42, 187, 166, 184, 126, 189, 149, 82, 235, 161, 196, 135, 18, 78, 41, 130, 31, 193, 151, 133, 21, 93, 217, 139, 180,
-    128, 239, 81, 232, 250, 206, 53, 193, 135, 103, 142, 9, 29, 66, 240, 249, 243, 182, 145, 176, 68, 50, 35, 87, 144,
-    239, 129, 153, 3, 117, 221, 245, 66, 129, 205, 197, 154, 185, 30, 193, 114, 226, 199, 58, 81, 1, 10, 233, 192, 194,
-    70, 109, 126, 99, 122, 14, 135, 128, 231, 193, 61, 94, 180, 22, 184, 58, 166, 11, 137, 23, 14, 96, 151, 116, 53,
-    178, 142, 234, 204, 199, 71, 141, 7, 120, 225, 80, 69, 30, 102, 128, 151, 163, 183, 156, 236, 137, 232, 246, 195,
-    59, 105, 195, 153, 72, 189, 114, 40, 54, 203, 62, 37, 77, 221, 174, 2, 14, 124, 218, 140, 54, 173, 169, 254, 167, 7,
-    41, 144, 154, 51, 8, 245, 209, 245, 204, 104, 50, 132, 211, 41, 102, 209, 86, 185, 111, 173, 220, 143, 66, 2, 27,
-    73, 185, 200, 231, 192, 228, 225, 171, 126, 8, 109, 29, 202, 180, 59, 219, 217, 2, 121, 198, 92, 227, 75, 237, 93,
-    111, 107, 79, 198, 252, 43, 17, 79, 38, 255, 77, 49, 14, 224, 138, 125, 25, 87, 32, 77, 133, 43, 70, 66, 103, 177,
-    128, 59, 51, 79, 161, 155, 220, 139, 247, 111, 36, 182, 254, 108, 231, 147, 98, 4, 1, 239, 38, 223, 71, 87, 22, 98,
-    221, 96, 200, 231, 146, 189, 61, 154, 54, 46, 238, 67, 105, 8, 226, 159, 87, 122, 86, 139, 13, 216, 1, 7, 255, 175,
-    118, 66, 178, 24, 175, 65, 114, 35, 199, 182, 196, 66, 136, 199, 95, 59, 220, 179, 65, 143, 49, 53, 136, 126, 63,
-    12, 148, 30, 26, 100, 120, 170, 109, 21, 68, 94, 218, 210, 207, 168, 43, 156, 117, 69, 160, 87, 71, 109, 56, 136,
-    175, 249, 95, 235, 126, 17, 3, 215, 87, 51, 38, 24, 232, 64, 236, 140, 127, 249, 240, 217, 165, 178, 140, 117, 235,
-    169, 177, 92, 36, 243, 235, 63, 78, 237, 105, 242, 183, 136, 160, 211, 122, 34, 93, 233, 44, 1, 192, 118, 250, 52,
-    226, 15, 42, 200, 64, 14, 40, 50, 158, 16, 133, 43, 215, 49, 60, 29, 187, 185, 87, 152, 158, 144, 121, 218, 12, 191,
-    171, 101, 59, 117, 250, 244, 15, 55, 152, 192, 9, 170, 138, 144, 145, 36, 66, 152, 120, 129, 81, 153, 47, 182, 29,
-    119, 7, 174, 150, 202, 68, 165, 209, 37, 160, 231, 228, 105, 49, 57, 211, 141, 101, 243, 83, 211, 53, 21, 53, 184,
-    9, 242, 148, 84, 39, 225, 214, 146, 223, 49, 130, 171, 220, 152, 219, 141, 244, 186, 40, 187, 133, 11, 54, 22, 174,
-    144, 206, 197, 26, 206, 6, 122, 194, 178, 43, 111, 191, 82, 163, 125, 1, 9, 164, 2, 177, 187, 229, 201, 201, 158, 7,
-    121, 105, 221, 197, 129, 209, 191, 44, 253, 206, 247, 157, 172, 232, 161, 67, 196, 156, 216, 109, 42, 89, 12, 37,
-    37, 65, 51, 190, 201, 127, 67, 243, 187, 143, 244, 49, 200, 107, 40, 230, 97, 243, 78, 155, 108, 221, 147, 19, 253,
-    45, 240, 224, 33, 199, 68, 10, 240, 97, 88, 209, 23, 104, 242, 255, 146, 6, 53, 194, 158, 108, 35, 47, 168, 92, 21,
-    24, 207, 248, 94, 188, 153, 42, 137, 223, 17, 133, 32, 193, 244, 216, 185, 202, 215, 90, 28, 35, 69, 245, 188, 4,
-    145, 122, 235, 40, 192, 40, 11, 247, 152, 9, 193, 35, 112, 25, 204, 95, 244, 78, 111, 192, 169, 223, 43, 193, 57,
-    172, 6, 107, 213, 213, 175, 186, 82, 115, 16, 164, 106, 21, 155, 145, 225, 186, 206, 39, 74, 131, 81, 186, 252, 123,
-    254, 154, 140, 66, 179, 43, 139, 245, 252, 47, 43, 134, 11, 31, 98, 96, 119, 29, 4, 170, 41, 254, 137, 53, 238, 235,
-    98, 73, 5, 241, 3, 177, 44, 234, 193, 187, 178, 68, 8, 170, 30, 64, 5, 235, 158, 198, 184, 255, 124, 25, 23, 77, 38,
-    149, 213, 181, 195, 112, 32, 115, 146, 252, 181, 222, 1, 196, 3, 137, 141, 78, 32, 81, 134, 27, 220, 216, 208, 67,
-    95, 94, 248, 215, 224, 123, 236, 244, 145, 200, 60, 166, 105, 77, 43, 178, 241, 86, 241, 156, 164, 174, 154, 170,
-    187, 27, 220, 9, 99, 100, 240, 128, 194, 115, 200, 86, 95, 75, 252, 84, 72, 107, 69, 109, 23, 166, 181, 246, 222,
-    131, 134, 96, 152, 51, 145, 120, 50, 159, 230, 167, 233, 68, 179, 111, 212, 221, 19, 69, 179, 30, 203, 172, 229, 41,
-    154, 77, 4, 57, 223, 30, 235, 99, 56, 195, 225, 126, 60, 89, 32, 220, 163, 128, 121, 222, 114, 115, 50, 109, 211,
-    113, 186, 183, 73, 109, 247, 250, 109, 109, 99, 133, 156, 56, 221, 137, 153, 119, 31, 152, 111, 211, 136, 60, 237,
-    123, 135, 7, 67, 199, 81, 228, 79, 253, 252, 90, 239, 87, 114, 243, 118, 173, 134, 106, 111, 85, 141, 250, 216, 89,
-    136, 28, 148, 83, 137, 211, 17, 155, 88, 224, 196, 218, 157, 177, 250, 25, 75, 168, 22, 29, 83, 49, 239, 128, 118,
-    195, 79, 142, 121, 98, 168, 2, 226, 80, 101, 77, 137, 158, 51, 227, 86, 62, 83, 144, 216, 189, 93, 17, 95, 147, 11,
-    74, 55, 205, 160, 187, 190, 218, 15, 21, 176, 167, 184, 101, 171, 227, 70, 69, 135, 113, 76, 211, 105, 138, 186,
-    240, 144, 30, 177, 242, 130, 9, 27, 102, 130, 158, 130, 203, 128, 217, 123, 57, 112, 150, 89, 43, 53, 53, 40, 116,
-    181, 55, 102, 197, 163, 164, 214, 95, 10, 44, 190, 25, 168, 86, 31, 13, 45, 147, 116, 34, 100, 181, 67, 74, 253,
-    202, 19, 216, 129, 156, 130, 126, 196, 170, 140, 234, 103, 93, 4, 138, 195, 136, 129, 205, 106, 1, 12, 210, 255,
-    132, 11, 32, 154, 100, 122, 45, 55, 32, 218, 76, 5, 26, 41, 242, 176, 166, 169, 30, 125, 53, 185, 129, 133, 150, 10,
-    41, 74, 31, 17, 96, 83, 156, 19, 156, 45, 113, 236, 114, 204, 28, 63, 63, 48, 44, 76, 73, 148, 153, 160, 211, 133,
-    233, 68, 108, 49, 6, 181, 247, 242, 112, 89, 82, 213, 214, 240, 231, 195, 99, 92, 240, 91, 231, 52, 165, 228, 176,
-    21, 173, 166, 222, 247, 157, 38, 100, 55, 102, 123, 238, 13, 81, 169, 43, 207, 220, 24, 48, 17, 251, 214, 9, 30, 19,
-    196, 110, 193, 240, 187, 173, 44, 179, 89, 195, 155, 120, 137, 77, 18, 159, 29, 207, 47, 132, 180, 91, 76, 202, 115,
-    38, 12, 204, 119, 144, 45, 192, 88, 136, 160, 228, 151, 170, 95, 220, 30, 123, 7, 76, 10, 202, 188, 98, 229, 105, 1,
-    165, 23, 195, 45, 39, 248, 12, 46, 252, 240, 141, 46, 189, 183, 39, 91, 120, 47, 151, 211, 118, 122, 114, 228, 113,
-    65, 235, 27, 37, 74, 73, 88, 0, 136, 224, 220, 49, 80, 65, 128, 138, 200, 188, 13, 20, 175, 210, 16, 141, 179, 220,
-    251, 242, 146, 27, 136, 169, 216, 0, 30, 68, 153, 93, 85, 29, 228, 94, 65, 51, 26, 198, 0, 207, 6, 63, 111, 241, 77,
-    96, 208, 147, 31, 69, 23, 108, 146, 145, 171, 4, 213, 59, 159, 244, 133, 75, 44, 131, 188, 228, 67, 30, 29, 185,
-    138, 26, 235, 73, 18, 253, 91, 97, 30, 215, 235, 244, 200, 192, 175, 115, 249, 118, 34, 239, 154, 105, 112, 219, 85,
-    40, 14, 46, 208, 213, 101, 160, 36, 170, 104, 115, 8, 159, 160, 151, 73, 85, 37, 171, 17, 195, 221, 143, 68, 136,
-    33, 163, 59, 204, 76, 155, 215, 198, 207, 57, 83, 0, 202, 171, 165, 210, 29, 86, 146, 201, 50, 29, 173, 138, 191,
-    207, 192, 109, 139, 225, 45, 202, 129, 195, 57, 228, 227, 162, 174, 108, 241, 240, 231, 88, 196, 34, 145, 22, 254,
-    100, 229, 122, 152, 239, 52, 23, 210, 48, 188, 174, 142, 98, 5, 127, 117, 28, 116, 234, 247, 35, 91, 144, 231, 136,
-    186, 206, 236, 146, 219, 207, 164, 130, 202, 105, 201, 132, 129, 59, 50, 5, 158, 142, 138, 250, 97, 154, 50, 242,
-    11, 69, 239, 252, 100, 100, 214, 239, 247, 159, 210, 176, 114, 198, 43, 148, 2, 229, 49, 4, 67, 5, 17, 101, 230,
-    247, 164, 197, 90, 207, 104, 73, 129, 233, 17, 116, 15, 249, 50, 69, 246, 165, 109, 87, 72, 28, 232, 162, 31, 130,
-    18, 214, 4, 121, 27, 166, 7, 233, 111, 18, 199, 49, 80, 70, 13, 73, 133, 231, 252, 72, 219, 99, 145, 15, 23, 176,
-    245, 213, 186, 247, 200, 104, 130, 115, 68, 153, 250, 45, 26, 145, 24, 7, 122, 127, 209, 168, 224, 212, 55, 29, 183,
-    57, 170, 145, 76, 237, 244, 86, 219, 4, 51, 240, 8, 125, 125, 202, 10, 143, 134, 104, 100, 229, 208, 44, 90, 163,
-    244, 222, 224, 197, 245, 90, 45, 42, 179, 238, 248, 33, 28, 21, 26, 163, 107, 187, 138, 116, 29, 67, 52, 60, 91,
-    159, 160, 93, 220, 188, 150, 167, 60, 110, 48, 178, 50, 226, 33, 147, 168, 192, 190, 97, 31, 173, 199, 145, 146,
-    207, 48, 244, 131, 59, 180, 223, 105, 0, 166, 63, 89, 63, 78, 29, 225, 145, 99, 21, 37, 206, 244, 67, 61, 227, 129,
-    119, 10, 47, 210, 246, 155, 216, 64, 70, 164, 95, 211, 199, 161, 125, 179, 207, 226, 217, 130, 233, 212, 17, 43, 7,
-    131, 50, 120, 239, 77, 250, 164, 253, 167, 40, 23, 233, 113, 13, 54, 156, 178, 145, 233, 104, 209, 99, 180, 182, 36,
-    48, 55, 107, 41, 147, 250, 89, 26, 214, 34, 243, 80, 179, 90, 208, 109, 193, 6, 11, 145, 234, 137, 241, 228, 228,
-    23, 239, 84, 212, 162, 117, 204, 107, 28, 17, 115, 138, 145, 39, 164, 180, 38, 208, 173, 189, 208, 170, 199, 46,
-    235, 195, 70, 0, 35, 54, 242, 80, 98, 224, 186, 162, 31, 104, 196, 161, 244, 87, 165, 50, 34, 223, 178, 2, 139, 99,
-    142, 229, 68, 17, 226, 31, 51, 228, 68, 114, 89, 30, 62, 169, 8, 60, 4, 64, 200, 171, 35, 41, 140, 218, 16, 15, 225,
-    132, 150, 53, 133, 104, 252, 254, 115, 133, 181, 181, 157, 141, 86, 27, 71, 68, 82, 184, 119, 97, 254, 56, 225, 223,
-    93, 234, 23, 200, 214, 101, 23, 149, 27, 101, 166, 234, 173, 244, 203, 218, 240, 180, 206, 254, 211, 113, 132, 105,
-    23, 120, 59, 228, 83, 0, 27, 41, 136, 138, 89, 140, 237, 31, 32, 196, 59, 42, 177, 238, 113, 230, 104, 147, 60, 247,
-    133, 146, 18, 22, 21, 127, 225, 116, 45, 35, 37, 161, 195, 103, 139, 49, 96, 123, 139, 188, 174, 56, 28, 16, 83, 24,
-    112, 33, 204, 64, 11, 17, 3, 88, 175, 153, 59, 254, 5, 202, 83, 106, 127, 195, 83, 57, 2, 232, 100, 138, 158, 149,
-    248, 104, 23, 139, 254, 76, 178, 163, 16, 80, 46, 13, 121, 218, 202, 118, 188, 191, 246, 221, 194, 89, 226, 134,
-    155, 76, 103, 57, 138, 112, 106, 154, 68, 128, 124, 228, 166, 94, 255, 23, 133, 139, 224, 252, 252, 221, 36, 86, 50,
-    99, 187, 120, 65, 199, 36, 116, 142, 85, 125, 225, 224, 176, 167, 199, 193, 152, 229, 70, 95, 21, 115, 92, 112, 132,
-    108, 254, 32, 108, 250, 10, 173, 213, 12, 75, 250, 112, 104, 118, 162, 116, 58, 129, 228, 249, 246, 248, 58, 110,
-    94, 28, 250, 151, 202, 68, 199, 239, 12, 118, 149, 216, 95, 183, 244, 195, 157, 100, 125, 85, 48, 60, 208, 6, 19,
-    66, 119, 148, 200, 246, 159, 161, 203, 56, 93, 187, 194, 197, 112, 96, 104, 81, 143, 220, 55, 225, 62, 9, 78, 201,
-    196, 102, 84, 46, 25, 226, 214, 141, 180, 168, 75, 148, 136, 238, 2, 57, 145, 193, 39, 182, 140, 217, 194, 161, 3,
-    236, 189, 89, 26, 38, 139, 220, 125, 33, 27, 227, 136, 60, 29, 164, 165, 28, 214, 186, 141, 128, 195, 59, 1, 54, 37,
-    2, 39, 186, 241, 48, 162, 108, 208, 14, 113, 106, 179, 214, 242, 60, 20, 161, 190, 67, 117, 89, 102, 113, 32, 174,
-    114, 83, 250, 255, 154, 201, 89, 164, 11, 88, 186, 177, 153, 106, 59, 173, 253, 211, 176, 90, 141, 75, 109, 11, 121,
-    77, 101, 133, 79, 209, 196, 213, 185, 179, 62, 188, 205, 170, 83, 54, 226, 177, 63, 93, 230, 154, 249, 120, 37, 11,
-    128, 211, 28, 67, 182, 221, 117, 172, 48, 63, 52, 250, 9, 181, 75, 23, 254, 160, 3, 90, 105, 168, 32, 63, 79, 12,
-    75, 156, 48, 11, 81, 52, 207, 222, 157, 141, 194, 126, 155, 156, 146, 181, 132, 183, 19, 220, 138, 207, 164, 241,
-    136, 53, 248, 32, 57, 28, 242, 165, 47, 34, 123, 31, 53, 167, 122, 54, 198, 6, 36, 149, 47, 235, 117, 56, 125, 76,
-    213, 122, 71, 96, 10, 248, 178, 202, 103, 32, 122, 108, 251, 70, 64, 110, 184, 80, 165, 97, 47, 7, 232, 220, 157,
-    150, 154, 196, 140, 199, 56, 199, 76, 45, 44, 171, 242, 188, 107, 68, 243, 213, 252, 193, 153, 190, 79, 133, 181,
-    62, 91, 240, 29, 1, 148, 204, 235, 6, 138, 14, 24, 234, 222, 147, 60, 14, 84, 46, 19, 172, 5, 43, 111, 66, 147, 171,
-    136, 13, 204, 68, 54, 220, 225, 130, 171, 119, 180, 113, 197, 113, 222, 183, 87, 197, 182, 30, 28, 101, 175, 176,
-    222, 95, 127, 86, 158, 33, 194, 129, 225, 173, 85, 105, 206, 93, 90, 240, 29, 70, 96, 12, 67, 45, 79, 110, 27, 23,
-    230, 176, 129, 237, 109, 217, 40, 158, 233, 185, 168, 216, 89, 122, 31, 17, 71, 203, 7, 45, 133, 2, 252, 250, 148,
-    213, 157, 220, 232, 18, 235, 176, 201, 238, 113, 72, 96, 252, 16, 7, 25, 76, 246, 50, 96, 110, 208, 173, 169, 69,
-    184, 165, 61, 101, 38, 72, 223, 128, 141, 58, 47, 81, 81, 213, 69, 184, 175, 109, 108, 191, 205, 76, 109, 19, 75,
-    85, 58, 48, 106, 216, 226, 14, 117, 211, 120, 72, 83, 220, 55, 214, 8, 165, 221, 127, 133, 250, 82, 4, 115, 9, 125,
-    232, 147, 134, 237, 51, 251, 251, 174, 59, 209, 179, 235, 193, 113, 218, 113, 82, 66, 44, 55, 149, 22, 144, 142, 15,
-    34, 236, 232, 185, 190, 227, 71, 213, 188, 116, 16, 156, 107, 28, 117, 220, 163, 213, 167, 39, 189, 56, 223, 222,
-    161, 182, 193, 54, 131, 100, 88, 98, 240, 217, 50, 57, 21, 122, 215, 185, 164, 22, 153, 247, 47, 22, 229, 50, 108,
-    75, 73, 77, 173, 126, 104, 14, 246, 255, 114, 15, 176, 162, 234, 144, 68, 54, 229, 170, 225, 165, 201, 26, 118, 101,
-    58, 236, 181, 167, 188, 222, 116, 192, 170, 191, 175, 96, 242, 168, 109, 92, 178, 73, 61, 166, 155, 180, 246, 173,
-    82, 92, 48, 141, 141, 128, 169, 66, 68, 39, 32, 11, 119, 63, 112, 38, 74, 97, 57, 151, 226, 19, 246, 131, 8, 157,
-    77, 8, 253, 254, 23, 94, 191, 85, 45, 4, 184, 97, 157, 168, 169, 215, 106, 14, 53, 81, 246, 87, 189, 148, 210, 81,
-    168, 19, 139, 99, 115, 78, 3, 212, 221, 250, 28, 58, 59, 27, 215, 198, 10, 101, 93, 135, 7, 86, 150, 66, 84, 24,
-    247, 128, 207, 78, 80, 134, 230, 15, 161, 104, 186, 50, 254, 57, 153, 254, 182, 216, 36, 115, 197, 11, 99, 22, 91,
-    206, 36, 8, 33, 20, 221, 186, 183, 192, 16, 246, 206, 102, 19, 40, 210, 150, 134, 166, 36, 60, 68, 209, 78, 126, 17,
-    170, 61, 88, 159, 108, 150, 177, 206, 128, 138, 119, 222, 69, 219, 127, 252, 213, 86, 169, 165, 195, 26, 176, 128,
-    186, 31, 191, 217, 181, 70, 103, 153, 211, 66, 67, 237, 53, 222, 89, 232, 0, 155, 251, 78, 233, 164, 125, 223, 11,
-    217, 155, 160, 193, 61, 26, 37, 26, 161, 35, 35, 15, 14, 223, 187, 201, 192, 13, 44, 112, 144, 94, 194, 121, 126,
-    23, 67, 48, 25, 43, 196, 13, 126, 60, 120, 241, 122, 219, 150, 113, 222, 218, 68, 187, 231, 27, 73, 141, 97, 218,
-    197, 166, 214, 153, 91, 245, 255, 211, 26, 181, 74, 232, 28, 217, 174, 204, 68, 10, 138, 23, 203, 224, 120, 207, 67,
-    53, 200, 31, 44, 201, 232, 123, 230, 112, 189, 83, 16, 251, 220, 174, 113, 186, 41, 243, 49, 199, 226, 213, 137,
-    104, 21, 55, 78, 216, 132, 180, 87, 224, 151, 7, 206, 21, 146, 214, 93, 217, 130, 155, 86, 61, 31, 16, 160, 152, 66,
-    164, 237, 194, 140, 55, 6, 185, 79, 146, 39, 210, 163, 254, 71, 106, 15, 60, 39, 55, 96, 189, 163, 134, 243, 103,
-    47, 94, 68, 0, 68, 5, 165, 43, 21, 201, 118, 9, 119, 107, 195, 68, 133, 27, 32, 149, 129, 135, 48, 253, 88, 136, 83,
-    160, 248, 188, 38, 8, 203, 22, 221, 103, 135, 28, 106, 54, 25, 142, 176, 237, 29, 59, 215, 93, 3, 97, 75, 235, 198,
-    193, 111, 153, 35, 209, 168, 55, 43, 82, 62, 98, 251, 59, 127, 116, 88, 74, 104, 144, 126, 224, 188, 216, 79, 162,
-    73, 0, 184, 212, 99, 171, 84, 25, 136, 81, 253, 101, 29, 171, 59, 107, 149, 48, 188, 44, 134, 25, 145, 182, 100, 55,
-    240, 24, 58, 79, 254, 234, 66, 212, 150, 228, 117, 81, 102, 249, 93, 95, 180, 35, 54, 71, 216, 28, 254, 183, 142,
-    22, 149, 139, 63, 120, 48, 2, 153, 202, 59, 196, 121, 152, 52, 147, 163, 18, 121, 213, 137, 42, 130, 62, 32, 253,
-    167, 161, 77, 129, 150, 131, 203, 195, 108, 98, 188, 45, 31, 243, 83, 32, 85, 73, 123, 216, 115, 41, 167, 33, 114,
-    96, 143, 126, 140, 236, 228, 187, 16, 194, 117, 5, 112, 112, 69, 84, 78, 79, 0, 52, 70, 97, 244, 49, 60, 22, 38, 7,
-    247, 234, 57, 139, 82, 87, 200, 248, 145, 231, 39, 123, 242, 192, 56, 122, 115, 24, 138, 37, 72, 181, 68, 228, 254,
-    61, 45, 197, 92, 248, 67, 87, 162, 196, 157, 146, 154, 113, 102, 136, 181, 50, 252, 224, 200, 238, 208, 108, 53, 34,
-    6, 60, 196, 130, 58, 232, 217, 78, 245, 189, 17, 190, 242, 21, 241, 142, 0, 246, 155, 222, 65, 113, 248, 7, 97, 92,
-    161, 89, 251, 47, 109, 122, 155, 27, 40, 20, 220, 118, 112, 102, 252, 164, 4, 238, 47, 103, 110, 70, 185, 2, 19,
-    207, 32, 66, 93, 59, 205, 170, 0, 154, 135, 150, 74, 123, 11, 43, 205, 254, 30, 51, 0, 13, 198, 0, 17, 172, 28, 180,
-    24, 97, 189, 38, 248, 137, 247, 124, 97, 232, 98, 64, 177, 34, 2, 200, 252, 29, 187, 246, 232, 248, 140, 4, 203, 68,
-    29, 151, 139, 68, 157, 152, 84, 70, 162, 62, 210, 49, 140, 67, 97, 225, 26, 57, 160, 177, 203, 230, 75, 49, 59, 147,
-    185, 171, 75, 235, 62, 101, 124, 244, 162, 59, 185, 22, 24, 78, 102, 65, 239, 234, 159, 113, 191, 21, 129, 111, 236,
-    242, 18, 238, 217, 131, 253, 69, 139, 8, 161, 142, 219, 228, 201, 143, 209, 93, 147, 13, 227, 8, 3, 138, 215, 30,
-    191, 114, 115, 212, 82, 220, 82, 209, 121, 121, 75, 165, 76, 217, 139, 209, 100, 31, 22, 237, 251, 187, 166, 76,
-    248, 3, 69, 135, 224, 130, 246, 216, 239, 131, 214, 206, 80, 162, 245, 102, 79, 237, 80, 98, 72, 191, 81, 34, 188,
-    128, 15, 83, 158, 148, 205, 104, 56, 5, 56, 54, 33, 249, 172, 126, 246, 25, 197, 180, 167, 179, 148, 108, 169, 16,
-    100, 29, 75, 88, 202, 243, 23, 96, 5, 45, 102, 150, 58, 31, 213, 245, 116, 49, 115, 130, 45, 84, 234, 230, 233, 91,
-    223, 130, 216, 123, 125, 76, 251, 225, 78, 227, 46, 173, 176, 3, 120, 134, 130, 110, 252, 253, 180, 235, 188, 116,
-    139, 254, 196, 88, 200, 131, 139, 97, 27, 2, 25, 106, 4, 228, 16, 50, 56, 159, 44, 232, 139, 47, 229, 158, 239, 63,
-    2, 149, 115, 164, 181, 219, 135, 95, 43, 208, 175, 187, 174, 155, 177, 134, 234, 115, 38, 165, 143, 227, 63, 160,
-    213, 186, 175, 76, 100, 106, 187, 135, 41, 72, 90, 184, 247, 84, 64, 237, 111, 44, 209, 249, 220, 67, 244, 25, 234,
-    200, 172, 222, 16, 96, 152, 246, 157, 152, 251, 249, 174, 86, 12, 106, 215, 210, 44, 55, 242, 246, 211, 210, 227,
-    149, 218, 3, 45, 134, 172, 11, 139, 109, 189, 34, 221, 4, 35, 242, 57, 150, 182, 17, 3, 53, 191, 241, 79, 128, 206,
-    165, 249, 28, 30, 133, 21, 75, 122, 79, 4, 158, 252, 198, 243, 232, 214, 130, 10, 79, 116, 172, 81, 33, 250, 90, 78,
-    84, 71, 120, 117, 241, 232, 178, 137, 255, 88, 171, 4, 190, 162, 159, 40, 227, 240, 129, 205, 128, 171, 214, 68,
-    238, 212, 32, 21, 34, 94, 3, 12, 137, 210, 70, 13, 186, 132, 59, 71, 22, 127, 7, 0, 90, 17, 130, 168, 0, 139, 43,
-    222, 67, 32, 149, 250, 251, 43, 199, 233, 142, 54, 228, 134, 244, 216, 213, 39, 111, 215, 242, 114, 4, 239, 97, 220,
-    64, 48, 211, 40, 41, 59, 132, 179, 40, 239, 127, 218, 115, 56, 42, 27, 161, 233, 37, 59, 56, 111, 17, 104, 181, 12,
-    87, 147, 156, 184, 24, 145, 84, 55, 164, 188, 22, 225, 157, 211, 126, 6, 14, 173, 100, 235, 197, 118, 16, 192, 39,
-    19, 183, 116, 8, 69, 190, 117, 230, 186, 217, 205, 182, 166, 212, 137, 190, 239, 97, 188, 102, 148, 75, 136, 112,
-    51, 11, 126, 178, 214, 128, 226, 124, 45, 144, 168, 77, 8, 28, 224, 0, 32, 20, 124, 240, 215, 234, 40, 52, 24, 218,
-    28, 1, 183, 217, 129, 236, 193, 85, 48, 172, 209, 137, 198, 86, 64, 141, 157, 90, 233, 10, 192, 47, 195, 33, 171,
-    50, 248, 240, 29, 31, 210, 69, 101, 160, 246, 204, 73, 179, 179, 46, 52, 85, 143, 116, 15, 47, 227, 241, 14, 96, 67,
-    199, 31, 189, 218, 14, 43, 45, 113, 230, 39, 249, 216, 211, 204, 165, 148, 114, 94, 60, 255, 61, 254, 3, 229, 47,
-    162, 128, 17, 39, 55, 102, 172, 217, 29, 161, 44, 212, 15, 250, 98, 101, 248, 214, 157, 107, 25, 108, 213, 186, 220,
-    182, 76, 242, 147, 132, 171, 64, 81, 132, 123, 60, 199, 116, 40, 223, 197, 8, 176, 16, 241, 248, 58, 94, 170, 153,
-    89, 204, 32, 204, 218, 36, 168, 2, 207, 230, 154, 254, 13, 146, 71, 68, 130, 220, 90, 216, 196, 87, 229, 46, 93, 8,
-    140, 143, 229, 11, 133, 33, 57, 102, 153, 24, 78, 219, 234, 14, 177, 155, 37, 21, 100, 72, 121, 31, 83, 182, 109,
-    247, 248, 134, 46, 67, 0, 149, 156, 2, 51, 174, 230, 221, 187, 38, 120, 114, 21, 143, 193, 183, 207, 236, 206, 99,
-    229, 47, 241, 209, 236, 60, 69, 214, 34, 9, 188, 246, 230, 73, 165, 169, 134, 140, 200, 80, 13, 94, 192, 237, 143,
-    106, 167, 228, 142, 150, 187, 70, 132, 247, 216, 89, 26, 100, 189, 9, 186, 57, 176, 70, 69, 107, 240, 169, 242, 233,
-    179, 56, 218, 107, 160, 55, 91, 222, 233, 103, 168, 130, 228, 242, 212, 234, 175, 175, 27, 72, 14, 233, 251, 96,
-    142, 28, 46, 193, 186, 174, 212, 146, 128, 58, 115, 2, 167, 17, 175, 115, 131, 210, 177, 19, 109, 10, 200, 2, 236,
-    237, 52, 34, 132, 239, 223, 198, 26, 105, 96, 233, 190, 245, 170, 160, 205, 246, 116, 95, 37, 131, 189, 238, 92,
-    129, 87, 160, 60, 4, 227, 86, 246, 249, 1, 175, 156, 250, 143, 91, 247, 138, 193, 4, 210, 123, 125, 114, 67, 246,
-    198, 220, 18, 117, 146, 199, 164, 225, 25, 252, 109, 111, 168, 185, 182, 138, 146, 122, 234, 191, 144, 43, 178, 109,
-    108, 136, 107, 211, 94, 130, 59, 211, 240, 149, 220, 65, 119, 201, 233, 116, 190, 136, 129, 253, 211, 241, 72, 208,
-    132, 95, 239, 86, 97, 35, 230, 175, 37, 27, 199, 213, 186, 181, 228, 207, 17, 76, 108, 187, 203, 185, 183, 159, 100,
-    7, 13, 99, 24, 131, 169, 236, 70, 104, 38, 10, 66, 168, 103, 122, 82, 74, 46, 12, 59, 168, 115, 40, 254, 181, 63,
-    20, 227, 208, 71, 113, 203, 132, 92, 74, 47, 176, 103, 83, 122, 67, 116, 199, 96, 104, 143, 18, 105, 221, 26, 229,
-    124, 142, 240, 237, 46, 126, 117, 241, 245, 192, 27, 83, 18, 126, 183, 64, 243, 72, 205, 165, 175, 49, 12, 60, 135,
-    226, 26, 154, 11, 137, 159, 203, 141, 106, 21, 228, 44, 44, 255, 87, 75, 204, 96, 206, 170, 38, 86, 25, 76, 65, 219,
-    21, 60, 160, 31, 195, 31, 160, 120, 60, 124, 228, 86, 251, 134, 187, 56, 248, 157, 129, 16, 138, 140, 25, 44, 60,
-    34, 8, 205, 49, 39, 15, 61, 117, 192, 111, 113, 154, 175, 64, 84, 189, 207, 7, 6, 174, 179, 35, 32, 21, 52, 127, 78,
-    219, 77, 85, 89, 18, 24, 116, 227, 134, 147, 118, 18, 149, 129, 183, 171, 63, 52, 187, 69, 81, 167, 151, 205, 213,
-    224, 224, 112, 129, 237, 238, 25, 13, 79, 79, 45, 48, 2, 137, 189, 244, 176, 196, 114, 11, 91, 125, 124, 45, 74, 67,
-    98, 25, 219, 190, 188, 232, 160, 45, 139, 228, 19, 136, 194, 57, 90, 91, 227, 126, 162, 197, 129, 54, 233, 225, 219,
-    248, 169, 201, 231, 112, 243, 103, 75, 62, 62, 248, 10, 12, 21, 127, 178, 190, 186, 36, 239, 175, 149, 7, 166, 22,
-    251, 102, 103, 240, 6, 156, 104, 177, 105, 254, 223, 138, 85, 63, 119, 228, 146, 4, 187, 183, 183, 34, 211, 235,
-    136, 98, 98, 187, 95, 205, 94, 156, 40, 184, 205, 103, 230, 103, 100, 217, 52, 76, 230, 175, 90, 142, 31, 54, 85,
-    205, 200, 209, 29, 111, 236, 238, 66, 137, 42, 26, 89, 141, 176, 180, 183, 57, 152, 132, 244, 96, 157, 198, 107, 45,
-    246, 104, 253, 150, 228, 226, 31, 199, 190, 113, 242, 112, 246, 121, 94, 156, 151, 250, 45, 181, 121, 136, 52, 12,
-    215, 86, 75, 126, 161, 72, 255, 0, 170, 115, 190, 17, 232, 118, 35, 19, 84, 200, 145, 251, 69, 7, 187, 108, 8, 59,
-    33, 197, 62, 205, 109, 151, 159, 120, 104, 8, 56, 183, 234, 29, 138, 228, 97, 176, 75, 78, 71, 68, 37, 155, 43, 93,
-    150, 15, 245, 230, 120, 111, 134, 38, 223, 132, 38, 121, 74, 132, 5, 121, 23, 140, 80, 87, 204, 154, 55, 80, 61,
-    241, 88, 146, 9, 183, 10, 182, 12, 94, 156, 22, 61, 70, 246, 196, 233, 54, 108, 185, 93, 110, 106, 4, 28, 201, 245,
-    35, 179, 105, 72, 204, 64, 16, 33, 167, 208, 11, 154, 110, 230, 17, 143, 41, 69, 11, 192, 8, 75, 149, 220, 244, 52,
-    162, 124, 34, 83, 143, 178, 16, 142, 83, 51, 41, 119, 6, 229, 185, 49, 6, 14, 241, 235, 161, 252, 175, 171, 68, 155,
-    30, 24, 191, 2, 124, 203, 93, 43, 110, 240, 8, 243, 127, 79, 117, 158, 30, 169, 134, 30, 254, 239, 194, 185, 57,
-    157, 162, 9, 55, 121, 22, 206, 234, 151, 144, 8, 175, 72, 191, 25, 19, 38, 104, 157, 214, 169, 169, 31, 58, 62, 133,
-    45, 183, 23, 132, 9, 188, 29, 64, 157, 70, 92, 136, 167, 197, 75, 126, 238, 101, 167, 235, 208, 234, 35, 28, 240,
-    40, 169, 144, 100, 169, 224, 238, 65, 95, 99, 81, 129, 247, 206, 246, 213, 235, 120, 184, 55, 231, 64, 121, 27, 241,
-    216, 109, 210, 249, 204, 226, 117, 33, 19, 128, 175, 154, 203, 252, 116, 204, 60, 82, 63, 125, 65, 114, 131, 92, 53,
-    35, 47, 17, 72, 252, 204, 22, 12, 147, 117, 187, 228, 14, 10, 125, 44, 147, 90, 142, 0, 31, 242, 135, 37, 164, 212,
-    98, 1, 79, 205, 167, 11, 153, 148, 172, 81, 235, 209, 242, 4, 84, 97, 242, 199, 213, 11, 90, 185, 158, 146, 240,
-    138, 209, 208, 71, 29, 183, 82, 31, 89, 22, 33, 45, 0, 126, 56, 198, 223, 64, 45, 12, 180, 255, 239, 183, 254, 38,
-    234, 245, 133, 156, 250, 122, 95, 27, 12, 232, 165, 32, 247, 55, 100, 131, 250, 22, 84, 152, 218, 53, 39, 124, 106,
-    179, 199, 180, 9, 180, 225, 254, 110, 7, 197, 205, 147, 241, 247, 63, 76, 227, 36, 179, 155, 73, 149, 252, 145, 195,
-    153, 56, 119, 42, 6, 24, 165, 30, 93, 234, 201, 86, 167, 60, 207, 168, 181, 207, 89, 207, 17, 250, 23, 173, 238, 48,
-    43, 202, 52, 55, 200, 189, 97, 176, 124, 22, 150, 26, 57, 200, 247, 88, 39, 54, 36, 199, 102, 144, 171, 200, 28,
-    233, 68, 16, 158, 135, 186, 177, 135, 185, 32, 154, 220, 181, 68, 7, 120, 36, 33, 18, 217, 87, 114, 203, 179, 208,
-    6, 101, 221, 153, 147, 57, 188, 153, 27, 55, 170, 2, 1, 118, 65, 48, 247, 141, 55, 192, 169, 58, 251, 44, 155, 60,
-    68, 53, 35, 252, 42, 248, 245, 231, 249, 184, 236, 122, 149, 134, 124, 218, 171, 221, 59, 139, 234, 92, 87, 38, 155,
-    113, 184, 74, 28, 2, 42, 208, 122, 202, 219, 180, 54, 64, 192, 109, 204, 48, 189, 234, 119, 147, 248, 84, 223, 137,
-    131, 233, 11, 188, 30, 95, 111, 133, 133, 55, 4, 202, 11, 44, 208, 147, 49, 223, 60, 140, 188, 252, 194, 206, 50,
-    142, 213, 1, 131, 250, 85, 114, 109, 63, 117, 224, 151, 10, 223, 202, 141, 178, 201, 6, 227, 3, 205, 239, 104, 168,
-    143, 119, 116, 165, 127, 151, 69, 153, 52, 14, 17, 131, 86, 140, 7, 220, 206, 94, 245, 55, 222, 126, 147, 56, 116,
-    212, 160, 14, 118, 103, 58, 141, 31, 74, 212, 238, 223, 84, 51, 253, 98, 221, 189, 170, 211, 67, 103, 37, 34, 242,
-    129, 153, 190, 142, 109, 180, 87, 158, 235, 55, 42, 182, 155, 175, 227, 232, 52, 241, 188, 244, 90, 0, 188, 197,
-    134, 17, 131, 244, 254, 136, 117, 132, 79, 20, 17, 151, 242, 136, 145, 118, 13, 212, 56, 57, 110, 6, 75, 197, 12,
-    111, 95, 159, 16, 99, 132, 214, 114, 165, 164, 158, 187, 103, 31, 212, 204, 41, 73, 183, 224, 150, 24, 198, 181,
-    109, 34, 77, 142, 114, 171, 235, 154, 36, 119, 82, 84, 50, 181, 148, 139, 98, 38, 70, 202, 74, 237, 67, 86, 229, 71,
-    134, 14, 222, 1, 138, 245, 212, 143, 218, 69, 4, 35, 212, 41, 208, 102, 80, 145, 247, 124, 149, 189, 141, 22, 0,
-    197, 108, 28, 205, 104, 78, 161, 36, 9, 126, 137, 27, 147, 234, 29, 15, 66, 71, 144, 60, 182, 243, 83, 164, 188,
-    159, 238, 242, 92, 26, 15, 243, 100, 24, 135, 239, 165, 6, 238, 54, 122, 212, 130, 137, 77, 0, 239, 107, 11, 235,
-    212, 126, 91, 190, 174, 37, 225, 5, 220, 159, 64, 1, 73, 59, 186, 139, 194, 40, 37, 232, 21, 64, 147, 203, 28, 68,
-    211, 4, 19, 164, 159, 18, 34, 106, 160, 32, 109, 88, 214, 254, 26, 164, 87, 160, 16, 164, 137, 27, 100, 0, 217, 115,
-    205, 130, 253, 64, 45, 185, 88, 63, 27, 194, 197, 42, 3, 135, 3, 10, 139, 235, 160, 151, 175, 123, 76, 71, 86, 0,
-    174, 193, 133, 233, 229, 64, 95, 128, 197, 110, 171, 254, 9, 201, 109, 94, 245, 36, 196, 129, 169, 26, 201, 121,
-    144, 6, 190, 98, 120, 52, 62, 197, 2, 197, 192, 210, 189, 75, 96, 142, 63, 139, 197, 90, 230, 123, 238, 90, 247, 44,
-    66, 164, 120, 76, 141, 37, 26, 237, 9, 204, 102, 236, 162, 155, 199, 255, 26, 203, 153, 205, 30, 200, 239, 186, 158,
-    89, 123, 218, 240, 165, 116, 233, 213, 154, 23, 137, 69, 99, 85, 140, 120, 177, 197, 7, 93, 58, 245, 32, 67, 191,
-    241, 56, 144, 210, 235, 238, 91, 83, 187, 220, 193, 207, 215, 159
+    123, 34, 67, 111, 109, 112, 111, 110, 101, 110, 116, 78, 97, 109, 101, 34, 58, 32, 34, 80, 97, 108, 34, 44, 32, 34,
+    68, 114, 105, 118, 101, 114, 83, 116, 97, 116, 101, 34, 58, 32, 91, 34, 72, 97, 108, 116, 101, 100, 79, 110, 68,
+    101, 118, 105, 99, 101, 73, 110, 105, 116, 34, 93, 44, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32,
+    91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 70, 81, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80,
+    117, 98, 108, 105, 99, 32, 67, 67, 67, 32, 79, 112, 116, 105, 111, 110, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 117, 98, 108, 105, 99, 67, 97, 116, 97, 108, 121, 115, 116, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 101, 120, 116, 117, 114, 101, 79, 112, 116, 76, 101, 118, 101, 108,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111,
+    108, 115, 32, 116, 101, 120, 116, 117, 114, 101, 32, 102, 105, 108, 116, 101, 114, 105, 110, 103, 32, 111, 112, 116,
+    105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 101, 120, 112, 111, 115, 101, 100, 32, 98, 121, 32, 67, 67, 67,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 54, 53, 50, 52, 48, 52, 53, 56, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 97, 116, 97, 108, 121, 115, 116, 65, 73, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 80, 117, 98, 108, 105, 99, 32, 67, 67, 67, 32, 79, 112, 116, 105, 111, 110, 115, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 49, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 117, 98, 108, 105, 99, 67, 97, 116, 97, 108,
+    121, 115, 116, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 97, 116, 97, 108, 121, 115, 116,
+    65, 73, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114,
+    111, 108, 115, 32, 97, 112, 112, 32, 100, 101, 116, 101, 99, 116, 32, 97, 110, 100, 32, 105, 109, 97, 103, 101, 32,
+    113, 117, 97, 108, 105, 116, 121, 32, 97, 108, 116, 101, 114, 105, 110, 103, 32, 111, 112, 116, 105, 109, 105, 122,
+    97, 116, 105, 111, 110, 115, 32, 101, 120, 112, 111, 115, 101, 100, 32, 98, 121, 32, 67, 67, 67, 46, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 48, 49, 57, 56, 54, 51, 52, 56, 125, 44, 32, 123, 34, 86,
+    97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118,
+    101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 108, 119, 97, 121, 115, 32, 114, 117, 110, 32, 116, 104,
+    101, 32, 112, 114, 101, 97, 109, 98, 108, 101, 32, 99, 109, 100, 32, 115, 116, 114, 101, 97, 109, 34, 44, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 79, 110, 108, 121, 32, 114, 117, 110, 32, 116, 104, 101, 32, 112, 114, 101, 97, 109,
+    98, 108, 101, 32, 99, 109, 100, 32, 115, 116, 114, 101, 97, 109, 32, 119, 104, 101, 110, 32, 110, 101, 99, 101, 115,
+    115, 97, 114, 121, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 102, 97, 108, 115, 101, 125, 93, 125, 44, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 80, 114, 101, 97, 109, 98, 108, 101, 67, 109, 100, 83,
+    116, 114, 101, 97, 109, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34,
+    44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 102, 111, 114, 99, 101, 80, 114, 101, 97, 109, 98, 108, 101, 67, 109, 100, 83, 116, 114, 101, 97,
+    109, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114,
+    111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 104, 101, 32, 112, 114, 101, 97, 109, 98, 108, 101,
+    32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 102, 111, 114, 32, 97, 32, 81, 117, 101,
+    117, 101, 32, 105, 115, 32, 97, 108, 119, 97, 121, 115, 32, 115, 117, 98, 109, 105, 116, 116, 101, 100, 32, 111,
+    114, 32, 115, 107, 105, 112, 112, 101, 100, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32,
+    115, 99, 104, 101, 100, 117, 108, 101, 114, 32, 99, 111, 110, 116, 101, 120, 116, 32, 114, 117, 110, 115, 32, 98,
+    97, 99, 107, 45, 116, 111, 45, 98, 97, 99, 107, 32, 111, 110, 32, 116, 104, 101, 32, 67, 80, 32, 114, 105, 110, 103,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 56, 55, 57, 52, 55, 52, 57, 54, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 78, 117, 109, 67, 109, 100, 83, 116, 114, 101, 97, 109,
+    115, 80, 101, 114, 83, 117, 98, 109, 105, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110,
+    101, 114, 97, 108, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 78, 117, 109, 67,
+    109, 100, 83, 116, 114, 101, 97, 109, 115, 80, 101, 114, 83, 117, 98, 109, 105, 116, 34, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32,
+    109, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110,
+    100, 32, 115, 116, 114, 101, 97, 109, 115, 32, 116, 104, 97, 116, 32, 99, 97, 110, 32, 98, 101, 32, 115, 117, 98,
+    109, 105, 116, 116, 101, 100, 32, 97, 116, 32, 111, 110, 99, 101, 32, 116, 111, 32, 116, 104, 101, 32, 107, 101,
+    114, 110, 101, 108, 46, 32, 79, 118, 101, 114, 114, 105, 100, 101, 115, 32, 116, 104, 101, 32, 107, 101, 114, 110,
+    101, 108, 32, 109, 97, 120, 105, 109, 117, 109, 32, 118, 97, 108, 117, 101, 32, 105, 102, 32, 115, 101, 116, 32,
+    116, 111, 32, 97, 32, 118, 97, 108, 117, 101, 32, 62, 32, 48, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 52, 54, 55, 48, 52, 53, 56, 52, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82,
+    101, 113, 117, 101, 115, 116, 72, 105, 103, 104, 80, 114, 105, 111, 114, 105, 116, 121, 86, 109, 105, 100, 34, 44,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 80, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101,
+    113, 117, 101, 115, 116, 72, 105, 103, 104, 80, 114, 105, 111, 114, 105, 116, 121, 86, 109, 105, 100, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 113, 117, 101, 115, 116, 115, 32,
+    116, 104, 97, 116, 32, 99, 111, 110, 116, 101, 120, 116, 115, 32, 98, 101, 32, 99, 114, 101, 97, 116, 101, 100, 32,
+    119, 105, 116, 104, 32, 104, 105, 103, 104, 32, 112, 114, 105, 111, 114, 105, 116, 121, 32, 86, 77, 73, 68, 32, 116,
+    111, 32, 114, 101, 100, 117, 99, 101, 32, 112, 97, 103, 101, 32, 116, 97, 98, 108, 101, 32, 105, 110, 118, 97, 108,
+    105, 100, 97, 116, 105, 111, 110, 32, 112, 101, 110, 97, 108, 116, 105, 101, 115, 46, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 53, 56, 48, 55, 51, 57, 50, 48, 50, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 82, 101, 113, 117, 101, 115, 116, 68, 101, 98, 117, 103, 86, 109, 105, 100, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 44, 32,
+    34, 80, 114, 111, 102, 105, 108, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 114, 101, 113, 117, 101, 115, 116, 68, 101, 98, 117, 103, 86, 109, 105, 100, 34, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 113, 117, 101, 115, 116, 115, 32, 116, 104, 97, 116, 32,
+    99, 111, 110, 116, 101, 120, 116, 115, 32, 98, 101, 32, 99, 114, 101, 97, 116, 101, 100, 32, 119, 105, 116, 104, 32,
+    97, 32, 100, 101, 98, 117, 103, 32, 86, 77, 73, 68, 46, 32, 84, 104, 105, 115, 32, 97, 108, 108, 111, 119, 115, 32,
+    102, 111, 114, 32, 98, 101, 116, 116, 101, 114, 32, 115, 104, 97, 100, 101, 114, 32, 100, 101, 98, 117, 103, 103,
+    105, 110, 103, 32, 98, 121, 32, 107, 101, 101, 112, 105, 110, 103, 32, 116, 104, 101, 32, 112, 97, 103, 101, 32,
+    116, 97, 98, 108, 101, 115, 32, 118, 97, 108, 105, 100, 32, 97, 102, 116, 101, 114, 32, 116, 104, 101, 32, 99, 111,
+    110, 116, 101, 120, 116, 32, 104, 97, 115, 32, 98, 101, 101, 110, 32, 115, 119, 105, 116, 99, 104, 101, 100, 32,
+    111, 117, 116, 46, 32, 32, 84, 104, 105, 115, 32, 105, 115, 32, 97, 108, 115, 111, 32, 117, 115, 101, 102, 117, 108,
+    32, 102, 111, 114, 32, 83, 81, 84, 84, 32, 112, 114, 111, 102, 105, 108, 105, 110, 103, 32, 97, 115, 32, 105, 116,
+    32, 101, 110, 115, 117, 114, 101, 115, 32, 98, 111, 116, 104, 32, 99, 111, 109, 112, 117, 116, 101, 32, 97, 110,
+    100, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 113, 117, 101, 117, 101, 32, 119, 111, 114, 107, 32, 119, 105,
+    108, 108, 32, 115, 104, 97, 114, 101, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 86, 77, 73, 68, 32, 97, 108,
+    108, 111, 119, 105, 110, 103, 32, 116, 104, 101, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32,
+    116, 111, 32, 98, 101, 32, 102, 105, 108, 116, 101, 114, 101, 100, 32, 116, 111, 32, 97, 32, 115, 105, 110, 103,
+    108, 101, 32, 86, 77, 73, 68, 32, 40, 116, 111, 32, 97, 118, 111, 105, 100, 32, 99, 97, 112, 116, 117, 114, 105,
+    110, 103, 32, 111, 116, 104, 101, 114, 32, 112, 114, 111, 99, 101, 115, 115, 101, 115, 32, 119, 111, 114, 107, 41,
+    32, 119, 104, 105, 108, 101, 32, 115, 116, 105, 108, 108, 32, 99, 97, 112, 116, 117, 114, 105, 110, 103, 32, 97,
+    108, 108, 32, 119, 111, 114, 107, 32, 98, 121, 32, 116, 104, 101, 32, 116, 97, 114, 103, 101, 116, 32, 112, 114,
+    111, 99, 101, 115, 115, 46, 32, 78, 79, 84, 69, 58, 32, 82, 71, 80, 32, 116, 114, 97, 99, 105, 110, 103, 32, 97,
+    117, 116, 111, 109, 97, 116, 105, 99, 97, 108, 108, 121, 32, 114, 101, 113, 117, 101, 115, 116, 115, 32, 116, 104,
+    101, 32, 68, 101, 98, 117, 103, 32, 86, 77, 73, 68, 32, 100, 117, 114, 105, 110, 103, 32, 115, 101, 116, 117, 112,
+    32, 115, 111, 32, 116, 104, 101, 114, 101, 32, 105, 115, 32, 110, 111, 32, 110, 101, 101, 100, 32, 116, 111, 32, 99,
+    104, 97, 110, 103, 101, 32, 116, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 119, 104, 101, 110, 32,
+    99, 97, 112, 116, 117, 114, 105, 110, 103, 32, 82, 71, 80, 32, 116, 114, 97, 99, 101, 115, 46, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 57, 55, 57, 50, 49, 52, 53, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 78, 101, 118, 101, 114, 67, 104, 97, 110, 103, 101, 67, 108, 111, 99, 107, 77, 111, 100, 101,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98,
+    117, 103, 34, 44, 32, 34, 80, 114, 111, 102, 105, 108, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 110, 101, 118, 101, 114, 67, 104, 97, 110, 103, 101, 67, 108, 111, 99, 107, 77,
+    111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115,
+    97, 98, 108, 101, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 71, 80, 85, 32, 99, 108, 111, 99, 107, 115, 32,
+    105, 110, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 40, 101, 103, 46, 32, 100, 117, 114, 105, 110,
+    103, 32, 112, 114, 111, 102, 105, 108, 105, 110, 103, 41, 46, 32, 69, 110, 97, 98, 108, 101, 32, 116, 104, 105, 115,
+    32, 105, 102, 32, 117, 115, 105, 110, 103, 32, 65, 71, 77, 32, 116, 111, 32, 102, 111, 114, 99, 101, 32, 99, 108,
+    111, 99, 107, 32, 118, 97, 108, 117, 101, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50,
+    57, 51, 54, 49, 48, 54, 54, 55, 56, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58,
+    32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 73, 110, 115, 116, 114, 117, 99, 116, 115, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114,
+    32, 116, 111, 32, 117, 115, 101, 32, 97, 108, 108, 32, 82, 66, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 45, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 114, 105,
+    118, 101, 114, 32, 119, 105, 108, 108, 32, 99, 104, 111, 111, 115, 101, 32, 97, 110, 32, 111, 112, 116, 105, 109,
+    97, 108, 32, 118, 97, 108, 117, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 125, 44, 32, 123, 34,
+    76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 79, 114, 69, 113,
+    117, 97, 108, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 110, 115,
+    116, 114, 117, 99, 116, 115, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 116, 111, 32, 117, 115, 101,
+    32, 116, 104, 105, 115, 32, 101, 120, 97, 99, 116, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 82, 66, 115,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 125, 93, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    78, 111, 110, 108, 111, 99, 97, 108, 68, 101, 115, 116, 71, 114, 97, 112, 104, 105, 99, 115, 67, 111, 112, 121, 82,
+    98, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 80,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110,
+    111, 110, 108, 111, 99, 97, 108, 68, 101, 115, 116, 71, 114, 97, 112, 104, 105, 99, 115, 67, 111, 112, 121, 82, 98,
+    115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 112, 101, 99, 105,
+    102, 105, 101, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 82, 66, 115, 32, 117, 115,
+    101, 100, 32, 105, 110, 32, 97, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 99, 111, 112, 121, 32, 116, 111, 32,
+    110, 111, 110, 108, 111, 99, 97, 108, 32, 100, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110, 115, 46, 32, 32, 82,
+    101, 100, 117, 99, 105, 110, 103, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 82, 66, 115,
+    32, 99, 97, 110, 32, 105, 110, 99, 114, 101, 97, 115, 101, 32, 80, 67, 73, 101, 32, 116, 104, 114, 111, 117, 103,
+    104, 112, 117, 116, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 53, 48, 49, 57, 48, 49, 48,
+    48, 48, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34,
+    58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72,
+    32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    73, 102, 104, 77, 111, 100, 101, 80, 97, 108, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72, 32, 105, 115, 32, 105, 109, 112, 108,
+    101, 109, 101, 110, 116, 101, 100, 32, 105, 110, 32, 80, 65, 76, 32, 40, 107, 101, 114, 110, 101, 108, 32, 105, 115,
+    32, 110, 111, 116, 32, 99, 97, 108, 108, 101, 100, 41, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    73, 102, 104, 77, 111, 100, 101, 75, 109, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72, 32, 105, 115, 32, 105, 109, 112,
+    108, 101, 109, 101, 110, 116, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 107, 101, 114, 110, 101, 108, 34, 125,
+    93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72, 32, 77, 111, 100, 101, 32, 115, 101, 116, 116, 105,
+    110, 103, 32, 118, 97, 108, 117, 101, 115, 46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 70, 72,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98,
+    117, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 105, 102, 104, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 73, 110, 102, 105, 110, 105, 116, 101, 108, 121, 32, 70, 97, 115,
+    116, 32, 72, 97, 114, 100, 119, 97, 114, 101, 32, 40, 73, 70, 72, 41, 32, 109, 111, 100, 101, 46, 32, 83, 101, 101,
+    32, 73, 102, 104, 71, 112, 117, 77, 97, 115, 107, 32, 102, 111, 114, 32, 119, 104, 105, 99, 104, 32, 65, 83, 73, 67,
+    115, 32, 97, 114, 101, 32, 97, 102, 102, 101, 99, 116, 101, 100, 32, 40, 100, 101, 102, 97, 117, 108, 116, 32, 97,
+    108, 108, 41, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50, 57, 57, 56, 54, 52, 49, 51,
+    56, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 100, 108, 101, 65, 102, 116, 101, 114, 83, 117, 98,
+    109, 105, 116, 71, 112, 117, 77, 97, 115, 107, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110,
+    101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 44, 32, 34, 83, 97, 102, 101, 83, 101, 116, 116, 105,
+    110, 103, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116,
+    114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83,
+    34, 58, 32, 91, 34, 87, 105, 110, 100, 111, 119, 115, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    105, 100, 108, 101, 65, 102, 116, 101, 114, 83, 117, 98, 109, 105, 116, 71, 112, 117, 77, 97, 115, 107, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 100, 108, 101, 115, 32, 97, 102, 116,
+    101, 114, 32, 101, 97, 99, 104, 32, 99, 97, 108, 108, 32, 116, 111, 32, 83, 117, 98, 109, 105, 116, 32, 102, 111,
+    114, 32, 116, 104, 101, 32, 71, 80, 85, 39, 115, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 98, 121, 32,
+    116, 104, 101, 32, 98, 105, 116, 109, 97, 115, 107, 46, 32, 71, 80, 85, 39, 115, 32, 97, 114, 101, 32, 115, 112,
+    101, 99, 105, 102, 105, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32,
+    105, 110, 32, 116, 104, 101, 32, 98, 105, 116, 102, 105, 101, 108, 100, 32, 97, 110, 100, 32, 109, 97, 112, 32, 116,
+    111, 32, 116, 104, 101, 32, 76, 68, 65, 32, 99, 104, 97, 105, 110, 32, 97, 114, 114, 97, 121, 46, 32, 32, 69, 120,
+    97, 109, 112, 108, 101, 58, 32, 48, 120, 50, 32, 119, 111, 117, 108, 100, 32, 99, 97, 117, 115, 101, 32, 116, 104,
+    101, 32, 71, 80, 85, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 32, 116, 111, 32, 116, 104,
+    101, 32, 50, 110, 100, 32, 76, 68, 65, 32, 99, 104, 97, 105, 110, 32, 105, 110, 32, 116, 104, 101, 32, 97, 114, 114,
+    97, 121, 32, 40, 97, 114, 114, 97, 121, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 49, 41, 32, 116, 111, 32,
+    105, 100, 108, 101, 32, 97, 102, 116, 101, 114, 32, 101, 97, 99, 104, 32, 115, 117, 98, 109, 105, 116, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 54, 53, 55, 57, 52, 48, 55, 57, 125, 44, 32, 123,
+    34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32,
+    116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101,
+    44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115,
+    115, 80, 111, 105, 110, 116, 78, 111, 110, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 111, 114, 109, 97, 108, 32, 111, 112, 101,
+    114, 97, 116, 105, 111, 110, 44, 32, 116, 111, 115, 115, 32, 112, 111, 105, 110, 116, 32, 105, 115, 32, 100, 105,
+    115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111,
+    105, 110, 116, 65, 102, 116, 101, 114, 82, 97, 115, 116, 101, 114, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 75, 105, 108, 108, 32, 82,
+    97, 115, 116, 101, 114, 105, 122, 101, 114, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111,
+    115, 115, 80, 111, 105, 110, 116, 87, 105, 114, 101, 102, 114, 97, 109, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99,
+    101, 32, 87, 105, 114, 101, 102, 114, 97, 109, 101, 32, 102, 105, 108, 108, 32, 109, 111, 100, 101, 34, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 66, 97, 99, 107, 70, 114, 111,
+    110, 116, 70, 97, 99, 101, 67, 117, 108, 108, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 98, 97, 99, 107, 32, 97,
+    110, 100, 32, 102, 114, 111, 110, 116, 32, 102, 97, 99, 101, 32, 99, 117, 108, 108, 105, 110, 103, 34, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 65, 102, 116, 101, 114, 83,
+    101, 116, 117, 112, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 99, 105, 115, 115, 111, 114, 45, 111, 117, 116, 32, 97, 108, 108, 32,
+    103, 101, 111, 109, 101, 116, 114, 121, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115,
+    115, 80, 111, 105, 110, 116, 68, 101, 112, 116, 104, 67, 108, 105, 112, 68, 105, 115, 97, 98, 108, 101, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 70, 111, 114, 99, 101, 32, 68, 101, 112, 116, 104, 45, 99, 108, 105, 112, 112, 105, 110, 103, 32, 100, 105,
+    115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111,
+    105, 110, 116, 65, 102, 116, 101, 114, 80, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 67, 111,
+    108, 111, 114, 32, 66, 117, 102, 102, 101, 114, 32, 119, 114, 105, 116, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 83, 105, 109, 112, 108, 101, 80, 115, 34, 44,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 55, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 85, 115, 101, 32, 97, 32, 116, 114, 105, 118, 105, 97, 108, 32, 80, 105, 120, 101, 108, 32, 83, 104, 97,
+    100, 101, 114, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116,
+    77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 111,
+    115, 115, 32, 80, 111, 105, 110, 116, 32, 77, 111, 100, 101, 115, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 77, 111, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34,
+    84, 111, 115, 115, 80, 111, 105, 110, 116, 78, 111, 110, 101, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116,
+    111, 115, 115, 80, 111, 105, 110, 116, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 84, 111, 115, 115, 32, 112, 111, 105, 110, 116, 115, 32, 101, 110, 97, 98, 108, 101, 115,
+    32, 115, 116, 114, 105, 112, 112, 105, 110, 103, 32, 111, 117, 116, 32, 111, 102, 32, 71, 80, 85, 32, 119, 111, 114,
+    107, 32, 102, 111, 114, 32, 109, 111, 114, 101, 32, 102, 111, 99, 117, 115, 101, 100, 32, 112, 101, 114, 102, 111,
+    114, 109, 97, 99, 101, 32, 97, 110, 97, 108, 121, 115, 105, 115, 46, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116,
+    105, 110, 103, 32, 99, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 105, 99, 104, 32, 119, 111, 114, 107, 32,
+    119, 105, 108, 108, 32, 98, 101, 32, 116, 111, 115, 115, 101, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 52, 52, 48, 49, 51, 54, 57, 57, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    87, 100, 100, 109, 49, 70, 114, 101, 101, 86, 105, 114, 116, 117, 97, 108, 71, 112, 117, 77, 101, 109, 86, 65, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 93, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 100, 100, 109, 49, 70, 114, 101, 101, 86, 105, 114, 116, 117, 97, 108,
+    71, 112, 117, 77, 101, 109, 86, 65, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 87, 104, 101, 116, 104, 101, 114, 32, 86, 65, 32, 111, 102, 32, 118, 105, 114, 116, 117, 97, 108, 32, 103, 112,
+    117, 32, 109, 101, 109, 111, 114, 121, 32, 119, 105, 108, 108, 32, 98, 101, 32, 102, 114, 101, 101, 100, 32, 97,
+    110, 100, 32, 114, 101, 116, 117, 114, 110, 101, 100, 32, 116, 111, 32, 86, 65, 77, 32, 97, 116, 32, 109, 101, 109,
+    111, 114, 121, 32, 100, 101, 115, 116, 114, 111, 121, 32, 116, 105, 109, 101, 32, 117, 110, 100, 101, 114, 32, 119,
+    100, 100, 109, 49, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 49, 50, 54, 56, 52,
+    51, 51, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 70, 105, 120, 101, 100,
+    70, 117, 110, 99, 67, 111, 108, 111, 114, 82, 101, 115, 111, 108, 118, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 44, 32, 34, 82, 101,
+    115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99, 101, 70, 105, 120, 101, 100, 70, 117, 110, 99, 67, 111, 108,
+    111, 114, 82, 101, 115, 111, 108, 118, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 102, 111, 114, 99, 101, 115, 32, 77, 83,
+    65, 65, 32, 99, 111, 108, 111, 114, 32, 105, 109, 97, 103, 101, 115, 32, 116, 111, 32, 97, 108, 119, 97, 121, 115,
+    32, 112, 114, 101, 102, 101, 114, 32, 102, 105, 120, 101, 100, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114,
+    101, 115, 111, 108, 118, 101, 115, 32, 111, 118, 101, 114, 32, 97, 110, 121, 32, 111, 116, 104, 101, 114, 32, 114,
+    101, 115, 111, 108, 118, 101, 32, 109, 101, 116, 104, 111, 100, 32, 40, 105, 102, 32, 70, 105, 120, 101, 100, 70,
+    117, 110, 99, 32, 114, 101, 115, 111, 108, 118, 101, 115, 32, 97, 114, 101, 32, 115, 117, 112, 112, 111, 114, 116,
+    101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 41, 46, 32, 84, 104, 105, 115, 32, 119, 105,
+    108, 108, 32, 111, 118, 101, 114, 114, 105, 100, 101, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 39, 115,
+    32, 112, 114, 101, 102, 101, 114, 114, 101, 100, 32, 114, 101, 115, 111, 108, 118, 101, 32, 109, 101, 116, 104, 111,
+    100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 51, 57, 49, 54, 55, 50, 55, 51, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 54, 52, 45, 98, 105, 116, 32,
+    97, 100, 100, 114, 101, 115, 115, 32, 116, 111, 32, 117, 115, 101, 32, 102, 111, 114, 32, 117, 110, 98, 111, 117,
+    110, 100, 32, 100, 101, 115, 99, 114, 105, 112, 116, 111, 114, 115, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108,
+    108, 32, 115, 104, 111, 119, 32, 117, 112, 32, 105, 110, 32, 116, 104, 101, 32, 102, 97, 117, 108, 116, 105, 110,
+    103, 32, 97, 100, 100, 114, 101, 115, 115, 32, 105, 102, 32, 97, 32, 112, 97, 103, 101, 32, 102, 97, 117, 108, 116,
+    32, 105, 115, 32, 116, 114, 105, 103, 103, 101, 114, 101, 100, 32, 100, 117, 101, 32, 116, 111, 32, 97, 110, 32,
+    117, 110, 98, 111, 117, 110, 100, 32, 100, 101, 115, 99, 114, 105, 112, 116, 111, 114, 32, 105, 110, 32, 97, 110,
+    32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 83, 97, 102, 101, 83, 101, 116, 116, 105, 110, 103, 34, 93, 44, 32,
+    34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 54,
+    48, 52, 53, 54, 57, 48, 57, 56, 52, 56, 51, 51, 51, 51, 53, 48, 50, 51, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 103, 112, 117, 115, 105, 122, 101, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 117, 110, 98, 111, 117, 110, 100, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 65, 100, 100, 114,
+    101, 115, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 110, 98, 111, 117, 110, 100, 68, 101, 115, 99,
+    114, 105, 112, 116, 111, 114, 65, 100, 100, 114, 101, 115, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 50, 57, 55, 50, 57, 49, 57, 53, 49, 55, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 108,
+    101, 97, 114, 65, 108, 108, 111, 99, 97, 116, 101, 100, 76, 102, 98, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 44, 32, 34, 83, 97, 102, 101,
+    83, 101, 116, 116, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115,
+    79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 76, 105, 110, 117, 120, 34, 93, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 99, 108, 101, 97, 114, 65, 108, 108, 111, 99, 97, 116, 101, 100, 76, 102, 98, 34, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 108, 101, 97, 114, 115, 32, 108, 111, 99, 97,
+    108, 32, 102, 114, 97, 109, 101, 32, 98, 117, 102, 102, 101, 114, 32, 116, 111, 32, 122, 101, 114, 111, 46, 32, 84,
+    104, 101, 32, 97, 108, 108, 111, 99, 97, 116, 101, 100, 32, 108, 111, 99, 97, 108, 32, 102, 114, 97, 109, 101, 32,
+    98, 117, 102, 102, 101, 114, 32, 105, 115, 32, 110, 111, 116, 32, 99, 108, 101, 97, 114, 101, 100, 32, 116, 111, 32,
+    122, 101, 114, 111, 32, 111, 110, 32, 76, 105, 110, 117, 120, 46, 32, 32, 65, 112, 112, 108, 105, 99, 97, 116, 105,
+    111, 110, 115, 32, 115, 111, 109, 101, 116, 105, 109, 101, 115, 32, 97, 115, 115, 117, 109, 101, 32, 116, 104, 97,
+    116, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 119, 105, 108, 108, 32, 99, 108, 101, 97, 114, 32,
+    116, 104, 101, 32, 102, 114, 97, 109, 101, 98, 117, 102, 102, 101, 114, 32, 111, 110, 32, 76, 105, 110, 117, 120,
+    32, 40, 119, 104, 105, 99, 104, 32, 119, 111, 117, 108, 100, 32, 109, 97, 116, 99, 104, 32, 87, 105, 110, 100, 111,
+    119, 115, 32, 98, 101, 104, 97, 118, 105, 111, 114, 41, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 50, 54, 53, 55, 52, 50, 48, 53, 54, 53, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117,
+    101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98,
+    108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 68, 101, 112, 116, 104, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 112,
+    116, 104, 32, 105, 109, 97, 103, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100,
+    114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 67, 111, 108, 111, 114, 49,
+    68, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 49, 68, 32, 67, 111, 108, 111, 114, 32, 105, 109, 97, 103, 101, 115, 34, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119,
+    105, 122, 122, 108, 101, 67, 111, 108, 111, 114, 50, 68, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 50, 68, 32, 67, 111, 108, 111, 114, 32,
+    105, 109, 97, 103, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68,
+    105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 67, 111, 108, 111, 114, 51, 68, 34, 44,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 51, 68, 32, 67, 111, 108, 111, 114, 32, 105, 109, 97, 103, 101, 115, 34, 125, 93, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122,
+    122, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116,
+    109, 97, 115, 107, 32, 118, 97, 108, 117, 101, 115, 32, 116, 104, 97, 116, 32, 99, 111, 114, 114, 101, 115, 112,
+    111, 110, 100, 32, 116, 111, 32, 105, 109, 97, 103, 101, 32, 116, 121, 112, 101, 115, 32, 102, 111, 114, 32, 99,
+    111, 110, 116, 114, 111, 108, 108, 105, 110, 103, 32, 52, 107, 66, 32, 115, 119, 105, 122, 122, 108, 101, 32, 109,
+    111, 100, 101, 115, 46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115,
+    97, 98, 108, 101, 52, 75, 98, 83, 119, 105, 122, 122, 108, 101, 77, 111, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83,
+    101, 116, 116, 105, 110, 103, 115, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101,
+    120, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114,
+    117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 100, 100, 114, 50, 68, 105, 115, 97,
+    98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 111, 102, 32, 115, 117, 114,
+    102, 97, 99, 101, 32, 116, 121, 112, 101, 115, 32, 119, 104, 105, 99, 104, 32, 115, 104, 111, 117, 108, 100, 32,
+    110, 111, 116, 32, 97, 108, 108, 111, 119, 32, 52, 107, 66, 32, 115, 119, 105, 122, 122, 108, 101, 32, 109, 111,
+    100, 101, 115, 32, 102, 111, 114, 32, 99, 104, 105, 112, 115, 32, 119, 104, 105, 99, 104, 32, 117, 115, 101, 32, 65,
+    100, 100, 114, 77, 103, 114, 50, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 50, 53, 50,
+    54, 55, 54, 56, 52, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    87, 104, 101, 116, 104, 101, 114, 32, 116, 111, 32, 100, 105, 115, 97, 98, 108, 101, 32, 88, 79, 82, 32, 116, 105,
+    108, 101, 32, 109, 111, 100, 101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101,
+    114, 97, 108, 34, 44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108,
+    101, 88, 111, 114, 84, 105, 108, 101, 77, 111, 100, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100,
+    100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 88, 111, 114, 84, 105, 108, 101, 77, 111, 100, 101, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 53, 55, 54, 48, 53, 50, 52, 50, 54, 125, 44, 32, 123, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 115, 32, 83, 32, 115,
+    119, 105, 122, 122, 108, 101, 32, 109, 111, 100, 101, 115, 32, 102, 111, 114, 32, 56, 98, 112, 112, 32, 99, 111,
+    108, 111, 114, 32, 116, 97, 114, 103, 101, 116, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71,
+    101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110,
+    103, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 100, 100, 114, 50, 68, 105,
+    115, 97, 98, 108, 101, 83, 77, 111, 100, 101, 115, 56, 66, 112, 112, 67, 111, 108, 111, 114, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 83, 77, 111, 100, 101, 115, 56, 66,
+    112, 112, 67, 111, 108, 111, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 55, 57,
+    49, 52, 50, 56, 54, 48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 118, 101, 114, 108, 97, 121, 82,
+    101, 112, 111, 114, 116, 72, 68, 82, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114,
+    97, 108, 34, 44, 32, 34, 68, 101, 118, 77, 111, 100, 101, 34, 44, 32, 34, 72, 68, 82, 34, 93, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 118, 101, 114, 108, 97, 121, 82, 101, 112, 111, 114, 116, 72, 68, 82,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109,
+    105, 110, 101, 115, 32, 105, 102, 32, 116, 104, 101, 32, 100, 101, 118, 101, 108, 111, 112, 101, 114, 32, 109, 111,
+    100, 101, 32, 111, 118, 101, 114, 108, 97, 121, 32, 119, 105, 108, 108, 32, 114, 101, 112, 111, 114, 116, 32, 105,
+    110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 97, 98, 111, 117, 116, 32, 72, 68, 82, 32, 109, 111, 100, 101,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 51, 53, 52, 55, 49, 49, 54, 52, 49, 125, 44,
+    32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34,
+    58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114,
+    117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80,
+    105, 112, 101, 108, 105, 110, 101, 72, 101, 97, 112, 76, 111, 99, 97, 108, 34, 44, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 99, 97,
+    108, 32, 67, 80, 85, 32, 118, 105, 115, 105, 98, 108, 101, 32, 104, 101, 97, 112, 46, 34, 125, 44, 32, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 72, 101, 97, 112, 73, 110, 118, 105, 115, 105,
+    98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 99, 97, 108, 32, 67, 80, 85, 32, 105, 110, 118, 105, 115, 105, 98, 108,
+    101, 32, 104, 101, 97, 112, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108,
+    105, 110, 101, 72, 101, 97, 112, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 45, 97, 99, 99,
+    101, 115, 115, 105, 98, 108, 101, 32, 117, 110, 99, 97, 99, 104, 101, 100, 32, 115, 121, 115, 116, 101, 109, 32,
+    109, 101, 109, 111, 114, 121, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101,
+    108, 105, 110, 101, 72, 101, 97, 112, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 51, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    71, 80, 85, 45, 97, 99, 99, 101, 115, 115, 105, 98, 108, 101, 32, 99, 97, 99, 104, 101, 100, 32, 115, 121, 115, 116,
+    101, 109, 32, 109, 101, 109, 111, 114, 121, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105,
+    112, 101, 108, 105, 110, 101, 72, 101, 97, 112, 68, 101, 102, 101, 114, 84, 111, 67, 108, 105, 101, 110, 116, 34,
+    44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 72, 101, 97, 112, 32, 116, 121, 112, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 98,
+    121, 32, 99, 108, 105, 101, 110, 116, 32, 105, 110, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 99, 114, 101,
+    97, 116, 101, 73, 110, 102, 111, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 101, 102,
+    101, 114, 114, 101, 100, 80, 105, 112, 101, 108, 105, 110, 101, 85, 112, 108, 111, 97, 100, 72, 101, 97, 112, 34,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 101, 97, 112, 32, 112, 114,
+    101, 102, 101, 114, 101, 110, 99, 101, 32, 102, 111, 114, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34,
+    125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 101, 102, 101, 114, 114, 101, 100, 80, 105, 112, 101,
+    108, 105, 110, 101, 85, 112, 108, 111, 97, 100, 72, 101, 97, 112, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34,
+    80, 105, 112, 101, 108, 105, 110, 101, 72, 101, 97, 112, 68, 101, 102, 101, 114, 84, 111, 67, 108, 105, 101, 110,
+    116, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 101, 102, 101, 114, 114, 101, 100, 80, 105, 112, 101,
+    108, 105, 110, 101, 85, 112, 108, 111, 97, 100, 72, 101, 97, 112, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 115, 32, 97, 114, 101, 32, 117, 112, 108,
+    111, 97, 100, 101, 100, 32, 102, 111, 114, 32, 71, 80, 85, 32, 97, 99, 99, 101, 115, 115, 32, 116, 111, 32, 116,
+    104, 101, 32, 104, 101, 97, 112, 32, 116, 121, 112, 101, 32, 112, 114, 101, 102, 101, 114, 114, 101, 100, 46, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 55, 48, 54, 51, 56, 50, 57, 57, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 110, 115, 101, 114, 116, 71, 117, 97, 114, 100, 80, 97, 103, 101, 66,
+    101, 116, 119, 101, 101, 110, 87, 100, 100, 109, 50, 86, 65, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125,
+    44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 87, 105,
+    110, 49, 48, 34, 93, 44, 32, 34, 66, 117, 105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 101, 118, 34,
+    93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 110, 115, 101, 114, 116, 71, 117, 97, 114, 100, 80, 97, 103, 101,
+    66, 101, 116, 119, 101, 101, 110, 87, 100, 100, 109, 50, 86, 65, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 32, 119, 101, 32, 119, 105, 108, 108, 32, 97,
+    116, 116, 101, 109, 112, 116, 32, 116, 111, 32, 105, 110, 115, 101, 114, 116, 32, 101, 109, 112, 116, 121, 32, 118,
+    97, 32, 115, 112, 97, 99, 101, 32, 105, 110, 32, 98, 101, 116, 119, 101, 101, 110, 32, 101, 118, 101, 114, 121, 32,
+    97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 109, 97, 112, 112, 105, 110, 103, 32, 105, 110, 32, 111, 114,
+    100, 101, 114, 32, 116, 111, 32, 102, 111, 114, 99, 101, 32, 112, 97, 103, 101, 32, 102, 97, 117, 108, 116, 115, 32,
+    119, 104, 101, 110, 32, 119, 114, 105, 116, 105, 110, 103, 32, 111, 117, 116, 115, 105, 100, 101, 32, 111, 102, 32,
+    97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 46, 32, 84, 104, 105, 115, 32, 104, 101, 108, 112, 115, 32, 100,
+    101, 98, 117, 103, 32, 114, 97, 110, 100, 111, 109, 32, 99, 111, 114, 114, 117, 112, 116, 105, 111, 110, 115, 32,
+    119, 104, 101, 110, 32, 119, 101, 32, 119, 114, 105, 116, 101, 32, 112, 97, 115, 116, 32, 111, 110, 101, 32, 97,
+    108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 110, 116, 111, 32, 97, 110, 111, 116, 104, 101, 114, 46, 32, 77,
+    117, 115, 116, 32, 98, 117, 105, 108, 100, 32, 119, 105, 116, 104, 32, 80, 65, 76, 95, 68, 69, 86, 69, 76, 79, 80,
+    69, 82, 95, 66, 85, 73, 76, 68, 32, 102, 108, 97, 103, 32, 102, 111, 114, 32, 116, 104, 105, 115, 32, 116, 111, 32,
+    119, 111, 114, 107, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 48, 51, 54, 51, 55,
+    48, 48, 54, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 72, 101, 97, 112, 80,
+    101, 114, 102, 84, 111, 70, 105, 120, 101, 100, 86, 97, 108, 117, 101, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 66, 114, 105, 110, 103, 117,
+    112, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 102, 111, 114, 99, 101, 72, 101, 97, 112, 80, 101, 114, 102, 84, 111, 70, 105, 120, 101, 100, 86,
+    97, 108, 117, 101, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73,
+    102, 32, 115, 101, 116, 32, 119, 101, 32, 119, 105, 108, 108, 32, 117, 115, 101, 32, 97, 32, 115, 101, 116, 32, 111,
+    102, 32, 104, 97, 114, 100, 45, 99, 111, 100, 101, 100, 32, 104, 101, 97, 112, 32, 112, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 32, 118, 97, 108, 117, 101, 115, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 116,
+    104, 101, 32, 117, 115, 117, 97, 108, 32, 65, 83, 73, 67, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 118, 97,
+    108, 117, 101, 115, 46, 32, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 105,
+    110, 116, 101, 110, 100, 101, 100, 32, 102, 111, 114, 32, 98, 114, 105, 110, 103, 45, 117, 112, 32, 116, 101, 115,
+    116, 105, 110, 103, 32, 97, 115, 32, 119, 101, 32, 119, 105, 108, 108, 32, 114, 101, 116, 117, 114, 110, 32, 122,
+    101, 114, 111, 115, 32, 102, 111, 114, 32, 97, 108, 108, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101,
+    32, 100, 97, 116, 97, 32, 111, 110, 32, 117, 110, 107, 110, 111, 119, 110, 32, 71, 80, 85, 115, 46, 32, 32, 84, 104,
+    105, 115, 32, 99, 97, 110, 32, 99, 97, 117, 115, 101, 32, 115, 116, 114, 97, 110, 103, 101, 32, 98, 101, 104, 97,
+    118, 105, 111, 114, 32, 40, 101, 46, 103, 46, 44, 32, 112, 111, 111, 114, 32, 112, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 41, 32, 105, 110, 32, 115, 111, 109, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 115,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 49, 53, 55, 48, 51, 49, 50, 52, 125, 44,
+    32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 114, 101, 97, 100,
+    32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97, 108, 32, 109, 101,
+    109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110,
+    99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 99, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 54, 55, 55, 49, 49, 48, 51, 54, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 119, 114, 105, 116,
+    101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97, 108, 32, 109,
+    101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 99, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 76,
+    111, 99, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 51, 48, 53, 55, 48, 49,
+    53, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32,
+    114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97,
+    108, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 103, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114,
+    76, 111, 99, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 51, 56, 54, 49, 48,
+    55, 51, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85,
+    32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 108,
+    111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101,
+    114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 76,
+    111, 99, 97, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116, 101, 80, 101,
+    114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50,
+    48, 49, 51, 50, 56, 55, 56, 55, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 71, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102,
+    111, 114, 32, 105, 110, 118, 105, 115, 105, 98, 108, 101, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112,
+    80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 82, 101, 97, 100, 80,
+    101, 114, 102, 70, 111, 114, 73, 110, 118, 105, 115, 105, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 71, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 73, 110, 118, 105, 115, 105, 98, 108, 101,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 56, 54, 48, 52, 51, 50, 50, 52, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 119, 114, 105, 116,
+    101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 105, 110, 118, 105, 115, 105,
+    98, 108, 101, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114,
+    102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 73, 110,
+    118, 105, 115, 105, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116,
+    101, 80, 101, 114, 102, 70, 111, 114, 73, 110, 118, 105, 115, 105, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 53, 57, 53, 50, 57, 49, 54, 48, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 85, 115, 119, 99, 32, 109, 101, 109, 111, 114,
+    121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34,
+    44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99,
+    112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97,
+    114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 57, 53, 49, 51,
+    49, 50, 56, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80,
+    85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97,
+    114, 116, 85, 115, 119, 99, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49,
+    125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71,
+    97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 82, 101, 97, 100,
+    80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 54, 54, 52, 50, 51, 54, 56, 52, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110,
+    99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 85, 115, 119, 99, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72,
+    101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97,
+    116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 82, 101,
+    97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 71, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 55, 54, 49, 55, 48, 48, 56, 54, 57, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 119, 114, 105, 116,
+    101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 85, 115, 119,
+    99, 32, 109, 101, 109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 103, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116,
+    85, 115, 119, 99, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116, 101, 80, 101,
+    114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 50, 53, 55, 52, 49, 53, 57, 56, 48, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99,
+    101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109, 101, 109, 111, 114,
+    121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34,
+    44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99,
+    112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108,
+    101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111,
+    114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 50, 56, 54, 57, 49, 55, 50, 51, 55, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110,
+    99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109, 101, 109, 111,
+    114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101,
+    34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    99, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97,
+    98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114,
+    102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 57, 53, 57, 55, 48, 56, 49, 49, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109, 101, 109,
+    111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99,
+    101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 103, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97,
+    98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102,
+    70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 48, 54, 50, 55, 53, 48, 51, 57, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109,
+    97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109, 101,
+    109, 111, 114, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110,
+    99, 101, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 103, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104,
+    101, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116, 101, 80,
+    101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 50, 49, 48, 50, 57, 55, 51, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 65, 108, 108, 111, 99, 97, 116, 105, 111, 110, 76, 105, 115, 116, 82, 101, 117, 115, 97, 98, 108,
+    101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34,
+    58, 32, 91, 34, 76, 105, 110, 117, 120, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111,
+    108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 108, 108, 111, 99,
+    97, 116, 105, 111, 110, 76, 105, 115, 116, 82, 101, 117, 115, 97, 98, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 45, 117, 115, 101, 32, 97, 108, 108, 111, 99, 97, 116,
+    105, 111, 110, 32, 108, 105, 115, 116, 32, 97, 99, 114, 111, 115, 115, 32, 115, 117, 98, 109, 105, 115, 115, 105,
+    111, 110, 115, 32, 105, 110, 32, 76, 105, 110, 117, 120, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 105,
+    109, 112, 114, 111, 118, 101, 32, 67, 80, 85, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 111, 102,
+    32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 115, 117, 98, 109, 105, 115, 115, 105,
+    111, 110, 44, 32, 98, 117, 116, 32, 119, 105, 108, 108, 32, 112, 111, 116, 101, 110, 116, 105, 97, 108, 108, 121,
+    32, 99, 97, 117, 115, 101, 32, 71, 80, 85, 32, 109, 101, 109, 111, 114, 121, 32, 100, 101, 45, 97, 108, 108, 111,
+    99, 97, 116, 105, 111, 110, 32, 116, 111, 32, 98, 101, 32, 100, 101, 108, 97, 121, 101, 100, 46, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 55, 50, 55, 48, 51, 54, 57, 57, 52, 125, 44, 32, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 67, 109, 100, 83, 116, 114, 101, 97, 109, 82, 101, 97, 100, 79, 110, 108, 121, 34, 44, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34,
+    58, 32, 91, 34, 87, 105, 110, 100, 111, 119, 115, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98,
+    111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100,
+    83, 116, 114, 101, 97, 109, 82, 101, 97, 100, 79, 110, 108, 121, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 65, 108, 119, 97, 121, 115, 32, 109, 97, 107, 101, 32, 99, 111, 109, 109, 97,
+    110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 109, 101, 109, 111, 114, 121, 32, 114, 101, 97, 100, 45, 111, 110,
+    108, 121, 32, 111, 110, 32, 116, 104, 101, 32, 71, 80, 85, 46, 32, 78, 111, 114, 109, 97, 108, 108, 121, 44, 32, 98,
+    117, 115, 121, 45, 116, 114, 97, 99, 107, 101, 100, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 32, 97,
+    114, 101, 32, 82, 87, 44, 32, 116, 104, 105, 115, 32, 102, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32, 98, 117,
+    115, 121, 32, 116, 114, 97, 99, 107, 101, 114, 32, 100, 97, 116, 97, 32, 105, 110, 116, 111, 32, 97, 32, 115, 101,
+    112, 97, 114, 97, 116, 101, 32, 82, 87, 32, 112, 97, 103, 101, 46, 32, 67, 117, 114, 114, 101, 110, 116, 108, 121,
+    32, 111, 110, 108, 121, 32, 119, 111, 114, 107, 115, 32, 111, 110, 32, 87, 68, 68, 77, 50, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 49, 57, 49, 49, 55, 55, 56, 53, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 70, 101, 110, 99, 101, 84, 105, 109, 101, 111, 117, 116, 79, 118, 101, 114, 114, 105, 100, 101,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44,
+    32, 34, 69, 109, 117, 108, 97, 116, 105, 111, 110, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    102, 101, 110, 99, 101, 84, 105, 109, 101, 111, 117, 116, 79, 118, 101, 114, 114, 105, 100, 101, 73, 110, 83, 101,
+    99, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101, 111,
+    117, 116, 32, 118, 97, 108, 117, 101, 32, 116, 111, 32, 111, 118, 101, 114, 114, 105, 100, 101, 32, 97, 112, 112,
+    45, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 118, 97, 108, 117, 101, 32, 102, 111, 114, 32, 102, 101, 110,
+    99, 101, 32, 116, 105, 109, 101, 111, 117, 116, 115, 46, 32, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105,
+    110, 103, 32, 105, 115, 32, 109, 101, 97, 110, 105, 110, 103, 108, 101, 115, 115, 32, 105, 102, 32, 116, 104, 101,
+    32, 97, 112, 112, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 122, 101, 114, 111, 32, 115, 101, 99, 111,
+    110, 100, 115, 46, 32, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 122, 101, 114, 111, 32, 104, 101, 114,
+    101, 32, 109, 101, 97, 110, 115, 32, 116, 111, 32, 117, 115, 101, 32, 116, 104, 101, 32, 97, 112, 112, 45, 115, 112,
+    101, 99, 105, 102, 105, 101, 100, 32, 116, 105, 109, 101, 111, 117, 116, 32, 118, 97, 108, 117, 101, 46, 32, 32, 85,
+    115, 101, 102, 117, 108, 32, 111, 110, 32, 72, 87, 32, 115, 105, 109, 117, 108, 97, 116, 105, 111, 110, 32, 119,
+    104, 101, 114, 101, 32, 119, 111, 114, 107, 105, 110, 103, 32, 99, 97, 115, 101, 115, 32, 99, 97, 110, 32, 114, 101,
+    115, 117, 108, 116, 32, 105, 110, 32, 102, 97, 108, 115, 101, 32, 116, 105, 109, 101, 111, 117, 116, 115, 46, 32,
+    32, 86, 97, 108, 117, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 105, 110, 32, 115, 101, 99, 111, 110,
+    100, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 55, 48, 49, 55, 50, 56, 49, 55, 125,
+    44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 54, 52, 107, 80, 97, 103, 101, 71, 114,
+    97, 110, 117, 108, 97, 114, 105, 116, 121, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111,
+    114, 99, 101, 54, 52, 107, 80, 97, 103, 101, 71, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 34, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 102, 111, 114,
+    99, 101, 32, 97, 108, 108, 32, 103, 112, 117, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 32, 116, 111,
+    32, 98, 101, 32, 97, 108, 105, 103, 110, 101, 100, 47, 115, 105, 122, 101, 100, 32, 105, 110, 32, 54, 52, 107, 32,
+    105, 110, 99, 114, 101, 109, 101, 110, 116, 115, 46, 32, 83, 104, 111, 117, 108, 100, 32, 105, 109, 112, 114, 111,
+    118, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 44, 32, 98, 117, 116, 32, 119, 105, 108, 108, 32,
+    119, 97, 115, 116, 101, 32, 97, 32, 108, 111, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 32, 105, 110, 32,
+    97, 108, 105, 103, 110, 109, 101, 110, 116, 32, 97, 110, 100, 32, 112, 97, 100, 100, 105, 110, 103, 46, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 51, 51, 52, 51, 50, 52, 57, 54, 125, 44, 32, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 85, 112, 100, 97, 116, 101, 79, 110, 101, 71, 112, 117, 86, 105, 114, 116, 117,
+    97, 108, 65, 100, 100, 114, 101, 115, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 34, 44, 32, 34, 83, 97, 102, 101, 83, 101, 116, 116, 105, 110, 103, 34, 44, 32, 34,
+    68, 101, 98, 117, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 112, 100, 97,
+    116, 101, 79, 110, 101, 71, 112, 117, 86, 105, 114, 116, 117, 97, 108, 65, 100, 100, 114, 101, 115, 115, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 119,
+    104, 101, 110, 32, 99, 97, 108, 108, 105, 110, 103, 32, 82, 101, 109, 97, 112, 86, 105, 114, 116, 117, 97, 108, 77,
+    101, 109, 111, 114, 121, 80, 97, 103, 101, 115, 40, 41, 44, 32, 80, 65, 76, 32, 119, 105, 108, 108, 32, 111, 110,
+    108, 121, 32, 100, 111, 32, 111, 110, 101, 32, 117, 110, 109, 97, 112, 47, 109, 97, 112, 32, 112, 114, 111, 116,
+    101, 99, 116, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 32, 97, 116, 32, 97, 32, 116, 105, 109, 101, 44, 32,
+    105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 116, 114, 121, 105, 110, 103, 32, 116, 111, 32, 103, 114, 111,
+    117, 112, 32, 116, 104, 101, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 115, 32, 98, 121, 32, 66, 97, 115, 101,
+    65, 100, 100, 114, 101, 115, 115, 46, 32, 32, 84, 104, 105, 115, 32, 97, 102, 102, 101, 99, 116, 115, 32, 87, 68,
+    68, 77, 50, 32, 111, 110, 108, 121, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 49, 55,
+    56, 51, 56, 51, 53, 55, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 108, 119, 97, 121, 115, 82,
+    101, 115, 105, 100, 101, 110, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98,
+    111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 108, 119,
+    97, 121, 115, 82, 101, 115, 105, 100, 101, 110, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 65, 108, 108, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 112, 101, 114, 109, 97, 110, 101, 110, 116, 108, 121, 32, 107, 101, 112, 116, 32, 114, 101, 115,
+    105, 100, 101, 110, 116, 32, 119, 105, 116, 104, 111, 117, 116, 32, 109, 97, 110, 97, 103, 101, 109, 101, 110, 116,
+    32, 98, 121, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 32, 119, 105, 116, 104, 32, 65, 100, 100, 71, 112,
+    117, 77, 101, 109, 111, 114, 121, 82, 101, 102, 101, 114, 101, 110, 99, 101, 115, 46, 32, 32, 84, 104, 105, 115, 32,
+    109, 97, 121, 32, 114, 101, 100, 117, 99, 101, 32, 116, 104, 101, 32, 114, 117, 110, 116, 105, 109, 101, 32, 111,
+    118, 101, 114, 104, 101, 97, 100, 32, 111, 102, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111, 110, 32, 111, 110,
+    32, 76, 105, 110, 117, 120, 44, 32, 98, 117, 116, 32, 119, 111, 110, 39, 116, 32, 119, 111, 114, 107, 32, 112, 114,
+    111, 112, 101, 114, 108, 121, 32, 105, 102, 32, 116, 104, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111,
+    110, 32, 111, 118, 101, 114, 99, 111, 109, 109, 105, 116, 115, 32, 116, 104, 101, 32, 97, 118, 97, 105, 108, 97, 98,
+    108, 101, 32, 71, 80, 85, 32, 109, 101, 109, 111, 114, 121, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 49, 57, 56, 57, 49, 51, 48, 54, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105,
+    115, 97, 98, 108, 101, 83, 121, 110, 99, 111, 98, 106, 70, 101, 110, 99, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 83, 121, 110, 99, 111, 98, 106, 70, 101, 110, 99, 101,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101,
+    32, 70, 101, 110, 99, 101, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 83, 121, 110, 99, 32, 79, 98, 106, 101, 99,
+    116, 46, 32, 70, 111, 114, 99, 101, 32, 117, 115, 101, 32, 84, 105, 109, 101, 115, 116, 97, 109, 112, 32, 70, 101,
+    110, 99, 101, 46, 32, 66, 121, 32, 100, 101, 102, 97, 117, 108, 116, 32, 70, 101, 110, 99, 101, 32, 116, 121, 112,
+    101, 32, 105, 115, 32, 115, 101, 108, 101, 99, 116, 101, 100, 32, 97, 99, 99, 111, 114, 100, 105, 110, 103, 32, 116,
+    111, 32, 116, 104, 101, 32, 115, 121, 115, 116, 101, 109, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105,
+    111, 110, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 56, 55, 55, 49, 53, 56, 53,
+    56, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110,
+    117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58,
+    32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 70, 111, 114, 99, 101, 68, 105, 115, 97, 98,
+    108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 116, 104, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97,
+    116, 105, 111, 110, 32, 97, 108, 119, 97, 121, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 68, 101, 102, 97,
+    117, 108, 116, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 108, 121, 32, 101, 110, 97, 98, 108, 101,
+    32, 116, 104, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 119, 104, 101, 110, 32, 107,
+    101, 114, 110, 101, 108, 32, 100, 114, 105, 118, 101, 114, 32, 99, 97, 110, 32, 115, 117, 112, 112, 111, 114, 116,
+    34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105,
+    100, 70, 111, 114, 99, 101, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 116, 104,
+    101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 97, 108, 119, 97, 121, 115, 32, 101, 110,
+    97, 98, 108, 101, 100, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121,
+    115, 86, 97, 108, 105, 100, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 101, 102, 105, 110, 101, 115, 32, 116, 104, 101, 32, 115, 117, 112, 112, 111, 114,
+    116, 101, 100, 32, 86, 77, 32, 97, 108, 119, 97, 121, 115, 32, 118, 97, 108, 105, 100, 32, 109, 111, 100, 101, 115,
+    46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 86, 109, 65, 108, 119, 97,
+    121, 115, 86, 97, 108, 105, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 68, 101, 102, 97,
+    117, 108, 116, 69, 110, 97, 98, 108, 101, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101,
+    86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 87, 105, 116, 104, 32, 116, 104, 105, 115, 32, 102, 101, 97, 116, 117, 114, 101, 32,
+    101, 110, 97, 98, 108, 101, 100, 32, 86, 77, 32, 97, 100, 100, 114, 101, 115, 115, 101, 115, 32, 97, 114, 101, 32,
+    97, 108, 119, 97, 121, 115, 32, 118, 97, 108, 105, 100, 32, 119, 105, 116, 104, 105, 110, 32, 116, 104, 101, 32,
+    108, 111, 99, 97, 108, 32, 86, 77, 32, 99, 111, 110, 116, 101, 120, 116, 46, 32, 32, 84, 104, 105, 115, 32, 101,
+    108, 105, 109, 105, 110, 97, 116, 101, 115, 32, 116, 104, 101, 32, 110, 101, 101, 100, 32, 116, 111, 32, 97, 100,
+    100, 32, 112, 114, 105, 118, 97, 116, 101, 32, 109, 101, 109, 111, 114, 121, 32, 105, 110, 116, 111, 32, 116, 104,
+    101, 32, 114, 101, 115, 111, 117, 114, 99, 101, 32, 108, 105, 115, 116, 46, 32, 84, 104, 105, 115, 32, 109, 97, 121,
+    32, 114, 101, 100, 117, 99, 101, 32, 116, 104, 101, 32, 114, 117, 110, 116, 105, 109, 101, 32, 111, 118, 101, 114,
+    104, 101, 97, 100, 32, 111, 102, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111, 110, 32, 111, 110, 32, 76, 105,
+    110, 117, 120, 44, 32, 98, 117, 116, 32, 119, 111, 110, 39, 116, 32, 119, 111, 114, 107, 32, 102, 111, 114, 32, 109,
+    101, 109, 111, 114, 121, 32, 115, 104, 97, 114, 101, 100, 32, 98, 121, 32, 109, 117, 108, 116, 105, 112, 108, 101,
+    32, 112, 114, 111, 99, 101, 115, 115, 101, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    49, 55, 49, 56, 50, 54, 52, 48, 57, 54, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97,
+    98, 108, 101, 83, 121, 110, 99, 79, 98, 106, 101, 99, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112,
+    101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 76, 105, 110, 117, 120, 34, 93, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 83, 121, 110, 99, 79, 98, 106, 101, 99, 116,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101,
+    115, 32, 83, 121, 110, 99, 79, 98, 106, 101, 99, 116, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111, 114, 32,
+    115, 101, 109, 97, 112, 104, 111, 114, 101, 115, 32, 119, 104, 105, 99, 104, 32, 109, 101, 97, 110, 115, 32, 115,
+    101, 109, 97, 112, 104, 111, 114, 101, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 98, 97, 115, 101, 100, 32, 111,
+    110, 32, 80, 114, 111, 79, 110, 108, 121, 32, 111, 114, 32, 76, 101, 103, 97, 99, 121, 32, 105, 110, 116, 101, 114,
+    102, 97, 99, 101, 115, 32, 97, 99, 99, 111, 114, 100, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32, 115, 121,
+    115, 116, 101, 109, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 51, 48, 57, 51, 51, 56, 53, 57, 125, 44, 32, 123, 34, 86, 97, 108, 105,
+    100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101,
+    44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117,
+    109, 112, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110,
+    100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 105, 110, 103, 32, 105, 115, 32, 100, 105, 115, 97,
+    98, 108, 101, 100, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117,
+    109, 112, 77, 111, 100, 101, 82, 101, 99, 111, 114, 100, 84, 105, 109, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 117, 109, 112,
+    105, 110, 103, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 97, 116, 32, 99, 111, 109, 109, 97, 110, 100,
+    32, 98, 117, 102, 102, 101, 114, 32, 114, 101, 99, 111, 114, 100, 32, 116, 105, 109, 101, 34, 125, 44, 32, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 83, 117, 98,
+    109, 105, 116, 84, 105, 109, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 117, 109, 112, 105, 110, 103, 32, 105, 115, 32, 101, 110,
+    97, 98, 108, 101, 100, 32, 97, 116, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 115,
+    117, 98, 109, 105, 116, 32, 116, 105, 109, 101, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109,
+    100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 101, 102, 105, 110, 101, 115, 32, 116, 104, 101, 32, 115, 117, 112, 112, 111, 114,
+    116, 101, 100, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 32,
+    109, 111, 100, 101, 115, 46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68,
+    117, 109, 112, 77, 111, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105,
+    110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117,
+    109, 112, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    99, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 100, 117,
+    109, 112, 105, 110, 103, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 44, 32, 97, 110, 100, 32, 119, 104, 101,
+    116, 104, 101, 114, 32, 105, 116, 32, 105, 115, 32, 97, 116, 32, 114, 101, 99, 111, 114, 100, 32, 111, 114, 32, 115,
+    117, 98, 109, 105, 116, 32, 116, 105, 109, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    51, 54, 48, 55, 57, 57, 49, 48, 51, 51, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108,
+    117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97,
+    116, 84, 101, 120, 116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115,
+    32, 97, 114, 101, 32, 100, 117, 109, 112, 101, 100, 32, 105, 110, 32, 112, 108, 97, 105, 110, 32, 116, 101, 120,
+    116, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112,
+    70, 111, 114, 109, 97, 116, 66, 105, 110, 97, 114, 121, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32,
+    98, 117, 102, 102, 101, 114, 115, 32, 97, 114, 101, 32, 100, 117, 109, 112, 101, 100, 32, 105, 110, 32, 114, 97,
+    119, 32, 98, 105, 110, 97, 114, 121, 32, 109, 111, 100, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97, 116, 66, 105, 110, 97, 114, 121, 72,
+    101, 97, 100, 101, 114, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114,
+    115, 32, 97, 114, 101, 32, 100, 117, 109, 112, 101, 100, 32, 105, 110, 32, 98, 105, 110, 97, 114, 121, 32, 109, 111,
+    100, 101, 32, 119, 105, 116, 104, 32, 80, 77, 52, 32, 104, 101, 97, 100, 101, 114, 115, 46, 34, 125, 93, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97, 116, 34, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 102, 105, 110, 101, 115, 32,
+    116, 104, 101, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 32, 102, 111, 114, 109, 97, 116, 115, 32, 102, 111,
+    114, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 105, 110, 103,
+    46, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111,
+    114, 109, 97, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32,
+    97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70,
+    111, 114, 109, 97, 116, 84, 101, 120, 116, 34, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58,
+    32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32,
+    91, 48, 93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104,
+    97, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111,
+    100, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70,
+    111, 114, 109, 97, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67,
+    111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 102, 111, 114, 109, 97, 116, 32, 111, 102, 32, 99, 111,
+    109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 115, 46, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 48, 53, 49, 54, 52, 57, 55, 55, 125, 44, 32, 123, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116, 105, 118, 101, 32, 100, 105, 114, 101,
+    99, 116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102,
+    101, 114, 32, 100, 117, 109, 112, 115, 32, 97, 114, 101, 32, 112, 108, 97, 99, 101, 100, 46, 32, 82, 101, 108, 97,
+    116, 105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65,
+    77, 68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118,
+    97, 114, 105, 97, 98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32,
+    105, 115, 110, 39, 116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105,
+    115, 32, 112, 108, 97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103,
+    103, 105, 110, 103, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 80, 97, 116, 104, 34,
+    58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 32, 34, 87, 105, 110, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 67, 109, 100, 66, 117, 102, 102, 101, 114, 115, 92, 92, 34, 44, 32,
+    34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 125, 44, 32,
+    34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58,
+    32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 48, 93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34,
+    58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67,
+    109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 68, 117, 109, 112, 68, 105, 114, 101, 99, 116,
+    111, 114, 121, 34, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76,
+    101, 110, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50, 57, 51, 50, 57, 53, 48, 50, 53,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100,
+    66, 117, 102, 68, 117, 109, 112, 83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 48, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105,
+    110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 48, 93, 44, 32, 34, 76, 111,
+    103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 125, 93, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66, 117,
+    102, 68, 117, 109, 112, 83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 101, 32, 115, 116, 97, 114, 116, 105, 110, 103, 32, 102, 114, 97,
+    109, 101, 32, 116, 111, 32, 115, 116, 97, 114, 116, 32, 100, 117, 109, 112, 105, 110, 103, 32, 99, 111, 109, 109,
+    97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 49, 54, 51, 57, 51, 48, 53, 52, 53, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 117, 98,
+    109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 69, 110, 100, 70, 114, 97, 109,
+    101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100,
+    32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58,
+    32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32,
+    91, 48, 93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104,
+    97, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111,
+    100, 101, 34, 125, 44, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 48, 93, 44, 32, 34, 76, 111, 103,
+    105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 83, 117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112,
+    83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115,
+    117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 69, 110, 100, 70, 114, 97,
+    109, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 101, 32,
+    101, 110, 100, 105, 110, 103, 32, 102, 114, 97, 109, 101, 32, 116, 111, 32, 115, 116, 111, 112, 32, 100, 117, 109,
+    112, 105, 110, 103, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 46, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 50, 49, 57, 54, 49, 50, 57, 51, 125, 44, 32, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 67, 109, 100, 66, 117, 102, 67, 111, 109, 109, 105, 116, 83, 105, 122,
+    101, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110,
+    100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101,
+    110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 66, 117, 105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 98,
+    103, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 67, 109, 100, 66, 117, 102, 67, 111, 109,
+    109, 105, 116, 83, 105, 122, 101, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 99, 111, 109, 109, 97,
+    110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 99, 111, 109, 109, 105, 116, 32, 115, 105, 122, 101, 115, 32, 97,
+    114, 101, 32, 108, 111, 103, 103, 101, 100, 32, 116, 111, 32, 97, 32, 102, 105, 108, 101, 46, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 50, 50, 50, 48, 48, 50, 53, 49, 55, 125, 44, 32, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 76, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 73, 110, 102, 111, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103,
+    103, 105, 110, 103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34,
+    58, 32, 123, 34, 66, 117, 105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 93, 125, 44, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 80, 105, 112, 101,
+    108, 105, 110, 101, 32, 76, 111, 103, 103, 105, 110, 103, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 56, 51, 53, 55, 57, 49, 53, 54, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 32, 76, 111, 103, 103, 105, 110, 103, 32, 99, 111, 110,
+    102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110,
+    103, 34, 93, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 66, 117, 105, 108, 100, 84,
+    121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 93, 44, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58,
+    32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 76, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 73, 110, 102, 111, 34, 125, 93, 125, 44, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 67, 111, 110, 102, 105,
+    103, 34, 44, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 111, 108, 115, 32, 108, 111, 103, 103, 105, 110, 103,
+    32, 111, 102, 32, 105, 110, 116, 101, 114, 110, 97, 108, 108, 121, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100,
+    32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 32, 40, 105, 46, 101, 46, 32, 82, 80, 77, 32, 112, 105, 112, 101,
+    108, 105, 110, 101, 115, 44, 32, 101, 116, 99, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 108, 111, 103, 73, 110, 116, 101, 114, 110, 97, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111,
+    103, 73, 110, 116, 101, 114, 110, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49,
+    54, 54, 52, 52, 55, 49, 51, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 67, 111, 110, 116, 111, 108, 115, 32, 108, 111, 103, 103, 105, 110, 103, 32, 111, 102, 32, 101, 120, 116,
+    101, 114, 110, 97, 108, 108, 121, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100, 32, 112, 105, 112, 101, 108, 105,
+    110, 101, 115, 32, 40, 105, 46, 101, 46, 32, 116, 104, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110,
+    39, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 108, 111, 103, 69, 120, 116, 101, 114, 110, 97, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    76, 111, 103, 69, 120, 116, 101, 114, 110, 97, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    57, 51, 56, 52, 49, 53, 48, 51, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 101, 97, 99, 104, 32, 115, 104, 97, 100, 101, 114, 32, 105,
+    110, 32, 97, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 108, 111, 103,
+    103, 101, 100, 32, 116, 111, 32, 97, 32, 115, 101, 112, 97, 114, 97, 116, 101, 32, 102, 105, 108, 101, 32, 111, 110,
+    32, 100, 105, 115, 107, 46, 32, 79, 116, 104, 101, 114, 119, 105, 115, 101, 32, 116, 104, 101, 32, 119, 104, 111,
+    108, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 105, 115, 32, 112, 108, 97, 99, 101, 100, 32, 105, 110,
+    32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 102, 105, 108, 101, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 108, 111, 103, 83, 104, 97, 100, 101, 114, 115, 83, 101, 112, 97, 114, 97, 116, 101, 108, 121,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 83, 104, 97, 100, 101, 114, 115, 83, 101, 112, 97,
+    114, 97, 116, 101, 108, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 53, 51, 55, 51,
+    52, 49, 54, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102,
+    32, 116, 114, 117, 101, 44, 32, 100, 117, 112, 108, 105, 99, 97, 116, 101, 32, 112, 105, 112, 101, 108, 105, 110,
+    101, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 100, 117, 109, 112, 101, 100, 32, 116, 111, 32, 97, 32, 102, 105,
+    108, 101, 32, 119, 105, 116, 104, 32, 97, 32, 110, 117, 109, 101, 114, 105, 99, 32, 115, 117, 102, 102, 105, 120,
+    32, 97, 116, 116, 97, 99, 104, 101, 100, 32, 116, 111, 32, 116, 104, 101, 32, 102, 105, 108, 101, 110, 97, 109, 101,
+    32, 116, 111, 32, 100, 105, 115, 116, 105, 110, 103, 117, 105, 115, 104, 32, 101, 97, 99, 104, 32, 99, 111, 112,
+    121, 32, 111, 102, 32, 116, 104, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 46, 34, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 68, 117, 112, 108, 105, 99, 97, 116, 101, 80, 105, 112, 101,
+    108, 105, 110, 101, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 68, 117, 112, 108, 105, 99,
+    97, 116, 101, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 51, 51, 52, 55, 50, 49, 55, 54, 56, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 100, 105, 115, 97, 115, 115, 101, 109, 98, 108,
+    121, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 109,
+    98, 101, 100, 100, 101, 100, 32, 105, 110, 116, 111, 32, 99, 111, 109, 112, 105, 108, 101, 100, 32, 69, 76, 70, 32,
+    98, 105, 110, 97, 114, 105, 101, 115, 46, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101,
+    109, 98, 101, 100, 80, 105, 112, 101, 108, 105, 110, 101, 68, 105, 115, 97, 115, 115, 101, 109, 98, 108, 121, 34,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 109, 98, 101, 100, 80, 105, 112, 101, 108, 105, 110, 101, 68, 105,
+    115, 97, 115, 115, 101, 109, 98, 108, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49,
+    55, 49, 51, 57, 57, 55, 55, 54, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32,
+    123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58,
+    32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70, 105,
+    108, 116, 101, 114, 78, 111, 110, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 111, 32, 110, 111, 116, 32, 100, 105, 115, 97, 98,
+    108, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 112, 105, 112, 101,
+    108, 105, 110, 101, 32, 116, 121, 112, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105,
+    112, 101, 108, 105, 110, 101, 76, 111, 103, 70, 105, 108, 116, 101, 114, 67, 115, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115,
+    97, 98, 108, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 67, 115, 32, 112, 105, 112, 101,
+    108, 105, 110, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105,
+    110, 101, 76, 111, 103, 70, 105, 108, 116, 101, 114, 78, 103, 103, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108,
+    101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 78, 71, 71, 32, 112, 105, 112, 101, 108, 105,
+    110, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101,
+    76, 111, 103, 70, 105, 108, 116, 101, 114, 71, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 108,
+    111, 103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 71, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 34,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70,
+    105, 108, 116, 101, 114, 84, 101, 115, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 108, 111, 103,
+    103, 105, 110, 103, 32, 102, 111, 114, 32, 84, 101, 115, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 34,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70,
+    105, 108, 116, 101, 114, 86, 115, 80, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 54, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 108, 111,
+    103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 86, 115, 80, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115,
+    34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70,
+    105, 108, 116, 101, 114, 115, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105,
+    110, 101, 84, 121, 112, 101, 70, 105, 108, 116, 101, 114, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123,
+    34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34,
+    58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51,
+    50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108,
+    105, 110, 101, 84, 121, 112, 101, 70, 105, 108, 116, 101, 114, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 102, 105, 101, 108, 100, 32, 119, 104, 105, 99, 104, 32, 97, 108, 108,
+    111, 119, 115, 32, 102, 111, 114, 32, 102, 105, 108, 116, 101, 114, 105, 110, 103, 32, 112, 105, 112, 101, 108, 105,
+    110, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 116, 111, 32, 101, 120, 99, 108, 117, 100, 101, 32, 115, 112,
+    101, 99, 105, 102, 105, 99, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 115, 46, 32, 32, 73,
+    102, 32, 97, 32, 98, 105, 116, 32, 105, 115, 32, 115, 101, 116, 32, 116, 104, 101, 110, 32, 116, 104, 97, 116, 32,
+    112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 32, 119, 105, 108, 108, 32, 78, 79, 84, 32, 98, 101,
+    32, 108, 111, 103, 103, 101, 100, 46, 32, 32, 84, 104, 101, 32, 98, 105, 116, 115, 32, 97, 114, 101, 32, 100, 101,
+    102, 105, 110, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 32,
+    97, 114, 114, 97, 121, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 55, 51, 55, 51, 48,
+    52, 56, 52, 53, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 80, 105, 112, 101, 108, 105,
+    110, 101, 72, 97, 115, 104, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34,
+    58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54,
+    52, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 80, 105,
+    112, 101, 108, 105, 110, 101, 72, 97, 115, 104, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 83, 112, 101, 99, 105, 102, 105, 99, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 104, 97, 115,
+    104, 32, 116, 111, 32, 108, 111, 103, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51,
+    53, 55, 55, 56, 50, 52, 56, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 82, 101, 108, 97, 116, 105, 118, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104, 101,
+    114, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32,
+    108, 111, 103, 115, 32, 97, 114, 101, 32, 112, 108, 97, 99, 101, 100, 46, 32, 82, 101, 108, 97, 116, 105, 118, 101,
+    32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77, 68, 95, 68, 69,
+    66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97,
+    98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105, 115, 110, 39,
+    116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 108,
+    97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46, 32, 69, 97, 99, 104, 32, 117, 110,
+    105, 113, 117, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 105, 115, 32, 105, 110, 32, 97, 32, 115, 101,
+    112, 97, 114, 97, 116, 101, 32, 102, 105, 108, 101, 32, 119, 105, 116, 104, 105, 110, 32, 116, 104, 97, 116, 32,
+    100, 105, 114, 101, 99, 116, 111, 114, 121, 46, 32, 84, 104, 101, 32, 108, 111, 103, 32, 110, 97, 109, 101, 32, 105,
+    115, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 97, 32, 104, 97, 115, 104, 32, 111, 102, 32, 116, 104, 101, 32,
+    112, 105, 112, 101, 108, 105, 110, 101, 39, 115, 32, 99, 114, 101, 97, 116, 101, 32, 105, 110, 102, 111, 32, 97,
+    110, 100, 32, 119, 104, 105, 99, 104, 32, 115, 104, 97, 100, 101, 114, 32, 115, 116, 97, 103, 101, 115, 32, 97, 114,
+    101, 32, 97, 99, 116, 105, 118, 101, 46, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 80,
+    97, 116, 104, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 32, 34, 87, 105,
+    110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 80, 105, 112, 101, 108, 105, 110, 101, 115, 92,
+    92, 34, 44, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47,
+    34, 125, 44, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 68, 105,
+    114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105,
+    110, 101, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 49, 54, 50, 53, 56, 51, 57, 52, 54, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105,
+    112, 101, 108, 105, 110, 101, 76, 111, 103, 67, 111, 110, 102, 105, 103, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 53, 56, 55, 56, 52, 53, 56, 50, 53, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 67, 109, 100, 83, 116, 114, 101, 97, 109, 82, 101, 115, 101, 114, 118, 101, 76, 105, 109, 105, 116, 34, 44, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    50, 53, 54, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 83, 116, 114, 101, 97, 109, 82, 101,
+    115, 101, 114, 118, 101, 76, 105, 109, 105, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 83, 112, 101, 99, 105, 102, 105, 101, 115, 32, 104, 111, 119, 32, 109, 97, 110, 121, 32, 68,
+    87, 79, 82, 68, 115, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 112, 97, 99, 101, 32, 105, 115, 32,
+    114, 101, 115, 101, 114, 118, 101, 100, 32, 98, 121, 32, 82, 101, 115, 101, 114, 118, 101, 67, 111, 109, 109, 97,
+    110, 100, 115, 40, 41, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 99, 108, 97, 109, 112,
+    101, 100, 32, 98, 121, 32, 101, 97, 99, 104, 32, 67, 109, 100, 83, 116, 114, 101, 97, 109, 32, 116, 111, 32, 116,
+    104, 101, 105, 114, 32, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 39, 115, 32, 99, 104, 117, 110, 107,
+    32, 115, 105, 122, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 52, 51, 57, 49,
+    51, 54, 48, 52, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 83, 116, 114, 101, 97, 109,
+    69, 110, 97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115, 101, 114, 118, 101, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102,
+    97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 66, 117, 105,
+    108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99,
+    109, 100, 83, 116, 114, 101, 97, 109, 69, 110, 97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115,
+    101, 114, 118, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102,
+    32, 116, 114, 117, 101, 44, 32, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109,
+    32, 119, 105, 108, 108, 32, 109, 101, 109, 115, 101, 116, 32, 97, 108, 108, 32, 99, 111, 109, 109, 97, 110, 100, 32,
+    115, 112, 97, 99, 101, 32, 116, 111, 32, 67, 109, 100, 83, 116, 114, 101, 97, 109, 77, 101, 109, 115, 101, 116, 86,
+    97, 108, 117, 101, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 111, 110, 108, 121, 32, 102, 117, 110, 99,
+    116, 105, 111, 110, 32, 111, 110, 32, 100, 101, 98, 117, 103, 32, 98, 117, 105, 108, 100, 115, 46, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 50, 55, 53, 50, 49, 50, 55, 52, 125, 44, 32, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 83, 116, 114, 101, 97, 109, 77, 101, 109, 115, 101, 116, 86, 97, 108,
+    117, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102,
+    102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79,
+    110, 34, 58, 32, 123, 34, 66, 117, 105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 93, 44,
+    32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109,
+    100, 83, 116, 114, 101, 97, 109, 69, 110, 97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115, 101,
+    114, 118, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 116, 114, 117, 101, 125, 93, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 83, 116, 114, 101, 97, 109, 77, 101, 109, 115, 101, 116, 86, 97, 108,
+    117, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 67, 109,
+    100, 83, 116, 114, 101, 97, 109, 69, 110, 97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115, 101,
+    114, 118, 101, 32, 105, 115, 32, 116, 114, 117, 101, 32, 97, 108, 108, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115,
+    112, 97, 99, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 109, 101, 109, 115, 101, 116, 32, 116, 111, 32, 116, 104,
+    105, 115, 32, 118, 97, 108, 117, 101, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 111, 110, 108, 121, 32,
+    102, 117, 110, 99, 116, 105, 111, 110, 32, 111, 110, 32, 100, 101, 98, 117, 103, 32, 98, 117, 105, 108, 100, 115,
+    46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 54, 49, 52, 53, 53, 52, 52, 49, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 67, 104, 117, 110, 107, 69, 110, 97, 98,
+    108, 101, 83, 116, 97, 103, 105, 110, 103, 66, 117, 102, 102, 101, 114, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 67, 104, 117, 110, 107, 69, 110, 97, 98, 108,
+    101, 83, 116, 97, 103, 105, 110, 103, 66, 117, 102, 102, 101, 114, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 101, 97, 99, 104, 32, 99, 111, 109,
+    109, 97, 110, 100, 32, 99, 104, 117, 110, 107, 32, 119, 105, 108, 108, 32, 97, 108, 108, 111, 99, 97, 116, 101, 32,
+    97, 32, 115, 121, 115, 116, 101, 109, 32, 109, 101, 109, 111, 114, 121, 32, 115, 116, 97, 103, 105, 110, 103, 32,
+    98, 117, 102, 102, 101, 114, 46, 32, 67, 111, 109, 109, 97, 110, 100, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32,
+    115, 116, 111, 114, 101, 100, 32, 105, 110, 32, 116, 104, 105, 115, 32, 98, 117, 102, 102, 101, 114, 32, 117, 110,
+    116, 105, 108, 32, 116, 104, 101, 32, 99, 104, 117, 110, 107, 32, 105, 115, 32, 102, 105, 110, 97, 108, 105, 122,
+    101, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 57, 49, 54, 49, 54, 56, 53,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 70,
+    114, 101, 101, 79, 110, 82, 101, 115, 101, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109,
+    109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 99, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 70, 114, 101, 101, 79, 110, 82, 101, 115, 101,
+    116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114,
+    117, 101, 44, 32, 101, 97, 99, 104, 32, 99, 111, 109, 109, 97, 110, 100, 32, 97, 108, 108, 111, 99, 97, 116, 111,
+    114, 32, 119, 105, 108, 108, 32, 102, 114, 101, 101, 32, 105, 116, 115, 32, 99, 111, 109, 109, 97, 110, 100, 32, 99,
+    104, 117, 110, 107, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 32, 119, 104, 101, 110, 32, 116, 104,
+    101, 32, 99, 108, 105, 101, 110, 116, 32, 99, 97, 108, 108, 115, 32, 73, 67, 109, 100, 65, 108, 108, 111, 99, 97,
+    116, 111, 114, 58, 58, 82, 101, 115, 101, 116, 40, 41, 32, 101, 118, 101, 110, 32, 116, 104, 111, 117, 103, 104, 32,
+    116, 104, 105, 115, 32, 98, 101, 104, 97, 118, 105, 111, 114, 32, 105, 115, 32, 97, 103, 97, 105, 110, 115, 116, 32,
+    116, 104, 101, 32, 114, 117, 108, 101, 115, 32, 111, 102, 32, 116, 104, 101, 32, 68, 88, 49, 50, 32, 115, 112, 101,
+    99, 105, 102, 105, 99, 97, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    49, 52, 54, 49, 49, 54, 52, 55, 48, 54, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 68, 101, 102, 97, 117, 108,
+    116, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 108, 121, 32, 101, 110, 97, 98, 108, 101, 32, 111, 112,
+    116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 97, 112, 112,
+    32, 115, 112, 101, 99, 105, 102, 105, 101, 115, 32, 116, 104, 101, 32, 67, 77, 68, 95, 66, 85, 70, 70, 69, 82, 95,
+    79, 80, 84, 73, 77, 73, 90, 69, 95, 71, 80, 85, 95, 83, 77, 65, 76, 76, 95, 66, 65, 84, 67, 72, 32, 99, 111, 109,
+    109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 98, 117, 105, 108, 100, 32, 102, 108, 97, 103, 46, 34, 125,
+    44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 70, 111, 114, 99, 101, 69, 110, 97,
+    98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111,
+    110, 115, 32, 97, 108, 119, 97, 121, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 125, 44, 32, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 70, 111, 114, 99, 101, 68, 105, 115, 97, 98, 108, 101, 34, 44,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 70, 111, 114, 99, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 97, 108,
+    119, 97, 121, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 80, 109, 52, 79, 112, 116, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 73, 115, 69, 120, 108, 117, 115, 105,
+    118, 101, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117,
+    102, 79, 112, 116, 105, 109, 105, 122, 101, 80, 109, 52, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67,
+    111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 68, 101, 102, 97, 117, 108, 116, 69, 110, 97, 98, 108, 101, 34,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 79, 112, 116, 105, 109, 105, 122, 101, 80,
+    109, 52, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116,
+    114, 111, 108, 115, 32, 102, 105, 110, 101, 45, 103, 114, 97, 105, 110, 101, 100, 32, 111, 112, 116, 105, 109, 105,
+    122, 97, 116, 105, 111, 110, 32, 111, 102, 32, 101, 97, 99, 104, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117,
+    102, 102, 101, 114, 39, 115, 32, 80, 77, 52, 32, 115, 116, 114, 101, 97, 109, 46, 32, 67, 97, 110, 32, 105, 109,
+    112, 114, 111, 118, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 111, 102, 32, 67, 80, 45, 98,
+    111, 117, 110, 100, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 115, 32, 116, 104, 97, 116, 32, 104, 97,
+    118, 101, 32, 67, 80, 85, 32, 99, 121, 99, 108, 101, 115, 32, 116, 111, 32, 115, 112, 97, 114, 101, 46, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 49, 56, 56, 57, 53, 50, 56, 56, 125, 44, 32, 123, 34,
+    86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116,
+    114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    80, 109, 52, 79, 112, 116, 77, 111, 100, 101, 73, 109, 109, 101, 100, 105, 97, 116, 101, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87,
+    104, 101, 110, 32, 99, 111, 109, 109, 97, 110, 100, 115, 32, 97, 114, 101, 32, 119, 114, 105, 116, 116, 101, 110,
+    32, 116, 111, 32, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 39, 115, 32,
+    114, 101, 115, 101, 114, 118, 101, 32, 98, 117, 102, 102, 101, 114, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 77, 111, 100, 101, 70, 105, 110, 97, 108, 105, 122, 101, 100, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 87, 104, 101, 110, 32, 97, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 39, 115,
+    32, 99, 111, 109, 109, 97, 110, 100, 32, 99, 104, 117, 110, 107, 115, 32, 97, 114, 101, 32, 102, 105, 110, 97, 108,
+    105, 122, 101, 100, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 77,
+    111, 100, 101, 34, 44, 32, 34, 73, 115, 69, 120, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 125,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 79, 112, 116, 105, 109, 105, 122, 101, 80,
+    109, 52, 77, 111, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100,
+    32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 77, 111, 100, 101, 73, 109, 109, 101, 100,
+    105, 97, 116, 101, 34, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101,
+    116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 48, 44, 32, 49,
+    93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 79, 112, 116, 105, 109, 105, 122, 101,
+    80, 109, 52, 77, 111, 100, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102,
+    79, 112, 116, 105, 109, 105, 122, 101, 80, 109, 52, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 110, 32, 80, 77, 52, 32, 111, 112, 116, 105, 109, 105, 122,
+    97, 116, 105, 111, 110, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 116, 104, 105, 115, 32, 115, 101,
+    116, 116, 105, 110, 103, 32, 99, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 110, 32, 99, 111, 109, 109,
+    97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 115, 32, 119, 105, 108, 108, 32, 117, 115, 101, 32, 116, 104, 101,
+    32, 111, 112, 116, 105, 109, 105, 122, 101, 114, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    50, 52, 57, 48, 56, 49, 54, 54, 49, 57, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67,
+    112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 68, 101, 102, 97, 117, 108, 116, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78,
+    111, 32, 111, 118, 101, 114, 114, 105, 100, 101, 44, 32, 117, 115, 101, 32, 99, 108, 105, 101, 110, 116, 39, 115,
+    32, 112, 114, 101, 102, 101, 114, 101, 110, 99, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 79,
+    110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 80, 65, 76, 32, 116, 111, 32, 117, 115, 101, 32, 116, 104, 101,
+    32, 67, 80, 85, 32, 117, 112, 100, 97, 116, 101, 32, 112, 97, 116, 104, 32, 102, 111, 114, 32, 118, 101, 114, 116,
+    101, 120, 32, 98, 117, 102, 102, 101, 114, 44, 32, 115, 116, 114, 101, 97, 109, 45, 111, 117, 116, 32, 97, 110, 100,
+    32, 115, 112, 105, 108, 108, 32, 116, 97, 98, 108, 101, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116,
+    104, 79, 102, 102, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 80, 65, 76, 32, 116, 111, 32, 117, 115, 101, 32,
+    116, 104, 101, 32, 67, 69, 32, 82, 65, 77, 32, 112, 97, 116, 104, 32, 102, 111, 114, 32, 118, 101, 114, 116, 101,
+    120, 32, 98, 117, 102, 102, 101, 114, 44, 32, 115, 116, 114, 101, 97, 109, 45, 111, 117, 116, 32, 97, 110, 100, 32,
+    115, 112, 105, 108, 108, 32, 116, 97, 98, 108, 101, 115, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104,
+    34, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97,
+    116, 101, 80, 97, 116, 104, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100,
+    32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85,
+    112, 100, 97, 116, 101, 80, 97, 116, 104, 79, 110, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110,
+    117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66,
+    117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 34, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 108, 111, 98, 97, 108, 108, 121, 32, 111, 118,
+    101, 114, 114, 105, 100, 101, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 67, 109, 100,
+    66, 117, 102, 102, 101, 114, 66, 117, 105, 108, 100, 70, 108, 97, 103, 115, 58, 58, 117, 115, 101, 67, 112, 117, 80,
+    97, 116, 104, 70, 111, 114, 84, 97, 98, 108, 101, 85, 112, 100, 97, 116, 101, 115, 32, 112, 97, 115, 115, 101, 100,
+    32, 105, 110, 32, 98, 121, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 46, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 51, 50, 56, 50, 57, 49, 49, 50, 56, 49, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117,
+    102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 68, 101, 102, 97, 117, 108,
+    116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 78, 111, 32, 111, 118, 101, 114, 114, 105, 100, 101, 44, 32, 117, 115, 101, 32, 97, 112,
+    112, 39, 115, 32, 112, 114, 101, 102, 101, 114, 101, 110, 99, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98,
+    109, 105, 116, 79, 110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 67, 77, 68, 95, 66, 85, 70, 70, 69, 82, 95,
+    79, 78, 69, 95, 84, 73, 77, 69, 95, 83, 85, 66, 77, 73, 84, 32, 97, 108, 119, 97, 121, 115, 32, 111, 110, 46, 34,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110,
+    101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 79, 102, 102, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 67,
+    77, 68, 95, 66, 85, 70, 70, 69, 82, 95, 79, 78, 69, 95, 84, 73, 77, 69, 95, 83, 85, 66, 77, 73, 84, 32, 97, 108,
+    119, 97, 121, 115, 32, 111, 102, 102, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100,
+    66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 34, 44, 32, 34,
+    73, 115, 69, 120, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98,
+    109, 105, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117,
+    102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101,
+    83, 117, 98, 109, 105, 116, 68, 101, 102, 97, 117, 108, 116, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109,
+    100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 108, 111, 98, 97, 108, 108, 121, 32,
+    111, 118, 101, 114, 114, 105, 100, 101, 115, 32, 116, 104, 101, 32, 67, 77, 68, 95, 66, 85, 70, 70, 69, 82, 95, 79,
+    78, 69, 95, 84, 73, 77, 69, 95, 83, 85, 66, 77, 73, 84, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102,
+    101, 114, 32, 98, 117, 105, 108, 100, 105, 110, 103, 32, 102, 108, 97, 103, 46, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 57, 48, 57, 57, 51, 52, 54, 55, 54, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86,
+    97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102,
+    80, 114, 101, 101, 109, 112, 116, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111,
+    109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 119, 105, 108, 108, 32, 110, 111, 116, 32, 98,
+    101, 32, 112, 114, 101, 101, 109, 112, 116, 101, 100, 32, 98, 117, 116, 32, 111, 117, 114, 32, 113, 117, 101, 117,
+    101, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 112, 114, 101, 101, 109, 112, 116, 105, 111, 110, 46, 34, 125,
+    44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 77,
+    111, 100, 101, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102,
+    102, 101, 114, 115, 32, 109, 97, 121, 32, 98, 101, 32, 112, 114, 101, 101, 109, 112, 116, 101, 100, 32, 105, 102,
+    32, 75, 77, 68, 32, 114, 101, 112, 111, 114, 116, 115, 32, 115, 117, 112, 112, 111, 114, 116, 46, 34, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 77, 111,
+    100, 101, 70, 117, 108, 108, 68, 105, 115, 97, 98, 108, 101, 85, 110, 115, 97, 102, 101, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80,
+    65, 76, 32, 112, 114, 101, 116, 101, 110, 100, 115, 32, 75, 77, 68, 32, 100, 111, 101, 115, 110, 39, 116, 32, 115,
+    117, 112, 112, 111, 114, 116, 32, 109, 105, 100, 45, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101,
+    114, 32, 112, 114, 101, 101, 109, 112, 116, 105, 111, 110, 46, 32, 84, 104, 105, 115, 32, 99, 97, 110, 32, 104, 97,
+    110, 103, 32, 111, 114, 32, 99, 111, 114, 114, 117, 112, 116, 32, 111, 116, 104, 101, 114, 32, 100, 114, 105, 118,
+    101, 114, 115, 46, 32, 73, 116, 32, 109, 117, 115, 116, 32, 111, 110, 108, 121, 32, 98, 101, 32, 117, 115, 101, 100,
+    32, 102, 111, 114, 32, 100, 101, 98, 117, 103, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67,
+    109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 77, 111, 100, 101, 34, 125, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 105, 111, 110, 77, 111, 100, 101, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114,
+    34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 77, 111, 100, 101, 69, 110, 97, 98, 108,
+    101, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116,
+    105, 111, 110, 77, 111, 100, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 111, 32, 119, 104, 97, 116, 32, 100, 101, 103, 114, 101, 101,
+    32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 115, 117, 112, 112, 111, 114, 116,
+    32, 109, 105, 100, 45, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 112, 114, 101, 101,
+    109, 112, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 52, 48,
+    53, 50, 55, 50, 48, 56, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 80, 65, 76, 32, 119, 105, 108, 108, 32, 100, 117, 109, 112, 32, 67, 69, 32, 82, 65, 77, 32, 117, 115,
+    105, 110, 103, 32, 97, 32, 112, 111, 115, 116, 97, 109, 98, 108, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115,
+    116, 114, 101, 97, 109, 32, 119, 104, 101, 110, 101, 118, 101, 114, 32, 101, 105, 116, 104, 101, 114, 32, 77, 67,
+    66, 80, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 111, 114, 32, 116, 104, 101, 32, 99, 108, 105, 101,
+    110, 116, 32, 101, 110, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 39, 112, 101, 114, 115, 105, 115, 116, 101,
+    110, 116, 32, 67, 69, 32, 82, 65, 77, 39, 32, 102, 101, 97, 116, 117, 114, 101, 46, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 80, 65, 76, 32, 119, 105, 108, 108, 32, 100, 117, 109, 112, 32, 67, 69, 32, 82, 65, 77, 32, 117,
+    115, 105, 110, 103, 32, 97, 32, 112, 111, 115, 116, 97, 109, 98, 108, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32,
+    115, 116, 114, 101, 97, 109, 32, 119, 104, 101, 110, 101, 118, 101, 114, 32, 116, 104, 101, 32, 99, 108, 105, 101,
+    110, 116, 32, 101, 110, 97, 98, 108, 101, 115, 32, 80, 65, 76, 39, 115, 32, 39, 112, 101, 114, 115, 105, 115, 116,
+    101, 110, 116, 32, 67, 69, 32, 82, 65, 77, 39, 32, 102, 101, 97, 116, 117, 114, 101, 46, 32, 40, 84, 121, 112, 105,
+    99, 97, 108, 108, 121, 32, 111, 110, 108, 121, 32, 68, 88, 57, 80, 32, 119, 105, 108, 108, 32, 100, 111, 32, 116,
+    104, 105, 115, 41, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 102, 97, 108, 115, 101, 125, 93, 125, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101, 114, 70, 111,
+    114, 99, 101, 67, 101, 82, 97, 109, 68, 117, 109, 112, 73, 110, 80, 111, 115, 116, 97, 109, 98, 108, 101, 34, 44,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 111, 109, 109, 97, 110, 100, 66, 117, 102,
+    102, 101, 114, 70, 111, 114, 99, 101, 67, 101, 82, 97, 109, 68, 117, 109, 112, 73, 110, 80, 111, 115, 116, 97, 109,
+    98, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 111, 103,
+    103, 108, 101, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 111, 114, 32, 110, 111, 116, 32, 80, 65, 76, 32, 115,
+    104, 111, 117, 108, 100, 32, 97, 100, 100, 32, 97, 32, 112, 111, 115, 116, 97, 109, 98, 108, 101, 32, 116, 111, 32,
+    117, 110, 105, 118, 101, 114, 115, 97, 108, 32, 81, 117, 101, 117, 101, 32, 115, 117, 98, 109, 105, 115, 115, 105,
+    111, 110, 115, 32, 116, 111, 32, 100, 117, 109, 112, 32, 67, 69, 32, 82, 65, 77, 32, 119, 104, 101, 110, 101, 118,
+    101, 114, 32, 77, 67, 66, 80, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 49, 51, 57, 49, 49, 55, 56, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101, 114, 67, 111, 109, 98, 105, 110, 101, 68,
+    101, 80, 114, 101, 97, 109, 98, 108, 101, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109,
+    109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 99, 111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101, 114, 67, 111, 109, 98, 105, 110, 101, 68, 101,
+    80, 114, 101, 97, 109, 98, 108, 101, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 67, 111, 109, 98, 105, 110, 101, 115, 32, 116, 104, 101, 32, 68, 69, 32, 112, 101, 114, 45, 115, 117,
+    98, 109, 105, 116, 32, 97, 110, 100, 32, 112, 101, 114, 45, 99, 111, 110, 116, 101, 120, 116, 32, 112, 114, 101, 97,
+    109, 98, 108, 101, 115, 32, 105, 110, 116, 111, 32, 111, 110, 101, 32, 112, 101, 114, 45, 115, 117, 98, 109, 105,
+    116, 32, 112, 114, 101, 97, 109, 98, 108, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    49, 52, 56, 52, 49, 50, 51, 49, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117,
+    102, 83, 112, 105, 108, 108, 84, 97, 98, 108, 101, 67, 97, 99, 104, 101, 83, 105, 122, 101, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 56, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 83, 112, 105, 108, 108, 84, 97, 98, 108,
+    101, 67, 97, 99, 104, 101, 83, 105, 122, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 114, 101, 99, 101, 110, 116, 108, 121, 32, 117, 112,
+    108, 111, 97, 100, 101, 100, 32, 117, 115, 101, 114, 45, 100, 97, 116, 97, 32, 115, 112, 105, 108, 108, 32, 116, 97,
+    98, 108, 101, 115, 32, 101, 97, 99, 104, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32,
+    114, 101, 109, 101, 109, 98, 101, 114, 115, 32, 119, 104, 101, 110, 32, 115, 112, 105, 108, 108, 32, 116, 97, 98,
+    108, 101, 115, 32, 97, 114, 101, 32, 109, 97, 110, 97, 103, 101, 100, 32, 119, 105, 116, 104, 32, 67, 80, 85, 32,
+    117, 112, 100, 97, 116, 101, 115, 32, 116, 111, 32, 101, 109, 98, 101, 100, 100, 101, 100, 32, 100, 97, 116, 97, 46,
+    32, 65, 32, 115, 112, 105, 108, 108, 32, 116, 97, 98, 108, 101, 32, 119, 104, 111, 115, 101, 32, 99, 111, 110, 116,
+    101, 110, 116, 115, 32, 109, 97, 116, 99, 104, 32, 111, 110, 101, 32, 111, 102, 32, 116, 104, 101, 109, 32, 114,
+    101, 117, 115, 101, 115, 32, 116, 104, 101, 32, 101, 97, 114, 108, 105, 101, 114, 32, 99, 111, 112, 121, 32, 105,
+    110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 117, 112, 108, 111, 97, 100, 105, 110, 103, 32, 105, 116, 32, 97,
+    103, 97, 105, 110, 46, 32, 48, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 114, 101, 117, 115,
+    101, 46, 32, 86, 97, 108, 117, 101, 115, 32, 97, 114, 101, 32, 99, 108, 97, 109, 112, 101, 100, 32, 116, 111, 32,
+    54, 52, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 53, 50, 50, 48, 51, 50, 52, 53,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 85, 116, 105, 108, 86, 101, 114, 105, 102,
+    121, 83, 104, 97, 100, 111, 119, 101, 100, 82, 101, 103, 82, 97, 110, 103, 101, 115, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117,
+    101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 66, 117, 105, 108, 100, 84,
+    121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 44, 32, 34, 100, 101, 118, 34, 93, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 99, 109, 100, 85, 116, 105, 108, 86, 101, 114, 105, 102, 121, 83, 104, 97, 100, 111, 119, 101, 100,
+    82, 101, 103, 82, 97, 110, 103, 101, 115, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 80, 65, 76, 32, 119, 105, 108, 108, 32, 118, 101, 114, 105,
+    102, 121, 32, 116, 104, 97, 116, 32, 97, 108, 108, 32, 114, 101, 103, 105, 115, 116, 101, 114, 32, 119, 114, 105,
+    116, 101, 115, 32, 105, 110, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 97, 114,
+    101, 32, 112, 114, 111, 112, 101, 114, 108, 121, 32, 115, 104, 97, 100, 111, 119, 101, 100, 32, 119, 104, 101, 110,
+    32, 109, 105, 100, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 112, 114, 101, 101,
+    109, 112, 116, 105, 111, 110, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 32, 84, 104, 105, 115, 32, 99,
+    97, 110, 32, 104, 97, 118, 101, 32, 97, 32, 110, 111, 116, 105, 99, 97, 98, 108, 101, 32, 105, 109, 112, 97, 99,
+    116, 32, 111, 110, 32, 67, 80, 85, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 46, 32, 84, 104, 105,
+    115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 105, 103, 110, 111, 114, 101, 100, 32, 105, 110, 32,
+    114, 101, 108, 101, 97, 115, 101, 32, 98, 117, 105, 108, 100, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 51, 56, 57, 48, 55, 48, 52, 48, 52, 53, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 65, 76, 32, 119, 105, 108, 108, 32, 101, 110,
+    97, 98, 108, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 119, 104, 101, 110, 32,
+    103, 101, 110, 101, 114, 97, 108, 108, 121, 32, 101, 102, 102, 105, 99, 105, 101, 110, 116, 46, 34, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115,
+    97, 98, 108, 101, 32, 97, 108, 108, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 116,
+    104, 97, 116, 32, 99, 111, 117, 108, 100, 32, 98, 101, 32, 100, 101, 116, 114, 105, 109, 101, 110, 116, 97, 108, 32,
+    105, 110, 32, 115, 112, 101, 99, 105, 97, 108, 32, 99, 97, 115, 101, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 77, 105, 110, 75, 101, 114, 110, 101, 108, 83, 117, 98, 109, 105, 116, 115, 34, 44, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    77, 105, 110, 105, 109, 105, 122, 101, 32, 116, 104, 101, 32, 111, 118, 101, 114, 104, 101, 97, 100, 32, 111, 102,
+    32, 108, 97, 117, 110, 99, 104, 105, 110, 103, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114,
+    115, 32, 111, 110, 32, 116, 104, 101, 32, 67, 80, 85, 32, 97, 110, 100, 32, 71, 80, 85, 46, 34, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 105, 110, 71, 112, 117, 67, 109, 100, 79, 118, 101, 114, 104, 101, 97,
+    100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 77, 105, 110, 105, 109, 105, 122, 101, 32, 116, 104, 101, 32, 111, 118, 101, 114, 104,
+    101, 97, 100, 32, 111, 102, 32, 114, 101, 97, 100, 105, 110, 103, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117,
+    102, 102, 101, 114, 32, 99, 111, 109, 109, 97, 110, 100, 115, 32, 111, 110, 32, 116, 104, 101, 32, 71, 80, 85, 46,
+    34, 125, 93, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111,
+    100, 101, 79, 118, 101, 114, 114, 105, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109,
+    109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 115, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 79, 118, 101, 114, 114, 105, 100, 101, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 110, 111, 110, 45, 122, 101,
+    114, 111, 44, 32, 105, 116, 32, 102, 111, 114, 99, 101, 115, 32, 97, 108, 108, 32, 83, 117, 98, 109, 105, 116, 79,
+    112, 116, 77, 111, 100, 101, 115, 32, 116, 111, 32, 97, 32, 115, 112, 101, 99, 105, 102, 105, 99, 32, 118, 97, 108,
+    117, 101, 46, 32, 48, 58, 32, 78, 111, 32, 79, 118, 101, 114, 114, 105, 100, 101, 32, 49, 58, 32, 83, 117, 98, 109,
+    105, 116, 79, 112, 116, 77, 111, 100, 101, 58, 58, 68, 101, 102, 97, 117, 108, 116, 32, 50, 58, 32, 83, 117, 98,
+    109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 58, 58, 68, 105, 115, 97, 98, 108, 101, 100, 32, 51, 58, 32, 83,
+    117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 58, 58, 77, 105, 110, 75, 101, 114, 110, 101, 108, 83, 117,
+    98, 109, 105, 116, 115, 32, 52, 58, 32, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 58, 58, 77,
+    105, 110, 71, 112, 117, 67, 109, 100, 79, 118, 101, 114, 104, 101, 97, 100, 32, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 51, 48, 53, 52, 56, 49, 48, 54, 48, 57, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83,
+    119, 105, 122, 122, 108, 101, 78, 111, 110, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 116, 105,
+    108, 101, 32, 115, 119, 105, 122, 122, 108, 101, 32, 102, 111, 114, 32, 97, 108, 108, 32, 115, 117, 114, 102, 97,
+    99, 101, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122,
+    122, 108, 101, 67, 111, 108, 111, 114, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 116, 105, 108, 101, 32,
+    115, 119, 105, 122, 122, 108, 101, 32, 102, 111, 114, 32, 114, 101, 110, 100, 101, 114, 97, 98, 108, 101, 32, 99,
+    111, 108, 111, 114, 32, 116, 97, 114, 103, 101, 116, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 68, 101, 112, 116, 104, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110,
+    97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101, 32, 102, 111, 114, 32, 114, 101,
+    110, 100, 101, 114, 97, 98, 108, 101, 32, 100, 101, 112, 116, 104, 45, 115, 116, 101, 110, 99, 105, 108, 32, 116,
+    97, 114, 103, 101, 116, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83,
+    119, 105, 122, 122, 108, 101, 83, 104, 97, 100, 101, 114, 82, 101, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108,
+    101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101, 32, 102, 111, 114, 32, 115, 104, 97, 100, 101,
+    114, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 65, 108, 108, 66, 105, 116, 115, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 55, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110,
+    97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101, 32, 102, 111, 114, 32, 97, 108,
+    108, 32, 115, 117, 114, 102, 97, 99, 101, 115, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84,
+    105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 66, 105, 116, 115, 34, 125, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 77, 111, 100, 101, 34, 44, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 93, 44, 32,
+    34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 55, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 77, 111, 100, 101,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115,
+    107, 32, 119, 104, 105, 99, 104, 32, 101, 110, 97, 98, 108, 101, 115, 32, 98, 97, 110, 107, 32, 38, 32, 112, 105,
+    112, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 105, 110, 103, 32, 102, 111, 114, 32, 115, 117,
+    114, 102, 97, 99, 101, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 52, 54, 56,
+    55, 55, 48, 49, 48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 86, 105, 100,
+    77, 109, 71, 112, 117, 86, 97, 77, 97, 112, 112, 105, 110, 103, 86, 97, 108, 105, 100, 97, 116, 105, 111, 110, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105,
+    110, 103, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58,
+    32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 87, 105, 110, 56, 34, 44, 32, 34, 87, 105, 110, 49, 48, 34, 93, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101, 86, 105, 100, 77, 109, 71, 112, 117, 86, 97, 77, 97,
+    112, 112, 105, 110, 103, 86, 97, 108, 105, 100, 97, 116, 105, 111, 110, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 32, 87, 68, 68, 77, 50, 32, 112, 108, 97, 116, 102, 111, 114, 109,
+    115, 44, 32, 80, 65, 76, 32, 105, 115, 32, 97, 98, 108, 101, 32, 116, 111, 32, 115, 101, 110, 100, 32, 97, 32, 115,
+    101, 116, 32, 111, 102, 32, 102, 108, 97, 103, 115, 32, 116, 104, 114, 111, 117, 103, 104, 32, 116, 111, 32, 116,
+    104, 101, 32, 107, 101, 114, 110, 101, 108, 32, 119, 104, 105, 99, 104, 32, 99, 97, 110, 32, 99, 111, 110, 116, 114,
+    111, 108, 32, 104, 111, 119, 32, 116, 104, 101, 32, 75, 77, 68, 32, 104, 97, 110, 100, 108, 101, 115, 32, 101, 97,
+    99, 104, 32, 71, 80, 85, 32, 86, 65, 32, 109, 97, 112, 112, 105, 110, 103, 32, 119, 104, 101, 110, 32, 114, 101,
+    115, 101, 114, 118, 105, 110, 103, 32, 86, 65, 32, 115, 112, 97, 99, 101, 44, 32, 109, 97, 112, 112, 105, 110, 103,
+    32, 86, 65, 32, 115, 112, 97, 99, 101, 32, 111, 114, 32, 117, 112, 100, 97, 116, 105, 110, 103, 32, 116, 104, 101,
+    32, 71, 80, 85, 32, 112, 97, 103, 101, 32, 109, 97, 112, 112, 105, 110, 103, 115, 46, 32, 73, 102, 32, 116, 104,
+    105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 116, 114, 117, 101, 32, 116, 104, 101, 110, 32,
+    80, 65, 76, 32, 119, 105, 108, 108, 32, 114, 101, 113, 117, 101, 115, 116, 32, 116, 104, 97, 116, 32, 101, 120, 116,
+    114, 97, 32, 118, 97, 108, 105, 100, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 101, 114, 102, 111, 114, 109,
+    101, 100, 32, 116, 111, 32, 101, 110, 115, 117, 114, 101, 32, 116, 104, 97, 116, 32, 101, 118, 101, 114, 121, 32,
+    71, 80, 85, 32, 118, 105, 114, 116, 117, 97, 108, 32, 97, 100, 100, 114, 101, 115, 115, 32, 109, 97, 112, 112, 105,
+    110, 103, 32, 116, 111, 32, 97, 32, 115, 112, 101, 99, 105, 102, 105, 99, 32, 112, 104, 121, 115, 105, 99, 97, 108,
+    32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 115, 112, 101, 99, 105, 102, 105, 101, 115, 32, 97, 32, 109,
+    97, 116, 99, 104, 105, 110, 103, 32, 115, 101, 116, 32, 111, 102, 32, 116, 104, 101, 115, 101, 32, 75, 77, 68, 32,
+    102, 108, 97, 103, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 53, 49, 55, 56,
+    53, 48, 53, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 85, 115, 119, 99,
+    72, 101, 97, 112, 65, 108, 108, 65, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34,
+    58, 32, 91, 34, 87, 105, 110, 49, 48, 34, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101,
+    85, 115, 119, 99, 72, 101, 97, 112, 65, 108, 108, 65, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32,
+    116, 104, 101, 110, 32, 116, 104, 105, 115, 32, 99, 104, 97, 110, 103, 101, 32, 99, 97, 117, 115, 101, 115, 32, 80,
+    65, 76, 32, 116, 111, 32, 97, 117, 116, 111, 109, 97, 116, 105, 99, 97, 108, 108, 121, 32, 99, 111, 110, 115, 105,
+    100, 101, 114, 32, 71, 65, 82, 84, 32, 116, 111, 32, 98, 101, 32, 97, 32, 118, 97, 108, 105, 100, 32, 104, 101, 97,
+    112, 32, 102, 111, 114, 32, 109, 97, 110, 121, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 48, 56, 51, 51, 51, 49, 54, 52, 125, 44, 32, 123,
+    34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32,
+    116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 78, 111, 110, 101, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65,
+    100, 100, 114, 108, 105, 98, 32, 115, 101, 108, 101, 99, 116, 115, 32, 105, 116, 115, 32, 111, 119, 110, 32, 100,
+    101, 102, 97, 117, 108, 116, 32, 115, 119, 105, 122, 122, 108, 101, 32, 115, 101, 116, 44, 32, 116, 104, 105, 115,
+    32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 80, 65, 76, 39, 115, 32, 112, 101, 114, 102, 32, 116, 117, 110, 105,
+    110, 103, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102,
+    101, 114, 114, 101, 100, 83, 87, 95, 90, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 101, 102, 101, 114, 32, 90, 79, 114, 100, 101,
+    114, 32, 115, 119, 105, 122, 122, 108, 101, 32, 40, 65, 68, 68, 82, 95, 83, 87, 95, 90, 41, 46, 34, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83,
+    87, 95, 83, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 80, 114, 101, 102, 101, 114, 32, 83, 116, 97, 110, 100, 97, 114, 100, 32, 115, 119,
+    105, 122, 122, 108, 101, 32, 40, 65, 68, 68, 82, 95, 83, 87, 95, 83, 41, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 87, 95, 68, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 80, 114, 101, 102, 101, 114, 32, 68, 105, 115, 112, 108, 97, 121, 32, 115, 119, 105, 122, 122, 108, 101, 32,
+    40, 65, 68, 68, 82, 95, 83, 87, 95, 68, 41, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100,
+    100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 87, 95, 82, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 56, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 101, 102, 101,
+    114, 32, 82, 111, 116, 97, 116, 101, 100, 32, 115, 119, 105, 122, 122, 108, 101, 32, 40, 65, 68, 68, 82, 95, 83, 87,
+    95, 82, 41, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101,
+    102, 101, 114, 114, 101, 100, 68, 101, 102, 97, 117, 108, 116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    49, 53, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 101, 102, 101,
+    114, 32, 97, 108, 108, 32, 115, 119, 105, 122, 122, 108, 101, 32, 109, 111, 100, 101, 115, 44, 32, 80, 65, 76, 32,
+    119, 105, 108, 108, 32, 115, 101, 108, 101, 99, 116, 105, 118, 101, 108, 121, 32, 100, 105, 115, 97, 98, 108, 101,
+    32, 115, 111, 109, 101, 32, 109, 111, 100, 101, 115, 32, 102, 111, 114, 32, 112, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101,
+    102, 101, 114, 114, 101, 100, 83, 119, 105, 122, 122, 108, 101, 84, 121, 112, 101, 83, 101, 116, 34, 125, 44, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 119,
+    105, 122, 122, 108, 101, 84, 121, 112, 101, 83, 101, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 82,
+    101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 93, 44, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 66, 105, 116,
+    109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114,
+    114, 101, 100, 68, 101, 102, 97, 117, 108, 116, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117,
+    109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 100, 100, 114, 50,
+    80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 119, 105, 122, 122, 108, 101, 84, 121, 112, 101, 83, 101, 116, 34,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 65, 76, 39, 115, 32, 100, 101,
+    102, 97, 117, 108, 116, 32, 115, 119, 105, 122, 122, 108, 101, 32, 116, 121, 112, 101, 32, 115, 101, 116, 32, 119,
+    104, 101, 110, 32, 117, 115, 105, 110, 103, 32, 65, 100, 100, 114, 76, 105, 98, 50, 46, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 51, 54, 53, 53, 55, 49, 54, 55, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 80, 114, 101, 102, 101, 116, 99, 104, 69, 110, 97, 98, 108,
+    101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 32,
+    40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105, 110, 103, 41, 34, 93, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101, 80, 114, 101, 102, 101, 116, 99, 104, 69,
+    110, 97, 98, 108, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102,
+    32, 116, 114, 117, 101, 44, 32, 97, 116, 116, 101, 109, 112, 116, 32, 116, 111, 32, 112, 114, 101, 102, 101, 116,
+    99, 104, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 115, 104, 97, 100, 101, 114, 32, 99, 111, 100, 101, 32, 97,
+    110, 100, 32, 100, 97, 116, 97, 32, 105, 110, 116, 111, 32, 76, 50, 32, 98, 101, 102, 111, 114, 101, 32, 101, 120,
+    101, 99, 117, 116, 105, 110, 103, 32, 116, 104, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 46, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 48, 48, 57, 56, 53, 57, 50, 51, 125, 44, 32, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 80, 114, 101, 102, 101, 116, 99, 104, 67, 108, 97, 109,
+    112, 83, 105, 122, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 101, 102, 101, 116, 99, 104,
+    105, 110, 103, 32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105, 110, 103, 41, 34, 93, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 104, 97, 100, 101, 114, 80, 114, 101, 102, 101, 116, 99, 104, 67,
+    108, 97, 109, 112, 83, 105, 122, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 87, 104, 101, 110, 32, 116, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 110,
+    111, 110, 45, 122, 101, 114, 111, 44, 32, 99, 108, 97, 109, 112, 32, 115, 104, 97, 100, 101, 114, 32, 112, 114, 101,
+    102, 101, 116, 99, 104, 105, 110, 103, 32, 116, 111, 32, 116, 104, 105, 115, 32, 109, 97, 110, 121, 32, 98, 121,
+    116, 101, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 48, 54, 50, 57, 48, 48,
+    51, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 65, 118, 97, 105, 108, 97, 98, 108,
+    101, 83, 103, 112, 114, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 83, 104, 97, 100, 101, 114, 32, 79,
+    112, 116, 105, 111, 110, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116,
+    51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 65, 118,
+    97, 105, 108, 97, 98, 108, 101, 83, 103, 112, 114, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 65, 114, 116, 105, 102, 105, 99, 105, 97, 108, 108, 121, 32, 108, 105, 109, 105, 116, 115, 32,
+    116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 83, 71, 80,
+    82, 115, 32, 97, 118, 97, 105, 108, 97, 98, 108, 101, 32, 102, 111, 114, 32, 115, 104, 97, 100, 101, 114, 32, 99,
+    111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 46, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 122, 101,
+    114, 111, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 108, 105, 109, 105, 116, 32, 97, 110,
+    100, 32, 72, 87, 32, 100, 101, 102, 97, 117, 108, 116, 115, 32, 97, 114, 101, 32, 117, 115, 101, 100, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 48, 56, 52, 51, 57, 55, 55, 54, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 65, 118, 97, 105, 108, 97, 98, 108, 101, 86, 103, 112, 114, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 83, 104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115,
+    34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 65, 118, 97, 105, 108, 97, 98, 108, 101,
+    86, 103, 112, 114, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 114,
+    116, 105, 102, 105, 99, 105, 97, 108, 108, 121, 32, 108, 105, 109, 105, 116, 115, 32, 116, 104, 101, 32, 109, 97,
+    120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 86, 71, 80, 82, 115, 32, 97, 118, 97,
+    105, 108, 97, 98, 108, 101, 32, 102, 111, 114, 32, 115, 104, 97, 100, 101, 114, 32, 99, 111, 109, 112, 105, 108, 97,
+    116, 105, 111, 110, 46, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 122, 101, 114, 111, 32, 100, 105, 115,
+    97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 108, 105, 109, 105, 116, 32, 97, 110, 100, 32, 72, 87, 32, 100, 101,
+    102, 97, 117, 108, 116, 115, 32, 97, 114, 101, 32, 117, 115, 101, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 49, 49, 54, 53, 52, 54, 51, 48, 53, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 77, 97, 120, 84, 104, 114, 101, 97, 100, 71, 114, 111, 117, 112, 115, 80, 101, 114, 67, 111, 109, 112, 117, 116,
+    101, 85, 110, 105, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 83, 104, 97, 100, 101, 114, 32, 79,
+    112, 116, 105, 111, 110, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116,
+    51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 84, 104,
+    114, 101, 97, 100, 71, 114, 111, 117, 112, 115, 80, 101, 114, 67, 111, 109, 112, 117, 116, 101, 85, 110, 105, 116,
+    34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111,
+    108, 115, 32, 104, 111, 119, 32, 109, 97, 110, 121, 32, 67, 83, 32, 116, 104, 114, 101, 97, 100, 45, 103, 114, 111,
+    117, 112, 115, 32, 97, 114, 101, 32, 97, 108, 108, 111, 119, 101, 100, 32, 116, 111, 32, 108, 97, 117, 110, 99, 104,
+    32, 112, 101, 114, 32, 99, 111, 109, 112, 117, 116, 101, 32, 117, 110, 105, 116, 46, 32, 32, 84, 104, 105, 115, 32,
+    116, 104, 114, 111, 116, 116, 108, 101, 115, 32, 116, 104, 101, 32, 115, 104, 97, 100, 101, 114, 44, 32, 119, 104,
+    105, 99, 104, 32, 99, 97, 110, 32, 115, 111, 109, 101, 116, 105, 109, 101, 115, 32, 101, 110, 97, 98, 108, 101, 32,
+    109, 111, 114, 101, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 115, 104, 97, 100, 101, 114, 32, 119, 111, 114,
+    107, 32, 116, 111, 32, 99, 111, 109, 112, 108, 101, 116, 101, 32, 105, 110, 32, 112, 97, 114, 97, 108, 108, 101,
+    108, 46, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 122, 101, 114, 111, 32, 100, 105, 115, 97, 98, 108,
+    101, 115, 32, 108, 105, 109, 105, 116, 105, 110, 103, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111,
+    102, 32, 116, 104, 114, 101, 97, 100, 45, 103, 114, 111, 117, 112, 115, 32, 116, 111, 32, 108, 97, 117, 110, 99,
+    104, 46, 32, 32, 84, 104, 105, 115, 32, 102, 105, 101, 108, 100, 32, 105, 115, 32, 32, 105, 103, 110, 111, 114, 101,
+    100, 32, 102, 111, 114, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 115, 104, 97, 100, 101, 114, 115, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 56, 52, 53, 49, 55, 57, 57, 57, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 83, 99, 114, 97, 116, 99, 104, 82, 105, 110, 103, 83, 105, 122,
+    101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 83, 99, 114, 97, 116, 99, 104, 34, 44, 32, 34, 80, 101,
+    114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 50, 54, 56, 52, 51, 53, 52, 53, 54, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 103, 112, 117, 115, 105, 122, 101, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 83, 99, 114, 97, 116, 99, 104, 82, 105, 110, 103, 83, 105, 122, 101, 34,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108,
+    115, 32, 116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 115, 105, 122, 101, 32, 111, 102, 32, 116, 104,
+    101, 32, 115, 99, 114, 97, 116, 99, 104, 32, 114, 105, 110, 103, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110,
+    46, 32, 73, 102, 32, 116, 104, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 32, 114, 101, 113, 117,
+    101, 115, 116, 115, 32, 109, 111, 114, 101, 32, 115, 99, 114, 97, 116, 99, 104, 32, 109, 101, 109, 111, 114, 121,
+    32, 116, 104, 97, 110, 32, 116, 104, 105, 115, 44, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 119,
+    105, 108, 108, 32, 108, 105, 109, 105, 116, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32,
+    119, 97, 118, 101, 115, 32, 105, 110, 32, 102, 108, 105, 103, 104, 116, 32, 116, 111, 32, 99, 111, 109, 112, 108,
+    121, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 109, 101, 109, 111, 114, 121, 32, 114, 101, 115, 116, 114, 105,
+    99, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 55, 56, 52, 53, 50, 56,
+    55, 53, 56, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 102, 104, 71, 112, 117, 77, 97, 115, 107,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 77, 71, 80, 85, 34, 44, 32, 34, 71, 101, 110, 101, 114, 97,
+    108, 34, 44, 32, 34, 68, 101, 98, 117, 103, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115,
+    72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 53, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79,
+    110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 48, 93, 44, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101,
+    114, 84, 104, 97, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 34, 125,
+    93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 102, 104, 71, 112, 117, 77, 97, 115, 107, 34, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 115, 107, 32, 111, 102, 32, 116,
+    104, 101, 32, 71, 80, 85, 115, 32, 116, 111, 32, 104, 97, 118, 101, 32, 97, 108, 108, 32, 115, 117, 98, 109, 105,
+    116, 115, 32, 100, 114, 111, 112, 112, 101, 100, 46, 32, 83, 101, 101, 32, 73, 70, 72, 32, 115, 101, 116, 116, 105,
+    110, 103, 32, 102, 111, 114, 32, 73, 70, 72, 32, 109, 111, 100, 101, 32, 116, 104, 97, 116, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 97, 112, 112, 108, 105, 101, 100, 46, 32, 73, 102, 32, 116, 104, 101, 32, 98, 105, 116, 32, 105,
+    115, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 71, 80, 85, 32, 119, 105, 108, 108, 32, 104, 97, 118, 101, 32,
+    105, 116, 115, 32, 115, 117, 98, 109, 105, 116, 115, 32, 100, 114, 111, 112, 112, 101, 100, 46, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 49, 55, 54, 50, 54, 54, 54, 52, 125, 44, 32, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 72, 119, 67, 111, 109, 112, 111, 115, 105, 116, 105, 110, 103, 69, 110, 97, 98, 108, 101,
+    100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 77, 71, 80, 85, 34, 93, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 104, 119, 67, 111, 109, 112, 111, 115, 105, 116, 105, 110, 103, 69, 110, 97, 98,
+    108, 101, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98,
+    108, 101, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111, 114, 32, 116, 104, 101, 32, 72, 87, 32, 99, 111,
+    109, 112, 111, 115, 105, 116, 111, 114, 32, 40, 99, 114, 111, 115, 115, 68, 105, 115, 112, 108, 97, 121, 80, 114,
+    101, 115, 101, 110, 116, 41, 32, 105, 102, 32, 116, 104, 101, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 115,
+    117, 112, 112, 111, 114, 116, 115, 32, 72, 87, 32, 99, 111, 109, 112, 111, 115, 105, 116, 105, 110, 103, 46, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 55, 50, 49, 54, 57, 55, 49, 55, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 103, 112, 117, 67, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116,
+    121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 77, 71, 80, 85, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 103, 112, 117, 67, 111, 109, 112, 97, 116, 105,
+    98, 105, 108, 105, 116, 121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111,
+    114, 32, 77, 71, 80, 85, 32, 105, 110, 32, 80, 65, 76, 46, 32, 73, 102, 32, 77, 71, 80, 85, 32, 67, 111, 109, 112,
+    97, 116, 105, 98, 105, 108, 105, 116, 121, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 44, 32, 97, 108,
+    108, 32, 71, 80, 85, 115, 32, 119, 105, 108, 108, 32, 115, 116, 105, 108, 108, 32, 98, 101, 32, 101, 120, 112, 111,
+    115, 101, 100, 32, 116, 111, 32, 116, 104, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 44, 32, 98,
+    117, 116, 32, 110, 111, 32, 77, 71, 80, 85, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 99, 111, 109, 112, 97,
+    116, 105, 98, 105, 108, 105, 116, 121, 32, 102, 108, 97, 103, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 114,
+    101, 116, 117, 114, 110, 101, 100, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 55,
+    55, 57, 51, 55, 50, 57, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 101, 101, 114, 77, 101, 109,
+    111, 114, 121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 77, 71, 80, 85,
+    34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 101, 101, 114, 77, 101, 109, 111, 114, 121,
+    69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    69, 110, 97, 98, 108, 101, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111, 114, 32, 112, 101, 101, 114,
+    32, 109, 101, 109, 111, 114, 121, 32, 97, 110, 100, 32, 112, 101, 101, 114, 32, 109, 101, 109, 111, 114, 121, 32,
+    116, 114, 97, 110, 115, 102, 101, 114, 115, 32, 105, 102, 32, 116, 104, 101, 32, 104, 97, 114, 100, 119, 97, 114,
+    101, 32, 105, 115, 32, 99, 97, 112, 97, 98, 108, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 50, 53, 57, 51, 54, 50, 53, 49, 49, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114,
+    99, 101, 80, 114, 101, 115, 101, 110, 116, 86, 105, 97, 71, 100, 105, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 87, 83, 73, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34,
+    58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 87, 105, 110, 100, 111, 119, 115, 34, 93, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 102, 111, 114, 99, 101, 80, 114, 101, 115, 101, 110, 116, 86, 105, 97, 71, 100, 105, 34, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32,
+    112, 114, 101, 115, 101, 110, 116, 32, 116, 101, 99, 104, 110, 105, 113, 117, 101, 32, 116, 111, 32, 117, 115, 101,
+    32, 116, 104, 101, 32, 71, 68, 73, 32, 66, 76, 84, 32, 112, 97, 116, 104, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 50, 54, 48, 55, 56, 55, 49, 54, 53, 51, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 80, 114, 101, 115, 101, 110, 116, 86, 105, 97, 79, 103, 108, 82, 117, 110, 116, 105, 109, 101, 34, 44, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 87, 83, 73, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 112,
+    101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 79, 83, 34, 58, 32, 91, 34, 87, 105, 110, 100, 111, 119, 115, 34,
+    93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 101, 115, 101, 110, 116, 86, 105, 97, 79, 103, 108, 82, 117,
+    110, 116, 105, 109, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87,
+    104, 101, 110, 32, 116, 114, 117, 101, 32, 119, 105, 110, 100, 111, 119, 32, 109, 111, 100, 101, 32, 112, 114, 101,
+    115, 101, 110, 116, 32, 112, 97, 116, 104, 32, 119, 105, 108, 108, 32, 103, 111, 32, 116, 104, 114, 111, 117, 103,
+    104, 32, 79, 112, 101, 110, 71, 76, 32, 114, 117, 110, 116, 105, 109, 101, 46, 32, 87, 104, 101, 110, 32, 102, 97,
+    108, 115, 101, 32, 119, 105, 110, 100, 111, 119, 32, 109, 111, 100, 101, 32, 112, 114, 101, 115, 101, 110, 116, 32,
+    112, 97, 116, 104, 32, 115, 116, 105, 108, 108, 32, 103, 111, 32, 108, 101, 103, 97, 99, 121, 32, 68, 87, 77, 32,
+    65, 80, 73, 32, 112, 97, 116, 104, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 54,
+    54, 51, 54, 51, 55, 55, 48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 112, 109, 76, 97, 122, 121,
+    80, 105, 112, 101, 108, 105, 110, 101, 67, 114, 101, 97, 116, 105, 111, 110, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 114, 112, 109, 76, 97, 122, 121, 80, 105, 112, 101, 108, 105, 110, 101, 67, 114, 101, 97,
+    116, 105, 111, 110, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104,
+    101, 110, 32, 116, 114, 117, 101, 44, 32, 101, 97, 99, 104, 32, 105, 110, 116, 101, 114, 110, 97, 108, 32, 82, 115,
+    114, 99, 80, 114, 111, 99, 77, 103, 114, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 105, 115, 32, 99, 114, 101,
+    97, 116, 101, 100, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 32, 116, 105, 109, 101, 32, 105, 116, 32, 105,
+    115, 32, 117, 115, 101, 100, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 99, 114, 101, 97, 116, 105,
+    110, 103, 32, 97, 108, 108, 32, 111, 102, 32, 116, 104, 101, 109, 32, 100, 117, 114, 105, 110, 103, 32, 100, 101,
+    118, 105, 99, 101, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 97, 116, 105, 111, 110, 46, 32, 80, 105, 112,
+    101, 108, 105, 110, 101, 32, 99, 114, 101, 97, 116, 105, 111, 110, 32, 102, 97, 105, 108, 117, 114, 101, 115, 32,
+    97, 114, 101, 32, 116, 104, 101, 110, 32, 111, 110, 108, 121, 32, 114, 101, 112, 111, 114, 116, 101, 100, 32, 98,
+    121, 32, 97, 110, 32, 97, 108, 101, 114, 116, 32, 97, 116, 32, 102, 105, 114, 115, 116, 32, 117, 115, 101, 32, 114,
+    97, 116, 104, 101, 114, 32, 116, 104, 97, 110, 32, 102, 97, 105, 108, 105, 110, 103, 32, 100, 101, 118, 105, 99,
+    101, 32, 99, 114, 101, 97, 116, 105, 111, 110, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    50, 56, 50, 53, 54, 52, 54, 52, 57, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 112, 109, 80,
+    114, 101, 119, 97, 114, 109, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 114, 112, 109, 80, 114, 101, 119, 97, 114, 109, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 110, 32, 82, 112,
+    109, 76, 97, 122, 121, 80, 105, 112, 101, 108, 105, 110, 101, 67, 114, 101, 97, 116, 105, 111, 110, 32, 105, 115,
+    32, 101, 110, 97, 98, 108, 101, 100, 44, 32, 99, 114, 101, 97, 116, 101, 115, 32, 116, 104, 101, 32, 114, 101, 109,
+    97, 105, 110, 105, 110, 103, 32, 105, 110, 116, 101, 114, 110, 97, 108, 32, 82, 115, 114, 99, 80, 114, 111, 99, 77,
+    103, 114, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 32, 111, 110, 32, 97, 32, 98, 97, 99, 107, 103, 114, 111,
+    117, 110, 100, 32, 116, 104, 114, 101, 97, 100, 32, 97, 102, 116, 101, 114, 32, 100, 101, 118, 105, 99, 101, 32,
+    105, 110, 105, 116, 105, 97, 108, 105, 122, 97, 116, 105, 111, 110, 32, 115, 111, 32, 116, 104, 97, 116, 32, 116,
+    104, 101, 105, 114, 32, 102, 105, 114, 115, 116, 32, 117, 115, 101, 32, 100, 111, 101, 115, 110, 39, 116, 32, 112,
+    97, 121, 32, 116, 104, 101, 32, 99, 114, 101, 97, 116, 105, 111, 110, 32, 99, 111, 115, 116, 46, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 57, 55, 52, 51, 54, 49, 56, 57, 125, 44, 32, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 82, 112, 109, 73, 110, 105, 116, 84, 104, 114, 101, 97, 100, 67, 111, 117, 110, 116, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 112, 109, 73, 110, 105, 116, 84, 104, 114, 101, 97, 100, 67,
+    111, 117, 110, 116, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 117,
+    109, 98, 101, 114, 32, 111, 102, 32, 116, 104, 114, 101, 97, 100, 115, 44, 32, 105, 110, 99, 108, 117, 100, 105,
+    110, 103, 32, 116, 104, 101, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 105, 110, 103, 32, 111, 110, 101, 44,
+    32, 117, 115, 101, 100, 32, 116, 111, 32, 99, 114, 101, 97, 116, 101, 32, 116, 104, 101, 32, 105, 110, 116, 101,
+    114, 110, 97, 108, 32, 82, 115, 114, 99, 80, 114, 111, 99, 77, 103, 114, 32, 112, 105, 112, 101, 108, 105, 110, 101,
+    115, 32, 119, 104, 101, 110, 32, 82, 112, 109, 76, 97, 122, 121, 80, 105, 112, 101, 108, 105, 110, 101, 67, 114,
+    101, 97, 116, 105, 111, 110, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 46, 32, 48, 32, 117, 115, 101,
+    115, 32, 111, 110, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 101, 114, 32, 108, 111, 103, 105, 99, 97, 108, 32,
+    67, 80, 85, 32, 99, 111, 114, 101, 46, 32, 86, 97, 108, 117, 101, 115, 32, 97, 114, 101, 32, 99, 108, 97, 109, 112,
+    101, 100, 32, 116, 111, 32, 56, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 49, 54,
+    49, 50, 56, 57, 51, 57, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 112, 109, 76, 111, 103, 80, 105,
+    112, 101, 108, 105, 110, 101, 67, 114, 101, 97, 116, 105, 111, 110, 84, 105, 109, 101, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110,
+    103, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34,
+    66, 117, 105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 34, 100, 98, 103, 34, 93, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 114, 112, 109, 76, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 67, 114, 101, 97, 116, 105, 111,
+    110, 84, 105, 109, 101, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87,
+    104, 101, 110, 32, 116, 114, 117, 101, 44, 32, 112, 114, 105, 110, 116, 115, 32, 104, 111, 119, 32, 108, 111, 110,
+    103, 32, 101, 97, 99, 104, 32, 105, 110, 116, 101, 114, 110, 97, 108, 32, 82, 115, 114, 99, 80, 114, 111, 99, 77,
+    103, 114, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 111, 111, 107, 32, 116, 111, 32, 99, 114, 101, 97,
+    116, 101, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 52, 51, 51, 51, 51, 51, 48,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 70, 111, 114, 99, 101, 82, 101, 115,
+    111, 117, 114, 99, 101, 65, 108, 105, 103, 110, 109, 101, 110, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 68, 101, 98, 117, 103, 34, 44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105,
+    110, 103, 115, 34, 44, 32, 34, 66, 114, 105, 110, 103, 117, 112, 34, 44, 32, 34, 69, 109, 117, 108, 97, 116, 105,
+    111, 110, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 103, 112, 117, 115, 105, 122, 101, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 101, 98, 117, 103, 70, 111, 114,
+    99, 101, 83, 117, 114, 102, 97, 99, 101, 65, 108, 105, 103, 110, 109, 101, 110, 116, 34, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 108, 105, 103, 110, 32, 97, 108, 108, 32, 114, 101, 115,
+    111, 117, 114, 99, 101, 115, 32, 116, 111, 32, 116, 104, 101, 32, 109, 97, 120, 40, 111, 114, 105, 103, 105, 110,
+    97, 108, 65, 108, 105, 103, 110, 109, 101, 110, 116, 44, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 65, 108,
+    105, 103, 110, 109, 101, 110, 116, 41, 46, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105,
+    115, 32, 105, 110, 32, 117, 110, 105, 116, 115, 32, 111, 102, 32, 98, 121, 116, 101, 115, 46, 32, 84, 104, 105, 115,
+    32, 105, 115, 32, 97, 32, 100, 101, 98, 117, 103, 32, 115, 101, 116, 116, 105, 110, 103, 32, 97, 110, 100, 32, 115,
+    116, 114, 97, 110, 103, 101, 32, 98, 101, 104, 97, 118, 105, 111, 114, 32, 40, 101, 46, 103, 46, 32, 112, 111, 111,
+    114, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 44, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101,
+    109, 111, 114, 121, 41, 32, 109, 97, 121, 32, 111, 99, 99, 117, 114, 32, 105, 110, 32, 115, 111, 109, 101, 32, 97,
+    112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 57, 55, 48, 56, 57, 57, 48, 52, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117,
+    103, 70, 111, 114, 99, 101, 82, 101, 115, 111, 117, 114, 99, 101, 65, 100, 100, 105, 116, 105, 111, 110, 97, 108,
+    80, 97, 100, 100, 105, 110, 103, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 98, 117, 103, 34,
+    44, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 44, 32, 34, 66,
+    114, 105, 110, 103, 117, 112, 34, 44, 32, 34, 69, 109, 117, 108, 97, 116, 105, 111, 110, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 103, 112, 117, 115, 105, 122, 101, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 101, 98, 117, 103, 70, 111, 114, 99, 101, 82, 101, 115, 111, 117,
+    114, 99, 101, 65, 100, 100, 105, 116, 105, 111, 110, 97, 108, 80, 97, 100, 100, 105, 110, 103, 34, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 100, 100, 32, 116, 104, 101, 32, 97, 100, 100,
+    105, 116, 105, 111, 110, 97, 108, 32, 112, 97, 100, 100, 105, 110, 103, 32, 116, 111, 32, 114, 101, 115, 111, 117,
+    114, 99, 101, 115, 39, 32, 109, 101, 109, 111, 114, 121, 32, 114, 101, 113, 117, 105, 114, 101, 109, 101, 110, 116,
+    115, 46, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 105, 110, 32, 117, 110,
+    105, 116, 115, 32, 111, 102, 32, 98, 121, 116, 101, 115, 46, 32, 84, 104, 105, 115, 32, 105, 115, 32, 97, 32, 100,
+    101, 98, 117, 103, 32, 115, 101, 116, 116, 105, 110, 103, 32, 97, 110, 100, 32, 115, 116, 114, 97, 110, 103, 101,
+    32, 98, 101, 104, 97, 118, 105, 111, 114, 32, 40, 101, 46, 103, 46, 32, 112, 111, 111, 114, 32, 112, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 44, 32, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 41, 32, 109,
+    97, 121, 32, 111, 99, 99, 117, 114, 32, 105, 110, 32, 115, 111, 109, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116,
+    105, 111, 110, 115, 46, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 48, 49, 48, 56, 48,
+    57, 49, 57, 125, 93, 44, 32, 34, 68, 101, 102, 105, 110, 101, 100, 67, 111, 110, 115, 116, 97, 110, 116, 115, 34,
+    58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 49, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115, 116, 114, 105, 110, 103, 32, 108, 101, 110,
+    103, 116, 104, 32, 102, 111, 114, 32, 97, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 47, 112, 97, 116, 104, 32,
+    115, 101, 116, 116, 105, 110, 103, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 70, 105,
+    108, 101, 78, 97, 109, 101, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 53,
+    54, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117,
+    109, 32, 115, 116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116, 104, 32, 102, 111, 114, 32, 97, 32, 102, 105,
+    108, 101, 110, 97, 109, 101, 32, 115, 101, 116, 116, 105, 110, 103, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 77, 97, 120, 77, 105, 115, 99, 83, 116, 114, 76, 101, 110, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 54, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105,
+    109, 117, 109, 32, 115, 116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116, 104, 32, 102, 111, 114, 32, 97, 32,
+    109, 105, 115, 99, 101, 108, 108, 97, 110, 101, 111, 117, 115, 32, 115, 116, 114, 105, 110, 103, 32, 115, 101, 116,
+    116, 105, 110, 103, 34, 125, 93, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 117, 98, 108, 105, 99, 32,
+    67, 67, 67, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34,
+    71, 80, 85, 32, 73, 110, 102, 111, 34, 44, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 32,
+    34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 44, 32, 34,
+    67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 44, 32, 34, 82, 101, 115, 111, 117, 114, 99,
+    101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 44, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103,
+    32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105, 110, 103, 41, 34, 44, 32, 34, 83, 104, 97, 100,
+    101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 32, 34, 77, 71, 80, 85, 34, 44, 32, 34, 87, 83, 73, 34, 44,
+    32, 34, 68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108, 97, 121, 34, 44, 32, 34, 71, 80, 85, 32, 80, 114, 111,
+    102, 105, 108, 101, 114, 34, 44, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 76, 111, 103, 103, 101, 114,
+    34, 44, 32, 34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 32, 76, 111, 103, 103, 101, 114, 34, 44, 32, 34, 68, 101,
+    98, 117, 103, 34, 44, 32, 34, 83, 97, 102, 101, 83, 101, 116, 116, 105, 110, 103, 34, 44, 32, 34, 68, 101, 118, 77,
+    111, 100, 101, 34, 44, 32, 34, 72, 68, 82, 34, 44, 32, 34, 80, 114, 111, 102, 105, 108, 105, 110, 103, 34, 44, 32,
+    34, 66, 114, 105, 110, 103, 117, 112, 34, 44, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 44, 32, 34, 69, 109,
+    117, 108, 97, 116, 105, 111, 110, 34, 44, 32, 34, 82, 73, 83, 34, 93, 125
 };  // g_palJsonData[]
 
 } // Pal
@@ -763,10 +763,11 @@ uint32* CmdStream::WriteUserDataEntriesToSgprsGfx(
             }
         }
     }
-    else
+    else if (WideBitfieldIsAnyBitSet(entries.dirty))
     {
         // If we are honoring the dirty flags, then there may be multiple packets because skipping dirty entries
-        // can break the assumption about only writing consecutive registers.
+        // can break the assumption about only writing consecutive registers.  The walk over the mapped user-SGPR's
+        // is skipped entirely when no entries are dirty, which is the common case for back-to-back draws.
         for (uint16 sgpr = 0; sgpr < userSgprCount; ++sgpr)
         {
             const uint16 packetFirstSgpr = (firstUserSgpr + sgpr);
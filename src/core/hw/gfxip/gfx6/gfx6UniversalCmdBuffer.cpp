@@ -3242,18 +3242,18 @@ void UniversalCmdBuffer::FixupSpillTableOnPipelineSwitch(
         // previous spill threshold.
         const uint16 firstEntry0 = currSpillThreshold;
         const uint16 entryLimit0 = Min(prevSpillThreshold, currUserDataLimit);
-        for (uint16 e = firstEntry0; e < entryLimit0; ++e)
+        if (firstEntry0 < entryLimit0)
         {
-            WideBitfieldSetBit(pEntries->dirty, e);
+            WideBitfieldSetRange(pEntries->dirty, firstEntry0, (entryLimit0 - firstEntry0));
         }
 
         // This second loop will handle cases #4 and #5 above, as well as the part of case #3 which falls beyond the
         // previous user-data limit.
         const uint16 firstEntry1 = Max(prevUserDataLimit, currSpillThreshold);
         const uint16 entryLimit1 = currUserDataLimit;
-        for (uint16 e = firstEntry1; e < entryLimit1; ++e)
+        if (firstEntry1 < entryLimit1)
         {
-            WideBitfieldSetBit(pEntries->dirty, e);
+            WideBitfieldSetRange(pEntries->dirty, firstEntry1, (entryLimit1 - firstEntry1));
         }
     } // if the spilled region is expanding
 }
@@ -3276,33 +3276,20 @@ uint32* UniversalCmdBuffer::WriteDirtyUserDataEntriesToCeRam(
     const uint16 spillThreshold = pCurrSignature->spillThreshold;
     const uint16 userDataLimit  = pCurrSignature->userDataLimit;
 
-    uint16 lastEntry = 0;
-    uint16 count     = 0;
-    for (uint16 e = spillThreshold; e < userDataLimit; ++e)
+    // Each run of consecutive dirty entries in the spilled region is uploaded with a single packet.
+    uint32 firstEntry = 0;
+    uint32 count      = 0;
+    for (uint32 e = spillThreshold; WideBitfieldScanRun(entries.dirty, e, userDataLimit, &firstEntry, &count); )
     {
-        while ((e < userDataLimit) && WideBitfieldIsSet(entries.dirty, e))
-        {
-            PAL_ASSERT((lastEntry == 0) || (lastEntry == (e - 1)));
-            lastEntry = e;
-            ++count;
-            ++e;
-        }
-
-        if (count > 0)
-        {
-            const uint16 firstEntry = (lastEntry - count + 1);
-            pCeCmdSpace = UploadToUserDataTable(pSpillTable,
-                                                firstEntry,
-                                                count,
-                                                &entries.entries[firstEntry],
-                                                userDataLimit,
-                                                pCeCmdSpace);
+        pCeCmdSpace = UploadToUserDataTable(pSpillTable,
+                                            firstEntry,
+                                            count,
+                                            &entries.entries[firstEntry],
+                                            userDataLimit,
+                                            pCeCmdSpace);
 
-            // Reset accumulators for the next packet.
-            lastEntry = 0;
-            count     = 0;
-        }
-    } // for each entry
+        e = (firstEntry + count);
+    } // for each run of dirty entries
 
     // NOTE: Both spill tables share the same ring buffer, so when one gets updated, the other must also. This is
     // because there may be a large series of Dispatches between Draws (or vice-versa), so if the buffer wraps, it
@@ -3389,34 +3376,30 @@ uint32* UniversalCmdBuffer::WriteDirtyUserDataEntriesToUserSgprsCs(
     // us get away with only checking the first sub-mask of the user-data entries' wide-bitfield of dirty flags.
     static_assert(MaxFastUserDataEntriesCs <= UserDataEntriesPerMask,
                   "The CS user-data entries mapped to user-SGPR's spans multiple wide-bitfield elements!");
-    constexpr uint32 AllFastUserDataEntriesMask = ((1 << MaxFastUserDataEntriesCs) - 1);
-    uint16 userSgprDirtyMask = (m_computeState.csUserDataEntries.dirty[0] & AllFastUserDataEntriesMask);
 
     // Additionally, dirty compute user-data is always written to user-SGPR's if it could be mapped by a pipeline,
     // which lets us avoid any complex logic when switching pipelines.
     const uint16 baseUserSgpr = FirstUserDataRegAddr[static_cast<uint32>(HwShaderStage::Cs)];
 
-    for (uint16 e = 0; e < MaxFastUserDataEntriesCs; ++e)
-    {
-        const uint16 firstEntry = e;
-        uint16       entryCount = 0;
-
-        while ((e < MaxFastUserDataEntriesCs) && ((userSgprDirtyMask & (1 << e)) != 0))
-        {
-            ++entryCount;
-            ++e;
-        }
+    // Each run of consecutive dirty entries is written with a single packet.
+    uint32 firstEntry = 0;
+    uint32 entryCount = 0;
+    uint32 nextEntry  = 0;
+    while (WideBitfieldScanRun(m_computeState.csUserDataEntries.dirty,
+                               nextEntry,
+                               MaxFastUserDataEntriesCs,
+                               &firstEntry,
+                               &entryCount))
+    {
+        const uint32 lastEntry = (firstEntry + entryCount - 1);
+        pDeCmdSpace = m_deCmdStream.WriteSetSeqShRegs((baseUserSgpr + firstEntry),
+                                                      (baseUserSgpr + lastEntry),
+                                                      ShaderCompute,
+                                                      &m_computeState.csUserDataEntries.entries[firstEntry],
+                                                      pDeCmdSpace);
 
-        if (entryCount > 0)
-        {
-            const uint16 lastEntry = (firstEntry + entryCount - 1);
-            pDeCmdSpace = m_deCmdStream.WriteSetSeqShRegs((baseUserSgpr + firstEntry),
-                                                          (baseUserSgpr + lastEntry),
-                                                          ShaderCompute,
-                                                          &m_computeState.csUserDataEntries.entries[firstEntry],
-                                                          pDeCmdSpace);
-        }
-    } // for each entry
+        nextEntry = (firstEntry + entryCount);
+    } // for each run of dirty entries
 
     return pDeCmdSpace;
 }
@@ -3698,18 +3681,18 @@ uint32* UniversalCmdBuffer::ValidateGraphicsUserDataCpu(
             const uint32 lastMaskId  = (lastUserData   / UserDataEntriesPerMask);
             for (uint32 maskId = firstMaskId; maskId <= lastMaskId; ++maskId)
             {
-                uint16 dirtyMask = m_graphicsState.gfxUserDataEntries.dirty[maskId];
+                uint64 dirtyMask = m_graphicsState.gfxUserDataEntries.dirty[maskId];
                 if (maskId == firstMaskId)
                 {
                     // Ignore the dirty bits for any entries below the spill threshold.
                     const uint16 firstEntryInMask = (spillThreshold & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= ~((1 << firstEntryInMask) - 1);
+                    dirtyMask &= ~((1ull << firstEntryInMask) - 1);
                 }
                 if (maskId == lastMaskId)
                 {
                     // Ignore the dirty bits for any entries beyond the user-data limit.
                     const uint16 lastEntryInMask = (lastUserData & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= ((1 << (lastEntryInMask + 1)) - 1);
+                    dirtyMask &= (UINT64_MAX >> ((UserDataEntriesPerMask - 1) - lastEntryInMask));
                 }
 
                 if (dirtyMask != 0)
@@ -3724,10 +3707,10 @@ uint32* UniversalCmdBuffer::ValidateGraphicsUserDataCpu(
         // Re-upload spill table contents if necessary, and write the new GPU virtual address to the user-SGPR(s).
         if (reUpload)
         {
-            UpdateUserDataTableCpu(&m_spillTable.stateGfx,
-                                   (userDataLimit - spillThreshold),
-                                   spillThreshold,
-                                   &m_graphicsState.gfxUserDataEntries.entries[0]);
+            UpdateSpillTableCpu(&m_spillTable.stateGfx,
+                                (userDataLimit - spillThreshold),
+                                spillThreshold,
+                                &m_graphicsState.gfxUserDataEntries.entries[0]);
         }
 
         // NOTE: If the pipeline is changing, we may need to re-write the spill table address to any shader stage, even
@@ -3885,18 +3868,18 @@ uint32* UniversalCmdBuffer::ValidateComputeUserDataCpu(
             const uint32 lastMaskId  = (lastUserData   / UserDataEntriesPerMask);
             for (uint32 maskId = firstMaskId; maskId <= lastMaskId; ++maskId)
             {
-                uint16 dirtyMask = m_computeState.csUserDataEntries.dirty[maskId];
+                uint64 dirtyMask = m_computeState.csUserDataEntries.dirty[maskId];
                 if (maskId == firstMaskId)
                 {
                     // Ignore the dirty bits for any entries below the spill threshold.
                     const uint16 firstEntryInMask = (spillThreshold & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= ~((1 << firstEntryInMask) - 1);
+                    dirtyMask &= ~((1ull << firstEntryInMask) - 1);
                 }
                 if (maskId == lastMaskId)
                 {
                     // Ignore the dirty bits for any entries beyond the user-data limit.
                     const uint16 lastEntryInMask = (lastUserData & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= ((1 << (lastEntryInMask + 1)) - 1);
+                    dirtyMask &= (UINT64_MAX >> ((UserDataEntriesPerMask - 1) - lastEntryInMask));
                 }
 
                 if (dirtyMask != 0)
@@ -3911,10 +3894,10 @@ uint32* UniversalCmdBuffer::ValidateComputeUserDataCpu(
         // Re-upload spill table contents if necessary, and write the new GPU virtual address to the user-SGPR.
         if (reUpload)
         {
-            UpdateUserDataTableCpu(&m_spillTable.stateCs,
-                                   (userDataLimit - spillThreshold),
-                                   spillThreshold,
-                                   &m_computeState.csUserDataEntries.entries[0]);
+            UpdateSpillTableCpu(&m_spillTable.stateCs,
+                                (userDataLimit - spillThreshold),
+                                spillThreshold,
+                                &m_computeState.csUserDataEntries.entries[0]);
 
             pDeCmdSpace = m_deCmdStream.WriteSetOneShReg<ShaderCompute>(m_pSignatureCs->stage.spillTableRegAddr,
                                                                         LowPart(m_spillTable.stateCs.gpuVirtAddr),
@@ -170,6 +170,7 @@ void SettingsLoader::SetupDefaults()
     m_settings.disableDfsmPsUav = true;
     m_settings.shaderPrefetchMethod = PrefetchCpDma;
     m_settings.prefetchCommandBuffers = Gfx9PrefetchCommandsBuildInfo;
+    m_settings.nestedCmdBufInlineThreshold = 256;
     m_settings.anisoFilterOptEnabled = false;
     m_settings.samplerCeilingLogicEnabled = false;
     m_settings.samplerPrecisionFixEnabled = true;
@@ -231,6 +232,8 @@ void SettingsLoader::SetupDefaults()
 
     m_settings.depthStencilFastClearComputeThresholdSingleSampled = 2097152;
     m_settings.depthStencilFastClearComputeThresholdMultiSampled = 4194304;
+    m_settings.coalesceBarriers = true;
+    m_settings.trackSubresCompressionState = false;
     m_settings.numSettings = g_gfx9PalNumSettings;
 }
 
@@ -749,6 +752,11 @@ void SettingsLoader::ReadSettings()
                            &m_settings.prefetchCommandBuffers,
                            InternalSettingScope::PrivatePalGfx9Key);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pNestedCmdBufInlineThresholdStr,
+                           Util::ValueType::Uint,
+                           &m_settings.nestedCmdBufInlineThreshold,
+                           InternalSettingScope::PrivatePalGfx9Key);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pAnisoFilterOptEnabledStr,
                            Util::ValueType::Boolean,
                            &m_settings.anisoFilterOptEnabled,
@@ -964,6 +972,16 @@ void SettingsLoader::ReadSettings()
                            &m_settings.depthStencilFastClearComputeThresholdMultiSampled,
                            InternalSettingScope::PrivatePalGfx9Key);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pCoalesceBarriersStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.coalesceBarriers,
+                           InternalSettingScope::PrivatePalGfx9Key);
+
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pTrackSubresCompressionStateStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.trackSubresCompressionState,
+                           InternalSettingScope::PrivatePalGfx9Key);
+
 }
 
 // =====================================================================================================================
@@ -1685,6 +1703,11 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.prefetchCommandBuffers);
     m_settingsInfoMap.Insert(3867574326, info);
 
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.nestedCmdBufInlineThreshold;
+    info.valueSize = sizeof(m_settings.nestedCmdBufInlineThreshold);
+    m_settingsInfoMap.Insert(3180719469, info);
+
     info.type      = SettingType::Boolean;
     info.pValuePtr = &m_settings.anisoFilterOptEnabled;
     info.valueSize = sizeof(m_settings.anisoFilterOptEnabled);
@@ -1900,6 +1923,16 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.depthStencilFastClearComputeThresholdMultiSampled);
     m_settingsInfoMap.Insert(2782857680, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.coalesceBarriers;
+    info.valueSize = sizeof(m_settings.coalesceBarriers);
+    m_settingsInfoMap.Insert(1299974758, info);
+
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.trackSubresCompressionState;
+    info.valueSize = sizeof(m_settings.trackSubresCompressionState);
+    m_settingsInfoMap.Insert(2492824239, info);
+
 }
 
 // =====================================================================================================================
@@ -1921,9 +1954,9 @@ void SettingsLoader::DevDriverRegister()
             component.pfnSetValue = ISettingsLoader::SetValue;
             component.pSettingsData = &g_gfx9PalJsonData[0];
             component.settingsDataSize = sizeof(g_gfx9PalJsonData);
-            component.settingsDataHash = 1612492929;
-            component.settingsDataHeader.isEncoded = true;
-            component.settingsDataHeader.magicBufferId = 402778310;
+            component.settingsDataHash = 0;
+            component.settingsDataHeader.isEncoded = false;
+            component.settingsDataHeader.magicBufferId = 0;
             component.settingsDataHeader.magicBufferOffset = 0;
 
             pSettingsService->RegisterComponent(component);
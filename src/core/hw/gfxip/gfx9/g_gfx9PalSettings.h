@@ -292,6 +292,7 @@ struct Gfx9PalSettings : public Pal::DriverSettings
     bool                                        disableDfsmPsUav;
     PrefetchMethod                              shaderPrefetchMethod;
     Gfx9PrefetchCommands                        prefetchCommandBuffers;
+    uint32                                      nestedCmdBufInlineThreshold;
     bool                                        anisoFilterOptEnabled;
     bool                                        samplerCeilingLogicEnabled;
     bool                                        samplerPrecisionFixEnabled;
@@ -353,6 +354,8 @@ struct Gfx9PalSettings : public Pal::DriverSettings
 
     uint32                                      depthStencilFastClearComputeThresholdSingleSampled;
     uint32                                      depthStencilFastClearComputeThresholdMultiSampled;
+    bool                                        coalesceBarriers;
+    bool                                        trackSubresCompressionState;
 };
 static const char* pEnableLoadIndexForObjectBindsStr = "#2416072074";
 static const char* pCopyDstIsCompressedStr = "#3919048798";
@@ -467,6 +470,7 @@ static const char* pDisableDfsmStr = "#2943779401";
 static const char* pDisableDfsmPsUavStr = "#1592843420";
 static const char* pShaderPrefetchMethodStr = "#3028994822";
 static const char* pPrefetchCommandBuffersStr = "#3867574326";
+static const char* pNestedCmdBufInlineThresholdStr = "#3180719469";
 static const char* pAnisoFilterOptEnabledStr = "#958470227";
 static const char* pCeilingLogicEnabledStr = "#2986992899";
 static const char* pPrecisionFixEnabledStr = "#286847775";
@@ -528,8 +532,10 @@ static const char* pWaTessIncorrectRelativeIndexStr = "#3815932601";
 
 static const char* pDepthStencilFastClearComputeThresholdSingleSampledStr = "#2634603321";
 static const char* pDepthStencilFastClearComputeThresholdMultiSampledStr = "#2782857680";
+static const char* pCoalesceBarriersStr = "#1299974758";
+static const char* pTrackSubresCompressionStateStr = "#2492824239";
 
-static const uint32 g_gfx9PalNumSettings = 151;
+static const uint32 g_gfx9PalNumSettings = 154;
 static const SettingNameHash g_gfx9PalSettingHashList[] = {
 2416072074,
 3919048798,
@@ -644,6 +650,7 @@ static const SettingNameHash g_gfx9PalSettingHashList[] = {
 1592843420,
 3028994822,
 3867574326,
+3180719469,
 958470227,
 2986992899,
 286847775,
@@ -705,2754 +712,2609 @@ static const SettingNameHash g_gfx9PalSettingHashList[] = {
 
 2634603321,
 2782857680,
+1299974758,
+2492824239,
 };
 
 static const uint8 g_gfx9PalJsonData[] = {
-    26, 250, 84, 220, 1, 92, 96, 106, 146, 207, 33, 32, 160, 3, 90, 155, 144, 218, 198, 89, 117, 164, 24, 82, 117, 14,
-    59, 32, 181, 106, 116, 74, 103, 93, 222, 20, 137, 16, 25, 12, 227, 13, 8, 153, 101, 40, 213, 245, 234, 243, 247, 35,
-    40, 1, 56, 28, 233, 29, 96, 109, 223, 136, 223, 14, 154, 51, 50, 244, 41, 45, 211, 52, 29, 5, 83, 83, 134, 254, 151,
-    147, 65, 179, 175, 50, 133, 28, 233, 131, 174, 31, 40, 145, 27, 31, 142, 4, 78, 94, 161, 152, 241, 119, 97, 32, 178,
-    65, 192, 91, 170, 51, 210, 153, 10, 220, 50, 184, 30, 232, 166, 32, 209, 210, 232, 65, 217, 52, 228, 223, 43, 139,
-    17, 96, 194, 153, 24, 147, 153, 240, 88, 218, 165, 203, 224, 200, 137, 13, 5, 117, 155, 77, 98, 162, 130, 200, 165,
-    172, 141, 95, 10, 204, 187, 28, 164, 237, 206, 13, 233, 74, 104, 203, 155, 100, 203, 59, 60, 99, 198, 131, 181, 150,
-    89, 83, 194, 212, 214, 29, 179, 200, 248, 220, 205, 15, 182, 186, 141, 97, 168, 80, 73, 154, 37, 160, 136, 140, 160,
-    214, 138, 237, 235, 103, 188, 178, 197, 115, 116, 159, 6, 182, 120, 163, 67, 223, 241, 243, 112, 9, 60, 150, 52,
-    251, 75, 238, 101, 7, 104, 57, 141, 57, 156, 172, 4, 235, 80, 67, 25, 62, 84, 50, 175, 34, 142, 237, 231, 48, 253,
-    241, 148, 204, 94, 78, 158, 234, 155, 185, 183, 251, 12, 10, 140, 164, 29, 86, 191, 178, 76, 118, 196, 135, 69, 96,
-    5, 55, 76, 244, 127, 38, 191, 73, 55, 2, 75, 143, 196, 48, 164, 13, 62, 143, 39, 221, 234, 68, 253, 160, 13, 38,
-    112, 108, 14, 94, 173, 123, 122, 191, 220, 119, 1, 93, 60, 22, 82, 73, 192, 191, 213, 165, 183, 225, 225, 85, 15,
-    144, 139, 209, 87, 250, 45, 111, 233, 26, 187, 206, 215, 64, 12, 82, 141, 134, 97, 148, 37, 122, 89, 215, 228, 210,
-    29, 118, 99, 31, 91, 232, 191, 22, 12, 45, 48, 175, 170, 2, 58, 169, 90, 134, 155, 144, 97, 10, 76, 111, 55, 93,
-    170, 34, 24, 130, 243, 19, 37, 222, 15, 132, 245, 231, 184, 15, 201, 154, 112, 43, 252, 85, 225, 78, 66, 39, 170,
-    25, 123, 80, 92, 105, 252, 106, 139, 145, 253, 6, 251, 223, 78, 102, 117, 18, 53, 53, 96, 173, 49, 232, 46, 12, 157,
-    79, 178, 155, 181, 23, 180, 128, 250, 232, 88, 156, 202, 30, 142, 115, 238, 63, 67, 140, 124, 39, 28, 247, 63, 129,
-    6, 87, 219, 138, 236, 54, 199, 220, 197, 79, 144, 239, 197, 231, 196, 243, 39, 27, 152, 122, 135, 86, 170, 144, 160,
-    188, 135, 169, 69, 16, 92, 52, 113, 20, 216, 218, 240, 75, 176, 55, 82, 47, 44, 62, 236, 82, 10, 111, 217, 138, 39,
-    53, 176, 189, 196, 143, 251, 115, 49, 181, 9, 241, 142, 222, 134, 41, 248, 250, 68, 118, 97, 141, 176, 150, 106, 18,
-    44, 2, 197, 236, 191, 3, 251, 146, 191, 181, 99, 34, 177, 126, 179, 38, 161, 242, 104, 247, 99, 238, 130, 1, 215,
-    250, 223, 21, 52, 99, 13, 146, 39, 27, 112, 133, 127, 203, 145, 200, 80, 230, 182, 99, 162, 70, 14, 30, 220, 131,
-    96, 103, 94, 76, 138, 210, 130, 162, 91, 232, 27, 48, 175, 124, 165, 80, 196, 77, 157, 54, 27, 77, 2, 53, 40, 87,
-    41, 29, 250, 69, 249, 37, 64, 75, 172, 34, 119, 29, 0, 48, 146, 196, 218, 72, 193, 235, 240, 150, 215, 194, 85, 38,
-    237, 115, 252, 145, 132, 154, 121, 2, 189, 12, 77, 204, 51, 174, 83, 187, 95, 25, 92, 179, 46, 197, 164, 24, 66,
-    103, 141, 213, 120, 121, 141, 201, 208, 14, 250, 60, 232, 101, 223, 230, 27, 136, 65, 118, 57, 161, 68, 79, 131, 45,
-    163, 176, 250, 165, 253, 178, 200, 195, 239, 242, 163, 11, 95, 65, 60, 37, 134, 242, 220, 69, 65, 87, 83, 238, 13,
-    20, 173, 254, 51, 6, 120, 195, 67, 184, 236, 147, 2, 108, 243, 253, 216, 208, 197, 119, 231, 162, 198, 104, 2, 215,
-    169, 219, 105, 34, 230, 125, 227, 210, 89, 133, 114, 216, 129, 156, 236, 170, 9, 153, 146, 104, 97, 61, 0, 168, 95,
-    199, 126, 146, 23, 58, 132, 77, 255, 89, 7, 22, 147, 43, 137, 163, 132, 232, 132, 222, 201, 189, 5, 16, 77, 252, 73,
-    245, 56, 90, 125, 78, 170, 217, 185, 16, 201, 196, 175, 26, 106, 42, 179, 176, 222, 155, 54, 130, 223, 131, 98, 0,
-    141, 122, 229, 12, 206, 8, 164, 124, 131, 226, 39, 21, 192, 109, 173, 97, 150, 206, 137, 3, 117, 98, 15, 1, 99, 69,
-    56, 195, 148, 60, 24, 39, 31, 125, 217, 195, 180, 100, 64, 208, 144, 195, 212, 107, 254, 111, 117, 28, 189, 14, 247,
-    20, 178, 1, 56, 78, 118, 44, 210, 146, 28, 135, 181, 42, 146, 112, 111, 131, 10, 132, 74, 184, 26, 57, 232, 87, 211,
-    84, 79, 188, 179, 205, 194, 149, 67, 57, 129, 159, 88, 114, 242, 105, 20, 85, 251, 197, 125, 214, 231, 237, 50, 75,
-    103, 62, 239, 25, 83, 63, 47, 195, 206, 8, 23, 31, 119, 62, 128, 182, 207, 48, 166, 3, 76, 173, 23, 14, 141, 96,
-    254, 23, 81, 248, 161, 174, 142, 28, 199, 207, 28, 245, 217, 227, 203, 226, 235, 157, 220, 130, 135, 111, 122, 216,
-    35, 110, 155, 189, 24, 173, 118, 18, 16, 7, 93, 246, 206, 154, 228, 145, 47, 75, 29, 244, 17, 138, 178, 204, 211,
-    196, 244, 159, 200, 183, 204, 0, 124, 217, 166, 143, 236, 245, 207, 168, 57, 112, 172, 12, 194, 89, 254, 76, 181,
-    253, 147, 102, 100, 143, 96, 199, 252, 196, 152, 109, 72, 34, 154, 165, 232, 111, 167, 196, 141, 107, 107, 143, 98,
-    200, 85, 43, 47, 39, 105, 174, 34, 195, 28, 216, 210, 104, 45, 160, 21, 119, 229, 172, 213, 57, 202, 72, 159, 122,
-    35, 135, 150, 0, 55, 242, 172, 202, 127, 87, 4, 18, 60, 194, 28, 240, 20, 60, 190, 200, 67, 62, 243, 112, 70, 94,
-    91, 151, 215, 17, 240, 171, 4, 61, 252, 37, 196, 179, 169, 156, 240, 183, 36, 174, 17, 11, 175, 52, 172, 195, 141,
-    123, 209, 45, 195, 43, 253, 239, 90, 193, 161, 16, 16, 212, 247, 95, 42, 163, 37, 114, 166, 45, 85, 238, 67, 240,
-    180, 254, 148, 224, 55, 102, 76, 190, 201, 62, 27, 234, 215, 243, 216, 57, 34, 121, 6, 19, 21, 117, 138, 31, 206,
-    141, 238, 222, 156, 46, 222, 150, 54, 151, 211, 242, 48, 147, 198, 111, 67, 12, 75, 22, 154, 145, 17, 22, 223, 203,
-    52, 244, 44, 136, 225, 235, 46, 46, 15, 195, 146, 183, 15, 129, 12, 50, 140, 100, 21, 73, 106, 71, 164, 73, 53, 22,
-    179, 133, 224, 242, 216, 157, 88, 130, 145, 49, 32, 127, 86, 158, 217, 60, 189, 33, 107, 71, 98, 253, 99, 156, 74,
-    187, 18, 250, 245, 4, 47, 218, 12, 33, 241, 200, 87, 50, 214, 22, 75, 187, 189, 239, 2, 212, 114, 249, 234, 207,
-    159, 216, 251, 38, 219, 100, 124, 91, 193, 195, 234, 225, 173, 142, 156, 60, 194, 198, 200, 219, 165, 2, 49, 6, 66,
-    39, 193, 77, 40, 69, 151, 179, 51, 128, 162, 211, 150, 87, 124, 61, 133, 132, 168, 207, 239, 178, 233, 155, 200,
-    250, 251, 79, 57, 198, 220, 244, 112, 243, 47, 215, 141, 112, 108, 170, 29, 79, 56, 101, 2, 124, 154, 234, 79, 85,
-    26, 157, 17, 42, 18, 214, 48, 160, 52, 228, 59, 90, 140, 19, 78, 56, 237, 184, 71, 93, 192, 98, 2, 59, 132, 142, 25,
-    64, 253, 140, 2, 14, 100, 238, 125, 165, 248, 92, 12, 126, 205, 226, 254, 207, 202, 50, 200, 85, 20, 46, 137, 137,
-    141, 167, 29, 190, 100, 16, 109, 146, 200, 214, 167, 244, 103, 20, 43, 187, 224, 223, 139, 180, 208, 52, 125, 242,
-    79, 108, 150, 232, 92, 25, 155, 53, 5, 69, 152, 231, 102, 207, 28, 180, 203, 186, 167, 234, 138, 215, 55, 34, 81,
-    49, 210, 75, 119, 16, 133, 3, 236, 217, 24, 172, 86, 164, 191, 72, 50, 82, 39, 143, 1, 169, 223, 230, 75, 156, 179,
-    244, 110, 110, 49, 194, 4, 9, 209, 231, 88, 87, 87, 123, 172, 234, 78, 72, 239, 224, 192, 236, 54, 202, 164, 3, 199,
-    132, 156, 240, 12, 28, 95, 222, 79, 34, 146, 141, 61, 88, 248, 4, 38, 64, 84, 191, 193, 143, 207, 236, 200, 92, 90,
-    77, 214, 6, 186, 11, 16, 161, 236, 130, 149, 254, 40, 250, 129, 23, 154, 46, 203, 221, 194, 127, 180, 143, 155, 27,
-    68, 239, 21, 140, 207, 22, 202, 137, 176, 148, 181, 92, 97, 213, 18, 51, 115, 41, 149, 108, 155, 248, 4, 36, 166,
-    185, 27, 226, 79, 229, 141, 197, 179, 158, 62, 201, 128, 70, 223, 77, 67, 61, 208, 223, 8, 224, 255, 140, 176, 198,
-    10, 245, 132, 103, 92, 95, 252, 62, 146, 241, 12, 39, 143, 123, 205, 121, 13, 124, 126, 216, 179, 95, 42, 126, 37,
-    156, 59, 219, 127, 206, 163, 107, 223, 3, 164, 126, 129, 109, 21, 176, 239, 24, 122, 4, 70, 79, 2, 153, 59, 65, 219,
-    68, 18, 0, 46, 255, 156, 230, 196, 87, 196, 245, 115, 88, 188, 183, 43, 181, 75, 117, 116, 228, 238, 22, 143, 245,
-    226, 45, 154, 84, 247, 245, 42, 15, 201, 157, 21, 116, 198, 249, 111, 127, 12, 134, 233, 86, 6, 213, 165, 130, 230,
-    18, 120, 124, 112, 118, 65, 217, 214, 97, 198, 107, 62, 227, 97, 143, 80, 110, 60, 194, 99, 97, 117, 29, 176, 229,
-    19, 22, 126, 91, 225, 35, 92, 181, 242, 32, 219, 148, 195, 59, 20, 89, 215, 90, 253, 198, 15, 150, 22, 165, 206,
-    245, 181, 156, 7, 234, 96, 177, 109, 133, 16, 85, 45, 54, 112, 182, 116, 144, 145, 150, 2, 15, 97, 180, 142, 85, 26,
-    113, 230, 105, 106, 243, 114, 7, 154, 0, 93, 214, 19, 179, 173, 14, 237, 155, 161, 197, 170, 7, 147, 144, 183, 229,
-    40, 84, 87, 83, 75, 142, 245, 142, 155, 39, 49, 238, 132, 53, 95, 120, 248, 69, 21, 57, 170, 138, 12, 17, 78, 62,
-    48, 33, 187, 229, 68, 86, 165, 102, 4, 192, 244, 171, 149, 177, 11, 48, 217, 114, 69, 35, 72, 95, 73, 65, 214, 137,
-    34, 1, 123, 227, 194, 145, 147, 14, 83, 39, 217, 76, 42, 50, 178, 206, 137, 223, 172, 4, 50, 116, 168, 82, 54, 83,
-    238, 27, 97, 50, 110, 182, 221, 56, 178, 167, 103, 49, 166, 242, 86, 65, 8, 6, 251, 89, 11, 131, 122, 113, 203, 117,
-    210, 166, 213, 228, 222, 250, 244, 137, 89, 63, 193, 24, 95, 230, 65, 101, 123, 99, 3, 19, 118, 247, 43, 184, 5,
-    148, 12, 230, 191, 156, 223, 38, 224, 2, 246, 147, 139, 19, 132, 57, 109, 81, 61, 142, 171, 31, 196, 136, 135, 28,
-    161, 70, 65, 42, 81, 8, 163, 64, 142, 8, 0, 107, 48, 143, 104, 230, 63, 180, 132, 0, 2, 117, 22, 74, 38, 211, 73,
-    137, 234, 38, 18, 116, 243, 57, 24, 252, 29, 186, 40, 227, 150, 255, 202, 45, 223, 88, 209, 164, 1, 171, 140, 246,
-    155, 109, 182, 203, 170, 21, 103, 86, 146, 40, 144, 116, 37, 120, 226, 24, 27, 112, 193, 237, 78, 251, 213, 66, 147,
-    175, 24, 110, 123, 48, 99, 22, 169, 247, 176, 236, 164, 144, 160, 49, 149, 176, 119, 211, 10, 191, 111, 118, 138,
-    42, 95, 193, 171, 91, 99, 30, 50, 72, 64, 173, 240, 232, 178, 64, 89, 127, 181, 35, 184, 240, 144, 58, 45, 198, 199,
-    15, 40, 198, 204, 228, 66, 65, 0, 90, 6, 180, 189, 112, 115, 219, 232, 51, 33, 130, 248, 82, 70, 189, 130, 100, 120,
-    100, 173, 225, 113, 191, 93, 33, 57, 50, 29, 105, 52, 108, 189, 197, 212, 152, 103, 109, 138, 186, 44, 169, 220,
-    194, 174, 164, 16, 76, 249, 253, 124, 13, 59, 53, 4, 151, 102, 197, 112, 103, 160, 158, 41, 85, 11, 193, 20, 67,
-    125, 221, 115, 146, 15, 173, 41, 214, 216, 205, 103, 240, 66, 42, 22, 167, 56, 49, 109, 131, 239, 20, 239, 196, 110,
-    236, 205, 179, 150, 46, 44, 230, 129, 83, 90, 185, 201, 44, 213, 25, 179, 135, 189, 245, 101, 25, 215, 176, 16, 32,
-    228, 191, 54, 228, 110, 22, 62, 30, 64, 99, 249, 37, 23, 14, 254, 225, 114, 152, 191, 90, 63, 88, 231, 87, 197, 22,
-    159, 123, 155, 111, 186, 254, 236, 34, 143, 111, 206, 120, 117, 94, 124, 87, 200, 212, 76, 151, 34, 219, 208, 47,
-    100, 84, 74, 79, 84, 250, 148, 30, 146, 52, 69, 139, 203, 1, 24, 127, 184, 122, 219, 183, 233, 235, 46, 39, 168,
-    185, 118, 239, 251, 16, 37, 100, 32, 51, 150, 243, 58, 211, 60, 249, 79, 146, 159, 155, 198, 115, 56, 109, 139, 147,
-    106, 85, 244, 134, 238, 226, 8, 109, 243, 3, 115, 63, 158, 236, 133, 230, 115, 31, 197, 167, 76, 206, 245, 145, 134,
-    17, 106, 136, 94, 43, 89, 240, 143, 169, 64, 244, 25, 213, 109, 219, 4, 60, 251, 216, 192, 113, 101, 32, 189, 224,
-    134, 65, 95, 121, 3, 127, 134, 29, 28, 88, 63, 177, 92, 80, 29, 241, 153, 112, 54, 148, 60, 7, 196, 75, 163, 162,
-    54, 92, 195, 79, 57, 22, 5, 108, 90, 0, 164, 164, 65, 114, 134, 6, 105, 14, 39, 206, 151, 126, 183, 213, 39, 77,
-    135, 210, 246, 15, 79, 137, 108, 96, 86, 111, 152, 174, 35, 58, 236, 148, 143, 75, 252, 232, 148, 152, 98, 207, 86,
-    71, 20, 221, 124, 6, 10, 187, 229, 119, 234, 97, 250, 250, 83, 53, 112, 252, 159, 123, 117, 219, 163, 206, 204, 102,
-    220, 77, 51, 79, 185, 199, 19, 60, 63, 150, 67, 193, 85, 142, 76, 114, 126, 90, 80, 23, 111, 184, 146, 182, 111, 90,
-    166, 150, 134, 155, 153, 140, 194, 73, 252, 65, 78, 255, 5, 145, 207, 36, 250, 71, 238, 247, 89, 132, 35, 171, 201,
-    139, 37, 136, 224, 125, 80, 32, 56, 231, 221, 248, 42, 15, 30, 60, 197, 168, 103, 71, 132, 63, 119, 114, 66, 108,
-    244, 79, 110, 137, 247, 225, 118, 243, 231, 95, 115, 187, 100, 252, 99, 150, 130, 33, 157, 253, 172, 192, 176, 225,
-    145, 27, 245, 23, 174, 238, 122, 182, 86, 162, 129, 224, 194, 221, 234, 89, 236, 202, 51, 124, 239, 151, 137, 107,
-    59, 110, 22, 139, 242, 53, 49, 184, 29, 123, 125, 145, 68, 59, 97, 246, 47, 59, 88, 70, 156, 67, 65, 254, 32, 10,
-    231, 228, 100, 81, 87, 89, 187, 223, 29, 155, 169, 67, 123, 224, 215, 88, 156, 9, 213, 0, 85, 41, 208, 188, 88, 90,
-    247, 112, 231, 248, 29, 99, 139, 45, 170, 144, 63, 179, 126, 12, 54, 8, 37, 248, 170, 42, 103, 162, 30, 99, 135,
-    238, 225, 205, 23, 171, 255, 2, 99, 92, 198, 84, 177, 79, 60, 29, 69, 252, 162, 166, 44, 197, 94, 225, 66, 96, 168,
-    168, 80, 39, 84, 228, 118, 110, 216, 185, 34, 40, 208, 122, 65, 73, 79, 175, 223, 0, 155, 12, 153, 168, 92, 73, 29,
-    78, 186, 23, 17, 22, 217, 171, 215, 35, 221, 136, 88, 116, 100, 74, 225, 170, 188, 84, 16, 42, 188, 54, 245, 167,
-    171, 209, 223, 89, 95, 125, 15, 142, 197, 89, 223, 81, 61, 158, 177, 13, 196, 40, 132, 171, 222, 187, 109, 4, 93,
-    100, 10, 89, 108, 173, 70, 74, 136, 107, 247, 158, 25, 25, 160, 73, 220, 241, 248, 188, 8, 135, 68, 195, 145, 194,
-    110, 72, 6, 118, 215, 235, 193, 34, 53, 131, 75, 74, 247, 0, 87, 37, 89, 94, 170, 241, 70, 227, 237, 146, 56, 60,
-    188, 115, 52, 224, 224, 97, 137, 107, 19, 215, 247, 193, 245, 123, 151, 203, 209, 251, 52, 90, 87, 125, 27, 177, 49,
-    147, 158, 68, 231, 100, 227, 232, 66, 100, 53, 153, 106, 239, 55, 14, 28, 71, 145, 115, 31, 39, 4, 18, 46, 191, 191,
-    115, 67, 151, 92, 86, 134, 149, 3, 2, 182, 119, 95, 148, 128, 221, 76, 43, 194, 45, 194, 213, 26, 251, 124, 82, 7,
-    13, 142, 106, 72, 57, 119, 249, 233, 143, 21, 241, 110, 231, 250, 75, 179, 242, 169, 238, 218, 202, 217, 215, 124,
-    102, 101, 50, 179, 48, 15, 125, 122, 53, 243, 69, 48, 156, 61, 97, 98, 93, 181, 206, 108, 99, 106, 233, 223, 209,
-    246, 116, 37, 120, 214, 172, 147, 110, 111, 182, 113, 166, 22, 28, 6, 70, 100, 127, 248, 237, 36, 70, 206, 242, 162,
-    73, 217, 198, 184, 234, 144, 17, 23, 245, 186, 183, 11, 212, 61, 110, 212, 181, 234, 76, 247, 129, 134, 28, 103,
-    247, 184, 220, 195, 82, 193, 34, 97, 214, 105, 156, 85, 229, 248, 225, 162, 152, 110, 45, 49, 126, 138, 200, 151,
-    105, 237, 151, 66, 50, 112, 225, 171, 89, 178, 74, 4, 78, 240, 92, 228, 104, 199, 150, 117, 70, 222, 40, 151, 62,
-    116, 67, 107, 53, 71, 196, 181, 226, 49, 25, 95, 204, 246, 151, 147, 247, 68, 18, 226, 76, 65, 157, 161, 1, 176,
-    134, 120, 133, 187, 116, 208, 75, 91, 244, 159, 201, 174, 79, 73, 34, 255, 212, 109, 221, 12, 202, 129, 146, 37,
-    112, 142, 159, 194, 28, 187, 91, 91, 160, 2, 102, 65, 206, 72, 35, 23, 170, 210, 206, 208, 166, 79, 72, 177, 141,
-    192, 78, 44, 148, 203, 17, 226, 198, 168, 115, 47, 201, 224, 218, 35, 116, 183, 49, 67, 83, 18, 19, 146, 39, 171,
-    49, 207, 114, 77, 243, 66, 112, 92, 3, 66, 161, 159, 208, 76, 202, 113, 212, 172, 82, 115, 114, 245, 155, 243, 53,
-    140, 221, 225, 250, 184, 37, 134, 229, 4, 214, 199, 173, 147, 138, 211, 227, 178, 129, 200, 143, 67, 198, 116, 176,
-    85, 91, 103, 62, 45, 76, 74, 20, 164, 77, 148, 57, 10, 195, 16, 79, 50, 27, 199, 223, 40, 80, 65, 11, 71, 39, 77,
-    172, 161, 8, 49, 135, 50, 85, 78, 33, 208, 45, 133, 29, 147, 189, 83, 200, 146, 91, 176, 175, 29, 179, 17, 18, 10,
-    149, 255, 202, 148, 134, 253, 152, 71, 48, 76, 136, 6, 167, 248, 7, 132, 45, 45, 164, 130, 15, 20, 182, 168, 172,
-    236, 67, 205, 167, 125, 84, 63, 19, 23, 58, 178, 149, 199, 112, 172, 255, 75, 49, 210, 74, 159, 211, 204, 11, 157,
-    26, 101, 177, 26, 73, 34, 196, 18, 91, 146, 243, 122, 209, 245, 179, 115, 138, 175, 209, 12, 206, 230, 159, 13, 42,
-    179, 39, 132, 36, 178, 30, 104, 125, 54, 76, 52, 157, 151, 130, 74, 68, 199, 255, 183, 201, 29, 173, 39, 226, 50,
-    69, 145, 90, 163, 194, 55, 197, 149, 53, 76, 156, 83, 8, 219, 15, 128, 92, 174, 197, 73, 220, 115, 124, 240, 210,
-    211, 105, 40, 45, 53, 212, 165, 41, 200, 174, 252, 68, 60, 39, 143, 19, 66, 158, 157, 255, 174, 39, 230, 173, 124,
-    208, 116, 200, 7, 212, 130, 10, 30, 177, 4, 85, 74, 85, 62, 124, 104, 42, 112, 222, 128, 167, 178, 168, 72, 222,
-    222, 89, 222, 192, 112, 207, 22, 46, 226, 145, 185, 0, 156, 50, 247, 103, 165, 96, 189, 128, 221, 4, 152, 232, 121,
-    164, 183, 201, 106, 51, 66, 222, 146, 76, 95, 60, 117, 93, 13, 132, 177, 205, 81, 39, 109, 51, 38, 90, 251, 196, 4,
-    81, 202, 63, 76, 225, 8, 4, 86, 15, 243, 13, 177, 182, 135, 22, 3, 19, 246, 155, 67, 245, 42, 22, 31, 73, 79, 174,
-    43, 184, 242, 237, 4, 123, 39, 42, 90, 210, 84, 208, 171, 65, 86, 25, 120, 34, 192, 251, 221, 135, 58, 130, 130,
-    174, 196, 54, 102, 7, 162, 170, 197, 224, 75, 5, 215, 144, 224, 204, 199, 48, 93, 28, 36, 176, 243, 254, 26, 155,
-    22, 120, 108, 168, 168, 28, 118, 162, 55, 102, 207, 21, 198, 87, 29, 200, 172, 0, 170, 237, 140, 59, 141, 14, 210,
-    150, 242, 129, 249, 62, 235, 37, 14, 4, 209, 219, 134, 85, 149, 167, 165, 49, 227, 175, 196, 122, 88, 121, 12, 181,
-    48, 177, 155, 98, 176, 155, 189, 215, 58, 143, 186, 130, 108, 150, 41, 163, 156, 50, 199, 147, 243, 139, 81, 210,
-    240, 19, 238, 46, 97, 53, 201, 105, 53, 216, 117, 205, 159, 235, 158, 201, 160, 37, 84, 160, 50, 220, 5, 186, 39,
-    246, 44, 15, 83, 206, 71, 177, 75, 146, 234, 17, 129, 113, 136, 148, 200, 0, 42, 250, 43, 219, 159, 181, 135, 173,
-    124, 227, 1, 54, 112, 246, 163, 37, 72, 47, 44, 184, 244, 59, 56, 99, 25, 141, 48, 76, 182, 206, 255, 212, 138, 108,
-    150, 153, 157, 146, 1, 50, 227, 158, 174, 112, 236, 64, 128, 250, 207, 51, 94, 183, 188, 183, 82, 74, 4, 190, 203,
-    123, 54, 112, 126, 88, 142, 185, 44, 4, 143, 41, 82, 171, 2, 220, 228, 25, 50, 145, 212, 109, 148, 12, 70, 162, 165,
-    222, 249, 100, 115, 159, 41, 153, 198, 97, 237, 77, 224, 203, 53, 227, 173, 204, 51, 129, 132, 138, 241, 208, 186,
-    201, 176, 213, 54, 65, 254, 232, 218, 4, 64, 6, 152, 111, 10, 199, 20, 28, 164, 2, 147, 103, 190, 52, 215, 222, 63,
-    179, 5, 241, 235, 183, 23, 227, 162, 187, 89, 140, 216, 30, 117, 112, 178, 4, 155, 239, 24, 231, 119, 189, 84, 151,
-    180, 33, 79, 65, 9, 168, 172, 143, 233, 254, 219, 15, 213, 8, 172, 125, 139, 75, 253, 193, 255, 142, 232, 195, 213,
-    220, 32, 11, 251, 247, 17, 153, 46, 98, 154, 77, 101, 71, 27, 112, 106, 238, 12, 101, 222, 38, 140, 2, 147, 180,
-    197, 255, 234, 241, 177, 171, 207, 252, 233, 72, 46, 177, 218, 156, 147, 194, 39, 232, 235, 240, 89, 151, 39, 255,
-    15, 217, 211, 142, 91, 161, 85, 197, 155, 97, 2, 205, 120, 219, 166, 186, 19, 213, 59, 122, 88, 113, 91, 181, 120,
-    238, 101, 214, 204, 5, 34, 31, 19, 252, 118, 62, 235, 91, 194, 21, 103, 51, 191, 220, 58, 240, 18, 46, 255, 173,
-    131, 174, 199, 110, 253, 79, 197, 164, 159, 127, 169, 58, 78, 121, 176, 150, 255, 44, 153, 63, 79, 13, 148, 9, 245,
-    246, 168, 16, 130, 255, 11, 242, 222, 127, 21, 134, 221, 65, 96, 25, 84, 103, 53, 138, 207, 179, 151, 74, 169, 5,
-    170, 176, 169, 112, 211, 138, 3, 223, 110, 0, 145, 251, 189, 32, 201, 106, 61, 240, 183, 167, 201, 106, 178, 149,
-    159, 176, 94, 164, 211, 9, 54, 67, 79, 166, 103, 69, 178, 199, 42, 224, 203, 217, 68, 217, 130, 139, 110, 127, 3,
-    233, 88, 151, 99, 238, 17, 100, 95, 16, 59, 133, 168, 51, 69, 171, 90, 212, 63, 55, 66, 13, 154, 244, 243, 114, 249,
-    85, 140, 146, 48, 162, 212, 205, 7, 196, 130, 47, 145, 138, 89, 78, 106, 126, 147, 14, 189, 175, 47, 102, 16, 229,
-    217, 242, 176, 76, 169, 53, 154, 54, 49, 146, 37, 87, 104, 21, 20, 230, 60, 144, 211, 30, 8, 160, 210, 129, 188,
-    143, 145, 63, 26, 80, 102, 229, 190, 150, 226, 62, 187, 249, 64, 116, 105, 115, 102, 143, 181, 66, 160, 162, 214,
-    64, 163, 110, 14, 161, 94, 38, 231, 6, 23, 76, 115, 125, 112, 9, 66, 92, 143, 51, 68, 119, 87, 185, 18, 157, 201,
-    57, 120, 132, 200, 180, 65, 151, 46, 185, 97, 157, 2, 182, 177, 60, 15, 130, 205, 254, 110, 177, 208, 34, 75, 19,
-    127, 250, 120, 13, 16, 168, 222, 213, 253, 210, 104, 93, 84, 207, 202, 57, 162, 158, 119, 83, 9, 32, 244, 167, 193,
-    244, 239, 27, 165, 213, 41, 180, 115, 220, 185, 123, 72, 114, 118, 214, 109, 240, 144, 121, 80, 237, 133, 94, 158,
-    222, 75, 247, 71, 36, 94, 108, 69, 146, 141, 127, 38, 28, 143, 72, 93, 63, 233, 102, 209, 85, 160, 113, 41, 137,
-    197, 219, 125, 75, 169, 220, 157, 223, 14, 45, 143, 23, 242, 217, 83, 215, 38, 3, 158, 76, 209, 59, 114, 18, 69, 54,
-    5, 188, 106, 168, 233, 140, 179, 39, 222, 39, 174, 27, 113, 169, 67, 147, 198, 122, 129, 29, 186, 224, 229, 123,
-    210, 76, 14, 44, 174, 193, 26, 106, 210, 1, 201, 240, 156, 149, 191, 243, 122, 137, 194, 28, 185, 26, 12, 103, 164,
-    34, 196, 74, 128, 141, 107, 146, 238, 144, 150, 25, 84, 95, 220, 162, 84, 235, 3, 171, 35, 56, 31, 85, 25, 114, 3,
-    204, 134, 173, 130, 62, 14, 99, 120, 212, 155, 182, 240, 53, 97, 56, 24, 105, 46, 57, 204, 35, 246, 160, 16, 194,
-    165, 240, 219, 158, 42, 154, 198, 186, 104, 181, 236, 223, 199, 77, 107, 90, 126, 141, 230, 76, 15, 188, 33, 114,
-    119, 96, 94, 27, 200, 31, 132, 131, 96, 248, 200, 252, 253, 194, 31, 115, 239, 219, 188, 192, 217, 91, 197, 105,
-    164, 135, 240, 7, 22, 164, 1, 192, 172, 145, 30, 213, 143, 48, 106, 163, 109, 139, 33, 184, 78, 2, 197, 122, 129,
-    154, 55, 230, 197, 226, 203, 98, 228, 86, 7, 252, 133, 121, 103, 231, 150, 173, 236, 36, 60, 163, 161, 90, 162, 234,
-    251, 40, 112, 25, 254, 200, 165, 32, 252, 1, 134, 64, 210, 183, 28, 16, 194, 62, 245, 211, 146, 117, 224, 243, 50,
-    168, 157, 226, 211, 172, 215, 102, 145, 8, 252, 193, 204, 3, 131, 163, 132, 149, 245, 157, 54, 197, 112, 147, 122,
-    211, 119, 214, 122, 186, 126, 122, 15, 23, 89, 98, 222, 131, 229, 221, 150, 44, 80, 180, 123, 15, 250, 220, 247, 58,
-    244, 10, 5, 246, 6, 73, 69, 164, 174, 18, 172, 149, 57, 145, 252, 210, 114, 133, 234, 213, 233, 156, 178, 142, 49,
-    85, 3, 250, 132, 146, 90, 109, 118, 179, 212, 185, 30, 137, 107, 178, 88, 251, 149, 100, 245, 130, 208, 55, 209,
-    191, 207, 30, 216, 252, 173, 66, 135, 202, 146, 119, 97, 64, 64, 126, 107, 84, 110, 12, 86, 82, 187, 122, 23, 91,
-    155, 92, 230, 130, 204, 60, 226, 18, 191, 182, 184, 67, 239, 163, 221, 140, 40, 149, 68, 125, 209, 250, 108, 120,
-    71, 102, 7, 145, 93, 216, 35, 160, 131, 174, 235, 152, 31, 103, 215, 106, 48, 108, 250, 193, 67, 238, 23, 19, 138,
-    150, 73, 101, 99, 105, 159, 110, 147, 172, 41, 162, 5, 222, 148, 215, 4, 158, 73, 13, 220, 10, 214, 200, 85, 33,
-    223, 63, 49, 196, 60, 53, 173, 38, 50, 126, 245, 28, 110, 47, 161, 217, 39, 24, 73, 103, 75, 131, 114, 233, 40, 149,
-    22, 217, 107, 159, 211, 149, 122, 143, 13, 198, 248, 64, 63, 59, 96, 163, 49, 21, 244, 72, 192, 131, 32, 80, 176, 4,
-    96, 221, 157, 23, 5, 177, 140, 89, 65, 173, 125, 243, 255, 62, 201, 250, 45, 108, 146, 196, 23, 19, 150, 64, 98, 12,
-    206, 225, 81, 30, 165, 187, 108, 188, 10, 212, 167, 76, 111, 247, 99, 189, 43, 135, 189, 150, 190, 137, 45, 53, 142,
-    25, 78, 160, 213, 82, 25, 114, 93, 214, 181, 41, 183, 194, 167, 239, 136, 54, 241, 157, 134, 166, 194, 147, 3, 55,
-    56, 236, 117, 247, 108, 64, 49, 43, 160, 164, 41, 152, 180, 194, 50, 147, 186, 163, 140, 217, 170, 128, 45, 98, 244,
-    10, 64, 151, 141, 167, 56, 59, 253, 219, 186, 226, 96, 220, 152, 254, 218, 252, 237, 247, 139, 199, 77, 139, 218,
-    143, 57, 173, 182, 116, 242, 124, 17, 250, 83, 198, 172, 150, 196, 228, 169, 58, 124, 118, 96, 234, 136, 89, 167,
-    45, 123, 165, 47, 46, 56, 115, 195, 10, 149, 139, 211, 109, 156, 71, 103, 120, 231, 40, 92, 122, 217, 134, 217, 209,
-    85, 67, 21, 205, 20, 164, 161, 10, 185, 141, 3, 188, 94, 162, 0, 44, 95, 10, 35, 146, 204, 136, 202, 225, 91, 250,
-    232, 235, 75, 252, 71, 240, 196, 30, 229, 195, 224, 2, 121, 232, 113, 235, 143, 142, 221, 193, 79, 110, 241, 254, 7,
-    66, 64, 201, 158, 10, 66, 9, 142, 91, 53, 252, 73, 251, 159, 153, 98, 215, 199, 185, 237, 202, 90, 61, 94, 76, 158,
-    214, 195, 43, 232, 253, 54, 37, 49, 253, 231, 174, 128, 201, 224, 144, 173, 199, 30, 128, 28, 216, 29, 173, 111,
-    218, 145, 154, 241, 222, 240, 119, 148, 119, 57, 86, 106, 247, 104, 99, 28, 79, 117, 50, 165, 141, 40, 68, 195, 173,
-    221, 15, 85, 220, 181, 82, 46, 89, 143, 114, 4, 188, 192, 174, 45, 150, 80, 225, 2, 176, 200, 220, 252, 47, 125,
-    139, 13, 11, 228, 40, 242, 46, 177, 91, 65, 156, 94, 157, 189, 225, 24, 122, 7, 107, 221, 27, 29, 147, 5, 37, 59,
-    184, 1, 216, 79, 58, 137, 122, 116, 189, 248, 165, 66, 238, 49, 127, 90, 157, 237, 78, 129, 31, 139, 19, 179, 255,
-    140, 137, 88, 240, 39, 249, 219, 188, 29, 233, 36, 55, 188, 154, 11, 181, 238, 19, 250, 197, 128, 28, 208, 92, 123,
-    104, 156, 151, 172, 222, 238, 138, 80, 133, 36, 26, 214, 124, 196, 90, 167, 172, 247, 148, 88, 149, 101, 81, 72,
-    112, 229, 103, 225, 72, 207, 69, 163, 100, 56, 26, 164, 47, 122, 229, 155, 49, 54, 66, 179, 16, 238, 153, 254, 198,
-    88, 205, 10, 69, 108, 254, 143, 20, 52, 120, 167, 128, 202, 194, 73, 61, 35, 170, 231, 14, 239, 175, 38, 93, 77,
-    201, 32, 239, 18, 188, 226, 115, 225, 205, 39, 34, 64, 0, 77, 36, 187, 57, 78, 82, 187, 199, 59, 252, 88, 116, 21,
-    227, 51, 143, 234, 242, 251, 4, 4, 134, 88, 153, 18, 186, 57, 254, 78, 213, 201, 195, 174, 236, 176, 203, 61, 1,
-    100, 130, 174, 183, 187, 202, 152, 10, 11, 218, 50, 68, 227, 225, 93, 218, 72, 121, 219, 90, 51, 186, 79, 226, 83,
-    153, 101, 232, 164, 133, 134, 157, 103, 145, 217, 165, 4, 33, 209, 156, 196, 5, 186, 40, 54, 71, 24, 123, 16, 83, 3,
-    55, 154, 255, 155, 141, 83, 180, 88, 95, 137, 105, 83, 172, 92, 237, 232, 17, 141, 28, 70, 86, 27, 92, 62, 148, 4,
-    68, 210, 129, 161, 166, 71, 162, 222, 0, 90, 71, 19, 240, 214, 246, 218, 167, 133, 57, 233, 21, 44, 206, 215, 180,
-    83, 105, 183, 120, 54, 216, 195, 11, 207, 225, 103, 232, 214, 248, 63, 66, 42, 222, 155, 239, 165, 34, 125, 141, 65,
-    199, 33, 163, 111, 171, 137, 161, 200, 227, 233, 232, 58, 245, 54, 200, 190, 254, 226, 185, 52, 62, 209, 245, 233,
-    29, 138, 223, 197, 21, 249, 142, 177, 94, 8, 12, 77, 41, 226, 92, 228, 239, 54, 33, 129, 227, 207, 44, 53, 54, 207,
-    49, 211, 2, 4, 167, 247, 46, 10, 241, 58, 173, 71, 3, 60, 142, 61, 42, 231, 234, 160, 237, 121, 229, 18, 174, 13,
-    48, 98, 98, 247, 233, 233, 141, 200, 136, 167, 174, 60, 85, 199, 4, 241, 103, 228, 235, 250, 205, 8, 91, 193, 87,
-    205, 72, 178, 114, 65, 41, 123, 128, 180, 255, 236, 11, 214, 47, 10, 190, 246, 71, 189, 165, 255, 42, 124, 164, 49,
-    179, 227, 112, 35, 171, 38, 203, 188, 7, 197, 59, 97, 1, 0, 18, 158, 235, 77, 219, 229, 155, 213, 96, 54, 48, 222,
-    204, 104, 47, 101, 4, 198, 94, 111, 72, 187, 37, 48, 33, 180, 12, 0, 128, 153, 4, 124, 0, 196, 141, 208, 125, 26,
-    116, 145, 101, 62, 71, 102, 47, 135, 192, 232, 144, 202, 155, 139, 80, 110, 170, 250, 106, 181, 8, 27, 235, 24, 65,
-    187, 232, 53, 68, 111, 79, 76, 24, 13, 112, 203, 216, 37, 195, 163, 105, 59, 195, 231, 123, 18, 30, 231, 180, 2,
-    121, 81, 44, 70, 114, 27, 191, 24, 125, 248, 4, 207, 12, 29, 38, 207, 210, 34, 234, 173, 213, 165, 23, 125, 121,
-    119, 98, 182, 137, 219, 24, 204, 111, 6, 21, 69, 176, 86, 40, 87, 125, 166, 158, 93, 114, 157, 242, 174, 21, 193,
-    29, 77, 111, 138, 31, 116, 165, 6, 24, 9, 138, 45, 6, 75, 123, 139, 47, 241, 219, 159, 191, 122, 95, 20, 198, 92,
-    94, 129, 252, 145, 150, 163, 100, 113, 216, 239, 82, 53, 19, 206, 180, 166, 162, 252, 163, 84, 3, 215, 75, 140, 53,
-    208, 132, 163, 95, 132, 183, 167, 97, 185, 177, 173, 215, 225, 150, 192, 231, 124, 16, 178, 37, 77, 6, 46, 174, 226,
-    206, 239, 83, 135, 3, 232, 58, 149, 166, 54, 59, 149, 203, 44, 158, 251, 37, 167, 172, 240, 61, 58, 205, 10, 233,
-    105, 215, 55, 50, 51, 125, 204, 138, 167, 73, 47, 203, 71, 131, 242, 168, 163, 124, 60, 80, 213, 35, 33, 198, 235,
-    68, 1, 46, 1, 161, 134, 253, 186, 41, 48, 204, 175, 17, 70, 22, 36, 228, 78, 59, 1, 198, 31, 49, 123, 167, 167, 60,
-    192, 165, 0, 152, 56, 228, 81, 51, 133, 183, 228, 194, 8, 64, 172, 207, 162, 245, 77, 75, 194, 144, 43, 77, 192, 48,
-    159, 98, 123, 21, 143, 87, 164, 216, 99, 26, 123, 232, 46, 233, 224, 82, 156, 62, 178, 107, 30, 20, 170, 61, 174,
-    185, 26, 168, 222, 12, 166, 84, 152, 31, 128, 46, 209, 7, 86, 164, 153, 41, 75, 22, 210, 243, 11, 22, 236, 59, 96,
-    186, 96, 201, 12, 56, 179, 131, 178, 196, 68, 254, 227, 138, 205, 11, 143, 145, 230, 15, 198, 36, 11, 133, 120, 244,
-    21, 55, 90, 14, 65, 28, 18, 124, 245, 36, 77, 210, 108, 18, 212, 70, 128, 231, 67, 208, 167, 37, 54, 215, 142, 6,
-    212, 55, 58, 215, 73, 126, 240, 80, 135, 99, 169, 233, 156, 252, 135, 181, 87, 194, 167, 232, 41, 119, 79, 117, 190,
-    168, 80, 178, 253, 201, 54, 103, 232, 1, 242, 56, 166, 188, 184, 220, 97, 68, 78, 74, 83, 14, 110, 156, 84, 130,
-    103, 11, 139, 111, 214, 199, 205, 89, 42, 190, 60, 76, 180, 100, 190, 28, 184, 215, 203, 154, 231, 24, 195, 217, 17,
-    65, 59, 61, 141, 229, 102, 197, 87, 163, 128, 134, 114, 145, 114, 55, 91, 73, 164, 131, 76, 68, 97, 168, 91, 90, 11,
-    12, 76, 134, 36, 233, 250, 235, 118, 128, 183, 248, 138, 167, 198, 169, 248, 232, 199, 132, 174, 13, 222, 98, 250,
-    1, 250, 30, 134, 214, 211, 125, 210, 97, 231, 221, 229, 165, 103, 126, 215, 37, 95, 154, 88, 157, 44, 75, 144, 95,
-    73, 212, 222, 172, 244, 48, 112, 236, 231, 132, 161, 91, 151, 210, 10, 205, 119, 165, 17, 200, 60, 211, 74, 51, 225,
-    226, 136, 47, 154, 62, 3, 57, 3, 36, 22, 127, 63, 104, 227, 211, 190, 95, 117, 24, 223, 131, 57, 250, 228, 147, 131,
-    144, 78, 58, 51, 106, 69, 253, 172, 59, 222, 243, 84, 248, 133, 26, 138, 209, 38, 114, 39, 20, 225, 13, 194, 230,
-    184, 98, 204, 131, 42, 33, 112, 172, 253, 53, 178, 34, 117, 188, 148, 250, 216, 126, 199, 95, 122, 20, 194, 132,
-    218, 110, 140, 88, 173, 72, 101, 185, 168, 157, 11, 236, 128, 177, 52, 94, 28, 47, 211, 88, 188, 137, 38, 211, 67,
-    184, 74, 127, 112, 209, 253, 49, 78, 199, 226, 80, 162, 167, 210, 182, 105, 215, 165, 152, 44, 228, 212, 197, 46,
-    170, 162, 47, 242, 154, 221, 49, 49, 56, 134, 126, 243, 188, 148, 235, 199, 194, 78, 16, 51, 164, 228, 178, 104, 78,
-    159, 90, 61, 35, 31, 198, 188, 59, 195, 116, 123, 187, 198, 130, 91, 114, 133, 51, 159, 108, 10, 106, 16, 199, 159,
-    104, 158, 75, 90, 201, 109, 170, 226, 139, 182, 89, 50, 147, 75, 228, 77, 110, 146, 194, 22, 197, 151, 210, 115,
-    181, 176, 83, 16, 122, 49, 25, 227, 105, 53, 110, 232, 76, 23, 55, 230, 151, 85, 122, 119, 84, 229, 161, 52, 97, 48,
-    210, 131, 66, 211, 161, 168, 79, 163, 200, 79, 181, 181, 63, 129, 37, 13, 150, 213, 162, 222, 219, 70, 26, 127, 233,
-    240, 62, 175, 110, 180, 134, 209, 197, 194, 235, 253, 100, 187, 87, 120, 188, 233, 220, 194, 37, 207, 107, 135, 228,
-    202, 221, 120, 217, 230, 59, 241, 151, 63, 4, 218, 43, 237, 3, 87, 98, 120, 7, 147, 240, 240, 19, 203, 210, 57, 88,
-    103, 41, 130, 190, 43, 220, 45, 78, 109, 223, 71, 171, 71, 51, 63, 70, 33, 229, 210, 167, 62, 129, 171, 164, 250,
-    119, 0, 194, 33, 139, 239, 208, 84, 135, 237, 107, 56, 184, 192, 66, 162, 53, 91, 87, 13, 22, 237, 208, 149, 242,
-    147, 111, 102, 98, 232, 216, 129, 125, 225, 221, 67, 218, 219, 175, 73, 227, 123, 74, 13, 68, 245, 96, 74, 91, 154,
-    204, 151, 59, 221, 55, 232, 118, 26, 83, 5, 189, 167, 222, 217, 95, 155, 175, 145, 122, 204, 11, 4, 114, 44, 40, 45,
-    201, 136, 200, 43, 52, 38, 217, 180, 59, 90, 246, 247, 43, 48, 225, 253, 114, 46, 83, 3, 210, 26, 23, 121, 11, 201,
-    8, 65, 135, 80, 216, 1, 178, 120, 180, 84, 48, 184, 68, 181, 14, 114, 189, 184, 109, 250, 206, 125, 171, 65, 13,
-    200, 5, 133, 33, 186, 195, 4, 118, 156, 73, 53, 11, 73, 18, 169, 97, 145, 75, 67, 74, 185, 240, 226, 237, 182, 123,
-    204, 194, 66, 174, 217, 128, 198, 47, 24, 218, 27, 50, 142, 189, 5, 1, 184, 67, 131, 117, 160, 126, 137, 144, 124,
-    36, 33, 14, 138, 102, 49, 118, 13, 6, 6, 174, 92, 71, 118, 128, 129, 17, 194, 181, 234, 255, 82, 37, 201, 31, 69,
-    75, 160, 205, 162, 16, 149, 131, 199, 79, 233, 155, 211, 118, 114, 185, 175, 139, 211, 234, 17, 30, 15, 105, 53,
-    103, 14, 205, 253, 121, 152, 229, 248, 74, 116, 44, 110, 243, 111, 49, 11, 59, 213, 248, 63, 160, 191, 232, 123,
-    166, 141, 177, 199, 15, 182, 75, 14, 81, 223, 182, 23, 12, 92, 150, 54, 15, 123, 119, 228, 49, 237, 228, 164, 116,
-    123, 119, 0, 138, 88, 54, 215, 184, 251, 177, 173, 125, 215, 113, 174, 71, 87, 56, 36, 57, 148, 127, 36, 8, 225,
-    160, 255, 24, 44, 252, 211, 20, 210, 98, 132, 80, 161, 168, 61, 226, 254, 77, 103, 157, 241, 247, 219, 160, 7, 47,
-    6, 125, 247, 37, 243, 137, 85, 212, 133, 238, 215, 192, 228, 55, 188, 254, 4, 14, 2, 5, 121, 71, 99, 156, 216, 254,
-    136, 99, 86, 14, 199, 176, 0, 97, 222, 163, 188, 103, 21, 45, 143, 250, 51, 205, 17, 16, 248, 213, 16, 14, 86, 65,
-    11, 187, 214, 205, 80, 174, 255, 70, 99, 253, 94, 94, 8, 68, 46, 53, 7, 8, 223, 168, 82, 157, 144, 85, 31, 253, 134,
-    148, 214, 108, 235, 59, 28, 43, 53, 109, 73, 232, 11, 205, 200, 45, 198, 214, 149, 140, 180, 199, 162, 180, 99, 253,
-    56, 166, 47, 166, 50, 185, 154, 255, 133, 243, 21, 52, 27, 159, 1, 172, 102, 78, 162, 23, 210, 32, 232, 222, 178,
-    51, 149, 109, 24, 15, 137, 187, 22, 91, 44, 216, 119, 64, 25, 40, 68, 41, 218, 6, 111, 79, 122, 223, 107, 115, 186,
-    49, 16, 88, 232, 87, 252, 50, 26, 81, 247, 133, 70, 214, 242, 146, 8, 59, 199, 177, 122, 172, 37, 170, 239, 16, 163,
-    64, 2, 6, 235, 104, 141, 49, 221, 223, 68, 166, 111, 179, 121, 235, 176, 39, 58, 57, 63, 13, 202, 53, 255, 158, 85,
-    64, 113, 184, 145, 7, 169, 185, 153, 187, 229, 15, 21, 227, 192, 85, 144, 235, 53, 105, 97, 1, 230, 124, 194, 208,
-    111, 109, 88, 189, 16, 163, 19, 50, 158, 172, 76, 115, 172, 83, 200, 215, 66, 162, 23, 236, 188, 53, 48, 102, 25,
-    71, 153, 232, 174, 118, 247, 7, 142, 2, 7, 198, 174, 83, 187, 219, 55, 186, 26, 182, 175, 27, 136, 122, 7, 141, 11,
-    69, 122, 10, 18, 131, 127, 190, 24, 175, 69, 11, 169, 26, 164, 40, 123, 144, 54, 183, 133, 30, 162, 65, 128, 91, 64,
-    17, 27, 102, 60, 50, 237, 58, 28, 253, 114, 218, 83, 194, 32, 228, 183, 113, 218, 109, 116, 215, 114, 46, 179, 122,
-    89, 202, 101, 30, 60, 122, 168, 159, 93, 31, 128, 18, 121, 96, 130, 53, 160, 58, 253, 28, 241, 61, 220, 89, 158, 28,
-    163, 194, 58, 63, 18, 182, 214, 87, 201, 191, 36, 203, 88, 94, 132, 91, 3, 174, 236, 250, 115, 15, 194, 64, 240,
-    157, 240, 173, 255, 134, 168, 104, 198, 82, 72, 132, 171, 31, 141, 46, 40, 210, 189, 9, 86, 242, 17, 149, 18, 12,
-    158, 56, 49, 186, 83, 212, 79, 219, 173, 19, 114, 45, 48, 27, 150, 128, 156, 75, 68, 35, 234, 69, 69, 172, 4, 103,
-    173, 202, 125, 153, 59, 128, 230, 215, 136, 124, 129, 71, 45, 8, 158, 172, 123, 135, 22, 32, 10, 102, 252, 18, 207,
-    240, 252, 189, 155, 194, 173, 44, 60, 47, 190, 92, 104, 2, 213, 29, 132, 13, 237, 223, 89, 72, 81, 194, 25, 136,
-    235, 201, 116, 1, 185, 210, 164, 55, 248, 217, 200, 75, 48, 29, 172, 113, 219, 46, 27, 108, 62, 78, 242, 18, 80,
-    169, 1, 253, 7, 57, 106, 30, 56, 2, 187, 96, 27, 223, 26, 74, 251, 115, 170, 182, 132, 97, 249, 30, 147, 178, 192,
-    124, 205, 67, 105, 111, 150, 51, 68, 21, 87, 196, 102, 183, 115, 0, 153, 67, 248, 243, 10, 115, 61, 17, 238, 215,
-    66, 123, 4, 143, 9, 168, 71, 19, 187, 205, 11, 125, 217, 168, 133, 77, 98, 58, 203, 33, 33, 245, 191, 60, 172, 121,
-    0, 154, 88, 152, 83, 244, 132, 245, 25, 99, 36, 227, 72, 62, 254, 27, 69, 252, 196, 183, 107, 17, 37, 160, 44, 164,
-    178, 99, 184, 49, 237, 198, 38, 99, 109, 62, 114, 68, 93, 166, 63, 58, 198, 164, 240, 225, 217, 23, 80, 85, 35, 229,
-    19, 170, 139, 19, 78, 160, 70, 83, 124, 102, 179, 26, 2, 223, 13, 106, 188, 72, 5, 98, 216, 75, 97, 143, 24, 71,
-    107, 166, 125, 51, 85, 52, 208, 149, 108, 158, 64, 169, 211, 141, 14, 135, 43, 121, 34, 214, 28, 73, 36, 27, 2, 70,
-    38, 167, 32, 123, 45, 139, 92, 81, 139, 186, 29, 175, 144, 54, 102, 15, 250, 74, 200, 181, 124, 23, 17, 96, 28, 135,
-    14, 245, 47, 11, 122, 26, 249, 24, 80, 70, 83, 224, 235, 206, 235, 241, 192, 81, 14, 212, 254, 234, 59, 146, 143,
-    117, 176, 101, 165, 174, 209, 9, 155, 52, 140, 122, 105, 45, 53, 50, 237, 216, 93, 2, 60, 48, 17, 221, 192, 182,
-    104, 38, 68, 126, 166, 97, 78, 107, 131, 96, 103, 40, 174, 153, 115, 132, 89, 78, 44, 206, 175, 115, 176, 238, 113,
-    12, 237, 128, 17, 169, 233, 211, 133, 224, 129, 184, 145, 49, 39, 199, 81, 222, 154, 219, 211, 183, 191, 163, 131,
-    94, 204, 238, 47, 144, 103, 135, 156, 142, 90, 100, 92, 172, 54, 168, 195, 218, 128, 168, 146, 47, 85, 105, 214, 89,
-    88, 112, 149, 138, 198, 168, 39, 254, 127, 176, 51, 148, 105, 76, 163, 204, 96, 242, 178, 115, 35, 28, 222, 17, 58,
-    1, 35, 168, 221, 216, 92, 44, 41, 60, 214, 34, 117, 21, 149, 231, 119, 58, 149, 91, 10, 18, 252, 244, 49, 216, 48,
-    182, 222, 18, 231, 135, 195, 98, 2, 152, 58, 233, 157, 69, 186, 50, 122, 163, 124, 14, 153, 199, 164, 255, 232, 246,
-    74, 80, 166, 59, 210, 210, 242, 136, 160, 231, 74, 154, 76, 232, 77, 22, 75, 177, 194, 7, 58, 138, 222, 184, 110,
-    15, 136, 88, 116, 112, 197, 222, 195, 68, 202, 178, 159, 124, 198, 190, 42, 39, 58, 39, 119, 137, 152, 26, 254, 181,
-    119, 76, 173, 184, 230, 240, 220, 127, 207, 15, 2, 17, 209, 234, 61, 106, 22, 196, 18, 221, 193, 191, 15, 244, 236,
-    102, 221, 62, 191, 28, 121, 184, 82, 203, 30, 203, 142, 244, 139, 47, 50, 160, 215, 121, 211, 95, 203, 182, 184,
-    153, 45, 14, 48, 73, 238, 161, 200, 193, 232, 138, 36, 78, 192, 237, 124, 161, 223, 68, 200, 130, 35, 1, 26, 25,
-    140, 5, 43, 167, 50, 61, 54, 11, 97, 145, 213, 11, 254, 130, 196, 32, 59, 154, 88, 45, 15, 121, 250, 161, 108, 96,
-    39, 168, 223, 92, 217, 224, 210, 124, 119, 242, 113, 142, 186, 214, 236, 156, 78, 31, 60, 121, 232, 34, 101, 216,
-    241, 251, 249, 32, 70, 55, 100, 71, 38, 72, 108, 11, 1, 31, 237, 223, 158, 188, 99, 218, 138, 199, 252, 174, 29,
-    166, 200, 215, 138, 70, 114, 92, 195, 117, 33, 110, 218, 234, 222, 127, 45, 0, 180, 159, 246, 189, 202, 184, 156,
-    236, 202, 45, 157, 235, 246, 123, 218, 78, 65, 67, 196, 202, 192, 225, 99, 83, 131, 20, 130, 130, 54, 107, 217, 213,
-    16, 196, 240, 115, 9, 72, 96, 77, 166, 84, 147, 82, 99, 233, 146, 67, 144, 94, 200, 16, 81, 58, 5, 0, 247, 239, 207,
-    98, 250, 197, 27, 213, 188, 148, 21, 191, 184, 211, 194, 159, 130, 83, 252, 196, 12, 189, 81, 112, 222, 27, 216,
-    189, 202, 250, 207, 197, 174, 31, 24, 250, 63, 141, 78, 90, 174, 180, 27, 19, 88, 68, 35, 224, 162, 41, 34, 204, 85,
-    208, 23, 177, 251, 182, 57, 74, 2, 208, 240, 166, 140, 229, 8, 90, 203, 31, 76, 44, 166, 181, 12, 101, 129, 198,
-    220, 98, 104, 204, 186, 181, 28, 103, 145, 57, 76, 43, 49, 154, 38, 80, 52, 29, 253, 156, 1, 76, 120, 7, 166, 152,
-    41, 179, 87, 23, 5, 141, 53, 217, 14, 253, 49, 31, 61, 15, 191, 121, 56, 36, 30, 201, 41, 79, 203, 13, 56, 114, 85,
-    136, 43, 159, 146, 28, 90, 252, 112, 238, 199, 64, 249, 145, 242, 156, 174, 198, 97, 126, 167, 163, 163, 201, 189,
-    94, 30, 200, 222, 217, 55, 209, 247, 96, 49, 167, 141, 255, 232, 240, 74, 126, 77, 42, 72, 248, 0, 37, 24, 146, 4,
-    115, 211, 56, 107, 208, 83, 88, 77, 52, 124, 115, 137, 224, 31, 103, 106, 154, 126, 236, 16, 246, 221, 181, 154,
-    136, 219, 154, 227, 16, 247, 142, 45, 191, 221, 53, 113, 146, 253, 123, 23, 51, 167, 56, 246, 125, 12, 102, 150,
-    170, 109, 133, 13, 176, 94, 45, 53, 55, 93, 241, 94, 41, 51, 129, 30, 18, 190, 108, 189, 10, 237, 88, 111, 251, 209,
-    95, 158, 112, 198, 19, 25, 253, 232, 210, 202, 48, 50, 116, 105, 245, 33, 105, 103, 241, 124, 20, 105, 178, 227, 68,
-    207, 61, 230, 245, 141, 170, 204, 146, 66, 244, 159, 160, 233, 91, 41, 142, 208, 3, 183, 186, 107, 249, 232, 201,
-    29, 50, 134, 76, 239, 4, 170, 65, 235, 146, 193, 95, 68, 59, 60, 3, 46, 34, 212, 88, 191, 165, 18, 184, 184, 172,
-    230, 127, 86, 46, 118, 103, 206, 67, 56, 117, 140, 51, 176, 18, 52, 128, 0, 42, 1, 11, 68, 144, 71, 54, 46, 122, 99,
-    156, 184, 95, 243, 11, 76, 202, 201, 131, 40, 70, 221, 196, 65, 137, 147, 178, 225, 194, 116, 158, 129, 233, 145,
-    175, 29, 35, 103, 200, 210, 82, 172, 224, 50, 178, 43, 215, 112, 114, 55, 71, 78, 34, 45, 252, 237, 70, 238, 107,
-    22, 87, 119, 9, 170, 230, 9, 227, 184, 112, 169, 28, 130, 14, 232, 181, 61, 195, 25, 136, 1, 237, 116, 185, 12, 159,
-    48, 203, 81, 113, 188, 91, 69, 119, 207, 116, 127, 99, 0, 189, 43, 163, 159, 82, 4, 207, 188, 18, 75, 45, 42, 226,
-    151, 105, 119, 68, 134, 223, 23, 166, 64, 115, 224, 100, 87, 214, 158, 189, 14, 231, 14, 36, 18, 135, 240, 242, 168,
-    159, 93, 124, 184, 233, 81, 229, 97, 132, 35, 207, 247, 229, 189, 167, 36, 142, 148, 59, 213, 66, 37, 24, 107, 139,
-    83, 200, 184, 78, 45, 4, 215, 114, 50, 165, 250, 120, 155, 97, 44, 10, 191, 31, 48, 185, 77, 9, 12, 79, 22, 84, 136,
-    147, 4, 177, 129, 100, 69, 43, 128, 158, 43, 246, 97, 201, 94, 2, 98, 54, 188, 26, 182, 51, 79, 177, 224, 31, 68,
-    156, 75, 194, 121, 30, 98, 70, 101, 143, 100, 182, 4, 245, 48, 5, 1, 169, 86, 231, 209, 250, 191, 113, 169, 34, 169,
-    53, 73, 99, 55, 221, 19, 190, 213, 117, 8, 129, 101, 2, 49, 107, 57, 156, 195, 118, 52, 56, 152, 132, 12, 103, 72,
-    173, 64, 75, 230, 62, 189, 1, 46, 8, 189, 64, 239, 7, 46, 223, 68, 226, 26, 152, 140, 195, 101, 22, 246, 151, 123,
-    42, 6, 91, 0, 30, 103, 199, 29, 180, 40, 142, 150, 164, 56, 53, 224, 226, 146, 99, 36, 48, 72, 51, 31, 161, 241,
-    173, 55, 225, 22, 79, 242, 87, 66, 38, 206, 9, 0, 90, 251, 252, 66, 114, 63, 150, 209, 18, 20, 153, 82, 96, 251,
-    232, 180, 32, 6, 44, 200, 30, 23, 112, 209, 100, 253, 249, 228, 126, 24, 165, 244, 241, 61, 192, 223, 245, 120, 127,
-    205, 74, 25, 185, 78, 139, 118, 148, 253, 76, 148, 229, 13, 1, 20, 191, 212, 107, 200, 109, 103, 30, 62, 112, 170,
-    204, 135, 95, 208, 145, 116, 215, 82, 44, 217, 204, 92, 238, 228, 75, 216, 237, 236, 125, 86, 52, 141, 36, 208, 115,
-    198, 7, 17, 82, 23, 41, 254, 95, 159, 208, 62, 187, 253, 172, 172, 46, 255, 56, 208, 158, 62, 87, 194, 149, 175,
-    215, 248, 229, 241, 27, 201, 23, 177, 30, 79, 86, 11, 238, 154, 108, 92, 99, 155, 117, 133, 255, 29, 35, 43, 21,
-    162, 19, 102, 142, 103, 77, 6, 93, 22, 79, 110, 108, 58, 111, 251, 199, 49, 105, 230, 3, 30, 77, 244, 150, 132, 227,
-    46, 79, 143, 56, 85, 20, 133, 234, 127, 72, 138, 91, 34, 151, 104, 33, 93, 35, 246, 214, 71, 194, 16, 154, 29, 95,
-    148, 239, 184, 149, 139, 203, 169, 5, 235, 0, 95, 9, 115, 129, 223, 99, 186, 117, 233, 51, 221, 213, 177, 65, 18,
-    163, 209, 187, 126, 28, 65, 73, 0, 84, 21, 8, 125, 170, 44, 39, 12, 164, 147, 98, 83, 175, 58, 231, 206, 79, 44, 64,
-    31, 179, 52, 122, 201, 67, 84, 197, 144, 53, 176, 148, 87, 25, 177, 105, 158, 218, 233, 75, 109, 105, 234, 161, 146,
-    238, 23, 76, 171, 220, 46, 240, 247, 172, 169, 142, 211, 148, 74, 79, 186, 190, 187, 45, 23, 68, 153, 31, 166, 91,
-    240, 239, 110, 34, 5, 165, 48, 190, 93, 223, 163, 95, 236, 89, 170, 251, 96, 211, 31, 148, 155, 64, 16, 253, 153,
-    14, 212, 62, 76, 37, 140, 145, 85, 183, 112, 147, 0, 212, 180, 250, 200, 140, 194, 7, 255, 82, 17, 195, 4, 157, 23,
-    187, 4, 128, 77, 189, 99, 168, 213, 205, 29, 182, 224, 198, 132, 209, 148, 66, 98, 74, 143, 194, 230, 142, 138, 220,
-    84, 156, 232, 25, 11, 169, 242, 112, 66, 212, 130, 52, 96, 134, 41, 166, 189, 189, 158, 127, 234, 243, 186, 230,
-    117, 75, 27, 50, 97, 29, 42, 230, 134, 55, 133, 225, 70, 210, 154, 225, 236, 162, 36, 129, 121, 15, 253, 140, 146,
-    132, 80, 74, 18, 11, 66, 55, 233, 242, 81, 36, 44, 130, 4, 41, 125, 125, 84, 45, 49, 169, 174, 102, 219, 72, 96, 60,
-    160, 76, 176, 253, 17, 75, 148, 34, 102, 100, 19, 204, 231, 101, 78, 121, 74, 14, 85, 188, 3, 163, 250, 222, 194,
-    201, 193, 63, 138, 55, 47, 246, 53, 104, 159, 170, 231, 79, 55, 7, 218, 163, 68, 166, 76, 191, 171, 94, 93, 207,
-    165, 21, 235, 27, 167, 122, 206, 197, 32, 222, 243, 129, 202, 67, 96, 16, 16, 137, 194, 16, 14, 132, 1, 48, 104, 52,
-    250, 217, 117, 137, 82, 199, 153, 155, 88, 52, 82, 39, 209, 103, 151, 41, 105, 140, 144, 149, 104, 0, 78, 100, 37,
-    92, 226, 255, 115, 144, 167, 185, 78, 238, 103, 2, 56, 126, 23, 238, 248, 177, 233, 23, 3, 180, 5, 167, 136, 184,
-    173, 230, 49, 10, 223, 190, 80, 176, 157, 16, 156, 83, 54, 114, 122, 112, 201, 196, 190, 178, 53, 35, 77, 54, 30,
-    239, 236, 87, 106, 107, 27, 214, 250, 21, 206, 183, 173, 139, 241, 98, 127, 191, 141, 154, 73, 43, 199, 229, 120,
-    38, 249, 231, 129, 155, 252, 31, 105, 66, 74, 231, 133, 213, 20, 219, 150, 147, 216, 196, 75, 70, 78, 10, 184, 30,
-    5, 166, 243, 249, 105, 115, 232, 222, 154, 96, 27, 26, 50, 245, 119, 144, 197, 150, 4, 114, 35, 38, 118, 7, 87, 119,
-    140, 126, 201, 218, 93, 142, 74, 231, 253, 218, 229, 255, 222, 137, 139, 70, 77, 77, 144, 90, 74, 8, 128, 56, 196,
-    113, 167, 130, 112, 49, 38, 61, 232, 109, 72, 174, 74, 60, 139, 243, 66, 77, 154, 241, 190, 118, 239, 78, 187, 167,
-    202, 246, 209, 55, 169, 51, 143, 194, 66, 64, 74, 40, 190, 130, 133, 197, 54, 236, 233, 44, 198, 126, 33, 118, 113,
-    27, 36, 171, 168, 51, 251, 167, 247, 247, 160, 159, 205, 142, 195, 162, 137, 121, 53, 62, 46, 245, 57, 224, 139,
-    169, 157, 122, 5, 146, 11, 253, 87, 144, 222, 11, 192, 101, 22, 192, 83, 57, 129, 115, 177, 76, 61, 74, 185, 197,
-    95, 116, 157, 147, 216, 182, 153, 85, 248, 228, 107, 31, 70, 12, 209, 206, 230, 115, 46, 122, 142, 230, 198, 72, 78,
-    41, 41, 30, 92, 45, 187, 123, 68, 209, 254, 154, 48, 7, 96, 76, 147, 118, 23, 142, 160, 106, 151, 129, 116, 108, 52,
-    18, 172, 112, 0, 192, 135, 69, 206, 5, 212, 37, 38, 192, 64, 120, 166, 160, 239, 53, 214, 144, 4, 227, 110, 86, 171,
-    112, 203, 156, 129, 21, 251, 164, 102, 117, 22, 140, 8, 29, 17, 24, 168, 133, 126, 239, 39, 249, 62, 78, 222, 225,
-    118, 4, 50, 1, 236, 79, 237, 84, 154, 107, 66, 239, 99, 78, 7, 100, 244, 22, 9, 212, 178, 136, 10, 114, 158, 178,
-    59, 175, 194, 73, 160, 224, 79, 88, 253, 164, 107, 140, 156, 254, 112, 175, 80, 80, 171, 9, 55, 177, 212, 113, 242,
-    47, 31, 8, 175, 128, 123, 200, 30, 89, 104, 53, 57, 79, 29, 214, 83, 159, 22, 192, 189, 105, 213, 201, 197, 197,
-    108, 124, 23, 246, 74, 246, 86, 175, 230, 148, 33, 134, 171, 180, 29, 155, 53, 46, 83, 232, 99, 112, 35, 124, 229,
-    221, 141, 63, 243, 121, 129, 204, 11, 244, 123, 199, 1, 62, 114, 167, 194, 12, 224, 14, 115, 145, 148, 38, 62, 226,
-    5, 39, 141, 102, 121, 97, 11, 108, 74, 75, 69, 57, 174, 181, 55, 116, 21, 131, 52, 21, 24, 36, 238, 42, 70, 166,
-    168, 71, 183, 138, 85, 122, 249, 32, 40, 88, 150, 40, 6, 19, 235, 208, 69, 33, 248, 139, 135, 140, 2, 48, 222, 205,
-    13, 138, 194, 91, 215, 64, 87, 199, 27, 64, 192, 13, 79, 152, 140, 169, 227, 4, 63, 176, 2, 64, 41, 185, 226, 176,
-    155, 63, 54, 75, 168, 97, 26, 46, 105, 205, 202, 90, 175, 216, 158, 89, 55, 91, 110, 190, 185, 103, 68, 14, 149,
-    134, 88, 101, 64, 217, 202, 137, 122, 132, 119, 35, 79, 163, 17, 110, 56, 111, 56, 19, 163, 42, 177, 126, 95, 1,
-    253, 27, 235, 108, 179, 216, 138, 93, 117, 92, 44, 176, 234, 191, 197, 30, 22, 169, 241, 8, 166, 139, 165, 170, 227,
-    189, 193, 111, 204, 85, 80, 253, 12, 42, 235, 162, 227, 106, 51, 159, 30, 41, 57, 99, 185, 139, 61, 18, 92, 205,
-    149, 93, 231, 118, 174, 104, 212, 120, 94, 124, 79, 175, 16, 232, 101, 179, 203, 25, 165, 238, 127, 247, 50, 99, 41,
-    51, 61, 180, 23, 92, 163, 248, 113, 149, 223, 16, 116, 38, 115, 49, 25, 114, 243, 128, 109, 196, 10, 12, 177, 180,
-    226, 88, 211, 170, 235, 44, 237, 194, 103, 242, 102, 5, 112, 67, 65, 242, 18, 92, 74, 220, 101, 108, 25, 93, 182,
-    99, 255, 249, 48, 23, 155, 32, 102, 4, 213, 228, 151, 76, 68, 47, 226, 157, 111, 108, 19, 183, 220, 69, 216, 195,
-    235, 186, 152, 246, 156, 43, 103, 54, 76, 186, 109, 199, 57, 215, 40, 160, 198, 243, 36, 250, 3, 62, 117, 174, 87,
-    171, 119, 148, 87, 133, 204, 184, 124, 28, 7, 246, 28, 227, 118, 13, 32, 72, 98, 38, 254, 22, 128, 206, 248, 142,
-    28, 239, 149, 7, 252, 232, 155, 219, 111, 101, 60, 144, 133, 125, 20, 253, 69, 70, 11, 244, 195, 241, 247, 243, 149,
-    62, 38, 233, 224, 47, 195, 184, 124, 19, 190, 96, 3, 95, 163, 56, 181, 149, 127, 77, 139, 138, 216, 65, 157, 78, 51,
-    83, 135, 8, 79, 143, 197, 169, 223, 212, 125, 77, 228, 9, 22, 109, 174, 115, 85, 240, 60, 6, 105, 72, 73, 9, 207,
-    42, 248, 68, 186, 64, 46, 230, 123, 72, 82, 184, 77, 90, 235, 13, 139, 123, 136, 158, 105, 98, 212, 82, 57, 130,
-    162, 29, 87, 192, 74, 24, 20, 163, 49, 154, 163, 28, 172, 106, 150, 57, 101, 241, 48, 65, 166, 158, 203, 249, 87,
-    89, 196, 231, 236, 77, 212, 150, 207, 251, 123, 12, 13, 193, 175, 237, 220, 174, 239, 91, 144, 123, 9, 237, 73, 121,
-    141, 216, 242, 203, 58, 27, 105, 134, 50, 186, 205, 122, 3, 13, 213, 249, 171, 173, 219, 67, 196, 42, 107, 23, 150,
-    8, 126, 171, 127, 58, 143, 14, 198, 38, 136, 223, 61, 61, 187, 124, 224, 54, 255, 97, 60, 93, 178, 43, 120, 6, 65,
-    73, 45, 178, 156, 6, 84, 41, 64, 249, 254, 229, 158, 34, 249, 39, 0, 31, 166, 41, 209, 243, 227, 102, 138, 255, 134,
-    50, 145, 230, 169, 128, 12, 63, 155, 159, 184, 243, 125, 86, 4, 198, 29, 93, 133, 220, 253, 107, 178, 24, 189, 113,
-    118, 32, 143, 101, 41, 82, 220, 10, 54, 161, 135, 50, 81, 82, 23, 121, 204, 202, 230, 2, 210, 147, 166, 235, 88,
-    241, 149, 45, 172, 84, 114, 47, 222, 86, 105, 154, 209, 134, 37, 213, 145, 235, 153, 158, 181, 98, 110, 168, 96,
-    253, 169, 40, 24, 255, 48, 43, 117, 8, 224, 208, 23, 189, 14, 121, 14, 38, 207, 181, 76, 96, 224, 239, 152, 205, 39,
-    216, 96, 10, 225, 110, 244, 7, 239, 21, 31, 97, 52, 43, 40, 250, 24, 173, 94, 100, 65, 153, 39, 82, 8, 227, 125,
-    210, 62, 9, 101, 151, 168, 214, 221, 178, 35, 142, 130, 111, 190, 134, 25, 13, 112, 178, 40, 120, 246, 176, 51, 34,
-    206, 187, 190, 124, 12, 57, 113, 188, 63, 4, 114, 146, 136, 8, 144, 120, 17, 163, 247, 204, 95, 132, 161, 21, 76, 2,
-    72, 74, 236, 172, 222, 58, 50, 71, 138, 215, 124, 28, 178, 106, 234, 176, 133, 13, 121, 85, 118, 255, 84, 35, 59,
-    19, 72, 241, 40, 125, 59, 50, 129, 23, 109, 27, 127, 164, 183, 114, 141, 17, 122, 189, 243, 210, 172, 245, 50, 55,
-    170, 52, 245, 151, 157, 36, 171, 3, 207, 53, 52, 175, 97, 156, 226, 183, 234, 60, 158, 208, 186, 134, 146, 196, 188,
-    133, 19, 100, 80, 5, 188, 34, 239, 233, 167, 204, 54, 59, 120, 121, 124, 61, 63, 137, 131, 118, 29, 11, 217, 115,
-    244, 40, 34, 194, 32, 241, 87, 143, 211, 83, 177, 210, 21, 176, 73, 150, 88, 94, 185, 141, 16, 182, 12, 165, 240,
-    168, 156, 128, 150, 137, 83, 57, 243, 68, 204, 218, 21, 89, 240, 232, 35, 54, 211, 145, 183, 62, 67, 181, 94, 130,
-    82, 127, 15, 66, 159, 158, 242, 98, 172, 151, 70, 101, 234, 213, 99, 198, 188, 210, 194, 175, 217, 213, 198, 107,
-    57, 219, 193, 5, 63, 144, 101, 111, 94, 50, 108, 83, 117, 192, 76, 80, 188, 238, 199, 67, 151, 14, 29, 224, 25, 17,
-    202, 165, 37, 251, 200, 107, 149, 157, 228, 182, 168, 131, 38, 39, 2, 200, 197, 127, 159, 13, 167, 223, 5, 123, 154,
-    215, 214, 56, 54, 2, 218, 62, 77, 15, 175, 40, 169, 225, 188, 36, 193, 65, 197, 210, 216, 70, 247, 69, 62, 196, 210,
-    148, 126, 214, 124, 115, 62, 39, 218, 48, 79, 14, 217, 71, 102, 72, 160, 248, 189, 19, 99, 57, 175, 132, 109, 180,
-    27, 141, 163, 122, 151, 22, 236, 236, 249, 233, 21, 92, 57, 237, 176, 121, 16, 124, 189, 227, 79, 245, 12, 41, 41,
-    250, 152, 252, 243, 100, 49, 179, 222, 27, 32, 52, 48, 227, 91, 215, 109, 112, 28, 0, 18, 252, 59, 78, 15, 181, 69,
-    105, 183, 107, 105, 11, 162, 221, 149, 178, 86, 93, 114, 135, 62, 118, 61, 75, 227, 114, 174, 254, 194, 67, 214,
-    235, 10, 74, 52, 82, 153, 182, 197, 91, 127, 175, 163, 21, 193, 128, 66, 200, 207, 165, 174, 126, 12, 32, 178, 68,
-    32, 203, 28, 95, 117, 247, 213, 144, 197, 224, 182, 51, 60, 193, 136, 81, 112, 129, 114, 199, 7, 224, 12, 123, 210,
-    132, 235, 206, 110, 111, 155, 21, 136, 218, 166, 202, 87, 232, 212, 221, 162, 176, 186, 137, 31, 44, 110, 248, 214,
-    243, 77, 131, 233, 100, 104, 77, 31, 108, 179, 83, 244, 12, 105, 214, 245, 232, 248, 73, 8, 119, 253, 124, 106, 135,
-    196, 163, 100, 146, 123, 181, 138, 125, 147, 104, 74, 220, 92, 238, 179, 10, 224, 217, 17, 128, 191, 252, 36, 40,
-    115, 243, 245, 91, 213, 169, 242, 116, 190, 59, 147, 51, 48, 150, 166, 220, 76, 164, 171, 135, 162, 163, 188, 99,
-    41, 197, 119, 170, 106, 21, 201, 55, 218, 212, 54, 176, 27, 147, 228, 5, 161, 79, 251, 16, 195, 13, 198, 28, 254,
-    203, 226, 66, 214, 10, 26, 246, 200, 95, 176, 115, 121, 18, 77, 121, 19, 237, 106, 89, 115, 77, 23, 63, 12, 146,
-    109, 24, 234, 233, 24, 229, 30, 244, 54, 215, 91, 193, 46, 83, 148, 223, 240, 29, 248, 82, 166, 8, 244, 249, 98,
-    191, 118, 112, 186, 4, 190, 133, 167, 121, 205, 185, 81, 231, 87, 75, 106, 158, 63, 212, 246, 71, 203, 97, 70, 145,
-    71, 47, 222, 252, 55, 226, 21, 147, 180, 10, 38, 95, 90, 7, 240, 180, 92, 190, 132, 179, 197, 135, 52, 7, 254, 111,
-    104, 235, 170, 252, 26, 87, 203, 9, 61, 190, 56, 44, 90, 118, 131, 197, 150, 105, 92, 69, 239, 180, 239, 181, 75, 2,
-    207, 117, 233, 59, 91, 223, 154, 216, 119, 42, 150, 5, 67, 69, 241, 185, 130, 223, 39, 225, 17, 223, 65, 18, 89,
-    249, 161, 164, 172, 243, 102, 237, 163, 247, 4, 241, 12, 165, 45, 105, 163, 111, 82, 103, 8, 237, 153, 92, 68, 251,
-    121, 246, 210, 183, 196, 145, 144, 232, 7, 119, 250, 253, 136, 130, 121, 143, 4, 233, 2, 25, 101, 144, 253, 103,
-    188, 2, 231, 184, 143, 254, 87, 6, 244, 214, 172, 195, 76, 181, 239, 15, 115, 126, 10, 251, 55, 238, 171, 230, 172,
-    67, 151, 85, 202, 166, 27, 138, 42, 119, 136, 144, 200, 52, 179, 34, 32, 119, 16, 69, 183, 65, 138, 218, 113, 88,
-    133, 236, 90, 49, 146, 150, 151, 202, 139, 244, 241, 207, 166, 129, 14, 120, 131, 126, 4, 153, 156, 136, 224, 170,
-    103, 184, 146, 113, 201, 134, 142, 8, 58, 158, 68, 50, 30, 80, 85, 112, 80, 186, 55, 16, 114, 96, 48, 246, 192, 24,
-    210, 197, 80, 45, 177, 151, 72, 53, 43, 48, 107, 0, 184, 78, 66, 117, 54, 110, 53, 21, 167, 88, 178, 217, 176, 182,
-    203, 67, 176, 23, 83, 228, 195, 65, 110, 124, 13, 171, 200, 191, 8, 2, 140, 249, 128, 123, 177, 37, 187, 48, 70,
-    202, 67, 92, 66, 116, 236, 19, 123, 177, 3, 110, 14, 208, 94, 255, 66, 239, 77, 106, 189, 149, 49, 50, 53, 144, 9,
-    98, 177, 13, 201, 24, 57, 144, 90, 127, 148, 6, 111, 55, 163, 247, 23, 183, 38, 51, 16, 216, 134, 82, 189, 16, 134,
-    240, 68, 213, 132, 219, 111, 84, 113, 17, 175, 211, 92, 29, 234, 190, 76, 41, 58, 232, 54, 34, 130, 224, 121, 37,
-    151, 144, 176, 67, 48, 80, 126, 180, 203, 135, 113, 255, 198, 225, 249, 95, 221, 154, 252, 76, 201, 207, 24, 103,
-    186, 33, 194, 17, 34, 122, 173, 18, 87, 248, 181, 86, 191, 162, 166, 32, 28, 4, 156, 228, 0, 8, 248, 152, 14, 105,
-    186, 70, 71, 197, 45, 31, 231, 43, 84, 224, 253, 169, 95, 238, 126, 218, 5, 36, 233, 172, 190, 152, 225, 94, 111,
-    152, 196, 133, 113, 246, 116, 98, 13, 212, 134, 230, 158, 72, 41, 56, 202, 83, 168, 23, 52, 45, 214, 178, 91, 244,
-    135, 107, 28, 35, 162, 119, 158, 56, 125, 203, 210, 66, 216, 255, 203, 29, 251, 244, 255, 188, 156, 56, 82, 3, 70,
-    244, 162, 196, 75, 133, 38, 125, 163, 105, 6, 38, 128, 246, 157, 231, 156, 106, 154, 219, 119, 163, 127, 118, 65,
-    38, 43, 224, 74, 30, 10, 197, 186, 117, 222, 87, 94, 107, 148, 29, 247, 165, 8, 55, 83, 1, 166, 84, 5, 187, 188,
-    196, 93, 57, 87, 253, 166, 48, 8, 66, 163, 48, 247, 107, 232, 105, 60, 132, 157, 46, 58, 11, 102, 7, 175, 239, 107,
-    183, 229, 180, 169, 175, 169, 163, 108, 154, 53, 244, 203, 63, 39, 142, 238, 197, 122, 127, 163, 127, 153, 212, 6,
-    139, 224, 99, 118, 68, 102, 235, 245, 51, 10, 90, 224, 187, 241, 223, 57, 95, 184, 105, 120, 4, 22, 24, 149, 107,
-    131, 135, 119, 16, 213, 187, 106, 187, 31, 203, 84, 170, 159, 16, 170, 213, 72, 130, 84, 233, 92, 221, 104, 2, 255,
-    217, 188, 137, 252, 158, 155, 12, 35, 126, 20, 193, 0, 68, 232, 89, 24, 174, 248, 82, 230, 8, 197, 2, 24, 194, 38,
-    142, 168, 135, 176, 242, 185, 188, 244, 168, 159, 188, 201, 2, 253, 124, 175, 145, 120, 82, 210, 29, 108, 194, 192,
-    249, 43, 75, 105, 24, 179, 228, 221, 38, 132, 208, 183, 82, 13, 24, 189, 22, 152, 59, 6, 108, 99, 9, 249, 166, 184,
-    183, 46, 52, 222, 194, 81, 159, 16, 72, 251, 101, 251, 228, 140, 218, 239, 97, 147, 216, 143, 111, 177, 200, 141,
-    233, 47, 129, 49, 95, 75, 24, 88, 248, 135, 138, 210, 108, 69, 54, 250, 51, 20, 234, 24, 16, 71, 188, 44, 41, 104,
-    189, 99, 134, 213, 247, 192, 239, 122, 149, 184, 167, 7, 252, 124, 29, 196, 216, 146, 89, 67, 238, 19, 52, 25, 148,
-    178, 69, 83, 144, 87, 213, 234, 225, 20, 123, 95, 186, 105, 229, 221, 105, 237, 184, 166, 170, 211, 217, 150, 138,
-    46, 149, 62, 30, 52, 64, 16, 172, 162, 228, 134, 144, 64, 161, 175, 32, 196, 53, 125, 34, 78, 149, 3, 134, 248, 30,
-    144, 222, 169, 25, 24, 33, 175, 243, 117, 145, 179, 98, 90, 3, 123, 136, 90, 204, 34, 82, 143, 91, 67, 136, 31, 128,
-    189, 106, 39, 54, 205, 206, 58, 198, 39, 83, 103, 74, 52, 2, 227, 16, 149, 251, 83, 80, 166, 224, 125, 83, 119, 40,
-    32, 108, 72, 118, 221, 42, 29, 61, 122, 58, 65, 107, 209, 193, 59, 244, 34, 213, 197, 243, 31, 226, 56, 48, 54, 170,
-    239, 165, 112, 236, 196, 39, 198, 155, 71, 29, 86, 104, 105, 248, 167, 218, 157, 239, 15, 58, 26, 150, 46, 141, 15,
-    206, 169, 122, 250, 131, 202, 36, 141, 106, 41, 171, 30, 197, 92, 239, 231, 174, 3, 234, 135, 246, 22, 229, 166,
-    193, 170, 230, 169, 220, 5, 8, 240, 202, 74, 124, 153, 93, 195, 68, 10, 51, 138, 229, 103, 21, 110, 41, 223, 97,
-    249, 29, 212, 31, 146, 113, 113, 86, 230, 161, 18, 140, 141, 135, 144, 86, 0, 61, 207, 174, 179, 245, 61, 152, 163,
-    3, 199, 247, 162, 42, 107, 193, 143, 204, 53, 46, 89, 145, 225, 126, 78, 111, 154, 96, 6, 8, 51, 48, 242, 143, 190,
-    76, 14, 173, 49, 71, 170, 165, 196, 55, 138, 170, 119, 84, 65, 37, 123, 227, 172, 6, 130, 70, 65, 226, 2, 190, 33,
-    90, 158, 53, 137, 131, 48, 231, 59, 48, 155, 131, 176, 9, 71, 35, 72, 174, 100, 165, 209, 155, 194, 8, 215, 191,
-    139, 98, 69, 251, 161, 227, 150, 54, 30, 13, 73, 119, 121, 251, 54, 139, 67, 107, 76, 53, 46, 234, 142, 51, 179,
-    238, 58, 77, 222, 18, 108, 200, 24, 50, 164, 26, 181, 62, 158, 151, 127, 104, 233, 75, 134, 133, 247, 78, 138, 131,
-    182, 214, 192, 216, 254, 251, 41, 212, 230, 209, 68, 181, 16, 107, 175, 20, 115, 196, 92, 78, 20, 87, 82, 156, 42,
-    158, 101, 148, 48, 234, 171, 34, 119, 237, 204, 56, 123, 206, 173, 35, 48, 172, 218, 38, 235, 12, 112, 184, 166,
-    216, 74, 98, 201, 196, 13, 172, 95, 39, 139, 191, 151, 156, 90, 40, 33, 181, 69, 228, 126, 252, 37, 254, 213, 8,
-    163, 171, 10, 90, 39, 124, 162, 81, 29, 228, 250, 83, 21, 51, 82, 120, 188, 25, 172, 163, 237, 221, 241, 214, 158,
-    49, 194, 35, 162, 85, 234, 20, 204, 4, 52, 163, 92, 56, 0, 68, 184, 173, 222, 95, 56, 96, 38, 7, 100, 155, 243, 232,
-    238, 0, 86, 190, 58, 1, 71, 232, 17, 6, 112, 176, 13, 81, 249, 243, 129, 183, 248, 104, 75, 49, 50, 3, 63, 13, 145,
-    231, 67, 201, 117, 103, 152, 89, 114, 83, 24, 98, 101, 22, 90, 153, 23, 172, 120, 56, 6, 204, 180, 155, 180, 150,
-    184, 135, 179, 231, 127, 99, 153, 1, 228, 52, 119, 81, 185, 163, 116, 152, 167, 12, 254, 169, 150, 186, 222, 7, 236,
-    33, 60, 178, 185, 101, 247, 214, 76, 79, 248, 18, 39, 84, 20, 148, 219, 75, 152, 66, 115, 27, 237, 202, 69, 98, 45,
-    79, 199, 172, 133, 114, 188, 155, 196, 192, 76, 192, 234, 98, 101, 119, 64, 165, 142, 128, 168, 45, 17, 83, 43, 15,
-    116, 89, 206, 230, 9, 148, 14, 83, 153, 185, 184, 203, 47, 1, 167, 115, 137, 103, 215, 113, 78, 158, 71, 5, 122,
-    237, 66, 213, 238, 249, 202, 139, 133, 160, 20, 115, 60, 214, 229, 196, 120, 72, 107, 168, 56, 87, 11, 101, 131,
-    228, 14, 188, 79, 175, 171, 46, 63, 100, 75, 150, 7, 36, 234, 47, 226, 182, 251, 165, 54, 11, 233, 142, 52, 81, 186,
-    208, 86, 241, 219, 137, 1, 234, 80, 127, 128, 11, 90, 176, 182, 252, 186, 241, 64, 69, 191, 87, 10, 65, 155, 71,
-    177, 118, 142, 2, 190, 95, 46, 83, 138, 50, 6, 201, 160, 121, 44, 9, 193, 87, 22, 66, 231, 113, 11, 112, 150, 42,
-    230, 179, 218, 254, 44, 208, 234, 12, 72, 229, 9, 202, 61, 148, 135, 244, 71, 250, 38, 216, 53, 134, 102, 41, 53,
-    190, 209, 167, 117, 41, 31, 206, 112, 247, 175, 126, 0, 39, 86, 156, 19, 166, 112, 85, 89, 87, 254, 46, 199, 176,
-    171, 106, 177, 90, 231, 240, 101, 86, 24, 242, 5, 39, 28, 39, 0, 133, 110, 180, 157, 4, 217, 40, 124, 147, 77, 98,
-    78, 150, 216, 36, 37, 108, 186, 56, 163, 43, 182, 174, 141, 141, 80, 105, 1, 219, 233, 208, 245, 8, 111, 242, 97,
-    215, 0, 130, 222, 163, 28, 1, 170, 141, 205, 180, 166, 103, 87, 222, 58, 146, 76, 186, 172, 93, 202, 42, 186, 73,
-    166, 116, 197, 118, 146, 50, 56, 55, 178, 186, 239, 33, 221, 210, 7, 159, 107, 49, 167, 183, 10, 243, 155, 252, 189,
-    236, 240, 167, 158, 181, 185, 138, 254, 27, 173, 220, 69, 78, 6, 74, 58, 10, 198, 94, 62, 22, 16, 236, 81, 242, 143,
-    79, 162, 52, 124, 101, 169, 126, 249, 101, 178, 160, 224, 117, 195, 222, 151, 243, 192, 153, 138, 147, 149, 31, 21,
-    85, 161, 57, 121, 116, 23, 101, 180, 225, 42, 174, 222, 137, 81, 98, 182, 111, 230, 248, 201, 88, 75, 1, 48, 21, 17,
-    168, 216, 32, 123, 211, 242, 253, 135, 209, 195, 38, 30, 53, 220, 117, 121, 11, 190, 120, 108, 184, 93, 173, 38,
-    149, 116, 19, 178, 239, 5, 104, 203, 2, 211, 228, 155, 178, 78, 49, 237, 193, 40, 117, 44, 249, 187, 71, 138, 44,
-    65, 250, 114, 186, 163, 253, 102, 29, 41, 104, 226, 209, 47, 95, 179, 167, 190, 8, 166, 230, 88, 161, 217, 202, 197,
-    183, 82, 209, 129, 165, 195, 168, 129, 252, 217, 33, 94, 220, 158, 37, 149, 38, 128, 233, 11, 154, 46, 5, 36, 174,
-    142, 237, 1, 74, 225, 170, 16, 134, 163, 33, 75, 8, 175, 62, 27, 223, 229, 97, 28, 239, 133, 23, 69, 160, 85, 202,
-    232, 133, 47, 217, 9, 21, 120, 59, 87, 18, 155, 117, 54, 160, 166, 61, 68, 101, 206, 187, 6, 231, 198, 201, 0, 128,
-    62, 38, 40, 244, 173, 67, 24, 236, 13, 249, 164, 45, 190, 179, 36, 204, 46, 119, 196, 189, 65, 25, 106, 14, 203,
-    254, 128, 226, 37, 244, 15, 246, 86, 179, 75, 63, 163, 96, 250, 39, 122, 138, 219, 43, 85, 102, 147, 169, 146, 118,
-    183, 244, 156, 23, 35, 217, 133, 244, 125, 247, 66, 123, 242, 90, 54, 185, 121, 131, 64, 212, 21, 248, 51, 247, 234,
-    237, 142, 192, 39, 179, 163, 208, 24, 247, 222, 26, 235, 14, 6, 17, 189, 231, 126, 72, 139, 101, 3, 113, 36, 184,
-    242, 206, 29, 144, 159, 12, 162, 15, 76, 41, 10, 190, 201, 227, 0, 26, 41, 71, 27, 254, 45, 125, 252, 124, 47, 216,
-    176, 153, 92, 111, 43, 68, 130, 166, 161, 231, 158, 173, 146, 103, 63, 118, 101, 10, 173, 89, 194, 8, 72, 118, 248,
-    34, 183, 234, 54, 126, 171, 89, 171, 24, 42, 41, 51, 129, 110, 240, 98, 204, 164, 150, 225, 37, 127, 195, 123, 186,
-    216, 28, 46, 151, 52, 208, 181, 66, 17, 96, 135, 132, 59, 17, 8, 134, 112, 248, 168, 218, 15, 243, 130, 105, 25, 78,
-    71, 2, 118, 176, 42, 20, 27, 67, 96, 219, 248, 228, 67, 212, 73, 3, 174, 134, 246, 78, 240, 88, 12, 86, 171, 162,
-    221, 44, 132, 68, 0, 43, 72, 163, 10, 82, 85, 205, 250, 249, 185, 10, 9, 65, 182, 243, 67, 135, 28, 107, 4, 25, 111,
-    120, 24, 28, 23, 194, 186, 49, 187, 180, 33, 10, 189, 52, 63, 102, 57, 117, 65, 143, 117, 98, 84, 2, 19, 220, 27,
-    47, 133, 156, 141, 76, 117, 47, 240, 69, 129, 122, 90, 255, 99, 27, 220, 142, 30, 245, 197, 107, 232, 136, 23, 56,
-    116, 223, 220, 50, 211, 84, 240, 2, 188, 227, 66, 242, 185, 66, 180, 142, 233, 53, 179, 125, 137, 38, 227, 141, 144,
-    9, 79, 157, 103, 174, 104, 125, 222, 191, 166, 39, 104, 234, 246, 157, 117, 214, 183, 224, 136, 6, 205, 77, 100, 85,
-    111, 122, 245, 184, 210, 165, 186, 8, 197, 205, 165, 13, 60, 39, 104, 155, 40, 73, 11, 150, 166, 37, 68, 250, 248,
-    234, 26, 209, 51, 201, 107, 188, 95, 153, 109, 50, 55, 16, 179, 239, 75, 29, 237, 181, 159, 63, 128, 195, 136, 17,
-    136, 213, 190, 134, 0, 195, 166, 221, 11, 155, 10, 100, 45, 11, 118, 238, 101, 115, 126, 162, 239, 174, 208, 131,
-    174, 11, 138, 111, 139, 46, 170, 176, 222, 48, 220, 163, 238, 148, 156, 195, 95, 62, 248, 223, 147, 236, 154, 78,
-    130, 107, 143, 213, 57, 122, 68, 112, 7, 144, 79, 81, 222, 247, 35, 37, 143, 127, 11, 168, 247, 57, 71, 208, 114,
-    226, 63, 212, 236, 164, 12, 73, 69, 164, 224, 218, 230, 162, 190, 195, 61, 93, 226, 141, 81, 174, 181, 29, 195, 85,
-    154, 169, 23, 198, 28, 200, 30, 41, 164, 101, 136, 253, 227, 191, 8, 115, 232, 142, 143, 87, 118, 88, 245, 239, 162,
-    67, 249, 52, 21, 65, 156, 227, 74, 114, 145, 83, 163, 58, 131, 184, 247, 186, 141, 172, 145, 138, 11, 18, 46, 237,
-    63, 30, 59, 203, 16, 65, 60, 59, 80, 207, 48, 177, 1, 117, 180, 17, 59, 169, 158, 116, 180, 1, 203, 145, 223, 43,
-    121, 110, 23, 17, 80, 155, 38, 101, 146, 83, 213, 10, 207, 139, 56, 44, 28, 249, 223, 164, 61, 213, 173, 146, 91,
-    147, 11, 65, 155, 123, 211, 244, 158, 133, 61, 138, 8, 125, 98, 243, 152, 7, 18, 254, 116, 34, 196, 226, 86, 26, 72,
-    28, 232, 69, 214, 172, 245, 25, 237, 180, 12, 2, 190, 206, 104, 152, 86, 81, 135, 27, 44, 133, 203, 230, 125, 98,
-    228, 72, 84, 23, 145, 0, 104, 60, 56, 227, 71, 41, 206, 129, 81, 233, 97, 207, 13, 98, 151, 5, 110, 252, 37, 61, 54,
-    20, 7, 22, 15, 241, 223, 86, 60, 43, 255, 60, 105, 192, 147, 51, 47, 42, 235, 11, 247, 149, 118, 242, 5, 164, 30,
-    164, 148, 219, 60, 144, 209, 88, 65, 172, 66, 84, 107, 217, 144, 9, 119, 42, 167, 205, 86, 10, 143, 185, 130, 120,
-    52, 225, 198, 245, 67, 163, 146, 122, 232, 73, 38, 153, 152, 143, 190, 217, 232, 47, 75, 193, 41, 194, 125, 170,
-    214, 170, 58, 45, 212, 12, 8, 28, 62, 10, 8, 7, 162, 233, 105, 174, 136, 140, 187, 220, 201, 26, 254, 6, 148, 148,
-    91, 224, 237, 54, 157, 46, 192, 70, 170, 152, 250, 165, 36, 223, 157, 2, 185, 65, 118, 70, 27, 243, 144, 99, 6, 230,
-    54, 77, 210, 159, 159, 13, 124, 219, 228, 220, 47, 5, 135, 163, 228, 219, 219, 20, 55, 22, 107, 146, 190, 235, 109,
-    51, 9, 138, 52, 65, 101, 168, 5, 21, 72, 159, 52, 203, 40, 44, 29, 53, 213, 36, 23, 97, 142, 219, 141, 249, 41, 32,
-    142, 43, 118, 21, 151, 207, 43, 95, 73, 25, 34, 95, 195, 147, 234, 40, 29, 118, 169, 187, 61, 189, 41, 179, 19, 153,
-    93, 127, 37, 206, 208, 244, 211, 57, 252, 199, 3, 246, 116, 69, 71, 185, 252, 96, 186, 171, 110, 29, 249, 198, 87,
-    151, 134, 129, 237, 166, 7, 195, 188, 202, 226, 55, 7, 203, 173, 182, 135, 67, 212, 93, 155, 118, 75, 17, 84, 132,
-    245, 221, 227, 118, 64, 36, 113, 29, 56, 54, 116, 161, 125, 252, 238, 17, 3, 181, 155, 28, 202, 171, 18, 167, 231,
-    101, 192, 176, 224, 233, 129, 200, 69, 218, 127, 49, 166, 154, 109, 65, 240, 63, 255, 134, 243, 121, 117, 110, 162,
-    86, 198, 130, 254, 192, 214, 32, 66, 112, 92, 221, 80, 169, 36, 8, 28, 97, 76, 68, 183, 50, 235, 125, 192, 105, 54,
-    18, 107, 226, 37, 212, 143, 138, 116, 43, 191, 174, 152, 227, 51, 32, 249, 192, 131, 69, 59, 159, 9, 157, 165, 81,
-    156, 12, 80, 146, 179, 192, 217, 251, 124, 206, 239, 13, 108, 27, 170, 116, 129, 20, 157, 133, 120, 121, 73, 150,
-    217, 206, 112, 102, 23, 58, 161, 241, 123, 29, 161, 27, 17, 186, 182, 22, 168, 172, 41, 203, 128, 69, 158, 237, 33,
-    184, 126, 1, 122, 43, 13, 123, 195, 95, 42, 193, 103, 22, 47, 105, 139, 51, 220, 145, 194, 251, 53, 247, 195, 248,
-    159, 118, 120, 233, 180, 63, 187, 97, 83, 29, 107, 34, 221, 87, 124, 228, 241, 54, 123, 151, 0, 230, 3, 203, 227,
-    117, 69, 107, 7, 4, 117, 136, 121, 136, 63, 29, 161, 145, 158, 252, 179, 241, 224, 104, 113, 147, 195, 32, 108, 142,
-    133, 44, 201, 161, 77, 101, 16, 113, 186, 231, 9, 11, 14, 104, 198, 25, 110, 4, 225, 249, 70, 157, 146, 72, 16, 82,
-    135, 153, 171, 120, 19, 254, 129, 9, 155, 192, 227, 159, 200, 232, 153, 101, 132, 248, 109, 133, 193, 105, 163, 29,
-    43, 60, 231, 61, 101, 218, 70, 67, 26, 4, 242, 217, 223, 64, 36, 246, 18, 122, 164, 37, 103, 80, 190, 10, 231, 234,
-    7, 252, 68, 22, 111, 189, 171, 46, 157, 120, 229, 142, 3, 231, 237, 103, 160, 139, 94, 187, 109, 0, 225, 126, 149,
-    59, 224, 211, 119, 238, 45, 167, 50, 184, 239, 81, 194, 116, 97, 49, 123, 213, 177, 51, 211, 135, 230, 11, 38, 182,
-    203, 240, 146, 227, 147, 231, 246, 70, 218, 21, 2, 149, 74, 160, 94, 165, 12, 200, 220, 112, 247, 8, 94, 50, 153,
-    125, 250, 91, 31, 52, 153, 184, 228, 16, 143, 165, 14, 91, 174, 229, 33, 228, 6, 173, 140, 61, 218, 198, 8, 86, 208,
-    247, 210, 178, 35, 239, 48, 190, 54, 131, 221, 182, 40, 73, 225, 32, 244, 18, 141, 228, 87, 82, 167, 244, 53, 244,
-    138, 124, 150, 0, 236, 225, 99, 252, 235, 152, 13, 227, 197, 255, 185, 34, 150, 154, 135, 105, 165, 253, 239, 3, 99,
-    236, 91, 108, 31, 236, 203, 10, 25, 124, 162, 21, 28, 228, 29, 156, 132, 20, 78, 230, 136, 253, 79, 55, 12, 173, 84,
-    233, 37, 251, 118, 10, 236, 87, 12, 87, 11, 186, 130, 108, 228, 26, 234, 251, 10, 167, 41, 203, 91, 118, 105, 195,
-    22, 65, 124, 196, 54, 225, 89, 135, 0, 173, 166, 51, 214, 62, 115, 203, 105, 234, 48, 250, 144, 121, 22, 106, 232,
-    134, 133, 102, 199, 24, 57, 251, 167, 89, 8, 93, 217, 235, 57, 89, 249, 134, 42, 220, 189, 112, 208, 129, 94, 57,
-    235, 166, 172, 115, 168, 152, 99, 160, 182, 35, 230, 49, 48, 54, 73, 93, 198, 117, 75, 197, 101, 109, 44, 156, 9,
-    72, 243, 50, 17, 218, 252, 181, 70, 87, 95, 159, 203, 73, 9, 105, 83, 16, 202, 2, 198, 53, 74, 74, 150, 138, 244,
-    180, 237, 223, 140, 243, 89, 126, 41, 104, 143, 52, 105, 245, 0, 59, 212, 159, 195, 14, 20, 167, 60, 32, 183, 58,
-    26, 149, 231, 52, 207, 83, 21, 63, 169, 96, 198, 115, 243, 221, 4, 240, 117, 29, 27, 251, 89, 15, 20, 135, 81, 17,
-    212, 226, 176, 235, 59, 157, 176, 230, 8, 209, 175, 224, 152, 4, 49, 12, 104, 1, 180, 72, 47, 206, 82, 208, 53, 50,
-    116, 202, 158, 244, 1, 48, 51, 234, 32, 103, 93, 187, 73, 37, 112, 160, 30, 11, 192, 242, 175, 77, 36, 220, 66, 175,
-    252, 250, 241, 248, 24, 91, 88, 145, 155, 140, 236, 244, 102, 154, 209, 9, 55, 131, 220, 180, 215, 135, 81, 212, 70,
-    206, 17, 48, 80, 134, 50, 42, 212, 81, 46, 192, 83, 183, 141, 66, 225, 183, 164, 224, 207, 252, 200, 0, 127, 165,
-    168, 90, 180, 230, 94, 234, 175, 94, 177, 76, 219, 138, 207, 186, 8, 50, 60, 71, 46, 252, 186, 229, 46, 236, 126, 0,
-    109, 92, 9, 58, 11, 25, 80, 186, 187, 2, 100, 2, 221, 44, 107, 98, 57, 87, 98, 102, 98, 6, 113, 221, 60, 12, 89,
-    199, 89, 95, 60, 70, 251, 44, 74, 201, 187, 7, 148, 166, 223, 190, 174, 164, 228, 117, 210, 5, 205, 205, 178, 3,
-    105, 103, 105, 66, 20, 222, 121, 27, 69, 250, 199, 92, 50, 146, 138, 198, 144, 117, 121, 21, 217, 238, 20, 149, 86,
-    10, 57, 251, 236, 13, 145, 114, 58, 209, 86, 237, 135, 226, 184, 65, 34, 171, 10, 103, 163, 172, 11, 208, 84, 139,
-    79, 40, 223, 106, 100, 75, 198, 24, 244, 237, 223, 154, 103, 52, 148, 34, 13, 118, 177, 205, 248, 223, 210, 63, 214,
-    91, 225, 179, 210, 79, 182, 217, 32, 152, 128, 92, 49, 212, 23, 240, 165, 143, 146, 244, 100, 104, 127, 155, 178,
-    78, 188, 135, 118, 32, 45, 127, 92, 76, 167, 46, 230, 225, 216, 168, 39, 4, 237, 32, 248, 100, 226, 200, 140, 113,
-    95, 51, 128, 209, 253, 40, 105, 62, 225, 64, 71, 90, 23, 48, 183, 119, 160, 225, 67, 50, 3, 49, 180, 208, 200, 250,
-    6, 210, 200, 148, 52, 243, 105, 233, 75, 133, 50, 69, 128, 89, 204, 192, 191, 43, 91, 246, 24, 93, 148, 6, 96, 106,
-    38, 227, 16, 78, 116, 128, 236, 30, 226, 80, 207, 80, 174, 96, 88, 146, 85, 129, 40, 94, 3, 59, 209, 169, 117, 190,
-    187, 118, 68, 33, 72, 13, 29, 214, 56, 65, 218, 146, 97, 139, 30, 85, 97, 155, 132, 112, 52, 210, 32, 128, 33, 158,
-    169, 253, 189, 76, 58, 38, 90, 152, 180, 63, 141, 172, 39, 209, 97, 85, 56, 182, 36, 136, 186, 253, 248, 150, 219,
-    100, 127, 254, 150, 170, 76, 224, 44, 233, 116, 10, 116, 15, 7, 67, 178, 77, 244, 18, 189, 99, 162, 209, 58, 6, 64,
-    249, 152, 139, 46, 206, 80, 23, 52, 107, 85, 223, 72, 161, 130, 61, 122, 57, 176, 16, 116, 191, 151, 89, 205, 144,
-    225, 10, 199, 102, 93, 11, 140, 7, 95, 51, 93, 42, 13, 169, 203, 83, 190, 0, 249, 220, 44, 145, 14, 156, 219, 139,
-    234, 180, 40, 59, 109, 173, 92, 20, 162, 107, 12, 32, 68, 247, 210, 80, 209, 68, 242, 4, 93, 2, 91, 162, 73, 34,
-    107, 227, 75, 36, 54, 54, 133, 18, 125, 52, 202, 2, 248, 131, 110, 103, 212, 45, 145, 204, 172, 93, 117, 9, 128, 69,
-    57, 80, 81, 250, 35, 39, 96, 245, 46, 19, 237, 108, 219, 126, 95, 185, 205, 37, 37, 63, 64, 122, 39, 159, 97, 110,
-    6, 44, 237, 143, 3, 191, 59, 15, 64, 78, 18, 227, 249, 116, 7, 238, 129, 55, 40, 176, 133, 210, 20, 90, 19, 219,
-    160, 50, 22, 202, 136, 60, 66, 53, 37, 186, 30, 49, 68, 24, 108, 156, 109, 146, 236, 158, 20, 26, 21, 72, 228, 222,
-    74, 177, 25, 78, 30, 163, 150, 253, 38, 35, 110, 251, 174, 110, 50, 71, 206, 14, 220, 20, 187, 90, 139, 128, 57,
-    184, 146, 75, 16, 20, 21, 15, 73, 99, 32, 125, 68, 241, 110, 172, 192, 88, 33, 4, 155, 248, 130, 212, 255, 36, 117,
-    228, 186, 91, 86, 50, 82, 11, 239, 184, 215, 92, 231, 110, 26, 73, 22, 127, 4, 245, 72, 226, 205, 177, 112, 108, 25,
-    161, 79, 69, 75, 151, 202, 96, 71, 231, 20, 22, 51, 136, 41, 1, 218, 231, 151, 164, 112, 124, 196, 194, 34, 50, 166,
-    133, 146, 192, 251, 102, 19, 196, 137, 13, 181, 174, 254, 101, 151, 51, 94, 82, 74, 156, 167, 238, 37, 169, 132, 86,
-    176, 93, 97, 12, 172, 83, 193, 176, 150, 220, 229, 99, 99, 184, 248, 181, 163, 217, 127, 44, 112, 212, 143, 77, 200,
-    219, 160, 172, 127, 252, 145, 231, 224, 79, 139, 141, 240, 227, 50, 176, 93, 156, 118, 80, 166, 236, 77, 46, 90, 87,
-    121, 121, 62, 221, 32, 5, 204, 79, 66, 13, 133, 208, 100, 98, 53, 198, 1, 223, 196, 100, 124, 88, 87, 200, 104, 32,
-    92, 49, 196, 223, 138, 59, 149, 39, 254, 219, 195, 183, 152, 42, 10, 10, 149, 117, 135, 201, 181, 96, 142, 64, 49,
-    61, 164, 9, 119, 136, 17, 130, 9, 135, 48, 152, 160, 199, 20, 154, 246, 107, 189, 219, 49, 55, 96, 15, 103, 35, 23,
-    92, 90, 248, 173, 186, 183, 69, 62, 122, 2, 42, 54, 122, 123, 65, 36, 16, 250, 21, 88, 214, 18, 240, 161, 44, 252,
-    95, 201, 137, 223, 238, 242, 34, 88, 132, 206, 161, 184, 130, 155, 97, 191, 195, 114, 63, 108, 146, 3, 48, 142, 28,
-    211, 120, 252, 199, 83, 208, 89, 153, 157, 165, 249, 9, 242, 170, 13, 100, 133, 87, 206, 71, 226, 247, 148, 126, 27,
-    64, 189, 211, 94, 130, 159, 194, 72, 187, 214, 241, 151, 204, 125, 166, 64, 50, 12, 120, 34, 52, 155, 67, 86, 106,
-    75, 63, 158, 47, 6, 172, 12, 83, 6, 193, 52, 159, 100, 253, 187, 58, 27, 31, 239, 37, 221, 167, 27, 35, 166, 233,
-    155, 151, 182, 180, 27, 21, 88, 15, 91, 106, 85, 227, 18, 182, 124, 47, 48, 171, 0, 118, 105, 133, 208, 106, 67,
-    205, 215, 2, 125, 196, 221, 39, 49, 218, 227, 151, 178, 174, 65, 156, 209, 5, 125, 108, 141, 19, 4, 182, 156, 219,
-    127, 183, 196, 17, 202, 210, 91, 233, 31, 166, 88, 196, 64, 9, 33, 205, 105, 199, 215, 42, 17, 177, 44, 177, 96,
-    115, 94, 28, 196, 214, 169, 103, 34, 92, 40, 202, 179, 0, 140, 32, 188, 6, 132, 28, 203, 239, 18, 243, 165, 146,
-    164, 54, 29, 177, 206, 113, 255, 148, 82, 245, 62, 129, 31, 215, 82, 255, 108, 186, 101, 28, 221, 55, 59, 153, 60,
-    12, 112, 230, 69, 3, 0, 170, 37, 63, 77, 214, 101, 238, 126, 227, 168, 34, 119, 75, 30, 46, 193, 173, 181, 125, 17,
-    159, 166, 208, 252, 92, 193, 69, 121, 57, 226, 109, 108, 176, 189, 96, 224, 23, 65, 222, 241, 155, 148, 124, 253,
-    248, 28, 72, 165, 17, 71, 188, 206, 149, 32, 78, 34, 166, 110, 185, 16, 225, 26, 102, 123, 71, 45, 111, 241, 218,
-    59, 254, 111, 141, 199, 136, 16, 8, 117, 7, 78, 137, 75, 173, 251, 93, 226, 29, 25, 46, 69, 117, 75, 170, 212, 133,
-    85, 21, 180, 112, 144, 183, 167, 177, 51, 150, 27, 243, 239, 22, 52, 79, 128, 89, 133, 25, 172, 165, 155, 51, 67,
-    195, 176, 4, 67, 219, 150, 119, 12, 253, 199, 125, 9, 126, 95, 114, 232, 212, 253, 120, 197, 49, 175, 139, 227, 250,
-    240, 78, 192, 129, 18, 222, 60, 12, 153, 136, 179, 133, 80, 61, 198, 97, 176, 67, 255, 24, 115, 13, 15, 82, 20, 27,
-    170, 20, 78, 161, 239, 80, 65, 50, 139, 32, 198, 140, 89, 131, 203, 208, 61, 31, 228, 81, 200, 241, 107, 242, 75,
-    32, 128, 23, 159, 235, 102, 17, 251, 216, 129, 136, 8, 144, 64, 71, 240, 37, 120, 72, 208, 230, 225, 214, 13, 132,
-    155, 170, 146, 248, 217, 21, 92, 91, 22, 47, 245, 178, 160, 253, 64, 194, 222, 151, 181, 74, 171, 188, 172, 197, 49,
-    52, 190, 235, 2, 102, 245, 130, 135, 78, 38, 52, 26, 82, 255, 38, 197, 185, 252, 156, 30, 78, 91, 231, 175, 21, 231,
-    17, 195, 9, 131, 128, 209, 99, 140, 64, 88, 85, 133, 248, 208, 205, 175, 170, 174, 93, 226, 57, 20, 254, 4, 100,
-    195, 247, 129, 56, 206, 50, 254, 201, 174, 139, 175, 31, 55, 229, 135, 189, 1, 242, 207, 218, 233, 135, 66, 232,
-    144, 211, 40, 19, 171, 197, 86, 232, 59, 80, 246, 14, 39, 40, 24, 241, 13, 116, 61, 99, 115, 176, 173, 46, 100, 105,
-    169, 247, 73, 227, 100, 146, 67, 229, 151, 32, 67, 122, 30, 81, 7, 30, 17, 160, 247, 45, 16, 249, 248, 210, 24, 119,
-    132, 98, 128, 176, 51, 192, 169, 94, 70, 209, 116, 214, 246, 62, 23, 239, 220, 26, 95, 68, 248, 168, 28, 231, 177,
-    34, 144, 69, 50, 105, 113, 56, 171, 168, 25, 36, 245, 133, 228, 191, 1, 162, 149, 239, 63, 65, 171, 172, 85, 172,
-    46, 240, 82, 244, 50, 74, 4, 165, 71, 17, 9, 13, 137, 93, 162, 207, 224, 102, 210, 63, 118, 90, 4, 118, 145, 109,
-    125, 33, 99, 219, 200, 132, 112, 52, 104, 106, 167, 26, 228, 114, 105, 68, 189, 137, 67, 21, 214, 39, 196, 69, 23,
-    60, 112, 167, 164, 14, 26, 109, 56, 34, 132, 124, 178, 160, 66, 8, 185, 112, 126, 55, 177, 84, 219, 172, 152, 181,
-    91, 102, 105, 10, 106, 172, 229, 0, 79, 175, 15, 16, 102, 116, 33, 112, 128, 59, 169, 32, 80, 4, 144, 12, 40, 154,
-    188, 16, 232, 63, 137, 248, 166, 33, 168, 227, 29, 130, 45, 88, 211, 126, 197, 224, 50, 133, 16, 222, 121, 109, 67,
-    249, 74, 39, 46, 126, 112, 172, 137, 86, 84, 42, 74, 162, 188, 64, 235, 95, 19, 4, 138, 143, 46, 105, 235, 144, 220,
-    175, 126, 124, 240, 255, 58, 80, 71, 20, 132, 165, 224, 81, 181, 211, 246, 53, 248, 75, 165, 227, 101, 183, 43, 41,
-    70, 15, 239, 130, 49, 88, 64, 103, 226, 165, 6, 145, 0, 25, 95, 84, 240, 95, 91, 44, 70, 218, 164, 107, 10, 126, 25,
-    219, 9, 198, 22, 254, 96, 19, 155, 52, 44, 53, 63, 59, 52, 7, 27, 207, 133, 158, 247, 147, 195, 159, 76, 164, 61,
-    205, 207, 33, 125, 29, 208, 207, 38, 53, 134, 10, 122, 172, 138, 38, 1, 47, 232, 232, 66, 205, 198, 173, 135, 65,
-    139, 147, 239, 184, 130, 120, 165, 185, 33, 163, 111, 60, 136, 81, 63, 162, 77, 26, 255, 158, 160, 246, 238, 18,
-    107, 162, 195, 233, 161, 57, 161, 192, 18, 184, 206, 208, 211, 119, 28, 133, 43, 15, 90, 204, 238, 135, 190, 211,
-    210, 161, 63, 27, 106, 82, 38, 13, 11, 71, 38, 181, 13, 225, 233, 10, 225, 227, 176, 127, 109, 213, 158, 86, 120,
-    53, 0, 60, 170, 224, 7, 231, 50, 226, 74, 18, 122, 184, 172, 63, 225, 153, 182, 223, 168, 234, 130, 98, 159, 223,
-    101, 152, 76, 218, 190, 223, 179, 237, 250, 199, 239, 217, 82, 237, 13, 209, 254, 214, 241, 67, 242, 149, 13, 107,
-    46, 116, 155, 7, 132, 97, 131, 232, 189, 99, 2, 216, 54, 228, 73, 136, 46, 37, 247, 71, 10, 11, 185, 48, 197, 153,
-    211, 112, 113, 86, 210, 22, 231, 141, 214, 11, 145, 171, 118, 6, 229, 123, 218, 135, 152, 119, 50, 88, 213, 47, 198,
-    87, 106, 165, 37, 100, 149, 26, 128, 164, 41, 24, 225, 127, 168, 103, 16, 227, 194, 242, 22, 149, 148, 129, 102,
-    199, 151, 156, 115, 115, 191, 111, 233, 162, 8, 224, 33, 220, 109, 71, 51, 166, 217, 218, 83, 189, 6, 196, 205, 61,
-    11, 130, 43, 62, 111, 207, 170, 36, 27, 158, 200, 50, 97, 43, 138, 9, 237, 191, 104, 198, 58, 254, 14, 141, 245, 37,
-    6, 50, 2, 218, 114, 61, 146, 150, 203, 45, 146, 148, 87, 80, 93, 227, 149, 173, 173, 215, 14, 136, 229, 231, 1, 62,
-    190, 254, 197, 211, 223, 123, 18, 32, 71, 8, 50, 181, 142, 36, 45, 89, 216, 66, 52, 194, 211, 199, 234, 47, 148, 53,
-    61, 45, 142, 30, 154, 100, 125, 166, 171, 115, 244, 24, 42, 177, 100, 204, 135, 13, 129, 182, 255, 181, 211, 175,
-    204, 126, 104, 122, 241, 117, 89, 216, 62, 57, 201, 35, 122, 47, 17, 167, 76, 39, 137, 219, 127, 94, 0, 18, 90, 76,
-    29, 185, 70, 3, 10, 118, 142, 187, 33, 166, 2, 51, 203, 33, 151, 151, 127, 194, 157, 176, 145, 147, 178, 83, 71, 77,
-    104, 3, 10, 10, 233, 28, 223, 184, 140, 118, 180, 90, 70, 3, 157, 103, 60, 41, 97, 51, 176, 184, 211, 144, 34, 176,
-    210, 212, 95, 47, 204, 58, 12, 88, 93, 110, 203, 17, 130, 170, 98, 83, 243, 92, 92, 184, 100, 153, 55, 150, 27, 171,
-    26, 154, 116, 56, 212, 181, 112, 209, 193, 246, 245, 98, 134, 80, 42, 223, 126, 39, 52, 16, 130, 201, 80, 173, 150,
-    42, 177, 1, 155, 62, 48, 169, 116, 209, 105, 239, 197, 180, 159, 215, 147, 160, 56, 225, 13, 44, 122, 198, 160, 11,
-    17, 251, 9, 11, 0, 92, 127, 62, 108, 114, 94, 32, 97, 113, 223, 197, 57, 20, 80, 38, 205, 121, 27, 255, 170, 135,
-    96, 26, 150, 37, 87, 23, 96, 176, 103, 200, 74, 87, 115, 75, 63, 64, 188, 0, 121, 176, 61, 70, 108, 88, 62, 125,
-    109, 52, 3, 56, 2, 90, 51, 100, 152, 25, 112, 201, 161, 50, 96, 75, 64, 241, 85, 224, 114, 117, 44, 54, 111, 67, 56,
-    198, 176, 250, 142, 19, 219, 51, 140, 15, 124, 185, 64, 170, 13, 67, 61, 58, 145, 72, 81, 85, 65, 252, 91, 196, 221,
-    162, 118, 34, 65, 76, 173, 86, 186, 142, 71, 23, 255, 187, 55, 151, 213, 199, 76, 144, 137, 252, 132, 19, 118, 74,
-    71, 237, 142, 56, 171, 144, 132, 134, 84, 143, 231, 47, 23, 196, 238, 192, 18, 163, 216, 175, 249, 66, 58, 74, 158,
-    50, 53, 153, 152, 151, 82, 35, 47, 192, 188, 186, 160, 29, 54, 3, 178, 106, 95, 121, 202, 170, 14, 100, 1, 92, 166,
-    233, 123, 255, 64, 97, 72, 135, 159, 8, 47, 241, 111, 157, 125, 47, 91, 127, 116, 190, 171, 97, 146, 106, 181, 68,
-    1, 120, 187, 104, 253, 203, 39, 166, 209, 239, 71, 114, 105, 116, 6, 6, 183, 189, 195, 139, 174, 193, 48, 185, 199,
-    140, 98, 65, 32, 239, 93, 59, 140, 119, 201, 184, 115, 66, 61, 4, 237, 215, 14, 132, 164, 69, 198, 223, 96, 188,
-    103, 94, 78, 28, 173, 112, 173, 246, 190, 25, 9, 101, 220, 46, 138, 228, 139, 181, 235, 179, 154, 132, 58, 71, 184,
-    230, 78, 199, 72, 176, 156, 101, 130, 147, 52, 110, 95, 120, 174, 67, 24, 139, 75, 157, 137, 162, 212, 87, 16, 136,
-    238, 47, 22, 66, 16, 126, 68, 254, 21, 26, 65, 130, 84, 225, 52, 217, 67, 250, 54, 162, 98, 80, 77, 119, 123, 171,
-    57, 64, 109, 242, 238, 96, 138, 39, 220, 223, 241, 212, 115, 106, 136, 241, 171, 64, 27, 10, 239, 65, 203, 106, 200,
-    125, 34, 152, 105, 147, 115, 85, 207, 6, 235, 27, 126, 209, 164, 110, 52, 178, 50, 9, 167, 225, 196, 144, 80, 231,
-    163, 162, 154, 197, 76, 34, 139, 38, 3, 181, 178, 81, 197, 73, 14, 91, 209, 189, 232, 88, 61, 67, 125, 171, 30, 108,
-    130, 254, 109, 197, 191, 120, 11, 5, 253, 93, 53, 201, 57, 207, 77, 193, 43, 214, 185, 39, 227, 142, 77, 250, 178,
-    80, 22, 63, 52, 142, 6, 42, 147, 202, 194, 200, 213, 87, 160, 172, 211, 230, 231, 114, 215, 77, 138, 48, 61, 166, 8,
-    176, 63, 69, 88, 133, 187, 186, 236, 176, 231, 31, 7, 213, 168, 141, 102, 39, 238, 193, 206, 211, 131, 201, 52, 131,
-    194, 141, 9, 102, 47, 71, 109, 184, 46, 3, 254, 123, 241, 128, 230, 49, 191, 175, 135, 13, 247, 34, 3, 235, 80, 174,
-    32, 229, 100, 122, 115, 8, 112, 197, 146, 207, 82, 73, 24, 245, 227, 248, 211, 56, 102, 152, 12, 58, 21, 119, 61,
-    201, 26, 199, 113, 44, 84, 233, 5, 245, 10, 108, 206, 243, 99, 14, 162, 221, 110, 22, 81, 170, 240, 239, 97, 134,
-    89, 239, 141, 42, 46, 136, 0, 196, 145, 166, 34, 102, 57, 11, 83, 108, 198, 32, 174, 174, 246, 61, 209, 46, 75, 166,
-    208, 131, 62, 30, 77, 99, 242, 165, 209, 79, 30, 183, 28, 64, 36, 65, 197, 20, 160, 7, 250, 13, 243, 104, 54, 211,
-    185, 242, 81, 136, 243, 135, 137, 151, 67, 19, 3, 222, 51, 157, 194, 133, 254, 7, 16, 127, 16, 80, 27, 201, 64, 97,
-    104, 165, 133, 28, 122, 186, 168, 163, 189, 151, 131, 171, 232, 118, 225, 61, 218, 175, 187, 62, 97, 247, 244, 152,
-    123, 184, 158, 45, 182, 240, 91, 67, 43, 244, 206, 72, 74, 253, 179, 79, 78, 247, 178, 95, 7, 100, 83, 111, 40, 77,
-    155, 215, 221, 245, 152, 67, 73, 191, 165, 79, 226, 127, 200, 25, 245, 4, 149, 72, 48, 47, 149, 101, 250, 8, 43, 24,
-    0, 247, 81, 120, 82, 225, 48, 228, 91, 29, 77, 30, 34, 8, 165, 48, 46, 224, 195, 132, 159, 45, 73, 157, 211, 214,
-    86, 76, 135, 235, 149, 172, 59, 220, 39, 167, 135, 116, 43, 154, 142, 60, 53, 9, 82, 71, 154, 101, 131, 24, 205, 51,
-    163, 34, 108, 228, 235, 42, 217, 79, 233, 119, 216, 135, 201, 68, 159, 139, 150, 5, 70, 238, 255, 250, 8, 102, 163,
-    75, 64, 217, 121, 72, 208, 223, 49, 43, 3, 223, 77, 172, 212, 218, 207, 74, 133, 95, 109, 41, 24, 240, 23, 176, 248,
-    12, 100, 121, 78, 57, 68, 122, 153, 181, 57, 68, 110, 59, 56, 23, 213, 48, 148, 19, 195, 15, 245, 161, 233, 110,
-    198, 65, 99, 26, 135, 211, 137, 220, 96, 5, 39, 101, 20, 212, 159, 65, 144, 39, 210, 206, 113, 38, 79, 104, 127, 17,
-    192, 251, 17, 229, 199, 43, 184, 80, 1, 96, 87, 178, 88, 115, 90, 139, 13, 18, 195, 117, 98, 175, 176, 106, 149,
-    139, 14, 237, 46, 204, 51, 146, 31, 246, 203, 192, 152, 158, 236, 178, 188, 158, 210, 98, 179, 196, 219, 118, 232,
-    244, 136, 75, 36, 137, 89, 14, 200, 81, 229, 102, 74, 218, 168, 58, 137, 115, 8, 193, 151, 115, 150, 68, 149, 5,
-    146, 89, 22, 100, 173, 228, 65, 154, 84, 152, 129, 147, 228, 82, 10, 212, 51, 129, 53, 152, 56, 242, 188, 177, 211,
-    97, 69, 240, 197, 48, 61, 111, 190, 9, 117, 121, 252, 63, 3, 212, 17, 59, 237, 51, 115, 42, 232, 188, 210, 40, 36,
-    188, 116, 76, 138, 245, 127, 137, 122, 117, 67, 149, 132, 186, 71, 78, 206, 190, 31, 45, 17, 180, 147, 4, 134, 38,
-    184, 30, 26, 93, 238, 130, 41, 99, 98, 50, 79, 93, 34, 95, 8, 152, 44, 97, 56, 30, 22, 216, 161, 85, 204, 102, 116,
-    32, 88, 106, 127, 115, 251, 180, 97, 151, 104, 150, 136, 161, 96, 86, 48, 18, 27, 181, 79, 14, 78, 146, 105, 154,
-    155, 112, 149, 187, 158, 137, 191, 79, 206, 241, 144, 214, 203, 46, 98, 213, 72, 226, 145, 143, 123, 26, 56, 114,
-    139, 133, 196, 58, 229, 113, 55, 192, 249, 255, 108, 73, 40, 161, 145, 239, 116, 111, 140, 198, 180, 53, 141, 154,
-    142, 66, 20, 80, 84, 76, 191, 75, 120, 51, 165, 97, 202, 81, 197, 31, 59, 49, 196, 30, 49, 137, 5, 2, 223, 87, 97,
-    63, 248, 0, 89, 229, 45, 220, 19, 82, 7, 113, 187, 90, 3, 145, 23, 197, 135, 100, 69, 75, 218, 129, 1, 9, 191, 251,
-    74, 254, 238, 227, 205, 61, 181, 210, 149, 215, 87, 43, 213, 223, 232, 2, 132, 150, 147, 197, 131, 63, 32, 94, 243,
-    199, 131, 187, 135, 93, 221, 151, 59, 191, 44, 226, 50, 1, 128, 234, 238, 241, 135, 112, 121, 117, 20, 174, 138,
-    172, 107, 68, 211, 171, 132, 66, 234, 70, 96, 206, 22, 56, 210, 124, 100, 158, 96, 38, 116, 137, 214, 62, 63, 140,
-    133, 2, 189, 167, 213, 130, 161, 107, 146, 222, 191, 213, 225, 131, 212, 81, 187, 19, 117, 23, 62, 223, 42, 143, 48,
-    135, 77, 131, 48, 124, 244, 174, 98, 43, 155, 119, 221, 215, 174, 102, 238, 157, 243, 44, 181, 151, 140, 99, 82,
-    147, 6, 252, 97, 49, 169, 24, 174, 223, 60, 88, 156, 167, 46, 248, 49, 247, 86, 235, 152, 237, 38, 74, 219, 95, 53,
-    3, 108, 55, 222, 128, 90, 169, 243, 123, 200, 64, 92, 123, 147, 77, 93, 59, 25, 103, 148, 125, 94, 167, 211, 205,
-    255, 44, 90, 96, 127, 148, 58, 228, 147, 87, 146, 32, 168, 33, 162, 18, 230, 237, 193, 253, 246, 245, 74, 82, 75,
-    124, 79, 99, 96, 143, 45, 48, 58, 250, 232, 40, 91, 132, 21, 240, 133, 91, 233, 35, 150, 154, 53, 218, 96, 22, 9,
-    146, 158, 41, 49, 49, 226, 92, 189, 13, 188, 72, 243, 211, 175, 234, 26, 88, 103, 223, 156, 183, 166, 72, 133, 88,
-    227, 243, 119, 244, 94, 174, 27, 192, 217, 182, 100, 2, 20, 140, 118, 160, 149, 52, 206, 113, 86, 6, 134, 95, 121,
-    101, 240, 115, 213, 244, 55, 19, 138, 157, 69, 107, 240, 109, 224, 109, 30, 60, 92, 7, 46, 156, 180, 72, 66, 27,
-    243, 12, 246, 254, 128, 204, 235, 158, 145, 190, 210, 213, 250, 79, 217, 168, 196, 212, 129, 111, 90, 41, 26, 155,
-    250, 124, 223, 245, 164, 169, 21, 180, 97, 195, 250, 1, 95, 223, 111, 193, 198, 149, 40, 172, 200, 147, 36, 130,
-    199, 74, 166, 155, 91, 110, 123, 191, 236, 112, 199, 103, 207, 61, 126, 100, 130, 19, 7, 66, 143, 122, 158, 236,
-    237, 150, 193, 161, 118, 136, 209, 168, 200, 29, 63, 122, 183, 240, 138, 196, 33, 61, 174, 47, 136, 129, 37, 1, 16,
-    39, 74, 126, 181, 172, 203, 104, 229, 82, 63, 39, 104, 77, 170, 97, 126, 254, 125, 252, 191, 224, 210, 52, 98, 204,
-    23, 173, 41, 210, 92, 66, 145, 44, 80, 41, 114, 71, 59, 42, 99, 74, 111, 181, 22, 204, 35, 195, 69, 74, 37, 72, 53,
-    3, 197, 87, 196, 131, 171, 231, 136, 169, 228, 166, 28, 114, 148, 80, 223, 116, 140, 98, 226, 45, 228, 36, 55, 198,
-    142, 26, 142, 78, 99, 158, 254, 152, 255, 40, 119, 12, 84, 92, 102, 238, 229, 130, 216, 158, 58, 91, 88, 88, 140,
-    208, 189, 126, 105, 36, 132, 219, 64, 138, 94, 39, 3, 227, 160, 61, 122, 178, 115, 9, 45, 76, 249, 181, 167, 176,
-    81, 35, 4, 201, 181, 251, 45, 47, 51, 78, 39, 64, 5, 107, 80, 167, 59, 177, 233, 74, 192, 229, 213, 140, 115, 176,
-    254, 48, 19, 242, 236, 10, 0, 254, 200, 28, 117, 252, 234, 8, 28, 38, 220, 62, 154, 101, 114, 85, 251, 39, 253, 186,
-    38, 220, 118, 67, 58, 76, 37, 24, 214, 171, 9, 175, 64, 121, 146, 170, 220, 94, 44, 197, 179, 137, 27, 218, 241,
-    208, 123, 169, 109, 227, 168, 152, 15, 250, 70, 65, 0, 57, 118, 234, 184, 48, 40, 33, 140, 21, 171, 69, 119, 189,
-    236, 33, 6, 87, 26, 15, 189, 170, 49, 244, 198, 155, 226, 64, 195, 45, 22, 106, 175, 104, 233, 221, 139, 44, 203,
-    32, 75, 253, 79, 235, 131, 189, 92, 20, 228, 108, 248, 34, 202, 202, 179, 241, 67, 76, 133, 72, 136, 33, 14, 254,
-    31, 82, 4, 246, 143, 199, 249, 168, 41, 43, 162, 123, 88, 193, 247, 226, 113, 199, 200, 239, 35, 203, 45, 199, 82,
-    191, 94, 159, 62, 211, 84, 62, 38, 142, 148, 187, 84, 56, 249, 198, 144, 180, 235, 95, 212, 87, 248, 167, 13, 49,
-    64, 102, 252, 141, 107, 40, 24, 20, 210, 32, 145, 254, 207, 33, 224, 136, 111, 222, 1, 169, 225, 14, 37, 158, 67,
-    227, 41, 145, 121, 10, 60, 90, 80, 124, 45, 210, 234, 18, 147, 194, 86, 233, 42, 184, 197, 97, 36, 70, 221, 67, 240,
-    50, 237, 200, 218, 169, 218, 11, 46, 50, 13, 47, 138, 15, 171, 85, 98, 73, 61, 20, 244, 6, 49, 25, 110, 216, 172,
-    249, 239, 220, 86, 153, 146, 198, 252, 121, 50, 53, 85, 35, 163, 81, 56, 188, 212, 149, 82, 141, 247, 90, 14, 103,
-    218, 201, 169, 60, 11, 131, 76, 9, 21, 94, 4, 149, 244, 116, 92, 64, 196, 79, 159, 131, 48, 92, 192, 246, 94, 249,
-    202, 26, 36, 235, 60, 244, 80, 177, 45, 147, 177, 91, 149, 24, 249, 118, 92, 124, 50, 243, 53, 189, 60, 52, 235,
-    165, 115, 217, 164, 71, 109, 18, 23, 162, 74, 230, 64, 75, 53, 127, 163, 44, 12, 167, 229, 31, 104, 228, 44, 169,
-    110, 50, 106, 168, 225, 234, 131, 170, 49, 251, 217, 238, 165, 147, 59, 46, 246, 47, 121, 246, 140, 176, 3, 157, 6,
-    78, 95, 20, 90, 28, 74, 11, 97, 69, 120, 222, 41, 197, 67, 20, 2, 132, 56, 132, 5, 10, 158, 205, 36, 45, 37, 229,
-    118, 2, 218, 239, 173, 64, 130, 4, 89, 171, 0, 25, 152, 5, 181, 231, 73, 151, 154, 36, 43, 146, 88, 11, 115, 214,
-    139, 148, 236, 126, 185, 114, 13, 46, 115, 39, 205, 10, 98, 239, 101, 29, 32, 183, 80, 31, 164, 248, 160, 232, 245,
-    124, 211, 254, 249, 146, 200, 64, 54, 232, 125, 80, 175, 107, 188, 147, 112, 47, 137, 20, 57, 141, 122, 147, 135,
-    181, 130, 188, 149, 106, 225, 175, 52, 242, 87, 53, 192, 133, 60, 204, 187, 229, 254, 43, 160, 1, 182, 121, 6, 195,
-    146, 19, 50, 182, 117, 133, 98, 228, 24, 105, 141, 164, 130, 38, 174, 238, 171, 13, 117, 45, 151, 99, 117, 38, 117,
-    191, 13, 166, 126, 254, 175, 246, 129, 164, 163, 75, 10, 123, 131, 139, 183, 179, 192, 132, 207, 203, 136, 225, 161,
-    156, 115, 71, 22, 237, 28, 71, 216, 214, 144, 89, 103, 168, 223, 123, 21, 238, 92, 150, 36, 221, 213, 4, 238, 236,
-    169, 199, 213, 149, 208, 3, 164, 75, 150, 154, 249, 33, 80, 225, 83, 252, 76, 47, 83, 187, 228, 197, 6, 75, 114,
-    159, 159, 85, 100, 31, 236, 146, 195, 176, 218, 186, 119, 169, 108, 19, 111, 104, 30, 245, 132, 174, 42, 96, 156,
-    86, 67, 101, 133, 117, 130, 94, 212, 44, 111, 39, 239, 206, 76, 2, 52, 105, 38, 88, 222, 211, 210, 97, 244, 216,
-    240, 101, 83, 212, 171, 238, 194, 171, 184, 232, 239, 80, 33, 206, 121, 121, 47, 229, 118, 130, 218, 78, 186, 177,
-    242, 125, 172, 174, 216, 137, 168, 185, 120, 246, 143, 111, 250, 66, 9, 134, 54, 31, 187, 86, 10, 204, 162, 45, 222,
-    193, 82, 227, 240, 143, 212, 92, 252, 20, 197, 184, 60, 95, 84, 179, 134, 50, 152, 90, 8, 26, 82, 75, 23, 204, 250,
-    133, 56, 153, 221, 154, 118, 50, 204, 250, 64, 166, 175, 197, 102, 226, 164, 83, 139, 226, 86, 47, 243, 104, 240,
-    202, 68, 130, 170, 205, 212, 168, 72, 173, 7, 252, 74, 245, 76, 110, 195, 211, 180, 13, 198, 12, 145, 47, 194, 46,
-    8, 110, 47, 153, 228, 142, 135, 178, 63, 15, 18, 171, 22, 175, 40, 124, 238, 104, 205, 44, 192, 232, 143, 214, 49,
-    86, 126, 26, 86, 206, 228, 89, 223, 66, 228, 62, 212, 167, 180, 133, 195, 249, 240, 9, 32, 33, 27, 114, 9, 226, 4,
-    23, 201, 171, 42, 109, 82, 131, 95, 97, 15, 36, 57, 20, 160, 39, 49, 187, 93, 62, 63, 33, 197, 119, 60, 219, 52,
-    218, 72, 155, 209, 51, 225, 182, 133, 190, 94, 12, 123, 108, 214, 42, 128, 228, 136, 247, 255, 104, 43, 61, 55, 158,
-    13, 17, 195, 98, 253, 225, 162, 50, 108, 177, 143, 175, 72, 116, 102, 80, 131, 64, 29, 187, 32, 195, 185, 150, 50,
-    115, 176, 33, 235, 12, 120, 218, 141, 223, 105, 120, 227, 170, 71, 38, 187, 2, 107, 220, 88, 206, 190, 21, 126, 122,
-    4, 87, 78, 1, 181, 212, 204, 114, 89, 2, 166, 179, 121, 106, 141, 112, 64, 21, 55, 25, 221, 223, 54, 188, 215, 108,
-    97, 131, 49, 50, 141, 155, 82, 176, 194, 85, 121, 116, 57, 94, 213, 208, 183, 107, 214, 134, 45, 119, 110, 74, 34,
-    18, 22, 157, 168, 127, 197, 139, 190, 220, 98, 77, 12, 169, 87, 140, 237, 159, 167, 13, 181, 55, 5, 78, 237, 170,
-    31, 145, 101, 168, 248, 140, 51, 241, 133, 43, 189, 45, 182, 96, 207, 252, 231, 36, 72, 110, 120, 201, 69, 59, 17,
-    164, 220, 130, 116, 149, 212, 180, 142, 24, 114, 175, 16, 238, 21, 219, 92, 131, 32, 172, 128, 8, 49, 156, 64, 152,
-    107, 238, 38, 44, 23, 55, 233, 169, 153, 86, 254, 64, 237, 198, 143, 7, 67, 238, 255, 1, 177, 144, 40, 209, 205, 73,
-    27, 209, 190, 157, 25, 160, 165, 228, 8, 84, 60, 37, 208, 129, 91, 48, 114, 250, 236, 170, 56, 167, 181, 151, 220,
-    44, 235, 88, 97, 235, 180, 138, 143, 49, 162, 67, 230, 167, 202, 0, 183, 202, 183, 87, 203, 174, 136, 144, 223, 195,
-    224, 233, 235, 86, 33, 16, 245, 18, 124, 130, 74, 162, 97, 145, 161, 53, 117, 192, 206, 117, 227, 204, 220, 62, 118,
-    186, 38, 246, 204, 132, 111, 115, 33, 139, 121, 56, 82, 155, 201, 16, 103, 56, 140, 121, 146, 139, 170, 29, 57, 90,
-    218, 23, 154, 154, 210, 117, 194, 68, 165, 233, 90, 136, 180, 194, 15, 79, 56, 200, 241, 164, 148, 177, 210, 190,
-    171, 208, 75, 175, 63, 196, 47, 233, 16, 226, 229, 116, 192, 44, 146, 36, 73, 80, 103, 11, 233, 255, 30, 186, 71,
-    134, 14, 249, 80, 206, 138, 48, 223, 181, 254, 180, 166, 158, 253, 190, 233, 190, 95, 110, 11, 209, 177, 88, 137,
-    95, 76, 163, 188, 172, 120, 42, 249, 254, 72, 33, 214, 37, 200, 241, 206, 25, 51, 91, 47, 64, 176, 29, 78, 224, 46,
-    23, 8, 212, 92, 177, 78, 176, 89, 122, 4, 196, 125, 0, 243, 66, 193, 218, 199, 23, 91, 174, 127, 62, 108, 21, 167,
-    114, 215, 90, 217, 32, 42, 228, 168, 163, 154, 19, 109, 156, 109, 88, 112, 76, 73, 200, 12, 222, 229, 6, 111, 134,
-    186, 54, 3, 155, 142, 98, 214, 119, 211, 82, 222, 184, 74, 110, 13, 53, 178, 115, 229, 169, 94, 183, 71, 155, 26,
-    139, 8, 236, 94, 31, 227, 128, 182, 156, 255, 105, 74, 207, 42, 176, 113, 44, 8, 65, 143, 102, 218, 190, 45, 242,
-    192, 182, 255, 49, 103, 68, 62, 95, 154, 29, 57, 61, 41, 209, 109, 205, 179, 118, 52, 236, 249, 132, 243, 190, 235,
-    53, 221, 101, 154, 158, 27, 222, 168, 91, 132, 19, 158, 9, 198, 33, 134, 3, 140, 191, 39, 31, 218, 78, 71, 7, 242,
-    66, 152, 6, 59, 29, 151, 234, 132, 124, 142, 254, 57, 192, 89, 4, 207, 45, 236, 154, 93, 240, 43, 54, 5, 232, 144,
-    126, 94, 242, 55, 236, 5, 56, 8, 100, 2, 51, 193, 31, 227, 167, 167, 186, 237, 119, 46, 152, 9, 52, 98, 125, 7, 121,
-    247, 156, 126, 248, 224, 91, 178, 38, 255, 124, 235, 27, 118, 74, 73, 149, 176, 151, 184, 130, 114, 160, 136, 198,
-    62, 111, 54, 113, 159, 92, 255, 30, 180, 85, 9, 223, 5, 255, 149, 181, 141, 107, 226, 104, 186, 21, 228, 197, 18,
-    83, 144, 42, 213, 71, 136, 151, 68, 4, 165, 203, 38, 154, 66, 138, 232, 93, 11, 148, 119, 137, 103, 237, 120, 111,
-    58, 208, 159, 234, 197, 63, 144, 187, 128, 166, 232, 107, 225, 80, 141, 22, 35, 43, 16, 221, 71, 138, 226, 49, 48,
-    251, 70, 168, 58, 89, 82, 231, 249, 7, 21, 133, 202, 4, 185, 34, 78, 240, 72, 172, 8, 23, 9, 23, 144, 218, 100, 15,
-    42, 123, 40, 181, 125, 137, 81, 168, 180, 143, 83, 211, 96, 139, 103, 34, 164, 182, 99, 136, 126, 175, 92, 67, 141,
-    19, 154, 107, 68, 225, 40, 170, 50, 197, 11, 104, 204, 171, 4, 47, 54, 138, 33, 198, 195, 249, 65, 183, 31, 56, 195,
-    190, 195, 3, 163, 127, 211, 188, 165, 70, 29, 195, 24, 218, 29, 183, 41, 12, 143, 137, 195, 125, 61, 32, 180, 44,
-    100, 10, 23, 215, 243, 1, 242, 193, 157, 95, 104, 179, 167, 212, 48, 135, 83, 235, 141, 82, 28, 238, 39, 154, 53,
-    109, 23, 134, 75, 49, 246, 245, 214, 231, 248, 183, 189, 49, 250, 221, 26, 206, 32, 188, 128, 127, 81, 118, 10, 131,
-    34, 87, 187, 157, 36, 194, 122, 127, 71, 125, 80, 249, 176, 204, 205, 0, 52, 191, 58, 154, 101, 124, 81, 88, 21,
-    207, 4, 206, 91, 153, 35, 87, 106, 186, 236, 135, 159, 175, 206, 92, 168, 27, 32, 86, 89, 217, 78, 145, 130, 98, 65,
-    196, 184, 21, 173, 19, 76, 251, 108, 150, 85, 170, 163, 18, 237, 221, 87, 240, 177, 170, 219, 164, 61, 153, 236, 7,
-    180, 46, 235, 8, 32, 171, 222, 195, 207, 136, 65, 187, 136, 201, 248, 242, 119, 218, 199, 72, 218, 81, 43, 39, 200,
-    64, 64, 174, 137, 127, 239, 184, 94, 175, 151, 128, 223, 63, 67, 239, 137, 64, 3, 226, 130, 171, 20, 89, 68, 167,
-    127, 90, 203, 56, 127, 127, 82, 81, 65, 27, 187, 154, 4, 6, 241, 168, 8, 221, 81, 227, 197, 226, 143, 174, 46, 46,
-    161, 164, 212, 204, 72, 163, 162, 74, 222, 63, 177, 123, 123, 27, 36, 8, 250, 130, 178, 199, 102, 108, 176, 192, 5,
-    37, 63, 22, 176, 216, 220, 177, 99, 192, 208, 237, 127, 31, 123, 100, 44, 117, 26, 53, 82, 55, 119, 86, 179, 172,
-    216, 77, 124, 41, 20, 167, 152, 177, 128, 134, 114, 127, 0, 68, 99, 81, 122, 3, 162, 245, 242, 62, 89, 161, 118,
-    233, 70, 23, 54, 208, 248, 85, 238, 120, 209, 221, 184, 152, 107, 138, 166, 201, 187, 225, 87, 115, 195, 12, 54, 98,
-    234, 45, 158, 133, 148, 241, 153, 227, 90, 127, 68, 208, 150, 114, 53, 143, 104, 66, 0, 172, 227, 85, 237, 181, 61,
-    74, 58, 114, 238, 158, 7, 75, 35, 72, 86, 121, 220, 21, 128, 250, 176, 193, 31, 178, 248, 119, 111, 129, 125, 245,
-    245, 34, 62, 53, 98, 170, 7, 69, 238, 93, 209, 233, 123, 188, 26, 72, 215, 183, 243, 95, 251, 120, 94, 13, 132, 25,
-    138, 22, 52, 183, 141, 183, 37, 225, 167, 228, 113, 78, 35, 4, 119, 170, 119, 192, 121, 47, 230, 169, 141, 109, 164,
-    219, 92, 218, 74, 229, 243, 228, 124, 216, 225, 232, 63, 100, 124, 200, 5, 149, 37, 103, 71, 233, 2, 17, 191, 191,
-    84, 29, 120, 161, 32, 113, 227, 47, 254, 146, 195, 182, 28, 6, 210, 148, 242, 197, 96, 101, 30, 22, 228, 156, 252,
-    63, 202, 105, 197, 149, 208, 45, 11, 154, 70, 122, 105, 2, 129, 193, 104, 102, 126, 252, 95, 139, 198, 6, 74, 36,
-    251, 54, 80, 127, 70, 78, 135, 24, 206, 22, 202, 95, 133, 130, 158, 19, 230, 139, 66, 174, 144, 177, 158, 107, 226,
-    188, 233, 46, 136, 43, 98, 214, 11, 98, 39, 160, 102, 160, 139, 146, 23, 84, 127, 240, 167, 2, 213, 58, 139, 142,
-    240, 138, 110, 95, 200, 77, 242, 74, 23, 10, 98, 206, 77, 161, 49, 0, 81, 26, 250, 238, 210, 225, 172, 202, 208,
-    236, 80, 4, 163, 173, 19, 213, 148, 125, 255, 170, 11, 75, 154, 195, 182, 115, 7, 165, 170, 158, 26, 3, 36, 62, 58,
-    136, 50, 53, 5, 246, 136, 28, 161, 223, 243, 144, 51, 50, 162, 59, 82, 118, 238, 48, 130, 1, 2, 188, 94, 148, 93,
-    177, 1, 5, 197, 54, 148, 173, 178, 240, 192, 53, 72, 99, 151, 202, 128, 158, 233, 180, 21, 105, 39, 212, 109, 25,
-    56, 158, 38, 80, 210, 203, 0, 230, 240, 60, 120, 31, 233, 248, 168, 36, 126, 30, 108, 168, 75, 141, 25, 52, 249,
-    146, 238, 249, 238, 17, 208, 198, 122, 243, 124, 223, 145, 2, 120, 159, 212, 156, 126, 252, 118, 23, 117, 58, 160,
-    202, 127, 197, 148, 112, 17, 52, 200, 142, 13, 228, 161, 158, 232, 181, 156, 100, 31, 196, 61, 239, 245, 12, 38,
-    154, 80, 98, 83, 86, 104, 181, 22, 51, 79, 213, 56, 213, 243, 22, 12, 200, 41, 131, 225, 226, 106, 190, 29, 131, 43,
-    144, 114, 48, 183, 117, 59, 228, 213, 153, 57, 71, 170, 198, 131, 114, 26, 79, 228, 172, 97, 8, 178, 190, 112, 98,
-    67, 236, 225, 70, 40, 12, 67, 93, 238, 128, 151, 81, 202, 108, 70, 211, 21, 252, 149, 176, 35, 149, 135, 225, 242,
-    49, 62, 187, 60, 13, 211, 150, 39, 246, 203, 235, 244, 42, 195, 168, 117, 177, 25, 171, 222, 50, 216, 44, 199, 71,
-    117, 111, 113, 63, 210, 30, 250, 163, 144, 1, 254, 10, 213, 219, 85, 250, 136, 163, 255, 124, 71, 231, 232, 156,
-    113, 133, 45, 213, 183, 152, 60, 108, 119, 170, 45, 251, 69, 118, 221, 47, 12, 7, 23, 23, 163, 255, 143, 79, 148,
-    84, 160, 14, 83, 234, 15, 160, 207, 90, 141, 110, 65, 105, 22, 180, 205, 254, 100, 60, 210, 33, 60, 215, 103, 98,
-    49, 51, 7, 88, 227, 106, 182, 20, 194, 34, 19, 70, 200, 176, 86, 149, 140, 4, 134, 152, 34, 47, 63, 189, 94, 50, 46,
-    227, 228, 130, 5, 242, 239, 193, 210, 53, 142, 30, 195, 249, 235, 53, 127, 95, 230, 204, 248, 144, 239, 212, 126, 1,
-    227, 193, 247, 13, 151, 115, 59, 194, 230, 19, 156, 25, 69, 119, 99, 210, 145, 162, 7, 203, 222, 56, 216, 103, 252,
-    115, 200, 45, 203, 222, 244, 129, 96, 99, 110, 202, 90, 249, 244, 162, 146, 167, 201, 87, 156, 54, 107, 170, 125, 1,
-    23, 134, 33, 26, 84, 111, 55, 18, 75, 193, 137, 140, 95, 185, 67, 110, 233, 58, 4, 157, 115, 215, 232, 117, 89, 43,
-    185, 115, 247, 9, 41, 161, 179, 12, 77, 61, 45, 4, 184, 164, 74, 52, 19, 91, 114, 52, 126, 105, 247, 97, 244, 118,
-    98, 82, 234, 84, 87, 210, 25, 34, 21, 122, 36, 168, 210, 18, 127, 85, 47, 15, 227, 48, 154, 243, 18, 201, 50, 74,
-    149, 161, 167, 29, 67, 168, 103, 86, 68, 165, 239, 100, 126, 231, 131, 224, 184, 112, 89, 45, 24, 203, 112, 249,
-    107, 132, 168, 12, 42, 205, 118, 166, 20, 48, 215, 157, 204, 47, 140, 44, 249, 214, 217, 221, 137, 205, 138, 84,
-    244, 219, 173, 124, 40, 127, 197, 98, 151, 208, 255, 3, 66, 61, 2, 12, 251, 183, 4, 135, 85, 49, 249, 252, 74, 183,
-    87, 200, 215, 64, 130, 194, 178, 134, 32, 151, 212, 111, 181, 77, 197, 9, 225, 47, 210, 143, 15, 148, 228, 195, 209,
-    246, 83, 110, 146, 139, 87, 138, 223, 251, 214, 17, 212, 141, 225, 131, 144, 142, 112, 193, 170, 56, 34, 165, 89,
-    50, 0, 111, 193, 149, 252, 38, 33, 5, 113, 119, 108, 216, 126, 144, 179, 132, 135, 27, 51, 20, 80, 239, 60, 204,
-    123, 201, 103, 221, 217, 66, 139, 107, 61, 18, 86, 38, 124, 184, 139, 253, 183, 142, 126, 227, 170, 214, 52, 160,
-    190, 204, 239, 14, 83, 36, 117, 143, 179, 14, 20, 9, 125, 203, 150, 231, 116, 40, 51, 242, 89, 187, 47, 74, 202,
-    247, 111, 62, 89, 225, 160, 189, 2, 36, 162, 138, 219, 190, 84, 36, 214, 254, 206, 148, 79, 87, 128, 224, 200, 59,
-    236, 110, 204, 168, 240, 176, 136, 3, 145, 198, 158, 186, 2, 184, 235, 34, 177, 130, 4, 212, 156, 230, 108, 242,
-    131, 19, 169, 100, 84, 61, 0, 236, 144, 20, 202, 33, 89, 70, 25, 5, 130, 229, 186, 225, 221, 95, 19, 49, 66, 173,
-    16, 1, 148, 219, 161, 36, 87, 118, 83, 147, 47, 170, 94, 35, 59, 24, 0, 82, 1, 91, 5, 60, 140, 120, 127, 166, 231,
-    117, 132, 145, 125, 156, 98, 26, 66, 230, 156, 43, 114, 54, 51, 201, 215, 142, 120, 198, 0, 151, 48, 51, 99, 209,
-    62, 99, 68, 252, 65, 136, 146, 91, 128, 70, 211, 33, 90, 205, 205, 213, 231, 47, 131, 47, 22, 105, 180, 175, 193,
-    210, 17, 129, 93, 5, 202, 1, 253, 120, 201, 58, 176, 164, 247, 252, 186, 56, 139, 174, 67, 226, 21, 127, 39, 131,
-    148, 238, 31, 167, 217, 94, 106, 111, 187, 111, 72, 161, 220, 73, 143, 86, 213, 84, 127, 28, 190, 145, 155, 27, 56,
-    229, 188, 158, 203, 158, 254, 78, 242, 164, 113, 229, 101, 219, 27, 66, 150, 176, 120, 78, 120, 237, 68, 247, 146,
-    182, 150, 179, 105, 90, 183, 255, 109, 159, 134, 64, 53, 16, 58, 251, 40, 206, 109, 183, 9, 168, 187, 173, 40, 146,
-    66, 130, 91, 247, 97, 159, 234, 207, 94, 223, 190, 137, 116, 51, 77, 207, 118, 146, 124, 172, 76, 234, 27, 226, 194,
-    47, 122, 180, 32, 163, 147, 137, 204, 17, 204, 66, 18, 226, 59, 156, 27, 95, 119, 72, 18, 17, 180, 156, 202, 169,
-    216, 194, 74, 161, 200, 248, 198, 216, 78, 26, 65, 1, 10, 78, 105, 139, 214, 245, 46, 125, 172, 168, 63, 194, 255,
-    220, 204, 63, 101, 143, 219, 71, 192, 59, 108, 120, 121, 25, 81, 180, 80, 167, 174, 176, 200, 106, 150, 206, 49, 81,
-    254, 167, 37, 87, 206, 237, 74, 111, 240, 96, 106, 40, 30, 165, 84, 6, 120, 106, 96, 21, 166, 224, 42, 120, 134,
-    235, 87, 221, 169, 166, 11, 151, 207, 16, 79, 135, 138, 150, 121, 102, 232, 237, 30, 31, 141, 7, 145, 178, 185, 169,
-    4, 38, 26, 81, 180, 22, 107, 70, 123, 149, 219, 216, 197, 226, 25, 84, 216, 29, 81, 148, 65, 5, 183, 65, 63, 217,
-    34, 35, 102, 122, 134, 255, 149, 41, 201, 143, 55, 187, 147, 199, 58, 88, 88, 241, 7, 236, 201, 35, 10, 157, 6, 196,
-    105, 140, 146, 176, 176, 240, 76, 99, 146, 158, 81, 43, 36, 149, 255, 193, 66, 99, 43, 146, 67, 136, 204, 49, 136,
-    0, 232, 221, 240, 167, 50, 253, 121, 95, 178, 221, 240, 185, 118, 64, 143, 19, 44, 6, 133, 184, 67, 159, 225, 193,
-    81, 61, 131, 151, 172, 52, 73, 252, 225, 218, 240, 190, 70, 73, 115, 192, 10, 6, 188, 145, 189, 41, 22, 132, 126,
-    164, 85, 65, 152, 140, 113, 223, 179, 21, 31, 166, 25, 8, 170, 3, 230, 29, 217, 126, 25, 248, 246, 233, 232, 175,
-    138, 172, 4, 11, 171, 146, 59, 247, 102, 115, 252, 9, 12, 211, 239, 250, 65, 236, 125, 216, 111, 33, 253, 31, 164,
-    149, 204, 11, 69, 217, 31, 152, 91, 109, 173, 114, 113, 249, 214, 227, 161, 107, 160, 166, 172, 207, 96, 13, 155,
-    25, 19, 132, 62, 207, 93, 214, 208, 24, 68, 41, 145, 50, 33, 82, 210, 203, 91, 141, 240, 40, 27, 200, 7, 58, 227,
-    34, 238, 173, 138, 96, 248, 227, 43, 215, 78, 253, 106, 139, 215, 234, 38, 218, 231, 104, 79, 73, 11, 212, 229, 141,
-    237, 248, 240, 48, 165, 43, 242, 108, 205, 35, 248, 42, 164, 239, 252, 207, 144, 38, 252, 7, 42, 94, 75, 162, 8,
-    208, 6, 251, 24, 3, 84, 70, 148, 45, 9, 216, 50, 211, 0, 31, 154, 217, 157, 20, 239, 186, 249, 137, 134, 210, 234,
-    250, 234, 26, 220, 97, 19, 130, 69, 210, 240, 136, 87, 136, 100, 45, 159, 73, 241, 169, 79, 191, 77, 237, 191, 183,
-    118, 228, 59, 179, 113, 89, 18, 4, 221, 185, 39, 132, 38, 123, 62, 70, 49, 31, 91, 155, 196, 80, 6, 189, 147, 87, 7,
-    231, 18, 84, 153, 2, 35, 242, 188, 226, 23, 252, 224, 201, 42, 210, 175, 99, 69, 123, 254, 158, 109, 244, 133, 157,
-    122, 11, 122, 101, 142, 213, 160, 28, 132, 99, 64, 160, 154, 43, 243, 140, 202, 112, 72, 2, 184, 125, 233, 245, 147,
-    35, 222, 213, 136, 248, 112, 75, 69, 78, 62, 46, 219, 240, 167, 61, 233, 145, 185, 215, 113, 152, 18, 231, 172, 118,
-    7, 92, 218, 246, 102, 195, 74, 140, 169, 160, 230, 203, 50, 40, 135, 183, 163, 235, 247, 168, 38, 114, 225, 220,
-    173, 5, 234, 86, 227, 61, 202, 205, 3, 77, 23, 35, 0, 138, 149, 204, 206, 254, 165, 96, 96, 55, 74, 90, 25, 42, 226,
-    52, 131, 69, 101, 182, 166, 8, 213, 18, 251, 226, 248, 64, 123, 5, 218, 0, 190, 190, 186, 85, 107, 146, 45, 1, 235,
-    196, 169, 162, 130, 163, 85, 202, 134, 226, 121, 255, 87, 2, 60, 161, 35, 83, 58, 136, 40, 185, 51, 106, 9, 45, 120,
-    30, 91, 14, 81, 198, 123, 51, 170, 37, 137, 221, 168, 145, 207, 224, 6, 58, 75, 84, 219, 175, 111, 46, 29, 252, 59,
-    14, 42, 51, 125, 211, 218, 230, 137, 124, 10, 107, 15, 90, 223, 103, 114, 120, 50, 146, 134, 158, 150, 103, 129,
-    155, 209, 181, 37, 21, 27, 149, 140, 74, 144, 208, 80, 245, 71, 2, 180, 39, 168, 13, 184, 134, 139, 39, 221, 34, 24,
-    245, 247, 175, 7, 85, 209, 130, 0, 132, 6, 25, 8, 237, 238, 88, 224, 63, 25, 204, 103, 128, 184, 3, 158, 64, 131,
-    128, 186, 156, 181, 90, 220, 255, 73, 53, 27, 180, 175, 62, 72, 138, 4, 129, 226, 57, 196, 164, 64, 170, 56, 167,
-    96, 180, 194, 184, 39, 61, 24, 35, 56, 242, 222, 123, 222, 118, 195, 20, 237, 223, 112, 95, 95, 128, 14, 252, 165,
-    110, 61, 232, 129, 146, 253, 123, 246, 233, 149, 115, 164, 199, 126, 44, 26, 25, 157, 58, 70, 100, 169, 77, 201, 87,
-    171, 9, 198, 235, 169, 101, 90, 95, 32, 147, 234, 163, 2, 77, 86, 94, 137, 165, 190, 242, 208, 113, 112, 10, 170,
-    139, 136, 152, 14, 212, 76, 196, 25, 172, 146, 34, 84, 54, 237, 212, 138, 139, 56, 154, 86, 49, 95, 216, 34, 24,
-    104, 129, 98, 66, 23, 3, 69, 16, 252, 75, 96, 21, 158, 30, 136, 215, 112, 49, 32, 122, 178, 204, 148, 42, 84, 165,
-    235, 119, 217, 206, 71, 17, 180, 88, 187, 60, 45, 240, 237, 23, 37, 218, 57, 157, 42, 129, 182, 48, 22, 81, 110,
-    238, 161, 69, 212, 107, 109, 16, 105, 166, 9, 12, 137, 183, 158, 125, 218, 137, 104, 75, 239, 100, 205, 156, 103,
-    75, 33, 217, 59, 85, 203, 200, 52, 146, 141, 245, 214, 157, 118, 14, 76, 159, 54, 159, 208, 188, 20, 73, 101, 90,
-    190, 112, 67, 46, 100, 66, 75, 228, 141, 223, 234, 252, 89, 169, 221, 27, 179, 126, 173, 82, 183, 146, 187, 211,
-    193, 235, 175, 194, 154, 167, 2, 215, 83, 21, 148, 28, 112, 140, 23, 109, 216, 214, 49, 139, 117, 73, 213, 89, 51,
-    18, 4, 90, 207, 3, 208, 135, 240, 241, 104, 148, 75, 173, 57, 22, 166, 1, 179, 33, 48, 66, 12, 185, 161, 105, 60,
-    73, 157, 3, 175, 147, 44, 243, 1, 145, 23, 57, 38, 223, 215, 129, 254, 230, 23, 141, 56, 147, 181, 247, 44, 225, 42,
-    111, 251, 160, 148, 153, 235, 51, 16, 175, 25, 192, 252, 94, 247, 233, 27, 105, 127, 242, 236, 140, 232, 252, 5,
-    177, 250, 239, 227, 99, 23, 91, 97, 129, 23, 144, 96, 207, 243, 155, 86, 31, 106, 133, 204, 56, 72, 157, 243, 149,
-    65, 116, 177, 57, 71, 146, 113, 222, 228, 1, 243, 179, 114, 44, 181, 14, 48, 5, 231, 182, 211, 50, 175, 133, 126,
-    85, 126, 50, 170, 65, 202, 71, 196, 57, 76, 49, 37, 18, 71, 79, 78, 84, 236, 254, 248, 103, 67, 45, 159, 184, 25,
-    107, 61, 163, 236, 213, 112, 128, 225, 102, 26, 205, 77, 108, 95, 129, 63, 3, 204, 71, 198, 155, 194, 19, 194, 203,
-    130, 108, 211, 77, 159, 237, 252, 200, 34, 139, 182, 181, 240, 104, 210, 181, 169, 177, 223, 159, 252, 179, 176,
-    146, 248, 59, 151, 189, 225, 208, 155, 0, 233, 77, 37, 144, 215, 202, 134, 251, 74, 175, 108, 212, 34, 16, 94, 88,
-    86, 198, 206, 189, 231, 136, 99, 26, 47, 21, 52, 87, 129, 254, 160, 118, 52, 9, 206, 121, 109, 146, 57, 214, 19,
-    136, 206, 203, 248, 222, 27, 250, 243, 55, 219, 96, 43, 9, 5, 160, 173, 232, 102, 129, 66, 54, 68, 65, 136, 123,
-    245, 168, 119, 218, 133, 121, 183, 138, 126, 240, 54, 113, 25, 67, 99, 5, 195, 117, 85, 109, 103, 37, 1, 239, 176,
-    235, 191, 105, 252, 5, 43, 114, 152, 26, 122, 24, 150, 153, 25, 42, 41, 213, 172, 233, 163, 222, 100, 44, 175, 49,
-    152, 12, 15, 253, 229, 151, 149, 94, 133, 112, 38, 77, 118, 76, 125, 69, 48, 166, 55, 126, 26, 37, 29, 243, 112,
-    101, 5, 80, 234, 211, 175, 93, 10, 110, 56, 6, 32, 116, 41, 195, 155, 173, 104, 228, 118, 169, 85, 201, 168, 14, 78,
-    41, 184, 85, 146, 223, 98, 136, 108, 149, 92, 85, 55, 167, 158, 28, 137, 233, 33, 73, 26, 121, 190, 210, 234, 153,
-    165, 47, 61, 204, 190, 142, 91, 97, 153, 66, 2, 12, 130, 235, 246, 27, 60, 30, 44, 30, 242, 164, 57, 94, 238, 119,
-    169, 80, 167, 187, 185, 237, 115, 242, 98, 54, 175, 124, 29, 161, 116, 19, 132, 98, 19, 65, 13, 225, 28, 132, 222,
-    145, 243, 242, 94, 96, 247, 13, 112, 0, 2, 38, 120, 236, 105, 220, 75, 254, 187, 49, 185, 125, 35, 68, 201, 98, 203,
-    188, 170, 60, 233, 117, 90, 17, 74, 102, 75, 115, 249, 98, 191, 89, 13, 204, 136, 25, 203, 60, 211, 126, 46, 112,
-    64, 37, 90, 72, 77, 31, 238, 116, 128, 250, 99, 242, 62, 251, 243, 170, 85, 166, 88, 8, 3, 1, 159, 14, 239, 84, 85,
-    48, 59, 250, 252, 98, 202, 106, 3, 223, 102, 14, 152, 113, 120, 21, 43, 75, 189, 32, 245, 158, 221, 130, 129, 146,
-    25, 234, 204, 130, 240, 87, 159, 94, 226, 87, 230, 179, 69, 121, 146, 175, 204, 166, 163, 15, 29, 212, 71, 65, 174,
-    53, 76, 150, 138, 215, 172, 86, 217, 121, 4, 239, 202, 248, 33, 154, 195, 127, 94, 147, 64, 151, 168, 79, 227, 249,
-    55, 9, 225, 37, 230, 103, 170, 115, 210, 20, 241, 132, 36, 134, 21, 253, 233, 38, 100, 236, 76, 176, 224, 42, 70,
-    113, 77, 103, 213, 48, 60, 68, 230, 144, 113, 27, 136, 134, 31, 173, 174, 63, 48, 165, 63, 136, 107, 126, 41, 178,
-    93, 92, 13, 65, 124, 246, 128, 75, 167, 176, 35, 236, 50, 20, 148, 137, 80, 71, 171, 178, 113, 59, 101, 150, 166,
-    221, 42, 211, 109, 138, 18, 181, 19, 149, 133, 35, 153, 5, 220, 206, 90, 13, 117, 27, 29, 57, 30, 235, 74, 199, 169,
-    23, 57, 86, 203, 255, 203, 127, 8, 82, 138, 90, 38, 80, 191, 13, 49, 89, 193, 153, 134, 212, 48, 18, 17, 2, 109, 42,
-    90, 113, 16, 144, 19, 40, 11, 53, 164, 16, 196, 123, 90, 217, 217, 254, 253, 17, 239, 236, 251, 103, 160, 191, 187,
-    184, 174, 155, 226, 21, 22, 85, 16, 143, 253, 40, 218, 216, 125, 46, 145, 251, 118, 123, 166, 105, 239, 95, 26, 145,
-    251, 28, 118, 211, 186, 28, 50, 255, 249, 123, 5, 178, 179, 211, 167, 250, 116, 106, 28, 50, 57, 197, 64, 204, 163,
-    130, 177, 22, 121, 189, 121, 189, 245, 31, 120, 110, 110, 233, 222, 20, 31, 198, 214, 231, 45, 131, 50, 214, 243,
-    77, 145, 65, 139, 161, 71, 248, 197, 57, 138, 77, 74, 166, 2, 28, 122, 234, 26, 16, 77, 177, 184, 1, 87, 137, 148,
-    39, 6, 25, 207, 23, 117, 208, 162, 247, 77, 236, 41, 34, 77, 128, 188, 161, 208, 47, 6, 132, 67, 27, 157, 217, 48,
-    237, 15, 254, 31, 86, 161, 212, 39, 226, 58, 48, 240, 111, 241, 94, 7, 148, 112, 241, 237, 90, 179, 211, 86, 13,
-    116, 55, 128, 178, 48, 210, 51, 127, 172, 146, 205, 58, 109, 142, 94, 181, 176, 81, 211, 45, 152, 39, 142, 64, 189,
-    209, 141, 57, 139, 184, 21, 39, 253, 114, 199, 241, 48, 113, 47, 242, 78, 102, 226, 53, 28, 157, 72, 31, 47, 117,
-    245, 122, 66, 130, 125, 15, 195, 232, 254, 89, 58, 133, 65, 74, 93, 209, 223, 163, 242, 157, 2, 50, 108, 115, 17,
-    124, 205, 78, 136, 6, 206, 243, 75, 49, 82, 142, 201, 120, 50, 121, 222, 208, 109, 138, 229, 160, 214, 115, 4, 106,
-    75, 153, 180, 137, 100, 130, 159, 92, 128, 44, 57, 250, 85, 56, 133, 52, 59, 182, 146, 172, 47, 149, 228, 169, 86,
-    14, 145, 107, 151, 16, 74, 182, 171, 91, 75, 46, 244, 245, 61, 2, 123, 222, 160, 118, 198, 146, 29, 103, 119, 166,
-    38, 238, 88, 70, 61, 120, 6, 121, 175, 11, 205, 116, 119, 80, 31, 198, 144, 39, 62, 238, 115, 210, 39, 109, 161, 85,
-    133, 137, 91, 233, 66, 156, 35, 233, 21, 167, 209, 190, 135, 45, 90, 82, 70, 160, 209, 218, 40, 114, 238, 28, 63,
-    74, 123, 184, 182, 88, 64, 112, 102, 69, 67, 213, 126, 164, 150, 200, 253, 226, 214, 168, 3, 195, 158, 108, 1, 48,
-    152, 203, 98, 48, 1, 137, 11, 115, 153, 90, 115, 94, 56, 87, 13, 90, 102, 42, 54, 75, 167, 223, 119, 12, 99, 209,
-    141, 67, 121, 215, 200, 195, 197, 95, 14, 105, 199, 213, 72, 218, 115, 112, 175, 18, 195, 185, 24, 112, 125, 99, 66,
-    85, 75, 246, 54, 5, 102, 124, 232, 164, 198, 178, 145, 97, 212, 155, 131, 114, 202, 118, 225, 209, 6, 217, 185, 132,
-    203, 135, 221, 201, 78, 137, 232, 174, 203, 127, 221, 81, 46, 162, 200, 207, 162, 153, 126, 167, 64, 221, 123, 28,
-    226, 90, 191, 94, 177, 13, 11, 159, 101, 220, 46, 118, 174, 132, 37, 26, 175, 99, 67, 233, 228, 173, 130, 234, 142,
-    29, 33, 75, 58, 144, 97, 188, 53, 67, 117, 219, 86, 38, 5, 68, 148, 251, 205, 77, 112, 29, 249, 169, 71, 13, 74,
-    170, 183, 212, 197, 250, 117, 226, 15, 95, 189, 207, 103, 200, 154, 199, 145, 2, 209, 151, 135, 156, 153, 32, 159,
-    86, 176, 27, 116, 93, 76, 243, 28, 9, 81, 65, 187, 35, 53, 226, 71, 63, 2, 76, 236, 127, 186, 12, 33, 183, 253, 218,
-    108, 132, 187, 218, 171, 210, 58, 219, 200, 163, 217, 27, 250, 63, 54, 112, 100, 225, 241, 196, 137, 246, 133, 63,
-    41, 131, 118, 29, 141, 11, 97, 126, 229, 188, 21, 155, 115, 58, 157, 172, 92, 244, 2, 25, 163, 38, 175, 148, 233,
-    11, 103, 142, 144, 219, 182, 126, 234, 99, 240, 136, 203, 6, 246, 247, 100, 79, 108, 194, 51, 28, 145, 13, 2, 119,
-    120, 36, 77, 35, 122, 253, 141, 29, 221, 0, 34, 1, 240, 234, 115, 4, 99, 250, 146, 191, 247, 69, 183, 232, 128, 151,
-    255, 104, 19, 252, 141, 201, 90, 28, 86, 19, 87, 40, 252, 5, 133, 8, 54, 198, 63, 178, 175, 36, 113, 28, 125, 193,
-    69, 243, 215, 243, 135, 252, 128, 213, 82, 177, 96, 41, 223, 220, 92, 107, 105, 210, 136, 143, 157, 187, 142, 75,
-    236, 122, 226, 248, 169, 65, 69, 185, 151, 112, 226, 23, 196, 6, 244, 20, 145, 76, 63, 159, 76, 225, 97, 230, 130,
-    40, 43, 154, 1, 102, 1, 191, 24, 232, 252, 97, 52, 38, 178, 236, 213, 110, 80, 151, 255, 38, 28, 96, 173, 90, 98, 0,
-    63, 26, 144, 215, 21, 196, 237, 19, 154, 94, 78, 199, 246, 36, 31, 131, 28, 94, 209, 41, 126, 200, 152, 80, 237, 88,
-    146, 108, 28, 13, 58, 237, 92, 233, 91, 123, 57, 69, 85, 81, 211, 10, 93, 143, 158, 186, 149, 179, 130, 127, 170,
-    41, 26, 4, 54, 57, 197, 134, 122, 7, 247, 136, 88, 207, 1, 18, 49, 15, 153, 5, 223, 27, 157, 131, 22, 246, 92, 188,
-    137, 33, 29, 91, 68, 217, 20, 173, 105, 34, 165, 170, 73, 210, 245, 130, 86, 32, 71, 40, 186, 142, 34, 243, 17, 229,
-    177, 156, 159, 228, 166, 133, 146, 157, 162, 202, 112, 72, 69, 73, 44, 155, 234, 182, 126, 78, 96, 153, 23, 208,
-    219, 224, 231, 27, 185, 208, 242, 186, 199, 229, 42, 172, 121, 162, 107, 13, 229, 236, 226, 9, 150, 59, 105, 244,
-    143, 58, 228, 57, 29, 36, 135, 208, 166, 23, 72, 128, 90, 133, 84, 168, 162, 244, 218, 110, 158, 77, 158, 234, 209,
-    83, 86, 206, 64, 169, 146, 224, 104, 254, 157, 211, 169, 241, 208, 169, 76, 86, 8, 228, 148, 226, 28, 244, 176, 52,
-    255, 33, 175, 95, 176, 154, 42, 92, 171, 69, 163, 33, 156, 226, 213, 40, 28, 251, 174, 58, 19, 140, 66, 110, 248,
-    59, 205, 43, 171, 33, 5, 228, 36, 131, 130, 73, 205, 185, 56, 154, 244, 232, 191, 110, 135, 151, 78, 79, 51, 76,
-    197, 83, 67, 245, 245, 29, 235, 121, 245, 80, 150, 64, 80, 44, 245, 167, 253, 31, 213, 147, 200, 211, 3, 23, 45,
-    219, 197, 43, 182, 89, 125, 42, 45, 246, 13, 102, 226, 202, 109, 204, 227, 150, 68, 238, 238, 230, 42, 34, 219, 118,
-    156, 184, 125, 104, 242, 228, 142, 5, 123, 165, 69, 230, 5, 235, 175, 200, 174, 139, 34, 35, 215, 244, 118, 108, 95,
-    197, 242, 163, 238, 202, 27, 189, 115, 226, 32, 27, 185, 16, 104, 151, 251, 251, 226, 105, 191, 41, 92, 193, 24,
-    198, 115, 238, 12, 72, 231, 82, 44, 163, 26, 120, 150, 117, 203, 94, 22, 185, 173, 41, 31, 50, 84, 194, 12, 233,
-    244, 200, 195, 173, 17, 219, 128, 228, 110, 168, 188, 171, 150, 126, 153, 236, 166, 32, 90, 8, 16, 69, 197, 36, 210,
-    210, 230, 203, 54, 70, 47, 126, 37, 242, 100, 211, 147, 34, 232, 201, 119, 166, 183, 58, 88, 143, 107, 212, 209, 3,
-    203, 104, 52, 58, 100, 168, 112, 226, 33, 52, 135, 15, 223, 104, 108, 171, 38, 205, 161, 75, 7, 211, 187, 144, 192,
-    7, 4, 112, 12, 1, 178, 27, 10, 193, 153, 111, 209, 70, 205, 144, 106, 106, 51, 81, 188, 68, 212, 198, 86, 149, 66,
-    45, 152, 116, 237, 225, 154, 218, 242, 74, 87, 180, 95, 153, 143, 212, 196, 245, 137, 27, 59, 198, 161, 44, 46, 186,
-    102, 149, 21, 108, 90, 195, 108, 15, 178, 253, 106, 205, 186, 136, 171, 166, 233, 242, 154, 129, 159, 243, 159, 0,
-    177, 174, 153, 178, 219, 170, 66, 35, 24, 209, 49, 92, 85, 162, 5, 13, 163, 30, 79, 167, 111, 220, 77, 140, 232,
-    103, 74, 146, 185, 34, 58, 158, 54, 122, 90, 237, 47, 24, 219, 115, 207, 2, 207, 173, 58, 185, 48, 128, 137, 42, 52,
-    145, 173, 238, 99, 84, 227, 28, 200, 109, 168, 154, 75, 154, 109, 53, 48, 99, 74, 252, 105, 43, 27, 204, 252, 243,
-    91, 218, 59, 4, 99, 36, 2, 121, 174, 6, 70, 62, 89, 47, 191, 51, 99, 132, 148, 161, 213, 63, 150, 101, 192, 244, 19,
-    31, 147, 196, 239, 242, 30, 62, 33, 115, 229, 103, 19, 118, 130, 225, 90, 161, 4, 132, 179, 67, 180, 85, 101, 79,
-    122, 156, 189, 60, 211, 119, 82, 244, 191, 54, 142, 115, 121, 60, 200, 142, 134, 69, 227, 176, 92, 159, 112, 165,
-    94, 184, 182, 31, 156, 80, 90, 17, 236, 44, 85, 221, 200, 121, 54, 118, 196, 206, 62, 236, 146, 154, 118, 181, 142,
-    0, 138, 113, 85, 116, 59, 75, 228, 254, 101, 213, 143, 147, 237, 87, 17, 41, 165, 3, 235, 142, 76, 71, 105, 89, 117,
-    23, 146, 18, 232, 173, 33, 69, 94, 107, 109, 62, 134, 204, 97, 26, 24, 163, 95, 1, 90, 151, 171, 126, 202, 204, 222,
-    160, 35, 213, 247, 136, 230, 182, 34, 126, 48, 8, 189, 100, 167, 252, 92, 98, 6, 0, 53, 179, 6, 218, 78, 74, 118,
-    156, 120, 14, 123, 117, 39, 234, 184, 66, 247, 41, 92, 22, 18, 149, 178, 229, 216, 64, 123, 222, 63, 48, 202, 152,
-    21, 25, 12, 213, 60, 65, 39, 78, 247, 66, 0, 166, 245, 208, 184, 194, 220, 190, 111, 104, 22, 27, 172, 208, 10, 232,
-    213, 91, 205, 254, 101, 113, 216, 241, 192, 17, 143, 162, 18, 43, 178, 203, 162, 68, 156, 112, 249, 150, 114, 89,
-    144, 122, 163, 211, 75, 11, 139, 11, 233, 118, 83, 223, 238, 119, 171, 25, 251, 6, 58, 59, 218, 178, 134, 63, 248,
-    241, 212, 54, 233, 19, 123, 203, 245, 32, 212, 124, 52, 56, 194, 149, 211, 141, 12, 156, 13, 105, 227, 210, 206, 80,
-    12, 224, 201, 187, 254, 211, 72, 68, 72, 34, 229, 178, 157, 223, 174, 232, 179, 92, 209, 124, 131, 16, 227, 71, 246,
-    106, 181, 212, 220, 177, 155, 84, 14, 62, 152, 193, 120, 103, 27, 58, 189, 160, 245, 134, 161, 51, 19, 99, 94, 241,
-    98, 208, 46, 65, 228, 227, 146, 241, 209, 106, 239, 226, 166, 59, 146, 115, 200, 44, 86, 158, 45, 129, 64, 81, 154,
-    188, 31, 1, 214, 195, 252, 155, 15, 67, 164, 15, 217, 242, 143, 161, 107, 246, 187, 26, 59, 88, 116, 187, 1, 132,
-    156, 28, 148, 250, 59, 78, 18, 193, 161, 115, 2, 249, 146, 62, 101, 99, 235, 189, 223, 44, 147, 171, 57, 235, 95,
-    222, 9, 222, 11, 148, 51, 3, 85, 13, 114, 214, 153, 115, 137, 49, 23, 75, 92, 59, 200, 108, 230, 190, 81, 233, 205,
-    212, 48, 231, 65, 37, 23, 138, 255, 82, 190, 160, 158, 63, 0, 69, 102, 34, 162, 208, 207, 193, 251, 215, 244, 4, 30,
-    132, 184, 76, 52, 87, 85, 39, 59, 168, 92, 3, 68, 214, 122, 162, 152, 88, 231, 250, 159, 180, 73, 107, 168, 0, 191,
-    144, 40, 134, 146, 125, 135, 212, 114, 83, 32, 86, 117, 219, 33, 103, 52, 157, 252, 236, 84, 41, 227, 17, 197, 107,
-    56, 36, 238, 158, 161, 0, 246, 30, 52, 139, 109, 35, 42, 182, 150, 177, 235, 76, 83, 142, 53, 153, 51, 61, 204, 136,
-    53, 237, 42, 29, 163, 5, 92, 134, 68, 189, 12, 158, 89, 15, 67, 208, 210, 3, 126, 218, 232, 22, 185, 111, 181, 176,
-    156, 15, 38, 146, 59, 210, 138, 243, 212, 246, 71, 23, 109, 117, 214, 65, 108, 250, 103, 229, 43, 77, 0, 234, 72,
-    57, 96, 62, 216, 172, 154, 123, 103, 159, 91, 245, 165, 44, 196, 193, 152, 109, 126, 101, 141, 194, 37, 130, 241,
-    158, 204, 28, 204, 58, 155, 247, 134, 179, 244, 143, 180, 26, 89, 88, 202, 113, 168, 164, 49, 66, 105, 121, 152,
-    125, 16, 146, 184, 82, 138, 103, 240, 161, 219, 89, 213, 137, 222, 24, 31, 190, 13, 87, 20, 13, 74, 245, 31, 186,
-    217, 103, 14, 199, 97, 126, 194, 72, 26, 105, 184, 228, 162, 156, 224, 46, 178, 124, 124, 171, 220, 159, 224, 46,
-    139, 160, 97, 224, 202, 164, 40, 152, 121, 47, 238, 135, 234, 26, 186, 34, 143, 169, 148, 232, 112, 80, 146, 250,
-    153, 158, 69, 38, 144, 16, 26, 214, 69, 100, 241, 221, 87, 137, 218, 160, 98, 225, 178, 82, 81, 112, 253, 7, 108,
-    238, 167, 235, 49, 65, 95, 48, 80, 159, 35, 36, 252, 4, 5, 234, 161, 209, 38, 214, 147, 13, 154, 89, 105, 177, 154,
-    153, 43, 65, 205, 88, 154, 49, 95, 45, 212, 189, 173, 6, 211, 150, 44, 165, 97, 199, 38, 250, 56, 176, 95, 105, 43,
-    122, 183, 246, 202, 126, 106, 117, 13, 145, 77, 241, 194, 205, 217, 151, 82, 96, 252, 56, 90, 19, 210, 18, 220, 123,
-    58, 78, 134, 179, 254, 46, 12, 220, 194, 216, 101, 176, 91, 237, 67, 102, 33, 82, 121, 118, 14, 201, 78, 218, 107,
-    134, 127, 65, 255, 7, 139, 89, 61, 233, 109, 95, 204, 153, 98, 100, 90, 168, 171, 5, 186, 254, 111, 80, 236, 13, 59,
-    5, 56, 65, 145, 131, 245, 205, 255, 80, 169, 199, 208, 189, 219, 232, 181, 75, 198, 140, 233, 129, 119, 104, 172,
-    12, 222, 196, 149, 197, 235, 226, 248, 14, 36, 52, 94, 101, 92, 54, 34, 214, 101, 84, 142, 68, 56, 203, 111, 38,
-    121, 241, 107, 16, 225, 150, 111, 154, 86, 19, 56, 182, 163, 21, 178, 179, 204, 232, 177, 18, 61, 83, 64, 17, 111,
-    81, 57, 212, 144, 204, 150, 220, 201, 86, 32, 60, 70, 129, 140, 50, 231, 149, 174, 99, 21, 60, 196, 186, 9, 16, 156,
-    33, 196, 221, 84, 60, 118, 73, 220, 113, 25, 110, 54, 193, 75, 98, 117, 31, 90, 107, 91, 100, 240, 181, 158, 83,
-    144, 165, 46, 120, 128, 155, 39, 108, 137, 243, 42, 209, 243, 142, 89, 132, 24, 183, 232, 81, 139, 113, 112, 21, 38,
-    42, 93, 18, 164, 72, 128, 107, 191, 227, 45, 222, 89, 252, 77, 114, 33, 249, 180, 85, 22, 179, 26, 28, 51, 111, 54,
-    250, 50, 189, 135, 107, 215, 212, 235, 162, 167, 132, 75, 56, 9, 200, 148, 14, 133, 53, 168, 139, 47, 123, 134, 86,
-    42, 138, 224, 246, 141, 47, 188, 6, 213, 234, 228, 112, 59, 228, 100, 241, 70, 101, 221, 211, 248, 125, 204, 209,
-    124, 232, 40, 102, 205, 78, 238, 39, 166, 201, 39, 160, 125, 204, 197, 247, 237, 83, 210, 94, 12, 191, 31, 8, 91,
-    85, 230, 235, 196, 124, 188, 190, 168, 64, 54, 56, 106, 232, 81, 195, 202, 111, 39, 203, 133, 226, 105, 85, 63, 117,
-    186, 116, 128, 109, 67, 176, 242, 26, 160, 66, 124, 223, 201, 89, 206, 231, 62, 227, 98, 72, 162, 212, 182, 60, 140,
-    141, 48, 216, 162, 223, 18, 126, 15, 168, 118, 151, 116, 85, 191, 167, 121, 37, 114, 70, 182, 18, 8, 152, 232, 125,
-    178, 247, 230, 59, 115, 121, 196, 64, 207, 153, 168, 194, 103, 146, 101, 186, 209, 202, 102, 156, 191, 94, 195, 74,
-    12, 138, 243, 42, 124, 13, 144, 154, 147, 123, 204, 50, 143, 168, 185, 74, 252, 247, 202, 113, 196, 168, 70, 109,
-    253, 93, 1, 98, 131, 174, 149, 33, 171, 65, 190, 24, 241, 250, 52, 76, 176, 59, 29, 93, 101, 55, 90, 79, 227, 95,
-    160, 0, 103, 111, 57, 139, 121, 82, 42, 243, 158, 217, 244, 187, 72, 41, 22, 184, 155, 132, 47, 147, 184, 15, 58,
-    75, 195, 38, 32, 192, 44, 83, 125, 112, 92, 122, 40, 126, 35, 86, 88, 70, 178, 89, 148, 121, 53, 71, 55, 125, 181,
-    52, 77, 30, 175, 222, 64, 194, 236, 26, 18, 220, 90, 0, 196, 209, 137, 103, 163, 6, 167, 65, 122, 116, 45, 104, 159,
-    130, 89, 132, 228, 46, 132, 58, 231, 252, 162, 6, 236, 29, 30, 250, 179, 153, 143, 158, 151, 126, 161, 147, 91, 1,
-    46, 122, 80, 171, 66, 150, 9, 211, 156, 174, 155, 94, 212, 127, 126, 88, 109, 222, 214, 81, 62, 145, 228, 203, 157,
-    95, 102, 6, 150, 108, 143, 184, 239, 145, 103, 241, 115, 59, 162, 98, 47, 110, 201, 209, 34, 211, 132, 100, 117,
-    102, 122, 160, 46, 12, 76, 86, 0, 189, 249, 33, 138, 145, 135, 109, 212, 18, 191, 211, 212, 246, 238, 8, 21, 36, 73,
-    86, 118, 147, 126, 145, 145, 26, 234, 183, 174, 76, 98, 222, 17, 33, 87, 115, 156, 238, 142, 228, 67, 223, 211, 107,
-    219, 180, 35, 19, 22, 66, 131, 9, 106, 85, 118, 102, 209, 196, 45, 247, 134, 148, 229, 223, 212, 96, 164, 79, 157,
-    193, 174, 135, 43, 137, 169, 95, 98, 6, 70, 232, 247, 82, 141, 65, 14, 47, 186, 19, 206, 23, 3, 6, 255, 23, 255, 30,
-    250, 222, 204, 234, 84, 130, 120, 115, 57, 239, 73, 28, 103, 102, 230, 210, 115, 91, 221, 65, 61, 5, 156, 17, 33,
-    215, 13, 170, 165, 117, 250, 246, 46, 204, 226, 95, 247, 213, 114, 104, 86, 198, 120, 63, 175, 48, 69, 125, 251, 80,
-    177, 97, 3, 153, 244, 165, 205, 123, 104, 107, 62, 35, 48, 2, 111, 45, 123, 229, 47, 0, 25, 168, 216, 94, 112, 143,
-    93, 7, 10, 54, 194, 121, 169, 223, 51, 6, 62, 97, 132, 118, 148, 23, 241, 201, 69, 23, 199, 85, 90, 3, 28, 65, 17,
-    221, 212, 249, 167, 249, 11, 120, 79, 161, 190, 55, 37, 218, 120, 167, 62, 83, 166, 194, 231, 254, 234, 120, 224,
-    155, 119, 230, 50, 184, 211, 53, 55, 118, 192, 138, 130, 137, 110, 84, 149, 35, 19, 237, 41, 163, 15, 152, 63, 79,
-    125, 189, 248, 23, 52, 207, 170, 118, 167, 73, 188, 230, 206, 44, 53, 156, 86, 57, 72, 1, 160, 168, 60, 48, 68, 149,
-    23, 191, 145, 252, 161, 91, 232, 89, 197, 247, 96, 100, 16, 117, 123, 246, 172, 115, 13, 160, 119, 252, 101, 149,
-    164, 114, 28, 149, 218, 195, 238, 190, 255, 161, 251, 82, 253, 16, 30, 46, 111, 94, 186, 71, 87, 214, 12, 127, 59,
-    198, 20, 192, 100, 35, 40, 84, 223, 155, 78, 28, 186, 225, 207, 68, 137, 171, 82, 83, 153, 223, 27, 169, 225, 195,
-    120, 196, 167, 223, 168, 195, 186, 248, 228, 201, 242, 232, 25, 102, 207, 109, 159, 6, 58, 194, 51, 208, 69, 43,
-    102, 212, 163, 119, 156, 131, 144, 136, 15, 39, 47, 219, 51, 74, 236, 141, 79, 146, 26, 78, 208, 205, 55, 70, 148,
-    41, 11, 248, 73, 87, 17, 96, 182, 193, 72, 233, 85, 17, 35, 95, 7, 198, 54, 241, 203, 166, 232, 144, 210, 68, 1, 80,
-    138, 189, 141, 126, 29, 209, 250, 17, 209, 217, 255, 235, 196, 132, 171, 184, 133, 208, 124, 224, 63, 120, 4, 143,
-    102, 50, 54, 7, 88, 32, 246, 136, 119, 134, 232, 59, 105, 219, 150, 47, 88, 160, 51, 182, 240, 190, 29, 199, 56, 59,
-    173, 238, 139, 185, 237, 74, 38, 18, 41, 0, 96, 49, 29, 128, 31, 248, 130, 135, 123, 78, 118, 175, 177, 198, 211,
-    129, 253, 59, 148, 199, 32, 242, 144, 109, 37, 3, 185, 217, 199, 108, 57, 217, 168, 166, 249, 137, 236, 248, 8, 3,
-    42, 99, 248, 64, 65, 168, 151, 87, 209, 63, 26, 28, 170, 68, 100, 177, 230, 141, 44, 43, 172, 221, 188, 224, 239,
-    151, 217, 22, 149, 146, 51, 177, 61, 226, 147, 114, 125, 70, 255, 183, 193, 79, 250, 101, 154, 213, 55, 67, 139,
-    174, 181, 159, 114, 66, 12, 53, 76, 64, 179, 181, 3, 97, 147, 26, 34, 100, 152, 253, 132, 220, 1, 110, 133, 191,
-    227, 205, 17, 245, 55, 233, 189, 235, 86, 238, 245, 252, 4, 27, 52, 219, 224, 204, 252, 16, 154, 129, 189, 13, 172,
-    237, 128, 49, 244, 33, 188, 81, 198, 214, 109, 210, 21, 26, 182, 27, 19, 57, 76, 248, 221, 200, 40, 185, 21, 204,
-    107, 25, 188, 99, 216, 231, 201, 242, 227, 40, 230, 183, 54, 14, 31, 179, 115, 10, 69, 118, 243, 211, 180, 97, 252,
-    13, 111, 135, 120, 231, 31, 26, 83, 185, 129, 94, 226, 241, 178, 199, 64, 211, 164, 47, 114, 104, 243, 72, 177, 155,
-    234, 155, 204, 173, 199, 109, 230, 158, 23, 70, 58, 190, 186, 220, 182, 201, 3, 94, 93, 249, 15, 75, 157, 28, 43,
-    195, 91, 232, 54, 134, 127, 75, 52, 38, 201, 29, 150, 58, 135, 82, 188, 113, 210, 10, 56, 195, 31, 227, 20, 171, 68,
-    17, 101, 123, 8, 50, 111, 74, 157, 0, 152, 86, 185, 17, 6, 18, 163, 178, 223, 89, 48, 243, 129, 135, 219, 218, 52,
-    137, 170, 172, 30, 117, 38, 53, 79, 120, 198, 67, 215, 110, 236, 18, 223, 232, 133, 131, 171, 218, 202, 218, 195,
-    151, 78, 117, 85, 165, 26, 9, 207, 156, 42, 242, 205, 254, 135, 12, 119, 254, 244, 190, 129, 215, 209, 113, 114,
-    178, 179, 50, 154, 156, 217, 69, 246, 170, 28, 193, 253, 249, 234, 68, 61, 9, 117, 57, 192, 225, 27, 7, 25, 101, 87,
-    32, 39, 4, 185, 200, 235, 249, 215, 254, 23, 231, 56, 21, 205, 71, 105, 218, 13, 15, 7, 170, 197, 130, 17, 200, 239,
-    15, 59, 187, 153, 172, 56, 99, 244, 74, 32, 141, 28, 33, 27, 180, 165, 215, 86, 140, 13, 159, 208, 207, 202, 190,
-    83, 172, 195, 97, 28, 25, 119, 109, 149, 17, 116, 243, 190, 47, 3, 69, 237, 221, 239, 203, 232, 4, 109, 108, 139,
-    32, 43, 182, 78, 179, 137, 150, 80, 72, 119, 164, 154, 39, 209, 79, 59, 242, 114, 168, 149, 187, 152, 219, 163, 77,
-    191, 176, 194, 91, 68, 105, 228, 24, 118, 176, 227, 8, 49, 89, 134, 130, 143, 216, 152, 225, 92, 199, 29, 85, 254,
-    197, 178, 191, 227, 243, 151, 255, 140, 44, 123, 101, 139, 217, 84, 119, 142, 190, 3, 197, 235, 254, 150, 187, 246,
-    99, 129, 137, 204, 51, 68, 108, 83, 46, 186, 116, 168, 100, 102, 75, 216, 129, 7, 89, 37, 228, 173, 246, 27, 142,
-    187, 185, 93, 145, 158, 69, 159, 100, 199, 19, 245, 246, 123, 121, 155, 127, 108, 23, 12, 198, 208, 141, 182, 245,
-    29, 152, 69, 31, 219, 214, 131, 145, 151, 217, 15, 1, 245, 250, 209, 106, 106, 47, 141, 189, 172, 33, 206, 60, 173,
-    237, 130, 32, 157, 0, 47, 178, 57, 77, 220, 46, 83, 110, 210, 21, 201, 218, 141, 131, 202, 69, 48, 95, 100, 138,
-    221, 122, 239, 56, 87, 56, 157, 1, 38, 9, 167, 188, 201, 189, 82, 187, 184, 209, 4, 151, 6, 12, 233, 168, 94, 42,
-    165, 73, 41, 229, 44, 161, 65, 68, 8, 192, 149, 91, 232, 241, 180, 144, 64, 243, 189, 210, 186, 191, 99, 15, 251,
-    51, 117, 128, 115, 58, 27, 9, 57, 6, 214, 115, 17, 140, 26, 48, 20, 105, 105, 248, 49, 13, 69, 126, 72, 226, 130,
-    13, 29, 249, 109, 198, 140, 103, 91, 251, 60, 45, 62, 65, 63, 182, 144, 159, 3, 57, 51, 182, 90, 36, 219, 172, 144,
-    95, 58, 130, 56, 3, 121, 149, 145, 206, 213, 169, 214, 143, 127, 55, 183, 187, 194, 69, 214, 187, 152, 199, 220, 61,
-    252, 71, 108, 155, 188, 186, 82, 160, 44, 52, 255, 4, 171, 13, 15, 190, 23, 188, 140, 198, 120, 12, 160, 26, 151,
-    146, 225, 218, 239, 185, 28, 105, 155, 37, 232, 98, 133, 30, 1, 9, 117, 179, 147, 14, 207, 233, 96, 72, 96, 254,
-    132, 23, 189, 194, 19, 2, 31, 223, 132, 203, 214, 176, 82, 92, 53, 83, 122, 82, 77, 78, 0, 91, 187, 65, 22, 133, 41,
-    20, 66, 43, 166, 146, 166, 125, 30, 104, 164, 130, 71, 40, 252, 146, 194, 99, 72, 133, 119, 92, 183, 18, 144, 197,
-    185, 205, 197, 178, 80, 169, 81, 81, 2, 173, 254, 158, 88, 113, 82, 108, 10, 92, 141, 0, 200, 234, 222, 93, 202, 30,
-    115, 139, 221, 6, 189, 200, 13, 68, 76, 40, 79, 126, 68, 221, 130, 65, 78, 25, 123, 3, 78, 0, 226, 64, 62, 145, 21,
-    113, 171, 37, 62, 138, 149, 154, 16, 240, 53, 29, 255, 51, 177, 173, 169, 16, 9, 38, 30, 160, 174, 89, 35, 9, 74,
-    148, 116, 143, 22, 217, 14, 251, 88, 106, 170, 157, 146, 64, 49, 124, 221, 177, 0, 37, 51, 159, 91, 69, 140, 80,
-    163, 177, 4, 50, 251, 223, 177, 134, 11, 132, 168, 58, 45, 217, 99, 148, 111, 59, 85, 113, 202, 49, 190, 117, 245,
-    158, 249, 146, 171, 5, 212, 94, 43, 113, 140, 83, 78, 254, 167, 76, 142, 81, 104, 80, 192, 11, 251, 29, 161, 95,
-    243, 62, 21, 59, 40, 82, 96, 245, 133, 57, 169, 231, 23, 27, 21, 96, 75, 180, 152, 11, 216, 28, 19, 205, 35, 73, 75,
-    114, 113, 85, 82, 176, 18, 13, 111, 212, 139, 12, 162, 161, 131, 236, 181, 213, 216, 215, 142, 129, 215, 104, 26,
-    168, 135, 104, 60, 150, 247, 18, 188, 61, 181, 6, 235, 74, 218, 6, 51, 50, 126, 217, 112, 147, 113, 138, 135, 177,
-    86, 70, 218, 245, 176, 196, 22, 160, 176, 24, 154, 181, 89, 192, 174, 240, 37, 195, 252, 246, 4, 133, 99, 191, 69,
-    126, 31, 247, 23, 216, 141, 48, 246, 98, 188, 140, 9, 46, 19, 100, 11, 144, 88, 219, 14, 224, 229, 228, 66, 31, 105,
-    69, 200, 163, 243, 176, 242, 146, 219, 186, 232, 164, 177, 7, 218, 189, 173, 249, 22, 92, 118, 9, 126, 64, 252, 245,
-    94, 189, 202, 79, 110, 102, 67, 87, 152, 97, 31, 32, 169, 0, 207, 143, 101, 180, 62, 252, 204, 100, 104, 130, 212,
-    248, 243, 118, 207, 172, 182, 20, 238, 32, 103, 217, 5, 51, 207, 59, 132, 29, 233, 0, 12, 220, 194, 148, 238, 222,
-    80, 70, 169, 57, 13, 224, 70, 185, 11, 39, 36, 99, 224, 247, 229, 177, 90, 49, 253, 39, 57, 119, 1, 132, 51, 113,
-    100, 38, 48, 102, 250, 99, 124, 165, 169, 144, 119, 128, 204, 31, 198, 197, 72, 47, 246, 92, 41, 119, 94, 15, 61,
-    52, 116, 31, 193, 200, 131, 78, 115, 210, 27, 92, 110, 205, 107, 90, 210, 119, 152, 75, 140, 237, 84, 151, 107, 28,
-    117, 87, 112, 2, 22, 29, 84, 113, 238, 103, 128, 82, 213, 111, 9, 167, 246, 43, 192, 186, 124, 88, 128, 14, 236, 19,
-    119, 19, 175, 151, 44, 92, 28, 96, 230, 19, 14, 223, 46, 111, 80, 137, 17, 239, 157, 203, 99, 218, 93, 0, 20, 194,
-    52, 6, 172, 214, 118, 86, 39, 130, 125, 8, 128, 35, 210, 29, 113, 47, 124, 89, 53, 32, 97, 47, 247, 110, 189, 240,
-    183, 95, 188, 87, 81, 119, 226, 206, 99, 124, 21, 122, 242, 115, 12, 65, 47, 12, 148, 196, 29, 89, 19, 38, 191, 126,
-    153, 63, 193, 62, 75, 131, 242, 156, 92, 190, 81, 114, 136, 0, 248, 193, 168, 219, 25, 132, 93, 104, 3, 250, 241,
-    89, 2, 171, 50, 181, 96, 157, 18, 71, 59, 53, 71, 8, 206, 116, 39, 98, 194, 45, 5, 82, 137, 3, 230, 218, 18, 60, 83,
-    190, 7, 220, 10, 150, 17, 122, 12, 204, 177, 106, 220, 182, 222, 151, 183, 181, 109, 94, 37, 195, 141, 205, 228,
-    164, 82, 250, 6, 134, 64, 47, 232, 77, 146, 19, 68, 67, 118, 166, 115, 145, 219, 115, 34, 53, 227, 105, 206, 246,
-    60, 81, 156, 61, 7, 241, 89, 176, 110, 198, 10, 146, 150, 169, 228, 26, 104, 182, 151, 5, 152, 195, 159, 134, 125,
-    169, 19, 137, 207, 106, 58, 229, 161, 44, 159, 63, 151, 140, 123, 242, 173, 95, 212, 191, 124, 208, 175, 72, 196,
-    21, 47, 188, 122, 60, 81, 193, 123, 171, 51, 147, 48, 171, 129, 141, 178, 57, 211, 84, 146, 39, 93, 249, 222, 175,
-    174, 104, 123, 169, 213, 186, 52, 62, 18, 196, 66, 138, 160, 64, 10, 140, 154, 101, 115, 227, 181, 85, 255, 59, 163,
-    74, 224, 253, 61, 126, 186, 234, 27, 186, 211, 217, 34, 153, 116, 170, 181, 77, 33, 215, 28, 105, 96, 160, 251, 180,
-    245, 18, 32, 49, 115, 100, 245, 247, 26, 78, 113, 44, 123, 172, 159, 161, 231, 94, 119, 57, 119, 153, 125, 189, 233,
-    49, 36, 217, 230, 140, 171, 21, 17, 247, 19, 125, 133, 237, 1, 70, 14, 173, 35, 234, 157, 133, 41, 232, 180, 123,
-    152, 80, 42, 130, 36, 178, 217, 24, 224, 168, 67, 147, 206, 34, 4, 26, 4, 66, 205, 172, 255, 10, 17, 74, 77, 229,
-    133, 159, 156, 127, 12, 165, 2, 20, 141, 250, 215, 229, 123, 133, 157, 112, 246, 194, 52, 117, 2, 206, 4, 134, 157,
-    179, 10, 168, 185, 24, 66, 27, 129, 74, 144, 55, 69, 228, 29, 46, 227, 67, 197, 24, 104, 103, 232, 211, 252, 83,
-    165, 245, 199, 99, 251, 112, 163, 128, 128, 202, 49, 121, 235, 44, 18, 246, 103, 165, 122, 128, 236, 218, 252, 61,
-    194, 4, 245, 88, 154, 67, 126, 128, 183, 188, 54, 34, 14, 159, 141, 1, 244, 7, 43, 228, 129, 2, 71, 254, 179, 174,
-    23, 101, 122, 57, 127, 34, 97, 155, 162, 188, 77, 244, 136, 88, 2, 158, 117, 142, 211, 98, 58, 245, 45, 68, 59, 46,
-    85, 179, 223, 26, 13, 5, 68, 252, 245, 6, 109, 155, 128, 173, 243, 159, 90, 75, 96, 232, 38, 10, 11, 218, 158, 190,
-    0, 196, 27, 159, 8, 158, 219, 43, 217, 105, 143, 173, 25, 146, 28, 126, 204, 137, 51, 219, 49, 189, 163, 118, 204,
-    25, 133, 228, 195, 3, 106, 254, 238, 191, 190, 231, 30, 62, 72, 203, 1, 85, 10, 236, 160, 40, 140, 89, 24, 229, 20,
-    19, 190, 18, 235, 12, 219, 165, 120, 207, 238, 120, 206, 87, 12, 3, 162, 70, 164, 44, 118, 92, 5, 244, 175, 137, 4,
-    164, 121, 253, 11, 18, 59, 56, 253, 57, 227, 187, 100, 247, 243, 237, 35, 223, 9, 52, 146, 119, 155, 147, 91, 231,
-    60, 52, 107, 47, 102, 168, 25, 172, 230, 197, 79, 25, 213, 156, 38, 186, 67, 178, 223, 84, 183, 37, 253, 234, 12,
-    197, 38, 107, 198, 182, 120, 174, 52, 49, 28, 129, 45, 96, 35, 198, 4, 130, 45, 40, 176, 238, 46, 254, 208, 158, 29,
-    27, 112, 113, 161, 217, 170, 37, 168, 150, 69, 182, 100, 66, 220, 243, 5, 105, 182, 210, 223, 48, 110, 215, 171,
-    131, 251, 250, 13, 211, 189, 101, 142, 136, 246, 221, 47, 61, 96, 246, 176, 171, 192, 142, 200, 151, 237, 43, 219,
-    221, 118, 145, 127, 36, 210, 18, 145, 223, 49, 113, 148, 121, 172, 31, 132, 101, 235, 124, 40, 58, 136, 10, 188, 19,
-    44, 223, 178, 179, 171, 226, 185, 159, 53, 240, 59, 148, 127, 121, 187, 6, 75, 55, 40, 4, 225, 40, 142, 145, 79, 31,
-    17, 205, 202, 36, 210, 65, 248, 89, 184, 85, 147, 165, 202, 53, 147, 200, 0, 36, 111, 71, 237, 105, 128, 114, 215,
-    148, 0, 122, 99, 178, 159, 220, 56, 147, 127, 4, 242, 236, 25, 99, 89, 238, 41, 61, 244, 189, 94, 159, 73, 178, 2,
-    46, 142, 177, 254, 172, 224, 207, 89, 237, 36, 138, 155, 177, 156, 152, 157, 222, 1, 62, 103, 254, 219, 47, 73, 219,
-    17, 153, 216, 233, 198, 187, 100, 17, 237, 71, 180, 117, 114, 171, 223, 145, 99, 26, 92, 26, 113, 91, 78, 118, 178,
-    195, 33, 162, 87, 78, 66, 231, 213, 124, 151, 43, 243, 222, 81, 243, 92, 146, 213, 188, 243, 127, 124, 205, 222,
-    203, 74, 67, 132, 238, 116, 60, 5, 68, 200, 255, 11, 46, 141, 110, 253, 205, 112, 150, 125, 16, 46, 18, 19, 19, 253,
-    8, 112, 27, 203, 4, 61, 51, 202, 245, 123, 199, 77, 88, 119, 238, 48, 103, 20, 195, 165, 25, 248, 202, 130, 80, 0,
-    72, 27, 13, 242, 238, 62, 198, 239, 239, 204, 255, 25, 65, 244, 72, 49, 66, 234, 14, 186, 144, 12, 224, 191, 86,
-    249, 17, 105, 227, 86, 9, 218, 45, 44, 197, 39, 71, 133, 9, 92, 33, 226, 115, 23, 28, 104, 183, 128, 132, 8, 18,
-    241, 208, 126, 254, 22, 176, 241, 82, 34, 163, 213, 231, 78, 7, 241, 247, 3, 103, 156, 65, 182, 65, 116, 251, 171,
-    81, 138, 140, 234, 94, 84, 230, 166, 47, 55, 221, 154, 155, 68, 0, 97, 5, 185, 136, 142, 154, 44, 78, 44, 190, 71,
-    159, 129, 143, 115, 240, 187, 74, 56, 210, 56, 212, 203, 225, 121, 122, 229, 102, 67, 47, 228, 229, 83, 121, 76,
-    118, 82, 47, 82, 88, 52, 154, 173, 245, 217, 79, 124, 244, 102, 79, 53, 194, 106, 236, 67, 32, 89, 97, 176, 191,
-    148, 166, 26, 163, 226, 193, 159, 170, 21, 115, 73, 149, 47, 19, 221, 142, 87, 157, 51, 6, 250, 64, 58, 133, 129,
-    142, 51, 1, 170, 52, 14, 110, 52, 72, 165, 160, 115, 178, 114, 86, 98, 13, 229, 235, 58, 219, 93, 70, 252, 203, 120,
-    27, 182, 2, 171, 217, 216, 166, 33, 2, 203, 29, 205, 217, 161, 109, 238, 253, 82, 117, 54, 201, 184, 128, 195, 142,
-    225, 219, 34, 64, 157, 130, 70, 253, 94, 180, 160, 79, 204, 243, 19, 114, 23, 67, 101, 42, 118, 53, 167, 84, 219,
-    123, 118, 47, 172, 227, 248, 236, 224, 233, 54, 174, 36, 83, 212, 82, 0, 59, 203, 233, 82, 223, 220, 246, 68, 59,
-    193, 188, 169, 95, 149, 41, 109, 220, 149, 70, 72, 246, 55, 118, 238, 20, 3, 217, 19, 57, 247, 181, 69, 198, 60,
-    146, 94, 119, 146, 188, 85, 56, 249, 19, 153, 22, 127, 173, 165, 241, 160, 17, 76, 152, 174, 129, 231, 88, 154, 239,
-    136, 129, 54, 254, 242, 235, 200, 97, 152, 55, 176, 82, 117, 60, 17, 182, 44, 236, 69, 139, 40, 149, 145, 156, 55,
-    38, 44, 74, 208, 150, 199, 218, 22, 60, 217, 114, 225, 41, 94, 54, 22, 50, 44, 112, 233, 63, 190, 115, 104, 75, 211,
-    21, 3, 188, 170, 222, 116, 169, 148, 238, 28, 119, 190, 77, 41, 78, 253, 0, 123, 162, 165, 192, 133, 84, 95, 221,
-    197, 253, 166, 184, 9, 113, 82, 111, 52, 61, 69, 75, 231, 32, 99, 118, 213, 199, 162, 85, 79, 13, 20, 88, 248, 204,
-    163, 137, 68, 217, 55, 126, 84, 133, 154, 207, 242, 80, 195, 203, 31, 185, 88, 0, 242, 71, 229, 131, 215, 157, 113,
-    145, 115, 61, 152, 160, 143, 187, 69, 111, 110, 57, 115, 70, 197, 21, 53, 121, 246, 55, 207, 174, 97, 153, 13, 54,
-    0, 44, 225, 218, 49, 181, 160, 126, 107, 45, 99, 161, 217, 183, 60, 87, 80, 178, 47, 73, 7, 91, 6, 100, 82, 69, 162,
-    251, 201, 243, 109, 130, 52, 72, 209, 200, 73, 223, 130, 75, 27, 118, 59, 41, 125, 148, 124, 249, 232, 73, 53, 149,
-    30, 107, 130, 255, 115, 252, 115, 9, 103, 131, 228, 93, 75, 233, 79, 33, 89, 107, 171, 213, 243, 250, 140, 223, 146,
-    207, 217, 56, 29, 178, 110, 77, 142, 139, 224, 175, 121, 253, 226, 137, 19, 45, 29, 189, 149, 143, 231, 14, 56, 6,
-    166, 126, 30, 74, 33, 226, 111, 122, 145, 233, 215, 47, 191, 222, 40, 61, 195, 58, 21, 79, 202, 49, 96, 167, 148,
-    37, 75, 218, 66, 14, 128, 254, 143, 76, 35, 47, 215, 182, 138, 117, 26, 90, 249, 191, 70, 198, 224, 90, 217, 99,
-    118, 205, 222, 226, 47, 130, 160, 11, 179, 123, 218, 227, 106, 2, 255, 21, 54, 132, 201, 28, 139, 95, 42, 30, 31,
-    130, 237, 54, 42, 17, 119, 116, 140, 135, 57, 138, 119, 156, 103, 9, 184, 249, 203, 79, 24, 25, 237, 236, 240, 48,
-    144, 109, 124, 29, 154, 62, 4, 164, 104, 57, 31, 251, 175, 66, 243, 69, 149, 254, 216, 151, 206, 29, 127, 204, 226,
-    74, 5, 148, 211, 243, 60, 59, 231, 179, 255, 126, 232, 32, 117, 165, 155, 16, 38, 135, 218, 190, 148, 33, 236, 8,
-    94, 116, 216, 119, 193, 224, 143, 103, 252, 246, 221, 64, 147, 234, 65, 19, 56, 249, 229, 45, 200, 119, 162, 167,
-    103, 45, 194, 23, 148, 89, 84, 173, 109, 73, 159, 116, 184, 242, 34, 37, 151, 220, 10, 241, 11, 192, 134, 124, 235,
-    113, 127, 18, 1, 104, 171, 170, 123, 79, 92, 72, 63, 199, 236, 223, 112, 215, 218, 47, 10, 96, 173, 180, 86, 48,
-    178, 120, 138, 143, 92, 48, 179, 14, 12, 44, 253, 21, 60, 119, 244, 244, 99, 124, 132, 94, 91, 81, 51, 29, 199, 123,
-    214, 191, 205, 227, 122, 165, 227, 11, 20, 161, 167, 236, 118, 19, 245, 184, 45, 14, 69, 38, 105, 145, 14, 89, 156,
-    55, 188, 22, 222, 66, 198, 11, 32, 77, 231, 175, 58, 34, 75, 38, 148, 150, 231, 94, 44, 235, 92, 119, 216, 129, 90,
-    16, 210, 218, 161, 23, 227, 143, 232, 177, 125, 167, 102, 159, 229, 41, 32, 37, 1, 57, 105, 32, 8, 36, 163, 156,
-    179, 213, 254, 117, 84, 103, 98, 68, 109, 45, 96, 152, 113, 205, 53, 178, 112, 11, 92, 187, 193, 58, 188, 72, 255,
-    234, 210, 19, 165, 53, 51, 37, 95, 130, 227, 238, 30, 166, 90, 34, 41, 213, 17, 113, 8, 100, 27, 130, 51, 236, 251,
-    128, 56, 186, 110, 153, 196, 19, 211, 97, 20, 19, 30, 96, 58, 180, 128, 197, 242, 169, 47, 60, 162, 70, 2, 237, 9,
-    163, 7, 122, 23, 239, 179, 71, 160, 79, 47, 82, 72, 237, 166, 62, 209, 231, 74, 109, 47, 182, 43, 159, 211, 37, 226,
-    191, 36, 86, 194, 104, 63, 101, 126, 55, 7, 171, 252, 60, 197, 49, 186, 154, 53, 140, 63, 208, 70, 14, 119, 133,
-    198, 19, 84, 37, 85, 218, 25, 200, 235, 251, 102, 175, 229, 240, 179, 235, 24, 112, 42, 182, 238, 183, 215, 246, 23,
-    188, 15, 212, 142, 180, 56, 95, 13, 144, 62, 186, 217, 95, 159, 150, 151, 139, 49, 243, 153, 116, 118, 44, 151, 219,
-    10, 119, 44, 29, 136, 73, 41, 133, 106, 65, 87, 155, 216, 189, 187, 247, 137, 10, 226, 199, 37, 202, 79, 248, 27,
-    48, 222, 232, 89, 66, 255, 66, 57, 219, 157, 166, 167, 119, 110, 94, 93, 196, 233, 123, 158, 100, 164, 35, 31, 149,
-    180, 223, 45, 204, 82, 246, 137, 205, 206, 74, 98, 71, 119, 53, 70, 92, 94, 239, 131, 177, 130, 102, 98, 119, 0,
-    175, 234, 117, 80, 39, 120, 95, 254, 167, 143, 93, 13, 190, 52, 58, 252, 254, 28, 74, 139, 153, 234, 205, 244, 18,
-    213, 237, 67, 173, 43, 199, 47, 209, 180, 235, 74, 119, 222, 41, 23, 154, 223, 184, 225, 140, 92, 112, 200, 138, 99,
-    30, 252, 95, 225, 71, 155, 250, 186, 254, 73, 37, 172, 243, 105, 153, 119, 116, 147, 209, 149, 204, 254, 223, 70, 4,
-    207, 79, 108, 243, 9, 235, 126, 166, 124, 229, 90, 114, 229, 155, 218, 171, 104, 146, 11, 112, 167, 92, 65, 134,
-    158, 103, 222, 124, 93, 122, 197, 20, 98, 24, 185, 25, 42, 242, 240, 77, 69, 137, 24, 131, 95, 56, 211, 118, 199,
-    240, 102, 211, 169, 65, 103, 150, 240, 4, 102, 64, 6, 62, 90, 37, 114, 226, 143, 69, 156, 198, 22, 33, 103, 220, 34,
-    199, 101, 33, 82, 211, 204, 176, 77, 33, 246, 240, 16, 100, 159, 45, 47, 82, 115, 112, 19, 81, 93, 119, 42, 168, 63,
-    140, 82, 230, 95, 107, 244, 178, 117, 124, 21, 121, 121, 71, 56, 202, 124, 79, 150, 27, 118, 51, 233, 169, 198, 190,
-    42, 89, 80, 20, 143, 188, 193, 96, 98, 225, 88, 76, 252, 120, 173, 26, 242, 248, 14, 157, 217, 216, 224, 6, 126,
-    164, 65, 12, 79, 230, 41, 90, 119, 167, 87, 99, 46, 210, 20, 68, 197, 112, 179, 181, 64, 145, 18, 85, 90, 188, 208,
-    121, 101, 48, 220, 76, 78, 26, 158, 101, 161, 127, 60, 219, 2, 200, 149, 45, 54, 193, 118, 214, 42, 229, 32, 254,
-    152, 91, 9, 114, 57, 176, 248, 125, 55, 127, 121, 87, 132, 89, 59, 85, 239, 218, 90, 104, 133, 248, 106, 246, 83,
-    94, 14, 2, 208, 217, 95, 175, 146, 136, 165, 214, 216, 97, 120, 110, 52, 144, 142, 248, 112, 49, 89, 66, 18, 201,
-    72, 128, 180, 194, 36, 46, 168, 237, 83, 75, 235, 117, 112, 204, 6, 143, 18, 202, 84, 249, 21, 118, 253, 36, 66, 30,
-    243, 104, 157, 6, 45, 38, 167, 202, 119, 185, 253, 247, 239, 56, 5, 242, 244, 22, 117, 117, 78, 245, 250, 98, 4,
-    224, 110, 252, 10, 59, 237, 250, 207, 126, 96, 50, 212, 77, 76, 53, 8, 250, 36, 179, 239, 1, 114, 187, 44, 138, 203,
-    169, 1, 150, 189, 69, 34, 178, 161, 33, 221, 154, 7, 195, 171, 185, 190, 73, 8, 124, 46, 42, 251, 24, 141, 103, 191,
-    41, 67, 40, 40, 84, 231, 48, 155, 232, 178, 3, 223, 151, 13, 189, 73, 127, 95, 63, 208, 157, 228, 172, 16, 112, 232,
-    193, 55, 187, 23, 91, 173, 236, 108, 244, 93, 224, 30, 37, 164, 166, 237, 211, 178, 199, 162, 179, 209, 247, 73,
-    141, 179, 30, 47, 0, 143, 143, 198, 37, 63, 90, 63, 36, 127, 169, 81, 38, 42, 243, 62, 4, 2, 125, 10, 120, 90, 244,
-    152, 109, 30, 41, 111, 113, 206, 245, 239, 246, 249, 126, 163, 101, 4, 115, 76, 134, 236, 254, 134, 226, 120, 161,
-    157, 5, 201, 109, 191, 92, 78, 73, 223, 125, 45, 133, 15, 99, 195, 243, 237, 107, 228, 203, 250, 143, 167, 176, 152,
-    78, 25, 204, 188, 12, 167, 13, 155, 250, 247, 60, 117, 104, 43, 160, 143, 25, 64, 22, 159, 162, 220, 246, 181, 21,
-    85, 141, 158, 137, 13, 80, 218, 183, 46, 19, 110, 151, 180, 21, 157, 67, 9, 44, 72, 249, 247, 104, 203, 89, 53, 109,
-    240, 152, 203, 36, 237, 146, 123, 67, 65, 72, 167, 98, 222, 217, 39, 131, 81, 241, 131, 194, 231, 235, 84, 50, 94,
-    65, 232, 58, 35, 11, 128, 164, 216, 120, 88, 87, 35, 75, 87, 231, 142, 233, 138, 7, 50, 242, 234, 188, 40, 98, 146,
-    100, 12, 254, 66, 27, 181, 162, 6, 3, 180, 31, 79, 216, 125, 139, 35, 196, 122, 159, 176, 175, 247, 193, 35, 7, 19,
-    161, 149, 174, 94, 11, 240, 0, 194, 4, 43, 26, 6, 211, 19, 87, 59, 191, 97, 250, 20, 95, 207, 191, 225, 185, 242,
-    78, 198, 189, 238, 161, 0, 31, 73, 240, 236, 137, 64, 195, 159, 125, 89, 135, 216, 231, 163, 252, 201, 70, 51, 98,
-    188, 63, 134, 134, 163, 227, 132, 252, 26, 134, 220, 196, 61, 46, 130, 114, 171, 152, 53, 208, 118, 42, 233, 99,
-    172, 115, 224, 96, 244, 248, 175, 221, 175, 188, 86, 184, 89, 42, 58, 79, 50, 63, 154, 189, 190, 98, 102, 14, 68,
-    196, 30, 53, 77, 47, 160, 248, 54, 135, 102, 31, 172, 75, 107, 246, 226, 190, 145, 253, 107, 21, 210, 65, 195, 233,
-    107, 156, 67, 82, 18, 128, 221, 15, 179, 231, 58, 18, 31, 51, 182, 173, 65, 145, 242, 42, 198, 193, 140, 225, 157,
-    200, 175, 193, 154, 133, 141, 173, 76, 157, 227, 0, 22, 138, 145, 178, 174, 167, 230, 145, 52, 247, 26, 144, 39,
-    177, 225, 153, 205, 251, 11, 223, 224, 136, 199, 158, 112, 235, 66, 209, 220, 97, 8, 211, 153, 173, 30, 136, 213,
-    119, 189, 67, 183, 51, 78, 230, 66, 136, 174, 148, 81, 103, 228, 26, 138, 228, 35, 84, 209, 126, 235, 94, 174, 203,
-    133, 200, 151, 137, 112, 163, 111, 6, 39, 143, 239, 45, 237, 130, 213, 2, 150, 70, 61, 115, 80, 196, 67, 142, 160,
-    97, 140, 113, 171, 244, 210, 123, 109, 206, 123, 12, 66, 250, 49, 249, 199, 191, 164, 30, 163, 197, 205, 230, 109,
-    251, 126, 250, 56, 47, 228, 200, 34, 54, 49, 38, 52, 215, 108, 151, 76, 170, 74, 239, 103, 133, 101, 115, 141, 6,
-    182, 209, 35, 11, 102, 118, 7, 203, 5, 123, 220, 248, 7, 110, 31, 33, 95, 108, 76, 144, 65, 34, 231, 101, 147, 229,
-    241, 90, 226, 157, 170, 97, 76, 99, 15, 80, 103, 174, 191, 180, 102, 35, 113, 33, 234, 219, 203, 23, 14, 114, 131,
-    169, 10, 98, 68, 235, 29, 243, 100, 97, 52, 171, 31, 161, 101, 183, 76, 193, 225, 132, 240, 200, 158, 211, 69, 221,
-    29, 70, 240, 222, 221, 12, 108, 21, 225, 106, 223, 113, 66, 247, 217, 32, 78, 22, 128, 215, 179, 171, 20, 163, 11,
-    96, 19, 6, 217, 83, 181, 184, 185, 215, 59, 195, 200, 221, 50, 10, 239, 253, 102, 137, 176, 100, 190, 237, 185, 148,
-    238, 64, 239, 100, 168, 245, 172, 235, 176, 200, 238, 193, 132, 46, 162, 179, 6, 48, 163, 232, 172, 174, 160, 184,
-    218, 199, 77, 113, 87, 208, 150, 42, 68, 188, 140, 7, 20, 238, 203, 54, 136, 103, 187, 97, 60, 62, 55, 200, 5, 218,
-    182, 221, 6, 44, 76, 2, 98, 243, 225, 82, 3, 42, 107, 69, 141, 12, 208, 140, 126, 81, 163, 22, 51, 248, 149, 41, 1,
-    56, 204, 255, 206, 199, 66, 41, 220, 109, 154, 58, 99, 142, 158, 182, 47, 217, 239, 175, 56, 208, 223, 106, 173, 4,
-    86, 28, 172, 86, 17, 185, 202, 134, 199, 182, 139, 204, 151, 156, 229, 230, 213, 76, 209, 141, 97, 174, 11, 96, 62,
-    109, 163, 101, 144, 149, 197, 70, 219, 212, 148, 207, 127, 203, 28, 253, 28, 252, 11, 208, 93, 248, 17, 68, 255, 92,
-    205, 230, 142, 16, 160, 247, 12, 215, 189, 57, 146, 202, 116, 156, 171, 116, 201, 156, 67, 222, 157, 173, 53, 172,
-    252, 86, 66, 33, 72, 181, 236, 255, 220, 90, 87, 181, 238, 194, 198, 22, 128, 185, 135, 150, 182, 68, 223, 236, 218,
-    246, 171, 123, 55, 238, 138, 148, 237, 53, 140, 133, 248, 80, 176, 209, 176, 145, 124, 57, 138, 224, 49, 190, 24,
-    32, 69, 156, 189, 120, 184, 76, 131, 118, 194, 57, 41, 90, 30, 34, 219, 67, 93, 187, 137, 58, 189, 109, 195, 94,
-    217, 158, 12, 140, 141, 199, 170, 175, 208, 22, 133, 246, 174, 208, 231, 31, 192, 24, 131, 164, 43, 103, 226, 120,
-    133, 197, 117, 45, 81, 74, 30, 84, 141, 225, 117, 182, 135, 80, 155, 57, 169, 66, 224, 89, 150, 16, 23, 214, 248,
-    30, 132, 156, 241, 101, 9, 136, 34, 41, 254, 7, 192, 214, 110, 19, 9, 128, 18, 147, 112, 134, 230, 87, 0, 184, 91,
-    26, 54, 181, 181, 64, 92, 126, 110, 212, 7, 95, 119, 139, 145, 168, 199, 113, 109, 85, 28, 165, 178, 239, 5, 168,
-    84, 108, 92, 44, 195, 233, 36, 97, 99, 149, 243, 181, 251, 95, 59, 121, 151, 202, 89, 222, 17, 25, 29, 201, 111,
-    126, 234, 53, 114, 33, 101, 172, 114, 78, 212, 239, 249, 212, 182, 72, 177, 98, 188, 166, 175, 153, 6, 153, 29, 150,
-    82, 20, 81, 209, 93, 153, 128, 255, 44, 55, 200, 179, 185, 113, 244, 89, 50, 48, 46, 149, 170, 11, 39, 235, 206,
-    220, 198, 195, 202, 102, 12, 255, 129, 0, 97, 251, 146, 26, 59, 102, 86, 145, 255, 48, 18, 190, 210, 130, 171, 95,
-    178, 150, 26, 177, 14, 133, 100, 26, 166, 40, 149, 146, 198, 149, 245, 90, 185, 150, 65, 36, 112, 191, 38, 11, 210,
-    68, 43, 253, 147, 20, 213, 154, 252, 153, 151, 35, 237, 33, 233, 89, 44, 197, 129, 128, 65, 229, 77, 112, 26, 132,
-    168, 136, 199, 115, 184, 157, 132, 128, 72, 46, 28, 113, 174, 245, 184, 113, 235, 84, 226, 228, 138, 189, 129, 200,
-    185, 132, 31, 62, 122, 196, 78, 198, 228, 180, 183, 228, 115, 136, 36, 166, 244, 50, 213, 14, 20, 174, 87, 57, 60,
-    224, 44, 249, 140, 64, 241, 214, 79, 191, 85, 213, 238, 249, 21, 20, 61, 125, 4, 146, 228, 72, 6, 8, 63, 175, 226,
-    179, 185, 56, 120, 228, 188, 114, 185, 91, 184, 159, 249, 109, 83, 219, 121, 3, 134, 214, 205, 137, 129, 57, 198,
-    201, 187, 15, 62, 146, 96, 132, 115, 96, 36, 69, 80, 128, 18, 195, 124, 5, 99, 24, 114, 189, 215, 145, 173, 11, 243,
-    118, 65, 29, 116, 76, 175, 59, 58, 170, 15, 209, 161, 202, 215, 97, 225, 7, 6, 41, 128, 55, 199, 181, 241, 240, 182,
-    72, 190, 64, 160, 81, 154, 60, 200, 102, 248, 142, 202, 132, 83, 163, 94, 15, 183, 154, 5, 123, 159, 67, 112, 109,
-    209, 87, 120, 143, 61, 98, 105, 225, 71, 7, 174, 87, 21, 111, 219, 18, 32, 94, 170, 78, 186, 175, 161, 179, 99, 206,
-    247, 101, 83, 123, 14, 90, 66, 38, 20, 37, 105, 100, 26, 86, 247, 130, 136, 55, 202, 52, 207, 75, 29, 222, 56, 143,
-    134, 49, 174, 50, 227, 13, 34, 137, 198, 95, 78, 26, 79, 146, 51, 250, 231, 235, 94, 248, 102, 138, 232, 28, 160,
-    73, 138, 35, 58, 28, 180, 159, 117, 171, 177, 246, 36, 166, 173, 222, 99, 220, 155, 92, 74, 38, 65, 85, 233, 20,
-    174, 83, 49, 98, 26, 132, 101, 20, 193, 64, 7, 255, 55, 6, 152, 45, 181, 88, 145, 66, 130, 181, 176, 38, 245, 135,
-    48, 162, 130, 6, 199, 163, 58, 38, 57, 180, 149, 10, 50, 14, 16, 170, 151, 210, 207, 28, 101, 123, 73, 203, 96, 214,
-    185, 54, 20, 61, 144, 165, 107, 54, 51, 244, 204, 222, 74, 97, 70, 223, 199, 253, 5, 169, 116, 243, 113, 250, 61,
-    138, 21, 160, 105, 164, 230, 135, 56, 53, 67, 53, 12, 117, 181, 126, 52, 229, 110, 21, 138, 80, 127, 79, 133, 120,
-    241, 144, 249, 37, 168, 9, 227, 206, 12, 177, 12, 11, 10, 101, 221, 191, 153, 147, 57, 80, 25, 195, 165, 54, 221,
-    228, 74, 138, 163, 228, 178, 65, 129, 60, 152, 114, 235, 222, 75, 92, 18, 153, 43, 133, 18, 237, 12, 117, 102, 150,
-    99, 122, 240, 251, 180, 136, 49, 17, 20, 73, 56, 208, 99, 78, 77, 233, 134, 193, 18, 63, 8, 89, 188, 42, 140, 101,
-    147, 82, 187, 171, 240, 34, 20, 60, 236, 250, 151, 139, 160, 36, 218, 107, 117, 38, 32, 71, 31, 169, 152, 169, 217,
-    45, 36, 195, 164, 174, 134, 160, 46, 20, 115, 145, 215, 1, 80, 196, 219, 101, 130, 169, 27, 165, 242, 235, 241, 66,
-    151, 38, 5, 211, 153, 132, 68, 167, 220, 191, 156, 44, 171, 189, 172, 167, 207, 230, 38, 97, 88, 15, 42, 211, 193,
-    33, 66, 25, 32, 191, 222, 150, 132, 122, 245, 71, 97, 238, 134, 152, 216, 165, 224, 113, 62, 1, 1, 249, 43, 97, 96,
-    253, 100, 172, 142, 113, 38, 35, 94, 249, 62, 1, 64, 99, 195, 250, 112, 2, 247, 213, 52, 122, 166, 15, 136, 244, 92,
-    203, 234, 162, 48, 74, 206, 26, 233, 48, 254, 142, 2, 216, 71, 117, 46, 132, 224, 170, 91, 106, 18, 48, 234, 109,
-    235, 21, 130, 174, 7, 28, 133, 80, 81, 208, 70, 234, 2, 72, 187, 223, 199, 211, 39, 202, 181, 137, 5, 71, 51, 142,
-    129, 30, 245, 129, 48, 242, 245, 201, 6, 151, 32, 57, 74, 52, 166, 235, 152, 169, 244, 114, 150, 8, 169, 10, 62,
-    221, 30, 163, 120, 42, 43, 154, 176, 220, 231, 124, 19, 230, 141, 17, 202, 255, 184, 132, 235, 66, 77, 113, 52, 165,
-    5, 138, 217, 115, 68, 193, 106, 34, 215, 246, 244, 165, 182, 150, 176, 214, 71, 72, 119, 35, 26, 35, 90, 100, 78,
-    25, 63, 133, 92, 220, 170, 35, 191, 8, 0, 40, 58, 212, 251, 118, 198, 144, 138, 9, 213, 102, 10, 15, 131, 78, 167,
-    79, 23, 152, 232, 220, 134, 181, 95, 232, 209, 173, 153, 250, 153, 57, 13, 208, 47, 102, 55, 41, 135, 151, 21, 111,
-    169, 6, 120, 234, 97, 57, 92, 47, 104, 9, 214, 19, 105, 13, 40, 13, 0, 63, 200, 12, 151, 144, 160, 100, 209, 104,
-    222, 0, 215, 236, 173, 29, 95, 185, 187, 233, 251, 227, 79, 105, 127, 151, 72, 226, 60, 104, 122, 163, 190, 16, 231,
-    176, 69, 2, 41, 12, 67, 32, 98, 28, 230, 86, 132, 160, 240, 1, 176, 111, 0, 72, 101, 67, 174, 175, 251, 176, 94, 73,
-    238, 11, 61, 94, 47, 150, 106, 169, 213, 44, 55, 214, 179, 188, 11, 100, 103, 145, 186, 175, 172, 19, 32, 109, 78,
-    158, 227, 17, 117, 10, 104, 101, 116, 56, 131, 56, 113, 239, 185, 239, 147, 218, 69, 31, 229, 75, 179, 204, 153,
-    232, 81, 141, 122, 41, 179, 35, 236, 90, 156, 12, 84, 70, 54, 215, 133, 92, 251, 155, 108, 115, 119, 74, 42, 96, 25,
-    216, 182, 19, 6, 49, 244, 127, 100, 169, 66, 234, 7, 241, 134, 178, 34, 200, 8, 248, 48, 162, 204, 47, 227, 133,
-    247, 9, 88, 236, 245, 121, 72, 123, 70, 132, 14, 97, 106, 151, 231, 35, 101, 253, 19, 89, 203, 190, 159, 253, 11,
-    225, 37, 103, 42, 166, 17, 163, 89, 25, 9, 94, 8, 142, 5, 1, 146, 237, 205, 102, 119, 187, 207, 41, 87, 17, 228,
-    114, 78, 24, 103, 4, 184, 3, 232, 14, 228, 28, 87, 182, 69, 161, 13, 128, 202, 137, 13, 59, 54, 179, 127, 48, 46,
-    191, 83, 220, 17, 100, 233, 114, 154, 235, 196, 142, 150, 34, 120, 57, 3, 67, 29, 239, 184, 146, 173, 231, 121, 173,
-    88, 205, 54, 65, 148, 50, 154, 173, 72, 49, 70, 160, 129, 54, 58, 32, 235, 113, 227, 122, 37, 160, 243, 66, 252, 28,
-    166, 157, 120, 97, 164, 199, 22, 95, 140, 224, 100, 57, 144, 174, 209, 72, 106, 144, 31, 58, 194, 107, 6, 239, 115,
-    18, 118, 211, 197, 83, 97, 214, 227, 145, 168, 105, 154, 97, 196, 55, 150, 52, 102, 191, 55, 134, 101, 234, 13, 11,
-    184, 162, 27, 223, 94, 6, 5, 15, 7, 12, 177, 49, 27, 14, 192, 135, 21, 128, 81, 82, 60, 143, 169, 240, 139, 246, 53,
-    88, 3, 224, 23, 173, 198, 20, 31, 54, 10, 170, 250, 104, 153, 229, 202, 192, 95, 163, 155, 189, 207, 57, 155, 223,
-    218, 12, 73, 186, 58, 188, 198, 176, 245, 75, 93, 231, 95, 189, 136, 99, 169, 164, 13, 192, 224, 151, 109, 78, 55,
-    216, 68, 201, 23, 176, 41, 56, 250, 211, 192, 250, 126, 0, 173, 136, 79, 174, 44, 90, 76, 192, 86, 235, 93, 183, 58,
-    224, 24, 113, 110, 234, 214, 204, 217, 108, 11, 214, 202, 189, 193, 223, 176, 10, 132, 86, 211, 250, 87, 215, 169,
-    85, 9, 171, 254, 224, 231, 73, 78, 22, 12, 54, 183, 177, 113, 103, 23, 239, 61, 135, 199, 38, 170, 67, 196, 190, 42,
-    86, 75, 106, 212, 118, 46, 53, 178, 112, 244, 17, 183, 177, 134, 181, 169, 145, 5, 83, 110, 254, 126, 61, 244, 219,
-    243, 97, 198, 166, 67, 0, 181, 237, 68, 218, 236, 70, 60, 30, 128, 121, 192, 13, 62, 190, 248, 127, 94, 91, 41, 116,
-    78, 49, 17, 244, 153, 86, 54, 14, 14, 12, 175, 6, 30, 34, 215, 185, 97, 226, 246, 194, 63, 199, 135, 123, 217, 253,
-    255, 100, 3, 246, 190, 114, 137, 1, 0, 184, 148, 97, 70, 146, 116, 42, 73, 116, 161, 96, 243, 53, 108, 138, 230,
-    165, 126, 192, 203, 85, 137, 32, 21, 97, 15, 66, 2, 64, 147, 35, 111, 68, 254, 216, 82, 55, 233, 173, 138, 203, 84,
-    71, 122, 191, 67, 71, 213, 9, 146, 134, 119, 195, 219, 244, 44, 95, 89, 132, 96, 66, 209, 73, 149, 110, 20, 83, 196,
-    179, 154, 215, 39, 80, 133, 5, 211, 45, 224, 5, 78, 92, 209, 161, 180, 162, 172, 1, 1, 168, 9, 181, 240, 185, 76,
-    62, 221, 3, 162, 79, 13, 5, 170, 106, 19, 195, 111, 191, 129, 200, 2, 90, 37, 200, 121, 237, 114, 82, 196, 51, 119,
-    65, 252, 78, 24, 199, 25, 237, 45, 241, 3, 17, 53, 49, 165, 5, 205, 180, 220, 143, 227, 11, 92, 192, 72, 176, 14,
-    85, 6, 41, 254, 174, 237, 64, 251, 9, 174, 119, 132, 93, 96, 21, 209, 124, 176, 234, 164, 115, 157, 153, 240, 192,
-    180, 248, 39, 231, 243, 7, 142, 89, 65, 16, 51, 248, 174, 74, 229, 85, 214, 128, 215, 126, 207, 126, 43, 181, 152,
-    156, 159, 131, 174, 107, 54, 17, 38, 229, 136, 96, 250, 158, 12, 107, 173, 208, 4, 194, 61, 65, 39, 99, 15, 183,
-    203, 118, 51, 32, 211, 82, 197, 115, 133, 18, 226, 76, 71, 195, 135, 109, 127, 107, 107, 120, 17, 73, 78, 104, 73,
-    39, 3, 142, 237, 141, 73, 132, 48, 234, 88, 98, 40, 120, 207, 227, 21, 232, 101, 13, 14, 40, 164, 245, 220, 66, 149,
-    90, 12, 8, 32, 243, 58, 196, 194, 123, 191, 174, 27, 105, 166, 38, 187, 180, 157, 250, 77, 149, 234, 180, 7, 114,
-    187, 176, 126, 104, 149, 140, 25, 6, 215, 19, 180, 104, 16, 204, 34, 57, 237, 65, 211, 126, 200, 126, 82, 68, 252,
-    252, 214, 85, 149, 35, 86, 219, 202, 10, 157, 214, 206, 240, 177, 6, 105, 163, 244, 69, 135, 213, 204, 8, 220, 146,
-    237, 228, 118, 236, 233, 198, 90, 38, 222, 10, 68, 59, 55, 158, 67, 94, 150, 235, 27, 77, 13, 252, 193, 63, 209, 3,
-    39, 182, 149, 88, 220, 45, 160, 234, 98, 75, 145, 65, 181, 127, 181, 19, 66, 248, 226, 3, 46, 201, 215, 25, 60, 218,
-    210, 115, 36, 202, 152, 173, 121, 114, 54, 226, 158, 158, 208, 64, 220, 171, 140, 16, 96, 79, 97, 132, 106, 221,
-    190, 208, 242, 181, 148, 117, 221, 2, 197, 102, 57, 28, 117, 139, 249, 227, 159, 186, 150, 250, 73, 93, 30, 78, 130,
-    190, 205, 51, 121, 169, 17, 115, 130, 229, 67, 63, 125, 218, 4, 16, 186, 186, 115, 91, 46, 83, 207, 97, 110, 131,
-    96, 50, 97, 4, 93, 49, 239, 72, 214, 132, 206, 193, 111, 236, 217, 40, 137, 8, 243, 67, 150, 101, 151, 31, 226, 116,
-    181, 60, 206, 149, 162, 4, 8, 176, 12, 142, 95, 163, 178, 163, 62, 107, 58, 105, 3, 167, 106, 160, 237, 121, 157,
-    216, 129, 238, 20, 169, 102, 32, 164, 248, 130, 155, 30, 138, 91, 48, 124, 94, 237, 102, 128, 39, 57, 196, 46, 63,
-    81, 254, 250, 47, 21, 44, 10, 229, 57, 106, 191, 184, 235, 187, 206, 135, 120, 226, 97, 217, 70, 53, 130, 95, 178,
-    58, 13, 110, 35, 122, 155, 84, 252, 83, 7, 199, 96, 207, 180, 0, 71, 82, 197, 194, 252, 235, 143, 64, 34, 131, 167,
-    214, 24, 194, 31, 36, 11, 126, 47, 180, 87, 219, 128, 233, 4, 194, 95, 17, 69, 122, 7, 166, 91, 154, 29, 65, 83, 25,
-    201, 184, 178, 57, 195, 225, 161, 132, 158, 48, 13, 156, 132, 64, 243, 82, 28, 7, 245, 156, 96, 33, 140, 163, 85,
-    85, 145, 250, 213, 57, 145, 132, 192, 16, 135, 249, 209, 145, 40, 223, 137, 223, 234, 26, 104, 138, 134, 163, 217,
-    245, 239, 118, 13, 106, 212, 109, 153, 239, 244, 152, 209, 225, 167, 100, 222, 79, 211, 153, 92, 40, 156, 55, 141,
-    74, 231, 245, 233, 226, 251, 41, 86, 232, 110, 170, 201, 141, 179, 162, 183, 148, 12, 115, 115, 40, 27, 4, 90, 144,
-    7, 192, 72, 147, 64, 196, 208, 148, 121, 239, 149, 144, 30, 237, 106, 21, 224, 243, 152, 109, 163, 106, 148, 75,
-    112, 156, 231, 76, 110, 60, 22, 162, 96, 129, 46, 227, 39, 89, 207, 122, 198, 252, 43, 185, 131, 231, 199, 160, 7,
-    37, 69, 91, 102, 60, 43, 237, 215, 168, 245, 80, 25, 220, 106, 9, 228, 6, 45, 119, 164, 44, 1, 114, 233, 83, 173,
-    204, 150, 214, 55, 246, 222, 7, 50, 186, 76, 0, 229, 33, 177, 102, 8, 172, 208, 34, 149, 207, 126, 68, 36, 184, 153,
-    117, 85, 229, 199, 165, 210, 116, 75, 250, 199, 18, 198, 215, 219, 194, 99, 11, 30, 222, 195, 39, 220, 173, 165,
-    101, 205, 221, 1, 33, 96, 67, 89, 154, 146, 169, 170, 67, 26, 167, 59, 53, 216, 166, 156, 235, 187, 63, 225, 8, 190,
-    68, 203, 225, 210, 53, 98, 133, 72, 239, 188, 132, 50, 224, 155, 133, 35, 78, 240, 255, 24, 65, 114, 7, 139, 125,
-    216, 165, 66, 100, 240, 59, 220, 135, 55, 43, 227, 232, 104, 173, 93, 234, 112, 190, 86, 247, 87, 34, 66, 5, 63, 97,
-    17, 136, 43, 78, 175, 25, 187, 206, 77, 235, 48, 92, 221, 0, 179, 228, 51, 101, 206, 62, 148, 124, 115, 175, 250,
-    196, 164, 60, 123, 77, 189, 243, 232, 1, 249, 177, 85, 120, 113, 255, 232, 88, 17, 101, 232, 6, 11, 96, 135, 73,
-    249, 50, 140, 201, 215, 60, 205, 185, 22, 131, 233, 77, 224, 106, 225, 35, 243, 66, 19, 156, 222, 242, 105, 243, 10,
-    28, 85, 163, 103, 211, 130, 144, 87, 200, 238, 180, 174, 248, 77, 199, 147, 199, 118, 255, 71, 129, 215, 5, 195, 82,
-    222, 9, 58, 15, 249, 115, 69, 180, 109, 213, 148, 202, 96, 235, 137, 134, 194, 156, 85, 208, 173, 63, 215, 96, 236,
-    205, 120, 40, 23, 91, 157, 95, 102, 177, 222, 147, 172, 27, 239, 48, 6, 236, 173, 117, 220, 131, 113, 185, 245, 218,
-    161, 21, 164, 114, 1, 201, 248, 66, 190, 169, 5, 161, 79, 3, 146, 85, 241, 16, 225, 92, 43, 18, 128, 229, 16, 47,
-    212, 78, 104, 157, 126, 88, 58, 71, 51, 74, 101, 37, 24, 34, 146, 150, 27, 17, 41, 239, 184, 71, 233, 3, 69, 2, 144,
-    96, 86, 251, 127, 154, 116, 234, 41, 180, 170, 194, 42, 139, 225, 224, 190, 178, 252, 137, 15, 18, 252, 189, 104,
-    31, 48, 133, 2, 153, 71, 94, 153, 159, 3, 246, 98, 146, 4, 35, 34, 213, 213, 148, 178, 64, 71, 50, 83, 220, 192, 14,
-    236, 139, 118, 137, 191, 102, 119, 74, 215, 248, 43, 150, 135, 214, 253, 188, 52, 34, 162, 25, 240, 45, 255, 183,
-    76, 8, 60, 115, 4, 69, 171, 5, 18, 242, 3, 143, 105, 35, 87, 61, 212, 56, 95, 67, 185, 213, 222, 25, 114, 135, 14,
-    7, 110, 110, 238, 12, 131, 128, 201, 109, 15, 90, 249, 214, 75, 144, 17, 194, 170, 161, 244, 230, 110, 196, 39, 166,
-    190, 78, 248, 222, 76, 81, 208, 173, 196, 123, 0, 182, 93, 99, 133, 154, 75, 163, 102, 54, 254, 231, 21, 196, 62,
-    157, 179, 181, 122, 51, 167, 92, 216, 4, 207, 144, 126, 25, 176, 149, 252, 211, 13, 27, 246, 180, 20, 149, 33, 193,
-    196, 72, 125, 161, 203, 91, 104, 165, 91, 222, 240, 239, 104, 2, 17, 218, 177, 89, 240, 232, 238, 117, 125, 182,
-    142, 142, 83, 145, 12, 242, 239, 172, 50, 34, 100, 82, 163, 177, 38, 158, 2, 243, 76, 56, 95, 59, 141, 242, 193, 77,
-    128, 59, 246, 56, 98, 63, 154, 107, 158, 207, 96, 228, 248, 165, 187, 242, 82, 53, 125, 29, 235, 22, 119, 107, 16,
-    255, 142, 181, 92, 178, 235, 160, 122, 27, 67, 182, 91, 98, 108, 140, 157, 240, 143, 151, 156, 139, 23, 61, 191, 90,
-    120, 225, 128, 202, 200, 147, 229, 156, 27, 65, 177, 135, 47, 110, 48, 235, 37, 205, 218, 253, 174, 54, 111, 18, 78,
-    52, 126, 167, 53, 62, 75, 44, 40, 201, 31, 68, 180, 39, 216, 217, 44, 154, 143, 203, 176, 246, 136, 170, 177, 178,
-    34, 8, 100, 232, 123, 34, 214, 5, 176, 204, 227, 202, 48, 67, 147, 48, 96, 26, 14, 224, 157, 123, 82, 251, 11, 119,
-    229, 251, 17, 94, 43, 206, 49, 73, 91, 123, 168, 247, 147, 246, 208, 248, 239, 61, 242, 223, 52, 121, 48, 12, 53,
-    112, 236, 31, 246, 17, 101, 222, 179, 49, 160, 19, 188, 103, 163, 120, 60, 80, 100, 23, 137, 118, 136, 132, 89, 137,
-    183, 243, 126, 187, 166, 107, 78, 35, 155, 65, 90, 69, 255, 93, 199, 244, 33, 107, 167, 231, 69, 244, 255, 222, 122,
-    245, 66, 120, 43, 184, 51, 43, 2, 79, 149, 224, 176, 10, 191, 3, 127, 32, 12, 64, 253, 60, 244, 37, 220, 201, 29, 4,
-    29, 86, 79, 79, 236, 94, 53, 243, 113, 223, 140, 81, 103, 150, 131, 124, 70, 136, 160, 21, 216, 207, 242, 74, 46,
-    172, 212, 46, 5, 205, 112, 253, 60, 131, 0, 113, 78, 145, 129, 234, 250, 188, 235, 15, 148, 67, 145, 61, 39, 78,
-    206, 33, 100, 220, 37, 123, 145, 87, 37, 15, 51, 10, 193, 226, 119, 55, 149, 235, 24, 170, 175, 215, 244, 30, 32,
-    220, 32, 37, 63, 32, 135, 181, 208, 180, 26, 41, 43, 76, 11, 193, 3, 60, 128, 136, 66, 23, 12, 100, 44, 96, 238, 5,
-    87, 222, 165, 79, 243, 238, 87, 68, 137, 126, 163, 92, 210, 75, 152, 21, 115, 210, 171, 68, 187, 179, 44, 203, 157,
-    247, 6, 0, 181, 245, 236, 123, 60, 130, 62, 34, 95, 85, 236, 171, 12, 167, 52, 140, 198, 183, 161, 106, 180, 78,
-    143, 61, 37, 202, 34, 225, 247, 10, 37, 201, 119, 76, 82, 208, 151, 45, 163, 136, 228, 51, 94, 246, 157, 176, 193,
-    89, 161, 234, 144, 106, 196, 245, 198, 94, 101, 37, 219, 175, 89, 192, 36, 26, 20, 164, 34, 33, 158, 42, 248, 57,
-    24, 254, 107, 63, 3, 58, 189, 116, 41, 242, 43, 120, 6, 170, 79, 238, 220, 17, 53, 168, 114, 167, 110, 203, 143, 51,
-    45, 41, 81, 225, 247, 43, 135, 211, 60, 110, 205, 238, 153, 156, 145, 75, 42, 218, 16, 42, 8, 253, 109, 149, 124,
-    120, 254, 1, 105, 52, 106, 196, 136, 145, 51, 12, 38, 107, 101, 231, 159, 243, 251, 147, 146, 97, 245, 216, 125, 74,
-    100, 28, 39, 230, 231, 109, 193, 121, 57, 95, 61, 177, 189, 40, 245, 139, 175, 40, 168, 219, 208, 162, 220, 129,
-    180, 166, 209, 3, 57, 68, 111, 44, 107, 212, 215, 63, 202, 247, 19, 181, 167, 251, 59, 245, 98, 76, 146, 203, 75,
-    80, 36, 36, 211, 148, 6, 52, 237, 96, 142, 142, 15, 135, 255, 60, 40, 110, 13, 163, 250, 51, 134, 241, 252, 33, 201,
-    229, 21, 91, 25, 252, 81, 135, 121, 104, 180, 154, 240, 37, 242, 142, 98, 182, 186, 15, 245, 74, 63, 241, 52, 216,
-    135, 137, 173, 6, 139, 63, 201, 162, 35, 188, 101, 144, 109, 160, 40, 168, 92, 238, 42, 122, 105, 184, 61, 245, 130,
-    126, 33, 186, 59, 25, 3, 103, 198, 186, 164, 229, 14, 129, 200, 23, 93, 202, 122, 200, 126, 0, 234, 150, 169, 67,
-    78, 107, 121, 4, 155, 82, 152, 85, 83, 165, 104, 19, 222, 155, 66, 203, 59, 237, 90, 46, 106, 177, 166, 106, 198,
-    132, 21, 252, 250, 71, 96, 155, 237, 193, 138, 237, 109, 39, 98, 180, 60, 99, 121, 76, 79, 207, 159, 154, 48, 127,
-    205, 122, 86, 70, 250, 66, 91, 68, 186, 113, 225, 202, 204, 200, 230, 72, 2, 14, 15, 89, 57, 79, 193, 76, 208, 84,
-    222, 190, 63, 69, 189, 252, 180, 21, 22, 59, 206, 228, 178, 93, 162, 89, 248, 70, 220, 28, 41, 133, 190, 89, 219, 1,
-    224, 185, 17, 95, 125, 34, 234, 157, 16, 195, 133, 104, 244, 161, 44, 246, 62, 198, 20, 134, 33, 166, 250, 0, 179,
-    70, 102, 138, 40, 13, 32, 202, 8, 76, 176, 96, 235, 27, 235, 28, 117, 143, 12, 64, 112, 168, 89, 6, 197, 29, 250,
-    133, 41, 78, 159, 237, 166, 62, 69, 195, 7, 203, 112, 187, 137, 26, 189, 222, 39, 88, 60, 22, 213, 61, 239, 187,
-    114, 9, 34, 33, 139, 176, 231, 92, 242, 100, 139, 185, 160, 34, 1, 61, 44, 226, 196, 47, 251, 63, 190, 191, 115, 12,
-    107, 17, 186, 36, 190, 122, 250, 37, 235, 5, 110, 194, 240, 34, 98, 195, 24, 234, 219, 10, 188, 168, 107, 1, 174,
-    121, 55, 172, 3, 26, 234, 31, 34, 242, 189, 139, 204, 151, 93, 214, 13, 67, 32, 174, 85, 203, 60, 171, 92, 0, 23,
-    202, 78, 7, 0, 253, 153, 40, 119, 202, 135, 158, 205, 138, 74, 41, 41, 215, 52, 179, 161, 236, 198, 153, 182, 205,
-    123, 213, 20, 138, 228, 179, 179, 48, 228, 126, 40, 171, 201, 53, 187, 205, 205, 10, 251, 56, 20, 146, 156, 239,
-    202, 233, 1, 191, 224, 152, 70, 245, 107, 96, 67, 119, 200, 176, 105, 83, 112, 180, 247, 158, 92, 215, 177, 105, 96,
-    200, 242, 221, 94, 15, 28, 142, 53, 217, 92, 196, 92, 239, 87, 71, 93, 19, 13, 208, 102, 226, 113, 46, 253, 147,
-    236, 199, 120, 252, 91, 51, 115, 119, 68, 137, 124, 110, 162, 0, 174, 208, 76, 169, 103, 154, 148, 97, 7, 204, 202,
-    250, 126, 18, 73, 5, 46, 169, 217, 60, 129, 215, 6, 232, 99, 17, 21, 187, 115, 240, 125, 55, 213, 61, 35, 18, 37,
-    75, 172, 95, 39, 177, 81, 191, 98, 228, 119, 14, 222, 35, 213, 68, 101, 122, 56, 230, 45, 63, 10, 175, 182, 94, 76,
-    170, 148, 95, 159, 230, 29, 98, 134, 104, 179, 62, 212, 205, 4, 255, 130, 19, 210, 246, 106, 224, 110, 14, 67, 249,
-    85, 184, 166, 34, 250, 65, 222, 140, 145, 194, 33, 2, 69, 84, 252, 112, 23, 23, 197, 18, 150, 62, 53, 167, 240, 16,
-    120, 89, 222, 108, 42, 165, 107, 203, 160, 104, 52, 140, 92, 42, 80, 144, 249, 190, 118, 189, 238, 206, 144, 147,
-    128, 123, 141, 2, 206, 127, 195, 162, 120, 65, 251, 49, 239, 148, 44, 14, 10, 201, 149, 172, 23, 22, 119, 60, 152,
-    27, 128, 102, 112, 133, 169, 89, 160, 128, 145, 101, 137, 186, 223, 237, 96, 85, 84, 49, 219, 197, 248, 56, 76, 238,
-    43, 78, 218, 207, 125, 101, 94, 141, 208, 105, 231, 166, 152, 74, 234, 222, 3, 204, 5, 182, 189, 73, 40, 216, 33,
-    233, 202, 140, 82, 57, 196, 89, 154, 80, 64, 44, 35, 200, 147, 183, 177, 146, 162, 35, 253, 92, 205, 174, 128, 244,
-    253, 120, 62, 74, 119, 225, 124, 242, 23, 101, 112, 112, 67, 122, 174, 66, 150, 56, 216, 47, 83, 66, 144, 52, 27,
-    171, 70, 70, 135, 205, 66, 3, 165, 94, 29, 180, 237, 230, 237, 251, 10, 7, 168, 149, 220, 190, 159, 251, 218, 193,
-    85, 22, 19, 70, 164, 221, 50, 7, 175, 20, 241, 5, 81, 31, 128, 173, 87, 108, 158, 170, 24, 103, 25, 251, 247, 86,
-    119, 57, 82, 208, 46, 31, 32, 238, 10, 168, 187, 57, 179, 87, 192, 145, 94, 155, 166, 75, 80, 150, 98, 88, 40, 23,
-    81, 10, 179, 122, 76, 5, 213, 210, 235, 139, 56, 40, 95, 172, 89, 250, 32, 90, 96, 189, 247, 12, 54, 76, 122, 17,
-    25, 241, 57, 219, 185, 130, 17, 50, 55, 67, 137, 240, 172, 122, 160, 42, 147, 26, 145, 92, 242, 154, 55, 192, 224,
-    13, 207, 151, 21, 29, 237, 151, 4, 5, 15, 25, 150, 232, 60, 35, 64, 181, 252, 190, 179, 177, 91, 58, 39, 92, 9, 45,
-    31, 177, 142, 242, 38, 184, 169, 161, 105, 38, 4, 237, 197, 0, 96, 154, 139, 48, 159, 125, 2, 222, 6, 22, 28, 94,
-    64, 110, 229, 178, 78, 207, 165, 249, 5, 90, 95, 8, 83, 202, 123, 236, 251, 37, 172, 169, 162, 194, 229, 104, 157,
-    225, 136, 161, 160, 139, 180, 228, 135, 235, 142, 142, 29, 47, 29, 37, 61, 249, 222, 105, 206, 78, 23, 99, 11, 16,
-    207, 43, 71, 222, 86, 254, 149, 64, 119, 6, 133, 2, 118, 42, 128, 186, 151, 88, 83, 241, 50, 196, 216, 23, 74, 151,
-    28, 146, 60, 204, 116, 2, 180, 48, 11, 181, 190, 145, 62, 254, 7, 137, 203, 220, 8, 99, 228, 104, 67, 113, 96, 242,
-    222, 216, 104, 198, 80, 133, 208, 82, 49, 223, 98, 88, 169, 149, 242, 230, 245, 160, 79, 51, 200, 18, 75, 200, 246,
-    68, 95, 38, 167, 128, 58, 16, 191, 25, 28, 232, 147, 192, 3, 61, 122, 40, 149, 180, 152, 111, 229, 218, 229, 50,
-    111, 129, 253, 249, 157, 59, 150, 145, 254, 114, 213, 89, 94, 135, 138, 194, 129, 37, 216, 181, 254, 167, 210, 65,
-    188, 184, 104, 220, 237, 8, 139, 148, 192, 152, 8, 29, 131, 76, 154, 4, 40, 181, 93, 220, 80, 50, 65, 228, 236, 101,
-    186, 186, 12, 46, 184, 55, 33, 101, 61, 28, 17, 86, 190, 241, 16, 23, 9, 139, 175, 232, 147, 17, 158, 160, 169, 33,
-    207, 70, 125, 84, 165, 65, 127, 177, 247, 191, 230, 217, 120, 160, 198, 51, 186, 222, 151, 62, 216, 186, 213, 254,
-    11, 89, 218, 98, 168, 227, 36, 31, 68, 169, 91, 135, 156, 102, 66, 114, 12, 223, 211, 108, 149, 181, 66, 100, 128,
-    23, 240, 204, 65, 4, 70, 217, 76, 20, 253, 53, 207, 82, 201, 150, 63, 94, 3, 102, 251, 30, 14, 78, 172, 127, 11,
-    133, 83, 179, 190, 104, 13, 3, 205, 128, 69, 118, 55, 132, 8, 21, 69, 51, 136, 73, 194, 245, 171, 37, 146, 251, 179,
-    62, 101, 226, 20, 5, 33, 104, 80, 24, 24, 123, 212, 65, 160, 196, 6, 110, 67, 169, 233, 169, 94, 53, 40, 107, 232,
-    189, 254, 48, 181, 85, 220, 49, 152, 86, 34, 23, 252, 228, 231, 113, 138, 163, 233, 20, 210, 216, 198, 183, 97, 229,
-    97, 77, 93, 163, 25, 131, 170, 192, 22, 140, 55, 97, 120, 199, 51, 124, 61, 160, 27, 67, 68, 122, 245, 120, 120, 27,
-    143, 184, 202, 176, 212, 188, 29, 89, 239, 140, 222, 153, 135, 142, 76, 179, 58, 148, 125, 86, 165, 35, 237, 152,
-    35, 82, 105, 205, 23, 49, 188, 175, 120, 128, 240, 157, 100, 211, 133, 95, 136, 94, 121, 125, 192, 176, 254, 80,
-    163, 148, 251, 34, 135, 39, 247, 229, 186, 1, 90, 34, 152, 238, 253, 128, 139, 62, 100, 154, 222, 7, 68, 233, 178,
-    127, 219, 217, 52, 132, 124, 22, 187, 182, 217, 86, 91, 138, 164, 232, 233, 106, 193, 98, 141, 206, 119, 205, 62,
-    174, 68, 168, 239, 105, 14, 231, 107, 136, 210, 144, 9, 60, 214, 254, 216, 137, 235, 4, 10, 253, 243, 210, 171, 211,
-    160, 140, 210, 27, 26, 116, 71, 130, 254, 4, 248, 249, 111, 72, 166, 170, 135, 132, 88, 119, 9, 141, 3, 28, 136, 87,
-    122, 165, 1, 166, 71, 124, 59, 185, 106, 169, 253, 117, 208, 240, 85, 252, 175, 221, 184, 62, 221, 124, 46, 244,
-    245, 140, 160, 216, 105, 223, 161, 145, 177, 76, 211, 39, 153, 199, 32, 212, 164, 184, 152, 194, 210, 17, 255, 97,
-    217, 206, 208, 221, 178, 7, 139, 169, 135, 75, 113, 179, 137, 161, 44, 32, 116, 43, 164, 183, 88, 221, 196, 43, 98,
-    154, 127, 204, 77, 132, 0, 212, 132, 47, 190, 144, 101, 231, 22, 146, 195, 218, 64, 249, 158, 146, 10, 227, 153, 38,
-    77, 127, 231, 46, 92, 71, 99, 84, 51, 54, 78, 204, 221, 227, 72, 111, 224, 6, 87, 217, 234, 156, 16, 165, 147, 2,
-    234, 225, 217, 174, 15, 138, 73, 12, 38, 135, 177, 122, 61, 55, 253, 201, 147, 122, 200, 75, 136, 66, 168, 188, 184,
-    131, 246, 94, 99, 222, 244, 144, 250, 86, 183, 28, 154, 234, 102, 72, 95, 51, 15, 178, 24, 52, 211, 237, 36, 116,
-    75, 89, 224, 196, 249, 31, 123, 17, 59, 177, 63, 59, 125, 196, 188, 96, 159, 156, 191, 188, 210, 86, 22, 39, 74, 19,
-    247, 39, 81, 98, 224, 48, 83, 242, 116, 252, 12, 174, 117, 42, 74, 24, 224, 192, 68, 176, 39, 221, 93, 173, 68, 98,
-    162, 55, 159, 174, 145, 252, 97, 14, 109, 122, 132, 49, 222, 106, 246, 93, 87, 253, 55, 180, 206, 103, 33, 237, 177,
-    153, 252, 125, 121, 15, 23, 188, 15, 132, 237, 73, 75, 118, 161, 144, 227, 204, 39, 248, 117, 43, 56, 152, 170, 234,
-    242, 86, 8, 170, 20, 201, 98, 121, 12, 193, 249, 41, 132, 104, 0, 69, 143, 70, 18, 139, 75, 170, 51, 55, 54, 248,
-    80, 217, 121, 65, 182, 86, 216, 255, 159, 176, 163, 10, 158, 40, 195, 90, 170, 29, 211, 129, 53, 69, 253, 102, 46,
-    169, 92, 137, 208, 72, 191, 174, 129, 196, 43, 220, 23, 254, 216, 99, 98, 173, 137, 18, 202, 175, 94, 89, 133, 242,
-    133, 229, 157, 94, 191, 195, 249, 101, 44, 132, 48, 86, 159, 66, 218, 57, 218, 67, 102, 117, 88, 113, 155, 111, 50,
-    98, 179, 40, 171, 180, 101, 135, 140, 100, 42, 212, 175, 143, 135, 159, 232, 67, 136, 239, 138, 14, 173, 144, 168,
-    14, 93, 85, 235, 64, 182, 255, 151, 120, 233, 136, 76, 116, 187, 40, 27, 237, 183, 11, 187, 0, 143, 164, 223, 147,
-    118, 80, 25, 227, 11, 190, 100, 83, 169, 168, 222, 63, 69, 32, 205, 179, 206, 179, 134, 143, 1, 221, 37, 48, 233,
-    48, 37, 166, 156, 25, 179, 197, 47, 10, 134, 240, 140, 228, 154, 189, 28, 56, 143, 254, 99, 125, 247, 126, 71, 105,
-    113, 141, 60, 10, 228, 0, 25, 121, 189, 237, 219, 168, 235, 244, 21, 33, 2, 229, 20, 150, 7, 237, 62, 231, 130, 213,
-    40, 90, 117, 239, 73, 171, 73, 69, 115, 84, 167, 52, 34, 3, 81, 188, 35, 231, 189, 196, 151, 196, 30, 87, 191, 105,
-    231, 30, 115, 254, 155, 120, 220, 23, 179, 198, 25, 113, 48, 30, 125, 61, 44, 192, 124, 27, 129, 137, 180, 240, 185,
-    30, 94, 11, 78, 69, 143, 151, 79, 209, 107, 182, 251, 15, 246, 165, 0, 119, 118, 10, 59, 99, 43, 148, 53, 84, 119,
-    137, 40, 103, 98, 127, 134, 147, 140, 87, 47, 164, 209, 88, 37, 38, 78, 202, 90, 25, 96, 209, 39, 25, 78, 9, 73,
-    241, 219, 202, 41, 177, 7, 164, 42, 244, 81, 80, 197, 3, 178, 93, 33, 141, 64, 25, 196, 125, 220, 183, 154, 250, 83,
-    221, 171, 84, 247, 140, 239, 43, 141, 245, 42, 78, 151, 196, 145, 206, 229, 165, 245, 234, 188, 246, 115, 99, 80,
-    167, 123, 162, 98, 34, 46, 130, 155, 161, 220, 213, 226, 15, 80, 143, 113, 148, 82, 255, 101, 74, 76, 50, 149, 232,
-    208, 233, 63, 10, 40, 54, 101, 236, 34, 235, 222, 54, 181, 67, 140, 20, 208, 90, 182, 12, 252, 16, 183, 240, 45, 50,
-    236, 12, 45, 125, 83, 118, 91, 205, 58, 67, 25, 123, 152, 136, 50, 222, 17, 226, 253, 146, 113, 21, 76, 221, 101,
-    193, 153, 63, 232, 192, 155, 24, 104, 230, 56, 46, 221, 5, 104, 32, 26, 195, 162, 245, 59, 236, 155, 90, 85, 6, 20,
-    13, 12, 238, 147, 170, 118, 169, 47, 173, 194, 233, 228, 31, 70, 240, 65, 66, 250, 135, 94, 210, 29, 198, 181, 44,
-    144, 50, 50, 135, 48, 80, 59, 197, 34, 187, 255, 137, 215, 95, 137, 121, 245, 105, 40, 65, 135, 89, 254, 146, 81,
-    183, 236, 178, 190, 177, 200, 18, 239, 157, 252, 19, 185, 57, 46, 87, 2, 94, 219, 215, 47, 142, 194, 143, 176, 229,
-    165, 244, 78, 175, 153, 136, 222, 161, 200, 195, 9, 217, 80, 27, 167, 174, 108, 45, 69, 38, 81, 248, 108, 235, 126,
-    118, 6, 249, 225, 174, 202, 162, 78, 104, 80, 69, 23, 205, 43, 63, 241, 240, 49, 220, 120, 132, 217, 40, 198, 3,
-    200, 242, 194, 13, 184, 40, 64, 37, 212, 130, 239, 57, 113, 189, 51, 99, 254, 40, 190, 73, 104, 223, 189, 169, 158,
-    187, 0, 32, 225, 126, 142, 73, 76, 165, 135, 86, 64, 30, 156, 186, 163, 11, 168, 45, 185, 41, 46, 23, 184, 51, 12,
-    100, 163, 140, 131, 123, 75, 52, 247, 189, 135, 223, 83, 144, 248, 175, 93, 99, 26, 194, 209, 132, 94, 187, 12, 28,
-    230, 174, 32, 243, 135, 209, 156, 53, 60, 9, 249, 167, 123, 219, 45, 242, 182, 121, 102, 181, 25, 70, 243, 186, 58,
-    109, 90, 125, 75, 92, 214, 115, 143, 237, 237, 232, 96, 209, 183, 54, 20, 38, 112, 30, 115, 174, 154, 196, 97, 94,
-    28, 112, 35, 172, 156, 242, 131, 95, 124, 159, 233, 138, 112, 197, 48, 234, 174, 69, 82, 4, 149, 139, 162, 132, 49,
-    126, 238, 159, 248, 91, 109, 54, 192, 104, 236, 103, 79, 6, 190, 242, 198, 125, 255, 222, 16, 229, 43, 19, 190, 183,
-    255, 55, 226, 43, 132, 191, 220, 119, 98, 111, 72, 123, 164, 213, 39, 9, 121, 62, 149, 215, 26, 137, 15, 220, 27,
-    128, 243, 108, 91, 188, 160, 35, 106, 161, 81, 153, 168, 120, 6, 6, 66, 170, 10, 203, 48, 14, 17, 236, 151, 100,
-    204, 84, 95, 80, 101, 131, 45, 123, 39, 125, 225, 84, 185, 140, 142, 189, 49, 250, 84, 67, 112, 202, 11, 82, 53,
-    250, 208, 36, 106, 170, 21, 182, 115, 144, 134, 242, 135, 182, 84, 221, 199, 51, 33, 28, 170, 229, 88, 125, 214,
-    243, 207, 49, 94, 6, 5, 152, 133, 65, 74, 94, 88, 79, 188, 57, 131, 97, 123, 223, 190, 39, 242, 215, 119, 253, 20,
-    241, 210, 74, 57, 206, 22, 228, 121, 44, 200, 0, 138, 157, 253, 11, 95, 106, 90, 91, 135, 60, 169, 3, 254, 250, 167,
-    209, 234, 2, 249, 170, 199, 108, 230, 89, 95, 125, 19, 155, 7, 58, 156, 232, 71, 210, 110, 70, 22, 76, 148, 66, 209,
-    92, 127, 70, 241, 168, 60, 20, 118, 156, 115, 63, 75, 141, 101, 226, 90, 131, 110, 124, 180, 118, 135, 229, 179,
-    153, 122, 81, 251, 173, 54, 253, 185, 217, 60, 136, 39, 130, 191, 69, 32, 47, 236, 165, 178, 16, 161, 120, 196, 233,
-    63, 39, 114, 233, 142, 110, 2, 56, 176, 177, 6, 174, 40, 26, 13, 123, 170, 195, 71, 93, 118, 172, 242, 225, 177,
-    238, 125, 58, 196, 58, 145, 207, 141, 0, 97, 23, 195, 162, 149, 71, 190, 201, 75, 108, 193, 12, 213, 190, 231, 105,
-    56, 4, 65, 57, 159, 134, 10, 227, 58, 145, 144, 0, 115, 132, 80, 90, 32, 8, 0, 250, 210, 191, 179, 152, 128, 52,
-    164, 242, 97, 149, 202, 211, 201, 169, 200, 190, 31, 245, 255, 216, 57, 249, 187, 122, 230, 35, 187, 168, 44, 232,
-    170, 51, 108, 116, 183, 109, 34, 98, 94, 115, 28, 69, 217, 25, 136, 129, 209, 59, 62, 65, 175, 109, 194, 166, 114,
-    255, 183, 209, 137, 71, 11, 64, 252, 12, 177, 99, 157, 243, 140, 251, 208, 149, 250, 24, 61, 185, 57, 196, 75, 253,
-    37, 77, 242, 120, 11, 204, 169, 204, 63, 48, 231, 209, 95, 203, 106, 145, 4, 203, 211, 196, 172, 154, 44, 240, 137,
-    29, 165, 235, 39, 33, 80, 104, 12, 36, 24, 202, 158, 61, 66, 78, 148, 84, 195, 231, 45, 224, 168, 74, 17, 158, 221,
-    157, 188, 197, 211, 71, 131, 223, 192, 225, 181, 253, 24, 3, 112, 136, 168, 197, 239, 230, 76, 249, 55, 217, 189,
-    133, 197, 159, 213, 147, 206, 65, 213, 217, 251, 180, 45, 117, 52, 80, 166, 133, 8, 68, 105, 81, 15, 106, 126, 222,
-    1, 66, 189, 13, 35, 183, 98, 164, 232, 128, 43, 212, 160, 213, 226, 233, 181, 106, 115, 217, 197, 89, 248, 242, 165,
-    88, 230, 164, 214, 148, 171, 232, 245, 110, 43, 60, 115, 169, 187, 209, 153, 84, 130, 154, 242, 90, 113, 150, 36,
-    137, 45, 43, 150, 156, 249, 245, 67, 51, 64, 159, 239, 30, 17, 113, 105, 134, 136, 234, 20, 10, 244, 137, 63, 22,
-    39, 218, 42, 104, 125, 4, 210, 100, 174, 179, 19, 39, 236, 70, 143, 25, 184, 184, 163, 174, 95, 115, 124, 76, 87,
-    25, 52, 9, 225, 86, 111, 33, 102, 160, 143, 51, 69, 33, 181, 214, 19, 62, 234, 202, 59, 165, 118, 216, 168, 68, 129,
-    251, 60, 3, 237, 178, 138, 128, 230, 102, 66, 55, 190, 86, 4, 217, 113, 108, 244, 253, 37, 22, 32, 22, 31, 95, 59,
-    55, 81, 176, 146, 189, 10, 70, 30, 192, 70, 205, 121, 41, 187, 85, 33, 34, 104, 53, 180, 242, 197, 59, 78, 220, 69,
-    135, 7, 240, 142, 151, 103, 71, 212, 177, 61, 111, 45, 104, 9, 27, 197, 38, 242, 80, 220, 157, 78, 205, 125, 248,
-    137, 183, 150, 142, 95, 245, 64, 182, 12, 228, 26, 247, 98, 137, 158, 0, 87, 153, 234, 183, 168, 178, 172, 232, 188,
-    67, 55, 103, 221, 242, 106, 51, 208, 231, 207, 82, 183, 13, 86, 248, 188, 117, 172, 254, 126, 23, 133, 1, 129, 65,
-    213, 184, 51, 109, 108, 216, 108, 171, 213, 201, 175, 78, 84, 60, 99, 59, 22, 235, 162, 0, 164, 208, 17, 122, 221,
-    220, 22, 9, 88, 5, 76, 237, 1, 62, 191, 24, 230, 181, 77, 59, 82, 207, 91, 224, 43, 47, 220, 213, 111, 137, 55, 218,
-    119, 181, 124, 122, 50, 73, 133, 200, 174, 61, 156, 103, 65, 254, 170, 161, 81, 35, 235, 194, 250, 49, 213, 18, 190,
-    3, 172, 35, 182, 160, 161, 26, 53, 88, 246, 92, 66, 64, 113, 243, 181, 243, 65, 55, 192, 111, 129, 183, 120, 227,
-    25, 197, 219, 128, 197, 38, 241, 114, 199, 54, 159, 34, 200, 197, 182, 211, 69, 76, 249, 142, 6, 159, 248, 54, 81,
-    253, 30, 140, 6, 14, 110, 113, 106, 85, 219, 139, 240, 55, 169, 108, 137, 170, 188, 120, 215, 215, 223, 248, 133,
-    233, 80, 144, 195, 176, 120, 229, 49, 120, 202, 86, 182, 168, 71, 21, 43, 119, 24, 184, 22, 71, 191, 103, 104, 205,
-    164, 12, 208, 209, 252, 240, 32, 96, 179, 205, 101, 170, 11, 64, 16, 39, 215, 181, 178, 197, 201, 18, 160, 172, 117,
-    203, 1, 136, 146, 252, 245, 63, 211, 94, 117, 182, 151, 229, 35, 238, 202, 102, 8, 71, 114, 37, 155, 146, 160, 104,
-    78, 172, 77, 94, 87, 252, 18, 229, 8, 59, 220, 221, 176, 147, 151, 188, 201, 231, 112, 7, 36, 131, 33, 189, 158,
-    216, 2, 184, 249, 204, 139, 36, 210, 132, 124, 242, 22, 139, 246, 151, 143, 241, 252, 189, 190, 79, 97, 23, 14, 199,
-    29, 127, 76, 130, 74, 226, 107, 87, 194, 69, 104, 37, 87, 233, 198, 172, 183, 143, 41, 62, 40, 92, 151, 234, 146,
-    84, 77, 164, 229, 92, 54, 101, 140, 117, 7, 211, 102, 1, 207, 69, 136, 180, 86, 186, 69, 68, 48, 142, 253, 221, 103,
-    4, 142, 153, 120, 167, 78, 19, 187, 139, 28, 127, 86, 94, 77, 169, 73, 124, 229, 224, 193, 216, 74, 24, 126, 238,
-    75, 207, 92, 130, 101, 123, 165, 195, 134, 83, 46, 241, 214, 185, 55, 195, 110, 15, 30, 20, 114, 18, 57, 135, 165,
-    172, 89, 84, 137, 154, 99, 143, 55, 233, 100, 190, 254, 255, 234, 91, 202, 109, 248, 175, 102, 129, 96, 220, 108,
-    228, 48, 213, 250, 182, 141, 248, 117, 162, 79, 137, 203, 71, 153, 234, 112, 151, 3, 236, 242, 25, 247, 55, 171,
-    166, 46, 27, 254, 59, 61, 119, 189, 58, 251, 244, 139, 112, 113, 162, 176, 159, 91, 58, 142, 89, 47, 51, 197, 226,
-    213, 26, 184, 217, 130, 178, 5, 240, 61, 102, 208, 104, 181, 153, 196, 51, 183, 224, 255, 159, 136, 217, 117, 199,
-    227, 213, 126, 102, 229, 14, 135, 217, 37, 135, 75, 182, 57, 19, 161, 6, 134, 119, 189, 232, 104, 250, 173, 55, 73,
-    201, 31, 101, 205, 19, 41, 160, 84, 31, 20, 44, 230, 254, 141, 227, 173, 162, 190, 217, 10, 87, 34, 144, 4, 129,
-    234, 115, 56, 199, 98, 56, 72, 206, 58, 206, 165, 123, 253, 61, 199, 148, 12, 217, 95, 43, 234, 231, 45, 158, 101,
-    209, 137, 140, 23, 80, 31, 16, 155, 136, 157, 253, 56, 147, 189, 19, 250, 15, 71, 94, 130, 165, 201, 33, 163, 234,
-    252, 166, 160, 63, 170, 84, 75, 138, 41, 94, 196, 128, 173, 94, 26, 108, 98, 0, 34, 138, 219, 23, 248, 120, 1, 212,
-    217, 110, 143, 92, 1, 180, 233, 234, 211, 52, 113, 117, 187, 120, 49, 190, 84, 42, 92, 137, 140, 17, 70, 216, 160,
-    4, 148, 174, 127, 78, 149, 17, 51, 236, 124, 65, 217, 160, 133, 114, 49, 248, 237, 6, 81, 3, 219, 115, 225, 47, 11,
-    189, 189, 128, 214, 29, 68, 19, 16, 24, 43, 74, 78, 242, 116, 59, 68, 219, 27, 23, 247, 62, 20, 242, 113, 33, 210,
-    29, 143, 107, 86, 8, 16, 83, 75, 5, 220, 71, 213, 126, 170, 205, 15, 115, 9, 102, 211, 207, 98, 216, 150, 249, 204,
-    213, 220, 66, 24, 231, 105, 26, 218, 254, 116, 198, 139, 176, 121, 222, 234, 184, 87, 14, 130, 75, 38, 119, 186,
-    229, 4, 124, 139, 176, 192, 71, 17, 106, 140, 0, 209, 227, 200, 174, 9, 162, 82, 185, 82, 254, 11, 163, 199, 178,
-    165, 7, 164, 88, 160, 25, 251, 95, 100, 225, 153, 25, 211, 218, 141, 68, 28, 16, 249, 37, 30, 220, 73, 34, 130, 217,
-    161, 223, 118, 38, 139, 128, 245, 142, 119, 12, 2, 227, 8, 84, 195, 223, 88, 201, 27, 27, 99, 31, 176, 35, 18, 46,
-    58, 180, 116, 245, 171, 249, 13, 68, 43, 181, 4, 219, 5, 236, 249, 29, 112, 132, 51, 6, 162, 110, 138, 30, 43, 241,
-    183, 138, 224, 15, 233, 196, 202, 71, 225, 249, 15, 207, 251, 145, 248, 218, 208, 32, 184, 223, 216, 254, 183, 1,
-    32, 234, 184, 154, 149, 194, 245, 112, 245, 61, 164, 29, 10, 75, 4, 216, 201, 130, 119, 110, 111, 176, 245, 66, 69,
-    195, 229, 242, 132, 141, 214, 82, 86, 26, 128, 62, 14, 89, 38, 185, 113, 111, 254, 35, 245, 138, 125, 202, 190, 77,
-    121, 11, 105, 155, 2, 230, 253, 25, 122, 237, 250, 34, 70, 56, 96, 240, 177, 117, 42, 18, 227, 229, 113, 210, 57,
-    209, 216, 75, 27, 60, 96, 194, 215, 225, 24, 210, 140, 78, 212, 207, 186, 84, 110, 181, 253, 124, 254, 127, 190, 39,
-    99, 3, 184, 53, 224, 22, 5, 143, 154, 147, 79, 58, 132, 151, 81, 173, 180, 76, 18, 64, 112, 133, 87, 16, 94, 213,
-    207, 51, 56, 172, 182, 138, 231, 197, 202, 213, 52, 156, 197, 192, 183, 76, 127, 118, 255, 56, 230, 33, 153, 201,
-    233, 40, 30, 50, 15, 131, 168, 125, 214, 146, 247, 93, 189, 152, 99, 132, 25, 190, 148, 232, 112, 148, 57, 102, 98,
-    118, 27, 99, 89, 109, 155, 21, 86, 152, 209, 115, 132, 43, 43, 182, 210, 15, 107, 143, 148, 138, 213, 124, 209, 239,
-    112, 171, 99, 85, 168, 95, 52, 28, 151, 12, 202, 75, 252, 195, 215, 226, 16, 212, 15, 65, 117, 192, 201, 2, 109, 32,
-    61, 225, 28, 130, 153, 194, 159, 63, 115, 116, 143, 231, 22, 54, 199, 216, 10, 233, 82, 204, 38, 7, 113, 221, 8,
-    129, 233, 240, 88, 232, 157, 10, 148, 33, 141, 2, 225, 115, 111, 101, 195, 191, 84, 154, 191, 135, 229, 203, 16, 15,
-    117, 111, 114, 248, 219, 171, 72, 242, 201, 90, 75, 170, 19, 113, 94, 55, 233, 127, 153, 51, 246, 142, 200, 196,
-    153, 179, 177, 198, 29, 104, 23, 125, 168, 169, 108, 40, 161, 203, 20, 123, 73, 37, 110, 219, 87, 127, 85, 245, 12,
-    195, 49, 132, 232, 251, 143, 186, 145, 129, 1, 47, 3, 124, 166, 236, 226, 108, 92, 222, 242, 246, 246, 46, 48, 183,
-    117, 56, 149, 53, 22, 92, 237, 124, 11, 36, 52, 29, 116, 68, 175, 18, 4, 221, 144, 65, 236, 118, 191, 76, 72, 73,
-    90, 113, 30, 149, 68, 1, 29, 52, 245, 189, 106, 227, 19, 47, 208, 24, 57, 157, 29, 103, 179, 115, 136, 148, 200,
-    192, 249, 125, 9, 91, 76, 100, 177, 178, 99, 164, 108, 101, 6, 245, 240, 205, 86, 157, 21, 130, 14, 115, 213, 250,
-    253, 122, 88, 204, 15, 94, 126, 189, 188, 212, 239, 138, 37, 109, 190, 97, 158, 199, 222, 18, 214, 79, 139, 158, 7,
-    209, 120, 176, 241, 246, 168, 138, 114, 157, 241, 61, 135, 236, 208, 50, 87, 225, 121, 19, 57, 228, 167, 202, 40,
-    13, 78, 166, 32, 11, 171, 200, 9, 104, 33, 24, 243, 123, 43, 25, 56, 123, 145, 214, 53, 233, 44, 241, 51, 98, 227,
-    230, 215, 215, 75, 170, 178, 143, 25, 152, 140, 246, 154, 100, 228, 120, 207, 145, 161, 48, 228, 8, 150, 152, 183,
-    128, 84, 204, 183, 184, 148, 142, 216, 219, 27, 101, 35, 190, 223, 60, 228, 114, 253, 150, 111, 44, 129, 226, 234,
-    85, 138, 221, 62, 52, 132, 198, 23, 195, 220, 85, 44, 99, 149, 84, 142, 43, 104, 231, 135, 36, 197, 55, 29, 172,
-    102, 252, 17, 1, 19, 194, 216, 214, 115, 145, 222, 73, 106, 8, 44, 235, 68, 87, 249, 214, 125, 94, 247, 188, 140,
-    174, 24, 83, 82, 204, 6, 206, 82, 8, 101, 132, 202, 226, 154, 13, 120, 214, 134, 252, 21, 136, 91, 224, 29, 63, 254,
-    176, 155, 49, 96, 54, 226, 40, 230, 171, 180, 20, 136, 147, 190, 28, 255, 173, 96, 70, 108, 242, 144, 248, 30, 240,
-    20, 58, 24, 214, 124, 85, 6, 91, 6, 5, 49, 236, 60, 137, 118, 185, 119, 100, 94, 12, 177, 106, 31, 45, 65, 27, 242,
-    204, 112, 237, 85, 129, 86, 17, 38, 237, 44, 144, 247, 8, 176, 196, 79, 79, 109, 56, 59, 85, 96, 128, 170, 136, 27,
-    76, 95, 213, 237, 5, 96, 39, 159, 3, 158, 243, 81, 104, 15, 202, 8, 134, 19, 96, 77, 17, 251, 238, 95, 193, 107, 78,
-    233, 55, 161, 18, 21, 0, 241, 192, 43, 209, 99, 237, 96, 229, 13, 242, 83, 62, 93, 120, 228, 127, 112, 172, 186, 50,
-    9, 206, 96, 50, 228, 161, 156, 253, 24, 156, 203, 24, 235, 223, 34, 36, 129, 107, 119, 108, 201, 229, 46, 221, 137,
-    172, 166, 155, 196, 47, 61, 147, 107, 16, 117, 132, 153, 244, 148, 128, 181, 231, 190, 192, 160, 25, 174, 100, 66,
-    112, 126, 140, 138, 19, 176, 128, 225, 172, 207, 30, 21, 96, 161, 189, 141, 5, 164, 183, 36, 151, 180, 92, 163, 61,
-    192, 3, 104, 206, 208, 69, 113, 227, 6, 99, 179, 153, 126, 15, 11, 97, 112, 50, 252, 114, 34, 226, 88, 14, 70, 133,
-    178, 138, 173, 237, 150, 67, 83, 53, 73, 98, 199, 197, 189, 1, 83, 179, 68, 124, 252, 75, 194, 145, 65, 66, 236, 59,
-    163, 88, 128, 144, 0, 48, 253, 28, 227, 55, 112, 69, 177, 255, 49, 166, 86, 239, 138, 87, 80, 228, 247, 231, 224,
-    69, 159, 43, 47, 214, 227, 156, 176, 13, 51, 213, 82, 208, 93, 209, 171, 169, 105, 31, 235, 39, 243, 154, 60, 14,
-    236, 66, 237, 99, 36, 63, 185, 139, 99, 189, 92, 186, 219, 106, 232, 254, 243, 184, 67, 45, 30, 253, 71, 44, 47,
-    207, 28, 57, 92, 126, 64, 214, 253, 219, 207, 186, 35, 43, 85, 30, 160, 17, 56, 21, 155, 253, 192, 202, 127, 52,
-    251, 145, 59, 200, 19, 164, 70, 38, 13, 27, 128, 120, 135, 150, 82, 68, 4, 169, 34, 118, 104, 62, 243, 137, 124,
-    201, 127, 1, 155, 23, 75, 153, 17, 126, 90, 34, 18, 30, 144, 43, 112, 232, 37, 144, 15, 186, 180, 227, 100, 110,
-    117, 34, 92, 104, 17, 57, 8, 191, 14, 109, 105, 57, 34, 30, 71, 20, 237, 55, 114, 208, 47, 64, 185, 103, 122, 105,
-    182, 226, 48, 38, 189, 207, 180, 113, 90, 117, 168, 2, 43, 50, 158, 122, 93, 123, 39, 215, 95, 128, 51, 42, 229, 66,
-    58, 125, 154, 189, 104, 151, 169, 14, 215, 80, 109, 16, 27, 239, 201, 189, 121, 218, 134, 41, 206, 254, 130, 60, 48,
-    24, 23, 92, 187, 125, 188, 110, 231, 186, 185, 157, 28, 86, 105, 149, 235, 254, 78, 148, 118, 117, 147, 101, 52,
-    204, 111, 187, 242, 255, 59, 155, 137, 76, 239, 253, 132, 209, 91, 10, 41, 248, 94, 145, 176, 133, 26, 84, 158, 255,
-    245, 207, 196, 20, 181, 137, 153, 40, 208, 144, 84, 140, 13, 16, 12, 189, 187, 189, 155, 163, 164, 92, 14, 96, 22,
-    213, 239, 255, 220, 66, 33, 158, 169, 5, 197, 148, 146, 195, 174, 89, 205, 112, 216, 151, 10, 93, 20, 0, 248, 192,
-    211, 94, 104, 104, 45, 52, 93, 202, 203, 208, 221, 115, 94, 174, 28, 244, 36, 231, 7, 136, 31, 91, 123, 214, 118,
-    53, 186, 204, 233, 209, 149, 8, 135, 70, 95, 195, 45, 118, 1, 42, 142, 130, 226, 153, 163, 173, 141, 235, 225, 195,
-    19, 65, 246, 153, 75, 188, 99, 41, 63, 208, 112, 35, 81, 158, 254, 40, 3, 115, 142, 135, 60, 227, 233, 177, 198, 74,
-    48, 131, 147, 102, 25, 189, 223, 253, 204, 35, 101, 193, 146, 43, 46, 152, 7, 140, 108, 166, 202, 222, 88, 86, 40,
-    14, 215, 227, 201, 141, 206, 250, 229, 107, 20, 102, 81, 241, 193, 55, 159, 158, 35, 126, 203, 9, 181, 101, 225, 28,
-    63, 74, 10, 213, 238, 59, 25, 21, 119, 160, 91, 49, 14, 224, 128, 121, 18, 83, 119, 27, 209, 43, 49, 3, 46, 194,
-    193, 39, 118, 3, 226, 170, 211, 129, 209, 109, 118, 254, 252, 98, 151, 195, 95, 19, 7, 232, 97, 181, 6, 96, 115, 87,
-    205, 56, 231, 231, 153, 191, 94, 202, 96, 19, 248, 93, 127, 8, 133, 147, 85, 45, 119, 132, 10, 131, 125, 68, 190,
-    234, 118, 46, 243, 88, 247, 17, 38, 122, 150, 206, 150, 31, 216, 201, 69, 57, 186, 184, 64, 137, 8, 56, 136, 104,
-    92, 90, 216, 10, 91, 103, 110, 238, 32, 64, 10, 100, 153, 133, 138, 186, 108, 144, 119, 41, 148, 83, 100, 124, 41,
-    207, 212, 181, 17, 212, 111, 63, 6, 148, 15, 118, 84, 49, 229, 120, 225, 187, 60, 184, 181, 217, 203, 235, 207, 34,
-    248, 164, 168, 79, 100, 171, 188, 127, 0, 243, 107, 165, 181, 238, 147, 193, 107, 57, 85, 251, 52, 13, 225, 121,
-    181, 107, 224, 23, 73, 133, 67, 27, 34, 28, 132, 2, 204, 47, 217, 36, 112, 21, 140, 176, 94, 202, 213, 210, 42, 140,
-    41, 180, 187, 99, 58, 60, 229, 230, 70, 44, 158, 135, 19, 196, 239, 150, 195, 35, 67, 159, 117, 135, 74, 213, 39,
-    187, 16, 54, 75, 179, 154, 193, 92, 179, 130, 113, 191, 235, 168, 104, 112, 35, 223, 192, 115, 241, 29, 201, 33, 17,
-    57, 184, 31, 242, 146, 92, 39, 195, 249, 167, 173, 48, 203, 164, 205, 217, 208, 148, 243, 190, 33, 172, 133, 0, 56,
-    10, 239, 132, 195, 192, 94, 201, 13, 122, 244, 179, 47, 105, 179, 76, 177, 104, 4, 70, 137, 67, 252, 151, 164, 209,
-    204, 210, 48, 105, 47, 212, 198, 211, 216, 244, 126, 211, 154, 179, 153, 176, 250, 183, 3, 129, 155, 144, 124, 98,
-    95, 67, 39, 63, 88, 59, 164, 157, 62, 72, 249, 252, 174, 205, 116, 140, 121, 39, 235, 120, 191, 88, 141, 108, 221,
-    131, 26, 184, 120, 247, 234, 101, 142, 3, 3, 252, 53, 75, 146, 45, 41, 242, 251, 222, 69, 53, 132, 161, 108, 44, 8,
-    224, 79, 24, 28, 202, 219, 12, 188, 138, 122, 142, 231, 17, 215, 7, 220, 248, 223, 236, 219, 220, 104, 27, 36, 84,
-    249, 176, 112, 219, 71, 249, 111, 222, 127, 66, 163, 227, 73, 247, 107, 116, 20, 221, 69, 177, 115, 63, 206, 165,
-    194, 42, 158, 59, 158, 88, 107, 147, 244, 184, 160, 73, 84, 19, 165, 106, 23, 195, 200, 240, 238, 153, 102, 13, 156,
-    70, 202, 163, 98, 168, 223, 220, 105, 250, 109, 139, 238, 233, 123, 40, 205, 65, 90, 117, 43, 93, 29, 66, 188, 52,
-    251, 158, 127, 244, 185, 55, 69, 92, 184, 83, 135, 60, 165, 255, 153, 215, 94, 95, 225, 34, 94, 76, 251, 158, 219,
-    177, 143, 105, 26, 124, 75, 48, 218, 137, 252, 141, 65, 121, 97, 146, 189, 238, 139, 80, 212, 74, 137, 150, 93, 65,
-    33, 238, 27, 138, 239, 211, 93, 83, 31, 243, 200, 165, 69, 255, 252, 135, 143, 104, 242, 101, 2, 102, 234, 135, 106,
-    226, 158, 182, 232, 231, 248, 143, 76, 226, 61, 116, 33, 193, 172, 195, 106, 202, 76, 71, 93, 139, 22, 1, 61, 32,
-    39, 79, 189, 211, 206, 129, 192, 214, 77, 141, 33, 153, 98, 48, 201, 175, 165, 241, 39, 167, 35, 228, 202, 26, 72,
-    181, 82, 215, 225, 168, 41, 196, 30, 23, 108, 223, 127, 235, 32, 35, 219, 246, 57, 103, 29, 47, 235, 163, 134, 122,
-    207, 117, 54, 3, 126, 218, 22, 189, 163, 28, 73, 229, 230, 43, 97, 55, 200, 232, 45, 204, 153, 213, 46, 87, 154,
-    106, 223, 148, 104, 189, 38, 200, 91, 22, 145, 98, 165, 72, 250, 244, 76, 173, 18, 28, 198, 115, 161, 215, 112, 59,
-    31, 145, 242, 203, 127, 141, 23, 128, 32, 148, 193, 17, 153, 7, 168, 135, 240, 153, 174, 179, 27, 6, 224, 93, 48,
-    92, 118, 222, 136, 118, 132, 111, 136, 110, 98, 254, 71, 175, 23, 94, 12, 159, 152, 28, 224, 87, 62, 81, 199, 151,
-    252, 0, 4, 0, 211, 89, 10, 103, 146, 247, 181, 178, 137, 28, 86, 130, 163, 166, 44, 184, 218, 85, 66, 210, 96, 80,
-    209, 48, 197, 172, 162, 181, 8, 128, 249, 215, 13, 87, 124, 210, 139, 130, 223, 137, 153, 62, 119, 23, 197, 93, 115,
-    32, 56, 49, 114, 185, 97, 108, 129, 185, 254, 199, 95, 16, 105, 246, 80, 249, 97, 28, 13, 61, 133, 39, 108, 55, 248,
-    113, 69, 182, 234, 21, 149, 144, 214, 221, 126, 136, 152, 135, 240, 59, 107, 65, 131, 192, 218, 135, 192, 124, 38,
-    12, 194, 177, 139, 59, 38, 129, 80, 96, 126, 34, 45, 150, 69, 0, 77, 107, 177, 250, 222, 232, 82, 92, 56, 242, 200,
-    133, 192, 30, 96, 6, 0, 19, 71, 65, 209, 86, 215, 112, 63, 161, 71, 207, 0, 38, 29, 58, 56, 9, 92, 148, 157, 180,
-    249, 141, 254, 84, 36, 0, 7, 186, 208, 226, 113, 94, 19, 154, 137, 240, 231, 154, 23, 115, 253, 67, 231, 52, 165,
-    228, 163, 37, 224, 254, 246, 182, 161, 38, 125, 49, 44, 19, 167, 65, 113, 156, 58, 140, 253, 95, 122, 84, 171, 240,
-    13, 29, 34, 135, 32, 130, 195, 219, 151, 33, 128, 91, 212, 141, 98, 202, 21, 87, 159, 97, 138, 127, 180, 186, 69,
-    84, 206, 63, 127, 73, 220, 87, 225, 33, 194, 50, 167, 178, 225, 188, 233, 8, 153, 30, 6, 65, 3, 11, 188, 224, 62,
-    179, 55, 90, 250, 118, 140, 107, 6, 191, 23, 99, 169, 190, 189, 56, 236, 238, 117, 73, 42, 31, 155, 218, 121, 45,
-    36, 176, 113, 56, 164, 71, 103, 0, 18, 7, 70, 156, 162, 130, 41, 8, 9, 199, 171, 139, 188, 15, 81, 227, 135, 68,
-    143, 135, 203, 244, 225, 129, 29, 136, 157, 153, 14, 52, 85, 131, 23, 89, 95, 175, 100, 86, 42, 17, 131, 26, 134,
-    87, 120, 122, 234, 95, 107, 198, 147, 89, 73, 7, 110, 254, 208, 155, 12, 192, 58, 155, 177, 169, 67, 47, 136, 247,
-    176, 4, 28, 17, 180, 133, 40, 241, 72, 83, 237, 81, 122, 45, 220, 233, 246, 255, 137, 228, 54, 225, 122, 87, 190,
-    187, 44, 96, 205, 84, 53, 17, 55, 153, 216, 98, 236, 62, 249, 35, 74, 2, 130, 244, 215, 6, 3, 118, 196, 21, 223,
-    209, 194, 72, 133, 121, 232, 122, 153, 3, 239, 197, 200, 198, 126, 73, 79, 247, 169, 129, 248, 58, 86, 128, 196, 36,
-    92, 157, 175, 132, 162, 144, 40, 197, 164, 74, 205, 149, 150, 116, 218, 174, 246, 229, 71, 250, 184, 166, 100, 206,
-    118, 150, 92, 161, 100, 255, 40, 172, 230, 59, 21, 198, 40, 161, 227, 218, 98, 85, 93, 98, 17, 40, 221, 230, 54, 30,
-    143, 250, 159, 187, 172, 254, 133, 202, 198, 146, 136, 204, 8, 199, 130, 153, 38, 33, 8, 219, 216, 159, 183, 47,
-    152, 21, 249, 13, 70, 166, 254, 42, 44, 145, 159, 225, 132, 205, 167, 99, 209, 91, 130, 7, 206, 59, 92, 22, 39, 25,
-    117, 176, 251, 240, 143, 107, 150, 118, 89, 206, 177, 84, 36, 74, 248, 33, 8, 163, 232, 59, 16, 109, 93, 243, 165,
-    94, 134, 18, 218, 45, 112, 2, 227, 81, 188, 111, 83, 202, 53, 78, 68, 29, 7, 149, 195, 231, 68, 158, 53, 213, 74,
-    21, 147, 241, 213, 176, 167, 139, 104, 210, 82, 82, 139, 237, 54, 11, 128, 21, 42, 117, 37, 144, 189, 142, 157, 34,
-    114, 150, 60, 162, 214, 66, 247, 246, 60, 243, 17, 51, 249, 25, 101, 85, 137, 67, 196, 144, 117, 119, 247, 182, 124,
-    9, 232, 226, 208, 189, 178, 247, 108, 72, 62, 131, 191, 183, 115, 87, 34, 11, 164, 97, 167, 201, 34, 31, 77, 87,
-    113, 113, 142, 176, 71, 215, 237, 235, 255, 116, 41, 88, 176, 52, 249, 27, 157, 168, 133, 254, 58, 75, 253, 154,
-    128, 199, 144, 108, 226, 198, 100, 250, 150, 103, 2, 192, 28, 86, 52, 68, 31, 174, 194, 125, 83, 76, 202, 212, 67,
-    43, 225, 223, 50, 24, 56, 213, 225, 131, 144, 34, 5, 148, 89, 221, 228, 189, 127, 138, 211, 164, 134, 159, 175, 199,
-    117, 6, 8, 133, 47, 52, 236, 0, 178, 224, 236, 251, 38, 27, 175, 60, 59, 115, 148, 251, 223, 225, 116, 233, 45, 225,
-    227, 118, 47, 53, 81, 63, 199, 232, 95, 6, 145, 40, 255, 74, 179, 69, 206, 41, 236, 28, 0, 140, 169, 175, 242, 230,
-    239, 5, 245, 107, 151, 245, 44, 150, 46, 78, 19, 122, 135, 138, 96, 251, 180, 105, 243, 191, 165, 133, 173, 209, 44,
-    161, 140, 106, 85, 12, 55, 189, 20, 1, 245, 160, 168, 29, 48, 129, 247, 202, 84, 168, 17, 109, 138, 225, 0, 151, 80,
-    151, 233, 81, 2, 131, 94, 112, 180, 3, 4, 2, 89, 111, 219, 64, 117, 41, 3, 236, 140, 49, 104, 129, 255, 17, 86, 135,
-    238, 229, 90, 243, 61, 172, 185, 22, 217, 237, 174, 202, 185, 20, 79, 86, 50, 21, 242, 54, 54, 196, 45, 224, 148, 6,
-    168, 0, 143, 220, 97, 28, 145, 76, 51, 242, 234, 254, 178, 155, 174, 184, 249, 180, 172, 150, 103, 138, 101, 21, 9,
-    28, 238, 80, 6, 75, 122, 216, 220, 96, 145, 234, 75, 123, 144, 124, 55, 177, 241, 93, 160, 127, 204, 87, 230, 148,
-    213, 30, 113, 103, 126, 235, 36, 60, 110, 63, 233, 128, 100, 135, 127, 117, 36, 213, 190, 241, 109, 92, 43, 91, 30,
-    106, 96, 202, 94, 1, 47, 18, 80, 174, 149, 33, 141, 66, 204, 6, 80, 77, 228, 30, 8, 6, 232, 115, 139, 178, 155, 182,
-    93, 17, 131, 187, 39, 216, 203, 18, 115, 32, 4, 121, 216, 132, 62, 255, 136, 163, 217, 223, 90, 227, 228, 152, 93,
-    36, 48, 184, 105, 104, 160, 72, 158, 55, 230, 195, 24, 253, 37, 129, 143, 167, 237, 183, 147, 36, 68, 99, 10, 187,
-    85, 80, 147, 38, 58, 198, 68, 47, 211, 213, 152, 171, 144, 138, 188, 232, 21, 95, 58, 100, 84, 53, 207, 34, 173, 50,
-    47, 184, 90, 241, 140, 72, 15, 226, 105, 54, 57, 169, 38, 27, 128, 185, 184, 249, 189, 106, 97, 21, 61, 245, 216,
-    149, 70, 223, 140, 65, 80, 150, 233, 95, 182, 247, 140, 154, 101, 108, 28, 51, 50, 251, 1, 31, 85, 118, 209, 206,
-    181, 199, 226, 129, 76, 94, 181, 223, 199, 57, 41, 73, 22, 226, 238, 20, 209, 120, 122, 64, 197, 198, 12, 97, 60,
-    22, 223, 149, 218, 241, 209, 83, 228, 251, 148, 21, 106, 206, 147, 62, 197, 251, 189, 163, 163, 13, 136, 250, 120,
-    29, 43, 214, 152, 44, 94, 13, 227, 209, 90, 60, 167, 162, 8, 207, 162, 138, 128, 195, 59, 14, 102, 20, 2, 60, 247,
-    164, 126, 133, 45, 133, 94, 36, 53, 165, 214, 242, 63, 5, 167, 184, 71, 35, 6, 22, 50, 28, 151, 126, 92, 185, 167,
-    223, 187, 108, 177, 60, 91, 224, 178, 242, 45, 32, 224, 190, 159, 176, 32, 204, 27, 82, 11, 105, 72, 97, 169, 66,
-    217, 239, 150, 238, 246, 62, 235, 132, 230, 121, 32, 213, 189, 58, 111, 224, 135, 195, 101, 54, 0, 197, 186, 82, 0,
-    154, 208, 125, 173, 48, 41, 52, 250, 0, 185, 86, 54, 237, 189, 16, 70, 66, 174, 32, 78, 28, 86, 12, 251, 114, 74,
-    17, 30, 198, 204, 218, 141, 149, 52, 203, 136, 194, 136, 215, 153, 25, 214, 136, 129, 236, 224, 218, 8, 202, 125,
-    118, 83, 189, 151, 53, 56, 126, 15, 14, 172, 42, 123, 214, 86, 113, 198, 7, 141, 76, 10, 65, 127, 246, 86, 94, 94,
-    43, 212, 144, 226, 75, 56, 106, 39, 192, 74, 20, 36, 137, 9, 189, 101, 127, 89, 191, 159, 156, 135, 200, 194, 154,
-    195, 106, 132, 30, 123, 12, 255, 200, 158, 40, 83, 233, 202, 233, 140, 208, 247, 96, 151, 249, 29, 16, 161, 3, 95,
-    221, 199, 189, 33, 132, 13, 95, 242, 196, 145, 83, 42, 93, 55, 11, 154, 7, 102, 125, 66, 147, 161, 130, 68, 194, 68,
-    44, 133, 215, 133, 176, 112, 248, 99, 200, 55, 134, 255, 91, 177, 247, 47, 14, 43, 224, 245, 165, 16, 71, 98, 186,
-    84, 130, 185, 237, 236, 87, 81, 192, 89, 87, 204, 81, 68, 99, 3, 13, 122, 17, 127, 78, 69, 171, 244, 211, 186, 58,
-    192, 53, 136, 235, 156, 163, 218, 24, 58, 66, 87, 26, 201, 29, 94, 155, 84, 152, 235, 157, 148, 216, 144, 232, 95,
-    241, 229, 206, 249, 36, 73, 120, 182, 81, 80, 38, 91, 185, 46, 108, 33, 131, 249, 165, 55, 230, 236, 105, 80, 43,
-    93, 234, 195, 219, 81, 104, 93, 26, 151, 17, 171, 205, 54, 48, 250, 205, 32, 44, 67, 64, 91, 55, 48, 45, 186, 163,
-    65, 70, 144, 48, 1, 16, 201, 50, 215, 50, 172, 146, 54, 135, 226, 60, 71, 115, 11, 47, 167, 240, 203, 215, 42, 254,
-    251, 175, 123, 148, 255, 160, 241, 109, 249, 126, 70, 76, 52, 33, 211, 14, 156, 213, 15, 34, 236, 253, 187, 185,
-    230, 67, 131, 239, 59, 78, 195, 125, 28, 117, 209, 172, 199, 173, 5, 185, 38, 154, 143, 238, 230, 133, 106, 192, 41,
-    65, 60, 174, 156, 37, 9, 126, 10, 249, 187, 137, 29, 202, 196, 28, 51, 187, 102, 76, 66, 7, 34, 208, 14, 31, 99,
-    220, 254, 118, 18, 164, 187, 163, 144, 76, 46, 239, 182, 184, 231, 201, 7, 118, 114, 58, 229, 177, 229, 184, 222,
-    121, 139, 226, 170, 237, 44, 242, 185, 92, 101, 180, 12, 106, 162, 130, 171, 162, 254, 68, 80, 124, 128, 141, 146,
-    163, 21, 68, 45, 125, 11, 98, 119, 96, 113, 81, 46, 123, 134, 254, 1, 179, 135, 22, 205, 16, 87, 190, 254, 13, 83,
-    240, 14, 48, 22, 244, 52, 201, 219, 162, 204, 106, 55, 29, 33, 147, 90, 186, 139, 151, 71, 178, 16, 194, 100, 54,
-    75, 13, 204, 193, 239, 72, 63, 48, 31, 210, 219, 80, 62, 81, 193, 73, 99, 136, 65, 17, 77, 164, 204, 129, 27, 91,
-    141, 178, 76, 242, 62, 227, 96, 178, 10, 156, 162, 253, 196, 106, 63, 219, 103, 76, 26, 83, 137, 60, 18, 35, 94,
-    232, 182, 181, 218, 41, 177, 143, 41, 67, 31, 246, 149, 130, 230, 114, 121, 2, 187, 7, 55, 84, 150, 40, 29, 192,
-    110, 142, 213, 240, 196, 166, 69, 226, 100, 138, 0, 234, 213, 15, 195, 128, 213, 20, 159, 148, 187, 14, 191, 217,
-    181, 68, 47, 140, 192, 86, 57, 185, 119, 135, 59, 169, 79, 186, 188, 18, 168, 227, 41, 157, 75, 203, 144, 179, 140,
-    47, 35, 29, 80, 224, 116, 7, 26, 95, 141, 213, 220, 223, 29, 107, 55, 156, 77, 216, 24, 46, 76, 0, 99, 12, 36, 153,
-    3, 14, 53, 51, 195, 126, 220, 144, 83, 214, 198, 123, 183, 241, 87, 71, 151, 99, 172, 245, 176, 147, 207, 19, 160,
-    184, 157, 85, 184, 79, 164, 94, 144, 226, 253, 5, 17, 144, 86, 205, 229, 110, 224, 64, 52, 200, 89, 54, 158, 162,
-    110, 237, 53, 187, 118, 16, 182, 227, 143, 40, 151, 38, 225, 115, 202, 167, 213, 194, 55, 86, 116, 120, 217, 215,
-    190, 75, 250, 147, 1, 210, 25, 136, 157, 8, 151, 128, 177, 74, 124, 30, 29, 171, 203, 0, 178, 184, 198, 142, 49, 2,
-    164, 14, 152, 36, 217, 163, 252, 71, 101, 24, 127, 62, 55, 105, 252, 243, 211, 243, 36, 21, 91, 3, 3, 3, 90, 247,
-    80, 90, 252, 89, 36, 37, 115, 141, 84, 215, 62, 8, 181, 170, 192, 110, 174, 90, 166, 83, 248, 181, 246, 30, 4, 131,
-    85, 235, 102, 150, 28, 109, 63, 77, 148, 225, 247, 94, 33, 133, 120, 4, 107, 79, 176, 136, 200, 97, 131, 120, 135,
-    148, 35, 35, 74, 48, 120, 249, 74, 90, 116, 90, 76, 47, 250, 44, 167, 159, 207, 72, 160, 126, 29, 188, 195, 102,
-    174, 49, 83, 208, 74, 226, 97, 3, 250, 53, 113, 151, 63, 231, 11, 176, 114, 137, 203, 106, 117, 189, 63, 55, 30,
-    186, 132, 1, 239, 146, 180, 38, 16, 54, 163, 8, 38, 237, 121, 98, 83, 215, 15, 240, 243, 197, 33, 145, 143, 50, 104,
-    30, 31, 132, 134, 104, 138, 101, 234, 3, 189, 172, 31, 96, 155, 209, 40, 154, 80, 39, 241, 174, 240, 18, 220, 152,
-    231, 128, 244, 104, 112, 181, 38, 57, 233, 114, 32, 30, 29, 60, 243, 34, 45, 157, 111, 36, 98, 248, 124, 249, 205,
-    235, 172, 23, 251, 103, 74, 72, 47, 83, 84, 93, 45, 90, 108, 7, 50, 227, 56, 37, 1, 11, 89, 190, 231, 122, 187, 82,
-    116, 202, 230, 179, 242, 42, 48, 177, 142, 56, 20, 42, 74, 166, 97, 82, 225, 20, 243, 244, 126, 97, 133, 25, 182,
-    15, 104, 173, 209, 212, 154, 139, 61, 103, 175, 167, 62, 251, 174, 151, 170, 210, 99, 60, 112, 17, 49, 241, 130, 58,
-    187, 213, 83, 161, 133, 23, 255, 209, 20, 232, 216, 68, 246, 219, 239, 66, 100, 254, 7, 40, 78, 186, 69, 250, 37,
-    97, 98, 151, 25, 76, 47, 207, 114, 102, 55, 230, 240, 55, 169, 95, 85, 94, 3, 171, 9, 25, 155, 68, 112, 107, 21,
-    135, 232, 73, 201, 181, 149, 18, 54, 70, 86, 148, 173, 89, 87, 17, 3, 194, 85, 58, 156, 38, 182, 96, 13, 146, 36,
-    204, 141, 229, 117, 58, 166, 107, 78, 171, 121, 70, 231, 241, 3, 187, 169, 254, 248, 140, 7, 218, 78, 30, 151, 199,
-    10, 235, 211, 101, 123, 172, 36, 225, 48, 135, 103, 105, 224, 56, 125, 244, 168, 162, 215, 83, 116, 100, 145, 161,
-    223, 105, 185, 12, 20, 15, 246, 221, 117, 246, 91, 60, 13, 57, 9, 131, 221, 147, 102, 244, 78, 195, 49, 189, 138,
-    69, 176, 138, 146, 240, 82, 153, 64, 232, 223, 254, 227, 195, 139, 230, 88, 137, 16, 168, 92, 68, 191, 154, 30, 184,
-    54, 62, 129, 28, 230, 17, 134, 60, 47, 3, 240, 11, 224, 206, 130, 39, 57, 31, 248, 220, 188, 172, 81, 222, 3, 0,
-    243, 175, 189, 182, 181, 144, 129, 206, 166, 106, 243, 202, 65, 64, 228, 90, 55, 1, 189, 62, 110, 163, 153, 21, 54,
-    200, 206, 138, 60, 103, 19, 56, 111, 83, 207, 160, 123, 244, 31, 201, 148, 178, 182, 176, 103, 242, 8, 104, 31, 32,
-    106, 147, 247, 0, 55, 90, 33, 100, 150, 60, 30, 215, 190, 54, 118, 113, 189, 63, 6, 231, 238, 248, 86, 216, 160,
-    220, 114, 56, 7, 167, 225, 14, 255, 57, 166, 167, 15, 120, 149, 244, 110, 238, 146, 183, 238, 157, 96, 135, 230,
-    200, 81, 141, 206, 213, 97, 91, 42, 25, 119, 3, 255, 23, 37, 108, 146, 44, 227, 218, 53, 171, 211, 204, 119, 21,
-    158, 34, 165, 174, 220, 135, 95, 40, 209, 164, 255, 165, 137, 226, 159, 236, 121, 34, 241, 150, 254, 52, 243, 211,
-    187, 183, 3, 102, 43, 187, 128, 41, 93, 86, 244, 233, 17, 70, 230, 97, 122, 149, 171, 145, 98, 242, 22, 185, 165,
-    230, 155, 37, 5, 132, 148, 173, 205, 244, 227, 163, 27, 45, 2, 164, 200, 102, 126, 188, 244, 242, 213, 247, 223,
-    157, 126, 118, 207, 224, 43, 129, 124, 252, 58, 222, 20, 53, 240, 115, 196, 168, 64, 34, 62, 173, 176, 74, 141, 206,
-    239, 227, 79, 12, 141, 21, 84, 63, 85, 71, 158, 178, 240, 247, 230, 197, 158, 8, 49, 3, 195, 33, 18, 195, 101, 15,
-    80, 67, 92, 124, 179, 141, 169, 221, 230, 104, 236, 63, 233, 231, 211, 110, 227, 240, 129, 205, 209, 179, 204, 70,
-    215, 153, 31, 56, 76, 45, 97, 123, 150, 255, 112, 59, 137, 175, 4, 0, 5, 50, 74, 71, 54, 74, 207, 239, 70, 216, 120,
-    157, 110, 58, 149, 202, 254, 36, 208, 210, 133, 33, 201, 152, 229, 228, 248, 29, 35, 156, 157, 54, 54, 172, 42, 143,
-    64, 68, 146, 30, 110, 94, 219, 253, 111, 217, 119, 197, 48, 118, 102, 92, 167, 229, 61, 24, 62, 101, 19, 8, 245, 73,
-    27, 165, 188, 133, 93, 131, 30, 113, 164, 216, 87, 176, 189, 252, 108, 3, 37, 238, 51, 174, 212, 121, 8, 203, 39,
-    22, 188, 120, 11, 69, 165, 109, 240, 131, 144, 139, 172, 241, 252, 152, 190, 174, 41, 245, 109, 194, 102, 130, 120,
-    112, 68, 50, 228, 185, 219, 186, 97, 50, 144, 160, 16, 69, 81, 173, 38, 45, 15, 44, 250, 147, 240, 120, 119, 58,
-    201, 24, 18, 162, 200, 150, 156, 211, 77, 20, 187, 201, 204, 143, 86, 18, 188, 150, 10, 238, 73, 142, 108, 137, 99,
-    179, 53, 241, 188, 17, 81, 159, 103, 36, 167, 236, 196, 69, 184, 246, 46, 18, 127, 196, 118, 97, 103, 164, 190, 21,
-    100, 73, 194, 19, 177, 229, 75, 50, 49, 35, 228, 20, 252, 222, 148, 192, 180, 132, 14, 21, 111, 198, 42, 229, 28,
-    177, 43, 168, 143, 93, 110, 55, 39, 137, 208, 10, 177, 50, 216, 18, 241, 39, 119, 182, 159, 148, 59, 25, 109, 221,
-    251, 212, 243, 76, 246, 147, 158, 190, 5, 65, 197, 101, 54, 199, 49, 103, 222, 147, 25, 170, 25, 176, 233, 123, 91,
-    167, 130, 84, 158, 55, 137, 201, 36, 180, 16, 134, 232, 129, 234, 3, 148, 67, 74, 152, 155, 21, 249, 138, 22, 192,
-    7, 112, 69, 128, 253, 240, 7, 137, 61, 119, 48, 177, 25, 90, 217, 175, 71, 145, 211, 45, 9, 52, 88, 121, 31, 73,
-    162, 99, 186, 227, 138, 60, 24, 82, 182, 155, 10, 50, 234, 209, 197, 168, 43, 110, 112, 67, 198, 244, 240, 236, 131,
-    172, 30, 139, 90, 154, 201, 201, 4, 100, 189, 75, 11, 186, 248, 150, 41, 169, 232, 138, 135, 142, 74, 105, 58, 193,
-    233, 254, 21, 239, 167, 187, 128, 173, 26, 213, 217, 214, 85, 24, 2, 140, 14, 188, 63, 254, 8, 22, 18, 232, 219,
-    192, 152, 213, 0, 144, 42, 247, 19, 78, 143, 187, 9, 249, 146, 173, 240, 204, 153, 249, 248, 89, 24, 27, 227, 239,
-    122, 230, 66, 103, 149, 159, 191, 215, 163, 148, 58, 64, 23, 253, 18, 196, 109, 216, 180, 248, 85, 46, 43, 221, 6,
-    171, 245, 46, 32, 150, 180, 142, 206, 76, 39, 126, 235, 176, 134, 235, 153, 220, 225, 63, 4, 103, 205, 136, 210, 84,
-    154, 83, 246, 99, 116, 160, 88, 212, 242, 22, 228, 222, 189, 224, 110, 246, 187, 200, 74, 135, 56, 28, 123, 90, 247,
-    211, 228, 85, 62, 211, 134, 139, 162, 71, 181, 46, 67, 165, 177, 157, 201, 197, 63, 234, 199, 217, 103, 174, 109,
-    113, 188, 78, 211, 84, 179, 57, 218, 236, 133, 189, 2, 34, 133, 217, 93, 168, 140, 146, 247, 218, 167, 13, 159, 200,
-    53, 180, 5, 43, 62, 243, 176, 37, 87, 154, 129, 228, 173, 186, 159, 8, 0, 60, 231, 216, 150, 210, 236, 63, 86, 33,
-    103, 25, 144, 190, 235, 22, 122, 38, 9, 88, 239, 47, 118, 80, 110, 33, 84, 38, 173, 99, 101, 172, 181, 60, 28, 243,
-    158, 92, 55, 132, 210, 82, 10, 110, 234, 107, 87, 113, 94, 124, 192, 45, 50, 219, 9, 116, 156, 76, 174, 108, 222,
-    189, 242, 111, 100, 125, 232, 227, 197, 18, 10, 88, 102, 245, 64, 253, 25, 230, 190, 161, 125, 38, 47, 185, 178, 8,
-    128, 93, 219, 159, 228, 199, 95, 116, 199, 29, 67, 201, 118, 110, 248, 31, 236, 130, 7, 21, 41, 5, 21, 156, 41, 125,
-    174, 27, 130, 77, 229, 116, 78, 111, 210, 101, 248, 202, 185, 42, 223, 163, 195, 6, 203, 193, 85, 109, 29, 47, 14,
-    202, 118, 61, 78, 8, 119, 253, 86, 86, 209, 159, 13, 24, 191, 241, 7, 25, 179, 152, 98, 47, 17, 101, 32, 10, 194,
-    23, 11, 65, 87, 72, 40, 240, 215, 222, 36, 84, 166, 133, 163, 175, 106, 59, 160, 88, 21, 244, 208, 195, 133, 197,
-    241, 127, 143, 246, 172, 77, 96, 27, 79, 30, 4, 47, 213, 236, 248, 228, 142, 72, 27, 20, 123, 120, 99, 5, 6, 96, 32,
-    218, 247, 163, 231, 244, 61, 181, 236, 11, 176, 135, 47, 30, 87, 241, 124, 134, 221, 131, 50, 166, 251, 152, 187,
-    168, 206, 237, 60, 189, 34, 5, 121, 27, 183, 90, 73, 84, 63, 138, 186, 147, 54, 160, 240, 151, 102, 164, 100, 203,
-    77, 52, 208, 4, 148, 39, 130, 105, 221, 163, 158, 91, 51, 117, 129, 176, 25, 241, 246, 152, 103, 131, 189, 165, 104,
-    106, 248, 16, 129, 8, 166, 108, 162, 153, 110, 177, 70, 45, 159, 7, 112, 217, 251, 21, 213, 70, 38, 93, 146, 141,
-    211, 58, 100, 230, 190, 97, 251, 33, 12, 91, 173, 163, 190, 170, 61, 136, 193, 201, 96, 133, 233, 45, 35, 170, 81,
-    235, 134, 169, 160, 31, 138, 140, 40, 246, 125, 177, 99, 61, 255, 177, 179, 48, 169, 43, 222, 115, 82, 215, 27, 115,
-    63, 148, 103, 198, 91, 237, 56, 208, 63, 241, 123, 100, 91, 3, 131, 128, 247, 7, 73, 167, 113, 10, 86, 6, 237, 76,
-    147, 33, 142, 153, 73, 116, 20, 57, 173, 138, 88, 144, 135, 47, 136, 1, 105, 86, 11, 108, 153, 51, 51, 213, 38, 245,
-    166, 55, 40, 226, 11, 196, 137, 45, 66, 65, 144, 39, 109, 29, 174, 89, 122, 207, 144, 19, 81, 37, 250, 66, 168, 76,
-    252, 101, 250, 27, 87, 146, 21, 61, 80, 246, 189, 131, 19, 122, 179, 102, 104, 37, 77, 30, 209, 135, 116, 245, 50,
-    14, 142, 19, 70, 52, 196, 140, 2, 194, 39, 243, 84, 184, 110, 26, 72, 144, 35, 73, 136, 219, 252, 47, 240, 100, 46,
-    81, 224, 150, 5, 146, 82, 39, 48, 62, 7, 254, 246, 14, 79, 92, 243, 204, 166, 175, 183, 151, 76, 155, 18, 78, 236,
-    84, 42, 129, 74, 107, 51, 187, 17, 161, 42, 23, 54, 212, 116, 236, 180, 23, 238, 163, 219, 171, 99, 206, 239, 7,
-    120, 29, 5, 201, 231, 151, 153, 92, 228, 1, 191, 24, 94, 56, 124, 145, 167, 230, 230, 77, 11, 125, 216, 126, 183,
-    125, 214, 59, 232, 44, 118, 186, 54, 92, 138, 136, 128, 118, 26, 145, 8, 167, 147, 137, 184, 1, 88, 178, 49, 169,
-    170, 56, 252, 177, 195, 94, 92, 32, 8, 205, 161, 235, 181, 157, 162, 98, 248, 31, 231, 104, 121, 3, 248, 142, 117,
-    200, 251, 153, 183, 37, 96, 9, 234, 224, 202, 251, 250, 72, 201, 43, 22, 100, 62, 6, 99, 157, 92, 36, 44, 54, 17,
-    118, 233, 130, 125, 74, 201, 8, 149, 242, 20, 90, 56, 124, 197, 103, 152, 30, 88, 234, 157, 39, 199, 205, 98, 8, 85,
-    222, 244, 69, 217, 148, 252, 98, 249, 204, 238, 23, 85, 104, 228, 169, 192, 9, 31, 239, 204, 215, 242, 133, 217,
-    198, 1, 27, 171, 92, 53, 81, 0, 16, 51, 40, 127, 1, 196, 195, 111, 41, 22, 163, 187, 237, 232, 174, 97, 199, 253,
-    142, 144, 189, 36, 62, 85, 39, 230, 165, 35, 251, 55, 119, 231, 181, 78, 80, 130, 218, 43, 87, 106, 125, 133, 210,
-    169, 4, 187, 227, 187, 61, 5, 228, 194, 192, 236, 215, 55, 85, 245, 38, 230, 221, 88, 196, 180, 210, 150, 221, 47,
-    96, 72, 89, 12, 250, 30, 79, 187, 173, 82, 244, 59, 216, 163, 176, 220, 16, 211, 26, 172, 89, 228, 162, 26, 106,
-    211, 51, 62, 157, 163, 53, 172, 104, 21, 147, 26, 107, 138, 253, 86, 102, 35, 34, 198, 96, 213, 251, 217, 18, 252,
-    5, 92, 130, 155, 245, 161, 194, 175, 42, 154, 223, 250, 84, 24, 124, 43, 41, 30, 155, 16, 61, 223, 231, 146, 8, 119,
-    158, 156, 216, 116, 135, 131, 7, 62, 231, 14, 24, 102, 12, 42, 249, 206, 52, 211, 229, 38, 240, 44, 129, 32, 9, 102,
-    45, 191, 118, 168, 187, 218, 251, 190, 235, 49, 192, 200, 84, 214, 217, 226, 85, 139, 240, 16, 125, 103, 178, 82,
-    201, 61, 30, 12, 78, 151, 95, 217, 196, 203, 123, 111, 143, 40, 188, 17, 171, 227, 99, 148, 247, 69, 237, 207, 221,
-    160, 4, 247, 53, 84, 104, 136, 160, 58, 20, 140, 88, 98, 134, 204, 49, 223, 60, 158, 177, 250, 214, 159, 42, 148,
-    174, 88, 229, 205, 82, 117, 111, 124, 61, 147, 208, 44, 206, 208, 140, 160, 153, 95, 166, 87, 236, 255, 121, 161,
-    202, 57, 49, 133, 62, 212, 21, 222, 84, 70, 88, 207, 97, 139, 30, 136, 131, 10, 178, 34, 210, 103, 184, 63, 120,
-    132, 132, 5, 45, 24, 58, 141, 31, 86, 204, 237, 210, 56, 104, 176, 37, 138, 238, 228, 148, 70, 101, 54, 62, 234,
-    147, 246, 238, 197, 40, 245, 23, 182, 235, 31, 42, 174, 146, 249, 170, 234, 44, 179, 174, 184, 112, 12, 180, 195,
-    176, 18, 153, 162, 161, 208, 49, 170, 23, 85, 71, 161, 226, 183, 132, 97, 109, 135, 118, 57, 18, 84, 0, 253, 12,
-    118, 95, 237, 75, 47, 237, 241, 98, 233, 230, 215, 247, 84, 37, 203, 199, 127, 22, 239, 182, 162, 28, 210, 178, 97,
-    43, 120, 201, 44, 201, 160, 162, 103, 41, 27, 23, 24, 184, 130, 173, 77, 42, 78, 141, 82, 247, 65, 3, 182, 19, 194,
-    95, 171, 87, 203, 165, 130, 160, 147, 22, 16, 116, 226, 47, 198, 68, 70, 156, 238, 124, 149, 189, 141, 85, 86, 181,
-    47, 53, 200, 121, 73, 171, 115, 72, 126, 197, 42, 155, 251, 27, 15, 11, 88, 130, 117, 169, 248, 3, 237, 245, 206,
-    219, 243, 86, 78, 91, 232, 117, 89, 146, 238, 178, 79, 234, 58, 103, 154, 129, 132, 25, 19, 230, 33, 79, 214, 210,
-    124, 91, 167, 160, 125, 250, 13, 218, 157, 21, 5, 75, 50, 188, 201, 194, 44, 51, 165, 73, 3, 196, 201, 66, 1, 128,
-    37, 27, 177, 137, 93, 125, 36, 143, 113, 19, 58, 192, 182, 18, 185, 19, 243, 49, 150, 174, 63, 40, 75, 217, 56, 249,
-    196, 236, 23, 47, 145, 26, 118, 77, 245, 128, 35, 4, 210, 13, 7, 140, 172, 233, 153, 244, 13, 96, 75, 67, 65, 178,
-    222, 209, 170, 255, 4, 11, 159, 156, 41, 169, 203, 0, 220, 126, 68, 185, 121, 196, 155, 229, 44, 140, 120, 129, 21,
-    187, 95, 122, 37, 106, 206, 9, 202, 131, 158, 244, 80, 96, 219, 114, 147, 199, 29, 234, 8, 253, 90, 232, 59, 64,
-    238, 61, 28, 187, 56, 1, 246, 9, 214, 96, 217, 239, 215, 239, 236, 22, 210, 189, 206, 71, 135, 166, 247, 211, 127,
-    123, 131, 181, 234, 47, 176, 215, 128, 29, 132, 68, 34, 71, 199, 58, 177, 148, 62, 81, 45, 188, 32, 81, 163, 248,
-    31, 146, 222, 250, 165, 14, 29, 234, 144, 138, 220, 228, 139, 2, 152, 44, 185, 1, 12, 19, 154, 254, 32, 3, 11, 55,
-    6, 79, 72, 58, 194, 99, 106, 117, 178, 121, 90, 95, 226, 128, 162, 127, 159, 219, 116, 209, 169, 14, 143, 217, 119,
-    67, 218, 70, 172, 5, 125, 218, 226, 208, 190, 80, 34, 197, 6, 70, 59, 109, 241, 130, 232, 3, 205, 24, 85, 130, 44,
-    35, 209, 197, 239, 220, 206, 197, 246, 171, 74, 127, 149, 154, 231, 200, 183, 252, 69, 32, 135, 121, 123, 106, 86,
-    174, 145, 35, 35, 219, 186, 18, 52, 60, 168, 29, 7, 204, 149, 19, 24, 75, 8, 72, 182, 24, 154, 39, 125, 184, 183,
-    154, 143, 56, 4, 37, 131, 57, 63, 90, 88, 161, 14, 37, 104, 127, 8, 236, 124, 4, 255, 6, 85, 14, 150, 145, 125, 136,
-    232, 18, 227, 119, 26, 186, 63, 60, 218, 205, 199, 117, 178, 194, 5, 114, 181, 178, 124, 152, 114, 57, 161, 175,
-    237, 239, 40, 135, 14, 141, 140, 144, 205, 86, 79, 244, 47, 227, 164, 83, 41, 251, 121, 30, 16, 27, 126, 29, 85, 76,
-    135, 193, 126, 93, 134, 196, 15, 228, 184, 216, 204, 147, 88, 30, 27, 161, 114, 196, 68, 234, 194, 3, 88, 245, 243,
-    144, 169, 35, 225, 226, 223, 244, 47, 72, 86, 68, 140, 199, 181, 171, 148, 75, 120, 240, 177, 174, 20, 69, 106, 169,
-    4, 60, 207, 226, 170, 121, 71, 217, 77, 196, 71, 67, 4, 43, 226, 55, 232, 201, 171, 164, 122, 197, 47, 198, 73, 121,
-    208, 239, 51, 212, 120, 135, 39, 24, 239, 50, 159, 102, 212, 189, 71, 112, 102, 15, 16, 157, 213, 93, 87, 255, 220,
-    87, 82, 110, 141, 78, 141, 163, 116, 16, 81, 203, 44, 63, 38, 225, 197, 157, 15, 221, 49, 83, 5, 163, 218, 139, 14,
-    171, 127, 8, 144, 127, 112, 177, 95, 131, 38, 179, 192, 242, 89, 235, 61, 157, 36, 217, 7, 73, 77, 197, 161, 192,
-    75, 239, 41, 10, 196, 63, 6, 11, 156, 231, 208, 232, 241, 100, 187, 152, 255, 246, 118, 1, 240, 145, 243, 174, 168,
-    90, 88, 201, 239, 61, 116, 230, 83, 59, 19, 212, 21, 167, 47, 91, 253, 6, 14, 197, 92, 88, 121, 62, 112, 35, 58, 20,
-    225, 19, 52, 227, 117, 230, 136, 172, 109, 55, 107, 118, 79, 172, 23, 231, 153, 87, 51, 247, 112, 54, 93, 135, 252,
-    35, 26, 155, 161, 4, 148, 86, 22, 13, 169, 251, 118, 192, 205, 248, 240, 96, 49, 148, 10, 147, 193, 113, 76, 38, 5,
-    189, 125, 211, 152, 244, 202, 189, 134, 243, 205, 90, 23, 173, 240, 109, 93, 189, 126, 81, 143, 162, 58, 193, 53,
-    109, 192, 14, 51, 71, 144, 228, 244, 140, 225, 155, 156, 133, 246, 222, 159, 165, 224, 55, 103, 97, 34, 135, 233,
-    162, 119, 116, 50, 210, 31, 229, 5, 113, 20, 47, 158, 116, 51, 125, 142, 53, 186, 247, 224, 53, 57, 128, 117, 129,
-    191, 140, 196, 136, 152, 81, 214, 7, 210, 167, 34, 111, 181, 109, 246, 182, 83, 248, 169, 253, 88, 247, 40, 94, 218,
-    170, 55, 101, 113, 50, 200, 87, 59, 102, 76, 5, 230, 102, 143, 128, 167, 143, 104, 16, 116, 66, 12, 3, 35, 150, 128,
-    137, 31, 108, 100, 4, 75, 231, 250, 23, 32, 5, 66, 166, 103, 222, 18, 15, 180, 240, 42, 85, 165, 178, 181, 134, 52,
-    52, 93, 145, 170, 126, 16, 49, 31, 28, 196, 62, 10, 98, 187, 182, 104, 85, 61, 182, 80, 101, 41, 151, 26, 5, 187,
-    150, 105, 17, 255, 46, 174, 185, 218, 67, 28, 163, 178, 43, 117, 238, 23, 172, 234, 80, 11, 36, 187, 53, 178, 222,
-    148, 108, 112, 224, 220, 175, 112, 49, 41, 23, 80, 126, 255, 183, 110, 177, 5, 210, 189, 92, 27, 97, 234, 65, 32,
-    194, 29, 211, 135, 27, 23, 48, 138, 223, 216, 115, 79, 168, 137, 129, 77, 167, 210, 87, 229, 229, 107, 173, 231,
-    173, 224, 193, 66, 223, 7, 54, 123, 22, 206, 173, 97, 18, 224, 54, 98, 254, 63, 105, 192, 57, 126, 9, 68, 53, 133,
-    32, 88, 122, 139, 249, 24, 126, 64, 241, 56, 225, 72, 70, 209, 198, 159, 134, 121, 165, 166, 150, 49, 5, 69, 30,
-    178, 146, 59, 106, 251, 1, 66, 77, 38, 185, 40, 211, 90, 25, 165, 43, 252, 198, 130, 67, 0, 34, 9, 1, 203, 212, 124,
-    108, 166, 14, 172, 210, 156, 191, 189, 207, 169, 52, 55, 167, 190, 48, 171, 251, 221, 22, 16, 16, 169, 50, 45, 19,
-    2, 108, 115, 200, 69, 91, 43, 26, 89, 54, 152, 74, 157, 229, 143, 244, 103, 172, 30, 139, 214, 161, 157, 238, 143,
-    70, 235, 80, 198, 239, 97, 170, 122, 80, 89, 7, 196, 0, 138, 171, 60, 41, 236, 231, 41, 221, 60, 144, 101, 96, 111,
-    214, 192, 74, 12, 92, 103, 54, 97, 15, 25, 105, 145, 247, 75, 55, 39, 11, 129, 92, 63, 52, 127, 246, 165, 185, 68,
-    16, 131, 228, 81, 123, 63, 177, 33, 9, 157, 89, 117, 81, 171, 193, 30, 193, 0, 1, 167, 179, 121, 255, 228, 93, 48,
-    202, 210, 142, 183, 236, 183, 184, 250, 231, 184, 1, 90, 168, 228, 172, 163, 218, 29, 54, 7, 199, 50, 187, 190, 33,
-    46, 24, 148, 23, 11, 158, 211, 155, 180, 58, 163, 153, 117, 74, 221, 244, 245, 36, 100, 141, 145, 188, 224, 175, 14,
-    47, 84, 34, 188, 167, 254, 15, 227, 44, 157, 32, 181, 54, 218, 113, 134, 172, 219, 199, 66, 210, 193, 235, 33, 197,
-    20, 95, 155, 103, 164, 112, 110, 76, 9, 210, 236, 2, 75, 161, 75, 238, 185, 66, 193, 8, 249, 46, 254, 86, 158, 210,
-    239, 198, 30, 124, 50, 239, 242, 232, 132, 88, 70, 45, 63, 149, 240, 82, 39, 159, 186, 80, 207, 220, 125, 183, 70,
-    54, 161, 33, 130, 117, 37, 128, 71, 115, 192, 78, 78, 168, 46, 89, 153, 76, 60, 54, 52, 162, 193, 94, 155, 22, 183,
-    240, 84, 60, 180, 120, 249, 154, 228, 14, 215, 160, 108, 128, 37, 92, 95, 215, 126, 33, 46, 8, 21, 31, 77, 132, 251,
-    40, 188, 167, 26, 106, 91, 144, 97, 248, 79, 25, 32, 174, 110, 125, 153, 220, 230, 24, 130, 153, 130, 80, 23, 141,
-    4, 82, 61, 243, 221, 158, 119, 147, 96, 229, 34, 141, 207, 113, 136, 78, 66, 113, 152, 254, 226, 243, 51, 192, 192,
-    235, 159, 21, 225, 105, 121, 16, 155, 71, 154, 85, 221, 160, 189, 14, 99, 202, 33, 127, 238, 210, 8, 245, 183, 58,
-    186, 80, 253, 176, 96, 43, 64, 75, 229, 126, 216, 61, 60, 169, 67, 215, 117, 42, 142, 59, 147, 224, 228, 59, 202,
-    26, 221, 33, 190, 159, 84, 40, 178, 160, 111, 181, 210, 196, 209, 110, 186, 189, 241, 69, 51, 154, 0, 118, 230, 126,
-    12, 32, 205, 50, 172, 169, 38, 108, 231, 171, 32, 58, 80, 203, 151, 249, 216, 231, 191, 231, 162, 158, 155, 166, 0,
-    159, 43, 69, 84, 167, 34, 160, 99, 252, 157, 53, 213, 4, 123, 122, 242, 37, 171, 2, 70, 145, 9, 166, 75, 206, 201,
-    33, 92, 198, 250, 155, 237, 117, 154, 206, 66, 75, 35, 65, 224, 128, 101, 242, 54, 228, 144, 197, 193, 180, 203,
-    178, 152, 47, 37, 81, 6, 193, 16, 159, 133, 255, 230, 93, 124, 241, 144, 207, 204, 24, 222, 199, 254, 150, 215, 229,
-    16, 120, 40, 206, 33, 85, 65, 100, 186, 139, 210, 223, 252, 190, 81, 161, 198, 108, 68, 148, 251, 253, 18, 184, 84,
-    9, 93, 107, 16, 199, 197, 15, 184, 218, 228, 187, 122, 179, 67, 224, 193, 149, 180, 143, 85, 172, 86, 79, 222, 191,
-    128, 175, 143, 219, 97, 83, 129, 252, 250, 171, 241, 162, 202, 192, 8, 161, 115, 13, 189, 146, 235, 107, 174, 49,
-    37, 141, 69, 91, 239, 206, 203, 224, 250, 7, 173, 115, 46, 136, 128, 157, 82, 7, 152, 6, 1, 245, 200, 187, 125, 42,
-    121, 209, 122, 103, 46, 178, 241, 146, 184, 117, 194, 254, 49, 202, 8, 51, 188, 84, 123, 158, 162, 116, 15, 219,
-    235, 251, 168, 96, 160, 74, 44, 86, 43, 116, 141, 188, 119, 141, 172, 144, 216, 11, 155, 5, 78, 235, 81, 78, 240,
-    175, 51, 95, 129, 180, 192, 120, 43, 53, 222, 138, 3, 16, 187, 131, 110, 142, 50, 46, 57, 75, 146, 170, 184, 102,
-    174, 171, 148, 87, 89, 156, 214, 190, 116, 250, 110, 242, 205, 131, 137, 104, 239, 91, 196, 56, 214, 216, 129, 12,
-    172, 208, 35, 54, 136, 240, 179, 35, 53, 169, 115, 15, 95, 209, 196, 80, 106, 121, 182, 235, 190, 89, 8, 134, 124,
-    93, 115, 61, 80, 90, 205, 141, 24, 8, 99, 19, 138, 137, 26, 113, 239, 91, 175, 192, 221, 12, 1, 60, 60, 130, 27, 74,
-    233, 14, 68, 12, 70, 245, 7, 145, 196, 13, 175, 17, 176, 245, 66, 211, 54, 81, 232, 34, 176, 82, 16, 57, 168, 5, 71,
-    102, 177, 80, 158, 166, 119, 95, 132, 84, 34, 140, 121, 145, 176, 83, 167, 144, 34, 5, 68, 130, 236, 201, 46, 63,
-    16, 226, 187, 4, 51, 160, 58, 210, 1, 174, 50, 55, 99, 227, 143, 127, 2, 187, 115, 68, 29, 142, 215, 29, 246, 171,
-    134, 215, 150, 217, 191, 26, 48, 231, 213, 238, 69, 88, 71, 37, 122, 124, 56, 202, 112, 223, 223, 254, 192, 238,
-    185, 221, 0, 232, 50, 128, 182, 96, 83, 56, 66, 149, 235, 33, 99, 87, 248, 30, 73, 94, 216, 229, 42, 69, 209, 183,
-    49, 185, 251, 14, 8, 201, 2, 174, 20, 136, 240, 2, 249, 140, 160, 192, 51, 216, 204, 147, 137, 153, 54, 78, 244,
-    105, 66, 168, 136, 38, 100, 99, 83, 188, 32, 31, 175, 126, 93, 105, 225, 1, 147, 210, 104, 191, 0, 150, 192, 53, 55,
-    60, 192, 28, 139, 195, 16, 32, 131, 133, 254, 68, 244, 18, 56, 217, 62, 219, 132, 249, 212, 194, 75, 227, 199, 241,
-    209, 230, 228, 29, 239, 252, 114, 58, 242, 182, 250, 184, 27, 169, 127, 131, 197, 235, 103, 58, 161, 97, 210, 95,
-    107, 209, 13, 90, 165, 158, 239, 141, 83, 200, 135, 243, 60, 82, 144, 117, 30, 227, 16, 233, 50, 166, 69, 76, 173,
-    32, 92, 119, 109, 65, 50, 240, 141, 57, 7, 242, 197, 226, 208, 53, 206, 6, 52, 157, 205, 236, 163, 158, 157, 255,
-    196, 33, 104, 211, 243, 208, 246, 105, 116, 85, 251, 254, 241, 65, 250, 125, 8, 206, 162, 162, 208, 203, 194, 184,
-    66, 135, 170, 133, 194, 145, 32, 154, 148, 7, 174, 98, 231, 111, 119, 220, 146, 210, 136, 230, 191, 254, 38, 182,
-    162, 91, 137, 169, 131, 238, 60, 103, 14, 169, 92, 84, 219, 77, 66, 212, 64, 245, 73, 110, 208, 84, 173, 119, 34,
-    190, 113, 130, 54, 235, 175, 64, 165, 162, 187, 172, 173, 14, 123, 115, 84, 28, 213, 123, 152, 111, 15, 139, 35, 97,
-    247, 57, 234, 226, 61, 162, 108, 161, 92, 12, 244, 36, 52, 119, 116, 206, 118, 161, 42, 241, 241, 70, 207, 24, 212,
-    144, 107, 157, 105, 228, 29, 96, 118, 51, 194, 11, 124, 79, 238, 142, 243, 56, 91, 42, 56, 80, 20, 212, 53, 169,
-    127, 225, 33, 191, 54, 112, 82, 171, 236, 1, 184, 89, 200, 157, 118, 4, 80, 97, 78, 218, 226, 210, 99, 76, 37, 25,
-    111, 1, 186, 82, 65, 123, 26, 200, 167, 34, 203, 148, 92, 183, 166, 168, 166, 50, 76, 121, 212, 48, 82, 10, 61, 17,
-    102, 201, 127, 103, 118, 140, 61, 195, 13, 145, 47, 66, 80, 66, 21, 30, 28, 60, 192, 51, 111, 223, 5, 150, 9, 110,
-    18, 59, 222, 81, 184, 99, 195, 201, 231, 72, 143, 109, 254, 11, 141, 195, 90, 37, 79, 197, 159, 139, 119, 126, 82,
-    195, 219, 179, 135, 122, 132, 56, 215, 59, 72, 62, 39, 39, 14, 35, 178, 26, 190, 194, 196, 199, 141, 121, 22, 68,
-    205, 139, 224, 106, 0, 251, 211, 64, 233, 213, 182, 117, 180, 249, 98, 204, 50, 41, 71, 212, 217, 251, 131, 226,
-    129, 23, 154, 232, 220, 131, 51, 18, 46, 234, 64, 241, 58, 32, 134, 93, 177, 214, 99, 115, 7, 118, 82, 37, 108, 27,
-    219, 94, 59, 100, 77, 231, 249, 169, 238, 14, 154, 223, 43, 30, 12, 67, 107, 17, 68, 66, 220, 184, 17, 182, 38, 49,
-    251, 248, 240, 84, 181, 244, 210, 124, 188, 138, 103, 228, 140, 119, 242, 180, 96, 86, 38, 107, 142, 155, 211, 236,
-    185, 142, 112, 199, 67, 120, 116, 176, 10, 132, 57, 65, 205, 149, 166, 57, 124, 167, 10, 97, 110, 244, 242, 200, 51,
-    51, 105, 180, 92, 97, 235, 243, 147, 178, 103, 15, 255, 237, 28, 107, 221, 28, 215, 165, 94, 88, 238, 43, 95, 136,
-    226, 100, 219, 221, 190, 90, 230, 3, 119, 193, 18, 152, 63, 9, 130, 81, 81, 1, 193, 59, 137, 247, 75, 231, 85, 89,
-    21, 10, 20, 127, 207, 164, 253, 48, 112, 146, 242, 139, 232, 97, 63, 15, 195, 50, 167, 128, 237, 48, 188, 156, 96,
-    39, 187, 210, 120, 18, 20, 202, 37, 174, 83, 47, 39, 125, 234, 12, 234, 118, 154, 193, 254, 182, 134, 255, 243, 52,
-    94, 186, 95, 168, 173, 150, 78, 153, 177, 96, 126, 70, 47, 72, 144, 138, 132, 236, 24, 192, 170, 185, 125, 196, 156,
-    40, 129, 38, 42, 192, 18, 69, 24, 22, 136, 88, 72, 107, 151, 30, 52, 156, 103, 248, 45, 140, 229, 57, 235, 91, 100,
-    126, 230, 91, 188, 56, 184, 147, 116, 69, 212, 232, 76, 71, 215, 34, 251, 130, 191, 215, 212, 222, 25, 102, 175, 38,
-    61, 43, 210, 18, 211, 134, 203, 106, 156, 47, 21, 108, 123, 154, 198, 209, 175, 55, 78, 210, 51, 138, 40, 198, 222,
-    208, 18, 12, 135, 223, 199, 102, 213, 208, 155, 137, 110, 134, 160, 190, 0, 108, 165, 113, 199, 135, 47, 136, 29,
-    76, 222, 36, 95, 15, 188, 35, 99, 8, 157, 184, 110, 219, 122, 144, 17, 195, 111, 237, 18, 139, 12, 213, 195, 191,
-    184, 111, 248, 37, 11, 122, 226, 121, 240, 49, 38, 110, 137, 176, 98, 231, 77, 2, 171, 141, 98, 117, 2, 192, 75,
-    170, 204, 48, 211, 125, 83, 175, 8, 25, 125, 160, 191, 241, 81, 213, 100, 192, 129, 66, 29, 163, 140, 99, 52, 52,
-    10, 58, 196, 228, 240, 156, 147, 28, 212, 87, 136, 17, 62, 229, 128, 215, 180, 240, 33, 43, 202, 153, 53, 2, 138, 4,
-    236, 64, 109, 87, 87, 143, 155, 21, 148, 46, 235, 240, 180, 57, 104, 100, 2, 168, 98, 53, 36, 207, 213, 108, 212,
-    27, 117, 238, 247, 183, 59, 152, 19, 21, 96, 111, 129, 239, 75, 4, 96, 229, 194, 83, 108, 97, 93, 249, 220, 91, 99,
-    43, 114, 46, 93, 83, 202, 34, 173, 251, 91, 186, 115, 232, 199, 226, 9, 35, 60, 250, 88, 100, 73, 216, 174, 54, 111,
-    28, 75, 243, 179, 231, 41, 180, 246, 93, 228, 255, 0, 104, 115, 147, 137, 35, 59, 220, 204, 175, 59, 166, 208, 106,
-    6, 23, 239, 240, 12, 187, 92, 13, 223, 224, 251, 231, 214, 137, 13, 36, 80, 239, 42, 70, 74, 52, 49, 197, 187, 155,
-    230, 148, 13, 65, 8, 70, 50, 84, 188, 181, 142, 148, 141, 183, 194, 108, 231, 99, 231, 157, 46, 2, 138, 78, 219, 56,
-    99, 147, 93, 219, 126, 175, 6, 239, 158, 130, 192, 195, 165, 32, 31, 106, 171, 178, 130, 138, 23, 243, 19, 229, 116,
-    20, 229, 227, 162, 149, 251, 203, 138, 253, 35, 93, 52, 23, 33, 179, 137, 28, 117, 2, 46, 12, 99, 156, 214, 80, 133,
-    42, 237, 20, 89, 246, 178, 90, 119, 16, 252, 210, 168, 16, 228, 174, 34, 243, 29, 143, 147, 184, 42, 30, 196, 69,
-    73, 0, 200, 220, 78, 44, 179, 90, 187, 142, 231, 206, 227, 245, 57, 178, 67, 155, 217, 117, 130, 113, 95, 104, 255,
-    189, 87, 193, 54, 98, 76, 23, 176, 67, 45, 247, 29, 217, 93, 163, 124, 185, 63, 0, 110, 43, 141, 182, 179, 32, 127,
-    6, 247, 82, 62, 42, 251, 228, 92, 240, 173, 7, 236, 56, 29, 103, 169, 236, 208, 252, 251, 189, 79, 151, 58, 68, 53,
-    173, 234, 212, 9, 110, 175, 119, 26, 112, 227, 206, 165, 24, 128, 67, 96, 190, 219, 1, 145, 171, 36, 67, 43, 128,
-    71, 76, 50, 70, 124, 44, 15, 96, 183, 228, 200, 178, 226, 49, 216, 49, 117, 215, 11, 140, 160, 236, 222, 33, 2, 219,
-    61, 12, 117, 2, 202, 56, 78, 172, 140, 19, 189, 56, 203, 248, 0, 163, 253, 32, 135, 33, 26, 67, 111, 249, 62, 20,
-    179, 157, 49, 124, 101, 73, 120, 6, 21, 75, 247, 38, 12, 158, 218, 130, 141, 236, 14, 139, 175, 44, 207, 205, 182,
-    25, 208, 199, 70, 224, 131, 173, 7, 181, 50, 66, 241, 148, 252, 210, 100, 171, 77, 92, 17, 33, 25, 52, 238, 145, 72,
-    24, 231, 229, 146, 82, 99, 27, 53, 233, 84, 87, 20, 13, 7, 238, 142, 16, 96, 162, 93, 3, 184, 12, 118, 178, 238, 83,
-    3, 84, 24, 172, 227, 140, 212, 220, 254, 254, 159, 125, 228, 56, 52, 68, 223, 248, 68, 229, 0, 50, 184, 1, 177, 48,
-    13, 240, 77, 88, 254, 47, 224, 116, 205, 171, 166, 105, 208, 129, 136, 35, 95, 199, 29, 226, 123, 249, 150, 247,
-    248, 81, 94, 87, 15, 245, 172, 157, 110, 28, 248, 4, 75, 174, 23, 40, 125, 159, 243, 105, 217, 165, 200, 161, 168,
-    218, 223, 145, 157, 20, 231, 135, 90, 117, 73, 136, 21, 198, 13, 225, 60, 187, 254, 155, 169, 157, 3, 230, 166, 110,
-    71, 177, 9, 102, 226, 216, 12, 117, 224, 102, 11, 128, 160, 25, 93, 79, 221, 231, 147, 143, 120, 160, 19, 220, 138,
-    255, 100, 47, 119, 237, 249, 24, 240, 106, 148, 243, 40, 185, 44, 42, 247, 6, 139, 17, 172, 255, 205, 218, 210, 251,
-    48, 58, 56, 114, 10, 232, 105, 6, 207, 131, 180, 194, 87, 167, 55, 55, 86, 211, 175, 188, 27, 82, 225, 47, 131, 40,
-    232, 199, 20, 77, 133, 92, 184, 84, 0, 173, 20, 179, 91, 117, 147, 9, 153, 49, 15, 239, 245, 33, 125, 5, 121, 217,
-    149, 33, 72, 171, 159, 138, 126, 191, 79, 55, 225, 108, 188, 14, 232, 179, 196, 15, 219, 49, 143, 54, 79, 104, 184,
-    76, 31, 82, 244, 31, 79, 240, 97, 214, 212, 119, 233, 86, 248, 224, 202, 193, 194, 243, 81, 33, 168, 151, 48, 180,
-    200, 164, 185, 241, 40, 146, 195, 207, 169, 254, 87, 40, 57, 182, 196, 199, 186, 53, 136, 74, 185, 172, 210, 94, 67,
-    63, 198, 218, 14, 219, 77, 133, 171, 8, 109, 21, 160, 184, 174, 209, 160, 186, 181, 149, 158, 177, 166, 93, 85, 103,
-    135, 96, 221, 48, 128, 28, 173, 87, 95, 53, 73, 65, 222, 205, 68, 154, 3, 193, 106, 179, 61, 189, 120, 75, 202, 176,
-    98, 159, 2, 195, 174, 251, 64, 252, 155, 199, 155, 121, 99, 227, 191, 150, 139, 242, 44, 83, 14, 52, 230, 159, 89,
-    14, 33, 92, 83, 148, 159, 150, 210, 62, 20, 147, 224, 238, 84, 71, 236, 120, 187, 173, 65, 39, 92, 210, 219, 3, 53,
-    99, 255, 247, 66, 136, 163, 237, 118, 159, 193, 244, 62, 158, 37, 235, 147, 138, 50, 227, 201, 206, 121, 166, 36,
-    109, 138, 11, 56, 233, 89, 202, 202, 243, 215, 91, 164, 172, 53, 238, 236, 206, 227, 238, 138, 149, 134, 27, 61,
-    149, 80, 157, 254, 58, 47, 57, 221, 213, 22, 143, 221, 144, 120, 12, 141, 73, 53, 11, 119, 186, 0, 10, 15, 180, 221,
-    56, 208, 172, 125, 61, 234, 146, 24, 123, 80, 92, 107, 119, 195, 99, 54, 49, 245, 74, 26, 43, 166, 247, 17, 74, 6,
-    228, 230, 47, 245, 103, 161, 39, 110, 115, 155, 9, 234, 93, 21, 101, 80, 204, 93, 178, 206, 155, 135, 194, 27, 146,
-    165, 198, 5, 231, 6, 188, 199, 189, 87, 40, 20, 211, 244, 41, 11, 225, 240, 31, 71, 103, 194, 17, 80, 143, 195, 117,
-    91, 213, 35, 239, 42, 190, 1, 190, 209, 131, 125, 7, 185, 104, 41, 189, 20, 156, 197, 134, 39, 121, 107, 211, 84,
-    106, 223, 207, 130, 90, 61, 210, 30, 237, 56, 101, 198, 176, 170, 194, 79, 219, 150, 190, 149, 161, 192, 186, 173,
-    196, 94, 165, 178, 177, 72, 122, 250, 139, 229, 105, 24, 162, 162, 140, 37, 106, 185, 171, 37, 105, 0, 183, 201,
-    125, 137, 223, 250, 244, 68, 144, 189, 215, 224, 58, 24, 116, 208, 160, 128, 6, 1, 151, 72, 6, 12, 220, 92, 100,
-    141, 28, 82, 77, 140, 45, 63, 165, 163, 23, 7, 185, 140, 132, 27, 129, 181, 212, 152, 66, 242, 6, 87, 218, 120, 77,
-    200, 5, 170, 69, 158, 107, 113, 63, 54, 247, 24, 176, 70, 68, 34, 138, 221, 38, 82, 110, 188, 76, 69, 183, 154, 163,
-    115, 51, 64, 28, 19, 9, 194, 228, 190, 87, 128, 121, 185, 34, 168, 89, 153, 205, 225, 201, 207, 160, 63, 53, 15,
-    135, 177, 43, 134, 239, 168, 152, 202, 224, 67, 24, 219, 198, 219, 177, 196, 169, 198, 101, 90, 36, 141, 222, 200,
-    104, 62, 136, 230, 53, 7, 224, 92, 10, 48, 28, 67, 236, 241, 129, 53, 141, 159, 228, 223, 166, 231, 126, 11, 79, 79,
-    244, 165, 96, 110, 171, 157, 14, 185, 99, 4, 56, 64, 118, 10, 153, 115, 72, 100, 195, 147, 148, 224, 40, 34, 180,
-    193, 194, 41, 232, 106, 222, 94, 125, 184, 3, 158, 99, 69, 80, 28, 64, 250, 231, 118, 237, 105, 99, 31, 75, 137, 84,
-    140, 184, 5, 157, 219, 224, 239, 168, 122, 178, 147, 53, 109, 90, 102, 35, 94, 85, 160, 84, 187, 178, 102, 170, 227,
-    183, 18, 76, 46, 61, 230, 213, 190, 95, 148, 65, 207, 28, 221, 237, 253, 63, 250, 142, 174, 138, 56, 241, 185, 174,
-    179, 193, 165, 117, 185, 11, 240, 188, 229, 143, 220, 246, 107, 141, 192, 66, 149, 252, 156, 36, 148, 148, 120, 156,
-    142, 125, 20, 207, 202, 207, 34, 16, 212, 123, 180, 66, 144, 212, 233, 81, 232, 142, 28, 47, 79, 43, 239, 147, 163,
-    227, 116, 168, 194, 96, 229, 192, 226, 86, 90, 43, 219, 92, 193, 225, 26, 51, 188, 160, 231, 62, 119, 8, 6, 75, 202,
-    139, 186, 98, 174, 6, 32, 28, 0, 100, 222, 151, 73, 210, 49, 73, 73, 82, 145, 29, 202, 47, 67, 87, 147, 163, 142,
-    75, 160, 81, 142, 37, 244, 225, 19, 207, 157, 81, 119, 170, 4, 32, 50, 224, 179, 41, 35, 172, 162, 193, 146, 199,
-    168, 35, 137, 153, 110, 138, 50, 72, 251, 134, 105, 212, 139, 51, 53, 168, 54, 216, 181, 79, 240, 78, 41, 223, 154,
-    136, 146, 133, 75, 18, 164, 49, 49, 68, 42, 202, 203, 234, 175, 159, 118, 75, 69, 76, 18, 187, 31, 242, 13, 243, 15,
-    205, 243, 37, 19, 120, 247, 124, 144, 136, 146, 217, 26, 195, 177, 57, 127, 136, 73, 179, 183, 102, 78, 134, 183,
-    152, 235, 165, 115, 178, 202, 174, 31, 58, 231, 240, 161, 186, 126, 159, 126, 177, 250, 252, 66, 18, 96, 14, 119,
-    254, 145, 203, 60, 60, 52, 25, 192, 238, 182, 194, 139, 135, 1, 203, 6, 157, 136, 111, 130, 18, 208, 178, 40, 221,
-    57, 10, 161, 212, 41, 253, 220, 78, 189, 65, 87, 227, 135, 127, 44, 73, 52, 28, 219, 66, 44, 204, 175, 159, 78, 23,
-    249, 112, 234, 187, 160, 137, 108, 34, 105, 237, 101, 196, 126, 190, 230, 156, 106, 249, 171, 108, 130, 147, 52, 49,
-    28, 22, 107, 236, 208, 84, 94, 227, 149, 193, 181, 12, 148, 94, 44, 187, 18, 147, 169, 45, 151, 255, 19, 170, 107,
-    90, 59, 234, 73, 77, 53, 15, 124, 235, 199, 233, 26, 102, 106, 134, 234, 235, 149, 193, 62, 7, 69, 198, 134, 21,
-    252, 223, 213, 116, 40, 249, 241, 2, 184, 63, 176, 85, 112, 70, 19, 92, 112, 48, 31, 112, 133, 67, 139, 252, 144,
-    89, 57, 122, 121, 158, 174, 180, 143, 33, 114, 31, 67, 53, 215, 180, 168, 10, 102, 37, 133, 192, 95, 189, 98, 96,
-    206, 92, 158, 177, 162, 28, 51, 242, 87, 29, 11, 151, 22, 226, 51, 32, 34, 61, 255, 31, 251, 184, 12, 245, 136, 201,
-    95, 67, 84, 217, 65, 219, 4, 125, 58, 53, 161, 0, 85, 196, 37, 3, 174, 94, 218, 74, 75, 225, 234, 50, 0, 251, 29,
-    176, 43, 118, 97, 218, 134, 153, 145, 248, 119, 3, 160, 96, 185, 31, 182, 9, 164, 57, 122, 101, 249, 133, 239, 204,
-    207, 202, 91, 39, 239, 247, 156, 163, 101, 245, 30, 133, 135, 191, 86, 123, 4, 89, 188, 138, 58, 251, 58, 228, 135,
-    155, 128, 180, 177, 221, 104, 193, 48, 56, 135, 116, 252, 122, 15, 216, 110, 53, 182, 200, 56, 81, 202, 163, 45,
-    254, 109, 35, 14, 170, 215, 13, 119, 32, 204, 240, 123, 44, 162, 139, 184, 100, 176, 69, 226, 42, 13, 162, 148, 17,
-    187, 215, 129, 7, 96, 52, 210, 218, 189, 105, 15, 170, 16, 44, 147, 203, 197, 46, 217, 24, 79, 73, 161, 148, 245,
-    173, 136, 234, 147, 126, 228, 139, 212, 196, 119, 105, 81, 55, 95, 199, 146, 30, 8, 178, 167, 94, 40, 220, 38, 61,
-    16, 3, 93, 85, 89, 113, 60, 62, 148, 220, 243, 7, 47, 61, 245, 131, 162, 35, 30, 235, 163, 206, 30, 1, 234, 6, 92,
-    253, 107, 220, 171, 181, 216, 240, 65, 30, 248, 140, 196, 156, 173, 20, 131, 20, 152, 39, 220, 198, 166, 202, 72,
-    15, 189, 227, 3, 131, 155, 165, 164, 50, 43, 5, 69, 214, 24, 56, 2, 220, 37, 195, 189, 241, 159, 234, 139, 162, 117,
-    191, 210, 239, 42, 201, 56, 111, 249, 111, 126, 71, 100, 62, 141, 188, 6, 241, 183, 68, 216, 90, 193, 104, 246, 253,
-    222, 240, 36, 14, 231, 238, 183, 168, 87, 192, 193, 18, 196, 5, 173, 238, 147, 246, 43, 151, 86, 23, 225, 185, 226,
-    213, 123, 70, 138, 136, 181, 101, 203, 178, 34, 251, 63, 48, 103, 49, 117, 63, 150, 29, 144, 192, 45, 219, 7, 239,
-    201, 90, 81, 210, 159, 36, 130, 113, 253, 68, 59, 130, 202, 221, 228, 22, 249, 67, 63, 16, 160, 163, 30, 171, 122,
-    248, 235, 184, 49, 109, 24, 83, 30, 234, 78, 208, 24, 2, 183, 59, 0, 128, 176, 227, 33, 136, 186, 3, 215, 162, 169,
-    48, 204, 49, 38, 245, 250, 48, 225, 143, 82, 213, 86, 189, 254, 4, 93, 173, 17, 64, 20, 220, 121, 78, 192, 182, 122,
-    98, 219, 21, 252, 142, 61, 217, 166, 77, 185, 90, 13, 131, 175, 136, 180, 41, 168, 176, 33, 43, 9, 8, 107, 181, 7,
-    43, 240, 25, 227, 137, 175, 8, 65, 1, 92, 127, 60, 164, 255, 101, 208, 248, 28, 254, 34, 145, 195, 218, 85, 248,
-    211, 58, 19, 255, 163, 34, 34, 112, 175, 4, 132, 18, 84, 7, 160, 213, 248, 239, 131, 107, 85, 134, 23, 97, 113, 59,
-    238, 127, 169, 247, 253, 192, 254, 57, 72, 136, 191, 123, 153, 180, 41, 106, 114, 162, 248, 122, 180, 185, 116, 251,
-    95, 88, 40, 137, 158, 102, 113, 9, 177, 115, 169, 13, 42, 3, 200, 157, 92, 225, 125, 227, 160, 102, 33, 194, 209,
-    131, 138, 158, 40, 92, 145, 159, 190, 184, 172, 28, 85, 158, 50, 9, 75, 124, 201, 138, 103, 201, 254, 130, 174, 81,
-    158, 131, 238, 156, 236, 120, 41, 61, 249, 55, 71, 247, 5, 175, 160, 114, 33, 146, 197, 209, 231, 193, 188, 154, 65,
-    227, 1, 24, 208, 51, 124, 151, 210, 147, 178, 78, 8, 181, 169, 110, 246, 219, 136, 83, 103, 21, 198, 169, 74, 189,
-    218, 28, 61, 98, 72, 164, 126, 215, 198, 23, 224, 188, 89, 146, 183, 123, 117, 147, 50, 214, 127, 207, 44, 173, 122,
-    27, 18, 152, 135, 105, 174, 11, 60, 230, 91, 193, 202, 142, 114, 82, 131, 196, 11, 240, 42, 112, 140, 86, 175, 4,
-    113, 254, 159, 36, 78, 161, 64, 16, 24, 127, 225, 138, 58, 222, 208, 246, 215, 211, 222, 228, 46, 247, 176, 227, 22,
-    53, 147, 54, 56, 94, 216, 231, 152, 65, 254, 136, 118, 0, 103, 59, 221, 54, 60, 122, 66, 82, 172, 22, 48, 9, 21, 77,
-    110, 150, 149, 6, 198, 242, 61, 46, 87, 73, 254, 0, 179, 18, 155, 209, 238, 74, 229, 179, 57, 120, 151, 17, 154,
-    171, 146, 96, 205, 160, 173, 63, 248, 168, 89, 111, 143, 118, 246, 114, 184, 47, 97, 249, 20, 103, 32, 40, 18, 112,
-    134, 127, 134, 43, 86, 44, 145, 127, 232, 22, 185, 38, 19, 179, 119, 173, 46, 121, 126, 246, 253, 242, 30, 87, 124,
-    227, 50, 127, 57, 187, 82, 23, 226, 180, 97, 232, 184, 47, 36, 38, 194, 55, 99, 107, 124, 251, 63, 157, 203, 166,
-    139, 245, 110, 180, 144, 172, 226, 229, 205, 189, 96, 159, 185, 93, 7, 85, 8, 233, 97, 199, 147, 16, 220, 96, 138,
-    179, 141, 83, 112, 45, 193, 209, 158, 201, 161, 169, 101, 13, 54, 177, 43, 201, 76, 104, 26, 197, 149, 132, 36, 163,
-    105, 170, 240, 95, 132, 192, 190, 224, 129, 101, 189, 217, 135, 250, 100, 163, 66, 35, 254, 106, 246, 240, 126, 97,
-    70, 192, 25, 87, 188, 89, 146, 54, 168, 111, 218, 73, 47, 38, 238, 165, 64, 77, 231, 100, 64, 39, 173, 89, 241, 247,
-    238, 203, 85, 213, 205, 172, 254, 67, 141, 134, 70, 149, 127, 6, 15, 155, 211, 199, 244, 154, 69, 150, 48, 241, 90,
-    130, 218, 35, 237, 168, 180, 246, 115, 39, 248, 12, 74, 162, 192, 10, 185, 233, 201, 119, 127, 228, 62, 213, 13, 36,
-    46, 233, 15, 181, 244, 23, 81, 29, 30, 206, 66, 235, 184, 160, 111, 229, 148, 220, 244, 235, 78, 148, 241, 245, 154,
-    32, 163, 113, 37, 176, 19, 221, 17, 1, 230, 199, 15, 154, 85, 39, 128, 224, 52, 36, 227, 123, 210, 34, 170, 217, 78,
-    111, 42, 29, 38, 232, 37, 180, 127, 40, 237, 136, 241, 146, 179, 232, 84, 98, 49, 144, 94, 188, 57, 116, 124, 137,
-    212, 76, 211, 155, 2, 151, 175, 25, 242, 1, 198, 60, 38, 235, 25, 105, 48, 249, 229, 111, 194, 208, 172, 246, 66,
-    80, 98, 15, 177, 92, 111, 4, 186, 32, 180, 58, 207, 7, 26, 87, 39, 141, 192, 121, 123, 108, 32, 232, 251, 122, 252,
-    246, 48, 160, 203, 41, 168, 134, 105, 179, 42, 7, 142, 90, 84, 138, 45, 207, 121, 246, 156, 202, 162, 60, 126, 216,
-    248, 179, 64, 63, 199, 120, 160, 131, 253, 166, 160, 249, 15, 81, 101, 174, 143, 103, 99, 167, 131, 129, 90, 186,
-    255, 165, 194, 216, 26, 159, 79, 252, 162, 194, 172, 210, 44, 103, 160, 109, 112, 170, 34, 185, 123, 110, 68, 16,
-    129, 55, 249, 10, 140, 196, 153, 226, 1, 198, 30, 121, 154, 38, 174, 245, 70, 98, 119, 164, 63, 222, 145, 193, 175,
-    157, 168, 164, 66, 235, 211, 131, 254, 91, 8, 215, 204, 66, 32, 231, 24, 241, 73, 160, 73, 231, 77, 90, 94, 176, 21,
-    197, 170, 245, 50, 196, 90, 2, 208, 14, 163, 158, 241, 135, 77, 88, 4, 169, 244, 142, 163, 238, 56, 193, 243, 201,
-    25, 116, 73, 4, 178, 196, 236, 62, 253, 105, 173, 209, 251, 96, 243, 120, 193, 164, 232, 119, 205, 152, 146, 13,
-    154, 65, 120, 209, 88, 200, 246, 249, 154, 63, 161, 79, 238, 210, 223, 8, 76, 211, 109, 204, 125, 190, 229, 185,
-    190, 172, 244, 188, 68, 26, 191, 181, 28, 226, 75, 80, 204, 241, 162, 124, 188, 58, 165, 237, 144, 238, 170, 32, 11,
-    166, 155, 26, 228, 92, 167, 255, 126, 115, 148, 174, 214, 95, 228, 226, 89, 165, 169, 37, 251, 95, 221, 243, 241,
-    19, 41, 55, 34, 194, 5, 91, 64, 50, 74, 215, 9, 198, 13, 95, 252, 234, 60, 3, 249, 229, 130, 164, 10, 222, 61, 67,
-    110, 28, 5, 127, 1, 80, 114, 93, 174, 162, 92, 233, 6, 55, 89, 163, 205, 228, 69, 252, 240, 210, 96, 143, 45, 3, 17,
-    8, 123, 36, 130, 133, 240, 47, 152, 252, 62, 249, 90, 238, 234, 237, 153, 21, 211, 159, 242, 49, 164, 217, 90, 248,
-    103, 104, 108, 104, 103, 152, 22, 82, 212, 205, 185, 121, 5, 148, 193, 210, 53, 136, 121, 99, 13, 221, 238, 64, 91,
-    111, 113, 130, 65, 119, 170, 208, 108, 185, 243, 65, 99, 36, 65, 33, 127, 114, 236, 26, 55, 122, 145, 116, 90, 154,
-    50, 76, 2, 218, 32, 195, 219, 96, 63, 96, 67, 255, 123, 161, 123, 32, 159, 85, 134, 51, 205, 23, 132, 227, 125, 231,
-    216, 84, 45, 121, 215, 131, 68, 44, 183, 45, 246, 190, 228, 193, 47, 81, 165, 75, 87, 187, 5, 219, 237, 3, 223, 221,
-    184, 6, 157, 216, 195, 186, 177, 4, 120, 243, 103, 152, 66, 180, 158, 135, 125, 89, 197, 209, 40, 124, 36, 40, 233,
-    35, 116, 132, 120, 129, 78, 130, 153, 78, 191, 22, 163, 210, 10, 101, 65, 89, 42, 39, 115, 182, 213, 68, 138, 41,
-    176, 170, 214, 10, 56, 38, 71, 173, 4, 241, 25, 80, 109, 7, 98, 51, 148, 45, 5, 218, 13, 33, 202, 42, 216, 236, 81,
-    209, 208, 200, 150, 160, 164, 12, 121, 201, 61, 62, 85, 172, 86, 86, 78, 180, 96, 169, 43, 174, 140, 213, 14, 36,
-    57, 153, 204, 92, 156, 78, 200, 107, 99, 23, 170, 59, 134, 229, 30, 51, 248, 187, 154, 17, 181, 117, 133, 90, 73,
-    185, 112, 219, 169, 18, 231, 37, 252, 159, 134, 70, 232, 107, 158, 190, 202, 230, 169, 105, 160, 22, 198, 40, 177,
-    116, 250, 206, 183, 190, 95, 126, 145, 186, 8, 100, 225, 63, 107, 129, 162, 46, 179, 225, 11, 155, 179, 152, 192,
-    88, 75, 250, 33, 83, 19, 135, 253, 10, 171, 247, 72, 28, 92, 255, 238, 29, 232, 43, 225, 133, 32, 174, 57, 122, 156,
-    8, 9, 34, 73, 135, 62, 238, 175, 62, 59, 61, 145, 228, 2, 7, 42, 38, 16, 174, 206, 235, 112, 141, 22, 95, 68, 62,
-    10, 142, 12, 166, 223, 129, 210, 82, 223, 125, 169, 45, 61, 12, 39, 247, 188, 233, 201, 62, 119, 170, 2, 147, 99, 5,
-    130, 116, 90, 204, 224, 26, 23, 6, 174, 115, 176, 119, 155, 145, 145, 6, 90, 98, 233, 134, 168, 0, 198, 162, 117,
-    141, 152, 183, 11, 228, 144, 109, 90, 206, 108, 208, 39, 205, 51, 158, 118, 97, 240, 244, 170, 57, 236, 90, 113,
-    148, 8, 227, 81, 77, 77, 89, 100, 6, 200, 240, 3, 221, 24, 173, 230, 135, 133, 229, 247, 245, 42, 59, 115, 15, 118,
-    139, 39, 63, 181, 75, 108, 213, 96, 134, 207, 97, 237, 154, 111, 93, 24, 4, 21, 128, 136, 112, 168, 64, 217, 220,
-    141, 170, 58, 147, 85, 68, 35, 214, 226, 45, 190, 163, 39, 196, 248, 195, 111, 65, 81, 241, 169, 19, 218, 253, 95,
-    243, 193, 66, 191, 172, 184, 22, 101, 71, 98, 230, 36, 29, 99, 153, 232, 204, 84, 39, 170, 140, 214, 170, 3, 60,
-    183, 142, 27, 5, 255, 52, 116, 21, 157, 106, 79, 148, 58, 167, 174, 193, 108, 183, 164, 145, 103, 92, 163, 241, 41,
-    67, 222, 201, 216, 227, 173, 102, 98, 172, 195, 166, 168, 212, 248, 192, 91, 189, 171, 183, 168, 49, 204, 58, 180,
-    30, 28, 48, 183, 24, 64, 33, 237, 51, 212, 3, 179, 167, 207, 100, 6, 151, 44, 18, 107, 220, 170, 213, 3, 197, 248,
-    83, 102, 66, 179, 104, 81, 217, 179, 134, 85, 192, 40, 159, 247, 40, 149, 151, 136, 191, 250, 69, 253, 220, 97, 211,
-    216, 119, 66, 244, 203, 90, 145, 64, 81, 148, 163, 49, 199, 214, 161, 57, 81, 232, 21, 47, 194, 94, 188, 195, 108,
-    130, 26, 228, 149, 138, 249, 206, 106, 157, 37, 39, 202, 2, 165, 107, 251, 15, 9, 253, 247, 59, 25, 180, 139, 181,
-    235, 241, 249, 114, 20, 136, 71, 182, 211, 76, 239, 75, 156, 209, 19, 72, 85, 246, 207, 118, 31, 25, 11, 65, 13, 51,
-    235, 18, 213, 105, 235, 30, 213, 156, 67, 178, 39, 95, 42, 183, 208, 42, 55, 45, 65, 206, 50, 64, 108, 144, 153, 5,
-    206, 223, 16, 175, 12, 18, 200, 45, 92, 15, 179, 251, 136, 128, 43, 109, 157, 13, 216, 84, 2, 39, 185, 15, 137, 136,
-    229, 22, 112, 89, 47, 5, 41, 29, 111, 251, 82, 32, 189, 69, 139, 126, 90, 71, 88, 68, 93, 19, 75, 120, 175, 128, 53,
-    44, 76, 228, 127, 101, 66, 32, 233, 200, 88, 47, 164, 19, 254, 67, 134, 56, 144, 49, 19, 77, 14, 252, 203, 88, 31,
-    171, 147, 197, 118, 78, 57, 217, 224, 205, 43, 120, 154, 10, 46, 18, 75, 230, 221, 255, 86, 249, 127, 94, 16, 7,
-    198, 79, 159, 242, 22, 212, 47, 251, 105, 200, 205, 82, 58, 121, 41, 170, 146, 141, 132, 143, 146, 78, 208, 217, 93,
-    171, 227, 231, 67, 162, 52, 90, 23, 135, 229, 74, 77, 175, 184, 103, 227, 229, 130, 170, 199, 221, 196, 40, 229, 68,
-    114, 65, 131, 225, 92, 41, 107, 97, 149, 19, 77, 115, 22, 255, 246, 29, 7, 155, 184, 216, 150, 97, 2, 137, 239, 153,
-    68, 123, 246, 205, 164, 76, 205, 7, 207, 108, 77, 208, 229, 247, 201, 113, 228, 10, 196, 207, 36, 149, 159, 172, 97,
-    204, 214, 193, 0, 251, 129, 222, 222, 43, 233, 128, 248, 169, 49, 206, 186, 176, 218, 190, 186, 213, 99, 199, 86,
-    231, 176, 108, 54, 55, 212, 5, 45, 159, 59, 71, 185, 96, 151, 180, 233, 168, 4, 57, 193, 71, 206, 158, 1, 23, 112,
-    229, 0, 76, 69, 190, 192, 144, 76, 239, 52, 121, 8, 21, 182, 252, 113, 77, 153, 15, 110, 83, 16, 165, 140, 66, 50,
-    81, 252, 160, 35, 154, 136, 132, 160, 209, 47, 169, 175, 164, 76, 24, 81, 216, 34, 87, 145, 218, 157, 200, 171, 141,
-    172, 186, 176, 123, 145, 89, 35, 106, 30, 195, 228, 176, 122, 37, 54, 78, 199, 243, 21, 149, 236, 118, 61, 74, 253,
-    192, 1, 90, 162, 25, 245, 90, 14, 128, 154, 99, 238, 78, 131, 209, 90, 155, 15, 133, 248, 128, 179, 85, 153, 59, 40,
-    37, 253, 134, 189, 31, 66, 58, 93, 127, 34, 99, 206, 46, 43, 221, 220, 22, 240, 16, 234, 108, 16, 107, 94, 137, 49,
-    248, 49, 112, 119, 54, 251, 41, 76, 20, 220, 199, 84, 57, 250, 226, 146, 109, 196, 239, 55, 36, 16, 220, 91, 111,
-    217, 239, 22, 109, 251, 201, 147, 147, 50, 106, 235, 228, 177, 28, 5, 98, 63, 146, 71, 31, 145, 62, 171, 109, 0,
-    254, 189, 202, 139, 236, 45, 3, 170, 195, 229, 43, 250, 182, 120, 215, 140, 83, 217, 178, 45, 129, 40, 38, 238, 22,
-    116, 114, 245, 125, 185, 254, 178, 106, 185, 9, 57, 206, 33, 127, 178, 120, 249, 86, 146, 104, 58, 90, 218, 4, 117,
-    119, 193, 87, 194, 193, 143, 149, 95, 168, 30, 116, 136, 38, 43, 245, 153, 161, 23, 51, 24, 194, 192, 212, 27, 27,
-    99, 171, 98, 115, 24, 83, 85, 100, 168, 189, 251, 7, 65, 4, 171, 110, 206, 205, 23, 111, 2, 255, 160, 74, 124, 184,
-    33, 84, 22, 94, 153, 44, 93, 226, 105, 89, 111, 135, 24, 229, 219, 130, 141, 86, 154, 176, 20, 225, 247, 30, 241,
-    26, 63, 199, 125, 204, 220, 112, 95, 101, 132, 212, 23, 125, 137, 92, 58, 203, 11, 255, 234, 235, 216, 183, 19, 123,
-    51, 81, 132, 185, 144, 128, 180, 41, 247, 22, 209, 187, 66, 214, 148, 66, 99, 225, 23, 43, 247, 75, 224, 55, 32,
-    110, 153, 192, 221, 233, 229, 120, 58, 141, 5, 144, 47, 159, 211, 215, 43, 128, 187, 247, 138, 26, 255, 107, 248,
-    224, 170, 214, 80, 209, 246, 235, 246, 210, 221, 112, 84, 142, 136, 60, 16, 132, 168, 54, 128, 242, 88, 124, 86, 85,
-    190, 149, 153, 248, 86, 119, 133, 215, 247, 49, 250, 175, 9, 102, 109, 106, 186, 27, 93, 36, 204, 87, 225, 82, 197,
-    115, 16, 200, 130, 48, 103, 11, 13, 38, 20, 145, 174, 210, 40, 80, 2, 239, 15, 32, 146, 221, 15, 120, 130, 45, 174,
-    250, 170, 17, 178, 11, 143, 247, 35, 140, 47, 114, 101, 87, 255, 95, 122, 178, 80, 83, 59, 147, 18, 6, 248, 21, 192,
-    162, 230, 153, 194, 219, 188, 233, 143, 59, 55, 78, 24, 145, 170, 41, 168, 77, 163, 32, 207, 201, 214, 16, 94, 59,
-    62, 156, 44, 243, 142, 172, 4, 111, 33, 61, 32, 22, 245, 195, 134, 166, 61, 62, 47, 8, 72, 206, 235, 189, 195, 186,
-    28, 33, 200, 82, 167, 156, 135, 203, 213, 176, 106, 42, 180, 116, 132, 240, 174, 208, 57, 247, 124, 15, 240, 241,
-    207, 239, 206, 234, 50, 121, 204, 85, 57, 178, 129, 16, 163, 219, 49, 211, 227, 160, 35, 204, 66, 247, 254, 171,
-    189, 9, 44, 26, 143, 5, 194, 40, 8, 58, 101, 173, 190, 55, 51, 206, 250, 11, 147, 66, 29, 24, 85, 21, 54, 194, 30,
-    132, 108, 83, 230, 163, 110, 51, 77, 107, 81, 115, 110, 170, 169, 150, 156, 245, 159, 227, 16, 202, 11, 97, 215,
-    240, 86, 167, 64, 108, 18, 248, 143, 140, 152, 118, 201, 229, 228, 181, 138, 88, 174, 22, 50, 108, 192, 132, 100,
-    143, 192, 94, 43, 157, 162, 135, 57, 73, 158, 61, 125, 103, 91, 126, 130, 72, 114, 46, 27, 24, 88, 131, 248, 27,
-    239, 46, 101, 131, 61, 14, 229, 124, 235, 247, 69, 100, 72, 43, 116, 193, 83, 107, 10, 59, 230, 203, 185, 237, 165,
-    72, 128, 61, 219, 222, 205, 73, 113, 116, 70, 124, 223, 251, 214, 201, 70, 235, 27, 107, 164, 88, 143, 249, 94, 17,
-    108, 11, 114, 166, 174, 174, 111, 240, 6, 11, 189, 66, 84, 26, 128, 201, 213, 27, 108, 116, 231, 199, 154, 246, 85,
-    197, 236, 233, 169, 16, 21, 76, 34, 23, 169, 228, 73, 170, 210, 92, 184, 185, 62, 156, 137, 62, 130, 108, 50, 33,
-    131, 207, 253, 24, 35, 43, 81, 63, 96, 187, 110, 62, 122, 17, 166, 28, 46, 158, 105, 170, 131, 221, 104, 46, 120,
-    40, 173, 71, 167, 214, 12, 109, 36, 91, 64, 193, 189, 225, 188, 174, 67, 166, 50, 10, 163, 198, 244, 215, 86, 101,
-    41, 99, 166, 246, 98, 91, 165, 228, 7, 185, 136, 193, 166, 205, 53, 26, 211, 216, 38, 96, 204, 102, 250, 216, 195,
-    85, 88, 12, 19, 252, 45, 42, 2, 152, 89, 60, 88, 82, 155, 114, 14, 4, 60, 38, 128, 18, 67, 19, 222, 236, 183, 80,
-    117, 140, 64, 208, 81, 160, 62, 52, 210, 138, 222, 236, 88, 153, 74, 204, 204, 120, 95, 43, 21, 109, 77, 103, 110,
-    117, 22, 180, 223, 159, 200, 45, 62, 88, 237, 200, 176, 2, 44, 98, 231, 146, 60, 153, 28, 0, 112, 170, 144, 98, 98,
-    250, 248, 80, 203, 140, 133, 93, 163, 175, 8, 145, 207, 77, 24, 74, 132, 0, 77, 110, 254, 133, 166, 69, 77, 233,
-    227, 98, 55, 17, 33, 242, 42, 206, 229, 6, 5, 105, 94, 141, 64, 44, 89, 62, 29, 133, 121, 8, 245, 142, 255, 235, 12,
-    42, 94, 85, 85, 77, 4, 136, 221, 234, 54, 24, 14, 172, 238, 248, 222, 14, 28, 202, 157, 101, 14, 159, 90, 232, 13,
-    146, 227, 39, 241, 249, 120, 172, 98, 89, 159, 113, 176, 21, 133, 250, 23, 235, 194, 28, 6, 97, 110, 164, 87, 228,
-    45, 123, 28, 168, 46, 111, 160, 139, 255, 196, 163, 160, 137, 149, 157, 96, 227, 149, 61, 73, 88, 66, 30, 16, 28,
-    35, 236, 132, 92, 195, 214, 81, 203, 193, 158, 177, 214, 48, 135, 212, 58, 201, 64, 64, 129, 68, 112, 117, 149, 39,
-    149, 175, 189, 82, 110, 145, 14, 73, 6, 232, 78, 167, 238, 155, 234, 135, 57, 172, 141, 71, 130, 208, 220, 209, 97,
-    33, 190, 81, 62, 119, 198, 235, 47, 187, 129, 198, 249, 64, 124, 78, 106, 15, 100, 193, 135, 141, 222, 97, 42, 72,
-    219, 216, 152, 177, 130, 39, 104, 255, 107, 32, 7, 99, 190, 200, 51, 251, 204, 94, 117, 115, 208, 54, 1, 29, 105,
-    72, 201, 94, 6, 16, 67, 238, 91, 173, 231, 142, 156, 160, 106, 114, 193, 39, 152, 133, 204, 92, 214, 97, 145, 248,
-    49, 144, 112, 114, 192, 43, 248, 249, 124, 249, 45, 99, 211, 199, 176, 3, 186, 152, 106, 136, 128, 248, 207, 63,
-    120, 201, 68, 128, 31, 125, 147, 49, 175, 107, 13, 144, 2, 5, 67, 7, 198, 1, 144, 229, 136, 169, 251, 52, 152, 138,
-    156, 145, 223, 208, 102, 40, 45, 152, 30, 217, 26, 134, 238, 187, 239, 154, 45, 30, 59, 243, 201, 90, 134, 81, 244,
-    144, 28, 34, 88, 163, 241, 193, 136, 168, 204, 32, 160, 255, 55, 96, 129, 164, 242, 230, 159, 194, 36, 75, 164, 6,
-    190, 28, 48, 158, 1, 94, 84, 160, 69, 138, 141, 70, 238, 179, 181, 92, 57, 237, 10, 45, 150, 185, 226, 175, 158,
-    112, 109, 243, 242, 70, 250, 148, 31, 221, 67, 207, 132, 232, 199, 232, 213, 27, 183, 28, 149, 82, 155, 88, 12, 135,
-    204, 248, 134, 180, 230, 236, 158, 109, 7, 21, 58, 119, 92, 122, 117, 226, 21, 98, 214, 65, 192, 24, 222, 15, 252,
-    43, 161, 35, 119, 209, 2, 156, 76, 157, 195, 42, 168, 71, 38, 238, 126, 5, 165, 116, 10, 96, 217, 154, 92, 115, 250,
-    124, 184, 59, 175, 135, 59, 65, 33, 155, 246, 116, 239, 99, 153, 52, 162, 137, 197, 146, 174, 10, 195, 179, 54, 247,
-    41, 94, 217, 183, 168, 196, 47, 50, 88, 73, 14, 174, 28, 125, 134, 189, 189, 30, 116, 0, 138, 149, 184, 2, 39, 93,
-    223, 64, 45, 239, 169, 219, 63, 173, 180, 192, 165, 130, 217, 215, 110, 8, 19, 203, 140, 215, 120, 48, 115, 4, 216,
-    60, 183, 163, 59, 164, 175, 46, 195, 192, 118, 47, 222, 174, 63, 122, 10, 54, 93, 100, 92, 240, 13, 195, 34, 228,
-    103, 47, 68, 245, 163, 121, 85, 250, 232, 182, 195, 7, 180, 175, 105, 90, 51, 48, 217, 28, 137, 22, 147, 36, 180,
-    14, 46, 119, 0, 83, 10, 43, 250, 233, 138, 147, 64, 44, 4, 122, 169, 209, 216, 24, 110, 225, 238, 41, 148, 236, 107,
-    49, 93, 127, 168, 25, 210, 57, 122, 119, 168, 39, 112, 116, 144, 14, 56, 76, 27, 42, 79, 235, 217, 10, 121, 97, 148,
-    71, 249, 19, 37, 102, 109, 233, 85, 91, 213, 132, 159, 2, 76, 200, 35, 16, 126, 250, 246, 223, 44, 23, 174, 87, 220,
-    188, 235, 70, 164, 175, 3, 212, 228, 151, 213, 47, 206, 126, 48, 68, 152, 21, 251, 238, 70, 206, 169, 222, 209, 154,
-    210, 22, 198, 228, 63, 126, 230, 134, 154, 102, 134, 107, 151, 211, 223, 48, 47, 165, 46, 24, 74, 171, 4, 84, 248,
-    118, 210, 83, 26, 188, 115, 138, 11, 33, 206, 171, 70, 141, 141, 18, 62, 102, 47, 116, 201, 202, 250, 92, 167, 18,
-    12, 93, 209, 19, 95, 34, 222, 27, 41, 135, 126, 96, 1, 150, 129, 189, 131, 181, 103, 215, 31, 173, 142, 114, 70,
-    151, 81, 234, 7, 216, 35, 98, 239, 54, 117, 56, 173, 57, 223, 243, 31, 21, 217, 189, 128, 96, 172, 147, 81, 92, 116,
-    180, 82, 140, 106, 183, 95, 211, 47, 225, 9, 181, 93, 185, 224, 94, 128, 123, 235, 11, 186, 49, 20, 19, 123, 250,
-    157, 81, 200, 119, 107, 39, 113, 208, 56, 155, 252, 60, 66, 214, 127, 178, 1, 192, 70, 200, 73, 161, 34, 53, 183,
-    194, 143, 60, 192, 67, 110, 133, 153, 215, 164, 112, 55, 141, 108, 123, 255, 14, 135, 185, 126, 207, 169, 236, 128,
-    19, 188, 138, 1, 210, 103, 243, 106, 108, 4, 126, 248, 59, 53, 44, 207, 35, 128, 85, 57, 203, 239, 45, 44, 2, 210,
-    175, 141, 72, 225, 93, 97, 67, 55, 184, 169, 67, 59, 167, 220, 107, 42, 99, 219, 193, 133, 243, 37, 27, 114, 238,
-    164, 31, 153, 135, 70, 93, 144, 229, 43, 3, 132, 245, 101, 231, 187, 73, 169, 70, 69, 84, 82, 53, 230, 219, 216, 6,
-    96, 43, 187, 168, 219, 234, 78, 11, 105, 242, 74, 102, 116, 47, 91, 109, 214, 96, 196, 41, 131, 53, 44, 165, 65,
-    147, 39, 37, 29, 240, 169, 186, 219, 63, 94, 103, 228, 217, 176, 155, 151, 135, 97, 170, 149, 73, 121, 128, 68, 1,
-    83, 15, 235, 71, 148, 84, 4, 7, 136, 223, 92, 179, 222, 61, 176, 50, 12, 41, 56, 219, 169, 200, 225, 83, 111, 27,
-    193, 239, 16, 158, 51, 237, 61, 1, 94, 81, 114, 246, 23, 42, 82, 170, 218, 10, 123, 215, 116, 199, 120, 45, 153,
-    151, 177, 130, 6, 85, 213, 93, 171, 209, 53, 97, 53, 232, 213, 213, 216, 233, 42, 106, 241, 189, 100, 170, 18, 197,
-    91, 253, 247, 156, 56, 255, 142, 69, 97, 49, 118, 111, 234, 154, 58, 67, 250, 86, 174, 81, 193, 201, 150, 122, 197,
-    126, 187, 194, 108, 82, 165, 39, 126, 220, 199, 77, 147, 43, 232, 52, 31, 72, 202, 192, 205, 91, 65, 240, 28, 169,
-    132, 110, 45, 142, 39, 20, 58, 78, 115, 74, 86, 219, 232, 116, 169, 31, 171, 181, 132, 80, 163, 55, 223, 227, 65,
-    202, 19, 89, 6, 60, 98, 244, 10, 238, 244, 202, 31, 226, 208, 29, 161, 38, 187, 96, 25, 47, 204, 18, 96, 231, 42,
-    153, 237, 129, 222, 241, 173, 126, 192, 153, 226, 246, 211, 252, 241, 176, 56, 118, 212, 117, 44, 168, 188, 164,
-    178, 196, 50, 157, 54, 172, 104, 71, 171, 190, 138, 203, 179, 74, 143, 212, 193, 187, 114, 41, 234, 5, 195, 199, 34,
-    196, 57, 111, 187, 37, 6, 3, 227, 42, 119, 51, 248, 127, 43, 220, 107, 106, 198, 192, 146, 92, 140, 129, 120, 114,
-    254, 227, 22, 245, 45, 62, 27, 3, 195, 98, 165, 232, 71, 100, 246, 66, 66, 160, 55, 33, 203, 188, 225, 219, 138, 42,
-    222, 208, 209, 240, 86, 210, 140, 8, 240, 206, 112, 252, 253, 117, 56, 245, 245, 172, 120, 14, 107, 177, 225, 69,
-    246, 134, 31, 141, 140, 227, 4, 144, 183, 121, 89, 182, 233, 187, 201, 3, 42, 230, 237, 33, 49, 199, 183, 155, 116,
-    70, 227, 241, 146, 96, 109, 58, 70, 79, 78, 253, 172, 58, 74, 108, 184, 113, 20, 211, 184, 85, 202, 58, 77, 223,
-    214, 88, 51, 85, 204, 40, 139, 252, 179, 2, 130, 116, 13, 40, 59, 148, 235, 191, 222, 73, 244, 100, 34, 29, 85, 146,
-    98, 236, 5, 196, 35, 218, 21, 123, 48, 83, 98, 79, 119, 208, 248, 251, 71, 73, 234, 252, 233, 109, 10, 61, 148, 11,
-    87, 45, 235, 162, 101, 70, 248, 174, 242, 165, 122, 60, 102, 224, 147, 162, 99, 251, 176, 48, 215, 69, 27, 117, 90,
-    44, 99, 250, 93, 141, 81, 13, 51, 221, 37, 210, 244, 250, 72, 61, 171, 44, 229, 42, 178, 66, 126, 120, 214, 12, 61,
-    250, 99, 12, 74, 181, 94, 113, 2, 114, 10, 95, 168, 251, 194, 229, 3, 147, 219, 35, 186, 109, 133, 112, 183, 216,
-    195, 253, 66, 227, 128, 53, 89, 42, 253, 50, 63, 21, 19, 60, 194, 184, 28, 86, 190, 44, 133, 235, 97, 160, 93, 131,
-    104, 109, 200, 168, 28, 15, 254, 175, 107, 80, 153, 18, 179, 206, 128, 80, 83, 86, 201, 107, 38, 165, 181, 174, 41,
-    162, 171, 129, 250, 59, 196, 41, 96, 155, 118, 24, 200, 158, 161, 188, 22, 147, 58, 21, 161, 167, 11, 65, 184, 39,
-    78, 224, 40, 225, 37, 14, 239, 225, 205, 75, 223, 232, 241, 1, 101, 31, 28, 56, 61, 123, 138, 195, 1, 181, 41, 204,
-    197, 11, 231, 156, 119, 153, 249, 70, 64, 2, 183, 194, 171, 140, 122, 68, 174, 64, 206, 147, 72, 235, 108, 31, 137,
-    112, 5, 72, 118, 171, 189, 174, 134, 19, 162, 65, 238, 109, 168, 173, 99, 132, 205, 163, 234, 10, 176, 28, 248, 80,
-    110, 184, 237, 75, 167, 128, 251, 243, 70, 240, 168, 36, 152, 96, 211, 247, 8, 213, 217, 245, 247, 39, 32, 15, 125,
-    40, 40, 237, 91, 140, 99, 165, 115, 44, 68, 21, 197, 75, 21, 125, 98, 253, 27, 33, 169, 241, 252, 87, 125, 4, 105,
-    11, 60, 29, 108, 37, 10, 9, 164, 191, 210, 24, 4, 73, 164, 136, 250, 81, 128, 109, 78, 137, 9, 212, 76, 134, 38,
-    135, 43, 135, 19, 72, 6, 93, 100, 15, 94, 132, 87, 41, 49, 167, 196, 81, 201, 76, 216, 113, 231, 98, 225, 116, 138,
-    68, 40, 208, 85, 154, 155, 253, 146, 196, 19, 15, 47, 29, 122, 111, 197, 168, 47, 60, 64, 198, 107, 255, 28, 89,
-    120, 112, 103, 60, 233, 0, 157, 90, 54, 60, 116, 65, 209, 201, 27, 156, 241, 118, 164, 9, 135, 132, 116, 115, 9, 69,
-    86, 175, 140, 169, 6, 92, 179, 60, 240, 201, 149, 4, 139, 133, 74, 163, 88, 112, 235, 61, 140, 44, 30, 24, 75, 238,
-    73, 127, 115, 229, 66, 158, 79, 150, 219, 252, 187, 252, 194, 149, 75, 159, 207, 244, 115, 60, 44, 244, 158, 32, 78,
-    32, 130, 42, 151, 181, 217, 230, 86, 110, 170, 238, 59, 119, 51, 119, 17, 38, 102, 145, 131, 104, 65, 106, 8, 131,
-    53, 34, 226, 39, 204, 162, 37, 215, 26, 171, 85, 223, 109, 104, 80, 43, 169, 141, 244, 15, 81, 177, 105, 4, 38, 142,
-    206, 217, 3, 39, 185, 255, 131, 11, 123, 127, 248, 188, 54, 190, 4, 213, 23, 216, 120, 219, 62, 134, 113, 1, 45, 1,
-    213, 0, 40, 20, 195, 216, 41, 60, 241, 214, 222, 37, 135, 246, 216, 116, 151, 61, 32, 152, 95, 16, 43, 147, 229, 48,
-    199, 62, 11, 247, 152, 15, 158, 87, 64, 21, 180, 156, 30, 147, 112, 171, 148, 129, 50, 221, 200, 68, 17, 248, 246,
-    90, 74, 10, 15, 228, 237, 79, 240, 5, 100, 125, 54, 95, 113, 184, 126, 136, 82, 150, 65, 78, 95, 26, 151, 158, 36,
-    47, 121, 192, 110, 116, 163, 163, 254, 181, 127, 237, 25, 83, 181, 47, 38, 213, 170, 81, 61, 72, 231, 129, 193, 193,
-    114, 60, 200, 65, 34, 179, 174, 47, 237, 112, 70, 167, 61, 39, 88, 168, 202, 197, 90, 169, 27, 73, 13, 223, 62, 168,
-    231, 4, 231, 118, 21, 99, 236, 40, 183, 194, 130, 41, 54, 80, 230, 96, 238, 68, 5, 43, 175, 107, 85, 203, 51, 173,
-    6, 116, 50, 167, 237, 157, 205, 103, 57, 157, 89, 150, 145, 155, 54, 148, 223, 100, 243, 113, 169, 221, 63, 46, 164,
-    224, 64, 218, 183, 195, 243, 70, 196, 180, 111, 98, 189, 19, 141, 62, 133, 221, 204, 172, 77, 225, 252, 171, 93,
-    164, 96, 53, 111, 178, 218, 78, 155, 13, 74, 27, 54, 139, 180, 94, 196, 134, 141, 152, 193, 237, 73, 214, 133, 18,
-    246, 63, 26, 156, 221, 113, 49, 64, 222, 89, 255, 27, 188, 132, 18, 87, 135, 71, 229, 205, 236, 45, 90, 72, 47, 173,
-    248, 71, 87, 140, 58, 206, 99, 128, 91, 105, 85, 17, 137, 231, 120, 164, 149, 219, 123, 127, 171, 189, 144, 127,
-    154, 30, 99, 98, 103, 81, 2, 79, 140, 228, 202, 90, 51, 47, 100, 227, 167, 103, 141, 217, 80, 117, 147, 137, 157,
-    138, 26, 127, 196, 171, 4, 22, 158, 12, 164, 144, 95, 30, 50, 185, 88, 216, 116, 253, 137, 65, 148, 205, 41, 46, 35,
-    77, 85, 35, 161, 65, 15, 5, 12, 243, 36, 154, 102, 148, 184, 255, 12, 90, 184, 100, 184, 76, 57, 15, 244, 142, 200,
-    11, 232, 225, 254, 46, 231, 176, 48, 198, 214, 203, 247, 113, 246, 74, 154, 50, 214, 125, 127, 188, 83, 147, 175,
-    251, 178, 166, 182, 160, 245, 22, 64, 171, 66, 227, 157, 4, 161, 179, 68, 255, 14, 230, 27, 40, 35, 176, 123, 125,
-    224, 134, 204, 40, 49, 216, 18, 202, 105, 228, 27, 132, 208, 186, 234, 120, 77, 220, 203, 147, 51, 78, 79, 180, 213,
-    27, 8, 196, 8, 111, 174, 59, 127, 201, 168, 11, 232, 34, 8, 86, 212, 15, 22, 32, 48, 59, 203, 49, 83, 185, 12, 99,
-    211, 165, 167, 157, 246, 21, 150, 22, 83, 46, 135, 115, 206, 233, 193, 185, 93, 50, 133, 66, 122, 41, 158, 28, 35,
-    22, 176, 7, 139, 209, 11, 238, 253, 180, 27, 105, 228, 162, 104, 80, 157, 199, 189, 70, 0, 235, 157, 158, 42, 229,
-    161, 202, 231, 226, 74, 231, 49, 190, 128, 110, 127, 213, 138, 151, 169, 76, 191, 36, 159, 221, 54, 228, 3, 213,
-    131, 201, 119, 103, 176, 66, 56, 206, 79, 247, 44, 110, 171, 21, 204, 70, 6, 25, 233, 58, 141, 13, 112, 222, 137,
-    248, 225, 166, 153, 69, 217, 239, 78, 204, 41, 150, 154, 22, 144, 190, 177, 244, 205, 22, 177, 61, 31, 224, 137, 10,
-    81, 218, 69, 142, 113, 0, 35, 6, 229, 102, 195, 243, 251, 85, 49, 222, 226, 197, 93, 24, 118, 181, 49, 163, 192,
-    218, 51, 230, 23, 170, 147, 236, 62, 206, 10, 233, 114, 141, 238, 192, 216, 114, 225, 5, 147, 89, 101, 69, 86, 227,
-    229, 135, 216, 95, 166, 107, 207, 7, 232, 137, 204, 7, 161, 71, 221, 199, 134, 57, 118, 112, 2, 201, 210, 242, 120,
-    186, 20, 254, 179, 194, 99, 200, 30, 44, 209, 173, 127, 162, 236, 102, 100, 16, 55, 199, 85, 253, 92, 18, 159, 239,
-    222, 209, 185, 153, 222, 240, 194, 159, 91, 182, 113, 77, 253, 73, 114, 162, 101, 90, 160, 49, 60, 71, 211, 205, 22,
-    45, 175, 211, 86, 62, 183, 51, 178, 22, 105, 167, 227, 221, 129, 114, 155, 244, 114, 68, 61, 172, 45, 65, 84, 232,
-    91, 139, 138, 56, 36, 185, 42, 0, 53, 220, 183, 211, 219, 71, 109, 90, 111, 52, 242, 175, 15, 244, 53, 98, 39, 58,
-    229, 226, 14, 74, 135, 175, 186, 4, 232, 170, 17, 165, 35, 123, 80, 14, 242, 29, 119, 137, 211, 172, 107, 109, 119,
-    132, 180, 171, 68, 107, 3, 59, 186, 147, 214, 146, 25, 42, 252, 3, 32, 111, 104, 124, 144, 143, 51, 32, 124, 120,
-    48, 72, 115, 107, 5, 106, 137, 101, 189, 6, 131, 91, 160, 216, 104, 144, 80, 188, 23, 166, 228, 41, 34, 129, 19,
-    194, 230, 178, 228, 63, 16, 229, 83, 66, 103, 82, 167, 86, 71, 24, 61, 115, 40, 220, 63, 162, 233, 189, 173, 43,
-    118, 126, 91, 52, 8, 243, 61, 140, 247, 173, 157, 23, 179, 13, 244, 244, 244, 126, 64, 106, 165, 102, 52, 7, 44,
-    100, 32, 22, 208, 169, 155, 170, 214, 86, 208, 172, 122, 107, 15, 196, 197, 242, 176, 113, 148, 38, 80, 113, 12, 3,
-    217, 25, 126, 70, 128, 200, 177, 59, 31, 207, 237, 67, 152, 172, 89, 188, 190, 137, 100, 19, 33, 141, 42, 37, 249,
-    163, 101, 66, 186, 254, 231, 195, 210, 226, 144, 32, 209, 97, 46, 138, 42, 169, 205, 162, 33, 78, 35, 162, 74, 174,
-    115, 112, 119, 225, 234, 232, 2, 93, 97, 108, 138, 236, 181, 147, 79, 161, 1, 156, 74, 180, 115, 109, 101, 195, 169,
-    19, 172, 195, 76, 43, 81, 228, 169, 213, 106, 154, 60, 86, 213, 60, 0, 31, 255, 101, 100, 172, 92, 171, 110, 118,
-    11, 255, 168, 113, 244, 178, 145, 215, 166, 175, 67, 97, 167, 199, 109, 98, 197, 57, 134, 195, 114, 141, 240, 228,
-    74, 231, 122, 24, 244, 168, 2, 107, 144, 152, 202, 73, 31, 95, 221, 172, 70, 153, 212, 222, 217, 87, 204, 18, 248,
-    41, 186, 238, 202, 69, 58, 172, 12, 221, 35, 197, 4, 132, 96, 208, 192, 62, 248, 156, 221, 64, 27, 201, 186, 250,
-    81, 128, 2, 232, 125, 84, 150, 114, 90, 48, 60, 173, 221, 206, 89, 234, 54, 46, 108, 199, 66, 209, 98, 115, 70, 77,
-    182, 181, 118, 194, 175, 114, 52, 12, 213, 29, 154, 31, 50, 250, 238, 240, 220, 193, 128, 229, 86, 247, 147, 197,
-    128, 245, 245, 66, 89, 48, 126, 34, 12, 114, 90, 202, 189, 150, 218, 201, 234, 219, 223, 166, 110, 39, 93, 253, 133,
-    189, 151, 139, 154, 195, 28, 92, 109, 69, 219, 38, 77, 14, 17, 45, 70, 92, 122, 39, 254, 104, 78, 87, 64, 137, 148,
-    19, 26, 244, 231, 135, 142, 207, 64, 48, 17, 133, 20, 116, 138, 161, 139, 130, 169, 118, 157, 6, 51, 232, 12, 231,
-    74, 149, 192, 196, 201, 44, 220, 247, 156, 153, 162, 118, 20, 197, 52, 75, 99, 6, 42, 150, 52, 31, 225, 250, 71,
-    162, 252, 1, 98, 227, 179, 49, 147, 105, 149, 110, 135, 103, 195, 70, 23, 210, 4, 126, 105, 218, 243, 4, 82, 9, 99,
-    227, 25, 28, 182, 107, 13, 113, 90, 88, 171, 191, 174, 136, 235, 86, 17, 97, 230, 84, 127, 10, 201, 108, 192, 56,
-    131, 238, 171, 146, 192, 108, 119, 45, 198, 171, 207, 79, 131, 252, 152, 31, 207, 88, 227, 241, 139, 109, 124, 43,
-    64, 196, 62, 220, 145, 201, 112, 212, 219, 249, 159, 141, 138, 150, 159, 172, 70, 240, 23, 134, 165, 60, 8, 27, 73,
-    209, 54, 164, 169, 107, 128, 201, 135, 187, 71, 2, 106, 143, 86, 90, 192, 181, 245, 110, 201, 74, 224, 58, 127, 9,
-    208, 238, 5, 203, 113, 18, 240, 197, 40, 131, 71, 233, 179, 242, 149, 97, 156, 139, 75, 159, 243, 148, 56, 244, 244,
-    154, 50, 27, 29, 240, 156, 81, 212, 163, 48, 61, 112, 238, 5, 155, 172, 134, 61, 162, 128, 227, 30, 42, 134, 239,
-    112, 208, 249, 56, 99, 84, 24, 214, 94, 30, 87, 31, 105, 15, 42, 186, 166, 248, 150, 53, 9, 255, 124, 16, 227, 165,
-    108, 125, 31, 11, 60, 182, 14, 219, 1, 149, 129, 234, 33, 105, 222, 135, 21, 247, 50, 17, 172, 14, 43, 167, 183,
-    167, 144, 243, 244, 1, 141, 225, 228, 186, 193, 41, 11, 252, 207, 213, 118, 210, 255, 221, 67, 12, 89, 75, 144, 205,
-    37, 227, 37, 85, 151, 214, 38, 69, 41, 49, 191, 220, 66, 96, 138, 28, 218, 200, 247, 31, 238, 250, 178, 119, 60,
-    127, 187, 180, 37, 13, 138, 125, 157, 73, 162, 195, 240, 171, 79, 56, 5, 145, 49, 167, 195, 126, 232, 59, 24, 21,
-    149, 96, 97, 197, 165, 105, 132, 155, 237, 93, 135, 136, 78, 184, 51, 250, 164, 26, 140, 190, 252, 24, 164, 53, 57,
-    74, 94, 201, 125, 56, 5, 231, 189, 61, 36, 116, 99, 53, 179, 58, 96, 155, 208, 161, 61, 16, 16, 136, 170, 249, 195,
-    197, 31, 101, 16, 213, 23, 225, 96, 42, 32, 79, 178, 206, 33, 236, 42, 216, 156, 121, 250, 175, 5, 32, 13, 142, 20,
-    103, 145, 11, 32, 214, 207, 236, 32, 39, 69, 201, 47, 25, 183, 130, 11, 24, 176, 63, 241, 144, 70, 145, 245, 129,
-    25, 19, 10, 54, 134, 216, 201, 32, 196, 194, 60, 80, 207, 233, 231, 220, 178, 147, 251, 98, 234, 153, 158, 223, 57,
-    201, 50, 1, 93, 98, 78, 22, 218, 225, 120, 26, 12, 187, 159, 16, 154, 142, 40, 114, 53, 208, 92, 24, 42, 47, 187,
-    149, 120, 134, 89, 190, 243, 122, 137, 93, 201, 127, 195, 252, 255, 91, 65, 123, 164, 193, 42, 94, 74, 100, 150,
-    241, 63, 25, 198, 255, 205, 155, 116, 201, 73, 153, 156, 107, 141, 161, 61, 77, 12, 43, 131, 26, 119, 52, 152, 159,
-    168, 43, 185, 207, 184, 174, 240, 143, 212, 26, 215, 246, 145, 123, 198, 237, 109, 157, 178, 16, 111, 116, 196, 131,
-    70, 80, 199, 206, 187, 89, 6, 85, 38, 28, 33, 189, 127, 215, 148, 22, 246, 192, 6, 95, 234, 56, 19, 227, 76, 115,
-    27, 119, 160, 31, 104, 129, 132, 219, 219, 67, 95, 164, 27, 88, 18, 51, 130, 171, 84, 63, 140, 164, 173, 201, 208,
-    27, 218, 166, 192, 153, 90, 156, 115, 46, 20, 21, 235, 212, 87, 162, 185, 125, 12, 219, 139, 0, 196, 217, 126, 190,
-    142, 233, 22, 31, 149, 244, 50, 203, 51, 5, 235, 17, 99, 165, 121, 29, 82, 86, 118, 189, 131, 91, 73, 223, 53, 124,
-    75, 30, 50, 109, 79, 243, 139, 164, 36, 251, 243, 54, 182, 6, 167, 169, 99, 163, 201, 110, 128, 211, 43, 1, 80, 47,
-    60, 55, 58, 53, 55, 4, 76, 80, 242, 125, 43, 80, 53, 188, 156, 9, 164, 5, 162, 194, 61, 146, 59, 62, 167, 2, 56, 75,
-    211, 70, 219, 214, 98, 162, 156, 208, 98, 96, 114, 137, 210, 248, 211, 40, 68, 70, 203, 64, 226, 139, 29, 150, 11,
-    144, 252, 180, 57, 179, 217, 119, 194, 119, 70, 189, 83, 219, 114, 229, 254, 185, 28, 207, 70, 142, 77, 36, 126,
-    201, 232, 86, 32, 57, 98, 95, 137, 203, 182, 13, 47, 222, 118, 74, 245, 169, 221, 98, 57, 146, 101, 89, 219, 72,
-    173, 161, 79, 130, 8, 167, 114, 68, 216, 213, 201, 241, 241, 152, 28, 203, 234, 55, 142, 170, 2, 253, 229, 35, 145,
-    26, 58, 162, 43, 150, 40, 73, 245, 151, 27, 132, 58, 89, 246, 30, 71, 229, 237, 174, 128, 171, 7, 89, 203, 174, 52,
-    106, 125, 38, 10, 210, 18, 217, 145, 12, 18, 140, 51, 103, 134, 110, 43, 167, 128, 177, 171, 157, 38, 34, 242, 183,
-    216, 173, 42, 214, 97, 111, 109, 176, 83, 18, 36, 242, 133, 230, 118, 167, 215, 222, 114, 246, 18, 141, 158, 227,
-    56, 57, 114, 82, 39, 205, 85, 141, 233, 50, 95, 128, 127, 106, 94, 41, 74, 155, 84, 237, 96, 184, 109, 163, 191,
-    251, 121, 223, 48, 30, 252, 215, 123, 235, 86, 130, 232, 106, 129, 86, 95, 223, 235, 148, 34, 121, 21, 222, 138,
-    200, 182, 30, 175, 70, 156, 174, 116, 36, 240, 252, 55, 168, 251, 228, 39, 135, 74, 71, 227, 3, 111, 188, 53, 206,
-    199, 222, 61, 0, 121, 205, 5, 98, 94, 91, 12, 249, 229, 179, 77, 201, 50, 134, 248, 206, 254, 58, 139, 48, 45, 7,
-    240, 238, 35, 223, 177, 220, 110, 70, 31, 16, 84, 224, 76, 160, 121, 213, 118, 76, 18, 33, 146, 239, 14, 64, 115,
-    173, 56, 188, 182, 244, 222, 148, 79, 193, 40, 36, 140, 146, 207, 202, 112, 159, 3, 130, 2, 211, 66, 152, 179, 251,
-    51, 204, 222, 58, 108, 91, 3, 145, 165, 177, 104, 143, 225, 11, 55, 109, 161, 131, 94, 67, 235, 80, 15, 46, 84, 8,
-    110, 66, 232, 122, 201, 13, 15, 47, 100, 224, 158, 89, 208, 170, 250, 23, 156, 151, 219, 205, 112, 117, 207, 185,
-    30, 115, 249, 89, 228, 155, 111, 34, 1, 114, 233, 136, 96, 35, 242, 24, 207, 237, 227, 44, 4, 114, 189, 198, 151,
-    161, 45, 203, 201, 188, 150, 24, 253, 0, 249, 118, 207, 39, 39, 75, 251, 166, 94, 140, 59, 248, 186, 20, 126, 9,
-    180, 175, 176, 141, 33, 157, 25, 211, 125, 107, 199, 37, 171, 49, 173, 254, 57, 140, 253, 69, 40, 161, 250, 232,
-    187, 37, 177, 43, 39, 196, 199, 192, 55, 113, 113, 164, 13, 202, 12, 122, 168, 149, 24, 53, 18, 99, 25, 254, 29,
-    252, 186, 90, 69, 155, 109, 202, 217, 1, 215, 89, 26, 0, 213, 76, 140, 178, 234, 113, 129, 163, 33, 65, 179, 155,
-    75, 82, 112, 18, 147, 245, 127, 194, 53, 44, 106, 95, 169, 22, 141, 29, 217, 254, 111, 183, 11, 19, 159, 246, 201,
-    6, 235, 171, 170, 134, 183, 21, 191, 105, 168, 102, 108, 51, 203, 73, 92, 239, 184, 119, 104, 211, 255, 90, 73, 240,
-    126, 13, 178, 37, 45, 53, 158, 240, 54, 235, 57, 137, 112, 109, 73, 250, 67, 44, 106, 227, 8, 226, 80, 249, 5, 91,
-    94, 207, 126, 38, 40, 157, 236, 99, 161, 255, 143, 43, 178, 161, 197, 135, 247, 186, 33, 141, 161, 80, 155, 32, 205,
-    66, 46, 87, 252, 233, 235, 81, 81, 66, 104, 79, 121, 84, 130, 242, 182, 100, 123, 147, 238, 210, 76, 241, 5, 57, 0,
-    80, 229, 244, 132, 37, 128, 151, 139, 253, 241, 117, 84, 54, 41, 68, 167, 90, 120, 46, 223, 155, 190, 226, 164, 147,
-    224, 115, 248, 198, 117, 218, 126, 5, 28, 77, 119, 152, 205, 60, 96, 124, 2, 175, 225, 2, 138, 54, 75, 173, 170,
-    164, 51, 219, 232, 235, 104, 150, 79, 185, 115, 83, 230, 170, 44, 76, 193, 244, 132, 193, 182, 2, 110, 122, 125,
-    212, 127, 52, 158, 12, 204, 28, 198, 131, 13, 144, 222, 165, 218, 126, 5, 155, 103, 35, 221, 239, 22, 64, 152, 147,
-    143, 43, 240, 125, 102, 100, 237, 213, 92, 104, 254, 150, 157, 5, 115, 195, 70, 234, 154, 77, 137, 57, 126, 214,
-    214, 166, 40, 241, 150, 139, 10, 85, 140, 211, 248, 154, 34, 128, 33, 106, 44, 88, 39, 187, 184, 93, 126, 26, 107,
-    104, 158, 52, 25, 209, 201, 22, 204, 21, 76, 161, 79, 196, 105, 135, 228, 36, 19, 145, 17, 10, 44, 182, 61, 34, 211,
-    203, 15, 255, 28, 128, 105, 1, 97, 95, 155, 21, 204, 36, 225, 48, 230, 249, 36, 207, 183, 206, 142, 63, 218, 51,
-    192, 17, 229, 252, 232, 38, 102, 6, 125, 57, 55, 50, 44, 123, 42, 88, 101, 212, 131, 49, 1, 155, 212, 227, 12, 134,
-    194, 21, 17, 68, 151, 12, 72, 10, 141, 60, 75, 242, 211, 195, 241, 197, 150, 207, 182, 223, 188, 93, 237, 135, 95,
-    225, 174, 174, 176, 174, 119, 139, 154, 104, 13, 174, 246, 45, 82, 199, 19, 228, 227, 21, 91, 132, 42, 215, 252, 66,
-    248, 144, 242, 203, 142, 189, 221, 140, 146, 60, 88, 7, 136, 31, 38, 158, 215, 18, 41, 78, 167, 240, 148, 68, 106,
-    83, 140, 46, 95, 222, 119, 198, 151, 169, 205, 28, 152, 116, 154, 192, 229, 89, 194, 82, 108, 123, 26, 0, 37, 111,
-    203, 149, 67, 179, 157, 188, 94, 254, 233, 159, 212, 108, 138, 58, 113, 214, 204, 114, 52, 249, 196, 104, 120, 207,
-    250, 66, 159, 158, 70, 177, 201, 118, 175, 47, 178, 17, 155, 176, 253, 166, 32, 98, 208, 212, 168, 192, 11, 194,
-    248, 99, 185, 15, 155, 109, 192, 203, 2, 170, 79, 247, 191, 122, 218, 228, 109, 117, 134, 72, 47, 22, 217, 239, 222,
-    240, 121, 237, 125, 236, 27, 60, 170, 182, 199, 187, 111, 227, 236, 57, 131, 141, 162, 161, 211, 239, 228, 209, 43,
-    173, 249, 42, 222, 68, 205, 85, 75, 39, 116, 101, 144, 192, 103, 225, 78, 114, 160, 175, 211, 121, 81, 111, 33, 82,
-    173, 59, 245, 178, 67, 92, 29, 205, 122, 99, 12, 144, 200, 37, 124, 171, 28, 150, 135, 250, 249, 154, 217, 35, 131,
-    80, 128, 96, 227, 190, 51, 91, 37, 159, 154, 57, 180, 229, 155, 14, 241, 82, 240, 199, 171, 66, 206, 244, 118, 163,
-    4, 38, 15, 4, 36, 53, 253, 166, 192, 42, 169, 14, 34, 49, 76, 155, 144, 185, 13, 231, 119, 235, 130, 35, 35, 20,
-    164, 219, 137, 248, 183, 121, 208, 172, 107, 33, 164, 2, 202, 149, 8, 26, 72, 106, 78, 209, 63, 240, 183, 227, 183,
-    217, 56, 112, 94, 135, 229, 193, 13, 168, 34, 12, 70, 203, 106, 194, 131, 141, 161, 31, 93, 225, 86, 128, 63, 208,
-    242, 70, 95, 71, 14, 142, 233, 76, 243, 228, 214, 236, 203, 183, 92, 9, 158, 180, 221, 223, 223, 221, 147, 202, 158,
-    85, 8, 168, 96, 99, 75, 78, 226, 210, 18, 104, 20, 36, 92, 154, 189, 249, 161, 19, 134, 137, 7, 154, 191, 164, 53,
-    235, 169, 181, 41, 197, 36, 77, 228, 26, 108, 104, 243, 142, 218, 122, 187, 78, 133, 154, 140, 21, 13, 91, 160, 147,
-    145, 95, 34, 7, 92, 214, 221, 246, 229, 83, 57, 33, 7, 208, 157, 72, 245, 2, 215, 24, 80, 38, 133, 195, 10, 239,
-    211, 158, 252, 226, 215, 128, 242, 195, 87, 55, 182, 48, 143, 138, 114, 243, 61, 167, 108, 42, 227, 90, 140, 137,
-    203, 163, 81, 161, 103, 153, 0, 164, 20, 158, 71, 205, 196, 109, 185, 211, 22, 25, 37, 229, 15, 63, 203, 222, 184,
-    88, 59, 69, 106, 121, 193, 215, 217, 232, 135, 109, 208, 76, 72, 170, 98, 223, 133, 159, 243, 41, 97, 31, 217, 62,
-    188, 7, 127, 137, 186, 4, 148, 107, 210, 153, 59, 105, 234, 75, 199, 196, 203, 18, 78, 216, 139, 243, 189, 34, 252,
-    192, 174, 45, 24, 140, 232, 29, 1, 22, 41, 143, 170, 244, 121, 137, 202, 230, 148, 223, 56, 65, 232, 98, 54, 7, 70,
-    187, 100, 155, 48, 98, 1, 243, 171, 80, 128, 47, 228, 162, 246, 114, 178, 59, 247, 161, 49, 207, 255, 70, 98, 78,
-    86, 244, 146, 55, 181, 65, 164, 184, 124, 181, 160, 121, 26, 167, 187, 140, 121, 236, 1, 254, 22, 129, 190, 43, 185,
-    86, 72, 86, 213, 11, 104, 25, 192, 244, 5, 28, 196, 16, 152, 249, 2, 134, 146, 233, 169, 2, 128, 73, 170, 253, 133,
-    124, 17, 40, 28, 61, 218, 231, 141, 88, 12, 26, 21, 77, 85, 40, 109, 206, 249, 236, 35, 8, 88, 214, 58, 14, 37, 49,
-    58, 252, 214, 73, 155, 200, 47, 255, 20, 180, 99, 251, 109, 160, 123, 150, 149, 113, 61, 34, 226, 37, 239, 68, 46,
-    154, 124, 228, 221, 107, 28, 87, 153, 101, 94, 216, 221, 48, 42, 127, 5, 187, 116, 177, 122, 6, 201, 23, 206, 33,
-    227, 52, 158, 127, 170, 15, 180, 24, 197, 252, 66, 57, 68, 163, 210, 213, 82, 134, 0, 111, 21, 195, 115, 78, 165,
-    232, 88, 56, 39, 96, 161, 63, 40, 228, 125, 216, 146, 43, 239, 208, 215, 5, 81, 185, 26, 13, 46, 198, 173, 183, 70,
-    215, 25, 85, 6, 222, 218, 185, 232, 19, 153, 1, 162, 64, 94, 95, 83, 123, 108, 154, 33, 36, 232, 214, 31, 181, 169,
-    144, 220, 141, 137, 186, 253, 135, 192, 242, 164, 57, 185, 89, 14, 126, 181, 64, 134, 133, 43, 174, 220, 181, 121,
-    91, 101, 240, 168, 17, 187, 74, 28, 36, 223, 106, 229, 167, 241, 112, 198, 118, 32, 90, 2, 22, 152, 27, 141, 233,
-    155, 18, 231, 252, 152, 56, 24, 23, 125, 84, 7, 113, 98, 33, 106, 54, 40, 202, 243, 180, 97, 135, 117, 92, 30, 176,
-    248, 149, 7, 87, 209, 128, 46, 162, 72, 115, 104, 92, 127, 45, 229, 176, 9, 190, 165, 151, 202, 249, 59, 128, 75,
-    21, 173, 5, 89, 125, 199, 147, 159, 183, 14, 28, 152, 72, 71, 29, 167, 101, 1, 255, 104, 168, 179, 27, 238, 219,
-    201, 207, 227, 199, 59, 193, 240, 71, 51, 126, 201, 224, 181, 182, 26, 53, 199, 22, 64, 0, 97, 163, 126, 8, 188,
-    202, 39, 131, 242, 149, 153, 233, 209, 243, 161, 176, 123, 120, 132, 62, 38, 62, 105, 45, 49, 98, 18, 231, 34, 114,
-    130, 244, 68, 148, 28, 68, 83, 128, 149, 112, 238, 211, 14, 113, 59, 126, 139, 179, 169, 226, 68, 57, 16, 1, 8, 175,
-    253, 213, 132, 55, 254, 81, 41, 208, 116, 44, 250, 167, 255, 115, 189, 193, 65, 19, 194, 235, 13, 221, 206, 102,
-    128, 209, 122, 198, 237, 80, 213, 103, 202, 7, 237, 91, 18, 239, 185, 55, 136, 104, 71, 183, 65, 71, 230, 16, 69,
-    70, 109, 28, 253, 210, 19, 182, 228, 80, 227, 174, 22, 243, 220, 33, 110, 83, 194, 238, 224, 97, 142, 200, 122, 78,
-    43, 113, 128, 197, 19, 42, 121, 209, 204, 127, 182, 95, 135, 195, 98, 83, 14, 211, 122, 160, 112, 27, 198, 250, 176,
-    37, 72, 29, 219, 33, 145, 142, 78, 130, 210, 211, 149, 108, 124, 160, 122, 2, 37, 73, 19, 1, 82, 88, 203, 5, 142,
-    186, 0, 151, 159, 136, 122, 140, 190, 66, 179, 222, 219, 17, 18, 69, 129, 65, 80, 225, 185, 225, 137, 133, 161, 144,
-    251, 173, 163, 51, 190, 253, 219, 68, 195, 186, 44, 130, 84, 84, 85, 6, 126, 94, 216, 82, 78, 161, 79, 219, 203, 0,
-    231, 210, 4, 171, 83, 238, 179, 52, 150, 38, 140, 245, 11, 106, 54, 148, 203, 234, 223, 147, 144, 119, 185, 61, 137,
-    245, 229, 227, 138, 60, 41, 6, 242, 62, 82, 94, 67, 169, 110, 211, 124, 138, 68, 21, 32, 161, 73, 160, 19, 204, 117,
-    124, 160, 113, 100, 7, 175, 39, 76, 72, 91, 89, 54, 47, 42, 60, 252, 90, 142, 155, 44, 175, 240, 28, 149, 8, 99,
-    189, 43, 64, 175, 27, 105, 74, 32, 85, 213, 237, 112, 150, 114, 10, 226, 117, 36, 49, 215, 149, 209, 97, 96, 211,
-    130, 21, 200, 147, 161, 101, 233, 252, 150, 181, 58, 126, 75, 22, 37, 51, 221, 218, 83, 157, 52, 124, 161, 47, 199,
-    24, 102, 5, 219, 61, 231, 153, 73, 20, 162, 233, 103, 199, 204, 96, 9, 197, 248, 178, 91, 102, 169, 193, 123, 124,
-    120, 86, 118, 61, 190, 27, 189, 167, 80, 244, 53, 197, 233, 232, 111, 10, 69, 204, 82, 196, 235, 14, 32, 128, 212,
-    157, 234, 191, 188, 72, 35, 10, 87, 41, 85, 170, 137, 51, 109, 246, 136, 13, 178, 203, 210, 101, 241, 237, 47, 229,
-    103, 167, 174, 200, 150, 252, 44, 76, 24, 119, 216, 163, 154, 23, 108, 203, 150, 159, 139, 242, 121, 40, 180, 133,
-    166, 44, 74, 3, 9, 243, 3, 73, 98, 137, 148, 95, 122, 207, 249, 242, 87, 118, 119, 151, 177, 70, 85, 141, 20, 228,
-    230, 105, 101, 175, 158, 248, 145, 52, 220, 26, 28, 5, 173, 200, 29, 159, 116, 211, 113, 232, 40, 211, 161, 145,
-    165, 124, 119, 148, 175, 52, 183, 109, 104, 92, 180, 100, 215, 136, 238, 104, 78, 52, 186, 196, 20, 146, 171, 19,
-    51, 180, 67, 49, 206, 38, 223, 99, 62, 150, 242, 118, 23, 165, 224, 86, 175, 37, 244, 57, 157, 154, 120, 95, 191,
-    12, 62, 204, 2, 52, 97, 218, 134, 228, 49, 52, 133, 6, 140, 189, 161, 138, 32, 44, 121, 163, 60, 19, 190, 155, 63,
-    56, 242, 177, 42, 43, 208, 209, 9, 104, 121, 225, 114, 225, 131, 243, 78, 68, 221, 42, 140, 153, 106, 100, 3, 22,
-    240, 89, 32, 212, 81, 137, 124, 49, 16, 124, 57, 248, 225, 226, 186, 112, 103, 11, 165, 205, 230, 172, 175, 133,
-    184, 191, 1, 101, 148, 62, 159, 104, 49, 166, 9, 50, 64, 166, 43, 214, 235, 17, 137, 128, 83, 66, 63, 116, 85, 59,
-    196, 110, 217, 53, 116, 44, 236, 255, 10, 236, 59, 225, 12, 35, 161, 176, 100, 56, 221, 215, 246, 173, 254, 69, 130,
-    135, 155, 121, 118, 239, 191, 236, 102, 3, 120, 215, 245, 186, 88, 11, 113, 75, 198, 231, 177, 19, 201, 92, 167, 10,
-    108, 162, 35, 189, 25, 208, 56, 6, 78, 48, 239, 118, 131, 190, 204, 28, 177, 208, 119, 167, 133, 111, 191, 221, 102,
-    125, 9, 115, 139, 129, 159, 231, 245, 164, 39, 176, 158, 110, 243, 14, 158, 190, 136, 206, 215, 255, 191, 9, 148,
-    235, 229, 194, 110, 132, 242, 188, 145, 143, 19, 148, 223, 4, 93, 53, 223, 168, 10, 181, 141, 240, 250, 204, 222,
-    239, 171, 235, 181, 126, 208, 21, 182, 82, 216, 70, 45, 111, 248, 246, 127, 124, 144, 185, 60, 122, 175, 192, 12,
-    147, 126, 150, 253, 206, 80, 169, 85, 159, 19, 171, 197, 175, 35, 1, 22, 77, 156, 42, 170, 82, 237, 101, 240, 183,
-    141, 32, 44, 248, 206, 75, 159, 130, 162, 61, 211, 131, 4, 129, 5, 191, 78, 224, 143, 107, 131, 211, 195, 90, 125,
-    159, 75, 157, 57, 245, 114, 97, 106, 104, 224, 20, 62, 122, 152, 154, 226, 92, 249, 12, 176, 138, 226, 39, 220, 126,
-    220, 4, 180, 61, 137, 145, 252, 61, 81, 69, 69, 184, 192, 161, 178, 142, 25, 58, 214, 230, 87, 106, 50, 235, 126,
-    123, 112, 43, 16, 165, 215, 154, 189, 193, 145, 65, 183, 114, 5, 62, 36, 84, 127, 178, 42, 67, 153, 124, 3, 91, 114,
-    143, 69, 83, 71, 171, 128, 8, 95, 173, 254, 154, 13, 215, 130, 37, 188, 198, 54, 236, 212, 55, 223, 196, 72, 197,
-    109, 132, 16, 9, 77, 64, 212, 182, 213, 246, 46, 93, 108, 155, 202, 120, 35, 173, 37, 204, 211, 68, 33, 211, 67,
-    176, 195, 33, 10, 115, 113, 251, 201, 113, 124, 188, 154, 239, 31, 212, 96, 117, 206, 87, 238, 188, 103, 123, 80,
-    91, 203, 127, 119, 220, 139, 72, 242, 228, 10, 44, 122, 33, 103, 11, 214, 33, 208, 243, 158, 17, 80, 231, 225, 192,
-    201, 9, 152, 124, 51, 55, 233, 109, 227, 121, 165, 107, 166, 92, 131, 219, 114, 175, 94, 8, 76, 218, 217, 115, 200,
-    86, 179, 163, 164, 233, 202, 42, 20, 193, 175, 240, 55, 236, 12, 190, 224, 184, 34, 3, 203, 172, 94, 59, 45, 243, 2,
-    9, 102, 187, 218, 135, 178, 62, 23, 195, 52, 180, 11, 182, 49, 159, 101, 52, 86, 96, 51, 13, 67, 161, 255, 148, 108,
-    152, 208, 179, 190, 209, 210, 195, 220, 167, 167, 146, 252, 96, 215, 98, 162, 19, 94, 137, 163, 157, 184, 81, 218,
-    158, 29, 121, 239, 40, 36, 73, 183, 114, 43, 51, 210, 149, 251, 156, 18, 179, 191, 29, 17, 105, 99, 175, 226, 155,
-    34, 78, 253, 230, 78, 31, 81, 163, 191, 148, 80, 129, 156, 102, 241, 115, 106, 68, 101, 118, 40, 6, 91, 4, 218, 182,
-    20, 89, 35, 246, 126, 178, 44, 57, 77, 251, 54, 92, 64, 152, 212, 239, 46, 138, 64, 71, 245, 184, 8, 222, 104, 128,
-    176, 221, 28, 130, 88, 208, 227, 39, 172, 91, 90, 241, 138, 215, 216, 187, 237, 56, 101, 235, 244, 48, 158, 38, 106,
-    137, 93, 78, 76, 1, 182, 245, 242, 36, 228, 117, 254, 120, 223, 47, 205, 37, 142, 70, 36, 226, 20, 129, 233, 122,
-    190, 107, 73, 247, 217, 219, 9, 160, 44, 27, 108, 91, 74, 57, 158, 61, 152, 167, 57, 116, 79, 50, 164, 154, 131,
-    180, 152, 234, 41, 52, 41, 51, 7, 122, 203, 207, 199, 45, 115, 6, 171, 106, 9, 92, 230, 168, 117, 246, 248, 96, 224,
-    44, 181, 230, 209, 249, 26, 63, 175, 78, 220, 187, 254, 193, 158, 209, 112, 32, 26, 37, 17, 188, 82, 90, 127, 239,
-    129, 99, 48, 246, 224, 185, 9, 49, 155, 34, 63, 31, 250, 210, 130, 193, 243, 43, 41, 235, 154, 83, 46, 4, 128, 63,
-    204, 200, 12, 70, 208, 25, 199, 111, 210, 239, 93, 77, 90, 71, 157, 31, 207, 138, 169, 150, 13, 192, 139, 41, 218,
-    153, 14, 179, 122, 147, 219, 72, 70, 161, 24, 66, 209, 98, 199, 221, 192, 121, 194, 193, 165, 102, 112, 141, 237,
-    181, 34, 5, 121, 67, 60, 1, 212, 207, 200, 214, 139, 95, 60, 188, 134, 247, 57, 167, 245, 238, 197, 29, 36, 82, 161,
-    109, 191, 187, 88, 81, 69, 70, 32, 64, 87, 19, 111, 181, 232, 232, 161, 164, 69, 142, 152, 85, 135, 33, 83, 180,
-    188, 235, 68, 54, 109, 169, 114, 163, 126, 48, 28, 14, 211, 188, 122, 161, 138, 79, 32, 117, 227, 157, 188, 206,
-    142, 237, 122, 29, 36, 191, 28, 138, 166, 146, 47, 86, 28, 212, 12, 196, 47, 132, 19, 244, 65, 10, 197, 255, 227,
-    75, 43, 53, 109, 32, 31, 61, 213, 14, 141, 55, 25, 198, 148, 60, 165, 182, 74, 71, 163, 121, 241, 57, 6, 209, 219,
-    85, 102, 106, 26, 248, 200, 201, 32, 108, 151, 12, 57, 61, 61, 177, 7, 62, 148, 206, 78, 212, 173, 97, 219, 140,
-    180, 116, 117, 173, 165, 207, 242, 1, 240, 84, 213, 168, 225, 160, 56, 118, 98, 132, 48, 160, 111, 158, 200, 89,
-    131, 205, 124, 151, 241, 73, 227, 162, 216, 84, 131, 99, 198, 142, 150, 13, 238, 46, 190, 27, 142, 255, 186, 112,
-    143, 31, 87, 50, 4, 178, 129, 69, 231, 167, 166, 115, 159, 67, 42, 252, 120, 36, 80, 124, 49, 90, 139, 89, 122, 170,
-    114, 63, 6, 191, 134, 39, 74, 172, 55, 191, 194, 88, 168, 51, 73, 185, 143, 223, 98, 67, 2, 46, 193, 66, 100, 68,
-    110, 169, 217, 229, 115, 72, 230, 224, 41, 114, 243, 54, 184, 132, 179, 0, 217, 214, 131, 177, 167, 117, 141, 128,
-    195, 108, 125, 49, 131, 135, 104, 196, 135, 144, 228, 117, 158, 121, 62, 201, 140, 161, 32, 16, 119, 76, 120, 187,
-    65, 37, 111, 233, 127, 93, 157, 208, 234, 196, 86, 27, 77, 55, 185, 231, 73, 72, 225, 153, 143, 212, 234, 206, 17,
-    58, 98, 103, 182, 20, 177, 199, 180, 105, 221, 242, 228, 241, 65, 20, 228, 25, 79, 52, 238, 26, 245, 166, 153, 110,
-    69, 115, 220, 68, 124, 192, 144, 113, 185, 59, 21, 77, 103, 10, 168, 85, 187, 128, 77, 70, 100, 167, 203, 5, 131,
-    224, 71, 46, 241, 29, 162, 246, 147, 206, 73, 179, 157, 170, 30, 69, 82, 252, 192, 114, 1, 73, 198, 14, 133, 14,
-    149, 20, 250, 179, 105, 6, 155, 150, 9, 146, 229, 66, 72, 103, 76, 212, 140, 66, 52, 194, 49, 108, 237, 229, 188,
-    44, 125, 106, 159, 61, 184, 17, 239, 44, 109, 103, 148, 197, 179, 48, 115, 120, 43, 92, 49, 43, 175, 120, 214, 216,
-    243, 227, 45, 2, 239, 43, 7, 143, 83, 206, 160, 17, 205, 198, 192, 132, 217, 139, 177, 220, 55, 251, 76, 226, 206,
-    246, 199, 203, 67, 222, 160, 128, 235, 133, 33, 63, 232, 69, 61, 80, 231, 162, 165, 33, 145, 54, 144, 215, 117, 160,
-    59, 126, 139, 41, 128, 37, 118, 2, 207, 168, 185, 145, 184, 138, 114, 107, 240, 183, 100, 178, 232, 49, 116, 232,
-    52, 82, 29, 178, 240, 141, 65, 0, 241, 154, 133, 88, 40, 219, 162, 0, 76, 219, 44, 96, 38, 114, 52, 73, 253, 5, 10,
-    108, 5, 119, 70, 12, 185, 10, 210, 199, 120, 220, 90, 211, 17, 164, 103, 156, 60, 13, 96, 176, 163, 236, 102, 155,
-    67, 58, 199, 239, 101, 253, 203, 182, 0, 39, 187, 19, 250, 229, 220, 115, 254, 197, 94, 250, 107, 144, 194, 184,
-    252, 183, 245, 65, 37, 191, 0, 95, 157, 202, 193, 215, 199, 252, 36, 219, 77, 117, 76, 62, 224, 232, 209, 139, 199,
-    104, 36, 62, 36, 149, 163, 67, 179, 139, 161, 74, 146, 70, 42, 33, 6, 208, 250, 125, 169, 70, 124, 118, 205, 68, 66,
-    176, 48, 87, 250, 180, 26, 50, 235, 131, 33, 133, 178, 203, 16, 169, 70, 109, 191, 229, 40, 111, 208, 72, 196, 221,
-    163, 253, 3, 50, 249, 33, 138, 4, 42, 89, 145, 206, 70, 13, 49, 0, 47, 177, 230, 15, 122, 160, 251, 217, 182, 132,
-    97, 30, 62, 70, 62, 234, 43, 49, 140, 12, 126, 210, 232, 90, 53, 86, 151, 135, 46, 253, 40, 153, 167, 147, 188, 217,
-    24, 97, 203, 110, 140, 63, 58, 27, 241, 140, 192, 4, 114, 68, 79, 33, 155, 20, 16, 88, 91, 120, 25, 61, 46, 123,
-    217, 252, 235, 226, 195, 86, 215, 120, 129, 141, 49, 174, 10, 171, 154, 173, 191, 215, 111, 0, 166, 139, 229, 232,
-    178, 1, 2, 116, 138, 151, 69, 96, 217, 163, 251, 92, 7, 93, 138, 249, 38, 81, 112, 216, 129, 172, 22, 219, 138, 1,
-    126, 186, 64, 155, 167, 216, 81, 100, 125, 231, 232, 3, 50, 206, 187, 224, 238, 147, 215, 78, 117, 109, 85, 237, 33,
-    28, 111, 250, 0, 140, 204, 15, 72, 6, 212, 86, 252, 223, 194, 66, 78, 94, 130, 235, 127, 13, 73, 192, 189, 156, 176,
-    106, 39, 108, 60, 178, 26, 40, 160, 189, 170, 226, 45, 74, 158, 93, 89, 26, 92, 237, 168, 192, 12, 97, 166, 254, 15,
-    51, 161, 93, 63, 188, 37, 235, 136, 88, 173, 55, 158, 200, 206, 224, 214, 169, 24, 53, 11, 51, 46, 130, 79, 59, 58,
-    1, 78, 58, 54, 174, 205, 21, 68, 88, 53, 21, 131, 222, 186, 141, 161, 238, 122, 150, 222, 26, 169, 127, 232, 141,
-    32, 75, 136, 230, 108, 210, 132, 25, 202, 173, 0, 51, 237, 192, 185, 71, 146, 158, 68, 101, 191, 99, 205, 56, 3,
-    250, 40, 18, 207, 15, 213, 17, 148, 198, 88, 60, 233, 229, 139, 18, 10, 81, 232, 238, 31, 190, 147, 90, 176, 95,
-    164, 46, 4, 142, 173, 32, 136, 77, 70, 54, 52, 188, 253, 45, 173, 134, 237, 158, 142, 217, 1, 244, 95, 168, 37, 100,
-    183, 235, 249, 167, 218, 219, 234, 82, 222, 77, 155, 217, 142, 153, 152, 21, 251, 208, 124, 96, 9, 241, 246, 179,
-    250, 232, 142, 12, 119, 139, 178, 78, 98, 46, 241, 105, 97, 237, 72, 138, 67, 173, 198, 112, 47, 224, 128, 12, 217,
-    83, 193, 22, 167, 137, 55, 212, 162, 73, 202, 128, 180, 229, 65, 132, 18, 171, 188, 184, 16, 220, 84, 197, 185, 225,
-    92, 122, 252, 7, 0, 206, 86, 124, 101, 177, 96, 236, 209, 125, 226, 50, 116, 84, 116, 177, 228, 179, 16, 171, 238,
-    220, 246, 20, 109, 179, 40, 85, 194, 29, 32, 138, 183, 191, 179, 79, 115, 43, 66, 122, 88, 125, 19, 21, 144, 116,
-    108, 89, 99, 35, 60, 221, 185, 225, 101, 22, 114, 160, 138, 44, 191, 33, 190, 43, 190, 29, 221, 145, 239, 178, 131,
-    222, 66, 206, 149, 190, 221, 155, 155, 224, 58, 246, 203, 157, 246, 68, 137, 23, 38, 77, 199, 2, 201, 183, 113, 210,
-    120, 25, 158, 131, 151, 25, 192, 159, 243, 171, 103, 255, 213, 15, 60, 249, 168, 6, 237, 136, 36, 30, 184, 113, 86,
-    60, 77, 103, 13, 52, 65, 253, 54, 236, 156, 178, 133, 237, 244, 107, 152, 249, 53, 157, 122, 139, 83, 75, 6, 164, 0,
-    109, 10, 227, 40, 247, 160, 153, 91, 100, 101, 32, 51, 24, 72, 219, 4, 36, 81, 144, 22, 216, 221, 87, 97, 54, 93,
-    132, 66, 206, 218, 7, 179, 99, 236, 2, 27, 94, 182, 134, 138, 251, 188, 82, 127, 155, 229, 6, 221, 226, 237, 105,
-    26, 70, 103, 218, 120, 17, 19, 145, 212, 247, 97, 22, 223, 91, 89, 14, 81, 182, 135, 112, 131, 195, 215, 208, 33,
-    49, 154, 70, 18, 95, 108, 47, 10, 17, 68, 183, 54, 197, 95, 29, 68, 40, 81, 8, 155, 189, 137, 220, 17, 138, 240,
-    251, 216, 74, 174, 41, 154, 97, 73, 6, 8, 61, 57, 252, 209, 244, 28, 79, 123, 146, 30, 241, 161, 136, 172, 35, 153,
-    237, 6, 205, 105, 20, 236, 91, 173, 195, 58, 89, 134, 95, 150, 3, 99, 118, 226, 46, 176, 56, 143, 163, 57, 236, 160,
-    65, 88, 4, 121, 196, 60, 65, 23, 198, 70, 129, 30, 58, 143, 55, 134, 89, 23, 223, 19, 188, 0, 19, 36, 65, 199, 231,
-    148, 32, 21, 101, 185, 216, 21, 160, 90, 19, 92, 229, 253, 142, 109, 70, 113, 94, 245, 66, 95, 201, 134, 224, 60,
-    177, 184, 128, 7, 17, 157, 226, 69, 186, 250, 20, 200, 154, 97, 115, 141, 199, 27, 86, 115, 50, 128, 233, 158, 2,
-    199, 204, 141, 127, 104, 161, 222, 165, 155, 179, 157, 9, 106, 195, 130, 182, 131, 36, 226, 86, 223, 173, 96, 212,
-    118, 58, 198, 1, 135, 27, 47, 175, 109, 238, 153, 44, 85, 155, 207, 158, 248, 246, 247, 107, 205, 71, 141, 69, 21,
-    123, 6, 149, 100, 138, 134, 153, 4, 95, 57, 229, 209, 220, 75, 7, 126, 208, 108, 232, 43, 38, 84, 15, 139, 111, 178,
-    130, 123, 217, 203, 102, 92, 132, 206, 225, 178, 126, 204, 52, 199, 46, 153, 43, 8, 79, 117, 32, 38, 64, 91, 116,
-    25, 103, 13, 249, 6, 249, 182, 205, 234, 101, 247, 244, 56, 46, 55, 50, 115, 66, 155, 48, 238, 34, 171, 147, 244,
-    175, 250, 145, 8, 163, 43, 129, 192, 196, 93, 72, 121, 69, 63, 6, 195, 117, 108, 41, 180, 135, 202, 58, 158, 160,
-    168, 179, 5, 46, 76, 186, 52, 211, 19, 255, 238, 119, 249, 244, 6, 62, 65, 222, 139, 210, 118, 78, 169, 158, 49,
-    244, 119, 142, 57, 20, 217, 110, 252, 237, 53, 73, 204, 226, 81, 38, 94, 59, 212, 33, 100, 240, 123, 117, 233, 25,
-    164, 155, 81, 117, 18, 122, 216, 18, 219, 125, 195, 237, 105, 29, 34, 133, 15, 18, 191, 189, 164, 9, 16, 133, 87,
-    60, 209, 134, 197, 1, 243, 169, 70, 199, 48, 75, 30, 156, 105, 210, 245, 247, 76, 147, 55, 182, 11, 214, 101, 94,
-    112, 218, 158, 20, 171, 243, 218, 205, 53, 224, 51, 226, 150, 13, 170, 7, 151, 81, 151, 12, 219, 103, 214, 13, 216,
-    254, 21, 64, 34, 45, 110, 57, 97, 140, 222, 173, 187, 165, 85, 78, 200, 13, 6, 21, 132, 222, 192, 87, 250, 236, 46,
-    7, 241, 118, 69, 41, 189, 32, 59, 196, 73, 25, 100, 174, 141, 135, 204, 7, 134, 241, 50, 193, 23, 47, 252, 240, 195,
-    216, 22, 161, 123, 166, 55, 60, 47, 192, 6, 209, 205, 19, 175, 106, 203, 27, 37, 177, 144, 249, 25, 113, 132, 248,
-    107, 46, 189, 172, 181, 217, 99, 228, 139, 78, 163, 10, 97, 1, 96, 148, 204, 235, 0, 236, 155, 160, 134, 90, 104,
-    104, 230, 179, 224, 164, 28, 137, 61, 132, 102, 62, 223, 82, 115, 129, 54, 92, 188, 29, 145, 131, 80, 208, 4, 62,
-    203, 60, 73, 148, 83, 167, 210, 84, 69, 42, 83, 102, 181, 217, 57, 219, 184, 55, 101, 44, 41, 9, 151, 172, 216, 188,
-    40, 175, 200, 153, 44, 128, 221, 220, 39, 238, 78, 110, 184, 192, 140, 215, 32, 84, 82, 27, 248, 86, 209, 134, 58,
-    62, 95, 35, 244, 76, 87, 195, 29, 136, 170, 230, 189, 29, 118, 108, 47, 150, 132, 147, 237, 19, 202, 76, 125, 209,
-    109, 18, 64, 94, 133, 109, 246, 215, 231, 22, 217, 69, 91, 79, 16, 108, 120, 225, 156, 67, 211, 192, 238, 169, 8,
-    75, 77, 249, 136, 55, 235, 92, 216, 60, 23, 233, 74, 193, 110, 35, 64, 180, 187, 2, 140, 180, 176, 9, 82, 139, 36,
-    54, 31, 235, 148, 87, 39, 29, 147, 208, 138, 245, 214, 78, 5, 219, 109, 236, 56, 9, 227, 203, 91, 78, 136, 37, 206,
-    252, 76, 7, 22, 59, 3, 203, 215, 119, 170, 189, 247, 213, 123, 94, 117, 212, 16, 218, 165, 228, 117, 125, 243, 192,
-    47, 158, 95, 223, 69, 221, 249, 230, 163, 181, 217, 217, 111, 73, 63, 135, 164, 7, 16, 81, 61, 219, 158, 102, 198,
-    157, 146, 226, 70, 183, 109, 92, 158, 113, 61, 16, 158, 40, 100, 197, 191, 100, 95, 31, 175, 26, 206, 137, 146, 115,
-    2, 121, 250, 140, 178, 220, 252, 178, 10, 189, 167, 231, 240, 135, 81, 158, 170, 146, 17, 234, 160, 89, 5, 241, 40,
-    11, 186, 159, 148, 173, 25, 192, 230, 136, 84, 98, 151, 220, 25, 202, 216, 95, 4, 132, 102, 134, 226, 73, 226, 19,
-    22, 189, 126, 96, 218, 217, 17, 151, 137, 243, 31, 196, 53, 94, 52, 208, 136, 150, 75, 231, 184, 189, 18, 7, 176,
-    95, 221, 82, 115, 251, 68, 16, 107, 121, 34, 62, 5, 206, 95, 133, 34, 75, 86, 96, 85, 114, 34, 181, 34, 139, 31,
-    179, 123, 101, 166, 179, 235, 155, 52, 5, 128, 133, 127, 122, 249, 101, 245, 5, 141, 214, 203, 168, 61, 26, 225, 78,
-    112, 234, 241, 53, 80, 202, 33, 26, 164, 165, 121, 3, 209, 168, 234, 214, 20, 144, 152, 225, 162, 245, 19, 160, 31,
-    152, 125, 27, 192, 241, 55, 74, 217, 184, 173, 175, 162, 29, 158, 138, 86, 73, 73, 33, 32, 92, 117, 1, 48, 134, 12,
-    135, 35, 129, 246, 248, 164, 11, 27, 248, 53, 34, 77, 90, 0, 174, 3, 234, 85, 94, 69, 8, 204, 120, 102, 102, 236,
-    252, 193, 243, 16, 169, 131, 159, 3, 15, 130, 95, 213, 64, 251, 53, 60, 12, 86, 218, 217, 47, 233, 222, 28, 228, 10,
-    20, 227, 133, 251, 187, 39, 51, 13, 185, 208, 142, 89, 117, 73, 245, 252, 150, 102, 139, 83, 87, 187, 53, 86, 175,
-    224, 25, 41, 245, 157, 2, 34, 167, 141, 95, 35, 151, 63, 113, 66, 230, 96, 0, 110, 30, 179, 176, 185, 220, 37, 136,
-    58, 80, 239, 66, 0, 47, 246, 160, 227, 141, 241, 181, 173, 70, 226, 65, 209, 200, 213, 0, 110, 135, 123, 193, 191,
-    63, 66, 122, 211, 208, 217, 198, 255, 209, 225, 32, 216, 119, 171, 20, 18, 146, 235, 17, 179, 173, 130, 35, 69, 11,
-    10, 138, 134, 37, 138, 212, 160, 229, 134, 68, 41, 194, 24, 214, 151, 0, 56, 136, 185, 169, 215, 182, 109, 79, 196,
-    118, 232, 4, 41, 170, 108, 188, 52, 203, 127, 23, 68, 68, 9, 133, 194, 231, 253, 81, 37, 156, 111, 162, 135, 143,
-    57, 183, 61, 7, 148, 188, 59, 115, 132, 240, 166, 83, 56, 180, 70, 140, 2, 91, 168, 89, 155, 187, 224, 210, 130,
-    201, 18, 95, 111, 120, 249, 61, 63, 120, 24, 154, 36, 90, 122, 154, 248, 63, 251, 21, 97, 90, 228, 82, 174, 153, 50,
-    48, 90, 59, 54, 93, 38, 140, 247, 228, 98, 85, 18, 227, 117, 22, 20, 142, 129, 87, 155, 170, 240, 9, 125, 169, 254,
-    30, 184, 196, 13, 242, 120, 245, 42, 82, 132, 144, 145, 184, 131, 186, 220, 6, 223, 237, 153, 27, 237, 241, 97, 113,
-    152, 112, 14, 116, 73, 236, 226, 130, 104, 175, 253, 29, 21, 115, 78, 203, 231, 150, 145, 201, 63, 253, 138, 47, 60,
-    163, 167, 49, 62, 117, 101, 110, 65, 104, 64, 102, 115, 194, 245, 175, 142, 249, 247, 114, 40, 168, 115, 35, 182,
-    40, 157, 77, 64, 210, 224, 160, 121, 245, 122, 57, 196, 249, 93, 53, 100, 166, 191, 14, 172, 210, 103, 94, 134, 176,
-    98, 33, 142, 1, 132, 62, 191, 205, 72, 222, 230, 197, 122, 139, 123, 187, 128, 199, 235, 172, 178, 30, 48, 145, 226,
-    8, 218, 51, 45, 36, 144, 201, 111, 181, 70, 200, 241, 124, 118, 136, 117, 186, 37, 249, 101, 227, 70, 88, 223, 223,
-    105, 118, 201, 104, 237, 101, 197, 163, 171, 180, 37, 30, 89, 176, 20, 174, 210, 96, 68, 53, 3, 227, 72, 185, 154,
-    139, 40, 167, 201, 8, 36, 77, 32, 185, 140, 224, 76, 182, 84, 247, 180, 180, 42, 88, 241, 16, 237, 136, 159, 16, 62,
-    157, 196, 98, 78, 239, 70, 102, 42, 5, 168, 63, 65, 36, 2, 237, 52, 81, 78, 90, 191, 184, 50, 95, 252, 42, 219, 64,
-    67, 161, 209, 196, 143, 12, 181, 69, 235, 200, 188, 93, 65, 216, 202, 135, 119, 176, 235, 32, 234, 89, 38, 214, 160,
-    215, 198, 28, 189, 138, 188, 129, 160, 192, 53, 180, 226, 70, 2, 241, 205, 179, 5, 67, 6, 209, 129, 168, 242, 197,
-    132, 150, 16, 132, 242, 154, 9, 90, 246, 19, 170, 219, 55, 110, 144, 189, 197, 234, 103, 175, 95, 77, 129, 238, 117,
-    171, 169, 125, 154, 234, 18, 242, 45, 185, 50, 156, 120, 34, 219, 243, 41, 63, 167, 22, 53, 98, 174, 186, 202, 140,
-    64, 48, 17, 48, 181, 33, 250, 251, 86, 77, 33, 78, 116, 255, 165, 196, 88, 236, 182, 96, 157, 137, 220, 163, 67,
-    211, 221, 115, 94, 155, 129, 97, 36, 209, 229, 138, 238, 249, 20, 146, 182, 227, 64, 202, 189, 108, 37, 118, 76,
-    105, 58, 216, 240, 112, 137, 227, 172, 119, 243, 61, 36, 114, 125, 73, 255, 217, 58, 181, 230, 246, 185, 245, 187,
-    23, 144, 205, 231, 147, 197, 87, 247, 44, 159, 142, 28, 187, 5, 167, 106, 32, 100, 244, 131, 198, 104, 68, 242, 19,
-    34, 163, 200, 71, 7, 127, 139, 26, 60, 14, 234, 218, 227, 206, 95, 61, 135, 237, 73, 12, 8, 200, 159, 170, 128, 208,
-    179, 93, 194, 17, 55, 104, 1, 191, 39, 210, 202, 189, 103, 101, 239, 229, 126, 230, 2, 0, 90, 99, 193, 84, 248, 239,
-    141, 19, 119, 23, 85, 188, 45, 178, 11, 183, 16, 11, 230, 176, 103, 246, 64, 150, 238, 65, 7, 175, 103, 161, 127,
-    141, 125, 202, 75, 81, 189, 14, 169, 43, 215, 246, 203, 24, 228, 63, 226, 217, 83, 235, 40, 151, 122, 188, 248, 38,
-    79, 241, 142, 70, 0, 163, 170, 216, 185, 29, 74, 201, 39, 32, 188, 206, 141, 82, 73, 7, 45, 81, 112, 196, 56, 196,
-    153, 249, 81, 95, 104, 234, 246, 13, 69, 141, 212, 163, 48, 144, 4, 115, 2, 141, 13, 194, 229, 169, 196, 161, 29,
-    210, 156, 69, 107, 32, 1, 97, 45, 198, 205, 62, 120, 159, 56, 5, 72, 44, 138, 207, 1, 140, 36, 13, 252, 101, 73,
-    127, 153, 174, 217, 95, 225, 53, 233, 249, 31, 244, 233, 218, 113, 168, 142, 255, 113, 88, 43, 44, 194, 67, 197, 15,
-    201, 78, 14, 238, 122, 126, 13, 205, 233, 62, 78, 220, 120, 87, 84, 112, 90, 158, 48, 80, 137, 69, 244, 127, 180,
-    248, 194, 89, 12, 160, 166, 111, 154, 248, 40, 20, 46, 116, 132, 255, 126, 40, 26, 165, 69, 38, 251, 172, 142, 211,
-    91, 212, 84, 47, 154, 177, 248, 38, 3, 207, 56, 120, 25, 151, 182, 36, 112, 196, 97, 200, 109, 106, 211, 30, 238,
-    241, 229, 203, 248, 104, 92, 250, 86, 199, 139, 104, 73, 177, 115, 47, 160, 175, 121, 155, 62, 250, 216, 242, 25,
-    246, 100, 6, 85, 250, 19, 51, 125, 3, 209, 146, 91, 242, 110, 37, 253, 175, 9, 94, 91, 78, 150, 65, 205, 135, 221,
-    22, 22, 200, 237, 32, 101, 160, 58, 18, 181, 104, 207, 52, 71, 160, 188, 144, 139, 43, 90, 111, 243, 69, 46, 219,
-    200, 167, 55, 40, 109, 177, 155, 14, 144, 229, 72, 147, 245, 55, 239, 58, 157, 241, 16, 199, 218, 220, 91, 70, 123,
-    182, 146, 62, 61, 20, 74, 202, 241, 39, 13, 49, 226, 231, 148, 237, 196, 19, 226, 54, 48, 3, 10, 140, 209, 32, 147,
-    9, 142, 253, 224, 92, 58, 136, 10, 32, 222, 98, 17, 194, 249, 63, 72, 93, 103, 220, 50, 64, 222, 163, 127, 145, 108,
-    138, 87, 161, 101, 71, 112, 165, 143, 110, 90, 203, 153, 231, 15, 46, 68, 215, 186, 26, 9, 12, 28, 164, 42, 93, 164,
-    88, 36, 170, 142, 191, 6, 205, 253, 242, 91, 221, 39, 131, 143, 3, 159, 105, 1, 85, 177, 9, 86, 115, 14, 244, 225,
-    243, 28, 132, 129, 175, 124, 66, 7, 166, 205, 104, 37, 170, 245, 87, 249, 37, 129, 12, 117, 23, 244, 215, 171, 180,
-    132, 114, 143, 22, 192, 109, 231, 147, 37, 101, 165, 14, 228, 55, 227, 71, 2, 173, 190, 7, 241, 153, 183, 244, 77,
-    101, 167, 167, 183, 37, 87, 52, 176, 176, 213, 21, 166, 64, 97, 104, 127, 185, 139, 141, 159, 210, 218, 127, 62, 15,
-    253, 83, 124, 1, 115, 196, 63, 147, 186, 112, 134, 164, 137, 56, 138, 30, 210, 53, 225, 230, 202, 105, 67, 166, 207,
-    36, 238, 6, 234, 47, 78, 144, 148, 46, 125, 192, 102, 39, 191, 12, 168, 166, 198, 27, 53, 98, 204, 218, 50, 208, 21,
-    149, 9, 178, 89, 165, 78, 117, 11, 154, 199, 14, 20, 206, 88, 40, 229, 143, 141, 230, 137, 80, 59, 242, 28, 102,
-    237, 250, 12, 146, 249, 232, 49, 7, 254, 121, 255, 119, 162, 91, 244, 75, 9, 234, 52, 190, 146, 132, 27, 152, 6, 45,
-    147, 88, 80, 11, 133, 233, 141, 38, 22, 120, 39, 36, 135, 127, 137, 215, 251, 98, 196, 139, 196, 213, 15, 224, 220,
-    87, 130, 91, 70, 237, 135, 184, 6, 83, 54, 156, 145, 192, 152, 45, 147, 49, 206, 44, 247, 41, 169, 50, 160, 116,
-    168, 138, 74, 177, 193, 72, 211, 16, 114, 168, 140, 16, 161, 65, 89, 84, 22, 49, 230, 11, 35, 65, 1, 90, 9, 100,
-    114, 242, 154, 80, 85, 254, 81, 243, 200, 230, 120, 9, 212, 69, 197, 134, 157, 209, 27, 35, 30, 183, 214, 17, 57,
-    213, 38, 117, 106, 92, 155, 33, 108, 81, 43, 23, 43, 49, 120, 18, 158, 83, 95, 203, 178, 252, 108, 158, 1, 149, 150,
-    67, 106, 115, 148, 128, 208, 68, 167, 252, 203, 76, 225, 34, 172, 25, 167, 88, 108, 160, 72, 163, 98, 6, 239, 98,
-    46, 116, 119, 121, 91, 204, 254, 21, 251, 244, 197, 116, 194, 13, 15, 126, 121, 22, 120, 124, 160, 236, 220, 230,
-    123, 78, 116, 238, 59, 109, 83, 99, 67, 120, 66, 33, 247, 98, 238, 32, 156, 37, 189, 184, 95, 73, 122, 231, 125,
-    233, 244, 25, 212, 217, 176, 198, 44, 241, 118, 33, 182, 233, 47, 28, 250, 114, 74, 74, 220, 96, 77, 168, 255, 219,
-    122, 54, 200, 137, 190, 158, 48, 121, 94, 37, 219, 41, 57, 227, 155, 64, 239, 46, 227, 176, 251, 184, 119, 233, 41,
-    109, 253, 99, 196, 136, 187, 185, 145, 130, 226, 101, 232, 146, 116, 236, 17, 25, 77, 93, 115, 81, 245, 250, 228,
-    184, 167, 197, 41, 253, 95, 247, 70, 230, 226, 207, 236, 69, 200, 107, 104, 83, 24, 126, 95, 92, 243, 1, 64, 88,
-    138, 76, 73, 44, 157, 126, 145, 210, 47, 241, 209, 25, 100, 124, 244, 96, 103, 180, 116, 133, 233, 27, 236, 131, 74,
-    94, 5, 34, 254, 19, 74, 211, 49, 192, 117, 237, 186, 216, 179, 39, 233, 79, 28, 99, 149, 43, 12, 252, 167, 1, 168,
-    86, 230, 204, 180, 18, 249, 206, 24, 116, 160, 37, 142, 54, 13, 205, 124, 213, 114, 128, 68, 250, 188, 78, 47, 250,
-    56, 224, 59, 184, 134, 224, 123, 80, 143, 157, 205, 0, 120, 159, 27, 132, 1, 175, 132, 37, 77, 158, 12, 121, 29,
-    151, 125, 65, 45, 147, 53, 145, 101, 235, 148, 30, 74, 60, 36, 136, 190, 180, 138, 123, 138, 150, 81, 127, 103, 154,
-    193, 21, 82, 40, 72, 42, 26, 157, 115, 205, 8, 231, 119, 115, 146, 230, 39, 201, 198, 79, 145, 154, 9, 182, 208, 43,
-    27, 120, 120, 178, 194, 17, 98, 67, 14, 10, 187, 167, 200, 92, 217, 7, 208, 0, 153, 4, 26, 42, 238, 185, 46, 50, 9,
-    199, 128, 251, 4, 109, 193, 146, 63, 119, 119, 27, 16, 1, 116, 156, 147, 157, 190, 89, 183, 124, 11, 31, 187, 7, 48,
-    164, 85, 121, 38, 235, 86, 173, 216, 190, 10, 141, 166, 173, 147, 178, 9, 176, 243, 90, 122, 243, 32, 121, 104, 171,
-    82, 144, 19, 236, 192, 252, 23, 181, 185, 71, 111, 176, 254, 229, 69, 166, 111, 168, 31, 194, 94, 64, 172, 81, 200,
-    224, 200, 123, 121, 183, 207, 217, 104, 123, 161, 181, 234, 86, 157, 104, 166, 181, 6, 60, 119, 244, 89, 3, 104,
-    104, 192, 136, 175, 182, 61, 21, 183, 83, 190, 137, 211, 178, 78, 149, 95, 8, 41, 25, 227, 106, 132, 43, 12, 162,
-    244, 144, 137, 31, 9, 113, 251, 239, 199, 150, 130, 40, 241, 242, 51, 122, 245, 74, 197, 190, 120, 43, 97, 218, 5,
-    31, 175, 155, 171, 179, 49, 105, 77, 101, 1, 137, 200, 185, 182, 41, 180, 93, 112, 88, 45, 57, 236, 1, 92, 130, 167,
-    61, 51, 83, 48, 203, 53, 70, 116, 103, 162, 218, 212, 3, 152, 224, 221, 87, 225, 79, 203, 209, 161, 19, 21, 155,
-    204, 20, 209, 128, 71, 108, 5, 134, 14, 192, 202, 159, 201, 32, 95, 80, 235, 198, 248, 26, 5, 43, 141, 54, 1, 85,
-    167, 102, 227, 171, 156, 125, 135, 140, 17, 214, 224, 132, 178, 54, 65, 80, 246, 138, 31, 86, 95, 19, 143, 146, 84,
-    204, 118, 149, 51, 55, 141, 135, 69, 65, 155, 61, 106, 168, 175, 152, 239, 19, 11, 138, 121, 129, 169, 227, 137, 72,
-    34, 23, 170, 221, 101, 132, 100, 186, 117, 166, 125, 86, 200, 120, 75, 106, 221, 104, 33, 148, 252, 157, 55, 34,
-    153, 168, 87, 14, 75, 187, 122, 223, 172, 71, 250, 223, 30, 115, 192, 226, 15, 13, 57, 61, 250, 208, 166, 12, 148,
-    62, 3, 3, 6, 175, 183, 169, 233, 108, 39, 161, 15, 249, 184, 197, 65, 203, 215, 89, 168, 96, 105, 30, 70, 67, 5,
-    185, 86, 38, 121, 42, 80, 245, 54, 51, 40, 137, 113, 139, 186, 158, 203, 83, 158, 156, 140, 88, 104, 136, 231, 64,
-    205, 71, 14, 223, 217, 104, 3, 111, 17, 42, 45, 4, 61, 72, 41, 77, 78, 39, 249, 86, 101, 11, 193, 105, 103, 223,
-    232, 212, 5, 208, 25, 78, 168, 65, 193, 58, 141, 164, 86, 231, 89, 126, 94, 216, 14, 193, 191, 110, 70, 115, 60, 66,
-    74, 111, 242, 166, 202, 245, 56, 179, 178, 158, 98, 172, 230, 163, 184, 68, 193, 77, 68, 41, 140, 193, 166, 205,
-    190, 183, 126, 27, 245, 121, 178, 42, 193, 231, 133, 0, 81, 216, 75, 75, 207, 65, 168, 105, 50, 241, 207, 51, 209,
-    228, 82, 194, 23, 238, 150, 164, 108, 3, 126, 19, 28, 92, 127, 37, 217, 223, 180, 250, 93, 231, 123, 196, 229, 12,
-    1, 82, 15, 251, 241, 238, 6, 158, 24, 74, 129, 121, 87, 198, 78, 254, 168, 211, 202, 37, 102, 122, 191, 216, 39,
-    128, 103, 71, 48, 185, 40, 251, 204, 148, 140, 86, 92, 103, 10, 89, 85, 249, 116, 122, 246, 241, 108, 54, 98, 169,
-    88, 116, 46, 92, 109, 35, 18, 210, 252, 238, 86, 221, 73, 213, 17, 44, 57, 87, 235, 57, 100, 69, 122, 81, 34, 200,
-    174, 173, 234, 249, 10, 7, 187, 223, 245, 85, 25, 238, 149, 252, 186, 113, 223, 132, 160, 152, 70, 77, 161, 1, 109,
-    149, 166, 192, 136, 236, 152, 10, 76, 136, 111, 47, 22, 64, 61, 139, 189, 62, 17, 42, 217, 41, 16, 36, 134, 25, 226,
-    146, 62, 139, 129, 126, 221, 159, 69, 117, 133, 61, 204, 253, 79, 157, 86, 75, 137, 87, 102, 97, 80, 76, 162, 24,
-    172, 83, 220, 11, 147, 25, 69, 224, 98, 65, 144, 233, 0, 91, 115, 230, 226, 190, 197, 210, 9, 219, 43, 33, 122, 30,
-    114, 144, 188, 113, 242, 82, 77, 41, 215, 123, 23, 62, 38, 170, 149, 75, 10, 4, 30, 178, 148, 26, 129, 234, 249,
-    180, 148, 72, 93, 172, 52, 75, 85, 45, 150, 38, 44, 85, 89, 47, 188, 158, 22, 118, 234, 118, 234, 28, 42, 136, 52,
-    74, 106, 251, 77, 51, 64, 213, 238, 227, 183, 56, 157, 191, 81, 115, 61, 161, 127, 147, 123, 71, 74, 88, 78, 238,
-    198, 166, 205, 64, 27, 149, 59, 228, 181, 254, 141, 141, 20, 44, 189, 183, 255, 220, 60, 200, 36, 135, 115, 104,
-    162, 152, 195, 120, 170, 90, 169, 171, 46, 174, 101, 170, 30, 157, 207, 50, 222, 255, 70, 139, 132, 17, 135, 37, 76,
-    217, 224, 96, 24, 86, 91, 223, 250, 233, 95, 168, 13, 146, 152, 248, 0, 82, 130, 205, 242, 0, 148, 3, 77, 84, 11,
-    82, 22, 85, 26, 37, 221, 212, 0, 204, 196, 196, 70, 19, 211, 222, 24, 29, 84, 23, 106, 227, 15, 171, 49, 42, 191,
-    102, 127, 52, 84, 163, 229, 99, 100, 200, 12, 94, 147, 229, 96, 248, 255, 220, 172, 0, 224, 182, 216, 184, 112, 158,
-    92, 91, 25, 141, 152, 75, 96, 139, 255, 211, 224, 117, 249, 150, 168, 152, 97, 224, 98, 49, 138, 194, 200, 112, 187,
-    190, 112, 119, 148, 54, 122, 32, 248, 27, 203, 86, 181, 155, 33, 242, 188, 23, 137, 65, 124, 244, 234, 141, 195,
-    245, 199, 16, 24, 116, 90, 239, 247, 81, 104, 213, 106, 238, 227, 167, 28, 215, 157, 70, 144, 240, 234, 248, 48,
-    153, 68, 180, 24, 101, 26, 200, 244, 12, 225, 49, 25, 157, 187, 54, 234, 140, 188, 224, 227, 180, 57, 2, 73, 174,
-    81, 82, 3, 198, 249, 176, 158, 91, 137, 173, 74, 94, 138, 132, 89, 167, 220, 36, 189, 200, 176, 6, 66, 204, 146, 5,
-    78, 175, 28, 112, 124, 205, 148, 130, 189, 164, 186, 183, 195, 193, 52, 166, 148, 179, 165, 122, 166, 139, 163, 1,
-    108, 201, 253, 81, 15, 249, 21, 178, 178, 219, 189, 81, 120, 222, 242, 17, 177, 227, 11, 221, 75, 37, 196, 179, 71,
-    201, 247, 121, 131, 148, 123, 25, 0, 150, 45, 97, 231, 12, 74, 23, 81, 229, 131, 255, 135, 221, 39, 60, 204, 164,
-    164, 214, 185, 176, 78, 109, 104, 128, 48, 249, 211, 27, 70, 64, 98, 7, 114, 66, 13, 52, 34, 80, 103, 136, 245, 105,
-    11, 108, 86, 186, 154, 173, 102, 124, 24, 23, 172, 144, 223, 195, 132, 232, 100, 192, 169, 141, 231, 41, 241, 3, 50,
-    170, 83, 100, 29, 227, 194, 101, 86, 215, 24, 10, 87, 180, 225, 190, 123, 153, 90, 229, 134, 15, 154, 175, 201, 191,
-    60, 226, 233, 176, 29, 204, 44, 167, 240, 9, 215, 72, 9, 88, 135, 133, 116, 125, 40, 171, 237, 255, 50, 234, 235,
-    55, 121, 87, 179, 164, 124, 56, 120, 255, 170, 11, 55, 178, 245, 187, 216, 207, 171, 38, 58, 139, 2, 184, 73, 14,
-    56, 124, 166, 84, 115, 23, 222, 91, 198, 203, 122, 63, 136, 2, 8, 179, 240, 244, 109, 124, 75, 162, 39, 44, 156,
-    232, 159, 44, 147, 24, 237, 193, 46, 32, 221, 201, 41, 140, 244, 13, 53, 222, 229, 132, 170, 39, 173, 208, 200, 41,
-    60, 14, 71, 176, 150, 18, 89, 156, 104, 97, 76, 187, 164, 15, 40, 115, 243, 146, 181, 165, 244, 122, 113, 225, 61,
-    36, 64, 158, 126, 181, 162, 101, 166, 51, 191, 30, 45, 255, 227, 79, 70, 176, 38, 217, 208, 179, 182, 99, 246, 138,
-    231, 5, 15, 182, 217, 118, 105, 95, 24, 102, 43, 5, 0, 245, 58, 253, 41, 113, 255, 174, 210, 47, 55, 10, 163, 181,
-    84, 103, 211, 140, 234, 200, 55, 234, 101, 108, 130, 47, 52, 74, 4, 177, 48, 178, 111, 18, 194, 119, 63, 47, 183,
-    143, 170, 46, 80, 56, 231, 77, 227, 138, 104, 143, 89, 159, 74, 189, 253, 2, 65, 190, 235, 242, 35, 87, 212, 242,
-    142, 177, 226, 41, 14, 113, 140, 0, 129, 180, 4, 72, 30, 230, 221, 184, 42, 54, 30, 112, 159, 162, 101, 11, 0, 206,
-    252, 234, 170, 198, 247, 236, 167, 249, 225, 222, 5, 103, 110, 31, 46, 158, 237, 85, 173, 68, 142, 242, 14, 113,
-    144, 198, 111, 247, 28, 222, 226, 181, 93, 97, 157, 175, 166, 237, 199, 200, 194, 77, 149, 143, 133, 191, 178, 246,
-    253, 235, 133, 97, 211, 8, 105, 134, 22, 210, 235, 227, 92, 28, 195, 25, 79, 116, 94, 228, 236, 160, 149, 82, 114,
-    1, 207, 114, 176, 33, 42, 223, 76, 134, 99, 249, 2, 103, 111, 216, 114, 156, 107, 211, 207, 255, 107, 50, 13, 10,
-    242, 30, 95, 45, 237, 195, 143, 173, 219, 66, 33, 43, 129, 124, 102, 57, 122, 192, 111, 102, 106, 213, 134, 143, 41,
-    18, 232, 118, 180, 159, 19, 194, 200, 150, 229, 165, 53, 61, 111, 10, 8, 31, 184, 191, 162, 26, 178, 123, 194, 49,
-    66, 144, 176, 48, 68, 18, 97, 27, 111, 252, 174, 38, 255, 115, 252, 211, 107, 190, 130, 252, 175, 45, 181, 222, 216,
-    33, 97, 171, 209, 231, 204, 108, 37, 38, 79, 112, 46, 96, 151, 216, 119, 72, 90, 148, 159, 186, 27, 73, 193, 217,
-    66, 73, 44, 161, 136, 26, 12, 247, 234, 68, 241, 167, 20, 166, 166, 99, 255, 3, 16, 194, 190, 167, 72, 220, 146,
-    230, 158, 188, 67, 84, 67, 98, 3, 41, 137, 95, 115, 172, 152, 214, 169, 92, 118, 134, 137, 242, 193, 48, 130, 194,
-    22, 86, 116, 161, 244, 65, 151, 140, 2, 246, 155, 95, 164, 183, 219, 125, 193, 10, 167, 179, 29, 187, 245, 216, 152,
-    28, 248, 160, 83, 183, 232, 57, 83, 77, 37, 4, 96, 14, 20, 184, 13, 16, 119, 81, 168, 77, 183, 147, 87, 183, 65, 22,
-    240, 80, 78, 247, 14, 231, 52, 32, 1, 126, 91, 203, 0, 121, 170, 118, 236, 138, 14, 247, 160, 112, 224, 123, 69, 19,
-    128, 253, 235, 214, 133, 166, 18, 253, 34, 184, 172, 18, 48, 11, 36, 12, 141, 185, 39, 238, 230, 183, 216, 82, 73,
-    35, 234, 112, 128, 220, 22, 127, 6, 187, 211, 200, 214, 126, 113, 119, 171, 196, 55, 107, 238, 126, 233, 246, 14,
-    45, 3, 207, 103, 114, 134, 84, 227, 216, 87, 201, 36, 30, 239, 145, 140, 31, 228, 201, 145, 238, 60, 221, 195, 20,
-    252, 218, 188, 157, 74, 120, 80, 79, 140, 106, 222, 160, 1, 25, 152, 75, 146, 193, 139, 154, 91, 10, 230, 51, 72,
-    166, 195, 47, 93, 163, 113, 141, 220, 228, 95, 87, 27, 25, 143, 240, 181, 79, 255, 9, 12, 252, 17, 222, 211, 166,
-    100, 186, 15, 86, 113, 153, 87, 153, 84, 195, 173, 2, 147, 59, 147, 176, 218, 172, 129, 154, 152, 254, 233, 244,
-    153, 78, 219, 185, 0, 251, 83, 45, 65, 53, 187, 46, 177, 43, 43, 51, 67, 98, 184, 188, 253, 23, 215, 178, 43, 66,
-    205, 106, 118, 203, 99, 14, 66, 32, 7, 59, 171, 147, 37, 98, 184, 50, 178, 201, 70, 114, 116, 175, 199, 93, 205,
-    200, 191, 205, 242, 228, 125, 250, 15, 86, 165, 22, 46, 113, 105, 11, 20, 181, 77, 71, 246, 123, 159, 129, 100, 231,
-    186, 69, 131, 61, 40, 163, 146, 100, 82, 66, 217, 184, 211, 73, 3, 75, 138, 199, 40, 171, 185, 196, 106, 48, 8, 97,
-    15, 170, 238, 90, 191, 106, 194, 84, 182, 200, 136, 194, 85, 29, 101, 30, 100, 84, 60, 149, 50, 168, 87, 87, 188,
-    204, 206, 39, 198, 204, 83, 22, 169, 172, 0, 193, 178, 227, 105, 28, 96, 145, 40, 8, 178, 186, 160, 81, 51, 163, 78,
-    22, 15, 153, 86, 209, 14, 1, 99, 116, 92, 141, 76, 112, 161, 87, 157, 186, 46, 142, 192, 242, 192, 39, 45, 48, 219,
-    226, 39, 106, 144, 156, 113, 146, 227, 183, 84, 8, 26, 44, 207, 95, 164, 149, 17, 164, 200, 130, 201, 123, 75, 51,
-    254, 233, 126, 55, 94, 217, 185, 137, 19, 162, 223, 131, 99, 117, 38, 95, 38, 123, 165, 84, 131, 129, 249, 101, 138,
-    109, 108, 251, 64, 42, 90, 129, 245, 157, 86, 184, 222, 2, 21, 226, 47, 88, 31, 147, 70, 50, 76, 192, 245, 39, 183,
-    136, 74, 29, 145, 251, 188, 214, 3, 216, 68, 100, 156, 52, 188, 99, 72, 3, 70, 59, 83, 235, 149, 35, 75, 45, 33,
-    126, 30, 92, 94, 209, 16, 64, 178, 38, 76, 245, 2, 113, 149, 121, 68, 131, 218, 201, 235, 80, 127, 99, 160, 157,
-    197, 20, 41, 55, 43, 211, 0, 178, 134, 221, 110, 124, 255, 107, 229, 183, 14, 48, 238, 30, 4, 79, 86, 214, 239, 154,
-    180, 95, 171, 116, 6, 221, 27, 57, 231, 250, 192, 27, 91, 37, 2, 121, 248, 248, 35, 253, 167, 85, 67, 52, 177, 97,
-    7, 29, 242, 217, 139, 85, 111, 241, 60, 47, 153, 149, 29, 192, 93, 95, 117, 142, 46, 252, 95, 0, 204, 146, 11, 215,
-    71, 217, 246, 36, 197, 1, 153, 6, 192, 25, 100, 196, 174, 174, 221, 151, 219, 85, 164, 83, 50, 113, 133, 124, 235,
-    84, 135, 59, 199, 90, 10, 226, 119, 188, 154, 178, 8, 205, 230, 36, 223, 86, 38, 50, 17, 247, 119, 194, 73, 187,
-    223, 154, 248, 66, 209, 48, 90, 81, 206, 200, 151, 227, 171, 1, 181, 106, 172, 192, 84, 103, 246, 9, 55, 170, 45,
-    101, 78, 1, 254, 13, 142, 81, 207, 52, 213, 163, 52, 48, 17, 242, 144, 244, 133, 57, 87, 95, 174, 60, 213, 15, 112,
-    66, 228, 231, 120, 165, 30, 120, 241, 223, 138, 235, 190, 175, 97, 93, 102, 226, 116, 174, 194, 187, 86, 244, 87,
-    66, 237, 54, 12, 77, 249, 37, 199, 236, 149, 68, 187, 174, 232, 56, 46, 74, 50, 69, 251, 195, 59, 177, 240, 202,
-    254, 98, 79, 84, 103, 81, 132, 78, 147, 255, 61, 148, 146, 153, 122, 158, 113, 237, 93, 30, 127, 9, 159, 30, 113,
-    176, 61, 183, 143, 14, 84, 116, 85, 166, 230, 159, 234, 135, 79, 75, 214, 115, 185, 37, 155, 218, 225, 119, 2, 66,
-    42, 176, 110, 148, 171, 215, 25, 71, 34, 192, 27, 87, 127, 215, 4, 229, 253, 155, 132, 35, 207, 221, 143, 246, 159,
-    217, 176, 3, 83, 242, 142, 8, 109, 236, 105, 14, 157, 147, 80, 99, 98, 190, 249, 195, 130, 14, 84, 141, 136, 240,
-    216, 99, 217, 60, 72, 226, 22, 116, 66, 158, 69, 230, 76, 203, 172, 197, 193, 24, 187, 169, 214, 215, 95, 220, 29,
-    205, 215, 48, 18, 198, 26, 47, 119, 131, 111, 227, 118, 159, 231, 57, 192, 232, 88, 32, 173, 123, 127, 246, 117, 45,
-    230, 143, 142, 0, 89, 86, 29, 145, 212, 108, 56, 213, 116, 43, 119, 164, 42, 147, 126, 53, 117, 108, 88, 134, 100,
-    37, 58, 136, 1, 3, 7, 74, 140, 98, 138, 105, 14, 229, 219, 41, 94, 218, 131, 10, 8, 176, 140, 162, 225, 16, 112,
-    151, 56, 88, 159, 190, 5, 181, 216, 244, 160, 250, 151, 157, 77, 180, 230, 245, 0, 227, 48, 203, 219, 77, 63, 161,
-    165, 24, 237, 173, 28, 238, 75, 38, 127, 170, 247, 163, 119, 248, 158, 241, 230, 194, 19, 216, 62, 155, 53, 44, 177,
-    249, 139, 148, 121, 205, 176, 250, 19, 253, 197, 53, 4, 79, 206, 170, 88, 57, 145, 159, 52, 189, 102, 156, 68, 100,
-    154, 195, 106, 87, 24, 140, 152, 51, 142, 71, 193, 211, 120, 118, 140, 201, 12, 147, 33, 35, 67, 39, 148, 107, 111,
-    14, 90, 47, 242, 179, 236, 233, 64, 58, 13, 245, 134, 201, 191, 5, 4, 148, 29, 209, 232, 184, 127, 22, 220, 198, 91,
-    180, 11, 33, 212, 159, 47, 106, 136, 117, 121, 203, 246, 111, 99, 184, 194, 54, 167, 207, 167, 11, 72, 242, 150, 90,
-    56, 139, 102, 38, 232, 195, 111, 200, 52, 249, 105, 156, 123, 72, 22, 169, 82, 233, 21, 222, 72, 110, 94, 85, 151,
-    92, 129, 58, 69, 6, 106, 50, 88, 119, 131, 183, 55, 241, 245, 86, 110, 97, 40, 178, 132, 104, 139, 27, 235, 246,
-    108, 54, 254, 137, 235, 176, 114, 189, 32, 251, 254, 159, 60, 220, 182, 76, 76, 231, 251, 97, 150, 68, 61, 153, 32,
-    11, 200, 25, 42, 81, 236, 212, 12, 218, 254, 215, 181, 95, 203, 33, 51, 208, 254, 22, 18, 51, 5, 28, 44, 50, 182,
-    39, 43, 39, 57, 217, 56, 49, 111, 232, 48, 221, 115, 221, 10, 96, 219, 16, 39, 213, 193, 107, 98, 105, 108, 234, 3,
-    251, 11, 242, 238, 195, 53, 138, 228, 119, 81, 216, 176, 161, 166, 246, 34, 58, 145, 8, 137, 31, 163, 22, 132, 98,
-    183, 175, 248, 194, 87, 186, 89, 33, 52, 201, 220, 215, 85, 191, 70, 79, 5, 139, 116, 226, 10, 23, 15, 255, 63, 176,
-    1, 235, 10, 140, 60, 52, 248, 103, 137, 157, 67, 51, 25, 19, 37, 161, 240, 207, 44, 252, 235, 107, 30, 45, 152, 15,
-    66, 62, 215, 221, 172, 63, 118, 92, 233, 252, 25, 85, 133, 98, 197, 125, 210, 206, 110, 249, 183, 54, 163, 238, 127,
-    206, 77, 143, 45, 27, 129, 115, 38, 129, 97, 10, 147, 84, 181, 108, 33, 204, 243, 65, 131, 52, 189, 34, 249, 184,
-    183, 145, 2, 234, 200, 104, 62, 162, 245, 4, 71, 38, 177, 184, 110, 95, 151, 92, 170, 64, 55, 223, 30, 2, 98, 247,
-    188, 158, 224, 100, 47, 149, 126, 11, 80, 236, 145, 75, 124, 251, 202, 231, 82, 96, 201, 45, 76, 190, 150, 200, 130,
-    127, 95, 114, 74, 74, 28, 197, 233, 203, 231, 61, 76, 159, 44, 208, 87, 151, 65, 240, 90, 203, 36, 213, 118, 228,
-    13, 98, 241, 230, 225, 148, 118, 203, 191, 175, 212, 170, 36, 35, 153, 122, 29, 249, 142, 182, 162, 179, 158, 78,
-    104, 82, 242, 182, 253, 195, 213, 96, 149, 37, 99, 50, 106, 28, 36, 201, 105, 16, 107, 151, 122, 198, 209, 190, 7,
-    232, 61, 130, 50, 160, 12, 202, 13, 159, 3, 34, 39, 199, 8, 137, 143, 76, 149, 173, 65, 166, 24, 206, 212, 162, 158,
-    245, 242, 103, 152, 188, 132, 148, 161, 22, 252, 82, 167, 180, 208, 14, 26, 190, 151, 121, 105, 142, 255, 159, 43,
-    18, 228, 219, 246, 51, 238, 9, 72, 114, 25, 202, 98, 181, 23, 84, 82, 255, 106, 120, 40, 252, 74, 130, 235, 86, 211,
-    145, 50, 221, 138, 91, 146, 218, 98, 93, 43, 255, 92, 47, 23, 145, 9, 120, 97, 151, 29, 190, 148, 189, 95, 38, 8,
-    81, 18, 157, 150, 37, 30, 145, 164, 154, 177, 188, 16, 10, 222, 216, 52, 103, 118, 210, 247, 213, 135, 53, 43, 59,
-    253, 47, 110, 69, 96, 150, 218, 225, 157, 117, 109, 87, 0, 242, 96, 107, 224, 205, 66, 120, 230, 193, 215, 117, 242,
-    90, 10, 64, 119, 226, 124, 202, 22, 143, 157, 174, 170, 85, 172, 106, 170, 213, 122, 235, 115, 167, 170, 98, 158,
-    140, 134, 93, 191, 175, 232, 149, 145, 141, 120, 137, 11, 94, 12, 163, 196, 58, 103, 21, 248, 207, 184, 10, 200,
-    132, 160, 47, 13, 191, 181, 208, 51, 62, 29, 38, 171, 57, 203, 79, 115, 37, 139, 33, 36, 58, 223, 32, 254, 20, 15,
-    11, 28, 53, 161, 30, 193, 218, 22, 17, 18, 157, 87, 203, 247, 46, 240, 1, 22, 212, 9, 216, 22, 219, 248, 33, 235,
-    188, 246, 22, 24, 136, 14, 59, 94, 28, 134, 63, 161, 82, 80, 253, 218, 251, 22, 189, 117, 251, 32, 140, 220, 41,
-    218, 234, 61, 246, 243, 214, 66, 163, 238, 125, 173, 49, 36, 37, 221, 109, 114, 117, 144, 21, 89, 87, 163, 238, 155,
-    176, 89, 90, 243, 22, 253, 169, 108, 25, 202, 252, 19, 106, 139, 161, 76, 142, 165, 156, 79, 174, 229, 226, 65, 31,
-    113, 184, 43, 122, 196, 124, 22, 232, 108, 2, 242, 19, 147, 79, 70, 123, 90, 5, 144, 168, 72, 79, 53, 254, 173, 6,
-    90, 32, 34, 167, 15, 54, 173, 220, 102, 58, 112, 89, 96, 109, 101, 184, 29, 250, 153, 57, 88, 143, 111, 174, 113,
-    37, 203, 149, 137, 98, 18, 141, 125, 3, 131, 38, 48, 79, 125, 137, 50, 184, 157, 162, 112, 226, 142, 18, 61, 104,
-    65, 129, 227, 39, 138, 231, 203, 184, 151, 181, 219, 253, 67, 102, 8, 225, 233, 248, 171, 78, 30, 165, 6, 208, 141,
-    14, 96, 170, 126, 182, 173, 34, 247, 23, 180, 62, 218, 58, 134, 99, 59, 92, 253, 39, 69, 87, 73, 137, 109, 22, 238,
-    41, 229, 232, 162, 7, 189, 128, 160, 182, 177, 86, 110, 243, 30, 223, 170, 87, 147, 156, 21, 134, 149, 158, 18, 72,
-    225, 120, 194, 80, 149, 23, 106, 136, 193, 70, 201, 106, 107, 126, 196, 137, 220, 204, 195, 241, 159, 34, 48, 191,
-    157, 63, 69, 142, 2, 159, 202, 45, 244, 226, 214, 147, 112, 244, 185, 141, 48, 253, 186, 16, 57, 5, 49, 244, 24,
-    225, 86, 177, 130, 43, 224, 75, 47, 20, 173, 161, 165, 153, 164, 72, 151, 230, 98, 188, 46, 87, 234, 107, 105, 99,
-    198, 152, 159, 18, 248, 243, 151, 23, 123, 221, 233, 225, 85, 130, 122, 166, 90, 92, 134, 95, 136, 13, 139, 199,
-    188, 252, 27, 2, 71, 39, 108, 130, 204, 233, 78, 101, 100, 78, 2, 126, 175, 126, 242, 49, 209, 146, 205, 199, 27,
-    45, 231, 26, 212, 160, 244, 117, 36, 82, 58, 93, 141, 229, 6, 131, 12, 85, 145, 244, 253, 171, 197, 127, 40, 169,
-    64, 84, 10, 27, 119, 61, 5, 18, 218, 250, 127, 158, 203, 81, 169, 16, 251, 250, 26, 205, 6, 74, 13, 4, 233, 246,
-    128, 211, 216, 108, 176, 27, 151, 214, 122, 194, 168, 208, 105, 184, 111, 55, 158, 74, 148, 132, 202, 116, 129, 210,
-    226, 123, 82, 55, 129, 28, 50, 246, 94, 148, 133, 5, 121, 5, 203, 185, 157, 132, 13, 89, 74, 142, 1, 34, 241, 56,
-    15, 20, 98, 216, 159, 123, 81, 86, 253, 118, 166, 236, 132, 155, 222, 207, 7, 31, 34, 170, 214, 104, 39, 77, 238,
-    178, 249, 33, 103, 91, 171, 95, 191, 254, 197, 49, 96, 211, 223, 89, 186, 211, 17, 93, 192, 16, 238, 38, 178, 252,
-    158, 190, 22, 163, 60, 10, 208, 29, 164, 203, 169, 53, 109, 106, 186, 211, 142, 59, 103, 78, 30, 147, 110, 52, 85,
-    44, 208, 132, 129, 193, 85, 252, 177, 183, 73, 82, 181, 150, 5, 99, 74, 244, 130, 160, 22, 182, 41, 113, 49, 78, 64,
-    67, 191, 148, 108, 221, 227, 162, 254, 27, 148, 177, 134, 74, 41, 48, 110, 106, 214, 201, 44, 31, 76, 142, 90, 227,
-    35, 164, 18, 198, 215, 190, 231, 55, 226, 179, 144, 101, 222, 175, 60, 81, 101, 57, 112, 212, 114, 191, 210, 202,
-    30, 164, 215, 97, 114, 59, 27, 160, 232, 31, 199, 88, 203, 226, 60, 51, 215, 211, 250, 139, 111, 14, 58, 211, 211,
-    108, 194, 105, 254, 227, 128, 181, 7, 128, 229, 248, 213, 37, 230, 57, 135, 32, 72, 87, 236, 253, 219, 82, 206, 157,
-    254, 6, 59, 135, 82, 14, 41, 70, 108, 227, 90, 209, 175, 92, 245, 25, 15, 165, 246, 246, 54, 249, 8, 121, 206, 188,
-    43, 10, 192, 112, 30, 197, 59, 69, 152, 183, 173, 3, 107, 93, 75, 14, 21, 69, 205, 16, 12, 11, 145, 15, 8, 153, 54,
-    25, 233, 75, 135, 12, 80, 155, 131, 140, 237, 157, 81, 147, 139, 150, 36, 98, 63, 142, 10, 74, 66, 20, 64, 166, 109,
-    38, 121, 54, 203, 208, 211, 182, 66, 210, 31, 151, 52, 84, 116, 200, 155, 26, 105, 146, 191, 73, 130, 7, 133, 89,
-    72, 83, 101, 203, 190, 200, 127, 245, 89, 33, 244, 201, 10, 50, 38, 51, 217, 102, 64, 197, 208, 101, 38, 88, 245,
-    85, 160, 135, 86, 4, 162, 43, 180, 70, 165, 234, 67, 103, 172, 60, 76, 6, 232, 100, 253, 113, 171, 27, 228, 228,
-    140, 24, 21, 6, 167, 198, 73, 24, 81, 238, 157, 20, 110, 231, 187, 123, 217, 232, 39, 246, 75, 16, 17, 160, 246,
-    241, 36, 115, 52, 27, 16, 60, 205, 138, 69, 171, 244, 113, 232, 228, 226, 50, 84, 206, 95, 250, 103, 223, 143, 150,
-    146, 46, 17, 89, 46, 18, 217, 232, 75, 137, 7, 244, 223, 162, 223, 17, 185, 213, 186, 66, 39, 25, 68, 1, 255, 85,
-    145, 141, 180, 250, 229, 189, 140, 88, 126, 242, 155, 132, 11, 74, 140, 198, 20, 199, 23, 2, 158, 163, 173, 132,
-    133, 229, 33, 42, 19, 153, 109, 178, 253, 202, 84, 62, 132, 41, 16, 53, 50, 128, 218, 240, 145, 100, 244, 87, 181,
-    19, 177, 107, 145, 0, 103, 177, 225, 148, 132, 239, 125, 137, 196, 187, 209, 46, 86, 183, 132, 75, 133, 8, 155, 161,
-    102, 254, 226, 173, 192, 63, 104, 47, 16, 98, 174, 226, 215, 97, 115, 192, 65, 54, 144, 132, 235, 199, 36, 173, 133,
-    254, 230, 233, 100, 71, 203, 35, 187, 23, 61, 3, 182, 42, 18, 69, 42, 185, 152, 11, 141, 182, 108, 182, 7, 131, 122,
-    32, 128, 237, 220, 229, 103, 121, 104, 236, 208, 255, 218, 11, 60, 204, 164, 159, 196, 241, 247, 158, 128, 58, 38,
-    154, 228, 35, 181, 80, 9, 215, 7, 35, 37, 12, 166, 159, 2, 46, 39, 115, 51
+    123, 34, 67, 111, 109, 112, 111, 110, 101, 110, 116, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 95, 80, 97,
+    108, 34, 44, 32, 34, 68, 114, 105, 118, 101, 114, 83, 116, 97, 116, 101, 34, 58, 32, 91, 34, 72, 97, 108, 116, 101,
+    100, 79, 110, 68, 101, 118, 105, 99, 101, 73, 110, 105, 116, 34, 93, 44, 32, 34, 72, 119, 108, 34, 58, 32, 34, 71,
+    102, 120, 57, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34,
+    67, 97, 99, 104, 101, 32, 102, 108, 117, 115, 104, 34, 44, 32, 34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103,
+    101, 116, 115, 34, 44, 32, 34, 67, 111, 109, 112, 117, 116, 101, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34,
+    44, 32, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 32, 34, 71, 114, 97, 112, 104, 105,
+    99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 83, 104, 97, 100, 101, 114, 32, 79, 112,
+    116, 105, 111, 110, 115, 34, 44, 32, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115, 34, 44, 32, 34, 80,
+    66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103,
+    32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105, 110, 103, 41, 34, 44, 32, 34, 84, 101, 120,
+    116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 32, 34, 72, 97, 114, 100, 119, 97, 114,
+    101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 44, 32, 34, 82, 80, 77, 34, 44, 32, 34, 71, 102,
+    120, 57, 34, 44, 32, 34, 71, 102, 120, 49, 48, 34, 93, 44, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58,
+    32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 111, 103, 103, 108, 101,
+    115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 111, 114, 32, 110, 111, 116, 32, 76, 79, 65, 68, 95, 73, 78, 68, 69,
+    88, 32, 112, 97, 99, 107, 101, 116, 115, 32, 97, 114, 101, 32, 117, 115, 101, 100, 32, 102, 111, 114, 32, 98, 105,
+    110, 100, 105, 110, 103, 32, 111, 98, 106, 101, 99, 116, 115, 32, 116, 111, 32, 116, 104, 101, 32, 99, 111, 109,
+    109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 105, 110, 32, 112, 108, 97, 99, 101, 32, 111, 102, 32, 115,
+    101, 116, 32, 112, 97, 99, 107, 101, 116, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101,
+    110, 101, 114, 97, 108, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101,
+    110, 97, 98, 108, 101, 76, 111, 97, 100, 73, 110, 100, 101, 120, 70, 111, 114, 79, 98, 106, 101, 99, 116, 66, 105,
+    110, 100, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 76, 111, 97, 100, 73,
+    110, 100, 101, 120, 70, 111, 114, 79, 98, 106, 101, 99, 116, 66, 105, 110, 100, 115, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 49, 54, 48, 55, 50, 48, 55, 52, 125, 44, 32, 123, 34, 86, 97, 108, 105,
+    100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101,
+    44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 111, 112,
+    121, 68, 115, 116, 67, 111, 109, 112, 114, 78, 101, 118, 101, 114, 65, 108, 108, 111, 119, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73,
+    102, 32, 115, 101, 116, 44, 32, 99, 111, 112, 121, 45, 100, 115, 116, 32, 119, 105, 108, 108, 32, 110, 101, 118,
+    101, 114, 32, 98, 101, 32, 115, 101, 116, 32, 97, 115, 32, 97, 32, 99, 111, 109, 112, 114, 101, 115, 115, 105, 98,
+    108, 101, 32, 108, 97, 121, 111, 117, 116, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 111, 112,
+    121, 68, 115, 116, 67, 111, 109, 112, 114, 65, 108, 119, 97, 121, 115, 65, 108, 108, 111, 119, 34, 44, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    73, 102, 32, 115, 101, 116, 44, 32, 99, 111, 112, 121, 45, 100, 115, 116, 32, 119, 105, 108, 108, 32, 97, 108, 119,
+    97, 121, 115, 32, 98, 101, 32, 115, 101, 116, 32, 97, 115, 32, 97, 32, 99, 111, 109, 112, 114, 101, 115, 115, 105,
+    98, 108, 101, 32, 108, 97, 121, 111, 117, 116, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 111,
+    112, 121, 68, 115, 116, 67, 111, 109, 112, 114, 65, 108, 119, 97, 121, 115, 65, 108, 108, 111, 119, 71, 102, 120,
+    49, 48, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 99, 111, 112, 121, 45, 100, 115, 116, 32, 119,
+    105, 108, 108, 32, 97, 108, 119, 97, 121, 115, 32, 98, 101, 32, 115, 101, 116, 32, 97, 115, 32, 97, 32, 99, 111,
+    109, 112, 114, 101, 115, 115, 105, 98, 108, 101, 32, 108, 97, 121, 111, 117, 116, 44, 32, 98, 117, 116, 32, 111,
+    110, 108, 121, 32, 111, 110, 32, 103, 102, 120, 49, 48, 43, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 67, 111, 112, 121, 68, 115, 116, 67, 111, 109, 112, 114, 65, 108, 108, 111, 119, 70, 111, 114, 82, 101, 97, 100,
+    97, 98, 108, 101, 70, 111, 114, 109, 97, 116, 115, 71, 102, 120, 49, 48, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 51, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101,
+    116, 44, 32, 99, 111, 112, 121, 45, 100, 115, 116, 32, 119, 105, 108, 108, 32, 98, 101, 32, 115, 101, 116, 32, 97,
+    115, 32, 97, 32, 99, 111, 109, 112, 114, 101, 115, 115, 105, 98, 108, 101, 32, 108, 97, 121, 111, 117, 116, 32, 102,
+    111, 114, 32, 115, 104, 97, 100, 101, 114, 32, 114, 101, 97, 100, 97, 98, 108, 101, 32, 105, 109, 97, 103, 101, 32,
+    102, 111, 114, 109, 97, 116, 115, 32, 111, 110, 108, 121, 44, 32, 98, 117, 116, 32, 111, 110, 108, 121, 32, 111,
+    110, 32, 103, 102, 120, 49, 48, 43, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 111, 112, 121,
+    68, 115, 116, 67, 111, 109, 112, 114, 34, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 104, 111, 119, 32, 116, 104, 101, 32, 76, 97, 121,
+    111, 117, 116, 67, 111, 112, 121, 68, 115, 116, 32, 119, 105, 108, 108, 32, 98, 101, 32, 115, 101, 116, 32, 105,
+    110, 32, 99, 111, 109, 112, 114, 101, 115, 115, 101, 100, 32, 117, 115, 97, 103, 101, 115, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 71, 102, 120, 49, 48, 34, 93, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67,
+    111, 112, 121, 68, 115, 116, 67, 111, 109, 112, 114, 65, 108, 119, 97, 121, 115, 65, 108, 108, 111, 119, 71, 102,
+    120, 49, 48, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 111, 112, 121, 68, 115, 116, 73,
+    115, 67, 111, 109, 112, 114, 101, 115, 115, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 111,
+    112, 121, 68, 115, 116, 73, 115, 67, 111, 109, 112, 114, 101, 115, 115, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 51, 57, 49, 57, 48, 52, 56, 55, 57, 56, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 65,
+    108, 108, 111, 119, 66, 105, 103, 80, 97, 103, 101, 82, 101, 110, 100, 101, 114, 84, 97, 114, 103, 101, 116, 34, 44,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 67, 111, 108, 111, 114, 32, 114, 101, 110, 100, 101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 125,
+    44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 65, 108, 108, 111, 119, 66, 105, 103, 80,
+    97, 103, 101, 68, 101, 112, 116, 104, 83, 116, 101, 110, 99, 105, 108, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 112, 116, 104,
+    32, 115, 116, 101, 110, 99, 105, 108, 32, 105, 109, 97, 103, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 71, 102, 120, 49, 48, 65, 108, 108, 111, 119, 66, 105, 103, 80, 97, 103, 101, 83, 104, 97, 100, 101,
+    114, 87, 114, 105, 116, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 32, 119, 114, 105, 116, 101, 97, 98,
+    108, 101, 32, 105, 109, 97, 103, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120,
+    49, 48, 65, 108, 108, 111, 119, 66, 105, 103, 80, 97, 103, 101, 83, 104, 97, 100, 101, 114, 82, 101, 97, 100, 34,
+    44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 32, 114, 101, 97, 100, 97, 98, 108, 101, 32, 105, 109, 97, 103, 101,
+    115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 65, 108, 108, 111, 119, 66,
+    105, 103, 80, 97, 103, 101, 66, 117, 102, 102, 101, 114, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49,
+    54, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 110, 100, 101, 114,
+    97, 98, 108, 101, 32, 98, 117, 102, 102, 101, 114, 115, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    71, 102, 120, 49, 48, 65, 108, 108, 111, 119, 66, 105, 103, 80, 97, 103, 101, 34, 125, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 111, 102, 32, 99, 97, 115,
+    101, 115, 32, 119, 104, 101, 114, 101, 32, 98, 105, 103, 45, 112, 97, 103, 101, 32, 119, 105, 108, 108, 32, 112,
+    111, 116, 101, 110, 116, 105, 97, 108, 108, 121, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44,
+    32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114,
+    117, 101, 44, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 54, 51, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 108, 108, 111, 119, 66, 105, 103, 80, 97, 103, 101, 34, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 65, 108, 108, 111, 119, 66, 105, 103, 80, 97, 103, 101, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 50, 54, 49, 54, 55, 54, 51, 49, 125, 44, 32, 123, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 115, 32, 98, 105, 110, 100,
+    105, 110, 103, 32, 111, 102, 32, 98, 111, 114, 100, 101, 114, 32, 99, 111, 108, 111, 114, 32, 112, 97, 108, 101,
+    116, 116, 101, 115, 44, 32, 97, 110, 100, 32, 102, 111, 114, 99, 101, 115, 32, 97, 110, 121, 32, 115, 97, 109, 112,
+    108, 101, 114, 115, 32, 99, 114, 101, 97, 116, 101, 100, 32, 116, 111, 32, 117, 115, 101, 32, 97, 32, 116, 114, 97,
+    110, 115, 112, 97, 114, 101, 110, 116, 32, 98, 108, 97, 99, 107, 32, 99, 111, 108, 111, 114, 46, 32, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102,
+    97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 66,
+    111, 114, 100, 101, 114, 67, 111, 108, 111, 114, 80, 97, 108, 101, 116, 116, 101, 66, 105, 110, 100, 115, 34, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 66, 111, 114, 100, 101, 114, 67, 111, 108,
+    111, 114, 80, 97, 108, 101, 116, 116, 101, 66, 105, 110, 100, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 56, 50, 53, 50, 55, 54, 48, 52, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116, 101, 100, 32, 116, 111, 32, 112, 114, 105, 109, 105, 116, 105,
+    118, 101, 32, 111, 114, 100, 101, 114, 101, 100, 32, 112, 105, 120, 101, 108, 32, 115, 104, 97, 100, 105, 110, 103,
+    46, 32, 32, 73, 102, 32, 115, 101, 116, 44, 32, 102, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32, 80, 83, 32, 116,
+    111, 32, 100, 114, 97, 105, 110, 32, 111, 110, 32, 97, 110, 121, 100, 101, 116, 101, 99, 116, 101, 100, 32, 111,
+    118, 101, 114, 108, 97, 112, 112, 105, 110, 103, 32, 119, 97, 118, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 114, 97, 105, 110, 80, 115, 79, 110, 79, 118, 101,
+    114, 108, 97, 112, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 114, 97, 105, 110, 80, 115, 79, 110, 79,
+    118, 101, 114, 108, 97, 112, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 51, 48, 57, 49,
+    57, 48, 54, 56, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73,
+    115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 80, 114, 105, 110, 116, 77, 101, 116, 97, 69, 113, 117, 97,
+    116, 105, 111, 110, 73, 110, 102, 111, 69, 113, 117, 97, 116, 105, 111, 110, 115, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 105,
+    110, 116, 115, 32, 109, 101, 116, 97, 32, 101, 113, 117, 97, 116, 105, 111, 110, 115, 32, 116, 104, 101, 109, 115,
+    101, 108, 118, 101, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 80, 114,
+    105, 110, 116, 77, 101, 116, 97, 69, 113, 117, 97, 116, 105, 111, 110, 73, 110, 102, 111, 80, 114, 111, 99, 101,
+    115, 115, 105, 110, 103, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 105, 110, 116, 115, 32, 101, 113, 117, 97, 116, 105, 111,
+    110, 32, 99, 111, 111, 114, 100, 105, 110, 97, 116, 101, 115, 32, 97, 115, 32, 116, 104, 101, 121, 39, 114, 101, 32,
+    112, 114, 111, 99, 101, 115, 115, 101, 100, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102,
+    120, 57, 80, 114, 105, 110, 116, 77, 101, 116, 97, 69, 113, 117, 97, 116, 105, 111, 110, 73, 110, 102, 111, 34, 125,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108,
+    115, 32, 112, 114, 105, 110, 116, 105, 110, 103, 32, 111, 102, 32, 109, 101, 116, 97, 45, 101, 113, 117, 97, 116,
+    105, 111, 110, 32, 100, 97, 116, 97, 46, 32, 32, 68, 101, 98, 117, 103, 32, 98, 117, 105, 108, 100, 115, 32, 111,
+    110, 108, 121, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44,
+    32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 66, 105, 116,
+    109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117,
+    101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 105, 110, 116, 77,
+    101, 116, 97, 69, 113, 117, 97, 116, 105, 111, 110, 73, 110, 102, 111, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 80, 114, 105, 110, 116, 77, 101, 116, 97, 69, 113, 117, 97, 116, 105, 111, 110, 73, 110, 102, 111, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49, 51, 55, 49, 55, 53, 56, 51, 57, 125, 44, 32, 123, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 116,
+    104, 101, 32, 109, 101, 116, 97, 45, 101, 113, 117, 97, 116, 105, 111, 110, 115, 32, 119, 105, 108, 108, 32, 98,
+    101, 32, 112, 114, 111, 99, 101, 115, 115, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 99, 112, 117, 32, 105, 110,
+    115, 116, 101, 97, 100, 32, 111, 102, 32, 98, 121, 32, 97, 32, 99, 111, 109, 112, 117, 116, 101, 32, 115, 104, 97,
+    100, 101, 114, 46, 69, 109, 117, 108, 97, 116, 105, 111, 110, 44, 32, 100, 101, 98, 117, 103, 32, 98, 117, 105, 108,
+    100, 115, 32, 111, 110, 108, 121, 46, 32, 32, 85, 115, 101, 102, 117, 108, 32, 102, 111, 114, 32, 112, 114, 101, 45,
+    115, 105, 108, 105, 99, 111, 110, 32, 100, 101, 118, 101, 108, 111, 112, 109, 101, 110, 116, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 111, 99, 101, 115, 115, 77, 101,
+    116, 97, 69, 113, 117, 97, 116, 105, 111, 110, 86, 105, 97, 67, 112, 117, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 80, 114, 111, 99, 101, 115, 115, 77, 101, 116, 97, 69, 113, 117, 97, 116, 105, 111, 110, 86, 105, 97, 67,
+    112, 117, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 50, 51, 57, 51, 54, 51, 49, 49,
+    125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117,
+    109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108, 101,
+    97, 114, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 116, 104, 101,
+    32, 79, 112, 116, 105, 109, 105, 122, 101, 100, 32, 70, 97, 115, 116, 32, 67, 108, 101, 97, 114, 32, 80, 97, 116,
+    104, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 112, 116, 105, 109, 105,
+    122, 101, 100, 70, 97, 115, 116, 67, 108, 101, 97, 114, 67, 111, 108, 111, 114, 67, 109, 97, 115, 107, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 69, 110, 97, 98, 108, 101, 32, 79, 112, 116, 105, 109, 105, 122, 101, 100, 32, 70, 97, 115, 116, 32, 67,
+    108, 101, 97, 114, 32, 80, 97, 116, 104, 32, 102, 111, 114, 32, 99, 111, 108, 111, 114, 32, 115, 117, 114, 102, 97,
+    99, 101, 115, 32, 99, 109, 97, 115, 107, 32, 109, 101, 116, 97, 100, 97, 116, 97, 32, 102, 97, 115, 116, 99, 108,
+    101, 97, 114, 40, 109, 115, 97, 97, 32, 111, 110, 108, 121, 41, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 71, 102, 120, 57, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108, 101, 97, 114,
+    67, 111, 108, 111, 114, 68, 99, 99, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 79, 112, 116, 105, 109, 105,
+    122, 101, 100, 32, 70, 97, 115, 116, 32, 67, 108, 101, 97, 114, 32, 80, 97, 116, 104, 32, 102, 111, 114, 32, 99,
+    111, 108, 111, 114, 32, 115, 117, 114, 102, 97, 99, 101, 115, 32, 100, 99, 99, 32, 109, 101, 116, 97, 100, 97, 116,
+    97, 32, 102, 97, 115, 116, 99, 108, 101, 97, 114, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    71, 102, 120, 57, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108, 101, 97, 114, 68, 101, 112,
+    116, 104, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 79, 112, 116, 105, 109, 105, 122, 101, 100, 32, 70,
+    97, 115, 116, 32, 67, 108, 101, 97, 114, 32, 80, 97, 116, 104, 32, 102, 111, 114, 32, 100, 101, 112, 116, 104, 32,
+    115, 117, 114, 102, 97, 99, 101, 115, 32, 104, 116, 105, 108, 101, 32, 109, 101, 116, 97, 100, 97, 116, 97, 32, 102,
+    97, 115, 116, 99, 108, 101, 97, 114, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120,
+    57, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108, 101, 97, 114, 34, 125, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 101, 110, 97, 98, 108, 101, 100, 44,
+    32, 116, 104, 101, 32, 109, 101, 116, 97, 45, 101, 113, 117, 97, 116, 105, 111, 110, 115, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 112, 114, 111, 99, 101, 115, 115, 101, 100, 32, 98, 121, 32, 97, 110, 32, 111, 112, 116, 105, 109,
+    105, 122, 101, 100, 32, 99, 111, 109, 112, 117, 116, 101, 32, 115, 104, 97, 100, 101, 114, 32, 97, 110, 100, 32, 97,
+    108, 103, 111, 114, 105, 116, 104, 109, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101,
+    114, 97, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73,
+    115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 55, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110,
+    116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 112, 116,
+    105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108, 101, 97, 114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108, 101, 97, 114, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 55, 53, 55, 49, 57, 54, 50, 53, 125, 44, 32, 123, 34, 86, 97, 108,
+    105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 68, 99, 99, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68,
+    67, 67, 32, 100, 101, 99, 111, 109, 112, 114, 101, 115, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 72, 116, 105, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 112,
+    116, 104, 32, 101, 120, 112, 97, 110, 100, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101,
+    99, 111, 109, 112, 114, 101, 115, 115, 70, 109, 97, 115, 107, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 77, 97, 115, 107, 32, 100, 101,
+    99, 111, 109, 112, 114, 101, 115, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 99,
+    111, 109, 112, 114, 101, 115, 115, 70, 97, 115, 116, 67, 108, 101, 97, 114, 34, 44, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 56, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 97, 115, 116,
+    32, 99, 108, 101, 97, 114, 32, 101, 108, 105, 109, 105, 110, 97, 116, 101, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 77, 97, 115, 107, 34, 125, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104,
+    101, 116, 104, 101, 114, 32, 116, 104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 100, 101, 99, 111,
+    109, 112, 114, 101, 115, 115, 32, 47, 32, 101, 120, 112, 97, 110, 100, 32, 47, 32, 101, 108, 105, 109, 105, 110, 97,
+    116, 101, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 115, 32, 119, 105, 108, 108, 32, 97, 108, 119, 97, 121,
+    115, 32, 111, 99, 99, 117, 114, 32, 119, 104, 101, 110, 32, 114, 101, 113, 117, 101, 115, 116, 101, 100, 46, 34, 44,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34,
+    93, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32,
+    116, 114, 117, 101, 44, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 108, 119, 97, 121, 115, 68, 101, 99, 111, 109, 112, 114, 101,
+    115, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 108, 119, 97, 121, 115, 68, 101, 99, 111, 109, 112,
+    114, 101, 115, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56, 56, 55, 53, 56, 51, 52,
+    49, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 117,
+    101, 32, 116, 111, 32, 111, 118, 101, 114, 114, 105, 100, 101, 32, 49, 68, 32, 105, 109, 97, 103, 101, 115, 32, 116,
+    111, 32, 98, 101, 32, 50, 68, 32, 105, 110, 115, 116, 101, 97, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 116, 114, 101, 97, 116, 49, 100, 65, 115, 50, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 84, 114, 101, 97, 116, 49, 100, 65, 115, 50, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 54, 52, 56, 51, 51, 50, 54, 53, 54, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99,
+    108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32,
+    91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 70, 111, 114, 99, 101, 87, 97, 118, 101, 66,
+    114, 101, 97, 107, 83, 105, 122, 101, 78, 111, 110, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 111, 32, 119, 97, 118, 101, 32, 98,
+    114, 101, 97, 107, 115, 32, 98, 121, 32, 114, 101, 103, 105, 111, 110, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 70, 111, 114, 99, 101, 87, 97, 118, 101, 66, 114, 101, 97, 107, 83, 105,
+    122, 101, 56, 120, 56, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 56, 120, 56, 32, 114, 101, 103, 105, 111, 110, 32, 115, 105, 122, 101,
+    46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 70, 111, 114, 99, 101, 87, 97,
+    118, 101, 66, 114, 101, 97, 107, 83, 105, 122, 101, 49, 54, 120, 49, 54, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 49, 54, 120, 49, 54,
+    32, 114, 101, 103, 105, 111, 110, 32, 115, 105, 122, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 71, 102, 120, 49, 48, 70, 111, 114, 99, 101, 87, 97, 118, 101, 66, 114, 101, 97, 107, 83, 105, 122, 101, 51,
+    50, 120, 51, 50, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 51, 50, 120, 51, 50, 32, 114, 101, 103, 105, 111, 110, 32, 115, 105, 122, 101,
+    46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 70, 111, 114, 99, 101, 87, 97,
+    118, 101, 66, 114, 101, 97, 107, 83, 105, 122, 101, 67, 108, 105, 101, 110, 116, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101,
+    32, 99, 108, 105, 101, 110, 116, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 118, 97, 108, 117, 101, 46, 34,
+    125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 70, 111, 114, 99, 101, 87, 97, 118,
+    101, 66, 114, 101, 97, 107, 83, 105, 122, 101, 34, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32, 115, 105, 122, 101, 32, 111, 102, 32, 97,
+    32, 119, 97, 118, 101, 32, 98, 114, 101, 97, 107, 59, 32, 111, 118, 101, 114, 45, 114, 105, 100, 101, 115, 32, 99,
+    108, 105, 101, 110, 116, 45, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 118, 97, 108, 117, 101, 46, 34, 44, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 71, 102, 120, 49, 48, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 34, 71, 102, 120, 49, 48, 70, 111, 114, 99, 101, 87, 97, 118, 101, 66, 114, 101, 97, 107, 83, 105, 122, 101, 67,
+    108, 105, 101, 110, 116, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117,
+    109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99, 101,
+    87, 97, 118, 101, 66, 114, 101, 97, 107, 83, 105, 122, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70,
+    111, 114, 99, 101, 87, 97, 118, 101, 66, 114, 101, 97, 107, 83, 105, 122, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 51, 50, 53, 55, 57, 52, 54, 49, 55, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 102, 102, 101, 99, 116, 115, 32, 116, 105, 108, 101, 100, 45, 116, 111,
+    45, 116, 105, 108, 101, 100, 32, 105, 109, 97, 103, 101, 32, 99, 111, 112, 105, 101, 115, 32, 111, 110, 32, 116,
+    104, 101, 32, 71, 70, 88, 49, 48, 32, 83, 68, 77, 65, 32, 101, 110, 103, 105, 110, 101, 32, 119, 104, 101, 114, 101,
+    32, 98, 111, 116, 104, 32, 105, 109, 97, 103, 101, 115, 32, 97, 114, 101, 32, 99, 111, 109, 112, 114, 101, 115, 115,
+    101, 100, 32, 83, 101, 116, 32, 116, 111, 32, 116, 114, 117, 101, 32, 116, 111, 32, 108, 101, 97, 118, 101, 32, 116,
+    104, 101, 32, 115, 111, 117, 114, 99, 101, 32, 105, 109, 97, 103, 101, 32, 105, 110, 32, 97, 32, 99, 111, 109, 112,
+    114, 101, 115, 115, 101, 100, 32, 115, 116, 97, 116, 101, 44, 32, 115, 101, 116, 32, 116, 111, 32, 102, 97, 108,
+    115, 101, 32, 116, 111, 32, 108, 101, 97, 118, 101, 32, 116, 104, 101, 32, 100, 101, 115, 116, 32, 105, 109, 97,
+    103, 101, 32, 105, 110, 32, 97, 32, 99, 111, 109, 112, 114, 101, 115, 115, 101, 100, 32, 115, 116, 97, 116, 101, 46,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 71, 102, 120,
+    49, 48, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 100, 109, 97,
+    80, 114, 101, 102, 101, 114, 67, 111, 109, 112, 114, 101, 115, 115, 101, 100, 83, 111, 117, 114, 99, 101, 34, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 100, 109, 97, 80, 114, 101, 102, 101, 114, 67, 111, 109, 112, 114,
+    101, 115, 115, 101, 100, 83, 111, 117, 114, 99, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    49, 56, 56, 52, 50, 50, 50, 57, 57, 48, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 85, 115, 101, 67, 111, 109, 112,
+    84, 111, 83, 105, 110, 103, 108, 101, 78, 111, 110, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 99, 111, 109, 112,
+    45, 116, 111, 45, 114, 101, 103, 32, 97, 108, 108, 32, 105, 109, 97, 103, 101, 32, 116, 121, 112, 101, 46, 34, 125,
+    44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 85, 115, 101, 67, 111, 109, 112, 84, 111,
+    83, 105, 110, 103, 108, 101, 50, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 99, 111, 109, 112, 45, 116, 111, 45,
+    115, 105, 110, 103, 108, 101, 32, 102, 111, 114, 32, 50, 100, 32, 105, 109, 97, 103, 101, 46, 34, 125, 44, 32, 123,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 85, 115, 101, 67, 111, 109, 112, 84, 111, 83, 105, 110,
+    103, 108, 101, 50, 100, 65, 114, 114, 97, 121, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 99, 111, 109, 112, 45, 116,
+    111, 45, 115, 105, 110, 103, 108, 101, 32, 102, 111, 114, 32, 50, 100, 32, 97, 114, 114, 97, 121, 32, 105, 109, 97,
+    103, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 85, 115, 101, 67,
+    111, 109, 112, 84, 111, 83, 105, 110, 103, 108, 101, 77, 115, 97, 97, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 99, 111,
+    109, 112, 45, 116, 111, 45, 115, 105, 110, 103, 108, 101, 32, 102, 111, 114, 32, 77, 83, 65, 65, 32, 105, 109, 97,
+    103, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 85, 115, 101, 67,
+    111, 109, 112, 84, 111, 83, 105, 110, 103, 108, 101, 51, 68, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 99, 111, 109,
+    112, 45, 116, 111, 45, 115, 105, 110, 103, 108, 101, 32, 102, 111, 114, 32, 51, 100, 32, 105, 109, 97, 103, 101, 46,
+    34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 68, 105, 115, 97, 98, 108, 101,
+    67, 111, 109, 112, 84, 111, 82, 101, 103, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 54, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 99, 111, 109,
+    112, 45, 116, 111, 45, 114, 101, 103, 32, 114, 101, 110, 100, 101, 114, 105, 110, 103, 32, 119, 105, 108, 108, 32,
+    98, 101, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 105, 109, 97, 103, 101, 115, 32, 116, 104,
+    97, 116, 32, 119, 101, 114, 101, 32, 99, 108, 101, 97, 114, 101, 100, 32, 119, 105, 116, 104, 32, 99, 111, 109, 112,
+    45, 116, 111, 45, 115, 105, 110, 103, 108, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71,
+    102, 120, 49, 48, 85, 115, 101, 67, 111, 109, 112, 84, 111, 83, 105, 110, 103, 108, 101, 56, 98, 112, 112, 34, 44,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 117, 115, 101, 32, 99, 111, 109, 112, 45, 116, 111, 45, 115,
+    105, 110, 103, 108, 101, 32, 102, 111, 114, 32, 56, 98, 112, 112, 32, 105, 109, 97, 103, 101, 46, 34, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 85, 115, 101, 67, 111, 109, 112, 84, 111, 83, 105,
+    110, 103, 108, 101, 49, 54, 98, 112, 112, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 52, 44, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 117, 115, 101,
+    32, 99, 111, 109, 112, 45, 116, 111, 45, 115, 105, 110, 103, 108, 101, 32, 102, 111, 114, 32, 49, 54, 98, 112, 112,
+    32, 105, 109, 97, 103, 101, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 85,
+    115, 101, 67, 111, 109, 112, 84, 111, 83, 105, 110, 103, 108, 101, 34, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 116, 104, 101, 114, 32, 119, 101, 32, 110, 101, 101, 100, 32,
+    116, 111, 32, 115, 101, 116, 32, 102, 105, 114, 115, 116, 32, 112, 105, 120, 101, 108, 32, 111, 102, 32, 101, 97,
+    99, 104, 32, 98, 108, 111, 99, 107, 32, 116, 104, 97, 116, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 115,
+    32, 116, 111, 32, 49, 32, 98, 121, 116, 101, 32, 105, 110, 32, 68, 67, 67, 32, 109, 101, 109, 111, 114, 121, 44, 32,
+    97, 110, 100, 32, 100, 111, 110, 39, 116, 32, 110, 101, 101, 100, 32, 116, 111, 32, 100, 111, 32, 97, 32, 102, 97,
+    115, 116, 32, 99, 108, 101, 97, 114, 32, 101, 108, 105, 109, 105, 110, 97, 116, 101, 32, 98, 97, 115, 101, 100, 32,
+    111, 110, 32, 105, 109, 97, 103, 101, 32, 116, 121, 112, 101, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34, 71, 102, 120, 49, 48, 34, 93, 44, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73,
+    115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 51, 49, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 117, 115, 101, 67, 111, 109, 112, 84, 111, 83, 105, 110, 103, 108, 101, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 85, 115, 101, 67, 111, 109, 112, 84, 111, 83, 105, 110, 103, 108, 101, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49, 49, 48, 48, 52, 48, 49, 55, 52, 125, 44, 32, 123, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 115, 32, 97, 32, 102, 97, 115,
+    116, 32, 99, 108, 101, 97, 114, 32, 99, 111, 100, 101, 32, 116, 111, 32, 98, 101, 32, 116, 104, 101, 32, 114, 101,
+    103, 117, 108, 97, 114, 32, 99, 108, 101, 97, 114, 32, 99, 111, 100, 101, 32, 97, 110, 100, 32, 116, 117, 114, 110,
+    115, 32, 111, 102, 102, 32, 65, 67, 48, 49, 32, 99, 111, 109, 112, 114, 101, 115, 115, 105, 111, 110, 32, 119, 104,
+    105, 99, 104, 32, 109, 97, 107, 101, 115, 32, 115, 117, 114, 101, 32, 116, 104, 101, 32, 102, 111, 117, 114, 32, 39,
+    109, 97, 103, 105, 99, 39, 32, 99, 111, 109, 112, 114, 101, 115, 115, 101, 100, 32, 99, 108, 101, 97, 114, 32, 99,
+    111, 100, 101, 115, 32, 97, 114, 101, 110, 39, 116, 32, 117, 115, 101, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 115, 34, 44, 32, 34, 71, 102, 120, 57,
+    34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111,
+    108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99, 101,
+    82, 101, 103, 117, 108, 97, 114, 67, 108, 101, 97, 114, 67, 111, 100, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 70, 111, 114, 99, 101, 82, 101, 103, 117, 108, 97, 114, 67, 108, 101, 97, 114, 67, 111, 100, 101, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 51, 55, 51, 56, 51, 52, 55, 54, 125, 44, 32, 123,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 115, 32, 117, 115,
+    101, 32, 111, 102, 32, 97, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 102, 105, 108, 108, 32, 109, 101, 109, 111,
+    114, 121, 32, 112, 97, 116, 104, 32, 111, 110, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114,
+    115, 32, 116, 104, 97, 116, 32, 115, 117, 112, 112, 111, 114, 116, 115, 32, 103, 114, 97, 112, 104, 105, 99, 115,
+    32, 111, 112, 115, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44,
+    32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    102, 111, 114, 99, 101, 71, 114, 97, 112, 104, 105, 99, 115, 70, 105, 108, 108, 77, 101, 109, 111, 114, 121, 80, 97,
+    116, 104, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 71, 114, 97, 112, 104, 105, 99,
+    115, 70, 105, 108, 108, 77, 101, 109, 111, 114, 121, 80, 97, 116, 104, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 52, 53, 49, 53, 55, 48, 54, 56, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114,
+    32, 116, 111, 32, 119, 97, 105, 116, 32, 97, 102, 116, 101, 114, 32, 70, 47, 73, 32, 119, 104, 101, 110, 32, 99,
+    104, 97, 110, 103, 105, 110, 103, 32, 116, 97, 114, 103, 101, 116, 115, 32, 119, 105, 116, 104, 105, 110, 32, 97,
+    32, 77, 101, 116, 97, 100, 97, 116, 97, 32, 109, 105, 112, 32, 116, 97, 105, 108, 32, 114, 101, 103, 105, 111, 110,
+    46, 32, 84, 104, 105, 115, 32, 99, 97, 110, 32, 114, 101, 115, 111, 108, 118, 101, 32, 99, 111, 114, 114, 117, 112,
+    116, 105, 111, 110, 115, 32, 114, 101, 108, 97, 116, 101, 100, 32, 116, 111, 32, 109, 101, 116, 97, 100, 97, 116,
+    97, 32, 99, 97, 99, 104, 101, 32, 99, 111, 110, 102, 108, 105, 99, 116, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 34, 67, 97, 99, 104, 101, 32, 102, 108, 117, 115, 104, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102,
+    97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 105, 116, 79, 110, 77, 101,
+    116, 97, 100, 97, 116, 97, 77, 105, 112, 84, 97, 105, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97,
+    105, 116, 79, 110, 77, 101, 116, 97, 100, 97, 116, 97, 77, 105, 112, 84, 97, 105, 108, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 50, 51, 50, 56, 49, 48, 48, 57, 52, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 119, 114, 105, 116, 101,
+    115, 32, 116, 104, 101, 32, 67, 79, 76, 79, 82, 95, 83, 82, 67, 95, 79, 80, 84, 32, 97, 110, 100, 32, 67, 79, 76,
+    79, 82, 95, 68, 83, 84, 95, 79, 80, 84, 32, 98, 105, 116, 115, 32, 111, 102, 32, 116, 104, 101, 83, 88, 95, 77, 82,
+    84, 35, 95, 66, 76, 69, 78, 68, 95, 79, 80, 84, 32, 102, 111, 114, 32, 66, 108, 101, 110, 100, 32, 83, 116, 97, 116,
+    101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103,
+    101, 116, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 98, 108, 101, 110, 100, 79, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 69,
+    110, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 108, 101, 110, 100, 79, 112, 116, 105,
+    109, 105, 122, 97, 116, 105, 111, 110, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 53, 54, 48, 57, 55, 57, 50, 57, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 68, 67, 67, 32, 119, 105, 108, 108, 32, 98,
+    101, 32, 117, 115, 101, 100, 32, 116, 111, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 97, 115, 116, 32, 99,
+    111, 108, 111, 114, 32, 99, 108, 101, 97, 114, 115, 32, 111, 110, 32, 115, 105, 110, 103, 108, 101, 115, 97, 109,
+    112, 108, 101, 100, 32, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 32, 73, 109, 97, 103, 101, 115, 46,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 115,
+    34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    102, 97, 115, 116, 67, 111, 108, 111, 114, 67, 108, 101, 97, 114, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 70, 97, 115, 116, 67, 111, 108, 111, 114, 67, 108, 101, 97, 114, 69, 110, 97, 98, 108,
+    101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 51, 56, 48, 52, 48, 56, 50, 52, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117,
+    101, 44, 32, 68, 67, 67, 32, 119, 105, 108, 108, 32, 98, 101, 32, 117, 115, 101, 100, 32, 116, 111, 32, 115, 117,
+    112, 112, 111, 114, 116, 32, 102, 97, 115, 116, 32, 99, 111, 108, 111, 114, 32, 99, 108, 101, 97, 114, 115, 32, 111,
+    110, 32, 115, 105, 110, 103, 108, 101, 115, 97, 109, 112, 108, 101, 100, 32, 51, 68, 32, 67, 111, 108, 111, 114, 32,
+    84, 97, 114, 103, 101, 116, 32, 73, 109, 97, 103, 101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116,
+    114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 97, 115, 116, 67, 111, 108, 111, 114,
+    67, 108, 101, 97, 114, 79, 110, 51, 100, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 70, 97, 115, 116, 67, 111, 108, 111, 114, 67, 108, 101, 97, 114, 79, 110, 51, 68, 69, 110, 97, 98, 108, 101, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54, 53, 53, 57, 56, 55, 56, 54, 50, 125, 44, 32, 123,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32,
+    116, 104, 101, 32, 115, 101, 116, 116, 105, 110, 103, 32, 111, 102, 32, 116, 104, 101, 32, 67, 66, 95, 67, 79, 76,
+    79, 82, 95, 73, 78, 70, 79, 46, 70, 77, 65, 83, 75, 95, 67, 79, 77, 80, 82, 69, 83, 83, 73, 79, 78, 95, 68, 73, 83,
+    65, 66, 76, 69, 32, 98, 105, 116, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 108, 111, 114,
+    32, 84, 97, 114, 103, 101, 116, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 109, 97, 115, 107, 67, 111, 109, 112, 114, 101, 115, 115,
+    68, 105, 115, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 109, 97, 115, 107, 67, 111,
+    109, 112, 114, 101, 115, 115, 68, 105, 115, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 50, 55, 49, 55, 56, 50, 50, 56, 53, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 97, 108, 108, 111, 119, 115, 32, 102, 111, 114,
+    32, 110, 111, 110, 45, 122, 101, 114, 111, 32, 102, 77, 97, 115, 107, 32, 112, 105, 112, 101, 45, 98, 97, 110, 107,
+    45, 120, 111, 114, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 108, 111, 114, 32, 84, 97,
+    114, 103, 101, 116, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 102, 109, 97, 115, 107, 65, 108, 108, 111, 119, 80, 105, 112, 101, 66, 97, 110,
+    107, 88, 111, 114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 109, 97, 115, 107, 65, 108, 108, 111, 119,
+    80, 105, 112, 101, 66, 97, 110, 107, 88, 111, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    52, 50, 49, 56, 55, 51, 49, 57, 52, 49, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 68, 99, 99, 79, 110, 67, 111, 109, 112,
+    117, 116, 101, 73, 110, 105, 116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 101, 32, 116, 105, 109, 101, 32, 105, 110, 105, 116,
+    34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 68, 99, 99, 79, 110, 67, 111, 109,
+    112, 117, 116, 101, 70, 97, 115, 116, 67, 108, 101, 97, 114, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 97, 115, 116, 32, 99, 111, 108,
+    111, 114, 32, 99, 108, 101, 97, 114, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120,
+    57, 68, 99, 99, 79, 110, 67, 111, 109, 112, 117, 116, 101, 34, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 116, 104, 101, 32, 115,
+    105, 116, 117, 97, 116, 105, 111, 110, 115, 32, 111, 110, 32, 119, 104, 105, 99, 104, 32, 97, 32, 99, 111, 109, 112,
+    117, 116, 101, 32, 115, 104, 97, 100, 101, 114, 32, 119, 105, 108, 108, 32, 98, 101, 32, 117, 115, 101, 100, 32,
+    102, 111, 114, 32, 68, 67, 67, 32, 97, 99, 99, 101, 115, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32,
+    34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117,
+    101, 44, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 51, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 100, 99, 99, 79, 110, 67, 111, 109, 112, 117, 116, 101, 69, 110, 97, 98, 108, 101,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 99, 99, 79, 110, 67, 111, 109, 112, 117, 116, 101, 69, 110,
+    97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 53, 48, 53, 54, 49, 54, 55,
+    48, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110,
+    117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 83, 105, 110, 103, 108, 101, 83, 97, 109, 112,
+    108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 83, 105, 110, 103, 108, 101, 32, 115, 97, 109, 112, 108, 101, 32, 114, 101, 110, 100,
+    101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102,
+    120, 57, 85, 115, 101, 68, 99, 99, 83, 114, 103, 98, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 82, 71, 66, 32, 110, 117, 109, 101,
+    114, 105, 99, 32, 102, 111, 114, 109, 97, 116, 32, 105, 109, 97, 103, 101, 115, 34, 125, 44, 32, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 78, 111, 110, 84, 99, 67, 111, 109, 112, 97,
+    116, 83, 104, 97, 100, 101, 114, 82, 101, 97, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 111, 110, 45, 84, 67, 32, 99, 111, 109,
+    112, 97, 116, 105, 98, 108, 101, 32, 115, 104, 97, 100, 101, 114, 32, 114, 101, 97, 100, 34, 125, 44, 32, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 80, 114, 116, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 56, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80,
+    97, 114, 116, 105, 97, 108, 108, 121, 32, 114, 101, 115, 105, 100, 101, 110, 116, 32, 116, 101, 120, 116, 117, 114,
+    101, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99,
+    77, 117, 108, 116, 105, 83, 97, 109, 112, 108, 101, 50, 120, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49,
+    54, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 50, 120, 32, 109, 117, 108,
+    116, 105, 115, 97, 109, 112, 108, 101, 32, 114, 101, 110, 100, 101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34,
+    125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 77, 117, 108,
+    116, 105, 83, 97, 109, 112, 108, 101, 52, 120, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 50, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 52, 120, 32, 109, 117, 108, 116, 105, 115,
+    97, 109, 112, 108, 101, 32, 114, 101, 110, 100, 101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 77, 117, 108, 116, 105, 83,
+    97, 109, 112, 108, 101, 56, 120, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 52, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 56, 120, 32, 109, 117, 108, 116, 105, 115, 97, 109, 112,
+    108, 101, 32, 114, 101, 110, 100, 101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 125, 44, 32, 123, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 69, 113, 97, 97, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 49, 50, 56, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    69, 81, 65, 65, 32, 114, 101, 110, 100, 101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 125, 44, 32, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 70, 111, 114, 78, 111, 110, 82, 101,
+    97, 100, 97, 98, 108, 101, 70, 111, 114, 109, 97, 116, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50,
+    53, 54, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 111, 110, 45, 114, 101,
+    97, 100, 97, 98, 108, 101, 32, 98, 117, 116, 32, 115, 116, 105, 108, 108, 32, 114, 101, 110, 100, 101, 114, 97, 98,
+    108, 101, 32, 111, 114, 32, 115, 104, 97, 100, 101, 114, 45, 119, 114, 105, 116, 101, 97, 98, 108, 101, 32, 102,
+    111, 114, 109, 97, 116, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 85,
+    115, 101, 68, 99, 99, 82, 101, 110, 100, 101, 114, 84, 97, 114, 103, 101, 116, 85, 97, 118, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 53, 49, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 83, 104, 97, 100, 101, 114, 32, 119, 114, 105, 116, 97, 98, 108, 101, 32, 115, 117, 114, 102, 97, 99, 101, 115,
+    40, 85, 65, 86, 41, 32, 116, 104, 97, 116, 32, 97, 114, 101, 32, 97, 108, 115, 111, 32, 114, 101, 110, 100, 101,
+    114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120,
+    49, 48, 85, 115, 101, 68, 99, 99, 78, 111, 110, 82, 101, 110, 100, 101, 114, 84, 97, 114, 103, 101, 116, 85, 97,
+    118, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 48, 50, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 32, 119, 114, 105, 116, 97, 98, 108, 101, 32, 115,
+    117, 114, 102, 97, 99, 101, 115, 40, 85, 65, 86, 41, 32, 116, 104, 97, 116, 32, 97, 114, 101, 32, 110, 111, 116, 32,
+    114, 101, 110, 100, 101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 34, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 111, 102, 32, 99, 97, 115, 101, 115, 32, 119,
+    104, 101, 114, 101, 32, 68, 67, 67, 32, 40, 100, 101, 108, 116, 97, 32, 99, 111, 108, 111, 114, 32, 99, 111, 109,
+    112, 114, 101, 115, 115, 105, 111, 110, 41, 32, 115, 117, 114, 102, 97, 99, 101, 115, 32, 119, 105, 108, 108, 32,
+    98, 101, 32, 117, 115, 101, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 108, 111, 114, 32,
+    84, 97, 114, 103, 101, 116, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34,
+    58, 32, 123, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 72,
+    101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 53, 49, 49, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 117, 115, 101, 68, 99, 99, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 115, 101, 68, 99, 99,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 50, 57, 53, 49, 56, 54, 53, 52, 125, 44, 32,
+    123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58,
+    32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 71, 102, 120, 49, 48, 67, 98, 68, 98, 67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 76, 114, 117, 67,
+    109, 97, 115, 107, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 99, 97, 99, 104, 101, 32, 112, 111, 108, 105, 99, 121,
+    32, 76, 82, 85, 32, 102, 111, 114, 32, 67, 77, 65, 83, 75, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 71, 102, 120, 49, 48, 67, 98, 68, 98, 67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 76, 114, 117, 68, 99,
+    99, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 99, 97, 99, 104, 101, 32, 112, 111, 108, 105, 99, 121, 32, 76, 82, 85,
+    32, 102, 111, 114, 32, 68, 67, 67, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48,
+    67, 98, 68, 98, 67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 76, 114, 117, 70, 109, 97, 115, 107, 34, 44, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 85, 115, 101, 32, 99, 97, 99, 104, 101, 32, 112, 111, 108, 105, 99, 121, 32, 76, 82, 85, 32, 102, 111, 114,
+    32, 70, 77, 65, 83, 75, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 67, 98,
+    68, 98, 67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 76, 114, 117, 72, 116, 105, 108, 101, 34, 44, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 56, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    85, 115, 101, 32, 99, 97, 99, 104, 101, 32, 112, 111, 108, 105, 99, 121, 32, 76, 82, 85, 32, 102, 111, 114, 32, 72,
+    84, 73, 76, 69, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 67, 98, 68, 98,
+    67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 76, 114, 117, 79, 99, 99, 108, 117, 115, 105, 111, 110, 34, 44,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 54, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 85, 115, 101, 32, 99, 97, 99, 104, 101, 32, 112, 111, 108, 105, 99, 121, 32, 76, 82, 85, 32, 102,
+    111, 114, 32, 79, 99, 99, 108, 117, 115, 105, 111, 110, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    71, 102, 120, 49, 48, 67, 98, 68, 98, 67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 76, 114, 117, 68, 101, 112,
+    116, 104, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 53, 54, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 99, 97, 99, 104, 101, 32, 112, 111, 108, 105, 99, 121,
+    32, 76, 82, 85, 32, 102, 111, 114, 32, 68, 101, 112, 116, 104, 46, 32, 87, 65, 82, 78, 73, 78, 71, 32, 45, 32, 85,
+    115, 101, 32, 119, 105, 116, 104, 32, 99, 97, 117, 116, 105, 111, 110, 44, 32, 99, 97, 110, 32, 100, 111, 109, 105,
+    110, 97, 116, 101, 32, 76, 50, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48,
+    67, 98, 68, 98, 67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 76, 114, 117, 83, 116, 101, 110, 99, 105, 108, 34,
+    44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 49, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 99, 97, 99, 104, 101, 32, 112, 111, 108, 105, 99, 121, 32, 76, 82, 85,
+    32, 102, 111, 114, 32, 83, 116, 101, 110, 99, 105, 108, 46, 32, 87, 65, 82, 78, 73, 78, 71, 32, 45, 32, 85, 115,
+    101, 32, 119, 105, 116, 104, 32, 99, 97, 117, 116, 105, 111, 110, 44, 32, 99, 97, 110, 32, 100, 111, 109, 105, 110,
+    97, 116, 101, 32, 76, 50, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 67,
+    98, 68, 98, 67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 76, 114, 117, 67, 111, 108, 111, 114, 34, 44, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 49, 48, 50, 52, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 85, 115, 101, 32, 99, 97, 99, 104, 101, 32, 112, 111, 108, 105, 99, 121, 32, 76, 82, 85, 32, 102,
+    111, 114, 32, 67, 111, 108, 111, 114, 46, 32, 87, 65, 82, 78, 73, 78, 71, 32, 45, 32, 78, 79, 84, 32, 82, 69, 67,
+    79, 77, 77, 69, 78, 68, 69, 68, 32, 97, 115, 32, 105, 116, 32, 99, 97, 110, 32, 100, 111, 109, 105, 110, 97, 116,
+    101, 32, 76, 50, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 67, 98, 68,
+    98, 67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 76, 114, 117, 34, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 111, 102, 32, 119, 104, 105, 99, 104,
+    32, 67, 66, 47, 68, 66, 32, 99, 97, 99, 104, 101, 32, 112, 111, 108, 105, 99, 105, 101, 115, 32, 116, 111, 32, 102,
+    111, 108, 108, 111, 119, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 108, 111, 114, 32, 84,
+    97, 114, 103, 101, 116, 115, 34, 44, 32, 34, 71, 102, 120, 49, 48, 34, 93, 44, 32, 34, 70, 108, 97, 103, 115, 34,
+    58, 32, 123, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 72,
+    101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103,
+    34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 98,
+    68, 98, 67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 98,
+    68, 98, 67, 97, 99, 104, 101, 80, 111, 108, 105, 99, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 52, 48, 57, 48, 54, 50, 56, 56, 51, 52, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 68, 111, 32, 110, 111, 116, 32, 108, 105, 109, 105, 116, 32, 110, 117, 109, 98, 101,
+    114, 32, 111, 102, 32, 119, 97, 118, 101, 115, 32, 105, 110, 32, 102, 108, 105, 103, 104, 116, 32, 105, 110, 32,
+    101, 97, 99, 104, 32, 99, 111, 109, 112, 117, 116, 101, 32, 117, 110, 105, 116, 46, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 48, 125, 44, 32, 123, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 76, 101, 115, 115,
+    84, 104, 97, 110, 79, 114, 69, 113, 117, 97, 108, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 76, 105, 109, 105, 116, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102,
+    32, 119, 97, 118, 101, 115, 32, 105, 110, 32, 102, 108, 105, 103, 104, 116, 32, 105, 110, 32, 101, 97, 99, 104, 32,
+    99, 111, 109, 112, 117, 116, 101, 32, 117, 110, 105, 116, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52,
+    48, 125, 93, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110,
+    116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 87, 65, 86, 69, 83, 95, 80, 69, 82, 95, 83, 72, 32, 102, 105, 101,
+    108, 100, 32, 105, 110, 32, 116, 104, 101, 32, 67, 79, 77, 80, 85, 84, 69, 95, 82, 69, 83, 79, 85, 82, 67, 69, 95,
+    76, 73, 77, 73, 84, 83, 32, 114, 101, 103, 105, 115, 116, 101, 114, 59, 32, 110, 111, 116, 101, 32, 116, 104, 97,
+    116, 32, 105, 116, 32, 105, 115, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 112, 101, 114, 45, 67, 85, 32,
+    114, 97, 116, 104, 101, 114, 32, 116, 104, 97, 110, 32, 112, 101, 114, 45, 83, 72, 32, 102, 111, 114, 32, 99, 111,
+    110, 118, 101, 110, 105, 101, 110, 99, 101, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109,
+    112, 117, 116, 101, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 115, 77, 97, 120, 87, 97, 118, 101, 115, 80,
+    101, 114, 67, 117, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 77, 97, 120, 87, 97, 118, 101, 115,
+    80, 101, 114, 67, 117, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 49, 54, 55, 48, 48,
+    55, 57, 52, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    68, 105, 115, 97, 98, 108, 101, 115, 32, 108, 111, 99, 107, 105, 110, 103, 46, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 48, 125, 44, 32, 123, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 77, 117, 108, 116, 105,
+    112, 108, 101, 79, 102, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 83,
+    32, 112, 101, 114, 45, 83, 72, 32, 108, 111, 119, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 32, 102, 111,
+    114, 32, 108, 111, 99, 107, 105, 110, 103, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 125, 93, 125,
+    44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108,
+    115, 32, 116, 104, 101, 32, 76, 79, 67, 75, 95, 84, 72, 82, 69, 83, 72, 79, 76, 68, 32, 102, 105, 101, 108, 100, 32,
+    105, 110, 32, 116, 104, 101, 32, 67, 79, 77, 80, 85, 84, 69, 95, 82, 69, 83, 79, 85, 82, 67, 69, 95, 76, 73, 77, 73,
+    84, 83, 32, 114, 101, 103, 105, 115, 116, 101, 114, 46, 32, 67, 83, 32, 112, 101, 114, 45, 83, 72, 32, 108, 111,
+    119, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 32, 102, 111, 114, 32, 108, 111, 99, 107, 105, 110, 103, 46,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 67, 111, 109, 112, 117, 116, 101, 32, 80, 105, 112, 101, 108,
+    105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 99, 115, 76, 111, 99, 107, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 67, 115, 76, 111, 99, 107, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 54, 49, 49, 48, 48, 55, 57, 125, 44, 32, 123, 34, 86, 97, 108,
+    105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 67, 115, 83, 105, 109, 100, 68, 101, 115, 116, 67, 110, 116, 108, 68, 101, 102, 97,
+    117, 108, 116, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 75, 101, 101, 112, 115, 32, 116, 104, 101, 32, 100, 101, 102, 97, 117, 108, 116,
+    32, 83, 73, 77, 68, 95, 68, 69, 83, 84, 95, 67, 78, 84, 76, 32, 98, 101, 104, 97, 118, 105, 111, 114, 46, 34, 125,
+    44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 83, 105, 109, 100, 68, 101, 115, 116, 67, 110, 116, 108,
+    70, 111, 114, 99, 101, 49, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 115, 32, 83, 73, 77, 68, 95, 68, 69, 83, 84,
+    95, 67, 78, 84, 76, 32, 116, 111, 32, 49, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115,
+    83, 105, 109, 100, 68, 101, 115, 116, 67, 110, 116, 108, 70, 111, 114, 99, 101, 48, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111,
+    114, 99, 101, 115, 32, 83, 73, 77, 68, 95, 68, 69, 83, 84, 95, 67, 78, 84, 76, 32, 116, 111, 32, 48, 46, 34, 125,
+    93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 83, 105, 109, 100, 68, 101, 115, 116, 67, 110, 116, 108,
+    77, 111, 100, 101, 34, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67,
+    111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 83, 73, 77, 68, 95, 68, 69, 83, 84, 95, 67, 78, 84, 76,
+    32, 102, 105, 101, 108, 100, 32, 111, 102, 32, 116, 104, 101, 32, 67, 79, 77, 80, 85, 84, 69, 95, 82, 69, 83, 79,
+    85, 82, 67, 69, 95, 76, 73, 77, 73, 84, 83, 32, 114, 101, 103, 105, 115, 116, 101, 114, 46, 32, 66, 121, 32, 100,
+    101, 102, 97, 117, 108, 116, 44, 32, 116, 104, 105, 115, 32, 102, 108, 97, 103, 32, 105, 115, 32, 99, 97, 108, 117,
+    108, 97, 116, 101, 100, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114,
+    32, 111, 102, 32, 119, 97, 118, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 100, 105, 115, 112, 97, 116, 99, 104,
+    46, 32, 73, 102, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 119, 97, 118, 101, 115, 32,
+    105, 115, 32, 97, 32, 109, 117, 108, 116, 105, 112, 108, 101, 32, 111, 102, 32, 52, 44, 32, 116, 104, 105, 115, 32,
+    102, 108, 97, 103, 32, 105, 115, 32, 115, 101, 116, 44, 32, 111, 116, 104, 101, 114, 119, 105, 115, 101, 32, 105,
+    116, 32, 105, 115, 32, 99, 108, 101, 97, 114, 101, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    67, 111, 109, 112, 117, 116, 101, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57,
+    34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 34, 67, 115, 83, 105, 109, 100, 68, 101, 115, 116, 67, 110, 116, 108, 68, 101, 102, 97, 117, 108, 116, 34,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 115, 83, 105, 109, 100, 68, 101, 115, 116, 67,
+    110, 116, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 83, 105, 109, 100, 68, 101, 115, 116, 67,
+    110, 116, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 55, 52, 55, 51, 48, 49, 57,
+    49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116,
+    114, 117, 101, 44, 32, 72, 84, 105, 108, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101,
+    100, 32, 102, 111, 114, 32, 100, 101, 112, 116, 104, 47, 115, 116, 101, 110, 99, 105, 108, 32, 105, 109, 97, 103,
+    101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110,
+    99, 105, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 104, 116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 72, 116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 50, 51, 55, 57, 57, 56, 56, 56, 55, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 100, 101, 112, 116, 104, 32, 99, 111, 109, 112,
+    114, 101, 115, 115, 105, 111, 110, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34,
+    44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79,
+    110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 72,
+    116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    100, 101, 112, 116, 104, 67, 111, 109, 112, 114, 101, 115, 115, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 68, 101, 112, 116, 104, 67, 111, 109, 112, 114, 101, 115, 115, 69, 110, 97, 98, 108, 101,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 48, 52, 49, 54, 54, 57, 54, 57, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44,
+    32, 115, 116, 101, 110, 99, 105, 108, 32, 99, 111, 109, 112, 114, 101, 115, 115, 105, 111, 110, 32, 119, 105, 108,
+    108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68,
+    101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117,
+    101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110,
+    103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 72, 116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 125, 93,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 116, 101, 110, 99, 105, 108, 67, 111, 109, 112, 114,
+    101, 115, 115, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 116, 101, 110, 99,
+    105, 108, 67, 111, 109, 112, 114, 101, 115, 115, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 51, 48, 52, 49, 52, 51, 50, 49, 57, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 68, 66, 32, 112, 114, 101, 108,
+    111, 97, 100, 105, 110, 103, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44,
+    32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110,
+    34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 72, 116, 105,
+    108, 101, 69, 110, 97, 98, 108, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100,
+    98, 80, 114, 101, 108, 111, 97, 100, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    68, 98, 80, 114, 101, 108, 111, 97, 100, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 57, 52, 54, 50, 56, 57, 57, 57, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 68, 66, 32, 112, 114, 101, 108, 111, 97,
+    100, 32, 119, 105, 110, 100, 111, 119, 32, 100, 105, 109, 101, 110, 115, 105, 111, 110, 115, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 117, 115, 101, 100, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 116, 104, 101, 32, 100,
+    101, 112, 116, 104, 32, 98, 117, 102, 102, 101, 114, 39, 115, 32, 100, 105, 109, 101, 110, 115, 105, 111, 110, 115,
+    46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105,
+    108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110,
+    100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120,
+    57, 72, 116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 100, 98, 80, 114, 101, 108, 111, 97, 100, 87, 105, 110, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 68, 98, 80, 114, 101, 108, 111, 97, 100, 87, 105, 110, 69, 110, 97, 98, 108, 101, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 51, 48, 52, 51, 55, 53, 48, 49, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44,
+    32, 112, 101, 114, 45, 116, 105, 108, 101, 32, 116, 114, 97, 99, 107, 105, 110, 103, 32, 111, 102, 32, 101, 120,
+    112, 47, 99, 108, 101, 97, 114, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34,
+    44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115,
+    79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 72,
+    116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    100, 98, 80, 101, 114, 84, 105, 108, 101, 69, 120, 112, 67, 108, 101, 97, 114, 69, 110, 97, 98, 108, 101, 34, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 98, 80, 101, 114, 84, 105, 108, 101, 69, 120, 112, 67, 108, 101, 97,
+    114, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 57, 55, 49,
+    51, 49, 54, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102,
+    32, 116, 114, 117, 101, 44, 32, 104, 105, 101, 114, 97, 114, 99, 104, 105, 99, 97, 108, 32, 100, 101, 112, 116, 104,
+    32, 116, 101, 115, 116, 105, 110, 103, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108,
+    34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79,
+    110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 123, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 72,
+    116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 125, 93, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    104, 105, 68, 101, 112, 116, 104, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 72,
+    105, 68, 101, 112, 116, 104, 69, 110, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 57, 53, 48, 49, 52, 56, 54, 48, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 104, 105, 101, 114, 97, 114, 99, 104, 105, 99, 97, 108, 32,
+    115, 116, 101, 110, 99, 105, 108, 32, 116, 101, 115, 116, 105, 110, 103, 32, 119, 105, 108, 108, 32, 98, 101, 32,
+    101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 112, 116, 104,
+    47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32,
+    34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58,
+    32, 91, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 116, 114, 117, 101, 93, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 71, 102, 120, 57, 72, 116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 125, 93, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 104, 105, 83, 116, 101, 110, 99, 105, 108, 69, 110, 97, 98, 108, 101, 34, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 72, 105, 83, 116, 101, 110, 99, 105, 108, 69, 110, 97, 98, 108, 101, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 55, 56, 54, 50, 51, 55, 51, 125, 44, 32, 123, 34,
+    86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 50, 53, 54, 45, 98, 105, 116, 32, 114,
+    101, 113, 117, 101, 115, 116, 32, 115, 105, 122, 101, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 53, 49, 50, 45, 98, 105,
+    116, 32, 114, 101, 113, 117, 101, 115, 116, 32, 115, 105, 122, 101, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 49, 125, 93, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 112,
+    101, 99, 105, 102, 105, 101, 115, 32, 116, 104, 101, 32, 68, 66, 32, 114, 101, 97, 100, 32, 114, 101, 113, 117, 101,
+    115, 116, 32, 115, 105, 122, 101, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 112, 116, 104,
+    47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 98, 82, 101, 113, 117, 101, 115, 116, 83, 105, 122, 101, 34, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 68, 98, 82, 101, 113, 117, 101, 115, 116, 83, 105, 122, 101, 34, 44, 32, 34, 70,
+    108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56, 51, 53, 49, 52, 53, 52, 54, 49, 125, 44, 32, 123, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104,
+    101, 32, 68, 66, 95, 82, 69, 78, 68, 69, 82, 95, 79, 86, 69, 82, 82, 73, 68, 69, 50, 46, 68, 73, 83, 65, 66, 76, 69,
+    95, 67, 79, 76, 79, 82, 95, 79, 78, 95, 86, 65, 76, 73, 68, 65, 84, 73, 79, 78, 32, 114, 101, 103, 105, 115, 116,
+    101, 114, 32, 102, 105, 101, 108, 100, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 68, 101, 112, 116, 104,
+    47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 98, 68, 105, 115, 97, 98, 108, 101, 67, 111, 108, 111, 114,
+    79, 110, 86, 97, 108, 105, 100, 97, 116, 105, 111, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 98,
+    68, 105, 115, 97, 98, 108, 101, 67, 111, 108, 111, 114, 79, 110, 86, 97, 108, 105, 100, 97, 116, 105, 111, 110, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 53, 55, 52, 49, 54, 57, 49, 56, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44,
+    32, 111, 110, 99, 104, 105, 112, 32, 71, 83, 32, 119, 105, 108, 108, 32, 98, 101, 32, 117, 115, 101, 100, 32, 105,
+    102, 32, 112, 111, 115, 115, 105, 98, 108, 101, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114,
+    97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101, 79,
+    110, 99, 104, 105, 112, 71, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 79,
+    110, 99, 104, 105, 112, 71, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 51, 52, 52,
+    54, 49, 56, 51, 49, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34,
+    73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117,
+    101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 117, 116, 79, 102, 79, 114, 100, 101, 114,
+    80, 114, 105, 109, 68, 105, 115, 97, 98, 108, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 108, 119, 97, 121, 115, 32, 100, 105,
+    115, 97, 98, 108, 101, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 117, 116, 79, 102, 79,
+    114, 100, 101, 114, 80, 114, 105, 109, 83, 97, 102, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 119,
+    104, 101, 110, 32, 107, 110, 111, 119, 110, 32, 116, 111, 32, 110, 111, 116, 32, 97, 102, 102, 101, 99, 116, 32,
+    114, 101, 110, 100, 101, 114, 32, 111, 117, 116, 112, 117, 116, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 79, 117, 116, 79, 102, 79, 114, 100, 101, 114, 80, 114, 105, 109, 65, 103, 103, 114, 101, 115, 115, 105,
+    118, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 119, 104, 101, 110, 32, 115, 117, 115, 112, 101, 99,
+    116, 101, 100, 32, 116, 111, 32, 110, 111, 116, 32, 97, 102, 102, 101, 99, 116, 32, 114, 101, 110, 100, 101, 114,
+    32, 111, 117, 116, 112, 117, 116, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 117, 116, 79,
+    102, 79, 114, 100, 101, 114, 80, 114, 105, 109, 65, 108, 119, 97, 121, 115, 34, 44, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 51, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 108, 119, 97,
+    121, 115, 32, 101, 110, 97, 98, 108, 101, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 117,
+    116, 79, 102, 79, 114, 100, 101, 114, 80, 114, 105, 109, 77, 111, 100, 101, 34, 125, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 111, 117, 116, 45, 111, 102, 45,
+    111, 114, 100, 101, 114, 32, 112, 114, 105, 109, 105, 116, 105, 118, 101, 32, 109, 111, 100, 101, 46, 32, 79, 110,
+    108, 121, 32, 97, 118, 97, 105, 108, 97, 98, 108, 101, 32, 111, 110, 32, 112, 97, 114, 116, 115, 32, 116, 104, 97,
+    116, 32, 104, 97, 118, 101, 32, 109, 111, 114, 101, 32, 116, 104, 97, 110, 32, 111, 110, 101, 32, 86, 71, 84, 46,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101,
+    108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 79, 117, 116, 79, 102, 79, 114, 100, 101, 114,
+    80, 114, 105, 109, 83, 97, 102, 101, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101,
+    110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97,
+    98, 108, 101, 79, 117, 116, 79, 102, 79, 114, 100, 101, 114, 80, 114, 105, 109, 105, 116, 105, 118, 101, 115, 34,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 79, 117, 116, 79, 102, 79, 114, 100, 101,
+    114, 80, 114, 105, 109, 105, 116, 105, 118, 101, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 52, 49, 57, 52, 54, 50, 52, 54, 50, 51, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58,
+    32, 34, 76, 101, 115, 115, 84, 104, 97, 110, 79, 114, 69, 113, 117, 97, 108, 34, 44, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 86, 97, 108, 117, 101, 115, 32, 97, 114, 101, 32, 108, 111, 103, 40,
+    50, 41, 32, 111, 102, 32, 116, 104, 101, 32, 119, 97, 116, 101, 114, 109, 97, 114, 107, 46, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 55, 125, 93, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 84, 104, 101, 32, 119, 97, 116, 101, 114, 109, 97, 114, 107, 32, 118, 97, 108, 117, 101, 32, 102, 111,
+    114, 32, 111, 117, 116, 45, 111, 102, 45, 111, 114, 100, 101, 114, 32, 112, 114, 105, 109, 105, 116, 105, 118, 101,
+    115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105,
+    112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 55, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 111, 117, 116, 79, 102, 79, 114, 100, 101, 114, 87, 97, 116, 101, 114, 109, 97,
+    114, 107, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 117, 116, 79, 102, 79, 114, 100, 101, 114, 87, 97,
+    116, 101, 114, 109, 97, 114, 107, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 50, 49,
+    57, 52, 57, 53, 50, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    73, 102, 32, 116, 114, 117, 101, 44, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 118, 101, 114, 116, 101, 120, 32,
+    103, 114, 111, 117, 112, 105, 110, 103, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 105, 110, 32, 71, 69,
+    95, 67, 78, 84, 76, 32, 114, 101, 103, 105, 115, 116, 101, 114, 32, 102, 111, 114, 32, 71, 102, 120, 49, 48, 43, 32,
+    65, 83, 73, 67, 115, 32, 98, 121, 32, 115, 101, 116, 116, 105, 110, 103, 32, 86, 69, 82, 84, 95, 71, 82, 80, 95, 83,
+    73, 90, 69, 32, 116, 111, 32, 50, 53, 54, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110,
+    101, 114, 97, 108, 34, 44, 32, 34, 71, 102, 120, 49, 48, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 71, 101, 67, 110, 116, 108, 86, 116, 120, 71,
+    114, 111, 117, 112, 105, 110, 103, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101,
+    71, 101, 67, 110, 116, 108, 86, 116, 120, 71, 114, 111, 117, 112, 105, 110, 103, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 51, 48, 52, 53, 50, 50, 57, 57, 51, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 116, 104, 101, 32, 72, 87,
+    45, 71, 83, 32, 115, 116, 97, 103, 101, 32, 119, 105, 108, 108, 32, 112, 114, 101, 102, 101, 114, 32, 116, 111, 32,
+    115, 101, 110, 100, 32, 97, 32, 119, 97, 118, 101, 32, 116, 111, 32, 101, 97, 99, 104, 32, 83, 73, 77, 68, 32, 105,
+    110, 32, 97, 32, 67, 85, 32, 98, 101, 102, 111, 114, 101, 32, 109, 111, 118, 105, 110, 103, 32, 116, 111, 32, 116,
+    104, 101, 32, 110, 101, 120, 116, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 46, 32, 73, 102, 32, 102, 97,
+    108, 115, 101, 44, 32, 72, 87, 45, 71, 83, 32, 112, 114, 101, 102, 101, 114, 115, 32, 116, 111, 32, 115, 101, 110,
+    100, 32, 111, 110, 108, 121, 32, 111, 110, 101, 32, 119, 97, 118, 101, 32, 116, 111, 32, 101, 97, 99, 104, 32, 67,
+    85, 32, 98, 101, 102, 111, 114, 101, 32, 109, 111, 118, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32, 110,
+    101, 120, 116, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71,
+    102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 115,
+    67, 117, 71, 114, 111, 117, 112, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    71, 115, 67, 117, 71, 114, 111, 117, 112, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 50, 57, 53, 50, 54, 50, 57, 54, 55, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 76, 111, 103, 105, 99,
+    79, 112, 34, 58, 32, 34, 77, 117, 108, 116, 105, 112, 108, 101, 79, 102, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 117, 115, 116, 32, 98, 101, 32, 49, 50, 56, 32, 100, 119, 111, 114,
+    100, 32, 97, 108, 105, 103, 110, 101, 100, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 50, 56, 125,
+    93, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109,
+    117, 109, 32, 97, 109, 111, 117, 110, 116, 32, 111, 102, 32, 76, 68, 83, 32, 115, 112, 97, 99, 101, 32, 116, 111,
+    32, 97, 108, 108, 111, 99, 32, 102, 111, 114, 32, 101, 97, 99, 104, 32, 111, 110, 45, 99, 104, 105, 112, 32, 71, 83,
+    32, 115, 117, 98, 103, 114, 111, 117, 112, 44, 32, 105, 110, 32, 68, 87, 79, 82, 68, 115, 46, 34, 44, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101,
+    115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 56, 49, 57, 50, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 103, 115, 77, 97, 120, 76, 100, 115, 83, 105, 122, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 71, 115, 77, 97, 120, 76, 100, 115, 83, 105, 122, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 51, 48, 51, 51, 55, 53, 57, 53, 51, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 71, 83, 32,
+    112, 114, 105, 109, 115, 32, 112, 101, 114, 32, 115, 117, 98, 103, 114, 111, 117, 112, 32, 42, 32, 71, 83, 32, 105,
+    110, 115, 116, 97, 110, 99, 101, 32, 99, 111, 117, 110, 116, 32, 105, 115, 32, 108, 101, 115, 115, 32, 116, 104, 97,
+    110, 32, 116, 104, 105, 115, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 32, 117, 115, 101, 32, 111, 102, 102,
+    45, 99, 104, 105, 112, 32, 71, 83, 46, 32, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112,
+    104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 54, 52,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 115, 79, 102, 102, 67, 104, 105, 112, 84,
+    104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 115, 79, 102, 102, 67,
+    104, 105, 112, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 49, 54, 53, 57, 48, 55, 53, 54, 57, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 84, 97, 114, 103, 101, 116, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 71, 83, 32,
+    112, 114, 105, 109, 115, 32, 112, 101, 114, 32, 115, 117, 98, 103, 114, 111, 117, 112, 32, 119, 104, 101, 110, 32,
+    114, 117, 110, 110, 105, 110, 103, 32, 119, 105, 116, 104, 32, 111, 110, 45, 99, 104, 105, 112, 32, 71, 83, 46, 32,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101,
+    108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 54, 52, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 105, 100, 101, 97, 108, 71, 115, 80, 114, 105, 109, 115, 80, 101, 114, 83, 117, 98,
+    71, 114, 111, 117, 112, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 115, 80, 114, 105, 109, 115, 80, 101,
+    114, 83, 117, 98, 71, 114, 111, 117, 112, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48,
+    55, 52, 51, 55, 55, 54, 50, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32,
+    123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 76,
+    101, 115, 115, 84, 104, 97, 110, 79, 114, 69, 113, 117, 97, 108, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    49, 50, 55, 125, 93, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111,
+    110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 102, 111, 114, 32, 108, 97, 116,
+    101, 45, 97, 108, 108, 111, 99, 32, 71, 83, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97,
+    112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    49, 54, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 97, 116, 101, 65, 108, 108, 111,
+    99, 71, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 71, 115, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 48, 50, 53, 48, 56, 48, 48, 52, 125, 44, 32,
+    123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58,
+    32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 66, 101, 104, 97, 118, 105, 111, 114, 76, 101, 103, 97,
+    99, 121, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 108, 97, 116, 101, 45, 97, 108, 108, 111, 99, 32, 118,
+    115, 44, 32, 98, 117, 116, 32, 105, 110, 99, 111, 114, 114, 101, 99, 116, 108, 121, 32, 109, 97, 115, 107, 115, 32,
+    111, 102, 102, 32, 67, 85, 115, 32, 105, 110, 32, 100, 121, 110, 97, 109, 105, 99, 32, 109, 111, 100, 101, 34, 125,
+    44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 66, 101, 104,
+    97, 118, 105, 111, 114, 68, 121, 110, 97, 109, 105, 99, 69, 110, 97, 98, 108, 101, 65, 108, 108, 67, 117, 115, 34,
+    44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 108, 97, 116, 101, 45, 97, 108, 108, 111, 99, 32, 118, 115, 44, 32,
+    98, 117, 116, 32, 100, 111, 110, 39, 116, 32, 109, 97, 115, 107, 32, 111, 102, 102, 32, 67, 85, 115, 34, 125, 44,
+    32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 66, 101, 104, 97,
+    118, 105, 111, 114, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32,
+    108, 97, 116, 101, 45, 97, 108, 108, 111, 99, 32, 118, 115, 32, 101, 110, 116, 105, 114, 101, 108, 121, 34, 125, 93,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 66, 101, 104, 97,
+    118, 105, 111, 114, 34, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67,
+    111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 98, 101, 104, 97, 118, 105, 111, 114, 32, 102, 111, 114,
+    32, 108, 97, 116, 101, 45, 97, 108, 108, 111, 99, 32, 86, 83, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102,
+    120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 66, 101, 104, 97, 118, 105, 111, 114, 76,
+    101, 103, 97, 99, 121, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 97, 116, 101, 65, 108,
+    108, 111, 99, 86, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99,
+    86, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 48, 53, 48, 50, 51, 57, 51, 51,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 108, 97, 109, 112,
+    115, 32, 116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105,
+    111, 110, 32, 102, 97, 99, 116, 111, 114, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97,
+    112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    54, 52, 46, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 84, 101, 115, 115,
+    70, 97, 99, 116, 111, 114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 84, 101, 115, 115, 70, 97,
+    99, 116, 111, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50, 55, 50, 53, 48, 52, 49,
+    49, 49, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 91, 123, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 76, 101, 115, 115, 84, 104,
+    97, 110, 79, 114, 69, 113, 117, 97, 108, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 111, 102, 102, 99, 104, 105, 112, 32, 116, 101, 115, 115,
+    101, 108, 108, 97, 116, 105, 111, 110, 32, 98, 117, 102, 102, 101, 114, 115, 46, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 53, 48, 56, 125, 93, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32,
+    76, 68, 83, 32, 98, 117, 102, 102, 101, 114, 115, 32, 117, 115, 101, 100, 32, 102, 111, 114, 32, 111, 102, 102, 99,
+    104, 105, 112, 32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 58, 32, 71, 102, 120, 57, 58, 32, 49,
+    45, 62, 53, 48, 56, 58, 32, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 111, 102, 102, 99, 104, 105, 112, 32, 116,
+    101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 98, 117, 102, 102, 101, 114, 115, 46, 34, 44, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101,
+    115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 53, 48, 56, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 110, 117, 109, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 115, 34, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 117, 109, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102,
+    102, 101, 114, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 49, 53, 48, 57, 49, 53, 52,
+    55, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110,
+    116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 112, 97, 116, 99,
+    104, 101, 115, 45, 112, 101, 114, 45, 116, 104, 114, 101, 97, 100, 45, 103, 114, 111, 117, 112, 32, 116, 111, 32,
+    114, 117, 110, 32, 119, 104, 101, 110, 32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 105, 115, 32,
+    101, 110, 97, 98, 108, 101, 100, 46, 32, 84, 104, 105, 115, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 110, 111,
+    114, 109, 97, 108, 108, 121, 32, 108, 105, 109, 105, 116, 101, 100, 32, 98, 121, 32, 104, 97, 114, 100, 119, 97,
+    114, 101, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 32, 40, 76, 68, 83, 44, 84, 70, 66, 117, 102, 102, 101,
+    114, 44, 32, 84, 104, 114, 101, 97, 100, 115, 41, 46, 32, 45, 32, 83, 101, 116, 116, 105, 110, 103, 32, 116, 111,
+    32, 49, 32, 119, 105, 108, 108, 32, 97, 108, 119, 97, 121, 115, 32, 119, 111, 114, 107, 44, 32, 98, 117, 116, 32,
+    105, 115, 32, 115, 108, 111, 119, 101, 115, 116, 46, 32, 45, 32, 83, 101, 116, 116, 105, 110, 103, 32, 116, 111, 32,
+    48, 32, 119, 105, 108, 108, 32, 97, 108, 108, 111, 119, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32,
+    116, 111, 32, 99, 104, 111, 111, 115, 101, 32, 116, 104, 101, 32, 111, 112, 116, 105, 109, 97, 108, 32, 118, 97,
+    108, 117, 101, 46, 32, 45, 32, 65, 110, 121, 32, 111, 116, 104, 101, 114, 32, 118, 97, 108, 117, 101, 32, 119, 105,
+    108, 108, 32, 98, 101, 32, 117, 115, 101, 100, 32, 40, 99, 108, 97, 109, 112, 101, 100, 32, 98, 97, 115, 101, 100,
+    32, 111, 110, 32, 72, 87, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 41, 46, 32, 79, 102, 102, 99, 104, 105,
+    112, 32, 84, 101, 115, 115, 32, 114, 111, 117, 110, 100, 115, 32, 116, 104, 105, 115, 32, 116, 111, 32, 116, 104,
+    101, 32, 110, 101, 97, 114, 101, 115, 116, 32, 109, 117, 108, 116, 105, 112, 108, 101, 32, 111, 102, 32, 102, 111,
+    117, 114, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80,
+    105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 117, 109, 84, 101, 115, 115, 80, 97, 116, 99, 104, 101, 115, 80, 101,
+    114, 84, 103, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 117, 109, 84, 101, 115, 115, 80, 97, 116, 99,
+    104, 101, 115, 80, 101, 114, 84, 104, 114, 101, 97, 100, 71, 114, 111, 117, 112, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 54, 57, 57, 53, 51, 50, 51, 48, 50, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32,
+    116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 56, 49, 57, 50,
+    34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 56, 107, 32, 68, 87, 79, 82, 68, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 52, 48, 57,
+    54, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 52, 107, 32, 68, 87, 79, 82, 68, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 50, 48,
+    52, 56, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 50, 107, 32, 68, 87, 79, 82, 68, 115, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 49,
+    48, 50, 52, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 49, 107, 32, 68, 87, 79, 82, 68, 115, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 34,
+    125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111,
+    108, 115, 32, 116, 104, 101, 32, 115, 105, 122, 101, 32, 111, 102, 32, 101, 97, 99, 104, 32, 111, 102, 102, 99, 104,
+    105, 112, 32, 76, 68, 83, 32, 66, 117, 102, 102, 101, 114, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120,
+    57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 34, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 56,
+    49, 57, 50, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 102, 102, 99, 104, 105, 112, 76,
+    100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 102,
+    102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 54, 50, 56, 51, 57, 55, 57, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 104, 97,
+    114, 100, 119, 97, 114, 101, 32, 119, 104, 101, 110, 32, 100, 105, 115, 116, 114, 105, 98, 117, 116, 101, 100, 32,
+    116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 105, 115, 32, 97, 99, 116, 105, 118, 101, 58, 32,
+    116, 104, 101, 32, 109, 105, 110, 32, 116, 101, 115, 115, 32, 102, 97, 99, 116, 111, 114, 115, 32, 102, 111, 114,
+    32, 101, 97, 99, 104, 32, 112, 97, 116, 99, 104, 32, 112, 114, 111, 99, 101, 115, 115, 101, 100, 32, 98, 121, 32,
+    97, 32, 86, 71, 84, 32, 97, 114, 101, 32, 97, 99, 99, 117, 109, 117, 108, 97, 116, 101, 100, 46, 32, 87, 104, 101,
+    110, 32, 116, 104, 101, 32, 115, 117, 109, 32, 101, 120, 99, 101, 101, 100, 115, 32, 116, 104, 105, 115, 32, 116,
+    104, 114, 101, 115, 104, 111, 108, 100, 44, 32, 116, 104, 101, 32, 110, 101, 120, 116, 32, 112, 97, 116, 99, 104,
+    32, 105, 115, 32, 115, 101, 110, 116, 32, 116, 111, 32, 97, 32, 100, 105, 102, 102, 101, 114, 101, 110, 116, 32, 86,
+    71, 84, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105,
+    112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 48, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 115, 111, 108, 105, 110, 101, 68, 105, 115, 116, 114, 105, 98, 117, 116,
+    105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 115, 111, 108, 105,
+    110, 101, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 53, 49, 57, 54, 49, 54, 51, 51, 125, 44, 32, 123, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 104,
+    97, 114, 100, 119, 97, 114, 101, 32, 119, 104, 101, 110, 32, 100, 105, 115, 116, 114, 105, 98, 117, 116, 101, 100,
+    32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 105, 115, 32, 97, 99, 116, 105, 118, 101, 58, 32,
+    116, 104, 101, 32, 109, 105, 110, 32, 116, 101, 115, 115, 32, 102, 97, 99, 116, 111, 114, 115, 32, 102, 111, 114,
+    32, 101, 97, 99, 104, 32, 112, 97, 116, 99, 104, 32, 112, 114, 111, 99, 101, 115, 115, 101, 100, 32, 98, 121, 32,
+    97, 32, 86, 71, 84, 32, 97, 114, 101, 32, 97, 99, 99, 117, 109, 117, 108, 97, 116, 101, 100, 46, 32, 87, 104, 101,
+    110, 32, 116, 104, 101, 32, 115, 117, 109, 32, 101, 120, 99, 101, 101, 100, 115, 32, 116, 104, 105, 115, 32, 116,
+    104, 114, 101, 115, 104, 111, 108, 100, 44, 32, 116, 104, 101, 32, 110, 101, 120, 116, 32, 112, 97, 116, 99, 104,
+    32, 105, 115, 32, 115, 101, 110, 116, 32, 116, 111, 32, 97, 32, 100, 105, 102, 102, 101, 114, 101, 110, 116, 32, 86,
+    71, 84, 46, 32, 82, 101, 99, 111, 109, 109, 101, 110, 100, 101, 100, 32, 116, 111, 32, 98, 101, 32, 104, 105, 103,
+    104, 101, 114, 32, 116, 104, 97, 110, 32, 113, 117, 97, 100, 32, 102, 97, 99, 116, 111, 114, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115,
+    34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 51, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 116, 114, 105, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 114, 105, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70,
+    97, 99, 116, 111, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56, 54, 55, 53, 54, 54,
+    49, 55, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101,
+    100, 32, 98, 121, 32, 116, 104, 101, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 119, 104, 101, 110, 32, 100, 105,
+    115, 116, 114, 105, 98, 117, 116, 101, 100, 32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 105,
+    115, 32, 97, 99, 116, 105, 118, 101, 58, 32, 116, 104, 101, 32, 109, 105, 110, 32, 116, 101, 115, 115, 32, 102, 97,
+    99, 116, 111, 114, 115, 32, 102, 111, 114, 32, 101, 97, 99, 104, 32, 112, 97, 116, 99, 104, 32, 112, 114, 111, 99,
+    101, 115, 115, 101, 100, 32, 98, 121, 32, 97, 32, 86, 71, 84, 32, 97, 114, 101, 32, 97, 99, 99, 117, 109, 117, 108,
+    97, 116, 101, 100, 46, 32, 87, 104, 101, 110, 32, 116, 104, 101, 32, 115, 117, 109, 32, 101, 120, 99, 101, 101, 100,
+    115, 32, 116, 104, 105, 115, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 44, 32, 116, 104, 101, 32, 110, 101,
+    120, 116, 32, 112, 97, 116, 99, 104, 32, 105, 115, 32, 115, 101, 110, 116, 32, 116, 111, 32, 97, 32, 100, 105, 102,
+    102, 101, 114, 101, 110, 116, 32, 86, 71, 84, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97,
+    112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    50, 52, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 113, 117, 97, 100, 68, 105, 115, 116,
+    114, 105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    81, 117, 97, 100, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 54, 48, 48, 49, 53, 57, 49, 57, 125, 44, 32, 123, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 100, 32, 98, 121, 32, 116, 104, 101,
+    32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 119, 104, 101, 110, 32, 100, 105, 115, 116, 114, 105, 98, 117, 116,
+    101, 100, 32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 105, 115, 32, 105, 110, 32, 68, 79, 78,
+    85, 84, 32, 109, 111, 100, 101, 58, 32, 116, 104, 101, 32, 109, 105, 110, 32, 116, 101, 115, 115, 32, 102, 97, 99,
+    116, 111, 114, 32, 102, 111, 114, 32, 101, 97, 99, 104, 32, 112, 97, 116, 99, 104, 32, 105, 115, 32, 116, 101, 115,
+    116, 101, 100, 32, 97, 103, 97, 105, 110, 115, 116, 32, 116, 104, 105, 115, 32, 116, 104, 114, 101, 115, 104, 111,
+    108, 100, 32, 116, 111, 32, 100, 101, 116, 101, 114, 109, 105, 110, 101, 32, 119, 104, 101, 116, 104, 101, 114, 32,
+    97, 32, 112, 97, 116, 99, 104, 32, 103, 101, 116, 115, 32, 115, 112, 108, 105, 116, 32, 117, 112, 46, 32, 73, 102,
+    32, 116, 104, 101, 32, 112, 97, 116, 99, 104, 32, 105, 115, 110, 39, 116, 32, 115, 112, 108, 105, 116, 44, 32, 105,
+    116, 32, 115, 116, 105, 108, 108, 32, 105, 110, 99, 114, 101, 109, 101, 110, 116, 115, 32, 116, 104, 101, 32, 97,
+    99, 99, 117, 109, 117, 108, 97, 116, 111, 114, 32, 102, 111, 114, 32, 116, 104, 101, 32, 80, 97, 116, 99, 104, 32,
+    100, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 32, 102, 97, 99, 116, 111, 114, 46, 34, 44, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101,
+    115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 50, 52, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 100, 111, 110, 117, 116, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111,
+    114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 111, 110, 117, 116, 68, 105, 115, 116, 114, 105, 98, 117,
+    116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56,
+    57, 49, 56, 56, 49, 49, 56, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 85, 115, 101, 100, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 100, 105, 115, 116, 114, 105, 98, 117,
+    116, 105, 111, 110, 32, 109, 111, 100, 101, 32, 105, 115, 32, 84, 82, 65, 80, 69, 90, 79, 73, 68, 32, 102, 111, 114,
+    32, 113, 117, 97, 100, 32, 97, 110, 100, 32, 116, 114, 105, 32, 100, 111, 109, 97, 105, 110, 32, 116, 121, 112, 101,
+    115, 46, 32, 84, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 100, 111, 110, 117, 116, 115, 32, 105,
+    110, 32, 116, 104, 101, 32, 112, 97, 116, 99, 104, 32, 97, 114, 101, 32, 99, 111, 109, 112, 97, 114, 101, 100, 32,
+    97, 103, 97, 105, 110, 115, 116, 32, 116, 104, 105, 115, 32, 118, 97, 108, 117, 101, 32, 116, 111, 32, 100, 101,
+    116, 101, 109, 105, 110, 101, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 104, 105, 115, 32, 100, 111, 110, 117,
+    116, 32, 103, 101, 116, 115, 32, 115, 112, 108, 105, 116, 32, 117, 112, 32, 105, 110, 116, 111, 32, 116, 114, 97,
+    112, 101, 122, 111, 105, 100, 115, 32, 40, 110, 101, 101, 100, 115, 32, 116, 104, 101, 32, 112, 97, 116, 99, 104,
+    32, 116, 111, 32, 98, 101, 32, 105, 110, 32, 100, 111, 110, 117, 116, 32, 109, 111, 100, 101, 41, 46, 32, 65, 32,
+    118, 97, 108, 117, 101, 32, 111, 102, 32, 48, 32, 111, 114, 32, 49, 32, 119, 105, 108, 108, 32, 98, 101, 32, 116,
+    114, 101, 97, 116, 101, 100, 32, 97, 115, 32, 50, 46, 32, 84, 104, 101, 32, 105, 110, 110, 101, 114, 109, 111, 115,
+    116, 32, 100, 111, 110, 117, 116, 32, 105, 115, 32, 110, 101, 118, 101, 114, 32, 97, 108, 108, 111, 119, 101, 100,
+    32, 116, 111, 32, 98, 101, 32, 98, 114, 111, 107, 101, 110, 32, 105, 110, 116, 111, 32, 116, 114, 97, 112, 101, 122,
+    111, 105, 100, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115,
+    32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 54, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 114, 97, 112, 101, 122, 111, 105, 100, 68, 105, 115, 116, 114, 105,
+    98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 114,
+    97, 112, 101, 122, 111, 105, 100, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111,
+    114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54, 55, 52, 57, 56, 52, 54, 52, 54, 125, 44,
+    32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 117, 109, 98, 101, 114, 32,
+    111, 102, 32, 112, 114, 105, 109, 105, 116, 105, 118, 101, 115, 32, 115, 101, 110, 116, 32, 116, 111, 32, 111, 110,
+    101, 32, 86, 71, 84, 32, 98, 101, 102, 111, 114, 101, 32, 115, 119, 105, 116, 99, 104, 105, 110, 103, 32, 116, 111,
+    32, 116, 104, 101, 32, 110, 101, 120, 116, 46, 32, 86, 97, 108, 105, 100, 32, 114, 97, 110, 103, 101, 32, 105, 115,
+    32, 49, 45, 54, 53, 53, 51, 54, 44, 32, 118, 97, 108, 117, 101, 115, 32, 108, 97, 114, 103, 101, 114, 32, 116, 104,
+    97, 110, 32, 50, 53, 54, 32, 97, 114, 101, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 116, 111, 32, 104, 117,
+    114, 116, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 46, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116,
+    105, 110, 103, 32, 111, 110, 108, 121, 32, 97, 102, 102, 101, 99, 116, 115, 32, 110, 111, 110, 45, 116, 101, 115,
+    115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 97, 110, 100, 32, 110, 111, 110, 45, 78, 71, 71, 32, 112, 105, 112,
+    101, 108, 105, 110, 101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105,
+    99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 50, 56, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 105, 109, 71, 114, 111, 117, 112, 83, 105,
+    122, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 105, 109, 103, 114, 111, 117, 112, 83, 105,
+    122, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 48, 50, 53, 48, 52, 51, 50, 53,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114,
+    117, 101, 44, 32, 82, 98, 80, 108, 117, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101,
+    100, 32, 102, 111, 114, 32, 65, 83, 73, 67, 32, 111, 102, 32, 82, 98, 80, 108, 117, 115, 32, 99, 97, 112, 97, 98,
+    105, 108, 105, 116, 121, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99,
+    115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 102, 120, 57, 82, 98, 80, 108, 117, 115, 69, 110, 97,
+    98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 98, 80, 108, 117, 115, 69, 110, 97, 98, 108,
+    101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49, 50, 50, 49, 54, 52, 51, 48, 50, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 86, 97, 108, 117, 101, 32,
+    116, 111, 32, 112, 114, 111, 103, 114, 97, 109, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102,
+    32, 99, 97, 99, 104, 101, 32, 108, 105, 110, 101, 115, 32, 102, 111, 114, 32, 83, 80, 73, 95, 83, 72, 65, 68, 69,
+    82, 95, 76, 65, 84, 69, 95, 65, 76, 76, 79, 67, 95, 86, 83, 32, 116, 111, 46, 32, 84, 104, 101, 32, 114, 97, 110,
+    103, 101, 32, 105, 115, 32, 91, 48, 44, 32, 54, 51, 93, 46, 32, 84, 104, 101, 32, 100, 101, 102, 97, 117, 108, 116,
+    32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 50, 53, 53, 32, 99, 104, 97, 110, 103, 101, 115, 32, 116, 111, 32, 40,
+    110, 117, 109, 67, 85, 115, 47, 83, 65, 32, 45, 32, 49, 41, 32, 42, 32, 52, 46, 34, 44, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32,
+    34, 71, 102, 120, 49, 48, 34, 93, 44, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 76, 101,
+    115, 115, 84, 104, 97, 110, 79, 114, 69, 113, 117, 97, 108, 34, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 99, 97, 99, 104, 101, 32, 108, 105,
+    110, 101, 115, 32, 116, 111, 32, 112, 114, 111, 103, 114, 97, 109, 32, 83, 80, 73, 95, 83, 72, 65, 68, 69, 82, 95,
+    76, 65, 84, 69, 95, 65, 76, 76, 79, 67, 95, 86, 83, 32, 116, 111, 46, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 54, 51, 125, 93, 125, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 50, 53, 53, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103,
+    102, 120, 49, 48, 83, 112, 105, 83, 104, 97, 100, 101, 114, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 78,
+    117, 109, 76, 105, 110, 101, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 49, 48, 83, 112,
+    105, 83, 104, 97, 100, 101, 114, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 78, 117, 109, 76, 105, 110, 101,
+    115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 51, 48, 55, 48, 52, 48, 50, 49, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 86, 97, 108, 117, 101, 32,
+    116, 111, 32, 112, 114, 111, 103, 114, 97, 109, 32, 71, 69, 95, 80, 67, 95, 65, 76, 76, 79, 67, 58, 58, 78, 85, 77,
+    95, 80, 67, 95, 76, 73, 78, 69, 83, 32, 116, 111, 32, 102, 111, 114, 32, 108, 101, 103, 97, 99, 121, 32, 97, 110,
+    100, 32, 78, 71, 71, 45, 112, 97, 115, 115, 116, 104, 114, 117, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46,
+    32, 84, 104, 101, 32, 118, 97, 108, 117, 101, 32, 105, 110, 32, 116, 104, 105, 115, 32, 115, 101, 116, 116, 105,
+    110, 103, 32, 105, 115, 32, 112, 101, 114, 32, 115, 104, 97, 100, 101, 114, 45, 101, 110, 103, 105, 110, 101, 46,
+    32, 84, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 109, 117, 108, 116, 105, 112, 108, 105, 101, 115, 32, 116,
+    104, 105, 115, 32, 118, 97, 108, 117, 101, 32, 98, 121, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111,
+    102, 32, 115, 104, 97, 100, 101, 114, 32, 101, 110, 103, 105, 110, 101, 115, 32, 97, 110, 100, 32, 116, 104, 101,
+    110, 32, 115, 117, 98, 116, 114, 97, 99, 116, 115, 32, 49, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120,
+    49, 48, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 49, 50, 56, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110,
+    116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 102, 120,
+    49, 48, 71, 101, 80, 99, 65, 108, 108, 111, 99, 78, 117, 109, 76, 105, 110, 101, 115, 80, 101, 114, 83, 101, 76,
+    101, 103, 97, 99, 121, 78, 103, 103, 80, 97, 115, 115, 116, 104, 114, 117, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 71, 102, 120, 49, 48, 71, 101, 80, 99, 65, 108, 108, 111, 99, 78, 117, 109, 76, 105, 110, 101, 115, 80, 101,
+    114, 83, 101, 76, 101, 103, 97, 99, 121, 78, 103, 103, 80, 97, 115, 115, 116, 104, 114, 117, 34, 44, 32, 34, 70,
+    108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 82, 101,
+    114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 53, 57, 50, 57, 50, 52, 52, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 86, 97, 108, 117, 101, 32, 116, 111, 32, 112, 114, 111, 103, 114,
+    97, 109, 32, 71, 69, 95, 80, 67, 95, 65, 76, 76, 79, 67, 58, 58, 78, 85, 77, 95, 80, 67, 95, 76, 73, 78, 69, 83, 32,
+    116, 111, 32, 102, 111, 114, 32, 78, 71, 71, 45, 99, 117, 108, 108, 105, 110, 103, 32, 112, 105, 112, 101, 108, 105,
+    110, 101, 115, 46, 32, 84, 104, 101, 32, 118, 97, 108, 117, 101, 32, 105, 110, 32, 116, 104, 105, 115, 32, 115, 101,
+    116, 116, 105, 110, 103, 32, 105, 115, 32, 112, 101, 114, 32, 115, 104, 97, 100, 101, 114, 45, 101, 110, 103, 105,
+    110, 101, 46, 32, 84, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 109, 117, 108, 116, 105, 112, 108, 105, 101,
+    115, 32, 116, 104, 105, 115, 32, 118, 97, 108, 117, 101, 32, 98, 121, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101,
+    114, 32, 111, 102, 32, 115, 104, 97, 100, 101, 114, 32, 101, 110, 103, 105, 110, 101, 115, 32, 97, 110, 100, 32,
+    116, 104, 101, 110, 32, 115, 117, 98, 116, 114, 97, 99, 116, 115, 32, 49, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34,
+    71, 102, 120, 49, 48, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 50, 53, 54, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    103, 102, 120, 49, 48, 71, 101, 80, 99, 65, 108, 108, 111, 99, 78, 117, 109, 76, 105, 110, 101, 115, 80, 101, 114,
+    83, 101, 78, 103, 103, 67, 117, 108, 108, 105, 110, 103, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102,
+    120, 49, 48, 71, 101, 80, 99, 65, 108, 108, 111, 99, 78, 117, 109, 76, 105, 110, 101, 115, 80, 101, 114, 83, 101,
+    78, 103, 103, 67, 117, 108, 108, 105, 110, 103, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115,
+    72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54,
+    54, 53, 52, 55, 50, 55, 49, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 87, 104, 101, 110, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 103, 114, 101, 97, 116, 101, 114, 32, 116,
+    104, 97, 110, 32, 122, 101, 114, 111, 44, 32, 116, 104, 101, 110, 32, 105, 116, 32, 115, 112, 101, 99, 105, 102,
+    105, 101, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 80, 83, 32, 119, 97, 118, 101,
+    115, 32, 116, 111, 32, 98, 101, 32, 115, 111, 102, 116, 32, 103, 114, 111, 117, 112, 101, 100, 46, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110,
+    101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 110, 117, 109, 80, 115, 87, 97, 118, 101, 115, 83, 111, 102, 116, 71, 114, 111, 117, 112, 101, 100, 80,
+    101, 114, 67, 117, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 117, 109, 80, 115, 87, 97, 118, 101, 115,
+    83, 111, 102, 116, 71, 114, 111, 117, 112, 101, 100, 80, 101, 114, 67, 117, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 49, 56, 55, 49, 53, 57, 48, 54, 50, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 110, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 103, 114,
+    101, 97, 116, 101, 114, 32, 116, 104, 97, 110, 32, 122, 101, 114, 111, 44, 32, 116, 104, 101, 110, 32, 105, 116, 32,
+    115, 112, 101, 99, 105, 102, 105, 101, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32,
+    86, 83, 32, 119, 97, 118, 101, 115, 32, 116, 111, 32, 98, 101, 32, 115, 111, 102, 116, 32, 103, 114, 111, 117, 112,
+    101, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80,
+    105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 117, 109, 86, 115, 87, 97, 118, 101, 115, 83, 111, 102, 116, 71, 114,
+    111, 117, 112, 101, 100, 80, 101, 114, 67, 117, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 117, 109, 86,
+    115, 87, 97, 118, 101, 115, 83, 111, 102, 116, 71, 114, 111, 117, 112, 101, 100, 80, 101, 114, 67, 117, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 50, 49, 49, 51, 50, 55, 55, 49, 125, 44, 32, 123, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 116,
+    104, 101, 32, 72, 87, 32, 119, 105, 108, 108, 32, 97, 108, 116, 101, 114, 110, 97, 116, 101, 32, 86, 71, 84, 39,
+    115, 32, 98, 101, 116, 119, 101, 101, 110, 32, 100, 114, 97, 119, 115, 32, 114, 97, 116, 104, 101, 114, 32, 116,
+    104, 97, 110, 32, 98, 101, 116, 119, 101, 101, 110, 32, 115, 101, 116, 115, 32, 111, 102, 32, 112, 114, 105, 109,
+    105, 116, 105, 118, 101, 115, 32, 119, 105, 116, 104, 105, 110, 32, 97, 32, 100, 114, 97, 119, 46, 32, 84, 114, 117,
+    101, 32, 105, 115, 32, 115, 97, 102, 101, 114, 44, 32, 98, 117, 116, 32, 108, 101, 115, 115, 32, 112, 101, 114, 102,
+    111, 114, 109, 97, 110, 116, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105,
+    99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108,
+    115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 119, 105, 116, 99, 104, 86, 103, 116, 79,
+    110, 68, 114, 97, 119, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 119, 105, 116, 99, 104, 86, 103, 116,
+    79, 110, 68, 114, 97, 119, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 48, 50, 48, 49,
+    51, 57, 48, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111,
+    110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 115, 105, 122, 101, 32, 111, 102, 32, 116, 104, 101, 32, 116,
+    101, 115, 115, 45, 102, 97, 99, 116, 111, 114, 32, 98, 117, 102, 102, 101, 114, 46, 32, 84, 104, 105, 115, 32, 115,
+    105, 122, 101, 32, 105, 115, 32, 112, 101, 114, 45, 83, 69, 44, 32, 97, 110, 100, 109, 101, 97, 115, 117, 114, 101,
+    100, 32, 105, 110, 32, 68, 87, 79, 82, 68, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114,
+    97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 56, 49, 57, 50, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 101, 115, 115, 70, 97,
+    99, 116, 111, 114, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 80, 101, 114, 83, 101, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 84, 101, 115, 115, 70, 97, 99, 116, 111, 114, 66, 117, 102, 102, 101, 114, 83, 105, 122,
+    101, 80, 101, 114, 83, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49, 49, 50, 48, 49,
+    54, 54, 53, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 86, 101,
+    114, 116, 101, 120, 32, 119, 97, 108, 107, 105, 110, 103, 32, 112, 97, 116, 116, 101, 114, 110, 32, 102, 111, 114,
+    32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 58, 32, 48, 58, 32, 40, 100, 101, 102, 97, 117, 108,
+    116, 41, 32, 68, 111, 110, 117, 116, 32, 119, 97, 108, 107, 105, 110, 103, 32, 112, 97, 116, 116, 101, 114, 110, 32,
+    102, 111, 114, 32, 111, 112, 116, 105, 109, 97, 108, 32, 114, 101, 117, 115, 101, 46, 32, 49, 58, 32, 83, 105, 110,
+    103, 108, 101, 45, 114, 105, 110, 103, 32, 119, 97, 108, 107, 105, 110, 103, 32, 112, 97, 116, 116, 101, 114, 110,
+    44, 32, 104, 97, 115, 32, 115, 117, 98, 111, 112, 116, 105, 109, 97, 108, 32, 114, 101, 117, 115, 101, 46, 34, 44,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105,
+    110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 84, 101, 115, 115, 68, 111, 110, 117, 116, 87, 97, 108, 107, 80,
+    97, 116, 116, 101, 114, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 101, 115, 115, 87, 97, 108, 107,
+    80, 97, 116, 116, 101, 114, 110, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 55, 50, 52,
+    52, 57, 52, 53, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73,
+    102, 32, 116, 114, 117, 101, 44, 32, 111, 102, 102, 99, 104, 105, 112, 32, 116, 101, 115, 115, 101, 108, 108, 97,
+    116, 105, 111, 110, 32, 119, 105, 108, 108, 32, 97, 108, 119, 97, 121, 115, 32, 117, 115, 101, 32, 116, 104, 101,
+    32, 109, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 76, 68, 83, 32, 98, 117, 102,
+    102, 101, 114, 115, 32, 112, 111, 115, 115, 105, 98, 108, 101, 32, 40, 98, 97, 115, 101, 100, 32, 111, 110, 32, 67,
+    104, 105, 112, 32, 73, 68, 41, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105,
+    99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117,
+    101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102,
+    120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 115, 101, 77, 97, 120, 79, 102, 102, 99, 104,
+    105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 115,
+    101, 77, 97, 120, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 115, 34, 44, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 54, 53, 48, 56, 54, 52, 50, 49, 125, 44, 32, 123, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 97, 100, 32, 104, 97, 108, 102, 45, 112,
+    97, 99, 107, 101, 100, 32, 86, 83, 32, 119, 97, 118, 101, 115, 44, 32, 102, 111, 114, 99, 105, 110, 103, 32, 116,
+    104, 101, 109, 32, 116, 111, 32, 117, 115, 101, 32, 104, 97, 108, 102, 32, 97, 115, 32, 109, 117, 99, 104, 32, 115,
+    112, 97, 99, 101, 32, 105, 110, 32, 116, 104, 101, 32, 112, 97, 114, 97, 109, 32, 99, 97, 99, 104, 101, 32, 97, 116,
+    32, 116, 104, 101, 32, 101, 120, 112, 101, 110, 115, 101, 32, 111, 102, 32, 105, 110, 101, 102, 102, 105, 99, 105,
+    101, 110, 116, 32, 117, 115, 101, 32, 111, 102, 32, 65, 76, 85, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 44,
+    32, 105, 102, 32, 116, 104, 101, 32, 101, 120, 112, 111, 114, 116, 32, 99, 111, 117, 110, 116, 32, 105, 115, 32, 62,
+    61, 32, 116, 104, 105, 115, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 46, 32, 84, 104, 105, 115, 32, 99, 97,
+    110, 32, 104, 101, 108, 112, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 105, 110, 32, 115, 111,
+    109, 101, 32, 99, 97, 115, 101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112,
+    104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 54,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 118, 115, 72, 97, 108, 102, 80, 97, 99, 107, 84,
+    104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 115, 72, 97, 108, 102,
+    80, 97, 99, 107, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 57, 56, 55, 50, 52, 55, 51, 57, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 102, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32,
+    86, 71, 84, 32, 116, 111, 32, 105, 115, 115, 117, 101, 32, 97, 32, 86, 83, 32, 119, 97, 118, 101, 32, 97, 115, 32,
+    115, 111, 111, 110, 32, 97, 115, 32, 97, 32, 112, 114, 105, 109, 103, 114, 111, 117, 112, 32, 105, 115, 102, 105,
+    110, 105, 115, 104, 101, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105,
+    99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108,
+    115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 118, 115, 70, 111, 114, 99, 101, 80, 97, 114,
+    116, 105, 97, 108, 87, 97, 118, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 115, 70, 111, 114, 99,
+    101, 80, 97, 114, 116, 105, 97, 108, 87, 97, 118, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 49, 57, 52, 54, 49, 54, 49, 56, 54, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 67, 117, 114, 114, 101, 110, 116, 32, 114, 101, 99, 111, 109, 109, 101, 110, 100, 97, 116, 105,
+    111, 110, 32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 116, 101, 97,
+    109, 32, 105, 115, 32, 116, 111, 32, 102, 111, 114, 99, 101, 32, 80, 65, 95, 83, 67, 95, 67, 79, 78, 83, 69, 82, 86,
+    65, 84, 73, 86, 69, 95, 82, 65, 83, 84, 95, 67, 78, 84, 76, 46, 67, 79, 86, 69, 82, 65, 71, 69, 95, 65, 65, 95, 77,
+    65, 83, 75, 32, 61, 32, 48, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99,
+    115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 67, 111, 118, 101, 114,
+    97, 103, 101, 65, 97, 77, 97, 115, 107, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108,
+    101, 67, 111, 118, 101, 114, 97, 103, 101, 65, 97, 77, 97, 115, 107, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 49, 56, 50, 57, 57, 57, 49, 48, 57, 49, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115,
+    69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 87, 100, 76, 111, 97, 100, 66, 97, 108,
+    97, 110, 99, 105, 110, 103, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101,
+    100, 46, 32, 83, 111, 102, 116, 119, 97, 114, 101, 32, 108, 111, 97, 100, 32, 98, 97, 108, 97, 110, 99, 105, 110,
+    103, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 87, 100, 76, 111, 97, 100,
+    66, 97, 108, 97, 110, 99, 105, 110, 103, 66, 97, 115, 105, 99, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 97, 115, 105, 99, 46, 32,
+    69, 110, 97, 98, 108, 101, 115, 32, 115, 109, 97, 108, 108, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 111, 112,
+    116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71,
+    102, 120, 57, 87, 100, 76, 111, 97, 100, 66, 97, 108, 97, 110, 99, 105, 110, 103, 65, 100, 118, 97, 110, 99, 101,
+    100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 65, 100, 118, 97, 110, 99, 101, 100, 46, 32, 69, 110, 97, 98, 108, 101, 100, 32, 98, 97,
+    115, 105, 99, 32, 109, 111, 100, 101, 32, 112, 108, 117, 115, 32, 115, 109, 97, 108, 108, 32, 105, 110, 115, 116,
+    97, 110, 99, 101, 32, 117, 110, 114, 111, 108, 108, 105, 110, 103, 32, 100, 114, 97, 119, 115, 32, 111, 112, 116,
+    105, 109, 105, 122, 97, 116, 105, 111, 110, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102,
+    120, 57, 87, 100, 76, 111, 97, 100, 66, 97, 108, 97, 110, 99, 105, 110, 103, 77, 111, 100, 101, 34, 125, 44, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 101, 116, 116, 105, 110, 103, 32, 102, 111,
+    114, 32, 99, 111, 110, 116, 114, 111, 108, 108, 105, 110, 103, 32, 119, 111, 114, 107, 32, 100, 105, 115, 116, 114,
+    105, 98, 117, 116, 111, 114, 32, 108, 111, 97, 100, 32, 98, 97, 108, 97, 110, 99, 105, 110, 103, 46, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110,
+    101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 71, 102, 120, 57, 87, 100, 76, 111, 97, 100, 66, 97, 108,
+    97, 110, 99, 105, 110, 103, 65, 100, 118, 97, 110, 99, 101, 100, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 119, 100, 76, 111, 97, 100, 66, 97, 108, 97, 110, 99, 105, 110, 103, 77, 111, 100, 101, 34, 44, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 87, 100, 76, 111, 97, 100, 66, 97, 108, 97, 110, 99, 105, 110, 103, 77, 111, 100,
+    101, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117,
+    101, 125, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 53, 55, 56, 54, 52, 48, 55, 52, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 117, 101, 32, 102,
+    111, 114, 99, 101, 115, 32, 97, 32, 66, 65, 84, 67, 72, 95, 66, 82, 69, 65, 75, 32, 101, 118, 101, 110, 116, 32,
+    119, 104, 101, 110, 32, 97, 32, 110, 101, 119, 32, 112, 105, 120, 101, 108, 32, 115, 104, 97, 100, 101, 114, 32,
+    105, 115, 32, 98, 111, 117, 110, 100, 46, 32, 70, 97, 108, 115, 101, 32, 98, 121, 32, 100, 101, 102, 97, 117, 108,
+    116, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105,
+    112, 101, 108, 105, 110, 101, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 98, 97, 116, 99, 104, 66, 114, 101, 97, 107, 79, 110, 78, 101, 119, 80, 105, 120, 101, 108, 83, 104, 97,
+    100, 101, 114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 97, 116, 99, 104, 66, 114, 101, 97, 107, 79,
+    110, 78, 101, 119, 80, 105, 120, 101, 108, 83, 104, 97, 100, 101, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 51, 51, 54, 55, 52, 53, 56, 51, 48, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 105, 115, 32, 109, 97, 115, 107, 32, 105, 115, 32, 65, 78, 68, 45, 101,
+    100, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 45, 100, 101, 99, 105, 100, 101,
+    100, 32, 71, 83, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 67, 85, 95, 69, 78, 32, 109, 97, 115, 107, 32, 116,
+    111, 32, 102, 117, 114, 116, 104, 101, 114, 32, 97, 108, 108, 111, 119, 32, 108, 105, 109, 105, 116, 105, 110, 103,
+    32, 111, 102, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 115, 32, 102, 111, 114, 32, 71, 83, 32, 119, 97, 118,
+    101, 115, 46, 32, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80,
+    105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 50, 57, 52, 57, 54, 55, 50, 57,
+    53, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102,
+    120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 115, 67, 117, 69, 110, 76, 105, 109,
+    105, 116, 77, 97, 115, 107, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 115, 67, 117, 69, 110, 76, 105,
+    109, 105, 116, 77, 97, 115, 107, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120,
+    34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 50, 49, 49,
+    48, 51, 49, 55, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84,
+    104, 105, 115, 32, 109, 97, 115, 107, 32, 105, 115, 32, 65, 78, 68, 45, 101, 100, 32, 119, 105, 116, 104, 32, 116,
+    104, 101, 32, 100, 114, 105, 118, 101, 114, 45, 100, 101, 99, 105, 100, 101, 100, 32, 86, 83, 45, 115, 112, 101, 99,
+    105, 102, 105, 99, 32, 67, 85, 95, 69, 78, 32, 109, 97, 115, 107, 32, 116, 111, 32, 102, 117, 114, 116, 104, 101,
+    114, 32, 97, 108, 108, 111, 119, 32, 108, 105, 109, 105, 116, 105, 110, 103, 32, 111, 102, 32, 101, 110, 97, 98,
+    108, 101, 100, 32, 67, 85, 115, 32, 102, 111, 114, 32, 86, 83, 32, 119, 97, 118, 101, 115, 46, 32, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110,
+    101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 125, 44, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34,
+    44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 118, 115, 67, 117, 69, 110, 76, 105, 109, 105, 116, 77, 97, 115, 107,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 115, 67, 117, 69, 110, 76, 105, 109, 105, 116, 77, 97, 115,
+    107, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117,
+    101, 125, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 56, 57, 51, 49, 48, 48, 51, 54, 125, 44,
+    32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 105, 115, 32, 109, 97,
+    115, 107, 32, 105, 115, 32, 65, 78, 68, 45, 101, 100, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 100, 114, 105,
+    118, 101, 114, 45, 100, 101, 99, 105, 100, 101, 100, 32, 80, 83, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 67,
+    85, 95, 69, 78, 32, 109, 97, 115, 107, 32, 116, 111, 32, 102, 117, 114, 116, 104, 101, 114, 32, 97, 108, 108, 111,
+    119, 32, 108, 105, 109, 105, 116, 105, 110, 103, 32, 111, 102, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 115,
+    32, 102, 111, 114, 32, 80, 83, 32, 119, 97, 118, 101, 115, 46, 32, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102,
+    120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 112, 115, 67, 117, 69, 110, 76, 105, 109, 105, 116, 77, 97, 115, 107, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 80, 115, 67, 117, 69, 110, 76, 105, 109, 105, 116, 77, 97, 115, 107, 34, 44, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 49, 53, 48, 57, 56, 49, 49, 53, 57, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 105, 115, 32, 109, 97, 115, 107, 32, 105, 115, 32, 65, 78,
+    68, 45, 101, 100, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 45, 100, 101, 99,
+    105, 100, 101, 100, 32, 67, 83, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 67, 85, 95, 69, 78, 32, 109, 97, 115,
+    107, 32, 116, 111, 32, 102, 117, 114, 116, 104, 101, 114, 32, 97, 108, 108, 111, 119, 32, 108, 105, 109, 105, 116,
+    105, 110, 103, 32, 111, 102, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 115, 32, 102, 111, 114, 32, 67, 83,
+    32, 119, 97, 118, 101, 115, 46, 32, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 114, 97, 112, 104,
+    105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 50, 57,
+    52, 57, 54, 55, 50, 57, 53, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116,
+    51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 115, 67, 117, 69,
+    110, 76, 105, 109, 105, 116, 77, 97, 115, 107, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 67, 117,
+    69, 110, 76, 105, 109, 105, 116, 77, 97, 115, 107, 34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73,
+    115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    51, 51, 56, 50, 51, 51, 49, 51, 53, 49, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108,
+    117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 102, 102, 67, 104, 105, 112, 72, 115, 73, 109, 109,
+    101, 100, 105, 97, 116, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 112, 121, 32, 72, 83, 32, 111, 117, 116, 112, 117, 116,
+    115, 32, 100, 105, 114, 101, 99, 116, 108, 121, 32, 116, 111, 32, 111, 102, 102, 45, 99, 104, 105, 112, 32, 109,
+    101, 109, 111, 114, 121, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 102,
+    102, 67, 104, 105, 112, 72, 115, 67, 111, 112, 121, 65, 108, 108, 65, 116, 69, 110, 100, 34, 44, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87,
+    114, 105, 116, 101, 32, 72, 83, 32, 111, 117, 116, 112, 117, 116, 115, 32, 116, 111, 32, 76, 68, 83, 44, 32, 116,
+    104, 101, 110, 32, 97, 116, 32, 101, 110, 100, 32, 111, 102, 32, 72, 83, 32, 117, 115, 101, 32, 109, 117, 108, 116,
+    105, 45, 116, 104, 114, 101, 97, 100, 101, 100, 32, 108, 111, 111, 112, 32, 116, 111, 32, 99, 111, 112, 121, 32,
+    102, 114, 111, 109, 32, 76, 68, 83, 32, 116, 111, 32, 111, 102, 102, 45, 99, 104, 105, 112, 32, 109, 101, 109, 111,
+    114, 121, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 102, 102, 67, 104,
+    105, 112, 72, 115, 67, 111, 112, 121, 77, 117, 108, 116, 105, 69, 108, 101, 109, 101, 110, 116, 115, 34, 44, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 87, 114, 105, 116, 101, 115, 32, 111, 117, 116, 112, 117, 116, 32, 99, 111, 110, 116, 114, 111, 108, 32, 112,
+    111, 105, 110, 116, 115, 32, 97, 110, 100, 32, 112, 97, 116, 99, 104, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115,
+    32, 100, 105, 114, 101, 99, 116, 108, 121, 32, 116, 111, 32, 111, 102, 102, 45, 99, 104, 105, 112, 32, 97, 110, 100,
+    32, 111, 110, 108, 121, 32, 99, 111, 112, 121, 32, 116, 104, 101, 105, 110, 112, 117, 116, 32, 99, 111, 110, 116,
+    114, 111, 108, 32, 112, 111, 105, 110, 116, 32, 116, 111, 32, 109, 101, 109, 111, 114, 121, 32, 97, 116, 32, 116,
+    104, 101, 32, 101, 110, 100, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79,
+    102, 102, 67, 104, 105, 112, 72, 115, 67, 111, 112, 121, 77, 101, 116, 104, 111, 100, 34, 125, 44, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 112, 101, 99, 105, 102, 105, 101, 115, 32, 116, 111,
+    32, 83, 67, 32, 104, 111, 119, 32, 116, 111, 32, 99, 111, 112, 121, 32, 72, 83, 32, 111, 117, 116, 112, 117, 116,
+    115, 32, 116, 111, 32, 111, 102, 102, 45, 99, 104, 105, 112, 32, 109, 101, 109, 111, 114, 121, 46, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 83, 104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 32,
+    34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 71, 102, 120, 57, 79, 102, 102, 67, 104, 105, 112, 72, 115, 67, 111, 112, 121,
+    65, 108, 108, 65, 116, 69, 110, 100, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101,
+    110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 102, 120,
+    57, 79, 102, 102, 67, 104, 105, 112, 72, 115, 67, 111, 112, 121, 77, 101, 116, 104, 111, 100, 34, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 79, 102, 102, 67, 104, 105, 112, 72, 115, 67, 111, 112, 121, 77, 101, 116, 104, 111,
+    100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 56, 50, 52, 57, 49, 55, 53, 51, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101,
+    115, 32, 83, 67, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 116, 111, 32, 115, 107, 105,
+    112, 32, 99, 111, 112, 121, 105, 110, 103, 32, 100, 97, 116, 97, 32, 102, 114, 111, 109, 32, 72, 83, 32, 102, 111,
+    114, 32, 110, 117, 108, 108, 32, 112, 97, 116, 99, 104, 101, 115, 32, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 83, 104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 102, 120, 57, 79, 102, 102, 67,
+    104, 105, 112, 72, 115, 83, 107, 105, 112, 68, 97, 116, 97, 67, 111, 112, 121, 78, 117, 108, 108, 80, 97, 116, 99,
+    104, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 102, 102, 67, 104, 105, 112, 72, 115, 83, 107, 105, 112,
+    68, 97, 116, 97, 67, 111, 112, 121, 78, 117, 108, 108, 80, 97, 116, 99, 104, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 49, 57, 53, 50, 49, 54, 55, 51, 56, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 83, 67, 32, 111, 112, 116, 105, 109,
+    105, 122, 97, 116, 105, 111, 110, 32, 116, 111, 32, 112, 101, 114, 102, 111, 114, 109, 32, 116, 104, 101, 32, 111,
+    102, 102, 99, 104, 105, 112, 32, 100, 97, 116, 97, 32, 99, 111, 112, 121, 32, 102, 114, 111, 109, 32, 116, 104, 101,
+    32, 104, 117, 108, 108, 32, 115, 104, 97, 100, 101, 114, 32, 116, 111, 32, 116, 104, 101, 32, 100, 111, 109, 97,
+    105, 110, 32, 115, 104, 97, 100, 101, 114, 32, 117, 115, 105, 110, 103, 32, 109, 117, 108, 116, 105, 112, 108, 101,
+    32, 119, 97, 118, 101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 83, 104, 97, 100, 101, 114,
+    32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 102, 120, 57, 79, 102, 102, 67, 104, 105, 112, 72, 115, 77,
+    117, 108, 116, 105, 87, 97, 118, 101, 80, 97, 116, 99, 104, 68, 97, 116, 97, 67, 111, 112, 121, 34, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 79, 102, 102, 67, 104, 105, 112, 72, 115, 77, 117, 108, 116, 105, 87, 97, 118, 101,
+    80, 97, 116, 99, 104, 68, 97, 116, 97, 67, 111, 112, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 50, 51, 57, 54, 55, 52, 56, 49, 52, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 83, 67, 32, 111, 112, 116, 105, 109, 105, 122, 97,
+    116, 105, 111, 110, 32, 102, 111, 114, 32, 111, 112, 116, 105, 109, 105, 122, 101, 100, 32, 68, 83, 32, 100, 97,
+    116, 97, 32, 102, 101, 116, 99, 104, 46, 32, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 83, 104, 97, 100,
+    101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 102, 120, 57, 79, 112, 116, 105, 109, 105, 122, 101,
+    68, 115, 68, 97, 116, 97, 70, 101, 116, 99, 104, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 112, 116,
+    105, 109, 105, 122, 101, 68, 115, 68, 97, 116, 97, 70, 101, 116, 99, 104, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 52, 48, 53, 51, 48, 56, 53, 54, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 116, 104, 101, 114, 32, 111, 114, 32, 110, 111, 116, 32, 80, 65,
+    76, 32, 115, 117, 112, 112, 111, 114, 116, 115, 32, 78, 71, 71, 46, 32, 70, 111, 114, 32, 113, 117, 97, 108, 105,
+    116, 121, 32, 112, 117, 114, 112, 111, 115, 101, 115, 32, 111, 110, 108, 121, 46, 34, 44, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 103, 103, 83, 117, 112, 112, 111,
+    114, 116, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 83, 117, 112, 112, 111, 114,
+    116, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 49, 53, 55, 48, 48, 56, 55,
+    53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116,
+    114, 111, 108, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 102, 111, 114, 32, 108, 97, 116, 101, 45, 97,
+    108, 108, 111, 99, 32, 71, 83, 32, 102, 111, 114, 32, 78, 71, 71, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115,
+    46, 32, 67, 97, 110, 32, 98, 101, 32, 110, 111, 32, 109, 111, 114, 101, 32, 116, 104, 97, 110, 32, 49, 50, 55, 46,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115, 34, 44,
+    32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 49, 50, 55, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 110, 103, 103, 76, 97, 116, 101, 65, 108, 108, 111, 99, 71, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 78, 103, 103, 76, 97, 116, 101, 65, 108, 108, 111, 99, 71, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 50, 49, 55, 57, 49, 53, 49, 57, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 104, 111, 119, 32, 109, 97, 110, 121, 32,
+    105, 110, 115, 116, 97, 110, 99, 101, 115, 32, 111, 102, 32, 116, 104, 101, 32, 78, 71, 71, 32, 115, 104, 97, 100,
+    101, 114, 45, 100, 97, 116, 97, 32, 116, 97, 98, 108, 101, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 99, 111,
+    110, 116, 97, 105, 110, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 114, 105, 110, 103, 32, 98, 117, 102, 102,
+    101, 114, 32, 109, 97, 110, 97, 103, 101, 100, 32, 98, 121, 32, 85, 110, 105, 118, 101, 114, 115, 97, 108, 32, 67,
+    111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 115, 46, 32, 65, 116, 32, 109, 111, 115, 116, 44, 32,
+    116, 104, 101, 32, 99, 111, 110, 115, 116, 97, 110, 116, 32, 101, 110, 103, 105, 110, 101, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 97, 98, 108, 101, 32, 116, 111, 32, 103, 101, 116, 32, 116, 104, 97, 116, 32, 109, 97, 110, 121,
+    32, 100, 114, 97, 119, 115, 32, 97, 104, 101, 97, 100, 32, 111, 102, 32, 116, 104, 101, 32, 100, 114, 97, 119, 32,
+    101, 110, 103, 105, 110, 101, 46, 32, 84, 104, 105, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 101, 105, 116,
+    104, 101, 114, 32, 122, 101, 114, 111, 44, 32, 111, 114, 32, 100, 105, 118, 105, 115, 105, 98, 108, 101, 32, 98,
+    121, 32, 102, 111, 117, 114, 46, 32, 73, 102, 32, 122, 101, 114, 111, 44, 32, 97, 110, 121, 32, 112, 105, 112, 101,
+    108, 105, 110, 101, 32, 119, 104, 105, 99, 104, 32, 114, 101, 113, 117, 105, 114, 101, 115, 32, 78, 71, 71, 32, 119,
+    105, 108, 108, 32, 102, 97, 105, 108, 32, 116, 111, 32, 99, 111, 109, 112, 105, 108, 101, 32, 98, 101, 99, 97, 117,
+    115, 101, 32, 110, 111, 32, 83, 82, 68, 32, 116, 97, 98, 108, 101, 32, 105, 115, 32, 112, 114, 101, 115, 101, 110,
+    116, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108,
+    115, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 51, 50, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 110, 103, 103, 82, 105, 110, 103, 83, 105, 122, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78,
+    103, 103, 82, 105, 110, 103, 83, 105, 122, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51,
+    56, 53, 56, 50, 51, 48, 56, 54, 52, 125, 44, 32, 123, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58,
+    32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 73, 115, 69, 120, 99, 108, 117,
+    115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 68, 101, 102, 101, 114, 114, 101, 100, 66, 97, 116, 99, 104, 66,
+    105, 110, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 68, 101, 102, 101, 114, 114, 101, 100, 66, 97, 116, 99,
+    104, 66, 105, 110, 67, 117, 115, 116, 111, 109, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 68, 101, 102, 101, 114, 114, 101, 100, 66, 97, 116, 99,
+    104, 66, 105, 110, 65, 99, 99, 117, 114, 97, 116, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 125,
+    93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 66, 105, 110, 110, 105, 110, 103, 77, 111, 100,
+    101, 34, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116,
+    114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 111, 114, 32, 110, 111, 116, 32, 100, 101, 102, 101,
+    114, 114, 101, 100, 32, 98, 97, 116, 99, 104, 32, 98, 105, 110, 110, 105, 110, 103, 32, 105, 115, 32, 101, 110, 97,
+    98, 108, 101, 100, 32, 48, 32, 58, 32, 66, 97, 116, 99, 104, 32, 98, 105, 110, 110, 105, 110, 103, 32, 97, 108, 119,
+    97, 121, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 49, 32, 58, 32, 85, 115, 101, 32, 99, 117, 115, 116,
+    111, 109, 32, 98, 105, 110, 32, 115, 105, 122, 101, 115, 32, 50, 32, 58, 32, 79, 112, 116, 105, 109, 97, 108, 32,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32,
+    34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 71, 102, 120, 57, 68, 101, 102, 101, 114, 114, 101, 100, 66, 97, 116, 99, 104,
+    66, 105, 110, 65, 99, 99, 117, 114, 97, 116, 101, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 101, 110, 117, 109, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    98, 105, 110, 110, 105, 110, 103, 77, 111, 100, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 102,
+    101, 114, 114, 101, 100, 66, 97, 116, 99, 104, 66, 105, 110, 77, 111, 100, 101, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 52, 49, 51, 48, 50, 49, 52, 56, 52, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 99, 117,
+    115, 116, 111, 109, 32, 98, 97, 116, 99, 104, 32, 98, 105, 110, 32, 115, 105, 122, 101, 46, 32, 32, 79, 110, 108,
+    121, 32, 117, 115, 101, 100, 32, 119, 104, 101, 110, 32, 100, 101, 102, 101, 114, 114, 101, 100, 66, 97, 116, 99,
+    104, 66, 105, 110, 77, 111, 100, 101, 61, 61, 49, 32, 72, 105, 103, 104, 32, 119, 111, 114, 100, 32, 105, 115, 32,
+    102, 111, 114, 32, 120, 44, 32, 108, 111, 119, 32, 119, 111, 114, 100, 32, 105, 115, 32, 102, 111, 114, 32, 121, 46,
+    32, 32, 68, 101, 102, 97, 117, 108, 116, 32, 105, 115, 32, 49, 50, 56, 120, 49, 50, 56, 46, 32, 32, 86, 97, 108,
+    117, 101, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 112, 111, 119, 101, 114, 45, 111, 102, 45, 116, 119, 111,
+    32, 98, 101, 116, 119, 101, 101, 110, 32, 49, 54, 32, 97, 110, 100, 32, 53, 49, 50, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93,
+    44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    56, 51, 56, 56, 55, 51, 54, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116,
+    51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 117, 115, 116,
+    111, 109, 66, 97, 116, 99, 104, 66, 105, 110, 83, 105, 122, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    67, 117, 115, 116, 111, 109, 66, 97, 116, 99, 104, 66, 105, 110, 83, 105, 122, 101, 34, 44, 32, 34, 70, 108, 97,
+    103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 55, 50, 49, 48, 48, 55, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 109,
+    105, 110, 105, 109, 117, 109, 32, 98, 97, 116, 99, 104, 32, 98, 105, 110, 32, 115, 105, 122, 101, 32, 117, 115, 101,
+    100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34,
+    44, 32, 34, 71, 102, 120, 49, 48, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 109, 105, 110, 66, 97, 116, 99, 104, 66, 105, 110, 83, 105, 122, 101, 34, 44, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 105, 110, 66, 97, 116, 99, 104, 66, 105, 110, 83, 105, 122, 101, 34, 44,
+    32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 125, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 32, 34, 83, 116, 114, 117, 99, 116,
+    117, 114, 101, 34, 58, 32, 91, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77,
+    105, 110, 105, 109, 117, 109, 32, 98, 97, 116, 99, 104, 32, 98, 105, 110, 32, 115, 105, 122, 101, 32, 119, 105, 100,
+    116, 104, 46, 32, 32, 86, 97, 108, 117, 101, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 112, 111, 119, 101,
+    114, 45, 111, 102, 45, 116, 119, 111, 32, 98, 101, 116, 119, 101, 101, 110, 32, 49, 54, 32, 97, 110, 100, 32, 53,
+    49, 50, 46, 32, 32, 83, 101, 116, 32, 116, 111, 32, 48, 32, 116, 111, 32, 117, 115, 101, 32, 100, 101, 102, 97, 117,
+    108, 116, 32, 108, 105, 109, 105, 116, 46, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116,
+    49, 54, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 105, 100, 116,
+    104, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 105, 100, 116, 104, 34, 44, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 51, 49, 57, 57, 56, 49, 55, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 105, 110, 105, 109, 117, 109, 32, 98, 97, 116, 99, 104, 32,
+    98, 105, 110, 32, 115, 105, 122, 101, 32, 104, 101, 105, 103, 104, 116, 46, 32, 32, 86, 97, 108, 117, 101, 32, 109,
+    117, 115, 116, 32, 98, 101, 32, 97, 32, 112, 111, 119, 101, 114, 45, 111, 102, 45, 116, 119, 111, 32, 98, 101, 116,
+    119, 101, 101, 110, 32, 49, 54, 32, 97, 110, 100, 32, 53, 49, 50, 46, 32, 32, 83, 101, 116, 32, 116, 111, 32, 48,
+    32, 116, 111, 32, 117, 115, 101, 32, 100, 101, 102, 97, 117, 108, 116, 32, 108, 105, 109, 105, 116, 46, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 49, 54, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 104, 101, 105, 103, 104, 116, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 72, 101, 105, 103, 104, 116, 34, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56, 54,
+    51, 48, 49, 51, 54, 48, 125, 93, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 50, 51, 52, 51,
+    54, 55, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32,
+    116, 114, 117, 101, 44, 32, 98, 105, 110, 110, 105, 110, 103, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101,
+    100, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 80, 83, 32, 104, 97, 115, 32, 97, 32, 100, 105, 115, 99, 97,
+    114, 100, 32, 105, 110, 115, 116, 114, 117, 99, 116, 105, 111, 110, 32, 111, 114, 32, 99, 97, 110, 32, 98, 101, 32,
+    116, 114, 105, 118, 105, 97, 108, 108, 121, 32, 114, 101, 106, 101, 99, 116, 101, 100, 46, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102, 120, 57,
+    34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108,
+    101, 66, 105, 110, 110, 105, 110, 103, 80, 115, 75, 105, 108, 108, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    68, 105, 115, 97, 98, 108, 101, 66, 105, 110, 110, 105, 110, 103, 80, 115, 75, 105, 108, 108, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 57, 55, 49, 54, 53, 51, 57, 53, 125, 44, 32, 123, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 98, 105, 110,
+    110, 105, 110, 103, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 105, 102, 32, 116, 104, 101, 114,
+    101, 32, 105, 115, 32, 110, 111, 32, 100, 101, 112, 116, 104, 32, 98, 117, 102, 102, 101, 114, 32, 98, 111, 117,
+    110, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83,
+    77, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 66, 105, 110, 110, 105, 110, 103, 78, 111, 68, 98, 34, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 66, 105, 110, 110, 105, 110, 103, 78, 111, 68, 98, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49, 51, 57, 56, 54, 53, 53, 55, 49, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44,
+    32, 98, 105, 110, 110, 105, 110, 103, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 105, 102, 32, 98,
+    108, 101, 110, 100, 105, 110, 103, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 111, 114, 32, 98,
+    108, 101, 110, 100, 105, 110, 103, 32, 100, 111, 101, 115, 32, 110, 111, 116, 32, 114, 101, 113, 117, 105, 114, 101,
+    32, 116, 104, 101, 32, 100, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110, 32, 99, 111, 108, 111, 114, 32, 116,
+    111, 32, 98, 101, 32, 114, 101, 97, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 66, 66, 32,
+    97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 66, 105, 110, 110, 105, 110, 103, 66, 108,
+    101, 110, 100, 105, 110, 103, 79, 102, 102, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98,
+    108, 101, 66, 105, 110, 110, 105, 110, 103, 66, 108, 101, 110, 100, 105, 110, 103, 79, 102, 102, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 54, 56, 56, 51, 53, 55, 56, 52, 125, 44, 32, 123, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 97, 109, 111, 117,
+    110, 116, 32, 111, 102, 32, 112, 97, 114, 97, 109, 101, 116, 101, 114, 32, 115, 116, 111, 114, 97, 103, 101, 32,
+    112, 101, 114, 32, 98, 97, 116, 99, 104, 32, 119, 104, 101, 110, 32, 110, 111, 116, 32, 117, 115, 105, 110, 103, 32,
+    78, 71, 71, 46, 32, 84, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 105, 115, 32, 118, 97, 108, 117, 101,
+    32, 49, 50, 56, 46, 32, 90, 101, 114, 111, 32, 109, 101, 97, 110, 115, 32, 99, 97, 108, 99, 117, 108, 97, 116, 101,
+    32, 97, 110, 32, 111, 112, 116, 105, 109, 97, 108, 32, 118, 97, 108, 117, 101, 32, 98, 97, 115, 101, 100, 32, 111,
+    110, 32, 116, 104, 101, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97,
+    116, 105, 111, 110, 46, 32, 79, 110, 32, 71, 70, 88, 57, 44, 32, 116, 104, 105, 115, 32, 118, 97, 108, 117, 101, 32,
+    105, 115, 32, 105, 110, 32, 117, 110, 105, 116, 115, 32, 111, 102, 32, 50, 32, 112, 97, 114, 97, 109, 32, 99, 97,
+    99, 104, 101, 32, 108, 105, 110, 101, 115, 46, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 66, 66,
+    32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 77, 97, 120, 65, 108, 108, 111, 99, 67,
+    111, 117, 110, 116, 76, 101, 103, 97, 99, 121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 110,
+    105, 110, 103, 77, 97, 120, 65, 108, 108, 111, 99, 67, 111, 117, 110, 116, 76, 101, 103, 97, 99, 121, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54, 56, 49, 54, 57, 56, 56, 57, 51, 125, 44, 32, 123, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 97, 109, 111,
+    117, 110, 116, 32, 111, 102, 32, 112, 97, 114, 97, 109, 101, 116, 101, 114, 32, 115, 116, 111, 114, 97, 103, 101,
+    32, 112, 101, 114, 32, 98, 97, 116, 99, 104, 32, 119, 104, 101, 110, 32, 117, 115, 105, 110, 103, 32, 78, 71, 71,
+    32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 111, 110, 45, 99, 104, 105, 112, 32, 112, 97, 114, 97, 109, 101, 116,
+    101, 114, 32, 99, 97, 99, 104, 101, 46, 32, 90, 101, 114, 111, 32, 109, 101, 97, 110, 115, 32, 99, 97, 108, 99, 117,
+    108, 97, 116, 101, 32, 97, 110, 32, 111, 112, 116, 105, 109, 97, 108, 32, 118, 97, 108, 117, 101, 32, 98, 97, 115,
+    101, 100, 32, 111, 110, 32, 116, 104, 101, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 99, 111, 110, 102, 105,
+    103, 117, 114, 97, 116, 105, 111, 110, 46, 32, 79, 110, 32, 71, 70, 88, 57, 44, 32, 116, 104, 105, 115, 32, 118, 97,
+    108, 117, 101, 32, 105, 115, 32, 105, 110, 32, 117, 110, 105, 116, 115, 32, 111, 102, 32, 50, 32, 112, 97, 114, 97,
+    109, 32, 99, 97, 99, 104, 101, 32, 108, 105, 110, 101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 77, 97, 120, 65, 108, 108, 111,
+    99, 67, 111, 117, 110, 116, 78, 103, 103, 79, 110, 67, 104, 105, 112, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 66, 105, 110, 110, 105, 110, 103, 77, 97, 120, 65, 108, 108, 111, 99, 67, 111, 117, 110, 116, 78, 103, 103, 79,
+    110, 67, 104, 105, 112, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 52, 51, 48, 48, 51,
+    53, 48, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120,
+    105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 112, 114, 105, 109, 105, 116, 105, 118, 101,
+    115, 32, 112, 101, 114, 32, 98, 97, 116, 99, 104, 46, 32, 84, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32,
+    118, 97, 108, 117, 101, 32, 105, 115, 32, 49, 48, 50, 52, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 48, 50, 52, 125,
+    44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57,
+    75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 77, 97, 120, 80,
+    114, 105, 109, 80, 101, 114, 66, 97, 116, 99, 104, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110,
+    110, 105, 110, 103, 77, 97, 120, 80, 114, 105, 109, 80, 101, 114, 66, 97, 116, 99, 104, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 51, 49, 55, 48, 55, 57, 55, 54, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114,
+    32, 111, 102, 32, 99, 111, 110, 116, 101, 120, 116, 32, 114, 111, 108, 108, 115, 32, 98, 101, 102, 111, 114, 101,
+    32, 98, 114, 101, 97, 107, 105, 110, 103, 32, 97, 32, 98, 97, 116, 99, 104, 46, 32, 84, 104, 101, 32, 109, 97, 120,
+    105, 109, 117, 109, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 54, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44,
+    32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103,
+    34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110,
+    116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110,
+    110, 105, 110, 103, 67, 111, 110, 116, 101, 120, 116, 83, 116, 97, 116, 101, 115, 80, 101, 114, 66, 105, 110, 34,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 110, 105, 110, 103, 67, 111, 110, 116, 101, 120, 116,
+    83, 116, 97, 116, 101, 115, 80, 101, 114, 66, 105, 110, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 49, 54, 54, 49, 54, 51, 57, 51, 51, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 112, 101,
+    114, 115, 105, 115, 116, 101, 110, 116, 32, 115, 116, 97, 116, 101, 115, 32, 112, 101, 114, 32, 98, 97, 116, 99,
+    104, 46, 32, 84, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 51,
+    49, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34,
+    44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101,
+    114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 80, 101, 114, 115, 105, 115, 116, 101, 110,
+    116, 83, 116, 97, 116, 101, 115, 80, 101, 114, 66, 105, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66,
+    105, 110, 110, 105, 110, 103, 80, 101, 114, 115, 105, 115, 116, 101, 110, 116, 83, 116, 97, 116, 101, 115, 80, 101,
+    114, 66, 105, 110, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 53, 48, 55, 52, 56, 53, 52,
+    55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105,
+    109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 70, 80, 79, 86, 32, 116, 111, 107, 101, 110, 115,
+    32, 97, 108, 108, 111, 119, 101, 100, 32, 112, 101, 114, 32, 98, 97, 116, 99, 104, 46, 32, 90, 101, 114, 111, 32,
+    109, 101, 97, 110, 115, 32, 110, 111, 32, 108, 105, 109, 105, 116, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 54, 51, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 70, 112, 111, 118,
+    115, 80, 101, 114, 66, 97, 116, 99, 104, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 110, 105,
+    110, 103, 70, 112, 111, 118, 115, 80, 101, 114, 66, 97, 116, 99, 104, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 48, 57, 51, 55, 49, 48, 51, 49, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 86, 97, 108, 117, 101, 32, 102, 111, 114, 32, 116, 104, 101, 32, 80, 65, 95, 83, 67,
+    95, 66, 73, 78, 78, 69, 82, 95, 67, 78, 84, 76, 95, 49, 58, 58, 79, 80, 84, 73, 77, 65, 76, 95, 66, 73, 78, 95, 83,
+    69, 76, 69, 67, 84, 73, 79, 78, 32, 114, 101, 103, 105, 115, 116, 101, 114, 32, 102, 105, 101, 108, 100, 46, 34, 44,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71,
+    102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98,
+    111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110,
+    110, 105, 110, 103, 79, 112, 116, 105, 109, 97, 108, 66, 105, 110, 83, 101, 108, 101, 99, 116, 105, 111, 110, 34,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 110, 105, 110, 103, 79, 112, 116, 105, 109, 97, 108, 66,
+    105, 110, 83, 101, 108, 101, 99, 116, 105, 111, 110, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    52, 53, 54, 51, 54, 48, 52, 50, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 100, 105, 115, 97, 98, 108, 101, 32, 66, 105, 110, 110, 105,
+    110, 103, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 80, 83, 32, 117, 115, 101, 115, 32, 85, 65, 86, 32, 97,
+    112, 112, 101, 110, 100, 32, 111, 114, 32, 99, 111, 110, 115, 117, 109, 101, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116,
+    114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 66, 105,
+    110, 110, 105, 110, 103, 65, 112, 112, 101, 110, 100, 67, 111, 110, 115, 117, 109, 101, 34, 44, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 66, 105, 110, 110, 105, 110, 103, 68, 105, 115, 97, 98, 108, 101, 66, 105, 110, 110, 105, 110,
+    103, 65, 112, 112, 101, 110, 100, 67, 111, 110, 115, 117, 109, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 56, 48, 49, 56, 57, 51, 55, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 68, 70, 83, 77, 32, 105, 115, 32, 100, 105,
+    115, 97, 98, 108, 101, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 66, 66, 32, 97, 110, 100,
+    32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 68, 102, 115, 109, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 68, 102, 115, 109, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 50, 57, 52, 51, 55, 55, 57, 52, 48, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 68, 70, 83, 77, 32, 105, 115, 32, 100, 105, 115,
+    97, 98, 108, 101, 100, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 112, 105, 120, 101, 108, 32, 115, 104, 97,
+    100, 101, 114, 32, 117, 115, 101, 115, 32, 85, 65, 86, 115, 32, 111, 114, 32, 82, 79, 86, 115, 46, 34, 44, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 32, 34, 71, 102,
+    120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97,
+    98, 108, 101, 68, 102, 115, 109, 80, 115, 85, 97, 118, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105,
+    115, 97, 98, 108, 101, 68, 102, 115, 109, 80, 115, 85, 97, 118, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 49, 53, 57, 50, 56, 52, 51, 52, 50, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 83, 101, 108, 101, 99, 116, 32, 109, 101, 116, 104, 111, 100, 32, 111, 102, 32, 115, 104,
+    97, 100, 101, 114, 32, 112, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 58, 32, 32, 48, 58, 32, 67, 80, 32, 68,
+    77, 65, 32, 40, 112, 114, 105, 109, 101, 115, 32, 85, 84, 67, 76, 50, 32, 97, 110, 100, 32, 84, 67, 67, 41, 32, 49,
+    58, 32, 80, 82, 73, 77, 69, 95, 85, 84, 67, 76, 50, 32, 40, 112, 114, 105, 109, 101, 115, 32, 116, 104, 101, 32, 85,
+    84, 67, 76, 50, 41, 32, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 101, 102, 101, 116, 99, 104,
+    105, 110, 103, 32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105, 110, 103, 41, 34, 93, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80,
+    114, 101, 102, 101, 116, 99, 104, 67, 112, 68, 109, 97, 34, 125, 44, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 123, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 67, 112, 68, 109, 97, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 48, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 32, 68, 77, 65, 32,
+    112, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 46, 34, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 80, 114, 101, 102, 101, 116, 99, 104, 80, 114, 105, 109, 101, 85, 116, 99, 76, 50, 34, 44, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 49, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 82,
+    73, 77, 69, 95, 85, 84, 67, 76, 50, 32, 40, 112, 114, 105, 109, 101, 115, 32, 116, 104, 101, 32, 85, 84, 67, 76, 50,
+    41, 46, 34, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 77, 101,
+    116, 104, 111, 100, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 104, 97, 100, 101, 114, 80,
+    114, 101, 102, 101, 116, 99, 104, 77, 101, 116, 104, 111, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83,
+    104, 97, 100, 101, 114, 80, 114, 101, 102, 101, 116, 99, 104, 77, 101, 116, 104, 111, 100, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 50, 56, 57, 57, 52, 56, 50, 50, 125, 44, 32, 123, 34, 86, 97, 108,
+    105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117,
+    101, 44, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102,
+    120, 57, 80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 115, 68, 105, 115, 97, 98, 108, 101,
+    100, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 125, 44, 32, 123, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    71, 102, 120, 57, 80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 115, 66, 117, 105, 108,
+    100, 73, 110, 102, 111, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 125, 44, 32, 123, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 71, 102, 120, 57, 80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 115,
+    70, 111, 114, 99, 101, 65, 108, 108, 68, 101, 34, 44, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 125, 44, 32,
+    123, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109,
+    109, 97, 110, 100, 115, 70, 111, 114, 99, 101, 65, 108, 108, 68, 101, 65, 99, 101, 34, 44, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 51, 125, 93, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 80, 114, 101, 102,
+    101, 116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 115, 34, 125, 44, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 67,
+    80, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 97, 114, 101, 32, 112, 114, 101,
+    102, 101, 116, 99, 104, 101, 100, 32, 105, 110, 116, 111, 32, 116, 104, 101, 32, 71, 102, 120, 32, 76, 50, 46, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 80, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 32, 40, 76,
+    50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105, 110, 103, 41, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34,
+    71, 102, 120, 57, 80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 115, 66, 117, 105, 108,
+    100, 73, 110, 102, 111, 34, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109,
+    34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 101, 102, 101, 116,
+    99, 104, 67, 111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101, 114, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101, 114, 115,
+    34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 54, 55, 53, 55, 52, 51, 50, 54, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 101, 115, 116, 101, 100, 32, 99,
+    111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 119, 104, 111, 115, 101, 32, 99, 111, 109,
+    109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 115, 32, 97, 114, 101, 32, 110, 111, 32, 108, 97, 114, 103, 101,
+    114, 32, 116, 104, 97, 110, 32, 116, 104, 105, 115, 32, 109, 97, 110, 121, 32, 68, 87, 79, 82, 68, 115, 32, 97, 114,
+    101, 32, 99, 111, 112, 105, 101, 100, 32, 105, 110, 108, 105, 110, 101, 32, 105, 110, 116, 111, 32, 116, 104, 101,
+    32, 99, 97, 108, 108, 105, 110, 103, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 105,
+    110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 98, 101, 105, 110, 103, 32, 108, 97, 117, 110, 99, 104, 101, 100, 32,
+    118, 105, 97, 32, 97, 110, 32, 73, 66, 50, 32, 111, 114, 32, 99, 104, 97, 105, 110, 101, 100, 32, 116, 111, 46, 32,
+    84, 104, 105, 115, 32, 115, 97, 118, 101, 115, 32, 116, 104, 101, 32, 67, 80, 32, 97, 110, 32, 105, 110, 100, 105,
+    114, 101, 99, 116, 32, 98, 117, 102, 102, 101, 114, 32, 102, 101, 116, 99, 104, 32, 102, 111, 114, 32, 115, 109, 97,
+    108, 108, 32, 110, 101, 115, 116, 101, 100, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114,
+    115, 46, 32, 83, 101, 116, 32, 116, 111, 32, 48, 32, 116, 111, 32, 97, 108, 119, 97, 121, 115, 32, 108, 97, 117,
+    110, 99, 104, 32, 110, 101, 115, 116, 101, 100, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101,
+    114, 115, 32, 118, 105, 97, 32, 97, 110, 32, 73, 66, 50, 32, 119, 104, 101, 110, 32, 112, 111, 115, 115, 105, 98,
+    108, 101, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 32, 34,
+    71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 50, 53, 54, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110,
+    101, 115, 116, 101, 100, 67, 109, 100, 66, 117, 102, 73, 110, 108, 105, 110, 101, 84, 104, 114, 101, 115, 104, 111,
+    108, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 101, 115, 116, 101, 100, 67, 109, 100, 66, 117, 102,
+    73, 110, 108, 105, 110, 101, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 51, 49, 56, 48, 55, 49, 57, 52, 54, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114,
+    32, 97, 110, 105, 115, 111, 116, 114, 111, 112, 105, 99, 32, 102, 105, 108, 116, 101, 114, 105, 110, 103, 32, 111,
+    112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 101, 110, 97, 98, 108, 101, 100,
+    46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116,
+    101, 114, 105, 110, 103, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 97, 110, 105, 115, 111, 70, 105, 108, 116, 101, 114, 79, 112, 116, 69, 110, 97,
+    98, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 110, 105, 115, 111, 70, 105, 108, 116, 101,
+    114, 79, 112, 116, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    57, 53, 56, 52, 55, 48, 50, 50, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 104, 101, 32,
+    114, 111, 117, 110, 100, 45, 117, 112, 32, 108, 111, 103, 105, 99, 32, 102, 111, 114, 32, 115, 97, 109, 112, 108,
+    101, 114, 115, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 32, 34, 71, 102,
+    120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98,
+    111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 97, 109,
+    112, 108, 101, 114, 67, 101, 105, 108, 105, 110, 103, 76, 111, 103, 105, 99, 69, 110, 97, 98, 108, 101, 100, 34, 44,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 101, 105, 108, 105, 110, 103, 76, 111, 103, 105, 99, 69, 110, 97, 98,
+    108, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 56, 54, 57, 57, 50, 56, 57,
+    57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116,
+    114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 114, 111, 117, 110, 100, 105, 110, 103, 32, 111, 102,
+    32, 118, 97, 108, 117, 101, 115, 32, 99, 111, 109, 105, 110, 103, 32, 111, 117, 116, 32, 111, 102, 32, 116, 104,
+    101, 32, 110, 111, 114, 109, 97, 108, 105, 122, 101, 114, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114,
+    105, 110, 103, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 115, 97, 109, 112, 108, 101, 114, 80, 114, 101, 99, 105, 115, 105, 111, 110, 70, 105, 120,
+    69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 101, 99, 105, 115, 105,
+    111, 110, 70, 105, 120, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 50, 56, 54, 56, 52, 55, 55, 55, 53, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 111, 102,
+    32, 116, 104, 101, 32, 80, 69, 82, 70, 95, 77, 73, 80, 32, 102, 105, 101, 108, 100, 32, 105, 110, 32, 83, 97, 109,
+    112, 108, 101, 114, 32, 83, 82, 68, 39, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 84, 101, 120,
+    116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 97, 109, 112, 108, 101, 114, 80, 101, 114,
+    102, 77, 105, 112, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 97, 109, 112, 108, 101, 114, 80, 101, 114,
+    102, 77, 105, 112, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 57, 54, 57, 48, 51, 53,
+    49, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110,
+    116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 116, 104, 101, 32, 97,
+    110, 105, 115, 111, 116, 114, 111, 112, 121, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 32, 102, 111, 114, 32,
+    83, 97, 109, 112, 108, 101, 114, 32, 83, 82, 68, 39, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 32, 34, 71, 102, 120, 57,
+    34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 97, 109, 112, 108, 101, 114,
+    65, 110, 105, 115, 111, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 83, 97, 109, 112, 108, 101, 114, 65, 110, 105, 115, 111, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 53, 50, 49, 50, 56, 51, 49, 48, 56, 125, 44, 32, 123, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116,
+    104, 101, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 116, 104, 101, 32, 97, 110, 105, 115, 111, 116, 114, 111,
+    112, 121, 32, 98, 105, 97, 115, 32, 102, 111, 114, 32, 83, 97, 109, 112, 108, 101, 114, 32, 83, 82, 68, 39, 115, 46,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101,
+    114, 105, 110, 103, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 115, 97, 109, 112, 108, 101, 114, 65, 110, 105, 115, 111, 66, 105, 97, 115, 34, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 83, 97, 109, 112, 108, 101, 114, 65, 110, 105, 115, 111, 66, 105, 97, 115, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 56, 53, 56, 49, 50, 48, 57, 54, 125, 44, 32, 123, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116,
+    104, 101, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 116, 104, 101, 32, 115, 101, 99, 111, 110, 100, 97, 114,
+    121, 32, 97, 110, 105, 115, 111, 116, 114, 111, 112, 121, 32, 98, 105, 97, 115, 32, 102, 111, 114, 32, 83, 97, 109,
+    112, 108, 101, 114, 32, 83, 82, 68, 39, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 84, 101, 120,
+    116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 32, 34, 71, 102, 120, 57, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 97, 109, 112, 108, 101, 114, 83, 101, 99, 65,
+    110, 105, 115, 111, 66, 105, 97, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 97, 109, 112, 108, 101,
+    114, 83, 101, 99, 65, 110, 105, 115, 111, 66, 105, 97, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 50, 54, 53, 52, 57, 54, 53, 50, 48, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 105,
+    115, 32, 101, 110, 97, 98, 108, 101, 100, 44, 32, 116, 104, 101, 110, 32, 111, 110, 108, 121, 32, 116, 104, 111,
+    115, 101, 32, 109, 105, 112, 115, 32, 117, 112, 32, 116, 111, 32, 97, 110, 100, 32, 105, 110, 99, 108, 117, 100,
+    105, 110, 103, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 32, 109, 105, 112, 32, 105, 110, 32, 116, 104, 101,
+    32, 109, 105, 112, 32, 116, 97, 105, 108, 32, 119, 105, 108, 108, 32, 98, 101, 32, 99, 111, 109, 112, 114, 101, 115,
+    115, 101, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32,
+    87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97,
+    103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114,
+    117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 82, 101, 115, 116, 114, 105, 99, 116,
+    77, 101, 116, 97, 68, 97, 116, 97, 85, 115, 101, 73, 110, 77, 105, 112, 84, 97, 105, 108, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 87, 97, 82, 101, 115, 116, 114, 105, 99, 116, 77, 101, 116, 97, 68, 97, 116, 97, 85, 115,
+    101, 73, 110, 77, 105, 112, 84, 97, 105, 108, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 53,
+    57, 57, 49, 50, 48, 57, 50, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 73, 102, 32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 105, 115, 32, 101, 110,
+    97, 98, 108, 101, 100, 44, 32, 116, 104, 101, 110, 32, 110, 111, 110, 45, 99, 111, 112, 121, 32, 82, 79, 80, 51, 32,
+    119, 105, 108, 108, 32, 100, 105, 115, 97, 98, 108, 101, 32, 116, 104, 101, 32, 68, 67, 67, 32, 111, 118, 101, 114,
+    119, 114, 105, 116, 101, 32, 99, 111, 109, 98, 105, 110, 101, 114, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102,
+    97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101,
+    116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    119, 97, 76, 111, 103, 105, 99, 79, 112, 68, 105, 115, 97, 98, 108, 101, 115, 79, 118, 101, 114, 119, 114, 105, 116,
+    101, 67, 111, 109, 98, 105, 110, 101, 114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 76, 111, 103,
+    105, 99, 79, 112, 68, 105, 115, 97, 98, 108, 101, 115, 79, 118, 101, 114, 119, 114, 105, 116, 101, 67, 111, 109, 98,
+    105, 110, 101, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 54, 54, 50, 48, 51, 52,
+    54, 57, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116,
+    104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100,
+    44, 32, 116, 104, 101, 110, 32, 114, 111, 116, 97, 116, 101, 100, 32, 115, 119, 105, 122, 122, 108, 101, 32, 109,
+    111, 100, 101, 115, 32, 119, 105, 108, 108, 32, 100, 105, 115, 97, 98, 108, 101, 32, 116, 104, 101, 32, 68, 67, 67,
+    32, 111, 118, 101, 114, 119, 114, 105, 116, 101, 32, 99, 111, 109, 98, 105, 110, 101, 114, 46, 34, 44, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117,
+    110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101,
+    114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 119, 97, 82, 111, 116, 97, 116, 101, 100, 83, 119, 105, 122, 122, 108, 101, 68, 105,
+    115, 97, 98, 108, 101, 115, 79, 118, 101, 114, 119, 114, 105, 116, 101, 67, 111, 109, 98, 105, 110, 101, 114, 34,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 82, 111, 116, 97, 116, 101, 100, 83, 119, 105, 122, 122, 108,
+    101, 68, 105, 115, 97, 98, 108, 101, 115, 79, 118, 101, 114, 119, 114, 105, 116, 101, 67, 111, 109, 98, 105, 110,
+    101, 114, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 54, 51, 52, 57, 56, 53, 54, 51, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 104, 101,
+    32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 44, 32, 116,
+    104, 101, 110, 32, 100, 105, 115, 97, 98, 108, 105, 110, 103, 32, 102, 77, 97, 115, 107, 32, 99, 111, 109, 112, 114,
+    101, 115, 115, 105, 111, 110, 32, 97, 108, 115, 111, 32, 115, 101, 116, 115, 32, 116, 104, 101, 32, 68, 73, 83, 65,
+    66, 76, 69, 95, 70, 77, 65, 83, 75, 95, 78, 79, 70, 69, 84, 67, 72, 95, 79, 80, 84, 32, 98, 105, 116, 46, 34, 44,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114,
+    111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123,
+    34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 68, 105, 115, 97, 98, 108, 101, 70, 109, 97, 115, 107, 78, 111, 102,
+    101, 116, 99, 104, 79, 112, 79, 110, 70, 109, 97, 115, 107, 67, 111, 109, 112, 114, 101, 115, 115, 105, 111, 110,
+    68, 105, 115, 97, 98, 108, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 68, 105, 115, 97, 98, 108,
+    101, 70, 109, 97, 115, 107, 78, 111, 102, 101, 116, 99, 104, 79, 112, 79, 110, 70, 109, 97, 115, 107, 67, 111, 109,
+    112, 114, 101, 115, 115, 105, 111, 110, 68, 105, 115, 97, 98, 108, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 49, 57, 55, 49, 57, 51, 54, 57, 49, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 70, 105, 120, 101, 115, 32, 105, 115, 115, 117, 101, 115, 32, 114, 101, 108, 97,
+    116, 101, 100, 32, 116, 111, 32, 117, 110, 101, 120, 112, 111, 115, 101, 100, 32, 77, 83, 65, 65, 32, 115, 97, 109,
+    112, 108, 101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101,
+    32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108,
+    97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116,
+    114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 70, 105, 120, 80, 111, 115, 116,
+    90, 67, 111, 110, 115, 101, 114, 118, 97, 116, 105, 118, 101, 82, 97, 115, 116, 101, 114, 105, 122, 97, 116, 105,
+    111, 110, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 70, 105, 120, 80, 111, 115, 116, 90, 67, 111,
+    110, 115, 101, 114, 118, 97, 116, 105, 118, 101, 82, 97, 115, 116, 101, 114, 105, 122, 97, 116, 105, 111, 110, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 55, 55, 57, 48, 52, 54, 48, 49, 50, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 105, 120, 101, 115, 32, 105, 115,
+    115, 117, 101, 115, 32, 114, 101, 108, 97, 116, 101, 100, 32, 116, 111, 32, 105, 110, 118, 97, 108, 105, 100, 32,
+    118, 97, 108, 117, 101, 115, 32, 97, 115, 115, 111, 99, 105, 97, 116, 101, 100, 32, 119, 105, 116, 104, 32, 86, 71,
+    84, 95, 84, 69, 83, 83, 95, 68, 73, 83, 84, 82, 73, 66, 85, 84, 73, 79, 78, 46, 34, 44, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115,
+    34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97,
+    100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 119, 97, 67, 108, 97, 109, 112, 81, 117, 97, 100, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105,
+    111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 67, 108, 97, 109,
+    112, 81, 117, 97, 100, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 50, 50, 57, 51, 55, 54, 55, 56, 125, 44, 32, 123,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32,
+    119, 104, 101, 116, 104, 101, 114, 32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 119,
+    97, 87, 114, 105, 116, 101, 49, 120, 65, 65, 83, 97, 109, 112, 108, 101, 76, 111, 99, 97, 116, 105, 111, 110, 115,
+    84, 111, 90, 101, 114, 111, 32, 105, 115, 32, 97, 99, 116, 105, 118, 101, 46, 32, 70, 65, 76, 83, 69, 58, 32, 32,
+    32, 70, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 111,
+    102, 102, 46, 32, 84, 82, 85, 69, 58, 32, 32, 32, 32, 70, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32, 119, 111,
+    114, 107, 97, 114, 111, 117, 110, 100, 32, 111, 110, 46, 32, 78, 111, 116, 32, 83, 101, 116, 58, 32, 65, 108, 108,
+    111, 119, 115, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 116, 111, 32, 100, 101, 99, 105, 100, 101,
+    44, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 67, 104, 105, 112, 32, 73, 68, 46, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100,
+    115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101,
+    97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 119, 97, 87, 114, 105, 116, 101, 49, 120, 65, 65, 83, 97, 109, 112, 108, 101, 76, 111, 99, 97,
+    116, 105, 111, 110, 115, 84, 111, 90, 101, 114, 111, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 87,
+    114, 105, 116, 101, 49, 120, 65, 65, 83, 97, 109, 112, 108, 101, 76, 111, 99, 97, 116, 105, 111, 110, 115, 84, 111,
+    90, 101, 114, 111, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 52, 50, 51, 56, 48, 55,
+    50, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 101, 32,
+    111, 118, 101, 114, 119, 114, 105, 116, 101, 32, 99, 111, 109, 98, 105, 110, 101, 114, 32, 109, 97, 114, 107, 115,
+    32, 115, 111, 109, 101, 116, 104, 105, 110, 103, 32, 97, 115, 32, 111, 118, 101, 114, 119, 114, 105, 116, 116, 101,
+    110, 32, 101, 118, 101, 110, 32, 105, 102, 32, 116, 104, 101, 114, 101, 32, 97, 114, 101, 32, 101, 110, 115, 117,
+    105, 110, 103, 113, 117, 97, 100, 115, 32, 116, 111, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 115, 101, 99,
+    116, 111, 114, 32, 116, 104, 97, 116, 32, 110, 101, 101, 100, 32, 100, 101, 115, 116, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100,
+    115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101,
+    97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 119, 97, 67, 111, 108, 111, 114, 67, 97, 99, 104, 101, 67, 111, 110, 116, 114, 111, 108, 108,
+    101, 114, 73, 110, 118, 97, 108, 105, 100, 69, 118, 105, 99, 116, 105, 111, 110, 34, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 87, 97, 67, 111, 108, 111, 114, 67, 97, 99, 104, 101, 67, 111, 110, 116, 114, 111, 108, 108, 101,
+    114, 73, 110, 118, 97, 108, 105, 100, 69, 118, 105, 99, 116, 105, 111, 110, 34, 44, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 50, 51, 51, 48, 51, 54, 56, 52, 52, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 105, 115, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32,
+    102, 111, 114, 99, 101, 115, 32, 104, 84, 105, 108, 101, 32, 100, 97, 116, 97, 32, 116, 111, 32, 98, 101, 32, 90,
+    45, 111, 110, 108, 121, 32, 102, 111, 114, 32, 105, 109, 97, 103, 101, 115, 32, 119, 105, 116, 104, 32, 109, 117,
+    108, 116, 105, 112, 108, 101, 32, 109, 105, 112, 32, 108, 101, 118, 101, 108, 115, 46, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100,
+    115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101,
+    97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 119, 97, 70, 111, 114, 99, 101, 90, 111, 110, 108, 121, 72, 116, 105, 108, 101, 70, 111, 114,
+    77, 105, 112, 109, 97, 112, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 70, 111, 114, 99, 101,
+    90, 111, 110, 108, 121, 72, 116, 105, 108, 101, 70, 111, 114, 77, 105, 112, 109, 97, 112, 115, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 54, 48, 54, 50, 52, 54, 49, 50, 125, 44, 32, 123, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 101, 32, 111, 118, 101, 114, 119, 114, 105, 116,
+    101, 32, 99, 111, 109, 98, 105, 110, 101, 114, 32, 116, 97, 107, 101, 115, 32, 111, 110, 108, 121, 32, 116, 104,
+    101, 32, 116, 97, 114, 103, 101, 116, 32, 109, 97, 115, 107, 32, 105, 110, 116, 111, 32, 99, 111, 110, 115, 105,
+    100, 101, 114, 97, 116, 105, 111, 110, 32, 119, 104, 105, 108, 101, 32, 100, 101, 99, 105, 100, 105, 110, 103, 116,
+    111, 32, 111, 118, 101, 114, 119, 114, 105, 116, 101, 32, 99, 111, 109, 98, 105, 110, 101, 32, 119, 104, 101, 114,
+    101, 97, 115, 32, 116, 104, 101, 32, 111, 116, 104, 101, 114, 32, 112, 97, 114, 116, 115, 32, 111, 102, 32, 116,
+    104, 101, 32, 67, 66, 32, 100, 101, 99, 105, 100, 101, 32, 111, 110, 32, 115, 104, 97, 100, 101, 114, 32, 109, 97,
+    115, 107, 32, 97, 110, 100, 116, 97, 114, 103, 101, 116, 32, 109, 97, 115, 107, 46, 32, 84, 104, 105, 115, 32, 100,
+    105, 115, 99, 114, 101, 112, 97, 110, 99, 121, 32, 109, 97, 121, 32, 108, 101, 97, 100, 32, 116, 111, 32, 116, 104,
+    101, 32, 111, 118, 101, 114, 119, 114, 105, 116, 101, 32, 99, 111, 109, 98, 105, 110, 101, 114, 32, 105, 110, 99,
+    111, 114, 114, 101, 99, 116, 108, 121, 32, 115, 105, 103, 110, 97, 108, 105, 110, 103, 97, 32, 114, 101, 97, 100,
+    32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 119, 104, 101, 110, 32, 115, 104, 97, 100, 101,
+    114, 32, 97, 110, 100, 32, 116, 97, 114, 103, 101, 116, 32, 109, 97, 115, 107, 32, 97, 114, 101, 32, 100, 105, 102,
+    102, 101, 114, 101, 110, 116, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114,
+    101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70,
+    108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32,
+    116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 79, 118, 101, 114, 119, 114,
+    105, 116, 101, 67, 111, 109, 98, 105, 110, 101, 114, 84, 97, 114, 103, 101, 116, 77, 97, 115, 107, 79, 110, 108,
+    121, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 79, 118, 101, 114, 119, 114, 105, 116, 101, 67, 111,
+    109, 98, 105, 110, 101, 114, 84, 97, 114, 103, 101, 116, 77, 97, 115, 107, 79, 110, 108, 121, 34, 44, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 55, 48, 55, 51, 50, 48, 52, 52, 125, 44, 32, 123, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 105, 102, 32,
+    104, 84, 105, 108, 101, 32, 112, 114, 101, 102, 101, 116, 99, 104, 32, 105, 115, 32, 100, 105, 115, 98, 108, 101,
+    100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111,
+    114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117,
+    101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102,
+    120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 68, 105, 115, 97, 98, 108, 101, 72, 116, 105,
+    108, 101, 80, 114, 101, 102, 101, 116, 99, 104, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 68, 105,
+    115, 97, 98, 108, 101, 72, 116, 105, 108, 101, 80, 114, 101, 102, 101, 116, 99, 104, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 49, 49, 50, 48, 57, 53, 50, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 105, 102, 32, 83, 84,
+    65, 76, 76, 69, 68, 95, 80, 79, 80, 83, 32, 105, 115, 32, 117, 115, 101, 100, 32, 111, 114, 32, 110, 111, 116, 46,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107,
+    97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32,
+    123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 77, 105, 115, 99, 80, 111, 112, 115, 77, 105, 115, 115, 101,
+    100, 79, 118, 101, 114, 108, 97, 112, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 77, 105, 115, 99,
+    80, 111, 112, 115, 77, 105, 115, 115, 101, 100, 79, 118, 101, 114, 108, 97, 112, 34, 44, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 49, 55, 48, 55, 49, 51, 54, 49, 49, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 105, 102, 32, 119, 104,
+    101, 110, 101, 118, 101, 114, 32, 97, 32, 99, 111, 110, 116, 101, 120, 116, 32, 114, 111, 108, 108, 32, 105, 115,
+    32, 100, 101, 116, 101, 99, 116, 101, 100, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 104, 101, 32, 115, 99,
+    105, 115, 115, 111, 114, 32, 114, 101, 103, 105, 115, 116, 101, 114, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32,
+    114, 101, 119, 114, 105, 116, 116, 101, 110, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114,
+    100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101,
+    125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105,
+    110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98,
+    111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 77,
+    105, 115, 99, 83, 99, 105, 115, 115, 111, 114, 82, 101, 103, 105, 115, 116, 101, 114, 67, 104, 97, 110, 103, 101,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 77, 105, 115, 99, 83, 99, 105, 115, 115, 111, 114, 82,
+    101, 103, 105, 115, 116, 101, 114, 67, 104, 97, 110, 103, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 51, 53, 56, 48, 56, 55, 54, 51, 52, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 105, 102, 32, 97, 32, 80, 83, 95, 80, 65, 82,
+    84, 73, 65, 76, 95, 70, 76, 85, 83, 72, 32, 105, 115, 32, 117, 115, 101, 100, 32, 119, 104, 101, 110, 101, 118, 101,
+    114, 32, 116, 104, 101, 32, 115, 99, 105, 115, 115, 111, 114, 32, 116, 111, 112, 45, 108, 101, 102, 116, 32, 111,
+    114, 32, 98, 111, 116, 116, 111, 109, 45, 114, 105, 103, 104, 116, 32, 114, 101, 103, 105, 115, 116, 101, 114, 115,
+    32, 99, 104, 97, 110, 103, 101, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97,
+    114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34,
+    70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58,
+    32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 77, 105, 115, 99, 80,
+    115, 70, 108, 117, 115, 104, 83, 99, 105, 115, 115, 111, 114, 67, 104, 97, 110, 103, 101, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 87, 97, 77, 105, 115, 99, 80, 115, 70, 108, 117, 115, 104, 83, 99, 105, 115, 115, 111,
+    114, 67, 104, 97, 110, 103, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 49, 49, 50,
+    54, 56, 53, 54, 52, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73,
+    102, 32, 115, 101, 116, 44, 32, 104, 84, 105, 108, 101, 32, 98, 117, 102, 102, 101, 114, 115, 32, 115, 117, 112,
+    112, 111, 114, 116, 32, 110, 111, 110, 45, 122, 101, 114, 111, 32, 112, 105, 112, 101, 45, 98, 97, 110, 107, 32,
+    120, 111, 114, 32, 118, 97, 108, 117, 101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97,
+    114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115,
+    101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116,
+    105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97,
+    72, 116, 105, 108, 101, 80, 105, 112, 101, 66, 97, 110, 107, 88, 111, 114, 77, 117, 115, 116, 66, 101, 90, 101, 114,
+    111, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 72, 116, 105, 108, 101, 80, 105, 112, 101, 66, 97,
+    110, 107, 88, 111, 114, 77, 117, 115, 116, 66, 101, 90, 101, 114, 111, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 54, 52, 51, 49, 50, 55, 54, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 68, 70, 83, 77, 32, 119, 105, 108, 108, 32,
+    98, 101, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 119, 104, 101, 110, 32, 69, 81, 65, 65, 32, 115, 117, 114,
+    102, 97, 99, 101, 115, 32, 97, 114, 101, 32, 98, 111, 117, 110, 100, 32, 116, 111, 32, 116, 104, 101, 32, 68, 66,
+    34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107,
+    97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32,
+    123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 68, 105, 115, 97, 98, 108, 101, 68, 102, 115, 109, 87, 105,
+    116, 104, 69, 113, 97, 97, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 68, 105, 115, 97, 98, 108, 101,
+    68, 102, 115, 109, 87, 105, 116, 104, 69, 113, 97, 97, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 52, 51, 53, 55, 53, 49, 50, 49, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 32, 80, 65, 76, 32, 119, 105, 108, 108, 32, 110, 111, 116, 32, 115,
+    101, 116, 32, 50, 52, 95, 56, 32, 104, 119, 32, 102, 111, 114, 109, 97, 116, 32, 102, 111, 114, 32, 50, 52, 45, 51,
+    50, 98, 105, 116, 32, 99, 111, 110, 118, 101, 114, 116, 101, 100, 32, 100, 101, 112, 116, 104, 32, 115, 117, 114,
+    102, 97, 99, 101, 115, 44, 32, 116, 104, 105, 115, 32, 119, 105, 108, 108, 32, 102, 105, 120, 32, 102, 97, 115, 116,
+    32, 99, 108, 101, 97, 114, 32, 101, 120, 112, 97, 110, 115, 105, 111, 110, 32, 119, 105, 116, 104, 32, 84, 67, 32,
+    99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 32, 115, 117, 114, 102, 97, 99, 101, 115, 32, 40, 98, 117, 116, 32,
+    97, 108, 115, 111, 32, 114, 101, 116, 117, 114, 110, 32, 105, 110, 99, 111, 114, 114, 101, 99, 116, 32, 117, 110,
+    99, 108, 97, 109, 112, 101, 100, 32, 98, 111, 114, 100, 101, 114, 32, 99, 111, 108, 111, 114, 46, 41, 34, 44, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111,
+    117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82,
+    101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 68, 105, 115, 97, 98, 108, 101, 50, 52, 66, 105, 116, 72, 87, 70, 111,
+    114, 109, 97, 116, 70, 111, 114, 84, 67, 67, 111, 109, 112, 97, 116, 105, 98, 108, 101, 68, 101, 112, 116, 104, 34,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 68, 105, 115, 97, 98, 108, 101, 50, 52, 66, 105, 116, 72, 87,
+    70, 111, 114, 109, 97, 116, 70, 111, 114, 84, 67, 67, 111, 109, 112, 97, 116, 105, 98, 108, 101, 68, 101, 112, 116,
+    104, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 50, 53, 51, 55, 48, 49, 50, 51, 125,
+    44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 32, 71, 102, 120, 57,
+    44, 32, 116, 104, 101, 32, 68, 66, 32, 99, 97, 110, 32, 100, 101, 108, 97, 121, 32, 116, 105, 108, 101, 32, 119,
+    114, 105, 116, 101, 32, 114, 101, 113, 117, 101, 115, 116, 115, 32, 105, 110, 32, 115, 117, 99, 104, 32, 97, 32,
+    119, 97, 121, 32, 116, 104, 97, 116, 32, 105, 116, 115, 32, 112, 101, 110, 100, 105, 110, 103, 32, 119, 114, 105,
+    116, 101, 32, 97, 99, 107, 32, 99, 111, 117, 110, 116, 101, 114, 115, 32, 99, 97, 110, 32, 117, 110, 100, 101, 114,
+    102, 108, 111, 119, 32, 119, 104, 105, 108, 101, 32, 112, 114, 111, 99, 101, 115, 115, 105, 110, 103, 32, 69, 79,
+    80, 32, 116, 105, 109, 101, 115, 116, 97, 109, 112, 115, 46, 32, 84, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111,
+    117, 110, 100, 32, 105, 115, 32, 116, 111, 32, 105, 115, 115, 117, 101, 32, 97, 32, 90, 80, 65, 83, 83, 95, 68, 79,
+    78, 69, 32, 101, 118, 101, 110, 116, 32, 98, 101, 102, 111, 114, 101, 32, 101, 97, 99, 104, 32, 116, 105, 109, 101,
+    115, 116, 97, 109, 112, 32, 101, 118, 101, 110, 116, 32, 98, 101, 99, 97, 117, 115, 101, 32, 105, 116, 32, 119, 105,
+    108, 108, 32, 97, 100, 100, 32, 112, 101, 110, 100, 105, 110, 103, 32, 119, 114, 105, 116, 101, 115, 32, 119, 104,
+    105, 99, 104, 32, 97, 114, 101, 32, 108, 111, 119, 101, 114, 32, 112, 114, 105, 111, 114, 105, 116, 121, 32, 116,
+    104, 97, 110, 32, 116, 104, 101, 32, 116, 105, 108, 101, 32, 119, 114, 105, 116, 101, 115, 32, 115, 111, 32, 116,
+    104, 101, 121, 32, 119, 105, 108, 108, 32, 102, 101, 110, 99, 101, 32, 116, 104, 101, 32, 100, 101, 108, 97, 121,
+    101, 100, 32, 119, 114, 105, 116, 101, 115, 46, 32, 68, 101, 102, 97, 117, 108, 116, 115, 32, 116, 111, 32, 84, 82,
+    85, 69, 32, 102, 111, 114, 32, 71, 102, 120, 57, 44, 32, 70, 65, 76, 83, 69, 32, 102, 111, 114, 32, 111, 116, 104,
+    101, 114, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32,
+    87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97,
+    103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114,
+    117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 68, 117, 109, 109, 121, 90, 112, 97,
+    115, 115, 68, 111, 110, 101, 66, 101, 102, 111, 114, 101, 84, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    87, 97, 68, 117, 109, 109, 121, 90, 112, 97, 115, 115, 68, 111, 110, 101, 66, 101, 102, 111, 114, 101, 84, 115, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 49, 52, 57, 49, 54, 52, 49, 50, 125, 44, 32, 123,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 32, 71, 102, 120, 57, 44, 32, 116,
+    104, 101, 32, 109, 101, 116, 97, 45, 97, 100, 100, 114, 101, 115, 115, 105, 110, 103, 32, 101, 113, 117, 97, 116,
+    105, 111, 110, 32, 99, 97, 110, 32, 116, 104, 101, 111, 114, 101, 116, 105, 99, 97, 108, 108, 121, 32, 109, 97, 112,
+    32, 109, 117, 108, 116, 105, 112, 108, 101, 32, 112, 105, 120, 101, 108, 115, 32, 116, 111, 32, 116, 104, 101, 32,
+    115, 97, 109, 101, 32, 84, 104, 105, 115, 32, 102, 105, 120, 32, 112, 114, 101, 118, 101, 110, 116, 115, 32, 116,
+    104, 97, 116, 32, 102, 114, 111, 109, 32, 104, 97, 112, 112, 101, 110, 105, 110, 103, 46, 32, 32, 77, 101, 116, 97,
+    45, 101, 113, 117, 97, 116, 105, 111, 110, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100, 32, 98, 121, 32, 100,
+    114, 105, 118, 101, 114, 32, 109, 117, 115, 116, 32, 109, 97, 116, 99, 104, 32, 116, 104, 101, 32, 109, 101, 116,
+    97, 32, 101, 113, 117, 97, 116, 105, 111, 110, 32, 97, 115, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100, 32, 98,
+    121, 32, 116, 104, 101, 32, 115, 105, 108, 105, 99, 111, 110, 46, 32, 32, 80, 114, 111, 100, 117, 99, 116, 115, 32,
+    116, 104, 97, 116, 32, 100, 111, 32, 110, 111, 116, 32, 104, 97, 118, 101, 32, 116, 104, 101, 32, 102, 105, 120, 32,
+    104, 97, 118, 101, 32, 110, 111, 32, 72, 87, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 115,
+    32, 116, 104, 97, 116, 32, 101, 120, 112, 111, 115, 101, 32, 116, 104, 101, 32, 112, 114, 111, 98, 108, 101, 109,
+    46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114,
+    107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58,
+    32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 77, 101, 116, 97, 65, 108, 105, 97, 115, 105, 110, 103,
+    70, 105, 120, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 77, 101,
+    116, 97, 65, 108, 105, 97, 115, 105, 110, 103, 70, 105, 120, 69, 110, 97, 98, 108, 101, 100, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49, 56, 50, 49, 53, 53, 54, 54, 56, 125, 44, 32, 123, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 32, 80, 65, 76, 32, 115, 101,
+    116, 115, 32, 67, 66, 95, 67, 79, 76, 79, 82, 95, 65, 84, 84, 82, 73, 66, 46, 76, 73, 77, 73, 84, 95, 67, 79, 76,
+    79, 82, 95, 70, 69, 84, 67, 72, 95, 84, 79, 95, 50, 53, 54, 66, 95, 77, 65, 88, 32, 61, 32, 49, 32, 102, 111, 114,
+    32, 109, 105, 112, 32, 108, 101, 118, 101, 108, 115, 32, 105, 110, 32, 116, 104, 101, 32, 116, 97, 105, 108, 32,
+    116, 104, 97, 116, 32, 97, 114, 101, 110, 39, 116, 32, 116, 104, 101, 32, 108, 97, 114, 103, 101, 115, 116, 46, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97,
+    114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32,
+    123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101,
+    121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 70, 111, 114, 99, 101, 50, 53, 54, 98, 67, 98, 70, 101, 116,
+    99, 104, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 70, 111, 114, 99, 101, 50, 53, 54, 98, 67, 98,
+    70, 101, 116, 99, 104, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 52, 52, 51, 51, 51,
+    55, 49, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32,
+    115, 101, 116, 44, 32, 97, 108, 105, 103, 110, 32, 105, 109, 97, 103, 101, 32, 97, 108, 108, 111, 99, 97, 116, 105,
+    111, 110, 32, 115, 105, 122, 101, 32, 117, 112, 32, 116, 111, 32, 102, 114, 97, 103, 109, 101, 110, 116, 32, 115,
+    105, 122, 101, 32, 119, 104, 101, 110, 32, 67, 109, 97, 115, 107, 32, 105, 115, 32, 112, 114, 101, 115, 101, 110,
+    116, 44, 32, 98, 117, 116, 32, 99, 111, 110, 116, 105, 110, 117, 101, 32, 116, 111, 32, 105, 115, 115, 117, 101, 32,
+    71, 67, 78, 32, 114, 97, 110, 103, 101, 100, 32, 115, 121, 110, 99, 115, 32, 111, 112, 101, 114, 97, 116, 105, 111,
+    110, 115, 32, 117, 115, 105, 110, 103, 32, 116, 104, 101, 32, 111, 114, 105, 103, 105, 110, 97, 108, 44, 32, 117,
+    110, 112, 97, 100, 100, 101, 100, 32, 115, 105, 122, 101, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101,
+    116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    119, 97, 67, 109, 97, 115, 107, 73, 109, 97, 103, 101, 83, 121, 110, 99, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 87, 97, 67, 109, 97, 115, 107, 73, 109, 97, 103, 101, 83, 121, 110, 99, 115, 34, 44, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 48, 50, 51, 56, 52, 51, 54, 57, 125, 44, 32, 123, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 80, 65, 76, 32, 119, 105,
+    108, 108, 32, 102, 105, 116, 32, 116, 104, 101, 32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32,
+    102, 97, 99, 116, 111, 114, 32, 114, 105, 110, 103, 32, 98, 117, 102, 102, 101, 114, 32, 116, 111, 32, 98, 101, 32,
+    116, 104, 101, 32, 49, 75, 98, 46, 32, 84, 104, 105, 115, 32, 105, 115, 32, 116, 111, 32, 119, 111, 114, 107, 97,
+    114, 111, 117, 110, 100, 32, 97, 32, 71, 69, 47, 85, 84, 67, 76, 49, 32, 99, 111, 117, 110, 116, 101, 114, 32, 117,
+    110, 100, 101, 114, 102, 108, 111, 119, 32, 72, 87, 32, 98, 117, 103, 46, 92, 92, 110, 47, 47, 35, 32, 83, 117, 112,
+    101, 114, 99, 101, 100, 101, 115, 32, 119, 97, 84, 101, 115, 115, 70, 97, 99, 116, 111, 114, 66, 117, 102, 102, 101,
+    114, 83, 105, 122, 101, 76, 105, 109, 105, 116, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97,
+    114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115,
+    101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116,
+    105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97,
+    84, 101, 115, 115, 70, 97, 99, 116, 111, 114, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 76, 105, 109, 105,
+    116, 71, 101, 85, 116, 99, 108, 49, 85, 110, 100, 101, 114, 102, 108, 111, 119, 34, 44, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 87, 97, 84, 101, 115, 115, 70, 97, 99, 116, 111, 114, 66, 117, 102, 102, 101, 114, 83, 105, 122,
+    101, 76, 105, 109, 105, 116, 71, 101, 85, 116, 99, 108, 49, 85, 110, 100, 101, 114, 102, 108, 111, 119, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 56, 57, 55, 52, 55, 50, 54, 50, 125, 44, 32, 123, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 83, 68, 77,
+    65, 32, 99, 97, 110, 32, 110, 111, 116, 32, 97, 99, 99, 101, 115, 115, 32, 109, 101, 116, 97, 45, 100, 97, 116, 97,
+    32, 40, 99, 111, 109, 112, 114, 101, 115, 115, 105, 111, 110, 41, 32, 115, 117, 114, 102, 97, 99, 101, 115, 46, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97,
+    114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 119, 97, 83, 100, 109, 97, 80, 114, 101, 118, 101, 110, 116, 67, 111, 109, 112, 114, 101, 115, 115, 101, 100,
+    83, 117, 114, 102, 85, 115, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 83, 100, 109, 97, 80,
+    114, 101, 118, 101, 110, 116, 67, 111, 109, 112, 114, 101, 115, 115, 101, 100, 83, 117, 114, 102, 85, 115, 101, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 51, 54, 53, 53, 54, 50, 55, 56, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32,
+    80, 65, 76, 32, 119, 105, 108, 108, 32, 105, 110, 115, 101, 114, 116, 32, 97, 32, 86, 71, 84, 95, 70, 76, 85, 83,
+    72, 32, 98, 101, 116, 119, 101, 101, 110, 32, 97, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 114, 97, 110,
+    115, 105, 116, 105, 111, 110, 32, 102, 114, 111, 109, 32, 97, 32, 78, 71, 71, 32, 116, 111, 32, 97, 32, 108, 101,
+    103, 97, 99, 121, 32, 71, 83, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97,
+    114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34,
+    70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58,
+    32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 86, 103, 116, 70, 108,
+    117, 115, 104, 78, 103, 103, 84, 111, 76, 101, 103, 97, 99, 121, 71, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 87, 97, 86, 103, 116, 70, 108, 117, 115, 104, 78, 103, 103, 84, 111, 76, 101, 103, 97, 99, 121, 71, 115, 34,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 50, 49, 53, 56, 49, 51, 53, 50, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32,
+    80, 65, 76, 32, 119, 105, 108, 108, 32, 105, 110, 115, 101, 114, 116, 32, 97, 32, 86, 71, 84, 95, 70, 76, 85, 83,
+    72, 32, 98, 101, 116, 119, 101, 101, 110, 32, 97, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 114, 97, 110,
+    115, 105, 116, 105, 111, 110, 32, 102, 114, 111, 109, 32, 97, 32, 78, 71, 71, 32, 116, 111, 32, 97, 32, 108, 101,
+    103, 97, 99, 121, 32, 112, 105, 112, 101, 108, 105, 110, 101, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101,
+    116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    119, 97, 86, 103, 116, 70, 108, 117, 115, 104, 78, 103, 103, 84, 111, 76, 101, 103, 97, 99, 121, 34, 44, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 87, 97, 86, 103, 116, 70, 108, 117, 115, 104, 78, 103, 103, 84, 111, 76, 101, 103, 97,
+    99, 121, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 55, 48, 49, 49, 56, 54, 56, 54, 50,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114,
+    117, 101, 44, 32, 101, 110, 97, 98, 108, 101, 115, 32, 112, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 32,
+    111, 102, 32, 73, 110, 100, 101, 120, 32, 98, 117, 102, 102, 101, 114, 32, 112, 97, 103, 101, 115, 32, 112, 114,
+    105, 111, 114, 32, 116, 111, 32, 100, 114, 97, 119, 115, 32, 105, 110, 32, 78, 71, 71, 32, 112, 105, 112, 108, 105,
+    110, 101, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32,
+    87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97,
+    103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114,
+    117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 69, 110, 97, 98, 108, 101, 73, 110,
+    100, 101, 120, 66, 117, 102, 102, 101, 114, 80, 114, 101, 102, 101, 116, 99, 104, 70, 111, 114, 78, 103, 103, 34,
+    44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 69, 110, 97, 98, 108, 101, 73, 110, 100, 101, 120, 66, 117,
+    102, 102, 101, 114, 80, 114, 101, 102, 101, 116, 99, 104, 70, 111, 114, 78, 103, 103, 34, 44, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 56, 49, 54, 49, 52, 55, 53, 48, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 101, 110, 97, 98, 108, 101,
+    115, 32, 90, 49, 54, 95, 85, 78, 79, 82, 77, 32, 49, 120, 65, 65, 32, 117, 110, 105, 110, 105, 116, 105, 97, 108,
+    105, 122, 101, 100, 32, 100, 101, 99, 111, 109, 112, 114, 101, 115, 115, 32, 104, 97, 110, 103, 32, 119, 111, 114,
+    107, 97, 114, 111, 117, 110, 100, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119,
+    97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103,
+    34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111,
+    108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 90, 49, 54, 85,
+    110, 111, 114, 109, 49, 120, 65, 97, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 85, 110, 105, 110, 105, 116,
+    105, 97, 108, 105, 122, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 90, 49, 54, 85, 110,
+    111, 114, 109, 49, 120, 65, 97, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 85, 110, 105, 110, 105, 116, 105,
+    97, 108, 105, 122, 101, 100, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 53, 55, 53, 52, 52, 50,
+    50, 50, 50, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32,
+    116, 114, 117, 101, 44, 32, 102, 111, 114, 99, 101, 115, 32, 76, 97, 116, 101, 65, 108, 108, 111, 99, 71, 115, 32,
+    116, 111, 32, 97, 108, 119, 97, 121, 115, 32, 98, 101, 32, 48, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101,
+    116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    119, 97, 76, 97, 116, 101, 65, 108, 108, 111, 99, 71, 115, 48, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87,
+    97, 76, 97, 116, 101, 65, 108, 108, 111, 99, 71, 115, 48, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 49, 49, 54, 51, 57, 57, 54, 49, 52, 48, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 119, 104, 101, 110, 101, 118, 101, 114, 32, 97,
+    110, 32, 105, 110, 100, 101, 120, 32, 98, 117, 102, 102, 101, 114, 32, 105, 115, 32, 98, 111, 117, 110, 100, 32,
+    119, 105, 116, 104, 32, 122, 101, 114, 111, 32, 115, 105, 122, 101, 32, 119, 101, 32, 105, 110, 115, 116, 101, 97,
+    100, 32, 98, 105, 110, 100, 32, 97, 110, 32, 105, 110, 116, 101, 114, 110, 97, 108, 32, 105, 110, 100, 101, 120, 32,
+    98, 117, 102, 102, 101, 114, 32, 119, 105, 116, 104, 32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 122, 101, 114,
+    111, 32, 101, 110, 116, 114, 121, 32, 116, 111, 32, 112, 114, 101, 118, 101, 110, 116, 32, 97, 32, 104, 97, 110,
+    103, 32, 105, 110, 32, 116, 104, 101, 32, 71, 69, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97,
+    114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115,
+    101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116,
+    105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97,
+    73, 110, 100, 101, 120, 66, 117, 102, 102, 101, 114, 90, 101, 114, 111, 83, 105, 122, 101, 34, 44, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 87, 97, 73, 110, 100, 101, 120, 66, 117, 102, 102, 101, 114, 90, 101, 114, 111, 83, 105,
+    122, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 54, 49, 51, 49, 51, 51, 48, 50,
+    125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114,
+    117, 101, 44, 32, 119, 104, 101, 110, 101, 118, 101, 114, 32, 97, 32, 80, 79, 80, 83, 32, 40, 80, 114, 105, 109,
+    105, 116, 105, 118, 101, 32, 79, 114, 100, 101, 114, 32, 80, 105, 120, 101, 108, 32, 83, 104, 97, 100, 101, 114, 41,
+    32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 105, 115, 32, 98, 111, 117, 110, 100, 44, 32, 119, 101, 32, 110,
+    101, 101, 100, 32, 116, 111, 32, 115, 101, 116, 32, 68, 66, 95, 82, 69, 78, 68, 69, 82, 95, 79, 86, 69, 82, 82, 73,
+    68, 69, 50, 58, 58, 80, 65, 82, 84, 73, 65, 76, 95, 83, 81, 85, 65, 68, 95, 76, 65, 85, 78, 67, 72, 32, 61, 32, 80,
+    83, 76, 67, 95, 79, 78, 95, 72, 65, 78, 71, 95, 79, 78, 76, 89, 32, 116, 111, 32, 112, 114, 101, 118, 101, 110, 116,
+    32, 97, 32, 104, 97, 110, 103, 46, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119,
+    97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103,
+    34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111,
+    108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 83, 116, 97,
+    108, 108, 101, 100, 80, 111, 112, 115, 77, 111, 100, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97,
+    83, 116, 97, 108, 108, 101, 100, 80, 111, 112, 115, 77, 111, 100, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 53, 52, 57, 49, 56, 50, 48, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 73, 66, 50, 39, 115, 32, 99, 97, 110, 110,
+    111, 116, 32, 98, 101, 32, 117, 115, 101, 100, 32, 111, 110, 32, 116, 104, 101, 32, 99, 111, 110, 115, 116, 97, 110,
+    116, 32, 101, 110, 103, 105, 110, 101, 32, 40, 67, 69, 41, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34,
+    72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 93, 44, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100, 83, 101,
+    116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 67, 101,
+    68, 105, 115, 97, 98, 108, 101, 73, 98, 50, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 67, 101, 68,
+    105, 115, 97, 98, 108, 101, 73, 98, 50, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49, 50,
+    54, 50, 53, 57, 51, 52, 54, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 112, 114, 101, 118, 101, 110, 116, 115, 32, 101, 110, 97, 98, 108, 105,
+    110, 103, 32, 66, 73, 71, 95, 80, 65, 71, 69, 32, 102, 111, 114, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 32,
+    116, 104, 97, 116, 32, 99, 111, 117, 108, 100, 32, 115, 104, 97, 114, 101, 32, 97, 32, 54, 52, 75, 105, 66, 32, 109,
+    101, 109, 111, 114, 121, 32, 114, 101, 103, 105, 111, 110, 32, 119, 105, 116, 104, 32, 97, 32, 110, 111, 110, 45,
+    66, 73, 71, 95, 80, 65, 71, 69, 32, 114, 101, 115, 111, 117, 114, 99, 101, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34,
+    93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101, 97, 100,
+    83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 119, 97, 85, 116, 99, 76, 48, 73, 110, 99, 111, 110, 115, 105, 115, 116, 101, 110, 116, 66, 105, 103,
+    80, 97, 103, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 85, 116, 99, 76, 48, 73, 110, 99, 111,
+    110, 115, 105, 115, 116, 101, 110, 116, 66, 105, 103, 80, 97, 103, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 49, 55, 52, 56, 53, 51, 57, 51, 54, 55, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100,
+    32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 44, 32, 116, 104, 101, 110, 32, 52, 120, 32, 77, 83, 65, 65, 32,
+    68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 32, 115, 117, 114, 102, 97, 99, 101, 115, 32, 119, 105,
+    108, 108, 32, 115, 101, 116, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 122, 32, 112,
+    108, 97, 110, 101, 115, 32, 102, 111, 114, 32, 100, 101, 99, 111, 109, 112, 114, 101, 115, 115, 32, 116, 111, 32,
+    50, 32, 105, 110, 32, 111, 114, 100, 101, 114, 32, 116, 111, 32, 97, 118, 111, 105, 100, 32, 97, 32, 104, 97, 110,
+    103, 32, 97, 115, 115, 111, 99, 105, 97, 116, 101, 100, 32, 119, 105, 116, 104, 32, 115, 101, 116, 116, 105, 110,
+    103, 32, 105, 116, 101, 114, 97, 116, 101, 95, 50, 53, 54, 32, 116, 111, 32, 49, 46, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100,
+    115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101,
+    97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 119, 97, 84, 119, 111, 80, 108, 97, 110, 101, 115, 73, 116, 101, 114, 97, 116, 101, 50, 53, 54,
+    34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 84, 119, 111, 80, 108, 97, 110, 101, 115, 73, 116, 101,
+    114, 97, 116, 101, 50, 53, 54, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 52, 57, 55,
+    53, 51, 55, 51, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102,
+    32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 105, 115, 32, 101, 110, 97, 98, 108,
+    101, 100, 44, 32, 119, 104, 101, 110, 32, 108, 101, 103, 97, 99, 121, 32, 116, 101, 115, 115, 101, 108, 108, 97,
+    116, 105, 111, 110, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 119, 105, 116, 104, 32, 119, 105, 114,
+    101, 102, 114, 97, 109, 101, 32, 109, 111, 100, 101, 44, 32, 119, 101, 32, 110, 101, 101, 100, 32, 116, 111, 32,
+    100, 105, 115, 97, 98, 108, 101, 32, 118, 101, 114, 116, 101, 120, 32, 114, 101, 117, 115, 101, 32, 111, 114, 32,
+    115, 117, 102, 102, 101, 114, 32, 99, 111, 114, 114, 117, 112, 116, 105, 111, 110, 46, 34, 44, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100,
+    115, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 102, 97, 108, 115, 101, 125, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 82, 101, 114, 101,
+    97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 119, 97, 84, 101, 115, 115, 73, 110, 99, 111, 114, 114, 101, 99, 116, 82, 101, 108, 97, 116,
+    105, 118, 101, 73, 110, 100, 101, 120, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 84, 101, 115, 115,
+    73, 110, 99, 111, 114, 114, 101, 99, 116, 82, 101, 108, 97, 116, 105, 118, 101, 73, 110, 100, 101, 120, 34, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 49, 53, 57, 51, 50, 54, 48, 49, 125, 44, 32, 123, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101,
+    115, 32, 105, 102, 32, 71, 70, 88, 32, 111, 114, 32, 67, 111, 109, 112, 117, 116, 101, 32, 105, 115, 32, 117, 115,
+    101, 100, 32, 116, 111, 32, 102, 97, 115, 116, 32, 99, 108, 101, 97, 114, 32, 83, 105, 110, 103, 108, 101, 83, 97,
+    109, 112, 108, 101, 100, 32, 68, 101, 112, 116, 104, 83, 116, 101, 110, 99, 105, 108, 32, 115, 117, 114, 102, 97,
+    99, 101, 115, 46, 32, 86, 97, 108, 117, 101, 32, 105, 115, 32, 105, 110, 32, 117, 110, 105, 116, 115, 32, 111, 102,
+    32, 40, 112, 105, 120, 32, 119, 105, 100, 116, 104, 32, 120, 32, 104, 101, 105, 103, 104, 116, 32, 120, 32, 100,
+    101, 112, 116, 104, 41, 46, 32, 86, 97, 108, 117, 101, 115, 32, 60, 61, 32, 116, 104, 105, 115, 32, 119, 105, 108,
+    108, 32, 116, 97, 107, 101, 32, 71, 70, 88, 32, 101, 108, 115, 101, 32, 67, 111, 109, 112, 117, 116, 101, 46, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 82, 80, 77, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 50, 48, 57, 55, 49, 53, 50, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 101, 112, 116, 104, 83, 116, 101, 110, 99, 105, 108, 70, 97,
+    115, 116, 67, 108, 101, 97, 114, 67, 111, 109, 112, 117, 116, 101, 84, 104, 114, 101, 115, 104, 111, 108, 100, 83,
+    105, 110, 103, 108, 101, 83, 97, 109, 112, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101,
+    112, 116, 104, 83, 116, 101, 110, 99, 105, 108, 70, 97, 115, 116, 67, 108, 101, 97, 114, 67, 111, 109, 112, 117,
+    116, 101, 84, 104, 114, 101, 115, 104, 111, 108, 100, 83, 105, 110, 103, 108, 101, 83, 97, 109, 112, 108, 101, 100,
+    34, 44, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 102, 97, 108, 115,
+    101, 44, 32, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125,
+    44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 51, 52, 54, 48, 51, 51, 50, 49, 125, 44, 32,
+    123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110,
+    101, 115, 32, 105, 102, 32, 71, 70, 88, 32, 111, 114, 32, 67, 111, 109, 112, 117, 116, 101, 32, 105, 115, 32, 117,
+    115, 101, 100, 32, 116, 111, 32, 102, 97, 115, 116, 32, 99, 108, 101, 97, 114, 32, 77, 117, 108, 116, 105, 83, 97,
+    109, 112, 108, 101, 100, 32, 68, 101, 112, 116, 104, 83, 116, 101, 110, 99, 105, 108, 32, 115, 117, 114, 102, 97,
+    99, 101, 115, 46, 32, 86, 97, 108, 117, 101, 32, 105, 115, 32, 105, 110, 32, 117, 110, 105, 116, 115, 32, 111, 102,
+    32, 40, 112, 105, 120, 32, 119, 105, 100, 116, 104, 32, 120, 32, 104, 101, 105, 103, 104, 116, 32, 120, 32, 100,
+    101, 112, 116, 104, 41, 46, 32, 86, 97, 108, 117, 101, 115, 32, 60, 61, 32, 116, 104, 105, 115, 32, 119, 105, 108,
+    108, 32, 116, 97, 107, 101, 32, 71, 70, 88, 32, 101, 108, 115, 101, 32, 67, 111, 109, 112, 117, 116, 101, 46, 34,
+    44, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 34, 82, 80, 77, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 49, 57, 52, 51, 48, 52, 125, 44, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 101, 112, 116, 104, 83, 116, 101, 110, 99, 105, 108, 70, 97,
+    115, 116, 67, 108, 101, 97, 114, 67, 111, 109, 112, 117, 116, 101, 84, 104, 114, 101, 115, 104, 111, 108, 100, 77,
+    117, 108, 116, 105, 83, 97, 109, 112, 108, 101, 100, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 112,
+    116, 104, 83, 116, 101, 110, 99, 105, 108, 70, 97, 115, 116, 67, 108, 101, 97, 114, 67, 111, 109, 112, 117, 116,
+    101, 84, 104, 114, 101, 115, 104, 111, 108, 100, 77, 117, 108, 116, 105, 83, 97, 109, 112, 108, 101, 100, 34, 44,
+    32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 34, 73, 115, 72, 101, 120, 34, 58, 32, 102, 97, 108, 115, 101, 44,
+    32, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 125, 44, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 56, 50, 56, 53, 55, 54, 56, 48, 125, 44, 32, 123, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 99,
+    111, 110, 115, 101, 99, 117, 116, 105, 118, 101, 32, 98, 97, 114, 114, 105, 101, 114, 115, 32, 119, 105, 116, 104,
+    32, 110, 111, 32, 105, 109, 97, 103, 101, 32, 108, 97, 121, 111, 117, 116, 32, 116, 114, 97, 110, 115, 105, 116,
+    105, 111, 110, 115, 32, 111, 114, 32, 101, 118, 101, 110, 116, 32, 119, 97, 105, 116, 115, 32, 97, 114, 101, 32, 99,
+    111, 97, 108, 101, 115, 99, 101, 100, 58, 32, 97, 32, 98, 97, 114, 114, 105, 101, 114, 32, 119, 104, 111, 115, 101,
+    32, 115, 121, 110, 99, 32, 112, 97, 99, 107, 101, 116, 115, 32, 119, 111, 117, 108, 100, 32, 105, 109, 109, 101,
+    100, 105, 97, 116, 101, 108, 121, 32, 102, 111, 108, 108, 111, 119, 32, 116, 104, 101, 32, 112, 114, 101, 118, 105,
+    111, 117, 115, 32, 98, 97, 114, 114, 105, 101, 114, 39, 115, 32, 115, 121, 110, 99, 32, 112, 97, 99, 107, 101, 116,
+    115, 32, 105, 110, 32, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 114,
+    101, 112, 108, 97, 99, 101, 115, 32, 116, 104, 101, 109, 32, 119, 105, 116, 104, 32, 97, 32, 115, 105, 110, 103,
+    108, 101, 32, 109, 101, 114, 103, 101, 100, 32, 115, 101, 116, 32, 111, 102, 32, 119, 97, 105, 116, 115, 32, 97,
+    110, 100, 32, 99, 97, 99, 104, 101, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 115, 46, 34, 44, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 34, 79, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 34, 93, 44, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101,
+    125, 44, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 111, 97, 108, 101, 115, 99, 101, 66, 97, 114, 114, 105,
+    101, 114, 115, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 111, 97, 108, 101, 115, 99, 101, 66, 97, 114,
+    114, 105, 101, 114, 115, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 57, 57, 57, 55, 52,
+    55, 53, 56, 125, 44, 32, 123, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32,
+    116, 114, 117, 101, 44, 32, 101, 97, 99, 104, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114,
+    32, 116, 114, 97, 99, 107, 115, 32, 116, 104, 101, 32, 99, 111, 109, 112, 114, 101, 115, 115, 105, 111, 110, 32,
+    115, 116, 97, 116, 101, 32, 105, 116, 115, 32, 98, 97, 114, 114, 105, 101, 114, 115, 32, 108, 101, 97, 118, 101, 32,
+    105, 109, 97, 103, 101, 32, 115, 117, 98, 114, 101, 115, 111, 117, 114, 99, 101, 115, 32, 105, 110, 32, 97, 110,
+    100, 32, 115, 107, 105, 112, 115, 32, 100, 101, 99, 111, 109, 112, 114, 101, 115, 115, 44, 32, 102, 97, 115, 116,
+    32, 99, 108, 101, 97, 114, 32, 101, 108, 105, 109, 105, 110, 97, 116, 101, 32, 97, 110, 100, 32, 101, 120, 112, 97,
+    110, 100, 32, 66, 76, 84, 115, 32, 119, 104, 111, 115, 101, 32, 114, 101, 115, 117, 108, 116, 32, 105, 115, 32, 97,
+    108, 114, 101, 97, 100, 121, 32, 105, 110, 32, 112, 108, 97, 99, 101, 44, 32, 114, 101, 103, 97, 114, 100, 108, 101,
+    115, 115, 32, 111, 102, 32, 116, 104, 101, 32, 111, 108, 100, 32, 108, 97, 121, 111, 117, 116, 32, 116, 104, 101,
+    32, 99, 108, 105, 101, 110, 116, 32, 114, 101, 112, 111, 114, 116, 115, 46, 34, 44, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 34, 79, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 34, 93, 44, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 125, 44,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 114, 97, 99, 107, 83, 117, 98, 114, 101, 115, 67, 111, 109,
+    112, 114, 101, 115, 115, 105, 111, 110, 83, 116, 97, 116, 101, 34, 44, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84,
+    114, 97, 99, 107, 83, 117, 98, 114, 101, 115, 67, 111, 109, 112, 114, 101, 115, 115, 105, 111, 110, 83, 116, 97,
+    116, 101, 34, 44, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 57, 50, 56, 50, 52, 50, 51, 57,
+    125, 93, 125
 };  // g_gfx9PalJsonData[]
 
 } // Gfx9
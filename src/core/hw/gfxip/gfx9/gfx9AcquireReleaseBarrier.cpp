@@ -743,11 +743,15 @@ LayoutTransitionInfo Device::PrepareColorBlt(
     const SubResourceInfo*const pSubresInfo    = image.SubresourceInfo(subresRange.startSubres);
 
     const ColorLayoutToState    layoutToState = gfx9ImageConst.LayoutToColorCompressionState();
-    const ColorCompressionState oldState      =
-        ImageLayoutToColorCompressionState(layoutToState, oldLayout);
     const ColorCompressionState newState      =
         ImageLayoutToColorCompressionState(layoutToState, newLayout);
 
+    // If an earlier barrier in this command buffer already left the image in a suitable state, treat this as a
+    // transition from that state so that no BLTs are issued.
+    const ColorCompressionState oldState      = IsCompressionStateKnown(pCmdBuf, image, subresRange, newState)
+        ? newState
+        : ImageLayoutToColorCompressionState(layoutToState, oldLayout);
+
     // Fast clear eliminates are only possible on universal queue command buffers and will be ignored on others. This
     // should be okay because prior operations should be aware of this fact (based on layout), and prohibit us from
     // getting to a situation where one is needed but has not been performed yet.
@@ -883,11 +887,15 @@ LayoutTransitionInfo Device::PrepareDepthStencilBlt(
 
     const DepthStencilLayoutToState    layoutToState =
         gfx9Image.LayoutToDepthCompressionState(subresRange.startSubres);
-    const DepthStencilCompressionState oldState =
-        ImageLayoutToDepthCompressionState(layoutToState, oldLayout);
     const DepthStencilCompressionState newState =
         ImageLayoutToDepthCompressionState(layoutToState, newLayout);
 
+    // If an earlier barrier in this command buffer already left the image in a suitable state, treat this as a
+    // transition from that state so that no BLTs are issued.
+    const DepthStencilCompressionState oldState = IsCompressionStateKnown(pCmdBuf, image, subresRange, newState)
+        ? newState
+        : ImageLayoutToDepthCompressionState(layoutToState, oldLayout);
+
     LayoutTransitionInfo transitionInfo = {};
 
     if ((oldState == DepthStencilCompressed) && (newState != DepthStencilCompressed))
@@ -1004,6 +1012,8 @@ LayoutTransitionInfo Device::PrepareBltInfo(
         }
     }
 
+    TrackCompressionState(pCmdBuf, imgBarrier.pImage, subresRange, oldLayout, newLayout);
+
     return layoutTransInfo;
 }
 
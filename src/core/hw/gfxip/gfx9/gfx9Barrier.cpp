@@ -75,6 +75,46 @@ static IMsaaState* BarrierMsaaState(
     return pMsaaState;
 }
 
+// =====================================================================================================================
+// Returns true if the barrier's only GPU work is its global syncs. Such a barrier records no other commands which must
+// stay ordered relative to its syncs, so its syncs can be merged with those of an adjacent barrier.
+static bool IsCoalescableBarrier(
+    const BarrierInfo& barrier)
+{
+    bool coalescable = ((barrier.pSplitBarrierGpuEvent        == nullptr) &&
+                        (barrier.flags.splitBarrierEarlyPhase == 0)       &&
+                        (barrier.flags.splitBarrierLatePhase  == 0)       &&
+                        (barrier.gpuEventWaitCount            == 0)       &&
+                        (barrier.rangeCheckedTargetWaitCount  == 0));
+
+    for (uint32 i = 0; coalescable && (i < barrier.transitionCount); i++)
+    {
+        coalescable = (barrier.pTransitions[i].imageInfo.pImage == nullptr);
+    }
+
+    return coalescable;
+}
+
+// =====================================================================================================================
+// Counts the pipeline drains IssueSyncs() will perform for the given requirements. A wait on an EOP timestamp idles
+// the whole pipeline and replaces any partial flushes.
+static uint32 CountPipelineDrains(
+    const SyncReqs& syncReqs)
+{
+    uint32 drains = 0;
+
+    if (syncReqs.waitOnEopTs || TestAnyFlagSet(syncReqs.cacheFlags, CacheSyncFlushAndInvCbMd))
+    {
+        drains = 1;
+    }
+    else
+    {
+        drains = (syncReqs.vsPartialFlush + syncReqs.psPartialFlush + syncReqs.csPartialFlush);
+    }
+
+    return drains;
+}
+
 // =====================================================================================================================
 // Issue BLT operations (i.e., decompress, resummarize) necessary to convert a depth/stencil image from one ImageLayout
 // to another.
@@ -134,11 +174,19 @@ void Device::TransitionDepthStencil(
 
         const DepthStencilLayoutToState    layoutToState =
             gfx9Image.LayoutToDepthCompressionState(subresRange.startSubres);
-        const DepthStencilCompressionState oldState      =
-            ImageLayoutToDepthCompressionState(layoutToState, transition.imageInfo.oldLayout);
         const DepthStencilCompressionState newState      =
             ImageLayoutToDepthCompressionState(layoutToState, transition.imageInfo.newLayout);
 
+        // If an earlier barrier in this command buffer already left the image in a suitable state, treat this as a
+        // transition from that state so that no BLTs are issued. Split barriers are excluded so that both phases
+        // always see the same old state.
+        const bool stateKnown = ((barrier.flags.splitBarrierEarlyPhase == 0) &&
+                                 (barrier.flags.splitBarrierLatePhase  == 0) &&
+                                 IsCompressionStateKnown(pCmdBuf, image, subresRange, newState));
+        const DepthStencilCompressionState oldState      = stateKnown
+            ? newState
+            : ImageLayoutToDepthCompressionState(layoutToState, transition.imageInfo.oldLayout);
+
         if ((oldState == DepthStencilCompressed) && (newState != DepthStencilCompressed))
         {
             // Performing an expand in the late phase is not ideal for performance, as it indicates the decompress
@@ -349,11 +397,19 @@ void Device::ExpandColor(
     PAL_ASSERT(image.IsDepthStencil() == false);
 
     const ColorLayoutToState    layoutToState = gfx9Image.LayoutToColorCompressionState();
-    const ColorCompressionState oldState      =
-        ImageLayoutToColorCompressionState(layoutToState, transition.imageInfo.oldLayout);
     const ColorCompressionState newState      =
         ImageLayoutToColorCompressionState(layoutToState, transition.imageInfo.newLayout);
 
+    // If an earlier barrier in this command buffer already left the image in a suitable state, treat this as a
+    // transition from that state so that no BLTs are issued. Split barriers are excluded so that both phases always
+    // see the same old state.
+    const bool stateKnown = ((barrier.flags.splitBarrierEarlyPhase == 0) &&
+                             (barrier.flags.splitBarrierLatePhase  == 0) &&
+                             IsCompressionStateKnown(pCmdBuf, image, subresRange, newState));
+    const ColorCompressionState oldState      = stateKnown
+        ? newState
+        : ImageLayoutToColorCompressionState(layoutToState, transition.imageInfo.oldLayout);
+
     // Menu of available BLTs.
     bool fastClearEliminate  = false;  // Writes the last clear color values to the base image for any pixel blocks that
                                        // are marked as fast cleared in CMask or DCC.  Single sample or MSAA.
@@ -664,6 +720,90 @@ void Device::ExpandColor(
     }
 }
 
+// =====================================================================================================================
+// Returns true if the barriers previously issued in this command buffer are known to have left every subresource in the
+// range in a compression state which already satisfies newState, so that no decompress, fast clear eliminate or expand
+// BLT is needed regardless of the old layout reported by the client.
+bool Device::IsCompressionStateKnown(
+    const GfxCmdBuffer* pCmdBuf,
+    const Pal::Image&   image,
+    const SubresRange&  subresRange,
+    uint32              newState
+    ) const
+{
+    bool   stateKnown   = false;
+    uint32 trackedState = 0;
+
+    if (Settings().trackSubresCompressionState &&
+        pCmdBuf->SubresStates()->Lookup(&image, subresRange, &trackedState))
+    {
+        if (image.IsDepthStencil())
+        {
+            // Expanded depth with valid HiZ also satisfies a state without HiZ. The reverse would need a resummarize.
+            stateKnown = ((trackedState == newState) ||
+                          ((trackedState == DepthStencilDecomprWithHiZ) && (newState == DepthStencilDecomprNoHiZ)));
+        }
+        else
+        {
+            // A fully decompressed image also satisfies a state which only requires FMask to be decompressed.
+            stateKnown = ((newState != ColorCompressed) && (trackedState <= newState));
+        }
+    }
+
+    return stateKnown;
+}
+
+// =====================================================================================================================
+// Records the compression state which an image layout transition leaves a subresource range in. Compressed states are
+// never recorded: rendering or fast clears can change compressed metadata without any further barriers.
+void Device::TrackCompressionState(
+    GfxCmdBuffer*      pCmdBuf,
+    const IImage*      pImage,
+    const SubresRange& subresRange,
+    ImageLayout        oldLayout,
+    ImageLayout        newLayout
+    ) const
+{
+    if (Settings().trackSubresCompressionState)
+    {
+        SubresStateTracker*const pTracker  = pCmdBuf->SubresStates();
+        const auto&              image     = static_cast<const Pal::Image&>(*pImage);
+        const auto&              gfx9Image = static_cast<const Image&>(*image.GetGfxImage());
+
+        uint32 newState     = 0;
+        bool   isCompressed = true;
+
+        if (TestAnyFlagSet(oldLayout.usages, LayoutUninitializedTarget) ||
+            TestAnyFlagSet(newLayout.usages, LayoutUninitializedTarget))
+        {
+            // The metadata was just (re)initialized or its contents are being discarded.
+        }
+        else if (image.IsDepthStencil())
+        {
+            if (gfx9Image.HasHtileData())
+            {
+                newState     = ImageLayoutToDepthCompressionState(
+                                   gfx9Image.LayoutToDepthCompressionState(subresRange.startSubres), newLayout);
+                isCompressed = (newState == DepthStencilCompressed);
+            }
+        }
+        else if (gfx9Image.HasColorMetaData())
+        {
+            newState     = ImageLayoutToColorCompressionState(gfx9Image.LayoutToColorCompressionState(), newLayout);
+            isCompressed = (newState == ColorCompressed);
+        }
+
+        if (isCompressed)
+        {
+            pTracker->Invalidate(pImage, subresRange);
+        }
+        else
+        {
+            pTracker->Update(pImage, subresRange, newState);
+        }
+    }
+}
+
 // =====================================================================================================================
 void Device::FillCacheOperations(
     const SyncReqs&               syncReqs,
@@ -881,6 +1021,73 @@ void Device::IssueSyncs(
     }
 }
 
+// =====================================================================================================================
+// Issues the global syncs of a barrier which passed IsCoalescableBarrier(). If the sync packets of the previous such
+// barrier are still the last thing in the command stream, no work was recorded between the two barriers. In that case
+// the old packets are discarded and a single set of syncs which satisfies both barriers is issued in their place.
+void Device::IssueCoalescedSyncs(
+    GfxCmdBuffer*                 pCmdBuf,
+    CmdStream*                    pCmdStream,
+    SyncReqs                      syncReqs,
+    HwPipePoint                   waitPoint,
+    CoalescedBarrierSyncs*        pCoalescedSyncs,
+    Developer::BarrierOperations* pOperations
+    ) const
+{
+    if ((pCoalescedSyncs->pCmdStart  != pCoalescedSyncs->pCmdEnd)    &&
+        (pCoalescedSyncs->chunkCount == pCmdStream->GetNumChunks()) &&
+        (pCoalescedSyncs->pCmdEnd    == pCmdStream->GetNextCmdAddr()))
+    {
+        const SyncReqs& prevSyncReqs = pCoalescedSyncs->syncReqs;
+        const uint32    drainsBefore = CountPipelineDrains(prevSyncReqs) + CountPipelineDrains(syncReqs);
+
+        syncReqs.cacheFlags           |= prevSyncReqs.cacheFlags;
+        syncReqs.cpMeCoherCntl.u32All |= prevSyncReqs.cpMeCoherCntl.u32All;
+        syncReqs.waitOnEopTs          |= prevSyncReqs.waitOnEopTs;
+        syncReqs.vsPartialFlush       |= prevSyncReqs.vsPartialFlush;
+        syncReqs.psPartialFlush       |= prevSyncReqs.psPartialFlush;
+        syncReqs.csPartialFlush       |= prevSyncReqs.csPartialFlush;
+        syncReqs.pfpSyncMe            |= prevSyncReqs.pfpSyncMe;
+        syncReqs.syncCpDma            |= prevSyncReqs.syncCpDma;
+
+        // The merged syncs must stall as early in the pipeline as the earliest of the two barriers required.
+        waitPoint = Min(waitPoint, pCoalescedSyncs->waitPoint);
+
+        pCmdStream->RewindCommands(pCoalescedSyncs->pCmdStart);
+
+        const uint32 drainsSaved = drainsBefore - CountPipelineDrains(syncReqs);
+
+        pCoalescedSyncs->barriersCoalesced++;
+        pCoalescedSyncs->drainsSaved += drainsSaved;
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        // Report the merge through the barrier developer callbacks so that tools can tally it.
+        pOperations->coalescing.barriersCoalesced++;
+        pOperations->coalescing.drainsSaved += static_cast<uint16>(drainsSaved);
+#endif
+    }
+
+    const uint32  chunkCount = pCmdStream->GetNumChunks();
+    const uint32* pCmdStart  = pCmdStream->GetNextCmdAddr();
+
+    IssueSyncs(pCmdBuf, pCmdStream, syncReqs, waitPoint, FullSyncBaseAddr, FullSyncSize, pOperations);
+
+    // The packets can only be rewound later if they didn't cause the command stream to roll over to a new chunk.
+    if ((pCmdStart != nullptr) && (chunkCount == pCmdStream->GetNumChunks()))
+    {
+        pCoalescedSyncs->pCmdStart  = pCmdStart;
+        pCoalescedSyncs->pCmdEnd    = pCmdStream->GetNextCmdAddr();
+        pCoalescedSyncs->chunkCount = chunkCount;
+        pCoalescedSyncs->syncReqs   = syncReqs;
+        pCoalescedSyncs->waitPoint  = waitPoint;
+    }
+    else
+    {
+        pCoalescedSyncs->pCmdStart = nullptr;
+        pCoalescedSyncs->pCmdEnd   = nullptr;
+    }
+}
+
 // =====================================================================================================================
 // Inserts a barrier in the current command stream that can stall GPU execution, flush/invalidate caches, or decompress
 // images before further, dependent work can continue in this command buffer.
@@ -897,15 +1104,17 @@ void Device::IssueSyncs(
 //            - Examine all cache transitions to determine which global cache flush/invalidate commands are required.
 //              Note that this includes all caches but DB, the only GPU cache with some range checking ability.
 //            - Issue any requested range-checked target stalls or GPU event stalls.
-//            - Issue the formulated "global" sync commands.
+//            - Issue the formulated "global" sync commands.  If the barrier has nothing but global syncs and the
+//              previous barrier's syncs are still at the tail of the command stream, merge both into one set.
 //     3. Late image transitions:
 //            - Issue metadata initialization BLTs.
 //            - Issue range-checked DB cache flushes.
 //            - Issue any decompress BLTs that couldn't be performed in phase 1.
 void Device::Barrier(
-    GfxCmdBuffer*      pCmdBuf,
-    CmdStream*         pCmdStream,
-    const BarrierInfo& barrier
+    GfxCmdBuffer*          pCmdBuf,
+    CmdStream*             pCmdStream,
+    const BarrierInfo&     barrier,
+    CoalescedBarrierSyncs* pCoalescedSyncs
     ) const
 {
     SyncReqs globalSyncReqs = {};
@@ -1269,7 +1478,20 @@ void Device::Barrier(
             pCmdStream->CommitCommands(pCmdSpace);
         }
 
-        IssueSyncs(pCmdBuf, pCmdStream, globalSyncReqs, barrier.waitPoint, FullSyncBaseAddr, FullSyncSize, &barrierOps);
+        if ((pCoalescedSyncs != nullptr) && Settings().coalesceBarriers && IsCoalescableBarrier(barrier))
+        {
+            IssueCoalescedSyncs(pCmdBuf, pCmdStream, globalSyncReqs, barrier.waitPoint, pCoalescedSyncs, &barrierOps);
+        }
+        else
+        {
+            IssueSyncs(pCmdBuf,
+                       pCmdStream,
+                       globalSyncReqs,
+                       barrier.waitPoint,
+                       FullSyncBaseAddr,
+                       FullSyncSize,
+                       &barrierOps);
+        }
 
         // -------------------------------------------------------------------------------------------------------------
         // -- Perform late image transitions (layout changes and range-checked DB cache flushes).
@@ -1389,6 +1611,12 @@ void Device::Barrier(
                                gfx9Image.GetGpuMemSyncSize(),
                                &barrierOps);
                 }
+
+                TrackCompressionState(pCmdBuf,
+                                      transition.imageInfo.pImage,
+                                      transition.imageInfo.subresRange,
+                                      transition.imageInfo.oldLayout,
+                                      transition.imageInfo.newLayout);
             }
         }
 
@@ -80,8 +80,10 @@ CmdStream::CmdStream(
                  isNested),
     m_cmdUtil(device.CmdUtil()),
     m_pPm4Optimizer(nullptr),
+    m_isNested(isNested),
     m_pChunkPreamble(nullptr),
-    m_contextRollDetected(false)
+    m_contextRollDetected(false),
+    m_nestedRegSummary(device.GetPlatform())
 {
 }
 
@@ -128,6 +130,8 @@ Result CmdStream::Begin(
 
     Result result = GfxCmdStream::Begin(flags, pMemAllocator);
 
+    m_nestedRegSummary.valid = false;
+
     if ((result == Result::Success) && (m_flags.optimizeCommands == 1))
     {
         // Allocate a temporary PM4 optimizer to use during command building.
@@ -151,6 +155,8 @@ void CmdStream::Reset(
     m_pChunkPreamble      = nullptr;
     m_contextRollDetected = false;
 
+    m_nestedRegSummary.valid = false;
+
     GfxCmdStream::Reset(pNewAllocator, returnGpuMemory);
 }
 
@@ -160,6 +166,12 @@ void CmdStream::CleanupTempObjects()
     // Clean up the temporary PM4 optimizer object.
     if (m_pMemAllocator != nullptr)
     {
+        if (m_isNested && (m_pPm4Optimizer != nullptr))
+        {
+            // This is our last chance to capture the register state this stream leaves behind for its callers.
+            m_pPm4Optimizer->ExportNestedSummary(&m_nestedRegSummary);
+        }
+
         PAL_SAFE_DELETE(m_pPm4Optimizer, m_pMemAllocator);
     }
 }
@@ -416,6 +428,12 @@ uint32* CmdStream::WriteSetOneContextRegNoOpt(
     pCmdSpace += totalDwords;
     m_contextRollDetected = true;
 
+    if (m_flags.optModeImmediate == 1)
+    {
+        // The optimizer never saw this write so its shadowed value for this register is stale.
+        m_pPm4Optimizer->SetContextRegInvalid(regAddr);
+    }
+
     return pCmdSpace;
 }
 
@@ -606,10 +624,11 @@ uint32* CmdStream::WriteUserDataEntriesToSgprsGfx(
             }
         }
     }
-    else
+    else if (WideBitfieldIsAnyBitSet(entries.dirty))
     {
         // If we are honoring the dirty flags, then there may be multiple packets because skipping dirty entries
-        // can break the assumption about only writing consecutive registers.
+        // can break the assumption about only writing consecutive registers.  The walk over the mapped user-SGPR's
+        // is skipped entirely when no entries are dirty, which is the common case for back-to-back draws.
         for (uint16 sgpr = 0; sgpr < userSgprCount; ++sgpr)
         {
             const uint16 packetFirstSgpr = (firstUserSgpr + sgpr);
@@ -1020,21 +1039,24 @@ uint32* CmdStream::WriteClearState(
     if ((clearMode == cmd__pfp_clear_state__pop_state) && (m_pPm4Optimizer != nullptr))
     {
         // We just destroyed all the state, reset the pm4 optimizer
-        m_pPm4Optimizer->Reset();
+        m_pPm4Optimizer->ResetToUnknownState();
     }
 
     return pCmdSpace;
 }
 
 // =====================================================================================================================
-// Marks current PM4 optimizer state as invalid. This is expected to be called after nested command buffer execute.
-void CmdStream::NotifyNestedCmdBufferExecute()
+// Updates the PM4 optimizer state to reflect the registers the given nested command stream modified. This is expected
+// to be called after nested command buffer execute.
+void CmdStream::NotifyNestedCmdBufferExecute(
+    const CmdStream& nestedStream)
 {
     if (m_flags.optModeImmediate == 1)
     {
-        // The command buffer PM4 optimizer has no knowledge of nested command buffer state.
-        // Reset PM4 optimizer state so that subsequent PM4 state does not get incorrectly optimized out.
-        m_pPm4Optimizer->Reset();
+        // Forget the registers the nested stream modified and adopt the values it left behind. If the nested stream
+        // was built without PM4 optimization its summary is invalid and all of our PM4 optimizer state is reset so
+        // that subsequent PM4 state does not get incorrectly optimized out.
+        m_pPm4Optimizer->MergeNestedSummary(nestedStream.m_nestedRegSummary);
     }
 }
 
@@ -28,6 +28,7 @@
 #include "core/hw/gfxip/gfxCmdStream.h"
 #include "core/hw/gfxip/gfx9/gfx9Chip.h"
 #include "core/hw/gfxip/gfx9/gfx9CmdUtil.h"
+#include "core/hw/gfxip/gfx9/gfx9Pm4Optimizer.h"
 
 namespace Pal
 {
@@ -36,7 +37,6 @@ namespace Gfx9
 
 class CmdUtil;
 class Device;
-class Pm4Optimizer;
 
 // =====================================================================================================================
 // This is a specialization of CmdStream that has special knowledge of PM4 on GFX9 hardware. It implements conditional
@@ -129,7 +129,7 @@ public:
     // be called in those cases to ensure that immediate mode PM4 optimization invalidates its copy of the register.
     void NotifyIndirectShRegWrite(uint32 regAddr);
 
-    void NotifyNestedCmdBufferExecute();
+    void NotifyNestedCmdBufferExecute(const CmdStream& nestedStream);
 
     void ResetDrawTimeState();
     template <bool canBeOptimized>
@@ -171,10 +171,14 @@ private:
 
     const CmdUtil& m_cmdUtil;
     Pm4Optimizer*  m_pPm4Optimizer;       // This will only be created if optimization is enabled for this stream.
+    const bool     m_isNested;            // True if this stream belongs to a nested command buffer.
     uint32*        m_pChunkPreamble;      // If non-null, the current chunk preamble was allocated here.
     bool           m_contextRollDetected; // This will only be set if a context roll has been detected since the
                                           // last draw.
 
+    // The registers this stream leaves behind for its caller. Only nested streams with PM4 optimization capture this.
+    NestedRegSummary m_nestedRegSummary;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(CmdStream);
     PAL_DISALLOW_DEFAULT_CTOR(CmdStream);
 };
@@ -109,6 +109,8 @@ void ComputeCmdBuffer::ResetState()
 
     // Command buffers start without a valid predicate GPU address.
     m_predGpuAddr = 0;
+
+    memset(&m_coalescedBarrierSyncs, 0, sizeof(m_coalescedBarrierSyncs));
 }
 
 // =====================================================================================================================
@@ -121,7 +123,7 @@ void ComputeCmdBuffer::CmdBarrier(
     const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
     m_gfxCmdBufState.flags.packetPredicate = 0;
 
-    m_device.Barrier(this, &m_cmdStream, barrierInfo);
+    m_device.Barrier(this, &m_cmdStream, barrierInfo, &m_coalescedBarrierSyncs);
 
     m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
 }
@@ -556,10 +558,10 @@ uint32* ComputeCmdBuffer::ValidateUserData(
             || m_spillTableCs.dirty)
         {
             const uint32 sizeInDwords = (userDataLimit - spillThreshold);
-            UpdateUserDataTableCpu(&m_spillTableCs,
-                                   sizeInDwords,
-                                   spillThreshold,
-                                   &m_computeState.csUserDataEntries.entries[0]);
+            UpdateSpillTableCpu(&m_spillTableCs,
+                                sizeInDwords,
+                                spillThreshold,
+                                &m_computeState.csUserDataEntries.entries[0]);
             relocated = true;
         }
 
@@ -683,39 +685,31 @@ uint32* ComputeCmdBuffer::WriteDirtyUserDataEntries(
     // us get away with only checking the first sub-mask of the user-data entries' wide-bitfield of dirty flags.
     static_assert(MaxFastUserDataEntriesCompute <= UserDataEntriesPerMask,
                   "The CS user-data entries mapped to user-SGPR's spans multiple wide-bitfield elements!");
-    constexpr uint32 AllFastUserDataEntriesMask = ((1 << MaxFastUserDataEntriesCompute) - 1);
-    const uint16 userSgprDirtyMask = (m_computeState.csUserDataEntries.dirty[0] & AllFastUserDataEntriesMask);
+    constexpr uint64 AllFastUserDataEntriesMask = ((1ull << MaxFastUserDataEntriesCompute) - 1);
 
     // Additionally, dirty compute user-data is always written to user-SGPR's if it could be mapped by a pipeline,
     // which lets us avoid any complex logic when switching pipelines.
     const uint16 baseUserSgpr = m_device.GetFirstUserDataReg(HwShaderStage::Cs);
 
-    uint16 lastEntry = 0;
-    uint16 count     = 0;
-    for (uint16 e = 0; e < MaxFastUserDataEntriesCompute; ++e)
+    // Each run of consecutive dirty entries is written with a single packet.
+    uint32 firstEntry = 0;
+    uint32 entryCount = 0;
+    uint32 nextEntry  = 0;
+    while (WideBitfieldScanRun(m_computeState.csUserDataEntries.dirty,
+                               nextEntry,
+                               MaxFastUserDataEntriesCompute,
+                               &firstEntry,
+                               &entryCount))
     {
-        while ((e < MaxFastUserDataEntriesCompute) && ((userSgprDirtyMask & (1 << e)) != 0))
-        {
-            PAL_ASSERT((lastEntry == 0) || (lastEntry == (e - 1)));
-            lastEntry = e;
-            ++count;
-            ++e;
-        }
-
-        if (count > 0)
-        {
-            const uint16 firstEntry = (lastEntry - count + 1);
-            pCmdSpace = m_cmdStream.WriteSetSeqShRegs((baseUserSgpr + firstEntry),
-                                                      (baseUserSgpr + lastEntry),
-                                                      ShaderCompute,
-                                                      &m_computeState.csUserDataEntries.entries[firstEntry],
-                                                      pCmdSpace);
+        const uint32 lastEntry = (firstEntry + entryCount - 1);
+        pCmdSpace = m_cmdStream.WriteSetSeqShRegs((baseUserSgpr + firstEntry),
+                                                  (baseUserSgpr + lastEntry),
+                                                  ShaderCompute,
+                                                  &m_computeState.csUserDataEntries.entries[firstEntry],
+                                                  pCmdSpace);
 
-            // Reset accumulators for the next packet.
-            lastEntry = 0;
-            count     = 0;
-        }
-    }
+        nextEntry = (firstEntry + entryCount);
+    } // for each run of dirty entries
 
     // If the currently active pipeline spills any entries to GPU memory, we need to check if any of the dirty
     // user-data entries fall within the spilled region for the current pipeline.
@@ -730,18 +724,18 @@ uint32* ComputeCmdBuffer::WriteDirtyUserDataEntries(
         const uint32 lastMaskId  = ((m_pSignatureCs->userDataLimit - 1) / UserDataEntriesPerMask);
         for (uint32 maskId = firstMaskId; maskId <= lastMaskId; ++maskId)
         {
-            uint16 dirtyMask = m_computeState.csUserDataEntries.dirty[maskId];
+            uint64 dirtyMask = m_computeState.csUserDataEntries.dirty[maskId];
             if (maskId == firstMaskId)
             {
                 // Ignore the dirty bits for any entries below the spill threshold.
                 const uint16 firstEntryInMask = (m_pSignatureCs->spillThreshold & (UserDataEntriesPerMask - 1));
-                dirtyMask &= ~((1 << firstEntryInMask) - 1);
+                dirtyMask &= ~((1ull << firstEntryInMask) - 1);
             }
             if (maskId == lastMaskId)
             {
                 // Ignore the dirty bits for any entries beyond the user-data limit.
                 const uint16 lastEntryInMask = ((m_pSignatureCs->userDataLimit - 1) & (UserDataEntriesPerMask - 1));
-                dirtyMask &= ((1 << (lastEntryInMask + 1)) - 1);
+                dirtyMask &= (UINT64_MAX >> ((UserDataEntriesPerMask - 1) - lastEntryInMask));
             }
 
             if (dirtyMask != 0)
@@ -1046,10 +1040,9 @@ void ComputeCmdBuffer::LeakNestedCmdBufferState(
 {
     Pal::ComputeCmdBuffer::LeakNestedCmdBufferState(callee);
 
-    // Invalidate PM4 optimizer state on post-execute since the current command buffer state does not reflect
-    // state changes from the nested command buffer. We will need to resolve the nested PM4 state onto the
-    // current command buffer for this to work correctly.
-    m_cmdStream.NotifyNestedCmdBufferExecute();
+    // The current PM4 optimizer state does not reflect state changes from the nested command buffer. Resolve the
+    // registers the nested command buffer left behind onto our PM4 optimizer state.
+    m_cmdStream.NotifyNestedCmdBufferExecute(callee.m_cmdStream);
 }
 
 // =====================================================================================================================
@@ -1484,6 +1477,9 @@ void ComputeCmdBuffer::CmdExecuteNestedCmdBuffers(
         // state back to the caller.
         LeakNestedCmdBufferState(*pCallee);
     }
+
+    // The nested command buffers may have changed the metadata state of any image.
+    SubresStates()->Reset();
 }
 
 // =====================================================================================================================
@@ -28,6 +28,7 @@
 #include "core/hw/gfxip/computeCmdBuffer.h"
 #include "core/hw/gfxip/gfx9/gfx9Gds.h"
 #include "core/hw/gfxip/gfx9/gfx9CmdStream.h"
+#include "core/hw/gfxip/gfx9/gfx9Device.h"
 
 namespace Pal
 {
@@ -290,6 +291,9 @@ private:
     //
     gpusize  m_predGpuAddr;
 
+    // The most recent barrier syncs which later barriers may merge into.
+    CoalescedBarrierSyncs  m_coalescedBarrierSyncs;
+
     PAL_DISALLOW_DEFAULT_CTOR(ComputeCmdBuffer);
     PAL_DISALLOW_COPY_AND_ASSIGN(ComputeCmdBuffer);
 };
@@ -50,6 +50,7 @@
 #include "core/hw/gfxip/gfx9/gfx9QueueContexts.h"
 #include "core/hw/gfxip/gfx9/gfx9SettingsLoader.h"
 #include "core/hw/gfxip/gfx9/gfx9ShadowedRegisters.h"
+#include "core/hw/gfxip/gfx9/gfx9StateBlock.h"
 #include "core/hw/gfxip/gfx9/gfx9StreamoutStatsQueryPool.h"
 #include "core/hw/gfxip/gfx9/gfx9UniversalCmdBuffer.h"
 #include "core/hw/gfxip/gfx9/gfx9UniversalEngine.h"
@@ -1202,6 +1203,37 @@ Result Device::CreateMsaaState(
     return result;
 }
 
+// =====================================================================================================================
+size_t Device::GetStateBlockSize(
+    const StateBlockCreateInfo& createInfo,
+    Result*                     pResult
+    ) const
+{
+    if (pResult != nullptr)
+    {
+        (*pResult) = StateBlock::ValidateCreateInfo(createInfo);
+    }
+
+    // The state block's combined PM4 image is stored immediately after the object.
+    return sizeof(StateBlock) + StateBlock::Pm4ImgSize(createInfo);
+}
+
+// =====================================================================================================================
+Result Device::CreateStateBlock(
+    const StateBlockCreateInfo& createInfo,
+    void*                       pPlacementAddr,
+    IStateBlock**               ppStateBlock
+    ) const
+{
+    StateBlock* pStateBlock = PAL_PLACEMENT_NEW(pPlacementAddr) StateBlock(createInfo);
+
+    PAL_ASSERT(pStateBlock != nullptr);
+
+    *ppStateBlock = pStateBlock;
+
+    return Result::Success;
+}
+
 // =====================================================================================================================
 size_t Device::GetImageSize(
     const ImageCreateInfo& createInfo) const
@@ -112,6 +112,19 @@ struct SyncReqs
     };
 };
 
+// Remembers the sync packets written by the most recent coalescable barrier in a command stream. If the next barrier's
+// syncs would be written directly after them, the old packets are discarded and one merged set is issued instead.
+struct CoalescedBarrierSyncs
+{
+    const uint32* pCmdStart;         // First DWORD of the sync packets, or null if there is nothing to merge with.
+    const uint32* pCmdEnd;           // The DWORD following the sync packets.
+    uint32        chunkCount;        // Number of chunks in the command stream when the packets were written.
+    SyncReqs      syncReqs;          // Sync requirements implemented by the packets.
+    HwPipePoint   waitPoint;         // Wait point the packets were built for.
+    uint32        barriersCoalesced; // Number of barriers whose syncs were merged into the previous barrier's.
+    uint32        drainsSaved;       // Number of pipeline drains (EOP waits and partial flushes) avoided by merging.
+};
+
 enum HwLayoutTransition : uint32
 {
     None                         = 0x0,
@@ -261,6 +274,15 @@ public:
         const MsaaStateCreateInfo& createInfo,
         void*                      pPlacementAddr,
         IMsaaState**               ppMsaaState) const override;
+
+    virtual size_t GetStateBlockSize(
+        const StateBlockCreateInfo& createInfo,
+        Result*                     pResult) const override;
+    virtual Result CreateStateBlock(
+        const StateBlockCreateInfo& createInfo,
+        void*                       pPlacementAddr,
+        IStateBlock**               ppStateBlock) const override;
+
     virtual size_t GetImageSize(const ImageCreateInfo& createInfo) const override;
     virtual void CreateImage(
         Pal::Image* pParentImage,
@@ -458,7 +480,11 @@ public:
         const SamplerInfo*  pSamplerInfo,
         void*               pOut);
 
-    void Barrier(GfxCmdBuffer* pCmdBuf, CmdStream* pCmdStream, const BarrierInfo& barrier) const;
+    void Barrier(
+        GfxCmdBuffer*          pCmdBuf,
+        CmdStream*             pCmdStream,
+        const BarrierInfo&     barrier,
+        CoalescedBarrierSyncs* pCoalescedSyncs) const;
 
     void BarrierRelease(
         GfxCmdBuffer*                 pCmdBuf,
@@ -493,6 +519,13 @@ public:
         gpusize                       rangeStartAddr,
         gpusize                       rangeSize,
         Developer::BarrierOperations* pOperations) const;
+    void IssueCoalescedSyncs(
+        GfxCmdBuffer*                 pCmdBuf,
+        CmdStream*                    pCmdStream,
+        SyncReqs                      syncReqs,
+        HwPipePoint                   waitPoint,
+        CoalescedBarrierSyncs*        pCoalescedSyncs,
+        Developer::BarrierOperations* pOperations) const;
     void ExpandColor(
         GfxCmdBuffer*                 pCmdBuf,
         CmdStream*                    pCmdStream,
@@ -509,6 +542,17 @@ public:
         bool                          earlyPhase,
         SyncReqs*                     pSyncReqs,
         Developer::BarrierOperations* pOperations) const;
+    bool IsCompressionStateKnown(
+        const GfxCmdBuffer*           pCmdBuf,
+        const Pal::Image&             image,
+        const SubresRange&            subresRange,
+        uint32                        newState) const;
+    void TrackCompressionState(
+        GfxCmdBuffer*                 pCmdBuf,
+        const IImage*                 pImage,
+        const SubresRange&            subresRange,
+        ImageLayout                   oldLayout,
+        ImageLayout                   newLayout) const;
     void AcqRelColorTransition(
         GfxCmdBuffer*                 pCmdBuf,
         CmdStream*                    pCmdStream,
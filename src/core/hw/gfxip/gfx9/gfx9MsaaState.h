@@ -131,6 +131,7 @@ public:
 
     static size_t Pm4ImgSize(const Device& device, const MsaaStateCreateInfo& msaaState);
     uint32* WriteCommands(CmdStream* pCmdStream, uint32* pCmdSpace) const;
+    uint32 Pm4ImgSizeInDwords() const { return static_cast<uint32>(m_pm4Image.spaceNeeded); }
 
     bool UsesOverRasterization() const { return (m_pm4Image.dbEqaa.bits.OVERRASTERIZATION_AMOUNT != 0); }
     bool ShaderCanKill() const { return (m_pm4Image.dbAlphaToMask.bits.ALPHA_TO_MASK_ENABLE != 0); }
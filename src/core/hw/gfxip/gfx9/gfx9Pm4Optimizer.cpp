@@ -27,7 +27,23 @@
 #include "core/hw/gfxip/gfx9/g_gfx9PalSettings.h"
 #include "core/hw/gfxip/gfx9/gfx9Device.h"
 #include "core/hw/gfxip/gfx9/gfx9Pm4Optimizer.h"
+#include "core/platform.h"
 #include "palAutoBuffer.h"
+#include "palVectorImpl.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define PAL_PM4_OPT_SSE2 1
+#else
+#define PAL_PM4_OPT_SSE2 0
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define PAL_PM4_OPT_AVX2 1
+#else
+#define PAL_PM4_OPT_AVX2 0
+#endif
 
 using namespace Util;
 
@@ -36,6 +52,116 @@ namespace Pal
 namespace Gfx9
 {
 
+// =====================================================================================================================
+// Returns a mask with the low "count" bits set. The count must be in the range [1, 32].
+static uint32 LowBitMask(
+    uint32 count)
+{
+    PAL_ASSERT((count > 0) && (count <= 32));
+    return (0xFFFFFFFF >> (32 - count));
+}
+
+// =====================================================================================================================
+// Reads "count" consecutive bits from a register bitmask starting at bit "start", placing the first bit in bit zero of
+// the return value. The count must be in the range [1, 32].
+static uint32 ReadMaskBits(
+    const uint32* pMask,
+    uint32        start,
+    uint32        count)
+{
+    const uint32 dword = start / 32;
+    const uint64 bits  = (static_cast<uint64>(pMask[dword + 1]) << 32) | pMask[dword];
+
+    return static_cast<uint32>(bits >> (start % 32)) & LowBitMask(count);
+}
+
+// =====================================================================================================================
+// Sets or clears every bit in the given bitmask range [start, start + count).
+static void WriteMaskBitRange(
+    uint32* pMask,
+    uint32  start,
+    uint32  count,
+    bool    set)
+{
+    while (count > 0)
+    {
+        const uint32 dword     = start / 32;
+        const uint32 shift     = start % 32;
+        const uint32 numBits   = Min(count, 32u);
+        const uint64 rangeBits = static_cast<uint64>(LowBitMask(numBits)) << shift;
+
+        if (set)
+        {
+            pMask[dword]     |= LowPart(rangeBits);
+            pMask[dword + 1] |= HighPart(rangeBits);
+        }
+        else
+        {
+            pMask[dword]     &= ~LowPart(rangeBits);
+            pMask[dword + 1] &= ~HighPart(rangeBits);
+        }
+
+        start += numBits;
+        count -= numBits;
+    }
+}
+
+// =====================================================================================================================
+// Marks every register in the range [start, start + count) as set to an unknown value.
+template <size_t RegisterCount>
+static void InvalidateRegRange(
+    uint32                        start,
+    uint32                        count,
+    RegGroupState<RegisterCount>* pRegState)
+{
+    WriteMaskBitRange(pRegState->validMask,   start, count, false);
+    WriteMaskBitRange(pRegState->touchedMask, start, count, true);
+}
+
+// =====================================================================================================================
+// Compares up to 32 consecutive shadowed register values against the new values a SET packet will write. Returns a mask
+// with bit i set if pNewVals[i] differs from pOldVals[i]. The bulk of the range is compared with the widest vector
+// instructions the build targets; any tail falls back to scalar compares.
+static uint32 DiffRegValues(
+    const uint32* pOldVals,
+    const uint32* pNewVals,
+    uint32        count)
+{
+    PAL_ASSERT(count <= 32);
+
+    uint32 diffMask = 0;
+    uint32 idx      = 0;
+
+#if PAL_PM4_OPT_AVX2
+    for (; (idx + 8) <= count; idx += 8)
+    {
+        const __m256i oldVals = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pOldVals + idx));
+        const __m256i newVals = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pNewVals + idx));
+        const uint32  eqMask  = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(oldVals, newVals)));
+
+        diffMask |= ((~eqMask & 0xFF) << idx);
+    }
+#endif
+
+#if PAL_PM4_OPT_SSE2
+    for (; (idx + 4) <= count; idx += 4)
+    {
+        const __m128i oldVals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pOldVals + idx));
+        const __m128i newVals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pNewVals + idx));
+        const uint32  eqMask  = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(oldVals, newVals)));
+
+        diffMask |= ((~eqMask & 0xF) << idx);
+    }
+#endif
+
+    for (; idx < count; ++idx)
+    {
+        diffMask |= (static_cast<uint32>(pOldVals[idx] != pNewVals[idx]) << idx);
+    }
+
+    return diffMask;
+}
+
 // =====================================================================================================================
 // Checks the current register state versus the next written value.  Determines whether a new SET command is necessary,
 // and updates the register state. Returns true if the given register value must be written to HW.
@@ -51,16 +177,16 @@ static bool UpdateRegState(
     // - The new value is different than the old value.
     // - The previous state is invalid.
     // - We must always write this register.
-    if ((pCurRegState->state[regOffset].value           != newRegVal) ||
-        (pCurRegState->state[regOffset].flags.valid     == 0)         ||
-        (pCurRegState->state[regOffset].flags.mustWrite == 1))
+    if ((pCurRegState->value[regOffset] != newRegVal)  ||
+        (pCurRegState->IsValid(regOffset) == false)    ||
+        pCurRegState->IsMustWrite(regOffset))
     {
 #if PAL_BUILD_PM4_INSTRUMENTOR
         pCurRegState->keptSets[regOffset]++;
 #endif
 
-        pCurRegState->state[regOffset].flags.valid = 1;
-        pCurRegState->state[regOffset].value       = newRegVal;
+        pCurRegState->validMask[regOffset / 32] |= (1u << (regOffset % 32));
+        pCurRegState->value[regOffset]           = newRegVal;
 
         mustKeep = true;
     }
@@ -72,6 +198,39 @@ static bool UpdateRegState(
     return mustKeep;
 }
 
+// =====================================================================================================================
+// The range version of UpdateRegState: checks up to 32 sequential registers against their shadowed state at once and
+// updates the state for all of them. Returns a mask with bit i set if the write to register (regOffset + i) must be
+// written to HW.
+template <size_t RegisterCount>
+static uint32 UpdateRegStateRange(
+    const uint32*                 pNewRegVals,
+    uint32                        regOffset,
+    uint32                        count,
+    RegGroupState<RegisterCount>* pCurRegState) // [in,out] Current state of the registers being set, will be updated.
+{
+    PAL_ASSERT((count > 0) && (count <= 32) && ((regOffset + count) <= RegisterCount));
+
+    // Same rules as UpdateRegState, evaluated for the whole range at once.
+    const uint32 keepMask = DiffRegValues(&pCurRegState->value[regOffset], pNewRegVals, count) |
+                            (~ReadMaskBits(pCurRegState->validMask, regOffset, count) & LowBitMask(count)) |
+                            ReadMaskBits(pCurRegState->mustWriteMask, regOffset, count);
+
+    // Unchanged registers already hold their new values so it's simplest to copy the entire range.
+    memcpy(&pCurRegState->value[regOffset], pNewRegVals, count * sizeof(uint32));
+    WriteMaskBitRange(pCurRegState->validMask, regOffset, count, true);
+
+#if PAL_BUILD_PM4_INSTRUMENTOR
+    for (uint32 i = 0; i < count; ++i)
+    {
+        pCurRegState->totalSets[regOffset + i]++;
+        pCurRegState->keptSets[regOffset + i] += ((keepMask >> i) & 1);
+    }
+#endif
+
+    return keepMask;
+}
+
 // =====================================================================================================================
 Pm4Optimizer::Pm4Optimizer(
     const Device& device)
@@ -99,24 +258,15 @@ void Pm4Optimizer::Reset()
     // consist of the viewport scale/offset regs, viewport scissor regs, and guardband regs.
     constexpr uint32 VportStart = mmPA_CL_VPORT_XSCALE     - CONTEXT_SPACE_START;
     constexpr uint32 VportEnd   = mmPA_CL_VPORT_ZOFFSET_15 - CONTEXT_SPACE_START;
-    for (uint32 regOffset = VportStart; regOffset <= VportEnd; ++regOffset)
-    {
-        m_cntxRegs.state[regOffset].flags.mustWrite = 1;
-    }
+    WriteMaskBitRange(m_cntxRegs.mustWriteMask, VportStart, (VportEnd - VportStart + 1), true);
 
     constexpr uint32 VportScissorStart = mmPA_SC_VPORT_SCISSOR_0_TL - CONTEXT_SPACE_START;
     constexpr uint32 VportScissorEnd   = mmPA_SC_VPORT_ZMAX_15      - CONTEXT_SPACE_START;
-    for (uint32 regOffset = VportScissorStart; regOffset <= VportScissorEnd; ++regOffset)
-    {
-        m_cntxRegs.state[regOffset].flags.mustWrite = 1;
-    }
+    WriteMaskBitRange(m_cntxRegs.mustWriteMask, VportScissorStart, (VportScissorEnd - VportScissorStart + 1), true);
 
     constexpr uint32 GuardbandStart = mmPA_CL_GB_VERT_CLIP_ADJ - CONTEXT_SPACE_START;
     constexpr uint32 GuardbandEnd   = mmPA_CL_GB_HORZ_DISC_ADJ - CONTEXT_SPACE_START;
-    for (uint32 regOffset = GuardbandStart; regOffset <= GuardbandEnd; ++regOffset)
-    {
-        m_cntxRegs.state[regOffset].flags.mustWrite = 1;
-    }
+    WriteMaskBitRange(m_cntxRegs.mustWriteMask, GuardbandStart, (GuardbandEnd - GuardbandStart + 1), true);
 
     // This workaround on gfx9 adds some writes to DB_Z_INFO which are preceded by a COND_EXEC. Make sure we don't
     // optimize away writes to this register, which would cause a hang or incorrect skipping of commands.
@@ -124,7 +274,7 @@ void Pm4Optimizer::Reset()
     {
         constexpr uint32 dbZInfoIdx = Gfx09::mmDB_Z_INFO - CONTEXT_SPACE_START;
 
-        m_cntxRegs.state[dbZInfoIdx].flags.mustWrite = 1;
+        WriteMaskBitRange(m_cntxRegs.mustWriteMask, dbZInfoIdx, 1, true);
     }
 
     // Reset the SH register state.
@@ -134,6 +284,123 @@ void Pm4Optimizer::Reset()
     m_contextRollDetected = false;
 }
 
+// =====================================================================================================================
+// Resets the optimizer after something replaced the register state with values we can't know (e.g., a CLEAR_STATE
+// pop). Unlike a normal reset, every register is considered to be modified by this stream from now on so that a caller
+// of a nested stream knows to forget its own shadow state.
+void Pm4Optimizer::ResetToUnknownState()
+{
+    Reset();
+
+    WriteMaskBitRange(m_cntxRegs.touchedMask, 0, CntxRegUsedRangeSize, true);
+    WriteMaskBitRange(m_shRegs.touchedMask,   0, ShRegUsedRangeSize,   true);
+}
+
+// =====================================================================================================================
+// Fills out the modified mask and known final values for one register group of a nested command stream summary.
+template <size_t RegisterCount>
+Result Pm4Optimizer::ExportRegGroup(
+    const RegGroupState<RegisterCount>& regState,
+    uint32*                             pModifiedMask,
+    RegOffsetValueList*                 pValues)
+{
+    Result result = Result::Success;
+
+    pValues->Clear();
+
+    for (uint32 dword = 0; dword < RegGroupState<RegisterCount>::MaskDwords; ++dword)
+    {
+        // Every register which holds a valid value was written by a SET packet in this stream.
+        pModifiedMask[dword] = regState.touchedMask[dword] | regState.validMask[dword];
+
+        uint32 validBits = regState.validMask[dword];
+        uint32 bit       = 0;
+
+        while ((result == Result::Success) && BitMaskScanForward(&bit, validBits))
+        {
+            validBits &= ~(1u << bit);
+
+            const uint32 regOffset = (dword * 32) + bit;
+            result = pValues->PushBack({ regOffset, regState.value[regOffset] });
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Captures a summary of the registers this stream has modified and the values it left in them. This should only be
+// called once a nested command stream is complete; see MergeNestedSummary.
+Result Pm4Optimizer::ExportNestedSummary(
+    NestedRegSummary* pSummary
+    ) const
+{
+    Result result = ExportRegGroup(m_cntxRegs, pSummary->cntxModifiedMask, &pSummary->cntxValues);
+
+    if (result == Result::Success)
+    {
+        result = ExportRegGroup(m_shRegs, pSummary->shModifiedMask, &pSummary->shValues);
+    }
+
+    pSummary->valid = (result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Merges one register group of a nested command stream summary into our shadow state. Returns true if any register in
+// the group was modified.
+template <size_t RegisterCount>
+bool Pm4Optimizer::MergeRegGroup(
+    const uint32*                 pModifiedMask,
+    const RegOffsetValueList&     values,
+    RegGroupState<RegisterCount>* pRegState)
+{
+    uint32 anyModified = 0;
+
+    // First forget every register the nested stream modified...
+    for (uint32 dword = 0; dword < RegGroupState<RegisterCount>::MaskDwords; ++dword)
+    {
+        pRegState->validMask[dword]   &= ~pModifiedMask[dword];
+        pRegState->touchedMask[dword] |=  pModifiedMask[dword];
+        anyModified                   |=  pModifiedMask[dword];
+    }
+
+    // ... then take on the values which the nested stream knows it left behind.
+    for (uint32 idx = 0; idx < values.NumElements(); ++idx)
+    {
+        const RegOffsetValue& regValue = values.At(idx);
+
+        pRegState->value[regValue.regOffset] = regValue.value;
+        pRegState->validMask[regValue.regOffset / 32] |= (1u << (regValue.regOffset % 32));
+    }
+
+    return (anyModified != 0);
+}
+
+// =====================================================================================================================
+// Updates our shadow state to reflect the execution of a nested command stream. Registers which the nested stream did
+// not modify keep their shadowed values so redundant state following the call can still be optimized out.
+void Pm4Optimizer::MergeNestedSummary(
+    const NestedRegSummary& summary)
+{
+    if (summary.valid)
+    {
+        if (MergeRegGroup(summary.cntxModifiedMask, summary.cntxValues, &m_cntxRegs))
+        {
+            // The nested stream rolled the context at least once.
+            m_contextRollDetected = true;
+        }
+
+        MergeRegGroup(summary.shModifiedMask, summary.shValues, &m_shRegs);
+    }
+    else
+    {
+        // We know nothing about the nested stream so we must forget everything.
+        ResetToUnknownState();
+    }
+}
+
 // =====================================================================================================================
 // This functions should be called by Gfx9 CmdStream's "Write" functions to determine if it can skip writing certain
 // packets up-front.
@@ -178,10 +445,10 @@ bool Pm4Optimizer::MustKeepContextRegRmw(
     // regState value to compute newRegVal. If we tried to do it anyway, the fact that our regMask will have some bits
     // disabled means that we would be setting regState's value to something partially invalid which may cause us to
     // skip needed packets in the future.
-    if (m_cntxRegs.state[regOffset].flags.valid != 0)
+    if (m_cntxRegs.IsValid(regOffset))
     {
         // Computed according to the formula stated in the definition of CmdUtil::BuildContextRegRmw.
-        const uint32 newRegVal = (m_cntxRegs.state[regOffset].value & ~regMask) | (regData & regMask);
+        const uint32 newRegVal = (m_cntxRegs.value[regOffset] & ~regMask) | (regData & regMask);
 
         mustKeep = UpdateRegState(newRegVal, regOffset, &m_cntxRegs);
     }
@@ -236,13 +503,13 @@ uint32* Pm4Optimizer::WriteOptimizedSetShShRegOffset(
 {
     // Since this is an indirect write, we do not know the exact SH register data. Invalidate SH register so that
     // the next SH register write will not be skipped inadvertently
-    m_shRegs.state[setShRegOffset.bitfields2.reg_offset].flags.valid = 0;
+    m_shRegs.SetInvalid(setShRegOffset.bitfields2.reg_offset);
 
     // If the index value is set to 0, this packet actually operates on two sequential SH registers so we need to
     // invalidate the following register as well.
     if (setShRegOffset.bitfields2.index == 0)
     {
-        m_shRegs.state[setShRegOffset.bitfields2.reg_offset + 1].flags.valid = 0;
+        m_shRegs.SetInvalid(setShRegOffset.bitfields2.reg_offset + 1);
     }
 
     // memcpy packet into command space
@@ -343,33 +610,33 @@ bool Pm4Optimizer::OptimizePm4Commands(
         else if (opcode == IT_DRAW_INDIRECT)
         {
             const auto& packet = reinterpret_cast<const PM4_PFP_DRAW_INDIRECT&>(*pOrigCmdCur);
-            m_shRegs.state[packet.bitfields3.start_vtx_loc].flags.valid  = 0;
-            m_shRegs.state[packet.bitfields4.start_inst_loc].flags.valid = 0;
+            m_shRegs.SetInvalid(packet.bitfields3.start_vtx_loc);
+            m_shRegs.SetInvalid(packet.bitfields4.start_inst_loc);
         }
         else if (opcode == IT_DRAW_INDIRECT_MULTI)
         {
             const auto& packet = reinterpret_cast<const PM4_PFP_DRAW_INDIRECT_MULTI&>(*pOrigCmdCur);
-            m_shRegs.state[packet.bitfields3.start_vtx_loc].flags.valid  = 0;
-            m_shRegs.state[packet.bitfields4.start_inst_loc].flags.valid = 0;
+            m_shRegs.SetInvalid(packet.bitfields3.start_vtx_loc);
+            m_shRegs.SetInvalid(packet.bitfields4.start_inst_loc);
             if (packet.bitfields5.draw_index_enable != 0)
             {
-                m_shRegs.state[packet.bitfields5.draw_index_loc].flags.valid = 0;
+                m_shRegs.SetInvalid(packet.bitfields5.draw_index_loc);
             }
         }
         else if (opcode == IT_DRAW_INDEX_INDIRECT)
         {
             const auto& packet = reinterpret_cast<const PM4_PFP_DRAW_INDEX_INDIRECT&>(*pOrigCmdCur);
-            m_shRegs.state[packet.bitfields3.base_vtx_loc].flags.valid   = 0;
-            m_shRegs.state[packet.bitfields4.start_inst_loc].flags.valid = 0;
+            m_shRegs.SetInvalid(packet.bitfields3.base_vtx_loc);
+            m_shRegs.SetInvalid(packet.bitfields4.start_inst_loc);
         }
         else if (opcode == IT_DRAW_INDEX_INDIRECT_MULTI)
         {
             const auto& packet = reinterpret_cast<const PM4_PFP_DRAW_INDEX_INDIRECT_MULTI&>(*pOrigCmdCur);
-            m_shRegs.state[packet.bitfields3.base_vtx_loc].flags.valid   = 0;
-            m_shRegs.state[packet.bitfields4.start_inst_loc].flags.valid = 0;
+            m_shRegs.SetInvalid(packet.bitfields3.base_vtx_loc);
+            m_shRegs.SetInvalid(packet.bitfields4.start_inst_loc);
             if (packet.bitfields5.draw_index_enable != 0)
             {
-                m_shRegs.state[packet.bitfields5.draw_index_loc].flags.valid = 0;
+                m_shRegs.SetInvalid(packet.bitfields5.draw_index_loc);
             }
         }
         else if (opcode == IT_INDIRECT_BUFFER)
@@ -378,7 +645,7 @@ bool Pm4Optimizer::OptimizePm4Commands(
             // This causes the current PM4 optimizer state to be out of sync after a nested command buffer
             // execute and can incorrectly optimize commands from the executing command buffer. We need to
             // invalidate the PM4 optimizer state if we detect a IT_INDIRECT_BUFFER packet in the stream.
-            Reset();
+            ResetToUnknownState();
         }
 
         if (optimized == false)
@@ -420,19 +687,24 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
     const uint32 regOffset = setData.bitfields2.reg_offset;
 
     // Determine which of the registers written by this set command can't be skipped because they must always be set or
-    // are taking on a new value.
+    // are taking on a new value. The registers are diffed against the shadow state 32 at a time.
     //
     // We assume that no more than 32 registers are being set. Currently the driver only sets more than 32 registers in
     // the viewport state object. Luckily, those registers are vector regisers so we can't optimize them anyway. If we
     // ever encounter a set command with more than 32 registers that has redundant values the assert below will trigger.
     uint32 keepRegCount = 0;
     uint32 keepRegMask  = 0;
-    for (uint32 i = 0; i < numRegs; i++)
+    for (uint32 i = 0; i < numRegs; i += 32)
     {
-        if (UpdateRegState(pRegData[i], (regOffset + i), pRegState))
+        const uint32 rangeMask = UpdateRegStateRange(pRegData + i,
+                                                     (regOffset + i),
+                                                     Min(numRegs - i, 32u),
+                                                     pRegState);
+        keepRegCount += CountSetBits(rangeMask);
+
+        if (i == 0)
         {
-            keepRegCount++;
-            keepRegMask |= 1 << i;
+            keepRegMask = rangeMask;
         }
     }
 
@@ -525,10 +797,7 @@ void Pm4Optimizer::HandlePm4LoadReg(
     {
         const uint32& startRegOffset = pRegisterGroup[0];
         const uint32  endRegOffset   = (startRegOffset + pRegisterGroup[1] - 1);
-        for (uint32 reg = startRegOffset; reg <= endRegOffset; ++reg)
-        {
-            pRegState->state[reg].flags.valid = 0;
-        }
+        InvalidateRegRange(startRegOffset, (endRegOffset - startRegOffset + 1), pRegState);
 
         pRegisterGroup += 2;
     }
@@ -554,10 +823,7 @@ void Pm4Optimizer::HandlePm4LoadRegIndex(
         const uint32 startRegOffset = *static_cast<const uint16*>(pRegisterGroup);
         const uint32 numRegs        = *static_cast<const uint32*>(VoidPtrInc(pRegisterGroup, sizeof(uint32)));
         const uint32 endRegOffset   = (startRegOffset + numRegs - 1);
-        for (uint32 reg = startRegOffset; reg <= endRegOffset; ++reg)
-        {
-            pRegState->state[reg].flags.valid = 0;
-        }
+        InvalidateRegRange(startRegOffset, (endRegOffset - startRegOffset + 1), pRegState);
 
         pRegisterGroup = VoidPtrInc(pRegisterGroup, sizeof(uint32) * 2);
     }
@@ -578,13 +844,13 @@ void Pm4Optimizer::HandlePm4SetShRegOffset(
     const PM4PFP_SET_SH_REG_OFFSET& setShRegOffset)
 {
     // Invalidate the register the packet is operating on.
-    m_shRegs.state[setShRegOffset.bitfields2.reg_offset].flags.valid = 0;
+    m_shRegs.SetInvalid(setShRegOffset.bitfields2.reg_offset);
 
     // If the index value is set to 0, this packet actually operates on two sequential SH registers so we need to
     // invalidate the following register as well.
     if (setShRegOffset.bitfields2.index == 0)
     {
-        m_shRegs.state[setShRegOffset.bitfields2.reg_offset + 1].flags.valid = 0;
+        m_shRegs.SetInvalid(setShRegOffset.bitfields2.reg_offset + 1);
     }
 }
 
@@ -597,10 +863,7 @@ void Pm4Optimizer::HandlePm4SetContextRegIndirect(
     const uint32 startRegOffset = static_cast<uint32>(setData.bitfields2.reg_offset);
     const uint32  endRegOffset  = (startRegOffset + (setData.header.count - 1));
 
-    for (uint32 reg = startRegOffset; reg <= endRegOffset; ++reg)
-    {
-        m_cntxRegs.state[reg].flags.valid = 0;
-    }
+    InvalidateRegRange(startRegOffset, (endRegOffset - startRegOffset + 1), &m_cntxRegs);
 }
 
 // =====================================================================================================================
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "core/hw/gfxip/gfx9/gfx9CmdUtil.h"
+#include "palVector.h"
 
 namespace Pal
 {
@@ -37,35 +38,67 @@ namespace Gfx9
 
 class Device;
 
-// Structure used during PM4 optimization to track the current value of a single register.
-struct RegState
-{
-    struct
-    {
-        uint32 valid     :  1;  // This register has been set in this stream, value is valid.
-        uint32 mustWrite :  1;  // All writes to this register must be preserved (can't optimize them out).
-        uint32 reserved  : 30;
-    } flags;
-
-    uint32 value;
-};
-
 // Structure used during PM4 optimization and instrumentation to track the current value of registers as well as the
 // number of times the register was written (via a SET packet) or ignored due to optimization.
+//
+// The register values and their flags are kept in separate arrays so that a whole sequential range of registers can be
+// compared against the shadow values with vector instructions and the flags can be queried for the same range with a
+// few bit operations. Each bitmask has one padding DWORD so that any 32-bit window of bits can be read or written
+// using a single 64-bit access.
 template <size_t RegisterCount>
 struct RegGroupState
 {
-    RegState  state[RegisterCount];     // State of each register in the group.
+    static constexpr size_t MaskDwords = ((RegisterCount + 31) / 32) + 1;
+
+    uint32    value[RegisterCount];       // Last value written to each register, meaningful only if it is valid.
+    uint32    validMask[MaskDwords];      // Set bits mark registers which were set in this stream; their values are
+                                          // valid.
+    uint32    mustWriteMask[MaskDwords];  // Set bits mark registers whose writes must all be preserved (can't optimize
+                                          // them out).
+    uint32    touchedMask[MaskDwords];    // Set bits mark registers which were set to unknown values in this stream.
+                                          // Together with validMask this covers every register the stream modified.
 #if PAL_BUILD_PM4_INSTRUMENTOR
-    uint32    totalSets[RegisterCount]; // Number of writes to each register using SET packets.
-    uint32    keptSets[RegisterCount];  // Number of writes to each register using SET packets which were not ignored
-                                        // due to PM4 optimization.
+    uint32    totalSets[RegisterCount];   // Number of writes to each register using SET packets.
+    uint32    keptSets[RegisterCount];    // Number of writes to each register using SET packets which were not
+                                          // ignored due to PM4 optimization.
 #endif
+
+    bool IsValid(uint32 regOffset) const     { return ((validMask[regOffset / 32] >> (regOffset % 32)) & 1) != 0; }
+    bool IsMustWrite(uint32 regOffset) const { return ((mustWriteMask[regOffset / 32] >> (regOffset % 32)) & 1) != 0; }
+
+    void SetInvalid(uint32 regOffset)
+    {
+        validMask[regOffset / 32]   &= ~(1u << (regOffset % 32));
+        touchedMask[regOffset / 32] |=  (1u << (regOffset % 32));
+    }
 };
 
 using ShRegState   = RegGroupState<ShRegUsedRangeSize>;
 using CntxRegState = RegGroupState<CntxRegUsedRangeSize>;
 
+// A register offset (relative to the start of its register space) and the value it holds.
+struct RegOffsetValue
+{
+    uint32 regOffset;
+    uint32 value;
+};
+
+using RegOffsetValueList = Util::Vector<RegOffsetValue, 64, Platform>;
+
+// Summary of the SH and context registers a nested command stream leaves behind once it has executed. It is exported
+// from the nested stream's optimizer when the stream ends and merged into the calling stream's optimizer after each
+// call so that the caller only needs to forget the registers the nested stream actually modified.
+struct NestedRegSummary
+{
+    explicit NestedRegSummary(Platform* pPlatform) : cntxValues(pPlatform), shValues(pPlatform), valid(false) { }
+
+    uint32             cntxModifiedMask[CntxRegState::MaskDwords]; // Context registers the nested stream modified.
+    uint32             shModifiedMask[ShRegState::MaskDwords];     // SH registers the nested stream modified.
+    RegOffsetValueList cntxValues; // Final values of the modified context registers whose values are known.
+    RegOffsetValueList shValues;   // Final values of the modified SH registers whose values are known.
+    bool               valid;      // If false, the caller must assume that every register was modified.
+};
+
 // =====================================================================================================================
 // Utility class which provides routines to optimize PM4 command streams. Currently it only optimizes SH register writes
 // and context register writes.
@@ -75,8 +108,13 @@ public:
     Pm4Optimizer(const Device& device);
 
     void Reset();
+    void ResetToUnknownState();
+
+    void SetShRegInvalid(uint32 regAddr) { m_shRegs.SetInvalid(regAddr - PERSISTENT_SPACE_START); }
+    void SetContextRegInvalid(uint32 regAddr) { m_cntxRegs.SetInvalid(regAddr - CONTEXT_SPACE_START); }
 
-    void SetShRegInvalid(uint32 regAddr) { m_shRegs.state[regAddr - PERSISTENT_SPACE_START].flags.valid = 0; }
+    Result ExportNestedSummary(NestedRegSummary* pSummary) const;
+    void   MergeNestedSummary(const NestedRegSummary& summary);
 
     bool MustKeepSetContextReg(uint32 regAddr, uint32 regData);
     bool MustKeepSetShReg(uint32 regAddr, uint32 regData);
@@ -130,6 +168,18 @@ private:
     template <typename LoadDataIndexPacket, size_t RegisterCount>
     void HandlePm4LoadRegIndex(const LoadDataIndexPacket& loadDataIndex, RegGroupState<RegisterCount>* pRegState);
 
+    template <size_t RegisterCount>
+    static Result ExportRegGroup(
+        const RegGroupState<RegisterCount>& regState,
+        uint32*                             pModifiedMask,
+        RegOffsetValueList*                 pValues);
+
+    template <size_t RegisterCount>
+    static bool MergeRegGroup(
+        const uint32*                 pModifiedMask,
+        const RegOffsetValueList&     values,
+        RegGroupState<RegisterCount>* pRegState);
+
     void HandlePm4SetShRegOffset(const PM4PFP_SET_SH_REG_OFFSET& setShRegOffset);
     void HandlePm4SetContextRegIndirect(const PM4_PFP_SET_CONTEXT_REG& setData);
 
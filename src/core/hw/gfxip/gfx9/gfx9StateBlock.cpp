@@ -0,0 +1,147 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/hw/gfxip/gfx9/gfx9CmdStream.h"
+#include "core/hw/gfxip/gfx9/gfx9ColorBlendState.h"
+#include "core/hw/gfxip/gfx9/gfx9DepthStencilState.h"
+#include "core/hw/gfxip/gfx9/gfx9MsaaState.h"
+#include "core/hw/gfxip/gfx9/gfx9StateBlock.h"
+
+using namespace Util;
+
+namespace Pal
+{
+namespace Gfx9
+{
+
+// =====================================================================================================================
+// Bakes the PM4 images of all of the state objects into the image which follows this object.  The caller must have
+// allocated Pm4ImgSize() bytes of memory immediately after the object.
+StateBlock::StateBlock(
+    const StateBlockCreateInfo& createInfo)
+    :
+    Pal::StateBlock(),
+    m_pMsaaState(static_cast<const MsaaState*>(createInfo.pMsaaState)),
+    m_pColorBlendState(static_cast<const ColorBlendState*>(createInfo.pColorBlendState)),
+    m_pDepthStencilState(static_cast<const DepthStencilState*>(createInfo.pDepthStencilState)),
+    m_pm4ImgSize(static_cast<uint32>(Pm4ImgSize(createInfo) / sizeof(uint32)))
+{
+    m_flags.u32All          = 0;
+    m_flags.hasViewports    = (createInfo.pViewports    != nullptr);
+    m_flags.hasScissorRects = (createInfo.pScissorRects != nullptr);
+
+    memset(&m_viewports,    0, sizeof(m_viewports));
+    memset(&m_scissorRects, 0, sizeof(m_scissorRects));
+
+    if (createInfo.pViewports != nullptr)
+    {
+        m_viewports = *createInfo.pViewports;
+    }
+
+    if (createInfo.pScissorRects != nullptr)
+    {
+        m_scissorRects = *createInfo.pScissorRects;
+    }
+
+    // Writing the state objects' commands with a null command stream just copies their PM4 images.
+    uint32*const pImage    = static_cast<uint32*>(VoidPtrInc(this, sizeof(*this)));
+    uint32*      pCmdSpace = pImage;
+
+    if (m_pMsaaState != nullptr)
+    {
+        pCmdSpace = m_pMsaaState->WriteCommands(nullptr, pCmdSpace);
+    }
+
+    if (m_pColorBlendState != nullptr)
+    {
+        pCmdSpace = m_pColorBlendState->WriteCommands(nullptr, pCmdSpace);
+    }
+
+    if (m_pDepthStencilState != nullptr)
+    {
+        pCmdSpace = m_pDepthStencilState->WriteCommands(nullptr, pCmdSpace);
+    }
+
+    PAL_ASSERT(pCmdSpace == (pImage + m_pm4ImgSize));
+}
+
+// =====================================================================================================================
+Result StateBlock::ValidateCreateInfo(
+    const StateBlockCreateInfo& createInfo)
+{
+    Result result = Result::Success;
+
+    if (((createInfo.pViewports    != nullptr) && (createInfo.pViewports->count    > MaxViewports)) ||
+        ((createInfo.pScissorRects != nullptr) && (createInfo.pScissorRects->count > MaxViewports)))
+    {
+        result = Result::ErrorInvalidValue;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Returns the size, in bytes, of the PM4 image which must follow a state block created with the given properties.
+size_t StateBlock::Pm4ImgSize(
+    const StateBlockCreateInfo& createInfo)
+{
+    size_t size = 0;
+
+    if (createInfo.pMsaaState != nullptr)
+    {
+        size += (static_cast<const MsaaState*>(createInfo.pMsaaState)->Pm4ImgSizeInDwords() * sizeof(uint32));
+    }
+
+    if (createInfo.pColorBlendState != nullptr)
+    {
+        size += ColorBlendState::Pm4ImgSize();
+    }
+
+    if (createInfo.pDepthStencilState != nullptr)
+    {
+        size += DepthStencilState::Pm4ImgSize();
+    }
+
+    return size;
+}
+
+// =====================================================================================================================
+// Writes the combined PM4 image of all of the state objects in this state block.  Returns the next unused DWORD in
+// pCmdSpace.
+uint32* StateBlock::WriteCommands(
+    CmdStream* pCmdStream,
+    uint32*    pCmdSpace
+    ) const
+{
+    if (m_pm4ImgSize > 0)
+    {
+        pCmdSpace = pCmdStream->WritePm4Image(m_pm4ImgSize, Pm4Image(), pCmdSpace);
+    }
+
+    return pCmdSpace;
+}
+
+} // Gfx9
+} // Pal
@@ -0,0 +1,98 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "core/hw/gfxip/stateBlock.h"
+#include "core/hw/gfxip/gfx9/gfx9Chip.h"
+
+namespace Pal
+{
+namespace Gfx9
+{
+
+class CmdStream;
+class ColorBlendState;
+class DepthStencilState;
+class MsaaState;
+
+// =====================================================================================================================
+// GFX9-specific state block implementation.  See IStateBlock documentation for more details.
+//
+// The PM4 images of the MSAA, color/blend and depth/stencil state objects are concatenated into a single image which
+// immediately follows this object in memory.  Viewports and scissor rectangles are copied by value because their
+// registers also depend on the bound pipeline and are therefore still written during draw-time validation.
+class StateBlock : public Pal::StateBlock
+{
+public:
+    explicit StateBlock(const StateBlockCreateInfo& createInfo);
+
+    static Result ValidateCreateInfo(const StateBlockCreateInfo& createInfo);
+    static size_t Pm4ImgSize(const StateBlockCreateInfo& createInfo);
+
+    uint32* WriteCommands(CmdStream* pCmdStream, uint32* pCmdSpace) const;
+
+    const MsaaState*         GetMsaaState() const         { return m_pMsaaState;         }
+    const ColorBlendState*   GetColorBlendState() const   { return m_pColorBlendState;   }
+    const DepthStencilState* GetDepthStencilState() const { return m_pDepthStencilState; }
+
+    const ViewportParams*    Viewports() const    { return (m_flags.hasViewports    != 0) ? &m_viewports    : nullptr; }
+    const ScissorRectParams* ScissorRects() const { return (m_flags.hasScissorRects != 0) ? &m_scissorRects : nullptr; }
+
+    // NOTE: Part of the IDestroyable public interface.
+    virtual void Destroy() override { this->~StateBlock(); }
+
+protected:
+    virtual ~StateBlock() {} // Destructor has nothing to do.
+
+private:
+    const uint32* Pm4Image() const { return static_cast<const uint32*>(Util::VoidPtrInc(this, sizeof(*this))); }
+
+    const MsaaState*const          m_pMsaaState;
+    const ColorBlendState*const    m_pColorBlendState;
+    const DepthStencilState*const  m_pDepthStencilState;
+
+    union
+    {
+        struct
+        {
+            uint32  hasViewports    :  1; // The viewports in m_viewports are valid.
+            uint32  hasScissorRects :  1; // The scissor rectangles in m_scissorRects are valid.
+            uint32  reserved        : 30;
+        };
+        uint32  u32All;
+    } m_flags;
+
+    ViewportParams     m_viewports;
+    ScissorRectParams  m_scissorRects;
+
+    uint32  m_pm4ImgSize; // Size of the PM4 image which follows this object, in DWORDs.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(StateBlock);
+    PAL_DISALLOW_DEFAULT_CTOR(StateBlock);
+};
+
+} // Gfx9
+} // Pal
@@ -36,13 +36,16 @@
 #include "core/hw/gfxip/gfx9/gfx9IndirectCmdGenerator.h"
 #include "core/hw/gfxip/gfx9/gfx9MsaaState.h"
 #include "core/hw/gfxip/gfx9/gfx9PerfExperiment.h"
+#include "core/hw/gfxip/gfx9/gfx9StateBlock.h"
 #include "core/hw/gfxip/gfx9/gfx9UniversalCmdBuffer.h"
 #include "core/hw/gfxip/queryPool.h"
 #include "core/g_palPlatformSettings.h"
 #include "core/settingsLoader.h"
 #include "marker_payload.h"
+#include "palAutoBuffer.h"
 #include "palMath.h"
 #include "palIntervalTreeImpl.h"
+#include "palSysUtil.h"
 #include "palVectorImpl.h"
 
 #include <float.h>
@@ -252,7 +255,8 @@ UniversalCmdBuffer::UniversalCmdBuffer(
     m_enabledPbb(false),
     m_customBinSizeX(0),
     m_customBinSizeY(0),
-    m_activeOcclusionQueryWriteRanges(m_device.GetPlatform())
+    m_activeOcclusionQueryWriteRanges(m_device.GetPlatform()),
+    m_segments(m_device.GetPlatform())
 {
     const PalPlatformSettings& platformSettings = m_device.Parent()->GetPlatform()->PlatformSettings();
     const PalSettings&         coreSettings     = m_device.Parent()->Settings();
@@ -269,6 +273,9 @@ UniversalCmdBuffer::UniversalCmdBuffer(
     memset(&m_drawTimeHwState, 0, sizeof(m_drawTimeHwState));
     memset(&m_nggState,        0, sizeof(m_nggState));
     memset(&m_currentBinSize,  0, sizeof(m_currentBinSize));
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    memset(&m_validationProfile, 0, sizeof(m_validationProfile));
+#endif
 
     memset(&m_pipelinePsHash, 0, sizeof(m_pipelinePsHash));
     m_pipelineFlags.u32All = 0;
@@ -633,6 +640,7 @@ void UniversalCmdBuffer::ResetState()
 
     // Reset the command buffer's per-draw state objects.
     memset(&m_drawTimeHwState, 0, sizeof(m_drawTimeHwState));
+    memset(&m_coalescedBarrierSyncs, 0, sizeof(m_coalescedBarrierSyncs));
 
     // The index buffer state starts out in the dirty state.
     m_drawTimeHwState.dirty.indexType       = 1;
@@ -678,6 +686,7 @@ void UniversalCmdBuffer::ResetState()
     m_vbTable.modified  = 0;
 
     m_activeOcclusionQueryWriteRanges.Clear();
+    m_segments.Clear();
 }
 
 // =====================================================================================================================
@@ -1088,6 +1097,56 @@ void UniversalCmdBuffer::CmdBindDepthStencilState(
     m_graphicsState.dirtyFlags.validationBits.depthStencilState = 1;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+// Binds all of the state in a pre-baked state block.  The register writes for all of its state objects are emitted as
+// a single PM4 image; the rest of the bookkeeping matches the individual CmdBind*() calls.
+void UniversalCmdBuffer::CmdBindStateBlock(
+    const IStateBlock* pStateBlock)
+{
+    PAL_ASSERT(pStateBlock != nullptr);
+
+    const StateBlock*const pNewState = static_cast<const StateBlock*>(pStateBlock);
+
+    uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
+    pDeCmdSpace = pNewState->WriteCommands(&m_deCmdStream, pDeCmdSpace);
+    m_deCmdStream.CommitCommands(pDeCmdSpace);
+
+    const MsaaState*const pMsaaState = pNewState->GetMsaaState();
+    if (pMsaaState != nullptr)
+    {
+        m_nggState.numSamples = pMsaaState->NumSamples();
+
+        m_graphicsState.pMsaaState                          = pMsaaState;
+        m_graphicsState.dirtyFlags.validationBits.msaaState = 1;
+        m_nggState.flags.dirty.msaaState                    = 1;
+    }
+
+    if (pNewState->GetColorBlendState() != nullptr)
+    {
+        m_graphicsState.pColorBlendState                          = pNewState->GetColorBlendState();
+        m_graphicsState.dirtyFlags.validationBits.colorBlendState = 1;
+    }
+
+    if (pNewState->GetDepthStencilState() != nullptr)
+    {
+        m_graphicsState.pDepthStencilState                          = pNewState->GetDepthStencilState();
+        m_graphicsState.dirtyFlags.validationBits.depthStencilState = 1;
+    }
+
+    // Viewport and scissor registers depend on the bound pipeline, so they're still written by draw-time validation.
+    if (pNewState->Viewports() != nullptr)
+    {
+        CmdSetViewports(*pNewState->Viewports());
+    }
+
+    if (pNewState->ScissorRects() != nullptr)
+    {
+        CmdSetScissorRects(*pNewState->ScissorRects());
+    }
+}
+#endif
+
 // =====================================================================================================================
 // updates setting blend consts and manages dirty state
 void UniversalCmdBuffer::CmdSetBlendConst(
@@ -1341,7 +1400,7 @@ void UniversalCmdBuffer::CmdBarrier(
     const uint32 packetPredicate = m_gfxCmdBufState.flags.packetPredicate;
     m_gfxCmdBufState.flags.packetPredicate = 0;
 
-    m_device.Barrier(this, &m_deCmdStream, barrierInfo);
+    m_device.Barrier(this, &m_deCmdStream, barrierInfo, &m_coalescedBarrierSyncs);
 
     m_gfxCmdBufState.flags.packetPredicate = packetPredicate;
 }
@@ -1575,6 +1634,12 @@ void UniversalCmdBuffer::CmdBindTargets(
             const auto* pImage        = pNewView->GetImage();
             auto*       pGfx10NewView = static_cast<const Gfx10ColorTargetView*>(pNewView);
 
+            if (pImage != nullptr)
+            {
+                // Rendering can change the image's metadata without any further barriers.
+                SubresStates()->InvalidateImage(pImage->Parent());
+            }
+
             if (IsGfx10(m_gfxIpLevel) && (pImage != nullptr))
             {
                 colorBigPage &= pGfx10NewView->IsColorBigPage();
@@ -1634,6 +1699,9 @@ void UniversalCmdBuffer::CmdBindTargets(
                                                    &m_deCmdStream,
                                                    pDeCmdSpace);
 
+        // Rendering can change the image's metadata without any further barriers.
+        SubresStates()->InvalidateImage(pNewDepthView->GetImage()->Parent());
+
         TargetExtent2d depthViewExtent = pNewDepthView->GetExtent();
         surfaceExtent.width  = Util::Min(surfaceExtent.width,  depthViewExtent.width);
         surfaceExtent.height = Util::Min(surfaceExtent.height, depthViewExtent.height);
@@ -2459,6 +2527,149 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexed(
     pThis->m_deCmdStream.CommitCommands(pDeCmdSpace);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+// Issues a batch of draws which share all graphics state except for some user-data entries.
+void UniversalCmdBuffer::CmdDrawBatch(
+    const DrawBatchInfo& batchInfo)
+{
+    PAL_ASSERT((batchInfo.drawCount == 0) || (batchInfo.pDraws != nullptr));
+
+    // The batched path only writes the plain draw packets.  Anything which needs extra per-draw work (thread trace
+    // markers, draw descriptions, UAV export flushes, view instancing or NGG fast launch) has switched the draw
+    // functions to another specialization, in which case the draws are issued one at a time instead.
+    const bool indexed        = (batchInfo.flags.indexed != 0);
+    const bool useBatchedPath =
+        indexed ? (m_funcTable.pfnCmdDrawIndexed == CmdDrawIndexed<false, false, false, false, false>)
+                : (m_funcTable.pfnCmdDraw        == CmdDraw<false, false, false, false>);
+
+    if (useBatchedPath == false)
+    {
+        Pal::UniversalCmdBuffer::CmdDrawBatch(batchInfo);
+    }
+    else if (m_deCmdStream.Pm4ImmediateOptimizerEnabled())
+    {
+        if (indexed)
+        {
+            CmdDrawBatch<true, true>(batchInfo);
+        }
+        else
+        {
+            CmdDrawBatch<false, true>(batchInfo);
+        }
+    }
+    else
+    {
+        if (indexed)
+        {
+            CmdDrawBatch<true, false>(batchInfo);
+        }
+        else
+        {
+            CmdDrawBatch<false, false>(batchInfo);
+        }
+    }
+}
+#endif
+
+// =====================================================================================================================
+// Issues a batch of draws.  All of the bound state is validated for the first draw.  Since nothing but user-data can
+// change between the draws of a batch, every later draw only validates its own user-data updates and the per-draw
+// hardware state (vertex and instance offsets, instance count) before its draw packet is written.
+template <bool Indexed, bool Pm4OptImmediate>
+void UniversalCmdBuffer::CmdDrawBatch(
+    const DrawBatchInfo& batchInfo)
+{
+    const CmdSetUserDataFunc pfnSetUserData =
+        m_funcTable.pfnCmdSetUserData[static_cast<uint32>(PipelineBindPoint::Graphics)];
+
+    for (uint32 i = 0; i < batchInfo.drawCount; ++i)
+    {
+        const DrawBatchEntry& draw = batchInfo.pDraws[i];
+
+        if (draw.userDataEntryCount != 0)
+        {
+            pfnSetUserData(this, draw.firstUserDataEntry, draw.userDataEntryCount, draw.pUserDataEntries);
+        }
+
+        uint32 firstIndex = 0;
+        if (Indexed)
+        {
+            // See CmdDrawIndexed() for why the first index is clamped.
+            firstIndex = draw.first;
+            m_workaroundState.HandleFirstIndexSmallerThanIndexCount(&firstIndex, m_graphicsState.iaState.indexCount);
+
+            PAL_ASSERT(firstIndex <= m_graphicsState.iaState.indexCount);
+        }
+
+        ValidateDrawInfo drawInfo;
+        drawInfo.vtxIdxCount   = draw.count;
+        drawInfo.instanceCount = draw.instanceCount;
+        drawInfo.firstVertex   = Indexed ? draw.vertexOffset : draw.first;
+        drawInfo.firstInstance = draw.firstInstance;
+        drawInfo.firstIndex    = firstIndex;
+        drawInfo.useOpaque     = false;
+
+        if (i == 0)
+        {
+            ValidateDraw<Indexed, false, Pm4OptImmediate>(drawInfo);
+        }
+        else
+        {
+            PAL_ASSERT((m_graphicsState.pipelineState.dirtyFlags.pipelineDirty == 0) &&
+                       (m_graphicsState.dirtyFlags.validationBits.u16All == 0));
+
+            uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
+
+            pDeCmdSpace = (this->*m_pfnValidateUserDataGfx)(nullptr, pDeCmdSpace);
+            pDeCmdSpace = ValidateDraw<Indexed, false, Pm4OptImmediate, false, false>(drawInfo, pDeCmdSpace);
+
+            m_deCmdStream.CommitCommands(pDeCmdSpace);
+        }
+
+        uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
+
+        pDeCmdSpace = WaitOnCeCounter(pDeCmdSpace);
+
+        if (Indexed == false)
+        {
+            pDeCmdSpace += CmdUtil::BuildDrawIndexAuto(draw.count, false, PacketPredicate(), pDeCmdSpace);
+        }
+        else if (IsNested() && (m_graphicsState.iaState.indexAddr == 0))
+        {
+            // If IB state is not bound, nested command buffers must use DRAW_INDEX_OFFSET_2 so that we can inherit
+            // the IB base and size from direct command buffer
+            pDeCmdSpace += CmdUtil::BuildDrawIndexOffset2(draw.count,
+                                                          (m_graphicsState.iaState.indexCount - firstIndex),
+                                                          firstIndex,
+                                                          PacketPredicate(),
+                                                          pDeCmdSpace);
+        }
+        else
+        {
+            // DRAW_INDEX_2 doesn't take an offset param, so the index offset is added into the IB address.
+            const uint32  indexSize   = (1 << static_cast<uint32>(m_graphicsState.iaState.indexType));
+            const gpusize gpuVirtAddr = (m_graphicsState.iaState.indexAddr + (indexSize * firstIndex));
+
+            pDeCmdSpace += CmdUtil::BuildDrawIndex2(draw.count,
+                                                    (m_graphicsState.iaState.indexCount - firstIndex),
+                                                    gpuVirtAddr,
+                                                    PacketPredicate(),
+                                                    pDeCmdSpace);
+        }
+
+        pDeCmdSpace = IncrementDeCounter(pDeCmdSpace);
+
+        m_deCmdStream.CommitCommands(pDeCmdSpace);
+    }
+
+    if (Indexed == false)
+    {
+        // See CmdDraw() for why the index type must be re-written before the next indexed draw.
+        m_drawTimeHwState.dirty.indexedIndexType = 1;
+    }
+}
+
 // =====================================================================================================================
 // Issues an indirect non-indexed draw command. We must discard the draw if vertexCount or instanceCount are zero.
 // We will rely on the HW to discard the draw for us.
@@ -3444,7 +3655,6 @@ Result UniversalCmdBuffer::AddPreamble()
 // Adds a postamble to the end of a new command buffer.
 Result UniversalCmdBuffer::AddPostamble()
 {
-
     uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
     if (m_gfxCmdBufState.flags.cpBltActive)
@@ -3908,18 +4118,18 @@ void UniversalCmdBuffer::FixupSpillTableOnPipelineSwitch(
         // previous spill threshold.
         const uint16 firstEntry0 = currSpillThreshold;
         const uint16 entryLimit0 = Min(prevSpillThreshold, currUserDataLimit);
-        for (uint16 e = firstEntry0; e < entryLimit0; ++e)
+        if (firstEntry0 < entryLimit0)
         {
-            WideBitfieldSetBit(pEntries->dirty, e);
+            WideBitfieldSetRange(pEntries->dirty, firstEntry0, (entryLimit0 - firstEntry0));
         }
 
         // This second loop will handle cases #4 and #5 above, as well as the part of case #3 which falls beyond the
         // previous user-data limit.
         const uint16 firstEntry1 = Max(prevUserDataLimit, currSpillThreshold);
         const uint16 entryLimit1 = currUserDataLimit;
-        for (uint16 e = firstEntry1; e < entryLimit1; ++e)
+        if (firstEntry1 < entryLimit1)
         {
-            WideBitfieldSetBit(pEntries->dirty, e);
+            WideBitfieldSetRange(pEntries->dirty, firstEntry1, (entryLimit1 - firstEntry1));
         }
     } // if the spilled region is expanding
 }
@@ -3942,33 +4152,20 @@ uint32* UniversalCmdBuffer::WriteDirtyUserDataEntriesToCeRam(
     const uint16 spillThreshold = pCurrSignature->spillThreshold;
     const uint16 userDataLimit  = pCurrSignature->userDataLimit;
 
-    uint16 lastEntry = 0;
-    uint16 count     = 0;
-    for (uint16 e = spillThreshold; e < userDataLimit; ++e)
+    // Each run of consecutive dirty entries in the spilled region is uploaded with a single packet.
+    uint32 firstEntry = 0;
+    uint32 count      = 0;
+    for (uint32 e = spillThreshold; WideBitfieldScanRun(entries.dirty, e, userDataLimit, &firstEntry, &count); )
     {
-        while ((e < userDataLimit) && WideBitfieldIsSet(entries.dirty, e))
-        {
-            PAL_ASSERT((lastEntry == 0) || (lastEntry == (e - 1)));
-            lastEntry = e;
-            ++count;
-            ++e;
-        }
+        pCeCmdSpace = UploadToUserDataTable(pSpillTable,
+                                            firstEntry,
+                                            count,
+                                            &entries.entries[firstEntry],
+                                            userDataLimit,
+                                            pCeCmdSpace);
 
-        if (count > 0)
-        {
-            const uint16 firstEntry = (lastEntry - count + 1);
-            pCeCmdSpace = UploadToUserDataTable(pSpillTable,
-                                                firstEntry,
-                                                count,
-                                                &entries.entries[firstEntry],
-                                                userDataLimit,
-                                                pCeCmdSpace);
-
-            // Reset accumulators for the next packet.
-            lastEntry = 0;
-            count     = 0;
-        }
-    } // for each entry
+        e = (firstEntry + count);
+    } // for each run of dirty entries
 
     // NOTE: Both spill tables share the same ring buffer, so when one gets updated, the other must also. This is
     // because there may be a large series of Dispatches between Draws (or vice-versa), so if the buffer wraps, it
@@ -4038,34 +4235,30 @@ uint32* UniversalCmdBuffer::WriteDirtyUserDataEntriesToUserSgprsCs(
     // us get away with only checking the first sub-mask of the user-data entries' wide-bitfield of dirty flags.
     static_assert(MaxFastUserDataEntriesCompute <= UserDataEntriesPerMask,
                   "The CS user-data entries mapped to user-SGPR's spans multiple wide-bitfield elements!");
-    constexpr uint32 AllFastUserDataEntriesMask = ((1 << MaxFastUserDataEntriesCompute) - 1);
-    uint16 userSgprDirtyMask = (m_computeState.csUserDataEntries.dirty[0] & AllFastUserDataEntriesMask);
 
     // Additionally, dirty compute user-data is always written to user-SGPR's if it could be mapped by a pipeline,
     // which lets us avoid any complex logic when switching pipelines.
     const uint16 baseUserSgpr = m_device.GetFirstUserDataReg(HwShaderStage::Cs);
 
-    for (uint16 e = 0; e < MaxFastUserDataEntriesCompute; ++e)
-    {
-        const uint16 firstEntry = e;
-        uint16       entryCount = 0;
-
-        while ((e < MaxFastUserDataEntriesCompute) && ((userSgprDirtyMask & (1 << e)) != 0))
-        {
-            ++entryCount;
-            ++e;
-        }
+    // Each run of consecutive dirty entries is written with a single packet.
+    uint32 firstEntry = 0;
+    uint32 entryCount = 0;
+    uint32 nextEntry  = 0;
+    while (WideBitfieldScanRun(m_computeState.csUserDataEntries.dirty,
+                               nextEntry,
+                               MaxFastUserDataEntriesCompute,
+                               &firstEntry,
+                               &entryCount))
+    {
+        const uint32 lastEntry = (firstEntry + entryCount - 1);
+        pDeCmdSpace = m_deCmdStream.WriteSetSeqShRegs((baseUserSgpr + firstEntry),
+                                                      (baseUserSgpr + lastEntry),
+                                                      ShaderCompute,
+                                                      &m_computeState.csUserDataEntries.entries[firstEntry],
+                                                      pDeCmdSpace);
 
-        if (entryCount > 0)
-        {
-            const uint16 lastEntry = (firstEntry + entryCount - 1);
-            pDeCmdSpace = m_deCmdStream.WriteSetSeqShRegs((baseUserSgpr + firstEntry),
-                                                          (baseUserSgpr + lastEntry),
-                                                          ShaderCompute,
-                                                          &m_computeState.csUserDataEntries.entries[firstEntry],
-                                                          pDeCmdSpace);
-        }
-    } // for each entry
+        nextEntry = (firstEntry + entryCount);
+    } // for each run of dirty entries
 
     return pDeCmdSpace;
 }
@@ -4428,18 +4621,18 @@ uint32* UniversalCmdBuffer::ValidateGraphicsUserDataCpu(
             const uint32 lastMaskId  = (lastUserData   / UserDataEntriesPerMask);
             for (uint32 maskId = firstMaskId; maskId <= lastMaskId; ++maskId)
             {
-                uint16 dirtyMask = m_graphicsState.gfxUserDataEntries.dirty[maskId];
+                uint64 dirtyMask = m_graphicsState.gfxUserDataEntries.dirty[maskId];
                 if (maskId == firstMaskId)
                 {
                     // Ignore the dirty bits for any entries below the spill threshold.
                     const uint16 firstEntryInMask = (spillThreshold & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= ~((1 << firstEntryInMask) - 1);
+                    dirtyMask &= ~((1ull << firstEntryInMask) - 1);
                 }
                 if (maskId == lastMaskId)
                 {
                     // Ignore the dirty bits for any entries beyond the user-data limit.
                     const uint16 lastEntryInMask = (lastUserData & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= ((1 << (lastEntryInMask + 1)) - 1);
+                    dirtyMask &= (UINT64_MAX >> ((UserDataEntriesPerMask - 1) - lastEntryInMask));
                 }
 
                 if (dirtyMask != 0)
@@ -4454,10 +4647,10 @@ uint32* UniversalCmdBuffer::ValidateGraphicsUserDataCpu(
         // Re-upload spill table contents if necessary, and write the new GPU virtual address to the user-SGPR(s).
         if (reUpload)
         {
-            UpdateUserDataTableCpu(&m_spillTable.stateGfx,
-                                   (userDataLimit - spillThreshold),
-                                   spillThreshold,
-                                   &m_graphicsState.gfxUserDataEntries.entries[0]);
+            UpdateSpillTableCpu(&m_spillTable.stateGfx,
+                                (userDataLimit - spillThreshold),
+                                spillThreshold,
+                                &m_graphicsState.gfxUserDataEntries.entries[0]);
         }
 
         // NOTE: If the pipeline is changing, we may need to re-write the spill table address to any shader stage, even
@@ -4596,18 +4789,18 @@ uint32* UniversalCmdBuffer::ValidateComputeUserDataCpu(
             const uint32 lastMaskId  = (lastUserData   / UserDataEntriesPerMask);
             for (uint32 maskId = firstMaskId; maskId <= lastMaskId; ++maskId)
             {
-                uint16 dirtyMask = m_computeState.csUserDataEntries.dirty[maskId];
+                uint64 dirtyMask = m_computeState.csUserDataEntries.dirty[maskId];
                 if (maskId == firstMaskId)
                 {
                     // Ignore the dirty bits for any entries below the spill threshold.
                     const uint16 firstEntryInMask = (spillThreshold & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= ~((1 << firstEntryInMask) - 1);
+                    dirtyMask &= ~((1ull << firstEntryInMask) - 1);
                 }
                 if (maskId == lastMaskId)
                 {
                     // Ignore the dirty bits for any entries beyond the user-data limit.
                     const uint16 lastEntryInMask = (lastUserData & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= ((1 << (lastEntryInMask + 1)) - 1);
+                    dirtyMask &= (UINT64_MAX >> ((UserDataEntriesPerMask - 1) - lastEntryInMask));
                 }
 
                 if (dirtyMask != 0)
@@ -4622,10 +4815,10 @@ uint32* UniversalCmdBuffer::ValidateComputeUserDataCpu(
         // Re-upload spill table contents if necessary, and write the new GPU virtual address to the user-SGPR.
         if (reUpload)
         {
-            UpdateUserDataTableCpu(&m_spillTable.stateCs,
-                                   (userDataLimit - spillThreshold),
-                                   spillThreshold,
-                                   &m_computeState.csUserDataEntries.entries[0]);
+            UpdateSpillTableCpu(&m_spillTable.stateCs,
+                                (userDataLimit - spillThreshold),
+                                spillThreshold,
+                                &m_computeState.csUserDataEntries.entries[0]);
 
             pDeCmdSpace = m_deCmdStream.WriteSetOneShReg<ShaderCompute>(m_pSignatureCs->stage.spillTableRegAddr,
                                                                         LowPart(m_spillTable.stateCs.gpuVirtAddr),
@@ -4671,10 +4864,22 @@ void UniversalCmdBuffer::ValidateDraw(
     uint32 userDataCmdLen = 0;
 #endif
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    memset(&m_validationProfile, 0, sizeof(m_validationProfile));
+
+    int64         stageStartTime      = 0;
+    const uint32* pStageStartCmdSpace = nullptr;
+#endif
+
     if (m_graphicsState.pipelineState.dirtyFlags.pipelineDirty)
     {
         uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        stageStartTime      = GetPerfCpuTime();
+        pStageStartCmdSpace = pDeCmdSpace;
+#endif
+
         const auto*const pNewPipeline = static_cast<const GraphicsPipeline*>(m_graphicsState.pipelineState.pPipeline);
 
         pDeCmdSpace = pNewPipeline->WriteShCommands(&m_deCmdStream, pDeCmdSpace, m_graphicsState.dynamicGraphicsInfo);
@@ -4689,6 +4894,10 @@ void UniversalCmdBuffer::ValidateDraw(
 
         pDeCmdSpace = SwitchGraphicsPipeline(pPrevSignature, pNewPipeline, pDeCmdSpace);
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        EndValidationStage(Developer::DrawValidationStage::Pipeline, stageStartTime, pStageStartCmdSpace, pDeCmdSpace);
+#endif
+
         // NOTE: Switching a graphics pipeline can result in a large amount of commands being written, so start a new
         // reserve/commit region before proceeding with validation.
         m_deCmdStream.CommitCommands(pDeCmdSpace);
@@ -4703,8 +4912,17 @@ void UniversalCmdBuffer::ValidateDraw(
 
         pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        stageStartTime      = GetPerfCpuTime();
+        pStageStartCmdSpace = pDeCmdSpace;
+#endif
+
         pDeCmdSpace = (this->*m_pfnValidateUserDataGfxPipelineSwitch)(pPrevSignature, pDeCmdSpace);
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        EndValidationStage(Developer::DrawValidationStage::UserData, stageStartTime, pStageStartCmdSpace, pDeCmdSpace);
+#endif
+
 #if PAL_BUILD_PM4_INSTRUMENTOR
         if (m_cachedSettings.enablePm4Instrumentation != 0)
         {
@@ -4717,16 +4935,34 @@ void UniversalCmdBuffer::ValidateDraw(
         }
 #endif
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        stageStartTime      = GetPerfCpuTime();
+        pStageStartCmdSpace = pDeCmdSpace;
+#endif
+
         pDeCmdSpace = ValidateDraw<Indexed, Indirect, Pm4OptImmediate, true>(drawInfo, pDeCmdSpace);
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        EndValidationStage(Developer::DrawValidationStage::Other, stageStartTime, pStageStartCmdSpace, pDeCmdSpace);
+#endif
+
         m_deCmdStream.CommitCommands(pDeCmdSpace);
     }
     else
     {
         uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        stageStartTime      = GetPerfCpuTime();
+        pStageStartCmdSpace = pDeCmdSpace;
+#endif
+
         pDeCmdSpace = (this->*m_pfnValidateUserDataGfx)(nullptr, pDeCmdSpace);
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        EndValidationStage(Developer::DrawValidationStage::UserData, stageStartTime, pStageStartCmdSpace, pDeCmdSpace);
+#endif
+
 #if PAL_BUILD_PM4_INSTRUMENTOR
         if (m_cachedSettings.enablePm4Instrumentation != 0)
         {
@@ -4739,20 +4975,71 @@ void UniversalCmdBuffer::ValidateDraw(
         }
 #endif
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        stageStartTime      = GetPerfCpuTime();
+        pStageStartCmdSpace = pDeCmdSpace;
+#endif
+
         pDeCmdSpace = ValidateDraw<Indexed, Indirect, Pm4OptImmediate, false>(drawInfo, pDeCmdSpace);
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        EndValidationStage(Developer::DrawValidationStage::Other, stageStartTime, pStageStartCmdSpace, pDeCmdSpace);
+#endif
+
         m_deCmdStream.CommitCommands(pDeCmdSpace);
     }
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    // The "other" stage was timed around the whole inner ValidateDraw(), which includes the stages profiled inside it.
+    constexpr Developer::DrawValidationStage NestedStages[] =
+    {
+        Developer::DrawValidationStage::Viewports,
+        Developer::DrawValidationStage::ScissorRects,
+        Developer::DrawValidationStage::DrawTimeHwState,
+    };
+
+    constexpr uint32 Other = static_cast<uint32>(Developer::DrawValidationStage::Other);
+
+    for (uint32 idx = 0; idx < ArrayLen(NestedStages); ++idx)
+    {
+        const uint32 stage = static_cast<uint32>(NestedStages[idx]);
+
+        m_validationProfile.stageTicks[Other]   -= m_validationProfile.stageTicks[stage];
+        m_validationProfile.stageCmdSize[Other] -= m_validationProfile.stageCmdSize[stage];
+    }
+#endif
+
 #if PAL_BUILD_PM4_INSTRUMENTOR
     if (m_cachedSettings.enablePm4Instrumentation != 0)
     {
         const uint32 miscCmdLen = (GetUsedSize(CommandDataAlloc) - startingCmdLen);
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        m_device.DescribeDrawDispatchValidation(this, userDataCmdLen, pipelineCmdLen, miscCmdLen, m_validationProfile);
+#else
         m_device.DescribeDrawDispatchValidation(this, userDataCmdLen, pipelineCmdLen, miscCmdLen);
+#endif
     }
 #endif
 }
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+// =====================================================================================================================
+// Charges the CPU time since startTime and the DE command space written between the two pointers to one stage of the
+// current draw's validation profile. Both pointers must belong to the same Reserve/Commit region.
+void UniversalCmdBuffer::EndValidationStage(
+    Developer::DrawValidationStage stage,
+    int64                          startTime,
+    const uint32*                  pStartCmdSpace,
+    const uint32*                  pEndCmdSpace)
+{
+    const uint32 idx = static_cast<uint32>(stage);
+
+    m_validationProfile.stageCalls[idx]++;
+    m_validationProfile.stageTicks[idx]   += (GetPerfCpuTime() - startTime);
+    m_validationProfile.stageCmdSize[idx] += static_cast<uint32>(VoidPtrDiff(pEndCmdSpace, pStartCmdSpace));
+}
+#endif
+
 // =====================================================================================================================
 // Performs draw-time dirty state validation. Returns the next unused DWORD in pDeCmdSpace.  Wrapper to determine
 // if any interesting state is dirty before calling the real ValidateDraw() function.
@@ -5064,6 +5351,16 @@ uint32* UniversalCmdBuffer::ValidateDraw(
     // If we're about to launch a draw we better have a pipeline bound.
     PAL_ASSERT(pPipeline != nullptr);
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    m_validationProfile.specialization = ((Indexed         ? Developer::DrawValidationIndexed         : 0) |
+                                          (Indirect        ? Developer::DrawValidationIndirect        : 0) |
+                                          (Pm4OptImmediate ? Developer::DrawValidationPm4OptImmediate : 0) |
+                                          (PipelineDirty   ? Developer::DrawValidationPipelineDirty   : 0) |
+                                          (StateDirty      ? Developer::DrawValidationStateDirty      : 0) |
+                                          (IsNgg           ? Developer::DrawValidationNgg             : 0) |
+                                          (IsNggFastLaunch ? Developer::DrawValidationNggFastLaunch   : 0));
+#endif
+
     // All of our dirty state will leak to the caller.
     m_graphicsState.leakFlags.u32All |= m_graphicsState.dirtyFlags.u32All;
     if (Indexed                                                 &&
@@ -5122,7 +5419,16 @@ uint32* UniversalCmdBuffer::ValidateDraw(
     // viewport/scissor-rect state and the active pipeline.
     if (StateDirty && dirtyFlags.viewports)
     {
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        const int64   stageStartTime      = GetPerfCpuTime();
+        const uint32* pStageStartCmdSpace = pDeCmdSpace;
+#endif
+
         pDeCmdSpace = ValidateViewports<Pm4OptImmediate>(pDeCmdSpace);
+
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        EndValidationStage(Developer::DrawValidationStage::Viewports, stageStartTime, pStageStartCmdSpace, pDeCmdSpace);
+#endif
     }
 
     regPA_SC_MODE_CNTL_1 paScModeCntl1 = m_drawTimeHwState.paScModeCntl1;
@@ -5375,6 +5681,11 @@ uint32* UniversalCmdBuffer::ValidateDraw(
                                                                            pDeCmdSpace);
     }
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    const int64   hwStateStartTime      = GetPerfCpuTime();
+    const uint32* pHwStateStartCmdSpace = pDeCmdSpace;
+#endif
+
     // Validate the per-draw HW state.
     pDeCmdSpace = ValidateDrawTimeHwState<Indexed,
                                           Indirect,
@@ -5385,6 +5696,13 @@ uint32* UniversalCmdBuffer::ValidateDraw(
                                                            drawInfo,
                                                            pDeCmdSpace);
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    EndValidationStage(Developer::DrawValidationStage::DrawTimeHwState,
+                       hwStateStartTime,
+                       pHwStateStartCmdSpace,
+                       pDeCmdSpace);
+#endif
+
     pDeCmdSpace = m_workaroundState.PreDraw<Indirect, StateDirty, Pm4OptImmediate>(m_graphicsState,
                                                                                    &m_deCmdStream,
                                                                                    this,
@@ -6351,6 +6669,11 @@ uint32* UniversalCmdBuffer::ValidateScissorRects(
 uint32* UniversalCmdBuffer::ValidateScissorRects(
     uint32* pDeCmdSpace)
 {
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    const int64   stageStartTime      = GetPerfCpuTime();
+    const uint32* pStageStartCmdSpace = pDeCmdSpace;
+#endif
+
     if (m_deCmdStream.Pm4ImmediateOptimizerEnabled())
     {
         pDeCmdSpace = ValidateScissorRects<true>(pDeCmdSpace);
@@ -6360,6 +6683,10 @@ uint32* UniversalCmdBuffer::ValidateScissorRects(
         pDeCmdSpace = ValidateScissorRects<false>(pDeCmdSpace);
     }
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    EndValidationStage(Developer::DrawValidationStage::ScissorRects, stageStartTime, pStageStartCmdSpace, pDeCmdSpace);
+#endif
+
     return pDeCmdSpace;
 }
 
@@ -8247,10 +8574,156 @@ void UniversalCmdBuffer::LeakNestedCmdBufferState(
     m_gfxCmdBufState.flags.cpWriteCachesDirty        = cmdBuffer.m_gfxCmdBufState.flags.cpWriteCachesDirty;
     m_gfxCmdBufState.flags.cpMemoryWriteL2CacheStale = cmdBuffer.m_gfxCmdBufState.flags.cpMemoryWriteL2CacheStale;
 
-    // Invalidate PM4 optimizer state on post-execute since the current command buffer state does not reflect
-    // state changes from the nested command buffer. We will need to resolve the nested PM4 state onto the
-    // current command buffer for this to work correctly.
-    m_deCmdStream.NotifyNestedCmdBufferExecute();
+    // The current PM4 optimizer state does not reflect state changes from the nested command buffer. Resolve the
+    // registers the nested command buffer left behind onto our PM4 optimizer state.
+    m_deCmdStream.NotifyNestedCmdBufferExecute(cmdBuffer.m_deCmdStream);
+}
+
+// =====================================================================================================================
+// Segments are recorded concurrently from this command buffer's state at the time they began, so we can't know which
+// state they leave behind. This forgets everything we know about the hardware state and re-issues all of our bound
+// state, making the commands which follow the segments behave as if the segments never touched any state.
+void UniversalCmdBuffer::RestoreStateAfterSegments()
+{
+    LinearAllocatorAuto<VirtualLinearAllocator> allocator(Allocator(), false);
+    GraphicsState* pState = PAL_NEW(GraphicsState, &allocator, AllocInternalTemp);
+
+    if (pState == nullptr)
+    {
+        NotifyAllocFailure();
+    }
+    else
+    {
+        // Some of the calls below write back into the graphics state so they must read from a copy.
+        *pState = m_graphicsState;
+
+        if (m_graphicsState.inheritedState.stateFlags.targetViewState == 0)
+        {
+            CmdBindTargets(pState->bindTargets);
+        }
+
+        if (HasStreamOutBeenSet())
+        {
+            CmdBindStreamOutTargets(pState->bindStreamOutTargets);
+        }
+
+        CmdSetInputAssemblyState(pState->inputAssemblyState);
+        CmdBindColorBlendState(pState->pColorBlendState);
+        CmdSetBlendConst(pState->blendConstState);
+
+        // Setting StencilRefMaskState flags to 0xFF so that the faster command is used instead of read-modify-write
+        StencilRefMaskParams stencilRefMaskState = pState->stencilRefMaskState;
+        stencilRefMaskState.flags.u8All = 0xFF;
+        CmdSetStencilRefMasks(stencilRefMaskState);
+
+        CmdBindDepthStencilState(pState->pDepthStencilState);
+        CmdSetDepthBounds(pState->depthBoundsState);
+        CmdBindMsaaState(pState->pMsaaState);
+        CmdSetLineStippleState(pState->lineStippleState);
+
+        // numSamplesPerPixel can be 0 if the client never called CmdSetMsaaQuadSamplePattern.
+        if (pState->numSamplesPerPixel != 0)
+        {
+            CmdSetMsaaQuadSamplePattern(pState->numSamplesPerPixel, pState->quadSamplePatternState);
+        }
+
+        CmdSetTriangleRasterState(pState->triangleRasterState);
+        CmdSetPointLineRasterState(pState->pointLineRasterState);
+        CmdSetDepthBiasState(pState->depthBiasState);
+        CmdSetViewports(pState->viewportState);
+        CmdSetScissorRects(pState->scissorRectState);
+        CmdSetGlobalScissor(pState->globalScissorState);
+        CmdSetClipRects(pState->clipRectsState.clipRule,
+                        pState->clipRectsState.rectCount,
+                        pState->clipRectsState.rectList);
+
+        PAL_SAFE_DELETE(pState, &allocator);
+    }
+
+    if (m_graphicsState.pipelineState.pBorderColorPalette != nullptr)
+    {
+        CmdBindBorderColorPalette(PipelineBindPoint::Graphics, m_graphicsState.pipelineState.pBorderColorPalette);
+    }
+
+    if (m_computeState.pipelineState.pBorderColorPalette != nullptr)
+    {
+        CmdBindBorderColorPalette(PipelineBindPoint::Compute, m_computeState.pipelineState.pBorderColorPalette);
+    }
+
+    // Rebind both pipelines from scratch at the next draw and dispatch, as if this was the first one.
+    m_graphicsState.pipelineState.dirtyFlags.pipelineDirty = (m_graphicsState.pipelineState.pPipeline != nullptr);
+    m_computeState.pipelineState.dirtyFlags.pipelineDirty  = (m_computeState.pipelineState.pPipeline != nullptr);
+
+    m_pSignatureCs          = &NullCsSignature;
+    m_pSignatureGfx         = &NullGfxSignature;
+    m_pipelineCtxPm4Hash    = 0;
+    m_pipelinePsHash        = {};
+    m_spiVsOutConfig.u32All = 0;
+    m_spiPsInControl.u32All = 0;
+    m_binningMode           = FORCE_BINNING_ON; // set a value that we would never use
+
+    m_state.flags.paScAaConfigUpdated = 0;
+
+    // Every user-data entry must be written again; the segments share our CE RAM so the tables must be rebuilt too.
+    for (uint32 i = 0; i < NumUserDataFlagsParts; ++i)
+    {
+        m_graphicsState.gfxUserDataEntries.dirty[i] |= m_graphicsState.gfxUserDataEntries.touched[i];
+        m_computeState.csUserDataEntries.dirty[i]   |= m_computeState.csUserDataEntries.touched[i];
+    }
+
+    m_spillTable.stateCs.dirty   = 1;
+    m_spillTable.stateGfx.dirty  = 1;
+    m_uavExportTable.state.dirty = 1;
+
+    if (m_vbTable.modified != 0)
+    {
+        if (UseCpuPathInsteadOfCeRam() == false)
+        {
+            uint32* pCeCmdSpace = m_ceCmdStream.ReserveCommands();
+            pCeCmdSpace = UploadToUserDataTable(&m_vbTable.state,
+                                                0,
+                                                m_vbTable.state.sizeInDwords,
+                                                reinterpret_cast<uint32*>(m_vbTable.pSrds),
+                                                m_vbTable.watermark,
+                                                pCeCmdSpace);
+            m_ceCmdStream.CommitCommands(pCeCmdSpace);
+        }
+        else
+        {
+            m_vbTable.state.dirty = 1;
+        }
+    }
+
+    // None of the per-draw HW state is known anymore.
+    m_drawTimeHwState.valid.u32All           = 0;
+    m_drawTimeHwState.dirty.indexType        = 1;
+    m_drawTimeHwState.dirty.indexedIndexType = 1;
+    m_drawTimeHwState.dirty.indexBufferBase  = 1;
+    m_drawTimeHwState.dirty.indexBufferSize  = 1;
+
+    // These registers are only written at draw-time when their values change, so write our values back now.
+    uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
+
+    pDeCmdSpace = m_deCmdStream.WriteSetOneContextRegNoOpt(mmPA_SC_CONSERVATIVE_RASTERIZATION_CNTL,
+                                                           m_paScConsRastCntl.u32All,
+                                                           pDeCmdSpace);
+
+    if (m_cmdUtil.GetRegInfo().mmDbDfsmControl != 0)
+    {
+        pDeCmdSpace = m_deCmdStream.WriteSetOneContextRegNoOpt(m_cmdUtil.GetRegInfo().mmDbDfsmControl,
+                                                               m_dbDfsmControl.u32All,
+                                                               pDeCmdSpace);
+    }
+
+    m_deCmdStream.CommitCommands(pDeCmdSpace);
+
+    // The segments may have launched blts or written memory; assume the worst.
+    SetGfxCmdBufGfxBltState(true);
+    SetGfxCmdBufCsBltState(true);
+    SetGfxCmdBufGfxBltWriteCacheState(true);
+    SetGfxCmdBufCsBltWriteCacheState(true);
+    SetGfxCmdBufCpBltWriteCacheState(true);
+    SetGfxCmdBufCpMemoryWriteL2CacheStaleState(true);
 }
 
 // =====================================================================================================================
@@ -8451,6 +8924,8 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
     uint32            cmdBufferCount,
     ICmdBuffer*const* ppCmdBuffers)
 {
+    const uint32 inlineThreshold = m_device.Settings().nestedCmdBufInlineThreshold;
+
     for (uint32 buf = 0; buf < cmdBufferCount; ++buf)
     {
         auto*const pCallee = static_cast<Gfx9::UniversalCmdBuffer*>(ppCmdBuffers[buf]);
@@ -8462,8 +8937,17 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
         // All user-data entries have been uploaded into CE RAM and GPU memory, so we can safely "call" the nested
         // command buffer's command streams.
 
-        const bool exclusiveSubmit = pCallee->IsExclusiveSubmit();
+        // Launching a nested command buffer via an IB2 or a chain costs the CP an extra indirect buffer fetch, which
+        // is more expensive than simply copying the commands inline when the nested command buffer is small. Streams
+        // which contain any command that depends on its chunk's GPU address must never be copied without patching.
+        const bool copyInline = ((pCallee->m_deCmdStream.TotalChunkDwords() <= inlineThreshold) &&
+                                 (pCallee->m_ceCmdStream.TotalChunkDwords() <= inlineThreshold) &&
+                                 (pCallee->m_deCmdStream.IsAddressDependent() == false) &&
+                                 (pCallee->m_ceCmdStream.IsAddressDependent() == false));
+
+        const bool exclusiveSubmit = (pCallee->IsExclusiveSubmit() && (copyInline == false));
         const bool allowIb2Launch = (pCallee->AllowLaunchViaIb2() &&
+                                     (copyInline == false) &&
                                      ((pCallee->m_state.flags.containsDrawIndirect == 0)
                                       || (IsGfx10(m_gfxIpLevel) == true)));
         const bool allowIb2LaunchCe = (allowIb2Launch && (m_cachedSettings.waCeDisableIb2 == 0));
@@ -8480,6 +8964,96 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
         // state back to the caller.
         LeakNestedCmdBufferState(*pCallee);
     }
+
+    // The nested command buffers may have changed the metadata state of any image.
+    SubresStates()->Reset();
+}
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+// Inserts a call to a series of segments which may still be recorded concurrently. The segments all began with this
+// command buffer's current state so they simply run one after another; the chains between them are built at End().
+void UniversalCmdBuffer::CmdInsertSegments(
+    uint32            segmentCount,
+    ICmdBuffer*const* ppSegments)
+{
+    AutoBuffer<const Pal::GfxCmdStream*, 8, Platform> deStreams(segmentCount, m_device.GetPlatform());
+    AutoBuffer<const Pal::GfxCmdStream*, 8, Platform> ceStreams(segmentCount, m_device.GetPlatform());
+
+    if ((deStreams.Capacity() < segmentCount) || (ceStreams.Capacity() < segmentCount))
+    {
+        NotifyAllocFailure();
+    }
+    else
+    {
+        Result result = Result::Success;
+
+        for (uint32 idx = 0; idx < segmentCount; ++idx)
+        {
+            auto*const pSegment = static_cast<Gfx9::UniversalCmdBuffer*>(ppSegments[idx]);
+            PAL_ASSERT((pSegment != nullptr) && pSegment->IsNested() && pSegment->IsExclusiveSubmit());
+
+            deStreams[idx] = &pSegment->m_deCmdStream;
+            ceStreams[idx] = &pSegment->m_ceCmdStream;
+
+            if (result == Result::Success)
+            {
+                result = m_segments.PushBack(pSegment);
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_deCmdStream.InsertSegments(segmentCount, &deStreams[0]);
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_ceCmdStream.InsertSegments(segmentCount, &ceStreams[0]);
+        }
+
+        if (result == Result::Success)
+        {
+            RestoreStateAfterSegments();
+
+            // The segments may have changed the metadata state of any image.
+            SubresStates()->Reset();
+        }
+        else
+        {
+            NotifyAllocFailure();
+        }
+    }
+}
+#endif
+
+// =====================================================================================================================
+// Completes recording of this command buffer. Any segments inserted into it must have ended by now so their chunks
+// can be tracked and their chains can be built once our own command streams have ended.
+Result UniversalCmdBuffer::End()
+{
+    for (uint32 idx = 0; idx < m_segments.NumElements(); ++idx)
+    {
+        const UniversalCmdBuffer*const pSegment = m_segments.At(idx);
+
+        // Track the most recent OS paging fence value across all segments called from this command buffer.
+        m_lastPagingFence = Max(m_lastPagingFence, pSegment->LastPagingFence());
+
+        m_deCmdStream.TrackNestedEmbeddedData(pSegment->m_embeddedData.chunkList);
+        m_deCmdStream.TrackNestedEmbeddedData(pSegment->m_gpuScratchMem.chunkList);
+        m_deCmdStream.TrackNestedCommands(pSegment->m_deCmdStream);
+        m_ceCmdStream.TrackNestedCommands(pSegment->m_ceCmdStream);
+    }
+
+    const Result result = Pal::UniversalCmdBuffer::End();
+
+    if ((result == Result::Success) && (m_segments.NumElements() > 0))
+    {
+        m_deCmdStream.StitchSegments();
+        m_ceCmdStream.StitchSegments();
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
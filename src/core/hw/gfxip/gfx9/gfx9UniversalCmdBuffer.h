@@ -29,8 +29,10 @@
 #include "core/hw/gfxip/gfx9/gfx9Gds.h"
 #include "core/hw/gfxip/gfx9/gfx9Chip.h"
 #include "core/hw/gfxip/gfx9/gfx9CmdStream.h"
+#include "core/hw/gfxip/gfx9/gfx9Device.h"
 #include "core/hw/gfxip/gfx9/gfx9WorkaroundState.h"
 #include "core/hw/gfxip/gfx9/g_gfx9PalSettings.h"
+#include "palDeveloperHooks.h"
 #include "palIntervalTree.h"
 
 #include "palPipelineAbi.h"
@@ -408,6 +410,8 @@ public:
 
     virtual Result Init(const CmdBufferInternalCreateInfo& internalInfo) override;
 
+    virtual Result End() override;
+
     virtual void CmdBindPipeline(
         const PipelineBindParams& params) override;
 
@@ -415,6 +419,9 @@ public:
     virtual void CmdBindMsaaState(const IMsaaState* pMsaaState) override;
     virtual void CmdBindColorBlendState(const IColorBlendState* pColorBlendState) override;
     virtual void CmdBindDepthStencilState(const IDepthStencilState* pDepthStencilState) override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdBindStateBlock(const IStateBlock* pStateBlock) override;
+#endif
 
     virtual void CmdSetBlendConst(const BlendConstParams& params) override;
     virtual void CmdSetInputAssemblyState(const InputAssemblyStateParams& params) override;
@@ -699,6 +706,15 @@ public:
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdInsertSegments(
+        uint32            segmentCount,
+        ICmdBuffer*const* ppSegments) override;
+
+    virtual void CmdDrawBatch(
+        const DrawBatchInfo& batchInfo) override;
+#endif
+
     virtual void CmdCommentString(const char* pComment) override;
     virtual void CmdNop(
         const void* pPayload,
@@ -831,6 +847,14 @@ protected:
         const ValidateDrawInfo& drawInfo,
         uint32*                 pDeCmdSpace);
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    void EndValidationStage(
+        Developer::DrawValidationStage stage,
+        int64                          startTime,
+        const uint32*                  pStartCmdSpace,
+        const uint32*                  pEndCmdSpace);
+#endif
+
     // Gets vertex offset register address
     uint16 GetVertexOffsetRegAddr() const { return m_vertexOffsetReg; }
 
@@ -884,6 +908,10 @@ private:
         uint32      firstInstance,
         uint32      instanceCount);
 
+    template <bool Indexed, bool Pm4OptImmediate>
+    void CmdDrawBatch(
+        const DrawBatchInfo& batchInfo);
+
     template <bool IssueSqttMarkerEvent, bool ViewInstancingEnable, bool DescribeDrawDispatch>
     static void PAL_STDCALL CmdDrawIndirectMulti(
         ICmdBuffer*       pCmdBuffer,
@@ -1044,6 +1072,8 @@ private:
     void LeakNestedCmdBufferState(
         const UniversalCmdBuffer& cmdBuffer);
 
+    void RestoreStateAfterSegments();
+
     uint8 CheckStreamOutBufferStridesOnPipelineSwitch();
     uint32* UploadStreamOutBufferStridesToCeRam(
         uint8   dirtyStrideMask,
@@ -1257,6 +1287,13 @@ private:
     DrawTimeHwState  m_drawTimeHwState;  // Tracks certain bits of HW-state that might need to be updated per draw.
     NggState         m_nggState;
 
+    // The most recent barrier syncs which later barriers may merge into.
+    CoalescedBarrierSyncs  m_coalescedBarrierSyncs;
+
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    Developer::DrawValidationProfile  m_validationProfile; // Per-stage profile of the draw currently being validated.
+#endif
+
     // In order to prevent invalid query results if an app does Begin()/End(), Reset()/Begin()/End(), Resolve() on a
     // query slot in a command buffer (the first End() might overwrite values written by the Reset()), we have to
     // insert an idle before performing the Reset().  This has a high performance penalty.  This structure is used
@@ -1264,6 +1301,9 @@ private:
     // during Reset() if the reset doesn't affect any pending queries.
     Util::IntervalTree<gpusize, bool, Platform>  m_activeOcclusionQueryWriteRanges;
 
+    // The segments inserted into this command buffer by CmdInsertSegments. They're stitched together at End().
+    Util::Vector<UniversalCmdBuffer*, 8, Platform>  m_segments;
+
     PAL_DISALLOW_DEFAULT_CTOR(UniversalCmdBuffer);
     PAL_DISALLOW_COPY_AND_ASSIGN(UniversalCmdBuffer);
 };
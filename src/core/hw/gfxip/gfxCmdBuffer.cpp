@@ -67,7 +67,10 @@ GfxCmdBuffer::GfxCmdBuffer(
     m_fceRefCountVec(device.GetPlatform()),
     m_gfxBltActiveCtr(0),
     m_csBltActiveCtr(0),
-    m_releaseActivityMap(128, device.GetPlatform())
+    m_releaseActivityMap(128, device.GetPlatform()),
+    m_spillTableCacheSize(Min(device.Parent()->Settings().cmdBufSpillTableCacheSize, MaxSpillTableCacheSlots)),
+    m_spillTableCacheCount(0),
+    m_spillTableCacheNext(0)
 {
     PAL_ASSERT((createInfo.queueType == QueueTypeUniversal) || (createInfo.queueType == QueueTypeCompute));
 
@@ -264,6 +267,13 @@ void GfxCmdBuffer::ResetState()
     m_gfxBltActiveCtr = 0;
     m_csBltActiveCtr  = 0;
 
+    // The embedded data referenced by the spill table ring is released when the command buffer is reset.
+    m_spillTableCacheCount = 0;
+    m_spillTableCacheNext  = 0;
+
+    // Nothing is known about the state of any image at the start of a command buffer.
+    m_subresStates.Reset();
+
 }
 
 // =====================================================================================================================
@@ -565,6 +575,7 @@ void GfxCmdBuffer::CmdCopyImage(
                                         regionCount,
                                         pRegions,
                                         flags);
+    m_subresStates.InvalidateImage(&dstImage);
 }
 
 // =====================================================================================================================
@@ -583,6 +594,7 @@ void GfxCmdBuffer::CmdCopyMemoryToImage(
                                                 regionCount,
                                                 pRegions,
                                                 false);
+    m_subresStates.InvalidateImage(&dstImage);
 }
 
 // =====================================================================================================================
@@ -646,6 +658,7 @@ void GfxCmdBuffer::CmdCopyMemoryToTiledImage(
                                                     regionCount,
                                                     &copyRegions[0],
                                                     true);
+        m_subresStates.InvalidateImage(&dstImage);
     }
 }
 
@@ -718,6 +731,7 @@ void GfxCmdBuffer::CmdScaledCopyImage(
 
     PAL_ASSERT(copyInfo.pRegions != nullptr);
     m_device.RsrcProcMgr().CmdScaledCopyImage(this, copyInfo, NullInternalFlags);
+    m_subresStates.InvalidateImage(copyInfo.pDstImage);
 }
 
 // =====================================================================================================================
@@ -725,6 +739,7 @@ void GfxCmdBuffer::CmdGenerateMipmaps(
     const GenMipmapsInfo& genInfo)
 {
     m_device.RsrcProcMgr().CmdGenerateMipmaps(this, genInfo);
+    m_subresStates.InvalidateImage(genInfo.pImage);
 }
 
 // =====================================================================================================================
@@ -748,6 +763,7 @@ void GfxCmdBuffer::CmdColorSpaceConversionCopy(
                                                        pRegions,
                                                        filter,
                                                        cscTable);
+    m_subresStates.InvalidateImage(&dstImage);
 }
 
 // =====================================================================================================================
@@ -828,6 +844,7 @@ void GfxCmdBuffer::CmdPresentBlt(
     copyInfo.flags.srcColorKey = false;
 
     m_device.RsrcProcMgr().CmdScaledCopyImage(this, copyInfo, internalFlags);
+    m_subresStates.InvalidateImage(&dstImage);
 }
 
 // =====================================================================================================================
@@ -900,6 +917,7 @@ void GfxCmdBuffer::CmdClearColorImage(
                                               boxCount,
                                               pBoxes,
                                               flags);
+    m_subresStates.InvalidateImage(&image);
 }
 
 // =====================================================================================================================
@@ -947,6 +965,7 @@ void GfxCmdBuffer::CmdClearDepthStencil(
                                                 rectCount,
                                                 pRects,
                                                 flags);
+    m_subresStates.InvalidateImage(&image);
 }
 
 // =====================================================================================================================
@@ -978,6 +997,7 @@ void GfxCmdBuffer::CmdClearImageView(
                                               pImageViewSrd,
                                               rectCount,
                                               pRects);
+    m_subresStates.InvalidateImage(&image);
 }
 
 // =====================================================================================================================
@@ -999,6 +1019,7 @@ void GfxCmdBuffer::CmdResolveImage(
                                            resolveMode,
                                            regionCount,
                                            pRegions);
+    m_subresStates.InvalidateImage(&dstImage);
 }
 
 // =====================================================================================================================
@@ -1153,6 +1174,66 @@ void GfxCmdBuffer::UpdateUserDataTableCpu(
     pTable->dirty = 0;
 }
 
+// =====================================================================================================================
+// Updates a user-data spill table managed by embedded data & CPU updates.  Bindless-heavy applications tend to cycle
+// through a handful of distinct spill tables, so the window of the table relevant to the active pipeline is hashed and
+// looked up in a small ring of recently uploaded spill tables first.  On a match, the table is pointed at the earlier
+// copy in embedded data, which saves both the embedded data allocation and the copy.
+void GfxCmdBuffer::UpdateSpillTableCpu(
+    UserDataTableState* pTable,
+    uint32              dwordsNeeded,
+    uint32              offsetInDwords,
+    const uint32*       pSrcData)       // In: Data representing the *full* contents of the table.
+{
+    if (m_spillTableCacheSize == 0)
+    {
+        UpdateUserDataTableCpu(pTable, dwordsNeeded, offsetInDwords, pSrcData);
+    }
+    else
+    {
+        // Embedded data is typically write-combined memory which is very slow to read back, so the earlier copies are
+        // identified by their 128-bit hash alone.  This is the same level of trust PAL places in pipeline hashes.
+        MetroHash::Hash hash = {};
+        MetroHash128::Hash(reinterpret_cast<const uint8*>(pSrcData + offsetInDwords),
+                           (sizeof(uint32) * dwordsNeeded),
+                           hash.bytes);
+
+        const SpillTableCacheSlot* pMatch = nullptr;
+        for (uint32 i = 0; (pMatch == nullptr) && (i < m_spillTableCacheCount); ++i)
+        {
+            const SpillTableCacheSlot& slot = m_spillTableCache[i];
+            if ((slot.offsetInDwords == offsetInDwords) &&
+                (slot.sizeInDwords   == dwordsNeeded)   &&
+                (slot.hash.qwords[0] == hash.qwords[0]) &&
+                (slot.hash.qwords[1] == hash.qwords[1]))
+            {
+                pMatch = &slot;
+            }
+        }
+
+        if (pMatch != nullptr)
+        {
+            pTable->gpuVirtAddr  = pMatch->gpuVirtAddr;
+            pTable->pCpuVirtAddr = pMatch->pCpuVirtAddr;
+            pTable->dirty        = 0;
+        }
+        else
+        {
+            UpdateUserDataTableCpu(pTable, dwordsNeeded, offsetInDwords, pSrcData);
+
+            SpillTableCacheSlot*const pSlot = &m_spillTableCache[m_spillTableCacheNext];
+            pSlot->hash           = hash;
+            pSlot->gpuVirtAddr    = pTable->gpuVirtAddr;
+            pSlot->pCpuVirtAddr   = pTable->pCpuVirtAddr;
+            pSlot->offsetInDwords = offsetInDwords;
+            pSlot->sizeInDwords   = dwordsNeeded;
+
+            m_spillTableCacheNext  = ((m_spillTableCacheNext + 1) % m_spillTableCacheSize);
+            m_spillTableCacheCount = Min((m_spillTableCacheCount + 1), m_spillTableCacheSize);
+        }
+    }
+}
+
 // =====================================================================================================================
 // CmdSetUserData callback which updates the tracked user-data entries for the compute state.
 void PAL_STDCALL GfxCmdBuffer::CmdSetUserDataCs(
@@ -1167,11 +1248,8 @@ void PAL_STDCALL GfxCmdBuffer::CmdSetUserDataCs(
 
     // NOTE: Compute operations are expected to be far rarer than graphics ones, so at the moment it is not expected
     // that filtering-out redundant compute user-data updates is worthwhile.
-    for (uint32 e = firstEntry; e < (firstEntry + entryCount); ++e)
-    {
-        WideBitfieldSetBit(pEntries->touched, e);
-        WideBitfieldSetBit(pEntries->dirty,   e);
-    }
+    WideBitfieldSetRange(pEntries->touched, firstEntry, entryCount);
+    WideBitfieldSetRange(pEntries->dirty,   firstEntry, entryCount);
     memcpy(&pEntries->entries[firstEntry], pEntryValues, entryCount * sizeof(uint32));
 }
 
@@ -1211,7 +1289,7 @@ void GfxCmdBuffer::LeakPerPipelineStateChanges(
             const uint32 entry = (bit + (UserDataEntriesPerMask * index));
             pDestUserDataEntries->entries[entry] = leakedUserDataEntries.entries[entry];
 
-            mask &= ~(1 << bit);
+            mask &= ~(1ull << bit);
         }
     }
 }
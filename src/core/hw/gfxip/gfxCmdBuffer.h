@@ -28,8 +28,10 @@
 #include "core/cmdBuffer.h"
 #include "core/fence.h"
 #include "core/platform.h"
+#include "core/hw/gfxip/subresStateTracker.h"
 #include "palDeque.h"
 #include "palHashMap.h"
+#include "palMetroHash.h"
 #include "palQueryPool.h"
 
 namespace Pal
@@ -63,10 +65,11 @@ constexpr uint32 PredicationAlign = 16;
 // the number returned to the client.
 constexpr uint32 MaxUserDataEntries = 128;
 
-// Wide-bitmask of one flag for every user-data entry.
-constexpr uint32 UserDataEntriesPerMask = (sizeof(uint16) << 3);
+// Wide-bitmask of one flag for every user-data entry. Using 64-bit parts keeps the number of parts small so that dirty
+// entries can be found with a few bit-scans instead of testing every entry.
+constexpr uint32 UserDataEntriesPerMask = (sizeof(uint64) << 3);
 constexpr uint32 NumUserDataFlagsParts  = (MaxUserDataEntries / UserDataEntriesPerMask);
-typedef uint16 UserDataFlags[NumUserDataFlagsParts];
+typedef uint64 UserDataFlags[NumUserDataFlagsParts];
 
 // Represents the user data entries for a particular shader stage.
 struct UserDataEntries
@@ -165,6 +168,20 @@ struct UserDataTableState
     };
 };
 
+// Maximum number of recently uploaded spill tables which a command buffer remembers for content-based reuse.
+constexpr uint32 MaxSpillTableCacheSlots = 64;
+
+// Describes one previously uploaded spill table in a command buffer's ring of recent spill tables.  A spill table with
+// the same window and contents can point at this copy instead of being uploaded to embedded data again.
+struct SpillTableCacheSlot
+{
+    Util::MetroHash::Hash hash;           // 128-bit hash of the table contents inside the uploaded window.
+    gpusize               gpuVirtAddr;    // Same meaning as UserDataTableState::gpuVirtAddr.
+    uint32*               pCpuVirtAddr;   // Same meaning as UserDataTableState::pCpuVirtAddr.
+    uint32                offsetInDwords; // First DWORD of the table which was uploaded.
+    uint32                sizeInDwords;   // Number of DWORD's which were uploaded.
+};
+
 // Structure representing release activity hashmap entry
 struct ReleaseActivityInfo
 {
@@ -446,6 +463,10 @@ public:
 
     Result AddFceSkippedImageCounter(GfxImage* pGfxImage);
 
+    // Known metadata states of image subresources, as recorded by the hardware layer's barrier code.
+    SubresStateTracker* SubresStates() { return &m_subresStates; }
+    const SubresStateTracker* SubresStates() const { return &m_subresStates; }
+
 protected:
     GfxCmdBuffer(
         const GfxDevice&           device,
@@ -506,6 +527,12 @@ protected:
         const uint32*       pSrcData,
         uint32              alignmentInDwords = 1);
 
+    void UpdateSpillTableCpu(
+        UserDataTableState* pTable,
+        uint32              dwordsNeeded,
+        uint32              offsetInDwords,
+        const uint32*       pSrcData);
+
     static void PAL_STDCALL CmdSetUserDataCs(
         ICmdBuffer*   pCmdBuffer,
         uint32        firstEntry,
@@ -564,12 +591,19 @@ private:
                                        // buffer so that appropriate submit-time operations can be done.
 
     FceRefCountsVector m_fceRefCountVec;
+    SubresStateTracker m_subresStates;
 
     uint16 m_gfxBltActiveCtr; // Count the number of gfx BLT that has launched.
     uint16 m_csBltActiveCtr;  // Count the number of cs BLT that has launched.
 
     ReleaseActivityMap m_releaseActivityMap; // A hashmap that tracks active releases.
 
+    // Ring of the most recently uploaded spill tables, used to reuse identical spill tables within this command buffer.
+    SpillTableCacheSlot m_spillTableCache[MaxSpillTableCacheSlots];
+    const uint32        m_spillTableCacheSize;  // Number of ring slots, or zero if spill-table reuse is disabled.
+    uint32              m_spillTableCacheCount; // Number of valid slots in the ring.
+    uint32              m_spillTableCacheNext;  // Index of the slot which the next uploaded spill table replaces.
+
     PAL_DISALLOW_COPY_AND_ASSIGN(GfxCmdBuffer);
     PAL_DISALLOW_DEFAULT_CTOR(GfxCmdBuffer);
 };
@@ -28,6 +28,7 @@
 #include "core/device.h"
 #include "core/hw/gfxip/gfxDevice.h"
 #include "core/hw/gfxip/gfxCmdStream.h"
+#include "palDequeImpl.h"
 #include "palVectorImpl.h"
 
 using namespace Util;
@@ -62,7 +63,9 @@ GfxCmdStream::GfxCmdStream(
     m_cmdBlockOffset(0),
     m_pTailChainLocation(nullptr),
     m_numCntlFlowStatements(0),
-    m_numPendingChains(0)
+    m_numPendingChains(0),
+    m_segmentCallSites(device.GetPlatform(), 8),
+    m_segments(device.GetPlatform())
 {
     memset(m_cntlFlowStack, 0, sizeof(m_cntlFlowStack));
     memset(m_pendingChains, 0, sizeof(m_pendingChains));
@@ -79,6 +82,13 @@ void GfxCmdStream::Reset(
     m_numPendingChains      = 0;
     m_pTailChainLocation    = nullptr;
 
+    while (m_segmentCallSites.NumElements() > 0)
+    {
+        m_segmentCallSites.PopBack(nullptr);
+    }
+
+    m_segments.Clear();
+
     Pal::CmdStream::Reset(pNewAllocator, returnGpuMemory);
 }
 
@@ -531,6 +541,111 @@ void GfxCmdStream::Call(
     }
 }
 
+// =====================================================================================================================
+// Inserts a call to a series of segment command streams which are still being recorded. The current command block ends
+// with a placeholder for a chain into the first segment and each segment will chain into the next one. The last segment
+// chains back to the command block which follows this call. None of these chains can be built until this stream and
+// all of the segments have ended, at which point the caller must call StitchSegments.
+Result GfxCmdStream::InsertSegments(
+    uint32                     segmentCount,
+    const GfxCmdStream*const* ppSegments)
+{
+    // Stitching relies on chaining and must not be hidden behind a branch because it's not a real command block.
+    PAL_ASSERT((m_chainIbSpaceInDwords > 0) && (m_chainIbSpaceInDwords <= MaxSegmentChainDwords));
+    PAL_ASSERT(m_numCntlFlowStatements == 0);
+
+    // The PM4 optimizer can't see the registers the segments will write, and finalized optimization would move the
+    // placeholder we patch below when it compacts this chunk. Just turn off optimization when we start using segments.
+    if (m_flags.optimizeCommands == 1)
+    {
+        m_flags.optimizeCommands = 0;
+        m_flags.optModeImmediate = 0;
+        m_flags.optModeFinalized = 0;
+    }
+
+    if (IsEmpty())
+    {
+        // The call to EndCommandBlock() below will not succeed if this command stream is currently empty. Add the
+        // smallest-possible NOP packet to prevent the stream from being empty.
+        uint32*const pNopPacket = AllocCommandSpace(m_minNopSizeInDwords);
+        BuildNop(m_minNopSizeInDwords, pNopPacket);
+    }
+
+    // End our current command block with a placeholder for the call. Like the tail chain, it will be patched after
+    // this stream's chunks are finalized so we must remember its mapped CPU address rather than its write address.
+    uint32*const pCallChain = EndCommandBlock(m_chainIbSpaceInDwords, false);
+    BuildNop(m_chainIbSpaceInDwords, pCallChain);
+
+    auto*const   pChunk     = m_chunkList.Back();
+    const size_t callOffset = pCallChain - pChunk->GetRmwWriteAddr();
+
+    SegmentCallSite callSite = {};
+    callSite.pCallChain   = pChunk->GetRmwCpuAddr() + callOffset;
+    callSite.firstSegment = m_segments.NumElements();
+    callSite.segmentCount = segmentCount;
+
+    Result result = Result::Success;
+
+    for (uint32 idx = 0; (idx < segmentCount) && (result == Result::Success); ++idx)
+    {
+        PAL_ASSERT(ppSegments[idx] != nullptr);
+        result = m_segments.PushBack(ppSegments[idx]);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_segmentCallSites.PushBack(callSite);
+    }
+
+    if (result == Result::Success)
+    {
+        // The return chain targets the next command block in this stream, so it's patched when that block ends.
+        AddChainPatch(ChainPatchType::IndirectBuffer, &m_segmentCallSites.Back().returnChain[0]);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Builds all of the chains needed to execute the segments inserted by InsertSegments. This must be called after this
+// stream and all of its segments have ended.
+void GfxCmdStream::StitchSegments()
+{
+    for (auto iter = m_segmentCallSites.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        const SegmentCallSite& callSite = *iter.Get();
+
+        uint32* pChain = callSite.pCallChain;
+
+        for (uint32 idx = 0; idx < callSite.segmentCount; ++idx)
+        {
+            const GfxCmdStream*const pSegment = m_segments.At(callSite.firstSegment + idx);
+
+            // Empty segments are skipped; the chain just jumps straight to the next segment.
+            if (pSegment->IsEmpty() == false)
+            {
+                // The segment's End() left a NOP at its tail-chain location which becomes the chain to its successor.
+                PAL_ASSERT(pSegment->m_pTailChainLocation != nullptr);
+                PAL_ASSERT(pSegment->m_chainIbSpaceInDwords == m_chainIbSpaceInDwords);
+                PAL_ASSERT(IsPreemptionEnabled() == pSegment->IsPreemptionEnabled());
+
+                const auto*const pFirstChunk = pSegment->GetFirstChunk();
+
+                BuildIndirectBuffer(pFirstChunk->GpuVirtAddr(),
+                                    pFirstChunk->CmdDwordsToExecute(),
+                                    pSegment->IsPreemptionEnabled(),
+                                    true,
+                                    pChain);
+
+                pChain = pSegment->m_pTailChainLocation;
+            }
+        }
+
+        // Finally, chain from the last segment back to the command block which followed the call.
+        memcpy(pChain, &callSite.returnChain[0], m_chainIbSpaceInDwords * sizeof(uint32));
+    }
+}
+
 // =====================================================================================================================
 // Uses command buffer chaining to "execute" a series of GPU-generated command chunks. All chunks starting at the given
 // iterator until the end of whichever list it belongs to are chained together. Additionally, the final chunk chains
@@ -27,6 +27,7 @@
 
 #include "core/cmdStream.h"
 #include "core/hw/gfxip/gfxDevice.h"
+#include "palDeque.h"
 #include "palVector.h"
 
 namespace Pal
@@ -88,6 +89,9 @@ public:
 
     virtual void Call(const CmdStream& targetStream, bool exclusiveSubmit, bool allowIb2Launch) override;
 
+    Result InsertSegments(uint32 segmentCount, const GfxCmdStream*const* ppSegments);
+    void StitchSegments();
+
     void ExecuteGeneratedCommands(ChunkRefList::Iter chunkIter);
 
     uint32 PrepareChunkForCmdGeneration(
@@ -175,6 +179,23 @@ private:
     ChainPatch     m_pendingChains[MaxChainPatches];
     uint32         m_numPendingChains;
 
+    // Segments are still being recorded when they're inserted so the chains which jump into them can't be built until
+    // this stream and all of its segments have ended. Each call site remembers where the chain into its first segment
+    // goes and holds the chain back to this stream, which is patched like any other chain when the next block ends.
+    static constexpr uint32 MaxSegmentChainDwords = 8;
+
+    struct SegmentCallSite
+    {
+        uint32* pCallChain;                          // Chain into the first segment (mapped CPU address).
+        uint32  returnChain[MaxSegmentChainDwords];  // Chain from the last segment back to this stream.
+        uint32  firstSegment;                        // Index of this call site's first segment in m_segments.
+        uint32  segmentCount;
+    };
+
+    // A deque is used because pending chain patches point into the call sites, so their addresses must not change.
+    Util::Deque<SegmentCallSite, Platform>          m_segmentCallSites;
+    Util::Vector<const GfxCmdStream*, 8, Platform>  m_segments;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(GfxCmdStream);
     PAL_DISALLOW_DEFAULT_CTOR(GfxCmdStream);
 };
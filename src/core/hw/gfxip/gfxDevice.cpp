@@ -381,6 +381,32 @@ void GfxDevice::DestroyMsaaStateInternal(
     }
 }
 
+// =====================================================================================================================
+// Default implementation for GFXIP levels which don't support pre-baked state blocks.
+size_t GfxDevice::GetStateBlockSize(
+    const StateBlockCreateInfo& createInfo,
+    Result*                     pResult
+    ) const
+{
+    if (pResult != nullptr)
+    {
+        (*pResult) = Result::ErrorUnavailable;
+    }
+
+    return 0;
+}
+
+// =====================================================================================================================
+// Default implementation for GFXIP levels which don't support pre-baked state blocks.
+Result GfxDevice::CreateStateBlock(
+    const StateBlockCreateInfo& createInfo,
+    void*                       pPlacementAddr,
+    IStateBlock**               ppStateBlock
+    ) const
+{
+    return Result::ErrorUnavailable;
+}
+
 // =====================================================================================================================
 Platform* GfxDevice::GetPlatform() const
 {
@@ -606,6 +632,28 @@ void GfxDevice::DescribeDrawDispatchValidation(
     m_pParent->DeveloperCb(Developer::CallbackType::DrawDispatchValidation, &data);
 }
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+// =====================================================================================================================
+// Call back to above layers to describe a draw-time validation, including its per-stage CPU profile.
+void GfxDevice::DescribeDrawDispatchValidation(
+    GfxCmdBuffer*                           pCmdBuf,
+    size_t                                  userDataCmdSize,
+    size_t                                  pipelineCmdSize,
+    size_t                                  miscCmdSize,
+    const Developer::DrawValidationProfile& profile
+    ) const
+{
+    Developer::DrawDispatchValidationData data = { };
+    data.pCmdBuffer      = pCmdBuf;
+    data.userDataCmdSize = static_cast<uint32>(userDataCmdSize);
+    data.pipelineCmdSize = static_cast<uint32>(pipelineCmdSize);
+    data.miscCmdSize     = static_cast<uint32>(miscCmdSize);
+    data.pProfile        = &profile;
+
+    m_pParent->DeveloperCb(Developer::CallbackType::DrawDispatchValidation, &data);
+}
+#endif
+
 // =====================================================================================================================
 // Call back to above layers to describe the writes to registers seen using SET or RMW packets.
 void GfxDevice::DescribeHotRegisters(
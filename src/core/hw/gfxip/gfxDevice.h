@@ -66,6 +66,7 @@ class      IPerfExperiment;
 class      IPipeline;
 class      IQueryPool;
 class      IShader;
+class      IStateBlock;
 class      MsaaState;
 class      Platform;
 class      Queue;
@@ -98,6 +99,7 @@ struct     QueryPoolCreateInfo;
 struct     PalSettings;
 struct     RasterStateCreateInfo;
 struct     SamplerInfo;
+struct     StateBlockCreateInfo;
 struct     ScShaderMem;
 struct     ScissorStateCreateInfo;
 struct     ShaderCreateInfo;
@@ -415,6 +417,15 @@ public:
         Util::SystemAllocType      allocType) const;
     void DestroyMsaaStateInternal(
         MsaaState* pMsaaState) const;
+
+    // State blocks are optional: GFXIP levels which don't override these report them as unavailable.
+    virtual size_t GetStateBlockSize(
+        const StateBlockCreateInfo& createInfo,
+        Result*                     pResult) const;
+    virtual Result CreateStateBlock(
+        const StateBlockCreateInfo& createInfo,
+        void*                       pPlacementAddr,
+        IStateBlock**               ppStateBlock) const;
     virtual size_t GetImageSize(const ImageCreateInfo& createInfo) const = 0;
     virtual void CreateImage(
         Pal::Image* pParentImage,
@@ -557,6 +568,14 @@ public:
         size_t        userDataCmdSize,
         size_t        pipelineCmdSize,
         size_t        miscCmdSize) const;
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    void DescribeDrawDispatchValidation(
+        GfxCmdBuffer*                           pCmdBuf,
+        size_t                                  userDataCmdSize,
+        size_t                                  pipelineCmdSize,
+        size_t                                  miscCmdSize,
+        const Developer::DrawValidationProfile& profile) const;
+#endif
 
     void DescribeHotRegisters(
         GfxCmdBuffer* pCmdBuf,
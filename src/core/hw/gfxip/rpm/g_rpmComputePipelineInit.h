@@ -151,6 +151,6 @@ enum class RpmComputePipeline : uint32
     Count
 };
 
-Result CreateRpmComputePipelines(GfxDevice* pDevice, ComputePipeline** pPipelineMem);
+Result CreateRpmComputePipeline(RpmComputePipeline pipelineType, GfxDevice* pDevice, ComputePipeline** ppPipeline);
 
 } // Pal
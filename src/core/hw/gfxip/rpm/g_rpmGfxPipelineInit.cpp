@@ -35,10 +35,12 @@ namespace Pal
 {
 
 // =====================================================================================================================
-// Creates all graphics pipeline objects required by RsrcProcMgr.
-Result CreateRpmGraphicsPipelines(
+// Creates the specified graphics pipeline object required by RsrcProcMgr.  Pipelines which aren't supported by this
+// device's GFXIP level are left null.
+Result CreateRpmGraphicsPipeline(
+    RpmGfxPipeline     pipeline,
     GfxDevice*         pDevice,
-    GraphicsPipeline** pPipelineMem)
+    GraphicsPipeline** ppPipeline)
 {
     Result result = Result::Success;
 
@@ -117,2968 +119,2866 @@ Result CreateRpmGraphicsPipelines(
 
     if (result == Result::Success)
     {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaDepth].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaDepth].size;
+        switch (pipeline)
+        {
+        case Copy2xMsaaDepth:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaDepth].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaDepth].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy2xMsaaDepth],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaDepthStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaDepthStencil].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy2xMsaaDepthStencil],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaStencil].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy2xMsaaStencil],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaDepth].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaDepth].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy4xMsaaDepth],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaDepthStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaDepthStencil].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy4xMsaaDepthStencil],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaStencil].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy4xMsaaStencil],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaDepth].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaDepth].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy8xMsaaDepth],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaDepthStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaDepthStencil].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy8xMsaaDepthStencil],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaStencil].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy8xMsaaStencil],
-            AllocInternal);
-    }
-
-    if ((properties.gfxLevel >= GfxIpLevel::GfxIp8) && (result == Result::Success))
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[DccDecompress].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[DccDecompress].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.dccDecompress = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[DccDecompress],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[DepthExpand].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[DepthExpand].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[DepthExpand],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[DepthResummarize].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[DepthResummarize].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[DepthResummarize],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[DepthSlowDraw].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[DepthSlowDraw].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[DepthSlowDraw],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[FastClearElim].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[FastClearElim].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.fastClearElim = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[FastClearElim],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[FmaskDecompress].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[FmaskDecompress].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.fmaskDecompress = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[FmaskDecompress],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_FP16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_SINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_SINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_SNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_SNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_UINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_UINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[Copy_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[Copy_UNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[Copy_UNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.resolveFixedFunc = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[ResolveFixedFunc_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.resolveFixedFunc = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[ResolveFixedFunc_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.resolveFixedFunc = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[ResolveFixedFunc_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.resolveFixedFunc = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[ResolveFixedFunc_FP16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_SINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.resolveFixedFunc = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[ResolveFixedFunc_SINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_SNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.resolveFixedFunc = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[ResolveFixedFunc_SNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_UINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.resolveFixedFunc = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[ResolveFixedFunc_UINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_UNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        internalInfo = { };
-        internalInfo.flags.resolveFixedFunc = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            internalInfo,
-            &pPipelineMem[ResolveFixedFunc_UNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy2d_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy2d_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy2d_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy2d_FP16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_SINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy2d_SINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_SNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy2d_SNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_UINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy2d_UINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_UNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy2d_UNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy3d_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy3d_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy3d_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy3d_FP16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_SINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy3d_SINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_SNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy3d_SNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_UINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy3d_UINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_UNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ScaledCopy3d_UNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_FP16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_SINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_SINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_SNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_SNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_UINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_UINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_UNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear0_UNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[1].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[1].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_FP16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_SINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_SINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_SNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_SNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_UINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_UINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_UNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[1].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear1_UNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[2].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[2].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_FP16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_SINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_SINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_SNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_SNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_UINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_UINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_UNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[2].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear2_UNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[3].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[3].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_FP16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_SINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+        case Copy2xMsaaDepthStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaDepthStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaDepthStencil].size;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_SINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_SNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_SNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_UINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_UINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_UNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[3].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear3_UNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[4].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[4].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_FP16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_SINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_SINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_SNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_SNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_UINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_UINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_UNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[4].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear4_UNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[5].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[5].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_FP16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_SINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_SINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_SNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_SNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_UINT16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_UINT16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_UNORM16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[5].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear5_UNORM16],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32ABGR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_32ABGR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32GR].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[6].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_32GR],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32R].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[6].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_32R],
-            AllocInternal);
-    }
-
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_FP16].size;
-
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
-
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
-
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
-
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_FP16],
-            AllocInternal);
-    }
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_SINT16].size;
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+        case Copy2xMsaaStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy2xMsaaStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy2xMsaaStencil].size;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
-
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_SINT16],
-            AllocInternal);
-    }
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_SNORM16].size;
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+        case Copy4xMsaaDepth:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaDepth].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaDepth].size;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_SNORM16],
-            AllocInternal);
-    }
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_UINT16].size;
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+        case Copy4xMsaaDepthStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaDepthStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaDepthStencil].size;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_UINT16],
-            AllocInternal);
-    }
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_UNORM16].size;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+        case Copy4xMsaaStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy4xMsaaStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy4xMsaaStencil].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case Copy8xMsaaDepth:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaDepth].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaDepth].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[6].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case Copy8xMsaaDepthStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaDepthStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaDepthStencil].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case Copy8xMsaaStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy8xMsaaStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy8xMsaaStencil].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case DccDecompress:
+            if (properties.gfxLevel >= GfxIpLevel::GfxIp8)
+            {
+                pipeInfo = { };
+                pipeInfo.pPipelineBinary    = pTable[DccDecompress].pBuffer;
+                pipeInfo.pipelineBinarySize = pTable[DccDecompress].size;
+
+                PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+                pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+                pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+                pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+                pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                    { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+                pipeInfo.cbState.logicOp           = LogicOp::Copy;
+                pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+                pipeInfo.rsState.depthClampDisable = true;
+
+                internalInfo = { };
+                internalInfo.flags.dccDecompress = true;
+
+                result = pDevice->CreateGraphicsPipelineInternal(
+                    pipeInfo,
+                    internalInfo,
+                    ppPipeline,
+                    AllocInternal);
+            }
+            break;
+
+        case DepthExpand:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[DepthExpand].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[DepthExpand].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear6_UNORM16],
-            AllocInternal);
-    }
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32ABGR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32ABGR].size;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case DepthResummarize:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[DepthResummarize].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[DepthResummarize].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case DepthSlowDraw:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[DepthSlowDraw].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[DepthSlowDraw].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case FastClearElim:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[FastClearElim].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[FastClearElim].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_32ABGR],
-            AllocInternal);
-    }
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32GR].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32GR].size;
+            internalInfo = { };
+            internalInfo.flags.fastClearElim = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case FmaskDecompress:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[FmaskDecompress].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[FmaskDecompress].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            internalInfo = { };
+            internalInfo.flags.fmaskDecompress = true;
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0x3;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case Copy_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_32GR],
-            AllocInternal);
-    }
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case Copy_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32R].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32R].size;
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case Copy_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case Copy_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case Copy_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case Copy_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_SNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+        case Copy_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+        case Copy_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[Copy_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[Copy_UNORM16].size;
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32_Uint;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_32R],
-            AllocInternal);
-    }
+        case ResolveFixedFunc_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_32ABGR].size;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_FP16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_FP16].size;
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            internalInfo = { };
+            internalInfo.flags.resolveFixedFunc = true;
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+        case ResolveFixedFunc_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_32GR].size;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            internalInfo = { };
+            internalInfo.flags.resolveFixedFunc = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_FP16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_SINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_SINT16].size;
+        case ResolveFixedFunc_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_32R].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            internalInfo = { };
+            internalInfo.flags.resolveFixedFunc = true;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_SINT16],
-            AllocInternal);
-    }
+        case ResolveFixedFunc_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_FP16].size;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_SNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_SNORM16].size;
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            internalInfo = { };
+            internalInfo.flags.resolveFixedFunc = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_SNORM16],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_UINT16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_UINT16].size;
+        case ResolveFixedFunc_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_SINT16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_UINT16],
-            AllocInternal);
-    }
+            internalInfo = { };
+            internalInfo.flags.resolveFixedFunc = true;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_UNORM16].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_UNORM16].size;
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+        case ResolveFixedFunc_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_SNORM16].size;
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
-        pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
-        pipeInfo.cbState.target[7].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[SlowColorClear7_UNORM16],
-            AllocInternal);
-    }
+            internalInfo = { };
+            internalInfo.flags.resolveFixedFunc = true;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveDepth].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveDepth].size;
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+        case ResolveFixedFunc_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            internalInfo = { };
+            internalInfo.flags.resolveFixedFunc = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ResolveDepth],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ResolveFixedFunc_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveFixedFunc_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveFixedFunc_UNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveDepthCopy].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveDepthCopy].size;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            internalInfo = { };
+            internalInfo.flags.resolveFixedFunc = true;
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                internalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy2d_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Float;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
 
-        pipeInfo.cbState.logicOp           = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
-        pipeInfo.rsState.depthClampDisable = true;
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ResolveDepthCopy],
-            AllocInternal);
-    }
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy2d_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveStencil].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveStencil].size;
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy2d_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy2d_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy2d_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy2d_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_SNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy2d_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy2d_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy2d_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy2d_UNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy3d_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy3d_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy3d_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy3d_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy3d_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy3d_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_SNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy3d_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ScaledCopy3d_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ScaledCopy3d_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ScaledCopy3d_UNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear0_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear0_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear0_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear0_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear0_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear0_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_SNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear0_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear0_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear0_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear0_UNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear1_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear1_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[1].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear1_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[1].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear1_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear1_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear1_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_SNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear1_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear1_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear1_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear1_UNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[1].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[1].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[1].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear2_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear2_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[2].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear2_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[2].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear2_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear2_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear2_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_SNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear2_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear2_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear2_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear2_UNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[2].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[2].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[2].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear3_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear3_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[3].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear3_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[3].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear3_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear3_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear3_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_SNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear3_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear3_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear3_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear3_UNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[3].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[3].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[3].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear4_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear4_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[4].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear4_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[4].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear4_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear4_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear4_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_SNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear4_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear4_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear4_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear4_UNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[4].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[4].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[4].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear5_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear5_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[5].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear5_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[5].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear5_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear5_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear5_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_SNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear5_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear5_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear5_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear5_UNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[5].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[5].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[5].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear6_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear6_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[6].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear6_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[6].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear6_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear6_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear6_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_SNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear6_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_UINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear6_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear6_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear6_UNORM16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[6].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[6].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[6].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear7_32ABGR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32ABGR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32ABGR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32Y32Z32W32_Uint;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear7_32GR:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32GR].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32GR].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[7].channelWriteMask       = 0x3;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32Y32_Uint;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear7_32R:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_32R].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_32R].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[7].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X32_Uint;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear7_FP16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_FP16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_FP16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X8Y8Z8W8_Unorm;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear7_SINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_SINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_SINT16].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Sint;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear7_SNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_SNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_SNORM16].size;
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Snorm;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case SlowColorClear7_UINT16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_UINT16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_UINT16].size;
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ResolveStencil],
-            AllocInternal);
-    }
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Uint;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
 
-    if (result == Result::Success)
-    {
-        pipeInfo = { };
-        pipeInfo.pPipelineBinary    = pTable[ResolveStencilCopy].pBuffer;
-        pipeInfo.pipelineBinarySize = pTable[ResolveStencilCopy].size;
+        case SlowColorClear7_UNORM16:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[SlowColorClear7_UNORM16].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[SlowColorClear7_UNORM16].size;
 
-        PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
 
-        pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[7].channelWriteMask       = 0xF;
+            pipeInfo.cbState.target[7].swizzledFormat.format  = ChNumFormat::X16Y16Z16W16_Unorm;
+            pipeInfo.cbState.target[7].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ResolveDepth:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveDepth].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveDepth].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ResolveDepthCopy:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveDepthCopy].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveDepthCopy].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x1;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X32_Float;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::Zero, ChannelSwizzle::One };
+
+            pipeInfo.cbState.logicOp           = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride   = BinningOverride::Disable;
+            pipeInfo.rsState.depthClampDisable = true;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ResolveStencil:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveStencil].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveStencil].size;
 
-        pipeInfo.cbState.target[0].channelWriteMask       = 0x2;
-        pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8_Uint;
-        pipeInfo.cbState.target[0].swizzledFormat.swizzle =
-            { ChannelSwizzle::Y, ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::One };
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
 
-        pipeInfo.cbState.logicOp         = LogicOp::Copy;
-        pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        case ResolveStencilCopy:
+            pipeInfo = { };
+            pipeInfo.pPipelineBinary    = pTable[ResolveStencilCopy].pBuffer;
+            pipeInfo.pipelineBinarySize = pTable[ResolveStencilCopy].size;
+
+            PAL_ASSERT((pipeInfo.pPipelineBinary != nullptr) && (pipeInfo.pipelineBinarySize != 0));
+
+            pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Rect;
+
+            pipeInfo.cbState.target[0].channelWriteMask       = 0x2;
+            pipeInfo.cbState.target[0].swizzledFormat.format  = ChNumFormat::X8Y8_Uint;
+            pipeInfo.cbState.target[0].swizzledFormat.swizzle =
+                { ChannelSwizzle::Y, ChannelSwizzle::X, ChannelSwizzle::Zero, ChannelSwizzle::One };
 
-        result = pDevice->CreateGraphicsPipelineInternal(
-            pipeInfo,
-            NullInternalInfo,
-            &pPipelineMem[ResolveStencilCopy],
-            AllocInternal);
+            pipeInfo.cbState.logicOp         = LogicOp::Copy;
+            pipeInfo.rsState.binningOverride = BinningOverride::Disable;
+
+            result = pDevice->CreateGraphicsPipelineInternal(
+                pipeInfo,
+                NullInternalInfo,
+                ppPipeline,
+                AllocInternal);
+            break;
+
+        default:
+            // The remaining indices are unused and have no pipeline to create.
+            break;
+        }
     }
 
     return result;
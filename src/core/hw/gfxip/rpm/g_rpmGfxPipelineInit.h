@@ -173,6 +173,6 @@ constexpr uint32 RpmPsClearFirstUserData = (RpmVsSliceOffset + 1);
 // We support separate depth and stencil resolves
 constexpr uint32 NumDepthStencilResolveTypes = 2;
 
-Result CreateRpmGraphicsPipelines(GfxDevice* pDevice, GraphicsPipeline** pPipelineMem);
+Result CreateRpmGraphicsPipeline(RpmGfxPipeline pipeline, GfxDevice* pDevice, GraphicsPipeline** ppPipeline);
 
 } // Pal
@@ -45,6 +45,7 @@
 #include "palFormatInfo.h"
 #include "palMsaaState.h"
 #include "palInlineFuncs.h"
+#include "palSysUtil.h"
 
 #include <float.h>
 #include <math.h>
@@ -57,6 +58,9 @@ namespace Pal
 static void PreComputeColorClearSync(ICmdBuffer* pCmdBuffer);
 static void PostComputeColorClearSync(ICmdBuffer* pCmdBuffer);
 
+// Maximum number of threads used to create the RPM pipelines when they aren't created lazily.
+static constexpr uint32 MaxRpmInitThreads = 8;
+
 // =====================================================================================================================
 // Note that this constructor is invoked before settings have been committed.
 RsrcProcMgr::RsrcProcMgr(
@@ -74,11 +78,24 @@ RsrcProcMgr::RsrcProcMgr(
     m_pStencilResolveState(nullptr),
     m_pDepthStencilResolveState(nullptr),
     m_pDevice(pDevice),
-    m_srdAlignment(0)
+    m_srdAlignment(0),
+    m_stopPrewarm(0),
+    m_nextPipeline(0),
+    m_pipelineResult(static_cast<uint32>(Result::Success))
 {
     memset(&m_pMsaaState[0], 0, sizeof(m_pMsaaState));
-    memset(&m_pComputePipelines[0], 0, sizeof(m_pComputePipelines));
-    memset(&m_pGraphicsPipelines[0], 0, sizeof(m_pGraphicsPipelines));
+
+    for (uint32 idx = 0; idx < static_cast<uint32>(RpmComputePipeline::Count); ++idx)
+    {
+        m_pComputePipelines[idx]    = nullptr;
+        m_computePipelineReady[idx] = 0;
+    }
+
+    for (uint32 idx = 0; idx < RpmGfxPipelineCount; ++idx)
+    {
+        m_pGraphicsPipelines[idx]    = nullptr;
+        m_graphicsPipelineReady[idx] = 0;
+    }
 }
 
 // =====================================================================================================================
@@ -121,6 +138,14 @@ RsrcProcMgr::~RsrcProcMgr()
 // this object.
 void RsrcProcMgr::Cleanup()
 {
+    // The pre-warm thread may still be creating pipelines; stop it before destroying them.
+    if (m_prewarmThread.IsCreated())
+    {
+        AtomicExchange(&m_stopPrewarm, 1);
+        m_prewarmThread.Join();
+        AtomicExchange(&m_stopPrewarm, 0);
+    }
+
     // Destroy all compute pipeline objects.
     for (uint32 idx = 0; idx < static_cast<uint32>(RpmComputePipeline::Count); ++idx)
     {
@@ -129,6 +154,8 @@ void RsrcProcMgr::Cleanup()
             m_pComputePipelines[idx]->DestroyInternal();
             m_pComputePipelines[idx] = nullptr;
         }
+
+        m_computePipelineReady[idx] = 0;
     }
 
     // Destroy all graphics pipeline objects.
@@ -139,6 +166,8 @@ void RsrcProcMgr::Cleanup()
             m_pGraphicsPipelines[idx]->DestroyInternal();
             m_pGraphicsPipelines[idx] = nullptr;
         }
+
+        m_graphicsPipelineReady[idx] = 0;
     }
 
     m_pDevice->DestroyColorBlendStateInternal(m_pBlendDisableState);
@@ -189,7 +218,7 @@ Result RsrcProcMgr::EarlyInit()
     // Round up to the size of a DWORD.
     m_srdAlignment = Util::NumBytesToNumDwords(m_srdAlignment);
 
-    return Result::Success;
+    return m_pipelineLock.Init();
 }
 
 // =====================================================================================================================
@@ -200,23 +229,255 @@ Result RsrcProcMgr::LateInit()
 
     if (m_pDevice->Parent()->GetPublicSettings()->disableResourceProcessingManager == false)
     {
-        result = CreateRpmComputePipelines(m_pDevice, m_pComputePipelines);
+        const PalSettings& settings = m_pDevice->CoreSettings();
+
+        // By default every RPM pipeline is created here so that a creation failure fails device creation. Most
+        // processes only ever use a handful of them, so the lazy creation setting defers each one to its first use.
+        if (settings.rpmLazyPipelineCreation == false)
+        {
+            uint32 numThreads = settings.rpmInitThreadCount;
+
+            if (numThreads == 0)
+            {
+                SystemInfo systemInfo = { };
+                numThreads = (QuerySystemInfo(&systemInfo) == Result::Success) ? systemInfo.cpuLogicalCoreCount : 1;
+            }
+
+            result = CreateAllPipelines(Min(Max(numThreads, 1u), MaxRpmInitThreads), true);
+        }
+        else
+        {
+            result = CreateCommonStateObjects();
+        }
+
+        if ((result == Result::Success) && settings.rpmLazyPipelineCreation && settings.rpmPrewarmPipelines)
+        {
+            // Failing to start the thread isn't fatal: every pipeline will still be created on its first use.
+            const Result threadResult = m_prewarmThread.Begin(&PrewarmPipelines, this);
+            PAL_ALERT(threadResult != Result::Success);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates the specified RPM compute pipeline unless it already exists or is known to be unsupported. If several threads
+// race to create the same pipeline, the first one to finish wins and the others discard their copy. Pipelines which
+// aren't supported by this device are left null.
+Result RsrcProcMgr::CreateComputePipeline(
+    RpmComputePipeline pipeline
+    ) const
+{
+    const uint32 index  = static_cast<uint32>(pipeline);
+    Result       result = Result::Success;
+
+    if (m_computePipelineReady[index] == 0)
+    {
+        ComputePipeline* pPipeline = nullptr;
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+        const int64 startTime = GetPerfCpuTime();
+#endif
+
+        // The pipeline is created outside of the lock so that different pipelines can be created in parallel.
+        if (m_pDevice->Parent()->GetPublicSettings()->disableResourceProcessingManager == false)
+        {
+            result = CreateRpmComputePipeline(pipeline, m_pDevice, &pPipeline);
+        }
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+        if (m_pDevice->CoreSettings().rpmLogPipelineCreationTime && (pPipeline != nullptr))
+        {
+            PAL_DPINFO("RPM compute pipeline %u created in %.3f ms.",
+                       index,
+                       (1000.0 * (GetPerfCpuTime() - startTime)) / GetPerfFrequency());
+        }
+#endif
 
         if (result == Result::Success)
         {
-            result = CreateRpmGraphicsPipelines(m_pDevice, m_pGraphicsPipelines);
+            MutexAuto lock(&m_pipelineLock);
+
+            if (m_computePipelineReady[index] == 0)
+            {
+                // Publish the pipeline only once it is fully created, since lookups read it without taking the lock.
+                // A null pipeline is still marked as ready so that later lookups don't try to create it again.
+                AtomicExchangePointer(reinterpret_cast<void*volatile*>(&m_pComputePipelines[index]), pPipeline);
+                AtomicExchange(&m_computePipelineReady[index], 1);
+            }
+            else if (pPipeline != nullptr)
+            {
+                // Another thread created the same pipeline first.
+                pPipeline->DestroyInternal();
+            }
+        }
+
+        PAL_ALERT(result != Result::Success);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates the specified RPM graphics pipeline unless it already exists or is known to be unsupported. If several
+// threads race to create the same pipeline, the first one to finish wins and the others discard their copy. Pipelines
+// which aren't supported by this device are left null.
+Result RsrcProcMgr::CreateGraphicsPipeline(
+    RpmGfxPipeline pipeline
+    ) const
+{
+    Result result = Result::Success;
+
+    if (m_graphicsPipelineReady[pipeline] == 0)
+    {
+        GraphicsPipeline* pPipeline = nullptr;
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+        const int64 startTime = GetPerfCpuTime();
+#endif
+
+        // The pipeline is created outside of the lock so that different pipelines can be created in parallel.
+        if (m_pDevice->Parent()->GetPublicSettings()->disableResourceProcessingManager == false)
+        {
+            result = CreateRpmGraphicsPipeline(pipeline, m_pDevice, &pPipeline);
         }
 
+#if PAL_ENABLE_PRINTS_ASSERTS
+        if (m_pDevice->CoreSettings().rpmLogPipelineCreationTime && (pPipeline != nullptr))
+        {
+            PAL_DPINFO("RPM graphics pipeline %u created in %.3f ms.",
+                       static_cast<uint32>(pipeline),
+                       (1000.0 * (GetPerfCpuTime() - startTime)) / GetPerfFrequency());
+        }
+#endif
+
         if (result == Result::Success)
         {
-            result = CreateCommonStateObjects();
+            MutexAuto lock(&m_pipelineLock);
+
+            if (m_graphicsPipelineReady[pipeline] == 0)
+            {
+                // Publish the pipeline only once it is fully created, since lookups read it without taking the lock.
+                // A null pipeline is still marked as ready so that later lookups don't try to create it again.
+                AtomicExchangePointer(reinterpret_cast<void*volatile*>(&m_pGraphicsPipelines[pipeline]), pPipeline);
+                AtomicExchange(&m_graphicsPipelineReady[pipeline], 1);
+            }
+            else if (pPipeline != nullptr)
+            {
+                // Another thread created the same pipeline first.
+                pPipeline->DestroyInternal();
+            }
         }
 
+        PAL_ALERT(result != Result::Success);
     }
 
     return result;
 }
 
+// =====================================================================================================================
+// Creates every RPM pipeline which hasn't been created yet using numThreads threads, including the calling one. If
+// requested, the calling thread creates the common state objects while the other threads start on the pipelines. Stops
+// at the first failure or when the pre-warm thread is asked to stop.
+Result RsrcProcMgr::CreateAllPipelines(
+    uint32 numThreads,
+    bool   createStateObjects)
+{
+    PAL_ASSERT((numThreads >= 1) && (numThreads <= MaxRpmInitThreads));
+
+    m_nextPipeline   = 0;
+    m_pipelineResult = static_cast<uint32>(Result::Success);
+
+    Thread workers[MaxRpmInitThreads - 1];
+    uint32 numWorkers = 0;
+
+    // Starting fewer workers than requested isn't an error; the remaining threads simply pick up more pipelines.
+    while ((numWorkers < (numThreads - 1)) && (workers[numWorkers].Begin(&PipelineWorker, this) == Result::Success))
+    {
+        numWorkers++;
+    }
+
+    Result result = Result::Success;
+
+    if (createStateObjects)
+    {
+        result = CreateCommonStateObjects();
+
+        if (result != Result::Success)
+        {
+            // Tell the workers to stop early.
+            AtomicCompareAndSwap(&m_pipelineResult,
+                                 static_cast<uint32>(Result::Success),
+                                 static_cast<uint32>(result));
+        }
+    }
+
+    CreateClaimedPipelines();
+
+    for (uint32 idx = 0; idx < numWorkers; ++idx)
+    {
+        workers[idx].Join();
+    }
+
+    if (result == Result::Success)
+    {
+        result = static_cast<Result>(m_pipelineResult);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Repeatedly claims the next pipeline from the list of all compute pipelines followed by all graphics pipelines and
+// creates it, until every pipeline has been claimed, one of them failed or the pre-warm thread is asked to stop.
+void RsrcProcMgr::CreateClaimedPipelines()
+{
+    constexpr uint32 NumComputePipelines = static_cast<uint32>(RpmComputePipeline::Count);
+    constexpr uint32 NumPipelines        = NumComputePipelines + RpmGfxPipelineCount;
+
+    for (uint32 idx = AtomicIncrement(&m_nextPipeline) - 1;
+         (idx < NumPipelines) && (m_pipelineResult == static_cast<uint32>(Result::Success)) && (m_stopPrewarm == 0);
+         idx = AtomicIncrement(&m_nextPipeline) - 1)
+    {
+        const Result result =
+            (idx < NumComputePipelines) ?
+            CreateComputePipeline(static_cast<RpmComputePipeline>(idx)) :
+            CreateGraphicsPipeline(static_cast<RpmGfxPipeline>(idx - NumComputePipelines));
+
+        if (result != Result::Success)
+        {
+            AtomicCompareAndSwap(&m_pipelineResult,
+                                 static_cast<uint32>(Result::Success),
+                                 static_cast<uint32>(result));
+        }
+    }
+}
+
+// =====================================================================================================================
+// Entry point of the worker threads started by CreateAllPipelines.
+void RsrcProcMgr::PipelineWorker(
+    void* pRsrcProcMgr)
+{
+    static_cast<RsrcProcMgr*>(pRsrcProcMgr)->CreateClaimedPipelines();
+}
+
+// =====================================================================================================================
+// Entry point of the pre-warm thread: creates the RPM pipelines which haven't been used yet so that command buffers
+// don't pay for their creation later.
+void RsrcProcMgr::PrewarmPipelines(
+    void* pRsrcProcMgr)
+{
+    const int64  startTime = GetPerfCpuTime();
+    const Result result    = static_cast<RsrcProcMgr*>(pRsrcProcMgr)->CreateAllPipelines(1, false);
+
+    // Any pipeline which couldn't be created here will be retried on its first use.
+    PAL_ALERT(result != Result::Success);
+
+    PAL_DPINFO("RPM pipeline pre-warm finished in %.3f ms.",
+               (1000.0 * (GetPerfCpuTime() - startTime)) / GetPerfFrequency());
+}
+
 // =====================================================================================================================
 // Builds commands to copy one or more regions from one GPU memory location to another with a compute shader.
 void RsrcProcMgr::CopyMemoryCs(
@@ -28,6 +28,8 @@
 #include "core/hw/gfxip/rpm/g_rpmComputePipelineInit.h"
 #include "core/hw/gfxip/rpm/g_rpmGfxPipelineInit.h"
 #include "palCmdBuffer.h"
+#include "palMutex.h"
+#include "palThread.h"
 
 namespace Pal
 {
@@ -278,11 +280,24 @@ protected:
         const IndirectCmdGenerator& generator,
         const CmdBuffer&            cmdBuffer) const = 0;
 
+    // RPM pipelines may be created on their first use; looking up a pipeline which already exists never takes a lock.
     const ComputePipeline* GetPipeline(RpmComputePipeline pipeline) const
-        { return m_pComputePipelines[static_cast<size_t>(pipeline)]; }
+    {
+        if (m_computePipelineReady[static_cast<size_t>(pipeline)] == 0)
+        {
+            CreateComputePipeline(pipeline);
+        }
+        return m_pComputePipelines[static_cast<size_t>(pipeline)];
+    }
 
     const GraphicsPipeline* GetGfxPipeline(RpmGfxPipeline pipeline) const
-        { return m_pGraphicsPipelines[pipeline]; }
+    {
+        if (m_graphicsPipelineReady[pipeline] == 0)
+        {
+            CreateGraphicsPipeline(pipeline);
+        }
+        return m_pGraphicsPipelines[pipeline];
+    }
 
     const MsaaState* GetMsaaState(uint32 samples, uint32 fragments) const;
 
@@ -355,6 +370,14 @@ protected:
 private:
     virtual Result CreateCommonStateObjects();
 
+    Result CreateComputePipeline(RpmComputePipeline pipeline) const;
+    Result CreateGraphicsPipeline(RpmGfxPipeline pipeline) const;
+    Result CreateAllPipelines(uint32 numThreads, bool createStateObjects);
+    void CreateClaimedPipelines();
+
+    static void PrewarmPipelines(void* pRsrcProcMgr);
+    static void PipelineWorker(void* pRsrcProcMgr);
+
     virtual void HwlFastColorClear(
         GfxCmdBuffer*      pCmdBuffer,
         const GfxImage&    dstImage,
@@ -606,9 +629,21 @@ private:
     GfxDevice*const  m_pDevice;
     uint32           m_srdAlignment; // All SRDs must be offset and size aligned to this many DWORDs.
 
-    // All internal RPM pipelines are stored here.
-    ComputePipeline*   m_pComputePipelines[static_cast<size_t>(RpmComputePipeline::Count)];
-    GraphicsPipeline*  m_pGraphicsPipelines[RpmGfxPipelineCount];
+    // All internal RPM pipelines are stored here.  If RpmLazyPipelineCreation is enabled, each one is created the
+    // first time it is looked up and is published atomically so later lookups can read it without taking a lock.
+    mutable ComputePipeline*volatile   m_pComputePipelines[static_cast<size_t>(RpmComputePipeline::Count)];
+    mutable GraphicsPipeline*volatile  m_pGraphicsPipelines[RpmGfxPipelineCount];
+
+    // Non-zero once the matching pipeline has been created or found to be unsupported on this device, so lookups of
+    // pipelines which are intentionally null don't retry their creation.  Failed creations are not recorded here.
+    mutable volatile uint32  m_computePipelineReady[static_cast<size_t>(RpmComputePipeline::Count)];
+    mutable volatile uint32  m_graphicsPipelineReady[RpmGfxPipelineCount];
+
+    mutable Util::Mutex  m_pipelineLock;    // Serializes publishing newly created pipelines.
+    Util::Thread         m_prewarmThread;   // Creates the remaining pipelines in the background if enabled.
+    volatile uint32      m_stopPrewarm;     // Non-zero when the pre-warm thread should stop creating pipelines.
+    volatile uint32      m_nextPipeline;    // Next pipeline index to be claimed by CreateAllPipelines' threads.
+    volatile uint32      m_pipelineResult;  // First failure seen by CreateAllPipelines' threads, or Success.
 
     PAL_DISALLOW_DEFAULT_CTOR(RsrcProcMgr);
     PAL_DISALLOW_COPY_AND_ASSIGN(RsrcProcMgr);
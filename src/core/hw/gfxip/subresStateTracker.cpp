@@ -0,0 +1,210 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/hw/gfxip/subresStateTracker.h"
+#include "palAssert.h"
+#include "palInlineFuncs.h"
+
+namespace Pal
+{
+
+// =====================================================================================================================
+// Returns true if the given entry shares at least one subresource with the specified range of an image.
+bool SubresStateTracker::Overlaps(
+    const Entry&       entry,
+    const IImage*      pImage,
+    const SubresRange& range)
+{
+    const uint32 firstMip   = range.startSubres.mipLevel;
+    const uint32 firstSlice = range.startSubres.arraySlice;
+
+    return ((entry.pImage == pImage)                            &&
+            (entry.aspect == range.startSubres.aspect)          &&
+            (entry.firstMip < (firstMip + range.numMips))       &&
+            (firstMip < entry.endMip)                           &&
+            (entry.firstSlice < (firstSlice + range.numSlices)) &&
+            (firstSlice < entry.endSlice));
+}
+
+// =====================================================================================================================
+// Removes an entry while keeping the remaining entries sorted from oldest to newest.
+void SubresStateTracker::RemoveEntry(
+    uint32 index)
+{
+    PAL_ASSERT(index < m_numEntries);
+
+    for (uint32 idx = index + 1; idx < m_numEntries; ++idx)
+    {
+        m_entries[idx - 1] = m_entries[idx];
+    }
+
+    m_numEntries--;
+}
+
+// =====================================================================================================================
+// Looks up the tracked state of a subresource range. Returns true and writes the state to pState only if every
+// subresource in the range is known to be in that same state.
+bool SubresStateTracker::Lookup(
+    const IImage*      pImage,
+    const SubresRange& range,
+    uint32*            pState
+    ) const
+{
+    PAL_ASSERT(pState != nullptr);
+
+    const uint32 firstMip   = range.startSubres.mipLevel;
+    const uint32 firstSlice = range.startSubres.arraySlice;
+    bool         found      = false;
+
+    // Entries never overlap and adjacent entries with the same state are merged, so the range is either covered by a
+    // single entry or its state isn't fully known.
+    for (uint32 idx = 0; idx < m_numEntries; ++idx)
+    {
+        const Entry& entry = m_entries[idx];
+
+        if ((entry.pImage == pImage)                          &&
+            (entry.aspect == range.startSubres.aspect)        &&
+            (entry.firstMip <= firstMip)                      &&
+            ((firstMip + range.numMips) <= entry.endMip)      &&
+            (entry.firstSlice <= firstSlice)                  &&
+            ((firstSlice + range.numSlices) <= entry.endSlice))
+        {
+            *pState = entry.state;
+            found   = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Records that every subresource in the given range is now in the specified state.
+void SubresStateTracker::Update(
+    const IImage*      pImage,
+    const SubresRange& range,
+    uint32             state)
+{
+    uint32 currentState = 0;
+
+    if ((Lookup(pImage, range, &currentState) == false) || (currentState != state))
+    {
+        // Forget whatever we knew about any subresource in the range. Entries which only partially overlap the range
+        // are dropped entirely instead of being split.
+        Invalidate(pImage, range);
+
+        Entry newEntry = {};
+        newEntry.pImage     = pImage;
+        newEntry.aspect     = range.startSubres.aspect;
+        newEntry.firstMip   = range.startSubres.mipLevel;
+        newEntry.endMip     = range.startSubres.mipLevel + range.numMips;
+        newEntry.firstSlice = range.startSubres.arraySlice;
+        newEntry.endSlice   = range.startSubres.arraySlice + range.numSlices;
+        newEntry.state      = state;
+
+        // Merge the new entry with any neighbors in the same state which span the same mips or the same slices. This
+        // keeps the entry count low when a client transitions an image one subresource at a time.
+        bool merged = true;
+
+        while (merged)
+        {
+            merged = false;
+
+            for (uint32 idx = 0; idx < m_numEntries; ++idx)
+            {
+                const Entry& entry = m_entries[idx];
+
+                if ((entry.pImage != pImage) || (entry.aspect != newEntry.aspect) || (entry.state != state))
+                {
+                    continue;
+                }
+
+                const bool sameMips   = ((entry.firstMip == newEntry.firstMip) && (entry.endMip == newEntry.endMip));
+                const bool sameSlices = ((entry.firstSlice == newEntry.firstSlice) &&
+                                         (entry.endSlice   == newEntry.endSlice));
+
+                if (sameMips &&
+                    ((entry.endSlice == newEntry.firstSlice) || (newEntry.endSlice == entry.firstSlice)))
+                {
+                    newEntry.firstSlice = Util::Min(entry.firstSlice, newEntry.firstSlice);
+                    newEntry.endSlice   = Util::Max(entry.endSlice,   newEntry.endSlice);
+                    merged              = true;
+                }
+                else if (sameSlices &&
+                         ((entry.endMip == newEntry.firstMip) || (newEntry.endMip == entry.firstMip)))
+                {
+                    newEntry.firstMip = Util::Min(entry.firstMip, newEntry.firstMip);
+                    newEntry.endMip   = Util::Max(entry.endMip,   newEntry.endMip);
+                    merged            = true;
+                }
+
+                if (merged)
+                {
+                    RemoveEntry(idx);
+                    break;
+                }
+            }
+        }
+
+        if (m_numEntries == MaxEntries)
+        {
+            // Evict the oldest entry to make room.
+            RemoveEntry(0);
+        }
+
+        m_entries[m_numEntries++] = newEntry;
+    }
+}
+
+// =====================================================================================================================
+// Forgets the tracked state of every subresource in the given range.
+void SubresStateTracker::Invalidate(
+    const IImage*      pImage,
+    const SubresRange& range)
+{
+    for (uint32 idx = m_numEntries; idx > 0; --idx)
+    {
+        if (Overlaps(m_entries[idx - 1], pImage, range))
+        {
+            RemoveEntry(idx - 1);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Forgets the tracked state of every subresource of the given image.
+void SubresStateTracker::InvalidateImage(
+    const IImage* pImage)
+{
+    for (uint32 idx = m_numEntries; idx > 0; --idx)
+    {
+        if (m_entries[idx - 1].pImage == pImage)
+        {
+            RemoveEntry(idx - 1);
+        }
+    }
+}
+
+} // Pal
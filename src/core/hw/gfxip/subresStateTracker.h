@@ -0,0 +1,81 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palImage.h"
+
+namespace Pal
+{
+
+// =====================================================================================================================
+// Tracks the known metadata state (e.g., the compression state of a color or depth/stencil image) of image subresource
+// ranges within a single command buffer.
+//
+// Each entry covers a contiguous block of mip levels and array slices of one aspect of an image.  Entries never
+// overlap; a subresource which isn't covered by any entry has an unknown state and the caller must fall back to
+// whatever the client's image layouts claim.  Forgetting an entry is always safe, so the tracker drops entries rather
+// than splitting them and evicts its oldest entry when it runs out of room.
+//
+// The meaning of the tracked state values is up to the hardware layer which records them.
+class SubresStateTracker
+{
+public:
+    SubresStateTracker() : m_numEntries(0) { }
+    ~SubresStateTracker() { }
+
+    bool IsEmpty() const { return (m_numEntries == 0); }
+    void Reset() { m_numEntries = 0; }
+
+    bool Lookup(const IImage* pImage, const SubresRange& range, uint32* pState) const;
+    void Update(const IImage* pImage, const SubresRange& range, uint32 state);
+    void Invalidate(const IImage* pImage, const SubresRange& range);
+    void InvalidateImage(const IImage* pImage);
+
+private:
+    // Maximum number of subresource ranges which can be tracked at once.
+    static constexpr uint32 MaxEntries = 64;
+
+    struct Entry
+    {
+        const IImage* pImage;
+        ImageAspect   aspect;
+        uint32        firstMip;
+        uint32        endMip;     // One past the last mip level covered by this entry.
+        uint32        firstSlice;
+        uint32        endSlice;   // One past the last array slice covered by this entry.
+        uint32        state;
+    };
+
+    static bool Overlaps(const Entry& entry, const IImage* pImage, const SubresRange& range);
+    void RemoveEntry(uint32 index);
+
+    Entry  m_entries[MaxEntries];
+    uint32 m_numEntries;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(SubresStateTracker);
+};
+
+} // Pal
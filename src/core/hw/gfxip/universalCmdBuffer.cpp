@@ -315,12 +315,8 @@ void PAL_STDCALL UniversalCmdBuffer::CmdSetUserDataGfx(
         }
         else
         {
-            const uint32 entryLimit = (userDataArgs.firstEntry + userDataArgs.entryCount);
-            for (uint32 e = userDataArgs.firstEntry; e < entryLimit ; ++e)
-            {
-                WideBitfieldSetBit(pEntries->touched, e);
-                WideBitfieldSetBit(pEntries->dirty,   e);
-            }
+            WideBitfieldSetRange(pEntries->touched, userDataArgs.firstEntry, userDataArgs.entryCount);
+            WideBitfieldSetRange(pEntries->dirty,   userDataArgs.firstEntry, userDataArgs.entryCount);
 
             memcpy(&pEntries->entries[userDataArgs.firstEntry],
                    userDataArgs.pEntryValues,
@@ -359,6 +355,25 @@ bool UniversalCmdBuffer::FilterSetUserDataGfx(
     uint32        entryCount   = pUserDataArgs->entryCount;
     const uint32* pEntryValues = pUserDataArgs->pEntryValues;
 
+    // The most common case is a whole range of previously set entries being set to the same values again (e.g., root
+    // constants which are re-specified before every draw). A single touched-run scan and memcmp rejects it without
+    // comparing the entries one at a time.
+    uint32 touchedFirst = 0;
+    uint32 touchedCount = 0;
+    if (WideBitfieldScanRun(m_graphicsState.gfxUserDataEntries.touched,
+                            firstEntry,
+                            (firstEntry + entryCount),
+                            &touchedFirst,
+                            &touchedCount)                                      &&
+        (touchedFirst == firstEntry)                                            &&
+        (touchedCount == entryCount)                                            &&
+        (memcmp(pEntryValues,
+                &m_graphicsState.gfxUserDataEntries.entries[firstEntry],
+                (sizeof(uint32) * entryCount)) == 0))
+    {
+        entryCount = 0;
+    }
+
     // Adjust the start entry and entry value pointer for any redundant entries found at the beginning of the range.
     while ((entryCount > 0) &&
            (*pEntryValues == m_graphicsState.gfxUserDataEntries.entries[firstEntry]) &&
@@ -481,6 +496,39 @@ void UniversalCmdBuffer::CmdSetLineStippleState(
     m_graphicsState.dirtyFlags.validationBits.lineStippleState = 1;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+// Issues a batch of draws by splitting it back into the equivalent sequence of CmdSetUserData and CmdDraw or
+// CmdDrawIndexed calls.  Hardware layers which can validate the batch's shared state only once override this.
+void UniversalCmdBuffer::CmdDrawBatch(
+    const DrawBatchInfo& batchInfo)
+{
+    PAL_ASSERT((batchInfo.drawCount == 0) || (batchInfo.pDraws != nullptr));
+
+    for (uint32 i = 0; i < batchInfo.drawCount; ++i)
+    {
+        const DrawBatchEntry& draw = batchInfo.pDraws[i];
+
+        if (draw.userDataEntryCount != 0)
+        {
+            CmdSetUserData(PipelineBindPoint::Graphics,
+                           draw.firstUserDataEntry,
+                           draw.userDataEntryCount,
+                           draw.pUserDataEntries);
+        }
+
+        if (batchInfo.flags.indexed != 0)
+        {
+            CmdDrawIndexed(draw.first, draw.count, draw.vertexOffset, draw.firstInstance, draw.instanceCount);
+        }
+        else
+        {
+            CmdDraw(draw.first, draw.count, draw.firstInstance, draw.instanceCount);
+        }
+    }
+}
+#endif
+
 #if PAL_ENABLE_PRINTS_ASSERTS
 // =====================================================================================================================
 // Dumps this command buffer's DE and CE command streams to the given file with an appropriate header.
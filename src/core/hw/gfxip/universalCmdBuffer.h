@@ -207,6 +207,11 @@ public:
     virtual void CmdSetLineStippleState(
         const LineStippleStateParams& params) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdDrawBatch(
+        const DrawBatchInfo& batchInfo) override;
+#endif
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     // This function allows us to dump the contents of this command buffer to a file at submission time.
     virtual void DumpCmdStreamsToFile(Util::File* pFile, CmdBufDumpFormat mode) const override;
@@ -1192,6 +1192,22 @@ void CmdBuffer::CmdBindDepthStencilState(
     GetNextLayer()->CmdBindDepthStencilState(NextDepthStencilState(pDepthStencilState));
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBuffer::CmdBindStateBlock(
+    const IStateBlock* pStateBlock)
+{
+    if (m_annotations.logCmdBinds)
+    {
+        GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdBindStateBlock));
+
+        // TODO: Add comment string.
+    }
+
+    GetNextLayer()->CmdBindStateBlock(NextStateBlock(pStateBlock));
+}
+#endif
+
 // =====================================================================================================================
 void CmdBuffer::CmdBindIndexData(
     gpusize   gpuAddr,
@@ -3205,6 +3221,56 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndexedIndirectMulti(
     pThis->HandleDrawDispatch(Developer::DrawDispatchType::CmdDrawIndexedIndirectMulti);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+// The batch is split back into individual calls through this layer so that every draw is annotated and handled just
+// like a draw recorded on its own would be.
+void CmdBuffer::CmdDrawBatch(
+    const DrawBatchInfo& batchInfo)
+{
+    if (m_annotations.logCmdDraws)
+    {
+        GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDrawBatch));
+
+        LinearAllocatorAuto<VirtualLinearAllocator> allocator(Allocator(), false);
+        char* pString = PAL_NEW_ARRAY(char, StringLength, &allocator, AllocInternalTemp);
+
+        Snprintf(pString, StringLength, "Indexed    = %u", batchInfo.flags.indexed);
+        GetNextLayer()->CmdCommentString(pString);
+        Snprintf(pString, StringLength, "Draw Count = %u", batchInfo.drawCount);
+        GetNextLayer()->CmdCommentString(pString);
+
+        PAL_SAFE_DELETE_ARRAY(pString, &allocator);
+    }
+
+    for (uint32 i = 0; i < batchInfo.drawCount; ++i)
+    {
+        const DrawBatchEntry& draw = batchInfo.pDraws[i];
+
+        if (draw.userDataEntryCount != 0)
+        {
+            CmdSetUserData(PipelineBindPoint::Graphics,
+                           draw.firstUserDataEntry,
+                           draw.userDataEntryCount,
+                           draw.pUserDataEntries);
+        }
+
+        if (batchInfo.flags.indexed != 0)
+        {
+            ICmdBuffer::CmdDrawIndexed(draw.first,
+                                       draw.count,
+                                       draw.vertexOffset,
+                                       draw.firstInstance,
+                                       draw.instanceCount);
+        }
+        else
+        {
+            ICmdBuffer::CmdDraw(draw.first, draw.count, draw.firstInstance, draw.instanceCount);
+        }
+    }
+}
+#endif
+
 // =====================================================================================================================
 void PAL_STDCALL CmdBuffer::CmdDispatch(
     ICmdBuffer* pCmdBuffer,
@@ -4820,6 +4886,33 @@ void CmdBuffer::CmdExecuteNestedCmdBuffers(
     PAL_SAFE_DELETE_ARRAY(ppNextCmdBuffers, &allocator);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBuffer::CmdInsertSegments(
+    uint32            segmentCount,
+    ICmdBuffer*const* ppSegments)
+{
+    if (m_annotations.logMiscellaneous)
+    {
+        GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdInsertSegments));
+
+        // TODO: Add comment string.
+    }
+
+    Util::LinearAllocatorAuto<Util::VirtualLinearAllocator> allocator(&m_allocator, false);
+
+    ICmdBuffer** ppNextSegments = PAL_NEW_ARRAY(ICmdBuffer*, segmentCount, &allocator, AllocInternalTemp);
+
+    for (uint32 i = 0; i < segmentCount; i++)
+    {
+        ppNextSegments[i] = static_cast<CmdBuffer*>(ppSegments[i])->GetNextLayer();
+    }
+    GetNextLayer()->CmdInsertSegments(segmentCount, ppNextSegments);
+
+    PAL_SAFE_DELETE_ARRAY(ppNextSegments, &allocator);
+}
+#endif
+
 // =====================================================================================================================
 void CmdBuffer::CmdExecuteIndirectCmds(
     const IIndirectCmdGenerator& generator,
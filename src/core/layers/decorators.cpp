@@ -250,6 +250,27 @@ IScreen* NextScreen(
            nullptr;
 }
 
+// =====================================================================================================================
+IStateBlock* NextStateBlock(
+    const IStateBlock* pStateBlock)
+{
+    return (pStateBlock != nullptr) ?
+            static_cast<const StateBlockDecorator*>(pStateBlock)->GetNextLayer() :
+            nullptr;
+}
+
+// =====================================================================================================================
+StateBlockCreateInfo NextStateBlockCreateInfo(
+    const StateBlockCreateInfo& createInfo)
+{
+    StateBlockCreateInfo nextCreateInfo = createInfo;
+    nextCreateInfo.pMsaaState         = NextMsaaState(createInfo.pMsaaState);
+    nextCreateInfo.pColorBlendState   = NextColorBlendState(createInfo.pColorBlendState);
+    nextCreateInfo.pDepthStencilState = NextDepthStencilState(createInfo.pDepthStencilState);
+
+    return nextCreateInfo;
+}
+
 // =====================================================================================================================
 ISwapChain* NextSwapChain(
     const ISwapChain* pSwapChain)
@@ -1259,6 +1280,42 @@ Result DeviceDecorator::CreateDepthStencilState(
     return result;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+size_t DeviceDecorator::GetStateBlockSize(
+    const StateBlockCreateInfo& createInfo,
+    Result*                     pResult
+    ) const
+{
+    return m_pNextLayer->GetStateBlockSize(NextStateBlockCreateInfo(createInfo), pResult) +
+           sizeof(StateBlockDecorator);
+}
+
+// =====================================================================================================================
+Result DeviceDecorator::CreateStateBlock(
+    const StateBlockCreateInfo& createInfo,
+    void*                       pPlacementAddr,
+    IStateBlock**               ppStateBlock
+    ) const
+{
+    IStateBlock* pStateBlock = nullptr;
+
+    Result result = m_pNextLayer->CreateStateBlock(NextStateBlockCreateInfo(createInfo),
+                                                   NextObjectAddr<StateBlockDecorator>(pPlacementAddr),
+                                                   &pStateBlock);
+
+    if (result == Result::Success)
+    {
+        PAL_ASSERT(pStateBlock != nullptr);
+        pStateBlock->SetClientData(pPlacementAddr);
+
+        (*ppStateBlock) = PAL_PLACEMENT_NEW(pPlacementAddr) StateBlockDecorator(pStateBlock, this);
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 size_t DeviceDecorator::GetQueueSemaphoreSize(
     const QueueSemaphoreCreateInfo& createInfo,
@@ -2131,6 +2188,31 @@ void CmdBufferFwdDecorator::CmdExecuteNestedCmdBuffers(
     }
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBufferFwdDecorator::CmdInsertSegments(
+    uint32            segmentCount,
+    ICmdBuffer*const* ppSegments)
+{
+    AutoBuffer<ICmdBuffer*, 16, PlatformDecorator> nextSegments(segmentCount, m_pDevice->GetPlatform());
+
+    if (nextSegments.Capacity() < segmentCount)
+    {
+        // If the layers become production code, we must set a flag here and return out of memory on End().
+        PAL_ASSERT_ALWAYS();
+    }
+    else
+    {
+        for (uint32 i = 0; i < segmentCount; ++i)
+        {
+            nextSegments[i] = NextCmdBuffer(ppSegments[i]);
+        }
+
+        m_pNextLayer->CmdInsertSegments(segmentCount, &nextSegments[0]);
+    }
+}
+#endif
+
 // =====================================================================================================================
 void CmdBufferFwdDecorator::CmdScaledCopyImage(
     const ScaledCopyInfo& copyInfo)
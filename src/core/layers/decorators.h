@@ -50,6 +50,7 @@
 #include "palQueue.h"
 #include "palQueueSemaphore.h"
 #include "palScreen.h"
+#include "palStateBlock.h"
 #include "palSwapChain.h"
 #include "palSysMemory.h"
 
@@ -107,6 +108,7 @@ class QueueDecorator;
 class QueueSemaphoreDecorator;
 class ScreenDecorator;
 class ScissorStateDecorator;
+class StateBlockDecorator;
 class ViewportStateDecorator;
 
 extern IBorderColorPalette*   NextBorderColorPalette(const IBorderColorPalette* pBorderColorPalette);
@@ -134,6 +136,8 @@ extern IQueue*                NextQueue(const IQueue* pQueue);
 extern IQueueSemaphore*       NextQueueSemaphore(const IQueueSemaphore* pQueueSemaphore);
 extern IScreen*               NextScreen(const IScreen* pScreen);
 extern IScissorState*         NextScissorState(const IScissorState* pScissorState);
+extern IStateBlock*           NextStateBlock(const IStateBlock* pStateBlock);
+extern StateBlockCreateInfo   NextStateBlockCreateInfo(const StateBlockCreateInfo& createInfo);
 extern ISwapChain*            NextSwapChain(const ISwapChain* pSwapChain);
 extern IViewportState*        NextViewportState(const IViewportState* pViewportState);
 
@@ -843,6 +847,18 @@ public:
         const DepthStencilStateCreateInfo& createInfo,
         void*                              pPlacementAddr,
         IDepthStencilState**               ppDepthStencilState) const override;
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual size_t GetStateBlockSize(
+        const StateBlockCreateInfo& createInfo,
+        Result*                     pResult) const override;
+
+    virtual Result CreateStateBlock(
+        const StateBlockCreateInfo& createInfo,
+        void*                       pPlacementAddr,
+        IStateBlock**               ppStateBlock) const override;
+#endif
+
     virtual size_t GetQueueSemaphoreSize(
         const QueueSemaphoreCreateInfo& createInfo,
         Result*                         pResult) const override;
@@ -1300,6 +1316,11 @@ public:
     virtual void CmdBindDepthStencilState(
         const IDepthStencilState* pDepthStencilState) override
         { m_pNextLayer->CmdBindDepthStencilState(NextDepthStencilState(pDepthStencilState)); }
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdBindStateBlock(
+        const IStateBlock* pStateBlock) override
+        { m_pNextLayer->CmdBindStateBlock(NextStateBlock(pStateBlock)); }
+#endif
 
     virtual void CmdSetVertexBuffers(
         uint32                firstBuffer,
@@ -1970,6 +1991,15 @@ public:
     virtual void CmdExecuteNestedCmdBuffers(
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdInsertSegments(
+        uint32            segmentCount,
+        ICmdBuffer*const* ppSegments) override;
+
+    virtual void CmdDrawBatch(
+        const DrawBatchInfo& batchInfo) override
+        { m_pNextLayer->CmdDrawBatch(batchInfo); }
+#endif
 
     virtual void CmdSaveComputeState(
         uint32 stateFlags) override
@@ -2909,6 +2939,37 @@ private:
     PAL_DISALLOW_COPY_AND_ASSIGN(QueueSemaphoreDecorator);
 };
 
+// =====================================================================================================================
+class StateBlockDecorator : public IStateBlock
+{
+public:
+    StateBlockDecorator(IStateBlock* pNextStateBlock, const DeviceDecorator* pNextDevice)
+        :
+        m_pNextLayer(pNextStateBlock), m_pDevice(pNextDevice)
+    {}
+
+    // Part of the IDestroyable public interface.
+    virtual void Destroy() override
+    {
+        IStateBlock* pNextLayer = m_pNextLayer;
+        this->~StateBlockDecorator();
+        pNextLayer->Destroy();
+    }
+
+    const IDevice*  GetDevice() const { return m_pDevice; }
+    IStateBlock*    GetNextLayer() const { return m_pNextLayer; }
+
+protected:
+    virtual ~StateBlockDecorator() {}
+
+    IStateBlock*const           m_pNextLayer;
+    const DeviceDecorator*const m_pDevice;
+
+private:
+    PAL_DISALLOW_DEFAULT_CTOR(StateBlockDecorator);
+    PAL_DISALLOW_COPY_AND_ASSIGN(StateBlockDecorator);
+};
+
 // =====================================================================================================================
 class PrivateScreenDecorator : public IPrivateScreen
 {
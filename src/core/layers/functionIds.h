@@ -41,6 +41,9 @@ enum class CmdBufCallId : uint32
     CmdBindMsaaState,
     CmdBindColorBlendState,
     CmdBindDepthStencilState,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    CmdBindStateBlock,
+#endif
     CmdBindIndexData,
     CmdBindTargets,
     CmdBindStreamOutTargets,
@@ -75,6 +78,9 @@ enum class CmdBufCallId : uint32
     CmdDrawIndexed,
     CmdDrawIndirectMulti,
     CmdDrawIndexedIndirectMulti,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    CmdDrawBatch,
+#endif
     CmdDispatch,
     CmdDispatchIndirect,
     CmdDispatchOffset,
@@ -121,6 +127,9 @@ enum class CmdBufCallId : uint32
     CmdWriteCeRam,
     CmdDumpCeRam,
     CmdExecuteNestedCmdBuffers,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    CmdInsertSegments,
+#endif
     CmdExecuteIndirectCmds,
     CmdIf,
     CmdElse,
@@ -168,6 +177,9 @@ static const char* CmdBufCallIdStrings[] =
     "CmdBindMsaaState()",
     "CmdBindColorBlendState()",
     "CmdBindDepthStencilState()",
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    "CmdBindStateBlock()",
+#endif
     "CmdBindIndexData()",
     "CmdBindTargets()",
     "CmdBindStreamOutTargets()",
@@ -202,6 +214,9 @@ static const char* CmdBufCallIdStrings[] =
     "CmdDrawIndexed()",
     "CmdDrawIndirectMulti()",
     "CmdDrawIndexedIndirectMulti()",
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    "CmdDrawBatch()",
+#endif
     "CmdDispatch()",
     "CmdDispatchIndirect()",
     "CmdDispatchOffset()",
@@ -248,6 +263,9 @@ static const char* CmdBufCallIdStrings[] =
     "CmdWriteCeRam()",
     "CmdDumpCeRam()",
     "CmdExecuteNestedCmdBuffers()",
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    "CmdInsertSegments()",
+#endif
     "CmdExecuteIndirectCmds()",
     "CmdIf()",
     "CmdElse()",
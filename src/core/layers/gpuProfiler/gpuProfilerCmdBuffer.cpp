@@ -360,6 +360,24 @@ void CmdBuffer::ReplayCmdBindDepthStencilState(
     pTgtCmdBuffer->CmdBindDepthStencilState(ReadTokenVal<IDepthStencilState*>());
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBuffer::CmdBindStateBlock(
+    const IStateBlock* pStateBlock)
+{
+    InsertToken(CmdBufCallId::CmdBindStateBlock);
+    InsertToken(pStateBlock);
+}
+
+// =====================================================================================================================
+void CmdBuffer::ReplayCmdBindStateBlock(
+    Queue*           pQueue,
+    TargetCmdBuffer* pTgtCmdBuffer)
+{
+    pTgtCmdBuffer->CmdBindStateBlock(ReadTokenVal<IStateBlock*>());
+}
+#endif
+
 // =====================================================================================================================
 void CmdBuffer::CmdBindIndexData(
     gpusize   gpuAddr,
@@ -782,6 +800,7 @@ void CmdBuffer::ReplayCmdBarrier(
     barrierInfo.reason                      = ReadTokenVal<uint32>();
 
     pTgtCmdBuffer->ResetBarrierString();
+    pTgtCmdBuffer->ResetBarrierSummary(barrierInfo.reason);
 
     // We can only log the parameters of one transition at a time.
     // TODO: Expand batched barrier calls into calls with one transition each when the profiler is enabled so we
@@ -810,6 +829,7 @@ void CmdBuffer::ReplayCmdBarrier(
     pTgtCmdBuffer->CmdBarrier(barrierInfo);
 
     logItem.cmdBufCall.barrier.pComment = pTgtCmdBuffer->GetBarrierString();
+    logItem.cmdBufCall.barrier.summary  = pTgtCmdBuffer->GetBarrierSummary();
     LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
 }
 
@@ -852,6 +872,11 @@ void CmdBuffer::ReplayCmdRelease(
     auto pGpuEvent = ReadTokenVal<IGpuEvent*>();
 
     pTgtCmdBuffer->ResetBarrierString();
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 504
+    pTgtCmdBuffer->ResetBarrierSummary(releaseInfo.reason);
+#else
+    pTgtCmdBuffer->ResetBarrierSummary(Developer::BarrierReasonUnknown);
+#endif
 
     // We can only log the parameters of one transition at a time.
     LogItem logItem = { };
@@ -898,6 +923,7 @@ void CmdBuffer::ReplayCmdRelease(
     pTgtCmdBuffer->CmdRelease(releaseInfo, pGpuEvent);
 
     logItem.cmdBufCall.barrier.pComment = pTgtCmdBuffer->GetBarrierString();
+    logItem.cmdBufCall.barrier.summary  = pTgtCmdBuffer->GetBarrierSummary();
     LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
 }
 
@@ -942,6 +968,11 @@ void CmdBuffer::ReplayCmdAcquire(
     uint32      gpuEventCount = ReadTokenArray(&ppGpuEvents);
 
     pTgtCmdBuffer->ResetBarrierString();
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 504
+    pTgtCmdBuffer->ResetBarrierSummary(acquireInfo.reason);
+#else
+    pTgtCmdBuffer->ResetBarrierSummary(Developer::BarrierReasonUnknown);
+#endif
 
     // We can only log the parameters of one transition at a time.
     LogItem logItem = { };
@@ -988,6 +1019,7 @@ void CmdBuffer::ReplayCmdAcquire(
     pTgtCmdBuffer->CmdAcquire(acquireInfo, gpuEventCount, ppGpuEvents);
 
     logItem.cmdBufCall.barrier.pComment = pTgtCmdBuffer->GetBarrierString();
+    logItem.cmdBufCall.barrier.summary  = pTgtCmdBuffer->GetBarrierSummary();
     LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
 }
 
@@ -1025,6 +1057,11 @@ void CmdBuffer::ReplayCmdReleaseThenAcquire(
 #endif
 
     pTgtCmdBuffer->ResetBarrierString();
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 504
+    pTgtCmdBuffer->ResetBarrierSummary(barrierInfo.reason);
+#else
+    pTgtCmdBuffer->ResetBarrierSummary(Developer::BarrierReasonUnknown);
+#endif
 
     // We can only log the parameters of one transition at a time.
     LogItem logItem = { };
@@ -1071,6 +1108,7 @@ void CmdBuffer::ReplayCmdReleaseThenAcquire(
     pTgtCmdBuffer->CmdReleaseThenAcquire(barrierInfo);
 
     logItem.cmdBufCall.barrier.pComment = pTgtCmdBuffer->GetBarrierString();
+    logItem.cmdBufCall.barrier.summary  = pTgtCmdBuffer->GetBarrierSummary();
     LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
 }
 
@@ -1363,6 +1401,81 @@ void CmdBuffer::ReplayCmdDrawIndexedIndirectMulti(
     LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBuffer::CmdDrawBatch(
+    const DrawBatchInfo& batchInfo)
+{
+    InsertToken(CmdBufCallId::CmdDrawBatch);
+    InsertToken(batchInfo.flags.u32All);
+    InsertToken(batchInfo.drawCount);
+
+    for (uint32 i = 0; i < batchInfo.drawCount; ++i)
+    {
+        const DrawBatchEntry& draw = batchInfo.pDraws[i];
+
+        InsertToken(draw.first);
+        InsertToken(draw.count);
+        InsertToken(draw.vertexOffset);
+        InsertToken(draw.firstInstance);
+        InsertToken(draw.instanceCount);
+        InsertToken(draw.firstUserDataEntry);
+        InsertTokenArray(draw.pUserDataEntries, draw.userDataEntryCount);
+    }
+}
+
+// =====================================================================================================================
+// Batches are replayed as the equivalent sequence of individual user-data updates and draws so that each draw of the
+// batch can be timed and reported on its own.
+void CmdBuffer::ReplayCmdDrawBatch(
+    Queue*           pQueue,
+    TargetCmdBuffer* pTgtCmdBuffer)
+{
+    DrawBatchInfo batchInfo = { };
+    batchInfo.flags.u32All  = ReadTokenVal<uint32>();
+
+    const uint32 drawCount = ReadTokenVal<uint32>();
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        auto          first              = ReadTokenVal<uint32>();
+        auto          count              = ReadTokenVal<uint32>();
+        auto          vertexOffset       = ReadTokenVal<int32>();
+        auto          firstInstance      = ReadTokenVal<uint32>();
+        auto          instanceCount      = ReadTokenVal<uint32>();
+        auto          firstUserDataEntry = ReadTokenVal<uint32>();
+        const uint32* pUserDataEntries   = nullptr;
+        auto          userDataEntryCount = ReadTokenArray(&pUserDataEntries);
+
+        if (userDataEntryCount != 0)
+        {
+            pTgtCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics,
+                                          firstUserDataEntry,
+                                          userDataEntryCount,
+                                          pUserDataEntries);
+        }
+
+        LogItem logItem = { };
+        logItem.cmdBufCall.flags.draw         = 1;
+        logItem.cmdBufCall.draw.vertexCount   = count;
+        logItem.cmdBufCall.draw.instanceCount = instanceCount;
+
+        if (batchInfo.flags.indexed != 0)
+        {
+            LogPreTimedCall(pQueue, pTgtCmdBuffer, &logItem, CmdBufCallId::CmdDrawIndexed);
+            pTgtCmdBuffer->CmdDrawIndexed(first, count, vertexOffset, firstInstance, instanceCount);
+            LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
+        }
+        else
+        {
+            LogPreTimedCall(pQueue, pTgtCmdBuffer, &logItem, CmdBufCallId::CmdDraw);
+            pTgtCmdBuffer->CmdDraw(first, count, firstInstance, instanceCount);
+            LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
+        }
+    }
+}
+#endif
+
 // =====================================================================================================================
 void PAL_STDCALL CmdBuffer::CmdDispatch(
     ICmdBuffer* pCmdBuffer,
@@ -2975,6 +3088,59 @@ void CmdBuffer::ReplayCmdExecuteNestedCmdBuffers(
     }
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBuffer::CmdInsertSegments(
+    uint32            segmentCount,
+    ICmdBuffer*const* ppSegments)
+{
+    InsertToken(CmdBufCallId::CmdInsertSegments);
+    InsertTokenArray(ppSegments, segmentCount);
+}
+
+// =====================================================================================================================
+// Segments are replayed into queue-owned nested command buffers just like nested command buffers are.  Replay is
+// single-threaded so the segments are simply replayed one after another before being inserted into the target.
+void CmdBuffer::ReplayCmdInsertSegments(
+    Queue*           pQueue,
+    TargetCmdBuffer* pTgtCmdBuffer)
+{
+    if (m_pDevice->LoggingEnabled(GpuProfilerGranularityDraw))
+    {
+        LogItem logItem = { };
+        logItem.type              = CmdBufferCall;
+        logItem.frameId           = m_curLogFrame;
+        logItem.cmdBufCall.callId = CmdBufCallId::CmdInsertSegments;
+        pQueue->AddLogItem(logItem);
+    }
+
+    ICmdBuffer*const* ppSegments   = nullptr;
+    const uint32      segmentCount = ReadTokenArray(&ppSegments);
+    auto*const        pPlatform    = static_cast<Platform*>(m_pDevice->GetPlatform());
+
+    AutoBuffer<ICmdBuffer*, 32, Platform> tgtSegments(segmentCount, pPlatform);
+
+    if (tgtSegments.Capacity() < segmentCount)
+    {
+        // If the layers become production code, we must set a flag here and return out of memory on End().
+        PAL_ASSERT_ALWAYS();
+    }
+    else
+    {
+        for (uint32 i = 0; i < segmentCount; i++)
+        {
+            auto*const pSegment    = static_cast<CmdBuffer*>(ppSegments[i]);
+            auto*const pTgtSegment = pQueue->AcquireNestedCmdBuf();
+
+            tgtSegments[i] = pTgtSegment;
+            pSegment->Replay(pQueue, pTgtSegment, m_curLogFrame);
+        }
+
+        pTgtCmdBuffer->CmdInsertSegments(segmentCount, &tgtSegments[0]);
+    }
+}
+#endif
+
 // =====================================================================================================================
 void CmdBuffer::CmdExecuteIndirectCmds(
     const IIndirectCmdGenerator& generator,
@@ -3598,6 +3764,9 @@ void CmdBuffer::Replay(
         &CmdBuffer::ReplayCmdBindMsaaState,
         &CmdBuffer::ReplayCmdBindColorBlendState,
         &CmdBuffer::ReplayCmdBindDepthStencilState,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        &CmdBuffer::ReplayCmdBindStateBlock,
+#endif
         &CmdBuffer::ReplayCmdBindIndexData,
         &CmdBuffer::ReplayCmdBindTargets,
         &CmdBuffer::ReplayCmdBindStreamOutTargets,
@@ -3632,6 +3801,9 @@ void CmdBuffer::Replay(
         &CmdBuffer::ReplayCmdDrawIndexed,
         &CmdBuffer::ReplayCmdDrawIndirectMulti,
         &CmdBuffer::ReplayCmdDrawIndexedIndirectMulti,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        &CmdBuffer::ReplayCmdDrawBatch,
+#endif
         &CmdBuffer::ReplayCmdDispatch,
         &CmdBuffer::ReplayCmdDispatchIndirect,
         &CmdBuffer::ReplayCmdDispatchOffset,
@@ -3678,6 +3850,9 @@ void CmdBuffer::Replay(
         &CmdBuffer::ReplayCmdWriteCeRam,
         &CmdBuffer::ReplayCmdDumpCeRam,
         &CmdBuffer::ReplayCmdExecuteNestedCmdBuffers,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        &CmdBuffer::ReplayCmdInsertSegments,
+#endif
         &CmdBuffer::ReplayCmdExecuteIndirectCmds,
         &CmdBuffer::ReplayCmdIf,
         &CmdBuffer::ReplayCmdElse,
@@ -3926,6 +4101,7 @@ Result TargetCmdBuffer::Begin(
     // recorded.
     m_allocator.Rewind(m_pAllocatorStream, false);
     ResetBarrierString();
+    ResetBarrierSummary(Developer::BarrierReasonInvalid);
 
     return CmdBufferFwdDecorator::Begin(info);
 }
@@ -3937,6 +4113,15 @@ void TargetCmdBuffer::ResetBarrierString()
     m_currentCommentSize     = 0;
 }
 
+// =====================================================================================================================
+// Starts a new summary of the operations performed by the barrier call which is about to execute.
+void TargetCmdBuffer::ResetBarrierSummary(
+    uint32 reason)
+{
+    memset(&m_barrierSummary, 0, sizeof(m_barrierSummary));
+    m_barrierSummary.reason = reason;
+}
+
 // =====================================================================================================================
 void TargetCmdBuffer::AddBarrierString(
     const char* pString)
@@ -4198,6 +4383,42 @@ static const char* ImageAspectToString(
 void TargetCmdBuffer::UpdateCommentString(
     Developer::BarrierData* pData)
 {
+    // Fold the reported operations into the summary of the current barrier call.
+    m_barrierSummary.operations.pipelineStalls.u16All    |= pData->operations.pipelineStalls.u16All;
+    m_barrierSummary.operations.caches.u16All            |= pData->operations.caches.u16All;
+    m_barrierSummary.operations.layoutTransitions.u16All |= pData->operations.layoutTransitions.u16All;
+
+    if (pData->hasTransition)
+    {
+        const IImage*const pImage = pData->transition.imageInfo.pImage;
+        uint32             idx    = 0;
+
+        m_barrierSummary.bltCount++;
+
+        while ((idx < m_barrierSummary.imageCount) && (m_barrierSummary.images[idx].pImage != pImage))
+        {
+            idx++;
+        }
+
+        if (idx < MaxBarrierSummaryImages)
+        {
+            auto*const pImageSummary = &m_barrierSummary.images[idx];
+
+            if (idx == m_barrierSummary.imageCount)
+            {
+                const ImageCreateInfo& createInfo = pImage->GetImageCreateInfo();
+
+                pImageSummary->pImage  = pImage;
+                pImageSummary->width   = createInfo.extent.width;
+                pImageSummary->height  = createInfo.extent.height;
+                pImageSummary->pFormat = FormatToString(createInfo.swizzledFormat.format);
+                m_barrierSummary.imageCount++;
+            }
+
+            pImageSummary->bltCount++;
+        }
+    }
+
     char newBarrierComment[MaxCommentLength] = {};
     if (pData->hasTransition)
     {
@@ -82,6 +82,10 @@ public:
         const IColorBlendState* pColorBlendState) override;
     virtual void CmdBindDepthStencilState(
         const IDepthStencilState* pDepthStencilState) override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdBindStateBlock(
+        const IStateBlock* pStateBlock) override;
+#endif
     virtual void CmdBindIndexData(
         gpusize gpuAddr, uint32 indexCount, IndexType indexType) override;
     virtual void CmdBindTargets(
@@ -405,6 +409,13 @@ public:
     virtual void CmdExecuteNestedCmdBuffers(
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdInsertSegments(
+        uint32            segmentCount,
+        ICmdBuffer*const* ppSegments) override;
+    virtual void CmdDrawBatch(
+        const DrawBatchInfo& batchInfo) override;
+#endif
     virtual void CmdExecuteIndirectCmds(
         const IIndirectCmdGenerator& generator,
         const IGpuMemory&            gpuMemory,
@@ -640,6 +651,9 @@ private:
     void ReplayCmdBindMsaaState(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdBindColorBlendState(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdBindDepthStencilState(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    void ReplayCmdBindStateBlock(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+#endif
     void ReplayCmdBindIndexData(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdBindTargets(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdBindStreamOutTargets(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
@@ -674,6 +688,9 @@ private:
     void ReplayCmdDrawIndexed(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDrawIndirectMulti(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDrawIndexedIndirectMulti(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    void ReplayCmdDrawBatch(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+#endif
     void ReplayCmdDispatch(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDispatchIndirect(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDispatchOffset(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
@@ -722,6 +739,9 @@ private:
     void ReplayCmdWriteCeRam(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDumpCeRam(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdExecuteNestedCmdBuffers(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    void ReplayCmdInsertSegments(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+#endif
     void ReplayCmdExecuteIndirectCmds(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdIf(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdElse(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
@@ -845,6 +865,9 @@ public:
     void AddBarrierString(const char* pString);
     const char* GetBarrierString() const { return m_pCurrentBarrierComment; }
 
+    void ResetBarrierSummary(uint32 reason);
+    const BarrierSummary& GetBarrierSummary() const { return m_barrierSummary; }
+
     virtual void UpdateCommentString(Developer::BarrierData* pData) override;
 
     void BeginSample(Queue* pQueue, LogItem* pLogItem, bool pipeStats, bool perfExp);
@@ -865,6 +888,9 @@ private:
     char*                        m_pCurrentBarrierComment;
     size_t                       m_currentCommentSize;
 
+    // Track the operations reported for the current barrier call.
+    BarrierSummary               m_barrierSummary;
+
     const QueueType              m_queueType;         // Universal, compute, etc.
     const EngineType             m_engineType;
     bool                         m_supportTimestamps; // This command buffer (based on engine type) supports timestamps.
@@ -30,6 +30,7 @@
 #include "palAutoBuffer.h"
 #include "palDequeImpl.h"
 #include "palSysUtil.h"
+#include "palVectorImpl.h"
 
 using namespace Util;
 
@@ -70,7 +71,9 @@ Queue::Queue(
     m_logItems(static_cast<Platform*>(pDevice->GetPlatform())),
     m_curLogFrame(0),
     m_curLogCmdBufIdx(0),
-    m_curLogSqttIdx(0)
+    m_curLogSqttIdx(0),
+    m_barrierReasonCosts(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_barrierImageCosts(static_cast<Platform*>(pDevice->GetPlatform()))
 {
     memset(&m_nestedAllocatorCreateInfo, 0, sizeof(m_nestedAllocatorCreateInfo));
     memset(&m_gpaSessionSampleConfig,    0, sizeof(m_gpaSessionSampleConfig));
@@ -97,6 +100,7 @@ Queue::~Queue()
     // Ensure all log items are flushed out before we shut down.
     WaitIdle();
     ProcessIdleSubmits();
+    OutputBarrierReportToFile();
     m_logFile.Close();
 
     PAL_ASSERT(m_busyCmdBufs.NumElements() == 0);
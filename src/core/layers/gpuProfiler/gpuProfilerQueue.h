@@ -31,6 +31,7 @@
 #include "palFile.h"
 #include "palGpaSession.h"
 #include "palLinearAllocator.h"
+#include "palVector.h"
 
 namespace Pal
 {
@@ -44,6 +45,52 @@ class TargetCmdBuffer;
 
 static constexpr size_t MaxCommentLength = 512;
 
+// Maximum number of distinct images tracked in the summary of a single barrier call.
+static constexpr uint32 MaxBarrierSummaryImages = 8;
+
+// Summarizes the work which the lower layers reported performing for a single barrier call.
+struct BarrierSummary
+{
+    uint32                       reason;     // Reason for the barrier (see Developer::BarrierReason).
+    Developer::BarrierOperations operations; // Union of all operations reported for this barrier.
+    uint32                       bltCount;   // Number of layout transition BLTs reported for this barrier.
+    uint32                       imageCount; // Number of valid entries in images.
+
+    struct
+    {
+        const IImage* pImage;   // Only used as a key, the image may be destroyed by the time the summary is logged.
+        uint32        width;
+        uint32        height;
+        const char*   pFormat;  // Static string naming the image format.
+        uint32        bltCount; // Number of layout transition BLTs reported for this image.
+    } images[MaxBarrierSummaryImages];
+};
+
+// GPU time and work of all barriers issued for the same barrier reason during a frame.
+struct BarrierReasonCost
+{
+    uint32 reason;
+    uint32 barrierCount;
+    uint64 totalTicks;
+    uint64 maxTicks;
+    uint32 bltCount;
+    uint32 stallCount;
+    uint32 cacheOpCount;
+};
+
+// GPU time of all barriers which transitioned the same image during a frame.  A barrier's full time is attributed to
+// each image it transitioned.
+struct BarrierImageCost
+{
+    const IImage* pImage;
+    uint32        width;
+    uint32        height;
+    const char*   pFormat;
+    uint32        barrierCount;
+    uint64        totalTicks;
+    uint32        bltCount;
+};
+
 // Identifies whether a specific LogItem corresponds to a queue call (Submit(), Present(), etc.), a command buffer
 // call (CmdDrawIndexed(), CmdCopyImage(), etc.), or a full frame.
 enum LogItemType : uint32
@@ -107,7 +154,8 @@ struct LogItem
                 // Log data only interesting for barrier calls (i.e., flags.barrier == 1).
                 struct
                 {
-                    const char* pComment;     // This string is dynamically allocated by the target CmdBuffer.
+                    const char*    pComment;  // This string is dynamically allocated by the target CmdBuffer.
+                    BarrierSummary summary;   // Operations reported by the lower layers while executing the barrier.
                 } barrier;
 
                 // Log data only interesting for CmdCommentString calls (i.e., flags.comment == 1).
@@ -242,6 +290,9 @@ private:
     void OutputGlobalPerfCountersToFile(const LogItem& logItem);
     void OutputTraceDataToFile(const LogItem& logItem);
 
+    void AccumulateBarrierCost(const LogItem& logItem);
+    void OutputBarrierReportToFile();
+
     void ProfilingClockMode(bool enable);
 
     Device*const     m_pDevice;
@@ -315,6 +366,10 @@ private:
 
     LogItem                           m_perFrameLogItem;  // Log item used when the profiling granularity is per frame.
 
+    // Barrier costs accumulated over the frame being logged, written out as a ranked report when the frame ends.
+    Util::Vector<BarrierReasonCost, 16, Platform> m_barrierReasonCosts;
+    Util::Vector<BarrierImageCost, 32, Platform>  m_barrierImageCosts;
+
     PAL_DISALLOW_DEFAULT_CTOR(Queue);
     PAL_DISALLOW_COPY_AND_ASSIGN(Queue);
 };
@@ -31,6 +31,7 @@
 #include "palAutoBuffer.h"
 #include "palDequeImpl.h"
 #include "palGpaSession.h"
+#include "palVectorImpl.h"
 #include "sqtt_file_format.h"
 
 using namespace Util;
@@ -104,6 +105,11 @@ void Queue::OutputLogItemsToFile(
 
             OutputCmdBufCallToFile(logItem, pNestedCmdBufPrefix);
 
+            if (logItem.cmdBufCall.flags.barrier)
+            {
+                AccumulateBarrierCost(logItem);
+            }
+
             if (logItem.cmdBufCall.callId == CmdBufCallId::End)
             {
                 PAL_ASSERT((activeCmdBufs > 0) && (activeCmdBufs <= 2));
@@ -141,6 +147,9 @@ void Queue::OpenLogFile(
 {
     const auto& settings = m_pDevice->GetPlatform()->PlatformSettings();
 
+    // Any barrier costs accumulated so far belong to the previous frame.
+    OutputBarrierReportToFile();
+
     m_logFile.Close();
 
     // Build a file name for this frame's log file.  It will have the pattern frameAAAAAADevBEngCD-EE.csv, where:
@@ -880,5 +889,256 @@ void Queue::OutputTraceDataToFile(
     }
 }
 
+// =====================================================================================================================
+// Returns a printable name for PAL's internal barrier reasons, or nullptr for any other reason.
+static const char* BarrierReasonToString(
+    uint32 reason)
+{
+    constexpr const char* InternalReasonStrings[] =
+    {
+        "PreComputeColorClear",
+        "PostComputeColorClear",
+        "PreComputeDepthStencilClear",
+        "PostComputeDepthStencilClear",
+        "MlaaResolveEdgeSync",
+        "AqlWaitForParentKernel",
+        "AqlWaitForChildrenKernels",
+        "P2PBlitSync",
+        "TimeGraphGrid",
+        "TimeGraphGpuLine",
+        "DebugOverlayText",
+        "DebugOverlayGraph",
+        "DevDriverOverlay",
+        "DmaImgScanlineCopySync",
+        "PostSqttTrace",
+        "PrePerfDataCopy",
+        "FlushL2CachedData",
+    };
+
+    static_assert(ArrayLen(InternalReasonStrings) ==
+                  (Developer::BarrierReasonInternalLastDefined - Developer::BarrierReasonFirst),
+                  "The number of internal barrier reasons has changed!");
+
+    const char* pString = nullptr;
+
+    if ((reason >= Developer::BarrierReasonFirst) && (reason < Developer::BarrierReasonInternalLastDefined))
+    {
+        pString = InternalReasonStrings[reason - Developer::BarrierReasonFirst];
+    }
+    else if (reason == Developer::BarrierReasonUnknown)
+    {
+        pString = "Unknown";
+    }
+    else if (reason == Developer::BarrierReasonInvalid)
+    {
+        pString = "Invalid";
+    }
+
+    return pString;
+}
+
+// =====================================================================================================================
+// Fills pOrder with the indices of the given costs, ranked from the highest to the lowest total GPU time.
+template <typename CostType, uint32 DefaultCapacity>
+static void RankByTotalTicks(
+    const Vector<CostType, DefaultCapacity, Platform>& costs,
+    uint32*                                            pOrder)
+{
+    for (uint32 i = 0; i < costs.NumElements(); i++)
+    {
+        uint32 pos = i;
+
+        while ((pos > 0) && (costs.At(pOrder[pos - 1]).totalTicks < costs.At(i).totalTicks))
+        {
+            pOrder[pos] = pOrder[pos - 1];
+            pos--;
+        }
+
+        pOrder[pos] = i;
+    }
+}
+
+// =====================================================================================================================
+// Adds the GPU time and the operations reported for a single timed barrier call to the barrier costs of the frame being
+// logged.  The time is accumulated per barrier reason and per transitioned image.
+void Queue::AccumulateBarrierCost(
+    const LogItem& logItem)
+{
+    PAL_ASSERT((logItem.type == CmdBufferCall) && logItem.cmdBufCall.flags.barrier);
+
+    if (m_pDevice->GetPlatform()->PlatformSettings().gpuProfilerConfig.reportBarrierCosts &&
+        HasValidGpaSample(&logItem, GpuUtil::GpaSampleType::Timing))
+    {
+        uint64 timestamps[2] = {};
+        logItem.pGpaSession->GetResults(logItem.gpaSampleIdTs, nullptr, &timestamps[0]);
+
+        const BarrierSummary& summary = logItem.cmdBufCall.barrier.summary;
+        const uint64          ticks   = timestamps[1] - timestamps[0];
+
+        uint32 reasonIdx = 0;
+        while ((reasonIdx < m_barrierReasonCosts.NumElements()) &&
+               (m_barrierReasonCosts.At(reasonIdx).reason != summary.reason))
+        {
+            reasonIdx++;
+        }
+
+        if (reasonIdx == m_barrierReasonCosts.NumElements())
+        {
+            BarrierReasonCost newCost = {};
+            newCost.reason = summary.reason;
+
+            if (m_barrierReasonCosts.PushBack(newCost) != Result::Success)
+            {
+                reasonIdx = UINT32_MAX;
+            }
+        }
+
+        if (reasonIdx != UINT32_MAX)
+        {
+            BarrierReasonCost*const pCost = &m_barrierReasonCosts.At(reasonIdx);
+
+            pCost->barrierCount++;
+            pCost->totalTicks   += ticks;
+            pCost->maxTicks      = Max(pCost->maxTicks, ticks);
+            pCost->bltCount     += summary.bltCount;
+            pCost->stallCount   += CountSetBits(summary.operations.pipelineStalls.u16All);
+            pCost->cacheOpCount += CountSetBits(summary.operations.caches.u16All);
+        }
+
+        for (uint32 i = 0; i < summary.imageCount; i++)
+        {
+            const auto& image    = summary.images[i];
+            uint32      imageIdx = 0;
+
+            while ((imageIdx < m_barrierImageCosts.NumElements()) &&
+                   (m_barrierImageCosts.At(imageIdx).pImage != image.pImage))
+            {
+                imageIdx++;
+            }
+
+            if (imageIdx == m_barrierImageCosts.NumElements())
+            {
+                BarrierImageCost newCost = {};
+                newCost.pImage  = image.pImage;
+                newCost.width   = image.width;
+                newCost.height  = image.height;
+                newCost.pFormat = image.pFormat;
+
+                if (m_barrierImageCosts.PushBack(newCost) != Result::Success)
+                {
+                    imageIdx = UINT32_MAX;
+                }
+            }
+
+            if (imageIdx != UINT32_MAX)
+            {
+                BarrierImageCost*const pCost = &m_barrierImageCosts.At(imageIdx);
+
+                pCost->barrierCount++;
+                pCost->totalTicks += ticks;
+                pCost->bltCount   += image.bltCount;
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Writes the barrier costs accumulated for the frame being logged to a .csv file, ranked from the most to the least
+// expensive barrier reason and image, then starts accumulating a new frame.
+void Queue::OutputBarrierReportToFile()
+{
+    const uint32 numReasons = m_barrierReasonCosts.NumElements();
+    const uint32 numImages  = m_barrierImageCosts.NumElements();
+
+    if (numReasons > 0)
+    {
+        Platform*const pPlatform = static_cast<Platform*>(m_pDevice->GetPlatform());
+
+        AutoBuffer<uint32, 16, Platform> reasonOrder(numReasons, pPlatform);
+        AutoBuffer<uint32, 32, Platform> imageOrder(Max(numImages, 1u), pPlatform);
+
+        char fileName[512];
+        Snprintf(&fileName[0],
+                 sizeof(fileName),
+                 "%s/frame%06uDev%uEng%s%u-%02uBarriers.csv",
+                 pPlatform->LogDirPath(),
+                 m_curLogFrame,
+                 m_pDevice->Id(),
+                 EngineTypeStrings[static_cast<uint32>(m_engineType)],
+                 m_engineIndex,
+                 m_queueId);
+
+        File reportFile;
+
+        if ((reasonOrder.Capacity() >= numReasons) &&
+            (imageOrder.Capacity()  >= numImages)  &&
+            (reportFile.Open(&fileName[0], FileAccessWrite) == Result::Success))
+        {
+            const double ticksToUs  = 1000000.0 / m_pDevice->TimestampFreq();
+            uint64       frameTicks = 0;
+
+            for (uint32 i = 0; i < numReasons; i++)
+            {
+                frameTicks += m_barrierReasonCosts.At(i).totalTicks;
+            }
+
+            RankByTotalTicks(m_barrierReasonCosts, &reasonOrder[0]);
+            RankByTotalTicks(m_barrierImageCosts, &imageOrder[0]);
+
+            reportFile.Printf("Rank,Barrier Reason,Barriers,Total Time (us),Average Time (us),Max Time (us),"
+                              "Share of Barrier Time (%%),BLTs,Pipeline Stalls,Cache Operations\n");
+
+            for (uint32 rank = 0; rank < numReasons; rank++)
+            {
+                const BarrierReasonCost& cost    = m_barrierReasonCosts.At(reasonOrder[rank]);
+                const char*const         pReason = BarrierReasonToString(cost.reason);
+
+                reportFile.Printf("%u,", rank + 1);
+
+                if (pReason != nullptr)
+                {
+                    reportFile.Printf("%s,", pReason);
+                }
+                else
+                {
+                    reportFile.Printf("0x%08x,", cost.reason);
+                }
+
+                reportFile.Printf("%u,%.2lf,%.2lf,%.2lf,%.1lf,%u,%u,%u\n",
+                                  cost.barrierCount,
+                                  cost.totalTicks * ticksToUs,
+                                  (cost.totalTicks * ticksToUs) / cost.barrierCount,
+                                  cost.maxTicks * ticksToUs,
+                                  (frameTicks > 0) ? ((100.0 * cost.totalTicks) / frameTicks) : 0.0,
+                                  cost.bltCount,
+                                  cost.stallCount,
+                                  cost.cacheOpCount);
+            }
+
+            reportFile.Printf("\nRank,Image,Width,Height,Format,Barriers,Total Time (us),BLTs\n");
+
+            for (uint32 rank = 0; rank < numImages; rank++)
+            {
+                const BarrierImageCost& cost = m_barrierImageCosts.At(imageOrder[rank]);
+
+                reportFile.Printf("%u,0x%p,%u,%u,%s,%u,%.2lf,%u\n",
+                                  rank + 1,
+                                  cost.pImage,
+                                  cost.width,
+                                  cost.height,
+                                  cost.pFormat,
+                                  cost.barrierCount,
+                                  cost.totalTicks * ticksToUs,
+                                  cost.bltCount);
+            }
+
+            reportFile.Close();
+        }
+    }
+
+    m_barrierReasonCosts.Clear();
+    m_barrierImageCosts.Clear();
+}
+
 } // GpuProfiler
 } // Pal
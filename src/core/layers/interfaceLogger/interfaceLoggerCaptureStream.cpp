@@ -0,0 +1,242 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/layers/interfaceLogger/interfaceLoggerCaptureStream.h"
+#include "core/layers/interfaceLogger/interfaceLoggerCmdAllocator.h"
+#include "core/layers/interfaceLogger/interfaceLoggerColorBlendState.h"
+#include "core/layers/interfaceLogger/interfaceLoggerDepthStencilState.h"
+#include "core/layers/interfaceLogger/interfaceLoggerMsaaState.h"
+#include "core/layers/interfaceLogger/interfaceLoggerPipeline.h"
+#include "core/layers/interfaceLogger/interfaceLoggerPlatform.h"
+
+using namespace Util;
+
+namespace Pal
+{
+namespace InterfaceLogger
+{
+
+using namespace GpuUtil::CmdCapture;
+
+// Buffered records are written to the file once they exceed this many bytes.
+constexpr size_t FlushThreshold = 1024 * 1024;
+
+// =====================================================================================================================
+CaptureStream::CaptureStream(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_pBuffer(nullptr),
+    m_bufferSize(0),
+    m_bufferUsed(0),
+    m_recordOffset(0),
+    m_dropRecord(false)
+{
+}
+
+// =====================================================================================================================
+CaptureStream::~CaptureStream()
+{
+    if (m_file.IsOpen())
+    {
+        const Result result = WriteFile();
+        PAL_ASSERT(result == Result::Success);
+    }
+
+    PAL_SAFE_FREE(m_pBuffer, m_pPlatform);
+}
+
+// =====================================================================================================================
+// Opens the capture file and writes the file header. No records may be written until this has succeeded.
+Result CaptureStream::OpenFile(
+    const char* pFilePath)
+{
+    Result result = m_mutex.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_file.Open(pFilePath, FileAccessWrite | FileAccessBinary);
+    }
+
+    if (result == Result::Success)
+    {
+        FileHeader header = {};
+        header.magic                 = FileMagic;
+        header.version               = FileVersion;
+        header.interfaceMajorVersion = PAL_CLIENT_INTERFACE_MAJOR_VERSION;
+        header.pointerSize           = sizeof(void*);
+
+        result = m_file.Write(&header, sizeof(header));
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Takes the stream's lock and reserves space for a new record's header. The header's size is filled in by EndRecord.
+void CaptureStream::BeginRecord(
+    CaptureFunc func,
+    uint32      objectId)
+{
+    m_mutex.Lock();
+
+    m_dropRecord   = false;
+    m_recordOffset = m_bufferUsed;
+
+    RecordHeader header = {};
+    header.func     = func;
+    header.objectId = objectId;
+
+    Write(header);
+}
+
+// =====================================================================================================================
+// Finishes the current record and releases the stream's lock.
+void CaptureStream::EndRecord()
+{
+    if (m_dropRecord)
+    {
+        // Something in this record couldn't be buffered; discard the whole record so the file stays parsable.
+        m_bufferUsed = m_recordOffset;
+    }
+    else
+    {
+        RecordHeader*const pHeader = reinterpret_cast<RecordHeader*>(m_pBuffer + m_recordOffset);
+        pHeader->size = static_cast<uint32>(m_bufferUsed - m_recordOffset - sizeof(RecordHeader));
+
+        if (m_bufferUsed >= FlushThreshold)
+        {
+            const Result result = WriteFile();
+            PAL_ASSERT(result == Result::Success);
+        }
+    }
+
+    m_mutex.Unlock();
+}
+
+// =====================================================================================================================
+void CaptureStream::Write(
+    const void* pData,
+    size_t      size)
+{
+    VerifyUnusedSpace(size);
+
+    if ((m_dropRecord == false) && (size > 0))
+    {
+        memcpy(m_pBuffer + m_bufferUsed, pData, size);
+        m_bufferUsed += size;
+    }
+}
+
+// =====================================================================================================================
+void CaptureStream::WriteObjectId(
+    const ICmdAllocator* pCmdAllocator)
+{
+    Write((pCmdAllocator != nullptr) ? static_cast<const CmdAllocator*>(pCmdAllocator)->ObjectId() : NullObjectId);
+}
+
+// =====================================================================================================================
+void CaptureStream::WriteObjectId(
+    const IPipeline* pPipeline)
+{
+    Write((pPipeline != nullptr) ? static_cast<const Pipeline*>(pPipeline)->ObjectId() : NullObjectId);
+}
+
+// =====================================================================================================================
+void CaptureStream::WriteObjectId(
+    const IMsaaState* pMsaaState)
+{
+    Write((pMsaaState != nullptr) ? static_cast<const MsaaState*>(pMsaaState)->ObjectId() : NullObjectId);
+}
+
+// =====================================================================================================================
+void CaptureStream::WriteObjectId(
+    const IColorBlendState* pColorBlendState)
+{
+    Write((pColorBlendState != nullptr) ? static_cast<const ColorBlendState*>(pColorBlendState)->ObjectId()
+                                        : NullObjectId);
+}
+
+// =====================================================================================================================
+void CaptureStream::WriteObjectId(
+    const IDepthStencilState* pDepthStencilState)
+{
+    Write((pDepthStencilState != nullptr) ? static_cast<const DepthStencilState*>(pDepthStencilState)->ObjectId()
+                                          : NullObjectId);
+}
+
+// =====================================================================================================================
+// Writes all buffered records to the file. Unlike the JSON logs, the capture is not flushed to disk after every write;
+// doing so would dominate the cost of the calls being captured.
+Result CaptureStream::WriteFile()
+{
+    Result result = Result::Success;
+
+    if (m_file.IsOpen() == false)
+    {
+        result = Result::ErrorUnavailable;
+    }
+    else if (m_bufferUsed > 0)
+    {
+        result       = m_file.Write(m_pBuffer, m_bufferUsed);
+        m_bufferUsed = 0;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Verifies that the buffer has enough space for an additional "size" bytes, reallocating if necessary. If the buffer
+// can't grow, the current record is marked to be dropped.
+void CaptureStream::VerifyUnusedSpace(
+    size_t size)
+{
+    if ((m_dropRecord == false) && (m_bufferSize - m_bufferUsed < size))
+    {
+        // Bump up the size of the buffer to the next multiple of 64K that fits the current contents plus "size".
+        const size_t newSize    = Pow2Align(m_bufferUsed + size, 65536);
+        uint8*const  pNewBuffer = static_cast<uint8*>(PAL_MALLOC(newSize, m_pPlatform, AllocInternal));
+
+        if (pNewBuffer == nullptr)
+        {
+            m_dropRecord = true;
+        }
+        else
+        {
+            if (m_pBuffer != nullptr)
+            {
+                memcpy(pNewBuffer, m_pBuffer, m_bufferUsed);
+            }
+
+            PAL_SAFE_FREE(m_pBuffer, m_pPlatform);
+
+            m_pBuffer    = pNewBuffer;
+            m_bufferSize = newSize;
+        }
+    }
+}
+
+} // InterfaceLogger
+} // Pal
@@ -0,0 +1,89 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "core/layers/decorators.h"
+#include "palCmdBufferReplayer.h"
+#include "palFile.h"
+#include "palMutex.h"
+
+namespace Pal
+{
+namespace InterfaceLogger
+{
+
+class Platform;
+
+// Identifies the interface call a capture record represents.
+using CaptureFunc = GpuUtil::CmdCapture::Func;
+
+// =====================================================================================================================
+// Writes command buffer building calls to a file in the GpuUtil::CmdCapture binary format so that they can be replayed
+// later by GpuUtil::CmdBufferReplayer. Records are staged in memory and written to the file in large blocks to keep the
+// per-call overhead low. Each record is written between BeginRecord and EndRecord, which hold the stream's lock so that
+// records from different threads are never interleaved.
+class CaptureStream
+{
+public:
+    explicit CaptureStream(Platform* pPlatform);
+    ~CaptureStream();
+
+    Result OpenFile(const char* pFilePath);
+
+    void BeginRecord(CaptureFunc func, uint32 objectId);
+    void EndRecord();
+
+    void Write(const void* pData, size_t size);
+
+    template <typename T>
+    void Write(const T& value) { Write(&value, sizeof(T)); }
+
+    // Writes the capture ID of the given decorated object, or NullObjectId if it is null.
+    void WriteObjectId(const ICmdAllocator* pCmdAllocator);
+    void WriteObjectId(const IPipeline* pPipeline);
+    void WriteObjectId(const IMsaaState* pMsaaState);
+    void WriteObjectId(const IColorBlendState* pColorBlendState);
+    void WriteObjectId(const IDepthStencilState* pDepthStencilState);
+
+private:
+    Result WriteFile();
+    void VerifyUnusedSpace(size_t size);
+
+    Platform*const m_pPlatform;
+    Util::Mutex    m_mutex;        // Serializes records written by different threads.
+    Util::File     m_file;         // The capture is being written here.
+    uint8*         m_pBuffer;      // Buffered records that need to be written to the file.
+    size_t         m_bufferSize;   // The size of the buffer in bytes.
+    size_t         m_bufferUsed;   // How many bytes of the buffer are in use.
+    size_t         m_recordOffset; // Offset of the current record's header within the buffer.
+    bool           m_dropRecord;   // Set if the buffer could not grow; the current record will be discarded.
+
+    PAL_DISALLOW_DEFAULT_CTOR(CaptureStream);
+    PAL_DISALLOW_COPY_AND_ASSIGN(CaptureStream);
+};
+
+} // InterfaceLogger
+} // Pal
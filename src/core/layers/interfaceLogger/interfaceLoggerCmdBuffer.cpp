@@ -87,6 +87,13 @@ Result CmdBuffer::Begin(
         m_pPlatform->LogEndFunc(pLogContext);
     }
 
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdBufferBegin, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(info.flags);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
+
     return result;
 }
 
@@ -110,6 +117,12 @@ Result CmdBuffer::End()
         m_pPlatform->LogEndFunc(pLogContext);
     }
 
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdBufferEnd, m_objectId, &pCaptureStream))
+    {
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
+
     return result;
 }
 
@@ -140,6 +153,14 @@ Result CmdBuffer::Reset(
         m_pPlatform->LogEndFunc(pLogContext);
     }
 
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdBufferReset, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->WriteObjectId(pCmdAllocator);
+        pCaptureStream->Write(static_cast<uint32>(returnGpuMemory));
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
+
     return result;
 }
 
@@ -170,6 +191,15 @@ void CmdBuffer::CmdBindPipeline(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdBindPipeline, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params.pipelineBindPoint);
+        pCaptureStream->WriteObjectId(params.pPipeline);
+        pCaptureStream->Write(params.apiPsoHash);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -192,6 +222,13 @@ void CmdBuffer::CmdBindMsaaState(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdBindMsaaState, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->WriteObjectId(pMsaaState);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -214,6 +251,13 @@ void CmdBuffer::CmdBindColorBlendState(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdBindColorBlendState, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->WriteObjectId(pColorBlendState);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -236,8 +280,39 @@ void CmdBuffer::CmdBindDepthStencilState(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdBindDepthStencilState, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->WriteObjectId(pDepthStencilState);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBuffer::CmdBindStateBlock(
+    const IStateBlock* pStateBlock)
+{
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::CmdBufferCmdBindStateBlock;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = m_pPlatform->GetTime();
+    m_pNextLayer->CmdBindStateBlock(NextStateBlock(pStateBlock));
+    funcInfo.postCallTime = m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndObject("stateBlock", pStateBlock);
+        pLogContext->EndInput();
+
+        m_pPlatform->LogEndFunc(pLogContext);
+    }
+}
+#endif
+
 // =====================================================================================================================
 void CmdBuffer::CmdSetDepthBounds(
     const DepthBoundsParams& params)
@@ -258,6 +333,13 @@ void CmdBuffer::CmdSetDepthBounds(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetDepthBounds, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -291,6 +373,15 @@ void CmdBuffer::CmdSetVertexBuffers(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetVertexBuffers, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(firstBuffer);
+        pCaptureStream->Write(bufferCount);
+        pCaptureStream->Write(pBuffers, bufferCount * sizeof(BufferViewInfo));
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 473
@@ -378,6 +469,15 @@ void CmdBuffer::CmdBindIndexData(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdBindIndexData, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(gpuAddr);
+        pCaptureStream->Write(indexCount);
+        pCaptureStream->Write(indexType);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -453,6 +553,13 @@ void CmdBuffer::CmdSetBlendConst(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetBlendConst, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -475,6 +582,13 @@ void CmdBuffer::CmdSetInputAssemblyState(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetInputAssemblyState, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -497,6 +611,13 @@ void CmdBuffer::CmdSetTriangleRasterState(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetTriangleRasterState, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -519,6 +640,13 @@ void CmdBuffer::CmdSetPointLineRasterState(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetPointLineRasterState, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -563,6 +691,13 @@ void CmdBuffer::CmdSetDepthBiasState(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetDepthBiasState, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -585,6 +720,13 @@ void CmdBuffer::CmdSetStencilRefMasks(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetStencilRefMasks, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -696,6 +838,13 @@ void CmdBuffer::CmdSetViewports(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetViewports, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -718,6 +867,13 @@ void CmdBuffer::CmdSetScissorRects(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetScissorRects, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -740,6 +896,13 @@ void CmdBuffer::CmdSetGlobalScissor(
 
         m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetGlobalScissor, m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(params);
+        m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -798,6 +961,40 @@ void CmdBuffer::CmdBarrier(
 
             m_pPlatform->LogEndFunc(pLogContext);
         }
+
+        CaptureStream* pCaptureStream = nullptr;
+        if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdBarrier, m_objectId, &pCaptureStream))
+        {
+            // Only memory transitions can be replayed; images, GPU events and target waits aren't captured.
+            uint32 memoryTransitionCount = 0;
+            for (uint32 i = 0; i < barrierInfo.transitionCount; i++)
+            {
+                memoryTransitionCount += (barrierInfo.pTransitions[i].imageInfo.pImage == nullptr) ? 1 : 0;
+            }
+
+            BarrierInfo capturedInfo                 = barrierInfo;
+            capturedInfo.pPipePoints                 = nullptr;
+            capturedInfo.gpuEventWaitCount           = 0;
+            capturedInfo.ppGpuEvents                 = nullptr;
+            capturedInfo.rangeCheckedTargetWaitCount = 0;
+            capturedInfo.ppTargets                   = nullptr;
+            capturedInfo.transitionCount             = memoryTransitionCount;
+            capturedInfo.pTransitions                = nullptr;
+            capturedInfo.pSplitBarrierGpuEvent       = nullptr;
+
+            pCaptureStream->Write(capturedInfo);
+            pCaptureStream->Write(barrierInfo.pPipePoints, barrierInfo.pipePointWaitCount * sizeof(HwPipePoint));
+
+            for (uint32 i = 0; i < barrierInfo.transitionCount; i++)
+            {
+                if (barrierInfo.pTransitions[i].imageInfo.pImage == nullptr)
+                {
+                    pCaptureStream->Write(barrierInfo.pTransitions[i]);
+                }
+            }
+
+            m_pPlatform->CaptureEndFunc(pCaptureStream);
+        }
     }
 }
 
@@ -2965,6 +3162,137 @@ void CmdBuffer::CmdExecuteNestedCmdBuffers(
     }
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBuffer::CmdInsertSegments(
+    uint32            segmentCount,
+    ICmdBuffer*const* ppSegments)
+{
+    AutoBuffer<ICmdBuffer*, 16, Platform> nextSegments(segmentCount, m_pPlatform);
+
+    if (nextSegments.Capacity() < segmentCount)
+    {
+        // If the layers become production code, we must set a flag here and return out of memory on End().
+        PAL_ASSERT_ALWAYS();
+    }
+    else
+    {
+        for (uint32 i = 0; i < segmentCount; ++i)
+        {
+            nextSegments[i] = NextCmdBuffer(ppSegments[i]);
+        }
+
+        BeginFuncInfo funcInfo;
+        funcInfo.funcId       = InterfaceFunc::CmdBufferCmdInsertSegments;
+        funcInfo.objectId     = m_objectId;
+        funcInfo.preCallTime  = m_pPlatform->GetTime();
+        m_pNextLayer->CmdInsertSegments(segmentCount, &nextSegments[0]);
+        funcInfo.postCallTime = m_pPlatform->GetTime();
+
+        LogContext* pLogContext = nullptr;
+        if (m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+        {
+            pLogContext->BeginInput();
+            pLogContext->KeyAndBeginList("segments", false);
+
+            for (uint32 idx = 0; idx < segmentCount; ++idx)
+            {
+                pLogContext->Object(ppSegments[idx]);
+            }
+
+            pLogContext->EndList();
+            pLogContext->EndInput();
+
+            m_pPlatform->LogEndFunc(pLogContext);
+        }
+    }
+}
+
+// =====================================================================================================================
+void CmdBuffer::CmdDrawBatch(
+    const DrawBatchInfo& batchInfo)
+{
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::CmdBufferCmdDrawBatch;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = m_pPlatform->GetTime();
+    m_pNextLayer->CmdDrawBatch(batchInfo);
+    funcInfo.postCallTime = m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndValue("indexed", (batchInfo.flags.indexed != 0));
+        pLogContext->KeyAndBeginList("draws", false);
+
+        for (uint32 idx = 0; idx < batchInfo.drawCount; ++idx)
+        {
+            const DrawBatchEntry& draw = batchInfo.pDraws[idx];
+
+            pLogContext->BeginMap(false);
+            pLogContext->KeyAndValue("first", draw.first);
+            pLogContext->KeyAndValue("count", draw.count);
+            pLogContext->KeyAndValue("vertexOffset", draw.vertexOffset);
+            pLogContext->KeyAndValue("firstInstance", draw.firstInstance);
+            pLogContext->KeyAndValue("instanceCount", draw.instanceCount);
+            pLogContext->KeyAndValue("firstUserDataEntry", draw.firstUserDataEntry);
+            pLogContext->KeyAndBeginList("userDataValues", true);
+
+            for (uint32 entry = 0; entry < draw.userDataEntryCount; ++entry)
+            {
+                pLogContext->Value(draw.pUserDataEntries[entry]);
+            }
+
+            pLogContext->EndList();
+            pLogContext->EndMap();
+        }
+
+        pLogContext->EndList();
+        pLogContext->EndInput();
+
+        m_pPlatform->LogEndFunc(pLogContext);
+    }
+
+    // The capture format has no batch record, so each draw is captured as the equivalent user-data update and draw.
+    for (uint32 idx = 0; idx < batchInfo.drawCount; ++idx)
+    {
+        const DrawBatchEntry& draw = batchInfo.pDraws[idx];
+
+        CaptureStream* pCaptureStream = nullptr;
+        if ((draw.userDataEntryCount > 0) &&
+            m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetUserData, m_objectId, &pCaptureStream))
+        {
+            pCaptureStream->Write(PipelineBindPoint::Graphics);
+            pCaptureStream->Write(draw.firstUserDataEntry);
+            pCaptureStream->Write(draw.userDataEntryCount);
+            pCaptureStream->Write(draw.pUserDataEntries, draw.userDataEntryCount * sizeof(uint32));
+            m_pPlatform->CaptureEndFunc(pCaptureStream);
+        }
+
+        if (batchInfo.flags.indexed != 0)
+        {
+            if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdDrawIndexed, m_objectId, &pCaptureStream))
+            {
+                const uint32 args[] = { draw.first,
+                                        draw.count,
+                                        static_cast<uint32>(draw.vertexOffset),
+                                        draw.firstInstance,
+                                        draw.instanceCount };
+                pCaptureStream->Write(args);
+                m_pPlatform->CaptureEndFunc(pCaptureStream);
+            }
+        }
+        else if (m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdDraw, m_objectId, &pCaptureStream))
+        {
+            const uint32 args[] = { draw.first, draw.count, draw.firstInstance, draw.instanceCount };
+            pCaptureStream->Write(args);
+            m_pPlatform->CaptureEndFunc(pCaptureStream);
+        }
+    }
+}
+#endif
+
 // =====================================================================================================================
 void CmdBuffer::CmdSaveComputeState(
     uint32 stateFlags)
@@ -3248,6 +3576,16 @@ void PAL_STDCALL CmdBuffer::CmdSetUserDataCs(
 
         pThis->m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (pThis->m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetUserData, pThis->m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(PipelineBindPoint::Compute);
+        pCaptureStream->Write(firstEntry);
+        pCaptureStream->Write(entryCount);
+        pCaptureStream->Write(pEntryValues, entryCount * sizeof(uint32));
+        pThis->m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -3283,6 +3621,16 @@ void PAL_STDCALL CmdBuffer::CmdSetUserDataGfx(
 
         pThis->m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (pThis->m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdSetUserData, pThis->m_objectId, &pCaptureStream))
+    {
+        pCaptureStream->Write(PipelineBindPoint::Graphics);
+        pCaptureStream->Write(firstEntry);
+        pCaptureStream->Write(entryCount);
+        pCaptureStream->Write(pEntryValues, entryCount * sizeof(uint32));
+        pThis->m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -3314,6 +3662,14 @@ void PAL_STDCALL CmdBuffer::CmdDraw(
 
         pThis->m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (pThis->m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdDraw, pThis->m_objectId, &pCaptureStream))
+    {
+        const uint32 args[] = { firstVertex, vertexCount, firstInstance, instanceCount };
+        pCaptureStream->Write(args);
+        pThis->m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -3378,6 +3734,15 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndexed(
 
         pThis->m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (pThis->m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdDrawIndexed, pThis->m_objectId, &pCaptureStream))
+    {
+        const uint32 args[] =
+            { firstIndex, indexCount, static_cast<uint32>(vertexOffset), firstInstance, instanceCount };
+        pCaptureStream->Write(args);
+        pThis->m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -3477,6 +3842,14 @@ void PAL_STDCALL CmdBuffer::CmdDispatch(
 
         pThis->m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (pThis->m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdDispatch, pThis->m_objectId, &pCaptureStream))
+    {
+        const uint32 args[] = { x, y, z };
+        pCaptureStream->Write(args);
+        pThis->m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -3539,6 +3912,14 @@ void PAL_STDCALL CmdBuffer::CmdDispatchOffset(
 
         pThis->m_pPlatform->LogEndFunc(pLogContext);
     }
+
+    CaptureStream* pCaptureStream = nullptr;
+    if (pThis->m_pPlatform->CaptureBeginFunc(CaptureFunc::CmdDispatchOffset, pThis->m_objectId, &pCaptureStream))
+    {
+        const uint32 args[] = { xOffset, yOffset, zOffset, xDim, yDim, zDim };
+        pCaptureStream->Write(args);
+        pThis->m_pPlatform->CaptureEndFunc(pCaptureStream);
+    }
 }
 
 // =====================================================================================================================
@@ -60,6 +60,10 @@ public:
         const IColorBlendState* pColorBlendState) override;
     virtual void CmdBindDepthStencilState(
         const IDepthStencilState* pDepthStencilState) override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdBindStateBlock(
+        const IStateBlock* pStateBlock) override;
+#endif
     virtual void CmdSetDepthBounds(
         const DepthBoundsParams& params) override;
     virtual void CmdSetVertexBuffers(
@@ -443,6 +447,13 @@ public:
     virtual void CmdExecuteNestedCmdBuffers(
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdInsertSegments(
+        uint32            segmentCount,
+        ICmdBuffer*const* ppSegments) override;
+    virtual void CmdDrawBatch(
+        const DrawBatchInfo& batchInfo) override;
+#endif
     virtual void CmdSaveComputeState(
         uint32 stateFlags) override;
     virtual void CmdRestoreComputeState(
@@ -44,6 +44,7 @@
 #include "core/layers/interfaceLogger/interfaceLoggerQueue.h"
 #include "core/layers/interfaceLogger/interfaceLoggerQueueSemaphore.h"
 #include "core/layers/interfaceLogger/interfaceLoggerScreen.h"
+#include "core/layers/interfaceLogger/interfaceLoggerStateBlock.h"
 #include "core/layers/interfaceLogger/interfaceLoggerSwapChain.h"
 #include "palSysUtil.h"
 
@@ -1463,6 +1464,20 @@ Result Device::CreateComputePipeline(
         const uint32 objectId = pPlatform->NewObjectId(InterfaceObject::Pipeline);
 
         (*ppPipeline) = PAL_PLACEMENT_NEW(pPlacementAddr) Pipeline(pNextPipeline, this, objectId);
+
+        CaptureStream* pCaptureStream = nullptr;
+        if (pPlatform->CaptureBeginFunc(CaptureFunc::CreateComputePipeline, objectId, &pCaptureStream))
+        {
+            // The ELF follows the create info; the replayer points pPipelineBinary back at it.
+            ComputePipelineCreateInfo capturedInfo = createInfo;
+            capturedInfo.pPipelineBinary             = nullptr;
+            capturedInfo.pIndirectFuncList           = nullptr;
+            capturedInfo.indirectFuncCount           = 0;
+
+            pCaptureStream->Write(capturedInfo);
+            pCaptureStream->Write(createInfo.pPipelineBinary, createInfo.pipelineBinarySize);
+            pPlatform->CaptureEndFunc(pCaptureStream);
+        }
     }
 
     LogContext* pLogContext = nullptr;
@@ -1518,6 +1533,18 @@ Result Device::CreateGraphicsPipeline(
         const uint32 objectId = pPlatform->NewObjectId(InterfaceObject::Pipeline);
 
         (*ppPipeline) = PAL_PLACEMENT_NEW(pPlacementAddr) Pipeline(pNextPipeline, this, objectId);
+
+        CaptureStream* pCaptureStream = nullptr;
+        if (pPlatform->CaptureBeginFunc(CaptureFunc::CreateGraphicsPipeline, objectId, &pCaptureStream))
+        {
+            // The ELF follows the create info; the replayer points pPipelineBinary back at it.
+            GraphicsPipelineCreateInfo capturedInfo = createInfo;
+            capturedInfo.pPipelineBinary              = nullptr;
+
+            pCaptureStream->Write(capturedInfo);
+            pCaptureStream->Write(createInfo.pPipelineBinary, createInfo.pipelineBinarySize);
+            pPlatform->CaptureEndFunc(pCaptureStream);
+        }
     }
 
     LogContext* pLogContext = nullptr;
@@ -1574,6 +1601,13 @@ Result Device::CreateMsaaState(
         const uint32 objectId = pPlatform->NewObjectId(InterfaceObject::MsaaState);
 
         (*ppMsaaState) = PAL_PLACEMENT_NEW(pPlacementAddr) MsaaState(pNextState, this, objectId);
+
+        CaptureStream* pCaptureStream = nullptr;
+        if (pPlatform->CaptureBeginFunc(CaptureFunc::CreateMsaaState, objectId, &pCaptureStream))
+        {
+            pCaptureStream->Write(createInfo);
+            pPlatform->CaptureEndFunc(pCaptureStream);
+        }
     }
 
     LogContext* pLogContext = nullptr;
@@ -1630,6 +1664,13 @@ Result Device::CreateColorBlendState(
         const uint32 objectId = pPlatform->NewObjectId(InterfaceObject::ColorBlendState);
 
         (*ppColorBlendState) = PAL_PLACEMENT_NEW(pPlacementAddr) ColorBlendState(pNextState, this, objectId);
+
+        CaptureStream* pCaptureStream = nullptr;
+        if (pPlatform->CaptureBeginFunc(CaptureFunc::CreateColorBlendState, objectId, &pCaptureStream))
+        {
+            pCaptureStream->Write(createInfo);
+            pPlatform->CaptureEndFunc(pCaptureStream);
+        }
     }
 
     LogContext* pLogContext = nullptr;
@@ -1686,6 +1727,13 @@ Result Device::CreateDepthStencilState(
         const uint32 objectId = pPlatform->NewObjectId(InterfaceObject::DepthStencilState);
 
         (*ppDepthStencilState) = PAL_PLACEMENT_NEW(pPlacementAddr) DepthStencilState(pNextState, this, objectId);
+
+        CaptureStream* pCaptureStream = nullptr;
+        if (pPlatform->CaptureBeginFunc(CaptureFunc::CreateDepthStencilState, objectId, &pCaptureStream))
+        {
+            pCaptureStream->Write(createInfo);
+            pPlatform->CaptureEndFunc(pCaptureStream);
+        }
     }
 
     LogContext* pLogContext = nullptr;
@@ -1706,6 +1754,64 @@ Result Device::CreateDepthStencilState(
     return result;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+size_t Device::GetStateBlockSize(
+    const StateBlockCreateInfo& createInfo,
+    Result*                     pResult
+    ) const
+{
+    return m_pNextLayer->GetStateBlockSize(NextStateBlockCreateInfo(createInfo), pResult) + sizeof(StateBlock);
+}
+
+// =====================================================================================================================
+Result Device::CreateStateBlock(
+    const StateBlockCreateInfo& createInfo,
+    void*                       pPlacementAddr,
+    IStateBlock**               ppStateBlock
+    ) const
+{
+    auto*const   pPlatform       = static_cast<Platform*>(m_pPlatform);
+    IStateBlock* pNextStateBlock = nullptr;
+
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::DeviceCreateStateBlock;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = pPlatform->GetTime();
+    const Result result   = m_pNextLayer->CreateStateBlock(NextStateBlockCreateInfo(createInfo),
+                                                           NextObjectAddr<StateBlock>(pPlacementAddr),
+                                                           &pNextStateBlock);
+    funcInfo.postCallTime = pPlatform->GetTime();
+
+    if (result == Result::Success)
+    {
+        PAL_ASSERT(pNextStateBlock != nullptr);
+        pNextStateBlock->SetClientData(pPlacementAddr);
+
+        const uint32 objectId = pPlatform->NewObjectId(InterfaceObject::StateBlock);
+
+        (*ppStateBlock) = PAL_PLACEMENT_NEW(pPlacementAddr) StateBlock(pNextStateBlock, this, objectId);
+    }
+
+    LogContext* pLogContext = nullptr;
+    if (pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndStruct("createInfo", createInfo);
+        pLogContext->EndInput();
+
+        pLogContext->BeginOutput();
+        pLogContext->KeyAndEnum("result", result);
+        pLogContext->KeyAndObject("createdObj", *ppStateBlock);
+        pLogContext->EndOutput();
+
+        pPlatform->LogEndFunc(pLogContext);
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 size_t Device::GetQueueSemaphoreSize(
     const QueueSemaphoreCreateInfo& createInfo,
@@ -2127,6 +2233,13 @@ Result Device::CreateCmdAllocator(
         const uint32 objectId = pPlatform->NewObjectId(InterfaceObject::CmdAllocator);
 
         (*ppCmdAllocator) = PAL_PLACEMENT_NEW(pPlacementAddr) CmdAllocator(pNextCmdAllocator, this, objectId);
+
+        CaptureStream* pCaptureStream = nullptr;
+        if (pPlatform->CaptureBeginFunc(CaptureFunc::CreateCmdAllocator, objectId, &pCaptureStream))
+        {
+            pCaptureStream->Write(createInfo);
+            pPlatform->CaptureEndFunc(pCaptureStream);
+        }
     }
 
     LogContext* pLogContext = nullptr;
@@ -2188,6 +2301,17 @@ Result Device::CreateCmdBuffer(
         const uint32 objectId = pPlatform->NewObjectId(InterfaceObject::CmdBuffer);
 
         (*ppCmdBuffer) = PAL_PLACEMENT_NEW(pPlacementAddr) CmdBuffer(pNextCmdBuffer, this, objectId);
+
+        CaptureStream* pCaptureStream = nullptr;
+        if (pPlatform->CaptureBeginFunc(CaptureFunc::CreateCmdBuffer, objectId, &pCaptureStream))
+        {
+            CmdBufferCreateInfo capturedInfo = createInfo;
+            capturedInfo.pCmdAllocator       = nullptr;
+
+            pCaptureStream->Write(capturedInfo);
+            pCaptureStream->WriteObjectId(createInfo.pCmdAllocator);
+            pPlatform->CaptureEndFunc(pCaptureStream);
+        }
     }
 
     LogContext* pLogContext = nullptr;
@@ -230,6 +230,15 @@ public:
         const DepthStencilStateCreateInfo& createInfo,
         void*                              pPlacementAddr,
         IDepthStencilState**               ppDepthStencilState) const override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual size_t GetStateBlockSize(
+        const StateBlockCreateInfo& createInfo,
+        Result*                     pResult) const override;
+    virtual Result CreateStateBlock(
+        const StateBlockCreateInfo& createInfo,
+        void*                       pPlacementAddr,
+        IStateBlock**               ppStateBlock) const override;
+#endif
     virtual size_t GetQueueSemaphoreSize(
         const QueueSemaphoreCreateInfo& createInfo,
         Result*                         pResult) const override;
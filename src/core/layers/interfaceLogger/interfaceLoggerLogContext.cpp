@@ -45,6 +45,7 @@
 #include "core/layers/interfaceLogger/interfaceLoggerQueue.h"
 #include "core/layers/interfaceLogger/interfaceLoggerQueueSemaphore.h"
 #include "core/layers/interfaceLogger/interfaceLoggerScreen.h"
+#include "core/layers/interfaceLogger/interfaceLoggerStateBlock.h"
 #include "core/layers/interfaceLogger/interfaceLoggerSwapChain.h"
 
 using namespace Util;
@@ -79,6 +80,7 @@ const char*const ObjectNames[] =
     "IScreen",
     "IShader",
     "IShaderCache",
+    "IStateBlock",
     "ISwapChain",
 };
 
@@ -106,6 +108,9 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
     { InterfaceFunc::CmdBufferCmdBindMsaaState,                                 InterfaceObject::CmdBuffer,            "CmdBindMsaaState"                        },
     { InterfaceFunc::CmdBufferCmdBindColorBlendState,                           InterfaceObject::CmdBuffer,            "CmdBindColorBlendState"                  },
     { InterfaceFunc::CmdBufferCmdBindDepthStencilState,                         InterfaceObject::CmdBuffer,            "CmdBindDepthStencilState"                },
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    { InterfaceFunc::CmdBufferCmdBindStateBlock,                                InterfaceObject::CmdBuffer,            "CmdBindStateBlock"                       },
+#endif
     { InterfaceFunc::CmdBufferCmdSetDepthBounds,                                InterfaceObject::CmdBuffer,            "CmdSetDepthBounds"                       },
     { InterfaceFunc::CmdBufferCmdSetUserData,                                   InterfaceObject::CmdBuffer,            "CmdSetUserData"                          },
     { InterfaceFunc::CmdBufferCmdSetVertexBuffers,                              InterfaceObject::CmdBuffer,            "CmdSetVertexBuffers"                     },
@@ -198,6 +203,10 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
     { InterfaceFunc::CmdBufferCmdWriteCeRam,                                    InterfaceObject::CmdBuffer,            "CmdWriteCeRam"                           },
     { InterfaceFunc::CmdBufferCmdAllocateEmbeddedData,                          InterfaceObject::CmdBuffer,            "CmdAllocateEmbeddedData"                 },
     { InterfaceFunc::CmdBufferCmdExecuteNestedCmdBuffers,                       InterfaceObject::CmdBuffer,            "CmdExecuteNestedCmdBuffers"              },
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    { InterfaceFunc::CmdBufferCmdInsertSegments,                                InterfaceObject::CmdBuffer,            "CmdInsertSegments"                       },
+    { InterfaceFunc::CmdBufferCmdDrawBatch,                                     InterfaceObject::CmdBuffer,            "CmdDrawBatch"                            },
+#endif
     { InterfaceFunc::CmdBufferCmdSaveComputeState,                              InterfaceObject::CmdBuffer,            "CmdSaveComputeState"                     },
     { InterfaceFunc::CmdBufferCmdRestoreComputeState,                           InterfaceObject::CmdBuffer,            "CmdRestoreComputeState"                  },
     { InterfaceFunc::CmdBufferCmdExecuteIndirectCmds,                           InterfaceObject::CmdBuffer,            "CmdExecuteIndirectCmds"                  },
@@ -262,6 +271,9 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
     { InterfaceFunc::DeviceCreateMsaaState,                                     InterfaceObject::Device,               "CreateMsaaState"                         },
     { InterfaceFunc::DeviceCreateColorBlendState,                               InterfaceObject::Device,               "CreateColorBlendState"                   },
     { InterfaceFunc::DeviceCreateDepthStencilState,                             InterfaceObject::Device,               "CreateDepthStencilState"                 },
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    { InterfaceFunc::DeviceCreateStateBlock,                                    InterfaceObject::Device,               "CreateStateBlock"                        },
+#endif
     { InterfaceFunc::DeviceCreateQueueSemaphore,                                InterfaceObject::Device,               "CreateQueueSemaphore"                    },
     { InterfaceFunc::DeviceOpenSharedQueueSemaphore,                            InterfaceObject::Device,               "OpenSharedQueueSemaphore"                },
     { InterfaceFunc::DeviceOpenExternalSharedQueueSemaphore,                    InterfaceObject::Device,               "OpenExternalSharedQueueSemaphore"        },
@@ -341,6 +353,7 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
     { InterfaceFunc::ScreenSetGammaRamp,                                        InterfaceObject::Screen,               "SetGammaRamp"                            },
     { InterfaceFunc::ScreenWaitForVerticalBlank,                                InterfaceObject::Screen,               "WaitForVerticalBlank"                    },
     { InterfaceFunc::ScreenDestroy,                                             InterfaceObject::Screen,               "Destroy"                                 },
+    { InterfaceFunc::StateBlockDestroy,                                         InterfaceObject::StateBlock,           "Destroy"                                 },
     { InterfaceFunc::SwapChainAcquireNextImage,                                 InterfaceObject::SwapChain,            "AcquireNextImage"                        },
     { InterfaceFunc::SwapChainWaitIdle,                                         InterfaceObject::SwapChain,            "WaitIdle"                                },
     { InterfaceFunc::SwapChainDestroy,                                          InterfaceObject::SwapChain,            "Destroy"                                 },
@@ -785,6 +798,20 @@ void LogContext::Object(
     }
 }
 
+// =====================================================================================================================
+void LogContext::Object(
+    const IStateBlock* pDecorator)
+{
+    if (pDecorator != nullptr)
+    {
+        Object(InterfaceObject::StateBlock, static_cast<const StateBlock*>(pDecorator)->ObjectId());
+    }
+    else
+    {
+        NullValue();
+    }
+}
+
 // =====================================================================================================================
 void LogContext::Object(
     const ISwapChain* pDecorator)
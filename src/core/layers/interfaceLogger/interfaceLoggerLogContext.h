@@ -62,6 +62,7 @@ enum class InterfaceObject : uint32
     Screen,
     Shader,
     ShaderCache,
+    StateBlock,
     SwapChain,
     Count
 };
@@ -81,6 +82,9 @@ enum class InterfaceFunc : uint32
     CmdBufferCmdBindMsaaState,
     CmdBufferCmdBindColorBlendState,
     CmdBufferCmdBindDepthStencilState,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    CmdBufferCmdBindStateBlock,
+#endif
     CmdBufferCmdSetDepthBounds,
     CmdBufferCmdSetUserData,
     CmdBufferCmdSetVertexBuffers,
@@ -173,6 +177,10 @@ enum class InterfaceFunc : uint32
     CmdBufferCmdWriteCeRam,
     CmdBufferCmdAllocateEmbeddedData,
     CmdBufferCmdExecuteNestedCmdBuffers,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    CmdBufferCmdInsertSegments,
+    CmdBufferCmdDrawBatch,
+#endif
     CmdBufferCmdSaveComputeState,
     CmdBufferCmdRestoreComputeState,
     CmdBufferCmdExecuteIndirectCmds,
@@ -237,6 +245,9 @@ enum class InterfaceFunc : uint32
     DeviceCreateMsaaState,
     DeviceCreateColorBlendState,
     DeviceCreateDepthStencilState,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    DeviceCreateStateBlock,
+#endif
     DeviceCreateQueueSemaphore,
     DeviceOpenSharedQueueSemaphore,
     DeviceOpenExternalSharedQueueSemaphore,
@@ -316,6 +327,7 @@ enum class InterfaceFunc : uint32
     ScreenSetGammaRamp,
     ScreenWaitForVerticalBlank,
     ScreenDestroy,
+    StateBlockDestroy,
     SwapChainAcquireNextImage,
     SwapChainWaitIdle,
     SwapChainDestroy,
@@ -442,6 +454,7 @@ public:
     void Object(const IQueue* pDecorator);
     void Object(const IQueueSemaphore* pDecorator);
     void Object(const IScreen* pDecorator);
+    void Object(const IStateBlock* pDecorator);
     void Object(const ISwapChain* pDecorator);
 
     // These functions create a list or map that represents a PAL interface structure.
@@ -560,6 +573,7 @@ public:
     void Struct(const SetMgpuModeInput& value);
     void Struct(SignedExtent2d value);
     void Struct(SignedExtent3d value);
+    void Struct(const StateBlockCreateInfo& value);
     void Struct(const StencilRefMaskParams& value);
     void Struct(SubresId value);
     void Struct(SubresRange value);
@@ -685,6 +699,7 @@ public:
     void KeyAndObject(const char* pKey, const IQueue* pDecorator)                { Key(pKey); Object(pDecorator); }
     void KeyAndObject(const char* pKey, const IQueueSemaphore* pDecorator)       { Key(pKey); Object(pDecorator); }
     void KeyAndObject(const char* pKey, const IScreen* pDecorator)               { Key(pKey); Object(pDecorator); }
+    void KeyAndObject(const char* pKey, const IStateBlock* pDecorator)           { Key(pKey); Object(pDecorator); }
     void KeyAndObject(const char* pKey, const ISwapChain* pDecorator)            { Key(pKey); Object(pDecorator); }
 
     void KeyAndStruct(const char* pKey, const AcquireNextImageInfo& value)                { Key(pKey); Struct(value); }
@@ -801,6 +816,7 @@ public:
     void KeyAndStruct(const char* pKey, const SetMgpuModeInput& value)                    { Key(pKey); Struct(value); }
     void KeyAndStruct(const char* pKey, SignedExtent2d value)                             { Key(pKey); Struct(value); }
     void KeyAndStruct(const char* pKey, SignedExtent3d value)                             { Key(pKey); Struct(value); }
+    void KeyAndStruct(const char* pKey, const StateBlockCreateInfo& value)                { Key(pKey); Struct(value); }
     void KeyAndStruct(const char* pKey, const StencilRefMaskParams& value)                { Key(pKey); Struct(value); }
     void KeyAndStruct(const char* pKey, SubresId value)                                   { Key(pKey); Struct(value); }
     void KeyAndStruct(const char* pKey, SubresRange value)                                { Key(pKey); Struct(value); }
@@ -565,6 +565,23 @@ void LogContext::Struct(
         Value("disableBusyChunkTracking");
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    if (value.flags.perThreadChunkCache)
+    {
+        Value("perThreadChunkCache");
+    }
+
+    if (value.flags.backgroundReclaim)
+    {
+        Value("backgroundReclaim");
+    }
+
+    if (value.flags.sysMemHugePages)
+    {
+        Value("sysMemHugePages");
+    }
+#endif
+
     EndList();
     KeyAndBeginMap("allocInfo", false);
 
@@ -584,10 +601,17 @@ void LogContext::Struct(
         KeyAndEnum("allocHeap", value.allocInfo[idx].allocHeap);
         KeyAndValue("allocSize", value.allocInfo[idx].allocSize);
         KeyAndValue("suballocSize", value.allocInfo[idx].suballocSize);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        KeyAndValue("reclaimHighWaterMark", value.allocInfo[idx].reclaimHighWaterMark);
+#endif
         EndMap();
     }
 
     EndMap();
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    KeyAndValue("reclaimIntervalMs", value.reclaimIntervalMs);
+    KeyAndValue("prefaultChunkCount", value.prefaultChunkCount);
+#endif
     EndMap();
 }
 
@@ -2710,6 +2734,36 @@ void LogContext::Struct(
     EndMap();
 }
 
+// =====================================================================================================================
+void LogContext::Struct(
+    const StateBlockCreateInfo& value)
+{
+    BeginMap(false);
+    KeyAndObject("msaaState", value.pMsaaState);
+    KeyAndObject("colorBlendState", value.pColorBlendState);
+    KeyAndObject("depthStencilState", value.pDepthStencilState);
+
+    if (value.pViewports != nullptr)
+    {
+        KeyAndStruct("viewports", *value.pViewports);
+    }
+    else
+    {
+        KeyAndNullValue("viewports");
+    }
+
+    if (value.pScissorRects != nullptr)
+    {
+        KeyAndStruct("scissorRects", *value.pScissorRects);
+    }
+    else
+    {
+        KeyAndNullValue("scissorRects");
+    }
+
+    EndMap();
+}
+
 // =====================================================================================================================
 void LogContext::Struct(
     const StencilRefMaskParams& value)
@@ -65,6 +65,9 @@ static constexpr FuncLoggingTableEntry FuncLoggingTable[] =
     { InterfaceFunc::CmdBufferCmdBindMsaaState,                     (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdBindColorBlendState,               (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdBindDepthStencilState,             (CmdBuild)            },
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    { InterfaceFunc::CmdBufferCmdBindStateBlock,                    (CmdBuild)            },
+#endif
     { InterfaceFunc::CmdBufferCmdSetDepthBounds,                    (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdSetUserData,                       (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdSetVertexBuffers,                  (CmdBuild)            },
@@ -157,6 +160,10 @@ static constexpr FuncLoggingTableEntry FuncLoggingTable[] =
     { InterfaceFunc::CmdBufferCmdWriteCeRam,                        (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdAllocateEmbeddedData,              (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdExecuteNestedCmdBuffers,           (CmdBuild)            },
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    { InterfaceFunc::CmdBufferCmdInsertSegments,                    (CmdBuild)            },
+    { InterfaceFunc::CmdBufferCmdDrawBatch,                         (CmdBuild)            },
+#endif
     { InterfaceFunc::CmdBufferCmdSaveComputeState,                  (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdRestoreComputeState,               (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdExecuteIndirectCmds,               (CmdBuild)            },
@@ -221,6 +228,9 @@ static constexpr FuncLoggingTableEntry FuncLoggingTable[] =
     { InterfaceFunc::DeviceCreateMsaaState,                         (CrtDstry)            },
     { InterfaceFunc::DeviceCreateColorBlendState,                   (CrtDstry)            },
     { InterfaceFunc::DeviceCreateDepthStencilState,                 (CrtDstry)            },
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    { InterfaceFunc::DeviceCreateStateBlock,                        (CrtDstry)            },
+#endif
     { InterfaceFunc::DeviceCreateQueueSemaphore,                    (CrtDstry | QueueOps) },
     { InterfaceFunc::DeviceOpenSharedQueueSemaphore,                (CrtDstry | QueueOps) },
     { InterfaceFunc::DeviceOpenExternalSharedQueueSemaphore,        (CrtDstry | QueueOps) },
@@ -300,6 +310,7 @@ static constexpr FuncLoggingTableEntry FuncLoggingTable[] =
     { InterfaceFunc::ScreenSetGammaRamp,                            (GenCalls)            },
     { InterfaceFunc::ScreenWaitForVerticalBlank,                    (GenCalls)            },
     { InterfaceFunc::ScreenDestroy,                                 (CrtDstry)            },
+    { InterfaceFunc::StateBlockDestroy,                             (CrtDstry)            },
     { InterfaceFunc::SwapChainAcquireNextImage,                     (GenCalls | QueueOps) },
     { InterfaceFunc::SwapChainWaitIdle,                             (GenCalls)            },
     { InterfaceFunc::SwapChainDestroy,                              (CrtDstry)            },
@@ -318,6 +329,7 @@ Platform::Platform(
     PlatformDecorator(allocCb, InterfaceLoggerCb, enabled, enabled, pNextPlatform),
     m_createInfo(createInfo),
     m_pMainLog(nullptr),
+    m_pCaptureStream(nullptr),
     m_nextThreadId(0),
     m_objectId(0),
     m_activePreset(0),
@@ -371,6 +383,7 @@ Platform::~Platform()
     m_threadDataVec.Clear();
 
     PAL_SAFE_DELETE(m_pMainLog, this);
+    PAL_SAFE_DELETE(m_pCaptureStream, this);
 
     // If someone manages to call a logging function after destruction this might protect us a bit.
     m_flags.threadKeyCreated  = 0;
@@ -501,6 +514,32 @@ Result Platform::CommitLoggingSettings()
             result = m_pMainLog->OpenFile(logFilePath);
         }
 
+        if ((result == Result::Success) && settings.interfaceLoggerConfig.binaryCapture)
+        {
+            CaptureStream* pCaptureStream = PAL_NEW(CaptureStream, this, AllocInternal)(this);
+
+            if (pCaptureStream == nullptr)
+            {
+                result = Result::ErrorOutOfMemory;
+            }
+            else
+            {
+                char captureFilePath[512];
+                Snprintf(captureFilePath, sizeof(captureFilePath), "%s/pal_capture.bin", LogDirPath());
+
+                result = pCaptureStream->OpenFile(captureFilePath);
+            }
+
+            if (result == Result::Success)
+            {
+                m_pCaptureStream = pCaptureStream;
+            }
+            else
+            {
+                PAL_SAFE_DELETE(pCaptureStream, this);
+            }
+        }
+
         // If multithreaded logging is enabled, we need to go back over our previously allocated ThreadData and give
         // them a context.
         if ((result == Result::Success) && settings.interfaceLoggerConfig.multithreaded)
@@ -653,6 +692,23 @@ void Platform::LogEndFunc(
     }
 }
 
+// =====================================================================================================================
+bool Platform::CaptureBeginFunc(
+    CaptureFunc     func,
+    uint32          objectId,
+    CaptureStream** ppStream)
+{
+    const bool canCapture = (m_pCaptureStream != nullptr);
+
+    if (canCapture)
+    {
+        m_pCaptureStream->BeginRecord(func, objectId);
+        (*ppStream) = m_pCaptureStream;
+    }
+
+    return canCapture;
+}
+
 // =====================================================================================================================
 Result Platform::EnumerateDevices(
     uint32*  pDeviceCount,
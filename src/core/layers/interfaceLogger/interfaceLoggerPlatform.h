@@ -26,6 +26,7 @@
 #pragma once
 
 #include "core/layers/decorators.h"
+#include "core/layers/interfaceLogger/interfaceLoggerCaptureStream.h"
 #include "core/layers/interfaceLogger/interfaceLoggerLogContext.h"
 #include "palDevice.h"
 #include "palMutex.h"
@@ -104,6 +105,12 @@ public:
     bool LogBeginFunc(const BeginFuncInfo& info, LogContext** ppContext);
     void LogEndFunc(LogContext* pContext);
 
+    // CaptureBeginFunc must be called to begin writing a record to the binary command buffer capture. It returns true
+    // and a stream with a new record begun if binary capture is enabled. CaptureEndFunc must be called to finish the
+    // record. Binary capture is independent of the logging presets; every captured call is always recorded.
+    bool CaptureBeginFunc(CaptureFunc func, uint32 objectId, CaptureStream** ppStream);
+    void CaptureEndFunc(CaptureStream* pStream) { pStream->EndRecord(); }
+
     // Returns a new object ID for an object of the given type. Note that AtomicIncrement returns the result of the
     // increment so we must subtract one to get the ID for the current object.
     uint32 NewObjectId(InterfaceObject objectType)
@@ -154,6 +161,7 @@ private:
     LogContext*              m_pMainLog;          // Holds all logged data if multithreaded logging is disabled.
                                                   // Otherwise it holds some initial logged data and identifies all
                                                   // thread log files.
+    CaptureStream*           m_pCaptureStream;    // Binary command buffer capture, or null if it is disabled.
     uint32                   m_nextThreadId;      // Each thread file gets a unique ID (not the OS thread ID).
     uint32                   m_objectId;          // This object's unique ID.
     volatile uint32          m_activePreset;      // The index of the active preset in m_loggingPresets.
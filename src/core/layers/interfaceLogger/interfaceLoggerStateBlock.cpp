@@ -0,0 +1,67 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/layers/interfaceLogger/interfaceLoggerDevice.h"
+#include "core/layers/interfaceLogger/interfaceLoggerPlatform.h"
+#include "core/layers/interfaceLogger/interfaceLoggerStateBlock.h"
+
+namespace Pal
+{
+namespace InterfaceLogger
+{
+
+// =====================================================================================================================
+StateBlock::StateBlock(
+    IStateBlock*  pNextStateBlock,
+    const Device* pDevice,
+    uint32        objectId)
+    :
+    StateBlockDecorator(pNextStateBlock, pDevice),
+    m_pPlatform(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_objectId(objectId)
+{
+}
+
+// =====================================================================================================================
+void StateBlock::Destroy()
+{
+    // Note that we can't time a Destroy call.
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::StateBlockDestroy;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = m_pPlatform->GetTime();
+    funcInfo.postCallTime = funcInfo.preCallTime;
+
+    LogContext* pLogContext = nullptr;
+    if (m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        m_pPlatform->LogEndFunc(pLogContext);
+    }
+
+    StateBlockDecorator::Destroy();
+}
+
+} // InterfaceLogger
+} // Pal
@@ -171,7 +171,43 @@ void CmdBuffer::NotifyDrawDispatchValidation(
 {
     PAL_ASSERT(this == data.pCmdBuffer);
     m_validationData = data;
+
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    // The profile is only valid for the duration of the callback, so it must be accumulated immediately.
+    if (data.pProfile != nullptr)
+    {
+        const Developer::DrawValidationProfile& profile = *data.pProfile;
+        PAL_ASSERT(profile.specialization < NumValidationSpecializations);
+
+        ValidationCostData*const pSpecialization = &m_stats.validationSpecialization[profile.specialization];
+        ++pSpecialization->count;
+
+        for (uint32 i = 0; i < NumValidationStages; ++i)
+        {
+            m_stats.validationStage[i].count   += profile.stageCalls[i];
+            m_stats.validationStage[i].ticks   += profile.stageTicks[i];
+            m_stats.validationStage[i].cmdSize += profile.stageCmdSize[i];
+
+            pSpecialization->ticks   += profile.stageTicks[i];
+            pSpecialization->cmdSize += profile.stageCmdSize[i];
+        }
+
+        m_validationData.pProfile = nullptr;
+    }
+#endif
+}
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBuffer::NotifyBarrierEnd(
+    const Developer::BarrierData& data)
+{
+    PAL_ASSERT(this == data.pCmdBuffer);
+
+    m_stats.barriersCoalesced += data.operations.coalescing.barriersCoalesced;
+    m_stats.drainsSaved       += data.operations.coalescing.drainsSaved;
 }
+#endif
 
 // =====================================================================================================================
 void CmdBuffer::UpdateOptimizedRegisters(
@@ -447,6 +483,17 @@ void CmdBuffer::CmdBindDepthStencilState(
     PostCall(CmdBufCallId::CmdBindDepthStencilState);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBuffer::CmdBindStateBlock(
+    const IStateBlock* pStateBlock)
+{
+    PreCall();
+    CmdBufferFwdDecorator::CmdBindStateBlock(pStateBlock);
+    PostCall(CmdBufCallId::CmdBindStateBlock);
+}
+#endif
+
 // =====================================================================================================================
 void CmdBuffer::CmdBindIndexData(
     gpusize   gpuAddr,
@@ -1443,6 +1490,27 @@ void CmdBuffer::CmdExecuteNestedCmdBuffers(
     PostCall(CmdBufCallId::CmdExecuteNestedCmdBuffers);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+// =====================================================================================================================
+void CmdBuffer::CmdInsertSegments(
+    uint32            segmentCount,
+    ICmdBuffer*const* ppSegments)
+{
+    PreCall();
+    CmdBufferFwdDecorator::CmdInsertSegments(segmentCount, ppSegments);
+    PostCall(CmdBufCallId::CmdInsertSegments);
+}
+
+// =====================================================================================================================
+void CmdBuffer::CmdDrawBatch(
+    const DrawBatchInfo& batchInfo)
+{
+    PreDrawCall();
+    CmdBufferFwdDecorator::CmdDrawBatch(batchInfo);
+    PostDrawCall(CmdBufCallId::CmdDrawBatch);
+}
+#endif
+
 // =====================================================================================================================
 void CmdBuffer::CmdSaveComputeState(
     uint32 stateFlags)
@@ -59,6 +59,11 @@ public:
     virtual void CmdBindDepthStencilState(
         const IDepthStencilState* pDepthStencilState) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdBindStateBlock(
+        const IStateBlock* pStateBlock) override;
+#endif
+
     virtual void CmdBindIndexData(
         gpusize   gpuAddr,
         uint32    indexCount,
@@ -436,6 +441,15 @@ public:
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    virtual void CmdInsertSegments(
+        uint32            segmentCount,
+        ICmdBuffer*const* ppSegments) override;
+
+    virtual void CmdDrawBatch(
+        const DrawBatchInfo& batchInfo) override;
+#endif
+
     virtual void CmdSaveComputeState(
         uint32 stateFlags) override;
     virtual void CmdRestoreComputeState(
@@ -495,6 +509,10 @@ public:
         const Developer::DrawDispatchValidationData& data);
     void UpdateOptimizedRegisters(
         const Developer::OptimizedRegistersData& data);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    void NotifyBarrierEnd(
+        const Developer::BarrierData& data);
+#endif
 
     const Pm4Statistics& Statistics() const { return m_stats; }
 
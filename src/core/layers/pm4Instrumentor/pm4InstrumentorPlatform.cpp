@@ -57,11 +57,24 @@ static void PAL_STDCALL Pm4InstrumentorCb(
     case Developer::CallbackType::CreateImage:
         break;
     case Developer::CallbackType::BarrierBegin:
-    case Developer::CallbackType::BarrierEnd:
     case Developer::CallbackType::ImageBarrier:
         PAL_ASSERT(pCbData != nullptr);
         TranslateBarrierEventData(pCbData);
         break;
+    case Developer::CallbackType::BarrierEnd:
+        PAL_ASSERT(pCbData != nullptr);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        if (TranslateBarrierEventData(pCbData))
+        {
+            const auto& data    = *static_cast<Developer::BarrierData*>(pCbData);
+            auto*const  pCmdBuf = static_cast<CmdBuffer*>(data.pCmdBuffer);
+
+            pCmdBuf->NotifyBarrierEnd(data);
+        }
+#else
+        TranslateBarrierEventData(pCbData);
+#endif
+        break;
     case Developer::CallbackType::DrawDispatch:
         PAL_ASSERT(pCbData != nullptr);
         TranslateDrawDispatchData(pCbData);
@@ -213,10 +213,31 @@ void Queue::AccumulateStatistics(
             m_stats.internalEvent[j].count   += stats.internalEvent[j].count;
         }
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        for (uint32 j = 0; j < NumValidationStages; ++j)
+        {
+            m_stats.validationStage[j].cmdSize += stats.validationStage[j].cmdSize;
+            m_stats.validationStage[j].ticks   += stats.validationStage[j].ticks;
+            m_stats.validationStage[j].count   += stats.validationStage[j].count;
+        }
+
+        for (uint32 j = 0; j < NumValidationSpecializations; ++j)
+        {
+            m_stats.validationSpecialization[j].cmdSize += stats.validationSpecialization[j].cmdSize;
+            m_stats.validationSpecialization[j].ticks   += stats.validationSpecialization[j].ticks;
+            m_stats.validationSpecialization[j].count   += stats.validationSpecialization[j].count;
+        }
+#endif
+
         m_stats.commandBufferSize += stats.commandBufferSize;
         m_stats.embeddedDataSize  += stats.embeddedDataSize;
         m_stats.gpuScratchMemSize += stats.gpuScratchMemSize;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        m_stats.barriersCoalesced += stats.barriersCoalesced;
+        m_stats.drainsSaved       += stats.drainsSaved;
+#endif
+
         AccumulateRegisterInfo(&m_shRegs,  pCmdBuf->ShRegs());
         AccumulateRegisterInfo(&m_ctxRegs, pCmdBuf->CtxRegs());
 
@@ -227,6 +248,103 @@ void Queue::AccumulateStatistics(
     m_cmdBufCount += count;
 }
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+// =====================================================================================================================
+static const char* ValidationStageToString(
+    uint32 stage)
+{
+    const char*const StringTable[] =
+    {
+        "Pipeline",         // Pipeline
+        "UserData",         // UserData
+        "Viewports",        // Viewports
+        "ScissorRects",     // ScissorRects
+        "DrawTimeHwState",  // DrawTimeHwState
+        "Other",            // Other
+    };
+
+    static_assert(ArrayLen(StringTable) == NumValidationStages,
+                  "The ValidationStageToString string table needs to be updated.");
+
+    PAL_ASSERT(stage < NumValidationStages);
+
+    return StringTable[stage];
+}
+
+// =====================================================================================================================
+// Helper function to print out the CPU and PM4 cost of a validation stage or specialization in .csv format.
+static void PrintValidationCost(
+    const File&               logFile,
+    const char*               pName,
+    const ValidationCostData& data,
+    int64                     perfFrequency)
+{
+    const uint64 microseconds = (static_cast<uint64>(data.ticks) * 1000000ull) / static_cast<uint64>(perfFrequency);
+    logFile.Printf("%s,%d,%llu,%llu\n", pName, data.count, data.cmdSize, microseconds);
+}
+
+// =====================================================================================================================
+// Helper function to print out draw-time validation cost statistics in .csv format.
+static void PrintValidationStats(
+    const File&          logFile,
+    const Pm4Statistics& stats)
+{
+    const int64 perfFrequency = GetPerfFrequency();
+
+    logFile.Printf("\nValidation Stage,Count,Total Bytes,Total CPU us\n");
+
+    for (uint32 i = 0; i < NumValidationStages; ++i)
+    {
+        if (stats.validationStage[i].count > 0)
+        {
+            PrintValidationCost(logFile, ValidationStageToString(i), stats.validationStage[i], perfFrequency);
+        }
+    }
+
+    const char*const FlagNames[] =
+    {
+        "Indexed",          // DrawValidationIndexed
+        "Indirect",         // DrawValidationIndirect
+        "Pm4OptImmediate",  // DrawValidationPm4OptImmediate
+        "PipelineDirty",    // DrawValidationPipelineDirty
+        "StateDirty",       // DrawValidationStateDirty
+        "Ngg",              // DrawValidationNgg
+        "NggFastLaunch",    // DrawValidationNggFastLaunch
+    };
+
+    static_assert((1u << ArrayLen(FlagNames)) == NumValidationSpecializations,
+                  "The specialization flag name table needs to be updated.");
+
+    logFile.Printf("\nValidateDraw Specialization,Count,Total Bytes,Total CPU us\n");
+
+    for (uint32 i = 0; i < NumValidationSpecializations; ++i)
+    {
+        if (stats.validationSpecialization[i].count == 0)
+        {
+            continue; // Skip specializations which were never hit.
+        }
+
+        // Build a name such as "ValidateDraw<Indexed|StateDirty>" from the specialization's flags.
+        char   name[256] = "ValidateDraw<";
+        size_t length    = strlen(name);
+
+        for (uint32 flag = 0; flag < ArrayLen(FlagNames); ++flag)
+        {
+            if (TestAnyFlagSet(i, 1u << flag))
+            {
+                Snprintf(&name[length], sizeof(name) - length, "%s%s", (name[length - 1] == '<') ? "" : "|",
+                         FlagNames[flag]);
+                length = strlen(name);
+            }
+        }
+
+        Snprintf(&name[length], sizeof(name) - length, ">");
+
+        PrintValidationCost(logFile, &name[0], stats.validationSpecialization[i], perfFrequency);
+    }
+}
+#endif
+
 // =====================================================================================================================
 // Helper function to print out optimized register statistics in .csv format.
 static void PrintRegisterStats(
@@ -292,6 +410,18 @@ void Queue::DumpStatistics()
         logFile.Printf("Embedded Data Footprint,%d,%llu\n",    m_cmdBufCount, m_stats.embeddedDataSize);
         logFile.Printf("GPU Scratch Mem Footprint,%d,%llu\n",  m_cmdBufCount, m_stats.gpuScratchMemSize);
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        if (m_stats.barriersCoalesced > 0)
+        {
+            logFile.Printf("\nCoalesced Barriers,%u\n",  m_stats.barriersCoalesced);
+            logFile.Printf("Pipeline Drains Saved,%u\n", m_stats.drainsSaved);
+        }
+#endif
+
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+        PrintValidationStats(logFile, m_stats);
+#endif
+
         if (m_shRegs.IsEmpty() == false)
         {
             logFile.Printf("\nSH Register Offset, Total, Kept\n");
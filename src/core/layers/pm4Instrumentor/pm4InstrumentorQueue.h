@@ -67,15 +67,41 @@ struct Pm4CallData
     uint32   count;    // Number of times the command buffer entry point was called
 };
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+// Number of distinct draw-time validation stages which are profiled by the Gfx9 universal command buffer.
+constexpr uint32 NumValidationStages = static_cast<uint32>(Developer::DrawValidationStage::Count);
+
+// Number of distinct ValidateDraw() template specializations, indexed by their DrawValidationSpecialization mask.
+constexpr uint32 NumValidationSpecializations = Developer::DrawValidationSpecializationCount;
+
+// CPU and PM4 cost of a single draw-time validation stage or ValidateDraw() specialization.
+struct ValidationCostData
+{
+    gpusize  cmdSize;  // Total size of PM4 commands written over the lifetime of the object.
+    int64    ticks;    // Total CPU time spent, in performance counter ticks.
+    uint32   count;    // Number of times the stage or specialization was executed.
+};
+#endif
+
 // Contains PM4 statistics for a single command buffer, queue, or device.
 struct Pm4Statistics
 {
     Pm4CallData  call[NumCallIds];
     Pm4CallData  internalEvent[NumEventIds];
 
+#if PAL_BUILD_DRAW_VALIDATION_PROFILER
+    ValidationCostData  validationStage[NumValidationStages];
+    ValidationCostData  validationSpecialization[NumValidationSpecializations];
+#endif
+
     gpusize  commandBufferSize; // Total amount of command buffer memory used over the lifetime of the object.
     gpusize  embeddedDataSize;  // Total amount of embedded data used over the lifetime of the object.
     gpusize  gpuScratchMemSize; // Total amount of GPU scratch memory used over the lifetime of the object.
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    uint32   barriersCoalesced; // Number of barriers whose syncs were merged into the previous barrier's.
+    uint32   drainsSaved;       // Number of pipeline drains avoided by merging barrier syncs.
+#endif
 };
 
 // Contains a single record of a register for tracking usage within the PM4 optimizer.
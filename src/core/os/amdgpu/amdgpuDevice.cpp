@@ -37,6 +37,7 @@
 #include "palAutoBuffer.h"
 #include "palHashMapImpl.h"
 #include "palInlineFuncs.h"
+#include "palOpenHashMapImpl.h"
 #include "palSettingsFileMgrImpl.h"
 #include "palSysMemory.h"
 #include "palSysUtil.h"
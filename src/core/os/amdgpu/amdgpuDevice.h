@@ -34,6 +34,7 @@
 #include "core/svmMgr.h"
 #include "palHashMap.h"
 #include "palIntrusiveList.h"
+#include "palOpenHashMap.h"
 
 namespace Pal
 {
@@ -936,7 +937,7 @@ private:
     static Result ParseClkInfo(const char* pFilePath, ClkInfo* pClkInfo, uint32* pCurIndex);
     Result        InitClkInfo();
 
-    typedef Util::HashMap<IGpuMemory*, uint32, Pal::Platform> MemoryRefMap;
+    typedef Util::OpenHashMap<IGpuMemory*, uint32, Pal::Platform> MemoryRefMap;
     MemoryRefMap m_globalRefMap;
     Util::Mutex  m_globalRefLock;
     static constexpr uint32 MemoryRefMapElements = 2048;
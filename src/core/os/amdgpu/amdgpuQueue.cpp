@@ -39,7 +39,7 @@
 #include "palAutoBuffer.h"
 #include "palDequeImpl.h"
 #include "palListImpl.h"
-#include "palHashMapImpl.h"
+#include "palOpenHashMapImpl.h"
 #include "palVectorImpl.h"
 
 #include <climits>
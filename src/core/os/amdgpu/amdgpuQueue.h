@@ -27,7 +27,7 @@
 
 #include "core/queue.h"
 #include "core/os/amdgpu/amdgpuHeaders.h"
-#include "palHashMap.h"
+#include "palOpenHashMap.h"
 #include "palVector.h"
 
 // It is a temporary solution while we are waiting for open source promotion.
@@ -223,7 +223,7 @@ private:
         bool                      isDummySubmission);
 
     // Tracks global memory references for this queue. Each key is a GPU memory object and each value is a refcount.
-    typedef Util::HashMap<IGpuMemory*, uint32, Pal::Platform> MemoryRefMap;
+    typedef Util::OpenHashMap<IGpuMemory*, uint32, Pal::Platform> MemoryRefMap;
 
     // Kernel object representing a list of GPU memory allocations referenced by a submit.
     // Stored as a member variable to prevent re-creating the kernel object on every submit
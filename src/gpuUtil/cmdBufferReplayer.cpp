@@ -0,0 +1,1008 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palAutoBuffer.h"
+#include "palCmdAllocator.h"
+#include "palCmdBuffer.h"
+#include "palCmdBufferReplayer.h"
+#include "palColorBlendState.h"
+#include "palDepthStencilState.h"
+#include "palFile.h"
+#include "palMsaaState.h"
+#include "palPipeline.h"
+#include "palPlatform.h"
+#include "palSysMemory.h"
+#include "palSysUtil.h"
+#include "palVectorImpl.h"
+
+#include <string.h>
+
+using namespace Pal;
+using namespace GpuUtil::CmdCapture;
+
+namespace GpuUtil
+{
+
+// Guards against corrupt captures which would make us grow an object table without bound.
+constexpr uint32 MaxObjectId = (1u << 24);
+
+// =====================================================================================================================
+// Sequentially decodes the payload of a single capture record.  Payloads are tightly packed, so every value is copied
+// out rather than referenced in place.
+class PayloadReader
+{
+public:
+    PayloadReader(const uint8* pData, uint32 size) : m_pData(pData), m_size(size), m_offset(0) { }
+
+    // Copies the next "size" bytes into pDst. Returns false if the payload is too small.
+    bool Read(void* pDst, size_t size)
+    {
+        const bool valid = (size <= (m_size - m_offset));
+
+        if (valid)
+        {
+            memcpy(pDst, m_pData + m_offset, size);
+            m_offset += static_cast<uint32>(size);
+        }
+
+        return valid;
+    }
+
+    template <typename T>
+    bool Read(T* pValue) { return Read(pValue, sizeof(T)); }
+
+    // Returns the unread remainder of the payload.
+    const uint8* Remaining(uint32* pSize) const
+    {
+        (*pSize) = m_size - m_offset;
+        return m_pData + m_offset;
+    }
+
+private:
+    const uint8*const m_pData;
+    const uint32      m_size;
+    uint32            m_offset;
+
+    PAL_DISALLOW_DEFAULT_CTOR(PayloadReader);
+    PAL_DISALLOW_COPY_AND_ASSIGN(PayloadReader);
+};
+
+// =====================================================================================================================
+CmdBufferReplayer::CmdBufferReplayer(
+    IPlatform* pPlatform,
+    IDevice*   pDevice)
+    :
+    m_pPlatform(pPlatform),
+    m_pDevice(pDevice),
+    m_pData(nullptr),
+    m_dataSize(0),
+    m_pFileData(nullptr),
+    m_cmdAllocators(pPlatform),
+    m_pipelines(pPlatform),
+    m_msaaStates(pPlatform),
+    m_colorBlendStates(pPlatform),
+    m_depthStencilStates(pPlatform),
+    m_cmdBuffers(pPlatform)
+{
+}
+
+// =====================================================================================================================
+CmdBufferReplayer::~CmdBufferReplayer()
+{
+    DestroyObjects();
+
+    PAL_SAFE_FREE(m_pFileData, m_pPlatform);
+}
+
+// =====================================================================================================================
+Result CmdBufferReplayer::Init(
+    const char* pFilePath)
+{
+    Result       result   = Result::ErrorInvalidValue;
+    const size_t fileSize = Util::File::GetFileSize(pFilePath);
+
+    if (fileSize > 0)
+    {
+        m_pFileData = PAL_MALLOC(fileSize, m_pPlatform, Util::AllocInternal);
+        result      = (m_pFileData != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        Util::File file;
+        result = file.Open(pFilePath, Util::FileAccessRead | Util::FileAccessBinary);
+
+        size_t bytesRead = 0;
+
+        if (result == Result::Success)
+        {
+            result = file.Read(m_pFileData, fileSize, &bytesRead);
+            file.Close();
+        }
+
+        if (result == Result::Success)
+        {
+            result = Init(m_pFileData, bytesRead);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result CmdBufferReplayer::Init(
+    const void* pData,
+    size_t      size)
+{
+    m_pData    = static_cast<const uint8*>(pData);
+    m_dataSize = size;
+
+    return ValidateHeader();
+}
+
+// =====================================================================================================================
+// Verifies that the capture was written by a compatible build of PAL.
+Result CmdBufferReplayer::ValidateHeader()
+{
+    Result result = Result::ErrorInvalidValue;
+
+    if ((m_pData != nullptr) && (m_dataSize >= sizeof(FileHeader)))
+    {
+        FileHeader header = {};
+        memcpy(&header, m_pData, sizeof(header));
+
+        if ((header.magic                 == FileMagic)                          &&
+            (header.version               == FileVersion)                        &&
+            (header.interfaceMajorVersion == PAL_CLIENT_INTERFACE_MAJOR_VERSION) &&
+            (header.pointerSize           == sizeof(void*)))
+        {
+            result = Result::Success;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result CmdBufferReplayer::Replay(
+    ReplayStats* pStats)
+{
+    ReplayStats stats = {};
+    Result      result = (m_pData != nullptr) ? Result::Success : Result::ErrorUnavailable;
+    size_t      offset = sizeof(FileHeader);
+
+    while ((result == Result::Success) && (offset < m_dataSize))
+    {
+        RecordHeader header = {};
+
+        if ((m_dataSize - offset) < sizeof(header))
+        {
+            result = Result::ErrorInvalidValue;
+        }
+        else
+        {
+            memcpy(&header, m_pData + offset, sizeof(header));
+            offset += sizeof(header);
+
+            if (((m_dataSize - offset) < header.size) || (header.func >= Func::Count))
+            {
+                result = Result::ErrorInvalidValue;
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            const uint8*const pPayload = m_pData + offset;
+            offset += header.size;
+
+            if (header.func <= Func::CreateDepthStencilState)
+            {
+                bool malformed = false;
+                result = CreateObject(header, pPayload, &malformed);
+
+                if (malformed)
+                {
+                    result = Result::ErrorInvalidValue;
+                }
+                else if (result == Result::Success)
+                {
+                    stats.recordsReplayed++;
+                }
+                else
+                {
+                    // The device couldn't recreate the object; anything that uses it will be skipped.
+                    stats.recordsSkipped++;
+                    result = Result::Success;
+                }
+            }
+            else if (ReplayCmdBufferCall(header, pPayload, &stats))
+            {
+                stats.recordsReplayed++;
+            }
+            else
+            {
+                stats.recordsSkipped++;
+            }
+        }
+    }
+
+    if (pStats != nullptr)
+    {
+        (*pStats) = stats;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Recreates the object described by a creation record, unless a previous replay already created it.  Sets pMalformed
+// if the record could not be decoded.
+Result CmdBufferReplayer::CreateObject(
+    const RecordHeader& header,
+    const uint8*        pPayload,
+    bool*               pMalformed)
+{
+    PayloadReader reader(pPayload, header.size);
+
+    Result        result  = Result::Success;
+    void*         pMemory = nullptr;
+    IDestroyable* pObject = nullptr;
+
+    switch (header.func)
+    {
+    case Func::CreateCmdAllocator:
+        if (LookupObject(m_cmdAllocators, header.objectId) == nullptr)
+        {
+            CmdAllocatorCreateInfo createInfo = {};
+
+            if (reader.Read(&createInfo))
+            {
+                pMemory = PAL_MALLOC(m_pDevice->GetCmdAllocatorSize(createInfo, &result),
+                                     m_pPlatform,
+                                     Util::AllocInternal);
+
+                if ((result == Result::Success) && (pMemory == nullptr))
+                {
+                    result = Result::ErrorOutOfMemory;
+                }
+                else if (result == Result::Success)
+                {
+                    ICmdAllocator* pCmdAllocator = nullptr;
+                    result  = m_pDevice->CreateCmdAllocator(createInfo, pMemory, &pCmdAllocator);
+                    pObject = pCmdAllocator;
+                }
+
+                if (result == Result::Success)
+                {
+                    result = StoreObject(&m_cmdAllocators, header.objectId, pObject);
+                }
+            }
+            else
+            {
+                (*pMalformed) = true;
+            }
+        }
+        break;
+
+    case Func::CreateCmdBuffer:
+        if ((header.objectId >= m_cmdBuffers.NumElements()) ||
+            (m_cmdBuffers.At(header.objectId).pCmdBuffer == nullptr))
+        {
+            CmdBufferCreateInfo createInfo  = {};
+            uint32              allocatorId = NullObjectId;
+
+            if (reader.Read(&createInfo) && reader.Read(&allocatorId))
+            {
+                createInfo.pCmdAllocator = static_cast<ICmdAllocator*>(LookupObject(m_cmdAllocators, allocatorId));
+
+                if (createInfo.pCmdAllocator == nullptr)
+                {
+                    result = Result::ErrorUnavailable;
+                }
+                else
+                {
+                    pMemory = PAL_MALLOC(m_pDevice->GetCmdBufferSize(createInfo, &result),
+                                         m_pPlatform,
+                                         Util::AllocInternal);
+                }
+
+                ICmdBuffer* pCmdBuffer = nullptr;
+
+                if ((result == Result::Success) && (pMemory == nullptr))
+                {
+                    result = Result::ErrorOutOfMemory;
+                }
+                else if (result == Result::Success)
+                {
+                    result  = m_pDevice->CreateCmdBuffer(createInfo, pMemory, &pCmdBuffer);
+                    pObject = pCmdBuffer;
+                }
+
+                if ((result == Result::Success) && (header.objectId >= MaxObjectId))
+                {
+                    (*pMalformed) = true;
+                    result        = Result::ErrorInvalidValue;
+                }
+
+                const ReplayCmdBuffer empty = {};
+
+                while ((result == Result::Success) && (m_cmdBuffers.NumElements() <= header.objectId))
+                {
+                    result = m_cmdBuffers.PushBack(empty);
+                }
+
+                if (result == Result::Success)
+                {
+                    m_cmdBuffers.At(header.objectId).pCmdBuffer = pCmdBuffer;
+                    m_cmdBuffers.At(header.objectId).valid      = false;
+                }
+            }
+            else
+            {
+                (*pMalformed) = true;
+            }
+        }
+        break;
+
+    case Func::CreateComputePipeline:
+    case Func::CreateGraphicsPipeline:
+        if (LookupObject(m_pipelines, header.objectId) == nullptr)
+        {
+            ComputePipelineCreateInfo  computeInfo  = {};
+            GraphicsPipelineCreateInfo graphicsInfo = {};
+
+            const bool isCompute = (header.func == Func::CreateComputePipeline);
+            const bool valid     = isCompute ? reader.Read(&computeInfo) : reader.Read(&graphicsInfo);
+
+            uint32       binarySize = 0;
+            const uint8* pBinary    = reader.Remaining(&binarySize);
+
+            // The pipeline ELF is not aligned within the capture; give PAL an aligned copy.
+            void* pBinaryCopy = valid ? PAL_MALLOC(binarySize, m_pPlatform, Util::AllocInternalTemp) : nullptr;
+
+            if (valid == false)
+            {
+                (*pMalformed) = true;
+            }
+            else if (pBinaryCopy == nullptr)
+            {
+                result = Result::ErrorOutOfMemory;
+            }
+            else
+            {
+                memcpy(pBinaryCopy, pBinary, binarySize);
+
+                IPipeline* pPipeline = nullptr;
+
+                if (isCompute)
+                {
+                    computeInfo.pPipelineBinary    = pBinaryCopy;
+                    computeInfo.pipelineBinarySize = binarySize;
+                    computeInfo.pIndirectFuncList  = nullptr;
+                    computeInfo.indirectFuncCount  = 0;
+
+                    pMemory = PAL_MALLOC(m_pDevice->GetComputePipelineSize(computeInfo, &result),
+                                         m_pPlatform,
+                                         Util::AllocInternal);
+
+                    if ((result == Result::Success) && (pMemory == nullptr))
+                    {
+                        result = Result::ErrorOutOfMemory;
+                    }
+                    else if (result == Result::Success)
+                    {
+                        result = m_pDevice->CreateComputePipeline(computeInfo, pMemory, &pPipeline);
+                    }
+                }
+                else
+                {
+                    graphicsInfo.pPipelineBinary    = pBinaryCopy;
+                    graphicsInfo.pipelineBinarySize = binarySize;
+
+                    pMemory = PAL_MALLOC(m_pDevice->GetGraphicsPipelineSize(graphicsInfo, &result),
+                                         m_pPlatform,
+                                         Util::AllocInternal);
+
+                    if ((result == Result::Success) && (pMemory == nullptr))
+                    {
+                        result = Result::ErrorOutOfMemory;
+                    }
+                    else if (result == Result::Success)
+                    {
+                        result = m_pDevice->CreateGraphicsPipeline(graphicsInfo, pMemory, &pPipeline);
+                    }
+                }
+
+                PAL_SAFE_FREE(pBinaryCopy, m_pPlatform);
+
+                pObject = pPipeline;
+
+                if (result == Result::Success)
+                {
+                    result = StoreObject(&m_pipelines, header.objectId, pObject);
+                }
+            }
+        }
+        break;
+
+    case Func::CreateMsaaState:
+        if (LookupObject(m_msaaStates, header.objectId) == nullptr)
+        {
+            MsaaStateCreateInfo createInfo = {};
+
+            if (reader.Read(&createInfo))
+            {
+                pMemory = PAL_MALLOC(m_pDevice->GetMsaaStateSize(createInfo, &result),
+                                     m_pPlatform,
+                                     Util::AllocInternal);
+
+                if ((result == Result::Success) && (pMemory == nullptr))
+                {
+                    result = Result::ErrorOutOfMemory;
+                }
+                else if (result == Result::Success)
+                {
+                    IMsaaState* pMsaaState = nullptr;
+                    result  = m_pDevice->CreateMsaaState(createInfo, pMemory, &pMsaaState);
+                    pObject = pMsaaState;
+                }
+
+                if (result == Result::Success)
+                {
+                    result = StoreObject(&m_msaaStates, header.objectId, pObject);
+                }
+            }
+            else
+            {
+                (*pMalformed) = true;
+            }
+        }
+        break;
+
+    case Func::CreateColorBlendState:
+        if (LookupObject(m_colorBlendStates, header.objectId) == nullptr)
+        {
+            ColorBlendStateCreateInfo createInfo = {};
+
+            if (reader.Read(&createInfo))
+            {
+                pMemory = PAL_MALLOC(m_pDevice->GetColorBlendStateSize(createInfo, &result),
+                                     m_pPlatform,
+                                     Util::AllocInternal);
+
+                if ((result == Result::Success) && (pMemory == nullptr))
+                {
+                    result = Result::ErrorOutOfMemory;
+                }
+                else if (result == Result::Success)
+                {
+                    IColorBlendState* pColorBlendState = nullptr;
+                    result  = m_pDevice->CreateColorBlendState(createInfo, pMemory, &pColorBlendState);
+                    pObject = pColorBlendState;
+                }
+
+                if (result == Result::Success)
+                {
+                    result = StoreObject(&m_colorBlendStates, header.objectId, pObject);
+                }
+            }
+            else
+            {
+                (*pMalformed) = true;
+            }
+        }
+        break;
+
+    case Func::CreateDepthStencilState:
+        if (LookupObject(m_depthStencilStates, header.objectId) == nullptr)
+        {
+            DepthStencilStateCreateInfo createInfo = {};
+
+            if (reader.Read(&createInfo))
+            {
+                pMemory = PAL_MALLOC(m_pDevice->GetDepthStencilStateSize(createInfo, &result),
+                                     m_pPlatform,
+                                     Util::AllocInternal);
+
+                if ((result == Result::Success) && (pMemory == nullptr))
+                {
+                    result = Result::ErrorOutOfMemory;
+                }
+                else if (result == Result::Success)
+                {
+                    IDepthStencilState* pDepthStencilState = nullptr;
+                    result  = m_pDevice->CreateDepthStencilState(createInfo, pMemory, &pDepthStencilState);
+                    pObject = pDepthStencilState;
+                }
+
+                if (result == Result::Success)
+                {
+                    result = StoreObject(&m_depthStencilStates, header.objectId, pObject);
+                }
+            }
+            else
+            {
+                (*pMalformed) = true;
+            }
+        }
+        break;
+
+    default:
+        PAL_NEVER_CALLED();
+        break;
+    }
+
+    if ((result != Result::Success) && (pObject != nullptr))
+    {
+        // The object was created but we couldn't track it.
+        pObject->Destroy();
+        pObject = nullptr;
+    }
+
+    if ((result != Result::Success) && (pObject == nullptr))
+    {
+        PAL_SAFE_FREE(pMemory, m_pPlatform);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Re-issues a single command buffer call.  Returns false if the call was skipped.
+bool CmdBufferReplayer::ReplayCmdBufferCall(
+    const RecordHeader& header,
+    const uint8*        pPayload,
+    ReplayStats*        pStats)
+{
+    ReplayCmdBuffer* pState = (header.objectId < m_cmdBuffers.NumElements()) ? &m_cmdBuffers.At(header.objectId)
+                                                                               : nullptr;
+    ICmdBuffer*const pCmdBuffer = (pState != nullptr) ? pState->pCmdBuffer : nullptr;
+
+    // Every call other than Begin and Reset requires that nothing was skipped since the last Begin.
+    bool replay = (pCmdBuffer != nullptr) &&
+                  (pState->valid || (header.func == Func::CmdBufferBegin) || (header.func == Func::CmdBufferReset));
+
+    PayloadReader reader(pPayload, header.size);
+
+    const int64 startTicks = Util::GetPerfCpuTime();
+
+    if (replay)
+    {
+        switch (header.func)
+        {
+        case Func::CmdBufferBegin:
+        {
+            CmdBufferBuildInfo buildInfo = {};
+            replay = reader.Read(&buildInfo.flags) && (pCmdBuffer->Begin(buildInfo) == Result::Success);
+            break;
+        }
+        case Func::CmdBufferEnd:
+            replay = (pCmdBuffer->End() == Result::Success);
+            pStats->cmdBuffersBuilt += replay ? 1 : 0;
+            break;
+
+        case Func::CmdBufferReset:
+        {
+            uint32 allocatorId     = NullObjectId;
+            uint32 returnGpuMemory = 0;
+
+            replay = reader.Read(&allocatorId) && reader.Read(&returnGpuMemory);
+
+            if (replay)
+            {
+                auto*const pCmdAllocator = static_cast<ICmdAllocator*>(LookupObject(m_cmdAllocators, allocatorId));
+
+                replay = ((pCmdAllocator != nullptr) || (allocatorId == NullObjectId)) &&
+                         (pCmdBuffer->Reset(pCmdAllocator, (returnGpuMemory != 0)) == Result::Success);
+            }
+            break;
+        }
+        case Func::CmdBindPipeline:
+        {
+            PipelineBindParams params     = {};
+            uint32             pipelineId = NullObjectId;
+
+            replay = reader.Read(&params.pipelineBindPoint) &&
+                     reader.Read(&pipelineId)               &&
+                     reader.Read(&params.apiPsoHash);
+
+            if (replay)
+            {
+                params.pPipeline = static_cast<const IPipeline*>(LookupObject(m_pipelines, pipelineId));
+                replay           = (params.pPipeline != nullptr) || (pipelineId == NullObjectId);
+            }
+
+            if (replay)
+            {
+                pCmdBuffer->CmdBindPipeline(params);
+            }
+            break;
+        }
+        case Func::CmdBindMsaaState:
+        case Func::CmdBindColorBlendState:
+        case Func::CmdBindDepthStencilState:
+        {
+            uint32 stateId = NullObjectId;
+            replay = reader.Read(&stateId);
+
+            const ObjectVector& states = (header.func == Func::CmdBindMsaaState)       ? m_msaaStates       :
+                                         (header.func == Func::CmdBindColorBlendState) ? m_colorBlendStates :
+                                                                                         m_depthStencilStates;
+            const IDestroyable*const pState = LookupObject(states, stateId);
+
+            replay = replay && ((pState != nullptr) || (stateId == NullObjectId));
+
+            if (replay && (header.func == Func::CmdBindMsaaState))
+            {
+                pCmdBuffer->CmdBindMsaaState(static_cast<const IMsaaState*>(pState));
+            }
+            else if (replay && (header.func == Func::CmdBindColorBlendState))
+            {
+                pCmdBuffer->CmdBindColorBlendState(static_cast<const IColorBlendState*>(pState));
+            }
+            else if (replay)
+            {
+                pCmdBuffer->CmdBindDepthStencilState(static_cast<const IDepthStencilState*>(pState));
+            }
+            break;
+        }
+        case Func::CmdSetUserData:
+        {
+            PipelineBindPoint bindPoint  = PipelineBindPoint::Compute;
+            uint32            firstEntry = 0;
+            uint32            entryCount = 0;
+
+            replay = reader.Read(&bindPoint) && reader.Read(&firstEntry) && reader.Read(&entryCount) &&
+                     (entryCount <= (header.size / sizeof(uint32)));
+
+            Util::AutoBuffer<uint32, 64, IPlatform> values(replay ? entryCount : 0, m_pPlatform);
+
+            replay = replay                              &&
+                     (values.Capacity() >= entryCount)   &&
+                     reader.Read(&values[0], entryCount * sizeof(uint32));
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetUserData(bindPoint, firstEntry, entryCount, &values[0]);
+            }
+            break;
+        }
+        case Func::CmdSetVertexBuffers:
+        {
+            BufferViewInfo buffers[MaxVertexBuffers];
+            uint32         firstBuffer = 0;
+            uint32         bufferCount = 0;
+
+            replay = reader.Read(&firstBuffer)                      &&
+                     reader.Read(&bufferCount)                      &&
+                     ((firstBuffer + bufferCount) <= MaxVertexBuffers) &&
+                     reader.Read(&buffers[0], bufferCount * sizeof(BufferViewInfo));
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetVertexBuffers(firstBuffer, bufferCount, &buffers[0]);
+            }
+            break;
+        }
+        case Func::CmdBindIndexData:
+        {
+            gpusize   gpuAddr    = 0;
+            uint32    indexCount = 0;
+            IndexType indexType  = IndexType::Idx32;
+
+            replay = reader.Read(&gpuAddr) && reader.Read(&indexCount) && reader.Read(&indexType);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdBindIndexData(gpuAddr, indexCount, indexType);
+            }
+            break;
+        }
+        case Func::CmdSetBlendConst:
+        {
+            BlendConstParams params = {};
+            replay = reader.Read(&params);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetBlendConst(params);
+            }
+            break;
+        }
+        case Func::CmdSetInputAssemblyState:
+        {
+            InputAssemblyStateParams params = {};
+            replay = reader.Read(&params);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetInputAssemblyState(params);
+            }
+            break;
+        }
+        case Func::CmdSetTriangleRasterState:
+        {
+            TriangleRasterStateParams params = {};
+            replay = reader.Read(&params);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetTriangleRasterState(params);
+            }
+            break;
+        }
+        case Func::CmdSetPointLineRasterState:
+        {
+            PointLineRasterStateParams params = {};
+            replay = reader.Read(&params);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetPointLineRasterState(params);
+            }
+            break;
+        }
+        case Func::CmdSetDepthBiasState:
+        {
+            DepthBiasParams params = {};
+            replay = reader.Read(&params);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetDepthBiasState(params);
+            }
+            break;
+        }
+        case Func::CmdSetDepthBounds:
+        {
+            DepthBoundsParams params = {};
+            replay = reader.Read(&params);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetDepthBounds(params);
+            }
+            break;
+        }
+        case Func::CmdSetStencilRefMasks:
+        {
+            StencilRefMaskParams params = {};
+            replay = reader.Read(&params);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetStencilRefMasks(params);
+            }
+            break;
+        }
+        case Func::CmdSetViewports:
+        {
+            ViewportParams params = {};
+            replay = reader.Read(&params);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetViewports(params);
+            }
+            break;
+        }
+        case Func::CmdSetScissorRects:
+        {
+            ScissorRectParams params = {};
+            replay = reader.Read(&params);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetScissorRects(params);
+            }
+            break;
+        }
+        case Func::CmdSetGlobalScissor:
+        {
+            GlobalScissorParams params = {};
+            replay = reader.Read(&params);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdSetGlobalScissor(params);
+            }
+            break;
+        }
+        case Func::CmdBarrier:
+        {
+            BarrierInfo barrier = {};
+            replay = reader.Read(&barrier)                                                    &&
+                     (barrier.pipePointWaitCount <= (header.size / sizeof(HwPipePoint)))      &&
+                     (barrier.transitionCount    <= (header.size / sizeof(BarrierTransition)));
+
+            const uint32 pipePointCount  = replay ? barrier.pipePointWaitCount : 0;
+            const uint32 transitionCount = replay ? barrier.transitionCount    : 0;
+
+            Util::AutoBuffer<HwPipePoint, 8, IPlatform>       pipePoints(pipePointCount, m_pPlatform);
+            Util::AutoBuffer<BarrierTransition, 8, IPlatform> transitions(transitionCount, m_pPlatform);
+
+            replay = replay                                                  &&
+                     (pipePoints.Capacity()  >= barrier.pipePointWaitCount)  &&
+                     (transitions.Capacity() >= barrier.transitionCount)     &&
+                     reader.Read(&pipePoints[0], barrier.pipePointWaitCount * sizeof(HwPipePoint)) &&
+                     reader.Read(&transitions[0], barrier.transitionCount * sizeof(BarrierTransition));
+
+            if (replay)
+            {
+                barrier.pPipePoints                 = &pipePoints[0];
+                barrier.pTransitions                = &transitions[0];
+                barrier.gpuEventWaitCount           = 0;
+                barrier.ppGpuEvents                 = nullptr;
+                barrier.rangeCheckedTargetWaitCount = 0;
+                barrier.ppTargets                   = nullptr;
+
+                pCmdBuffer->CmdBarrier(barrier);
+            }
+            break;
+        }
+        case Func::CmdDraw:
+        {
+            uint32 args[4] = {};
+            replay = reader.Read(&args);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdDraw(args[0], args[1], args[2], args[3]);
+            }
+            break;
+        }
+        case Func::CmdDrawIndexed:
+        {
+            uint32 args[5] = {};
+            replay = reader.Read(&args);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdDrawIndexed(args[0], args[1], static_cast<int32>(args[2]), args[3], args[4]);
+            }
+            break;
+        }
+        case Func::CmdDispatch:
+        {
+            uint32 args[3] = {};
+            replay = reader.Read(&args);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdDispatch(args[0], args[1], args[2]);
+            }
+            break;
+        }
+        case Func::CmdDispatchOffset:
+        {
+            uint32 args[6] = {};
+            replay = reader.Read(&args);
+
+            if (replay)
+            {
+                pCmdBuffer->CmdDispatchOffset(args[0], args[1], args[2], args[3], args[4], args[5]);
+            }
+            break;
+        }
+        default:
+            PAL_NEVER_CALLED();
+            replay = false;
+            break;
+        }
+    }
+
+    if (replay)
+    {
+        const int64  ticks   = Util::GetPerfCpuTime() - startTicks;
+        const uint32 funcIdx = static_cast<uint32>(header.func);
+
+        pStats->callCount[funcIdx]++;
+        pStats->callTicks[funcIdx] += ticks;
+        pStats->totalTicks         += ticks;
+    }
+
+    if (pState != nullptr)
+    {
+        // A skipped call leaves the command buffer in an unknown state until it is begun again.
+        pState->valid = replay && (header.func != Func::CmdBufferEnd) && (header.func != Func::CmdBufferReset);
+    }
+
+    return replay;
+}
+
+// =====================================================================================================================
+// Records an object pointer at the given capture ID, growing the table as needed.
+Result CmdBufferReplayer::StoreObject(
+    ObjectVector* pObjects,
+    uint32        objectId,
+    IDestroyable* pObject)
+{
+    Result result = (objectId < MaxObjectId) ? Result::Success : Result::ErrorOutOfMemory;
+
+    while ((result == Result::Success) && (pObjects->NumElements() <= objectId))
+    {
+        result = pObjects->PushBack(nullptr);
+    }
+
+    if (result == Result::Success)
+    {
+        pObjects->At(objectId) = pObject;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+IDestroyable* CmdBufferReplayer::LookupObject(
+    const ObjectVector& objects,
+    uint32              objectId)
+{
+    return (objectId < objects.NumElements()) ? objects.At(objectId) : nullptr;
+}
+
+// =====================================================================================================================
+// Destroys every recreated object, command buffers first.
+void CmdBufferReplayer::DestroyObjects()
+{
+    for (uint32 idx = 0; idx < m_cmdBuffers.NumElements(); ++idx)
+    {
+        ICmdBuffer* pCmdBuffer = m_cmdBuffers.At(idx).pCmdBuffer;
+
+        if (pCmdBuffer != nullptr)
+        {
+            pCmdBuffer->Destroy();
+            PAL_SAFE_FREE(pCmdBuffer, m_pPlatform);
+        }
+    }
+
+    m_cmdBuffers.Clear();
+
+    ObjectVector*const pTables[] =
+    {
+        &m_cmdAllocators,
+        &m_pipelines,
+        &m_msaaStates,
+        &m_colorBlendStates,
+        &m_depthStencilStates,
+    };
+
+    for (uint32 table = 0; table < sizeof(pTables) / sizeof(pTables[0]); ++table)
+    {
+        for (uint32 idx = 0; idx < pTables[table]->NumElements(); ++idx)
+        {
+            IDestroyable* pObject = pTables[table]->At(idx);
+
+            if (pObject != nullptr)
+            {
+                pObject->Destroy();
+                PAL_SAFE_FREE(pObject, m_pPlatform);
+            }
+        }
+
+        pTables[table]->Clear();
+    }
+}
+
+} // GpuUtil
@@ -27,11 +27,15 @@
 #include "palMutex.h"
 #include "palAssert.h"
 #include "palPlatformKey.h"
-#include "palHashMapImpl.h"
+#include "palIntrusiveListImpl.h"
+#include "palOpenHashMapImpl.h"
+#include "palOpenHashSetImpl.h"
 #include "palAutoBuffer.h"
 #include "palVectorImpl.h"
 #include "core/platform.h"
 
+#include "lz4.h"
+
 namespace Util
 {
 
@@ -41,16 +45,29 @@ FileArchiveCacheLayer::FileArchiveCacheLayer(
     const AllocCallbacks& callbacks,
     IArchiveFile*         pArchiveFile,
     IHashContext*         pBaseContext,
-    void*                 pTempContextMem)
+    bool                  useWriteBehind,
+    size_t                maxWriteBehindBytes,
+    bool                  useCompression)
     :
-    CacheLayerBase     { callbacks },
-    m_pArchivefile     { pArchiveFile },
-    m_pBaseContext     { pBaseContext },
-    m_pTempContextMem  { pTempContextMem },
-    m_archiveFileMutex {},
-    m_hashContextMutex {},
-    m_entryMapLock     {},
-    m_entries          { HashTableBucketCount, Allocator() }
+    CacheLayerBase        { callbacks },
+    m_pArchivefile        { pArchiveFile },
+    m_pBaseContext        { pBaseContext },
+    m_useCompression      { useCompression },
+    m_archiveFileMutex    {},
+    m_entryMapLock        {},
+    m_entries             { HashTableInitEntries, Allocator() },
+    m_refreshedEntryCount { 0 },
+    m_useWriteBehind      { useWriteBehind },
+    m_maxWriteBehindBytes { (maxWriteBehindBytes != 0) ? maxWriteBehindBytes : DefaultWriteBehindBytes },
+    m_writeThread         {},
+    m_writeQueueMutex     {},
+    m_writeQueued         {},
+    m_writeRetired        {},
+    m_pendingList         {},
+    m_pendingKeys         { MaxWriteBatchEntries, Allocator() },
+    m_pendingBytes        { 0 },
+    m_exitWriteThread     { false },
+    m_writeBehindResult   { Result::Success }
 {
     PAL_ASSERT(m_pArchivefile != nullptr);
     PAL_ASSERT(m_pBaseContext != nullptr);
@@ -60,6 +77,21 @@ FileArchiveCacheLayer::FileArchiveCacheLayer(
 // =====================================================================================================================
 FileArchiveCacheLayer::~FileArchiveCacheLayer()
 {
+    // The write-behind thread drains the queue before it exits, so no queued store is lost.
+    if (m_writeThread.IsCreated())
+    {
+        {
+            MutexAuto writeQueueLock { &m_writeQueueMutex };
+
+            m_exitWriteThread = true;
+            m_writeQueued.WakeAll();
+        }
+
+        m_writeThread.Join();
+    }
+
+    PAL_ASSERT(m_pendingList.IsEmpty());
+
     m_pBaseContext->Destroy();
 }
 
@@ -76,17 +108,37 @@ Result FileArchiveCacheLayer::Init()
 
     if (result == Result::Success)
     {
-        result = m_hashContextMutex.Init();
+        result = m_entryMapLock.Init();
     }
 
     if (result == Result::Success)
     {
-        result = m_entryMapLock.Init();
+        result = m_entries.Init();
     }
 
-    if (result == Result::Success)
+    if ((result == Result::Success) && m_useWriteBehind)
     {
-        result = m_entries.Init();
+        result = m_writeQueueMutex.Init();
+
+        if (result == Result::Success)
+        {
+            result = m_writeQueued.Init();
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_writeRetired.Init();
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_pendingKeys.Init();
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_writeThread.Begin(&WriteBehindThreadFunc, this);
+        }
     }
 
     // Collapse all results other than success
@@ -118,14 +170,38 @@ Result FileArchiveCacheLayer::QueryInternal(
     else
     {
         EntryKey     key;
-        const Entry* pEntry;
+        Entry        entry  = {};
+        const Entry* pEntry = nullptr;
 
         ConvertToEntryKey(pHashId, &key);
 
+        // Entries may move when the map grows, so copy the entry out while the lock is still held.
         {
             RWLockAuto<RWLock::ReadOnly> entryMapLock { &m_entryMapLock };
 
             pEntry = m_entries.FindKey(key);
+
+            if (pEntry != nullptr)
+            {
+                entry = *pEntry;
+            }
+        }
+
+        // A store of this key may still be waiting for the write-behind thread. Wait for it to land rather than
+        // reporting a miss which would make the client recreate the data. The write may also have been retired since
+        // the lookup above, so search again even if nothing is pending anymore.
+        if ((pEntry == nullptr) && m_useWriteBehind)
+        {
+            WaitForPendingWrite(key);
+
+            RWLockAuto<RWLock::ReadOnly> entryMapLock { &m_entryMapLock };
+
+            pEntry = m_entries.FindKey(key);
+
+            if (pEntry != nullptr)
+            {
+                entry = *pEntry;
+            }
         }
 
         if (pEntry == nullptr)
@@ -133,15 +209,17 @@ Result FileArchiveCacheLayer::QueryInternal(
             MutexAuto                     archiveFileLock { &m_archiveFileMutex };
             RWLockAuto<RWLock::ReadWrite> entryMapLock { &m_entryMapLock };
 
-            const size_t oldEntryCount = m_entries.GetNumEntries();
-            Result       refreshResult = RefreshHeaders();
+            Result refreshResult = RefreshHeaders();
 
             PAL_ALERT(IsErrorResult(refreshResult));
 
-            // If the refresh picked up any new header, search again
-            if (oldEntryCount != m_entries.GetNumEntries())
+            // Search again: the refresh may have picked up new headers, and another thread may have added the entry
+            // while we waited for the locks.
+            pEntry = m_entries.FindKey(key);
+
+            if (pEntry != nullptr)
             {
-                pEntry = m_entries.FindKey(key);
+                entry = *pEntry;
             }
         }
 
@@ -149,8 +227,8 @@ Result FileArchiveCacheLayer::QueryInternal(
         {
             pQuery->pLayer          = this;
             pQuery->hashId          = *pHashId;
-            pQuery->dataSize        = pEntry->dataSize;
-            pQuery->context.entryId = pEntry->ordinalId;
+            pQuery->dataSize        = entry.dataSize;
+            pQuery->context.entryId = entry.ordinalId;
 
             result = Result::Success;
         }
@@ -186,6 +264,11 @@ Result FileArchiveCacheLayer::StoreInternal(
     {
         ConvertToEntryKey(pHashId, &key);
 
+        if (m_useWriteBehind)
+        {
+            result = QueueWrite(key, pData, dataSize);
+        }
+        else
         {
             RWLockAuto<RWLock::ReadOnly> entryMapLock { &m_entryMapLock };
 
@@ -199,8 +282,7 @@ Result FileArchiveCacheLayer::StoreInternal(
     if (result == Result::NotFound)
     {
         ArchiveEntryHeader header         = {};
-        const size_t       writeDataSize  = dataSize;
-        void* const        pMem           = PAL_MALLOC(writeDataSize, Allocator(), AllocInternalTemp);
+        void* const        pMem           = PAL_MALLOC(dataSize, Allocator(), AllocInternalTemp);
 
         PAL_ALERT(pMem == nullptr);
 
@@ -213,27 +295,36 @@ Result FileArchiveCacheLayer::StoreInternal(
             result = Result::ErrorOutOfMemory;
         }
 
-        // Write the scratch buffer to the file
+        // Compress into the scratch buffer before taking the archive lock so that other stores and loads don't wait
+        // on the compression.
         if (result == Result::Success)
         {
-            MutexAuto archiveFileLock { &m_archiveFileMutex };
+            size_t writeDataSize = 0;
 
-            void* const pDataMem = pMem;
-            header.dataSize      = static_cast<uint32>(writeDataSize);
-            header.metaValue     = static_cast<uint32>(dataSize);
+            header.compressionType  = EncodeEntryData(pData, dataSize, pMem, &writeDataSize);
+            header.dataSize         = static_cast<uint32>(writeDataSize);
+            header.decompressedSize = static_cast<uint32>(dataSize);
+            header.metaValue        = static_cast<uint32>(dataSize);
 
-            memcpy(pDataMem, pData, dataSize);
             memcpy(header.entryKey, key.value, sizeof(EntryKey));
-
-            result = m_pArchivefile->Write(&header, pMem);
         }
 
-        // Only insert this entry into our lookup table if everything succeeded
+        // Write the scratch buffer to the file
         if (result == Result::Success)
         {
-            RWLockAuto<RWLock::ReadWrite> entryMapLock { &m_entryMapLock };
+            MutexAuto archiveFileLock { &m_archiveFileMutex };
+
+            result = m_pArchivefile->Write(&header, pMem);
+
+            // Only insert this entry into our lookup table if everything succeeded
+            if (result == Result::Success)
+            {
+                RWLockAuto<RWLock::ReadWrite> entryMapLock { &m_entryMapLock };
 
-            result = AddHeaderToTable(header);
+                result = AddHeaderToTable(header);
+
+                AdvanceRefreshedEntryCount(&header, 1);
+            }
         }
 
         if (pMem != nullptr)
@@ -289,6 +380,7 @@ Result FileArchiveCacheLayer::LoadInternal(
 #endif
 
     ArchiveEntryHeader header;
+    const void*        pView = nullptr;
 
     if (result == Result::Success)
     {
@@ -303,11 +395,29 @@ Result FileArchiveCacheLayer::LoadInternal(
         PAL_ALERT(header.ordinalId != pQuery->context.entryId);
         PAL_ALERT(header.metaValue > pQuery->dataSize);
 
+        // Memory mapped archives can hand out the payload directly, which saves the staging copy below.
+        {
+            MutexAuto archiveFileLock { &m_archiveFileMutex };
+
+            result = m_pArchivefile->GetEntryDataView(&header, &pView);
+        }
+
+        if (result == Result::Success)
+        {
+            result = DecodeEntryData(header, pView, pBuffer);
+        }
+        else if (result == Result::Unsupported)
+        {
+            result = Result::Success;
+        }
+    }
+
+    if ((result == Result::Success) &&
+        (pView == nullptr))
+    {
         const size_t readSize      = header.dataSize;
-        const size_t dataSize      = header.metaValue;
 
         void* const pReadMem = PAL_MALLOC(readSize, Allocator(), AllocInternalTemp);
-        void* const pDataMem = pReadMem;
 
         if (pReadMem == nullptr)
         {
@@ -331,7 +441,7 @@ Result FileArchiveCacheLayer::LoadInternal(
 
         if (result == Result::Success)
         {
-            memcpy(pBuffer, pDataMem, dataSize);
+            result = DecodeEntryData(header, pReadMem, pBuffer);
         }
 
         if (pReadMem != nullptr)
@@ -362,6 +472,8 @@ static size_t GetBaseContextSizeFromCreateInfo(
         Result          result = GetHashContextInfo(HashAlgorithm::Sha1, &info);
 
         PAL_ALERT(IsErrorResult(result));
+
+        contextSize = info.contextObjectSize;
     }
 
     return contextSize;
@@ -372,7 +484,7 @@ static size_t GetBaseContextSizeFromCreateInfo(
 size_t GetArchiveFileCacheLayerSize(
     const ArchiveFileCacheCreateInfo* pCreateInfo)
 {
-    return sizeof(FileArchiveCacheLayer) + (GetBaseContextSizeFromCreateInfo(pCreateInfo) * 2);
+    return sizeof(FileArchiveCacheLayer) + GetBaseContextSizeFromCreateInfo(pCreateInfo);
 }
 
 // =====================================================================================================================
@@ -389,8 +501,6 @@ Result CreateArchiveFileCacheLayer(
     Result                 result          = Result::Success;
     FileArchiveCacheLayer* pLayer          = nullptr;
     IHashContext*          pBaseContext    = nullptr;
-    void*                  pTempContextMem = nullptr;
-    const size_t           hashContextSize = GetBaseContextSizeFromCreateInfo(pCreateInfo);
     ArchiveFileOpenInfo    openInfo        = {};
 
     if ((pCreateInfo == nullptr) ||
@@ -403,7 +513,6 @@ Result CreateArchiveFileCacheLayer(
     if (result == Result::Success)
     {
         void* pBaseContextMem = VoidPtrInc(pPlacementAddr, sizeof(FileArchiveCacheLayer));
-        pTempContextMem       = VoidPtrInc(pBaseContextMem, hashContextSize);
 
         if (pCreateInfo->pPlatformKey != nullptr)
         {
@@ -428,7 +537,15 @@ Result CreateArchiveFileCacheLayer(
             (pCreateInfo->baseInfo.pCallbacks == nullptr) ? callbacks : *pCreateInfo->baseInfo.pCallbacks,
             pCreateInfo->pFile,
             pBaseContext,
-            pTempContextMem);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+            pCreateInfo->useWriteBehind,
+            pCreateInfo->maxWriteBehindBytes,
+            (pCreateInfo->disableCompression == false));
+#else
+            false,
+            0,
+            true);
+#endif
 
         result = pLayer->Init();
 
@@ -452,6 +569,23 @@ Result CreateArchiveFileCacheLayer(
     return result;
 }
 
+// =====================================================================================================================
+// Wait for all stores queued on an archive file cache layer to be written
+Result FlushArchiveFileCacheLayer(
+    ICacheLayer* pCacheLayer)
+{
+    PAL_ASSERT(pCacheLayer != nullptr);
+
+    Result result = Result::ErrorInvalidPointer;
+
+    if (pCacheLayer != nullptr)
+    {
+        result = static_cast<FileArchiveCacheLayer*>(pCacheLayer)->Flush();
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Attempt to add an entry header to our table
 Result FileArchiveCacheLayer::AddHeaderToTable(
@@ -464,43 +598,383 @@ Result FileArchiveCacheLayer::AddHeaderToTable(
     return m_entries.Insert(key, {header.ordinalId, header.metaValue});
 }
 
+// =====================================================================================================================
+// Skip entries this layer just wrote and added to our table when the next refresh reads headers back from the archive
+// file. Only entries which directly follow the refreshed range can be skipped; anything written by another process in
+// between is still picked up by RefreshHeaders. The caller must hold both the archive file and entry map locks.
+void FileArchiveCacheLayer::AdvanceRefreshedEntryCount(
+    const ArchiveEntryHeader* pHeaders,
+    size_t                    count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (pHeaders[i].ordinalId == m_refreshedEntryCount)
+        {
+            m_refreshedEntryCount++;
+        }
+    }
+}
+
 // =====================================================================================================================
 // Reload entry headers from the archive file
 Result FileArchiveCacheLayer::RefreshHeaders()
 {
     Result       result        = Result::Success;
     const size_t newEntryCount = m_pArchivefile->GetEntryCount();
-    size_t       curEntryCount = m_entries.GetNumEntries();
+    size_t       curEntryCount = m_refreshedEntryCount;
+
+    // Headers are copied out of the archive's in-memory table in batches rather than one call per entry
+    ArchiveEntryHeader headers[MaxWriteBatchEntries];
 
     while (curEntryCount < newEntryCount)
     {
-        ArchiveEntryHeader header;
-        result = m_pArchivefile->GetEntryByIndex(curEntryCount, &header);
+        size_t filled = 0;
+
+        result = m_pArchivefile->FillEntryHeaderTable(headers,
+                                                      curEntryCount,
+                                                      Min(newEntryCount - curEntryCount, MaxWriteBatchEntries),
+                                                      &filled);
 
-        if (result != Result::Success)
+        if ((result != Result::Success) || (filled == 0))
         {
             PAL_ALERT(IsErrorResult(result));
             break;
         }
 
-        PAL_ALERT(header.ordinalId != curEntryCount);
+        for (size_t i = 0; i < filled; ++i)
+        {
+            PAL_ALERT(headers[i].ordinalId != curEntryCount);
 
-        result = AddHeaderToTable(header);
+            result = AddHeaderToTable(headers[i]);
+
+            if (IsErrorResult(result))
+            {
+                PAL_ALERT_ALWAYS();
+                break;
+            }
+
+            curEntryCount += 1;
+        }
+
+        m_refreshedEntryCount = curEntryCount;
 
         if (IsErrorResult(result))
         {
-            PAL_ALERT_ALWAYS();
             break;
         }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Prepare data for storage in the archive. pOut must have room for dataSize bytes. Data is LZ4 compressed when that
+// makes it smaller, otherwise it is copied as-is. Returns the ArchiveCompression* type of the output.
+uint32 FileArchiveCacheLayer::EncodeEntryData(
+    const void* pData,
+    size_t      dataSize,
+    void*       pOut,
+    size_t*     pOutSize
+    ) const
+{
+    PAL_ASSERT(pOutSize != nullptr);
+
+    uint32 compressionType = ArchiveCompressionNone;
+    int    compressedSize  = 0;
+
+    // Limiting the output to one byte less than the input makes LZ4 give up as soon as compression stops paying off.
+    if (m_useCompression &&
+        (dataSize > MinCompressSize) &&
+        (dataSize <= static_cast<size_t>(LZ4_MAX_INPUT_SIZE)))
+    {
+        compressedSize = LZ4_compress_default(static_cast<const char*>(pData),
+                                              static_cast<char*>(pOut),
+                                              static_cast<int>(dataSize),
+                                              static_cast<int>(dataSize - 1));
+    }
+
+    if (compressedSize > 0)
+    {
+        compressionType = ArchiveCompressionLz4;
+        *pOutSize       = static_cast<size_t>(compressedSize);
+    }
+    else
+    {
+        memcpy(pOut, pData, dataSize);
+        *pOutSize = dataSize;
+    }
+
+    return compressionType;
+}
+
+// =====================================================================================================================
+// Decode data read from the archive into the client's buffer, which must have room for header.decompressedSize bytes
+Result FileArchiveCacheLayer::DecodeEntryData(
+    const ArchiveEntryHeader& header,
+    const void*               pStoredData,
+    void*                     pBuffer)
+{
+    Result result = Result::Success;
+
+    if (header.compressionType == ArchiveCompressionLz4)
+    {
+        const int decompressedSize = LZ4_decompress_safe(static_cast<const char*>(pStoredData),
+                                                         static_cast<char*>(pBuffer),
+                                                         static_cast<int>(header.dataSize),
+                                                         static_cast<int>(header.decompressedSize));
+
+        if (decompressedSize != static_cast<int>(header.decompressedSize))
+        {
+            PAL_ALERT_ALWAYS();
+            result = Result::ErrorUnknown;
+        }
+    }
+    else if ((header.compressionType == ArchiveCompressionNone) &&
+             (header.dataSize == header.decompressedSize))
+    {
+        memcpy(pBuffer, pStoredData, header.dataSize);
+    }
+    else
+    {
+        PAL_ALERT_ALWAYS();
+        result = Result::ErrorUnknown;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Hand a store over to the write-behind thread. Returns AlreadyExists if the key is in the archive or already queued.
+Result FileArchiveCacheLayer::QueueWrite(
+    const EntryKey& key,
+    const void*     pData,
+    size_t          dataSize)
+{
+    PAL_ASSERT(m_useWriteBehind);
+
+    Result        result = Result::Success;
+    void* const   pMem   = PAL_MALLOC(sizeof(PendingWrite) + dataSize, Allocator(), AllocInternal);
+    PendingWrite* pWrite = nullptr;
+
+    // Compress on the storing thread so the work is spread over all callers and less data is held in the queue.
+    if (pMem != nullptr)
+    {
+        pWrite = PAL_PLACEMENT_NEW(pMem) PendingWrite(key, dataSize);
+        pWrite->compressionType = EncodeEntryData(pData, dataSize, VoidPtrInc(pMem, sizeof(PendingWrite)),
+                                                  &pWrite->storedSize);
+    }
+    else
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    if (result == Result::Success)
+    {
+        MutexAuto writeQueueLock { &m_writeQueueMutex };
+
+        // The thread adds entries to m_entries before it drops them from m_pendingKeys, so checking both while the
+        // queue lock is held can't miss a store that is just being retired.
+        if (m_pendingKeys.Contains(key))
+        {
+            result = Result::AlreadyExists;
+        }
+        else
+        {
+            RWLockAuto<RWLock::ReadOnly> entryMapLock { &m_entryMapLock };
+
+            if (m_entries.FindKey(key) != nullptr)
+            {
+                result = Result::AlreadyExists;
+            }
+        }
 
-        curEntryCount += 1;
+        // Apply back-pressure once the in-flight budget is used up. A single store larger than the budget is still
+        // allowed through once everything else has been written.
+        while ((result == Result::Success) &&
+               (m_pendingBytes != 0) &&
+               ((m_pendingBytes + pWrite->storedSize) > m_maxWriteBehindBytes))
+        {
+            m_writeRetired.Wait(&m_writeQueueMutex, UINT32_MAX);
+
+            // Another thread may have queued the same key while we slept.
+            if (m_pendingKeys.Contains(key))
+            {
+                result = Result::AlreadyExists;
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_pendingKeys.Insert(key);
+        }
+
+        if (result == Result::Success)
+        {
+            m_pendingBytes += pWrite->storedSize;
+            m_pendingList.PushBack(&pWrite->node);
+            m_writeQueued.WakeOne();
+
+            pWrite = nullptr;
+        }
+    }
+
+    if (pWrite != nullptr)
+    {
+        pWrite->~PendingWrite();
+        PAL_FREE(pMem, Allocator());
     }
 
     return result;
 }
 
 // =====================================================================================================================
-// Convert a 128-bit hash to a SHA1 entry id
+// Block until a queued store of the given key, if any, is visible in m_entries.
+void FileArchiveCacheLayer::WaitForPendingWrite(
+    const EntryKey& key)
+{
+    MutexAuto writeQueueLock { &m_writeQueueMutex };
+
+    while (m_pendingKeys.Contains(key))
+    {
+        m_writeRetired.Wait(&m_writeQueueMutex, UINT32_MAX);
+    }
+}
+
+// =====================================================================================================================
+// Wait until every store queued so far has been written to the archive file
+Result FileArchiveCacheLayer::Flush()
+{
+    Result result = Result::Success;
+
+    if (m_useWriteBehind)
+    {
+        MutexAuto writeQueueLock { &m_writeQueueMutex };
+
+        while (m_pendingKeys.GetNumEntries() != 0)
+        {
+            m_writeRetired.Wait(&m_writeQueueMutex, UINT32_MAX);
+        }
+
+        result              = m_writeBehindResult;
+        m_writeBehindResult = Result::Success;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Write a batch of queued stores to the archive file with a single footer update and publish them in our table
+void FileArchiveCacheLayer::WriteBatch(
+    PendingWrite** ppBatch,
+    size_t         count)
+{
+    ArchiveEntryHeader headers[MaxWriteBatchEntries] = {};
+    const void*        pData[MaxWriteBatchEntries]   = {};
+
+    PAL_ASSERT(count <= MaxWriteBatchEntries);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        headers[i].compressionType  = ppBatch[i]->compressionType;
+        headers[i].dataSize         = static_cast<uint32>(ppBatch[i]->storedSize);
+        headers[i].decompressedSize = static_cast<uint32>(ppBatch[i]->dataSize);
+        headers[i].metaValue        = static_cast<uint32>(ppBatch[i]->dataSize);
+        memcpy(headers[i].entryKey, ppBatch[i]->key.value, sizeof(EntryKey));
+
+        pData[i] = ppBatch[i]->Data();
+    }
+
+    Result result = Result::Success;
+
+    {
+        MutexAuto archiveFileLock { &m_archiveFileMutex };
+
+        result = m_pArchivefile->WriteBatch(headers, pData, count);
+
+        if (result == Result::Success)
+        {
+            RWLockAuto<RWLock::ReadWrite> entryMapLock { &m_entryMapLock };
+
+            for (size_t i = 0; (i < count) && (result == Result::Success); ++i)
+            {
+                result = AddHeaderToTable(headers[i]);
+            }
+
+            AdvanceRefreshedEntryCount(headers, count);
+        }
+    }
+
+    PAL_ALERT(IsErrorResult(result));
+
+    MutexAuto writeQueueLock { &m_writeQueueMutex };
+
+    // Retire the batch even if it failed, a later store of the same data may succeed.
+    for (size_t i = 0; i < count; ++i)
+    {
+        m_pendingKeys.Erase(ppBatch[i]->key);
+        m_pendingBytes -= ppBatch[i]->storedSize;
+
+        ppBatch[i]->~PendingWrite();
+        PAL_FREE(ppBatch[i], Allocator());
+    }
+
+    if ((result != Result::Success) &&
+        (m_writeBehindResult == Result::Success))
+    {
+        m_writeBehindResult = result;
+    }
+
+    m_writeRetired.WakeAll();
+}
+
+// =====================================================================================================================
+// Main loop of the write-behind thread: write queued stores in batches until asked to exit with an empty queue
+void FileArchiveCacheLayer::WriteBehindLoop()
+{
+    PendingWrite* pBatch[MaxWriteBatchEntries];
+
+    bool exit = false;
+
+    while (exit == false)
+    {
+        size_t count = 0;
+
+        {
+            MutexAuto writeQueueLock { &m_writeQueueMutex };
+
+            while (m_pendingList.IsEmpty() && (m_exitWriteThread == false))
+            {
+                m_writeQueued.Wait(&m_writeQueueMutex, UINT32_MAX);
+            }
+
+            while ((m_pendingList.IsEmpty() == false) && (count < MaxWriteBatchEntries))
+            {
+                PendingWrite* const pWrite = m_pendingList.Front();
+
+                m_pendingList.Erase(&pWrite->node);
+                pBatch[count++] = pWrite;
+            }
+
+            exit = m_pendingList.IsEmpty() && m_exitWriteThread;
+        }
+
+        if (count > 0)
+        {
+            WriteBatch(pBatch, count);
+        }
+    }
+}
+
+// =====================================================================================================================
+void FileArchiveCacheLayer::WriteBehindThreadFunc(
+    void* pParam)
+{
+    static_cast<FileArchiveCacheLayer*>(pParam)->WriteBehindLoop();
+}
+
+// =====================================================================================================================
+// Convert a 128-bit hash to a SHA1 entry id. Each call duplicates the base context into its own stack buffer so that
+// concurrent queries, stores and loads never contend on a shared context.
 void FileArchiveCacheLayer::ConvertToEntryKey(
     const Hash128* pHashId,
     EntryKey*      pKey)
@@ -508,19 +982,33 @@ void FileArchiveCacheLayer::ConvertToEntryKey(
     PAL_ASSERT(pHashId != nullptr);
     PAL_ASSERT(pKey != nullptr);
 
-    MutexAuto hashContextLock { &m_hashContextMutex };
+    const size_t contextSize = m_pBaseContext->GetDuplicateObjectSize();
+    AutoBuffer<uint64, HashContextQwords, ForwardAllocator> contextMem(
+        RoundUpQuotient(contextSize, sizeof(uint64)), Allocator());
 
     IHashContext* pContext = nullptr;
-    Result result          = m_pBaseContext->Duplicate(m_pTempContextMem, &pContext);
-    PAL_ALERT(IsErrorResult(result));
+    Result        result   = Result::ErrorOutOfMemory;
 
-    result = pContext->AddData(pHashId, sizeof(Hash128));
-    PAL_ALERT(IsErrorResult(result));
+    if ((contextMem.Capacity() * sizeof(uint64)) >= contextSize)
+    {
+        result = m_pBaseContext->Duplicate(contextMem.Data(), &pContext);
+    }
 
-    result = pContext->Finish(pKey->value);
-    PAL_ALERT(IsErrorResult(result));
+    if (result == Result::Success)
+    {
+        result = pContext->AddData(pHashId, sizeof(Hash128));
+        PAL_ALERT(IsErrorResult(result));
+
+        result = pContext->Finish(pKey->value);
+        PAL_ALERT(IsErrorResult(result));
 
-    pContext->Destroy();
+        pContext->Destroy();
+    }
+    else
+    {
+        PAL_ALERT_ALWAYS();
+        memset(pKey->value, 0, sizeof(pKey->value));
+    }
 }
 
 } //namespace Util
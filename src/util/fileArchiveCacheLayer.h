@@ -28,9 +28,13 @@
 
 #include "palArchiveFileFmt.h"
 #include "palArchiveFile.h"
+#include "palConditionVariable.h"
+#include "palIntrusiveList.h"
 #include "palLinearAllocator.h"
 #include "palHashProvider.h"
-#include "palHashMap.h"
+#include "palOpenHashMap.h"
+#include "palOpenHashSet.h"
+#include "palThread.h"
 #include "palVector.h"
 
 namespace Util
@@ -45,11 +49,16 @@ public:
         const AllocCallbacks& callbacks,
         IArchiveFile*         pArchiveFile,
         IHashContext*         pBaseContext,
-        void*                 pTemContextMem);
+        bool                  useWriteBehind,
+        size_t                maxWriteBehindBytes,
+        bool                  useCompression);
     virtual ~FileArchiveCacheLayer();
 
     virtual Result Init() override;
 
+    // Wait for the write-behind thread to write out every queued store
+    Result Flush();
+
 protected:
 
     virtual Result QueryInternal(
@@ -71,7 +80,11 @@ private:
 
     // Constants
     static constexpr size_t        MinExpectedHeaders   = 256;
-    static constexpr size_t        HashTableBucketCount = 2048;
+    static constexpr size_t        HashTableInitEntries = 2048;
+    static constexpr size_t        HashContextQwords    = 64;   // Stack space for a duplicated hash context
+    static constexpr size_t        DefaultWriteBehindBytes = 32 * 1024 * 1024;
+    static constexpr size_t        MaxWriteBatchEntries    = 64;
+    static constexpr size_t        MinCompressSize         = 64;    // Smaller entries are never worth compressing
 
     // Helper type for ArchiveEntryHeader::entryKey
     struct EntryKey
@@ -85,26 +98,72 @@ private:
         uint64 ordinalId;
         size_t dataSize;
     };
-    using EntryMap = HashMap<EntryKey, Entry, ForwardAllocator, JenkinsHashFunc>;
+    using EntryMap = OpenHashMap<EntryKey, Entry, ForwardAllocator, JenkinsHashFunc>;
+
+    // A store waiting to be written by the write-behind thread. The data immediately follows the structure.
+    struct PendingWrite
+    {
+        explicit PendingWrite(const EntryKey& entryKey, size_t size)
+            :
+            key(entryKey), dataSize(size), storedSize(0), compressionType(ArchiveCompressionNone), node(this) {}
+
+        const void* Data() const { return (this + 1); }
+
+        EntryKey                        key;
+        size_t                          dataSize;        // Size of the data as given to Store()
+        size_t                          storedSize;      // Size of the encoded data following this structure
+        uint32                          compressionType;
+        IntrusiveListNode<PendingWrite> node;
+    };
+    using PendingList = IntrusiveList<PendingWrite>;
+    using PendingSet  = OpenHashSet<EntryKey, ForwardAllocator, JenkinsHashFunc>;
 
     // Hashing Utility functions
     void ConvertToEntryKey(const Hash128* pHashId, EntryKey* pKey);
 
+    // Entry encoding
+    uint32        EncodeEntryData(const void* pData, size_t dataSize, void* pOut, size_t* pOutSize) const;
+    static Result DecodeEntryData(const ArchiveEntryHeader& header, const void* pStoredData, void* pBuffer);
+
     // Header refresh
     Result AddHeaderToTable(const ArchiveEntryHeader& header);
     Result RefreshHeaders();
+    void   AdvanceRefreshedEntryCount(const ArchiveEntryHeader* pHeaders, size_t count);
+
+    // Write-behind
+    Result QueueWrite(const EntryKey& key, const void* pData, size_t dataSize);
+    void   WaitForPendingWrite(const EntryKey& key);
+    void   WriteBatch(PendingWrite** ppBatch, size_t count);
+    void   WriteBehindLoop();
+
+    static void WriteBehindThreadFunc(void* pParam);
 
     // Invariants that must be passed in by ctor
     IArchiveFile* const  m_pArchivefile;
     IHashContext* const  m_pBaseContext;
-    void* const          m_pTempContextMem;
+    const bool           m_useCompression;
 
     Mutex                m_archiveFileMutex;
-    Mutex                m_hashContextMutex;
     RWLock               m_entryMapLock;
 
     // Data Members
     EntryMap m_entries;
+    size_t   m_refreshedEntryCount; // Archive entries already scanned by RefreshHeaders() or written by this layer.
+                                    // Duplicate keys in the archive make this differ from the number of entries in
+                                    // m_entries.
+
+    // Write-behind queue: MAY NOT BE INITIALIZED IF WE AREN'T USING WRITE-BEHIND
+    const bool           m_useWriteBehind;
+    const size_t         m_maxWriteBehindBytes;
+    Thread               m_writeThread;
+    Mutex                m_writeQueueMutex;
+    ConditionVariable    m_writeQueued;       // Signaled when a store is queued or the thread should exit
+    ConditionVariable    m_writeRetired;      // Signaled when the thread finishes writing a batch
+    PendingList          m_pendingList;       // Stores not yet picked up by the thread
+    PendingSet           m_pendingKeys;       // Keys of every store not yet visible in m_entries
+    size_t               m_pendingBytes;      // Data size of every store not yet visible in m_entries
+    bool                 m_exitWriteThread;
+    Result               m_writeBehindResult; // First write error since the last Flush()
 };
 
 } //namespace Util
@@ -29,6 +29,7 @@
 #include "palInlineFuncs.h"
 #include "palIntrusiveListImpl.h"
 #include "palMetroHash.h"
+#include "palOpenHashSetImpl.h"
 #include "palPlatformKey.h"
 #include "palSysUtil.h"
 #include "palVectorImpl.h"
@@ -39,6 +40,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -233,6 +235,57 @@ static Result CreateDir(
     return result;
 }
 
+// =====================================================================================================================
+// Write out an empty archive with the given header. The file must not exist yet.
+static Result WriteEmptyArchive(
+    const char*              pFileName,
+    const ArchiveFileHeader& header)
+{
+    PAL_ASSERT(pFileName != nullptr);
+
+    Result      result = Result::Success;
+    const int32 fd     = open(pFileName, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+
+    if (fd == InvalidFd)
+    {
+        result = Result::ErrorUnavailable;
+    }
+    // The lock will prevent the file from being opened by multiple instances simultaneously.
+    // It will be automatically released when we close the file handle.
+    else if (flock(fd, LOCK_EX | LOCK_NB) == 0)
+    {
+        struct
+        {
+            ArchiveFileHeader header;
+            ArchiveFileFooter footer;
+        } data;
+
+        data.header            = header;
+        data.header.firstBlock = static_cast<uint32>(VoidPtrDiff(&data.footer, &data));
+
+        memcpy(data.footer.footerMarker, MagicFooterMarker, sizeof(data.footer.footerMarker));
+        data.footer.entryCount         = 0;
+        data.footer.lastWriteTimestamp = GetCurrentFileTime();
+        memcpy(data.footer.archiveMarker, MagicArchiveMarker, sizeof(data.footer.archiveMarker));
+
+        result = WriteDirect(fd, 0, &data, sizeof(data));
+
+        close(fd);
+
+        if (result != Result::Success)
+        {
+            remove(pFileName);
+        }
+    }
+    else
+    {
+        close(fd);
+        result = Result::ErrorUnavailable;
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Initialize a newly created file
 static Result CreateFileInternal(
@@ -253,56 +306,23 @@ static Result CreateFileInternal(
     }
     if (result == Result::Success)
     {
-        int32 fd = open(pFileName, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+        ArchiveFileHeader header = {};
 
-        if (fd == InvalidFd)
-        {
-            result = Result::ErrorUnavailable;
-        }
-        // The lock will prevent the file from being opened by multiple instances simultaneously.
-        // It will be automatically released when we close the file handle.
-        else if (flock(fd, LOCK_EX | LOCK_NB) == 0)
-        {
-            struct
-            {
-                ArchiveFileHeader header;
-                ArchiveFileFooter footer;
-            } data;
-
-            memcpy(data.header.archiveMarker, MagicArchiveMarker, sizeof(data.header.archiveMarker));
-            data.header.majorVersion = CurrentMajorVersion;
-            data.header.minorVersion = CurrentMinorVersion;
-            data.header.firstBlock   = static_cast<uint32>(VoidPtrDiff(&data.footer, &data));
-            data.header.archiveType  = pOpenInfo->archiveType;
-
-            memset(data.header.platformKey, 0, sizeof(data.header.platformKey));
-            if (pOpenInfo->pPlatformKey)
-            {
-                memcpy(
-                    data.header.platformKey,
-                    pOpenInfo->pPlatformKey->GetKey(),
-                    Min(sizeof(data.header.platformKey), pOpenInfo->pPlatformKey->GetKeySize()));
-            }
-
-            memcpy(data.footer.footerMarker, MagicFooterMarker, sizeof(data.footer.footerMarker));
-            data.footer.entryCount         = 0;
-            data.footer.lastWriteTimestamp = GetCurrentFileTime();
-            memcpy(data.footer.archiveMarker, MagicArchiveMarker, sizeof(data.footer.archiveMarker));
+        memcpy(header.archiveMarker, MagicArchiveMarker, sizeof(header.archiveMarker));
+        header.majorVersion = CurrentMajorVersion;
+        header.minorVersion = CurrentMinorVersion;
+        header.archiveType  = pOpenInfo->archiveType;
 
-            result = WriteDirect(fd, 0, &data, sizeof(data));
-
-            close(fd);
-
-            if (result != Result::Success)
-            {
-                remove(pFileName);
-            }
-        }
-        else
+        memset(header.platformKey, 0, sizeof(header.platformKey));
+        if (pOpenInfo->pPlatformKey)
         {
-            close(fd);
-            result = Result::ErrorUnavailable;
+            memcpy(
+                header.platformKey,
+                pOpenInfo->pPlatformKey->GetKey(),
+                Min(sizeof(header.platformKey), pOpenInfo->pPlatformKey->GetKeySize()));
         }
+
+        result = WriteEmptyArchive(pFileName, header);
     }
 
     return result;
@@ -460,31 +480,73 @@ ArchiveFile::ArchiveFile(
     m_recentList        (),
     m_pages             (),
     m_pageCount         (0),
-    m_pageSize          (MinPageSize)
+    m_pageSize          (MinPageSize),
+    // Index sidecar
+    m_indexPath         (),
+    m_indexedEntryCount (0),
+    // Memory mapped reads
+    m_pMappedFile       (nullptr),
+    m_mappedSize        (0)
 {
 }
 
 // =====================================================================================================================
 ArchiveFile::~ArchiveFile()
 {
+    // Refresh the sidecar while we still hold the archive lock so that the next open is a single sequential read
+    if (m_haveWriteAccess &&
+        (m_indexPath[0] != '\0') &&
+        (m_entries.NumElements() != m_indexedEntryCount))
+    {
+        const Result indexResult = WriteIndex();
+        PAL_ALERT(IsErrorResult(indexResult));
+    }
+
+    if (m_pMappedFile != nullptr)
+    {
+        munmap(m_pMappedFile, m_mappedSize);
+    }
+
     close(m_hFile);
 }
 
 // =====================================================================================================================
 // Due to possible failure on object creation, Init() is required to be called before the object is usable
 Result ArchiveFile::Init(
-    const ArchiveFileOpenInfo* pInfo)
+    const ArchiveFileOpenInfo* pInfo,
+    bool                       useMemoryMappedReads)
 {
     Result result = Result::Success;
 
+    // A read-only file can't change underneath us while we hold its lock, so it can be mapped once up front. Fall back
+    // to the regular read paths if the mapping fails.
+    if (useMemoryMappedReads &&
+        (m_haveWriteAccess == false))
+    {
+        const Result mapResult = InitMapping();
+        PAL_ALERT(IsErrorResult(mapResult));
+    }
+
     // Init internal memory buffers
     if ((result == Result::Success) &&
+        (m_pMappedFile == nullptr) &&
         (pInfo->useBufferedReadMemory))
     {
         m_useBufferedMemory = true;
         result              = InitPages();
     }
 
+    // Pull in as many entry headers as possible from the index sidecar. Any entries it doesn't cover are read from the
+    // archive by RefreshFile() below.
+    if (result == Result::Success)
+    {
+        GenerateFullPath(m_indexPath, sizeof(m_indexPath), pInfo);
+        Strncat(m_indexPath, sizeof(m_indexPath), ArchiveIndexSuffix);
+
+        const Result indexResult = LoadIndex();
+        PAL_ALERT(IsErrorResult(indexResult));
+    }
+
     // Read the footer of the file directly
     if (result == Result::Success)
     {
@@ -512,7 +574,19 @@ Result ArchiveFile::Preload(
 {
     Result result = Result::ErrorUnknown;
 
-    if (m_useBufferedMemory)
+    if (m_pMappedFile != nullptr)
+    {
+        if (startLocation < m_mappedSize)
+        {
+            PrefetchMapped(startLocation, Min(maxReadSize, m_mappedSize - startLocation));
+            result = Result::Success;
+        }
+        else
+        {
+            result = Result::ErrorInvalidValue;
+        }
+    }
+    else if (m_useBufferedMemory)
     {
         if (startLocation < m_fileSize)
         {
@@ -558,15 +632,22 @@ Result ArchiveFile::FillEntryHeaderTable(
     }
     else
     {
+        // We can still fill the table using our cached entries
+        Result refreshResult = RefreshFile(false);
+        PAL_ALERT(IsErrorResult(refreshResult));
+
         const size_t endEntry = Min<size_t>(startEntry + maxEntries, m_entries.NumElements());
 
+        result = (startEntry < endEntry) ? Result::Success : Result::ErrorInvalidValue;
+
         for (size_t i = startEntry; i < endEntry; ++i)
         {
-            ArchiveEntryHeader* pCurEntry = &pHeaders[i];
-            result = GetEntryByIndex(i, pCurEntry);
+            pHeaders[i - startEntry] = m_entries.At(static_cast<uint32>(i));
 
-            if (result != Result::Success)
+            if (pHeaders[i - startEntry].ordinalId != i)
             {
+                PAL_ALERT_ALWAYS();
+                result = Result::ErrorUnknown;
                 break;
             }
 
@@ -631,67 +712,200 @@ Result ArchiveFile::Read(
     return result;
 }
 
+// =====================================================================================================================
+// Get a pointer to the value corresponding to the entry header passed in inside the mapped archive
+Result ArchiveFile::GetEntryDataView(
+    const ArchiveEntryHeader* pHeader,
+    const void**              ppData)
+{
+    PAL_ASSERT(pHeader != nullptr);
+    PAL_ASSERT(ppData != nullptr);
+
+    Result result = Result::ErrorUnknown;
+
+    if ((pHeader == nullptr) ||
+        (ppData == nullptr))
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if (m_pMappedFile == nullptr)
+    {
+        result = Result::Unsupported;
+    }
+    else if ((pHeader->ordinalId <= GetEntryCount()) &&
+             ((pHeader->dataPosition + pHeader->dataSize) <= m_curFooterOffset))
+    {
+        const void* const pData = VoidPtrInc(m_pMappedFile, pHeader->dataPosition);
+
+        // The payload is still verified so that a view is as trustworthy as a copy returned by Read()
+        if (Crc64(pData, pHeader->dataSize) == pHeader->dataCrc64)
+        {
+            *ppData = pData;
+            result  = Result::Success;
+        }
+        else
+        {
+            PAL_ALERT_ALWAYS();
+        }
+    }
+    else
+    {
+        result = Result::ErrorInvalidValue;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Gets the payload of an entry so that it can be copied into another archive. The payload is a view into the mapped
+// file if there is one, otherwise it is read into pBuffer which must hold pHeader->dataSize bytes. Unlike Read() and
+// GetEntryDataView(), a payload which fails its checksum is not an error; it is reported through pIsValid so that the
+// caller can tell corrupted entries apart from failed reads.
+Result ArchiveFile::GetEntryForCopy(
+    const ArchiveEntryHeader* pHeader,
+    void*                     pBuffer,
+    const void**              ppData,
+    bool*                     pIsValid)
+{
+    PAL_ASSERT(pHeader != nullptr);
+    PAL_ASSERT(ppData != nullptr);
+    PAL_ASSERT(pIsValid != nullptr);
+
+    Result result = Result::Success;
+
+    if ((pHeader == nullptr) ||
+        (ppData == nullptr) ||
+        (pIsValid == nullptr) ||
+        ((m_pMappedFile == nullptr) && (pBuffer == nullptr) && (pHeader->dataSize > 0)))
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if ((pHeader->ordinalId > GetEntryCount()) ||
+             ((pHeader->dataPosition + pHeader->dataSize) > m_curFooterOffset))
+    {
+        result = Result::ErrorInvalidValue;
+    }
+    else if (m_pMappedFile != nullptr)
+    {
+        *ppData = VoidPtrInc(m_pMappedFile, pHeader->dataPosition);
+    }
+    else
+    {
+        result  = ReadInternal(pHeader->dataPosition, pBuffer, pHeader->dataSize, false);
+        *ppData = pBuffer;
+    }
+
+    if (result == Result::Success)
+    {
+        *pIsValid = (Crc64(*ppData, pHeader->dataSize) == pHeader->dataCrc64);
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Write a header+data pair to the archive
 Result ArchiveFile::Write(
     ArchiveEntryHeader* pHeader,
     const void*         pData)
 {
-    PAL_ASSERT(pHeader != nullptr);
-    PAL_ASSERT(pData != nullptr);
+    return WriteBatch(pHeader, &pData, 1);
+}
+
+// =====================================================================================================================
+// Write a set of header+data pairs to the archive followed by a single footer
+Result ArchiveFile::WriteBatch(
+    ArchiveEntryHeader* pHeaders,
+    const void* const*  ppData,
+    size_t              count)
+{
+    PAL_ASSERT(pHeaders != nullptr);
+    PAL_ASSERT(ppData != nullptr);
 
     Result result = Result::ErrorUnknown;
 
-    if ((pHeader == nullptr) ||
-        (pData == nullptr))
+    if ((pHeaders == nullptr) ||
+        (ppData == nullptr))
     {
         result = Result::ErrorInvalidPointer;
     }
     else if (m_haveWriteAccess)
     {
         // cache off the write location
-        uint32 curOffset = m_curFooterOffset;
+        const uint32 startOffset = m_curFooterOffset;
+        uint32       curOffset   = startOffset;
+        size_t       writeSize   = sizeof(ArchiveFileFooter);
 
-        FastMemCpy(pHeader->entryMarker, MagicEntryMarker, sizeof(MagicEntryMarker));
-        pHeader->ordinalId    = m_cachedFooter.entryCount;
-        pHeader->nextBlock    = curOffset + sizeof(ArchiveEntryHeader) + pHeader->dataSize;
-        pHeader->dataPosition = curOffset + sizeof(ArchiveEntryHeader);
-        pHeader->dataCrc64    = Crc64(pData, pHeader->dataSize);
+        result = Result::Success;
 
-        size_t writeSize = sizeof(ArchiveEntryHeader) + pHeader->dataSize + sizeof(ArchiveFileFooter);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ArchiveEntryHeader* const pHeader = &pHeaders[i];
 
-        void* pBuffer = PAL_MALLOC(writeSize, Allocator(), AllocInternalTemp);
+            if (ppData[i] == nullptr)
+            {
+                result = Result::ErrorInvalidPointer;
+                break;
+            }
 
-        if (pBuffer != nullptr)
-        {
-            void* pOutData   = VoidPtrInc(pBuffer, sizeof(ArchiveEntryHeader));
-            void* pOutFooter = VoidPtrInc(pOutData, pHeader->dataSize);
+            FastMemCpy(pHeader->entryMarker, MagicEntryMarker, sizeof(MagicEntryMarker));
+            pHeader->ordinalId    = m_cachedFooter.entryCount + static_cast<uint32>(i);
+            pHeader->nextBlock    = curOffset + sizeof(ArchiveEntryHeader) + pHeader->dataSize;
+            pHeader->dataPosition = curOffset + sizeof(ArchiveEntryHeader);
+            pHeader->dataCrc64    = Crc64(ppData[i], pHeader->dataSize);
 
-            memcpy(pBuffer, pHeader, sizeof(ArchiveEntryHeader));
-            memcpy(pOutData, pData, pHeader->dataSize);
-            memcpy(pOutFooter, &m_cachedFooter, sizeof(ArchiveFileFooter));
+            curOffset  = pHeader->nextBlock;
+            writeSize += sizeof(ArchiveEntryHeader) + pHeader->dataSize;
+        }
 
-            // Correct the footer we're about to attempt to write
-            static_cast<ArchiveFileFooter*>(pOutFooter)->entryCount += 1;
+        void* pBuffer = nullptr;
 
-            result = WriteInternal(curOffset, pBuffer, writeSize);
+        if (result == Result::Success)
+        {
+            pBuffer = PAL_MALLOC(writeSize, Allocator(), AllocInternalTemp);
 
-            PAL_SAFE_FREE(pBuffer, Allocator());
-            if (result == Result::Success)
+            if (pBuffer == nullptr)
             {
-                // Update our internal cache to reflect the result of the write
-                m_curFooterOffset = pHeader->nextBlock;
-                m_cachedFooter.entryCount += 1;
+                PAL_ALERT_ALWAYS();
+                result = Result::ErrorOutOfMemory;
+            }
+        }
 
-                result = m_entries.PushBack(*pHeader);
+        if (result == Result::Success)
+        {
+            void* pOut = pBuffer;
 
-                PAL_ALERT(IsErrorResult(result));
+            for (size_t i = 0; i < count; ++i)
+            {
+                memcpy(pOut, &pHeaders[i], sizeof(ArchiveEntryHeader));
+                pOut = VoidPtrInc(pOut, sizeof(ArchiveEntryHeader));
+
+                memcpy(pOut, ppData[i], pHeaders[i].dataSize);
+                pOut = VoidPtrInc(pOut, pHeaders[i].dataSize);
             }
+
+            memcpy(pOut, &m_cachedFooter, sizeof(ArchiveFileFooter));
+
+            // Correct the footer we're about to attempt to write. Only one footer is written for the whole batch.
+            static_cast<ArchiveFileFooter*>(pOut)->entryCount += static_cast<uint32>(count);
+
+            result = WriteInternal(startOffset, pBuffer, writeSize);
+
+            PAL_SAFE_FREE(pBuffer, Allocator());
         }
-        else
+
+        if (result == Result::Success)
         {
-            PAL_ALERT_ALWAYS();
-            result = Result::ErrorOutOfMemory;
+            // Update our internal cache to reflect the result of the write
+            m_curFooterOffset          = curOffset;
+            m_cachedFooter.entryCount += static_cast<uint32>(count);
+
+            for (size_t i = 0; (i < count) && (result == Result::Success); ++i)
+            {
+                result = m_entries.PushBack(pHeaders[i]);
+            }
+
+            PAL_ALERT(IsErrorResult(result));
         }
     }
     else
@@ -794,6 +1008,213 @@ Result ArchiveFile::RefreshFile(
     return result;
 }
 
+// =====================================================================================================================
+// Populate our entry table from the index sidecar. Fails without side effects if the sidecar is missing or doesn't
+// describe this archive.
+Result ArchiveFile::LoadIndex()
+{
+    PAL_ASSERT(m_entries.IsEmpty());
+
+    Result      result = Result::NotFound;
+    const int32 fd     = open(m_indexPath, O_RDONLY);
+
+    ArchiveIndexHeader indexHeader = {};
+    ArchiveFileFooter  footer      = {};
+    struct stat        statBuf;
+    uint64             archiveSize = 0;
+
+    if (fd != InvalidFd)
+    {
+        result = ReadDirect(fd, 0, &indexHeader, sizeof(indexHeader));
+    }
+
+    if (result == Result::Success)
+    {
+        const uint64 expectedSize = sizeof(ArchiveIndexHeader) +
+                                    (static_cast<uint64>(indexHeader.entryCount) * sizeof(ArchiveEntryHeader));
+
+        if ((memcmp(indexHeader.indexMarker, MagicIndexMarker, sizeof(MagicIndexMarker)) != 0) ||
+            (indexHeader.majorVersion != m_archiveHeader.majorVersion) ||
+            (indexHeader.minorVersion != m_archiveHeader.minorVersion) ||
+            (fstat(fd, &statBuf) != 0) ||
+            (static_cast<uint64>(statBuf.st_size) != expectedSize) ||
+            (fstat(m_hFile, &statBuf) != 0))
+        {
+            result = Result::ErrorIncompatibleLibrary;
+        }
+        else
+        {
+            archiveSize = static_cast<uint64>(statBuf.st_size);
+        }
+    }
+
+    // The archive is append-only, so the index is either current (the footer is still where it was and unchanged) or
+    // a prefix of the archive's entries (the footer was overwritten by new entries).
+    bool isCurrent = false;
+
+    if (result == Result::Success)
+    {
+        if ((indexHeader.footerOffset + sizeof(ArchiveFileFooter)) == archiveSize)
+        {
+            result    = ReadInternal(indexHeader.footerOffset, &footer, sizeof(footer), false);
+            isCurrent = (result == Result::Success) &&
+                        (Crc64(&footer, sizeof(footer)) == indexHeader.footerCrc64) &&
+                        (footer.entryCount == indexHeader.entryCount);
+
+            if (isCurrent == false)
+            {
+                result = Result::ErrorIncompatibleLibrary;
+            }
+        }
+        else if ((indexHeader.footerOffset + sizeof(ArchiveFileFooter)) > archiveSize)
+        {
+            result = Result::ErrorIncompatibleLibrary;
+        }
+    }
+
+    void* pRecords = nullptr;
+
+    if ((result == Result::Success) &&
+        (indexHeader.entryCount > 0))
+    {
+        const size_t recordsSize = indexHeader.entryCount * sizeof(ArchiveEntryHeader);
+
+        pRecords = PAL_MALLOC(recordsSize, Allocator(), AllocInternalTemp);
+
+        if (pRecords == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+
+        if (result == Result::Success)
+        {
+            result = ReadDirect(fd, sizeof(indexHeader), pRecords, recordsSize);
+        }
+
+        if ((result == Result::Success) &&
+            (Crc64(pRecords, recordsSize) != indexHeader.entriesCrc64))
+        {
+            result = Result::ErrorIncompatibleLibrary;
+        }
+
+        // A stale index must still match the archive: its last record has to be on disc exactly as remembered.
+        if ((result == Result::Success) &&
+            (isCurrent == false))
+        {
+            const ArchiveEntryHeader* const pLast =
+                static_cast<const ArchiveEntryHeader*>(pRecords) + (indexHeader.entryCount - 1);
+            ArchiveEntryHeader onDisk = {};
+
+            result = ReadInternal(pLast->dataPosition - sizeof(ArchiveEntryHeader), &onDisk, sizeof(onDisk), false);
+
+            if ((result == Result::Success) &&
+                (memcmp(&onDisk, pLast, sizeof(onDisk)) != 0))
+            {
+                result = Result::ErrorIncompatibleLibrary;
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_entries.Reserve(indexHeader.entryCount);
+        }
+
+        const ArchiveEntryHeader* const pHeaders = static_cast<const ArchiveEntryHeader*>(pRecords);
+
+        for (uint32 i = 0; (result == Result::Success) && (i < indexHeader.entryCount); ++i)
+        {
+            if (pHeaders[i].ordinalId == i)
+            {
+                result = m_entries.PushBack(pHeaders[i]);
+            }
+            else
+            {
+                result = Result::ErrorIncompatibleLibrary;
+            }
+        }
+
+        PAL_SAFE_FREE(pRecords, Allocator());
+    }
+
+    if (result == Result::Success)
+    {
+        m_indexedEntryCount = indexHeader.entryCount;
+
+        if (isCurrent)
+        {
+            m_cachedFooter    = footer;
+            m_curFooterOffset = indexHeader.footerOffset;
+            m_fileSize        = archiveSize;
+        }
+    }
+    else
+    {
+        m_entries.Clear();
+    }
+
+    if (fd != InvalidFd)
+    {
+        close(fd);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Write our entry table out to the index sidecar
+Result ArchiveFile::WriteIndex()
+{
+    Result       result      = Result::Success;
+    const uint32 entryCount  = m_entries.NumElements();
+    const size_t recordsSize = entryCount * sizeof(ArchiveEntryHeader);
+
+    ArchiveIndexHeader indexHeader = {};
+
+    memcpy(indexHeader.indexMarker, MagicIndexMarker, sizeof(indexHeader.indexMarker));
+    indexHeader.majorVersion = m_archiveHeader.majorVersion;
+    indexHeader.minorVersion = m_archiveHeader.minorVersion;
+    indexHeader.entryCount   = entryCount;
+    indexHeader.footerOffset = m_curFooterOffset;
+    indexHeader.footerCrc64  = Crc64(&m_cachedFooter, sizeof(m_cachedFooter));
+    indexHeader.entriesCrc64 = (entryCount > 0) ? Crc64(m_entries.Data(), recordsSize) : 0;
+
+    const int32 fd = open(m_indexPath, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+
+    if (fd == InvalidFd)
+    {
+        result = Result::ErrorUnavailable;
+    }
+
+    if (result == Result::Success)
+    {
+        result = WriteDirect(fd, 0, &indexHeader, sizeof(indexHeader));
+    }
+
+    if ((result == Result::Success) &&
+        (entryCount > 0))
+    {
+        result = WriteDirect(fd, sizeof(indexHeader), m_entries.Data(), recordsSize);
+    }
+
+    if (fd != InvalidFd)
+    {
+        close(fd);
+
+        // Never leave a torn index behind, it would only be rejected on the next open
+        if (result != Result::Success)
+        {
+            remove(m_indexPath);
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        m_indexedEntryCount = entryCount;
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Lookup Archive entry header by index
 Result ArchiveFile::GetEntryByIndex(
@@ -845,6 +1266,14 @@ Result ArchiveFile::ReadNextEntry(
     if (headerOffset < m_curFooterOffset)
     {
         result = ReadInternal(headerOffset, pNextHeader, sizeof(ArchiveEntryHeader), false);
+
+        // Headers are walked in file order while payloads are skipped, so start paging in the following header early.
+        if ((result == Result::Success) &&
+            (m_pMappedFile != nullptr) &&
+            (pNextHeader->nextBlock < m_curFooterOffset))
+        {
+            PrefetchMapped(pNextHeader->nextBlock, sizeof(ArchiveEntryHeader));
+        }
     }
 
     return result;
@@ -862,7 +1291,11 @@ Result ArchiveFile::ReadInternal(
 
     Result result = Result::ErrorUnknown;
 
-    if (m_useBufferedMemory)
+    if (m_pMappedFile != nullptr)
+    {
+        result = ReadMapped(fileOffset, pBuffer, readSize);
+    }
+    else if (m_useBufferedMemory)
     {
         result = ReadCached(fileOffset, pBuffer, readSize, forceCacheReload);
     }
@@ -899,6 +1332,78 @@ Result ArchiveFile::WriteInternal(
     return result;
 }
 
+// =====================================================================================================================
+// Map the whole file read-only into our address space
+Result ArchiveFile::InitMapping()
+{
+    PAL_ASSERT(m_haveWriteAccess == false);
+
+    Result      result = Result::ErrorUnknown;
+    struct stat statBuf;
+
+    if ((fstat(m_hFile, &statBuf) == 0) &&
+        (statBuf.st_size > 0))
+    {
+        const size_t mappedSize  = static_cast<size_t>(statBuf.st_size);
+        void* const  pMappedFile = mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, m_hFile, 0);
+
+        if (pMappedFile != MAP_FAILED)
+        {
+            m_pMappedFile = pMappedFile;
+            m_mappedSize  = mappedSize;
+
+            // Payloads are read by random access so kernel read-ahead would mostly pull in data that is never used.
+            // The footer and the first entry header are needed immediately to build the entry table.
+            madvise(m_pMappedFile, m_mappedSize, MADV_RANDOM);
+            PrefetchMapped(m_mappedSize - sizeof(ArchiveFileFooter), sizeof(ArchiveFileFooter));
+            PrefetchMapped(m_archiveHeader.firstBlock, sizeof(ArchiveEntryHeader));
+
+            result = Result::Success;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Copy data out of the mapped file
+Result ArchiveFile::ReadMapped(
+    size_t fileOffset,
+    void*  pBuffer,
+    size_t readSize)
+{
+    PAL_ASSERT(m_pMappedFile != nullptr);
+
+    Result result = Result::ErrorInvalidValue;
+
+    if ((fileOffset <= m_mappedSize) &&
+        (readSize <= (m_mappedSize - fileOffset)))
+    {
+        memcpy(pBuffer, VoidPtrInc(m_pMappedFile, fileOffset), readSize);
+        result = Result::Success;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Ask the kernel to start paging in a range of the mapped file
+void ArchiveFile::PrefetchMapped(
+    size_t fileOffset,
+    size_t size)
+{
+    PAL_ASSERT(m_pMappedFile != nullptr);
+
+    const size_t pageSize  = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t beginPage = Pow2AlignDown(fileOffset, pageSize);
+    const size_t endOffset = Min(fileOffset + size, m_mappedSize);
+
+    if (beginPage < endOffset)
+    {
+        madvise(VoidPtrInc(m_pMappedFile, beginPage), endOffset - beginPage, MADV_WILLNEED);
+    }
+}
+
 // =====================================================================================================================
 // Copy data from cached memory pages
 Result ArchiveFile::ReadCached(
@@ -1134,9 +1639,10 @@ Result ArchiveFile::PageInfo::Load(
 }
 
 // =====================================================================================================================
-// Opens a file on disk as a "PAL Archive File"
-Result OpenArchiveFile(
+// Opens a file on disk as a "PAL Archive File", optionally mapping it into memory if it is opened read-only
+static Result OpenArchiveFileInternal(
     const ArchiveFileOpenInfo* pOpenInfo,
+    bool                       useMemoryMappedReads,
     void*                      pPlacementAddr,
     IArchiveFile**             ppArchiveFile)
 {
@@ -1210,7 +1716,7 @@ Result OpenArchiveFile(
             pOpenInfo->allowWriteAccess,
             pOpenInfo->useBufferedReadMemory ? pOpenInfo->maxReadBufferMem : 0);
 
-        result = pArchiveFile->Init(pOpenInfo);
+        result = pArchiveFile->Init(pOpenInfo, useMemoryMappedReads);
 
         if (result == Result::Success)
         {
@@ -1234,6 +1740,22 @@ Result OpenArchiveFile(
     return result;
 }
 
+// =====================================================================================================================
+// Opens a file on disk as a "PAL Archive File"
+Result OpenArchiveFile(
+    const ArchiveFileOpenInfo* pOpenInfo,
+    void*                      pPlacementAddr,
+    IArchiveFile**             ppArchiveFile)
+{
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    const bool useMemoryMappedReads = (pOpenInfo != nullptr) && pOpenInfo->useMemoryMappedReads;
+#else
+    const bool useMemoryMappedReads = false;
+#endif
+
+    return OpenArchiveFileInternal(pOpenInfo, useMemoryMappedReads, pPlacementAddr, ppArchiveFile);
+}
+
 // =====================================================================================================================
 // Create a blank archive
 Result CreateArchiveFile(
@@ -1253,6 +1775,252 @@ Result CreateArchiveFile(
     return result;
 }
 
+// =====================================================================================================================
+// Rewrite an archive keeping only valid, unique entries accepted by the filter
+Result CompactArchiveFile(
+    const ArchiveFileOpenInfo* pOpenInfo,
+    ArchiveEntryFilter         pfnFilter,
+    void*                      pUserData,
+    size_t*                    pEntriesRemoved)
+{
+    PAL_ASSERT(pOpenInfo != nullptr);
+
+    // The key of an entry, used to detect duplicates
+    struct EntryKey
+    {
+        uint8 value[sizeof(ArchiveEntryHeader::entryKey)];
+    };
+
+    constexpr size_t  BatchSize         = 64;
+    constexpr char    CompactSuffix[]   = ".compact";
+
+    Result            result            = Result::Success;
+    AllocCallbacks    callbacks         = {};
+    IArchiveFile*     pSrcFile          = nullptr;
+    IArchiveFile*     pDstFile          = nullptr;
+    void*             pSrcMem           = nullptr;
+    void*             pDstMem           = nullptr;
+    size_t            entriesRemoved    = 0;
+
+    ArchiveFileOpenInfo srcInfo = {};
+    ArchiveFileOpenInfo dstInfo = {};
+
+    if (pOpenInfo == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if ((strlen(pOpenInfo->fileName) + sizeof(CompactSuffix)) > MaxFilenameLength)
+    {
+        result = Result::ErrorInvalidValue;
+    }
+
+    if (result == Result::Success)
+    {
+        if (pOpenInfo->pMemoryCallbacks == nullptr)
+        {
+            Pal::GetDefaultAllocCb(&callbacks);
+        }
+        else
+        {
+            callbacks = *pOpenInfo->pMemoryCallbacks;
+        }
+
+        // Map the source so that entries can be validated and copied without staging them if possible
+        srcInfo                         = *pOpenInfo;
+        srcInfo.pMemoryCallbacks        = &callbacks;
+        srcInfo.allowCreateFile         = false;
+        srcInfo.allowWriteAccess        = false;
+        srcInfo.useBufferedReadMemory   = false;
+
+        // The temporary archive is created next to the source and swapped in once it is complete
+        dstInfo                         = srcInfo;
+        dstInfo.pPlatformKey            = nullptr;
+        dstInfo.archiveType             = 0;
+        dstInfo.allowCreateFile         = false;
+        dstInfo.allowWriteAccess        = true;
+        Strncat(dstInfo.fileName, sizeof(dstInfo.fileName), CompactSuffix);
+
+        DeleteArchiveFile(&dstInfo);
+    }
+
+    ForwardAllocator allocator(callbacks);
+
+    if (result == Result::Success)
+    {
+        pSrcMem = PAL_MALLOC(GetArchiveFileObjectSize(&srcInfo), &allocator, AllocInternalTemp);
+        pDstMem = PAL_MALLOC(GetArchiveFileObjectSize(&dstInfo), &allocator, AllocInternalTemp);
+
+        if ((pSrcMem == nullptr) ||
+            (pDstMem == nullptr))
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result = OpenArchiveFileInternal(&srcInfo, true, pSrcMem, &pSrcFile);
+    }
+
+    char srcPath[MaxFullPathLength] = {};
+    char dstPath[MaxFullPathLength] = {};
+
+    GenerateFullPath(srcPath, sizeof(srcPath), &srcInfo);
+    GenerateFullPath(dstPath, sizeof(dstPath), &dstInfo);
+
+    // Carry the source's identity (version, type and platform key) over to the new archive
+    if (result == Result::Success)
+    {
+        result = WriteEmptyArchive(dstPath, static_cast<ArchiveFile*>(pSrcFile)->GetArchiveHeader());
+    }
+
+    if (result == Result::Success)
+    {
+        result = OpenArchiveFileInternal(&dstInfo, false, pDstMem, &pDstFile);
+    }
+
+    OpenHashSet<EntryKey, ForwardAllocator, JenkinsHashFunc> seenKeys(1024, &allocator);
+
+    if (result == Result::Success)
+    {
+        result = seenKeys.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        ArchiveFile* const pSrcArchive        = static_cast<ArchiveFile*>(pSrcFile);
+        ArchiveEntryHeader headers[BatchSize] = {};
+        const void*        pData[BatchSize]   = {};
+        void*              pCopies[BatchSize] = {};
+        size_t             batchCount         = 0;
+
+        const size_t entryCount = pSrcFile->GetEntryCount();
+
+        for (size_t i = 0; (i < entryCount) && (result == Result::Success); ++i)
+        {
+            ArchiveEntryHeader header  = {};
+            const void*        pEntry  = nullptr;
+            void*              pCopy   = nullptr;
+            bool               isValid = false;
+            EntryKey           key;
+
+            result = pSrcFile->GetEntryByIndex(i, &header);
+
+            // If the source couldn't be mapped its entries are staged through copies instead
+            if ((result == Result::Success) &&
+                (pSrcArchive->IsMapped() == false) &&
+                (header.dataSize > 0))
+            {
+                pCopy = PAL_MALLOC(header.dataSize, &allocator, AllocInternalTemp);
+
+                if (pCopy == nullptr)
+                {
+                    result = Result::ErrorOutOfMemory;
+                }
+            }
+
+            // A failed read aborts the compaction so that the source is never replaced by an incomplete archive
+            if (result == Result::Success)
+            {
+                result = pSrcArchive->GetEntryForCopy(&header, pCopy, &pEntry, &isValid);
+            }
+
+            if (result != Result::Success)
+            {
+                PAL_SAFE_FREE(pCopy, &allocator);
+                break;
+            }
+
+            memcpy(key.value, header.entryKey, sizeof(key.value));
+
+            // Corrupted entries fail their checksum and are dropped along with evicted ones
+            bool keep = isValid &&
+                        ((pfnFilter == nullptr) || pfnFilter(header, pUserData)) &&
+                        (seenKeys.Contains(key) == false);
+
+            if (keep)
+            {
+                result = seenKeys.Insert(key);
+
+                headers[batchCount] = header;
+                pData[batchCount]   = pEntry;
+                pCopies[batchCount] = pCopy;
+                batchCount++;
+            }
+            else
+            {
+                PAL_SAFE_FREE(pCopy, &allocator);
+                entriesRemoved++;
+            }
+
+            if ((result == Result::Success) &&
+                ((batchCount == BatchSize) || ((i + 1) == entryCount)) &&
+                (batchCount > 0))
+            {
+                result = pDstFile->WriteBatch(headers, pData, batchCount);
+
+                for (size_t j = 0; j < batchCount; ++j)
+                {
+                    PAL_SAFE_FREE(pCopies[j], &allocator);
+                }
+
+                batchCount = 0;
+            }
+        }
+
+        for (size_t j = 0; j < batchCount; ++j)
+        {
+            PAL_SAFE_FREE(pCopies[j], &allocator);
+        }
+    }
+
+    if (pSrcFile != nullptr)
+    {
+        pSrcFile->Destroy();
+    }
+
+    // Destroying the new archive writes its index sidecar
+    if (pDstFile != nullptr)
+    {
+        pDstFile->Destroy();
+    }
+
+    if (result == Result::Success)
+    {
+        if (rename(dstPath, srcPath) == InvalidSysCall)
+        {
+            result = Result::ErrorUnknown;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        Strncat(srcPath, sizeof(srcPath), ArchiveIndexSuffix);
+        Strncat(dstPath, sizeof(dstPath), ArchiveIndexSuffix);
+
+        // Without its sidecar the archive is still valid, it just opens more slowly
+        if (rename(dstPath, srcPath) == InvalidSysCall)
+        {
+            remove(srcPath);
+        }
+    }
+    else if (dstInfo.fileName[0] != '\0')
+    {
+        DeleteArchiveFile(&dstInfo);
+    }
+
+    PAL_SAFE_FREE(pSrcMem, &allocator);
+    PAL_SAFE_FREE(pDstMem, &allocator);
+
+    if ((result == Result::Success) &&
+        (pEntriesRemoved != nullptr))
+    {
+        *pEntriesRemoved = entriesRemoved;
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Attempt to delete an archive file on disc
 Result DeleteArchiveFile(
@@ -1264,12 +2032,20 @@ Result DeleteArchiveFile(
 
     if (pOpenInfo != nullptr)
     {
-        char stringBuffer[MaxPathLength + MaxFilenameLength + 1] = {};
+        char stringBuffer[MaxFullPathLength] = {};
         GenerateFullPath(stringBuffer, sizeof(stringBuffer), pOpenInfo);
         if (remove(stringBuffer) == InvalidSysCall)
         {
             result = Result::ErrorUnknown;
         }
+        else
+        {
+            result = Result::Success;
+        }
+
+        // The sidecar is optional, so it's fine if it doesn't exist
+        Strncat(stringBuffer, sizeof(stringBuffer), ArchiveIndexSuffix);
+        remove(stringBuffer);
     }
 
     return result;
@@ -30,7 +30,9 @@
 
 namespace Util
 {
-constexpr int32 InvalidSysCall = -1; // value representing system call happens error for Linux
+constexpr int32  InvalidSysCall       = -1;     // value representing system call happens error for Linux
+constexpr char   ArchiveIndexSuffix[] = ".idx"; // appended to the archive file name to name its index sidecar
+constexpr size_t MaxFullPathLength    = MaxPathLength + MaxFilenameLength + sizeof(ArchiveIndexSuffix);
 
 // =====================================================================================================================
 // Wrapper around a transaction file written int the format specified in palArchiveFileFmt.h
@@ -45,7 +47,7 @@ public:
             size_t                   memoryBufferMax);
     virtual ~ArchiveFile();
 
-    Result Init(const ArchiveFileOpenInfo* pInfo);
+    Result Init(const ArchiveFileOpenInfo* pInfo, bool useMemoryMappedReads);
 
     virtual size_t GetEntryCount() const override;
 
@@ -67,12 +69,31 @@ public:
         const ArchiveEntryHeader*   pHeader,
         void*                       pDataBuffer) override;
 
+    virtual Result GetEntryDataView(
+        const ArchiveEntryHeader*   pHeader,
+        const void**                ppData) override;
+
     virtual Result Write(
         ArchiveEntryHeader* pHeader,
         const void*         pData) override;
 
+    virtual Result WriteBatch(
+        ArchiveEntryHeader* pHeaders,
+        const void* const*  ppData,
+        size_t              count) override;
+
     virtual void   Destroy() override { this->~ArchiveFile(); }
 
+    const ArchiveFileHeader& GetArchiveHeader() const { return m_archiveHeader; }
+
+    bool IsMapped() const { return (m_pMappedFile != nullptr); }
+
+    Result GetEntryForCopy(
+        const ArchiveEntryHeader* pHeader,
+        void*                     pBuffer,
+        const void**              ppData,
+        bool*                     pIsValid);
+
 private:
     PAL_DISALLOW_DEFAULT_CTOR(ArchiveFile);
     PAL_DISALLOW_COPY_AND_ASSIGN(ArchiveFile);
@@ -117,11 +138,20 @@ private:
 
     Result RefreshFile(bool forceRefresh);
 
+    // Index sidecar
+    Result LoadIndex();
+    Result WriteIndex();
+
     Result ReadNextEntry(const ArchiveEntryHeader* pCurheader, ArchiveEntryHeader* pNextHeader);
 
     Result ReadInternal(size_t fileOffset, void* pBuffer, size_t readSize, bool forceCacheReload);
     Result WriteInternal(size_t fileOffset, const void* pData, size_t writeSize);
 
+    // Memory mapped I/O API
+    Result InitMapping();
+    Result ReadMapped(size_t fileOffset, void* pBuffer, size_t readSize);
+    void   PrefetchMapped(size_t fileOffset, size_t size);
+
     // "Cached" I/O API
     Result ReadCached(size_t fileOffset, void* pBuffer, size_t readSize, bool forceReload);
     Result WriteCached(size_t fileOffset, const void* pData, size_t writeSize);
@@ -161,6 +191,14 @@ private:
     PageInfo                m_pages[MaxPageCount];
     size_t                  m_pageCount;
     size_t                  m_pageSize;
+
+    // Index sidecar: only rewritten on destruction if entries were added since it was loaded
+    char                    m_indexPath[MaxFullPathLength];
+    size_t                  m_indexedEntryCount;
+
+    // Read-only mapping of the whole file: MAY BE NULL IF WE AREN'T USING MEMORY MAPPED READS
+    void*                   m_pMappedFile;
+    size_t                  m_mappedSize;
 };
 
 } //namespace Util
@@ -24,6 +24,7 @@
  **********************************************************************************************************************/
 
 #include "palSysMemory.h"
+#include "util/lnx/lnxSysMemory.h"
 #include <cstdlib>
 #include <unistd.h>
 #include <sys/mman.h>
@@ -102,10 +103,38 @@ Result VirtualReserve(
 
     if (result == Result::Success)
     {
-        void* pMemory = mmap(pMem, sizeInBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        // mmap only guarantees page alignment. If the caller wants a larger alignment we over-reserve by the alignment
+        // and trim off the unaligned head and the leftover tail afterwards.
+        const size_t pageSize     = VirtualPageSize();
+        const bool   overReserve  = ((pMem == nullptr) && (alignment > pageSize));
+        const size_t reserveBytes = overReserve ? (sizeInBytes + alignment) : sizeInBytes;
+
+        PAL_ASSERT((overReserve == false) || IsPowerOfTwo(alignment));
+
+        void* pMemory = mmap(pMem, reserveBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
 
         if ((pMemory != nullptr) && (pMemory != MAP_FAILED))
         {
+            if (overReserve)
+            {
+                const size_t base      = reinterpret_cast<size_t>(pMemory);
+                const size_t alignedVa = Pow2Align(base, alignment);
+                const size_t headBytes = alignedVa - base;
+                const size_t tailBytes = reserveBytes - headBytes - sizeInBytes;
+
+                if (headBytes > 0)
+                {
+                    munmap(pMemory, headBytes);
+                }
+
+                if (tailBytes > 0)
+                {
+                    munmap(reinterpret_cast<void*>(alignedVa + sizeInBytes), tailBytes);
+                }
+
+                pMemory = reinterpret_cast<void*>(alignedVa);
+            }
+
             PAL_ASSERT(ppOut != nullptr);
             (*ppOut) = pMemory;
         }
@@ -216,6 +245,86 @@ Result VirtualRelease(
     return result;
 }
 
+// =====================================================================================================================
+// Asks the OS to back the specified range of committed memory with transparent huge pages. This is only a hint.
+Result VirtualAdviseHugePages(
+    void*  pMem,
+    size_t sizeInBytes)
+{
+    Result result = Result::Success;
+
+    if (sizeInBytes == 0)
+    {
+        result = Result::ErrorInvalidValue;
+    }
+    else if (pMem == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+
+    if (result == Result::Success)
+    {
+#if defined(MADV_HUGEPAGE)
+        if (madvise(pMem, sizeInBytes, MADV_HUGEPAGE) != 0)
+        {
+            result = Result::ErrorUnavailable;
+        }
+#else
+        result = Result::ErrorUnavailable;
+#endif
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Faults in every page of the specified range of committed memory for writing without changing its contents.
+Result VirtualPrefault(
+    void*  pMem,
+    size_t sizeInBytes)
+{
+    Result result = Result::Success;
+
+    if (sizeInBytes == 0)
+    {
+        result = Result::ErrorInvalidValue;
+    }
+    else if (pMem == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+
+    if (result == Result::Success)
+    {
+        const size_t pageSize = VirtualPageSize();
+        bool         faulted  = false;
+
+#if defined(MADV_POPULATE_WRITE)
+        // Newer kernels can populate the whole range in a single call. This fails on some kinds of mappings (e.g.,
+        // mapped GPU memory) in which case we fall back to touching the pages ourselves.
+        const size_t start = Pow2AlignDown(reinterpret_cast<size_t>(pMem), pageSize);
+        const size_t end   = Pow2Align(reinterpret_cast<size_t>(pMem) + sizeInBytes, pageSize);
+
+        faulted = (madvise(reinterpret_cast<void*>(start), (end - start), MADV_POPULATE_WRITE) == 0);
+#endif
+
+        if (faulted == false)
+        {
+            // Writing back the value we just read faults the page in for writing without modifying it.
+            volatile uint8*const pBytes = static_cast<volatile uint8*>(pMem);
+
+            for (size_t offset = 0; offset < sizeInBytes; offset += pageSize)
+            {
+                pBytes[offset] = pBytes[offset];
+            }
+
+            pBytes[sizeInBytes - 1] = pBytes[sizeInBytes - 1];
+        }
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 void* GenericAllocator::Alloc(
     const AllocInfo& allocInfo)
@@ -24,7 +24,7 @@
  **********************************************************************************************************************/
 
 #include "memoryCacheLayer.h"
-#include "palHashMapImpl.h"
+#include "palOpenHashMapImpl.h"
 #include "palIntrusiveListImpl.h"
 #include "palAssert.h"
 #include "core/platform.h"
@@ -32,36 +32,89 @@
 namespace Util
 {
 
+// =====================================================================================================================
+template <RWLock::LockType type>
+MemoryCacheLayer::ShardLockAuto<type>::ShardLockAuto(
+    Shard* pShard)
+    :
+    m_pShard { pShard }
+{
+    const bool acquired = (type == RWLock::ReadOnly) ? m_pShard->lock.TryLockForRead()
+                                                     : m_pShard->lock.TryLockForWrite();
+
+    if (acquired == false)
+    {
+        AtomicIncrement64(&m_pShard->contentions);
+
+        if (type == RWLock::ReadOnly)
+        {
+            m_pShard->lock.LockForRead();
+        }
+        else
+        {
+            m_pShard->lock.LockForWrite();
+        }
+    }
+}
+
+// =====================================================================================================================
+template <RWLock::LockType type>
+MemoryCacheLayer::ShardLockAuto<type>::~ShardLockAuto()
+{
+    if (type == RWLock::ReadOnly)
+    {
+        m_pShard->lock.UnlockForRead();
+    }
+    else
+    {
+        m_pShard->lock.UnlockForWrite();
+    }
+}
+
 // =====================================================================================================================
 MemoryCacheLayer::MemoryCacheLayer(
     const AllocCallbacks& callbacks,
     size_t                maxMemorySize,
     size_t                maxObjectCount,
     bool                  evictOnFull,
-    bool                  evictDuplicates)
+    bool                  evictDuplicates,
+    uint32                numShards,
+    void*                 pShardMem)
     :
     CacheLayerBase    { callbacks },
     m_maxSize         { maxMemorySize },
     m_maxCount        { maxObjectCount },
     m_evictOnFull     { evictOnFull },
     m_evictDuplicates { evictDuplicates },
-    m_lock            {},
+    m_numShards       { GetShardCount(numShards) },
     m_curSize         { 0 },
     m_curCount        { 0 },
-    m_recentEntryList {},
-    m_entryLookup     { 2048, Allocator() }
+    m_pShards         { static_cast<Shard*>(pShardMem) }
 {
+    PAL_ASSERT(m_pShards != nullptr);
+
+    for (uint32 i = 0; i < m_numShards; ++i)
+    {
+        PAL_PLACEMENT_NEW(&m_pShards[i]) Shard(Allocator(), LookupInitEntries / m_numShards);
+    }
 }
 
 // =====================================================================================================================
 MemoryCacheLayer::~MemoryCacheLayer()
 {
-    while (m_recentEntryList.IsEmpty() == false)
+    for (uint32 i = 0; i < m_numShards; ++i)
     {
-        Entry* pEntry = m_recentEntryList.Front();
-        m_entryLookup.Erase(*pEntry->HashId());
-        m_recentEntryList.Erase(pEntry->ListNode());
-        pEntry->Destroy();
+        Shard* const pShard = &m_pShards[i];
+
+        while (pShard->recentEntryList.IsEmpty() == false)
+        {
+            Entry* pEntry = pShard->recentEntryList.Front();
+            pShard->entryLookup.Erase(*pEntry->HashId());
+            pShard->recentEntryList.Erase(pEntry->ListNode());
+            pEntry->Destroy();
+        }
+
+        pShard->~Shard();
     }
 }
 
@@ -71,14 +124,14 @@ Result MemoryCacheLayer::Init()
 {
     Result result = CacheLayerBase::Init();
 
-    if (result == Result::Success)
+    for (uint32 i = 0; (i < m_numShards) && (result == Result::Success); ++i)
     {
-        result = m_lock.Init();
-    }
+        result = m_pShards[i].lock.Init();
 
-    if (result == Result::Success)
-    {
-        result = m_entryLookup.Init();
+        if (result == Result::Success)
+        {
+            result = m_pShards[i].entryLookup.Init();
+        }
     }
 
     return result;
@@ -92,26 +145,77 @@ Result MemoryCacheLayer::QueryInternal(
 {
     Result result = Result::Success;
 
-    Entry** ppFound = nullptr;
+    Shard* const pShard   = GetShard(*pHashId);
+    Entry*       pFound   = nullptr;
+    size_t       dataSize = 0;
+    void*        pData    = nullptr;
+
+    if (UseClock())
+    {
+        ShardLockAuto<RWLock::ReadOnly> lock { pShard };
+
+        Entry** ppFound = pShard->entryLookup.FindKey(*pHashId);
+
+        if (ppFound != nullptr)
+        {
+            // Entries are never added to the lookup without a valid entry pointer.
+            PAL_ASSERT(*ppFound != nullptr);
+            pFound = *ppFound;
+
+            if (pFound != nullptr)
+            {
+                pFound->MarkReferenced();
+
+                // The entry may be evicted as soon as the lock is released.
+                dataSize = pFound->DataSize();
+                pData    = pFound->Data();
+            }
+        }
+        else
+        {
+            result = Result::NotFound;
+        }
+    }
+    else
+    {
+        ShardLockAuto<RWLock::ReadWrite> lock { pShard };
+
+        Entry** ppFound = pShard->entryLookup.FindKey(*pHashId);
+
+        if (ppFound != nullptr)
+        {
+            // Entries are never added to the lookup without a valid entry pointer.
+            PAL_ASSERT(*ppFound != nullptr);
+            pFound = *ppFound;
 
-    RWLockAuto<RWLock::ReadWrite> lock { &m_lock };
+            if (pFound != nullptr)
+            {
+                Entry::Node* pNode = pFound->ListNode();
+                pShard->recentEntryList.Erase(pNode);
+                pShard->recentEntryList.PushBack(pNode);
 
-    ppFound = m_entryLookup.FindKey(*pHashId);
+                dataSize = pFound->DataSize();
+                pData    = pFound->Data();
+            }
+        }
+        else
+        {
+            result = Result::NotFound;
+        }
+    }
 
-    if (ppFound == nullptr)
+    if (result == Result::NotFound)
     {
-        result = Result::NotFound;
+        AtomicIncrement64(&pShard->misses);
     }
-    else if (*ppFound != nullptr)
+    else if (pFound != nullptr)
     {
-        Entry::Node* pNode = (*ppFound)->ListNode();
-        m_recentEntryList.Erase(pNode);
-        m_recentEntryList.PushBack(pNode);
+        AtomicIncrement64(&pShard->hits);
 
         pQuery->hashId             = *pHashId;
         pQuery->pLayer             = this;
-        pQuery->dataSize           = (*ppFound)->DataSize();
-        pQuery->context.pEntryInfo = (*ppFound)->Data();
+        pQuery->dataSize           = dataSize;
+        pQuery->context.pEntryInfo = pData;
     }
     else
     {
@@ -144,13 +248,15 @@ Result MemoryCacheLayer::StoreInternal(
         result = Result::ErrorInvalidValue;
     }
 
+    Shard* const pShard = (result == Result::Success) ? GetShard(*pHashId) : nullptr;
+
     if (result == Result::Success)
     {
         Entry** ppFound = nullptr;
 
-        RWLockAuto<RWLock::ReadWrite> lock { &m_lock };
+        ShardLockAuto<RWLock::ReadWrite> lock { pShard };
 
-        ppFound = m_entryLookup.FindKey(*pHashId);
+        ppFound = pShard->entryLookup.FindKey(*pHashId);
 
         if (ppFound != nullptr)
         {
@@ -158,7 +264,7 @@ Result MemoryCacheLayer::StoreInternal(
             {
                 if (m_evictDuplicates)
                 {
-                    result = EvictEntryFromCache(*ppFound);
+                    result = EvictEntryFromCache(pShard, *ppFound);
                 }
                 else
                 {
@@ -172,22 +278,20 @@ Result MemoryCacheLayer::StoreInternal(
         }
     }
 
-    if (result == Result::Success)
-    {
-        RWLockAuto<RWLock::ReadWrite> lock { &m_lock };
-
-        result = EnsureAvailableSpace(dataSize, 1);
-    }
-
     if (result == Result::Success)
     {
         Entry* pEntry = Entry::Create(Allocator(), pHashId, pData, dataSize);
 
         if (pEntry != nullptr)
         {
-            RWLockAuto<RWLock::ReadWrite> lock { &m_lock };
+            ShardLockAuto<RWLock::ReadWrite> lock { pShard };
 
-            result = AddEntryToCache(pEntry);
+            result = EnsureAvailableSpace(pShard, dataSize, 1);
+
+            if (result == Result::Success)
+            {
+                result = AddEntryToCache(pShard, pEntry);
+            }
 
             if (result != Result::Success)
             {
@@ -223,13 +327,19 @@ Result MemoryCacheLayer::LoadInternal(
     else
     {
         Entry** ppFound = nullptr;
+        Shard*  pShard  = GetShard(pQuery->hashId);
 
-        RWLockAuto<RWLock::ReadOnly> lock { &m_lock };
+        ShardLockAuto<RWLock::ReadOnly> lock { pShard };
 
-        ppFound = m_entryLookup.FindKey(pQuery->hashId);
-        if (ppFound != nullptr)
+        ppFound = pShard->entryLookup.FindKey(pQuery->hashId);
+
+        PAL_ASSERT((ppFound == nullptr) || (*ppFound != nullptr));
+
+        // The entry found by the query may have been evicted and the hash stored again since, so always copy from the
+        // entry which is in the cache now.
+        if ((ppFound != nullptr) && (*ppFound != nullptr) && ((*ppFound)->DataSize() == pQuery->dataSize))
         {
-            memcpy(pBuffer, pQuery->context.pEntryInfo, pQuery->dataSize);
+            memcpy(pBuffer, (*ppFound)->Data(), pQuery->dataSize);
         }
         else
         {
@@ -242,87 +352,73 @@ Result MemoryCacheLayer::LoadInternal(
 }
 
 // =====================================================================================================================
-// Evict entries until a specified count is reached
-Result MemoryCacheLayer::EvictEntryByCount(
-    size_t numToEvict)
+// Picks the next entry to evict from the shard.  In single-shard mode the list is kept in exact LRU order so this is
+// simply the front of the list.  Otherwise the list front acts as a CLOCK hand: referenced entries have their bit
+// cleared and are moved to the back, and the first unreferenced entry is chosen.
+MemoryCacheLayer::Entry* MemoryCacheLayer::SelectVictim(
+    Shard* pShard)
 {
-    Result result = Result::Success;
-
-    size_t numEvicted = 0;
+    Entry* pVictim = pShard->recentEntryList.Front();
 
-    while ((result == Result::Success) &&
-           (numEvicted < numToEvict))
+    if (UseClock())
     {
-        Entry* const pEntry = m_recentEntryList.Front();
-
-        if (pEntry != nullptr)
+        // After one full sweep every reference bit has been cleared, so this loop always terminates with a victim.
+        for (size_t i = 0; (pVictim != nullptr) && (i < pShard->curCount); ++i)
         {
-            result = EvictEntryFromCache(pEntry);
-
-            if (result == Result::Success)
+            if (pVictim->ClearReferenced() == false)
             {
-                ++numEvicted;
+                break;
             }
-        }
-        else
-        {
-            result = Result::ErrorShaderCacheFull;
+
+            Entry::Node* pNode = pVictim->ListNode();
+            pShard->recentEntryList.Erase(pNode);
+            pShard->recentEntryList.PushBack(pNode);
+
+            pVictim = pShard->recentEntryList.Front();
         }
     }
 
-    return result;
+    return pVictim;
 }
 
 // =====================================================================================================================
-// Evict entries until a specified size is reached
-Result MemoryCacheLayer::EvictEntryBySize(
-    size_t minSizeToEvict)
+// Evicts entries from the given shard, whose write lock the caller holds, until the budget shared by all shards can
+// hold entrySize more bytes and entryCount more entries or the shard runs out of entries.
+void MemoryCacheLayer::EvictEntries(
+    Shard* pShard,
+    size_t entrySize,
+    size_t entryCount)
 {
     Result result = Result::Success;
 
-    size_t evictedSize = 0;
-
     while ((result == Result::Success) &&
-           (evictedSize < minSizeToEvict))
+           (HasAvailableSpace(entrySize, entryCount) == false))
     {
-        Entry* const pEntry = m_recentEntryList.Front();
+        Entry* const pEntry = SelectVictim(pShard);
 
-        if (pEntry != nullptr)
-        {
-            const size_t dataSize = pEntry->DataSize();
-
-            result = EvictEntryFromCache(pEntry);
-
-            if (result == Result::Success)
-            {
-                evictedSize += dataSize;
-            }
-        }
-        else
-        {
-            result = Result::ErrorShaderCacheFull;
-        }
+        result = (pEntry != nullptr) ? EvictEntryFromCache(pShard, pEntry) : Result::ErrorShaderCacheFull;
     }
-
-    return result;
 }
 
 // =====================================================================================================================
 // Remove an entry from the cache table, list, and metrics.
 Result MemoryCacheLayer::EvictEntryFromCache(
+    Shard* pShard,
     Entry* pEntry)
 {
     PAL_ASSERT(pEntry != nullptr);
 
     Result result = Result::ErrorUnknown;
 
-    if (m_entryLookup.Erase(*pEntry->HashId()))
+    if (pShard->entryLookup.Erase(*pEntry->HashId()))
     {
         result = Result::Success;
 
-        m_recentEntryList.Erase(pEntry->ListNode());
-        m_curSize -= pEntry->DataSize();
-        m_curCount -= 1;
+        pShard->recentEntryList.Erase(pEntry->ListNode());
+        pShard->curSize -= pEntry->DataSize();
+        pShard->curCount -= 1;
+        AtomicAdd64(&m_curSize, static_cast<uint64>(-static_cast<int64>(pEntry->DataSize())));
+        AtomicAdd64(&m_curCount, static_cast<uint64>(-1));
         pEntry->Destroy();
     }
 
@@ -330,27 +426,43 @@ Result MemoryCacheLayer::EvictEntryFromCache(
 }
 
 // =====================================================================================================================
-// Insert the entry into our cache lookup table and LRU list
+// Insert the entry into our cache lookup table and LRU list.  Another thread may have stored the same hash since the
+// caller last checked, in which case the existing entry wins.
 Result MemoryCacheLayer::AddEntryToCache(
+    Shard* pShard,
     Entry* pEntry)
 {
     PAL_ASSERT(pEntry != nullptr);
 
-    Result result = m_entryLookup.Insert(*pEntry->HashId(), pEntry);
+    bool    existed = false;
+    Entry** ppValue = nullptr;
+    Result  result  = pShard->entryLookup.FindAllocate(*pEntry->HashId(), &existed, &ppValue);
+
+    if ((result == Result::Success) && existed)
+    {
+        result = Result::AlreadyExists;
+    }
 
     if (result == Result::Success)
     {
-        m_recentEntryList.PushBack(pEntry->ListNode());
-        m_curSize += pEntry->DataSize();
-        m_curCount++;
+        *ppValue = pEntry;
+
+        pShard->recentEntryList.PushBack(pEntry->ListNode());
+        pShard->curSize += pEntry->DataSize();
+        pShard->curCount++;
+        AtomicAdd64(&m_curSize, pEntry->DataSize());
+        AtomicIncrement64(&m_curCount);
     }
 
     return result;
 }
 
 // =====================================================================================================================
-// Ensure size requested is available within the cache, may evict data
+// Ensure size requested is available within the budget shared by all shards, may evict data.  Victims come from pShard
+// first, whose write lock the caller holds, and then from any other shard whose lock is free.  Waiting on a second
+// shard lock could deadlock against a thread doing the same from that shard, so busy shards are skipped.
 Result MemoryCacheLayer::EnsureAvailableSpace(
+    Shard* pShard,
     size_t entrySize,
     size_t entryCount)
 {
@@ -359,28 +471,35 @@ Result MemoryCacheLayer::EnsureAvailableSpace(
 
     Result result = Result::Success;
 
-    const size_t availableCount = m_maxCount - m_curCount;
-
-    if (entryCount > availableCount)
+    if ((entrySize > m_maxSize) || (entryCount > m_maxCount))
     {
         result = Result::ErrorShaderCacheFull;
-
-        if (m_evictOnFull)
-        {
-            result = EvictEntryByCount(entryCount - availableCount);
-        }
     }
-
-    const size_t availableSize = m_maxSize - m_curSize;
-
-    if ((result == Result::Success) &&
-        (entrySize > availableSize))
+    else if (HasAvailableSpace(entrySize, entryCount) == false)
     {
         result = Result::ErrorShaderCacheFull;
 
         if (m_evictOnFull)
         {
-            result = EvictEntryBySize(entrySize - availableSize);
+            EvictEntries(pShard, entrySize, entryCount);
+
+            const uint32 shardIdx = static_cast<uint32>(pShard - m_pShards);
+
+            for (uint32 i = 1; (i < m_numShards) && (HasAvailableSpace(entrySize, entryCount) == false); ++i)
+            {
+                Shard* const pOtherShard = &m_pShards[(shardIdx + i) & (m_numShards - 1)];
+
+                if (pOtherShard->lock.TryLockForWrite())
+                {
+                    EvictEntries(pOtherShard, entrySize, entryCount);
+                    pOtherShard->lock.UnlockForWrite();
+                }
+            }
+
+            if (HasAvailableSpace(entrySize, entryCount))
+            {
+                result = Result::Success;
+            }
         }
     }
 
@@ -410,12 +529,13 @@ Result MemoryCacheLayer::PromoteData(
         result = Result::ErrorInvalidValue;
     }
 
-    Entry** ppFound = nullptr;
+    Shard* const pShard  = GetShard(pQuery->hashId);
+    Entry**      ppFound = nullptr;
 
     {
-        RWLockAuto<RWLock::ReadOnly> lock { &m_lock };
+        ShardLockAuto<RWLock::ReadOnly> lock { pShard };
 
-        ppFound = m_entryLookup.FindKey(pQuery->hashId);
+        ppFound = pShard->entryLookup.FindKey(pQuery->hashId);
     }
 
     if (ppFound != nullptr)
@@ -423,13 +543,6 @@ Result MemoryCacheLayer::PromoteData(
         result = Result::AlreadyExists;
     }
 
-    if (result == Result::Success)
-    {
-        RWLockAuto<RWLock::ReadWrite> lock { &m_lock };
-
-        result = EnsureAvailableSpace(pQuery->dataSize, 1);
-    }
-
     if (result == Result::Success)
     {
         Entry* pEntry = Entry::Create(Allocator(), &pQuery->hashId, nullptr, pQuery->dataSize);
@@ -440,10 +553,14 @@ Result MemoryCacheLayer::PromoteData(
 
             if (result == Result::Success)
             {
-                RWLockAuto<RWLock::ReadWrite> lock { &m_lock };
+                ShardLockAuto<RWLock::ReadWrite> lock { pShard };
 
-                result = AddEntryToCache(pEntry);
-                m_entryLookup.Insert(pQuery->hashId, pEntry);
+                result = EnsureAvailableSpace(pShard, pQuery->dataSize, 1);
+
+                if (result == Result::Success)
+                {
+                    result = AddEntryToCache(pShard, pEntry);
+                }
             }
 
             if (result == Result::Success)
@@ -472,7 +589,13 @@ Result MemoryCacheLayer::PromoteData(
 size_t GetMemoryCacheLayerSize(
     const MemoryCacheCreateInfo* pCreateInfo)
 {
-    return sizeof(MemoryCacheLayer);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    const uint32 numShards = pCreateInfo->numShards;
+#else
+    const uint32 numShards = 1;
+#endif
+
+    return sizeof(MemoryCacheLayer) + MemoryCacheLayer::GetShardMemSize(numShards);
 }
 
 // =====================================================================================================================
@@ -504,12 +627,20 @@ Result CreateMemoryCacheLayer(
             Pal::GetDefaultAllocCb(&callbacks);
         }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+        const uint32 numShards = pCreateInfo->numShards;
+#else
+        const uint32 numShards = 1;
+#endif
+
         pLayer = PAL_PLACEMENT_NEW(pPlacementAddr) MemoryCacheLayer(
             (pCreateInfo->baseInfo.pCallbacks == nullptr) ? callbacks : *pCreateInfo->baseInfo.pCallbacks,
             pCreateInfo->maxMemorySize,
             pCreateInfo->maxObjectCount,
             pCreateInfo->evictOnFull,
-            pCreateInfo->evictDuplicates);
+            pCreateInfo->evictDuplicates,
+            numShards,
+            VoidPtrInc(pPlacementAddr, sizeof(MemoryCacheLayer)));
 
         result = pLayer->Init();
 
@@ -526,6 +657,26 @@ Result CreateMemoryCacheLayer(
     return result;
 }
 
+// =====================================================================================================================
+// Sums the entry count and data size over all shards.  Like before sharding, this does not take any lock and may
+// observe a concurrent store or eviction partially.
+Result MemoryCacheLayer::GetMemoryCacheSize(
+    size_t* pCurCount,
+    size_t* pCurSize
+    ) const
+{
+    *pCurCount = 0;
+    *pCurSize  = 0;
+
+    for (uint32 i = 0; i < m_numShards; ++i)
+    {
+        *pCurCount += m_pShards[i].curCount;
+        *pCurSize  += m_pShards[i].curSize;
+    }
+
+    return Result::Success;
+}
+
 // =====================================================================================================================
 Result GetMemoryCacheLayerCurSize(
     ICacheLayer*    pCacheLayer,
@@ -544,17 +695,33 @@ Result MemoryCacheLayer::GetMemoryCacheHashIds(
 {
     Result result = Result::Success;
 
-    RWLockAuto<RWLock::ReadOnly> lock { &m_lock };
+    // Hold every shard's lock so that the count and the hash IDs form a consistent snapshot.  Shards are always locked
+    // in index order.
+    for (uint32 i = 0; i < m_numShards; ++i)
+    {
+        m_pShards[i].lock.LockForRead();
+    }
+
+    size_t totalCount = 0;
+
+    for (uint32 i = 0; i < m_numShards; ++i)
+    {
+        totalCount += m_pShards[i].curCount;
+    }
+
     // Iterate through all Entries and copy their hash ID to pHashIds array.
-    if (curCount == m_curCount)
+    if (curCount == totalCount)
     {
         uint32 i = 0;
 
-        for (auto iter = m_recentEntryList.Begin(); iter.IsValid(); iter.Next())
+        for (uint32 shard = 0; shard < m_numShards; ++shard)
         {
-            Entry* pEntry = iter.Get();
+            for (auto iter = m_pShards[shard].recentEntryList.Begin(); iter.IsValid(); iter.Next())
+            {
+                Entry* pEntry = iter.Get();
 
-            pHashIds[i++] = *pEntry->HashId();
+                pHashIds[i++] = *pEntry->HashId();
+            }
         }
     }
     else
@@ -562,6 +729,11 @@ Result MemoryCacheLayer::GetMemoryCacheHashIds(
         result = Result::ErrorInvalidMemorySize;
     }
 
+    for (uint32 i = 0; i < m_numShards; ++i)
+    {
+        m_pShards[i].lock.UnlockForRead();
+    }
+
     return result;
 }
 
@@ -576,4 +748,61 @@ Result GetMemoryCacheLayerHashIds(
     return pMemoryCache->GetMemoryCacheHashIds(curCount, pHashIds);
 }
 
+// =====================================================================================================================
+Result MemoryCacheLayer::GetMemoryCacheShardStats(
+    uint32*                pNumShards,
+    MemoryCacheShardStats* pStats
+    ) const
+{
+    PAL_ASSERT(pNumShards != nullptr);
+
+    Result result = Result::Success;
+
+    if (pStats != nullptr)
+    {
+        if (*pNumShards < m_numShards)
+        {
+            result = Result::ErrorInvalidMemorySize;
+        }
+        else
+        {
+            for (uint32 i = 0; i < m_numShards; ++i)
+            {
+                const Shard& shard = m_pShards[i];
+
+                pStats[i].curCount    = shard.curCount;
+                pStats[i].curSize     = shard.curSize;
+                pStats[i].hits        = shard.hits;
+                pStats[i].misses      = shard.misses;
+                pStats[i].contentions = shard.contentions;
+            }
+        }
+    }
+
+    *pNumShards = m_numShards;
+
+    return result;
+}
+
+// =====================================================================================================================
+Result GetMemoryCacheLayerShardStats(
+    ICacheLayer*           pCacheLayer,
+    uint32*                pNumShards,
+    MemoryCacheShardStats* pStats)
+{
+    PAL_ASSERT(pCacheLayer != nullptr);
+    PAL_ASSERT(pNumShards != nullptr);
+
+    Result result = Result::ErrorInvalidPointer;
+
+    if ((pCacheLayer != nullptr) && (pNumShards != nullptr))
+    {
+        auto pMemoryCache = static_cast<MemoryCacheLayer*>(pCacheLayer);
+
+        result = pMemoryCache->GetMemoryCacheShardStats(pNumShards, pStats);
+    }
+
+    return result;
+}
+
 } //namespace Util
@@ -25,7 +25,7 @@
 #pragma once
 
 #include "cacheLayerBase.h"
-#include "palHashMap.h"
+#include "palOpenHashMap.h"
 #include "palIntrusiveList.h"
 #include "palVector.h"
 
@@ -34,6 +34,11 @@ namespace Util
 
 // =====================================================================================================================
 // An ICacheLayer implementation that operates on fixed memory limits but not a fixed memory space
+//
+// The cache is split into one or more shards selected by hash, each with its own lock, lookup table and replacement
+// list.  With a single shard queries take the lock exclusively to maintain an exact LRU order.  With multiple shards
+// queries only take their shard's lock in shared mode and set a reference bit on the entry, and eviction approximates
+// LRU by giving referenced entries a second chance (CLOCK).
 class MemoryCacheLayer : public CacheLayerBase
 {
 public:
@@ -42,21 +47,25 @@ public:
         size_t                maxMemorySize,
         size_t                maxObjectCount,
         bool                  evictOnFull,
-        bool                  evictDuplicates);
+        bool                  evictDuplicates,
+        uint32                numShards,
+        void*                 pShardMem);
     virtual ~MemoryCacheLayer();
 
     virtual Result Init() override;
 
-    Result GetMemoryCacheSize(size_t* pCurCount, size_t* pCurSize) const
-    {
-        *pCurCount = m_curCount;
-        *pCurSize  = m_curSize;
-
-        return Result::Success;
-    }
+    Result GetMemoryCacheSize(size_t* pCurCount, size_t* pCurSize) const;
 
     Result GetMemoryCacheHashIds(size_t curCount, Hash128* pHashIds);
 
+    Result GetMemoryCacheShardStats(uint32* pNumShards, MemoryCacheShardStats* pStats) const;
+
+    // Returns the number of shards a cache created with the given requested count will use.
+    static uint32 GetShardCount(uint32 numShards) { return Min(MaxShards, Pow2Pad(Max(numShards, 1u))); }
+
+    // Returns the size of the placement memory which must follow the layer object for the given shard count.
+    static size_t GetShardMemSize(uint32 numShards) { return (sizeof(Shard) * GetShardCount(numShards)); }
+
 protected:
     virtual Result QueryInternal(
         const Hash128*  pHashId,
@@ -80,13 +89,25 @@ private:
     PAL_DISALLOW_COPY_AND_ASSIGN(MemoryCacheLayer);
     PAL_DISALLOW_DEFAULT_CTOR(MemoryCacheLayer);
     class Entry;
+    struct Shard;
+
+    static constexpr uint32 MaxShards         = 64;
+    static constexpr uint32 LookupInitEntries = 2048;
+
+    Shard* GetShard(const Hash128& hashId) const { return &m_pShards[hashId.dwords[3] & (m_numShards - 1)]; }
+    bool   UseClock() const { return (m_numShards > 1); }
+
+    Result AddEntryToCache(Shard* pShard, Entry* pEntry);
+    Result EvictEntryFromCache(Shard* pShard, Entry* pEntry);
 
-    Result AddEntryToCache(Entry* pEntry);
-    Result EvictEntryFromCache(Entry* pEntry);
+    Entry* SelectVictim(Shard* pShard);
+    Result EnsureAvailableSpace(Shard* pShard, size_t entrySize, size_t entryCount);
+    void   EvictEntries(Shard* pShard, size_t entrySize, size_t entryCount);
 
-    Result EnsureAvailableSpace(size_t entrySize, size_t entryCount);
-    Result EvictEntryByCount(size_t numToEvict = 1);
-    Result EvictEntryBySize(size_t minSizeToEvict);
+    // The size and count limits are shared by all shards, so a single shard may use the whole budget.  Other shards may
+    // store concurrently, so this is only a snapshot of the shared counters.
+    bool HasAvailableSpace(size_t entrySize, size_t entryCount) const
+        { return ((m_curSize + entrySize) <= m_maxSize) && ((m_curCount + entryCount) <= m_maxCount); }
 
     // IntrusiveList capable cache entry data structure
     class Entry
@@ -95,7 +116,7 @@ private:
         using List = IntrusiveList<Entry>;
         using Node = IntrusiveListNode<Entry>;
         using Iter = IntrusiveListIterator<Entry>;
-        using Map  = HashMap<Hash128, Entry*, ForwardAllocator>;
+        using Map  = OpenHashMap<Hash128, Entry*, ForwardAllocator>;
 
         static Entry* Create(
             ForwardAllocator* pAllocator,
@@ -134,6 +155,24 @@ private:
 
         Node* ListNode() { return &m_node; }
 
+        // Sets the CLOCK reference bit.  May be called concurrently by threads holding the shard lock in shared mode;
+        // the bit is read first so that hot entries don't bounce their cache line between cores.
+        void MarkReferenced()
+        {
+            if (m_referenced == 0)
+            {
+                AtomicExchange(&m_referenced, 1);
+            }
+        }
+
+        // Clears the CLOCK reference bit and returns its previous state.  Requires the shard lock in exclusive mode.
+        bool ClearReferenced()
+        {
+            const bool referenced = (m_referenced != 0);
+            m_referenced = 0;
+            return referenced;
+        }
+
         void Destroy()
         {
             ForwardAllocator* pAllocator = m_pAllocator;
@@ -151,7 +190,8 @@ private:
             m_node       { this },
             m_hashId     {},
             m_pData      { nullptr },
-            m_dataSize   { 0 }
+            m_dataSize   { 0 },
+            m_referenced { 0 }
         {
             PAL_ASSERT(m_pAllocator != nullptr);
         }
@@ -163,20 +203,62 @@ private:
         Hash128                 m_hashId;
         void*                   m_pData;
         size_t                  m_dataSize;
+        volatile uint32         m_referenced;
+    };
+
+    // One independently locked partition of the cache.  Ends in a cache line of padding so that the lock and counters
+    // of neighboring shards don't share a line.
+    struct Shard
+    {
+        Shard(ForwardAllocator* pAllocator, uint32 initEntries)
+            :
+            lock            {},
+            curSize         { 0 },
+            curCount        { 0 },
+            recentEntryList {},
+            entryLookup     { initEntries, pAllocator },
+            hits            { 0 },
+            misses          { 0 },
+            contentions     { 0 }
+        {
+        }
+
+        RWLock          lock;
+        size_t          curSize;
+        size_t          curCount;
+        Entry::List     recentEntryList;
+        Entry::Map      entryLookup;
+        volatile uint64 hits;
+        volatile uint64 misses;
+        volatile uint64 contentions;
+        uint8           padding[PAL_CACHE_LINE_BYTES];
+    };
+
+    // Acquires a shard lock, counting the acquisition as contended if the lock could not be taken immediately.
+    template <RWLock::LockType type>
+    class ShardLockAuto
+    {
+    public:
+        explicit ShardLockAuto(Shard* pShard);
+        ~ShardLockAuto();
+
+    private:
+        Shard* const m_pShard;
+
+        PAL_DISALLOW_DEFAULT_CTOR(ShardLockAuto);
+        PAL_DISALLOW_COPY_AND_ASSIGN(ShardLockAuto);
     };
 
     const size_t m_maxSize;
     const size_t m_maxCount;
     const bool   m_evictOnFull;
     const bool   m_evictDuplicates;
+    const uint32 m_numShards;
 
-    RWLock       m_lock;
-
-    size_t       m_curSize;
-    size_t       m_curCount;
+    volatile uint64 m_curSize;   // Total data size of the entries in all shards.
+    volatile uint64 m_curCount;  // Total number of entries in all shards.
 
-    Entry::List  m_recentEntryList;
-    Entry::Map   m_entryLookup;
+    Shard* const m_pShards;
 };
 
 } //namespace Util
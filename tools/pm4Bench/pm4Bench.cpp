@@ -0,0 +1,1235 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+// pm4Bench: an offline command buffer recording benchmark.
+//
+// Creates a null device (no GPU or kernel driver needed), records scripted sequences of draws, dispatches and
+// barriers into a universal command buffer and reports the CPU cost and PM4 footprint of each sequence.  Every
+// scenario is recorded twice: once with the PM4 optimizer disabled and once with it enabled, so the optimizer's
+// savings can be read straight off the report.
+//
+// Dispatch scenarios use the compute pipeline embedded in GpuUtil's TimeGraph.  Draw scenarios need a client-supplied
+// graphics pipeline ELF (--gfxPipeline) for the selected null GPU and are skipped without one.
+//
+// With --replay, the scenarios are replaced by a command buffer capture written by the interface logger's binary
+// capture mode, which is replayed on the null device to measure the CPU cost of a real application's recording.
+//
+// With --faultLatency, every command buffer is recorded into a brand new command allocator so that each chunk is
+// written to for the first time, and the per-dispatch CPU latency distribution is reported with and without chunk
+// pre-faulting and huge page backing.  This shows how much of the recording tail latency is page faults.
+
+#include "pal.h"
+#include "palCmdAllocator.h"
+#include "palCmdBuffer.h"
+#include "palCmdBufferReplayer.h"
+#include "palColorBlendState.h"
+#include "palDepthStencilState.h"
+#include "palDevice.h"
+#include "palDeveloperHooks.h"
+#include "palFile.h"
+#include "palLib.h"
+#include "palMsaaState.h"
+#include "palPipeline.h"
+#include "palPlatform.h"
+#include "palSysMemory.h"
+#include "palSysUtil.h"
+
+#include "timeGraph/g_timeGraphComputePipelineInitImpl.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace Pal;
+using namespace Util;
+
+namespace Pm4Bench
+{
+
+using TimeGraphComputePipeline = GpuUtil::TimeGraphDraw::TimeGraphComputePipeline;
+
+// Recording scenarios.  Each one records "ops" back-to-back units of work into a single command buffer.
+enum class Scenario : uint32
+{
+    Dispatch = 0,    // Set user data + dispatch.
+    DispatchBarrier, // Set user data + dispatch + CS->CS barrier.
+    Draw,            // Set user data + draw with all other state bound once.
+    DrawRebind,      // Rebind pipeline and all state objects before every draw (optimizer best case).
+    DrawBarrier,     // Draw + color target->shader read barrier.
+    Count
+};
+
+static const char* ScenarioNames[] =
+{
+    "dispatch",
+    "dispatchBarrier",
+    "draw",
+    "drawRebind",
+    "drawBarrier",
+};
+
+static_assert(sizeof(ScenarioNames) / sizeof(ScenarioNames[0]) == static_cast<size_t>(Scenario::Count),
+              "ScenarioNames does not match the Scenario enum!");
+
+constexpr uint32  DefaultIterations      = 64;
+constexpr uint32  DefaultOpsPerIteration = 1024;
+constexpr uint32  NumUserDataEntries     = 8;
+constexpr gpusize CmdAllocSize           = 2 * 1024 * 1024;
+constexpr gpusize CmdSuballocSize        = 64 * 1024;
+constexpr gpusize ScratchAllocSize       = 64 * 1024;
+constexpr uint32  DefaultPrefaultChunks  = 4;
+
+// Command line options.
+struct Options
+{
+    NullGpuId   nullGpuId;
+    uint32      iterations;
+    uint32      opsPerIteration;
+    const char* pGfxPipelinePath;
+    const char* pReplayPath;
+    bool        listDevices;
+    bool        faultLatency;
+    uint32      prefaultChunks;
+};
+
+// Everything the benchmark creates on the null device.
+struct Context
+{
+    GenericAllocator    allocator;
+    IPlatform*          pPlatform;
+    IDevice*            pDevice;
+    ICmdAllocator*      pCmdAllocator;
+    ICmdBuffer*         pCmdBuffer;
+    IPipeline*          pComputePipelines[static_cast<size_t>(TimeGraphComputePipeline::Count)];
+    IPipeline*          pGfxPipeline;
+    IMsaaState*         pMsaaState;
+    IColorBlendState*   pColorBlendState;
+    IDepthStencilState* pDepthStencilState;
+    void*               pGfxPipelineBinary;
+    size_t              gfxPipelineBinarySize;
+
+    // Command allocator GPU memory traffic, counted by the developer callback.
+    uint32              cmdAllocations;
+    gpusize             cmdAllocationBytes;
+};
+
+// Results of recording one scenario for all iterations.
+struct ScenarioResult
+{
+    uint64  ops;             // Total draws/dispatches recorded.
+    int64   ticks;           // Total CPU ticks spent between Begin() and End().
+    uint64  commandBytes;    // Total command (PM4) bytes written.
+    uint64  embeddedBytes;   // Total embedded data bytes written.
+    uint64  chunks;          // Lower bound on the number of command chunks consumed.
+    uint32  cmdAllocations;  // Number of command allocator GPU memory allocations made while recording.
+};
+
+// =====================================================================================================================
+// Counts the GPU memory allocations made on behalf of the command allocator.
+static void PAL_STDCALL DeveloperCallback(
+    void*                   pPrivateData,
+    const uint32            deviceIndex,
+    Developer::CallbackType type,
+    void*                   pCbData)
+{
+    Context*const pContext = static_cast<Context*>(pPrivateData);
+
+    if (type == Developer::CallbackType::AllocGpuMemory)
+    {
+        const auto*const pData = static_cast<const Developer::GpuMemoryData*>(pCbData);
+
+        if (pData->flags.isCmdAllocator)
+        {
+            pContext->cmdAllocations++;
+            pContext->cmdAllocationBytes += pData->size;
+        }
+    }
+}
+
+// =====================================================================================================================
+static void PrintUsage()
+{
+    printf("Usage: pm4Bench [options]\n"
+           "  --gpu <name>          Null GPU to record for (default: first GFX9 device).\n"
+           "  --iterations <n>      Command buffers recorded per scenario (default: %u).\n"
+           "  --ops <n>             Draws or dispatches per command buffer (default: %u).\n"
+           "  --gfxPipeline <file>  Graphics pipeline ELF for the selected GPU; enables the draw scenarios.\n"
+           "  --replay <file>       Replay an interface logger binary capture --iterations times instead.\n"
+           "  --faultLatency        Report per-dispatch latency percentiles with and without chunk pre-faulting.\n"
+           "  --prefaultChunks <n>  Chunks to pre-fault ahead of the write pointer for --faultLatency (default: %u).\n"
+           "  --list                List the available null GPUs and exit.\n",
+           DefaultIterations,
+           DefaultOpsPerIteration,
+           DefaultPrefaultChunks);
+}
+
+// =====================================================================================================================
+// Looks up a null GPU by name.  Returns false if no such GPU is known to PAL.
+static bool FindNullGpu(
+    const char* pName,
+    NullGpuId*  pNullGpuId)
+{
+    NullGpuInfo nullGpus[static_cast<uint32>(NullGpuId::Max)] = {};
+    uint32      numGpus = static_cast<uint32>(NullGpuId::Max);
+
+    bool found = false;
+
+    if (EnumerateNullDevices(&numGpus, &nullGpus[0]) == Pal::Result::Success)
+    {
+        for (uint32 idx = 0; (idx < numGpus) && (found == false); ++idx)
+        {
+            if ((nullGpus[idx].pGpuName != nullptr) && (strcmp(nullGpus[idx].pGpuName, pName) == 0))
+            {
+                (*pNullGpuId) = nullGpus[idx].nullGpuId;
+                found         = true;
+            }
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+static void ListNullGpus()
+{
+    NullGpuInfo nullGpus[static_cast<uint32>(NullGpuId::Max)] = {};
+    uint32      numGpus = static_cast<uint32>(NullGpuId::Max);
+
+    if (EnumerateNullDevices(&numGpus, &nullGpus[0]) == Pal::Result::Success)
+    {
+        for (uint32 idx = 0; idx < numGpus; ++idx)
+        {
+            printf("%s\n", nullGpus[idx].pGpuName);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Returns false if the command line could not be parsed.
+static bool ParseOptions(
+    int      argc,
+    char**   argv,
+    Options* pOptions)
+{
+    pOptions->nullGpuId        = NullGpuId::Vega10;
+    pOptions->iterations       = DefaultIterations;
+    pOptions->opsPerIteration  = DefaultOpsPerIteration;
+    pOptions->pGfxPipelinePath = nullptr;
+    pOptions->pReplayPath      = nullptr;
+    pOptions->listDevices      = false;
+    pOptions->faultLatency     = false;
+    pOptions->prefaultChunks   = DefaultPrefaultChunks;
+
+    bool valid = true;
+
+    for (int arg = 1; valid && (arg < argc); ++arg)
+    {
+        const bool hasValue = ((arg + 1) < argc);
+
+        if (strcmp(argv[arg], "--list") == 0)
+        {
+            pOptions->listDevices = true;
+        }
+        else if ((strcmp(argv[arg], "--gpu") == 0) && hasValue)
+        {
+            valid = FindNullGpu(argv[++arg], &pOptions->nullGpuId);
+        }
+        else if ((strcmp(argv[arg], "--iterations") == 0) && hasValue)
+        {
+            pOptions->iterations = static_cast<uint32>(strtoul(argv[++arg], nullptr, 0));
+            valid = (pOptions->iterations > 0);
+        }
+        else if ((strcmp(argv[arg], "--ops") == 0) && hasValue)
+        {
+            pOptions->opsPerIteration = static_cast<uint32>(strtoul(argv[++arg], nullptr, 0));
+            valid = (pOptions->opsPerIteration > 0);
+        }
+        else if ((strcmp(argv[arg], "--gfxPipeline") == 0) && hasValue)
+        {
+            pOptions->pGfxPipelinePath = argv[++arg];
+        }
+        else if ((strcmp(argv[arg], "--replay") == 0) && hasValue)
+        {
+            pOptions->pReplayPath = argv[++arg];
+        }
+        else if (strcmp(argv[arg], "--faultLatency") == 0)
+        {
+            pOptions->faultLatency = true;
+        }
+        else if ((strcmp(argv[arg], "--prefaultChunks") == 0) && hasValue)
+        {
+            pOptions->prefaultChunks = static_cast<uint32>(strtoul(argv[++arg], nullptr, 0));
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+
+    return valid;
+}
+
+// =====================================================================================================================
+// Reads the client graphics pipeline ELF into memory.
+static Pal::Result LoadGfxPipelineBinary(
+    Context*    pContext,
+    const char* pPath)
+{
+    Pal::Result result = Pal::Result::ErrorInvalidValue;
+
+    const size_t fileSize = File::GetFileSize(pPath);
+
+    if (fileSize > 0)
+    {
+        pContext->pGfxPipelineBinary = PAL_MALLOC(fileSize, &pContext->allocator, AllocInternal);
+        result = (pContext->pGfxPipelineBinary != nullptr) ? Pal::Result::Success : Pal::Result::ErrorOutOfMemory;
+    }
+
+    File file;
+
+    if (result == Pal::Result::Success)
+    {
+        result = file.Open(pPath, FileAccessRead | FileAccessBinary);
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        result = file.Read(pContext->pGfxPipelineBinary, fileSize, &pContext->gfxPipelineBinarySize);
+        file.Close();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates the platform and the null device and finalizes the device without any engines; the benchmark only records.
+static Pal::Result InitDevice(
+    Context*       pContext,
+    const Options& options)
+{
+    Pal::Result result = Pal::Result::ErrorOutOfMemory;
+
+    void* pPlatformMem = PAL_MALLOC(GetPlatformSize(), &pContext->allocator, AllocInternal);
+
+    if (pPlatformMem != nullptr)
+    {
+        PlatformCreateInfo createInfo = {};
+        createInfo.pSettingsPath          = "/etc/amd";
+        createInfo.flags.createNullDevice = 1;
+        createInfo.nullGpuId              = options.nullGpuId;
+
+        result = CreatePlatform(createInfo, pPlatformMem, &pContext->pPlatform);
+
+        if (result != Pal::Result::Success)
+        {
+            PAL_SAFE_FREE(pPlatformMem, &pContext->allocator);
+        }
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        IPlatform::InstallDeveloperCb(pContext->pPlatform, &DeveloperCallback, pContext);
+
+        uint32   numDevices = 0;
+        IDevice* pDevices[MaxDevices] = {};
+
+        result = pContext->pPlatform->EnumerateDevices(&numDevices, &pDevices[0]);
+
+        if ((result == Pal::Result::Success) && (numDevices == 0))
+        {
+            result = Pal::Result::ErrorInitializationFailed;
+        }
+
+        pContext->pDevice = pDevices[0];
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        result = pContext->pDevice->CommitSettingsAndInit();
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        const DeviceFinalizeInfo finalizeInfo = {};
+        result = pContext->pDevice->Finalize(finalizeInfo);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Fills out the command allocator create info which every command buffer in the benchmark uses by default.
+static void InitCmdAllocatorCreateInfo(
+    CmdAllocatorCreateInfo* pAllocInfo)
+{
+    memset(pAllocInfo, 0, sizeof(*pAllocInfo));
+
+    pAllocInfo->flags.autoMemoryReuse                      = 1;
+    pAllocInfo->allocInfo[CommandDataAlloc].allocHeap      = GpuHeapGartCacheable;
+    pAllocInfo->allocInfo[CommandDataAlloc].allocSize      = CmdAllocSize;
+    pAllocInfo->allocInfo[CommandDataAlloc].suballocSize   = CmdSuballocSize;
+    pAllocInfo->allocInfo[EmbeddedDataAlloc].allocHeap     = GpuHeapGartCacheable;
+    pAllocInfo->allocInfo[EmbeddedDataAlloc].allocSize     = CmdAllocSize;
+    pAllocInfo->allocInfo[EmbeddedDataAlloc].suballocSize  = CmdSuballocSize;
+    pAllocInfo->allocInfo[GpuScratchMemAlloc].allocHeap    = GpuHeapInvisible;
+    pAllocInfo->allocInfo[GpuScratchMemAlloc].allocSize    = ScratchAllocSize;
+    pAllocInfo->allocInfo[GpuScratchMemAlloc].suballocSize = ScratchAllocSize;
+}
+
+// =====================================================================================================================
+static Pal::Result CreateCmdAllocator(
+    Context*                      pContext,
+    const CmdAllocatorCreateInfo& allocInfo,
+    ICmdAllocator**               ppCmdAllocator)
+{
+    Pal::Result result = Pal::Result::Success;
+
+    void* pAllocatorMem = PAL_MALLOC(pContext->pDevice->GetCmdAllocatorSize(allocInfo, &result),
+                                     &pContext->allocator,
+                                     AllocInternal);
+
+    if (pAllocatorMem == nullptr)
+    {
+        result = Pal::Result::ErrorOutOfMemory;
+    }
+    else if (result == Pal::Result::Success)
+    {
+        result = pContext->pDevice->CreateCmdAllocator(allocInfo, pAllocatorMem, ppCmdAllocator);
+    }
+
+    if ((result != Pal::Result::Success) && (pAllocatorMem != nullptr))
+    {
+        PAL_SAFE_FREE(pAllocatorMem, &pContext->allocator);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+static Pal::Result InitCmdBuffer(
+    Context* pContext)
+{
+    CmdAllocatorCreateInfo allocInfo;
+    InitCmdAllocatorCreateInfo(&allocInfo);
+
+    Pal::Result result = CreateCmdAllocator(pContext, allocInfo, &pContext->pCmdAllocator);
+
+    if (result == Pal::Result::Success)
+    {
+        CmdBufferCreateInfo createInfo = {};
+        createInfo.pCmdAllocator = pContext->pCmdAllocator;
+        createInfo.queueType     = QueueTypeUniversal;
+        createInfo.engineType    = EngineTypeUniversal;
+
+        void* pCmdBufferMem = PAL_MALLOC(pContext->pDevice->GetCmdBufferSize(createInfo, &result),
+                                         &pContext->allocator,
+                                         AllocInternal);
+
+        if (pCmdBufferMem == nullptr)
+        {
+            result = Pal::Result::ErrorOutOfMemory;
+        }
+        else if (result == Pal::Result::Success)
+        {
+            result = pContext->pDevice->CreateCmdBuffer(createInfo, pCmdBufferMem, &pContext->pCmdBuffer);
+        }
+
+        if ((result != Pal::Result::Success) && (pCmdBufferMem != nullptr))
+        {
+            PAL_SAFE_FREE(pCmdBufferMem, &pContext->allocator);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates the graphics pipeline and the state objects used by the draw scenarios.
+static Pal::Result InitGraphicsState(
+    Context* pContext)
+{
+    IDevice*const pDevice = pContext->pDevice;
+    Pal::Result   result  = Pal::Result::Success;
+
+    GraphicsPipelineCreateInfo pipeInfo = {};
+    pipeInfo.pPipelineBinary                    = pContext->pGfxPipelineBinary;
+    pipeInfo.pipelineBinarySize                 = pContext->gfxPipelineBinarySize;
+    pipeInfo.iaState.topologyInfo.primitiveType = PrimitiveType::Triangle;
+    pipeInfo.cbState.target[0].swizzledFormat   =
+        { ChNumFormat::X8Y8Z8W8_Unorm,
+          { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W } };
+    pipeInfo.cbState.target[0].channelWriteMask = 0xF;
+
+    void* pMemory = PAL_MALLOC(pDevice->GetGraphicsPipelineSize(pipeInfo, &result),
+                               &pContext->allocator,
+                               AllocInternal);
+
+    if (pMemory == nullptr)
+    {
+        result = Pal::Result::ErrorOutOfMemory;
+    }
+    else if (result == Pal::Result::Success)
+    {
+        result = pDevice->CreateGraphicsPipeline(pipeInfo, pMemory, &pContext->pGfxPipeline);
+    }
+
+    if ((result != Pal::Result::Success) && (pMemory != nullptr))
+    {
+        PAL_SAFE_FREE(pMemory, &pContext->allocator);
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        MsaaStateCreateInfo msaaInfo = {};
+        msaaInfo.coverageSamples         = 1;
+        msaaInfo.exposedSamples          = 1;
+        msaaInfo.pixelShaderSamples      = 1;
+        msaaInfo.depthStencilSamples     = 1;
+        msaaInfo.shaderExportMaskSamples = 1;
+        msaaInfo.sampleMask              = 1;
+        msaaInfo.sampleClusters          = 1;
+        msaaInfo.alphaToCoverageSamples  = 1;
+        msaaInfo.occlusionQuerySamples   = 1;
+
+        pMemory = PAL_MALLOC(pDevice->GetMsaaStateSize(msaaInfo, &result), &pContext->allocator, AllocInternal);
+
+        if (pMemory == nullptr)
+        {
+            result = Pal::Result::ErrorOutOfMemory;
+        }
+        else if (result == Pal::Result::Success)
+        {
+            result = pDevice->CreateMsaaState(msaaInfo, pMemory, &pContext->pMsaaState);
+        }
+
+        if ((result != Pal::Result::Success) && (pMemory != nullptr))
+        {
+            PAL_SAFE_FREE(pMemory, &pContext->allocator);
+        }
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        const ColorBlendStateCreateInfo blendInfo = {};
+
+        pMemory = PAL_MALLOC(pDevice->GetColorBlendStateSize(blendInfo, &result), &pContext->allocator, AllocInternal);
+
+        if (pMemory == nullptr)
+        {
+            result = Pal::Result::ErrorOutOfMemory;
+        }
+        else if (result == Pal::Result::Success)
+        {
+            result = pDevice->CreateColorBlendState(blendInfo, pMemory, &pContext->pColorBlendState);
+        }
+
+        if ((result != Pal::Result::Success) && (pMemory != nullptr))
+        {
+            PAL_SAFE_FREE(pMemory, &pContext->allocator);
+        }
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        DepthStencilStateCreateInfo depthInfo = {};
+        depthInfo.depthFunc = CompareFunc::Always;
+
+        pMemory = PAL_MALLOC(pDevice->GetDepthStencilStateSize(depthInfo, &result),
+                             &pContext->allocator,
+                             AllocInternal);
+
+        if (pMemory == nullptr)
+        {
+            result = Pal::Result::ErrorOutOfMemory;
+        }
+        else if (result == Pal::Result::Success)
+        {
+            result = pDevice->CreateDepthStencilState(depthInfo, pMemory, &pContext->pDepthStencilState);
+        }
+
+        if ((result != Pal::Result::Success) && (pMemory != nullptr))
+        {
+            PAL_SAFE_FREE(pMemory, &pContext->allocator);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Binds the pipeline and all graphics state objects which the draw scenarios need.
+static void BindGraphicsState(
+    const Context& context,
+    ICmdBuffer*    pCmdBuffer)
+{
+    PipelineBindParams bindParams = {};
+    bindParams.pipelineBindPoint = PipelineBindPoint::Graphics;
+    bindParams.pPipeline         = context.pGfxPipeline;
+
+    pCmdBuffer->CmdBindPipeline(bindParams);
+    pCmdBuffer->CmdBindMsaaState(context.pMsaaState);
+    pCmdBuffer->CmdBindColorBlendState(context.pColorBlendState);
+    pCmdBuffer->CmdBindDepthStencilState(context.pDepthStencilState);
+
+    ViewportParams viewports = {};
+    viewports.count                  = 1;
+    viewports.viewports[0].width     = 1920.0f;
+    viewports.viewports[0].height    = 1080.0f;
+    viewports.viewports[0].maxDepth  = 1.0f;
+    viewports.viewports[0].origin    = PointOrigin::UpperLeft;
+    viewports.horzDiscardRatio       = 1.0f;
+    viewports.vertDiscardRatio       = 1.0f;
+    viewports.horzClipRatio          = 1.0f;
+    viewports.vertClipRatio          = 1.0f;
+
+    pCmdBuffer->CmdSetViewports(viewports);
+
+    ScissorRectParams scissors = {};
+    scissors.count                    = 1;
+    scissors.scissors[0].extent.width  = 1920;
+    scissors.scissors[0].extent.height = 1080;
+
+    pCmdBuffer->CmdSetScissorRects(scissors);
+}
+
+// =====================================================================================================================
+// Issues a global barrier which waits for srcPoint before continuing at dstPoint.
+static void CmdGlobalBarrier(
+    ICmdBuffer*  pCmdBuffer,
+    HwPipePoint  srcPoint,
+    HwPipePoint  dstPoint,
+    uint32       srcCacheMask,
+    uint32       dstCacheMask)
+{
+    BarrierInfo barrier = {};
+    barrier.waitPoint          = dstPoint;
+    barrier.pipePointWaitCount = 1;
+    barrier.pPipePoints        = &srcPoint;
+    barrier.globalSrcCacheMask = srcCacheMask;
+    barrier.globalDstCacheMask = dstCacheMask;
+
+    pCmdBuffer->CmdBarrier(barrier);
+}
+
+// =====================================================================================================================
+// Records one command buffer's worth of the given scenario.
+static void RecordScenario(
+    const Context& context,
+    Scenario       scenario,
+    uint32         ops)
+{
+    ICmdBuffer*const pCmdBuffer = context.pCmdBuffer;
+
+    uint32 userData[NumUserDataEntries] = {};
+
+    const bool isDispatch = ((scenario == Scenario::Dispatch) || (scenario == Scenario::DispatchBarrier));
+
+    if (isDispatch)
+    {
+        PipelineBindParams bindParams = {};
+        bindParams.pipelineBindPoint = PipelineBindPoint::Compute;
+        bindParams.pPipeline         =
+            context.pComputePipelines[static_cast<size_t>(TimeGraphComputePipeline::TimeGraph)];
+
+        pCmdBuffer->CmdBindPipeline(bindParams);
+    }
+    else
+    {
+        BindGraphicsState(context, pCmdBuffer);
+    }
+
+    for (uint32 op = 0; op < ops; ++op)
+    {
+        // Only the first user-data entry changes per op; the rest are redundant and exercise the PM4 optimizer.
+        userData[0] = op;
+
+        switch (scenario)
+        {
+        case Scenario::Dispatch:
+        case Scenario::DispatchBarrier:
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, NumUserDataEntries, &userData[0]);
+            pCmdBuffer->CmdDispatch(1, 1, 1);
+
+            if (scenario == Scenario::DispatchBarrier)
+            {
+                CmdGlobalBarrier(pCmdBuffer, HwPipePostCs, HwPipePreCs, CoherShader, CoherShader);
+            }
+            break;
+
+        case Scenario::DrawRebind:
+            BindGraphicsState(context, pCmdBuffer);
+            // Fall through to record the draw itself.
+        case Scenario::Draw:
+        case Scenario::DrawBarrier:
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, 0, NumUserDataEntries, &userData[0]);
+            pCmdBuffer->CmdDraw(0, 3, 0, 1);
+
+            if (scenario == Scenario::DrawBarrier)
+            {
+                CmdGlobalBarrier(pCmdBuffer, HwPipeBottom, HwPipePostIndexFetch, CoherColorTarget, CoherShader);
+            }
+            break;
+
+        default:
+            PAL_NEVER_CALLED();
+            break;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Records the given scenario for all iterations and accumulates the results.
+static Pal::Result RunScenario(
+    Context*       pContext,
+    const Options& options,
+    Scenario       scenario,
+    bool           optimize,
+    ScenarioResult* pResult)
+{
+    ICmdBuffer*const pCmdBuffer = pContext->pCmdBuffer;
+
+    memset(pResult, 0, sizeof(*pResult));
+
+    const uint32 cmdAllocationsBefore = pContext->cmdAllocations;
+
+    Pal::Result result = Pal::Result::Success;
+
+    for (uint32 iteration = 0; (iteration < options.iterations) && (result == Pal::Result::Success); ++iteration)
+    {
+        result = pCmdBuffer->Reset(pContext->pCmdAllocator, true);
+
+        CmdBufferBuildInfo buildInfo = {};
+        buildInfo.flags.optimizeOneTimeSubmit = 1;
+        buildInfo.flags.optimizeGpuSmallBatch = optimize;
+
+        const int64 startTicks = GetPerfCpuTime();
+
+        if (result == Pal::Result::Success)
+        {
+            result = pCmdBuffer->Begin(buildInfo);
+        }
+
+        if (result == Pal::Result::Success)
+        {
+            RecordScenario(*pContext, scenario, options.opsPerIteration);
+            result = pCmdBuffer->End();
+        }
+
+        pResult->ticks += (GetPerfCpuTime() - startTicks);
+
+        if (result == Pal::Result::Success)
+        {
+            const uint32 commandBytes = pCmdBuffer->GetUsedSize(CommandDataAlloc);
+
+            pResult->ops           += options.opsPerIteration;
+            pResult->commandBytes  += commandBytes;
+            pResult->embeddedBytes += pCmdBuffer->GetUsedSize(EmbeddedDataAlloc);
+            pResult->chunks        += (commandBytes + CmdSuballocSize - 1) / CmdSuballocSize;
+        }
+    }
+
+    pResult->cmdAllocations = (pContext->cmdAllocations - cmdAllocationsBefore);
+
+    return result;
+}
+
+// =====================================================================================================================
+static void PrintHeader()
+{
+    printf("%-16s %-4s %12s %12s %12s %10s %10s %10s\n",
+           "scenario", "opt", "ops", "ns/op", "dwords/op", "embed/op", "chunks", "gpuAllocs");
+}
+
+// =====================================================================================================================
+static void PrintResult(
+    Scenario      scenario,
+    bool          optimize,
+    const ScenarioResult& result,
+    double        ticksPerNs)
+{
+    const double ops = static_cast<double>(result.ops);
+
+    printf("%-16s %-4s %12llu %12.1f %12.2f %10.2f %10llu %10u\n",
+           ScenarioNames[static_cast<uint32>(scenario)],
+           optimize ? "on" : "off",
+           static_cast<unsigned long long>(result.ops),
+           static_cast<double>(result.ticks) / ticksPerNs / ops,
+           static_cast<double>(result.commandBytes / sizeof(uint32)) / ops,
+           static_cast<double>(result.embeddedBytes / sizeof(uint32)) / ops,
+           static_cast<unsigned long long>(result.chunks),
+           result.cmdAllocations);
+}
+
+// =====================================================================================================================
+// Prints the PM4 optimizer's savings for one scenario.
+static void PrintSavings(
+    Scenario      scenario,
+    const ScenarioResult& unoptimized,
+    const ScenarioResult& optimized)
+{
+    const double saved = (unoptimized.commandBytes > 0)
+        ? (100.0 * (static_cast<double>(unoptimized.commandBytes) - static_cast<double>(optimized.commandBytes)) /
+           static_cast<double>(unoptimized.commandBytes))
+        : 0.0;
+
+    printf("%-16s PM4 optimizer removed %.1f%% of command dwords (%llu -> %llu bytes)\n",
+           ScenarioNames[static_cast<uint32>(scenario)],
+           saved,
+           static_cast<unsigned long long>(unoptimized.commandBytes),
+           static_cast<unsigned long long>(optimized.commandBytes));
+}
+
+// =====================================================================================================================
+// Replays a binary command buffer capture and prints the CPU cost of each captured function.
+static Pal::Result RunReplay(
+    Context*       pContext,
+    const Options& options)
+{
+    static const char* FuncNames[] =
+    {
+        "CreateCmdAllocator",
+        "CreateCmdBuffer",
+        "CreateComputePipeline",
+        "CreateGraphicsPipeline",
+        "CreateMsaaState",
+        "CreateColorBlendState",
+        "CreateDepthStencilState",
+        "Begin",
+        "End",
+        "Reset",
+        "CmdBindPipeline",
+        "CmdBindMsaaState",
+        "CmdBindColorBlendState",
+        "CmdBindDepthStencilState",
+        "CmdSetUserData",
+        "CmdSetVertexBuffers",
+        "CmdBindIndexData",
+        "CmdSetBlendConst",
+        "CmdSetInputAssemblyState",
+        "CmdSetTriangleRasterState",
+        "CmdSetPointLineRasterState",
+        "CmdSetDepthBiasState",
+        "CmdSetDepthBounds",
+        "CmdSetStencilRefMasks",
+        "CmdSetViewports",
+        "CmdSetScissorRects",
+        "CmdSetGlobalScissor",
+        "CmdBarrier",
+        "CmdDraw",
+        "CmdDrawIndexed",
+        "CmdDispatch",
+        "CmdDispatchOffset",
+    };
+
+    constexpr uint32 NumFuncs = static_cast<uint32>(GpuUtil::CmdCapture::Func::Count);
+
+    static_assert(sizeof(FuncNames) / sizeof(FuncNames[0]) == NumFuncs,
+                  "FuncNames does not match the CmdCapture::Func enum!");
+
+    GpuUtil::CmdBufferReplayer replayer(pContext->pPlatform, pContext->pDevice);
+
+    Pal::Result          result = replayer.Init(options.pReplayPath);
+    GpuUtil::ReplayStats totals = {};
+
+    for (uint32 iteration = 0; (iteration < options.iterations) && (result == Pal::Result::Success); ++iteration)
+    {
+        GpuUtil::ReplayStats stats = {};
+        result = replayer.Replay(&stats);
+
+        totals.recordsReplayed += stats.recordsReplayed;
+        totals.recordsSkipped  += stats.recordsSkipped;
+        totals.cmdBuffersBuilt += stats.cmdBuffersBuilt;
+        totals.totalTicks      += stats.totalTicks;
+
+        for (uint32 idx = 0; idx < NumFuncs; ++idx)
+        {
+            totals.callCount[idx] += stats.callCount[idx];
+            totals.callTicks[idx] += stats.callTicks[idx];
+        }
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        const double ticksPerNs = static_cast<double>(GetPerfFrequency()) / 1000000000.0;
+
+        printf("pm4Bench: replayed %s %u times\n\n", options.pReplayPath, options.iterations);
+        printf("%-28s %12s %12s %10s\n", "function", "calls", "total ms", "ns/call");
+
+        for (uint32 idx = 0; idx < NumFuncs; ++idx)
+        {
+            if (totals.callCount[idx] > 0)
+            {
+                const double ns = static_cast<double>(totals.callTicks[idx]) / ticksPerNs;
+
+                printf("%-28s %12llu %12.3f %10.1f\n",
+                       FuncNames[idx],
+                       static_cast<unsigned long long>(totals.callCount[idx]),
+                       ns / 1000000.0,
+                       ns / static_cast<double>(totals.callCount[idx]));
+            }
+        }
+
+        printf("\nrecords replayed: %u, skipped: %u, command buffers built: %u, total: %.3f ms\n",
+               totals.recordsReplayed,
+               totals.recordsSkipped,
+               totals.cmdBuffersBuilt,
+               static_cast<double>(totals.totalTicks) / ticksPerNs / 1000000.0);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// qsort comparator for per-op latencies.
+static int CompareTicks(
+    const void* pLhs,
+    const void* pRhs)
+{
+    const int64 lhs = *static_cast<const int64*>(pLhs);
+    const int64 rhs = *static_cast<const int64*>(pRhs);
+
+    return (lhs < rhs) ? -1 : ((lhs > rhs) ? 1 : 0);
+}
+
+// =====================================================================================================================
+// Records the dispatch scenario into a fresh command allocator per command buffer, timing every dispatch on its own,
+// and prints the resulting latency distribution.  Each allocator is destroyed afterwards so that no chunk is ever
+// written to twice and every page fault the command streams take shows up in the results.
+static Pal::Result RunFaultLatency(
+    Context*       pContext,
+    const Options& options,
+    bool           prefault,
+    double         ticksPerNs)
+{
+    ICmdBuffer*const pCmdBuffer = pContext->pCmdBuffer;
+    const uint32     numSamples = (options.iterations * options.opsPerIteration);
+
+    CmdAllocatorCreateInfo allocInfo;
+    InitCmdAllocatorCreateInfo(&allocInfo);
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 548
+    if (prefault)
+    {
+        allocInfo.flags.sysMemHugePages = 1;
+        allocInfo.prefaultChunkCount    = options.prefaultChunks;
+    }
+#endif
+
+    int64* pSamples = static_cast<int64*>(PAL_MALLOC(numSamples * sizeof(int64), &pContext->allocator, AllocInternal));
+
+    Pal::Result result = (pSamples != nullptr) ? Pal::Result::Success : Pal::Result::ErrorOutOfMemory;
+
+    PipelineBindParams bindParams = {};
+    bindParams.pipelineBindPoint = PipelineBindPoint::Compute;
+    bindParams.pPipeline         =
+        pContext->pComputePipelines[static_cast<size_t>(TimeGraphComputePipeline::TimeGraph)];
+
+    uint32 userData[NumUserDataEntries] = {};
+    uint32 sample                       = 0;
+
+    for (uint32 iteration = 0; (iteration < options.iterations) && (result == Pal::Result::Success); ++iteration)
+    {
+        ICmdAllocator* pCmdAllocator = nullptr;
+
+        result = CreateCmdAllocator(pContext, allocInfo, &pCmdAllocator);
+
+        if (result == Pal::Result::Success)
+        {
+            result = pCmdBuffer->Reset(pCmdAllocator, true);
+        }
+
+        if (result == Pal::Result::Success)
+        {
+            CmdBufferBuildInfo buildInfo = {};
+            buildInfo.flags.optimizeOneTimeSubmit = 1;
+
+            result = pCmdBuffer->Begin(buildInfo);
+        }
+
+        if (result == Pal::Result::Success)
+        {
+            pCmdBuffer->CmdBindPipeline(bindParams);
+
+            for (uint32 op = 0; op < options.opsPerIteration; ++op)
+            {
+                userData[0] = op;
+
+                const int64 startTicks = GetPerfCpuTime();
+
+                pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, NumUserDataEntries, &userData[0]);
+                pCmdBuffer->CmdDispatch(1, 1, 1);
+
+                pSamples[sample++] = (GetPerfCpuTime() - startTicks);
+            }
+
+            result = pCmdBuffer->End();
+        }
+
+        // Move the command buffer back onto the long-lived allocator before destroying this one.
+        const Pal::Result resetResult = pCmdBuffer->Reset(pContext->pCmdAllocator, true);
+
+        if (result == Pal::Result::Success)
+        {
+            result = resetResult;
+        }
+
+        if (pCmdAllocator != nullptr)
+        {
+            pCmdAllocator->Destroy();
+            PAL_SAFE_FREE(pCmdAllocator, &pContext->allocator);
+        }
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        qsort(pSamples, numSamples, sizeof(int64), CompareTicks);
+
+        const auto percentile = [&](double p)
+        {
+            const uint32 idx = Min(static_cast<uint32>(p * numSamples), numSamples - 1);
+            return static_cast<double>(pSamples[idx]) / ticksPerNs;
+        };
+
+        printf("%-10s %8u %12.1f %12.1f %12.1f %12.1f\n",
+               prefault ? "prefault" : "baseline",
+               prefault ? options.prefaultChunks : 0,
+               percentile(0.5),
+               percentile(0.99),
+               percentile(0.999),
+               static_cast<double>(pSamples[numSamples - 1]) / ticksPerNs);
+    }
+
+    PAL_SAFE_FREE(pSamples, &pContext->allocator);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Destroys every object in the context in reverse creation order.
+static void Cleanup(
+    Context* pContext)
+{
+    if (pContext->pCmdBuffer != nullptr)
+    {
+        pContext->pCmdBuffer->Destroy();
+        PAL_SAFE_FREE(pContext->pCmdBuffer, &pContext->allocator);
+    }
+
+    if (pContext->pCmdAllocator != nullptr)
+    {
+        pContext->pCmdAllocator->Destroy();
+        PAL_SAFE_FREE(pContext->pCmdAllocator, &pContext->allocator);
+    }
+
+    if (pContext->pDepthStencilState != nullptr)
+    {
+        pContext->pDepthStencilState->Destroy();
+        PAL_SAFE_FREE(pContext->pDepthStencilState, &pContext->allocator);
+    }
+
+    if (pContext->pColorBlendState != nullptr)
+    {
+        pContext->pColorBlendState->Destroy();
+        PAL_SAFE_FREE(pContext->pColorBlendState, &pContext->allocator);
+    }
+
+    if (pContext->pMsaaState != nullptr)
+    {
+        pContext->pMsaaState->Destroy();
+        PAL_SAFE_FREE(pContext->pMsaaState, &pContext->allocator);
+    }
+
+    if (pContext->pGfxPipeline != nullptr)
+    {
+        pContext->pGfxPipeline->Destroy();
+        PAL_SAFE_FREE(pContext->pGfxPipeline, &pContext->allocator);
+    }
+
+    for (uint32 idx = 0; idx < static_cast<uint32>(TimeGraphComputePipeline::Count); ++idx)
+    {
+        if (pContext->pComputePipelines[idx] != nullptr)
+        {
+            pContext->pComputePipelines[idx]->Destroy();
+            PAL_SAFE_FREE(pContext->pComputePipelines[idx], &pContext->allocator);
+        }
+    }
+
+    PAL_SAFE_FREE(pContext->pGfxPipelineBinary, &pContext->allocator);
+
+    if (pContext->pDevice != nullptr)
+    {
+        pContext->pDevice->Cleanup();
+        pContext->pDevice = nullptr;
+    }
+
+    if (pContext->pPlatform != nullptr)
+    {
+        pContext->pPlatform->Destroy();
+        PAL_SAFE_FREE(pContext->pPlatform, &pContext->allocator);
+    }
+}
+
+} // Pm4Bench
+
+// =====================================================================================================================
+int main(
+    int    argc,
+    char** argv)
+{
+    using namespace Pm4Bench;
+
+    Options options = {};
+
+    if (ParseOptions(argc, argv, &options) == false)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    if (options.listDevices)
+    {
+        ListNullGpus();
+        return 0;
+    }
+
+    Context context = {};
+
+    Pal::Result result = InitDevice(&context, options);
+
+    if ((result == Pal::Result::Success) && (options.pReplayPath != nullptr))
+    {
+        result = RunReplay(&context, options);
+
+        if (result != Pal::Result::Success)
+        {
+            fprintf(stderr, "pm4Bench: failed to replay %s with result %d\n",
+                    options.pReplayPath,
+                    static_cast<int32>(result));
+        }
+
+        Cleanup(&context);
+
+        return (result == Pal::Result::Success) ? 0 : 1;
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        result = GpuUtil::TimeGraphDraw::CreateTimeGraphComputePipelines(context.pDevice,
+                                                                          &context.allocator,
+                                                                          &context.pComputePipelines[0]);
+    }
+
+    if ((result == Pal::Result::Success) && (options.pGfxPipelinePath != nullptr))
+    {
+        result = LoadGfxPipelineBinary(&context, options.pGfxPipelinePath);
+
+        if (result == Pal::Result::Success)
+        {
+            result = InitGraphicsState(&context);
+        }
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        result = InitCmdBuffer(&context);
+    }
+
+    if ((result == Pal::Result::Success) && options.faultLatency)
+    {
+        const double ticksPerNs = static_cast<double>(GetPerfFrequency()) / 1000000000.0;
+
+        printf("pm4Bench: %u fresh command allocators x %u dispatches, per-dispatch latency in ns\n\n",
+               options.iterations,
+               options.opsPerIteration);
+        printf("%-10s %8s %12s %12s %12s %12s\n", "config", "prefault", "p50", "p99", "p99.9", "max");
+
+        for (uint32 prefault = 0; (prefault < 2) && (result == Pal::Result::Success); ++prefault)
+        {
+            result = RunFaultLatency(&context, options, (prefault != 0), ticksPerNs);
+        }
+
+        if (result != Pal::Result::Success)
+        {
+            fprintf(stderr, "pm4Bench: failed with result %d\n", static_cast<int32>(result));
+        }
+
+        Cleanup(&context);
+
+        return (result == Pal::Result::Success) ? 0 : 1;
+    }
+
+    if (result == Pal::Result::Success)
+    {
+        const double ticksPerNs = static_cast<double>(GetPerfFrequency()) / 1000000000.0;
+
+        printf("pm4Bench: %u command buffers x %u ops per scenario\n\n", options.iterations, options.opsPerIteration);
+        PrintHeader();
+
+        ScenarioResult results[static_cast<uint32>(Scenario::Count)][2] = {};
+
+        for (uint32 idx = 0; (idx < static_cast<uint32>(Scenario::Count)) && (result == Pal::Result::Success); ++idx)
+        {
+            const Scenario scenario   = static_cast<Scenario>(idx);
+            const bool     isDispatch = ((scenario == Scenario::Dispatch) || (scenario == Scenario::DispatchBarrier));
+
+            if (isDispatch || (context.pGfxPipeline != nullptr))
+            {
+                for (uint32 optimize = 0; (optimize < 2) && (result == Pal::Result::Success); ++optimize)
+                {
+                    result = RunScenario(&context, options, scenario, (optimize != 0), &results[idx][optimize]);
+
+                    if (result == Pal::Result::Success)
+                    {
+                        PrintResult(scenario, (optimize != 0), results[idx][optimize], ticksPerNs);
+                    }
+                }
+            }
+        }
+
+        printf("\n");
+
+        for (uint32 idx = 0; (idx < static_cast<uint32>(Scenario::Count)) && (result == Pal::Result::Success); ++idx)
+        {
+            if (results[idx][0].ops > 0)
+            {
+                PrintSavings(static_cast<Scenario>(idx), results[idx][0], results[idx][1]);
+            }
+        }
+
+        if (context.pGfxPipeline == nullptr)
+        {
+            printf("\nDraw scenarios skipped; pass --gfxPipeline <elf> to enable them.\n");
+        }
+    }
+
+    if (result != Pal::Result::Success)
+    {
+        fprintf(stderr, "pm4Bench: failed with result %d\n", static_cast<int32>(result));
+    }
+
+    Cleanup(&context);
+
+    return (result == Pal::Result::Success) ? 0 : 1;
+}